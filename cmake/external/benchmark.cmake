@@ -0,0 +1,41 @@
+# ******************************************************************************
+# Copyright 2017-2020 Intel Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ******************************************************************************
+
+if(TARGET benchmark::benchmark)
+    return()
+endif()
+
+include(FetchContent)
+
+message(STATUS "Fetching Google Benchmark")
+
+SET(BENCHMARK_GIT_LABEL v1.5.2)
+
+FetchContent_Declare(ext_benchmark
+    GIT_REPOSITORY https://github.com/google/benchmark.git
+    GIT_TAG        ${BENCHMARK_GIT_LABEL}
+    GIT_SHALLOW    1)
+
+# gtest is already fetched for the unit tests, the benchmark library does not need its own
+set(BENCHMARK_ENABLE_TESTING OFF CACHE INTERNAL "")
+set(BENCHMARK_ENABLE_GTEST_TESTS OFF CACHE INTERNAL "")
+set(BENCHMARK_ENABLE_INSTALL OFF CACHE INTERNAL "")
+
+FetchContent_GetProperties(ext_benchmark)
+if(NOT ext_benchmark_POPULATED)
+    FetchContent_Populate(ext_benchmark)
+    add_subdirectory(${ext_benchmark_SOURCE_DIR} ${ext_benchmark_BINARY_DIR} EXCLUDE_FROM_ALL)
+endif()
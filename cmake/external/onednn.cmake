@@ -110,6 +110,10 @@ set(DNNL_BUILD_TESTS OFF CACHE INTERNAL "" FORCE)
 set(DNNL_BUILD_EXAMPLES OFF CACHE INTERNAL "" FORCE)
 set(DNNL_ENABLE_CONCURRENT_EXEC ON CACHE INTERNAL "" FORCE)
 set(DNNL_ENABLE_PRIMITIVE_CACHE ON CACHE INTERNAL "" FORCE)
+if(NGRAPH_CPU_SHARED_THREADPOOL_ENABLE)
+    # Primitives run on the thread pool of the CPU executor given to their streams
+    set(DNNL_CPU_RUNTIME "THREADPOOL" CACHE INTERNAL "" FORCE)
+endif()
 if((NOT WIN32) AND NGRAPH_NATIVE_ARCH_ENABLE)
     set(DNNL_ARCH_OPT_FLAGS "-march=${NGRAPH_TARGET_ARCH} -mtune=${NGRAPH_TARGET_ARCH}" CACHE INTERNAL "" FORCE)
 endif()
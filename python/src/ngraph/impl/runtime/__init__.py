@@ -16,5 +16,6 @@
 # flake8: noqa
 
 from _pyngraph.runtime import Backend
+from _pyngraph.runtime import CallFuture
 from _pyngraph.runtime import Executable
 from _pyngraph.runtime import Tensor
@@ -15,14 +15,14 @@
 # ******************************************************************************
 """Provide a layer of abstraction for the ngraph++ runtime environment."""
 import logging
-from typing import Dict, List, Union
+from typing import Any, Dict, List, Optional, Sequence, Tuple, Union
 from enum import Enum
 
 import numpy as np
 
 from ngraph.exceptions import UserInputError
 from ngraph.impl import Function, Node, Shape, PartialShape, serialize, util
-from ngraph.impl.runtime import Backend, Executable, Tensor
+from ngraph.impl.runtime import Backend, CallFuture, Executable, Tensor
 from ngraph.utils.types import NumericData, get_dtype
 
 log = logging.getLogger(__name__)
@@ -106,15 +106,110 @@ class Computation(object):
 
     def __call__(self, *input_values: NumericData) -> List[NumericData]:
         """Run computation on input values and return result."""
+        if self.function.is_dynamic():
+            return self._call_dynamic(*input_values)
+
+        result_tensors, input_tensors, results = self._prepare_call(*input_values)
+        self.handle.call(result_tensors, input_tensors)
+        return results
+
+    def call_async(self, *input_values: NumericData) -> "ComputationFuture":
+        """Start the computation on input values and return a future of its result.
+
+        The call runs without holding the GIL, so several calls, from one thread or several,
+        run concurrently as far as the backend allows. The input values must not be modified
+        until the future is done.
+        """
+        if self.function.is_dynamic():
+            raise UserInputError("Asynchronous calls of dynamic functions are not supported.")
+
+        result_tensors, input_tensors, results = self._prepare_call(*input_values)
+        call_future = self.handle.call_async(result_tensors, input_tensors)
+        return ComputationFuture(call_future, results, [self, result_tensors, input_tensors])
+
+    def call_batch(
+        self,
+        input_batches: Sequence[Sequence[NumericData]],
+        outputs: Optional[List[List[np.ndarray]]] = None,
+    ) -> List[List[np.ndarray]]:
+        """Run the computation on every sample of a batch and return the results of each.
+
+        The samples run back-to-back in one call into the backend, concurrently as far as it
+        allows, without creating Python objects per sample beyond the arrays themselves.
+
+        :param input_batches: the input values of each sample
+        :param outputs: preallocated arrays for the results of each sample, written in place
+        :return: the results of each sample, `outputs` if given
+        """
+        if self.function.is_dynamic():
+            raise UserInputError("Batched calls of dynamic functions are not supported.")
+
+        inputs = [
+            [
+                Computation._to_input_array(value, tensor_view)
+                for tensor_view, value in zip(self.tensor_views, sample)
+            ]
+            for sample in input_batches
+        ]
+        if outputs is None:
+            outputs = [
+                [
+                    np.ndarray(view.shape, dtype=get_dtype(view.element_type))
+                    for view in self.result_views
+                ]
+                for _ in inputs
+            ]
+        for sample in outputs:
+            for result_view, result in zip(self.result_views, sample):
+                dtype = get_dtype(result_view.element_type)
+                if result.dtype != dtype or list(result.shape) != list(result_view.shape):
+                    raise UserInputError(
+                        "Provided output's type and shape: %s %s does not match the "
+                        "expected: %s %s.",
+                        result.dtype,
+                        list(result.shape),
+                        dtype,
+                        list(result_view.shape),
+                    )
+        self.handle.call_batch(self.runtime.backend, outputs, inputs)
+        return outputs
+
+    def _prepare_call(
+        self, *input_values: NumericData
+    ) -> Tuple[List[Tensor], List[Tensor], List[np.ndarray]]:
+        # Inputs and results are backend tensors on the memory of the ndarrays, so that the
+        # call reads and writes them without copies
+        input_tensors = list(self.tensor_views)
+        for index, (tensor_view, value) in enumerate(zip(self.tensor_views, input_values)):
+            if not isinstance(value, np.ndarray):
+                value = np.array(value)
+            if list(tensor_view.shape) != list(value.shape):
+                Computation._write_ndarray_to_tensor_view(value, tensor_view)
+                continue
+            value = Computation._to_tensor_dtype(value, tensor_view)
+            input_tensors[index] = self.runtime.backend.create_tensor(
+                tensor_view.element_type, tensor_view.shape, np.ascontiguousarray(value)
+            )
+
+        results = []
+        result_tensors = []
+        for result_view in self.result_views:
+            result = np.ndarray(result_view.shape, dtype=get_dtype(result_view.element_type))
+            results.append(result)
+            result_tensors.append(
+                self.runtime.backend.create_tensor(
+                    result_view.element_type, result_view.shape, result
+                )
+            )
+        return result_tensors, input_tensors, results
+
+    def _call_dynamic(self, *input_values: NumericData) -> List[NumericData]:
         for tensor_view, value in zip(self.tensor_views, input_values):
             if not isinstance(value, np.ndarray):
                 value = np.array(value)
             Computation._write_ndarray_to_tensor_view(value, tensor_view)
 
-        if self.function.is_dynamic():
-            self.handle.call_with_validate(self.result_views, self.tensor_views)
-        else:
-            self.handle.call(self.result_views, self.tensor_views)
+        self.handle.call_with_validate(self.result_views, self.tensor_views)
 
         results = []
         for result_view in self.result_views:
@@ -137,14 +232,8 @@ class Computation(object):
         return int((element_type.bitwidth / 8.0) * element_count)
 
     @staticmethod
-    def _write_ndarray_to_tensor_view(value: np.ndarray, tensor_view: Tensor) -> None:
+    def _to_tensor_dtype(value: np.ndarray, tensor_view: Tensor) -> np.ndarray:
         tensor_view_dtype = get_dtype(tensor_view.element_type)
-        if list(tensor_view.shape) != list(value.shape) and len(value.shape) > 0:
-            raise UserInputError(
-                "Provided tensor's shape: %s does not match the expected: %s.",
-                list(value.shape),
-                list(tensor_view.shape),
-            )
         if value.dtype != tensor_view_dtype:
             log.warning(
                 "Attempting to write a %s value to a %s tensor. Will attempt type conversion.",
@@ -152,6 +241,28 @@ class Computation(object):
                 tensor_view.element_type,
             )
             value = value.astype(tensor_view_dtype)
+        return value
+
+    @staticmethod
+    def _to_input_array(value: NumericData, tensor_view: Tensor) -> np.ndarray:
+        value = np.array(value) if not isinstance(value, np.ndarray) else value
+        if list(tensor_view.shape) != list(value.shape):
+            raise UserInputError(
+                "Provided tensor's shape: %s does not match the expected: %s.",
+                list(value.shape),
+                list(tensor_view.shape),
+            )
+        return np.ascontiguousarray(Computation._to_tensor_dtype(value, tensor_view))
+
+    @staticmethod
+    def _write_ndarray_to_tensor_view(value: np.ndarray, tensor_view: Tensor) -> None:
+        if list(tensor_view.shape) != list(value.shape) and len(value.shape) > 0:
+            raise UserInputError(
+                "Provided tensor's shape: %s does not match the expected: %s.",
+                list(value.shape),
+                list(tensor_view.shape),
+            )
+        value = Computation._to_tensor_dtype(value, tensor_view)
 
         buffer_size = Computation._get_buffer_size(
             tensor_view.element_type, tensor_view.element_count
@@ -166,3 +277,28 @@ class Computation(object):
             tensor_view.element_type, tensor_view.element_count
         )
         tensor_view.read(util.numpy_to_c(output), buffer_size)
+
+
+class ComputationFuture(object):
+    """Result of Computation.call_async, with the interface of concurrent.futures.Future."""
+
+    def __init__(self, call_future: CallFuture, results: List[np.ndarray], keep_alive: Any) -> None:
+        self._call_future = call_future
+        self._results = results
+        # The computation and the tensors of the call have to outlive it
+        self._keep_alive = keep_alive
+
+    def done(self) -> bool:
+        """Return True if the call has completed."""
+        return self._call_future.done()
+
+    def result(self, timeout: Optional[float] = None) -> List[NumericData]:
+        """Wait for the call and return its results, or raise the exception it raised.
+
+        :param timeout: seconds to wait at most, None to wait until the call completes
+        """
+        if not self._call_future.wait(-1.0 if timeout is None else timeout):
+            raise TimeoutError("The computation did not complete in {} seconds".format(timeout))
+        self._call_future.result()
+        self._keep_alive = None
+        return self._results
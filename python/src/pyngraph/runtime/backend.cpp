@@ -14,9 +14,12 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <pybind11/buffer_info.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <stdexcept>
+
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/tensor.hpp"
 #include "pyngraph/partial_shape.hpp"
@@ -43,6 +46,30 @@ static std::shared_ptr<ngraph::runtime::Executable> compile(ngraph::runtime::Bac
     return self->compile(func, enable_performance_data);
 }
 
+std::shared_ptr<ngraph::runtime::Tensor>
+    create_tensor_on_buffer(ngraph::runtime::Backend* self,
+                            const ngraph::element::Type& element_type,
+                            const ngraph::Shape& shape,
+                            py::buffer buffer)
+{
+    py::buffer_info info = buffer.request();
+    ssize_t stride = info.itemsize;
+    for (ssize_t i = info.ndim - 1; i >= 0; i--)
+    {
+        if (info.shape[i] != 1 && info.strides[i] != stride)
+        {
+            throw std::invalid_argument("The buffer of a tensor must be C-contiguous");
+        }
+        stride *= info.shape[i];
+    }
+    if (static_cast<size_t>(info.size * info.itemsize) !=
+        ngraph::shape_size(shape) * element_type.size())
+    {
+        throw std::invalid_argument("The buffer does not have the size of the tensor");
+    }
+    return self->create_tensor(element_type, shape, info.ptr);
+}
+
 void regclass_pyngraph_runtime_Backend(py::module m)
 {
     py::class_<ngraph::runtime::Backend, std::shared_ptr<ngraph::runtime::Backend>> backend(
@@ -55,6 +82,8 @@ void regclass_pyngraph_runtime_Backend(py::module m)
                 (std::shared_ptr<ngraph::runtime::Tensor>(ngraph::runtime::Backend::*)(
                     const ngraph::element::Type&, const ngraph::Shape&)) &
                     ngraph::runtime::Backend::create_tensor);
+    // The tensor keeps the buffer alive
+    backend.def("create_tensor", &create_tensor_on_buffer, py::keep_alive<0, 4>());
     backend.def("create_dynamic_tensor",
                 (std::shared_ptr<ngraph::runtime::Tensor>(ngraph::runtime::Backend::*)(
                     const ngraph::element::Type&, const ngraph::PartialShape&)) &
@@ -18,6 +18,18 @@
 
 #include <pybind11/pybind11.h>
 
+#include <memory>
+
+#include "ngraph/runtime/backend.hpp"
+
 namespace py = pybind11;
 
 void regclass_pyngraph_runtime_Backend(py::module m);
+
+// A tensor of `backend` using the memory of `buffer`, which has to be a C-contiguous array of
+// the size of the tensor and to outlive it
+std::shared_ptr<ngraph::runtime::Tensor>
+    create_tensor_on_buffer(ngraph::runtime::Backend* backend,
+                            const ngraph::element::Type& element_type,
+                            const ngraph::Shape& shape,
+                            py::buffer buffer);
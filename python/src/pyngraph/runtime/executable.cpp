@@ -17,14 +17,150 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <chrono>
+#include <exception>
+#include <future>
+#include <stdexcept>
+#include <vector>
+
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/tensor.hpp"
+#include "pyngraph/runtime/backend.hpp"
 #include "pyngraph/runtime/executable.hpp"
 
 namespace py = pybind11;
 
+// Completion of an Executable::call_async, waited for without holding the GIL so that other
+// Python threads run meanwhile
+class CallFuture
+{
+public:
+    CallFuture(std::future<bool>&& future)
+        : m_future(future.share())
+    {
+    }
+
+    bool done() const
+    {
+        return m_future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    }
+
+    // Waits at most `timeout` seconds, or until the call completes if it is negative
+    bool wait(double timeout) const
+    {
+        if (timeout < 0)
+        {
+            m_future.wait();
+            return true;
+        }
+        return m_future.wait_for(std::chrono::duration<double>(timeout)) ==
+               std::future_status::ready;
+    }
+
+    // The result of the call, or the exception it threw
+    bool result() const { return m_future.get(); }
+
+private:
+    std::shared_future<bool> m_future;
+};
+
+static CallFuture call_async(ngraph::runtime::Executable* self,
+                             const std::vector<std::shared_ptr<ngraph::runtime::Tensor>>& outputs,
+                             const std::vector<std::shared_ptr<ngraph::runtime::Tensor>>& inputs)
+{
+    return CallFuture(self->call_async(outputs, inputs));
+}
+
+using TensorVector = std::vector<std::shared_ptr<ngraph::runtime::Tensor>>;
+
+// Tensors on the buffers of one sample, with the element types and shapes of `nodes`
+template <typename NodeVector>
+static TensorVector make_sample_tensors(ngraph::runtime::Backend* backend,
+                                        const NodeVector& nodes,
+                                        const std::vector<py::buffer>& buffers)
+{
+    if (buffers.size() != nodes.size())
+    {
+        throw std::invalid_argument("Every sample of a batch needs one buffer per parameter "
+                                    "and one per result of the function");
+    }
+    TensorVector tensors;
+    for (size_t i = 0; i < nodes.size(); i++)
+    {
+        tensors.push_back(create_tensor_on_buffer(backend,
+                                                  nodes[i]->get_output_element_type(0),
+                                                  nodes[i]->get_output_shape(0),
+                                                  buffers[i]));
+    }
+    return tensors;
+}
+
+// Runs the executable on every sample of a batch, the tensors of sample i being on the buffers
+// outputs[i] and inputs[i], and returns once all the calls are done. The calls are all started
+// before waiting for the first so that a backend running calls concurrently overlaps them.
+static void call_batch(ngraph::runtime::Executable* self,
+                       ngraph::runtime::Backend* backend,
+                       const std::vector<std::vector<py::buffer>>& outputs,
+                       const std::vector<std::vector<py::buffer>>& inputs)
+{
+    if (outputs.size() != inputs.size())
+    {
+        throw std::invalid_argument("A batch needs as many output samples as input samples");
+    }
+    std::vector<TensorVector> output_tensors;
+    std::vector<TensorVector> input_tensors;
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        output_tensors.push_back(make_sample_tensors(backend, self->get_results(), outputs[i]));
+        input_tensors.push_back(make_sample_tensors(backend, self->get_parameters(), inputs[i]));
+    }
+
+    py::gil_scoped_release release;
+    std::vector<std::future<bool>> calls;
+    std::exception_ptr error;
+    try
+    {
+        for (size_t i = 0; i < inputs.size(); i++)
+        {
+            calls.push_back(self->call_async(output_tensors[i], input_tensors[i]));
+        }
+    }
+    catch (...)
+    {
+        error = std::current_exception();
+    }
+    // The calls started have to complete before the buffers may be released
+    for (auto& call : calls)
+    {
+        try
+        {
+            call.get();
+        }
+        catch (...)
+        {
+            if (!error)
+            {
+                error = std::current_exception();
+            }
+        }
+    }
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
 void regclass_pyngraph_runtime_Executable(py::module m)
 {
+    py::class_<CallFuture> call_future(m, "CallFuture");
+    call_future.doc() = "ngraph.impl.runtime.CallFuture is the completion of Executable.call_async";
+    call_future.def("done", &CallFuture::done);
+    call_future.def("wait",
+                    &CallFuture::wait,
+                    py::arg("timeout") = -1.0,
+                    py::call_guard<py::gil_scoped_release>());
+    call_future.def("result", &CallFuture::result, py::call_guard<py::gil_scoped_release>());
+
     py::class_<ngraph::runtime::Executable, std::shared_ptr<ngraph::runtime::Executable>>
         executable(m, "Executable");
     executable.doc() = "ngraph.impl.runtime.Executable wraps ngraph::runtime::Executable";
@@ -32,12 +168,17 @@ void regclass_pyngraph_runtime_Executable(py::module m)
                    (bool (ngraph::runtime::Executable::*)(
                        const std::vector<std::shared_ptr<ngraph::runtime::Tensor>>&,
                        const std::vector<std::shared_ptr<ngraph::runtime::Tensor>>&)) &
-                       ngraph::runtime::Executable::call);
+                       ngraph::runtime::Executable::call,
+                   py::call_guard<py::gil_scoped_release>());
     executable.def("call_with_validate",
                    (bool (ngraph::runtime::Executable::*)(
                        const std::vector<std::shared_ptr<ngraph::runtime::Tensor>>&,
                        const std::vector<std::shared_ptr<ngraph::runtime::Tensor>>&)) &
-                       ngraph::runtime::Executable::call_with_validate);
+                       ngraph::runtime::Executable::call_with_validate,
+                   py::call_guard<py::gil_scoped_release>());
+    // The tensors and the executable have to be kept alive until the call is done
+    executable.def("call_async", &call_async, py::call_guard<py::gil_scoped_release>());
+    executable.def("call_batch", &call_batch);
     executable.def(
         "get_performance_data",
         (std::vector<ngraph::runtime::PerformanceCounter>(ngraph::runtime::Executable::*)()) &
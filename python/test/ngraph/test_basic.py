@@ -18,7 +18,7 @@ import pytest
 import json
 
 import ngraph as ng
-from ngraph.impl import Function
+from ngraph.impl import Function, Shape, Type
 from ngraph.exceptions import UserInputError
 
 import test
@@ -84,6 +84,57 @@ def test_simple_computation_on_ndarrays(dtype):
     assert np.allclose(result, np.array([[630, 704], [782, 864]], dtype=dtype))
 
 
+
+def test_tensor_on_ndarray_memory():
+    runtime = get_runtime()
+    value = np.array([[1, 2], [3, 4]], dtype=np.float32)
+    tensor = runtime.backend.create_tensor(Type.f32, Shape([2, 2]), value)
+    view = np.asarray(tensor)
+    assert np.shares_memory(view, value)
+    assert np.array_equal(view, value)
+
+    with pytest.raises(ValueError):
+        runtime.backend.create_tensor(Type.f32, Shape([2, 2]), value.T)
+
+
+def test_computation_call_async():
+    runtime = get_runtime()
+
+    shape = [2, 2]
+    parameter_a = ng.parameter(shape, dtype=np.float32, name="A")
+    parameter_b = ng.parameter(shape, dtype=np.float32, name="B")
+    computation = runtime.computation(parameter_a + parameter_b, parameter_a, parameter_b)
+
+    value_a = np.array([[1, 2], [3, 4]], dtype=np.float32)
+    value_b = np.array([[5, 6], [7, 8]], dtype=np.float32)
+    futures = [computation.call_async(value_a, value_b * i) for i in range(4)]
+    for i, future in enumerate(futures):
+        assert np.allclose(future.result(), value_a + value_b * i)
+        assert future.done()
+
+
+def test_computation_call_batch():
+    runtime = get_runtime()
+
+    shape = [2, 2]
+    parameter_a = ng.parameter(shape, dtype=np.float32, name="A")
+    parameter_b = ng.parameter(shape, dtype=np.float32, name="B")
+    computation = runtime.computation(parameter_a * parameter_b, parameter_a, parameter_b)
+
+    value_a = np.array([[1, 2], [3, 4]], dtype=np.float32)
+    batch = [(value_a, np.full(shape, i, dtype=np.float32)) for i in range(3)]
+    results = computation.call_batch(batch)
+    for i, sample_results in enumerate(results):
+        assert np.allclose(sample_results[0], value_a * i)
+
+    outputs = [[np.zeros(shape, dtype=np.float32)] for _ in batch]
+    assert computation.call_batch(batch, outputs) is outputs
+    for i, sample_outputs in enumerate(outputs):
+        assert np.allclose(sample_outputs[0], value_a * i)
+
+    with pytest.raises(UserInputError):
+        computation.call_batch(batch, [[np.zeros([3], dtype=np.float32)] for _ in batch])
+
 def test_serialization():
     dtype = np.float32
     backend_name = test.BACKEND_NAME
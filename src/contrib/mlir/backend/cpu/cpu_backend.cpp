@@ -20,10 +20,13 @@
 
 #include "cpu_backend.hpp"
 #include "contrib/mlir/backend/pass/affine_lowerer.hpp"
+#include "contrib/mlir/backend/pass/parallel_loop_outliner.hpp"
+#include "contrib/mlir/backend/pass/temp_pool_allocation.hpp"
 #include "contrib/mlir/utils.hpp"
 #include "ngraph/check.hpp"
 #include "ngraph/env_util.hpp"
 
+#include <algorithm>
 #include <llvm/ADT/STLExtras.h>
 #include <llvm/Analysis/TargetTransformInfo.h>
 #include <llvm/ExecutionEngine/Orc/JITTargetMachineBuilder.h>
@@ -34,6 +37,7 @@
 #include <mlir/Conversion/SCFToStandard/SCFToStandard.h>
 #include <mlir/Conversion/StandardToLLVM/ConvertStandardToLLVM.h>
 #include <mlir/Conversion/StandardToLLVM/ConvertStandardToLLVMPass.h>
+#include <mlir/Conversion/VectorToLLVM/ConvertVectorToLLVM.h>
 #include <mlir/Dialect/Affine/Passes.h>
 #include <mlir/Dialect/LLVMIR/LLVMDialect.h>
 #include <mlir/IR/StandardTypes.h>
@@ -53,12 +57,12 @@ static llvm::cl::opt<bool> clEnableNgInPlaceMemoryOpt(
 
 static llvm::cl::opt<bool>
     clEnableAffineLoopFusion("ngraph-affine-loop-fusion",
-                             llvm::cl::init(false),
+                             llvm::cl::init(true),
                              llvm::cl::desc("Enable loop fusion optimization in Affine dialect"));
 
 static llvm::cl::opt<bool>
     clEnableAffineLoopTiling("ngraph-affine-loop-tile",
-                             llvm::cl::init(false),
+                             llvm::cl::init(true),
                              llvm::cl::desc("Enable loop tiling optimization in Affine dialect"));
 
 static llvm::cl::opt<unsigned>
@@ -74,6 +78,28 @@ static llvm::cl::opt<unsigned> clLoopTilingCacheSize(
                    "inferred from the host CPU using for the cache level specified by "
                    "-ngraph-loop-tile-cache-level."));
 
+static llvm::cl::opt<bool> clEnableAffineVectorization(
+    "ngraph-affine-vectorize",
+    llvm::cl::init(false),
+    llvm::cl::desc("Enable super-vectorization of the innermost loops in Affine dialect"));
+
+static llvm::cl::opt<unsigned> clVectorizationWidth(
+    "ngraph-affine-vectorize-width",
+    llvm::cl::init(0),
+    llvm::cl::desc("Number of elements of the vectors used by -ngraph-affine-vectorize. If "
+                   "zero, the width of the vector registers of the host CPU is used."));
+
+static llvm::cl::opt<bool> clEnableTempPool(
+    "ngraph-temp-pool",
+    llvm::cl::init(true),
+    llvm::cl::desc("Plan the temporaries of a sub-graph into a buffer reused across calls"));
+
+static llvm::cl::opt<bool> clEnableParallelLoops(
+    "ngraph-parallel-loops",
+    llvm::cl::init(true),
+    llvm::cl::desc("Run the parallel outermost loops of a sub-graph on the threads of the CPU "
+                   "backend. Requires the default memref lowering."));
+
 // Enable the lowering of MemRefs to LLVM bare pointers.
 extern llvm::cl::opt<bool> clEnableBarePtrMemRefLowering;
 
@@ -139,6 +165,70 @@ static unsigned getCacheLevelSize(llvm::TargetTransformInfo& targetInfo,
     return optCacheLevelSize.getValue();
 }
 
+/// Returns the number of f32 elements that fit in a vector register of the target, unless
+/// `userWidth` is not zero, in which case it returns `userWidth`.
+static unsigned getVectorizationWidth(llvm::TargetTransformInfo& targetInfo, unsigned userWidth)
+{
+    if (userWidth)
+    {
+        return userWidth;
+    }
+
+    unsigned registerBitWidth = targetInfo.getRegisterBitWidth(/*Vector=*/true);
+    return std::max(registerBitWidth / 32, 1u);
+}
+
+namespace
+{
+    /// Lowers the Vector and Standard dialects to the LLVM dialect in a single conversion, as
+    /// the vector.transfer ops produced by the super-vectorizer read and write memrefs that
+    /// are converted at the same time.
+    class VectorAndStdToLLVMLoweringPass
+        : public PassWrapper<VectorAndStdToLLVMLoweringPass, OperationPass<ModuleOp>>
+    {
+    public:
+        VectorAndStdToLLVMLoweringPass(const LowerToLLVMOptions& options)
+            : options(options)
+        {
+        }
+
+        void runOnOperation() override
+        {
+            LLVMTypeConverter typeConverter(&getContext(), options);
+            OwningRewritePatternList patterns;
+            populateVectorToLLVMConversionPatterns(typeConverter, patterns);
+            if (options.useBarePtrCallConv)
+            {
+                populateStdToLLVMBarePtrConversionPatterns(typeConverter, patterns);
+            }
+            else
+            {
+                populateStdToLLVMConversionPatterns(typeConverter, patterns);
+            }
+
+            LLVMConversionTarget target(getContext());
+            if (failed(applyPartialConversion(getOperation(), target, std::move(patterns))))
+            {
+                signalPassFailure();
+            }
+        }
+
+    private:
+        LowerToLLVMOptions options;
+    };
+}
+
+/// Creates the pass lowering Standard dialect, and Vector dialect if vectorization is enabled,
+/// to LLVM dialect.
+static std::unique_ptr<Pass> createCPULowerToLLVMPass(const LowerToLLVMOptions& options)
+{
+    if (clEnableAffineVectorization)
+    {
+        return std::make_unique<VectorAndStdToLLVMLoweringPass>(options);
+    }
+    return mlir::createLowerToLLVMPass(options);
+}
+
 void MLIRCPUBackend::init()
 {
     // Mutex to safely initialize CPU backend
@@ -212,13 +302,13 @@ void MLIRCPUBackend::lowerStandardDialect()
     {
         LowerToLLVMOptions llvmOptions;
         llvmOptions.useBarePtrCallConv = true, llvmOptions.emitCWrappers = false,
-        pm.addPass(mlir::createLowerToLLVMPass(llvmOptions));
+        pm.addPass(createCPULowerToLLVMPass(llvmOptions));
     }
     else
     {
         LowerToLLVMOptions llvmOptions;
         llvmOptions.useBarePtrCallConv = false, llvmOptions.emitCWrappers = true,
-        pm.addPass(mlir::createLowerToLLVMPass(llvmOptions));
+        pm.addPass(createCPULowerToLLVMPass(llvmOptions));
     }
 
     // Apply any generic pass manager command line options.
@@ -273,6 +363,31 @@ void MLIRCPUBackend::optimizeAffineDialect()
         pm.addPass(mlir::createLoopTilingPass(cacheLevelSize));
     }
 
+    if (clEnableAffineVectorization)
+    {
+        // Vectorize the innermost loops, whose accesses are contiguous in the row-major
+        // memrefs produced by the lowering, and clean up the resulting vector ops.
+        int64_t vectorWidth = getVectorizationWidth(targetInfo, clVectorizationWidth);
+        LLVM_DEBUG(llvm::dbgs() << "Enabling Affine Super-Vectorization with width "
+                                << vectorWidth << ".\n");
+        pm.addPass(mlir::createSuperVectorizePass({vectorWidth}));
+        pm.addPass(mlir::createCanonicalizerPass());
+    }
+
+    // The private buffers created by loop fusion are allocated in 'main' as well, so the
+    // temporaries are planned after the loop optimizations.
+    if (clEnableTempPool)
+    {
+        pm.addPass(mlir::createTempPoolAllocationPass());
+    }
+
+    // Outline the parallel loops last, so that they are outlined with the loops fused into
+    // them. The runtime calls the outlined functions through their C interface.
+    if (clEnableParallelLoops && !clEnableBarePtrMemRefLowering)
+    {
+        pm.addPass(mlir::createParallelLoopOutliningPass());
+    }
+
     // Populate pass manager with affine-to-loop and loop-to-std dialect
     // conversions.
     pm.addPass(mlir::createLowerAffinePass());
@@ -0,0 +1,247 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+// NOTE: This file follows nGraph format style and MLIR naming convention since
+// it does
+// not expose public API to the rest of nGraph codebase and heavily depends on
+// MLIR API.
+
+#include "parallel_loop_outliner.hpp"
+
+#include "contrib/mlir/runtime/cpu/callback_utils.hpp"
+
+#include <llvm/ADT/STLExtras.h>
+#include <llvm/Support/Debug.h>
+#include <mlir/Analysis/LoopAnalysis.h>
+#include <mlir/Analysis/Utils.h>
+#include <mlir/Dialect/Affine/IR/AffineOps.h>
+#include <mlir/Dialect/StandardOps/IR/Ops.h>
+#include <mlir/IR/BlockAndValueMapping.h>
+#include <mlir/IR/Builders.h>
+#include <mlir/IR/Function.h>
+#include <mlir/IR/Module.h>
+#include <mlir/Transforms/RegionUtils.h>
+
+#include <string>
+
+#define PASS_NAME "ngraph-outline-parallel-loops"
+#define DEBUG_TYPE PASS_NAME
+
+// anonymous namespace
+// no need to expose any of the following outside of this file
+namespace
+{
+    using namespace mlir;
+    using namespace ngraph::runtime::ngmlir;
+
+    /// Outlines a parallel loop with constant bounds from the body of 'main'. The outlined
+    /// function takes the bounds of a chunk of the loop followed by the arguments of 'main':
+    ///
+    ///   func @main_parallel_0(%begin: index, %end: index, <arguments of main>) {
+    ///     affine.for %i = %begin to %end step <step> { <body> }
+    ///   }
+    ///
+    /// The runtime calls the function through its C interface with the arguments it bound
+    /// for 'main'. Constants and the views of the temporaries over the pool argument are
+    /// cloned into the function; loops reading other values computed by 'main' are not
+    /// outlined.
+    class ParallelLoopOutliningPass
+        : public PassWrapper<ParallelLoopOutliningPass, OperationPass<ModuleOp>>
+    {
+    public:
+        void runOnOperation() override;
+
+    private:
+        /// Returns true if `forOp` can run its iterations concurrently from an outlined
+        /// function.
+        bool canOutline(AffineForOp forOp, FuncOp mainFunc);
+
+        /// Moves `forOp` to a new function and replaces it with a call to the callback.
+        void outline(AffineForOp forOp, FuncOp mainFunc, int64_t id);
+
+        FuncOp getCallbackDecl();
+    };
+
+    /// Returns true if `value` is an argument of `entry`, or is computed from arguments of
+    /// `entry` and constants only, by ops that can be cloned out of 'main'.
+    bool isAvailableOutside(Value value, Block* entry)
+    {
+        if (auto blockArg = value.dyn_cast<BlockArgument>())
+        {
+            return blockArg.getOwner() == entry;
+        }
+        Operation* op = value.getDefiningOp();
+        if (isa<ConstantOp>(op))
+        {
+            return true;
+        }
+        if (!isa<ViewOp>(op))
+        {
+            return false;
+        }
+        return llvm::all_of(op->getOperands(),
+                            [&](Value operand) { return isAvailableOutside(operand, entry); });
+    }
+
+    /// Clones the ops computing `value`, available outside of 'main', before the insertion
+    /// point of `builder`.
+    void cloneDefinition(Value value, OpBuilder& builder, BlockAndValueMapping& mapping)
+    {
+        if (mapping.contains(value))
+        {
+            return;
+        }
+        Operation* op = value.getDefiningOp();
+        for (Value operand : op->getOperands())
+        {
+            cloneDefinition(operand, builder, mapping);
+        }
+        builder.clone(*op, mapping);
+    }
+
+    void ParallelLoopOutliningPass::runOnOperation()
+    {
+        ModuleOp module = getOperation();
+        FuncOp mainFunc = module.lookupSymbol<FuncOp>("main");
+        if (!mainFunc || mainFunc.isExternal())
+        {
+            return;
+        }
+
+        SmallVector<AffineForOp, 4> loops;
+        for (auto forOp : mainFunc.getBody().front().getOps<AffineForOp>())
+        {
+            if (canOutline(forOp, mainFunc))
+            {
+                loops.push_back(forOp);
+            }
+        }
+
+        int64_t id = 0;
+        for (auto forOp : loops)
+        {
+            outline(forOp, mainFunc, id++);
+        }
+        LLVM_DEBUG(llvm::dbgs() << "Outlined " << id << " parallel loops.\n");
+    }
+
+    bool ParallelLoopOutliningPass::canOutline(AffineForOp forOp, FuncOp mainFunc)
+    {
+        if (!forOp.hasConstantLowerBound() || !forOp.hasConstantUpperBound())
+        {
+            return false;
+        }
+        auto tripCount = getConstantTripCount(forOp);
+        if (!tripCount.hasValue() || tripCount.getValue() < 2 || !isLoopParallel(forOp))
+        {
+            return false;
+        }
+
+        llvm::SetVector<Value> usedValues;
+        getUsedValuesDefinedAbove(forOp.region(), usedValues);
+        return llvm::all_of(usedValues, [&](Value value) {
+            return isAvailableOutside(value, &mainFunc.getBody().front());
+        });
+    }
+
+    void ParallelLoopOutliningPass::outline(AffineForOp forOp, FuncOp mainFunc, int64_t id)
+    {
+        ModuleOp module = getOperation();
+        auto loc = forOp.getLoc();
+        OpBuilder builder(module.getContext());
+        auto indexTy = builder.getIndexType();
+
+        SmallVector<Type, 8> argTypes = {indexTy, indexTy};
+        for (Type type : mainFunc.getType().getInputs())
+        {
+            argTypes.push_back(type);
+        }
+        builder.setInsertionPoint(mainFunc);
+        auto funcOp = builder.create<FuncOp>(loc,
+                                             parallelLoopFuncPrefix + std::to_string(id),
+                                             builder.getFunctionType(argTypes, {}),
+                                             ArrayRef<NamedAttribute>{});
+        Block* entry = funcOp.addEntryBlock();
+        builder.setInsertionPointToStart(entry);
+
+        BlockAndValueMapping mapping;
+        for (auto arg : mainFunc.getArguments())
+        {
+            mapping.map(arg, entry->getArgument(arg.getArgNumber() + 2));
+        }
+        llvm::SetVector<Value> usedValues;
+        getUsedValuesDefinedAbove(forOp.region(), usedValues);
+        for (Value value : usedValues)
+        {
+            cloneDefinition(value, builder, mapping);
+        }
+
+        auto chunkLoop = builder.create<AffineForOp>(loc,
+                                                     ValueRange{entry->getArgument(0)},
+                                                     builder.getSymbolIdentityMap(),
+                                                     ValueRange{entry->getArgument(1)},
+                                                     builder.getSymbolIdentityMap(),
+                                                     forOp.getStep());
+        builder.create<ReturnOp>(loc);
+        mapping.map(forOp.getInductionVar(), chunkLoop.getInductionVar());
+        builder.setInsertionPoint(chunkLoop.getBody()->getTerminator());
+        for (auto& op : forOp.getBody()->without_terminator())
+        {
+            builder.clone(op, mapping);
+        }
+
+        // Replace the loop with a call to the callback that runs the outlined function.
+        builder.setInsertionPoint(forOp);
+        SmallVector<Value, 4> callArgs;
+        for (int64_t value :
+             {id, forOp.getConstantLowerBound(), forOp.getConstantUpperBound(), forOp.getStep()})
+        {
+            callArgs.push_back(builder.create<ConstantIntOp>(loc, value, 64));
+        }
+        builder.create<CallOp>(loc, getCallbackDecl(), callArgs);
+        forOp.erase();
+    }
+
+    FuncOp ParallelLoopOutliningPass::getCallbackDecl()
+    {
+        ModuleOp module = getOperation();
+        auto callBackFunc = module.lookupSymbol<FuncOp>("callback_parallel_for");
+        if (!callBackFunc)
+        {
+            OpBuilder builder(module.getContext());
+            builder.setInsertionPointToStart(module.getBody());
+            auto int64Ty = builder.getIntegerType(64);
+            auto callBackType =
+                builder.getFunctionType({int64Ty, int64Ty, int64Ty, int64Ty}, {});
+            callBackFunc = builder.create<FuncOp>(builder.getUnknownLoc(),
+                                                  "callback_parallel_for",
+                                                  callBackType,
+                                                  ArrayRef<NamedAttribute>{});
+        }
+        return callBackFunc;
+    }
+}
+
+namespace mlir
+{
+    std::unique_ptr<Pass> createParallelLoopOutliningPass()
+    {
+        return std::make_unique<ParallelLoopOutliningPass>();
+    }
+}
+
+static PassRegistration<ParallelLoopOutliningPass>
+    pass(PASS_NAME, "Outline parallel loops of 'main' into functions run by the CPU runtime");
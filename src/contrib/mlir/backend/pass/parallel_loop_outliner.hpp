@@ -0,0 +1,33 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+// NOTE: This file follows nGraph format style and MLIR naming convention since
+// it does
+// not expose public API to the rest of nGraph codebase and heavily depends on
+// MLIR API.
+
+#pragma once
+
+#include <mlir/Pass/Pass.h>
+
+namespace mlir
+{
+    /// Outlines the parallel outermost affine loops of the 'main' function into functions
+    /// that run a sub-range of the iterations of the loop, and replaces each loop with a
+    /// call to the 'callback_parallel_for' runtime callback, which splits the iterations
+    /// among threads.
+    std::unique_ptr<Pass> createParallelLoopOutliningPass();
+}
@@ -0,0 +1,139 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+// NOTE: This file follows nGraph format style and MLIR naming convention since
+// it does
+// not expose public API to the rest of nGraph codebase and heavily depends on
+// MLIR API.
+
+#include "temp_pool_allocation.hpp"
+
+#include "contrib/mlir/runtime/cpu/memory_manager.hpp"
+
+#include <llvm/Support/Debug.h>
+#include <mlir/Dialect/StandardOps/IR/Ops.h>
+#include <mlir/IR/Builders.h>
+#include <mlir/IR/Function.h>
+#include <mlir/IR/Module.h>
+#include <mlir/IR/StandardTypes.h>
+
+#define PASS_NAME "ngraph-temp-pool-allocation"
+#define DEBUG_TYPE PASS_NAME
+
+// anonymous namespace
+// no need to expose any of the following outside of this file
+namespace
+{
+    using namespace mlir;
+    using namespace ngraph::runtime::ngmlir;
+
+    // Alignment of the temporaries in the pool, in bytes
+    constexpr int64_t tempAlignment = 64;
+
+    /// Replaces the statically shaped allocs of the entry block of 'main' with views at
+    /// fixed offsets of a pool argument, and drops their deallocs. The temporaries are all
+    /// live until the end of 'main', as the lowering deallocates them there, so they are
+    /// laid out one after the other; the buffers shared by in-place ops are already single
+    /// allocs.
+    class TempPoolAllocationPass
+        : public PassWrapper<TempPoolAllocationPass, OperationPass<ModuleOp>>
+    {
+    public:
+        void runOnOperation() override;
+    };
+
+    void TempPoolAllocationPass::runOnOperation()
+    {
+        ModuleOp module = getOperation();
+        FuncOp mainFunc = module.lookupSymbol<FuncOp>("main");
+        if (!mainFunc || mainFunc.isExternal())
+        {
+            return;
+        }
+
+        Block& entry = mainFunc.getBody().front();
+        SmallVector<AllocOp, 8> allocs;
+        for (auto alloc : entry.getOps<AllocOp>())
+        {
+            MemRefType type = alloc.getType();
+            if (type.hasStaticShape() && type.getAffineMaps().empty() &&
+                type.getElementType().isIntOrFloat())
+            {
+                allocs.push_back(alloc);
+            }
+        }
+        if (allocs.empty())
+        {
+            return;
+        }
+
+        SmallVector<int64_t, 8> offsets;
+        int64_t poolSize = 0;
+        for (auto alloc : allocs)
+        {
+            offsets.push_back(poolSize);
+            int64_t sizeInBytes = (alloc.getType().getSizeInBits() + 7) / 8;
+            poolSize += (sizeInBytes + tempAlignment - 1) / tempAlignment * tempAlignment;
+        }
+
+        OpBuilder builder(module.getContext());
+        auto poolType = MemRefType::get({poolSize}, builder.getIntegerType(8));
+        Value pool = entry.addArgument(poolType);
+        SmallVector<Type, 8> inputs(mainFunc.getType().getInputs().begin(),
+                                    mainFunc.getType().getInputs().end());
+        inputs.push_back(poolType);
+        mainFunc.setType(builder.getFunctionType(inputs, mainFunc.getType().getResults()));
+
+        for (unsigned i = 0; i < allocs.size(); i++)
+        {
+            AllocOp alloc = allocs[i];
+            builder.setInsertionPoint(alloc);
+            auto byteShift = builder.create<ConstantIndexOp>(alloc.getLoc(), offsets[i]);
+            auto view = builder.create<ViewOp>(
+                alloc.getLoc(), alloc.getType(), pool, byteShift, ValueRange{});
+
+            SmallVector<Operation*, 2> deallocs;
+            for (Operation* user : alloc.getResult().getUsers())
+            {
+                if (isa<DeallocOp>(user))
+                {
+                    deallocs.push_back(user);
+                }
+            }
+            for (Operation* dealloc : deallocs)
+            {
+                dealloc->erase();
+            }
+            alloc.replaceAllUsesWith(view.getResult());
+            alloc.erase();
+        }
+
+        module.setAttr(tempPoolSizeAttrName, builder.getI64IntegerAttr(poolSize));
+        LLVM_DEBUG(llvm::dbgs() << "Planned " << allocs.size() << " temporaries into a pool of "
+                                << poolSize << " bytes.\n");
+    }
+}
+
+namespace mlir
+{
+    std::unique_ptr<Pass> createTempPoolAllocationPass()
+    {
+        return std::make_unique<TempPoolAllocationPass>();
+    }
+}
+
+static PassRegistration<TempPoolAllocationPass>
+    pass(PASS_NAME, "Plan the temporaries of 'main' into a buffer passed by the CPU runtime");
@@ -24,6 +24,10 @@ namespace ngraph
     {
         namespace ngmlir
         {
+            // Prefix of the functions the parallel loops of 'main' are outlined to. The name
+            // of a function ends with the id 'callback_parallel_for' is called with.
+            constexpr const char* parallelLoopFuncPrefix = "main_parallel_";
+
             // OpType class is used for callbacks.
             // We pass OpType to the generic callback functions,
             // which call the real implementation based on OpType.
@@ -1032,3 +1032,9 @@ extern "C" void _mlir_ciface_callback_3_inputs(
         NGRAPH_UNREACHABLE("Unsupported type");
     }
 }
+
+extern "C" void
+    _mlir_ciface_callback_parallel_for(int64_t id, int64_t lb, int64_t ub, int64_t step)
+{
+    MLIRCPURuntime::runParallelLoop(id, lb, ub, step);
+}
@@ -20,6 +20,7 @@
 
 #include "cpu_runtime.hpp"
 #include "contrib/mlir/backend/cpu/cpu_backend.hpp"
+#include "contrib/mlir/runtime/cpu/callback_utils.hpp"
 #include "ngraph/check.hpp"
 
 #include <llvm/ADT/STLExtras.h>
@@ -37,6 +38,10 @@
 #include <mlir/ExecutionEngine/OptUtils.h>
 #include <mlir/IR/Function.h>
 
+#include <algorithm>
+#include <atomic>
+#include <string>
+
 using llvm::ArrayRef;
 using llvm::SmallVector;
 using llvm::StringRef;
@@ -63,38 +68,133 @@ llvm::cl::opt<bool> clEnableBarePtrMemRefLowering(
     llvm::cl::init(false),
     llvm::cl::desc("Enable the lowering of MemRefs to LLVM bare pointers"));
 
-void MLIRCPURuntime::run(const std::vector<MemRefArg>& args, bool firstIteration)
+namespace
+{
+    // The invocation of 'main' running on the calling thread, which the parallel loops
+    // called back from 'main' belong to
+    struct Invocation
+    {
+        MLIRCPURuntime* runtime;
+        SmallVector<void*, 8>* invokeArgs;
+        const MLIRCPURuntime::ParallelFor* parallelFor;
+    };
+
+    thread_local Invocation* currentInvocation = nullptr;
+
+    class InvocationScope
+    {
+    public:
+        InvocationScope(Invocation* invocation)
+            : m_previous(currentInvocation)
+        {
+            currentInvocation = invocation;
+        }
+        ~InvocationScope() { currentInvocation = m_previous; }
+
+    private:
+        Invocation* m_previous;
+    };
+}
+
+void MLIRCPURuntime::run(const std::vector<MemRefArg>& args)
+{
+    run(args, [](int64_t count, const std::function<void(int64_t, int64_t)>& body) {
+        body(0, count);
+    });
+}
+
+void MLIRCPURuntime::run(const std::vector<MemRefArg>& args, const ParallelFor& parallelFor)
 {
-    run_internal(args, firstIteration);
+    std::call_once(m_initialized, [this]() { initialize(); });
+
+    // The temporaries of the call live in a buffer passed as the last argument of 'main'
+    const std::vector<MemRefArg>* callArgs = &args;
+    std::vector<MemRefArg> argsWithTempPool;
+    std::unique_ptr<runtime::AlignedBuffer> tempPool;
+    if (m_tempPoolSize > 0)
+    {
+        tempPool = m_tempPools.acquire(m_tempPoolSize);
+        argsWithTempPool = args;
+        argsWithTempPool.push_back({tempPool->get_ptr(), {m_tempPoolSize}, {1}});
+        callArgs = &argsWithTempPool;
+    }
+
+    // The arguments are bound per call, so that callers sharing the runtime do not see each
+    // other's tensors
+    auto invokeArgs = bindArguments(*callArgs);
+    {
+        Invocation invocation{this, &invokeArgs, &parallelFor};
+        InvocationScope scope(&invocation);
+        execute(invokeArgs);
+    }
+    cleanup(invokeArgs);
+    if (tempPool)
+    {
+        m_tempPools.release(std::move(tempPool));
+    }
+}
+
+void MLIRCPURuntime::runParallelLoop(int64_t id, int64_t lb, int64_t ub, int64_t step)
+{
+    NGRAPH_CHECK(currentInvocation, "Parallel loop called outside of an MLIR invocation");
+    Invocation invocation = *currentInvocation;
+
+    // The outlined function takes the bounds of a chunk followed by the arguments of 'main'
+    std::string name = std::string("_mlir_ciface_") + parallelLoopFuncPrefix + std::to_string(id);
+    std::atomic<bool> failed(false);
+    (*invocation.parallelFor)((ub - lb + step - 1) / step, [&](int64_t first, int64_t last) {
+        int64_t begin = lb + first * step;
+        int64_t end = std::min(ub, lb + last * step);
+        SmallVector<void*, 8> chunkArgs = {&begin, &end};
+        chunkArgs.append(invocation.invokeArgs->begin(), invocation.invokeArgs->end());
+        auto invocationResult = invocation.runtime->m_engine->invoke(
+            name, llvm::MutableArrayRef<void*>(chunkArgs));
+        if (invocationResult)
+        {
+            llvm::consumeError(std::move(invocationResult));
+            failed = true;
+        }
+    });
+    NGRAPH_CHECK(!failed, "JIT invocation of '", name, "' failed\n");
 }
 
-void MLIRCPURuntime::run_internal(const std::vector<MemRefArg>& args, bool firstIteration)
+void MLIRCPURuntime::initialize()
 {
     // Create an MLIR execution engine. We use a null MLIR pass manager for now to
     // make sure we
     // don't run MLIR passes that were already run. We also pass a default
     // transformer created with
     // the default or user-provided optimization level.
+    auto llvmTransformer = mlir::makeOptimizingTransformer(
+        MLIRCPUBackend::mlirOptLevel, /*sizeLevel=*/0, MLIRCPUBackend::targetMachine.get());
+    auto maybeEngine = mlir::ExecutionEngine::create(
+        m_module.get(), llvmTransformer, MLIRCPUBackend::mlirOptLevel);
+    NGRAPH_CHECK(maybeEngine, "failed to construct an execution engine");
+    m_engine = std::move(maybeEngine.get());
 
-    if (!m_engine)
+    if (auto poolSize = m_module->getAttrOfType<mlir::IntegerAttr>(tempPoolSizeAttrName))
     {
-        auto llvmTransformer = mlir::makeOptimizingTransformer(
-            MLIRCPUBackend::mlirOptLevel, /*sizeLevel=*/0, MLIRCPUBackend::targetMachine.get());
-        auto maybeEngine = mlir::ExecutionEngine::create(
-            m_module.get(), llvmTransformer, MLIRCPUBackend::mlirOptLevel);
-        NGRAPH_CHECK(maybeEngine, "failed to construct an execution engine");
-        m_engine = std::move(maybeEngine.get());
+        m_tempPoolSize = static_cast<size_t>(poolSize.getInt());
     }
 
-    bindArguments(args);
-    execute(firstIteration);
-    cleanup();
+    // The attributes of the callbacks live in globals of the module, which are initialized
+    // once for all the calls
+    if (!clEnableBarePtrMemRefLowering)
+    {
+        auto invocationResult = m_engine->invoke("_mlir_ciface_callback_init");
+        if (clDumpObjectFile)
+        {
+            m_engine->dumpToObjectFile(clObjectFilename.empty() ? "jitted_mlir.o"
+                                                                : clObjectFilename.getValue());
+        }
+        NGRAPH_CHECK(!invocationResult, "JIT invocation of '_mlir_ciface_callback_init' failed\n");
+    }
 }
 
 // Binds MLIR function arguments to the proper values. This includes externally
 // allocated tensors
 // helpers to be used inside the function.
-void MLIRCPURuntime::bindArguments(const std::vector<MemRefArg>& args)
+SmallVector<void*, 8> MLIRCPURuntime::bindArguments(const std::vector<MemRefArg>& args)
 {
     NGRAPH_CHECK(m_module, "MLIR module is not ready.");
 
@@ -102,9 +202,6 @@ void MLIRCPURuntime::bindArguments(const std::vector<MemRefArg>& args)
     auto func = m_module->lookupSymbol<mlir::LLVM::LLVMFuncOp>(name);
     NGRAPH_CHECK(func && !func.getBlocks().empty(), "Function not found");
 
-    // Set external arguments
-    m_externalTensors = &args;
-
     // Create list with a type-erased double pointer for each invocation
     // arguments.
     // We currently use 'allocateMemrefArgs', which creates the arguments list per
@@ -112,92 +209,67 @@ void MLIRCPURuntime::bindArguments(const std::vector<MemRefArg>& args)
     // comment below).
     // StaticMemRef is just a struct with the actual pointer to the data.
 
-    for (auto i = 0; i < m_externalTensors->size(); i++)
+    std::vector<size_t> ranks;
+    for (auto i = 0; i < args.size(); i++)
     {
-        m_ranks.push_back((*m_externalTensors)[i].m_shape.size());
+        ranks.push_back(args[i].m_shape.size());
     }
-    auto expectedArguments = allocateMemrefArgs();
-    NGRAPH_CHECK(expectedArguments.size(), "Arguments can't be created");
-    m_invokeArgs = std::move(expectedArguments);
+    auto invokeArgs = allocateMemrefArgs(ranks);
+    NGRAPH_CHECK(invokeArgs.size(), "Arguments can't be created");
 
-    NGRAPH_CHECK(m_invokeArgs.size() == m_externalTensors->size(),
+    NGRAPH_CHECK(invokeArgs.size() == args.size(),
                  "Number of external tensors doesn't match number of function arguments");
 
     // Assign external tensor pointers to invocation arguments.
-    for (size_t i = 0, numArgs = m_invokeArgs.size(); i < numArgs; ++i)
+    for (size_t i = 0, numArgs = invokeArgs.size(); i < numArgs; ++i)
     {
         if (!clEnableBarePtrMemRefLowering)
         {
             // Default memref lowering lowers memrefs to StaticMemRef descriptors.
-            auto* memRefArg = *(reinterpret_cast<StaticMemRef**>(m_invokeArgs[i]));
-            memRefArg->allocatedPtr = (*m_externalTensors)[i].m_tensor;
-            memRefArg->alignedPtr = (*m_externalTensors)[i].m_tensor;
-            auto rank = m_ranks[i];
+            auto* memRefArg = *(reinterpret_cast<StaticMemRef**>(invokeArgs[i]));
+            memRefArg->allocatedPtr = args[i].m_tensor;
+            memRefArg->alignedPtr = args[i].m_tensor;
+            auto rank = ranks[i];
             for (auto j = 0; j < rank; j++)
             {
-                memRefArg->shapeAndStrides[j] = (*m_externalTensors)[i].m_shape[j];
-                memRefArg->shapeAndStrides[rank + j] = (*m_externalTensors)[i].m_strides[j];
+                memRefArg->shapeAndStrides[j] = args[i].m_shape[j];
+                memRefArg->shapeAndStrides[rank + j] = args[i].m_strides[j];
             }
         }
         else
         {
             // Custom memref lowering lowers memref arguments to bare pointers to
             // tensors.
-            auto** memRefArg = reinterpret_cast<void**>(m_invokeArgs[i]);
-            *memRefArg = (*m_externalTensors)[i].m_tensor;
+            auto** memRefArg = reinterpret_cast<void**>(invokeArgs[i]);
+            *memRefArg = args[i].m_tensor;
         }
     }
+    return invokeArgs;
 }
 
 // Lowers standard dialect to LLVM dialect and uses the MLIR execution engine to
 // execute the code.
-void MLIRCPURuntime::execute(bool firstIteration)
+void MLIRCPURuntime::execute(SmallVector<void*, 8>& invokeArgs)
 {
     // Invoke the JIT-compiled function with the arguments. Note that, for API
     // uniformity reasons, it takes a list of type-erased pointers to arguments.
     // Please, note that 'invoke' method is overloaded with a parameter pack
     // version.
     // Make sure the MutableArrayRef version is invoked.
-    if (!clEnableBarePtrMemRefLowering)
-    {
-        if (firstIteration)
-        {
-            auto invocationResult = m_engine->invoke("_mlir_ciface_callback_init");
-            if (clDumpObjectFile)
-            {
-                m_engine->dumpToObjectFile(clObjectFilename.empty() ? "jitted_mlir.o"
-                                                                    : clObjectFilename.getValue());
-            }
-            NGRAPH_CHECK(!invocationResult,
-                         "JIT invocation of '_mlir_ciface_callback_init' failed\n");
-        }
-
-        auto invocationResult =
-            m_engine->invoke("_mlir_ciface_main", llvm::MutableArrayRef<void*>(m_invokeArgs));
-        if (clDumpObjectFile)
-        {
-            m_engine->dumpToObjectFile(clObjectFilename.empty() ? "jitted_mlir.o"
-                                                                : clObjectFilename.getValue());
-        }
-        NGRAPH_CHECK(!invocationResult, "JIT invocation of '_mlir_ciface_main' failed\n");
-    }
-    else
+    auto name = clEnableBarePtrMemRefLowering ? "main" : "_mlir_ciface_main";
+    auto invocationResult = m_engine->invoke(name, llvm::MutableArrayRef<void*>(invokeArgs));
+    if (clDumpObjectFile)
     {
-        auto invocationResult =
-            m_engine->invoke("main", llvm::MutableArrayRef<void*>(m_invokeArgs));
-        if (clDumpObjectFile)
-        {
-            m_engine->dumpToObjectFile(clObjectFilename.empty() ? "jitted_mlir.o"
-                                                                : clObjectFilename.getValue());
-        }
-        NGRAPH_CHECK(!invocationResult, "JIT invocation of 'main' failed\n");
+        m_engine->dumpToObjectFile(clObjectFilename.empty() ? "jitted_mlir.o"
+                                                            : clObjectFilename.getValue());
     }
+    NGRAPH_CHECK(!invocationResult, "JIT invocation of '", name, "' failed\n");
 }
 
-void MLIRCPURuntime::cleanup()
+void MLIRCPURuntime::cleanup(SmallVector<void*, 8>& invokeArgs)
 {
     // Free void double pointer arguments without freeing external tensor data.
-    for (auto* arg : m_invokeArgs)
+    for (auto* arg : invokeArgs)
     {
         if (!clEnableBarePtrMemRefLowering)
         {
@@ -233,15 +305,15 @@ void MLIRCPURuntime::cleanup()
 //   arg0Ptr-> <data>
 //   arg1Ptr-> <data>
 //   ...
-SmallVector<void*, 8> MLIRCPURuntime::allocateMemrefArgs()
+SmallVector<void*, 8> MLIRCPURuntime::allocateMemrefArgs(const std::vector<size_t>& ranks)
 {
     SmallVector<void*, 8> args;
-    for (auto i = 0; i < m_externalTensors->size(); i++)
+    for (auto i = 0; i < ranks.size(); i++)
     {
         if (!clEnableBarePtrMemRefLowering)
         {
             // Default memref lowering lowers memrefs to StaticMemRef descriptors.
-            auto descriptor = allocateDefaultMemrefDescriptor(m_ranks[i]);
+            auto descriptor = allocateDefaultMemrefDescriptor(ranks[i]);
             StaticMemRef** arg = reinterpret_cast<StaticMemRef**>(malloc(sizeof(StaticMemRef*)));
             *arg = descriptor;
             args.push_back(arg);
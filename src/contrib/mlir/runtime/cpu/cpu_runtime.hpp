@@ -20,12 +20,15 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <mlir/ExecutionEngine/ExecutionEngine.h>
 #include <mlir/IR/Builders.h>
 #include <mlir/IR/Module.h>
 #include <mlir/IR/Types.h>
 #include "contrib/mlir/backend/backend.hpp"
+#include "contrib/mlir/runtime/cpu/memory_manager.hpp"
 #include "contrib/mlir/runtime/runtime.hpp"
 
 namespace ngraph
@@ -51,24 +54,42 @@ namespace ngraph
             /// A CPU Runtime is an MLIR runtime that owns an MLIR context and a module
             /// The module should be in LLVM dialect and ready to be lowered via an MLIR
             /// ExecutionEngine. The runtime owns the context and must out-live any MLIR
-            /// code Compilation and execution.
+            /// code Compilation and execution. A runtime can be shared by several callers,
+            /// and run concurrently, once its module is set.
             class MLIRCPURuntime : public MLIRRuntime
             {
             public:
-                /// Executes a pre-compiled subgraph
-                void run(const std::vector<MemRefArg>& args, bool firstIteration) override;
+                /// Runs `body` on sub-ranges [begin, end) covering [0, count), possibly
+                /// concurrently, and returns once all of them are done
+                using ParallelFor = std::function<void(
+                    int64_t count, const std::function<void(int64_t, int64_t)>& body)>;
+
+                /// Executes a pre-compiled subgraph, running its parallel loops on the
+                /// calling thread
+                void run(const std::vector<MemRefArg>& args) override;
+
+                /// Executes a pre-compiled subgraph, splitting the iterations of its parallel
+                /// loops with `parallelFor`
+                void run(const std::vector<MemRefArg>& args, const ParallelFor& parallelFor);
+
+                /// Runs the iterations [lb, ub) of the parallel loop `id` of the subgraph the
+                /// calling thread is executing. Called by the 'callback_parallel_for'
+                /// callback.
+                static void runParallelLoop(int64_t id, int64_t lb, int64_t ub, int64_t step);
 
             private:
-                void run_internal(const std::vector<MemRefArg>& args, bool firstIteration);
+                // Creates the execution engine and initializes the callbacks of the module, the
+                // first time the runtime runs
+                void initialize();
                 // Bind external tensors to MLIR module entry point
-                void bindArguments(const std::vector<MemRefArg>& args);
+                llvm::SmallVector<void*, 8> bindArguments(const std::vector<MemRefArg>& args);
                 // Invokes an MLIR module entry point with bound arguments
-                void execute(bool firstIteration);
+                void execute(llvm::SmallVector<void*, 8>& invokeArgs);
                 // Cleans up allocated args
-                void cleanup();
+                void cleanup(llvm::SmallVector<void*, 8>& invokeArgs);
 
                 /// Helper to create memref arguments for MLIR function signature
-                llvm::SmallVector<void*, 8> allocateMemrefArgs();
+                llvm::SmallVector<void*, 8> allocateMemrefArgs(const std::vector<size_t>& ranks);
 
                 /// Helper to allocate a default MemRef descriptor for LLVM. Handles static
                 /// shapes
@@ -76,13 +97,11 @@ namespace ngraph
                 StaticMemRef* allocateDefaultMemrefDescriptor(size_t);
 
             private:
-                // Pointers to externally allocated memory for sub-graph's input and output
-                // tensors.
-                const std::vector<MemRefArg>* m_externalTensors;
-                // Arguments for the MLIR function generated for the nGraph sub-graph.
-                llvm::SmallVector<void*, 8> m_invokeArgs;
+                std::once_flag m_initialized;
                 std::unique_ptr<::mlir::ExecutionEngine> m_engine;
-                std::vector<size_t> m_ranks;
+                // Size of the buffer holding the temporaries of a call, 0 if there are none
+                size_t m_tempPoolSize = 0;
+                MLIRMemPool m_tempPools;
             };
         }
     }
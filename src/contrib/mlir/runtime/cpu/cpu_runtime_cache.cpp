@@ -0,0 +1,85 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+// NOTE: This file follows nGraph format style.
+// Follows nGraph naming convention for public APIs only, else MLIR naming
+// convention.
+
+#include "cpu_runtime_cache.hpp"
+#include "contrib/mlir/backend/cpu/cpu_backend.hpp"
+#include "contrib/mlir/core/compiler.hpp"
+
+#include <llvm/Support/raw_ostream.h>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+using namespace ngraph;
+using namespace ngraph::runtime::ngmlir;
+
+namespace
+{
+    std::mutex cacheMutex;
+    std::unordered_map<std::string, std::shared_ptr<MLIRCPURuntime>> cache;
+}
+
+std::shared_ptr<MLIRCPURuntime>
+    MLIRCPURuntimeCache::get_runtime(std::shared_ptr<ngraph::Function> function)
+{
+    // Compilations are serialized: the LLVM target machine of the CPU backend is shared.
+    std::lock_guard<std::mutex> lock(cacheMutex);
+
+    // The runtime contains the context and must out-live the compilation, so the sub-graph is
+    // translated in the context of a new runtime, which is dropped if it turns out to be a
+    // duplicate.
+    auto runtime = std::make_shared<MLIRCPURuntime>();
+    mlir::MLIRContext& context = runtime->get_context();
+    MLIRCompiler mlirCompiler(function, context);
+    // Compile to NG dialect
+    mlirCompiler.compile();
+
+    // The printed module names the values by position and does not print locations, so
+    // identical sub-graphs print identically whatever the names of their nodes.
+    std::string key;
+    llvm::raw_string_ostream keyStream(key);
+    mlirCompiler.get_module()->print(keyStream);
+    keyStream.flush();
+
+    auto it = cache.find(key);
+    if (it != cache.end())
+    {
+        return it->second;
+    }
+
+    // Codegen to LLVM dialect and store the module into the runtime
+    MLIRCPUBackend mlirBackend(mlirCompiler.get_module(), context);
+    mlirBackend.codegen();
+    runtime->set_module(mlirBackend.get_module());
+    cache.emplace(std::move(key), runtime);
+    return runtime;
+}
+
+size_t MLIRCPURuntimeCache::size()
+{
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    return cache.size();
+}
+
+void MLIRCPURuntimeCache::clear()
+{
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    cache.clear();
+}
@@ -0,0 +1,54 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+// NOTE: This file follows nGraph format style.
+// Follows nGraph naming convention for public APIs only, else MLIR naming
+// convention.
+
+#pragma once
+
+#include <memory>
+#include "contrib/mlir/runtime/cpu/cpu_runtime.hpp"
+#include "ngraph/function.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace ngmlir
+        {
+            /// Process-wide cache of JIT-compiled sub-graphs. A sub-graph is keyed by the
+            /// nGraph dialect module it translates to, so identical sub-graphs, whether they
+            /// come from several CompiledKernel ops or from several executables, are lowered
+            /// and JIT-compiled once and share one runtime. The dialect types carry static
+            /// shapes, so each shape of a sub-graph has its own entry.
+            class MLIRCPURuntimeCache
+            {
+            public:
+                /// Returns the runtime of a sub-graph, compiling it if no identical sub-graph
+                /// was compiled before. MLIRCompiler and MLIRCPUBackend must be initialized.
+                static std::shared_ptr<MLIRCPURuntime>
+                    get_runtime(std::shared_ptr<ngraph::Function> function);
+
+                /// Number of distinct sub-graphs compiled so far
+                static size_t size();
+
+                /// Drops the cached runtimes. Runtimes in use stay alive until released.
+                static void clear();
+            };
+        }
+    }
+}
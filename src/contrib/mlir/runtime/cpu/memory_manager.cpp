@@ -23,6 +23,7 @@
 #include <memory>
 #include "ngraph/ngraph_visibility.hpp"
 
+using namespace ngraph::runtime;
 using namespace ngraph::runtime::ngmlir;
 
 /// Call back to allocate memory for temps from JIT'ed code
@@ -45,3 +46,23 @@ void MLIRMemMgr::freeAll()
         free(p);
     }
 }
+
+std::unique_ptr<AlignedBuffer> MLIRMemPool::acquire(size_t size)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_buffers.empty() && m_buffers.back()->size() >= size)
+        {
+            std::unique_ptr<AlignedBuffer> buffer = std::move(m_buffers.back());
+            m_buffers.pop_back();
+            return buffer;
+        }
+    }
+    return std::unique_ptr<AlignedBuffer>(new AlignedBuffer(size));
+}
+
+void MLIRMemPool::release(std::unique_ptr<AlignedBuffer> buffer)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_buffers.push_back(std::move(buffer));
+}
@@ -21,10 +21,14 @@
 
 #pragma once
 
+#include <memory>
+#include <mutex>
 #include <stdint.h>
 #include <stdlib.h>
 #include <vector>
 
+#include "ngraph/runtime/aligned_buffer.hpp"
+
 namespace ngraph
 {
     namespace runtime
@@ -49,6 +53,27 @@ namespace ngraph
             private:
                 std::vector<void*> ptrList;
             };
+
+            /// Name of the module attribute holding the size, in bytes, of the buffer the
+            /// temporaries of 'main' are planned into
+            constexpr const char* tempPoolSizeAttrName = "ngraph.temp_pool_size";
+
+            /// Buffers holding the temporaries of the calls of a compiled sub-graph. The
+            /// buffers are kept across calls, so that a call only allocates when it runs
+            /// concurrently with more calls than ever before.
+            class MLIRMemPool
+            {
+            public:
+                /// Returns a buffer of at least `size` bytes, reusing a released one if any
+                std::unique_ptr<AlignedBuffer> acquire(size_t size);
+
+                /// Keeps `buffer` for the next calls
+                void release(std::unique_ptr<AlignedBuffer> buffer);
+
+            private:
+                std::mutex m_mutex;
+                std::vector<std::unique_ptr<AlignedBuffer>> m_buffers;
+            };
         }
     }
 }
@@ -14,51 +14,230 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+
 #include "ngraph/axis_set.hpp"
 #include "ngraph/util.hpp"
 
+constexpr size_t ngraph::AxisSet::inline_capacity;
+
 ngraph::AxisSet::AxisSet()
-    : std::set<size_t>()
 {
 }
 
 ngraph::AxisSet::AxisSet(const std::initializer_list<size_t>& axes)
-    : std::set<size_t>(axes)
+    : AxisSet(axes.begin(), axes.end())
 {
 }
 
 ngraph::AxisSet::AxisSet(const std::set<size_t>& axes)
-    : std::set<size_t>(axes)
+    : AxisSet(axes.begin(), axes.end())
 {
 }
 
 ngraph::AxisSet::AxisSet(const std::vector<size_t>& axes)
-    : std::set<size_t>(axes.begin(), axes.end())
+    : AxisSet(axes.begin(), axes.end())
 {
 }
 
 ngraph::AxisSet::AxisSet(const AxisSet& axes)
-    : std::set<size_t>(axes)
 {
+    *this = axes;
+}
+
+ngraph::AxisSet::AxisSet(AxisSet&& axes) noexcept
+{
+    *this = std::move(axes);
 }
 
 ngraph::AxisSet& ngraph::AxisSet::operator=(const AxisSet& v)
 {
-    static_cast<std::set<size_t>*>(this)->operator=(v);
+    if (this != &v)
+    {
+        clear();
+        if (v.m_size > m_capacity)
+        {
+            delete[] m_heap;
+            m_heap = new size_t[v.m_size];
+            m_capacity = v.m_size;
+        }
+        std::copy(v.begin(), v.end(), data());
+        m_size = v.m_size;
+        m_mask = v.m_mask;
+    }
     return *this;
 }
 
 ngraph::AxisSet& ngraph::AxisSet::operator=(AxisSet&& v) noexcept
 {
-    static_cast<std::set<size_t>*>(this)->operator=(v);
+    if (this != &v)
+    {
+        if (v.m_heap)
+        {
+            delete[] m_heap;
+            m_heap = v.m_heap;
+            m_capacity = v.m_capacity;
+            v.m_heap = nullptr;
+            v.m_capacity = inline_capacity;
+        }
+        else
+        {
+            std::copy(v.begin(), v.end(), data());
+        }
+        m_size = v.m_size;
+        m_mask = v.m_mask;
+        v.m_size = 0;
+        v.m_mask = 0;
+    }
     return *this;
 }
 
+ngraph::AxisSet::~AxisSet()
+{
+    delete[] m_heap;
+}
+
+ngraph::AxisSet::operator std::set<size_t>() const
+{
+    return std::set<size_t>(begin(), end());
+}
+
 std::vector<int64_t> ngraph::AxisSet::to_vector() const
 {
     return std::vector<int64_t>(this->begin(), this->end());
 }
 
+ngraph::AxisSet::const_iterator ngraph::AxisSet::find(size_t axis) const
+{
+    if (axis < 64 && !((m_mask >> axis) & 1))
+    {
+        return end();
+    }
+    auto it = lower_bound(axis);
+    return it != end() && *it == axis ? it : end();
+}
+
+ngraph::AxisSet::const_iterator ngraph::AxisSet::lower_bound(size_t axis) const
+{
+    return std::lower_bound(begin(), end(), axis);
+}
+
+ngraph::AxisSet::const_iterator ngraph::AxisSet::upper_bound(size_t axis) const
+{
+    return std::upper_bound(begin(), end(), axis);
+}
+
+void ngraph::AxisSet::clear()
+{
+    m_size = 0;
+    m_mask = 0;
+}
+
+void ngraph::AxisSet::insert_at(size_t index, size_t axis)
+{
+    if (m_size == m_capacity)
+    {
+        size_t capacity = 2 * m_capacity;
+        size_t* heap = new size_t[capacity];
+        std::copy(begin(), end(), heap);
+        delete[] m_heap;
+        m_heap = heap;
+        m_capacity = capacity;
+    }
+    size_t* axes = data();
+    std::copy_backward(axes + index, axes + m_size, axes + m_size + 1);
+    axes[index] = axis;
+    m_size++;
+    if (axis < 64)
+    {
+        m_mask |= uint64_t(1) << axis;
+    }
+}
+
+std::pair<ngraph::AxisSet::const_iterator, bool> ngraph::AxisSet::insert(size_t axis)
+{
+    auto it = lower_bound(axis);
+    if (it != end() && *it == axis)
+    {
+        return std::make_pair(it, false);
+    }
+    size_t index = it - begin();
+    insert_at(index, axis);
+    return std::make_pair(begin() + index, true);
+}
+
+ngraph::AxisSet::const_iterator ngraph::AxisSet::insert(const_iterator hint, size_t axis)
+{
+    if ((hint == begin() || *(hint - 1) < axis) && (hint == end() || axis < *hint))
+    {
+        size_t index = hint - begin();
+        insert_at(index, axis);
+        return begin() + index;
+    }
+    return insert(axis).first;
+}
+
+size_t ngraph::AxisSet::erase(size_t axis)
+{
+    auto it = find(axis);
+    if (it == end())
+    {
+        return 0;
+    }
+    erase(it);
+    return 1;
+}
+
+ngraph::AxisSet::const_iterator ngraph::AxisSet::erase(const_iterator position)
+{
+    size_t index = position - begin();
+    size_t* axes = data();
+    if (axes[index] < 64)
+    {
+        m_mask &= ~(uint64_t(1) << axes[index]);
+    }
+    std::copy(axes + index + 1, axes + m_size, axes + index);
+    m_size--;
+    return begin() + index;
+}
+
+void ngraph::AxisSet::swap(AxisSet& other) noexcept
+{
+    AxisSet tmp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(tmp);
+}
+
+bool ngraph::operator==(const AxisSet& a, const AxisSet& b)
+{
+    return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin());
+}
+
+bool ngraph::operator!=(const AxisSet& a, const AxisSet& b)
+{
+    return !(a == b);
+}
+
+bool ngraph::operator<(const AxisSet& a, const AxisSet& b)
+{
+    return std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end());
+}
+
+bool ngraph::operator>(const AxisSet& a, const AxisSet& b)
+{
+    return b < a;
+}
+
+bool ngraph::operator<=(const AxisSet& a, const AxisSet& b)
+{
+    return !(b < a);
+}
+
+bool ngraph::operator>=(const AxisSet& a, const AxisSet& b)
+{
+    return !(a < b);
+}
+
 std::ostream& ngraph::operator<<(std::ostream& s, const AxisSet& axis_set)
 {
     s << "AxisSet{";
@@ -17,6 +17,10 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
 #include <ostream>
 #include <set>
 #include <vector>
@@ -27,9 +31,29 @@
 namespace ngraph
 {
     /// \brief A set of axes.
-    class AxisSet : public std::set<size_t>
+    ///
+    /// The axes are kept sorted in one buffer, inside the set itself for up to
+    /// `inline_capacity` axes, so that building, copying and walking the small sets of
+    /// reductions, broadcasts and softmax take no allocation. Membership of axes below 64 is
+    /// a bit test. The interface is that of the `std::set<size_t>` the class used to be.
+    class AxisSet
     {
     public:
+        using key_type = size_t;
+        using value_type = size_t;
+        using size_type = size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = const size_t&;
+        using const_reference = const size_t&;
+        using pointer = const size_t*;
+        using const_pointer = const size_t*;
+        using iterator = const size_t*;
+        using const_iterator = const size_t*;
+        using reverse_iterator = std::reverse_iterator<const_iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        static constexpr size_t inline_capacity = 6;
+
         NGRAPH_API AxisSet();
 
         NGRAPH_API AxisSet(const std::initializer_list<size_t>& axes);
@@ -38,15 +62,86 @@ namespace ngraph
 
         NGRAPH_API AxisSet(const std::vector<size_t>& axes);
 
+        template <typename InputIt>
+        AxisSet(InputIt first, InputIt last)
+            : AxisSet()
+        {
+            insert(first, last);
+        }
+
         NGRAPH_API AxisSet(const AxisSet& axes);
 
+        NGRAPH_API AxisSet(AxisSet&& axes) noexcept;
+
         NGRAPH_API AxisSet& operator=(const AxisSet& v);
 
         NGRAPH_API AxisSet& operator=(AxisSet&& v) noexcept;
 
+        NGRAPH_API ~AxisSet();
+
+        NGRAPH_API operator std::set<size_t>() const;
+
         NGRAPH_API std::vector<int64_t> to_vector() const;
+
+        const_iterator begin() const { return data(); }
+        const_iterator end() const { return data() + m_size; }
+        const_iterator cbegin() const { return begin(); }
+        const_iterator cend() const { return end(); }
+        const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+        const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+        const_reverse_iterator crbegin() const { return rbegin(); }
+        const_reverse_iterator crend() const { return rend(); }
+        size_t size() const { return m_size; }
+        bool empty() const { return m_size == 0; }
+        size_t max_size() const { return std::numeric_limits<size_t>::max() / sizeof(size_t); }
+        size_t count(size_t axis) const
+        {
+            return axis < 64 ? (m_mask >> axis) & 1 : (find(axis) != end() ? 1 : 0);
+        }
+
+        NGRAPH_API const_iterator find(size_t axis) const;
+        NGRAPH_API const_iterator lower_bound(size_t axis) const;
+        NGRAPH_API const_iterator upper_bound(size_t axis) const;
+
+        NGRAPH_API void clear();
+        NGRAPH_API std::pair<const_iterator, bool> insert(size_t axis);
+        /// \brief Inserts `axis`, checking first whether it belongs at `hint`, as appending
+        ///        the largest axis so far does.
+        NGRAPH_API const_iterator insert(const_iterator hint, size_t axis);
+        template <typename InputIt>
+        void insert(InputIt first, InputIt last)
+        {
+            for (; first != last; ++first)
+            {
+                insert(end(), static_cast<size_t>(*first));
+            }
+        }
+        void insert(std::initializer_list<size_t> axes) { insert(axes.begin(), axes.end()); }
+        std::pair<const_iterator, bool> emplace(size_t axis) { return insert(axis); }
+        NGRAPH_API size_t erase(size_t axis);
+        NGRAPH_API const_iterator erase(const_iterator position);
+        NGRAPH_API void swap(AxisSet& other) noexcept;
+
+    private:
+        const size_t* data() const { return m_heap ? m_heap : m_inline; }
+        size_t* data() { return m_heap ? m_heap : m_inline; }
+        void insert_at(size_t index, size_t axis);
+
+        // Bit i is set when axis i < 64 is in the set
+        uint64_t m_mask{0};
+        size_t m_size{0};
+        size_t m_capacity{inline_capacity};
+        size_t* m_heap{nullptr};
+        size_t m_inline[inline_capacity];
     };
 
+    NGRAPH_API bool operator==(const AxisSet& a, const AxisSet& b);
+    NGRAPH_API bool operator!=(const AxisSet& a, const AxisSet& b);
+    NGRAPH_API bool operator<(const AxisSet& a, const AxisSet& b);
+    NGRAPH_API bool operator>(const AxisSet& a, const AxisSet& b);
+    NGRAPH_API bool operator<=(const AxisSet& a, const AxisSet& b);
+    NGRAPH_API bool operator>=(const AxisSet& a, const AxisSet& b);
+
     template <>
     class NGRAPH_API AttributeAdapter<AxisSet> : public ValueAccessor<std::vector<int64_t>>
     {
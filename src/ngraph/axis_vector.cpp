@@ -35,11 +35,21 @@ ngraph::AxisVector::AxisVector(const std::vector<size_t>& axes)
 {
 }
 
+ngraph::AxisVector::AxisVector(std::vector<size_t>&& axes) noexcept
+    : std::vector<size_t>(std::move(axes))
+{
+}
+
 ngraph::AxisVector::AxisVector(const AxisVector& axes)
     : std::vector<size_t>(axes)
 {
 }
 
+ngraph::AxisVector::AxisVector(AxisVector&& axes) noexcept
+    : std::vector<size_t>(std::move(axes))
+{
+}
+
 ngraph::AxisVector::AxisVector(size_t n)
     : std::vector<size_t>(n)
 {
@@ -57,7 +67,7 @@ ngraph::AxisVector& ngraph::AxisVector::operator=(const AxisVector& v)
 
 ngraph::AxisVector& ngraph::AxisVector::operator=(AxisVector&& v) noexcept
 {
-    static_cast<std::vector<size_t>*>(this)->operator=(v);
+    static_cast<std::vector<size_t>*>(this)->operator=(std::move(v));
     return *this;
 }
 
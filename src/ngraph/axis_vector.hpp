@@ -33,8 +33,12 @@ namespace ngraph
 
         NGRAPH_API AxisVector(const std::vector<size_t>& axes);
 
+        NGRAPH_API AxisVector(std::vector<size_t>&& axes) noexcept;
+
         NGRAPH_API AxisVector(const AxisVector& axes);
 
+        NGRAPH_API AxisVector(AxisVector&& axes) noexcept;
+
         NGRAPH_API explicit AxisVector(size_t n);
 
         template <class InputIterator>
@@ -0,0 +1,99 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/builder/preprocess.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/convert.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/op/transpose.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+shared_ptr<op::v0::Parameter> builder::add_preprocessing(const shared_ptr<Function>& function,
+                                                         size_t parameter_index,
+                                                         const PreprocessSteps& steps)
+{
+    auto parameter = function->get_parameters().at(parameter_index);
+    NGRAPH_CHECK(parameter->get_element_type() == element::f32 &&
+                     parameter->get_output_partial_shape(0).rank().compatible(4) &&
+                     parameter->get_output_partial_shape(0).is_static(),
+                 "Preprocessing expects an f32 NCHW parameter, got ",
+                 parameter->get_element_type(),
+                 parameter->get_output_partial_shape(0));
+    Shape shape = parameter->get_output_shape(0);
+    size_t channels = shape[1];
+    size_t height_axis = steps.channels_last ? 1 : 2;
+
+    Shape frame_shape = steps.channels_last ? Shape{shape[0], shape[2], shape[3], channels} : shape;
+    if (!steps.frame_size.empty())
+    {
+        NGRAPH_CHECK(steps.frame_size.size() == 2,
+                     "Preprocessing frame size must be {height, width}, got ",
+                     steps.frame_size);
+        frame_shape[height_axis] = steps.frame_size[0];
+        frame_shape[height_axis + 1] = steps.frame_size[1];
+    }
+    auto frames = make_shared<op::v0::Parameter>(steps.element_type, frame_shape);
+    frames->set_friendly_name(parameter->get_friendly_name());
+
+    Output<Node> value = frames;
+    if (steps.element_type != element::f32)
+    {
+        value = make_shared<op::v0::Convert>(value, element::f32);
+    }
+    if (frame_shape[height_axis] != shape[2] || frame_shape[height_axis + 1] != shape[3])
+    {
+        auto attrs = steps.resize_attrs;
+        attrs.axes = AxisSet{height_axis, height_axis + 1};
+        auto sizes = op::v0::Constant::create(
+            element::i64, Shape{2}, vector<int64_t>{int64_t(shape[2]), int64_t(shape[3])});
+        value = make_shared<op::v3::Interpolate>(value, sizes, attrs);
+    }
+
+    auto per_channel = [&](const vector<float>& values) {
+        NGRAPH_CHECK(values.size() == 1 || values.size() == channels,
+                     "Preprocessing needs one value or one per channel, got ",
+                     values.size());
+        Shape values_shape;
+        if (values.size() > 1)
+        {
+            values_shape = steps.channels_last ? Shape{channels} : Shape{channels, 1, 1};
+        }
+        return op::v0::Constant::create(element::f32, values_shape, values);
+    };
+    if (!steps.mean.empty())
+    {
+        value = make_shared<op::v1::Subtract>(value, per_channel(steps.mean));
+    }
+    if (!steps.scale.empty())
+    {
+        value = make_shared<op::v1::Multiply>(value, per_channel(steps.scale));
+    }
+    if (steps.channels_last)
+    {
+        auto order = op::v0::Constant::create(element::i64, Shape{4}, vector<int64_t>{0, 3, 1, 2});
+        value = make_shared<op::v1::Transpose>(value, order);
+    }
+
+    for (auto input : parameter->output(0).get_target_inputs())
+    {
+        input.replace_source_output(value);
+    }
+    function->replace_parameter(parameter_index, frames);
+    return frames;
+}
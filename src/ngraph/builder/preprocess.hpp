@@ -0,0 +1,64 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/op/interpolate.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/type/element_type.hpp"
+
+namespace ngraph
+{
+    namespace builder
+    {
+        /// \brief How the frames fed to an input differ from the f32 NCHW tensor it expects.
+        struct PreprocessSteps
+        {
+            /// The element type of the frames, converted to f32 first
+            element::Type element_type = element::u8;
+            /// Whether the frames are NHWC rather than NCHW
+            bool channels_last = true;
+            /// The height and width of the frames, which are resized to those of the input.
+            /// Empty if they already match.
+            Shape frame_size;
+            /// The interpolation of the resize. The axes are set from `channels_last`.
+            op::v3::Interpolate::InterpolateAttrs resize_attrs;
+            /// Subtracted per channel after the resize; one value for all channels, or none
+            std::vector<float> mean;
+            /// Multiplied per channel after the mean; one value for all channels, or none
+            std::vector<float> scale;
+        };
+
+        /// \brief Replaces the f32 NCHW parameter `parameter_index` of `function` with one
+        ///        taking frames as described by `steps`, followed by the conversion, resize,
+        ///        normalization and transposition that turn them into what the parameter was.
+        ///
+        /// The steps are made of v1 and v3 ops, so any backend runs them; the CPU backend runs
+        /// them as one kernel that writes the layout of a convolution using the result.
+        /// \returns The new parameter
+        NGRAPH_API
+        std::shared_ptr<op::v0::Parameter> add_preprocessing(
+            const std::shared_ptr<Function>& function,
+            size_t parameter_index,
+            const PreprocessSteps& steps);
+    }
+}
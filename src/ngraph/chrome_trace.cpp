@@ -14,10 +14,13 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <atomic>
+#include <cstdlib>
 #include <iostream>
-#include <map>
+#include <memory>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "chrome_trace.hpp"
 #include "ngraph/env_util.hpp"
@@ -36,11 +39,171 @@ static bool read_tracing_env_var()
 mutex event::Manager::s_file_mutex;
 bool event::Manager::s_tracing_enabled = read_tracing_env_var();
 
+namespace
+{
+    struct Event
+    {
+        char phase;
+        size_t timestamp;
+        // Durations of complete ('X') events, ids of object events
+        size_t value;
+        string name;
+        string category;
+        string args;
+    };
+
+    // The events of one thread. The thread adds events at the head without a lock, and
+    // writers, holding the file mutex, remove them from the tail.
+    struct ThreadEvents
+    {
+        static constexpr size_t capacity = 8192;
+
+        ThreadEvents()
+            : events(capacity)
+        {
+            stringstream ss;
+            ss << "\"" << this_thread::get_id() << "\"";
+            thread_id = ss.str();
+        }
+
+        vector<Event> events;
+        atomic<size_t> head{0};
+        atomic<size_t> tail{0};
+        string thread_id;
+        // Set when the thread exits, after its last event
+        atomic<bool> orphaned{false};
+    };
+
+    constexpr size_t ThreadEvents::capacity;
+
+    mutex s_threads_mutex;
+
+    // The buffers own their events until they are written, and flush() drops the buffers of
+    // exited threads once they are empty. Never destroyed, so that close() can still write them
+    // at exit.
+    vector<shared_ptr<ThreadEvents>>& get_all_thread_events()
+    {
+        static auto s_thread_events = new vector<shared_ptr<ThreadEvents>>();
+        return *s_thread_events;
+    }
+
+    // A thread's view of its buffer, which it does not own. Marks the buffer orphaned when the
+    // thread exits.
+    struct ThreadEventsHandle
+    {
+        ~ThreadEventsHandle()
+        {
+            if (auto owned = owner.lock())
+            {
+                owned->orphaned.store(true, memory_order_release);
+            }
+        }
+
+        weak_ptr<ThreadEvents> owner;
+        // Valid while the buffer is not orphaned, since only orphaned buffers are dropped
+        ThreadEvents* events = nullptr;
+    };
+
+    ThreadEvents& get_thread_events()
+    {
+        static thread_local ThreadEventsHandle s_handle;
+        if (!s_handle.events)
+        {
+            auto events = make_shared<ThreadEvents>();
+            lock_guard<mutex> lock(s_threads_mutex);
+            get_all_thread_events().push_back(events);
+            s_handle.owner = events;
+            s_handle.events = events.get();
+        }
+        return *s_handle.events;
+    }
+
+    void write_event(ostream& out,
+                     const Event& event,
+                     const string& pid,
+                     const string& tid)
+    {
+        out << R"({"name":")" << event.name << R"(",)";
+        if (event.phase == 'X')
+        {
+            out << R"("cat":")" << event.category << R"(","ph":"X","pid":)" << pid
+                << R"(,"tid":)" << tid << R"(,"ts":)" << event.timestamp / 1000 << R"(,"dur":)"
+                << event.value / 1000;
+        }
+        else
+        {
+            out << R"("ph":")" << event.phase << R"(","id":")" << event.value << R"(","ts":)"
+                << event.timestamp / 1000 << R"(,"pid":)" << pid << R"(,"tid":)" << tid;
+        }
+        if (!event.args.empty())
+        {
+            out << R"(,"args":)" << event.args;
+        }
+        out << "}";
+    }
+}
+
+// Writes the events of `events` recorded so far. The caller holds the file mutex.
+static void write_thread_events(ThreadEvents& events,
+                                ofstream& out,
+                                const string& pid,
+                                bool& first_event)
+{
+    size_t tail = events.tail.load(memory_order_relaxed);
+    size_t head = events.head.load(memory_order_acquire);
+    if (tail == head)
+    {
+        return;
+    }
+    if (!out.is_open())
+    {
+        event::Manager::open();
+    }
+    for (; tail != head; tail++)
+    {
+        auto& event = events.events[tail % ThreadEvents::capacity];
+        if (!first_event)
+        {
+            out << ",\n";
+        }
+        first_event = false;
+        write_event(out, event, pid, events.thread_id);
+        // Release the strings now rather than when the slot is reused
+        event.name = string();
+        event.category = string();
+        event.args = string();
+    }
+    events.tail.store(head, memory_order_release);
+}
+
+// Whether nothing has been written since the trace was opened
+static bool s_first_event = true;
+
+void event::Manager::record(
+    char phase, size_t timestamp, size_t value, string name, string category, string args)
+{
+    // Writes what is left at exit. The stream is created first so it is destroyed after.
+    static bool s_close_at_exit = (get_output_stream(), atexit(close), true);
+    (void)s_close_at_exit;
+
+    ThreadEvents& events = get_thread_events();
+    size_t head = events.head.load(memory_order_relaxed);
+    if (head - events.tail.load(memory_order_acquire) == ThreadEvents::capacity)
+    {
+        // The buffer is full, so this thread writes its events itself
+        lock_guard<mutex> lock(get_mutex());
+        write_thread_events(events, get_output_stream(), get_process_id(), s_first_event);
+    }
+    events.events[head % ThreadEvents::capacity] =
+        Event{phase, timestamp, value, move(name), move(category), move(args)};
+    events.head.store(head + 1, memory_order_release);
+}
+
 event::Duration::Duration(const string& name, const string& category, const string& args)
 {
     if (Manager::is_tracing_enabled())
     {
-        m_start = Manager::get_current_microseconds();
+        m_start = Manager::get_current_nanoseconds();
         m_stop = 0;
         m_name = name;
         m_category = category;
@@ -52,39 +215,27 @@ void event::Duration::stop()
 {
     if (Manager::is_tracing_enabled())
     {
-        m_stop = Manager::get_current_microseconds();
+        m_stop = Manager::get_current_nanoseconds();
     }
 }
 
-void event::Duration::write()
+void event::Duration::set_args(const string& args)
 {
     if (Manager::is_tracing_enabled())
     {
-        size_t stop_time = (m_stop != 0 ? m_stop : Manager::get_current_microseconds());
-
-        lock_guard<mutex> lock(Manager::get_mutex());
-
-        ofstream& out = event::Manager::get_output_stream();
-        string str;
-        if (out.is_open() == false)
-        {
-            event::Manager::open();
-        }
-        else
-        {
-            str += ",\n";
-        }
+        m_args = args;
+    }
+}
 
-        str +=
-            R"({"name":")" + m_name + R"(","cat":")" + m_category + R"(","ph":"X","pid":)" +
-            Manager::get_process_id() + R"(,"tid":)" + Manager::get_thread_id() +
-            R"(,"ts":)" + to_string(m_start) + R"(,"dur":)" + to_string(stop_time - m_start);
-        if (!m_args.empty())
-        {
-            str += R"(,"args":)" + m_args;
-        }
-        str += "}";
-        out << str;
+void event::Duration::write()
+{
+    // m_start is 0 if the event was not started while tracing, or has been written already
+    if (Manager::is_tracing_enabled() && m_start != 0)
+    {
+        size_t stop_time = (m_stop != 0 ? m_stop : Manager::get_current_nanoseconds());
+        Manager::record(
+            'X', m_start, stop_time - m_start, move(m_name), move(m_category), move(m_args));
+        m_start = 0;
     }
 }
 
@@ -94,28 +245,8 @@ event::Object::Object(const string& name, const string& args)
 {
     if (Manager::is_tracing_enabled())
     {
-        lock_guard<mutex> lock(Manager::get_mutex());
-
-        ofstream& out = event::Manager::get_output_stream();
-        string str;
-        if (out.is_open() == false)
-        {
-            event::Manager::open();
-        }
-        else
-        {
-            str += ",\n";
-        }
-        str += R"({"name":")" + m_name + R"(","ph":"N","id":")" + to_string(m_id) +
-               R"(","ts":)" + to_string(Manager::get_current_microseconds()) +
-               R"(,"pid":)" + Manager::get_process_id() + R"(,"tid":)" + Manager::get_thread_id();
-        if (!args.empty())
-        {
-            str += R"(,"args":)" + args;
-        }
-        str += "}";
-
-        write_snapshot(out, args);
+        record('N', args);
+        record('O', args);
     }
 }
 
@@ -123,54 +254,21 @@ void event::Object::snapshot(const string& args)
 {
     if (Manager::is_tracing_enabled())
     {
-        lock_guard<mutex> lock(Manager::get_mutex());
-
-        ofstream& out = event::Manager::get_output_stream();
-        if (out.is_open() == false)
-        {
-            event::Manager::open();
-        }
-        else
-        {
-            Manager::get_output_stream() << ",\n";
-        }
-        write_snapshot(out, args);
+        record('O', args);
     }
 }
 
-void event::Object::write_snapshot(ostream& out, const string& args)
+void event::Object::destroy()
 {
-    string str = R"({"name":")" + m_name + R"(","ph":"O","id":")" + to_string(m_id) +
-                 R"(","ts":)" + to_string(Manager::get_current_microseconds()) +
-                 R"(,"pid":)" + Manager::get_process_id() + R"(,"tid":)" + Manager::get_thread_id();
-    if (!args.empty())
+    if (Manager::is_tracing_enabled())
     {
-        str += R"(,"args":)" + args;
+        record('D', string());
     }
-    str += "}";
-    out << str;
 }
 
-void event::Object::destroy()
+void event::Object::record(char phase, const string& args)
 {
-    if (Manager::is_tracing_enabled())
-    {
-        lock_guard<mutex> lock(Manager::get_mutex());
-
-        ofstream& out = event::Manager::get_output_stream();
-        if (out.is_open() == false)
-        {
-            event::Manager::open();
-        }
-        else
-        {
-            Manager::get_output_stream() << ",\n";
-        }
-        string str = R"({"name":")" + m_name + R"(","ph":"D","id":")" + to_string(m_id) +
-                     R"(","ts":)" + to_string(Manager::get_current_microseconds()) +
-                     R"(,"pid":)" + Manager::get_process_id() + R"(,"tid":)" +
-                     Manager::get_thread_id() + "}";
-    }
+    Manager::record(phase, Manager::get_current_nanoseconds(), m_id, m_name, string(), args);
 }
 
 void event::Manager::open(const string& path)
@@ -180,11 +278,38 @@ void event::Manager::open(const string& path)
     {
         out.open(path, ios_base::trunc);
         out << "[\n";
+        s_first_event = true;
+        // Terminates the trace at exit, so it is valid JSON even when nothing closes it
+        static bool s_close_at_exit = (atexit(close), true);
+        (void)s_close_at_exit;
+    }
+}
+
+void event::Manager::flush()
+{
+    lock_guard<mutex> lock(get_mutex());
+    lock_guard<mutex> threads_lock(s_threads_mutex);
+    auto& all_events = get_all_thread_events();
+    for (auto it = all_events.begin(); it != all_events.end();)
+    {
+        // Read first, so that the write below includes the last event of an exited thread
+        bool orphaned = (*it)->orphaned.load(memory_order_acquire);
+        write_thread_events(**it, get_output_stream(), get_process_id(), s_first_event);
+        if (orphaned)
+        {
+            it = all_events.erase(it);
+        }
+        else
+        {
+            it++;
+        }
     }
 }
 
 void event::Manager::close()
 {
+    flush();
+    lock_guard<mutex> lock(get_mutex());
     ofstream& out = get_output_stream();
     if (out.is_open())
     {
@@ -219,23 +344,3 @@ bool event::Manager::is_event_tracing_enabled()
 {
     return s_tracing_enabled;
 }
-
-string event::Manager::get_thread_id()
-{
-    thread::id tid = this_thread::get_id();
-    static map<thread::id, string> tid_map;
-    auto it = tid_map.find(tid);
-    string rc;
-    if (it == tid_map.end())
-    {
-        stringstream ss;
-        ss << "\"" << tid << "\"";
-        rc = ss.str();
-        tid_map.insert({tid, rc});
-    }
-    else
-    {
-        rc = it->second;
-    }
-    return rc;
-}
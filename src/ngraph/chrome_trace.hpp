@@ -73,6 +73,10 @@ namespace ngraph
 //
 // More information about this is at:
 // http://dev.chromium.org/developers/how-tos/trace-event-profiling-tool
+//
+// Events are not written as they end. Each thread moves them, with raw timestamps, into a ring
+// buffer of its own without taking a lock, and they are formatted and written by flush() and
+// close(), or by a thread whose buffer is full.
 
 class ngraph::event::Manager
 {
@@ -81,6 +85,9 @@ class ngraph::event::Manager
 
 public:
     static void open(const std::string& path = "runtime_event_trace.json");
+    /// \brief Writes the events recorded so far, opening the default path if nothing is open
+    static void flush();
+    /// \brief Writes the events recorded so far and terminates the trace
     static void close();
     static bool is_tracing_enabled() { return s_tracing_enabled; }
     static void enable_event_tracing();
@@ -88,13 +95,22 @@ public:
     static bool is_event_tracing_enabled();
 
 private:
+    /// \param value The duration of 'X' events, the object id of others
+    static void record(char phase,
+                       size_t timestamp,
+                       size_t value,
+                       std::string name,
+                       std::string category,
+                       std::string args);
     static std::ofstream& get_output_stream();
     static const std::string& get_process_id();
-    static size_t get_current_microseconds()
+    /// Raw timestamps, converted to microseconds when written
+    static size_t get_current_nanoseconds()
     {
-        return std::chrono::high_resolution_clock::now().time_since_epoch().count() / 1000;
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::high_resolution_clock::now().time_since_epoch())
+            .count();
     }
-    static std::string get_thread_id();
     static std::mutex& get_mutex() { return s_file_mutex; }
     static std::ostream s_ostream;
     static std::mutex s_file_mutex;
@@ -117,11 +133,14 @@ public:
     /// This funtion has an implicit stop() if stop() has not been previously called
     void write();
 
+    /// \brief Replace the args written with the event, for data only known once the event is
+    /// under way
+    void set_args(const std::string& args);
+
     Duration(const Duration&) = delete;
     Duration& operator=(Duration const&) = delete;
 
 private:
-    std::string to_json() const;
     size_t m_start{0};
     size_t m_stop{0};
     std::string m_name;
@@ -137,7 +156,7 @@ public:
     void destroy();
 
 private:
-    void write_snapshot(std::ostream& out, const std::string& args);
+    void record(char phase, const std::string& args);
     const std::string m_name;
     size_t m_id{0};
 };
@@ -14,7 +14,11 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <atomic>
+#include <future>
 #include <iostream>
+#include <mutex>
 #include <string>
 
 #include <clang/Basic/DiagnosticOptions.h>
@@ -79,10 +83,13 @@ class CompilerInfo
 {
 public:
     std::string pch_file;
-    shared_ptr<codegen::CompilerCore> compiler;
+    // Compilers not in use. A CompilerInstance is not thread safe, so every compile takes a
+    // compiler of its own out of this pool and returns it when done.
+    vector<shared_ptr<codegen::CompilerCore>> idle;
 };
 
 static unordered_map<std::string, CompilerInfo> s_compiler_info;
+static mutex s_compiler_info_mutex;
 
 static class StaticHandler
 {
@@ -90,6 +97,7 @@ public:
     StaticHandler() {}
     ~StaticHandler()
     {
+        lock_guard<mutex> lock(s_compiler_info_mutex);
         for (const auto& p : s_compiler_info)
         {
             file_util::remove_file(p.second.pch_file);
@@ -97,6 +105,40 @@ public:
     }
 } s_static_init;
 
+// Takes an idle compiler for the precompiled header source out of the pool, or makes a new one
+static shared_ptr<codegen::CompilerCore>
+    acquire_compiler(const std::string& precompiled_header_source,
+                     const vector<std::string>& header_search_paths)
+{
+    {
+        lock_guard<mutex> lock(s_compiler_info_mutex);
+        auto& idle = s_compiler_info[precompiled_header_source].idle;
+        if (!idle.empty())
+        {
+            auto compiler = idle.back();
+            idle.pop_back();
+            return compiler;
+        }
+    }
+    // Setting up a compiler initializes LLVM targets and parses global LLVM options
+    static mutex s_create_mutex;
+    lock_guard<mutex> lock(s_create_mutex);
+    auto compiler = make_shared<codegen::CompilerCore>();
+    for (const std::string& path : header_search_paths)
+    {
+        compiler->add_header_search_path(path);
+    }
+    compiler->set_precompiled_header_source(precompiled_header_source);
+    return compiler;
+}
+
+static void release_compiler(const std::string& precompiled_header_source,
+                             const shared_ptr<codegen::CompilerCore>& compiler)
+{
+    lock_guard<mutex> lock(s_compiler_info_mutex);
+    s_compiler_info[precompiled_header_source].idle.push_back(compiler);
+}
+
 codegen::Module::Module(std::unique_ptr<llvm::Module> module)
     : m_module(move(module))
 {
@@ -130,25 +172,69 @@ void codegen::Compiler::add_header_search_path(const std::string& path)
     m_header_search_paths.push_back(path);
 }
 
+std::vector<std::string> codegen::Compiler::get_library_header_paths()
+{
+    std::vector<std::string> paths;
+#ifdef EIGEN_HEADERS_PATH
+    paths.push_back(EIGEN_HEADERS_PATH);
+#endif
+#ifdef DNNL_HEADERS_PATH
+    paths.push_back(DNNL_HEADERS_PATH);
+#endif
+#ifdef TBB_HEADERS_PATH
+    paths.push_back(TBB_HEADERS_PATH);
+#endif
+    paths.push_back(NGRAPH_HEADERS_PATH);
+    return paths;
+}
+
 std::unique_ptr<codegen::Module> codegen::Compiler::compile(const std::string& source)
 {
     if (getenv_bool("NGRAPH_CODEGEN_DUMP_SOURCE"))
     {
         cout << source << endl;
     }
-    // lock_guard<mutex> lock(m_mutex);
-    CompilerInfo& compiler_info = s_compiler_info[m_precompiled_header_source];
-    if (!compiler_info.compiler)
+    auto compiler = acquire_compiler(m_precompiled_header_source, m_header_search_paths);
+    // A compiler that threw may be in a bad state and is not returned to the pool
+    auto rc = compiler->compile(m_compiler_action, source);
+    release_compiler(m_precompiled_header_source, compiler);
+    return rc;
+}
+
+std::vector<std::unique_ptr<codegen::Module>>
+    codegen::Compiler::compile(const std::vector<std::string>& sources, size_t max_threads)
+{
+    std::vector<std::unique_ptr<codegen::Module>> modules(sources.size());
+    if (sources.empty())
     {
-        compiler_info.compiler = make_shared<CompilerCore>();
-        for (const std::string& path : m_header_search_paths)
-        {
-            compiler_info.compiler->add_header_search_path(path);
-        }
-        compiler_info.compiler->set_precompiled_header_source(m_precompiled_header_source);
+        return modules;
     }
-    auto rc = compiler_info.compiler->compile(m_compiler_action, source);
-    return rc;
+
+    // The first source is compiled alone so that the precompiled header is generated before
+    // any of the workers need it
+    modules[0] = compile(sources[0]);
+
+    size_t thread_count = std::max<size_t>(1, std::min(max_threads, sources.size() - 1));
+    m_compiler_actions.clear();
+    m_compiler_actions.resize(sources.size());
+    atomic<size_t> next_source{1};
+    vector<future<void>> futures;
+    for (size_t i = 0; i < thread_count; ++i)
+    {
+        futures.push_back(async(launch::async, [&]() {
+            auto worker = acquire_compiler(m_precompiled_header_source, m_header_search_paths);
+            for (size_t j = next_source++; j < sources.size(); j = next_source++)
+            {
+                modules[j] = worker->compile(m_compiler_actions[j], sources[j]);
+            }
+            release_compiler(m_precompiled_header_source, worker);
+        }));
+    }
+    for (auto& f : futures)
+    {
+        f.get();
+    }
+    return modules;
 }
 
 static std::string GetExecutablePath(const char* Argv0)
@@ -334,15 +420,20 @@ std::unique_ptr<codegen::Module>
 
     preprocessor_options.RetainRemappedFileBuffers = true;
 
-    CompilerInfo& compiler_info = s_compiler_info[m_precompiled_header_source];
-    if (!m_precompiled_header_source.empty() && compiler_info.pch_file.empty())
+    string pch_file;
     {
-        compiler_info.pch_file = generate_pch(m_precompiled_header_source);
+        lock_guard<mutex> lock(s_compiler_info_mutex);
+        CompilerInfo& compiler_info = s_compiler_info[m_precompiled_header_source];
+        if (!m_precompiled_header_source.empty() && compiler_info.pch_file.empty())
+        {
+            compiler_info.pch_file = generate_pch(m_precompiled_header_source);
+        }
+        pch_file = compiler_info.pch_file;
     }
-    if (!compiler_info.pch_file.empty())
+    if (!pch_file.empty())
     {
         // Preprocessor options
-        preprocessor_options.ImplicitPCHInclude = compiler_info.pch_file;
+        preprocessor_options.ImplicitPCHInclude = pch_file;
         preprocessor_options.DisablePCHValidation = 0;
     }
 
@@ -60,10 +60,21 @@ public:
     void set_precompiled_header_source(const std::string& source);
     void add_header_search_path(const std::string& path);
     std::unique_ptr<ngraph::codegen::Module> compile(const std::string& source);
+    /// \brief Compiles independent translation units that share the precompiled header,
+    ///        using up to `max_threads` threads.
+    /// \returns One module per source, in order; an entry is nullptr if its source failed to
+    ///          compile.
+    std::vector<std::unique_ptr<ngraph::codegen::Module>>
+        compile(const std::vector<std::string>& sources, size_t max_threads);
     std::unique_ptr<clang::CodeGenAction>& get_compiler_action() { return m_compiler_action; }
+    /// \brief The Eigen, DNNL, TBB and nGraph header directories generated code is compiled
+    ///        against, for building it ahead of time with another compiler.
+    static std::vector<std::string> get_library_header_paths();
 
 private:
     std::unique_ptr<clang::CodeGenAction> m_compiler_action;
+    // Own the LLVM contexts of the modules returned by the multi-source compile
+    std::vector<std::unique_ptr<clang::CodeGenAction>> m_compiler_actions;
     std::shared_ptr<CompilerCore> m_compiler_core;
     std::string m_precompiled_header_source;
     std::vector<std::string> m_header_search_paths;
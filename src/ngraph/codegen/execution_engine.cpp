@@ -14,13 +14,82 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstdio>
+#include <fstream>
+#include <unordered_map>
+#ifdef _WIN32
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
 #include <llvm/ExecutionEngine/ExecutionEngine.h>
+#include <llvm/ExecutionEngine/ObjectCache.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Object/ObjectFile.h>
 #include <llvm/Support/Host.h>
 
 #include "ngraph/codegen/execution_engine.hpp"
+#include "ngraph/file_util.hpp"
+#include "ngraph/log.hpp"
 
 using namespace ngraph;
 
+namespace
+{
+    // Write-only object cache: stores the object code MCJIT generates for the modules it was
+    // given a path for, and counts the code generated for all of them. Reads go through
+    // ExecutionEngine::add_object_file so that a hit also skips the clang front end.
+    class ObjectFileWriter : public llvm::ObjectCache
+    {
+    public:
+        void add_module(const llvm::Module* module, const std::string& path)
+        {
+            m_paths[module] = path;
+        }
+
+        void notifyObjectCompiled(const llvm::Module* module, llvm::MemoryBufferRef obj) override
+        {
+            m_code_bytes += obj.getBufferSize();
+            auto it = m_paths.find(module);
+            if (it == m_paths.end())
+            {
+                return;
+            }
+            const std::string& path = it->second;
+
+            // Write to a temporary file first so concurrent processes never see a partial entry
+            std::string tmp_path = path + "." + std::to_string(getpid()) + "." +
+                                   std::to_string(reinterpret_cast<size_t>(this)) + ".tmp";
+            {
+                std::ofstream out(tmp_path, std::ios::binary);
+                out.write(obj.getBufferStart(), obj.getBufferSize());
+                if (!out)
+                {
+                    NGRAPH_DEBUG << "Could not write codegen object file " << tmp_path;
+                }
+            }
+            if (std::rename(tmp_path.c_str(), path.c_str()) != 0)
+            {
+                file_util::remove_file(tmp_path);
+            }
+        }
+
+        std::unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module*) override
+        {
+            return nullptr;
+        }
+
+        size_t get_code_bytes() const { return m_code_bytes; }
+
+    private:
+        std::unordered_map<const llvm::Module*, std::string> m_paths;
+        size_t m_code_bytes = 0;
+    };
+}
+
 codegen::ExecutionEngine::ExecutionEngine()
     : m_execution_engine{nullptr}
 {
@@ -38,21 +107,30 @@ bool codegen::ExecutionEngine::add_module(std::unique_ptr<ngraph::codegen::Modul
 {
     if (module)
     {
+        std::unique_ptr<llvm::Module> llvm_module = module->take_module();
+        const llvm::Module* module_key = llvm_module.get();
         if (!m_execution_engine)
         {
-            m_execution_engine.reset(llvm::EngineBuilder(module->take_module())
-                                         .setEngineKind(llvm::EngineKind::JIT)
-                                         .setOptLevel(llvm::CodeGenOpt::Aggressive)
-                                         .setMCPU(llvm::sys::getHostCPUName())
-                                         //  .setCodeModel(llvm::CodeModel::Medium)
-                                         .setErrorStr(&m_jit_error)
-                                         .create());
-
-            if (!m_execution_engine)
+            if (!create_execution_engine(std::move(llvm_module)))
             {
                 return false;
             }
         }
+        else
+        {
+            m_execution_engine->addModule(std::move(llvm_module));
+        }
+        if (!m_object_cache)
+        {
+            m_object_cache.reset(new ObjectFileWriter());
+            m_execution_engine->setObjectCache(m_object_cache.get());
+        }
+        if (!m_object_file_path.empty())
+        {
+            static_cast<ObjectFileWriter*>(m_object_cache.get())
+                ->add_module(module_key, m_object_file_path);
+            m_object_file_path.clear();
+        }
     }
     else
     {
@@ -62,6 +140,63 @@ bool codegen::ExecutionEngine::add_module(std::unique_ptr<ngraph::codegen::Modul
     return true;
 }
 
+bool codegen::ExecutionEngine::add_object_file(const std::string& path)
+{
+    auto object = llvm::object::ObjectFile::createObjectFile(path);
+    if (!object)
+    {
+        NGRAPH_DEBUG << "Could not load codegen object file " << path << ": "
+                     << llvm::toString(object.takeError());
+        return false;
+    }
+    if (!m_execution_engine)
+    {
+        // MCJIT is always created from a module; an empty one is enough to host the object
+        m_context.reset(new llvm::LLVMContext());
+        if (!create_execution_engine(
+                std::unique_ptr<llvm::Module>(new llvm::Module("ngraph_object", *m_context))))
+        {
+            return false;
+        }
+    }
+    m_loaded_code_bytes += object->getBinary()->getData().size();
+    m_execution_engine->addObjectFile(std::move(*object));
+    return true;
+}
+
+size_t codegen::ExecutionEngine::get_code_bytes() const
+{
+    size_t bytes = m_loaded_code_bytes;
+    if (m_object_cache)
+    {
+        bytes += static_cast<ObjectFileWriter*>(m_object_cache.get())->get_code_bytes();
+    }
+    return bytes;
+}
+
+void codegen::ExecutionEngine::set_object_file_path(const std::string& path)
+{
+    m_object_file_path = path;
+}
+
+std::string codegen::ExecutionEngine::get_host_cpu_name()
+{
+    return llvm::sys::getHostCPUName().str();
+}
+
+bool codegen::ExecutionEngine::create_execution_engine(std::unique_ptr<llvm::Module> module)
+{
+    m_execution_engine.reset(llvm::EngineBuilder(std::move(module))
+                                 .setEngineKind(llvm::EngineKind::JIT)
+                                 .setOptLevel(llvm::CodeGenOpt::Aggressive)
+                                 .setMCPU(llvm::sys::getHostCPUName())
+                                 //  .setCodeModel(llvm::CodeModel::Medium)
+                                 .setErrorStr(&m_jit_error)
+                                 .create());
+
+    return m_execution_engine != nullptr;
+}
+
 void codegen::ExecutionEngine::finalize()
 {
     if (m_execution_engine)
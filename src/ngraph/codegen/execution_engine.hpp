@@ -33,6 +33,8 @@ namespace llvm
 {
     class Module;
     class ExecutionEngine;
+    class LLVMContext;
+    class ObjectCache;
 }
 
 class ngraph::codegen::ExecutionEngine
@@ -42,7 +44,20 @@ public:
     ~ExecutionEngine();
 
     bool add_module(std::unique_ptr<ngraph::codegen::Module>& module);
+    /// \brief Loads a relocatable object file, such as one written by set_object_file_path,
+    ///        in place of a compiled module.
+    /// \returns false if the file cannot be read or no execution engine can be created.
+    bool add_object_file(const std::string& path);
+    /// \brief Writes the object code generated for the next module added to `path` when
+    ///        finalize() runs. Must be called before the add_module it applies to.
+    void set_object_file_path(const std::string& path);
     void finalize();
+    /// \brief Bytes of object code generated for the modules or loaded from object files
+    size_t get_code_bytes() const;
+
+    /// \brief Name of the host CPU that object code is generated for; object files are only
+    ///        valid on hosts with the same name.
+    static std::string get_host_cpu_name();
 
     template <typename ftype>
     std::function<ftype> find_function(const std::string& func_name)
@@ -51,9 +66,16 @@ public:
     }
 
 private:
+    // Declared before m_execution_engine, which refers to both of them, so they outlive it
+    std::unique_ptr<llvm::LLVMContext> m_context;
+    std::unique_ptr<llvm::ObjectCache> m_object_cache;
     std::unique_ptr<llvm::ExecutionEngine> m_execution_engine;
     std::string m_jit_error;
 
+    std::string m_object_file_path;
+    size_t m_loaded_code_bytes = 0;
+
+    bool create_execution_engine(std::unique_ptr<llvm::Module> module);
     void* get_pointer_to_named_function(const std::string& func_name);
     template <typename signature>
     std::function<signature> f_cast(void* f)
@@ -45,11 +45,21 @@ ngraph::Coordinate::Coordinate(const std::vector<size_t>& axes)
 {
 }
 
+ngraph::Coordinate::Coordinate(std::vector<size_t>&& axes) noexcept
+    : std::vector<size_t>(std::move(axes))
+{
+}
+
 ngraph::Coordinate::Coordinate(const Coordinate& axes)
     : std::vector<size_t>(axes)
 {
 }
 
+ngraph::Coordinate::Coordinate(Coordinate&& axes) noexcept
+    : std::vector<size_t>(std::move(axes))
+{
+}
+
 ngraph::Coordinate::Coordinate(size_t n, size_t initial_value)
     : std::vector<size_t>(n, initial_value)
 {
@@ -65,7 +75,7 @@ ngraph::Coordinate& ngraph::Coordinate::operator=(const Coordinate& v)
 
 ngraph::Coordinate& ngraph::Coordinate::operator=(Coordinate&& v) noexcept
 {
-    static_cast<std::vector<size_t>*>(this)->operator=(v);
+    static_cast<std::vector<size_t>*>(this)->operator=(std::move(v));
     return *this;
 }
 
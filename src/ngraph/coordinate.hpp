@@ -36,8 +36,12 @@ namespace ngraph
 
         NGRAPH_API Coordinate(const std::vector<size_t>& axes);
 
+        NGRAPH_API Coordinate(std::vector<size_t>&& axes) noexcept;
+
         NGRAPH_API Coordinate(const Coordinate& axes);
 
+        NGRAPH_API Coordinate(Coordinate&& axes) noexcept;
+
         NGRAPH_API Coordinate(size_t n, size_t initial_value = 0);
 
         NGRAPH_API ~Coordinate();
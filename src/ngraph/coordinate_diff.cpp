@@ -38,11 +38,21 @@ ngraph::CoordinateDiff::CoordinateDiff(const std::vector<std::ptrdiff_t>& diffs)
 {
 }
 
+ngraph::CoordinateDiff::CoordinateDiff(std::vector<std::ptrdiff_t>&& diffs) noexcept
+    : std::vector<std::ptrdiff_t>(std::move(diffs))
+{
+}
+
 ngraph::CoordinateDiff::CoordinateDiff(const CoordinateDiff& diffs)
     : std::vector<std::ptrdiff_t>(diffs)
 {
 }
 
+ngraph::CoordinateDiff::CoordinateDiff(CoordinateDiff&& diffs) noexcept
+    : std::vector<std::ptrdiff_t>(std::move(diffs))
+{
+}
+
 ngraph::CoordinateDiff::CoordinateDiff(size_t n, std::ptrdiff_t initial_value)
     : std::vector<std::ptrdiff_t>(n, initial_value)
 {
@@ -60,7 +70,7 @@ ngraph::CoordinateDiff& ngraph::CoordinateDiff::operator=(const CoordinateDiff&
 
 ngraph::CoordinateDiff& ngraph::CoordinateDiff::operator=(CoordinateDiff&& v) noexcept
 {
-    static_cast<std::vector<std::ptrdiff_t>*>(this)->operator=(v);
+    static_cast<std::vector<std::ptrdiff_t>*>(this)->operator=(std::move(v));
     return *this;
 }
 
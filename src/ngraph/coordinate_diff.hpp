@@ -33,8 +33,12 @@ namespace ngraph
 
         NGRAPH_API CoordinateDiff(const std::vector<std::ptrdiff_t>& diffs);
 
+        NGRAPH_API CoordinateDiff(std::vector<std::ptrdiff_t>&& diffs) noexcept;
+
         NGRAPH_API CoordinateDiff(const CoordinateDiff& diffs);
 
+        NGRAPH_API CoordinateDiff(CoordinateDiff&& diffs) noexcept;
+
         NGRAPH_API explicit CoordinateDiff(size_t n, std::ptrdiff_t initial_value = 0);
 
         template <class InputIterator>
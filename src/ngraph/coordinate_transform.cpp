@@ -490,3 +490,102 @@ bool CoordinateTransform::Iterator::operator==(const Iterator& it)
 
     return true;
 }
+
+CoordinateTransform::IndexIterator::IndexIterator(const CoordinateTransform& transform)
+    : m_transform(transform)
+    , m_coordinate(transform.m_n_axes, 0)
+    , m_source_axis_strides(transform.m_n_axes)
+    , m_source_steps(transform.m_n_axes)
+    , m_contributions(transform.m_n_axes, 0)
+    , m_in_hole(transform.m_n_axes, false)
+    , m_simple_axis(transform.m_n_axes, false)
+    , m_target_index(0)
+    , m_source_index(0)
+    , m_holes(0)
+    , m_oob(shape_size(transform.m_target_shape) == 0)
+{
+    std::vector<size_t> source_buffer_strides(transform.m_n_axes);
+    size_t stride = 1;
+    for (size_t axis = transform.m_n_axes; axis-- > 0;)
+    {
+        source_buffer_strides[axis] = stride;
+        stride *= transform.m_source_shape[axis];
+    }
+
+    for (size_t target_axis = 0; target_axis < transform.m_n_axes; target_axis++)
+    {
+        size_t source_axis = transform.m_source_axis_order[target_axis];
+        m_source_axis_strides[target_axis] = source_buffer_strides[source_axis];
+        m_source_steps[target_axis] =
+            transform.m_source_strides[source_axis] * source_buffer_strides[source_axis];
+        m_simple_axis[target_axis] = transform.m_target_padding_below[target_axis] == 0 &&
+                                     transform.m_target_padding_above[target_axis] == 0 &&
+                                     transform.m_target_dilation_strides[target_axis] == 1;
+        if (!m_oob)
+        {
+            update_axis(target_axis);
+        }
+    }
+}
+
+void CoordinateTransform::IndexIterator::update_axis(size_t target_axis)
+{
+    // Same arithmetic as to_source_coordinate and has_source_coordinate, for one axis
+    size_t source_axis = m_transform.m_source_axis_order[target_axis];
+    std::ptrdiff_t padding_below = m_transform.m_target_padding_below[target_axis];
+    std::ptrdiff_t dilation = m_transform.m_target_dilation_strides[target_axis];
+    std::ptrdiff_t source_length = m_transform.m_source_shape[source_axis];
+    std::ptrdiff_t pos_deshifted =
+        m_coordinate[target_axis] * m_transform.m_source_strides[source_axis] +
+        m_transform.m_source_start_corner[source_axis];
+    std::ptrdiff_t pos_depadded = pos_deshifted - padding_below;
+    bool in_hole = pos_deshifted < padding_below || source_length == 0 ||
+                   pos_depadded >= (source_length - 1) * dilation + 1 ||
+                   pos_depadded % dilation != 0;
+
+    m_source_index -= m_contributions[target_axis];
+    m_contributions[target_axis] =
+        in_hole ? 0 : (pos_depadded / dilation) * m_source_axis_strides[target_axis];
+    m_source_index += m_contributions[target_axis];
+    if (in_hole != m_in_hole[target_axis])
+    {
+        m_in_hole[target_axis] = in_hole;
+        if (in_hole)
+        {
+            m_holes++;
+        }
+        else
+        {
+            m_holes--;
+        }
+    }
+}
+
+void CoordinateTransform::IndexIterator::operator++()
+{
+    if (m_oob)
+    {
+        return;
+    }
+    m_target_index++;
+    const Shape& target_shape = m_transform.m_target_shape;
+    for (size_t axis = target_shape.size(); axis-- > 0;)
+    {
+        if (++m_coordinate[axis] < target_shape[axis])
+        {
+            if (m_simple_axis[axis])
+            {
+                m_contributions[axis] += m_source_steps[axis];
+                m_source_index += m_source_steps[axis];
+            }
+            else
+            {
+                update_axis(axis);
+            }
+            return;
+        }
+        m_coordinate[axis] = 0;
+        update_axis(axis);
+    }
+    m_oob = true;
+}
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/coordinate.hpp"
 #include "ngraph/coordinate_diff.hpp"
@@ -92,8 +94,56 @@ namespace ngraph
             bool m_empty;
         };
 
+        /// \brief Walks the target space in the same order as Iterator, yielding flat buffer
+        ///        indices instead of coordinates.
+        ///
+        /// The target index, the source index and whether the target point has a source
+        /// coordinate are updated incrementally, one axis at a time, so a step neither builds a
+        /// Coordinate nor recomputes a dot product with the strides.
+        ///
+        ///     for (auto it = transform.index_begin(); it.valid(); ++it)
+        ///     {
+        ///         out[it.target_index()] = it.has_source() ? arg[it.source_index()] : pad;
+        ///     }
+        class NGRAPH_API IndexIterator
+        {
+        public:
+            explicit IndexIterator(const CoordinateTransform& transform);
+
+            void operator++();
+            /// \brief False once every target point has been visited.
+            bool valid() const { return !m_oob; }
+            /// \brief Row-major index of the current point in the target space.
+            size_t target_index() const { return m_target_index; }
+            /// \brief Equal to index() of the current target coordinate. Only meaningful if
+            ///        has_source() is true.
+            size_t source_index() const { return m_source_index; }
+            /// \brief Equal to has_source_coordinate() of the current target coordinate.
+            bool has_source() const { return m_holes == 0; }
+
+        private:
+            // Recomputes the source contribution and hole state of a target axis
+            void update_axis(size_t axis);
+
+            const CoordinateTransform& m_transform;
+            // Per target axis: current position, element stride in the source buffer, the
+            // source index step for one target step when the axis has no padding or dilation,
+            // and the current contribution to the source index
+            std::vector<size_t> m_coordinate;
+            std::vector<size_t> m_source_axis_strides;
+            std::vector<size_t> m_source_steps;
+            std::vector<size_t> m_contributions;
+            std::vector<bool> m_in_hole;
+            std::vector<bool> m_simple_axis;
+            size_t m_target_index;
+            size_t m_source_index;
+            size_t m_holes;
+            bool m_oob;
+        };
+
         Iterator begin() noexcept { return Iterator(m_target_shape); }
         Iterator end() noexcept { return m_end_iterator; }
+        IndexIterator index_begin() const { return IndexIterator(*this); }
         size_t index_source(const Coordinate& c) const;
         static Strides default_strides(size_t n_axes);
         static CoordinateDiff default_padding(size_t n_axes);
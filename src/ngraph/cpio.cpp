@@ -14,6 +14,13 @@
 // limitations under the License.
 //*****************************************************************************
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include "ngraph/cpio.hpp"
 #include "ngraph/log.hpp"
 
@@ -133,6 +140,12 @@ void cpio::Header::write(ostream& stream, const string& name, uint32_t size)
     stream.write(name.c_str(), namesize + (namesize % 2));
 }
 
+size_t cpio::Header::get_size(const string& name)
+{
+    size_t namesize = name.size() + 1;
+    return 26 + namesize + (namesize % 2);
+}
+
 cpio::Writer::Writer()
     : m_stream(nullptr)
 {
@@ -162,11 +175,13 @@ cpio::Writer::~Writer()
 void cpio::Writer::open(ostream& out)
 {
     m_stream = &out;
+    m_offset = 0;
 }
 
 void cpio::Writer::open(const string& filename)
 {
     m_stream = &m_my_stream;
+    m_offset = 0;
     m_my_stream.open(filename, ios_base::binary | ios_base::out);
 }
 
@@ -181,6 +196,7 @@ void cpio::Writer::write(const string& record_name, const void* data, uint32_t s
             char ch = 0;
             m_stream->write(&ch, 1);
         }
+        m_offset += Header::get_size(record_name) + size_in_bytes + (size_in_bytes % 2);
     }
     else
     {
@@ -188,6 +204,28 @@ void cpio::Writer::write(const string& record_name, const void* data, uint32_t s
     }
 }
 
+void cpio::Writer::write(const string& record_name,
+                         const void* data,
+                         uint32_t size_in_bytes,
+                         size_t alignment)
+{
+    if ((alignment & (alignment - 1)) != 0)
+    {
+        throw runtime_error("cpio alignment must be a power of two");
+    }
+    size_t data_offset = m_offset + Header::get_size(record_name);
+    if (alignment > 2 && data_offset % alignment != 0)
+    {
+        // Records are always an even number of bytes, so the padding is as well
+        static const string pad_name = ".pad";
+        size_t pad = (alignment - (data_offset + Header::get_size(pad_name)) % alignment) %
+                     alignment;
+        vector<char> zeros(pad, 0);
+        write(pad_name, zeros.data(), static_cast<uint32_t>(pad));
+    }
+    write(record_name, data, size_in_bytes);
+}
+
 cpio::Reader::Reader()
     : m_stream(nullptr)
 {
@@ -288,6 +326,16 @@ vector<char> cpio::Reader::read(const FileInfo& info)
     return buffer;
 }
 
+void cpio::Reader::read(const FileInfo& info, size_t offset, void* data, size_t size_in_bytes)
+{
+    if (offset + size_in_bytes > info.get_size())
+    {
+        throw runtime_error("Read past the end of record '" + info.get_name() + "'");
+    }
+    m_stream->seekg(info.get_offset() + offset, ios_base::beg);
+    m_stream->read(reinterpret_cast<char*>(data), size_in_bytes);
+}
+
 bool cpio::is_cpio(const string& path)
 {
     ifstream in(path, ios_base::binary | ios_base::in);
@@ -337,3 +385,50 @@ size_t cpio::FileInfo::get_offset() const
 {
     return m_offset;
 }
+
+cpio::MappedReader::MappedReader(const string& filename)
+{
+    {
+        Reader reader(filename);
+        m_file_info = reader.get_file_info();
+    }
+#ifndef _WIN32
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        throw runtime_error("Failed to open '" + filename + "'");
+    }
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size > 0)
+    {
+        m_size = static_cast<size_t>(st.st_size);
+        void* p = mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        if (p != MAP_FAILED)
+        {
+            m_data = static_cast<char*>(p);
+            m_mapped = true;
+        }
+    }
+    ::close(fd);
+#endif
+    if (!m_mapped)
+    {
+        ifstream in(filename, ios_base::binary | ios_base::in);
+        in.seekg(0, ios_base::end);
+        m_size = static_cast<size_t>(in.tellg());
+        in.seekg(0, ios_base::beg);
+        m_buffer.resize(m_size);
+        in.read(m_buffer.data(), m_size);
+        m_data = m_buffer.data();
+    }
+}
+
+cpio::MappedReader::~MappedReader()
+{
+#ifndef _WIN32
+    if (m_mapped)
+    {
+        munmap(m_data, m_size);
+    }
+#endif
+}
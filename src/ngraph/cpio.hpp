@@ -34,6 +34,7 @@ namespace ngraph
         class FileInfo;
         class Writer;
         class Reader;
+        class MappedReader;
 
         bool is_cpio(const std::string&);
         bool is_cpio(std::istream&);
@@ -57,6 +58,8 @@ public:
 
     static Header read(std::istream&);
     static void write(std::ostream&, const std::string& name, uint32_t size);
+    /// \brief Number of bytes written by write() for a record named `name`
+    static size_t get_size(const std::string& name);
 
 private:
 };
@@ -91,10 +94,18 @@ public:
     void open(std::ostream& out);
     void open(const std::string& filename);
     void write(const std::string& file_name, const void* data, uint32_t size_in_bytes);
+    /// \brief Write a record whose data starts at a multiple of `alignment` bytes from the start
+    ///        of the archive, inserting a padding record if needed.
+    /// \param alignment Must be a power of two.
+    void write(const std::string& file_name,
+               const void* data,
+               uint32_t size_in_bytes,
+               size_t alignment);
 
 private:
     std::ostream* m_stream;
     std::ofstream m_my_stream;
+    size_t m_offset{0};
 };
 
 class NGRAPH_API ngraph::cpio::Reader
@@ -111,9 +122,38 @@ public:
     const std::vector<FileInfo>& get_file_info();
     bool read(const std::string& file_name, void* data, size_t size_in_bytes);
     std::vector<char> read(const FileInfo& info);
+    /// \brief Read size_in_bytes bytes of a record, starting offset bytes into its data
+    void read(const FileInfo& info, size_t offset, void* data, size_t size_in_bytes);
 
 private:
     std::istream* m_stream;
     std::ifstream m_my_stream;
     std::vector<cpio::FileInfo> m_file_info;
 };
+
+/// \brief Memory-mapped view of a cpio archive.
+///
+/// Record data can be referenced in place for as long as the MappedReader is alive. The file is
+/// mapped copy-on-write, so pages are shared with the page cache (and with every other process
+/// mapping the same file) until they are written to. On platforms without mmap the file is read
+/// into memory instead.
+class NGRAPH_API ngraph::cpio::MappedReader
+{
+public:
+    MappedReader(const std::string& filename);
+    ~MappedReader();
+
+    const std::vector<FileInfo>& get_file_info() const { return m_file_info; }
+    char* get_data(const FileInfo& info) const { return m_data + info.get_offset(); }
+    bool is_mapped() const { return m_mapped; }
+
+private:
+    MappedReader(const MappedReader&) = delete;
+    MappedReader& operator=(const MappedReader&) = delete;
+
+    char* m_data{nullptr};
+    size_t m_size{0};
+    bool m_mapped{false};
+    std::vector<char> m_buffer;
+    std::vector<FileInfo> m_file_info;
+};
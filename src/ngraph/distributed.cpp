@@ -14,10 +14,17 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstring>
+#include <vector>
+
 #include "ngraph/distributed.hpp"
 #include "ngraph/distributed/null.hpp"
+#include "ngraph/distributed/shared_memory.hpp"
+#include "ngraph/env_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/type.hpp"
+#include "ngraph/type/bfloat16.hpp"
+#include "ngraph/type/float16.hpp"
 
 using namespace ngraph;
 
@@ -35,6 +42,19 @@ namespace ngraph
     }
 
     constexpr DiscreteTypeInfo AttributeAdapter<reduction::Type>::type_info;
+
+    template <>
+    EnumNames<reduction::Compression>& EnumNames<reduction::Compression>::get()
+    {
+        static auto enum_names =
+            EnumNames<reduction::Compression>("reduction::Compression",
+                                              {{"NONE", reduction::Compression::NONE},
+                                               {"BF16", reduction::Compression::BF16},
+                                               {"F16", reduction::Compression::F16}});
+        return enum_names;
+    }
+
+    constexpr DiscreteTypeInfo AttributeAdapter<reduction::Compression>::type_info;
 }
 
 std::ostream& reduction::operator<<(std::ostream& out, const reduction::Type& obj)
@@ -42,6 +62,168 @@ std::ostream& reduction::operator<<(std::ostream& out, const reduction::Type& ob
     return out << as_string(obj);
 }
 
+std::ostream& reduction::operator<<(std::ostream& out, const reduction::Compression& obj)
+{
+    return out << as_string(obj);
+}
+
+namespace
+{
+    // acc[i] = reduce(acc[i], arg[i]), as loops simple enough for the compiler to vectorize
+    template <typename T>
+    void reduce(T* acc, const T* arg, size_t count, reduction::Type reduce_type)
+    {
+        switch (reduce_type)
+        {
+        case reduction::Type::SUM:
+            for (size_t i = 0; i < count; i++)
+            {
+                acc[i] += arg[i];
+            }
+            break;
+        case reduction::Type::PROD:
+            for (size_t i = 0; i < count; i++)
+            {
+                acc[i] *= arg[i];
+            }
+            break;
+        case reduction::Type::MIN:
+            for (size_t i = 0; i < count; i++)
+            {
+                acc[i] = arg[i] < acc[i] ? arg[i] : acc[i];
+            }
+            break;
+        case reduction::Type::MAX:
+            for (size_t i = 0; i < count; i++)
+            {
+                acc[i] = arg[i] > acc[i] ? arg[i] : acc[i];
+            }
+            break;
+        }
+    }
+
+    // bf16 and f16 are reduced in f32 and rounded once
+    template <typename T>
+    void reduce_narrow(T* out,
+                       const std::vector<const char*>& args,
+                       size_t count,
+                       reduction::Type type)
+    {
+        std::vector<float> acc(count);
+        std::vector<float> arg(count);
+        for (size_t rank = 0; rank < args.size(); rank++)
+        {
+            const T* values = reinterpret_cast<const T*>(args[rank]);
+            float* widened = rank == 0 ? acc.data() : arg.data();
+            for (size_t i = 0; i < count; i++)
+            {
+                widened[i] = static_cast<float>(values[i]);
+            }
+            if (rank > 0)
+            {
+                reduce(acc.data(), arg.data(), count, type);
+            }
+        }
+        for (size_t i = 0; i < count; i++)
+        {
+            out[i] = T(acc[i]);
+        }
+    }
+
+    template <typename T>
+    void reduce_wide(T* out,
+                     const std::vector<const char*>& args,
+                     size_t count,
+                     reduction::Type type)
+    {
+        std::memcpy(out, args[0], count * sizeof(T));
+        for (size_t rank = 1; rank < args.size(); rank++)
+        {
+            reduce(out, reinterpret_cast<const T*>(args[rank]), count, type);
+        }
+    }
+}
+
+void reduction::reduce(char* out,
+                       const std::vector<const char*>& args,
+                       size_t count,
+                       element::Type_t element_type,
+                       reduction::Type reduce_type)
+{
+    switch (element_type)
+    {
+    case element::Type_t::bf16:
+        reduce_narrow(reinterpret_cast<bfloat16*>(out), args, count, reduce_type);
+        break;
+    case element::Type_t::f16:
+        reduce_narrow(reinterpret_cast<float16*>(out), args, count, reduce_type);
+        break;
+    case element::Type_t::f32:
+        reduce_wide(reinterpret_cast<float*>(out), args, count, reduce_type);
+        break;
+    case element::Type_t::f64:
+        reduce_wide(reinterpret_cast<double*>(out), args, count, reduce_type);
+        break;
+    case element::Type_t::i32:
+        reduce_wide(reinterpret_cast<int32_t*>(out), args, count, reduce_type);
+        break;
+    case element::Type_t::i64:
+        reduce_wide(reinterpret_cast<int64_t*>(out), args, count, reduce_type);
+        break;
+    default:
+        throw ngraph_error("all_reduce does not support element type " +
+                           element::Type(element_type).get_type_name());
+    }
+}
+
+namespace
+{
+    class CompletedRequest : public DistributedRequest
+    {
+    public:
+        void wait() override {}
+    };
+}
+
+std::unique_ptr<DistributedRequest>
+    DistributedInterface::all_reduce_async(void* in,
+                                           void* out,
+                                           element::Type_t element_type,
+                                           reduction::Type reduce_type,
+                                           size_t count)
+{
+    if (in == out)
+    {
+        // all_reduce itself need not support reducing in place
+        std::vector<char> copy(static_cast<char*>(in),
+                               static_cast<char*>(in) + count * element::Type(element_type).size());
+        all_reduce(copy.data(), out, element_type, reduce_type, count);
+    }
+    else
+    {
+        all_reduce(in, out, element_type, reduce_type, count);
+    }
+    return std::unique_ptr<DistributedRequest>(new CompletedRequest());
+}
+
+std::unique_ptr<DistributedRequest> DistributedInterface::recv_async(void* in,
+                                                                     element::Type_t element_type,
+                                                                     size_t count,
+                                                                     int src_id)
+{
+    recv(in, element_type, count, src_id);
+    return std::unique_ptr<DistributedRequest>(new CompletedRequest());
+}
+
+std::unique_ptr<DistributedRequest> DistributedInterface::send_async(const void* in,
+                                                                     element::Type_t element_type,
+                                                                     size_t count,
+                                                                     int dest_id)
+{
+    send(in, element_type, count, dest_id);
+    return std::unique_ptr<DistributedRequest>(new CompletedRequest());
+}
+
 static std::unique_ptr<DistributedInterface> s_distributed_interface;
 
 void ngraph::set_distributed_interface(std::unique_ptr<DistributedInterface> distributed_interface)
@@ -54,6 +236,18 @@ DistributedInterface* ngraph::get_distributed_interface()
 {
     if (nullptr == s_distributed_interface)
     {
+#ifndef _WIN32
+        int32_t world_size = getenv_int("NGRAPH_SHM_WORLD_SIZE", 0);
+        if (world_size > 0)
+        {
+            std::string name = getenv_string("NGRAPH_SHM_NAME");
+            set_distributed_interface(std::unique_ptr<DistributedInterface>(
+                new ngraph::distributed::SharedMemory(name.empty() ? "/ngraph" : name,
+                                                      world_size,
+                                                      getenv_int("NGRAPH_SHM_RANK", 0))));
+            return s_distributed_interface.get();
+        }
+#endif
         set_distributed_interface(
             std::unique_ptr<DistributedInterface>(new ngraph::distributed::Null()));
     }
@@ -19,6 +19,7 @@
 #include <cstddef>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "ngraph/attribute_visitor.hpp"
 #include "ngraph/type.hpp"
@@ -38,6 +39,26 @@ namespace ngraph
 
         NGRAPH_API
         std::ostream& operator<<(std::ostream& out, const Type& obj);
+
+        /// \brief Narrower type the tensors of a reduction are sent as
+        enum class Compression
+        {
+            NONE,
+            BF16,
+            F16,
+        };
+
+        NGRAPH_API
+        std::ostream& operator<<(std::ostream& out, const Compression& obj);
+
+        /// \brief Reduces count elements of every one of args into out, elementwise on the
+        ///        host. bf16 and f16 are reduced in f32 and rounded once.
+        NGRAPH_API
+        void reduce(char* out,
+                    const std::vector<const char*>& args,
+                    size_t count,
+                    element::Type_t element_type,
+                    Type reduce_type);
     }
 
     template <>
@@ -54,7 +75,31 @@ namespace ngraph
         const DiscreteTypeInfo& get_type_info() const override { return type_info; }
     };
 
-    class DistributedInterface
+    template <>
+    class NGRAPH_API AttributeAdapter<reduction::Compression>
+        : public EnumAttributeAdapterBase<reduction::Compression>
+    {
+    public:
+        AttributeAdapter(reduction::Compression& value)
+            : EnumAttributeAdapterBase<reduction::Compression>(value)
+        {
+        }
+
+        static constexpr DiscreteTypeInfo type_info{"AttributeAdapter<reduction::Compression>",
+                                                    0};
+        const DiscreteTypeInfo& get_type_info() const override { return type_info; }
+    };
+
+    /// \brief Handle of a collective running in the background
+    class DistributedRequest
+    {
+    public:
+        virtual ~DistributedRequest() {}
+        /// \brief Blocks until the collective is complete and its output may be read
+        virtual void wait() = 0;
+    };
+
+    class NGRAPH_API DistributedInterface
     {
     public:
         virtual ~DistributedInterface() {}
@@ -67,11 +112,31 @@ namespace ngraph
                                 element::Type_t element_type,
                                 reduction::Type reduce_type,
                                 size_t count) = 0;
+        /// \brief Starts an all_reduce and returns without waiting for it. in and out may be
+        ///        the same buffer; neither may be touched until the request has been waited on.
+        ///
+        /// Libraries with non-blocking collectives override this. The default reduces before
+        /// returning a request which is already complete.
+        virtual std::unique_ptr<DistributedRequest> all_reduce_async(void* in,
+                                                                     void* out,
+                                                                     element::Type_t element_type,
+                                                                     reduction::Type reduce_type,
+                                                                     size_t count);
         virtual void
             broadcast(void* in, element::Type_t element_type, size_t count, int root_id) = 0;
         virtual void recv(void* in, element::Type_t element_type, size_t count, int src_id) = 0;
         virtual void
             send(const void* in, element::Type_t element_type, size_t count, int dest_id) = 0;
+        /// \brief Starts a recv into in and returns without waiting for it. in may not be
+        ///        touched until the request has been waited on. The default receives before
+        ///        returning.
+        virtual std::unique_ptr<DistributedRequest>
+            recv_async(void* in, element::Type_t element_type, size_t count, int src_id);
+        /// \brief Starts a send of in and returns without waiting for it. in may not be
+        ///        modified until the request has been waited on. The default sends before
+        ///        returning.
+        virtual std::unique_ptr<DistributedRequest>
+            send_async(const void* in, element::Type_t element_type, size_t count, int dest_id);
     };
 
     void set_distributed_interface(std::unique_ptr<DistributedInterface> distributed_interface);
@@ -0,0 +1,293 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#ifndef _WIN32
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ngraph/check.hpp"
+#include "ngraph/distributed/shared_memory.hpp"
+#include "ngraph/except.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static_assert(ATOMIC_INT_LOCK_FREE == 2, "The ranks synchronize through lock free atomics");
+
+namespace
+{
+    constexpr size_t s_line_bytes = 64;
+    constexpr uint32_t s_ready = 0x6e677368;
+
+    // An atomic alone in its cache line, so the ranks spinning on one do not slow the others
+    struct alignas(s_line_bytes) Flag
+    {
+        atomic<uint32_t> value;
+    };
+
+    size_t align_up(size_t bytes)
+    {
+        return (bytes + s_line_bytes - 1) / s_line_bytes * s_line_bytes;
+    }
+
+    void spin_until(const atomic<uint32_t>& flag, uint32_t value, bool equal)
+    {
+        size_t spins = 0;
+        while ((flag.load(memory_order_acquire) == value) != equal)
+        {
+            if (++spins > 1024)
+            {
+                this_thread::yield();
+            }
+        }
+    }
+}
+
+// The segment starts with the header, then the full flag of every mailbox, the slot of every
+// rank, the reduced chunk and the mailboxes
+struct distributed::SharedMemory::Header
+{
+    Flag ready;
+    Flag barrier_count;
+    Flag barrier_generation;
+};
+
+distributed::SharedMemory::SharedMemory(const string& name,
+                                        int size,
+                                        int rank,
+                                        size_t chunk_bytes)
+    : m_segment_name(name)
+    , m_size(size)
+    , m_rank(rank)
+{
+    NGRAPH_CHECK(size > 0 && rank >= 0 && rank < size,
+                 "Rank ",
+                 rank,
+                 " is not one of the ",
+                 size,
+                 " ranks");
+    // Room for a whole number of the largest elements in every rank's mailbox
+    m_chunk_bytes = align_up(max(chunk_bytes, s_line_bytes));
+    m_mailbox_bytes = align_up(max(m_chunk_bytes / size, s_line_bytes));
+    m_segment_bytes = sizeof(Header) + sizeof(Flag) * size * size + m_chunk_bytes * (size + 1) +
+                      m_mailbox_bytes * size * size;
+
+    int fd = -1;
+    if (rank == 0)
+    {
+        shm_unlink(name.c_str());
+        fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+        NGRAPH_CHECK(fd >= 0, "Cannot create shared memory segment ", name);
+        NGRAPH_CHECK(ftruncate(fd, m_segment_bytes) == 0,
+                     "Cannot size shared memory segment ",
+                     name,
+                     " to ",
+                     m_segment_bytes,
+                     " bytes");
+    }
+    else
+    {
+        // Rank 0 may not have created the segment, or not sized it, yet
+        auto deadline = chrono::steady_clock::now() + chrono::seconds(60);
+        struct stat status;
+        while ((fd = shm_open(name.c_str(), O_RDWR, 0)) < 0 || fstat(fd, &status) != 0 ||
+               static_cast<size_t>(status.st_size) != m_segment_bytes)
+        {
+            if (fd >= 0)
+            {
+                close(fd);
+                fd = -1;
+            }
+            NGRAPH_CHECK(chrono::steady_clock::now() < deadline,
+                         "Timed out waiting for rank 0 to create shared memory segment ",
+                         name);
+            this_thread::sleep_for(chrono::milliseconds(1));
+        }
+    }
+    void* segment = mmap(nullptr, m_segment_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    NGRAPH_CHECK(segment != MAP_FAILED, "Cannot map shared memory segment ", name);
+    m_segment = static_cast<char*>(segment);
+    // The segment was created zeroed, which is the initial value of every flag
+    m_header = reinterpret_cast<Header*>(m_segment);
+    if (rank == 0)
+    {
+        m_header->ready.value.store(s_ready, memory_order_release);
+    }
+    else
+    {
+        spin_until(m_header->ready.value, s_ready, true);
+    }
+    barrier();
+}
+
+distributed::SharedMemory::~SharedMemory()
+{
+    if (m_segment != nullptr)
+    {
+        // No rank may still be reading from the slots of the others
+        barrier();
+        munmap(m_segment, m_segment_bytes);
+        if (m_rank == 0)
+        {
+            shm_unlink(m_segment_name.c_str());
+        }
+    }
+}
+
+const string& distributed::SharedMemory::get_name() const
+{
+    return m_name;
+}
+
+int distributed::SharedMemory::get_size()
+{
+    return m_size;
+}
+
+int distributed::SharedMemory::get_rank()
+{
+    return m_rank;
+}
+
+void distributed::SharedMemory::barrier()
+{
+    atomic<uint32_t>& count = m_header->barrier_count.value;
+    atomic<uint32_t>& generation = m_header->barrier_generation.value;
+    uint32_t current = generation.load(memory_order_acquire);
+    if (count.fetch_add(1, memory_order_acq_rel) == static_cast<uint32_t>(m_size - 1))
+    {
+        count.store(0, memory_order_relaxed);
+        generation.fetch_add(1, memory_order_acq_rel);
+    }
+    else
+    {
+        spin_until(generation, current, false);
+    }
+}
+
+char* distributed::SharedMemory::get_slot(int rank) const
+{
+    return m_segment + sizeof(Header) + sizeof(Flag) * m_size * m_size + m_chunk_bytes * rank;
+}
+
+char* distributed::SharedMemory::get_mailbox(int src_id, int dest_id) const
+{
+    return get_slot(m_size + 1) + m_mailbox_bytes * (src_id * m_size + dest_id);
+}
+
+void distributed::SharedMemory::all_reduce(void* in,
+                                           void* out,
+                                           element::Type_t element_type,
+                                           reduction::Type reduce_type,
+                                           size_t count)
+{
+    size_t element_bytes = element::Type(element_type).size();
+    size_t chunk_count = m_chunk_bytes / element_bytes;
+    char* reduced = get_slot(m_size);
+    for (size_t offset = 0; offset < count; offset += chunk_count)
+    {
+        size_t n = min(chunk_count, count - offset);
+        memcpy(
+            get_slot(m_rank), static_cast<char*>(in) + offset * element_bytes, n * element_bytes);
+        barrier();
+        // Every rank reduces its slice of the chunk over the slots of all the ranks
+        size_t begin = n * m_rank / m_size * element_bytes;
+        size_t end = n * (m_rank + 1) / m_size * element_bytes;
+        vector<const char*> slices;
+        for (int rank = 0; rank < m_size; rank++)
+        {
+            slices.push_back(get_slot(rank) + begin);
+        }
+        reduction::reduce(
+            reduced + begin, slices, (end - begin) / element_bytes, element_type, reduce_type);
+        barrier();
+        // The next chunk only overwrites the reduced one after the barrier which follows the
+        // copies of every rank into their slots, so this copy needs no barrier after it
+        memcpy(static_cast<char*>(out) + offset * element_bytes, reduced, n * element_bytes);
+    }
+}
+
+void distributed::SharedMemory::broadcast(void* in,
+                                          element::Type_t element_type,
+                                          size_t count,
+                                          int root_id)
+{
+    size_t bytes = count * element::Type(element_type).size();
+    for (size_t offset = 0; offset < bytes; offset += m_chunk_bytes)
+    {
+        size_t n = min(m_chunk_bytes, bytes - offset);
+        if (m_rank == root_id)
+        {
+            memcpy(get_slot(root_id), static_cast<char*>(in) + offset, n);
+        }
+        barrier();
+        if (m_rank != root_id)
+        {
+            memcpy(static_cast<char*>(in) + offset, get_slot(root_id), n);
+        }
+        barrier();
+    }
+}
+
+void distributed::SharedMemory::recv(void* in,
+                                     element::Type_t element_type,
+                                     size_t count,
+                                     int src_id)
+{
+    NGRAPH_CHECK(src_id >= 0 && src_id < m_size, "No rank ", src_id, " to receive from");
+    Flag* full = reinterpret_cast<Flag*>(m_segment + sizeof(Header)) + src_id * m_size + m_rank;
+    char* mailbox = get_mailbox(src_id, m_rank);
+    size_t bytes = count * element::Type(element_type).size();
+    for (size_t offset = 0; offset < bytes; offset += m_mailbox_bytes)
+    {
+        size_t n = min(m_mailbox_bytes, bytes - offset);
+        spin_until(full->value, 1, true);
+        memcpy(static_cast<char*>(in) + offset, mailbox, n);
+        full->value.store(0, memory_order_release);
+    }
+}
+
+void distributed::SharedMemory::send(const void* in,
+                                     element::Type_t element_type,
+                                     size_t count,
+                                     int dest_id)
+{
+    NGRAPH_CHECK(dest_id >= 0 && dest_id < m_size, "No rank ", dest_id, " to send to");
+    Flag* full = reinterpret_cast<Flag*>(m_segment + sizeof(Header)) + m_rank * m_size + dest_id;
+    char* mailbox = get_mailbox(m_rank, dest_id);
+    size_t bytes = count * element::Type(element_type).size();
+    for (size_t offset = 0; offset < bytes; offset += m_mailbox_bytes)
+    {
+        size_t n = min(m_mailbox_bytes, bytes - offset);
+        spin_until(full->value, 0, true);
+        memcpy(mailbox, static_cast<const char*>(in) + offset, n);
+        full->value.store(1, memory_order_release);
+    }
+}
+
+#endif
@@ -0,0 +1,88 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include "ngraph/distributed.hpp"
+
+namespace ngraph
+{
+    namespace distributed
+    {
+        /// \brief DistributedInterface for processes of one host, which communicate through a
+        ///        POSIX shared memory segment.
+        ///
+        /// Rank 0 creates the segment `name` and the other ranks map it. all_reduce is a
+        /// reduce-scatter followed by an all-gather: every rank copies its input to its
+        /// slot of the segment, reduces its slice of the slots of all the ranks, and copies
+        /// all the reduced slices out, chunk_bytes of the input at a time. send and recv go
+        /// through a mailbox for each ordered pair of ranks. Rank 0 replaces the segment a
+        /// killed run left behind, but another rank which maps that segment first would hang
+        /// in its first collective, so concurrent or successive jobs should use names of their
+        /// own.
+        class NGRAPH_API SharedMemory : public DistributedInterface
+        {
+        public:
+            SharedMemory(const std::string& name,
+                         int size,
+                         int rank,
+                         size_t chunk_bytes = size_t(1) << 20);
+            ~SharedMemory() override;
+
+            const std::string& get_name() const override;
+            int get_size() override;
+            int get_rank() override;
+            void all_reduce(void* in,
+                            void* out,
+                            element::Type_t element_type,
+                            reduction::Type reduce_type,
+                            size_t count) override;
+
+            void broadcast(void* in,
+                           element::Type_t element_type,
+                           size_t count,
+                           int root_id) override;
+
+            void recv(void* in, element::Type_t element_type, size_t count, int src_id) override;
+
+            void send(const void* in,
+                      element::Type_t element_type,
+                      size_t count,
+                      int dest_id) override;
+
+        protected:
+            struct Header;
+
+            // Returns once every rank has called it
+            void barrier();
+            char* get_slot(int rank) const;
+            char* get_mailbox(int src_id, int dest_id) const;
+
+            std::string m_name{"SharedMemory"};
+            std::string m_segment_name;
+            int m_size;
+            int m_rank;
+            size_t m_chunk_bytes;
+            size_t m_mailbox_bytes;
+            size_t m_segment_bytes;
+            char* m_segment{nullptr};
+            Header* m_header;
+        };
+    }
+}
@@ -16,9 +16,19 @@
 
 #pragma once
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
 #include <map>
+#include <mutex>
+#include <set>
 #include <stack>
+#include <string>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #include "ngraph/node.hpp"
 #include "ngraph/shape.hpp"
@@ -45,6 +55,69 @@ namespace ngraph
         /// \brief Table of ops with handlers
         using op_handler_map = std::map<Node::type_info_t, op_handler>;
 
+        /// \brief Handler results remembered across evaluations and evaluators
+        ///
+        /// Results are keyed by the node and a key computed from each input value, so a memo
+        /// can be shared by repeated queries on a graph, e.g. when the same shape subgraph is
+        /// evaluated many times. The value keys are kept, so memos suit small values.
+        class Memo
+        {
+        public:
+            /// \brief Produces a key that is equal for equal values
+            using value_key_function = std::function<std::string(const V&)>;
+            using key_type = std::pair<size_t, std::vector<std::string>>;
+
+            explicit Memo(value_key_function value_key)
+                : m_value_key(std::move(value_key))
+            {
+            }
+
+            key_type make_key(Node* node, const std::vector<V>& inputs) const
+            {
+                key_type key{node->get_instance_id(), {}};
+                for (auto& input : inputs)
+                {
+                    key.second.push_back(m_value_key(input));
+                }
+                return key;
+            }
+
+            bool find(const key_type& key, std::vector<V>& outputs) const
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                auto it = m_results.find(key);
+                if (it == m_results.end())
+                {
+                    return false;
+                }
+                outputs = it->second;
+                return true;
+            }
+
+            void insert(const key_type& key, const std::vector<V>& outputs)
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_results[key] = outputs;
+            }
+
+            size_t size() const
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                return m_results.size();
+            }
+
+            void clear()
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_results.clear();
+            }
+
+        private:
+            value_key_function m_value_key;
+            mutable std::mutex m_mutex;
+            std::map<key_type, std::vector<V>> m_results;
+        };
+
         /// \brief construct  handler using the provided op handlers.
         ///
         /// Evaluations share previously computed values so that calls on multiple nodes can share
@@ -70,6 +143,13 @@ namespace ngraph
         void set_univeral_handler(const op_handler& handler) { m_universal_handler = handler; }
         /// \brief If set, handles all ops not in the handlers
         void set_default_handler(const op_handler& handler) { m_default_handler = handler; }
+        /// \brief If set, handler results are looked up in and added to the memo
+        void set_memo(const std::shared_ptr<Memo>& memo) { m_memo = memo; }
+        const std::shared_ptr<Memo>& get_memo() const { return m_memo; }
+        /// \brief Number of threads evaluate(const OutputVector&) may use for independent ops.
+        ///        Handlers must be safe to call concurrently when this is more than 1.
+        void set_num_threads(size_t num_threads) { m_num_threads = num_threads; }
+        size_t get_num_threads() const { return m_num_threads; }
 
     protected:
         op_handler get_handler(Node* node)
@@ -90,6 +170,159 @@ namespace ngraph
             return handler;
         }
 
+        std::vector<V> execute(Node* node, const op_handler& handler, std::vector<V>& inputs)
+        {
+            if (!m_memo)
+            {
+                return handler(node, inputs);
+            }
+            auto key = m_memo->make_key(node, inputs);
+            std::vector<V> outputs;
+            if (!m_memo->find(key, outputs))
+            {
+                outputs = handler(node, inputs);
+                m_memo->insert(key, outputs);
+            }
+            return outputs;
+        }
+
+        bool is_computed(Node* node) const
+        {
+            return m_value_map.find(node->output(0)) != m_value_map.end();
+        }
+
+        /// \brief Runs the handlers of everything values depend on, with ops whose inputs are
+        ///        known running on up to m_num_threads threads
+        void evaluate_parallel(const OutputVector& values)
+        {
+            // Find the ops that need their handler run
+            std::map<Node*, op_handler> handlers;
+            std::vector<Node*> stack;
+            for (auto& value : values)
+            {
+                stack.push_back(value.get_node());
+            }
+            while (!stack.empty())
+            {
+                Node* node = stack.back();
+                stack.pop_back();
+                if (handlers.count(node) > 0 || is_computed(node))
+                {
+                    continue;
+                }
+                if (auto handler = get_handler(node))
+                {
+                    handlers[node] = handler;
+                    for (auto& input_value : node->input_values())
+                    {
+                        stack.push_back(input_value.get_node());
+                    }
+                }
+                else
+                {
+                    for (auto output : node->outputs())
+                    {
+                        m_value_map[output] = V();
+                    }
+                }
+            }
+
+            std::map<Node*, size_t> waiting;
+            std::map<Node*, std::vector<Node*>> users;
+            std::deque<Node*> ready;
+            for (auto& entry : handlers)
+            {
+                std::set<Node*> producers;
+                for (auto& input_value : entry.first->input_values())
+                {
+                    if (handlers.count(input_value.get_node()) > 0)
+                    {
+                        producers.insert(input_value.get_node());
+                    }
+                }
+                for (auto producer : producers)
+                {
+                    users[producer].push_back(entry.first);
+                }
+                waiting[entry.first] = producers.size();
+                if (producers.empty())
+                {
+                    ready.push_back(entry.first);
+                }
+            }
+
+            std::mutex mutex;
+            std::condition_variable ready_changed;
+            size_t remaining = handlers.size();
+            std::exception_ptr error;
+            auto worker = [&]() {
+                std::unique_lock<std::mutex> lock(mutex);
+                while (true)
+                {
+                    ready_changed.wait(
+                        lock, [&]() { return !ready.empty() || remaining == 0 || error; });
+                    if (remaining == 0 || error)
+                    {
+                        return;
+                    }
+                    Node* node = ready.front();
+                    ready.pop_front();
+                    std::vector<V> inputs;
+                    for (auto& input_value : node->input_values())
+                    {
+                        inputs.push_back(m_value_map.at(input_value));
+                    }
+                    lock.unlock();
+                    std::vector<V> outputs;
+                    try
+                    {
+                        outputs = execute(node, handlers.at(node), inputs);
+                    }
+                    catch (...)
+                    {
+                        lock.lock();
+                        error = std::current_exception();
+                        ready_changed.notify_all();
+                        return;
+                    }
+                    lock.lock();
+                    for (size_t i = 0; i < outputs.size(); ++i)
+                    {
+                        m_value_map[node->output(i)] = outputs[i];
+                    }
+                    --remaining;
+                    auto it = users.find(node);
+                    if (it != users.end())
+                    {
+                        for (auto user : it->second)
+                        {
+                            if (--waiting.at(user) == 0)
+                            {
+                                ready.push_back(user);
+                            }
+                        }
+                    }
+                    ready_changed.notify_all();
+                }
+            };
+
+            std::vector<std::thread> threads;
+            size_t num_threads = std::min(m_num_threads, handlers.size());
+            for (size_t i = 1; i < num_threads; ++i)
+            {
+                threads.emplace_back(worker);
+            }
+            worker();
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+
         class Inst;
         using InstPtr = std::unique_ptr<Inst>;
         using InstStack = std::stack<InstPtr>;
@@ -173,7 +406,7 @@ namespace ngraph
                 {
                     inputs.push_back(evaluator.get_value_map().at(v));
                 }
-                std::vector<V> outputs = m_handler(node, inputs);
+                std::vector<V> outputs = evaluator.execute(node, m_handler, inputs);
                 for (size_t i = 0; i < outputs.size(); ++i)
                 {
                     evaluator.get_value_map()[node->output(i)] = outputs[i];
@@ -206,10 +439,28 @@ namespace ngraph
             return m_value_map.at(value);
         }
 
+        /// \brief Determine information about several values, evaluating independent ops in
+        ///        parallel when more than one thread is allowed
+        std::vector<V> evaluate(const OutputVector& values)
+        {
+            if (m_num_threads > 1)
+            {
+                evaluate_parallel(values);
+            }
+            std::vector<V> results;
+            for (auto& value : values)
+            {
+                results.push_back(evaluate(value));
+            }
+            return results;
+        }
+
     protected:
         op_handler m_universal_handler;
         op_handler_map m_handlers;
         op_handler m_default_handler;
         value_map& m_value_map;
+        std::shared_ptr<Memo> m_memo;
+        size_t m_num_threads{1};
     };
 }
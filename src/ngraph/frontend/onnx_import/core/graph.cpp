@@ -14,11 +14,15 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <functional>
 #include <numeric>
 #include <sstream>
+#include <thread>
 
 #include "graph.hpp"
+#include "ngraph/env_util.hpp"
+#include "ngraph/util.hpp"
 #include "node.hpp"
 #include "provenance.hpp"
 #include "utils/common.hpp"
@@ -75,6 +79,30 @@ namespace ngraph
                     strings.begin() + 1, strings.end(), strings.begin()->get(), concat_with_comma);
             }
 
+            /// \brief Frees the memory held by the values of a tensor proto, keeping its name,
+            ///        type and dimensions.
+            static void release_tensor_data(ONNX_NAMESPACE::TensorProto& tensor_proto)
+            {
+                std::string{}.swap(*tensor_proto.mutable_raw_data());
+                tensor_proto.clear_raw_data();
+                google::protobuf::RepeatedField<float>{}.Swap(tensor_proto.mutable_float_data());
+                google::protobuf::RepeatedField<double>{}.Swap(tensor_proto.mutable_double_data());
+                google::protobuf::RepeatedField<int32_t>{}.Swap(tensor_proto.mutable_int32_data());
+                google::protobuf::RepeatedField<int64_t>{}.Swap(tensor_proto.mutable_int64_data());
+                google::protobuf::RepeatedField<uint64_t>{}.Swap(
+                    tensor_proto.mutable_uint64_data());
+            }
+
+            /// \return The number of threads decoding initializers, NGRAPH_ONNX_IMPORT_THREADS
+            ///         or all hardware threads by default.
+            static size_t get_import_threads()
+            {
+                const auto hardware_threads =
+                    std::max(static_cast<int32_t>(std::thread::hardware_concurrency()), 1);
+                return static_cast<size_t>(
+                    std::max(getenv_int("NGRAPH_ONNX_IMPORT_THREADS", hardware_threads), 1));
+            }
+
             static std::string build_input_provenance_tag(const std::string& input_name,
                                                           const PartialShape& shape)
             {
@@ -95,22 +123,55 @@ namespace ngraph
         }
 
         Graph::Graph(const ONNX_NAMESPACE::GraphProto& graph_proto, Model& model)
+            : Graph{graph_proto, model, nullptr}
+        {
+        }
+
+        Graph::Graph(ONNX_NAMESPACE::GraphProto& graph_proto, Model& model)
+            : Graph{graph_proto, model, &graph_proto}
+        {
+        }
+
+        Graph::Graph(const ONNX_NAMESPACE::GraphProto& graph_proto,
+                     Model& model,
+                     ONNX_NAMESPACE::GraphProto* releasable_graph_proto)
             : m_graph_proto{&graph_proto}
             , m_model{&model}
         {
-            // Process all initializers in the graph
-            for (const auto& initializer_tensor : m_graph_proto->initializer())
+            // Process all initializers in the graph. Decoding their values dominates the
+            // import of large models, so the Constants are created concurrently.
+            std::vector<int> initializer_indices;
+            std::vector<Tensor> initializers;
+            for (int i = 0; i < m_graph_proto->initializer_size(); ++i)
             {
+                const auto& initializer_tensor = m_graph_proto->initializer(i);
                 if (initializer_tensor.has_name())
                 {
-                    Tensor tensor = Tensor{initializer_tensor};
-                    m_initializers.emplace(initializer_tensor.name(), tensor);
+                    initializer_indices.push_back(i);
+                    initializers.emplace_back(initializer_tensor, m_model->get_model_dir());
+                }
+            }
 
-                    // For each initializer, create a Constant node and store in cache
-                    auto ng_constant = tensor.get_ng_constant();
-                    add_provenance_tag_to_initializer(tensor, ng_constant);
-                    m_ng_node_cache.emplace(initializer_tensor.name(), std::move(ng_constant));
+            std::vector<std::shared_ptr<default_opset::Constant>> ng_constants(
+                initializers.size());
+            parallel_for(initializers.size(), detail::get_import_threads(), [&](size_t i) {
+                ng_constants[i] = initializers[i].get_ng_constant();
+                add_provenance_tag_to_initializer(initializers[i], ng_constants[i]);
+
+                // The Constant owns a copy of the values now, so drop the serialized ones
+                // before further initializers are copied.
+                if (releasable_graph_proto != nullptr)
+                {
+                    detail::release_tensor_data(
+                        *releasable_graph_proto->mutable_initializer(initializer_indices[i]));
                 }
+            });
+
+            for (size_t i = 0; i < initializers.size(); ++i)
+            {
+                const auto& name = initializers[i].get_name();
+                m_initializers.emplace(name, initializers[i]);
+                m_ng_node_cache.emplace(name, std::move(ng_constants[i]));
             }
 
             // Process all ONNX graph inputs, convert them to nGraph nodes and store in cache
@@ -34,6 +34,11 @@ namespace ngraph
         {
         public:
             Graph(const ONNX_NAMESPACE::GraphProto& proto, Model& model);
+            /// \brief Builds the graph from a proto which is not needed after the import.
+            ///
+            /// The values of every initializer are released as soon as they have been copied
+            /// into their Constant node, so the weights are never held twice in memory.
+            Graph(ONNX_NAMESPACE::GraphProto& proto, Model& model);
             const std::vector<Node>& get_nodes() const { return m_nodes; }
             const std::vector<ValueInfo>& get_inputs() const { return m_inputs; }
             const std::vector<ValueInfo>& get_outputs() const { return m_outputs; }
@@ -60,6 +65,10 @@ namespace ngraph
                                      const OutputVector& ng_node_vector) const;
 
         private:
+            Graph(const ONNX_NAMESPACE::GraphProto& proto,
+                  Model& model,
+                  ONNX_NAMESPACE::GraphProto* releasable_proto);
+
             const ONNX_NAMESPACE::GraphProto* m_graph_proto;
             std::vector<Node> m_nodes;
             std::vector<ValueInfo> m_inputs;
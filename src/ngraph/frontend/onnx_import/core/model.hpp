@@ -31,7 +31,11 @@ namespace ngraph
         {
         public:
             Model() = delete;
-            explicit Model(const ONNX_NAMESPACE::ModelProto& model_proto);
+            /// \param model_proto The model.
+            /// \param model_dir   The directory the locations of external tensor data are
+            ///                    relative to.
+            explicit Model(const ONNX_NAMESPACE::ModelProto& model_proto,
+                           const std::string& model_dir = "");
 
             Model(const Model&) = default;
             Model(Model&&) = default;
@@ -46,6 +50,7 @@ namespace ngraph
             {
                 return m_model_proto->producer_version();
             }
+            const std::string& get_model_dir() const { return m_model_dir; }
 
             /// \brief Access an operator object by its type name and domain name
             /// The function will return the operator object if it exists, or report an error
@@ -74,6 +79,7 @@ namespace ngraph
 
         private:
             const ONNX_NAMESPACE::ModelProto* m_model_proto;
+            std::string m_model_dir;
             std::unordered_map<std::string, OperatorSet> m_opset;
         };
 
@@ -23,6 +23,7 @@
 #include "ngraph/op/constant.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
+#include "utils/tensor_external_data.hpp"
 
 namespace ngraph
 {
@@ -384,9 +385,13 @@ namespace ngraph
             };
 
             Tensor() = delete;
-            explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor)
+            /// \param tensor    The tensor proto.
+            /// \param model_dir The directory the location of external data is relative to.
+            explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor,
+                            const std::string& model_dir = "")
                 : m_tensor_proto{&tensor}
                 , m_shape{std::begin(tensor.dims()), std::end(tensor.dims())}
+                , m_model_dir{model_dir}
             {
                 if (m_shape == Shape{0})
                 {
@@ -411,6 +416,12 @@ namespace ngraph
                 {
                     throw error::tensor::segments_unsupported{};
                 }
+                if (detail::has_external_data(*m_tensor_proto))
+                {
+                    auto buffer = load_external_data();
+                    auto data = buffer->get_ptr<T>();
+                    return std::vector<T>(data, data + buffer->size() / sizeof(T));
+                }
                 return detail::tensor::get_data<T>(*m_tensor_proto);
             }
 
@@ -508,8 +519,32 @@ namespace ngraph
             std::shared_ptr<ngraph::op::v0::Constant>
                 make_ng_constant(const element::Type& type) const
             {
-                auto constant =
-                    std::make_shared<ngraph::op::v0::Constant>(type, m_shape, get_data<T>());
+                std::shared_ptr<ngraph::op::v0::Constant> constant;
+                if (detail::has_external_data(*m_tensor_proto))
+                {
+                    // The Constant adopts the buffer, which maps the external file in place
+                    auto buffer = load_external_data();
+                    if (buffer->size() != shape_size(m_shape) * type.size())
+                    {
+                        throw error::tensor::invalid_external_data{
+                            "size of the data of tensor '" + m_tensor_proto->name() +
+                            "' does not match its shape"};
+                    }
+                    constant = std::make_shared<ngraph::op::v0::Constant>(type, m_shape, buffer);
+                }
+                else if (m_tensor_proto->has_raw_data() && !m_tensor_proto->has_segment() &&
+                    m_tensor_proto->raw_data().size() == shape_size(m_shape) * type.size())
+                {
+                    // Copy the raw bytes straight into the aligned storage of the Constant
+                    // instead of going through an intermediate std::vector<T>.
+                    constant = std::make_shared<ngraph::op::v0::Constant>(
+                        type, m_shape, m_tensor_proto->raw_data().data());
+                }
+                else
+                {
+                    constant =
+                        std::make_shared<ngraph::op::v0::Constant>(type, m_shape, get_data<T>());
+                }
                 if (m_tensor_proto->has_name())
                 {
                     constant->set_friendly_name(get_name());
@@ -517,8 +552,14 @@ namespace ngraph
                 return constant;
             }
 
+            std::shared_ptr<runtime::AlignedBuffer> load_external_data() const
+            {
+                return detail::TensorExternalData{*m_tensor_proto}.load(m_model_dir);
+            }
+
             const ONNX_NAMESPACE::TensorProto* m_tensor_proto;
             Shape m_shape;
+            std::string m_model_dir;
         };
 
         inline std::ostream& operator<<(std::ostream& outs, const Tensor& tensor)
@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <chrono>
 #include <fstream>
 #include <google/protobuf/io/zero_copy_stream_impl.h>
 #include <google/protobuf/text_format.h>
@@ -21,7 +22,9 @@
 
 #include "core/graph.hpp"
 #include "core/model.hpp"
+#include "ngraph/chrome_trace.hpp"
 #include "ngraph/except.hpp"
+#include "ngraph/file_util.hpp"
 #include "onnx.hpp"
 #include "ops_bridge.hpp"
 
@@ -49,44 +52,76 @@ namespace ngraph
                     }
                 };
             }
-        }
 
-        std::shared_ptr<Function> import_onnx_model(std::istream& stream)
-        {
-            ONNX_NAMESPACE::ModelProto model_proto;
-            // Try parsing input as a binary protobuf message
-            if (!model_proto.ParseFromIstream(&stream))
+            std::shared_ptr<Function> import_onnx_model(std::istream& stream,
+                                                        const std::string& model_dir,
+                                                        ImportStatistics* statistics = nullptr)
             {
-                // Rewind to the beginning and clear stream state.
-                stream.clear();
-                stream.seekg(0);
-                google::protobuf::io::IstreamInputStream iistream(&stream);
-                // Try parsing input as a prototxt message
-                if (!google::protobuf::TextFormat::Parse(&iistream, &model_proto))
+                using clock = std::chrono::steady_clock;
+                event::Duration import_event("import_onnx_model", "Import");
+                auto start = clock::now();
+                ONNX_NAMESPACE::ModelProto model_proto;
+                // Try parsing input as a binary protobuf message
+                if (!model_proto.ParseFromIstream(&stream))
                 {
-                    throw detail::error::stream_parse{stream};
+                    // Rewind to the beginning and clear stream state.
+                    stream.clear();
+                    stream.seekg(0);
+                    google::protobuf::io::IstreamInputStream iistream(&stream);
+                    // Try parsing input as a prototxt message
+                    if (!google::protobuf::TextFormat::Parse(&iistream, &model_proto))
+                    {
+                        throw detail::error::stream_parse{stream};
+                    }
                 }
-            }
 
-            Model model{model_proto};
-            Graph graph{model_proto.graph(), model};
-            auto function = std::make_shared<Function>(
-                graph.get_ng_outputs(), graph.get_ng_parameters(), graph.get_name());
-            for (std::size_t i{0}; i < function->get_output_size(); ++i)
-            {
-                function->get_output_op(i)->set_friendly_name(graph.get_outputs().at(i).get_name());
+                auto parsed = clock::now();
+
+                Model model{model_proto, model_dir};
+                // The proto is discarded after the import, which lets the graph release the
+                // serialized weights as it converts them to Constants.
+                Graph graph{*model_proto.mutable_graph(), model};
+                auto function = std::make_shared<Function>(
+                    graph.get_ng_outputs(), graph.get_ng_parameters(), graph.get_name());
+                for (std::size_t i{0}; i < function->get_output_size(); ++i)
+                {
+                    function->get_output_op(i)->set_friendly_name(
+                        graph.get_outputs().at(i).get_name());
+                }
+                if (statistics)
+                {
+                    using microseconds = std::chrono::duration<double, std::micro>;
+                    statistics->parse_microseconds = microseconds(parsed - start).count();
+                    statistics->convert_microseconds = microseconds(clock::now() - parsed).count();
+                }
+                return function;
             }
-            return function;
+        }
+
+        std::shared_ptr<Function> import_onnx_model(std::istream& stream)
+        {
+            return detail::import_onnx_model(stream, "");
         }
 
         std::shared_ptr<Function> import_onnx_model(const std::string& file_path)
+        {
+            ImportStatistics statistics;
+            return import_onnx_model(file_path, statistics);
+        }
+
+        std::shared_ptr<Function> import_onnx_model(const std::string& file_path,
+                                                    ImportStatistics& statistics)
         {
             std::ifstream ifs{file_path, std::ios::in | std::ios::binary};
             if (!ifs.is_open())
             {
                 throw detail::error::file_open{file_path};
             }
-            return import_onnx_model(ifs);
+            // Locations of external tensor data are relative to the model file
+            const auto model_dir = file_path.find('/') == std::string::npos
+                                       ? std::string{}
+                                       : file_util::get_directory(file_path);
+            return detail::import_onnx_model(ifs, model_dir, &statistics);
         }
 
         std::set<std::string> get_supported_operators(std::int64_t version,
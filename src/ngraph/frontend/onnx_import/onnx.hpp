@@ -62,6 +62,9 @@ namespace ngraph
         /// \note       If stream parsing fails or the ONNX model contains unsupported ops,
         ///             the function throws an ngraph_error exception.
         ///
+        /// \note       Locations of external tensor data are resolved relative to the current
+        ///             working directory.
+        ///
         /// \param[in]  stream    The input stream (e.g. file stream, memory stream, etc).
         ///
         /// \return     An nGraph function that represents a single output from the created graph.
@@ -74,11 +77,34 @@ namespace ngraph
         /// \note      If file parsing fails or the ONNX model contains unsupported ops,
         ///            the function throws an ngraph_error exception.
         ///
+        /// \note      Tensors stored in external data files are memory-mapped from the
+        ///            directory of the model file, so their data is not copied on import.
+        ///
         /// \param[in] file_path  The path to a file containing the ONNX model
         ///                       (relative or absolute).
         ///
         /// \return    An nGraph function that represents a single output from the created graph.
         ONNX_IMPORTER_API
         std::shared_ptr<Function> import_onnx_model(const std::string& file_path);
+
+        /// \brief      Time spent in the stages of an import, in microseconds.
+        struct ImportStatistics
+        {
+            /// Reading and parsing the protobuf message
+            double parse_microseconds{0};
+            /// Converting the ONNX graph to nGraph ops, which also validates each op
+            double convert_microseconds{0};
+        };
+
+        /// \brief      Imports an ONNX model from the input file like import_onnx_model and
+        ///             reports how long each stage took.
+        ///
+        /// \param[in]  file_path   The path to a file containing the ONNX model.
+        /// \param[out] statistics  The time spent in each stage of the import.
+        ///
+        /// \return     An nGraph function that represents a single output from the created graph.
+        ONNX_IMPORTER_API
+        std::shared_ptr<Function> import_onnx_model(const std::string& file_path,
+                                                    ImportStatistics& statistics);
     }
 }
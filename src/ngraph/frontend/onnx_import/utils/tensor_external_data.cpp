@@ -0,0 +1,141 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstring>
+#include <fstream>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "ngraph/file_util.hpp"
+#include "ngraph/op/constant.hpp"
+#include "tensor_external_data.hpp"
+
+namespace ngraph
+{
+    namespace onnx_import
+    {
+        namespace detail
+        {
+            TensorExternalData::TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor)
+            {
+                for (const auto& entry : tensor.external_data())
+                {
+                    if (entry.key() == "location")
+                    {
+                        m_location = entry.value();
+                    }
+                    else if (entry.key() == "offset")
+                    {
+                        m_offset = std::stoull(entry.value());
+                    }
+                    else if (entry.key() == "length")
+                    {
+                        m_length = std::stoull(entry.value());
+                    }
+                }
+                if (m_location.empty())
+                {
+                    throw error::tensor::invalid_external_data{"tensor '" + tensor.name() +
+                                                               "' has no location"};
+                }
+            }
+
+            std::shared_ptr<runtime::AlignedBuffer>
+                TensorExternalData::load(const std::string& model_dir) const
+            {
+                const std::string path =
+                    model_dir.empty() ? m_location : file_util::path_join(model_dir, m_location);
+                const size_t alignment = op::v0::Constant::host_alignment();
+#ifndef _WIN32
+                int fd = ::open(path.c_str(), O_RDONLY);
+                if (fd < 0)
+                {
+                    throw error::tensor::invalid_external_data{"failed to open '" + path + "'"};
+                }
+                struct stat st;
+                size_t file_size = 0;
+                if (fstat(fd, &st) == 0)
+                {
+                    file_size = static_cast<size_t>(st.st_size);
+                }
+                const size_t length = (m_length == 0 && file_size > m_offset)
+                                          ? file_size - m_offset
+                                          : m_length;
+                if (m_offset + length > file_size)
+                {
+                    ::close(fd);
+                    throw error::tensor::invalid_external_data{"'" + path +
+                                                               "' is too small for the tensor"};
+                }
+
+                // mmap offsets have to be page aligned
+                const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+                const size_t map_offset = m_offset - m_offset % page_size;
+                const size_t map_size = m_offset - map_offset + length;
+                void* p = MAP_FAILED;
+                if (length > 0)
+                {
+                    p = mmap(nullptr,
+                             map_size,
+                             PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE,
+                             fd,
+                             static_cast<off_t>(map_offset));
+                }
+                ::close(fd);
+                if (p != MAP_FAILED)
+                {
+                    std::shared_ptr<void> mapping{p,
+                                                  [map_size](void* ptr) { munmap(ptr, map_size); }};
+                    char* data = static_cast<char*>(p) + (m_offset - map_offset);
+                    if (reinterpret_cast<size_t>(data) % alignment == 0)
+                    {
+                        return std::make_shared<runtime::AlignedBuffer>(data, length, mapping);
+                    }
+                    auto buffer = std::make_shared<runtime::AlignedBuffer>(length, alignment);
+                    std::memcpy(buffer->get_ptr(), data, length);
+                    return buffer;
+                }
+#endif
+                std::ifstream in{path, std::ios::in | std::ios::binary};
+                if (!in.is_open())
+                {
+                    throw error::tensor::invalid_external_data{"failed to open '" + path + "'"};
+                }
+                size_t read_size = m_length;
+                if (read_size == 0)
+                {
+                    in.seekg(0, std::ios::end);
+                    const auto end = static_cast<size_t>(in.tellg());
+                    read_size = end > m_offset ? end - m_offset : 0;
+                }
+                auto buffer = std::make_shared<runtime::AlignedBuffer>(read_size, alignment);
+                in.seekg(m_offset, std::ios::beg);
+                in.read(buffer->get_ptr<char>(), read_size);
+                if (static_cast<size_t>(in.gcount()) != read_size)
+                {
+                    throw error::tensor::invalid_external_data{"'" + path +
+                                                               "' is too small for the tensor"};
+                }
+                return buffer;
+            }
+        }
+    }
+}
@@ -0,0 +1,84 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <onnx/onnx_pb.h>
+#include <string>
+
+#include "ngraph/except.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
+
+namespace ngraph
+{
+    namespace onnx_import
+    {
+        namespace error
+        {
+            namespace tensor
+            {
+                struct invalid_external_data : ngraph_error
+                {
+                    explicit invalid_external_data(const std::string& what)
+                        : ngraph_error{"invalid external data: " + what}
+                    {
+                    }
+                };
+            }
+        }
+
+        namespace detail
+        {
+            /// \brief Helper class used to load tensor data stored in an external file
+            ///        (TensorProto with data_location set to EXTERNAL).
+            class TensorExternalData
+            {
+            public:
+                explicit TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor);
+
+                /// \brief Memory-maps the data of the tensor.
+                ///
+                /// The file is mapped copy-on-write and the returned buffer references the
+                /// mapping directly when the data is suitably aligned, otherwise it is copied.
+                /// On platforms without mmap the data is read from the file.
+                ///
+                /// \param model_dir Directory the location of the data is relative to.
+                ///
+                /// \return Buffer holding the tensor data, which keeps the mapping alive.
+                std::shared_ptr<runtime::AlignedBuffer> load(const std::string& model_dir) const;
+
+                const std::string& get_location() const { return m_location; }
+                size_t get_offset() const { return m_offset; }
+                /// \return The size of the data in bytes, or 0 when it extends to the end of the
+                ///         file.
+                size_t get_length() const { return m_length; }
+
+            private:
+                std::string m_location;
+                size_t m_offset{0};
+                size_t m_length{0};
+            };
+
+            /// \return `true` if the data of the tensor is stored in an external file.
+            inline bool has_external_data(const ONNX_NAMESPACE::TensorProto& tensor)
+            {
+                return tensor.has_data_location() &&
+                       tensor.data_location() == ONNX_NAMESPACE::TensorProto_DataLocation_EXTERNAL;
+            }
+        }
+    }
+}
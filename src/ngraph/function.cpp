@@ -87,19 +87,104 @@ void Function::init()
     validate_nodes_and_infer_types();
 }
 
-NodeVector Function::get_ordered_ops() const
+void Function::update_ordered_ops() const
 {
-    NodeVector nodes;
-    for (auto& r : get_results())
+    size_t version = Node::get_graph_version();
+    if (m_ordered_ops_valid && m_ordered_ops_version == version)
     {
-        nodes.push_back(r);
+        return;
     }
-    for (auto& param : get_parameters())
+
+    m_ordered_ops.clear();
+    if (m_default_topological_sorter)
+    {
+        // topological_sort<NodeVector> over raw pointers, with the same visiting order
+        unordered_set<Node*> nodes_done;
+        stack<Node*, vector<Node*>> nodes_to_do;
+        for (auto& r : get_results())
+        {
+            nodes_to_do.push(r.get());
+        }
+        for (auto& param : get_parameters())
+        {
+            nodes_to_do.push(param.get());
+        }
+        while (nodes_to_do.size() > 0)
+        {
+            Node* node = nodes_to_do.top();
+            if (nodes_done.count(node) == 0)
+            {
+                bool can_add = true;
+                size_t arg_count = node->get_input_size();
+                for (size_t i = 0; i < arg_count; ++i)
+                {
+                    Node* dep = node->get_input_node_ptr(arg_count - i - 1);
+                    if (nodes_done.count(dep) == 0)
+                    {
+                        can_add = false;
+                        nodes_to_do.push(dep);
+                    }
+                }
+                for (auto& depptr : node->get_control_dependencies())
+                {
+                    Node* dep = depptr.get();
+                    if (nodes_done.count(dep) == 0)
+                    {
+                        can_add = false;
+                        nodes_to_do.push(dep);
+                    }
+                }
+                if (can_add)
+                {
+                    m_ordered_ops.push_back(node);
+                    nodes_to_do.pop();
+                    nodes_done.insert(node);
+                }
+            }
+            else
+            {
+                nodes_to_do.pop();
+            }
+        }
+    }
+    else
     {
-        nodes.push_back(param);
+        NodeVector nodes;
+        for (auto& r : get_results())
+        {
+            nodes.push_back(r);
+        }
+        for (auto& param : get_parameters())
+        {
+            nodes.push_back(param);
+        }
+        for (auto& node : m_topological_sorter(nodes))
+        {
+            m_ordered_ops.push_back(node.get());
+        }
     }
+    m_ordered_ops_version = version;
+    m_ordered_ops_valid = true;
+}
 
-    return m_topological_sorter(nodes);
+NodeVector Function::get_ordered_ops() const
+{
+    lock_guard<mutex> lock(m_ordered_ops_mutex);
+    update_ordered_ops();
+    NodeVector nodes;
+    nodes.reserve(m_ordered_ops.size());
+    for (Node* node : m_ordered_ops)
+    {
+        nodes.push_back(node->shared_from_this());
+    }
+    return nodes;
+}
+
+vector<Node*> Function::get_ordered_op_ptrs() const
+{
+    lock_guard<mutex> lock(m_ordered_ops_mutex);
+    update_ordered_ops();
+    return m_ordered_ops;
 }
 
 void Function::map_unordered_ops(std::function<void(Node*)> f) const
@@ -264,15 +349,11 @@ void Function::set_placement(size_t placement)
 // the result if the function is modified
 bool Function::is_dynamic() const
 {
-    auto list_of_nodes = this->get_ops();
-    for (auto& node : list_of_nodes)
-    {
-        if (node->get_output_partial_shape(0).is_dynamic())
-        {
-            return true;
-        }
-    }
-    return false;
+    bool dynamic = false;
+    map_unordered_ops([&dynamic](Node* node) {
+        dynamic = dynamic || node->get_output_partial_shape(0).is_dynamic();
+    });
+    return dynamic;
 }
 
 void Function::replace_parameter(size_t parameter_index,
@@ -286,9 +367,14 @@ void Function::replace_parameter(size_t parameter_index,
                  " parameters.");
     replace_node(m_parameters[parameter_index], parameter);
     m_parameters[parameter_index] = parameter;
+    lock_guard<mutex> lock(m_ordered_ops_mutex);
+    m_ordered_ops_valid = false;
 }
 
 void Function::set_topological_sort(topological_sort_t sorter)
 {
+    lock_guard<mutex> lock(m_ordered_ops_mutex);
     m_topological_sorter = sorter;
+    m_default_topological_sorter = false;
+    m_ordered_ops_valid = false;
 }
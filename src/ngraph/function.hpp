@@ -20,6 +20,7 @@
 #include <initializer_list>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -90,7 +91,12 @@ namespace ngraph
         const std::string& get_friendly_name() const;
 
         NodeVector get_ops() const;
+        /// \brief Returns the ops in topological order. The order is cached until the graph is
+        /// modified, see Node::get_graph_version.
         NodeVector get_ordered_ops() const;
+        /// \brief Returns the ops in topological order, like get_ordered_ops, without taking a
+        /// reference to each op. The pointers are only valid while the graph is not modified.
+        std::vector<Node*> get_ordered_op_ptrs() const;
         void map_unordered_ops(std::function<void(Node*)> f) const;
 
         friend std::ostream& operator<<(std::ostream&, const Function&);
@@ -140,5 +146,14 @@ namespace ngraph
         const std::string m_unique_name;
         size_t m_placement{0};
         topological_sort_t m_topological_sorter;
+        bool m_default_topological_sorter{true};
+
+        // Updates m_ordered_ops if the graph changed since it was sorted. Callers hold
+        // m_ordered_ops_mutex.
+        void update_ordered_ops() const;
+        mutable std::mutex m_ordered_ops_mutex;
+        mutable std::vector<Node*> m_ordered_ops;
+        mutable size_t m_ordered_ops_version{0};
+        mutable bool m_ordered_ops_valid{false};
     };
 }
@@ -100,7 +100,7 @@ void ngraph::traverse_nodes(const NodeVector& subgraph_results,
         if (instances_seen.insert(n).second)
         {
             f(n->shared_from_this());
-            for (size_t i = 0; i < n->inputs().size(); i++)
+            for (size_t i = 0; i < n->get_input_size(); i++)
             {
                 stack.push(n->get_input_node_ptr(i));
             }
@@ -302,8 +302,28 @@ bool ngraph::is_post_dominated(Node* X, Node* Y)
     return true;
 }
 
+static bool has_same_output_types(const Node& a, const Node& b)
+{
+    if (a.get_output_size() != b.get_output_size())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < a.get_output_size(); i++)
+    {
+        if (a.get_output_element_type(i) != b.get_output_element_type(i) ||
+            !a.get_output_partial_shape(i).same_scheme(b.get_output_partial_shape(i)))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 NodeVector ngraph::clone_nodes(const NodeVector& nodes, NodeMap& node_map)
 {
+    // Nodes cloned here, rather than mapped by the caller, produce the same values as the
+    // originals. Their users keep the original output types instead of inferring them again.
+    unordered_set<const Node*> identical;
     // for each node in topological order
     auto sorted_nodes = topological_sort(nodes);
     for (auto node : sorted_nodes)
@@ -312,10 +332,12 @@ NodeVector ngraph::clone_nodes(const NodeVector& nodes, NodeMap& node_map)
         {
             // get (already) cloned arguments and clone the node
             OutputVector cloned_args;
+            bool identical_args = true;
             for (auto input : node->inputs())
             {
                 Output<Node> output = input.get_source_output();
                 cloned_args.push_back(output.for_node(node_map.at(output.get_node())));
+                identical_args = identical_args && identical.count(output.get_node()) != 0;
             }
             NodeVector cloned_dependencies;
             for (auto& dependency : node->get_control_dependencies())
@@ -327,7 +349,17 @@ NodeVector ngraph::clone_nodes(const NodeVector& nodes, NodeMap& node_map)
                     cloned_dependencies.push_back(dependent);
                 }
             }
-            auto cloned_node = node->copy_with_new_inputs(cloned_args, cloned_dependencies);
+            auto cloned_node =
+                identical_args
+                    ? node->copy_with_identical_inputs(cloned_args, cloned_dependencies)
+                    : node->copy_with_new_inputs(cloned_args, cloned_dependencies);
+            // Nodes without inputs, such as parameters, are always validated and only count as
+            // identical if their types did not change
+            if (identical_args &&
+                (node->get_input_size() != 0 || has_same_output_types(*node, *cloned_node)))
+            {
+                identical.insert(node.get());
+            }
             if (node->get_friendly_name() != node->get_name())
             {
                 // There is a friendly name for this node so copy it
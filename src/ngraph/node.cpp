@@ -28,12 +28,15 @@
 #include "ngraph/op/constant.hpp"
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/op/result.hpp"
+#include "ngraph/op/util/binary_elementwise.hpp"
+#include "ngraph/op/util/unary_elementwise_arithmetic.hpp"
 #include "ngraph/pattern/matcher.hpp"
 
 using namespace std;
 using namespace ngraph;
 
 atomic<size_t> Node::m_next_instance_id(0);
+atomic<size_t> Node::s_graph_version(0);
 
 Node::Node(size_t output_size)
     : Node()
@@ -143,6 +146,7 @@ void Node::set_arguments(const OutputVector& arguments)
         auto& output_descriptor = output_node->get_output_descriptor(output.get_index());
         m_inputs.emplace_back(this, i++, output_descriptor);
     }
+    graph_modified();
 }
 
 descriptor::Input& Node::get_input_descriptor(size_t position)
@@ -160,7 +164,11 @@ descriptor::Output& Node::get_output_descriptor(size_t position)
     {
         size_t i = m_outputs.size();
         auto tensor_descriptor =
-            make_shared<descriptor::Tensor>(element::dynamic, PartialShape::dynamic(), this, i);
+            allocate_shared<descriptor::Tensor>(m_outputs.get_allocator(),
+                                                element::dynamic,
+                                                PartialShape::dynamic(),
+                                                this,
+                                                i);
         m_outputs.emplace_back(this, i, tensor_descriptor);
     }
     return m_outputs.at(position);
@@ -178,13 +186,115 @@ void Node::set_argument(size_t position, const Output<Node>& argument)
 // When that is working, these two functions will be removed.
 #define IN_TRANSITION
 
+// The node copied by copy_with_identical_inputs on this thread, whose output types the copy
+// takes over
+static thread_local const Node* s_type_source = nullptr;
+
+shared_ptr<Node> Node::copy_with_identical_inputs(const OutputVector& inputs,
+                                                  const NodeVector& control_dependencies) const
+{
+    const Node* previous = s_type_source;
+    s_type_source = this;
+    shared_ptr<Node> clone;
+    try
+    {
+        clone = copy_with_new_inputs(inputs, control_dependencies);
+    }
+    catch (...)
+    {
+        s_type_source = previous;
+        throw;
+    }
+    s_type_source = previous;
+    return clone;
+}
+
+// Ops whose validate_and_infer_types only sets output types. Others, such as TopK or
+// ReverseSequence, also compute members there that their clones do not copy.
+static bool only_infers_types(const Node& node)
+{
+    return dynamic_cast<const op::util::BinaryElementwise*>(&node) != nullptr ||
+           dynamic_cast<const op::util::UnaryElementwiseArithmetic*>(&node) != nullptr ||
+           dynamic_cast<const op::v0::Result*>(&node) != nullptr;
+}
+
+// True if node is the copy of source being constructed. Other nodes built while copying,
+// copies whose inputs do not match, nodes without inputs, whose types come from their
+// attributes, and ops with derived state must be validated.
+static bool is_identical_copy(const Node& node, const Node& source)
+{
+    if (node.get_type_info() != source.get_type_info() || node.get_input_size() == 0 ||
+        node.get_input_size() != source.get_input_size() || !only_infers_types(node))
+    {
+        return false;
+    }
+    for (size_t i = 0; i < node.get_input_size(); i++)
+    {
+        if (node.get_input_element_type(i) != source.get_input_element_type(i) ||
+            !node.get_input_partial_shape(i).same_scheme(source.get_input_partial_shape(i)))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 void Node::constructor_validate_and_infer_types()
 {
 #ifdef IN_TRANSITION
+    const Node* source = s_type_source;
+    if (source && is_identical_copy(*this, *source))
+    {
+        s_type_source = nullptr;
+        set_output_size(source->get_output_size());
+        for (size_t i = 0; i < source->get_output_size(); i++)
+        {
+            set_output_type(
+                i, source->get_output_element_type(i), source->get_output_partial_shape(i));
+        }
+        for (size_t i = 0; i < m_inputs.size(); i++)
+        {
+            m_inputs[i].m_is_relevant_to_shape = source->m_inputs[i].m_is_relevant_to_shape;
+            m_inputs[i].m_is_relevant_to_value = source->m_inputs[i].m_is_relevant_to_value;
+        }
+        return;
+    }
     validate_and_infer_types();
 #endif
 }
 
+bool Node::revalidate_if_stale()
+{
+    if (!m_types_stale)
+    {
+        return false;
+    }
+    revalidate_and_infer_types();
+    return true;
+}
+
+void Node::revalidate_and_infer_types()
+{
+    vector<pair<element::Type, PartialShape>> previous;
+    for (auto& output : m_outputs)
+    {
+        previous.emplace_back(output.get_element_type(), output.get_partial_shape());
+    }
+    validate_and_infer_types();
+    m_types_stale = false;
+    for (size_t i = 0; i < m_outputs.size(); i++)
+    {
+        if (i >= previous.size() || m_outputs[i].get_element_type() != previous[i].first ||
+            !m_outputs[i].get_partial_shape().same_scheme(previous[i].second))
+        {
+            for (auto input : m_outputs[i].get_inputs())
+            {
+                input->get_raw_pointer_node()->invalidate_types();
+            }
+        }
+    }
+}
+
 void Node::delayed_validate_and_infer_types()
 {
 #ifndef IN_TRANSITION
@@ -477,6 +587,7 @@ void Node::add_control_dependency(std::shared_ptr<Node> node)
         m_control_dependencies.end())
     {
         m_control_dependencies.push_back(node);
+        graph_modified();
         if (find(node->m_control_dependents.begin(), node->m_control_dependents.end(), this) ==
             node->m_control_dependents.end())
         {
@@ -514,6 +625,7 @@ void Node::remove_control_dependency(std::shared_ptr<Node> node)
         if (it != m_control_dependencies.end())
         {
             m_control_dependencies.erase(it);
+            graph_modified();
         }
     }
     {
@@ -536,6 +648,7 @@ void Node::clear_control_dependencies()
         }
     }
     m_control_dependencies.clear();
+    graph_modified();
 }
 
 void Node::clear_control_dependents()
@@ -37,6 +37,7 @@
 #include "ngraph/descriptor/input.hpp"
 #include "ngraph/descriptor/output.hpp"
 #include "ngraph/descriptor/tensor.hpp"
+#include "ngraph/node_arena.hpp"
 #include "ngraph/node_input.hpp"
 #include "ngraph/node_output.hpp"
 #include "ngraph/op/util/attr_types.hpp"
@@ -218,7 +219,19 @@ namespace ngraph
         /// Sets the number of outputs
         void set_output_size(size_t output_size);
 
-        void revalidate_and_infer_types() { validate_and_infer_types(); }
+        /// \brief Validates the node again. If this changes its output types its users are
+        ///        marked stale, see revalidate_if_stale.
+        void revalidate_and_infer_types();
+        /// \brief Marks the output types of the node as possibly out of date, e.g. after one of
+        ///        its attributes changed. Redirecting an input of the node also marks it.
+        void invalidate_types() { m_types_stale = true; }
+        /// \returns true if the node was marked by invalidate_types since it was last validated
+        bool types_are_stale() const { return m_types_stale; }
+        /// \brief Validates the node again if its types are stale. Since users of nodes whose
+        ///        output types change are marked stale in turn, visiting the nodes in
+        ///        topological order revalidates exactly the nodes affected by graph changes.
+        /// \returns true if the node was validated
+        bool revalidate_if_stale();
         // Called after transition
         void delayed_validate_and_infer_types();
 
@@ -290,6 +303,9 @@ namespace ngraph
         virtual bool is_dynamic() const;
         virtual bool has_state() const { return false; }
         size_t get_instance_id() const { return m_instance_id; }
+        /// \brief A counter that changes whenever an input of a node is redirected or a control
+        /// dependency is added or removed, so that cached traversals can tell they are stale
+        static size_t get_graph_version() { return s_graph_version; }
         /// \brief Writes a description of a node to a stream
         /// \param os The stream; should be returned
         /// \param depth How many levels of inputs to describe
@@ -401,6 +417,17 @@ namespace ngraph
         std::shared_ptr<Node> copy_with_new_inputs(const OutputVector& inputs,
                                                    const NodeVector& control_dependencies) const;
 
+        /// \brief Copies the node like copy_with_new_inputs, for inputs known to hold the same
+        ///        values as the inputs of this node.
+        ///
+        /// Elementwise ops and Results take their output types from this node instead of
+        /// inferring them again. Other ops, which may derive members from their inputs while
+        /// validating, ops that validate outside of constructor_validate_and_infer_types and
+        /// copies whose inputs turn out to have different types are validated as usual.
+        std::shared_ptr<Node>
+            copy_with_identical_inputs(const OutputVector& inputs,
+                                       const NodeVector& control_dependencies) const;
+
         /// True if this and node have one output with same element type and shape
         bool has_same_type(std::shared_ptr<const Node> node) const;
 
@@ -512,6 +539,7 @@ namespace ngraph
     private:
         descriptor::Input& get_input_descriptor(size_t position);
         descriptor::Output& get_output_descriptor(size_t position);
+        static void graph_modified() { s_graph_version++; }
 
         std::vector<Node*> m_control_dependents;
         NodeVector m_control_dependencies;
@@ -520,12 +548,14 @@ namespace ngraph
         std::string m_friendly_name;
         std::string m_unique_name;
         static std::atomic<size_t> m_next_instance_id;
+        static std::atomic<size_t> s_graph_version;
         std::unordered_set<std::string> m_provenance_tags;
         std::set<std::shared_ptr<Node>> m_provenance_group;
-        std::deque<descriptor::Input> m_inputs;
-        std::deque<descriptor::Output> m_outputs;
+        std::deque<descriptor::Input, ArenaAllocator<descriptor::Input>> m_inputs;
+        std::deque<descriptor::Output, ArenaAllocator<descriptor::Output>> m_outputs;
         std::unordered_map<Node*, autodiff::Adjoints> m_adjoint_map;
         int32_t m_placement = default_placement;
+        bool m_types_stale = false;
         std::shared_ptr<ngraph::op::util::OpAnnotations> m_op_annotations;
         std::map<std::string, std::shared_ptr<Variant>> m_rt_info;
     };
@@ -0,0 +1,79 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+
+#include "ngraph/check.hpp"
+#include "ngraph/node_arena.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static thread_local shared_ptr<NodeArena> s_current_arena;
+
+NodeArena::NodeArena(size_t block_size)
+    : m_block_size(block_size)
+{
+}
+
+void* NodeArena::allocate(size_t size, size_t alignment)
+{
+    NGRAPH_CHECK(alignment <= alignof(max_align_t), "Unsupported alignment ", alignment);
+    lock_guard<mutex> lock(m_mutex);
+    size_t padding = (alignment - reinterpret_cast<size_t>(m_next) % alignment) % alignment;
+    if (m_next == nullptr || static_cast<size_t>(m_end - m_next) < size + padding)
+    {
+        // Blocks come from new[], which is suitably aligned for any fundamental type
+        size_t block_size = max(m_block_size, size);
+        m_blocks.emplace_back(new char[block_size]);
+        m_next = m_blocks.back().get();
+        m_end = m_next + block_size;
+        m_reserved += block_size;
+        padding = 0;
+    }
+    void* p = m_next + padding;
+    m_next += padding + size;
+    m_allocated += size;
+    return p;
+}
+
+size_t NodeArena::get_allocated_size() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_allocated;
+}
+
+size_t NodeArena::get_reserved_size() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_reserved;
+}
+
+shared_ptr<NodeArena> NodeArena::get_current()
+{
+    return s_current_arena;
+}
+
+NodeArena::Scope::Scope(shared_ptr<NodeArena> arena)
+    : m_previous(move(s_current_arena))
+{
+    s_current_arena = move(arena);
+}
+
+NodeArena::Scope::~Scope()
+{
+    s_current_arena = move(m_previous);
+}
@@ -0,0 +1,146 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#include "ngraph/ngraph_visibility.hpp"
+
+namespace ngraph
+{
+    /// \brief Memory for the nodes of a graph, handed out from large blocks.
+    ///
+    /// While a NodeArena::Scope is active on a thread, the input and output descriptors and
+    /// the tensor descriptors of the nodes constructed on that thread are allocated from the
+    /// arena. NodeArena::make also places the node itself and its shared_ptr control block in
+    /// the arena. Memory is only released when the arena is destroyed, which happens once
+    /// every node allocated from it is gone, so an arena suits graphs that are built, e.g. by
+    /// an importer or clone_function, and then mostly kept as they are.
+    class NGRAPH_API NodeArena : public std::enable_shared_from_this<NodeArena>
+    {
+    public:
+        /// \param block_size The size of the blocks memory is taken from
+        explicit NodeArena(size_t block_size = 1 << 20);
+        NodeArena(const NodeArena&) = delete;
+        NodeArena& operator=(const NodeArena&) = delete;
+
+        void* allocate(size_t size, size_t alignment);
+
+        /// \returns The number of bytes handed out
+        size_t get_allocated_size() const;
+        /// \returns The number of bytes reserved in blocks
+        size_t get_reserved_size() const;
+
+        /// \returns The arena of the innermost active scope on this thread, or nullptr
+        static std::shared_ptr<NodeArena> get_current();
+
+        /// \brief Makes an arena the current one of the thread for its lifetime
+        class NGRAPH_API Scope
+        {
+        public:
+            explicit Scope(std::shared_ptr<NodeArena> arena);
+            ~Scope();
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+
+        private:
+            std::shared_ptr<NodeArena> m_previous;
+        };
+
+        /// \brief Constructs a node, or any other object, in the arena
+        template <typename T, typename... Args>
+        std::shared_ptr<T> make(Args&&... args);
+
+    private:
+        mutable std::mutex m_mutex;
+        std::vector<std::unique_ptr<char[]>> m_blocks;
+        char* m_next{nullptr};
+        char* m_end{nullptr};
+        size_t m_block_size;
+        size_t m_allocated{0};
+        size_t m_reserved{0};
+    };
+
+    /// \brief Allocates from a NodeArena, by default the current one when the allocator is
+    ///        constructed, or from the heap when there is none
+    template <typename T>
+    class ArenaAllocator
+    {
+    public:
+        using value_type = T;
+
+        ArenaAllocator()
+            : m_arena(NodeArena::get_current())
+        {
+        }
+        explicit ArenaAllocator(std::shared_ptr<NodeArena> arena)
+            : m_arena(std::move(arena))
+        {
+        }
+        template <typename U>
+        ArenaAllocator(const ArenaAllocator<U>& other)
+            : m_arena(other.get_arena())
+        {
+        }
+
+        T* allocate(size_t n)
+        {
+            if (m_arena)
+            {
+                return static_cast<T*>(m_arena->allocate(n * sizeof(T), alignof(T)));
+            }
+            return static_cast<T*>(::operator new(n * sizeof(T)));
+        }
+        void deallocate(T* p, size_t /* n */)
+        {
+            // Arena memory is released with the arena
+            if (!m_arena)
+            {
+                ::operator delete(p);
+            }
+        }
+
+        const std::shared_ptr<NodeArena>& get_arena() const { return m_arena; }
+    private:
+        std::shared_ptr<NodeArena> m_arena;
+    };
+
+    template <typename T, typename U>
+    bool operator==(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b)
+    {
+        return a.get_arena() == b.get_arena();
+    }
+
+    template <typename T, typename U>
+    bool operator!=(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b)
+    {
+        return !(a == b);
+    }
+
+    template <typename T, typename... Args>
+    std::shared_ptr<T> NodeArena::make(Args&&... args)
+    {
+        // The descriptors of the node come from this arena too
+        Scope scope(shared_from_this());
+        return std::allocate_shared<T>(ArenaAllocator<T>(shared_from_this()),
+                                       std::forward<Args>(args)...);
+    }
+}
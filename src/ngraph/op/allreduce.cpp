@@ -23,9 +23,12 @@ using namespace ngraph;
 
 constexpr NodeTypeInfo op::v0::AllReduce::type_info;
 
-op::v0::AllReduce::AllReduce(const Output<Node>& arg, reduction::Type reduce_type)
+op::v0::AllReduce::AllReduce(const Output<Node>& arg,
+                             reduction::Type reduce_type,
+                             reduction::Compression compression)
     : Op({arg})
     , m_reduce_type(reduce_type)
+    , m_compression(compression)
 {
     constructor_validate_and_infer_types();
 }
@@ -39,6 +42,12 @@ void op::v0::AllReduce::validate_and_infer_types()
                           "Only element types f32 and f64 are supported (argument element type: ",
                           get_input_element_type(0),
                           ").");
+    NODE_VALIDATION_CHECK(this,
+                          m_compression == reduction::Compression::NONE ||
+                              m_reduce_type == reduction::Type::SUM,
+                          "Only a SUM can be compressed (reduction: ",
+                          m_reduce_type,
+                          ").");
 
     set_output_type(0, get_input_element_type(0), get_input_partial_shape(0));
 }
@@ -46,12 +55,13 @@ void op::v0::AllReduce::validate_and_infer_types()
 shared_ptr<Node> op::v0::AllReduce::clone_with_new_inputs(const OutputVector& new_args) const
 {
     check_new_args_count(this, new_args);
-    return make_shared<AllReduce>(new_args.at(0), get_reduce_type());
+    return make_shared<AllReduce>(new_args.at(0), m_reduce_type, m_compression);
 }
 
 bool op::v0::AllReduce::visit_attributes(AttributeVisitor& visitor)
 {
     visitor.on_attribute("reduce_type", m_reduce_type);
+    visitor.on_attribute("compression", m_compression);
     return true;
 }
 
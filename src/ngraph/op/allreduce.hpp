@@ -32,8 +32,17 @@ namespace ngraph
                 static constexpr NodeTypeInfo type_info{"AllReduce", 0};
                 const NodeTypeInfo& get_type_info() const override { return type_info; }
                 AllReduce() = default;
+                /// \brief Constructs an AllReduce.
+                ///
+                /// \param arg The tensor to reduce over the ranks
+                /// \param reduce_type The reduction
+                /// \param compression The narrower type arg is sent as, if any. The rounding
+                ///        error of a call is added to arg in the next one, so that none of the
+                ///        gradient it compresses is lost over the steps of a training. Only a
+                ///        SUM can be compressed.
                 AllReduce(const Output<Node>& arg,
-                          reduction::Type reduce_type = reduction::Type::SUM);
+                          reduction::Type reduce_type = reduction::Type::SUM,
+                          reduction::Compression compression = reduction::Compression::NONE);
 
                 void validate_and_infer_types() override;
 
@@ -41,10 +50,16 @@ namespace ngraph
                     clone_with_new_inputs(const OutputVector& new_args) const override;
                 reduction::Type get_reduce_type() const;
                 void set_reduce_type(reduction::Type reduce_type);
+                reduction::Compression get_compression() const { return m_compression; }
+                void set_compression(reduction::Compression compression)
+                {
+                    m_compression = compression;
+                }
                 bool visit_attributes(AttributeVisitor& visitor) override;
 
             private:
                 reduction::Type m_reduce_type{reduction::Type::SUM};
+                reduction::Compression m_compression{reduction::Compression::NONE};
             };
         }
     }
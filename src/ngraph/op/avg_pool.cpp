@@ -623,7 +623,7 @@ bool op::v1::AvgPoolBackprop::visit_attributes(AttributeVisitor& visitor)
     return true;
 }
 
-const Shape op::v1::AvgPoolBackprop::get_forward_arg_shape() const
+Shape op::v1::AvgPoolBackprop::get_forward_arg_shape() const
 {
     Shape shape;
     if (auto const_op = as_type<op::v0::Constant>(input_value(1).get_node()))
@@ -339,7 +339,7 @@ namespace ngraph
                 virtual std::shared_ptr<Node>
                     clone_with_new_inputs(const OutputVector& new_args) const override;
 
-                const Shape get_forward_arg_shape() const;
+                Shape get_forward_arg_shape() const;
                 const Shape& get_kernel() const;
                 void set_kernel(const Shape& kernel);
                 const Strides& get_strides() const;
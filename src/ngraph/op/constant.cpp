@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <cmath>
 #include <cstdio>
 
@@ -174,21 +175,15 @@ op::v0::Constant::Constant(const element::Type& type,
         case element::Type_t::bf16:
         {
             vector<float> value = parse_string<float>(values);
-            auto target = get_data_ptr_nc<element::Type_t::bf16>();
-            for (size_t i = 0; i < value.size(); i++)
-            {
-                target[i] = value[i];
-            }
+            bfloat16::from_float_buffer(
+                value.data(), get_data_ptr_nc<element::Type_t::bf16>(), value.size());
             break;
         }
         case element::Type_t::f16:
         {
             vector<float> value = parse_string<float>(values);
-            auto target = get_data_ptr_nc<element::Type_t::f16>();
-            for (size_t i = 0; i < value.size(); i++)
-            {
-                target[i] = value[i];
-            }
+            float16::from_float_buffer(
+                value.data(), get_data_ptr_nc<element::Type_t::f16>(), value.size());
             break;
         }
         case element::Type_t::f32:
@@ -286,6 +281,18 @@ void* op::v0::Constant::allocate_buffer()
     return get_data_ptr_nc();
 }
 
+void op::v0::Constant::fill_from_first_element()
+{
+    size_t element_size = m_element_type.size();
+    size_t size = shape_size(m_shape) * element_size;
+    char* data = static_cast<char*>(get_data_ptr_nc());
+    // Double the filled prefix each time, so large constants take few, large copies
+    for (size_t filled = element_size; filled < size; filled *= 2)
+    {
+        std::memcpy(data + filled, data, std::min(filled, size - filled));
+    }
+}
+
 op::v0::Constant::Constant(const element::Type& type, const Shape& shape, const void* data)
     : Constant(type, shape)
 {
@@ -295,14 +302,73 @@ op::v0::Constant::Constant(const element::Type& type, const Shape& shape, const
     m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
 }
 
+op::v0::Constant::Constant(const element::Type& type,
+                           const Shape& shape,
+                           shared_ptr<runtime::AlignedBuffer> data)
+    : m_element_type(type)
+    , m_shape(shape)
+    , m_data(data)
+{
+    size_t size = ceil(shape_size(m_shape) * m_element_type.bitwidth() / 8.f);
+    NGRAPH_CHECK(m_data && m_data->size() >= size,
+                 "Constant data buffer is smaller than the constant (",
+                 m_data ? m_data->size() : 0,
+                 " < ",
+                 size,
+                 " bytes)");
+    constructor_validate_and_infer_types();
+    m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
+}
+
+op::v0::Constant::Constant(const element::Type& type, const Shape& shape, DataLoader loader)
+    : m_element_type(type)
+    , m_shape(shape)
+    , m_all_elements_bitwise_identical(false)
+    , m_lazy_data(make_shared<LazyData>())
+{
+    NGRAPH_CHECK(loader, "Lazy constant requires a data loader");
+    m_lazy_data->m_loader = move(loader);
+    constructor_validate_and_infer_types();
+}
+
 op::v0::Constant::Constant(const Constant& other)
-    : Constant(other.m_element_type, other.m_shape)
+    : Op()
+    , m_element_type(other.m_element_type)
+    , m_shape(other.m_shape)
+    , m_data(other.m_data)
+    , m_all_elements_bitwise_identical(other.m_all_elements_bitwise_identical)
+    , m_lazy_data(other.m_lazy_data)
 {
-    m_data = other.m_data;
-    m_all_elements_bitwise_identical = other.m_all_elements_bitwise_identical;
     constructor_validate_and_infer_types();
 }
 
+const shared_ptr<runtime::AlignedBuffer>& op::v0::Constant::load_data() const
+{
+    LazyData& lazy = *m_lazy_data;
+    call_once(lazy.m_once, [&]() {
+        auto data = lazy.m_loader();
+        size_t size = ceil(shape_size(m_shape) * m_element_type.bitwidth() / 8.f);
+        NGRAPH_CHECK(data && data->size() >= size,
+                     "Constant data buffer is smaller than the constant (",
+                     data ? data->size() : 0,
+                     " < ",
+                     size,
+                     " bytes)");
+        lazy.m_data = data;
+        lazy.m_all_elements_bitwise_identical =
+            are_all_data_elements_bitwise_identical(data->get_ptr());
+        // Release whatever the loader holds on to, such as an open archive
+        lazy.m_loader = nullptr;
+        lazy.m_loaded.store(true, memory_order_release);
+    });
+    return lazy.m_data;
+}
+
+bool op::v0::Constant::is_data_loaded() const
+{
+    return !m_lazy_data || m_lazy_data->m_loaded.load(memory_order_acquire);
+}
+
 op::v0::Constant::~Constant() {}
 
 string op::v0::Constant::convert_value_to_string(size_t index) const
@@ -522,13 +588,12 @@ shared_ptr<Node> op::v0::Constant::clone_with_new_inputs(const OutputVector& new
 }
 
 template <typename T>
-static bool test_bitwise_identical(const op::v0::Constant* constant)
+static bool test_bitwise_identical(const void* buffer, size_t size)
 {
-    const size_t size = shape_size(constant->get_output_shape(0));
     bool data_is_constant = true;
     if (size > 0)
     {
-        const T* data = constant->get_data_ptr<T>();
+        const T* data = static_cast<const T*>(buffer);
         const T compare = data[0];
         for (size_t i = 1; i < size; i++)
         {
@@ -544,6 +609,12 @@ static bool test_bitwise_identical(const op::v0::Constant* constant)
 
 bool op::v0::Constant::are_all_data_elements_bitwise_identical() const
 {
+    return are_all_data_elements_bitwise_identical(get_data_ptr());
+}
+
+bool op::v0::Constant::are_all_data_elements_bitwise_identical(const void* data) const
+{
+    const size_t size = shape_size(m_shape);
     bool rc = false;
 #if defined(__GNUC__) && !(__GNUC__ == 4 && __GNUC_MINOR__ == 8)
 #pragma GCC diagnostic push
@@ -556,7 +627,7 @@ bool op::v0::Constant::are_all_data_elements_bitwise_identical() const
     case element::Type_t::i8:
     case element::Type_t::u8:
     {
-        rc = test_bitwise_identical<uint8_t>(this);
+        rc = test_bitwise_identical<uint8_t>(data, size);
         break;
     }
     case element::Type_t::bf16:
@@ -564,21 +635,21 @@ bool op::v0::Constant::are_all_data_elements_bitwise_identical() const
     case element::Type_t::i16:
     case element::Type_t::u16:
     {
-        rc = test_bitwise_identical<uint16_t>(this);
+        rc = test_bitwise_identical<uint16_t>(data, size);
         break;
     }
     case element::Type_t::f32:
     case element::Type_t::i32:
     case element::Type_t::u32:
     {
-        rc = test_bitwise_identical<uint32_t>(this);
+        rc = test_bitwise_identical<uint32_t>(data, size);
         break;
     }
     case element::Type_t::f64:
     case element::Type_t::i64:
     case element::Type_t::u64:
     {
-        rc = test_bitwise_identical<uint64_t>(this);
+        rc = test_bitwise_identical<uint64_t>(data, size);
         break;
     }
     case element::Type_t::u1:
@@ -595,6 +666,13 @@ bool op::v0::Constant::visit_attributes(AttributeVisitor& visitor)
 {
     visitor.on_attribute("element_type", m_element_type);
     visitor.on_attribute("shape", m_shape);
+    if (m_lazy_data)
+    {
+        // The visitor works on the buffer itself, so the data has to be present
+        m_data = load_data();
+        m_all_elements_bitwise_identical = m_lazy_data->m_all_elements_bitwise_identical;
+        m_lazy_data.reset();
+    }
     if (m_data == nullptr)
     {
         // Filling in a fresh constant
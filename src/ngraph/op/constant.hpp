@@ -16,8 +16,11 @@
 
 #pragma once
 
+#include <atomic>
 #include <cmath>
 #include <cstring>
+#include <functional>
+#include <mutex>
 #include <sstream>
 
 #include "ngraph/coordinate_diff.hpp"
@@ -68,16 +71,24 @@ namespace ngraph
                         shape_size(m_shape),
                         ").");
 
-                    if (values.size() == 1)
+                    if (values.size() == 1 && shape_size(m_shape) != 1)
                     {
-                        write_values(std::vector<T>(shape_size(m_shape), values[0]));
+                        if (shape_size(m_shape) > 0)
+                        {
+                            // Convert the value once and replicate its bytes
+                            write_to_buffer(
+                                m_element_type, m_shape, values, get_data_ptr_nc(), 1);
+                            fill_from_first_element();
+                        }
+                        m_all_elements_bitwise_identical = true;
                     }
                     else
                     {
                         write_values(values);
+                        m_all_elements_bitwise_identical =
+                            are_all_data_elements_bitwise_identical();
                     }
                     constructor_validate_and_infer_types();
-                    m_all_elements_bitwise_identical = are_all_data_elements_bitwise_identical();
                 }
 
                 /// \brief Create unitialized constant
@@ -233,6 +244,31 @@ namespace ngraph
                 /// \param data A void* to constant data.
                 Constant(const element::Type& type, const Shape& shape, const void* data);
 
+                /// \brief Constructs a tensor constant that references existing data without
+                ///        copying it.
+                ///
+                /// \param type The element type of the tensor constant.
+                /// \param shape The shape of the tensor constant.
+                /// \param data Buffer holding the constant data. Must be at least as large as
+                ///        the constant and is shared, not copied.
+                Constant(const element::Type& type,
+                         const Shape& shape,
+                         std::shared_ptr<runtime::AlignedBuffer> data);
+
+                /// \brief Produces the data of a lazily loaded constant.
+                using DataLoader = std::function<std::shared_ptr<runtime::AlignedBuffer>()>;
+
+                /// \brief Constructs a tensor constant whose data is loaded on first access.
+                ///
+                /// The loader runs at most once, the first time the data is needed, and its
+                /// result is shared with every copy of the constant. Copies made before the
+                /// data is loaded do not trigger the load.
+                ///
+                /// \param type The element type of the tensor constant.
+                /// \param shape The shape of the tensor constant.
+                /// \param loader Returns a buffer at least as large as the constant.
+                Constant(const element::Type& type, const Shape& shape, DataLoader loader);
+
                 Constant(const Constant& other);
                 Constant& operator=(const Constant&) = delete;
 
@@ -328,13 +364,8 @@ namespace ngraph
                         throw ngraph_error("Buffer over-read");
                     }
 
-                    std::vector<T> rc;
                     const T* p = static_cast<const T*>(get_data_ptr());
-                    for (size_t i = 0; i < shape_size(m_shape); i++)
-                    {
-                        rc.push_back(p[i]);
-                    }
-                    return rc;
+                    return std::vector<T>(p, p + shape_size(m_shape));
                 }
 
                 /// \brief Return the Constant's value as a vector cast to type T
@@ -345,93 +376,63 @@ namespace ngraph
                 std::vector<T> cast_vector() const
                 {
                     auto source_type = get_output_element_type(0);
+                    size_t count = shape_size(m_shape);
                     std::vector<T> rc;
                     switch (source_type)
                     {
                     case element::Type_t::boolean:
-                    {
-                        auto vector = get_vector<char>();
-                        rc = std::vector<T>(vector.begin(), vector.end());
+                        read_converted(rc, get_data_ptr<char>(), count);
                         break;
-                    }
                     case element::Type_t::bf16:
-                    {
-                        auto vector = get_vector<bfloat16>();
-                        rc = std::vector<T>(vector.begin(), vector.end());
+                        read_converted(rc, get_data_ptr<bfloat16>(), count);
                         break;
-                    }
                     case element::Type_t::f16:
-                    {
-                        auto vector = get_vector<float16>();
-                        rc = std::vector<T>(vector.begin(), vector.end());
+                        read_converted(rc, get_data_ptr<float16>(), count);
                         break;
-                    }
                     case element::Type_t::f32:
-                    {
-                        auto vector = get_vector<float>();
-                        rc = std::vector<T>(vector.begin(), vector.end());
+                        read_converted(rc, get_data_ptr<float>(), count);
                         break;
-                    }
                     case element::Type_t::f64:
-                    {
-                        auto vector = get_vector<double>();
-                        rc = std::vector<T>(vector.begin(), vector.end());
+                        read_converted(rc, get_data_ptr<double>(), count);
                         break;
-                    }
                     case element::Type_t::i8:
-                    {
-                        auto vector = get_vector<int8_t>();
-                        rc = std::vector<T>(vector.begin(), vector.end());
+                        read_converted(rc, get_data_ptr<int8_t>(), count);
                         break;
-                    }
                     case element::Type_t::i16:
-                    {
-                        auto vector = get_vector<int16_t>();
-                        rc = std::vector<T>(vector.begin(), vector.end());
+                        read_converted(rc, get_data_ptr<int16_t>(), count);
                         break;
-                    }
                     case element::Type_t::i32:
-                    {
-                        auto vector = get_vector<int32_t>();
-                        rc = std::vector<T>(vector.begin(), vector.end());
+                        read_converted(rc, get_data_ptr<int32_t>(), count);
                         break;
-                    }
                     case element::Type_t::i64:
-                    {
-                        auto vector = get_vector<int64_t>();
-                        rc = std::vector<T>(vector.begin(), vector.end());
+                        read_converted(rc, get_data_ptr<int64_t>(), count);
                         break;
-                    }
                     case element::Type_t::u8:
-                    {
-                        auto vector = get_vector<uint8_t>();
-                        rc = std::vector<T>(vector.begin(), vector.end());
+                        read_converted(rc, get_data_ptr<uint8_t>(), count);
                         break;
-                    }
                     case element::Type_t::u16:
-                    {
-                        auto vector = get_vector<uint16_t>();
-                        rc = std::vector<T>(vector.begin(), vector.end());
+                        read_converted(rc, get_data_ptr<uint16_t>(), count);
                         break;
-                    }
                     case element::Type_t::u32:
-                    {
-                        auto vector = get_vector<uint32_t>();
-                        rc = std::vector<T>(vector.begin(), vector.end());
+                        read_converted(rc, get_data_ptr<uint32_t>(), count);
                         break;
-                    }
                     case element::Type_t::u64:
-                    {
-                        auto vector = get_vector<uint64_t>();
-                        rc = std::vector<T>(vector.begin(), vector.end());
+                        read_converted(rc, get_data_ptr<uint64_t>(), count);
                         break;
-                    }
                     default: throw std::runtime_error("unsupported type");
                     }
                     return rc;
                 }
 
-                const void* get_data_ptr() const { return (m_data ? m_data->get_ptr() : nullptr); }
+                const void* get_data_ptr() const
+                {
+                    const auto& data = m_lazy_data ? load_data() : m_data;
+                    return (data ? data->get_ptr() : nullptr);
+                }
+                /// \return false while a lazily loaded constant has not read its data yet
+                bool is_data_loaded() const;
+                /// \brief Alignment of the data buffer allocated for a constant
+                static constexpr size_t host_alignment() { return 64; }
                 template <typename T>
                 const T* get_data_ptr() const
                 {
@@ -450,6 +451,11 @@ namespace ngraph
                 bool is_constant() const override { return true; }
                 bool get_all_data_elements_bitwise_identical() const
                 {
+                    if (m_lazy_data)
+                    {
+                        load_data();
+                        return m_lazy_data->m_all_elements_bitwise_identical;
+                    }
                     return m_all_elements_bitwise_identical;
                 }
                 std::string convert_value_to_string(size_t index) const;
@@ -458,7 +464,11 @@ namespace ngraph
                 /// \brief Allocate a buffer and return a pointer to it
                 void* allocate_buffer();
 
-                void* get_data_ptr_nc() { return (m_data ? m_data->get_ptr() : nullptr); }
+                void* get_data_ptr_nc()
+                {
+                    const auto& data = m_lazy_data ? load_data() : m_data;
+                    return (data ? data->get_ptr() : nullptr);
+                }
                 template <element::Type_t ET>
                 typename element_type_traits<ET>::value_type* get_data_ptr_nc()
                 {
@@ -485,13 +495,63 @@ namespace ngraph
                 template <typename T, typename U>
                 void write_buffer(void* target, const std::vector<U>& source, size_t count)
                 {
-                    T* p = reinterpret_cast<T*>(target);
+                    write_converted(reinterpret_cast<T*>(target), source, count);
+                }
+
+                template <typename T, typename U>
+                static void write_converted(T* p, const std::vector<U>& source, size_t count)
+                {
                     for (size_t i = 0; i < count; i++)
                     {
                         p[i] = static_cast<T>(source[i]);
                     }
                 }
 
+                // Matching types are copied without conversion
+                template <typename T>
+                static void write_converted(T* p, const std::vector<T>& source, size_t count)
+                {
+                    std::memcpy(p, source.data(), count * sizeof(T));
+                }
+
+                // Weights are commonly narrowed from f32, which has bulk conversions
+                static void
+                    write_converted(float16* p, const std::vector<float>& source, size_t count)
+                {
+                    float16::from_float_buffer(source.data(), p, count);
+                }
+
+                static void
+                    write_converted(bfloat16* p, const std::vector<float>& source, size_t count)
+                {
+                    bfloat16::from_float_buffer(source.data(), p, count);
+                }
+
+                template <typename T, typename U>
+                static void read_converted(std::vector<T>& target, const U* source, size_t count)
+                {
+                    // A plain copy when T and U match
+                    target = std::vector<T>(source, source + count);
+                }
+
+                static void
+                    read_converted(std::vector<float>& target, const float16* source, size_t count)
+                {
+                    target.resize(count);
+                    float16::to_float_buffer(source, target.data(), count);
+                }
+
+                static void read_converted(std::vector<float>& target,
+                                           const bfloat16* source,
+                                           size_t count)
+                {
+                    target.resize(count);
+                    bfloat16::to_float_buffer(source, target.data(), count);
+                }
+
+                /// \brief Copies the first element over the rest of the buffer
+                void fill_from_first_element();
+
                 template <typename T>
                 void write_to_buffer(const element::Type& target_type,
                                      const Shape& /* target_shape */,
@@ -558,12 +618,26 @@ namespace ngraph
 #endif
                 }
 
-                static constexpr size_t host_alignment() { return 64; }
                 element::Type m_element_type;
                 Shape m_shape{};
                 std::shared_ptr<runtime::AlignedBuffer> m_data;
                 bool m_all_elements_bitwise_identical;
                 bool are_all_data_elements_bitwise_identical() const;
+                bool are_all_data_elements_bitwise_identical(const void* data) const;
+
+                /// \brief State of a lazily loaded constant, shared by all of its copies
+                struct LazyData
+                {
+                    std::once_flag m_once;
+                    DataLoader m_loader;
+                    std::shared_ptr<runtime::AlignedBuffer> m_data;
+                    bool m_all_elements_bitwise_identical{false};
+                    /// Set, with release ordering, once the loader has filled in the fields above
+                    std::atomic<bool> m_loaded{false};
+                };
+                std::shared_ptr<LazyData> m_lazy_data;
+                /// \brief Runs the loader of a lazy constant if it has not run yet
+                const std::shared_ptr<runtime::AlignedBuffer>& load_data() const;
             };
 
             /// \brief A scalar constant whose element type is the same as like.
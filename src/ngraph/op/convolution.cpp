@@ -564,7 +564,7 @@ bool op::v1::ConvolutionBackpropFilters::visit_attributes(AttributeVisitor& visi
     return true;
 }
 
-const Shape op::v1::ConvolutionBackpropFilters::get_filters_shape() const
+Shape op::v1::ConvolutionBackpropFilters::get_filters_shape() const
 {
     Shape shape;
     if (auto const_op = as_type<op::v0::Constant>(input_value(2).get_node()))
@@ -253,7 +253,7 @@ namespace ngraph
                     clone_with_new_inputs(const OutputVector& new_args) const override;
 
                 /// \return The filters tensor shape.
-                const Shape get_filters_shape() const;
+                Shape get_filters_shape() const;
                 /// \return The strides from the forward prop.
                 const Strides& get_strides() const { return m_strides; }
                 void set_strides(const Strides& strides) { m_strides = strides; }
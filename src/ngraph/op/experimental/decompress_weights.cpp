@@ -0,0 +1,97 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/experimental/decompress_weights.hpp"
+#include "ngraph/attribute_visitor.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr NodeTypeInfo op::v0::DecompressWeights::type_info;
+
+op::v0::DecompressWeights::DecompressWeights(const Output<Node>& packed,
+                                             const Output<Node>& scales,
+                                             const Shape& shape,
+                                             size_t axis,
+                                             size_t bits)
+    : Op({packed, scales})
+    , m_shape(shape)
+    , m_axis(axis)
+    , m_bits(bits)
+{
+    constructor_validate_and_infer_types();
+}
+
+Shape op::v0::DecompressWeights::get_packed_shape(const Shape& shape, size_t bits)
+{
+    Shape packed_shape = shape;
+    if (!packed_shape.empty())
+    {
+        packed_shape.back() = (packed_shape.back() * bits + 7) / 8;
+    }
+    return packed_shape;
+}
+
+void op::v0::DecompressWeights::validate_and_infer_types()
+{
+    NODE_VALIDATION_CHECK(
+        this, m_bits == 8 || m_bits == 4, "Only 8 and 4 bit weights are supported, got ", m_bits);
+    NODE_VALIDATION_CHECK(this,
+                          m_axis < m_shape.size(),
+                          "Channel axis ",
+                          m_axis,
+                          " is out of bounds for weights of shape ",
+                          m_shape);
+    NODE_VALIDATION_CHECK(this,
+                          get_input_element_type(0).compatible(element::i8),
+                          "Packed weights must have element type i8, got ",
+                          get_input_element_type(0));
+    NODE_VALIDATION_CHECK(this,
+                          get_input_element_type(1).compatible(element::f32),
+                          "Scales must have element type f32, got ",
+                          get_input_element_type(1));
+    NODE_VALIDATION_CHECK(this,
+                          get_input_partial_shape(0).compatible(get_packed_shape(m_shape, m_bits)),
+                          "Packed weights of shape ",
+                          get_input_partial_shape(0),
+                          " do not match the packed shape ",
+                          get_packed_shape(m_shape, m_bits),
+                          " of weights of shape ",
+                          m_shape);
+    NODE_VALIDATION_CHECK(this,
+                          get_input_partial_shape(1).compatible(Shape{m_shape[m_axis]}),
+                          "Expected ",
+                          m_shape[m_axis],
+                          " scales, got scales of shape ",
+                          get_input_partial_shape(1));
+
+    set_output_type(0, element::f32, m_shape);
+}
+
+bool op::v0::DecompressWeights::visit_attributes(AttributeVisitor& visitor)
+{
+    visitor.on_attribute("shape", m_shape);
+    visitor.on_attribute("axis", m_axis);
+    visitor.on_attribute("bits", m_bits);
+    return true;
+}
+
+shared_ptr<Node>
+    op::v0::DecompressWeights::clone_with_new_inputs(const OutputVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<DecompressWeights>(new_args.at(0), new_args.at(1), m_shape, m_axis, m_bits);
+}
@@ -0,0 +1,72 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/op/op.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        namespace v0
+        {
+            /// \brief Expands weight-only compressed storage to f32 weights.
+            ///
+            /// The weights are symmetric quantized with one scale per index of a channel axis,
+            /// w = q * scales[channel]. Each row of the last axis of the weights is packed into
+            /// whole bytes of `packed`: one value per byte for 8 bits, or two two's complement
+            /// nibbles per byte, low nibble first, for 4 bits.
+            class NGRAPH_API DecompressWeights : public Op
+            {
+            public:
+                static constexpr NodeTypeInfo type_info{"DecompressWeights", 0};
+                const NodeTypeInfo& get_type_info() const override { return type_info; }
+                DecompressWeights() = default;
+                /// \brief Constructs a DecompressWeights operation.
+                ///
+                /// \param packed i8 tensor of the packed quantized values, of shape
+                ///        get_packed_shape(shape, bits)
+                /// \param scales f32 vector with one scale per index of `axis`
+                /// \param shape shape of the decompressed weights
+                /// \param axis channel axis the scales are indexed by
+                /// \param bits bits per quantized value, 8 or 4
+                DecompressWeights(const Output<Node>& packed,
+                                  const Output<Node>& scales,
+                                  const Shape& shape,
+                                  size_t axis,
+                                  size_t bits);
+
+                void validate_and_infer_types() override;
+                bool visit_attributes(AttributeVisitor& visitor) override;
+
+                virtual std::shared_ptr<Node>
+                    clone_with_new_inputs(const OutputVector& new_args) const override;
+
+                const Shape& get_weights_shape() const { return m_shape; }
+                size_t get_axis() const { return m_axis; }
+                size_t get_bits() const { return m_bits; }
+                /// \returns the shape of the packed storage for weights of `shape`.
+                static Shape get_packed_shape(const Shape& shape, size_t bits);
+
+            protected:
+                Shape m_shape;
+                size_t m_axis;
+                size_t m_bits;
+            };
+        }
+    }
+}
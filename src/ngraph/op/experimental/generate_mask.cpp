@@ -102,7 +102,7 @@ shared_ptr<Node> op::v1::GenerateMask::clone_with_new_inputs(const OutputVector&
         new_args.at(0), new_args.at(1), m_element_type, m_seed, m_probability, m_use_seed);
 }
 
-const Shape op::v1::GenerateMask::get_mask_shape() const
+Shape op::v1::GenerateMask::get_mask_shape() const
 {
     Shape shape;
     if (auto const_op = as_type<op::v0::Constant>(input_value(1).get_node()))
@@ -111,7 +111,7 @@ namespace ngraph
                     m_element_type = element_type;
                 }
                 /// Deprecated accessor for transitional attributes
-                const Shape get_mask_shape() const;
+                Shape get_mask_shape() const;
                 /// \brief Returns the probability of a trial generating 1 (i.e. an element being
                 /// kept)
                 double get_probability() const { return m_probability; }
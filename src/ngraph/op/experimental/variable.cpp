@@ -0,0 +1,115 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/experimental/variable.hpp"
+#include "ngraph/attribute_visitor.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr NodeTypeInfo op::v0::ReadVariable::type_info;
+
+op::v0::ReadVariable::ReadVariable(const Output<Node>& initial_value, const string& variable_id)
+    : Op({initial_value})
+    , m_variable_id(variable_id)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::v0::ReadVariable::validate_and_infer_types()
+{
+    NODE_VALIDATION_CHECK(this, !m_variable_id.empty(), "Variable id must not be empty");
+    NODE_VALIDATION_CHECK(this,
+                          get_input_partial_shape(0).is_static() &&
+                              get_input_element_type(0).is_static(),
+                          "The initial value of variable ",
+                          m_variable_id,
+                          " must have a static element type and shape, got ",
+                          get_input_element_type(0),
+                          " ",
+                          get_input_partial_shape(0));
+    set_output_type(0, get_input_element_type(0), get_input_partial_shape(0));
+}
+
+bool op::v0::ReadVariable::visit_attributes(AttributeVisitor& visitor)
+{
+    visitor.on_attribute("variable_id", m_variable_id);
+    return true;
+}
+
+shared_ptr<Node> op::v0::ReadVariable::clone_with_new_inputs(const OutputVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<ReadVariable>(new_args.at(0), m_variable_id);
+}
+
+constexpr NodeTypeInfo op::v0::AssignVariable::type_info;
+
+op::v0::AssignVariable::AssignVariable(const Output<Node>& value, const string& variable_id)
+    : Op({value})
+    , m_variable_id(variable_id)
+{
+    constructor_validate_and_infer_types();
+}
+
+op::v0::AssignVariable::AssignVariable(const Output<Node>& value,
+                                       const shared_ptr<ReadVariable>& read)
+    : Op({value})
+    , m_variable_id(read->get_variable_id())
+{
+    constructor_validate_and_infer_types();
+    NODE_VALIDATION_CHECK(this,
+                          value.get_element_type() == read->get_output_element_type(0) &&
+                              value.get_partial_shape().same_scheme(
+                                  read->get_output_partial_shape(0)),
+                          "Value of element type ",
+                          value.get_element_type(),
+                          " and shape ",
+                          value.get_partial_shape(),
+                          " does not match variable ",
+                          m_variable_id,
+                          " of element type ",
+                          read->get_output_element_type(0),
+                          " and shape ",
+                          read->get_output_partial_shape(0));
+    add_control_dependency(read);
+}
+
+void op::v0::AssignVariable::validate_and_infer_types()
+{
+    NODE_VALIDATION_CHECK(this, !m_variable_id.empty(), "Variable id must not be empty");
+    NODE_VALIDATION_CHECK(this,
+                          get_input_partial_shape(0).is_static() &&
+                              get_input_element_type(0).is_static(),
+                          "The value of variable ",
+                          m_variable_id,
+                          " must have a static element type and shape, got ",
+                          get_input_element_type(0),
+                          " ",
+                          get_input_partial_shape(0));
+}
+
+bool op::v0::AssignVariable::visit_attributes(AttributeVisitor& visitor)
+{
+    visitor.on_attribute("variable_id", m_variable_id);
+    return true;
+}
+
+shared_ptr<Node> op::v0::AssignVariable::clone_with_new_inputs(const OutputVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<AssignVariable>(new_args.at(0), m_variable_id);
+}
@@ -0,0 +1,98 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <string>
+
+#include "ngraph/op/op.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        namespace v0
+        {
+            /// \brief Reads a variable, a tensor the backend keeps in a persistent buffer of the
+            ///        executable from one call to the next.
+            ///
+            /// The output is the value of the variable at the start of the call, or
+            /// `initial_value` until the variable is first assigned. Variables are identified
+            /// by their id within an executable.
+            class NGRAPH_API ReadVariable : public Op
+            {
+            public:
+                static constexpr NodeTypeInfo type_info{"ReadVariable", 0};
+                const NodeTypeInfo& get_type_info() const override { return type_info; }
+                ReadVariable() = default;
+                /// \brief Constructs a ReadVariable operation.
+                ///
+                /// \param initial_value value of the variable before it is assigned, which
+                ///        gives its element type and static shape
+                /// \param variable_id id of the variable
+                ReadVariable(const Output<Node>& initial_value, const std::string& variable_id);
+
+                void validate_and_infer_types() override;
+                bool visit_attributes(AttributeVisitor& visitor) override;
+
+                virtual std::shared_ptr<Node>
+                    clone_with_new_inputs(const OutputVector& new_args) const override;
+
+                const std::string& get_variable_id() const { return m_variable_id; }
+                bool has_state() const override { return true; }
+            protected:
+                std::string m_variable_id;
+            };
+
+            /// \brief Assigns a variable the value its reads see in the following calls.
+            ///
+            /// AssignVariable has no outputs. It is kept in a function by a control dependency
+            /// of one of the results on it, and must run after every ReadVariable of the
+            /// variable, which the constructor from a ReadVariable ensures with a control
+            /// dependency on it.
+            class NGRAPH_API AssignVariable : public Op
+            {
+            public:
+                static constexpr NodeTypeInfo type_info{"AssignVariable", 0};
+                const NodeTypeInfo& get_type_info() const override { return type_info; }
+                AssignVariable() = default;
+                /// \brief Constructs an AssignVariable operation.
+                ///
+                /// \param value new value of the variable
+                /// \param variable_id id of the variable
+                AssignVariable(const Output<Node>& value, const std::string& variable_id);
+                /// \brief Constructs an AssignVariable operation of the variable `read` reads,
+                ///        with a control dependency on `read`.
+                ///
+                /// \param value new value of the variable
+                /// \param read read of the variable
+                AssignVariable(const Output<Node>& value,
+                               const std::shared_ptr<ReadVariable>& read);
+
+                void validate_and_infer_types() override;
+                bool visit_attributes(AttributeVisitor& visitor) override;
+
+                virtual std::shared_ptr<Node>
+                    clone_with_new_inputs(const OutputVector& new_args) const override;
+
+                const std::string& get_variable_id() const { return m_variable_id; }
+                bool has_state() const override { return true; }
+            protected:
+                std::string m_variable_id;
+            };
+        }
+    }
+}
@@ -75,7 +75,7 @@ namespace ngraph
                 double get_eps() const { return m_eps; }
                 bool get_across_channels() const { return m_across_channels; }
                 bool get_normalize_variance() const { return m_normalize_variance; }
-                AxisSet get_reduction_axes() const { return m_reduction_axes; }
+                const AxisSet& get_reduction_axes() const { return m_reduction_axes; }
                 void set_reduction_axes(AxisSet axes) { m_reduction_axes = axes; }
 
             private:
@@ -14,6 +14,9 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <functional>
+#include <thread>
+
 #include "ngraph/op/non_zero.hpp"
 #include "ngraph/op/op.hpp"
 #include "ngraph/runtime/host_tensor.hpp"
@@ -94,8 +97,39 @@ namespace
         Shape input_shape = input->get_shape();
         size_t input_rank = input_shape.size();
 
-        size_t non_zero_count = runtime::reference::non_zero_get_count<IN_T>(
-            input->get_data_ptr<INPUT_ET>(), input_shape);
+        const IN_T* data = input->get_data_ptr<INPUT_ET>();
+        const size_t count = shape_size(input_shape);
+
+        // Large inputs are split between threads. Each gathers the positions of its chunk in
+        // one read of the input; after a prefix sum of their counts, each writes its columns.
+        const size_t chunk_elements = 1 << 16;
+        size_t chunks = min<size_t>(max(thread::hardware_concurrency(), 1u),
+                                    max<size_t>(count / chunk_elements, 1));
+        auto run_chunks = [chunks](const function<void(size_t)>& work) {
+            vector<thread> threads;
+            for (size_t chunk = 1; chunk < chunks; chunk++)
+            {
+                threads.emplace_back(work, chunk);
+            }
+            work(0);
+            for (auto& t : threads)
+            {
+                t.join();
+            }
+        };
+
+        vector<vector<size_t>> positions(chunks);
+        run_chunks([&](size_t chunk) {
+            runtime::reference::non_zero_positions(
+                data, count * chunk / chunks, count * (chunk + 1) / chunks, positions[chunk]);
+        });
+        vector<size_t> first_column(chunks);
+        size_t non_zero_count = 0;
+        for (size_t chunk = 0; chunk < chunks; chunk++)
+        {
+            first_column[chunk] = non_zero_count;
+            non_zero_count += positions[chunk].size();
+        }
 
         Shape out_shape;
         if (input_rank == 0 && non_zero_count > 0)
@@ -107,9 +141,13 @@ namespace
             out_shape = Shape{input_rank, non_zero_count};
         }
 
+        // The output is allocated once, at its final size
         output->set_shape(out_shape);
-        runtime::reference::non_zero<IN_T, OUT_T>(
-            input->get_data_ptr<INPUT_ET>(), output->get_data_ptr<OUT_ET>(), input_shape);
+        OUT_T* out = output->get_data_ptr<OUT_ET>();
+        run_chunks([&](size_t chunk) {
+            runtime::reference::non_zero_write(
+                positions[chunk], first_column[chunk], non_zero_count, input_shape, out);
+        });
 
         return true;
     }
@@ -63,15 +63,21 @@ namespace ngraph
                 void set_is_relevant_to_shapes(bool is_relevant);
 
                 const PartialShape& get_partial_shape() const { return m_partial_shape; }
-                PartialShape& get_partial_shape() { return m_partial_shape; }
+                PartialShape& get_partial_shape()
+                {
+                    invalidate_types();
+                    return m_partial_shape;
+                }
                 void set_partial_shape(const PartialShape& partial_shape)
                 {
                     m_partial_shape = partial_shape;
+                    invalidate_types();
                 }
                 const element::Type& get_element_type() const { return m_element_type; }
                 void set_element_type(const element::Type& element_type)
                 {
                     m_element_type = element_type;
+                    invalidate_types();
                 }
 
             protected:
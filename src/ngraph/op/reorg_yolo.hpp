@@ -43,7 +43,7 @@ namespace ngraph
                 virtual std::shared_ptr<Node>
                     clone_with_new_inputs(const OutputVector& new_args) const override;
 
-                Strides get_strides() const { return m_strides; }
+                const Strides& get_strides() const { return m_strides; }
 
             private:
                 Strides m_strides;
@@ -25,7 +25,7 @@
 #include "ngraph/op/reshape.hpp"
 #include "ngraph/op/subtract.hpp"
 #include "ngraph/op/sum.hpp"
-#include "ngraph/runtime/reference/softmax.hpp"
+#include "ngraph/runtime/opt_kernel/softmax.hpp"
 #include "ngraph/util.hpp"
 
 using namespace std;
@@ -56,19 +56,14 @@ bool op::v0::Softmax::are_axes_constant() const
     return input_value(1).get_node_shared_ptr()->is_constant();
 }
 
-const AxisSet op::v0::Softmax::get_axes() const
+AxisSet op::v0::Softmax::get_axes() const
 {
-    AxisSet axes;
-    auto const_op = dynamic_pointer_cast<op::v0::Constant>(input_value(1).get_node_shared_ptr());
-    if (const_op)
-    {
-        axes = const_op->get_axis_set_val();
-    }
-    else
+    auto const_op = as_type<op::v0::Constant>(input_value(1).get_node());
+    if (!const_op)
     {
         throw ngraph_error("get_axes called on a Softmax node whose 'axes' input is not constant");
     }
-    return axes;
+    return const_op->get_axis_set_val();
 }
 
 void op::v0::Softmax::set_axes(const AxisSet& axes)
@@ -165,7 +160,7 @@ namespace
                                      const AxisSet& axes)
     {
         return (ET == arg->get_element_type()) &&
-               (runtime::reference::softmax(
+               (runtime::opt_kernel::softmax(
                     arg->get_data_ptr<ET>(), out->get_data_ptr<ET>(), shape, axes),
                 true);
     }
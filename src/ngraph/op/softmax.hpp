@@ -58,7 +58,7 @@ namespace ngraph
                     clone_with_new_inputs(const OutputVector& new_args) const override;
 
                 bool are_axes_constant() const;
-                const AxisSet get_axes() const;
+                AxisSet get_axes() const;
                 void set_axes(const AxisSet& axes);
 
                 bool evaluate(const HostTensorVector& outputs,
@@ -53,7 +53,7 @@ namespace ngraph
                 /// \return The axis positions (0-based) to be eliminated through reduction.
                 /// \throws CheckFailure if the reduction axes are not constant. (Use
                 ///           reduction_axes_constant to check.)
-                const AxisSet get_reduction_axes() const;
+                AxisSet get_reduction_axes() const;
 
                 /// \brief Change the reduction axes
                 void set_reduction_axes(const AxisSet& reduction_axes);
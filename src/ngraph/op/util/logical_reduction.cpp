@@ -43,14 +43,13 @@ bool op::util::LogicalReduction::reduction_axes_constant() const
     return is_type<op::v0::Constant>(input_value(1).get_node());
 }
 
-const AxisSet op::util::LogicalReduction::get_reduction_axes() const
+AxisSet op::util::LogicalReduction::get_reduction_axes() const
 {
-    AxisSet axes;
     if (auto const_op = as_type<op::v0::Constant>(input_value(1).get_node()))
     {
-        axes = const_op->get_axis_set_val();
+        return const_op->get_axis_set_val();
     }
-    return axes;
+    return AxisSet();
 }
 
 void op::util::LogicalReduction::set_reduction_axes(const AxisSet& reduction_axes)
@@ -59,6 +59,7 @@ NGRAPH_OP(Any, ngraph::op::v0)
 NGRAPH_OP(ArgMax, ngraph::op::v0)
 NGRAPH_OP(ArgMin, ngraph::op::v0)
 NGRAPH_OP(Asin, ngraph::op::v0)
+NGRAPH_OP(AssignVariable, ngraph::op::v0)
 NGRAPH_OP(Atan, ngraph::op::v0)
 NGRAPH_OP(Atan2, ngraph::op::v0)
 NGRAPH_OP(AvgPool, ngraph::op::v0)
@@ -88,6 +89,7 @@ NGRAPH_OP(CropAndResize, ngraph::op::v0)
 NGRAPH_OP(CrossEntropy, ngraph::op::v0)
 NGRAPH_OP(CrossEntropyBackprop, ngraph::op::v0)
 NGRAPH_OP(CumSum, ngraph::op::v0)
+NGRAPH_OP(DecompressWeights, ngraph::op::v0)
 NGRAPH_OP(DepthToSpace, ngraph::op::v0)
 NGRAPH_OP(Dequantize, ngraph::op::v0)
 NGRAPH_OP(Divide, ngraph::op::v1)
@@ -161,6 +163,7 @@ NGRAPH_OP(QuantizedDot, ngraph::op::v0)
 NGRAPH_OP(QuantizedDotBias, ngraph::op::v0)
 NGRAPH_OP(RandomUniform, ngraph::op::v0)
 NGRAPH_OP(Range, ngraph::op::v0)
+NGRAPH_OP(ReadVariable, ngraph::op::v0)
 NGRAPH_OP(Recv, ngraph::op::v0)
 NGRAPH_OP(Relu, ngraph::op::v0)
 NGRAPH_OP(ReluBackprop, ngraph::op::v0)
@@ -28,10 +28,12 @@
 #include "ngraph/op/constant.hpp"
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/exp.hpp"
+#include "ngraph/op/experimental/generate_mask.hpp"
 #include "ngraph/op/experimental/transpose.hpp"
 #include "ngraph/op/gather.hpp"
 #include "ngraph/op/log.hpp"
 #include "ngraph/op/multiply.hpp"
+#include "ngraph/op/power.hpp"
 #include "ngraph/op/product.hpp"
 #include "ngraph/op/reshape.hpp"
 #include "ngraph/op/shape_of.hpp"
@@ -485,6 +487,175 @@ static bool simplify_add(shared_ptr<Node> add)
     return rc;
 }
 
+//`simplify_power` strength-reduces powers with a small integer exponent into
+// multiplies, which are much cheaper than the elementwise `pow` call
+//
+// a ^ 1 -> a
+// a ^ 2 -> a * a
+// a ^ 3 -> (a * a) * a
+// a ^ 4 -> (a * a) * (a * a)
+static bool simplify_power(shared_ptr<Node> power)
+{
+    auto base = power->input_value(0);
+    if (base.get_partial_shape().is_dynamic() || power->get_output_partial_shape(0).is_dynamic() ||
+        base.get_shape() != power->get_output_shape(0))
+    {
+        NGRAPH_DEBUG << power << " broadcasts its base";
+        return false;
+    }
+
+    auto exponent = get_constant(power->get_input_node_shared_ptr(1));
+    if (is_uniform_constant(exponent.get(), 1))
+    {
+        return replace_output_update_name(power->output(0), base);
+    }
+
+    NodeVector new_ops;
+    shared_ptr<Node> replacement;
+    if (is_uniform_constant(exponent.get(), 2))
+    {
+        replacement = make_shared<op::v1::Multiply>(base, base);
+        new_ops.push_back(replacement);
+    }
+    else if (is_uniform_constant(exponent.get(), 3))
+    {
+        auto square = make_shared<op::v1::Multiply>(base, base);
+        replacement = make_shared<op::v1::Multiply>(square, base);
+        new_ops = {square, replacement};
+    }
+    else if (is_uniform_constant(exponent.get(), 4))
+    {
+        auto square = make_shared<op::v1::Multiply>(base, base);
+        replacement = make_shared<op::v1::Multiply>(square, square);
+        new_ops = {square, replacement};
+    }
+    else
+    {
+        return false;
+    }
+
+    replacement->set_friendly_name(power->get_friendly_name());
+    copy_runtime_info(power, new_ops);
+    replace_node(power, replacement);
+    return true;
+}
+
+// CPUFusion matches the divides of batch-norm statistics and of dropout scaling as a whole
+// and `simplify_log` folds `log(exp(x) / y)`; those divides are left as they are
+static bool is_divide_pattern_anchor(const Output<Node>& dividend)
+{
+    auto node = dividend.get_node();
+    if (is_type<op::v0::Sum>(node) || is_type<op::v0::Exp>(node))
+    {
+        return true;
+    }
+    if (is_type<op::v1::Subtract>(node) || is_type<op::v1::Multiply>(node))
+    {
+        for (auto& arg : node->input_values())
+        {
+            auto arg_node = arg.get_node();
+            if (is_type<op::v0::Sum>(arg_node) || is_type<op::v0::GenerateMask>(arg_node))
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+template <typename T>
+static shared_ptr<op::v0::Constant> reciprocal_constant(const op::v0::Constant& constant,
+                                                        const Shape& shape)
+{
+    const T* values = static_cast<const T*>(constant.get_data_ptr());
+    size_t count = constant.get_all_data_elements_bitwise_identical()
+                       ? 1
+                       : shape_size(constant.get_output_shape(0));
+    vector<T> reciprocals(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        if (values[i] == static_cast<T>(0))
+        {
+            return nullptr;
+        }
+        reciprocals[i] = static_cast<T>(1) / values[i];
+    }
+    return op::v0::Constant::create(constant.get_output_element_type(0), shape, reciprocals);
+}
+
+//`simplify_divide` replaces a division by a floating-point constant with a
+// multiplication by its reciprocal; a multiply has a fraction of a divide's latency
+//
+// a / c -> a * (1 / c)
+// a / broadcast(c) -> a * (1 / c) for a uniform c
+static bool simplify_divide(shared_ptr<Node> divide)
+{
+    auto divisor = divide->input_value(1);
+    auto type = divisor.get_element_type();
+    if ((type != element::f32 && type != element::f64) || divisor.get_partial_shape().is_dynamic())
+    {
+        return false;
+    }
+    if (is_divide_pattern_anchor(divide->input_value(0)))
+    {
+        NGRAPH_DEBUG << divide << " is left for a fusion";
+        return false;
+    }
+
+    auto constant = get_constant(divisor.get_node_shared_ptr());
+    if (!constant || (constant != divisor.get_node_shared_ptr() &&
+                      !constant->get_all_data_elements_bitwise_identical()))
+    {
+        return false;
+    }
+
+    auto reciprocal = type == element::f32
+                          ? reciprocal_constant<float>(*constant, divisor.get_shape())
+                          : reciprocal_constant<double>(*constant, divisor.get_shape());
+    if (!reciprocal)
+    {
+        NGRAPH_DEBUG << divisor << " has a zero element";
+        return false;
+    }
+
+    auto multiply = make_shared<op::v1::Multiply>(
+        divide->input_value(0), reciprocal, divide->get_autob());
+    multiply->set_friendly_name(divide->get_friendly_name());
+    copy_runtime_info(divide, {reciprocal, multiply});
+    replace_node(divide, multiply);
+    return true;
+}
+
+//`simplify_exp` cancels `exp(log(x))` into `x`, which holds for the positive
+// inputs log is defined on, and only for real types
+static bool simplify_exp(shared_ptr<Node> n)
+{
+    if (!n->get_output_element_type(0).is_real())
+    {
+        return false;
+    }
+    if (auto log = as_type_ptr<op::v0::Log>(n->get_input_node_shared_ptr(0)))
+    {
+        return replace_output_update_name(n->output(0), log->input_value(0));
+    }
+    return false;
+}
+
+//`simplify_log_exp` cancels `log(exp(x))` into `x`, which holds until exp overflows, and
+// only for real types
+static bool simplify_log_exp(shared_ptr<Node> n)
+{
+    if (!n->get_output_element_type(0).is_real())
+    {
+        return false;
+    }
+    if (auto exp = as_type_ptr<op::v0::Exp>(n->get_input_node_shared_ptr(0)))
+    {
+        return replace_output_update_name(n->output(0), exp->input_value(0));
+    }
+    return false;
+}
+
 //`simplify_log` optimizes `log(exp(x)/y)` into `x - log(y)`
 static bool simplify_log(shared_ptr<Node> n)
 {
@@ -703,6 +874,105 @@ static bool simplify_reduction(shared_ptr<Node> n)
     return true;
 }
 
+//`simplify_sum_broadcast` reduces before broadcasting when every reduced axis is a
+// broadcast axis, so the sum never reads the broadcast tensor:
+//
+// sum(broadcast(x, axes = B), reduction_axes = R) -> broadcast(x, axes = B - R) * n
+// where R is a subset of B and n is the number of elements summed into each output
+static bool simplify_sum_broadcast(shared_ptr<Node> n)
+{
+    auto sum = static_pointer_cast<op::v0::Sum>(n);
+    auto broadcast = as_type_ptr<op::v0::Broadcast>(n->get_input_node_shared_ptr(0));
+    if (!broadcast || n->get_output_partial_shape(0).is_dynamic() ||
+        broadcast->get_output_partial_shape(0).is_dynamic())
+    {
+        return false;
+    }
+
+    auto type = n->get_output_element_type(0);
+    if (!type.is_real() && !type.is_integral_number())
+    {
+        return false;
+    }
+
+    const auto& reduction_axes = sum->get_reduction_axes();
+    const auto& broadcast_axes = broadcast->get_broadcast_axes();
+    const auto& broadcast_shape = broadcast->get_output_shape(0);
+    if (reduction_axes.empty())
+    {
+        return false;
+    }
+
+    // broadcast axes which survive the reduction, renumbered for the reduced shape
+    AxisSet remaining_axes;
+    size_t reduced_before = 0;
+    for (size_t axis = 0; axis < broadcast_shape.size(); axis++)
+    {
+        bool reduced = reduction_axes.count(axis) != 0;
+        bool broadcasted = broadcast_axes.count(axis) != 0;
+        if (reduced && !broadcasted)
+        {
+            NGRAPH_DEBUG << n << " reduces an axis of the broadcast argument";
+            return false;
+        }
+        if (reduced)
+        {
+            reduced_before++;
+        }
+        else if (broadcasted)
+        {
+            remaining_axes.insert(axis - reduced_before);
+        }
+    }
+
+    auto multiplier = reduction_shape_size(reduction_axes, broadcast_shape);
+    if (multiplier == 0)
+    {
+        return false;
+    }
+
+    const auto& output_shape = n->get_output_shape(0);
+    NodeVector new_ops;
+    Output<Node> replacement = broadcast->input_value(0);
+    if (!remaining_axes.empty())
+    {
+        replacement = make_shared<op::v0::Broadcast>(replacement, output_shape, remaining_axes);
+        new_ops.push_back(replacement.get_node_shared_ptr());
+    }
+    if (multiplier != 1)
+    {
+        shared_ptr<Node> count =
+            op::v0::Constant::create(type, Shape{}, {static_cast<double>(multiplier)});
+        new_ops.push_back(count);
+        if (output_shape.size() > 0)
+        {
+            AxisSet axes{};
+            for (size_t i = 0; i < output_shape.size(); i++)
+            {
+                axes.insert(i);
+            }
+            count = make_shared<op::v0::Broadcast>(count, output_shape, axes);
+            new_ops.push_back(count);
+        }
+        replacement = make_shared<op::v1::Multiply>(replacement, count);
+        new_ops.push_back(replacement.get_node_shared_ptr());
+    }
+
+    if (new_ops.empty())
+    {
+        return replace_output_update_name(n->output(0), replacement);
+    }
+    replacement.get_node_shared_ptr()->set_friendly_name(n->get_friendly_name());
+    copy_runtime_info(n, new_ops);
+    replace_node(n, replacement.get_node_shared_ptr());
+    return true;
+}
+
+static bool simplify_sum(shared_ptr<Node> n)
+{
+    return simplify_reduction<op::v0::Sum, get_sum_constant>(n) || simplify_sum_broadcast(n);
+}
+
 static bool replace_transpose_with_reshape(shared_ptr<Node> transpose)
 {
     auto data = transpose->input_value(0);
@@ -813,8 +1083,8 @@ static unordered_map<NodeTypeInfo, function<bool(shared_ptr<Node>)>> initialize_
          {op::v0::Concat::type_info, simplify_concat},
          {op::v0::ShapeOf::type_info, simplify_gather_shapeof},
          {op::v3::ShapeOf::type_info, simplify_gather_shapeof},
-         {op::v0::Sum::type_info,
-          function<bool(shared_ptr<Node>)>{simplify_reduction<op::v0::Sum, get_sum_constant>}},
+         {op::v1::Power::type_info, simplify_power},
+         {op::v0::Sum::type_info, simplify_sum},
          {op::v0::Product::type_info,
           function<bool(shared_ptr<Node>)>{simplify_reduction<op::v0::Product, get_prod_constant>}},
          {op::v0::Log::type_info, simplify_log},
@@ -824,6 +1094,12 @@ static unordered_map<NodeTypeInfo, function<bool(shared_ptr<Node>)>> initialize_
 static unordered_map<NodeTypeInfo, function<bool(shared_ptr<Node>)>> ops_to_simplifiers =
     initialize_ops_to_simplifiers();
 
+// The rewrites that may change results, applied ahead of the others in fast math only
+static unordered_map<NodeTypeInfo, function<bool(shared_ptr<Node>)>> fast_math_simplifiers = {
+    {op::v1::Divide::type_info, simplify_divide},
+    {op::v0::Exp::type_info, simplify_exp},
+    {op::v0::Log::type_info, simplify_log_exp}};
+
 bool pass::AlgebraicSimplification::run_on_function(shared_ptr<Function> f)
 {
     bool replaced = false;
@@ -834,6 +1110,15 @@ bool pass::AlgebraicSimplification::run_on_function(shared_ptr<Function> f)
             continue;
         }
 
+        if (m_fast_math)
+        {
+            auto fm = fast_math_simplifiers.find(n->get_type_info());
+            if (fm != fast_math_simplifiers.end() && fm->second(n))
+            {
+                replaced = true;
+                continue;
+            }
+        }
         auto eh = ops_to_simplifiers.find(n->get_type_info());
         if (eh != ops_to_simplifiers.end())
         {
@@ -30,5 +30,17 @@ namespace ngraph
 class NGRAPH_API ngraph::pass::AlgebraicSimplification : public FunctionPass
 {
 public:
+    /// \param fast_math Also apply the rewrites that may change results: divisions by
+    ///        constants become multiplications by their reciprocals, which may differ by an
+    ///        ulp, and exp(log(x)) and log(exp(x)) cancel into x, which differs for inputs
+    ///        outside the domain of log and on overflow.
+    AlgebraicSimplification(bool fast_math = false)
+        : m_fast_math(fast_math)
+    {
+    }
+
     virtual bool run_on_function(std::shared_ptr<ngraph::Function> f);
+
+private:
+    bool m_fast_math;
 };
@@ -14,11 +14,43 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <typeindex>
+#include <unordered_map>
+#include <unordered_set>
+
 #include "constant_folding.hpp"
+#include "ngraph/env_util.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/pass/pass_util.hpp"
 
 using namespace std;
 using namespace ngraph;
 
+namespace
+{
+    // One constant_fold call, shared by every node with the same key and equal inputs
+    struct Fold
+    {
+        shared_ptr<Node> node;
+        string key;
+        vector<shared_ptr<op::v0::Constant>> inputs;
+        OutputVector replacements;
+        bool folded{false};
+        size_t microseconds{0};
+    };
+
+    // Waves whose constant inputs are smaller than this are folded on the calling thread
+    const size_t s_parallel_min_bytes = 1 << 16;
+}
+
 bool ngraph::pass::revalidate_and_ensure_static(shared_ptr<Node> n)
 {
     n->revalidate_and_infer_types();
@@ -60,3 +92,226 @@ void ngraph::pass::ConstantFolding::construct_constant_default()
                 },
                 PassProperty::CHANGE_DYNAMIC_STATE);
 }
+
+bool ngraph::pass::ConstantFolding::run_on_function(shared_ptr<Function> f)
+{
+    // The subtree folding is the default handler run ahead of the matchers, so it is disabled
+    // along with it
+    bool folded = is_enabled("Constant folding defaults") && fold_constant_subtrees(f);
+    return GraphRewrite::run_on_function(f) || folded;
+}
+
+bool ngraph::pass::ConstantFolding::fold_constant_subtrees(const shared_ptr<Function>& f)
+{
+    static bool profile_enabled = getenv_bool("NGRAPH_PROFILE_PASS_ENABLE");
+
+    auto is_foldable = [this](const shared_ptr<Node>& node) {
+        if (node->is_constant() || node->is_parameter() || node->is_output() ||
+            node->get_input_size() == 0)
+        {
+            return false;
+        }
+        // Backends that provide their own kernels leave those ops to the matchers
+        if (m_cfmap.count(type_index(typeid(*node))) != 0)
+        {
+            return false;
+        }
+        for (auto& input : node->input_values())
+        {
+            if (!input.get_node()->is_constant())
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    vector<shared_ptr<Node>> wave;
+    for (auto& node : f->get_ordered_ops())
+    {
+        if (is_foldable(node))
+        {
+            wave.push_back(node);
+        }
+    }
+
+    bool folded = false;
+    while (!wave.empty())
+    {
+        // Match every node of the wave against the folds before it. Identical subtrees over
+        // equal constants reach the same depth, so folds are only memoized within a wave, which
+        // keeps the constants they were computed from alive no longer than the wave.
+        unordered_multimap<size_t, shared_ptr<Fold>> memo;
+        unordered_map<const Node*, size_t> constant_hashes;
+        vector<pair<shared_ptr<Node>, shared_ptr<Fold>>> wave_folds;
+        vector<shared_ptr<Fold>> pending;
+        size_t pending_bytes = 0;
+        for (auto& node : wave)
+        {
+            if (!revalidate_and_ensure_static(node))
+            {
+                continue;
+            }
+            auto fold = make_shared<Fold>();
+            fold->node = node;
+            for (auto& input : node->input_values())
+            {
+                fold->inputs.push_back(
+                    static_pointer_cast<op::v0::Constant>(input.get_node_shared_ptr()));
+            }
+
+            string attribute_key;
+            bool memoizable = get_attribute_key(*node, attribute_key);
+            size_t hash = 0;
+            if (memoizable)
+            {
+                const auto& type_info = node->get_type_info();
+                fold->key = string(type_info.name) + "_v" + to_string(type_info.version) + ":" +
+                            attribute_key;
+                hash = std::hash<string>()(fold->key);
+                for (auto& input : fold->inputs)
+                {
+                    auto it = constant_hashes.find(input.get());
+                    if (it == constant_hashes.end())
+                    {
+                        it = constant_hashes.emplace(input.get(), hash_constant(*input)).first;
+                    }
+                    hash = hash * 31 + it->second;
+                }
+                auto same_fold = [&](const pair<const size_t, shared_ptr<Fold>>& entry) {
+                    const Fold& other = *entry.second;
+                    if (other.key != fold->key || other.inputs.size() != fold->inputs.size())
+                    {
+                        return false;
+                    }
+                    for (size_t i = 0; i < fold->inputs.size(); i++)
+                    {
+                        if (!constants_equal(*other.inputs[i], *fold->inputs[i]))
+                        {
+                            return false;
+                        }
+                    }
+                    return true;
+                };
+                auto range = memo.equal_range(hash);
+                auto match = find_if(range.first, range.second, same_fold);
+                if (match != range.second)
+                {
+                    wave_folds.emplace_back(node, match->second);
+                    continue;
+                }
+                memo.emplace(hash, fold);
+            }
+            wave_folds.emplace_back(node, fold);
+            pending.push_back(fold);
+            for (auto& input : fold->inputs)
+            {
+                pending_bytes += constant_byte_size(*input);
+            }
+        }
+
+        // Evaluate the new folds. Each one reads its constant inputs and creates new constants.
+        // An input can be shared by several folds, and reading it as a HostTensor names its
+        // tensor on first use, so the names are set here before the folds run concurrently.
+        auto evaluate = [](Fold& fold) {
+            stopwatch timer;
+            timer.start();
+            fold.replacements.resize(fold.node->get_output_size());
+            fold.folded = fold.node->constant_fold(fold.replacements, fold.node->input_values());
+            timer.stop();
+            fold.microseconds = timer.get_microseconds();
+        };
+        size_t num_threads = min<size_t>(pending.size(), thread::hardware_concurrency());
+        if (num_threads > 1 && pending_bytes >= s_parallel_min_bytes)
+        {
+            for (auto& fold : pending)
+            {
+                for (auto& input : fold->inputs)
+                {
+                    input->output(0).get_tensor().get_name();
+                }
+            }
+            atomic<size_t> next{0};
+            exception_ptr error;
+            atomic_flag error_set = ATOMIC_FLAG_INIT;
+            vector<thread> threads;
+            for (size_t t = 0; t < num_threads; t++)
+            {
+                threads.emplace_back([&]() {
+                    for (size_t i = next++; i < pending.size(); i = next++)
+                    {
+                        try
+                        {
+                            evaluate(*pending[i]);
+                        }
+                        catch (...)
+                        {
+                            if (!error_set.test_and_set())
+                            {
+                                error = current_exception();
+                            }
+                        }
+                    }
+                });
+            }
+            for (auto& t : threads)
+            {
+                t.join();
+            }
+            if (error)
+            {
+                rethrow_exception(error);
+            }
+        }
+        else
+        {
+            for (auto& fold : pending)
+            {
+                evaluate(*fold);
+            }
+        }
+
+        // Replace the folded nodes, and collect their users that are now foldable
+        vector<shared_ptr<Node>> next_wave;
+        unordered_set<Node*> next_wave_nodes;
+        for (auto& wave_fold : wave_folds)
+        {
+            auto& node = wave_fold.first;
+            const Fold& fold = *wave_fold.second;
+            if (!fold.folded)
+            {
+                continue;
+            }
+            NGRAPH_CHECK(fold.replacements.size() == node->get_output_size(),
+                         "constant_fold returned incorrect number of replacements for ",
+                         node);
+            m_num_rewrites++;
+            if (profile_enabled)
+            {
+                cout << setw(7) << fold.microseconds << "us   fold " << node->get_name()
+                     << (fold.node == node ? "" : " (memoized)") << "\n";
+            }
+            for (size_t i = 0; i < fold.replacements.size(); ++i)
+            {
+                auto node_output = node->output(i);
+                auto replacement = fold.replacements.at(i);
+                if (!replacement.get_node_shared_ptr() || node_output == replacement)
+                {
+                    continue;
+                }
+                node_output.replace(replacement);
+                folded = true;
+                for (auto& target : replacement.get_target_inputs())
+                {
+                    auto user = target.get_node()->shared_from_this();
+                    if (next_wave_nodes.insert(user.get()).second && is_foldable(user))
+                    {
+                        next_wave.push_back(user);
+                    }
+                }
+            }
+        }
+        wave = move(next_wave);
+    }
+    return folded;
+}
@@ -94,7 +94,13 @@ public:
         construct_constant_default();
     }
 
+    /// \brief Folds every node whose inputs are all constants through Node::constant_fold,
+    ///        evaluating the independent nodes of each wave concurrently and identical nodes
+    ///        on identical constants once, then runs the matchers for what is left.
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
 private:
+    bool fold_constant_subtrees(const std::shared_ptr<ngraph::Function>& f);
     void construct_constant_dyn_broadcast();
     void construct_constant_pad();
     void construct_constant_quantize();
@@ -0,0 +1,43 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class ConvertFP32ToBF16;
+    }
+}
+
+class NGRAPH_API ngraph::pass::ConvertFP32ToBF16 : public ngraph::pass::GraphRewrite
+{
+public:
+    ConvertFP32ToBF16()
+        : GraphRewrite()
+    {
+        convert_constants_precision();
+        convert_parameters_precision();
+    }
+
+private:
+    void convert_constants_precision();
+
+    void convert_parameters_precision();
+};
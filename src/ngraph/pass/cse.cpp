@@ -57,6 +57,7 @@
 #include "ngraph/op/sum.hpp"
 #include "ngraph/op/tan.hpp"
 #include "ngraph/op/tanh.hpp"
+#include "ngraph/pass/pass_util.hpp"
 #include "ngraph/pattern/matcher.hpp"
 
 using namespace std;
@@ -211,47 +212,111 @@ static unordered_map<type_index, function<bool(shared_ptr<Node>, shared_ptr<Node
 static unordered_map<type_index, function<bool(shared_ptr<Node>, shared_ptr<Node>)>>
     ops_to_cse_handlers = initialize_ops_to_cse_handlers();
 
+using CSEHandlers =
+    unordered_map<type_index, function<bool(shared_ptr<Node>, shared_ptr<Node>)>>;
+
+// Ops without a handler are compared structurally: same type, same inputs, equal output types
+// and equal attributes, as written by get_attribute_key. Ops with state, such as the random
+// number generators, and ops that do not visit all of their attributes are never eliminated
+// this way.
+static bool cse_structural(shared_ptr<Node> a, shared_ptr<Node> b)
+{
+    if (a->get_output_size() != b->get_output_size())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < a->get_output_size(); i++)
+    {
+        if (a->get_output_element_type(i) != b->get_output_element_type(i) ||
+            !a->get_output_partial_shape(i).same_scheme(b->get_output_partial_shape(i)))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// The key of a node is hashed once, from its type, its inputs and, for constants, its data, or
+// otherwise its attributes, so the expression map is a single pass over the graph and nodes
+// are only compared when their hashes match.
 class NodeKey
 {
 public:
-    NodeKey(const shared_ptr<Node>& n,
-            unordered_map<type_index, function<bool(shared_ptr<Node>, shared_ptr<Node>)>>&
-                backend_handlers)
+    NodeKey(const shared_ptr<Node>& n, const CSEHandlers& backend_handlers)
         : m_node(n)
-        , m_node_ref(*n)
-        , m_ti(TI(m_node_ref))
-        , m_backend_handlers(backend_handlers)
+        , m_ti(TI(*n))
     {
+        auto eh = ops_to_cse_handlers.find(m_ti);
+        auto backend_eh = backend_handlers.find(m_ti);
+        if (eh != ops_to_cse_handlers.end())
+        {
+            m_handler = &eh->second;
+        }
+        else if (backend_eh != backend_handlers.end())
+        {
+            m_handler = &backend_eh->second;
+        }
+        else if (!n->is_op() || n->has_state() || !pass::get_attribute_key(*n, m_attributes))
+        {
+            m_eliminable = false;
+        }
+
+        vector<size_t> hashes{hash<type_index>()(m_ti)};
+        OutputVector cargs = n->input_values();
+        if (n->is_commutative())
+        {
+            sort(begin(cargs), end(cargs));
+        }
+        for (auto& arg : cargs)
+        {
+            hashes.push_back(arg.get_node()->get_instance_id());
+            hashes.push_back(arg.get_index());
+        }
+        if (auto constant = as_type_ptr<op::v0::Constant>(n))
+        {
+            hashes.push_back(pass::hash_constant(*constant));
+        }
+        else if (!m_handler)
+        {
+            hashes.push_back(hash<string>()(m_attributes));
+        }
+        m_hash = hash_combine(hashes);
     }
 
     shared_ptr<Node> get_node() const { return m_node; }
+    size_t get_hash() const { return m_hash; }
+    bool is_eliminable() const { return m_eliminable; }
     bool operator==(const NodeKey& other) const
     {
-        if (m_ti == other.m_ti)
+        if (!m_eliminable || m_ti != other.m_ti)
         {
-            auto eh = ops_to_cse_handlers.find(m_ti);
-            if (eh != ops_to_cse_handlers.end())
-            {
-                return eh->second(m_node, other.m_node);
-            }
-
-            eh = m_backend_handlers.find(m_ti);
-            if (eh != m_backend_handlers.end())
-            {
-                return eh->second(m_node, other.m_node);
-            }
+            return false;
         }
-
-        return false;
+        if (m_handler)
+        {
+            return (*m_handler)(m_node, other.m_node);
+        }
+        if (m_attributes != other.m_attributes)
+        {
+            return false;
+        }
+        OutputVector args = m_node->input_values();
+        OutputVector other_args = other.m_node->input_values();
+        if (m_node->is_commutative())
+        {
+            sort(begin(args), end(args));
+            sort(begin(other_args), end(other_args));
+        }
+        return args == other_args && cse_structural(m_node, other.m_node);
     }
 
 private:
     shared_ptr<Node> m_node;
-    // m_node_ref is only to allow getting the type_index in the ctor
-    Node& m_node_ref;
-    std::type_index m_ti;
-    unordered_map<type_index, function<bool(shared_ptr<Node>, shared_ptr<Node>)>>&
-        m_backend_handlers;
+    type_index m_ti;
+    const function<bool(shared_ptr<Node>, shared_ptr<Node>)>* m_handler{nullptr};
+    string m_attributes;
+    bool m_eliminable{true};
+    size_t m_hash;
 };
 
 namespace std
@@ -259,40 +324,7 @@ namespace std
     template <>
     struct hash<NodeKey>
     {
-        size_t operator()(const NodeKey& k) const
-        {
-            Node& p_this = *k.get_node().get();
-            auto ti = TI(p_this);
-
-            hash<type_index> type_hash_compute{};
-            auto type_hash = type_hash_compute(ti);
-
-            vector<size_t> arg_ids;
-
-            arg_ids.push_back(type_hash);
-
-            OutputVector cargs;
-            for (auto input : k.get_node()->inputs())
-            {
-                cargs.push_back(input.get_source_output());
-            }
-
-            // TODO: Do we need another map, so we could
-            // specify how to compute hash for each op?
-            if (p_this.is_commutative())
-            {
-                sort(begin(cargs), end(cargs));
-            }
-
-            for (auto arg : cargs)
-            {
-                arg_ids.push_back(arg.get_node_shared_ptr()->get_instance_id());
-                arg_ids.push_back(arg.get_index());
-            }
-
-            auto hashc = ngraph::hash_combine(arg_ids);
-            return hashc;
-        }
+        size_t operator()(const NodeKey& k) const { return k.get_hash(); }
     };
 }
 
@@ -309,14 +341,19 @@ bool ngraph::pass::CommonSubexpressionElimination::run_on_function(shared_ptr<ng
         }
 
         NodeKey n_key(n, m_backend_cse_handlers);
-        if (expressions.count(n_key))
+        if (!n_key.is_eliminable())
+        {
+            continue;
+        }
+        auto it = expressions.find(n_key);
+        if (it != expressions.end())
         {
-            ngraph::replace_node(n, expressions.at(n_key));
+            ngraph::replace_node(n, it->second);
             replaced = true;
         }
         else
         {
-            expressions.insert(make_pair(n_key, n));
+            expressions.emplace(move(n_key), n);
         }
     }
 
@@ -15,6 +15,8 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <atomic>
+#include <deque>
 #include <iostream>
 #include <regex>
 #include <unordered_set>
@@ -27,6 +29,10 @@
 using namespace std;
 using namespace ngraph;
 
+// Memo epoch of the matchers, changed whenever a graph being rewritten may have changed. It is
+// shared by all the passes, which only makes them forget failed sub-matches more often.
+static atomic<size_t> s_rewrite_epoch{1};
+
 // GraphRewrite algorithm:
 // GraphRewrite processes an input graph in an topological order(i.e. args before users)
 // Given the following graph:          Abs2
@@ -75,18 +81,24 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
     do
     {
         rewritten = false;
+        // Failed sub-matches remembered by the matchers are only valid within a sweep in which
+        // the graph does not change
+        s_rewrite_epoch.fetch_add(1, memory_order_relaxed);
         // m_matchers may contain newly constructed matchers for matchers
         // that need multiple passes. See comments above.
         vector<MatchClosure> matchers_to_run{m_matchers};
         m_matchers.clear();
+        MatcherIndex index(matchers_to_run);
         for (auto node : f->get_ordered_ops())
         {
             if (m_enable_shape_inference)
             {
-                node->revalidate_and_infer_types();
+                // Only nodes downstream of a rewrite need their types inferred again
+                node->revalidate_if_stale();
             }
-            for (auto& closure : matchers_to_run)
+            for (size_t closure_index : index.get_closures(node->get_type_info()))
             {
+                auto& closure = matchers_to_run[closure_index];
                 if (is_dyn_func && closure.property[PassProperty::REQUIRE_STATIC_SHAPE])
                 {
                     NGRAPH_DEBUG << "matcher callback requires static shape but the "
@@ -96,7 +108,9 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
                 }
                 else if (closure.handler(node))
                 {
+                    s_rewrite_epoch.fetch_add(1, memory_order_relaxed);
                     rewritten = true;
+                    m_num_rewrites++;
                     // If call back may change function's is_dynamic state, we need to
                     // update the cached value.
                     if (closure.property.is_set(PassProperty::CHANGE_DYNAMIC_STATE))
@@ -150,10 +164,18 @@ bool pass::GraphRewriteBase::is_enabled(const std::string& name) const
 void pass::GraphRewriteBase::add_handler(const std::string& name,
                                          function<bool(const std::shared_ptr<Node>&)> handler,
                                          const PassPropertyMask& property)
+{
+    add_handler(name, handler, property, nullptr);
+}
+
+void pass::GraphRewriteBase::add_handler(const std::string& name,
+                                         function<bool(const std::shared_ptr<Node>&)> handler,
+                                         const PassPropertyMask& property,
+                                         const NodeTypeInfo* root_type)
 {
     if (is_enabled(name))
     {
-        m_matchers.push_back({name, handler, property});
+        m_matchers.push_back({name, handler, property, root_type});
         // If any matcher call back may change dynamic state, we need to
         // update the pass property.
         if (property.is_set(PassProperty::CHANGE_DYNAMIC_STATE))
@@ -163,6 +185,32 @@ void pass::GraphRewriteBase::add_handler(const std::string& name,
     }
 }
 
+const NodeTypeInfo* pass::GraphRewriteBase::get_root_type(const Output<Node>& pattern_value)
+{
+    // Node::match_node only matches nodes of its own type. Pattern ops override it.
+    Node* root = pattern_value.get_node();
+    return root->is_pattern() ? nullptr : &root->get_type_info();
+}
+
+const vector<size_t>& pass::GraphRewriteBase::MatcherIndex::get_closures(const NodeTypeInfo& type)
+{
+    auto it = m_closures_by_type.find(type);
+    if (it == m_closures_by_type.end())
+    {
+        vector<size_t> closures;
+        for (size_t i = 0; i < m_closures.size(); i++)
+        {
+            const NodeTypeInfo* root_type = m_closures[i].root_type;
+            if (!root_type || *root_type == type)
+            {
+                closures.push_back(i);
+            }
+        }
+        it = m_closures_by_type.emplace(type, move(closures)).first;
+    }
+    return it->second;
+}
+
 void pass::GraphRewrite::add_matcher(const shared_ptr<pattern::Matcher>& m,
                                      const graph_rewrite_callback& callback,
                                      const PassPropertyMask& property)
@@ -170,14 +218,18 @@ void pass::GraphRewrite::add_matcher(const shared_ptr<pattern::Matcher>& m,
     add_handler(m->get_name(),
                 [m, callback](const std::shared_ptr<Node>& node) -> bool {
                     NGRAPH_DEBUG << "Running matcher " << m->get_name() << " on " << node;
+                    m->set_memo_epoch(s_rewrite_epoch.load(memory_order_relaxed));
                     if (m->match(node))
                     {
                         NGRAPH_DEBUG << "Matcher " << m->get_name() << " matched " << node;
+                        // The callback may change the graph
+                        s_rewrite_epoch.fetch_add(1, memory_order_relaxed);
                         return callback(*m.get());
                     }
                     return false;
                 },
-                property);
+                property,
+                get_root_type(m->get_pattern_value()));
 }
 
 void pass::GraphRewrite::add_matcher(const shared_ptr<pattern::Matcher>& m,
@@ -201,7 +253,8 @@ void pass::RecurrentGraphRewrite::add_matcher(
                     }
                     return false;
                 },
-                property);
+                property,
+                get_root_type(m->get_initial_pattern_value()));
 }
 
 void pass::RecurrentGraphRewrite::add_matcher(
@@ -213,48 +266,115 @@ void pass::RecurrentGraphRewrite::add_matcher(
     add_matcher(m, callback, {PassProperty::REQUIRE_STATIC_SHAPE});
 }
 
+// RecurrentGraphRewrite applies up to m_num_iters rewrites. Instead of sweeping the whole graph
+// again after every rewrite, it keeps a worklist of the nodes that may match. It starts with every
+// node, and after a rewrite at a root it adds the root's former users, their new arguments (the
+// replacements), and everything downstream of them, since a new match must contain a changed
+// node and patterns match from their root towards the arguments.
 bool pass::RecurrentGraphRewrite::run_on_function(shared_ptr<Function> f)
 {
     m_function = f;
     bool changed = false;
-    size_t i = 0;
+    size_t rewrites = 0;
 
     // This check is very expensive and is only needed for experimental features, so we will hide
     // it behind an environment variable for now. TODO: Find a less expensive way to handle this.
     static bool s_rerun_dynamic_check = getenv_bool("NGRAPH_GRAPH_REWRITE_RERUN_DYNAMIC_CHECK");
+    bool is_dyn_func = s_rerun_dynamic_check && f->is_dynamic();
 
-    auto run_matchers = [&]() -> bool {
-        bool is_dyn_func = s_rerun_dynamic_check && f->is_dynamic();
-        for (auto node : f->get_ops())
+    MatcherIndex index(m_matchers);
+    deque<shared_ptr<Node>> worklist;
+    unordered_set<Node*> queued;
+    auto enqueue = [&](const shared_ptr<Node>& node) {
+        if (queued.insert(node.get()).second)
         {
-            for (auto& closure : m_matchers)
+            worklist.push_back(node);
+        }
+    };
+    for (auto& node : f->get_ops())
+    {
+        enqueue(node);
+    }
+
+    // Nodes replaced by an earlier rewrite are no longer part of the function
+    auto is_live = [](const shared_ptr<Node>& node) {
+        if (node->is_output() || node->is_parameter())
+        {
+            return true;
+        }
+        for (auto& output : node->outputs())
+        {
+            if (!output.get_target_inputs().empty())
             {
-                if (is_dyn_func && closure.property[PassProperty::REQUIRE_STATIC_SHAPE])
+                return true;
+            }
+        }
+        return false;
+    };
+
+    while (!worklist.empty() && rewrites < m_num_iters)
+    {
+        shared_ptr<Node> node = worklist.front();
+        worklist.pop_front();
+        queued.erase(node.get());
+        if (!is_live(node))
+        {
+            continue;
+        }
+
+        NodeVector users = node->get_users();
+        for (size_t closure_index : index.get_closures(node->get_type_info()))
+        {
+            auto& closure = m_matchers[closure_index];
+            if (is_dyn_func && closure.property[PassProperty::REQUIRE_STATIC_SHAPE])
+            {
+                NGRAPH_DEBUG << "matcher callback requires static shape but the "
+                                "function is dynamic, skipping this "
+                                "optimization till the shapes are fully "
+                                "materialized";
+            }
+            else if (closure.handler(node))
+            {
+                // If call back may change function's is_dynamic state, we need to
+                // update the cached value.
+                if (closure.property.is_set(PassProperty::CHANGE_DYNAMIC_STATE))
                 {
-                    NGRAPH_DEBUG << "matcher callback requires static shape but the "
-                                    "function is dynamic, skipping this "
-                                    "optimization till the shapes are fully "
-                                    "materialized";
+                    is_dyn_func = s_rerun_dynamic_check && f->is_dynamic();
                 }
-                else if (closure.handler(node))
+                changed = true;
+                rewrites++;
+                m_num_rewrites++;
+
+                // A pattern of several levels can have its root anywhere downstream of the
+                // replaced node, even if that root was already tried
+                deque<shared_ptr<Node>> downstream;
+                for (auto& user : users)
                 {
-                    // If call back may change function's is_dynamic state, we need to
-                    // update the cached value.
-                    if (closure.property.is_set(PassProperty::CHANGE_DYNAMIC_STATE))
+                    for (auto& argument : user->get_arguments())
                     {
-                        is_dyn_func = s_rerun_dynamic_check && f->is_dynamic();
+                        enqueue(argument);
                     }
-                    return true;
+                    downstream.push_back(user);
                 }
+                unordered_set<Node*> visited;
+                while (!downstream.empty())
+                {
+                    shared_ptr<Node> n = downstream.front();
+                    downstream.pop_front();
+                    if (visited.insert(n.get()).second)
+                    {
+                        enqueue(n);
+                        for (auto& user : n->get_users())
+                        {
+                            downstream.push_back(user);
+                        }
+                    }
+                }
+                // The root itself may still match, e.g. if it was only partly rewritten
+                enqueue(node);
+                break;
             }
         }
-        return false;
-    };
-
-    do
-    {
-        changed = run_matchers();
-        i++;
-    } while (changed && i < m_num_iters);
+    }
     return changed;
 }
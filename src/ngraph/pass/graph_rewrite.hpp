@@ -17,8 +17,10 @@
 #pragma once
 
 #include <functional>
+#include <map>
 #include <memory>
 #include <set>
+#include <vector>
 
 #include "ngraph/pass/pass.hpp"
 #include "ngraph/pattern/matcher.hpp"
@@ -48,6 +50,9 @@ public:
                      std::function<bool(const std::shared_ptr<Node>& node)> handler,
                      const PassPropertyMask& property);
 
+    /// \brief The number of rewrites applied by all runs of this pass so far
+    size_t get_num_rewrites() const { return m_num_rewrites; }
+
 protected:
     GraphRewriteBase()
         : FunctionPass()
@@ -60,13 +65,44 @@ protected:
 
     bool is_enabled(const std::string& name) const;
 
+    /// \brief Adds a handler that can only change nodes of type \p root_type, or any node when
+    ///        \p root_type is nullptr
+    void add_handler(const std::string& name,
+                     std::function<bool(const std::shared_ptr<Node>& node)> handler,
+                     const PassPropertyMask& property,
+                     const NodeTypeInfo* root_type);
+
+    /// \brief The type of node a pattern rooted at \p pattern_value can match, or nullptr if
+    ///        the root is a pattern op that matches more than one type
+    static const NodeTypeInfo* get_root_type(const Output<Node>& pattern_value);
+
     struct MatchClosure
     {
         std::string name;
         std::function<bool(const std::shared_ptr<Node>& node)> handler;
         PassPropertyMask property;
+        const NodeTypeInfo* root_type;
     };
     std::vector<MatchClosure> m_matchers;
+    size_t m_num_rewrites{0};
+
+    /// \brief Matchers indexed by the node types they can match
+    ///
+    /// Lists, for each node type seen, the positions in the closure vector of the closures
+    /// that can match it, in registration order.
+    class MatcherIndex
+    {
+    public:
+        MatcherIndex(const std::vector<MatchClosure>& closures)
+            : m_closures(closures)
+        {
+        }
+        const std::vector<size_t>& get_closures(const NodeTypeInfo& type);
+
+    private:
+        const std::vector<MatchClosure>& m_closures;
+        std::map<NodeTypeInfo, std::vector<size_t>> m_closures_by_type;
+    };
 };
 
 /// \brief GraphRewrite (in tandem with \sa Matcher) performs transformations on specified patterns
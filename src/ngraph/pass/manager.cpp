@@ -19,14 +19,22 @@
 #else
 #include <cxxabi.h>
 #endif
+#include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <memory>
+#include <mutex>
+#include <sstream>
+#ifndef _WIN32
+#include <unistd.h>
+#endif
 
+#include "ngraph/chrome_trace.hpp"
 #include "ngraph/env_util.hpp"
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/node.hpp"
+#include "ngraph/pass/graph_rewrite.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/pass.hpp"
 #include "ngraph/pass/serialize.hpp"
@@ -45,9 +53,70 @@ pass::Manager::Manager()
 
 pass::Manager::~Manager() {}
 
+static string get_pass_name(const pass::PassBase& pass)
+{
+    string name = typeid(pass).name();
+#ifndef _WIN32
+    int status;
+    char* demangled = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
+    if (demangled)
+    {
+        name = demangled;
+        free(demangled);
+    }
+#endif
+    return name;
+}
+
+static int64_t get_resident_bytes()
+{
+#if defined(__linux)
+    // The second field of statm is the resident set size in pages
+    ifstream statm("/proc/self/statm");
+    int64_t size = 0;
+    int64_t resident = 0;
+    if (statm >> size >> resident)
+    {
+        return resident * sysconf(_SC_PAGESIZE);
+    }
+#endif
+    return 0;
+}
+
+static size_t count_ops(const vector<shared_ptr<Function>>& functions)
+{
+    size_t count = 0;
+    for (auto& f : functions)
+    {
+        count += f->get_ops().size();
+    }
+    return count;
+}
+
+static size_t get_num_rewrites(const pass::PassBase& pass)
+{
+    auto graph_rewrite = dynamic_cast<const pass::GraphRewriteBase*>(&pass);
+    return graph_rewrite ? graph_rewrite->get_num_rewrites() : 0;
+}
+
+static mutex s_profile_callback_mutex;
+static pass::Manager::ProfileCallback s_profile_callback;
+
+void pass::Manager::set_profile_callback(ProfileCallback callback)
+{
+    lock_guard<mutex> lock(s_profile_callback_mutex);
+    s_profile_callback = move(callback);
+}
+
 void pass::Manager::run_passes(shared_ptr<Function> func, bool /* transitive */)
 {
     static bool profile_enabled = getenv_bool("NGRAPH_PROFILE_PASS_ENABLE");
+    ProfileCallback profile_callback;
+    {
+        lock_guard<mutex> lock(s_profile_callback_mutex);
+        profile_callback = s_profile_callback;
+    }
+    bool profile = m_profile || profile_enabled || profile_callback;
 
     get_state().set_function(func);
     vector<std::pair<shared_ptr<Function>, bool>> fs{std::make_pair(func, func->is_dynamic())};
@@ -57,8 +126,20 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool /* transitive */)
     stopwatch pass_timer;
     stopwatch overall_timer;
     overall_timer.start();
+    m_pass_profiles.clear();
+    size_t nodes_before = profile ? count_ops(f_array) : 0;
     for (shared_ptr<PassBase> pass : m_pass_list)
     {
+        PassProfile pass_profile{};
+        if (profile)
+        {
+            pass_profile.name = get_pass_name(*pass);
+            pass_profile.index = index;
+            pass_profile.nodes_before = nodes_before;
+            pass_profile.memory_delta = -get_resident_bytes();
+            pass_profile.rewrites = get_num_rewrites(*pass);
+        }
+        event::Duration pass_event(profile ? pass_profile.name : "pass", "Pass");
         pass_timer.start();
         pass->set_state(get_state());
         auto module_pass = dynamic_pointer_cast<ModulePass>(pass);
@@ -152,15 +233,32 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool /* transitive */)
         }
         index++;
         pass_timer.stop();
+        pass_event.stop();
+        if (profile)
+        {
+            pass_profile.microseconds = pass_timer.get_microseconds();
+            pass_profile.nodes_after = count_ops(f_array);
+            pass_profile.memory_delta += get_resident_bytes();
+            pass_profile.rewrites = get_num_rewrites(*pass) - pass_profile.rewrites;
+            nodes_before = pass_profile.nodes_after;
+
+            stringstream args;
+            args << R"({"nodes_before":)" << pass_profile.nodes_before << R"(,"nodes_after":)"
+                 << pass_profile.nodes_after << R"(,"memory_delta":)"
+                 << pass_profile.memory_delta << R"(,"rewrites":)" << pass_profile.rewrites
+                 << "}";
+            pass_event.set_args(args.str());
+            m_pass_profiles.push_back(pass_profile);
+            if (profile_callback)
+            {
+                profile_callback(pass_profile);
+            }
+        }
         if (profile_enabled)
         {
-            PassBase* p = pass.get();
-            string name = typeid(*p).name();
-#ifndef _WIN32
-            int status;
-            name = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
-#endif
-            cout << setw(7) << pass_timer.get_milliseconds() << "ms " << name << "\n";
+            cout << setw(7) << pass_timer.get_milliseconds() << "ms " << pass_profile.name
+                 << " (" << pass_profile.nodes_before << " -> " << pass_profile.nodes_after
+                 << " nodes, " << pass_profile.rewrites << " rewrites)\n";
         }
     }
     if (profile_enabled)
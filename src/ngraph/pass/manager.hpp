@@ -16,8 +16,11 @@
 
 #pragma once
 
+#include <cstdint>
+#include <functional>
 #include <list>
 #include <memory>
+#include <string>
 #include <typeinfo>
 #include <vector>
 
@@ -32,9 +35,29 @@ namespace ngraph
     {
         class Manager;
         class ManagerState;
+        struct PassProfile;
     }
 }
 
+/// \brief What one pass did during pass::Manager::run_passes
+struct ngraph::pass::PassProfile
+{
+    /// \brief Demangled class name of the pass
+    std::string name;
+    /// \brief Position of the pass in the manager's pass list
+    size_t index;
+    size_t microseconds;
+    /// \brief Number of ops in the functions the manager runs on, before and after the pass
+    size_t nodes_before;
+    size_t nodes_after;
+    /// \brief Change in the resident memory of the process over the pass, or 0 where the
+    /// platform does not report it
+    int64_t memory_delta;
+    /// \brief Number of matcher callbacks and folds that changed the graph, for passes derived
+    /// from GraphRewriteBase, and 0 for other passes
+    size_t rewrites;
+};
+
 class NGRAPH_API ngraph::pass::Manager
 {
 public:
@@ -63,6 +86,21 @@ public:
     /// each registered pass
     /// \param new_state Value "true" enables Validate pass run; "false", otherwise
     void set_per_pass_validation(bool new_state) { m_per_pass_validation = new_state; }
+    /// \brief Set flag to enable/disable collecting a PassProfile for each pass that is run.
+    /// Profiling is also enabled by the NGRAPH_PROFILE_PASS_ENABLE environment variable, which
+    /// prints the profiles to stdout as well.
+    void set_pass_profiling(bool new_state) { m_profile = new_state; }
+    /// \brief The profiles of the passes run by the last call to run_passes, in order
+    ///
+    /// Each pass is also recorded as an ngraph::event::Duration with the profile as its args, so
+    /// it shows up in the Chrome trace when NGRAPH_ENABLE_TRACING is set.
+    const std::vector<PassProfile>& get_pass_profiles() const { return m_pass_profiles; }
+
+    using ProfileCallback = std::function<void(const PassProfile&)>;
+    /// \brief Sets a callback receiving the profile of every pass run by any Manager, such as
+    /// the managers a backend creates while compiling, and enables profiling in all of them.
+    /// An empty callback removes it. The callback is called on the thread running the passes.
+    static void set_profile_callback(ProfileCallback callback);
 
 private:
     template <typename T, class... Args>
@@ -90,9 +128,11 @@ private:
 
     std::vector<std::string> m_pass_names;
     std::vector<std::shared_ptr<PassBase>> m_pass_list;
+    std::vector<PassProfile> m_pass_profiles;
     ManagerState m_state;
     PassConfig m_pass_config;
     bool m_visualize = false;
     bool m_serialize = false;
     bool m_per_pass_validation = true;
+    bool m_profile = false;
 };
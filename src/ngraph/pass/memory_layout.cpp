@@ -14,8 +14,11 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <exception>
+#include <numeric>
 #include <sstream>
+#include <unordered_map>
 
 #include "ngraph/log.hpp"
 #include "ngraph/op/concat.hpp"
@@ -28,9 +31,12 @@
 using namespace std;
 using namespace ngraph;
 
-pass::MemoryLayout::MemoryLayout(size_t alignment, bool disable_memory_sharing)
+pass::MemoryLayout::MemoryLayout(size_t alignment,
+                                 bool disable_memory_sharing,
+                                 MemoryManager::allocation_scheme scheme)
     : m_alignment(alignment)
     , m_disable_memory_sharing(disable_memory_sharing)
+    , m_scheme(disable_memory_sharing ? MemoryManager::allocation_scheme::NO_REUSE : scheme)
 {
     if (m_alignment == 0)
     {
@@ -38,45 +44,104 @@ pass::MemoryLayout::MemoryLayout(size_t alignment, bool disable_memory_sharing)
     }
 }
 
-bool pass::MemoryLayout::run_on_function(shared_ptr<Function> function)
+// Finds the outputs of `node` that can be computed in place of one of its inputs
+static void get_in_place_outputs(const shared_ptr<Node>& node,
+                                 bool disable_memory_sharing,
+                                 map<descriptor::Tensor*, descriptor::Tensor*>& in_place_outputs,
+                                 set<const descriptor::Tensor*>& reused_inputs)
 {
-    MemoryManager mm(m_alignment, m_disable_memory_sharing);
-    for (shared_ptr<Node> node : function->get_ordered_ops())
+    if (node->is_op())
     {
-        std::map<descriptor::Tensor*, descriptor::Tensor*> in_place_outputs;
-        std::set<const descriptor::Tensor*> reused_inputs;
-
-        if (node->is_op())
+        auto op = std::static_pointer_cast<op::Op>(node);
+        // concat and slice in_place_oi should be treated differently
+        if (!is_type<op::v0::Concat>(node) && !is_type<op::v0::Slice>(node))
         {
-            auto op = std::static_pointer_cast<op::Op>(node);
-            // concat and slice in_place_oi should be treated differently
-            if (!is_type<op::v0::Concat>(node) && !is_type<op::v0::Slice>(node))
+            if (auto op_annotations = op->get_op_annotations())
             {
-                if (auto op_annotations = op->get_op_annotations())
+                for (auto oi_pair : op_annotations->get_in_place_oi_pairs())
                 {
-                    for (auto oi_pair : op_annotations->get_in_place_oi_pairs())
+                    auto output = &node->output(oi_pair.output).get_tensor();
+                    auto input = &node->get_input_tensor(oi_pair.input);
+                    auto input_node = node->get_input_node_ptr(oi_pair.input);
+
+                    // For destructive kernel, this should be the last use
+                    // Non-destructive kernels can pass through if memory sharing is disabled
+                    if ((node->liveness_free_list.count(input) != 0 ||
+                         (disable_memory_sharing && !oi_pair.destructive &&
+                          !input_node->is_parameter() && !input_node->is_constant())) &&
+                        node->liveness_new_list.count(output) != 0)
+
                     {
-                        auto output = &node->output(oi_pair.output).get_tensor();
-                        auto input = &node->get_input_tensor(oi_pair.input);
-                        auto input_node = node->get_input_node_ptr(oi_pair.input);
-
-                        // For destructive kernel, this should be the last use
-                        // Non-destructive kernels can pass through if memory sharing is disabled
-                        if ((node->liveness_free_list.count(input) != 0 ||
-                             (m_disable_memory_sharing && !oi_pair.destructive &&
-                              !input_node->is_parameter() && !input_node->is_constant())) &&
-                            node->liveness_new_list.count(output) != 0)
-
-                        {
-                            NGRAPH_DEBUG << "Reusing " << input->get_name() << " for "
-                                         << output->get_name();
-                            in_place_outputs.insert({output, input});
-                            reused_inputs.insert(input);
-                        }
+                        NGRAPH_DEBUG << "Reusing " << input->get_name() << " for "
+                                     << output->get_name();
+                        in_place_outputs.insert({output, input});
+                        reused_inputs.insert(input);
                     }
                 }
             }
         }
+    }
+}
+
+bool pass::MemoryLayout::run_on_function(shared_ptr<Function> function)
+{
+    MemoryManager mm(m_alignment, m_scheme);
+    if (m_scheme == MemoryManager::allocation_scheme::GREEDY_BY_SIZE)
+    {
+        // Collect the live range of every buffer first. A tensor computed in place shares the
+        // buffer of its input, which then lives until the tensor's last use.
+        vector<MemoryManager::interval> intervals;
+        unordered_map<const descriptor::Tensor*, size_t> buffer_index;
+        vector<pair<descriptor::Tensor*, size_t>> tensor_buffers;
+        size_t position = 0;
+        for (shared_ptr<Node> node : function->get_ordered_ops())
+        {
+            map<descriptor::Tensor*, descriptor::Tensor*> in_place_outputs;
+            set<const descriptor::Tensor*> reused_inputs;
+            get_in_place_outputs(node, m_disable_memory_sharing, in_place_outputs, reused_inputs);
+
+            for (descriptor::Tensor* tensor : node->liveness_new_list)
+            {
+                size_t index;
+                auto it = in_place_outputs.find(tensor);
+                if (it != in_place_outputs.end())
+                {
+                    index = buffer_index.at(it->second);
+                }
+                else
+                {
+                    index = intervals.size();
+                    intervals.push_back({tensor->size(), position, position});
+                }
+                buffer_index[tensor] = index;
+                tensor_buffers.push_back({tensor, index});
+            }
+            for (const descriptor::Tensor* tensor : node->liveness_free_list)
+            {
+                auto it = buffer_index.find(tensor);
+                if (reused_inputs.count(tensor) == 0 && it != buffer_index.end())
+                {
+                    MemoryManager::interval& range = intervals[it->second];
+                    range.last_use = max(range.last_use, position);
+                }
+            }
+            position++;
+        }
+
+        vector<size_t> offsets = mm.allocate(intervals);
+        for (const pair<descriptor::Tensor*, size_t>& tensor_buffer : tensor_buffers)
+        {
+            tensor_buffer.first->set_pool_offset(offsets[tensor_buffer.second]);
+        }
+        function->set_temporary_pool_size(mm.max_allocated());
+        return false;
+    }
+
+    for (shared_ptr<Node> node : function->get_ordered_ops())
+    {
+        std::map<descriptor::Tensor*, descriptor::Tensor*> in_place_outputs;
+        std::set<const descriptor::Tensor*> reused_inputs;
+        get_in_place_outputs(node, m_disable_memory_sharing, in_place_outputs, reused_inputs);
 
         for (descriptor::Tensor* tensor : node->liveness_new_list)
         {
@@ -120,6 +185,18 @@ pass::MemoryManager::MemoryManager(size_t alignment, bool disable_memory_reuse)
     m_node_list.emplace_back(numeric_limits<size_t>::max(), block_state::FREE);
 }
 
+pass::MemoryManager::MemoryManager(size_t alignment, allocation_scheme scheme)
+    : m_alignment{alignment}
+    , m_scheme{scheme}
+    , m_max_allocated{0}
+{
+    if (m_alignment == 0)
+    {
+        throw invalid_argument("Memory alignment must be > 0");
+    }
+    m_node_list.emplace_back(numeric_limits<size_t>::max(), block_state::FREE);
+}
+
 size_t pass::MemoryManager::allocate(size_t size)
 {
     size_t rc = 0;
@@ -128,10 +205,102 @@ size_t pass::MemoryManager::allocate(size_t size)
     case allocation_scheme::FIRST_FIT: rc = first_fit(size); break;
     case allocation_scheme::BEST_FIT: rc = best_fit(size); break;
     case allocation_scheme::NO_REUSE: rc = no_reuse_allocator(size); break;
+    case allocation_scheme::GREEDY_BY_SIZE:
+        throw invalid_argument("GREEDY_BY_SIZE needs all live ranges, use allocate(intervals)");
     }
     return rc;
 }
 
+vector<size_t> pass::MemoryManager::allocate(const vector<interval>& intervals)
+{
+    if (m_scheme == allocation_scheme::GREEDY_BY_SIZE)
+    {
+        return greedy_by_size(intervals);
+    }
+
+    // Replay the live ranges in execution order: allocations of a position come before the
+    // frees so a buffer never overlaps another one used at the same position
+    vector<size_t> offsets(intervals.size());
+    vector<size_t> by_first(intervals.size());
+    vector<size_t> by_last(intervals.size());
+    iota(by_first.begin(), by_first.end(), 0);
+    iota(by_last.begin(), by_last.end(), 0);
+    stable_sort(by_first.begin(), by_first.end(), [&](size_t a, size_t b) {
+        return intervals[a].first_use < intervals[b].first_use;
+    });
+    stable_sort(by_last.begin(), by_last.end(), [&](size_t a, size_t b) {
+        return intervals[a].last_use < intervals[b].last_use;
+    });
+    auto last_it = by_last.begin();
+    for (auto first_it = by_first.begin(); first_it != by_first.end(); ++first_it)
+    {
+        size_t position = intervals[*first_it].first_use;
+        while (last_it != by_last.end() && intervals[*last_it].last_use < position)
+        {
+            if (m_scheme != allocation_scheme::NO_REUSE)
+            {
+                free(offsets[*last_it]);
+            }
+            ++last_it;
+        }
+        offsets[*first_it] = allocate(intervals[*first_it].size);
+    }
+    return offsets;
+}
+
+vector<size_t> pass::MemoryManager::greedy_by_size(const vector<interval>& intervals)
+{
+    vector<size_t> offsets(intervals.size());
+    vector<size_t> order(intervals.size());
+    iota(order.begin(), order.end(), 0);
+    stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return intervals[a].size > intervals[b].size;
+    });
+
+    // Buffers placed so far, sorted by offset
+    vector<size_t> placed;
+    for (size_t index : order)
+    {
+        const interval& current = intervals[index];
+        size_t size = align(current.size, m_alignment);
+        size_t best_offset = 0;
+        size_t best_gap = numeric_limits<size_t>::max();
+        size_t gap_start = 0;
+        for (size_t other_index : placed)
+        {
+            const interval& other = intervals[other_index];
+            if (other.last_use < current.first_use || current.last_use < other.first_use)
+            {
+                continue;
+            }
+            size_t other_offset = offsets[other_index];
+            if (other_offset >= gap_start)
+            {
+                size_t gap = other_offset - gap_start;
+                if (gap >= size && gap < best_gap)
+                {
+                    best_gap = gap;
+                    best_offset = gap_start;
+                }
+            }
+            gap_start = max(gap_start, other_offset + align(other.size, m_alignment));
+        }
+        if (best_gap == numeric_limits<size_t>::max())
+        {
+            best_offset = gap_start;
+        }
+        offsets[index] = best_offset;
+        m_max_allocated = max(m_max_allocated, best_offset + size);
+
+        auto it = upper_bound(
+            placed.begin(), placed.end(), best_offset, [&](size_t offset, size_t i) {
+                return offset < offsets[i];
+            });
+        placed.insert(it, index);
+    }
+    return offsets;
+}
+
 size_t pass::MemoryManager::no_reuse_allocator(size_t size)
 {
     size_t offset = m_max_allocated;
@@ -19,6 +19,7 @@
 #include <limits>
 #include <list>
 #include <sstream>
+#include <vector>
 
 #include "ngraph/pass/pass.hpp"
 
@@ -32,17 +33,6 @@ namespace ngraph
     }
 }
 
-class NGRAPH_API ngraph::pass::MemoryLayout : public FunctionPass
-{
-public:
-    MemoryLayout(size_t alignment = 1, bool disable_memory_sharing = false);
-    bool run_on_function(std::shared_ptr<ngraph::Function>) override;
-
-private:
-    size_t m_alignment;
-    bool m_disable_memory_sharing;
-};
-
 class NGRAPH_API ngraph::pass::MemoryManager
 {
 public:
@@ -56,7 +46,19 @@ public:
     {
         FIRST_FIT,
         BEST_FIT,
-        NO_REUSE
+        NO_REUSE,
+        /// Offline: buffers are placed largest first, each at the offset leaving the smallest
+        /// gap among the buffers already placed whose live ranges intersect its own
+        GREEDY_BY_SIZE
+    };
+
+    /// \brief Live range of a buffer for offline planning. first_use and last_use are
+    ///        inclusive positions in execution order.
+    struct interval
+    {
+        size_t size;
+        size_t first_use;
+        size_t last_use;
     };
 
     class node
@@ -70,11 +72,19 @@ public:
     };
 
     MemoryManager(size_t alignment = 1, bool disable_reuse = false);
+    MemoryManager(size_t alignment, allocation_scheme scheme);
     // memory_manager& alignment(size_t a);
 
     size_t allocate(size_t size);
     void free(size_t offset);
 
+    /// \brief Assigns offsets to all buffers at once. GREEDY_BY_SIZE needs the whole set of
+    ///        live ranges; the other schemes replay them through allocate() and free().
+    /// \return The offset of each buffer, in the order of `intervals`
+    std::vector<size_t> allocate(const std::vector<interval>& intervals);
+
+    allocation_scheme get_scheme() const { return m_scheme; }
+
     void dump(std::ostream&);
 
     static size_t align(size_t x, size_t alignment);
@@ -90,9 +100,25 @@ private:
     size_t first_fit(size_t size);
     size_t best_fit(size_t size);
     size_t no_reuse_allocator(size_t size);
+    std::vector<size_t> greedy_by_size(const std::vector<interval>& intervals);
 
     std::list<node> m_node_list;
     size_t m_alignment;
     allocation_scheme m_scheme;
     size_t m_max_allocated;
 };
+
+class NGRAPH_API ngraph::pass::MemoryLayout : public FunctionPass
+{
+public:
+    MemoryLayout(size_t alignment = 1,
+                 bool disable_memory_sharing = false,
+                 MemoryManager::allocation_scheme scheme =
+                     MemoryManager::allocation_scheme::FIRST_FIT);
+    bool run_on_function(std::shared_ptr<ngraph::Function>) override;
+
+private:
+    size_t m_alignment;
+    bool m_disable_memory_sharing;
+    MemoryManager::allocation_scheme m_scheme;
+};
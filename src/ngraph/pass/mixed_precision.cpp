@@ -0,0 +1,255 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <map>
+
+#include "ngraph/function.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/convert.hpp"
+#include "ngraph/pass/mixed_precision.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static const string s_allow_prefix = "MixedPrecision::Allow::";
+static const string s_deny_prefix = "MixedPrecision::Deny::";
+
+const set<string>& pass::MixedPrecision::get_default_allow_list()
+{
+    static const set<string> allow{"BatchMatMul",
+                                   "Convolution",
+                                   "ConvolutionBackpropData",
+                                   "ConvolutionBias",
+                                   "Dot",
+                                   "GroupConvolution",
+                                   "MatMul"};
+    return allow;
+}
+
+const set<string>& pass::MixedPrecision::get_default_deny_list()
+{
+    static const set<string> deny{"BatchNormInference",
+                                  "BatchNormTraining",
+                                  "Exp",
+                                  "LayerNorm",
+                                  "Log",
+                                  "LRN",
+                                  "MVN",
+                                  "NormalizeL2",
+                                  "Power",
+                                  "Product",
+                                  "ReduceMean",
+                                  "ReduceProd",
+                                  "ReduceSum",
+                                  "Softmax",
+                                  "Sum"};
+    return deny;
+}
+
+const set<string>& pass::MixedPrecision::get_neutral_list()
+{
+    static const set<string> neutral{"Abs",
+                                     "Add",
+                                     "AvgPool",
+                                     "Broadcast",
+                                     "Clamp",
+                                     "Concat",
+                                     "Maximum",
+                                     "MaxPool",
+                                     "Minimum",
+                                     "Multiply",
+                                     "Negative",
+                                     "Pad",
+                                     "Relu",
+                                     "Reshape",
+                                     "Reverse",
+                                     "Slice",
+                                     "Squeeze",
+                                     "StridedSlice",
+                                     "Subtract",
+                                     "Transpose",
+                                     "Unsqueeze"};
+    return neutral;
+}
+
+pass::MixedPrecision::MixedPrecision(const PassConfig& pass_config)
+    : m_low_precision_type(pass_config.get_pass_attribute("MixedPrecision::BF16") ? element::bf16
+                                                                                   : element::f16)
+    , m_allow(get_default_allow_list())
+    , m_deny(get_default_deny_list())
+{
+    for (auto& attribute : pass_config.get_pass_attributes())
+    {
+        const string& name = attribute.first;
+        set<string>* list = nullptr;
+        string type_name;
+        if (name.compare(0, s_allow_prefix.size(), s_allow_prefix) == 0)
+        {
+            list = &m_allow;
+            type_name = name.substr(s_allow_prefix.size());
+        }
+        else if (name.compare(0, s_deny_prefix.size(), s_deny_prefix) == 0)
+        {
+            list = &m_deny;
+            type_name = name.substr(s_deny_prefix.size());
+        }
+        else
+        {
+            continue;
+        }
+        if (attribute.second)
+        {
+            list->insert(type_name);
+        }
+        else
+        {
+            list->erase(type_name);
+        }
+    }
+}
+
+pass::MixedPrecision::MixedPrecision(const element::Type& low_precision_type,
+                                     const set<string>& allow,
+                                     const set<string>& deny)
+    : m_low_precision_type(low_precision_type)
+    , m_allow(allow)
+    , m_deny(deny)
+{
+    NGRAPH_CHECK(low_precision_type == element::f16 || low_precision_type == element::bf16,
+                 "MixedPrecision converts to f16 or bf16, not ",
+                 low_precision_type);
+}
+
+bool pass::MixedPrecision::run_on_function(shared_ptr<Function> function)
+{
+    m_converted_node_count = 0;
+    m_convert_count = 0;
+
+    // Converts are shared by every consumer of a producer output on the same side of a boundary
+    map<pair<Node*, size_t>, Output<Node>> to_low;
+    map<pair<Node*, size_t>, Output<Node>> to_f32;
+    map<Node*, shared_ptr<Node>> low_constants;
+
+    auto is_low = [&](const Output<Node>& output) {
+        return output.get_element_type() == m_low_precision_type;
+    };
+    auto is_f32_constant = [](const Output<Node>& output) {
+        return output.get_element_type() == element::f32 && output.get_node()->is_constant();
+    };
+
+    for (auto node : function->get_ordered_ops())
+    {
+        if (node->is_parameter() || node->is_constant() || node->get_input_size() == 0)
+        {
+            continue;
+        }
+
+        const string type_name = node->get_type_name();
+        bool has_float_input = false;
+        bool any_low = false;
+        bool all_low_or_constant = true;
+        for (auto& input : node->inputs())
+        {
+            Output<Node> source = input.get_source_output();
+            if (is_low(source))
+            {
+                has_float_input = true;
+                any_low = true;
+            }
+            else if (source.get_element_type() == element::f32)
+            {
+                has_float_input = true;
+                all_low_or_constant = all_low_or_constant && is_f32_constant(source);
+            }
+        }
+        if (!has_float_input)
+        {
+            continue;
+        }
+
+        bool run_low = false;
+        if (m_deny.count(type_name) == 0)
+        {
+            if (m_allow.count(type_name) != 0)
+            {
+                run_low = true;
+            }
+            else if (get_neutral_list().count(type_name) != 0)
+            {
+                run_low = any_low && all_low_or_constant;
+            }
+        }
+
+        bool changed = false;
+        for (auto& input : node->inputs())
+        {
+            Output<Node> source = input.get_source_output();
+            auto key = make_pair(source.get_node(), source.get_index());
+            if (run_low && source.get_element_type() == element::f32)
+            {
+                if (source.get_node()->is_constant())
+                {
+                    auto& low_constant = low_constants[source.get_node()];
+                    if (!low_constant)
+                    {
+                        auto constant = as_type_ptr<op::v0::Constant>(source.get_node_shared_ptr());
+                        low_constant = op::v0::Constant::create(m_low_precision_type,
+                                                                constant->get_output_shape(0),
+                                                                constant->cast_vector<float>());
+                        low_constant->set_friendly_name(constant->get_friendly_name());
+                    }
+                    input.replace_source_output(low_constant);
+                }
+                else
+                {
+                    auto it = to_low.find(key);
+                    if (it == to_low.end())
+                    {
+                        auto convert =
+                            make_shared<op::v0::Convert>(source, m_low_precision_type);
+                        it = to_low.insert({key, convert->output(0)}).first;
+                        m_convert_count++;
+                    }
+                    input.replace_source_output(it->second);
+                }
+                changed = true;
+            }
+            else if (!run_low && is_low(source))
+            {
+                auto it = to_f32.find(key);
+                if (it == to_f32.end())
+                {
+                    auto convert = make_shared<op::v0::Convert>(source, element::f32);
+                    it = to_f32.insert({key, convert->output(0)}).first;
+                    m_convert_count++;
+                }
+                input.replace_source_output(it->second);
+                changed = true;
+            }
+        }
+
+        if (changed || run_low)
+        {
+            node->revalidate_and_infer_types();
+        }
+        if (run_low)
+        {
+            m_converted_node_count++;
+        }
+    }
+
+    return m_converted_node_count > 0;
+}
@@ -0,0 +1,81 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <set>
+#include <string>
+
+#include "ngraph/pass/pass.hpp"
+#include "ngraph/pass/pass_config.hpp"
+#include "ngraph/type/element_type.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class MixedPrecision;
+    }
+}
+
+/// \brief Runs compute bound f32 ops in f16 or bf16 and keeps numerically sensitive ops in f32.
+///
+/// Ops are classified by type name:
+///  - allowed ops (Convolution, Dot, MatMul, ...) are always converted,
+///  - denied ops (Softmax, LayerNorm, reductions, Exp, ...) always stay in f32,
+///  - neutral elementwise and data movement ops (Relu, Add, Reshape, MaxPool, ...) stay in low
+///    precision when every floating point input already is, so a chain of converted ops does
+///    not round trip through f32,
+///  - everything else stays in f32.
+///
+/// A Convert is inserted once per producer output at each precision boundary and f32 Constants
+/// feeding converted ops are replaced by low precision Constants, so no Convert is needed for
+/// weights. Results are converted back so the function signature is unchanged.
+///
+/// The policy can be changed through PassConfig attributes:
+///  - "MixedPrecision::BF16" selects bf16 instead of f16,
+///  - "MixedPrecision::Allow::<type name>" adds (=1) or removes (=0) an allowed op,
+///  - "MixedPrecision::Deny::<type name>" adds (=1) or removes (=0) a denied op.
+/// Deny wins over allow.
+class NGRAPH_API ngraph::pass::MixedPrecision : public FunctionPass
+{
+public:
+    MixedPrecision(const PassConfig& pass_config = PassConfig());
+    MixedPrecision(const element::Type& low_precision_type,
+                   const std::set<std::string>& allow,
+                   const std::set<std::string>& deny);
+
+    bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+
+    const element::Type& get_low_precision_type() const { return m_low_precision_type; }
+    const std::set<std::string>& get_allow_list() const { return m_allow; }
+    const std::set<std::string>& get_deny_list() const { return m_deny; }
+    /// \brief Number of nodes whose outputs were converted to low precision by the last run.
+    size_t get_converted_node_count() const { return m_converted_node_count; }
+    /// \brief Number of Convert ops inserted by the last run.
+    size_t get_convert_count() const { return m_convert_count; }
+
+    static const std::set<std::string>& get_default_allow_list();
+    static const std::set<std::string>& get_default_deny_list();
+    static const std::set<std::string>& get_neutral_list();
+
+private:
+    element::Type m_low_precision_type;
+    std::set<std::string> m_allow;
+    std::set<std::string> m_deny;
+    size_t m_converted_node_count{0};
+    size_t m_convert_count{0};
+};
@@ -14,12 +14,153 @@
 // limitations under the License.
 //*****************************************************************************
 
-#include "ngraph/pass/pass_util.hpp"
+#include <cstring>
+
+#include "ngraph/attribute_visitor.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/pass/pass_util.hpp"
 
 using namespace std;
 using namespace ngraph;
 
+namespace
+{
+    // Writes the attributes of a node into a string, so that two nodes of the same type can be
+    // compared. Attributes that can only be reached through ValueAccessor<void> make the key
+    // invalid.
+    class AttributeKeyVisitor : public AttributeVisitor
+    {
+    public:
+        AttributeKeyVisitor() { m_key << hexfloat; }
+        using AttributeVisitor::on_adapter;
+        void on_adapter(const string& /* name */, ValueAccessor<void>& /* adapter */) override
+        {
+            m_valid = false;
+        }
+        void on_adapter(const string& name, ValueAccessor<string>& adapter) override
+        {
+            m_key << name << "=" << adapter.get() << ";";
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<string>>& adapter) override
+        {
+            m_key << name << "=[";
+            for (auto& value : adapter.get())
+            {
+                m_key << value << ",";
+            }
+            m_key << "];";
+        }
+        void on_adapter(const string& name, ValueAccessor<bool>& adapter) override
+        {
+            add(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<int8_t>& adapter) override
+        {
+            add(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<int16_t>& adapter) override
+        {
+            add(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<int32_t>& adapter) override
+        {
+            add(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<int64_t>& adapter) override
+        {
+            add(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<uint8_t>& adapter) override
+        {
+            add(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<uint16_t>& adapter) override
+        {
+            add(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<uint32_t>& adapter) override
+        {
+            add(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<uint64_t>& adapter) override
+        {
+            add(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<float>& adapter) override
+        {
+            add(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<double>& adapter) override
+        {
+            add(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int8_t>>& adapter) override
+        {
+            add_vector(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int16_t>>& adapter) override
+        {
+            add_vector(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int32_t>>& adapter) override
+        {
+            add_vector(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<int64_t>>& adapter) override
+        {
+            add_vector(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<uint8_t>>& adapter) override
+        {
+            add_vector(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<uint16_t>>& adapter) override
+        {
+            add_vector(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<uint32_t>>& adapter) override
+        {
+            add_vector(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<uint64_t>>& adapter) override
+        {
+            add_vector(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<float>>& adapter) override
+        {
+            add_vector(name, adapter);
+        }
+        void on_adapter(const string& name, ValueAccessor<vector<double>>& adapter) override
+        {
+            add_vector(name, adapter);
+        }
+
+        bool is_valid() const { return m_valid; }
+        string get_key() const { return m_key.str(); }
+
+    private:
+        // Unary plus prints 8 bit integers as numbers rather than characters
+        template <typename T>
+        void add(const string& name, ValueAccessor<T>& adapter)
+        {
+            m_key << name << "=" << +adapter.get() << ";";
+        }
+        template <typename T>
+        void add_vector(const string& name, ValueAccessor<vector<T>>& adapter)
+        {
+            m_key << name << "=[";
+            for (auto value : adapter.get())
+            {
+                m_key << +value << ",";
+            }
+            m_key << "];";
+        }
+
+        ostringstream m_key;
+        bool m_valid{true};
+    };
+}
+
 std::function<bool(Output<Node>)> ngraph::pass::get_no_fan_out_function()
 {
     auto ret_fun = [](Output<Node> n) {
@@ -39,3 +180,42 @@ std::function<bool(Output<Node>)> ngraph::pass::get_no_fan_out_function()
 
     return ret_fun;
 }
+
+bool ngraph::pass::get_attribute_key(Node& node, string& key)
+{
+    AttributeKeyVisitor visitor;
+    if (!node.visit_attributes(visitor) || !visitor.is_valid())
+    {
+        return false;
+    }
+    key = visitor.get_key();
+    return true;
+}
+
+size_t ngraph::pass::constant_byte_size(const op::v0::Constant& constant)
+{
+    size_t bits = shape_size(constant.get_output_shape(0)) *
+                  constant.get_output_element_type(0).bitwidth();
+    return (bits + 7) / 8;
+}
+
+bool ngraph::pass::constants_equal(const op::v0::Constant& a, const op::v0::Constant& b)
+{
+    return &a == &b ||
+           (a.get_output_element_type(0) == b.get_output_element_type(0) &&
+            a.get_output_shape(0) == b.get_output_shape(0) &&
+            memcmp(a.get_data_ptr(), b.get_data_ptr(), constant_byte_size(a)) == 0);
+}
+
+// FNV-1a over the constant's bytes
+size_t ngraph::pass::hash_constant(const op::v0::Constant& constant)
+{
+    uint64_t hash = 14695981039346656037ULL;
+    const unsigned char* data = static_cast<const unsigned char*>(constant.get_data_ptr());
+    size_t size = constant_byte_size(constant);
+    for (size_t i = 0; i < size; i++)
+    {
+        hash = (hash ^ data[i]) * 1099511628211ULL;
+    }
+    return static_cast<size_t>(hash);
+}
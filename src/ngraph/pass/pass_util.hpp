@@ -25,11 +25,31 @@
 #include <string>
 
 #include "ngraph/node.hpp"
+#include "ngraph/op/constant.hpp"
 
 namespace ngraph
 {
     namespace pass
     {
         std::function<bool(Output<Node>)> get_no_fan_out_function();
+
+        /// \brief Writes the attributes of \p node into \p key. Two nodes of the same type get
+        /// the same key exactly when their attributes are equal.
+        /// \returns false, leaving \p key unchanged, if some attribute of \p node cannot be
+        /// visited
+        NGRAPH_API
+        bool get_attribute_key(Node& node, std::string& key);
+
+        /// \brief The number of bytes of data held by \p constant
+        NGRAPH_API
+        size_t constant_byte_size(const op::v0::Constant& constant);
+
+        /// \brief True if \p a and \p b have the same type, shape and data
+        NGRAPH_API
+        bool constants_equal(const op::v0::Constant& a, const op::v0::Constant& b);
+
+        /// \brief A hash of the data of \p constant
+        NGRAPH_API
+        size_t hash_constant(const op::v0::Constant& constant);
     }
 }
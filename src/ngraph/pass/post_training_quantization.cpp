@@ -0,0 +1,343 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cmath>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/dequantize.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/matmul.hpp"
+#include "ngraph/op/max.hpp"
+#include "ngraph/op/min.hpp"
+#include "ngraph/op/quantize.hpp"
+#include "ngraph/op/quantized_convolution.hpp"
+#include "ngraph/op/quantized_dot.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/pass/post_training_quantization.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    struct QuantizationParams
+    {
+        float scale;
+        int zero_point;
+    };
+
+    bool is_static_f32(const Output<Node>& output)
+    {
+        return output.get_element_type() == element::f32 && output.get_partial_shape().is_static();
+    }
+
+    // The interpreter and CPU quantized dot kernels only reduce over a single axis.
+    bool is_quantizable(const shared_ptr<Node>& node)
+    {
+        if (node->get_input_size() != 2 || node->get_output_size() != 1 ||
+            !is_static_f32(node->input_value(0)) || !is_static_f32(node->input_value(1)) ||
+            !is_static_f32(node->output(0)))
+        {
+            return false;
+        }
+        if (is_type<op::v0::Convolution>(node) || is_type<op::v1::Convolution>(node))
+        {
+            return true;
+        }
+        if (auto dot = as_type_ptr<op::v0::Dot>(node))
+        {
+            return dot->get_reduction_axes_count() == 1 &&
+                   dot->get_input_shape(0).size() >= 1 && dot->get_input_shape(1).size() >= 1;
+        }
+        if (auto matmul = as_type_ptr<op::v0::MatMul>(node))
+        {
+            return !matmul->get_transpose_a() && !matmul->get_transpose_b() &&
+                   matmul->get_input_shape(0).size() == 2 &&
+                   matmul->get_input_shape(1).size() == 2;
+        }
+        return false;
+    }
+
+    // The inputs whose ranges come from calibration rather than from constant data.
+    vector<Output<Node>> calibrated_outputs(const shared_ptr<Node>& node)
+    {
+        vector<Output<Node>> outputs{node->input_value(0)};
+        if (!node->input_value(1).get_node()->is_constant())
+        {
+            outputs.push_back(node->input_value(1));
+        }
+        outputs.push_back(node->output(0));
+        return outputs;
+    }
+
+    // Activations keep their full range by placing real 0 on an exact u8 level.
+    QuantizationParams get_u8_params(const pair<float, float>& range)
+    {
+        float low = min(range.first, 0.0f);
+        float high = max(range.second, 0.0f);
+        float scale = (high - low) / 255.0f;
+        if (!(scale > 0.0f))
+        {
+            return {1.0f, 0};
+        }
+        int zero_point = static_cast<int>(std::nearbyint(-low / scale));
+        return {scale, max(0, min(255, zero_point))};
+    }
+
+    QuantizationParams get_i8_params(const pair<float, float>& range)
+    {
+        float max_abs = max(std::fabs(range.first), std::fabs(range.second));
+        return {max_abs > 0.0f ? max_abs / 127.0f : 1.0f, 0};
+    }
+
+    shared_ptr<Node> make_scale(const QuantizationParams& params)
+    {
+        return op::v0::Constant::create(element::f32, Shape{}, {params.scale});
+    }
+
+    shared_ptr<Node> make_zero_point(const element::Type& type, const QuantizationParams& params)
+    {
+        return op::v0::Constant::create(type, Shape{}, {params.zero_point});
+    }
+
+    Output<Node> quantize(const Output<Node>& input,
+                          const element::Type& type,
+                          const QuantizationParams& params)
+    {
+        return make_shared<op::v0::Quantize>(
+            input,
+            make_scale(params),
+            make_zero_point(type, params),
+            type,
+            AxisSet{},
+            op::v0::Quantize::RoundMode::ROUND_NEAREST_TOWARD_EVEN);
+    }
+
+    // Constant weights are quantized here rather than through a Quantize node so that the
+    // rewritten function carries i8 weights without needing another folding pass.
+    shared_ptr<Node> quantize_constant(const op::v0::Constant& constant,
+                                       const QuantizationParams& params)
+    {
+        vector<float> values = constant.get_vector<float>();
+        vector<int8_t> quantized(values.size());
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            float q = std::nearbyint(values[i] / params.scale);
+            quantized[i] = static_cast<int8_t>(max(-127.0f, min(127.0f, q)));
+        }
+        return op::v0::Constant::create(element::i8, constant.get_output_shape(0), quantized);
+    }
+
+    pair<float, float> get_constant_range(const op::v0::Constant& constant)
+    {
+        vector<float> values = constant.get_vector<float>();
+        if (values.empty())
+        {
+            return {0.0f, 0.0f};
+        }
+        auto range = minmax_element(values.begin(), values.end());
+        return {*range.first, *range.second};
+    }
+}
+
+string pass::calibration_key(const Output<Node>& output)
+{
+    return output.get_node()->get_name() + ":" + to_string(output.get_index());
+}
+
+pass::ActivationCalibrator::ActivationCalibrator(const shared_ptr<Function>& function,
+                                                 const shared_ptr<runtime::Backend>& backend)
+{
+    NodeMap node_map;
+    auto clone = clone_function(*function, node_map);
+    ResultVector results = clone->get_results();
+    m_original_results = results.size();
+
+    for (auto node : function->get_ordered_ops())
+    {
+        if (!is_quantizable(node))
+        {
+            continue;
+        }
+        for (const Output<Node>& output : calibrated_outputs(node))
+        {
+            string key = calibration_key(output);
+            if (find(m_keys.begin(), m_keys.end(), key) != m_keys.end())
+            {
+                continue;
+            }
+            Output<Node> cloned(node_map.at(output.get_node()), output.get_index());
+            AxisSet axes;
+            for (size_t i = 0; i < output.get_shape().size(); ++i)
+            {
+                axes.insert(i);
+            }
+            results.push_back(make_shared<op::v0::Result>(make_shared<op::v0::Min>(cloned, axes)));
+            results.push_back(make_shared<op::v0::Result>(make_shared<op::v0::Max>(cloned, axes)));
+            m_keys.push_back(key);
+        }
+    }
+
+    auto calibration = make_shared<Function>(results, clone->get_parameters());
+    m_executable = backend->compile(calibration);
+    for (auto& result : results)
+    {
+        m_outputs.push_back(backend->create_tensor(result->get_output_element_type(0),
+                                                   result->get_output_shape(0)));
+    }
+}
+
+void pass::ActivationCalibrator::run(const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    m_executable->call_with_validate(m_outputs, inputs);
+
+    for (size_t i = 0; i < m_keys.size(); ++i)
+    {
+        float low;
+        float high;
+        m_outputs.at(m_original_results + 2 * i)->read(&low, sizeof(low));
+        m_outputs.at(m_original_results + 2 * i + 1)->read(&high, sizeof(high));
+
+        auto it = m_table.find(m_keys[i]);
+        if (it == m_table.end())
+        {
+            m_table.insert({m_keys[i], {low, high}});
+        }
+        else
+        {
+            it->second.first = min(it->second.first, low);
+            it->second.second = max(it->second.second, high);
+        }
+    }
+    m_sample_count++;
+}
+
+bool pass::PostTrainingQuantization::run_on_function(shared_ptr<Function> function)
+{
+    m_quantized_count = 0;
+
+    for (auto node : function->get_ordered_ops())
+    {
+        if (!is_quantizable(node))
+        {
+            continue;
+        }
+
+        auto data_range = m_table.find(calibration_key(node->input_value(0)));
+        auto output_range = m_table.find(calibration_key(node->output(0)));
+        if (data_range == m_table.end() || output_range == m_table.end())
+        {
+            continue;
+        }
+
+        QuantizationParams data_params = get_u8_params(data_range->second);
+        QuantizationParams output_params = get_i8_params(output_range->second);
+        QuantizationParams weight_params;
+        Output<Node> weights;
+        if (auto constant = as_type_ptr<op::v0::Constant>(node->get_input_node_shared_ptr(1)))
+        {
+            weight_params = get_i8_params(get_constant_range(*constant));
+            weights = quantize_constant(*constant, weight_params);
+        }
+        else
+        {
+            auto weight_range = m_table.find(calibration_key(node->input_value(1)));
+            if (weight_range == m_table.end())
+            {
+                continue;
+            }
+            weight_params = get_i8_params(weight_range->second);
+            weights = quantize(node->input_value(1), element::i8, weight_params);
+        }
+        Output<Node> data = quantize(node->input_value(0), element::u8, data_params);
+
+        shared_ptr<Node> quantized;
+        if (auto conv = as_type_ptr<op::v0::Convolution>(node))
+        {
+            quantized = make_shared<op::v0::QuantizedConvolution>(
+                data,
+                weights,
+                conv->get_window_movement_strides(),
+                conv->get_window_dilation_strides(),
+                conv->get_padding_below(),
+                conv->get_padding_above(),
+                conv->get_data_dilation_strides(),
+                make_scale(data_params),
+                make_zero_point(element::u8, data_params),
+                make_scale(weight_params),
+                make_zero_point(element::i8, weight_params),
+                make_scale(output_params),
+                make_zero_point(element::i8, output_params),
+                element::i8,
+                AxisSet{},
+                AxisSet{},
+                AxisSet{});
+        }
+        else if (auto conv = as_type_ptr<op::v1::Convolution>(node))
+        {
+            quantized = make_shared<op::v0::QuantizedConvolution>(
+                data,
+                weights,
+                conv->get_strides(),
+                conv->get_dilations(),
+                conv->get_pads_begin(),
+                conv->get_pads_end(),
+                Strides(conv->get_strides().size(), 1),
+                make_scale(data_params),
+                make_zero_point(element::u8, data_params),
+                make_scale(weight_params),
+                make_zero_point(element::i8, weight_params),
+                make_scale(output_params),
+                make_zero_point(element::i8, output_params),
+                element::i8,
+                AxisSet{},
+                AxisSet{},
+                AxisSet{});
+        }
+        else
+        {
+            // Dot with one reduction axis and an untransposed 2D MatMul are the same product
+            quantized =
+                make_shared<op::v0::QuantizedDot>(data,
+                                                  weights,
+                                                  1,
+                                                  make_scale(data_params),
+                                                  make_zero_point(element::u8, data_params),
+                                                  make_scale(weight_params),
+                                                  make_zero_point(element::i8, weight_params),
+                                                  make_scale(output_params),
+                                                  make_zero_point(element::i8, output_params),
+                                                  element::i8,
+                                                  AxisSet{},
+                                                  AxisSet{},
+                                                  AxisSet{});
+        }
+
+        auto dequantized =
+            make_shared<op::v0::Dequantize>(quantized,
+                                            make_scale(output_params),
+                                            make_zero_point(element::i8, output_params),
+                                            element::f32,
+                                            AxisSet{});
+        replace_node(node, dequantized);
+        m_quantized_count++;
+    }
+
+    return m_quantized_count > 0;
+}
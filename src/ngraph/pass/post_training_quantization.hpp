@@ -0,0 +1,100 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ngraph/pass/pass.hpp"
+#include "ngraph/runtime/backend.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class ActivationCalibrator;
+        class PostTrainingQuantization;
+
+        /// \brief Observed [min, max] range of each calibrated f32 output, keyed by
+        ///        calibration_key().
+        using CalibrationTable = std::map<std::string, std::pair<float, float>>;
+
+        /// \brief The key under which the range of `output` is stored in a CalibrationTable.
+        NGRAPH_API
+        std::string calibration_key(const Output<Node>& output);
+    }
+}
+
+/// \brief Collects the activation ranges that PostTrainingQuantization needs by running the
+///        original f32 function on sample data.
+///
+/// A clone of the function is compiled on `backend` with an extra scalar Min and Max result
+/// for the data inputs and the output of every Convolution, Dot and MatMul. Each call to
+/// run() executes one sample and widens the recorded ranges, so the table covers every sample
+/// seen so far.
+class NGRAPH_API ngraph::pass::ActivationCalibrator
+{
+public:
+    ActivationCalibrator(const std::shared_ptr<Function>& function,
+                         const std::shared_ptr<runtime::Backend>& backend);
+
+    /// \brief Executes the function on one sample. `inputs` are backend tensors matching the
+    ///        parameters of the original function.
+    void run(const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+
+    const CalibrationTable& get_table() const { return m_table; }
+    size_t get_sample_count() const { return m_sample_count; }
+
+private:
+    std::shared_ptr<runtime::Executable> m_executable;
+    std::vector<std::shared_ptr<runtime::Tensor>> m_outputs;
+    /// Key recorded by the Min/Max result pair starting at m_outputs[m_original_results + 2i].
+    std::vector<std::string> m_keys;
+    size_t m_original_results;
+    size_t m_sample_count{0};
+    CalibrationTable m_table;
+};
+
+/// \brief Rewrites f32 Convolution, Dot and MatMul nodes into their int8 quantized forms using
+///        the ranges recorded by an ActivationCalibrator.
+///
+/// Activations are quantized to u8 with a zero point so that one sided ranges (e.g. after a
+/// Relu) keep all 256 levels, Constant weights are quantized to symmetric i8 in place and the
+/// result is requantized to symmetric i8 from the calibrated output range and dequantized back
+/// to f32, so the rewritten function is a drop in replacement for the original. Nodes whose
+/// ranges are missing from the table, or whose shapes the quantized ops do not support, are
+/// left in f32.
+class NGRAPH_API ngraph::pass::PostTrainingQuantization : public FunctionPass
+{
+public:
+    PostTrainingQuantization(const CalibrationTable& table)
+        : m_table(table)
+    {
+    }
+
+    bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+
+    /// \brief Number of nodes quantized by the last run.
+    size_t get_quantized_count() const { return m_quantized_count; }
+
+private:
+    CalibrationTable m_table;
+    size_t m_quantized_count{0};
+};
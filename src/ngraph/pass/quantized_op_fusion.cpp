@@ -0,0 +1,298 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/pass/quantized_op_fusion.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/convert.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/dequantize.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/matmul.hpp"
+#include "ngraph/op/quantize.hpp"
+#include "ngraph/op/quantized_convolution.hpp"
+#include "ngraph/op/quantized_dot.hpp"
+#include "ngraph/pattern/matcher.hpp"
+#include "ngraph/pattern/op/label.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    struct QuantizedChain
+    {
+        Output<Node> data;
+        Output<Node> weights;
+        shared_ptr<op::v0::Constant> data_scale;
+        shared_ptr<op::v0::Constant> data_zero_point;
+        shared_ptr<op::v0::Constant> weights_scale;
+        shared_ptr<op::v0::Constant> weights_zero_point;
+        shared_ptr<op::v0::Constant> output_scale;
+        shared_ptr<op::v0::Constant> output_zero_point;
+        element::Type output_type;
+    };
+
+    shared_ptr<Node> make_dequantize_pattern(const element::Type& type, const Shape& shape)
+    {
+        auto input = make_shared<pattern::op::Label>(type, shape);
+        auto scale = make_shared<pattern::op::Label>(element::f32, Shape{});
+        auto zero_point = make_shared<pattern::op::Label>(type, Shape{});
+        return make_shared<op::v0::Dequantize>(input, scale, zero_point, element::f32, AxisSet{});
+    }
+
+    shared_ptr<Node> make_quantize_pattern(const Output<Node>& input)
+    {
+        auto scale = make_shared<pattern::op::Label>(element::f32, Shape{});
+        auto zero_point = make_shared<pattern::op::Label>(element::u8, Shape{});
+        auto round_mode = op::v0::Quantize::RoundMode::ROUND_NEAREST_TOWARD_EVEN;
+        return make_shared<op::v0::Quantize>(
+            input, scale, zero_point, element::u8, AxisSet{}, round_mode);
+    }
+
+    // Per tensor scales and zero points become scalar Constants. The ONNX importer converts a
+    // zero point of another element type to the type of the data with a Convert.
+    shared_ptr<op::v0::Constant> get_scalar_constant(const Output<Node>& value)
+    {
+        auto node = value.get_node_shared_ptr();
+        if (is_type<op::v0::Convert>(node))
+        {
+            node = node->get_input_node_shared_ptr(0);
+        }
+        auto constant = as_type_ptr<op::v0::Constant>(node);
+        if (!constant || shape_size(constant->get_output_shape(0)) != 1)
+        {
+            return nullptr;
+        }
+        return op::v0::Constant::create(
+            value.get_element_type(), Shape{}, constant->cast_vector<double>());
+    }
+
+    bool get_dequantized(const Output<Node>& value,
+                         Output<Node>& input,
+                         shared_ptr<op::v0::Constant>& scale,
+                         shared_ptr<op::v0::Constant>& zero_point)
+    {
+        auto dequantize = as_type_ptr<op::v0::Dequantize>(value.get_node_shared_ptr());
+        if (!dequantize || dequantize->get_output_element_type(0) != element::f32)
+        {
+            return false;
+        }
+        input = dequantize->input_value(0);
+        scale = get_scalar_constant(dequantize->input_value(1));
+        zero_point = get_scalar_constant(dequantize->input_value(2));
+        return scale && zero_point && input.get_partial_shape().is_static();
+    }
+
+    bool is_nearest_rounding(op::v0::Quantize::RoundMode mode)
+    {
+        switch (mode)
+        {
+        case op::v0::Quantize::RoundMode::ROUND_NEAREST_TOWARD_INFINITY:
+        case op::v0::Quantize::RoundMode::ROUND_NEAREST_TOWARD_ZERO:
+        case op::v0::Quantize::RoundMode::ROUND_NEAREST_UPWARD:
+        case op::v0::Quantize::RoundMode::ROUND_NEAREST_DOWNWARD:
+        case op::v0::Quantize::RoundMode::ROUND_NEAREST_TOWARD_EVEN: return true;
+        default: return false;
+        }
+    }
+
+    // Takes apart the Dequantize -> op -> Quantize chain ending in `root`.
+    bool get_chain(const shared_ptr<Node>& root, QuantizedChain& chain)
+    {
+        auto quantize = as_type_ptr<op::v0::Quantize>(root);
+        if (!quantize || !is_nearest_rounding(quantize->get_round_mode()))
+        {
+            return false;
+        }
+        auto op = quantize->get_input_node_shared_ptr(0);
+        if (!get_dequantized(
+                op->input_value(0), chain.data, chain.data_scale, chain.data_zero_point) ||
+            !get_dequantized(
+                op->input_value(1), chain.weights, chain.weights_scale, chain.weights_zero_point))
+        {
+            return false;
+        }
+        chain.output_scale = get_scalar_constant(quantize->input_value(1));
+        chain.output_zero_point = get_scalar_constant(quantize->input_value(2));
+        chain.output_type = quantize->get_output_element_type(0);
+
+        auto weights_type = chain.weights.get_element_type();
+        bool supported = chain.data.get_element_type() == element::u8 &&
+                         ((weights_type == element::i8 && chain.output_type == element::i8) ||
+                          (weights_type == element::u8 && chain.output_type == element::u8));
+        return supported && chain.output_scale && chain.output_zero_point;
+    }
+
+    shared_ptr<Node> make_quantized_dot(const QuantizedChain& chain)
+    {
+        return make_shared<op::v0::QuantizedDot>(chain.data,
+                                                 chain.weights,
+                                                 1,
+                                                 chain.data_scale,
+                                                 chain.data_zero_point,
+                                                 chain.weights_scale,
+                                                 chain.weights_zero_point,
+                                                 chain.output_scale,
+                                                 chain.output_zero_point,
+                                                 chain.output_type,
+                                                 AxisSet{},
+                                                 AxisSet{},
+                                                 AxisSet{});
+    }
+
+    shared_ptr<Node> make_quantized_convolution(const QuantizedChain& chain,
+                                                const Strides& strides,
+                                                const Strides& dilations,
+                                                const CoordinateDiff& padding_below,
+                                                const CoordinateDiff& padding_above,
+                                                const Strides& data_dilations)
+    {
+        return make_shared<op::v0::QuantizedConvolution>(chain.data,
+                                                         chain.weights,
+                                                         strides,
+                                                         dilations,
+                                                         padding_below,
+                                                         padding_above,
+                                                         data_dilations,
+                                                         chain.data_scale,
+                                                         chain.data_zero_point,
+                                                         chain.weights_scale,
+                                                         chain.weights_zero_point,
+                                                         chain.output_scale,
+                                                         chain.output_zero_point,
+                                                         chain.output_type,
+                                                         AxisSet{},
+                                                         AxisSet{},
+                                                         AxisSet{});
+    }
+}
+
+void pass::QuantizedOpFusion::construct_quantized_dot()
+{
+    auto dot = make_shared<op::v0::Dot>(make_dequantize_pattern(element::u8, Shape{2, 3}),
+                                        make_dequantize_pattern(element::i8, Shape{3, 4}));
+    auto quantize = make_quantize_pattern(dot);
+
+    auto callback = [](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In callback for construct_quantized_dot against "
+                     << m.get_match_root()->get_name();
+        auto dot = as_type_ptr<op::v0::Dot>(m.get_match_root()->get_input_node_shared_ptr(0));
+        QuantizedChain chain;
+        if (!dot || dot->get_reduction_axes_count() != 1 || !get_chain(m.get_match_root(), chain))
+        {
+            return false;
+        }
+        m.get_match_value().replace(make_quantized_dot(chain)->output(0));
+        return true;
+    };
+
+    auto m = make_shared<pattern::Matcher>(quantize, "QuantizedOpFusion.QuantizedDot");
+    this->add_matcher(m, callback);
+}
+
+void pass::QuantizedOpFusion::construct_quantized_matmul()
+{
+    auto matmul = make_shared<op::v0::MatMul>(make_dequantize_pattern(element::u8, Shape{2, 3}),
+                                              make_dequantize_pattern(element::i8, Shape{3, 4}));
+    auto quantize = make_quantize_pattern(matmul);
+
+    auto callback = [](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In callback for construct_quantized_matmul against "
+                     << m.get_match_root()->get_name();
+        auto matmul =
+            as_type_ptr<op::v0::MatMul>(m.get_match_root()->get_input_node_shared_ptr(0));
+        QuantizedChain chain;
+        // With 2D weights and no transposes, MatMul is a Dot over the last data axis
+        if (!matmul || matmul->get_transpose_a() || matmul->get_transpose_b() ||
+            !get_chain(m.get_match_root(), chain) || chain.data.get_shape().size() < 2 ||
+            chain.weights.get_shape().size() != 2)
+        {
+            return false;
+        }
+        m.get_match_value().replace(make_quantized_dot(chain)->output(0));
+        return true;
+    };
+
+    auto m = make_shared<pattern::Matcher>(quantize, "QuantizedOpFusion.QuantizedMatMul");
+    this->add_matcher(m, callback);
+}
+
+void pass::QuantizedOpFusion::construct_quantized_convolution()
+{
+    auto conv = make_shared<op::v0::Convolution>(
+        make_dequantize_pattern(element::u8, Shape{1, 2, 3, 3}),
+        make_dequantize_pattern(element::i8, Shape{2, 2, 1, 1}));
+    auto quantize = make_quantize_pattern(conv);
+
+    auto callback = [](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In callback for construct_quantized_convolution against "
+                     << m.get_match_root()->get_name();
+        auto conv =
+            as_type_ptr<op::v0::Convolution>(m.get_match_root()->get_input_node_shared_ptr(0));
+        QuantizedChain chain;
+        if (!conv || !get_chain(m.get_match_root(), chain))
+        {
+            return false;
+        }
+        auto qconv = make_quantized_convolution(chain,
+                                                conv->get_window_movement_strides(),
+                                                conv->get_window_dilation_strides(),
+                                                conv->get_padding_below(),
+                                                conv->get_padding_above(),
+                                                conv->get_data_dilation_strides());
+        m.get_match_value().replace(qconv->output(0));
+        return true;
+    };
+
+    auto m = make_shared<pattern::Matcher>(quantize, "QuantizedOpFusion.QuantizedConvolution");
+    this->add_matcher(m, callback);
+}
+
+void pass::QuantizedOpFusion::construct_quantized_convolution_v1()
+{
+    auto conv = make_shared<op::v1::Convolution>(
+        make_dequantize_pattern(element::u8, Shape{1, 2, 3, 3}),
+        make_dequantize_pattern(element::i8, Shape{2, 2, 1, 1}),
+        Strides{1, 1},
+        CoordinateDiff{0, 0},
+        CoordinateDiff{0, 0},
+        Strides{1, 1});
+    auto quantize = make_quantize_pattern(conv);
+
+    auto callback = [](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In callback for construct_quantized_convolution_v1 against "
+                     << m.get_match_root()->get_name();
+        auto conv =
+            as_type_ptr<op::v1::Convolution>(m.get_match_root()->get_input_node_shared_ptr(0));
+        QuantizedChain chain;
+        if (!conv || !get_chain(m.get_match_root(), chain))
+        {
+            return false;
+        }
+        auto qconv = make_quantized_convolution(chain,
+                                                conv->get_strides(),
+                                                conv->get_dilations(),
+                                                conv->get_pads_begin(),
+                                                conv->get_pads_end(),
+                                                Strides(conv->get_strides().size(), 1));
+        m.get_match_value().replace(qconv->output(0));
+        return true;
+    };
+
+    auto m = make_shared<pattern::Matcher>(quantize, "QuantizedOpFusion.QuantizedConvolutionV1");
+    this->add_matcher(m, callback);
+}
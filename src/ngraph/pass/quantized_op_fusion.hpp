@@ -0,0 +1,53 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/graph_rewrite.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class QuantizedOpFusion;
+    }
+}
+
+/// \brief Rewrites Dequantize -> Dot/MatMul/Convolution -> Quantize chains, as the ONNX importer
+///        produces for QuantizeLinear/DequantizeLinear models, into QuantizedDot and
+///        QuantizedConvolution so the product runs in integer arithmetic.
+///
+/// Only per tensor scales and zero points held in Constants are fused, and only the element
+/// type combinations the quantized kernels support: u8 data with i8 weights into i8, or u8
+/// data with u8 weights into u8. The quantized kernels round halfway cases away from zero, so
+/// a result may differ by one level from Quantize with another nearest rounding mode.
+class NGRAPH_API ngraph::pass::QuantizedOpFusion : public ngraph::pass::GraphRewrite
+{
+public:
+    QuantizedOpFusion()
+        : GraphRewrite()
+    {
+        construct_quantized_dot();
+        construct_quantized_matmul();
+        construct_quantized_convolution();
+        construct_quantized_convolution_v1();
+    }
+
+    void construct_quantized_dot();
+    void construct_quantized_matmul();
+    void construct_quantized_convolution();
+    void construct_quantized_convolution_v1();
+};
@@ -0,0 +1,227 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "ngraph/function.hpp"
+#include "ngraph/op/allreduce.hpp"
+#include "ngraph/op/broadcast_distributed.hpp"
+#include "ngraph/op/recv.hpp"
+#include "ngraph/op/send.hpp"
+#include "ngraph/pass/liveness.hpp"
+#include "ngraph/pass/rematerialization.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    bool is_recomputable(const Node* node)
+    {
+        return node->is_op() && !node->is_parameter() && !node->is_constant() &&
+               !node->is_output() && !node->has_state() && !is_type<op::v0::AllReduce>(node) &&
+               !is_type<op::v0::BroadcastDistributed>(node) && !is_type<op::v0::Send>(node) &&
+               !is_type<op::v0::Recv>(node);
+    }
+}
+
+pass::Rematerialization::Rematerialization(size_t budget_bytes, size_t max_segment_ops)
+    : m_budget_bytes(budget_bytes)
+    , m_max_segment_ops(max_segment_ops)
+{
+}
+
+bool pass::Rematerialization::run_on_function(shared_ptr<Function> function)
+{
+    m_recomputed_count = 0;
+    m_initial_peak_bytes = 0;
+    m_peak_bytes = 0;
+    if (function->is_dynamic())
+    {
+        return false;
+    }
+
+    bool changed = false;
+    // Values that could not be recomputed. The outputs of the graph are fixed, so a value
+    // found wanting stays so.
+    set<pair<Node*, size_t>> rejected;
+    // Every rewrite frees a value at the peak, so there cannot be more of them than values
+    size_t max_rewrites = 0;
+    for (const shared_ptr<Node>& node : function->get_ops())
+    {
+        max_rewrites += node->get_output_size();
+    }
+    for (size_t rewrite = 0; rewrite <= max_rewrites; rewrite++)
+    {
+        pass::Liveness().run_on_function(function);
+        vector<shared_ptr<Node>> ops;
+        for (const shared_ptr<Node>& node : function->get_ordered_ops())
+        {
+            ops.push_back(node);
+        }
+
+        unordered_map<Node*, size_t> positions;
+        // Last op, in execution order, during which each intermediate tensor is live
+        unordered_map<descriptor::Tensor*, size_t> last_uses;
+        size_t live_bytes = 0;
+        size_t peak_bytes = 0;
+        size_t peak_position = 0;
+        for (size_t i = 0; i < ops.size(); i++)
+        {
+            Node* node = ops[i].get();
+            positions[node] = i;
+            for (descriptor::Tensor* tensor : node->liveness_new_list)
+            {
+                last_uses[tensor] = i;
+                live_bytes += tensor->size();
+            }
+            if (live_bytes > peak_bytes)
+            {
+                peak_bytes = live_bytes;
+                peak_position = i;
+            }
+            for (descriptor::Tensor* tensor : node->liveness_free_list)
+            {
+                last_uses[tensor] = i;
+                live_bytes -= tensor->size();
+            }
+        }
+        if (rewrite == 0)
+        {
+            m_initial_peak_bytes = peak_bytes;
+        }
+        m_peak_bytes = peak_bytes;
+        if (peak_bytes <= m_budget_bytes)
+        {
+            break;
+        }
+
+        // Values live across the peak, the largest first
+        vector<Output<Node>> candidates;
+        for (size_t i = 0; i < peak_position; i++)
+        {
+            if (!is_recomputable(ops[i].get()))
+            {
+                continue;
+            }
+            for (const Output<Node>& output : ops[i]->outputs())
+            {
+                auto it = last_uses.find(&output.get_tensor());
+                if (it != last_uses.end() && it->second > peak_position &&
+                    rejected.count({output.get_node(), output.get_index()}) == 0)
+                {
+                    candidates.push_back(output);
+                }
+            }
+        }
+        stable_sort(candidates.begin(),
+                    candidates.end(),
+                    [](const Output<Node>& o1, const Output<Node>& o2) {
+                        return o1.get_tensor().size() > o2.get_tensor().size();
+                    });
+
+        bool rewritten = false;
+        for (const Output<Node>& candidate : candidates)
+        {
+            vector<Input<Node>> late_inputs;
+            bool used_before_peak = false;
+            size_t first_late = ops.size();
+            for (const Input<Node>& input : candidate.get_target_inputs())
+            {
+                size_t position = positions.at(input.get_node());
+                if (position > peak_position)
+                {
+                    late_inputs.push_back(input);
+                    first_late = min(first_late, position);
+                }
+                else
+                {
+                    used_before_peak = true;
+                }
+            }
+            // Without an early use the value could simply be computed later
+            if (!used_before_peak || late_inputs.empty())
+            {
+                rejected.insert({candidate.get_node(), candidate.get_index()});
+                continue;
+            }
+
+            // The recomputation runs after the op before the first late use, and reads the
+            // values that are live there anyway
+            shared_ptr<Node> anchor = ops[first_late - 1];
+            map<Node*, shared_ptr<Node>> clones;
+            bool feasible = true;
+            std::function<Output<Node>(const Output<Node>&, bool)> recompute =
+                [&](const Output<Node>& value, bool force) -> Output<Node> {
+                Node* node = value.get_node();
+                if (!force)
+                {
+                    auto it = last_uses.find(&value.get_tensor());
+                    if (it == last_uses.end() || it->second >= first_late)
+                    {
+                        return value;
+                    }
+                }
+                auto clone_it = clones.find(node);
+                if (clone_it != clones.end())
+                {
+                    return clone_it->second->output(value.get_index());
+                }
+                if (!feasible || !is_recomputable(node) || clones.size() >= m_max_segment_ops)
+                {
+                    feasible = false;
+                    return value;
+                }
+                OutputVector args;
+                for (const Output<Node>& arg : node->input_values())
+                {
+                    args.push_back(recompute(arg, false));
+                }
+                if (!feasible)
+                {
+                    return value;
+                }
+                shared_ptr<Node> clone = node->copy_with_new_inputs(args);
+                clone->add_control_dependency(anchor);
+                clones[node] = clone;
+                return clone->output(value.get_index());
+            };
+            Output<Node> recomputed = recompute(candidate, true);
+            if (!feasible)
+            {
+                rejected.insert({candidate.get_node(), candidate.get_index()});
+                continue;
+            }
+            for (const Input<Node>& input : late_inputs)
+            {
+                input.replace_source_output(recomputed);
+            }
+            m_recomputed_count += clones.size();
+            rewritten = true;
+            break;
+        }
+        if (!rewritten)
+        {
+            break;
+        }
+        changed = true;
+    }
+    return changed;
+}
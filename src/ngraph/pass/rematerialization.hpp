@@ -0,0 +1,59 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class Rematerialization;
+    }
+}
+
+/// \brief Recomputes forward values for their late uses instead of keeping them live, to bring
+///        the peak memory of a training graph under a budget (gradient checkpointing).
+///
+/// The intermediate bytes live at each op come from pass::Liveness. While the peak is over
+/// `budget_bytes`, the largest tensor live across the peak that is produced before it and used
+/// both before and after it is recomputed for the uses after the peak. The recomputation
+/// reads the values still live where it runs, or recomputes them in turn, up to
+/// `max_segment_ops` ops per value; it is held after the op that precedes the first late use
+/// by a control dependency. Ops with state or side effects (random generators, distributed
+/// ops) are never recomputed.
+class NGRAPH_API ngraph::pass::Rematerialization : public FunctionPass
+{
+public:
+    Rematerialization(size_t budget_bytes, size_t max_segment_ops = 8);
+
+    bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+
+    /// \brief Number of ops added to recompute values by the last run.
+    size_t get_recomputed_count() const { return m_recomputed_count; }
+    /// \brief Peak bytes of intermediate tensors before the last run.
+    size_t get_initial_peak_bytes() const { return m_initial_peak_bytes; }
+    /// \brief Peak bytes of intermediate tensors after the last run.
+    size_t get_peak_bytes() const { return m_peak_bytes; }
+
+private:
+    size_t m_budget_bytes;
+    size_t m_max_segment_ops;
+    size_t m_recomputed_count{0};
+    size_t m_initial_peak_bytes{0};
+    size_t m_peak_bytes{0};
+};
@@ -0,0 +1,261 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "transpose_sinking_v1.hpp"
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/matmul.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/squeeze.hpp"
+#include "ngraph/op/transpose.hpp"
+#include "ngraph/op/unsqueeze.hpp"
+#include "ngraph/pattern/matcher.hpp"
+#include "ngraph/pattern/op/label.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static bool get_constant_order(const Output<Node>& transpose, AxisVector& order)
+{
+    auto constant = as_type_ptr<op::v0::Constant>(transpose.get_node()->get_argument(1));
+    if (!constant)
+    {
+        return false;
+    }
+    order = constant->get_axis_vector_val();
+    return true;
+}
+
+static shared_ptr<Node> make_transpose(const Output<Node>& arg, const AxisVector& order)
+{
+    auto order_constant = op::v0::Constant::create(element::i64, Shape{order.size()}, order);
+    return make_shared<op::v1::Transpose>(arg, order_constant);
+}
+
+static AxisVector inverse_order(const AxisVector& order)
+{
+    AxisVector inverse(order.size());
+    for (size_t i = 0; i < order.size(); i++)
+    {
+        inverse[order[i]] = i;
+    }
+    return inverse;
+}
+
+// Whether the order only swaps the last two axes, which is what the transpose flags of a
+// MatMul do
+static bool swaps_last_two_axes(const AxisVector& order)
+{
+    size_t rank = order.size();
+    if (rank < 2)
+    {
+        return false;
+    }
+    AxisVector swapped = get_default_order(rank);
+    swap(swapped[rank - 2], swapped[rank - 1]);
+    return order == swapped;
+}
+
+// The argument of a binary elementwise op that a transpose of its other argument can be
+// moved below: the same transpose of a value of the same shape, a constant that can be
+// transposed back, or a scalar
+static bool get_untransposed_argument(const Output<Node>& other,
+                                      const AxisVector& order,
+                                      const Shape& arg_shape,
+                                      Output<Node>& untransposed)
+{
+    AxisVector other_order;
+    if (is_type<op::v1::Transpose>(other.get_node()) && get_constant_order(other, other_order) &&
+        other_order == order && other.get_node()->get_input_shape(0) == arg_shape)
+    {
+        untransposed = other.get_node()->input_value(0);
+        return true;
+    }
+    if (other.get_shape().empty())
+    {
+        untransposed = other;
+        return true;
+    }
+    if (is_type<op::v0::Constant>(other.get_node()) &&
+        other.get_shape() == apply_permutation(arg_shape, order))
+    {
+        untransposed = make_transpose(other, inverse_order(order));
+        return true;
+    }
+    return false;
+}
+
+void pass::TransposeSinkingV1::construct_transpose_pattern()
+{
+    auto arg = make_shared<pattern::op::Label>(element::f32, Shape{2, 3});
+    auto order = make_shared<pattern::op::Label>(element::i64, Shape{2});
+    auto transpose = make_shared<op::v1::Transpose>(arg, order);
+
+    auto callback = [arg](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In callback for construct_transpose_pattern against node = "
+                     << m.get_match_root()->get_name();
+        auto t = m.get_match_root_as<op::v1::Transpose>();
+        NGRAPH_CHECK(t, "match root node ", *m.get_match_root(), " not of type `op::v1::Transpose`");
+
+        AxisVector axes;
+        if (!get_constant_order(t->output(0), axes))
+        {
+            NGRAPH_DEBUG << "Transpose order is not a constant";
+            return false;
+        }
+        auto x = m.get_pattern_value_map()[arg];
+
+        // Successive transposes, which may leave an identity
+        AxisVector x_axes;
+        if (is_type<op::v1::Transpose>(x.get_node()) && get_constant_order(x, x_axes))
+        {
+            AxisVector combined(axes.size());
+            for (size_t i = 0; i < axes.size(); i++)
+            {
+                combined[i] = x_axes[axes[i]];
+            }
+            x = x.get_node()->input_value(0);
+            axes = combined;
+            if (axes != get_default_order(axes.size()))
+            {
+                NGRAPH_DEBUG << "Combining " << x.get_node()->get_name() << " transposes";
+                replace_node(t, make_transpose(x, axes));
+                return true;
+            }
+        }
+        if (axes == get_default_order(axes.size()))
+        {
+            NGRAPH_DEBUG << "Removing identity transpose " << t->get_name();
+            t->output(0).replace(x);
+            return true;
+        }
+
+        auto targets = t->output(0).get_target_inputs();
+        if (targets.size() != 1 || is_type<op::v0::Constant>(x.get_node()))
+        {
+            // Constant folding takes care of transposed constants
+            return false;
+        }
+        auto target = *targets.begin();
+        auto user = target.get_node()->shared_from_this();
+        if (user->get_output_size() != 1)
+        {
+            return false;
+        }
+
+        if (auto matmul = as_type_ptr<op::v0::MatMul>(user))
+        {
+            if (!swaps_last_two_axes(axes))
+            {
+                return false;
+            }
+            NGRAPH_DEBUG << "Folding " << t->get_name() << " into " << matmul->get_name();
+            bool transpose_a = matmul->get_transpose_a();
+            bool transpose_b = matmul->get_transpose_b();
+            OutputVector matmul_args{matmul->input_value(0), matmul->input_value(1)};
+            matmul_args[target.get_index()] = x;
+            (target.get_index() == 0 ? transpose_a : transpose_b) ^= true;
+            replace_node(matmul,
+                         make_shared<op::v0::MatMul>(
+                             matmul_args[0], matmul_args[1], transpose_a, transpose_b));
+            return true;
+        }
+
+        if (user->is_unary_elementwise_arithmetic())
+        {
+            NGRAPH_DEBUG << "Sinking " << t->get_name() << " below " << user->get_name();
+            auto new_user = user->clone_with_new_inputs(OutputVector{x});
+            replace_node(user, make_transpose(new_user, axes));
+            return true;
+        }
+
+        if (user->is_binary_elementwise_arithmetic())
+        {
+            size_t index = target.get_index();
+            Output<Node> other;
+            if (!get_untransposed_argument(
+                    user->input_value(1 - index), axes, x.get_shape(), other))
+            {
+                return false;
+            }
+            NGRAPH_DEBUG << "Sinking " << t->get_name() << " below " << user->get_name();
+            OutputVector user_args(2);
+            user_args[index] = x;
+            user_args[1 - index] = other;
+            auto new_user = user->clone_with_new_inputs(user_args);
+            replace_node(user, make_transpose(new_user, axes));
+            return true;
+        }
+        return false;
+    };
+
+    auto m = make_shared<pattern::Matcher>(transpose, "TransposeSinkingV1.Transpose");
+    this->add_matcher(m, callback, PassProperty::REQUIRE_STATIC_SHAPE);
+}
+
+void pass::TransposeSinkingV1::construct_reshape_chain_pattern()
+{
+    auto is_reshape = [](const Output<Node>& value) {
+        auto node = value.get_node();
+        return is_type<op::v1::Reshape>(node) || is_type<op::v0::Squeeze>(node) ||
+               is_type<op::v0::Unsqueeze>(node);
+    };
+    auto arg = make_shared<pattern::op::Label>(element::f32, Shape{2, 3});
+    auto shape = make_shared<pattern::op::Label>(element::i64, Shape{2});
+
+    auto callback = [arg, is_reshape](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In callback for construct_reshape_chain_pattern against node = "
+                     << m.get_match_root()->get_name();
+        auto r = m.get_match_root();
+        auto x = m.get_pattern_value_map()[arg];
+        if (is_reshape(x) && x.get_node()->get_input_partial_shape(0).is_static())
+        {
+            x = x.get_node()->input_value(0);
+        }
+        else if (x.get_shape() != r->get_output_shape(0))
+        {
+            return false;
+        }
+
+        if (x.get_shape() == r->get_output_shape(0))
+        {
+            NGRAPH_DEBUG << "Removing identity reshape " << r->get_name();
+            r->output(0).replace(x);
+            return true;
+        }
+        NGRAPH_DEBUG << "Combining the reshapes of " << x.get_node()->get_name();
+        const Shape& output_shape = r->get_output_shape(0);
+        auto shape_constant =
+            op::v0::Constant::create(element::i64, Shape{output_shape.size()}, output_shape);
+        replace_node(r, make_shared<op::v1::Reshape>(x, shape_constant, false));
+        return true;
+    };
+
+    auto reshape = make_shared<op::v1::Reshape>(arg, shape, false);
+    auto m_reshape = make_shared<pattern::Matcher>(reshape, "TransposeSinkingV1.Reshape");
+    this->add_matcher(m_reshape, callback, PassProperty::REQUIRE_STATIC_SHAPE);
+
+    auto squeeze = make_shared<op::v0::Squeeze>(arg, shape);
+    auto m_squeeze = make_shared<pattern::Matcher>(squeeze, "TransposeSinkingV1.Squeeze");
+    this->add_matcher(m_squeeze, callback, PassProperty::REQUIRE_STATIC_SHAPE);
+
+    auto unsqueeze = make_shared<op::v0::Unsqueeze>(arg, shape);
+    auto m_unsqueeze = make_shared<pattern::Matcher>(unsqueeze, "TransposeSinkingV1.Unsqueeze");
+    this->add_matcher(m_unsqueeze, callback, PassProperty::REQUIRE_STATIC_SHAPE);
+}
@@ -0,0 +1,50 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/graph_rewrite.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class TransposeSinkingV1;
+    }
+}
+
+/// \brief Removes the copies of the v1 Transpose, Reshape, Squeeze and Unsqueeze chains of
+///        graphs in opset-1, such as those the ONNX importer produces.
+///
+/// Transposes with a constant order are moved below their single unary or binary elementwise
+/// user, which brings transposes of a chain together. Successive transposes are combined,
+/// those left as identities are removed, and a transpose of the last two axes of an argument
+/// of a MatMul becomes its transpose flag. Chains of reshapes, squeezes and unsqueezes become
+/// one reshape, which is removed if it keeps the shape.
+class NGRAPH_API ngraph::pass::TransposeSinkingV1 : public ngraph::pass::GraphRewrite
+{
+public:
+    TransposeSinkingV1()
+        : GraphRewrite()
+    {
+        construct_transpose_pattern();
+        construct_reshape_chain_pattern();
+    }
+
+private:
+    void construct_transpose_pattern();
+    void construct_reshape_chain_pattern();
+};
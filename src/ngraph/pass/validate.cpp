@@ -21,6 +21,11 @@ using namespace ngraph;
 
 bool pass::Validate::run_on_function(std::shared_ptr<Function> f)
 {
-    f->validate_nodes_and_infer_types();
+    // Nodes are validated when constructed, so only the nodes affected by changes to the
+    // graph since then need validating again
+    for (auto& node : f->get_ordered_ops())
+    {
+        node->revalidate_if_stale();
+    }
     return false;
 }
@@ -34,6 +34,10 @@ namespace ngraph
         /// pass does not break the shape and data type requirement on a computation node.
         /// This default validation run can be changed via calling the
         /// \link ngraph::pass::Manager::set_per_pass_validation(bool) \endlink function.
+        ///
+        /// Only nodes whose types are stale, see \link ngraph::Node::revalidate_if_stale()
+        /// \endlink, are validated. Function::validate_nodes_and_infer_types validates every
+        /// node.
         class NGRAPH_API Validate : public FunctionPass
         {
         public:
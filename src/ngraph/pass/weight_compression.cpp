@@ -0,0 +1,171 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cmath>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/embedding_lookup.hpp"
+#include "ngraph/op/experimental/decompress_weights.hpp"
+#include "ngraph/op/matmul.hpp"
+#include "ngraph/pass/weight_compression.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    // Sets axis to the output channel axis of the weights `node` takes as input 1.
+    bool get_weights_channel_axis(const Node* node, size_t& axis)
+    {
+        if (node->get_input_size() != 2 || node->get_input_partial_shape(1).rank() != 2)
+        {
+            return false;
+        }
+        if (auto dot = as_type<const op::v0::Dot>(node))
+        {
+            axis = 1;
+            return dot->get_reduction_axes_count() == 1;
+        }
+        if (auto matmul = as_type<const op::v0::MatMul>(node))
+        {
+            axis = matmul->get_transpose_b() ? 0 : 1;
+            return true;
+        }
+        if (is_type<op::v0::EmbeddingLookup>(node))
+        {
+            axis = 0;
+            return true;
+        }
+        return false;
+    }
+
+    // The f32 copy only goes away if every user takes the constant as its weights.
+    bool all_users_take_weights(const op::v0::Constant& constant, size_t axis)
+    {
+        for (auto& input : constant.output(0).get_target_inputs())
+        {
+            size_t user_axis;
+            if (input.get_index() != 1 || !get_weights_channel_axis(input.get_node(), user_axis) ||
+                user_axis != axis)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    shared_ptr<Node> compress(const op::v0::Constant& constant, size_t axis, size_t bits)
+    {
+        const Shape& shape = constant.get_output_shape(0);
+        size_t rows = shape[0];
+        size_t cols = shape[1];
+        auto values = constant.get_vector<float>();
+
+        vector<float> scales(shape[axis], 0.0f);
+        for (size_t row = 0; row < rows; row++)
+        {
+            for (size_t col = 0; col < cols; col++)
+            {
+                float& scale = scales[axis == 0 ? row : col];
+                scale = max(scale, abs(values[row * cols + col]));
+            }
+        }
+        float limit = static_cast<float>((1 << (bits - 1)) - 1);
+        for (float& scale : scales)
+        {
+            scale = (scale > 0.0f) ? scale / limit : 1.0f;
+        }
+
+        Shape packed_shape = op::v0::DecompressWeights::get_packed_shape(shape, bits);
+        size_t row_size = packed_shape[1];
+        vector<int8_t> packed(shape_size(packed_shape), 0);
+        for (size_t row = 0; row < rows; row++)
+        {
+            for (size_t col = 0; col < cols; col++)
+            {
+                float scale = scales[axis == 0 ? row : col];
+                float q = max(-limit, min(limit, round(values[row * cols + col] / scale)));
+                int8_t value = static_cast<int8_t>(q);
+                int8_t& byte = packed[row * row_size + col * bits / 8];
+                if (bits == 8)
+                {
+                    byte = value;
+                }
+                else if (col % 2 == 0)
+                {
+                    byte = static_cast<int8_t>((byte & 0xF0) | (value & 0x0F));
+                }
+                else
+                {
+                    byte = static_cast<int8_t>((byte & 0x0F) | ((value & 0x0F) << 4));
+                }
+            }
+        }
+
+        auto packed_constant = make_shared<op::v0::Constant>(element::i8, packed_shape, packed);
+        auto scales_constant =
+            make_shared<op::v0::Constant>(element::f32, Shape{scales.size()}, scales);
+        return make_shared<op::v0::DecompressWeights>(
+            packed_constant, scales_constant, shape, axis, bits);
+    }
+}
+
+pass::WeightCompression::WeightCompression(size_t bits, size_t min_elements)
+    : m_bits(bits)
+    , m_min_elements(min_elements)
+{
+    NGRAPH_CHECK(bits == 8 || bits == 4, "Only 8 and 4 bit weights are supported, got ", bits);
+}
+
+bool pass::WeightCompression::run_on_function(shared_ptr<Function> function)
+{
+    m_compressed_count = 0;
+    m_saved_bytes = 0;
+    for (auto& node : function->get_ordered_ops())
+    {
+        size_t axis;
+        if (!get_weights_channel_axis(node.get(), axis))
+        {
+            continue;
+        }
+        auto constant = as_type_ptr<op::v0::Constant>(node->get_input_node_shared_ptr(1));
+        if (!constant || constant->get_output_element_type(0) != element::f32 ||
+            shape_size(constant->get_output_shape(0)) < m_min_elements ||
+            !all_users_take_weights(*constant, axis))
+        {
+            continue;
+        }
+
+        // Per channel scales can outweigh the savings on very thin matrices
+        const Shape& shape = constant->get_output_shape(0);
+        size_t original_bytes = shape_size(shape) * sizeof(float);
+        size_t compressed_bytes =
+            shape_size(op::v0::DecompressWeights::get_packed_shape(shape, m_bits)) +
+            shape[axis] * sizeof(float);
+        if (compressed_bytes >= original_bytes)
+        {
+            continue;
+        }
+
+        replace_node(constant, compress(*constant, axis, m_bits));
+        m_saved_bytes += original_bytes - compressed_bytes;
+        m_compressed_count++;
+    }
+    return m_compressed_count > 0;
+}
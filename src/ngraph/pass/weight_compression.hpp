@@ -0,0 +1,57 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class WeightCompression;
+    }
+}
+
+/// \brief Stores large f32 weight Constants of Dot, MatMul and EmbeddingLookup compressed to 8
+///        or 4 bits.
+///
+/// Each matrix is symmetric quantized with one scale per output channel, i.e. per column of
+/// Dot and MatMul weights and per row of an embedding table, and replaced by a
+/// DecompressWeights of an i8 Constant and the scales. This cuts the resident weight memory by
+/// 4x (8 bits) or 8x (4 bits). Backends can dequantize on the fly inside their GEMM and
+/// embedding kernels; everywhere else DecompressWeights expands the weights like a Constant.
+///
+/// Constants with fewer than `min_elements` elements, or that feed anything but weights with
+/// the same channel axis, are left alone.
+class NGRAPH_API ngraph::pass::WeightCompression : public FunctionPass
+{
+public:
+    WeightCompression(size_t bits = 8, size_t min_elements = 1024);
+
+    bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+
+    /// \brief Number of Constants compressed by the last run.
+    size_t get_compressed_count() const { return m_compressed_count; }
+    /// \brief Bytes of Constant data saved by the last run.
+    size_t get_saved_bytes() const { return m_saved_bytes; }
+
+private:
+    size_t m_bits;
+    size_t m_min_elements;
+    size_t m_compressed_count{0};
+    size_t m_saved_bytes{0};
+};
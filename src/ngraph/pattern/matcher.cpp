@@ -22,13 +22,15 @@
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/parameter.hpp"
+#include "ngraph/pattern/op/branch.hpp"
+#include "ngraph/pattern/op/capture.hpp"
 
 using namespace std;
 using namespace ngraph;
 
 pattern::MatcherState::MatcherState(Matcher* matcher)
     : m_matcher(matcher)
-    , m_pattern_value_map(matcher->m_pattern_map)
+    , m_bindings_size(matcher->m_bindings.size())
     , m_watermark(matcher->m_matched_list.size())
     , m_capture_size(matcher->m_pattern_value_maps.size())
 {
@@ -82,13 +84,7 @@ pattern::MatcherState::~MatcherState()
                                             m_matcher->m_matched_list.end());
         }
 
-        if (!m_pattern_value_maps.empty())
-        {
-            m_matcher->m_pattern_value_maps.erase(m_pattern_value_maps.begin() + m_capture_size,
-                                                  m_pattern_value_maps.end());
-        }
-
-        m_matcher->m_pattern_map = m_pattern_value_map;
+        m_matcher->undo_bindings(m_bindings_size);
     }
 }
 
@@ -128,16 +124,97 @@ Output<Node> pattern::Matcher::get_match_value()
 void pattern::Matcher::capture(const set<Node*>& static_nodes)
 {
     m_pattern_value_maps.push_back(m_pattern_map);
-    m_pattern_map.clear();
-    for (auto key_value : m_pattern_value_maps.back())
+    for (auto it = m_pattern_map.begin(); it != m_pattern_map.end();)
+    {
+        if (static_nodes.count(it->first.get()) > 0)
+        {
+            ++it;
+        }
+        else
+        {
+            m_bindings.push_back(Binding{it->first, it->second, true});
+            it = m_pattern_map.erase(it);
+        }
+    }
+}
+
+void pattern::Matcher::bind(const shared_ptr<Node>& label, const Output<Node>& value)
+{
+    auto it = m_pattern_map.find(label);
+    if (it == m_pattern_map.end())
+    {
+        m_bindings.push_back(Binding{label, Output<Node>(), false});
+        m_pattern_map.emplace(label, value);
+    }
+    else
+    {
+        m_bindings.push_back(Binding{label, it->second, true});
+        it->second = value;
+    }
+}
+
+void pattern::Matcher::undo_bindings(size_t size)
+{
+    while (m_bindings.size() > size)
     {
-        if (static_nodes.count(key_value.first.get()) > 0)
+        Binding& binding = m_bindings.back();
+        if (binding.was_bound)
+        {
+            m_pattern_map[binding.label] = binding.previous;
+        }
+        else
         {
-            m_pattern_map.insert(key_value);
+            m_pattern_map.erase(binding.label);
         }
+        m_bindings.pop_back();
     }
 }
 
+void pattern::Matcher::reset()
+{
+    m_failed_matches.clear();
+}
+
+void pattern::Matcher::set_memo_epoch(size_t epoch)
+{
+    if (epoch != m_memo_epoch)
+    {
+        m_failed_matches.clear();
+        m_memo_epoch = epoch;
+    }
+}
+
+const pattern::Matcher::PatternInfo& pattern::Matcher::get_pattern_info(Node* pattern_node)
+{
+    auto it = m_pattern_info.find(pattern_node);
+    if (it != m_pattern_info.end())
+    {
+        return it->second;
+    }
+    PatternInfo info;
+    info.size = 1;
+    // Captures change the pattern map and branches lead to patterns that are not inputs
+    info.memoizable = !is_type<op::Capture>(pattern_node) && !is_type<op::Branch>(pattern_node);
+    if (is_type<op::Label>(pattern_node))
+    {
+        info.labels.push_back(pattern_node->shared_from_this());
+    }
+    for (size_t i = 0; i < pattern_node->get_input_size(); i++)
+    {
+        const PatternInfo& input_info = get_pattern_info(pattern_node->get_input_node_ptr(i));
+        info.size += input_info.size;
+        info.memoizable = info.memoizable && input_info.memoizable;
+        for (auto& label : input_info.labels)
+        {
+            if (find(info.labels.begin(), info.labels.end(), label) == info.labels.end())
+            {
+                info.labels.push_back(label);
+            }
+        }
+    }
+    return m_pattern_info.emplace(pattern_node, move(info)).first->second;
+}
+
 bool pattern::Matcher::is_contained_match(const OutputVector& exclusions, bool ignore_unused)
 {
     if (exclusions.empty())
@@ -161,8 +238,8 @@ bool pattern::Matcher::is_contained_match(const OutputVector& exclusions, bool i
 bool pattern::Matcher::match_value(const Output<Node>& pattern_value,
                                    const Output<Node>& graph_value)
 {
-    shared_ptr<Node> pattern_node = pattern_value.get_node_shared_ptr();
-    shared_ptr<Node> graph_node = graph_value.get_node_shared_ptr();
+    Node* pattern_node = pattern_value.get_node();
+    Node* graph_node = graph_value.get_node();
 
     // This env var allows one to specify node name patterns to abort pattern matching
     // at particular nodes. The upshot is that one can quickly zero in on an offending
@@ -178,7 +255,33 @@ bool pattern::Matcher::match_value(const Output<Node>& pattern_value,
             return false;
         }
     }
-    return pattern_node->match_value(this, pattern_value, graph_value);
+
+    // Sub-patterns smaller than this are matched again rather than looked up
+    constexpr size_t min_memo_size = 3;
+    bool memoize = false;
+    MemoKey key{pattern_node, pattern_value.get_index(), graph_node, graph_value.get_index()};
+    if (m_memo_epoch != 0)
+    {
+        const PatternInfo& info = get_pattern_info(pattern_node);
+        if (info.memoizable && info.size >= min_memo_size)
+        {
+            if (m_failed_matches.count(key) > 0)
+            {
+                return false;
+            }
+            memoize = none_of(info.labels.begin(),
+                              info.labels.end(),
+                              [this](const shared_ptr<Node>& label) {
+                                  return m_pattern_map.count(label) > 0;
+                              });
+        }
+    }
+    bool is_match = pattern_node->match_value(this, pattern_value, graph_value);
+    if (!is_match && memoize)
+    {
+        m_failed_matches.insert(key);
+    }
+    return is_match;
 }
 
 bool pattern::Matcher::match_permutation(const OutputVector& pattern_args, const OutputVector& args)
@@ -198,10 +301,8 @@ bool pattern::Matcher::match_arguments(Node* pattern_node, const shared_ptr<Node
     NGRAPH_DEBUG << "[MATCHER] Match arguments at " << *graph_node << " for pattern "
                  << *pattern_node;
 
-    auto args = graph_node->input_values();
-    auto pattern_args = pattern_node->input_values();
-
-    if (args.size() != pattern_args.size())
+    size_t arg_count = graph_node->get_input_size();
+    if (arg_count != pattern_node->get_input_size())
     {
         NGRAPH_DEBUG << "[MATCHER] Aborting at " << *graph_node << " for pattern " << *pattern_node;
         return false;
@@ -209,6 +310,8 @@ bool pattern::Matcher::match_arguments(Node* pattern_node, const shared_ptr<Node
 
     if (graph_node->is_commutative())
     {
+        auto args = graph_node->input_values();
+        auto pattern_args = pattern_node->input_values();
         // TODO: [nikolayk] we don't really have to use lexicographically-based perms,
         // heap's algo should be faster
         sort(begin(pattern_args),
@@ -228,7 +331,14 @@ bool pattern::Matcher::match_arguments(Node* pattern_node, const shared_ptr<Node
     }
     else
     {
-        return match_permutation(pattern_args, args);
+        for (size_t i = 0; i < arg_count; i++)
+        {
+            if (!match_value(pattern_node->input_value(i), graph_node->input_value(i)))
+            {
+                return false;
+            }
+        }
+        return true;
     }
 
     NGRAPH_DEBUG << "[MATCHER] Aborting at " << *graph_node << " for pattern " << *pattern_node;
@@ -261,6 +371,7 @@ bool pattern::Matcher::match(const Output<Node>& graph_value,
     m_match_root.reset();
     m_pattern_map.clear();
     m_matched_list.clear();
+    m_bindings.clear();
 
     // insert previous matches
     m_pattern_map.insert(previous_matches.cbegin(), previous_matches.cend());
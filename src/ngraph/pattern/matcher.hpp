@@ -19,6 +19,8 @@
 #include <algorithm>
 #include <functional>
 #include <memory.h>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "ngraph/node.hpp"
 #include "ngraph/op/constant.hpp"
@@ -51,8 +53,7 @@ public:
 
 protected:
     Matcher* m_matcher;
-    PatternValueMap m_pattern_value_map;
-    PatternValueMaps m_pattern_value_maps;
+    size_t m_bindings_size;
     size_t m_watermark;
     size_t m_capture_size;
     bool m_restore{true};
@@ -74,6 +75,9 @@ protected:
 ///
 /// Pattern nodes that have different match behavior are in ngraph::pattern::op and have
 /// descriptions of their match behavior.
+///
+/// Starting a submatch does not copy the pattern map: label bindings are logged, and a failed
+/// submatch undoes the bindings made since it started.
 class NGRAPH_API ngraph::pattern::Matcher
 {
 public:
@@ -140,7 +144,20 @@ public:
     bool is_contained_match(const OutputVector& exclusions = {}, bool ignore_unused = true);
     const OutputVector& get_matched_values() const { return m_matched_list; }
     OutputVector& get_matched_values() { return m_matched_list; }
-    void reset() {}
+    /// \brief Forgets the sub-patterns known not to match, see set_memo_epoch
+    void reset();
+    /// \brief Remembers which sub-patterns failed to match which graph values, and fails them
+    ///        again without matching, until the epoch changes.
+    ///
+    /// Only failures that did not depend on labels bound outside the sub-pattern are
+    /// remembered, since more bindings only make a match harder, and never of sub-patterns
+    /// with captures or branches. Callers must change the epoch whenever the graph may have
+    /// changed, as GraphRewrite does once per sweep and after every match. Epoch 0, the
+    /// default, turns memoization off.
+    void set_memo_epoch(size_t epoch);
+    /// \brief Binds \p label to \p value in the pattern map, to be undone if the current
+    ///        submatch fails
+    void bind(const std::shared_ptr<Node>& label, const Output<Node>& value);
     const std::string& get_name() { return m_name; }
     Output<Node> get_pattern_value() { return m_pattern_node; }
     std::shared_ptr<Node> get_match_root();
@@ -179,6 +196,54 @@ protected:
 
     std::string m_name{"unnamed"};
     bool m_strict_mode{false};
+
+private:
+    friend class MatcherState;
+
+    // The state of a label before a change to the pattern map
+    struct Binding
+    {
+        std::shared_ptr<Node> label;
+        Output<Node> previous;
+        bool was_bound;
+    };
+    void undo_bindings(size_t size);
+
+    struct PatternInfo
+    {
+        // Labels of the sub-pattern rooted at the node
+        std::vector<std::shared_ptr<Node>> labels;
+        size_t size;
+        bool memoizable;
+    };
+    const PatternInfo& get_pattern_info(Node* pattern_node);
+
+    struct MemoKey
+    {
+        const Node* pattern;
+        size_t pattern_index;
+        const Node* graph;
+        size_t graph_index;
+        bool operator==(const MemoKey& other) const
+        {
+            return pattern == other.pattern && pattern_index == other.pattern_index &&
+                   graph == other.graph && graph_index == other.graph_index;
+        }
+    };
+    struct MemoKeyHash
+    {
+        size_t operator()(const MemoKey& key) const
+        {
+            size_t seed = std::hash<const Node*>()(key.pattern) ^ key.pattern_index;
+            seed ^= std::hash<const Node*>()(key.graph) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+            return seed ^ key.graph_index;
+        }
+    };
+
+    std::vector<Binding> m_bindings;
+    size_t m_memo_epoch{0};
+    std::unordered_map<const Node*, PatternInfo> m_pattern_info;
+    std::unordered_set<MemoKey, MemoKeyHash> m_failed_matches;
 };
 
 class NGRAPH_API ngraph::pattern::RecurrentMatcher
@@ -232,6 +297,8 @@ public:
 
     std::shared_ptr<Node> get_match_root() { return m_match_root.get_node_shared_ptr(); }
     Output<Node> get_match_value() { return m_match_root; }
+    /// \brief Returns the pattern the first cell, and so the match root, is matched against
+    Output<Node> get_initial_pattern_value() const { return m_initial_pattern; }
 
 private:
     std::set<std::shared_ptr<Node>>
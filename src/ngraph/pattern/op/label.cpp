@@ -48,13 +48,15 @@ bool pattern::op::Label::match_value(Matcher* matcher,
         auto& pvm = matcher->get_pattern_value_map();
         auto saved = matcher->start_match();
         matcher->add_node(graph_value);
-        if (pvm.count(shared_from_this()))
+        auto label = shared_from_this();
+        auto it = pvm.find(label);
+        if (it != pvm.end())
         {
-            return saved.finish(pvm[shared_from_this()] == graph_value);
+            return saved.finish(it->second == graph_value);
         }
         else
         {
-            pvm[shared_from_this()] = graph_value;
+            matcher->bind(label, graph_value);
             return saved.finish(matcher->match_value(input_value(0), graph_value));
         }
     }
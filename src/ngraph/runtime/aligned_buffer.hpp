@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cstddef>
+#include <memory>
 
 #include "ngraph/runtime/allocator.hpp"
 
@@ -39,6 +40,10 @@ public:
     // allocator exceeds the lifetime of this AlignedBuffer.
     AlignedBuffer(size_t byte_size, size_t alignment = 64, Allocator* allocator = nullptr);
 
+    /// \brief Wraps memory owned by someone else, e.g. a memory-mapped file. The buffer does
+    /// not free `ptr`; `owner` is kept alive for as long as this buffer exists.
+    AlignedBuffer(void* ptr, size_t byte_size, std::shared_ptr<void> owner);
+
     AlignedBuffer();
     ~AlignedBuffer();
 
@@ -74,6 +79,7 @@ private:
     char* m_allocated_buffer;
     char* m_aligned_buffer;
     size_t m_byte_size;
+    std::shared_ptr<void> m_owner;
 };
 
 namespace ngraph
@@ -0,0 +1,127 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+
+#include "ngraph/check.hpp"
+#include "ngraph/runtime/arena_allocator.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+static const size_t s_min_block_size = 64 * 1024;
+
+runtime::ArenaAllocator::ArenaAllocator(size_t initial_size, Allocator* parent)
+    : m_parent(parent ? parent : get_default_allocator())
+    , m_initial_size(initial_size)
+{
+}
+
+runtime::ArenaAllocator::~ArenaAllocator()
+{
+    release_blocks();
+}
+
+void* runtime::ArenaAllocator::malloc(size_t size, size_t alignment)
+{
+    if (alignment == 0)
+    {
+        alignment = 1;
+    }
+    NGRAPH_CHECK((alignment & (alignment - 1)) == 0,
+                 "ArenaAllocator alignment must be a power of two, got ",
+                 alignment);
+    m_allocation_count++;
+
+    // Alignment is computed on the address so any alignment is honoured regardless of what
+    // the parent allocator guarantees
+    char* ptr = nullptr;
+    size_t padding = 0;
+    if (!m_blocks.empty())
+    {
+        const Block& block = m_blocks.back();
+        size_t addr = reinterpret_cast<size_t>(block.data) + m_offset;
+        padding = (alignment - addr % alignment) % alignment;
+        if (m_offset + padding + size <= block.size)
+        {
+            ptr = block.data + m_offset + padding;
+        }
+    }
+    if (ptr == nullptr)
+    {
+        add_block(size + alignment);
+        const Block& block = m_blocks.back();
+        size_t addr = reinterpret_cast<size_t>(block.data);
+        padding = (alignment - addr % alignment) % alignment;
+        ptr = block.data + padding;
+    }
+    m_offset += padding + size;
+    m_used += padding + size;
+    m_high_water_mark = max(m_high_water_mark, m_used);
+    return ptr;
+}
+
+void runtime::ArenaAllocator::free(void* /* ptr */)
+{
+}
+
+void runtime::ArenaAllocator::reset()
+{
+    if (m_blocks.size() > 1)
+    {
+        // Replace the chain with a single block big enough for the whole previous cycle
+        size_t capacity = get_capacity();
+        release_blocks();
+        add_block(capacity);
+    }
+    m_offset = 0;
+    m_used = 0;
+}
+
+size_t runtime::ArenaAllocator::get_capacity() const
+{
+    size_t capacity = 0;
+    for (const Block& block : m_blocks)
+    {
+        capacity += block.size;
+    }
+    return capacity;
+}
+
+void runtime::ArenaAllocator::add_block(size_t min_size)
+{
+    size_t size = max(min_size, m_initial_size);
+    if (!m_blocks.empty())
+    {
+        size = max(size, 2 * m_blocks.back().size);
+    }
+    size = max(size, s_min_block_size);
+    Block block;
+    block.data = static_cast<char*>(m_parent->malloc(size, 1));
+    block.size = size;
+    m_blocks.push_back(block);
+    m_system_allocation_count++;
+    m_offset = 0;
+}
+
+void runtime::ArenaAllocator::release_blocks()
+{
+    for (const Block& block : m_blocks)
+    {
+        m_parent->free(block.data);
+    }
+    m_blocks.clear();
+}
@@ -0,0 +1,84 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "ngraph/runtime/allocator.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class ArenaAllocator;
+    }
+}
+
+/// \brief Bump-pointer allocator for short lived buffers such as the intermediate tensors of
+/// a single Executable::call. free() is a no-op; all memory handed out since the last reset()
+/// is reclaimed at once by reset(). When a cycle needed more than one block the blocks are
+/// coalesced on reset(), so a steady state workload does no system allocation at all.
+///
+/// This class is not thread safe.
+class NGRAPH_API ngraph::runtime::ArenaAllocator : public ngraph::runtime::Allocator
+{
+public:
+    /// \param initial_size Size in bytes of the first block, allocated lazily
+    /// \param parent Allocator used for the backing blocks, the default allocator if null.
+    ///               Its lifetime must exceed the lifetime of this ArenaAllocator.
+    ArenaAllocator(size_t initial_size = 0, Allocator* parent = nullptr);
+    ~ArenaAllocator() override;
+
+    void* malloc(size_t size, size_t alignment) override;
+    /// \brief Does nothing, memory is reclaimed by reset()
+    void free(void* ptr) override;
+
+    /// \brief Invalidates every pointer returned since the previous reset
+    void reset();
+
+    /// \brief Total size in bytes of the blocks currently held
+    size_t get_capacity() const;
+    /// \brief Largest number of bytes used in a single cycle between resets
+    size_t get_high_water_mark() const { return m_high_water_mark; }
+    /// \brief Number of malloc() calls served since construction
+    size_t get_allocation_count() const { return m_allocation_count; }
+    /// \brief Number of blocks requested from the parent allocator since construction
+    size_t get_system_allocation_count() const { return m_system_allocation_count; }
+
+private:
+    ArenaAllocator(const ArenaAllocator&) = delete;
+    ArenaAllocator& operator=(const ArenaAllocator&) = delete;
+
+    struct Block
+    {
+        char* data;
+        size_t size;
+    };
+
+    void add_block(size_t min_size);
+    void release_blocks();
+
+    Allocator* m_parent;
+    size_t m_initial_size;
+    std::vector<Block> m_blocks;
+    size_t m_offset{0};
+    size_t m_used{0};
+    size_t m_high_water_mark{0};
+    size_t m_allocation_count{0};
+    size_t m_system_allocation_count{0};
+};
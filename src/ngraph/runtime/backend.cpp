@@ -102,6 +102,15 @@ std::shared_ptr<ngraph::runtime::Tensor>
     throw std::invalid_argument("This backend does not support dynamic tensors");
 }
 
+std::shared_ptr<ngraph::runtime::Tensor>
+    runtime::Backend::create_tensor_view(const std::shared_ptr<ngraph::runtime::Tensor>& /* base */,
+                                         const Shape& /* shape */,
+                                         size_t /* offset */,
+                                         const Strides& /* strides */)
+{
+    throw std::invalid_argument("This backend does not support tensor views");
+}
+
 std::shared_ptr<runtime::Executable>
     runtime::Backend::compile(std::shared_ptr<Function> func,
                               ngraph::pass::PassConfig& /* pass_config */,
@@ -25,6 +25,7 @@
 #include "ngraph/runtime/executable.hpp"
 #include "ngraph/runtime/performance_counter.hpp"
 #include "ngraph/shape.hpp"
+#include "ngraph/strides.hpp"
 #include "ngraph/type/element_type.hpp"
 #include "ngraph/util.hpp"
 
@@ -103,6 +104,22 @@ public:
     virtual std::shared_ptr<ngraph::runtime::Tensor>
         create_dynamic_tensor(const ngraph::element::Type& element_type, const PartialShape& shape);
 
+    /// \brief Create a view of elements of `base` that shares its memory, if the backend
+    ///        supports views. Views with the row-major strides of `shape`, such as a range of
+    ///        the batch, are passed to calls without copies.
+    /// \param base A tensor created by this backend
+    /// \param shape The shape of the view
+    /// \param offset The row-major index in `base` of the first element of the view
+    /// \param strides The distance in elements of `base` between neighbours along each axis
+    ///     of the view
+    /// \returns shared_ptr to a new backend-specific tensor
+    /// \throws std::invalid_argument if the backend does not support views
+    virtual std::shared_ptr<ngraph::runtime::Tensor>
+        create_tensor_view(const std::shared_ptr<ngraph::runtime::Tensor>& base,
+                           const Shape& shape,
+                           size_t offset,
+                           const Strides& strides);
+
     /// \returns `true` if this backend supports dynamic tensors, else `false`.
     virtual bool supports_dynamic_tensors() { return false; }
     /// \brief Compiles a Function.
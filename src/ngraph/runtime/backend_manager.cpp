@@ -22,6 +22,7 @@
 
 #include <sstream>
 
+#include "ngraph/env_util.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
@@ -165,7 +166,10 @@ DL_HANDLE runtime::BackendManager::open_shared_library(string type)
     handle = LoadLibrary(library_path.c_str());
 #else
     DLERROR(); // Clear any pending errors
-    handle = dlopen(library_path.c_str(), RTLD_NOW | RTLD_GLOBAL);
+    // Functions are bound on first call, which shortens loading a backend that is little used.
+    // NGRAPH_BACKEND_BIND_NOW reports missing symbols when the backend is loaded instead.
+    int binding = getenv_bool("NGRAPH_BACKEND_BIND_NOW") ? RTLD_NOW : RTLD_LAZY;
+    handle = dlopen(library_path.c_str(), binding | RTLD_GLOBAL);
 #endif
     string error = DLERROR();
     if (!handle)
@@ -60,7 +60,7 @@ namespace ngraph
                                     arg1_buffer_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
                                                       CPUExecutionContext* /* ectx */) {
-                        if (ctx->first_iteration)
+                        if (ctx->dnnl_primitives[add_index] == nullptr)
                         {
                             dnnl_emitter->build_elementwise_add(ctx->dnnl_memories,
                                                                 ctx->dnnl_primitives,
@@ -69,6 +69,10 @@ namespace ngraph
                                                                 deps,
                                                                 add_index);
                         }
+                        if (ctx->build_primitives_only)
+                        {
+                            return;
+                        }
                         cpu::dnnl_utils::set_memory_ptr(
                             ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
                         cpu::dnnl_utils::set_memory_ptr(
@@ -79,6 +83,7 @@ namespace ngraph
                         cpu::dnnl_utils::dnnl_invoke_primitive(
                             ctx, add_index, deps, cpu::dnnl_utils::OpType::ADD, scratchpad_size);
                     };
+                    external_function->add_primitive_build_functor(functors.size());
                     functors.emplace_back(functor);
                 }
                 else
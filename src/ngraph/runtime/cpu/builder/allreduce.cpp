@@ -17,10 +17,44 @@
 #include "ngraph/op/allreduce.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/type/bfloat16.hpp"
+#include "ngraph/type/float16.hpp"
 
 using namespace std;
 using namespace ngraph;
 
+// Sends arg + the rounding error of the previous call as C and keeps the rounding error of
+// this call. The error is shared by the contexts of the executable, whose calls are the steps
+// of one training.
+template <typename T, typename C>
+static runtime::cpu::CPUKernelFunctor compressed_all_reduce(size_t arg_buffer_index,
+                                                            size_t out_buffer_index,
+                                                            size_t count,
+                                                            element::Type_t compressed_type)
+{
+    auto residual = make_shared<vector<T>>(count, 0);
+    return [residual, arg_buffer_index, out_buffer_index, count, compressed_type](
+        runtime::cpu::CPURuntimeContext* ctx, runtime::cpu::CPUExecutionContext* /* ectx */) {
+        const T* arg = static_cast<const T*>(ctx->buffer_data[arg_buffer_index]);
+        T* out = static_cast<T*>(ctx->buffer_data[out_buffer_index]);
+        T* error = residual->data();
+        vector<C> compressed(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            T value = arg[i] + error[i];
+            compressed[i] = C(static_cast<float>(value));
+            error[i] = value - static_cast<T>(static_cast<float>(compressed[i]));
+        }
+        vector<C> reduced(count);
+        get_distributed_interface()->all_reduce(
+            compressed.data(), reduced.data(), compressed_type, reduction::Type::SUM, count);
+        for (size_t i = 0; i < count; i++)
+        {
+            out[i] = static_cast<T>(static_cast<float>(reduced[i]));
+        }
+    };
+}
+
 namespace ngraph
 {
     namespace runtime
@@ -50,6 +84,30 @@ namespace ngraph
                                      : node->get_friendly_name())
                              << " Size: " << count;
 
+                auto compression = allreduce->get_compression();
+                if (compression != reduction::Compression::NONE)
+                {
+                    bool bf16 = compression == reduction::Compression::BF16;
+                    auto compressed_type = bf16 ? element::Type_t::bf16 : element::Type_t::f16;
+                    if (data_type == element::f32)
+                    {
+                        functors.emplace_back(
+                            bf16 ? compressed_all_reduce<float, bfloat16>(
+                                       arg_buffer_index, out_buffer_index, count, compressed_type)
+                                 : compressed_all_reduce<float, float16>(
+                                       arg_buffer_index, out_buffer_index, count, compressed_type));
+                    }
+                    else
+                    {
+                        functors.emplace_back(
+                            bf16 ? compressed_all_reduce<double, bfloat16>(
+                                       arg_buffer_index, out_buffer_index, count, compressed_type)
+                                 : compressed_all_reduce<double, float16>(
+                                       arg_buffer_index, out_buffer_index, count, compressed_type));
+                    }
+                    return;
+                }
+
                 auto functor =
                     [&, count, reduce_type, data_type, arg_buffer_index, out_buffer_index](
                         CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {
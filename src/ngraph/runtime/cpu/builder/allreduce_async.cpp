@@ -0,0 +1,117 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstring>
+
+#include "ngraph/distributed.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/op/allreduce_async.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::AllReduceStart)
+            {
+                auto& functors = external_function->get_functors();
+                const ngraph::op::AllReduceStart* start =
+                    static_cast<const ngraph::op::AllReduceStart*>(node);
+                auto request_index = external_function->get_distributed_request_index(node);
+                auto reduce_type = start->get_reduce_type();
+                auto data_type = out[0].get_element_type();
+                auto count = out[0].get_size();
+
+                vector<size_t> arg_buffer_indices;
+                vector<size_t> arg_sizes;
+                for (const TensorWrapper& arg : args)
+                {
+                    arg_buffer_indices.push_back(
+                        external_function->get_buffer_index(arg.get_name()));
+                    arg_sizes.push_back(arg.get_size() * arg.get_element_type().size());
+                }
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto functor = [&,
+                                request_index,
+                                reduce_type,
+                                data_type,
+                                count,
+                                arg_buffer_indices,
+                                arg_sizes,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* /* ectx */) {
+                    char* bucket = static_cast<char*>(ctx->buffer_data[out_buffer_index]);
+                    for (size_t i = 0; i < arg_buffer_indices.size(); i++)
+                    {
+                        memcpy(bucket, ctx->buffer_data[arg_buffer_indices[i]], arg_sizes[i]);
+                        bucket += arg_sizes[i];
+                    }
+                    void* data = ctx->buffer_data[out_buffer_index];
+                    ctx->distributed_requests[request_index] =
+                        get_distributed_interface()->all_reduce_async(
+                            data, data, data_type, reduce_type, count);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::AllReduceWait)
+            {
+                auto& functors = external_function->get_functors();
+                auto request_index =
+                    external_function->get_distributed_request_index(node->get_input_node_ptr(0));
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+
+                vector<size_t> out_buffer_indices;
+                vector<size_t> out_sizes;
+                for (const TensorWrapper& output : out)
+                {
+                    out_buffer_indices.push_back(
+                        external_function->get_buffer_index(output.get_name()));
+                    out_sizes.push_back(output.get_size() * output.get_element_type().size());
+                }
+
+                auto functor = [&, request_index, arg_buffer_index, out_buffer_indices, out_sizes](
+                    CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {
+                    auto& request = ctx->distributed_requests[request_index];
+                    NGRAPH_CHECK(request, "AllReduceWait ran before its AllReduceStart");
+                    request->wait();
+                    request.reset();
+                    const char* bucket =
+                        static_cast<const char*>(ctx->buffer_data[arg_buffer_index]);
+                    for (size_t i = 0; i < out_buffer_indices.size(); i++)
+                    {
+                        memcpy(ctx->buffer_data[out_buffer_indices[i]], bucket, out_sizes[i]);
+                        bucket += out_sizes[i];
+                    }
+                };
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_allreduce_async_cpp()
+            {
+                REGISTER_OP_BUILDER(ngraph::op::AllReduceStart);
+                REGISTER_OP_BUILDER(ngraph::op::AllReduceWait);
+            }
+        }
+    }
+}
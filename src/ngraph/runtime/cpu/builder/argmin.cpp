@@ -36,7 +36,6 @@ namespace ngraph
 
                 const ngraph::op::v0::ArgMin* argmin =
                     static_cast<const ngraph::op::v0::ArgMin*>(node);
-                CPUKernelFunctor functor;
 
                 auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
                 auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
@@ -48,219 +47,42 @@ namespace ngraph
                 bool is_int64 = out[0].get_element_type() == element::i64;
                 auto axis = argmin->get_reduction_axis();
                 auto in_shape = args[0].get_shape();
-                auto out_shape = out[0].get_shape();
 
+                std::function<decltype(runtime::cpu::kernel::argmin<float, int64_t>)> kernel;
                 auto element_type = args[0].get_element_type();
                 if (element_type == element::f32)
                 {
-                    if (is_int64)
-                    {
-                        std::function<decltype(runtime::cpu::kernel::argmin<float, int64_t, 1>)>
-                            kernel;
-
-                        SELECT_KERNEL_RANK(
-                            kernel, float, int64_t, in_shape.size(), runtime::cpu::kernel::argmin);
-
-                        functor = [&,
-                                   kernel,
-                                   in_shape,
-                                   out_shape,
-                                   axis,
-                                   arg_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* ectx) {
-                            kernel(ctx->buffer_data[arg_buffer_index],
-                                   ctx->buffer_data[out_buffer_index],
-                                   in_shape,
-                                   out_shape,
-                                   axis,
-                                   ectx->arena);
-                        };
-                    }
-                    else
-                    {
-                        std::function<decltype(runtime::cpu::kernel::argmin<float, int, 1>)> kernel;
-
-                        SELECT_KERNEL_RANK(
-                            kernel, float, int, in_shape.size(), runtime::cpu::kernel::argmin);
-
-                        functor = [&,
-                                   kernel,
-                                   in_shape,
-                                   out_shape,
-                                   axis,
-                                   arg_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* ectx) {
-                            kernel(ctx->buffer_data[arg_buffer_index],
-                                   ctx->buffer_data[out_buffer_index],
-                                   in_shape,
-                                   out_shape,
-                                   axis,
-                                   ectx->arena);
-                        };
-                    }
+                    kernel = is_int64 ? runtime::cpu::kernel::argmin<float, int64_t>
+                                      : runtime::cpu::kernel::argmin<float, int32_t>;
                 }
                 else if (element_type == element::f64)
                 {
-                    if (is_int64)
-                    {
-                        std::function<decltype(runtime::cpu::kernel::argmin<double, int64_t, 1>)>
-                            kernel;
-
-                        SELECT_KERNEL_RANK(
-                            kernel, double, int64_t, in_shape.size(), runtime::cpu::kernel::argmin);
-
-                        functor = [&,
-                                   kernel,
-                                   in_shape,
-                                   out_shape,
-                                   axis,
-                                   arg_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* ectx) {
-                            kernel(ctx->buffer_data[arg_buffer_index],
-                                   ctx->buffer_data[out_buffer_index],
-                                   in_shape,
-                                   out_shape,
-                                   axis,
-                                   ectx->arena);
-                        };
-                    }
-                    else
-                    {
-                        std::function<decltype(runtime::cpu::kernel::argmin<double, int, 1>)>
-                            kernel;
-
-                        SELECT_KERNEL_RANK(
-                            kernel, double, int, in_shape.size(), runtime::cpu::kernel::argmin);
-
-                        functor = [&,
-                                   kernel,
-                                   in_shape,
-                                   out_shape,
-                                   axis,
-                                   arg_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* ectx) {
-                            kernel(ctx->buffer_data[arg_buffer_index],
-                                   ctx->buffer_data[out_buffer_index],
-                                   in_shape,
-                                   out_shape,
-                                   axis,
-                                   ectx->arena);
-                        };
-                    }
+                    kernel = is_int64 ? runtime::cpu::kernel::argmin<double, int64_t>
+                                      : runtime::cpu::kernel::argmin<double, int32_t>;
                 }
                 else if (element_type == element::i32)
                 {
-                    if (is_int64)
-                    {
-                        std::function<decltype(runtime::cpu::kernel::argmin<int, int64_t, 1>)>
-                            kernel;
-
-                        SELECT_KERNEL_RANK(
-                            kernel, int, int64_t, in_shape.size(), runtime::cpu::kernel::argmin);
-
-                        functor = [&,
-                                   kernel,
-                                   in_shape,
-                                   out_shape,
-                                   axis,
-                                   arg_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* ectx) {
-                            kernel(ctx->buffer_data[arg_buffer_index],
-                                   ctx->buffer_data[out_buffer_index],
-                                   in_shape,
-                                   out_shape,
-                                   axis,
-                                   ectx->arena);
-                        };
-                    }
-                    else
-                    {
-                        std::function<decltype(runtime::cpu::kernel::argmin<int, int, 1>)> kernel;
-
-                        SELECT_KERNEL_RANK(
-                            kernel, int, int, in_shape.size(), runtime::cpu::kernel::argmin);
-
-                        functor = [&,
-                                   kernel,
-                                   in_shape,
-                                   out_shape,
-                                   axis,
-                                   arg_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* ectx) {
-                            kernel(ctx->buffer_data[arg_buffer_index],
-                                   ctx->buffer_data[out_buffer_index],
-                                   in_shape,
-                                   out_shape,
-                                   axis,
-                                   ectx->arena);
-                        };
-                    }
+                    kernel = is_int64 ? runtime::cpu::kernel::argmin<int32_t, int64_t>
+                                      : runtime::cpu::kernel::argmin<int32_t, int32_t>;
                 }
                 else if (element_type == element::u32)
                 {
-                    if (is_int64)
-                    {
-                        std::function<decltype(runtime::cpu::kernel::argmin<uint32_t, int64_t, 1>)>
-                            kernel;
-
-                        SELECT_KERNEL_RANK(kernel,
-                                           uint32_t,
-                                           int64_t,
-                                           in_shape.size(),
-                                           runtime::cpu::kernel::argmin);
-
-                        functor = [&,
-                                   kernel,
-                                   in_shape,
-                                   out_shape,
-                                   axis,
-                                   arg_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* ectx) {
-                            kernel(ctx->buffer_data[arg_buffer_index],
-                                   ctx->buffer_data[out_buffer_index],
-                                   in_shape,
-                                   out_shape,
-                                   axis,
-                                   ectx->arena);
-                        };
-                    }
-                    else
-                    {
-                        std::function<decltype(runtime::cpu::kernel::argmin<uint32_t, int, 1>)>
-                            kernel;
-
-                        SELECT_KERNEL_RANK(
-                            kernel, uint32_t, int, in_shape.size(), runtime::cpu::kernel::argmin);
-
-                        functor = [&,
-                                   kernel,
-                                   in_shape,
-                                   out_shape,
-                                   axis,
-                                   arg_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* ectx) {
-                            kernel(ctx->buffer_data[arg_buffer_index],
-                                   ctx->buffer_data[out_buffer_index],
-                                   in_shape,
-                                   out_shape,
-                                   axis,
-                                   ectx->arena);
-                        };
-                    }
+                    kernel = is_int64 ? runtime::cpu::kernel::argmin<uint32_t, int64_t>
+                                      : runtime::cpu::kernel::argmin<uint32_t, int32_t>;
                 }
                 else
                 {
                     throw ngraph_error("Unsupported type in CPU Builder for ArgMin");
                 }
 
+                auto functor = [&, kernel, in_shape, axis, arg_buffer_index, out_buffer_index](
+                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[arg_buffer_index],
+                           ctx->buffer_data[out_buffer_index],
+                           in_shape,
+                           axis,
+                           ectx->arena);
+                };
                 functors.emplace_back(functor);
             }
 
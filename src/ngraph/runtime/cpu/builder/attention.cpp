@@ -0,0 +1,225 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/kernel/attention.hpp"
+#include "ngraph/runtime/cpu/op/attention.hpp"
+#include "ngraph/runtime/cpu/op/prefix_attention.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            // Offsets and strides of a mask numpy broadcast to the scores [..., queries, keys]
+            static void set_mask_strides(kernel::AttentionShape& attention,
+                                         const Shape& scores_shape,
+                                         const Shape& mask_shape)
+            {
+                size_t rank = scores_shape.size();
+                Shape padded_shape(rank - mask_shape.size(), 1);
+                padded_shape.insert(padded_shape.end(), mask_shape.begin(), mask_shape.end());
+                vector<size_t> strides(rank, 0);
+                size_t stride = 1;
+                for (size_t axis = rank; axis-- > 0;)
+                {
+                    strides[axis] = padded_shape[axis] == 1 ? 0 : stride;
+                    stride *= padded_shape[axis];
+                }
+                attention.mask_query_stride = strides[rank - 2];
+                attention.mask_key_stride = strides[rank - 1];
+                attention.mask_batch_offsets.resize(attention.batch);
+                for (size_t b = 0; b < attention.batch; b++)
+                {
+                    size_t offset = 0;
+                    size_t index = b;
+                    for (size_t axis = rank - 2; axis-- > 0;)
+                    {
+                        offset += (index % scores_shape[axis]) * strides[axis];
+                        index /= scores_shape[axis];
+                    }
+                    attention.mask_batch_offsets[b] = offset;
+                }
+            }
+
+            // One task per tile of queries of a batch index
+            static void run_attention(const kernel::AttentionShape& attention,
+                                      const float* query,
+                                      const float* key,
+                                      const float* value,
+                                      const float* mask,
+                                      float* out,
+                                      int arena)
+            {
+                size_t tiles_per_batch =
+                    (attention.queries + kernel::attention_query_block - 1) /
+                    kernel::attention_query_block;
+                size_t tasks = attention.batch * tiles_per_batch;
+                double tile_keys = static_cast<double>(
+                    attention.causal_prefix
+                        ? min(attention.keys, attention.prefix_position + attention.queries)
+                        : attention.keys);
+                Eigen::TensorOpCost cost(
+                    tile_keys * (attention.depth + attention.value_depth) * sizeof(float),
+                    kernel::attention_query_block * attention.value_depth * sizeof(float),
+                    2.0 * kernel::attention_query_block * tile_keys *
+                        (attention.depth + attention.value_depth));
+                executor::GetCPUExecutor().get_device(arena).parallelFor(
+                    tasks, cost, [&](Eigen::Index begin, Eigen::Index end) {
+                        for (Eigen::Index task = begin; task < end; task++)
+                        {
+                            size_t b = task / tiles_per_batch;
+                            size_t query_begin =
+                                (task % tiles_per_batch) * kernel::attention_query_block;
+                            size_t query_end = min(query_begin + kernel::attention_query_block,
+                                                   attention.queries);
+                            kernel::attention_tile(
+                                query, key, value, mask, out, attention, b, query_begin, query_end);
+                        }
+                    });
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::ScaledDotProductAttention)
+            {
+                auto sdpa = static_cast<const ngraph::op::ScaledDotProductAttention*>(node);
+                auto& functors = external_function->get_functors();
+
+                auto query_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto key_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto value_buffer_index = external_function->get_buffer_index(args[2].get_name());
+                auto mask_buffer_index =
+                    sdpa->has_mask() ? external_function->get_buffer_index(args[3].get_name())
+                                     : numeric_limits<size_t>::max();
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                const Shape& query_shape = args[0].get_shape();
+                size_t rank = query_shape.size();
+                kernel::AttentionShape attention;
+                attention.batch = shape_size(Shape(query_shape.begin(), query_shape.end() - 2));
+                attention.queries = query_shape[rank - 2];
+                attention.depth = query_shape[rank - 1];
+                attention.keys = args[2].get_shape()[rank - 2];
+                attention.value_depth = args[2].get_shape()[rank - 1];
+                attention.transpose_key = sdpa->get_transpose_key();
+                attention.scale = sdpa->get_scale();
+                attention.mask_query_stride = 0;
+                attention.mask_key_stride = 0;
+                attention.causal_prefix = false;
+                attention.prefix_position = 0;
+                if (sdpa->has_mask())
+                {
+                    Shape scores_shape(query_shape.begin(), query_shape.end() - 1);
+                    scores_shape.push_back(attention.keys);
+                    set_mask_strides(attention, scores_shape, args[3].get_shape());
+                }
+
+                auto functor = [attention,
+                                query_buffer_index,
+                                key_buffer_index,
+                                value_buffer_index,
+                                mask_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* ectx) {
+                    auto mask =
+                        mask_buffer_index == numeric_limits<size_t>::max()
+                            ? nullptr
+                            : static_cast<const float*>(ctx->buffer_data[mask_buffer_index]);
+                    run_attention(attention,
+                                  static_cast<const float*>(ctx->buffer_data[query_buffer_index]),
+                                  static_cast<const float*>(ctx->buffer_data[key_buffer_index]),
+                                  static_cast<const float*>(ctx->buffer_data[value_buffer_index]),
+                                  mask,
+                                  static_cast<float*>(ctx->buffer_data[out_buffer_index]),
+                                  ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::PrefixAttention)
+            {
+                auto prefix_attention = static_cast<const ngraph::op::PrefixAttention*>(node);
+                auto& functors = external_function->get_functors();
+
+                auto query_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto key_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto value_buffer_index = external_function->get_buffer_index(args[2].get_name());
+                auto position_buffer_index =
+                    external_function->get_buffer_index(args[3].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                bool position_i64 = args[3].get_element_type() == element::i64;
+
+                const Shape& query_shape = args[0].get_shape();
+                kernel::AttentionShape attention;
+                attention.batch = query_shape[0];
+                attention.queries = query_shape[1];
+                attention.depth = query_shape[2];
+                attention.keys = args[1].get_shape()[1];
+                attention.value_depth = args[2].get_shape()[2];
+                attention.transpose_key = true;
+                attention.scale = prefix_attention->get_scale();
+                attention.mask_query_stride = 0;
+                attention.mask_key_stride = 0;
+                attention.causal_prefix = true;
+                attention.prefix_position = 0;
+
+                auto functor = [attention,
+                                position_i64,
+                                query_buffer_index,
+                                key_buffer_index,
+                                value_buffer_index,
+                                position_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* ectx) {
+                    void* position_data = ctx->buffer_data[position_buffer_index];
+                    int64_t position = position_i64 ? *static_cast<int64_t*>(position_data)
+                                                    : *static_cast<int32_t*>(position_data);
+                    if (position < 0 || position + attention.queries > attention.keys)
+                    {
+                        throw ngraph_error("PrefixAttention of " +
+                                           to_string(attention.queries) + " queries at position " +
+                                           to_string(position) + " is past the " +
+                                           to_string(attention.keys) + " keys");
+                    }
+                    kernel::AttentionShape call_attention = attention;
+                    call_attention.prefix_position = static_cast<size_t>(position);
+                    run_attention(call_attention,
+                                  static_cast<const float*>(ctx->buffer_data[query_buffer_index]),
+                                  static_cast<const float*>(ctx->buffer_data[key_buffer_index]),
+                                  static_cast<const float*>(ctx->buffer_data[value_buffer_index]),
+                                  nullptr,
+                                  static_cast<float*>(ctx->buffer_data[out_buffer_index]),
+                                  ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_attention_cpp()
+            {
+                REGISTER_OP_BUILDER(ngraph::op::PrefixAttention);
+                REGISTER_OP_BUILDER(ngraph::op::ScaledDotProductAttention);
+            }
+        }
+    }
+}
@@ -68,7 +68,7 @@ namespace ngraph
                                     arg0_buffer_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
                                                       CPUExecutionContext* /* ectx */) {
-                        if (ctx->first_iteration)
+                        if (ctx->dnnl_primitives[avg_pool_index] == nullptr)
                         {
                             dnnl_emitter->build_pooling_forward(ctx->dnnl_memories,
                                                                 ctx->dnnl_primitives,
@@ -77,6 +77,10 @@ namespace ngraph
                                                                 deps,
                                                                 avg_pool_index);
                         }
+                        if (ctx->build_primitives_only)
+                        {
+                            return;
+                        }
                         cpu::dnnl_utils::set_memory_ptr(
                             ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
                         cpu::dnnl_utils::set_memory_ptr(
@@ -88,6 +92,7 @@ namespace ngraph
                                                                cpu::dnnl_utils::OpType::AVGPOOL,
                                                                scratchpad_size);
                     };
+                    external_function->add_primitive_build_functor(functors.size());
                     functors.emplace_back(functor);
                 }
                 else
@@ -166,7 +171,7 @@ namespace ngraph
                                     delta_buffer_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
                                                       CPUExecutionContext* /* ectx */) {
-                        if (ctx->first_iteration)
+                        if (ctx->dnnl_primitives[avg_pool_index] == nullptr)
                         {
                             dnnl_emitter->build_pooling_backward(ctx->dnnl_memories,
                                                                  ctx->dnnl_primitives,
@@ -176,6 +181,10 @@ namespace ngraph
                                                                  deps,
                                                                  avg_pool_index);
                         }
+                        if (ctx->build_primitives_only)
+                        {
+                            return;
+                        }
                         cpu::dnnl_utils::set_memory_ptr(
                             ctx, deps[0], ctx->buffer_data[delta_buffer_index]);
                         cpu::dnnl_utils::set_memory_ptr(
@@ -188,6 +197,7 @@ namespace ngraph
                             cpu::dnnl_utils::OpType::AVGPOOLBACKPROP,
                             scratchpad_size);
                     };
+                    external_function->add_primitive_build_functor(functors.size());
                     functors.emplace_back(functor);
                 }
                 else
@@ -111,7 +111,7 @@ namespace ngraph
                                     out1_buffer_index,
                                     out2_buffer_index](CPURuntimeContext* ctx,
                                                        CPUExecutionContext* /* ectx */) {
-                        if (ctx->first_iteration)
+                        if (ctx->dnnl_primitives[batchnorm_index] == nullptr)
                         {
                             dnnl_emitter->build_batchnorm_forward(ctx->dnnl_memories,
                                                                   ctx->dnnl_primitives,
@@ -123,6 +123,10 @@ namespace ngraph
                                                                   batchnorm_index,
                                                                   ops);
                         }
+                        if (ctx->build_primitives_only)
+                        {
+                            return;
+                        }
                         memcpy(stacked_weights.get(),
                                ctx->buffer_data[arg0_buffer_index],
                                weight_sizes[0]);
@@ -147,6 +151,7 @@ namespace ngraph
                             cpu::dnnl_utils::OpType::BATCHNORM3ARGS,
                             scratchpad_size);
                     };
+                    external_function->add_primitive_build_functor(functors.size());
                     functors.emplace_back(functor);
                 }
                 else
@@ -187,7 +192,7 @@ namespace ngraph
                                     arg4_buffer_index,
                                     out0_buffer_index](CPURuntimeContext* ctx,
                                                        CPUExecutionContext* /* ectx */) {
-                        if (ctx->first_iteration)
+                        if (ctx->dnnl_primitives[batchnorm_index] == nullptr)
                         {
                             dnnl_emitter->build_batchnorm_forward(ctx->dnnl_memories,
                                                                   ctx->dnnl_primitives,
@@ -199,6 +204,10 @@ namespace ngraph
                                                                   batchnorm_index,
                                                                   ops);
                         }
+                        if (ctx->build_primitives_only)
+                        {
+                            return;
+                        }
                         memcpy(stacked_weights.get(),
                                ctx->buffer_data[arg0_buffer_index],
                                weight_sizes[0]);
@@ -223,6 +232,7 @@ namespace ngraph
                             cpu::dnnl_utils::OpType::BATCHNORM5ARGS,
                             scratchpad_size);
                     };
+                    external_function->add_primitive_build_functor(functors.size());
                     functors.emplace_back(functor);
                 }
             }
@@ -548,7 +558,7 @@ namespace ngraph
                                     out1_buffer_index,
                                     out2_buffer_index](CPURuntimeContext* ctx,
                                                        CPUExecutionContext* /* ectx */) {
-                        if (ctx->first_iteration)
+                        if (ctx->dnnl_primitives[batchnorm_index] == nullptr)
                         {
                             dnnl_emitter->build_batchnorm_backward(ctx->dnnl_memories,
                                                                    ctx->dnnl_primitives,
@@ -561,6 +571,10 @@ namespace ngraph
                                                                    deps,
                                                                    batchnorm_index);
                         }
+                        if (ctx->build_primitives_only)
+                        {
+                            return;
+                        }
                         memcpy(stacked_weights.get(),
                                ctx->buffer_data[arg0_buffer_index],
                                weight_sizes[0]);
@@ -595,6 +609,7 @@ namespace ngraph
                                stacked_dweights.get() + weight_sizes[0],
                                weight_sizes[1]);
                     };
+                    external_function->add_primitive_build_functor(functors.size());
                     functors.emplace_back(functor);
                 }
             }
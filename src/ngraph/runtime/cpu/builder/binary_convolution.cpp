@@ -0,0 +1,195 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/op/binary_convolution.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/reference/binary_convolution.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <typename T>
+            static void pack_binary_channels(const T* in,
+                                             uint64_t* out,
+                                             size_t channels,
+                                             size_t spatial,
+                                             size_t items,
+                                             int arena)
+            {
+                size_t words = reference::binary_channel_words(channels);
+                Eigen::TensorOpCost cost(channels * sizeof(T), words * sizeof(uint64_t), channels);
+                executor::GetCPUExecutor().get_device(arena).parallelFor(
+                    items, cost, [&](Eigen::Index begin, Eigen::Index end) {
+                        reference::pack_binary_channels(in,
+                                                        out,
+                                                        channels,
+                                                        spatial,
+                                                        static_cast<size_t>(begin),
+                                                        static_cast<size_t>(end));
+                    });
+            }
+
+            // The channels of the activations are packed into bits on every call, those of
+            // constant filters once here. The output positions are then split between threads,
+            // each computing every filter from the same packed window.
+            template <typename T, typename F>
+            static void build_binary_convolution(CPU_ExternalFunction* external_function,
+                                                 const Node* node,
+                                                 const vector<TensorWrapper>& args,
+                                                 const vector<TensorWrapper>& out)
+            {
+                auto c = static_cast<const ngraph::op::v1::BinaryConvolution*>(node);
+                auto& functors = external_function->get_functors();
+                size_t data_index = external_function->get_buffer_index(args[0].get_name());
+                size_t filters_index = external_function->get_buffer_index(args[1].get_name());
+                size_t out_index = external_function->get_buffer_index(out[0].get_name());
+
+                reference::BinaryConvolutionGeometry geometry(args[0].get_shape(),
+                                                              args[1].get_shape(),
+                                                              out[0].get_shape(),
+                                                              c->get_strides(),
+                                                              c->get_dilations(),
+                                                              c->get_pads_begin());
+                bool pad_bit = reference::binary_bit(c->get_pad_value());
+                size_t words = reference::binary_channel_words(geometry.channels);
+                size_t data_items = geometry.batch * geometry.in_size();
+                size_t filter_items = geometry.filters * geometry.kernel_size();
+
+                shared_ptr<vector<uint64_t>> packed_filters;
+                if (auto constant = as_type<const ngraph::op::v0::Constant>(
+                        node->get_input_node_ptr(1)))
+                {
+                    packed_filters = make_shared<vector<uint64_t>>(filter_items * words);
+                    reference::pack_binary_channels(constant->get_data_ptr<F>(),
+                                                    packed_filters->data(),
+                                                    geometry.channels,
+                                                    geometry.kernel_size(),
+                                                    0,
+                                                    filter_items);
+                }
+
+                auto functor = [=](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    vector<uint64_t> packed_data(data_items * words);
+                    pack_binary_channels(static_cast<const T*>(ctx->buffer_data[data_index]),
+                                         packed_data.data(),
+                                         geometry.channels,
+                                         geometry.in_size(),
+                                         data_items,
+                                         ectx->arena);
+                    vector<uint64_t> call_filters;
+                    const uint64_t* filters = nullptr;
+                    if (packed_filters)
+                    {
+                        filters = packed_filters->data();
+                    }
+                    else
+                    {
+                        call_filters.resize(filter_items * words);
+                        pack_binary_channels(
+                            static_cast<const F*>(ctx->buffer_data[filters_index]),
+                            call_filters.data(),
+                            geometry.channels,
+                            geometry.kernel_size(),
+                            filter_items,
+                            ectx->arena);
+                        filters = call_filters.data();
+                    }
+
+                    T* result = static_cast<T*>(ctx->buffer_data[out_index]);
+                    size_t window_words = geometry.kernel_size() * words;
+                    Eigen::TensorOpCost cost(window_words * sizeof(uint64_t),
+                                             geometry.filters * sizeof(T),
+                                             2 * window_words * geometry.filters);
+                    executor::GetCPUExecutor().get_device(ectx->arena).parallelFor(
+                        geometry.batch * geometry.out_size(),
+                        cost,
+                        [&](Eigen::Index begin, Eigen::Index end) {
+                            reference::binary_convolution(packed_data.data(),
+                                                          filters,
+                                                          result,
+                                                          geometry,
+                                                          pad_bit,
+                                                          static_cast<size_t>(begin),
+                                                          static_cast<size_t>(end));
+                        });
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <typename T>
+            static void build_binary_convolution(CPU_ExternalFunction* external_function,
+                                                 const Node* node,
+                                                 const vector<TensorWrapper>& args,
+                                                 const vector<TensorWrapper>& out)
+            {
+                auto filter_type = args[1].get_element_type();
+                if (filter_type == args[0].get_element_type())
+                {
+                    build_binary_convolution<T, T>(external_function, node, args, out);
+                }
+                else if (filter_type == element::boolean || filter_type == element::u8)
+                {
+                    build_binary_convolution<T, uint8_t>(external_function, node, args, out);
+                }
+                else if (filter_type == element::i8)
+                {
+                    build_binary_convolution<T, int8_t>(external_function, node, args, out);
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported filter type (" + filter_type.get_type_name() +
+                                       ") in CPU Builder for BinaryConvolution");
+                }
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::v1::BinaryConvolution)
+            {
+                auto element_type = args[0].get_element_type();
+                if (element_type == element::f32)
+                {
+                    build_binary_convolution<float>(external_function, node, args, out);
+                }
+                else if (element_type == element::f64)
+                {
+                    build_binary_convolution<double>(external_function, node, args, out);
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported element type (" +
+                                       element_type.get_type_name() +
+                                       ") in CPU Builder for BinaryConvolution");
+                }
+            }
+
+            void register_builders_binary_convolution_cpp()
+            {
+                REGISTER_OP_BUILDER(ngraph::op::v1::BinaryConvolution);
+            }
+        }
+    }
+}
@@ -0,0 +1,197 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/experimental/decompress_weights.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/op/compressed_weights.hpp"
+#include "ngraph/runtime/reference/decompress_weights.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::v0::DecompressWeights)
+            {
+                auto& functors = external_function->get_functors();
+
+                auto decompress = static_cast<const ngraph::op::v0::DecompressWeights*>(node);
+                auto shape = decompress->get_weights_shape();
+                auto axis = decompress->get_axis();
+                auto bits = decompress->get_bits();
+
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto functor = [&,
+                                shape,
+                                axis,
+                                bits,
+                                arg0_buffer_index,
+                                arg1_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* /* ectx */) {
+                    runtime::reference::decompress_weights(
+                        static_cast<const int8_t*>(ctx->buffer_data[arg0_buffer_index]),
+                        static_cast<const float*>(ctx->buffer_data[arg1_buffer_index]),
+                        static_cast<float*>(ctx->buffer_data[out_buffer_index]),
+                        shape,
+                        axis,
+                        bits);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::CompressedDot)
+            {
+                auto& functors = external_function->get_functors();
+
+                auto dot = static_cast<const ngraph::op::CompressedDot*>(node);
+                size_t k = dot->get_weights_shape()[0];
+                size_t n = dot->get_weights_shape()[1];
+                size_t m = shape_size(args[0].get_shape()) / k;
+                auto axis = dot->get_axis();
+                auto bits = dot->get_bits();
+
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto arg2_buffer_index = external_function->get_buffer_index(args[2].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto functor = [&,
+                                m,
+                                k,
+                                n,
+                                axis,
+                                bits,
+                                arg0_buffer_index,
+                                arg1_buffer_index,
+                                arg2_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* /* ectx */) {
+                    runtime::reference::compressed_dot(
+                        static_cast<const float*>(ctx->buffer_data[arg0_buffer_index]),
+                        static_cast<const int8_t*>(ctx->buffer_data[arg1_buffer_index]),
+                        static_cast<const float*>(ctx->buffer_data[arg2_buffer_index]),
+                        static_cast<float*>(ctx->buffer_data[out_buffer_index]),
+                        m,
+                        k,
+                        n,
+                        axis,
+                        bits);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <typename U>
+            static CPUKernelFunctor compressed_embedding_lookup_functor(
+                const ngraph::op::CompressedEmbeddingLookup* lookup,
+                size_t element_count,
+                size_t arg0_buffer_index,
+                size_t arg1_buffer_index,
+                size_t arg2_buffer_index,
+                size_t out_buffer_index)
+            {
+                auto shape = lookup->get_weights_shape();
+                auto axis = lookup->get_axis();
+                auto bits = lookup->get_bits();
+                return [shape,
+                        axis,
+                        bits,
+                        element_count,
+                        arg0_buffer_index,
+                        arg1_buffer_index,
+                        arg2_buffer_index,
+                        out_buffer_index](CPURuntimeContext* ctx,
+                                          CPUExecutionContext* /* ectx */) {
+                    runtime::reference::compressed_embedding<U>(
+                        static_cast<const U*>(ctx->buffer_data[arg0_buffer_index]),
+                        static_cast<const int8_t*>(ctx->buffer_data[arg1_buffer_index]),
+                        static_cast<const float*>(ctx->buffer_data[arg2_buffer_index]),
+                        static_cast<float*>(ctx->buffer_data[out_buffer_index]),
+                        element_count,
+                        shape,
+                        axis,
+                        bits);
+                };
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::CompressedEmbeddingLookup)
+            {
+                auto& functors = external_function->get_functors();
+
+                auto lookup = static_cast<const ngraph::op::CompressedEmbeddingLookup*>(node);
+                size_t element_count = shape_size(args[0].get_shape());
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto arg2_buffer_index = external_function->get_buffer_index(args[2].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto index_element_type = args[0].get_element_type();
+                if (index_element_type == element::f32)
+                {
+                    functors.emplace_back(compressed_embedding_lookup_functor<float>(
+                        lookup,
+                        element_count,
+                        arg0_buffer_index,
+                        arg1_buffer_index,
+                        arg2_buffer_index,
+                        out_buffer_index));
+                }
+                else if (index_element_type == element::i32)
+                {
+                    functors.emplace_back(compressed_embedding_lookup_functor<int>(
+                        lookup,
+                        element_count,
+                        arg0_buffer_index,
+                        arg1_buffer_index,
+                        arg2_buffer_index,
+                        out_buffer_index));
+                }
+                else if (index_element_type == element::i64)
+                {
+                    functors.emplace_back(compressed_embedding_lookup_functor<int64_t>(
+                        lookup,
+                        element_count,
+                        arg0_buffer_index,
+                        arg1_buffer_index,
+                        arg2_buffer_index,
+                        out_buffer_index));
+                }
+                else
+                {
+                    throw ngraph_error(
+                        "Unsupported index type in CPU Builder for CompressedEmbeddingLookup");
+                }
+            }
+
+            void register_builders_compressed_weights_cpp()
+            {
+                REGISTER_OP_BUILDER(ngraph::op::v0::DecompressWeights);
+                REGISTER_OP_BUILDER(ngraph::op::CompressedDot);
+                REGISTER_OP_BUILDER(ngraph::op::CompressedEmbeddingLookup);
+            }
+        }
+    }
+}
@@ -38,7 +38,6 @@ namespace ngraph
                 auto& functors = external_function->get_functors();
 
                 vector<size_t> arg_buffer_indices;
-                vector<Shape> arg_shapes;
                 vector<size_t> arg_sizes;
                 auto element_size = concat->get_input_element_type(0).size();
                 for (auto& arg : args)
@@ -47,7 +46,6 @@ namespace ngraph
                     {
                         arg_buffer_indices.emplace_back(
                             external_function->get_buffer_index(arg.get_name()));
-                        arg_shapes.emplace_back(arg.get_shape());
                         arg_sizes.emplace_back(shape_size(arg.get_shape()) * element_size);
                     }
                 }
@@ -64,30 +62,23 @@ namespace ngraph
                         auto out_size = shape_size(out_shape) * element_size;
 
                         auto functor =
-                            [&, arg_buffer_indices, nargs, out_size, arg_sizes, out_buffer_index](
-                                CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {
-                                auto offset = 0;
-                                for (size_t i = 0; i < nargs; i++)
+                            [&, arg_buffer_indices, out_size, arg_sizes, out_buffer_index](
+                                CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                                auto out_begin =
+                                    reinterpret_cast<char*>(ctx->buffer_data[out_buffer_index]);
+                                std::vector<void*> arg_tensors;
+                                for (size_t i = 0; i < arg_buffer_indices.size(); i++)
                                 {
                                     // if the argument pointer does not fall within the concat
                                     // output buffer (caused by propagate_in_place_output or
                                     // propagate_in_place_input), we need to copy the data;
                                     // otherwise, we can skip the copy.
-                                    if (ctx->buffer_data[arg_buffer_indices[i]] <
-                                            ctx->buffer_data[out_buffer_index] ||
-                                        ctx->buffer_data[arg_buffer_indices[i]] >=
-                                            reinterpret_cast<char*>(
-                                                ctx->buffer_data[out_buffer_index]) +
-                                                out_size)
-                                    {
-                                        memcpy(reinterpret_cast<char*>(
-                                                   ctx->buffer_data[out_buffer_index]) +
-                                                   offset,
-                                               ctx->buffer_data[arg_buffer_indices[i]],
-                                               arg_sizes[i]);
-                                    }
-                                    offset += arg_sizes[i];
+                                    auto arg = ctx->buffer_data[arg_buffer_indices[i]];
+                                    bool in_place = arg >= out_begin && arg < out_begin + out_size;
+                                    arg_tensors.push_back(in_place ? nullptr : arg);
                                 }
+                                runtime::cpu::kernel::concat(
+                                    arg_tensors, arg_sizes, out_begin, 1, ectx->arena);
                             };
 
                         functors.emplace_back(functor);
@@ -121,7 +112,7 @@ namespace ngraph
                                     concat_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
                                                       CPUExecutionContext* /* ectx */) {
-                        if (ctx->first_iteration)
+                        if (ctx->dnnl_primitives[concat_index] == nullptr)
                         {
                             dnnl_emitter->build_concat(ctx->dnnl_memories,
                                                        ctx->dnnl_primitives,
@@ -131,6 +122,10 @@ namespace ngraph
                                                        deps,
                                                        concat_index);
                         }
+                        if (ctx->build_primitives_only)
+                        {
+                            return;
+                        }
                         for (size_t i = 0; i < nargs; i++)
                         {
                             cpu::dnnl_utils::set_memory_ptr(
@@ -146,35 +141,36 @@ namespace ngraph
                                                                scratchpad_size);
                     };
 
+                    external_function->add_primitive_build_functor(functors.size());
                     functors.emplace_back(functor);
                 }
                 else
                 {
-                    std::function<decltype(runtime::cpu::kernel::concat<float, 1>)> kernel;
-
-                    SELECT_KERNEL_ET_RANK(kernel,
-                                          out[0].get_element_type(),
-                                          out[0].get_shape().size(),
-                                          runtime::cpu::kernel::concat)
+                    // Rows of the inputs are contiguous below the concatenation axis
+                    size_t outer_count =
+                        shape_size(Shape(out_shape.begin(), out_shape.begin() + axis));
+                    vector<size_t> arg_row_sizes;
+                    for (auto size : arg_sizes)
+                    {
+                        arg_row_sizes.push_back(outer_count == 0 ? 0 : size / outer_count);
+                    }
 
                     auto functor = [&,
-                                    kernel,
                                     arg_buffer_indices,
-                                    arg_shapes,
-                                    out_shape,
-                                    axis,
+                                    arg_row_sizes,
+                                    outer_count,
                                     out_buffer_index](CPURuntimeContext* ctx,
-                                                      CPUExecutionContext* /* ectx */) {
+                                                      CPUExecutionContext* ectx) {
                         std::vector<void*> arg_tensors;
                         for (auto& arg_buffer_index : arg_buffer_indices)
                         {
                             arg_tensors.push_back(ctx->buffer_data[arg_buffer_index]);
                         }
-                        kernel(arg_tensors,
-                               arg_shapes,
-                               ctx->buffer_data[out_buffer_index],
-                               out_shape,
-                               axis);
+                        runtime::cpu::kernel::concat(arg_tensors,
+                                                     arg_row_sizes,
+                                                     ctx->buffer_data[out_buffer_index],
+                                                     outer_count,
+                                                     ectx->arena);
                     };
                     functors.emplace_back(functor);
                 }
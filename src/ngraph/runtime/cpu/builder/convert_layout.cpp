@@ -105,7 +105,7 @@ namespace ngraph
                                 arg_buffer_index,
                                 out_buffer_index](CPURuntimeContext* ctx,
                                                   CPUExecutionContext* /* ectx */) {
-                    if (ctx->first_iteration)
+                    if (ctx->dnnl_primitives[reorder_index] == nullptr)
                     {
                         dnnl_emitter->build_reorder(ctx->dnnl_memories,
                                                     ctx->dnnl_primitives,
@@ -115,6 +115,10 @@ namespace ngraph
                                                     deps,
                                                     reorder_index);
                     }
+                    if (ctx->build_primitives_only)
+                    {
+                        return;
+                    }
                     cpu::dnnl_utils::set_memory_ptr(
                         ctx, deps[0], ctx->buffer_data[arg_buffer_index]);
                     cpu::dnnl_utils::set_memory_ptr(
@@ -126,6 +130,7 @@ namespace ngraph
                                                            cpu::dnnl_utils::OpType::CONVERTLAYOUT,
                                                            scratchpad_size);
                 };
+                external_function->add_primitive_build_functor(functors.size());
                 functors.emplace_back(functor);
             }
 
@@ -72,7 +72,7 @@ namespace ngraph
                                     arg1_buffer_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
                                                       CPUExecutionContext* /* ectx */) {
-                        if (ctx->first_iteration)
+                        if (ctx->dnnl_primitives[conv_index] == nullptr)
                         {
                             dnnl_emitter->build_convolution_forward<false>(
                                 ctx->dnnl_memories,
@@ -80,10 +80,14 @@ namespace ngraph
                                 ctx->dnnl_scratchpad_mds,
                                 conv_desc,
                                 conv_attr,
-                                executor::global_cpu_engine,
+                                executor::get_cpu_engine(),
                                 deps,
                                 conv_index);
                         }
+                        if (ctx->build_primitives_only)
+                        {
+                            return;
+                        }
                         cpu::dnnl_utils::set_memory_ptr(
                             ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
                         cpu::dnnl_utils::set_memory_ptr(
@@ -97,6 +101,7 @@ namespace ngraph
                                                                cpu::dnnl_utils::OpType::CONVOLUTION,
                                                                scratchpad_size);
                     };
+                    external_function->add_primitive_build_functor(functors.size());
                     functors.emplace_back(functor);
                 }
                 else
@@ -182,7 +187,7 @@ namespace ngraph
                                     arg1_buffer_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
                                                       CPUExecutionContext* /* ectx */) {
-                        if (ctx->first_iteration)
+                        if (ctx->dnnl_primitives[conv_index] == nullptr)
                         {
                             dnnl_emitter->build_convolution_forward<false>(
                                 ctx->dnnl_memories,
@@ -190,10 +195,14 @@ namespace ngraph
                                 ctx->dnnl_scratchpad_mds,
                                 conv_desc,
                                 conv_attr,
-                                executor::global_cpu_engine,
+                                executor::get_cpu_engine(),
                                 deps,
                                 conv_index);
                         }
+                        if (ctx->build_primitives_only)
+                        {
+                            return;
+                        }
                         cpu::dnnl_utils::set_memory_ptr(
                             ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
                         cpu::dnnl_utils::set_memory_ptr(
@@ -208,6 +217,7 @@ namespace ngraph
                             cpu::dnnl_utils::OpType::CONVOLUTIONRELU,
                             scratchpad_size);
                     };
+                    external_function->add_primitive_build_functor(functors.size());
                     functors.emplace_back(functor);
                 }
                 else
@@ -251,7 +261,7 @@ namespace ngraph
                                     arg2_buffer_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
                                                       CPUExecutionContext* /* ectx */) {
-                        if (ctx->first_iteration)
+                        if (ctx->dnnl_primitives[conv_index] == nullptr)
                         {
                             dnnl_emitter->build_convolution_forward<true>(
                                 ctx->dnnl_memories,
@@ -259,10 +269,14 @@ namespace ngraph
                                 ctx->dnnl_scratchpad_mds,
                                 conv_desc,
                                 conv_attr,
-                                executor::global_cpu_engine,
+                                executor::get_cpu_engine(),
                                 deps,
                                 conv_index);
                         }
+                        if (ctx->build_primitives_only)
+                        {
+                            return;
+                        }
                         cpu::dnnl_utils::set_memory_ptr(
                             ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
                         cpu::dnnl_utils::set_memory_ptr(
@@ -279,6 +293,7 @@ namespace ngraph
                             cpu::dnnl_utils::OpType::CONVOLUTIONBIAS,
                             scratchpad_size);
                     };
+                    external_function->add_primitive_build_functor(functors.size());
                     functors.emplace_back(functor);
                 }
                 else
@@ -328,7 +343,7 @@ namespace ngraph
                                     arg3_buffer_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
                                                       CPUExecutionContext* /* ectx */) {
-                        if (ctx->first_iteration)
+                        if (ctx->dnnl_primitives[conv_index] == nullptr)
                         {
                             dnnl_emitter->build_convolution_forward<true>(
                                 ctx->dnnl_memories,
@@ -336,10 +351,14 @@ namespace ngraph
                                 ctx->dnnl_scratchpad_mds,
                                 conv_desc,
                                 conv_attr,
-                                executor::global_cpu_engine,
+                                executor::get_cpu_engine(),
                                 deps,
                                 conv_index);
                         }
+                        if (ctx->build_primitives_only)
+                        {
+                            return;
+                        }
                         if (ctx->buffer_data[out_buffer_index] !=
                             ctx->buffer_data[arg3_buffer_index])
                         {
@@ -363,6 +382,7 @@ namespace ngraph
                             cpu::dnnl_utils::OpType::CONVOLUTIONBIASADD,
                             scratchpad_size);
                     };
+                    external_function->add_primitive_build_functor(functors.size());
                     functors.emplace_back(functor);
                 }
                 else
@@ -408,7 +428,7 @@ namespace ngraph
                                     arg2_buffer_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
                                                       CPUExecutionContext* /* ectx */) {
-                        if (ctx->first_iteration)
+                        if (ctx->dnnl_primitives[conv_index] == nullptr)
                         {
                             dnnl_emitter->build_convolution_forward<false>(
                                 ctx->dnnl_memories,
@@ -416,10 +436,14 @@ namespace ngraph
                                 ctx->dnnl_scratchpad_mds,
                                 conv_desc,
                                 conv_attr,
-                                executor::global_cpu_engine,
+                                executor::get_cpu_engine(),
                                 deps,
                                 conv_index);
                         }
+                        if (ctx->build_primitives_only)
+                        {
+                            return;
+                        }
                         if (ctx->buffer_data[out_buffer_index] !=
                             ctx->buffer_data[arg2_buffer_index])
                         {
@@ -441,6 +465,7 @@ namespace ngraph
                             cpu::dnnl_utils::OpType::CONVOLUTIONADD,
                             scratchpad_size);
                     };
+                    external_function->add_primitive_build_functor(functors.size());
                     functors.emplace_back(functor);
                 }
                 else
@@ -488,7 +513,7 @@ namespace ngraph
                                     arg1_buffer_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
                                                       CPUExecutionContext* /* ectx */) {
-                        if (ctx->first_iteration)
+                        if (ctx->dnnl_primitives[conv_index] == nullptr)
                         {
                             dnnl_emitter->build_convolution_backward_data(ctx->dnnl_memories,
                                                                           ctx->dnnl_primitives,
@@ -498,6 +523,10 @@ namespace ngraph
                                                                           deps,
                                                                           conv_index);
                         }
+                        if (ctx->build_primitives_only)
+                        {
+                            return;
+                        }
                         cpu::dnnl_utils::set_memory_ptr(
                             ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
                         cpu::dnnl_utils::set_memory_ptr(
@@ -512,6 +541,7 @@ namespace ngraph
                             cpu::dnnl_utils::OpType::CONVOLUTIONBACKPROPDATA,
                             scratchpad_size);
                     };
+                    external_function->add_primitive_build_functor(functors.size());
                     functors.emplace_back(functor);
                 }
                 else
@@ -604,7 +634,7 @@ namespace ngraph
                                     arg1_buffer_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
                                                       CPUExecutionContext* /* ectx */) {
-                        if (ctx->first_iteration)
+                        if (ctx->dnnl_primitives[conv_index] == nullptr)
                         {
                             dnnl_emitter->build_convolution_backward_weights(
                                 ctx->dnnl_memories,
@@ -615,6 +645,10 @@ namespace ngraph
                                 deps,
                                 conv_index);
                         }
+                        if (ctx->build_primitives_only)
+                        {
+                            return;
+                        }
                         cpu::dnnl_utils::set_memory_ptr(
                             ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
                         cpu::dnnl_utils::set_memory_ptr(
@@ -629,6 +663,7 @@ namespace ngraph
                             cpu::dnnl_utils::OpType::CONVOLUTIONBACKPROPWEIGHTS,
                             scratchpad_size);
                     };
+                    external_function->add_primitive_build_functor(functors.size());
                     functors.emplace_back(functor);
                 }
                 else
@@ -717,7 +752,7 @@ namespace ngraph
                                     out0_buffer_index,
                                     out1_buffer_index](CPURuntimeContext* ctx,
                                                        CPUExecutionContext* /* ectx */) {
-                        if (ctx->first_iteration)
+                        if (ctx->dnnl_primitives[conv_index] == nullptr)
                         {
                             dnnl_emitter->build_convolution_backward_weights_bias(
                                 ctx->dnnl_memories,
@@ -728,6 +763,10 @@ namespace ngraph
                                 deps,
                                 conv_index);
                         }
+                        if (ctx->build_primitives_only)
+                        {
+                            return;
+                        }
                         cpu::dnnl_utils::set_memory_ptr(
                             ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
                         cpu::dnnl_utils::set_memory_ptr(
@@ -744,6 +783,7 @@ namespace ngraph
                             cpu::dnnl_utils::OpType::CONVOLUTIONBACKPROPWEIGHTSBIAS,
                             scratchpad_size);
                     };
+                    external_function->add_primitive_build_functor(functors.size());
                     functors.emplace_back(functor);
                 }
                 else
@@ -786,7 +826,7 @@ namespace ngraph
                                     arg1_buffer_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
                                                       CPUExecutionContext* /* ectx */) {
-                        if (ctx->first_iteration)
+                        if (ctx->dnnl_primitives[conv_index] == nullptr)
                         {
                             dnnl_emitter->build_convolution_forward<false>(
                                 ctx->dnnl_memories,
@@ -794,10 +834,14 @@ namespace ngraph
                                 ctx->dnnl_scratchpad_mds,
                                 conv_desc,
                                 conv_attr,
-                                executor::global_cpu_engine,
+                                executor::get_cpu_engine(),
                                 deps,
                                 conv_index);
                         }
+                        if (ctx->build_primitives_only)
+                        {
+                            return;
+                        }
 
                         // group convolution
                         cpu::dnnl_utils::set_memory_ptr(
@@ -814,6 +858,7 @@ namespace ngraph
                             cpu::dnnl_utils::OpType::GROUPCONVOLUTION,
                             scratchpad_size);
                     };
+                    external_function->add_primitive_build_functor(functors.size());
                     functors.emplace_back(functor);
                 }
                 else
@@ -857,7 +902,7 @@ namespace ngraph
                                     arg2_buffer_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
                                                       CPUExecutionContext* /* ectx */) {
-                        if (ctx->first_iteration)
+                        if (ctx->dnnl_primitives[conv_index] == nullptr)
                         {
                             dnnl_emitter->build_convolution_forward<true>(
                                 ctx->dnnl_memories,
@@ -865,10 +910,14 @@ namespace ngraph
                                 ctx->dnnl_scratchpad_mds,
                                 conv_desc,
                                 conv_attr,
-                                executor::global_cpu_engine,
+                                executor::get_cpu_engine(),
                                 deps,
                                 conv_index);
                         }
+                        if (ctx->build_primitives_only)
+                        {
+                            return;
+                        }
                         cpu::dnnl_utils::set_memory_ptr(
                             ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
                         cpu::dnnl_utils::set_memory_ptr(
@@ -885,6 +934,7 @@ namespace ngraph
                             cpu::dnnl_utils::OpType::GROUPCONVOLUTIONBIAS,
                             scratchpad_size);
                     };
+                    external_function->add_primitive_build_functor(functors.size());
                     functors.emplace_back(functor);
                 }
                 else
@@ -934,7 +984,7 @@ namespace ngraph
                                     arg2_buffer_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
                                                       CPUExecutionContext* /* ectx */) {
-                        if (ctx->first_iteration)
+                        if (ctx->dnnl_primitives[conv_index] == nullptr)
                         {
                             dnnl_emitter->build_deconvolutionbias_forward(ctx->dnnl_memories,
                                                                           ctx->dnnl_primitives,
@@ -944,6 +994,10 @@ namespace ngraph
                                                                           conv_index,
                                                                           weights_desc);
                         }
+                        if (ctx->build_primitives_only)
+                        {
+                            return;
+                        }
                         cpu::dnnl_utils::set_memory_ptr(
                             ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
                         cpu::dnnl_utils::set_memory_ptr(
@@ -960,6 +1014,7 @@ namespace ngraph
                             cpu::dnnl_utils::OpType::DECONVOLUTIONBIAS,
                             scratchpad_size);
                     };
+                    external_function->add_primitive_build_functor(functors.size());
                     functors.emplace_back(functor);
                 }
                 else
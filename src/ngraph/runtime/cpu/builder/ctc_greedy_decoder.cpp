@@ -0,0 +1,103 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/op/ctc_greedy_decoder.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/reference/ctc_greedy_decoder.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            // The batch elements are decoded independently, so they are split between threads
+            template <typename T>
+            static void build_ctc_greedy_decoder(CPU_ExternalFunction* external_function,
+                                                 const Node* node,
+                                                 const vector<TensorWrapper>& args,
+                                                 const vector<TensorWrapper>& out)
+            {
+                auto decoder = static_cast<const ngraph::op::v0::CTCGreedyDecoder*>(node);
+                auto& functors = external_function->get_functors();
+                size_t data_index = external_function->get_buffer_index(args[0].get_name());
+                size_t mask_index = external_function->get_buffer_index(args[1].get_name());
+                size_t out_index = external_function->get_buffer_index(out[0].get_name());
+                Shape data_shape = args[0].get_shape();
+                bool merge_repeated = decoder->get_ctc_merge_repeated();
+
+                auto functor = [=](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    const T* data = static_cast<const T*>(ctx->buffer_data[data_index]);
+                    const T* mask = static_cast<const T*>(ctx->buffer_data[mask_index]);
+                    T* result = static_cast<T*>(ctx->buffer_data[out_index]);
+                    size_t frames = data_shape[0];
+                    Eigen::TensorOpCost cost(frames * (data_shape[2] + 1) * sizeof(T),
+                                             frames * sizeof(T),
+                                             frames * data_shape[2]);
+                    executor::GetCPUExecutor().get_device(ectx->arena).parallelFor(
+                        data_shape[1], cost, [&](Eigen::Index begin, Eigen::Index end) {
+                            reference::ctc_greedy_decoder(data,
+                                                          mask,
+                                                          result,
+                                                          data_shape,
+                                                          merge_repeated,
+                                                          static_cast<size_t>(begin),
+                                                          static_cast<size_t>(end));
+                        });
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::v0::CTCGreedyDecoder)
+            {
+                auto element_type = args[0].get_element_type();
+                if (args[1].get_element_type() != element_type)
+                {
+                    throw ngraph_error("Unsupported sequence mask type (" +
+                                       args[1].get_element_type().get_type_name() +
+                                       ") in CPU Builder for CTCGreedyDecoder");
+                }
+                if (element_type == element::f32)
+                {
+                    build_ctc_greedy_decoder<float>(external_function, node, args, out);
+                }
+                else if (element_type == element::f64)
+                {
+                    build_ctc_greedy_decoder<double>(external_function, node, args, out);
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported element type (" +
+                                       element_type.get_type_name() +
+                                       ") in CPU Builder for CTCGreedyDecoder");
+                }
+            }
+
+            void register_builders_ctc_greedy_decoder_cpp()
+            {
+                REGISTER_OP_BUILDER(ngraph::op::v0::CTCGreedyDecoder);
+            }
+        }
+    }
+}
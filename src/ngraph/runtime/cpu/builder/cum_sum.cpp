@@ -33,19 +33,21 @@ namespace ngraph
 #define FUNCTOR_CUMSUM(T, M)                                                                       \
     do                                                                                             \
     {                                                                                              \
+        kernel = runtime::cpu::kernel::cumsum<T, M>;                                               \
         auto functor = [&,                                                                         \
                         kernel,                                                                    \
                         arg0_buffer_index,                                                         \
                         arg1_buffer_index,                                                         \
                         out0_buffer_index,                                                         \
                         tensor_shape,                                                              \
-                        cumsum_op](CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {      \
-            runtime::cpu::kernel::reference_cumsum<T, M>(ctx->buffer_data[arg0_buffer_index],      \
-                                                         ctx->buffer_data[arg1_buffer_index],      \
-                                                         ctx->buffer_data[out0_buffer_index],      \
-                                                         tensor_shape,                             \
-                                                         cumsum_op->is_exclusive(),                \
-                                                         cumsum_op->is_reverse());                 \
+                        cumsum_op](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {            \
+            kernel(ctx->buffer_data[arg0_buffer_index],                                            \
+                   ctx->buffer_data[arg1_buffer_index],                                            \
+                   ctx->buffer_data[out0_buffer_index],                                            \
+                   tensor_shape,                                                                   \
+                   cumsum_op->is_exclusive(),                                                      \
+                   cumsum_op->is_reverse(),                                                        \
+                   ectx->arena);                                                                   \
         };                                                                                         \
         functors.emplace_back(functor);                                                            \
     } while (0)
@@ -61,93 +63,73 @@ namespace ngraph
                 if (args[0].get_element_type() == element::f32 &&
                     args[1].get_element_type() == element::i32)
                 {
-                    std::function<decltype(runtime::cpu::kernel::reference_cumsum<float, int32_t>)>
-                        kernel;
+                    std::function<decltype(runtime::cpu::kernel::cumsum<float, int32_t>)> kernel;
                     FUNCTOR_CUMSUM(float, int32_t);
                 }
                 else if (args[0].get_element_type() == element::f32 &&
                          args[1].get_element_type() == element::i64)
                 {
-                    std::function<decltype(runtime::cpu::kernel::reference_cumsum<float, int64_t>)>
-                        kernel;
+                    std::function<decltype(runtime::cpu::kernel::cumsum<float, int64_t>)> kernel;
                     FUNCTOR_CUMSUM(float, int64_t);
                 }
                 else if (args[0].get_element_type() == element::f64 &&
                          args[1].get_element_type() == element::i32)
                 {
-                    std::function<decltype(runtime::cpu::kernel::reference_cumsum<double, int32_t>)>
-                        kernel;
+                    std::function<decltype(runtime::cpu::kernel::cumsum<double, int32_t>)> kernel;
                     FUNCTOR_CUMSUM(double, int32_t);
                 }
                 else if (args[0].get_element_type() == element::f64 &&
                          args[1].get_element_type() == element::i64)
                 {
-                    std::function<decltype(runtime::cpu::kernel::reference_cumsum<double, int64_t>)>
-                        kernel;
+                    std::function<decltype(runtime::cpu::kernel::cumsum<double, int64_t>)> kernel;
                     FUNCTOR_CUMSUM(double, int64_t);
                 }
                 else if (args[0].get_element_type() == element::i32 &&
                          args[1].get_element_type() == element::i32)
                 {
-                    std::function<decltype(
-                        runtime::cpu::kernel::reference_cumsum<int32_t, int32_t>)>
-                        kernel;
+                    std::function<decltype(runtime::cpu::kernel::cumsum<int32_t, int32_t>)> kernel;
                     FUNCTOR_CUMSUM(int32_t, int32_t);
                 }
                 else if (args[0].get_element_type() == element::i32 &&
                          args[1].get_element_type() == element::i64)
                 {
-                    std::function<decltype(
-                        runtime::cpu::kernel::reference_cumsum<int32_t, int64_t>)>
-                        kernel;
+                    std::function<decltype(runtime::cpu::kernel::cumsum<int32_t, int64_t>)> kernel;
                     FUNCTOR_CUMSUM(int32_t, int64_t);
                 }
                 else if (args[0].get_element_type() == element::i64 &&
                          args[1].get_element_type() == element::i32)
                 {
-                    std::function<decltype(
-                        runtime::cpu::kernel::reference_cumsum<int64_t, int32_t>)>
-                        kernel;
+                    std::function<decltype(runtime::cpu::kernel::cumsum<int64_t, int32_t>)> kernel;
                     FUNCTOR_CUMSUM(int64_t, int32_t);
                 }
                 else if (args[0].get_element_type() == element::i64 &&
                          args[1].get_element_type() == element::i64)
                 {
-                    std::function<decltype(
-                        runtime::cpu::kernel::reference_cumsum<int64_t, int64_t>)>
-                        kernel;
+                    std::function<decltype(runtime::cpu::kernel::cumsum<int64_t, int64_t>)> kernel;
                     FUNCTOR_CUMSUM(int64_t, int64_t);
                 }
                 else if (args[0].get_element_type() == element::u32 &&
                          args[1].get_element_type() == element::i32)
                 {
-                    std::function<decltype(
-                        runtime::cpu::kernel::reference_cumsum<uint32_t, int32_t>)>
-                        kernel;
+                    std::function<decltype(runtime::cpu::kernel::cumsum<uint32_t, int32_t>)> kernel;
                     FUNCTOR_CUMSUM(uint32_t, int32_t);
                 }
                 else if (args[0].get_element_type() == element::u32 &&
                          args[1].get_element_type() == element::i64)
                 {
-                    std::function<decltype(
-                        runtime::cpu::kernel::reference_cumsum<uint32_t, int64_t>)>
-                        kernel;
+                    std::function<decltype(runtime::cpu::kernel::cumsum<uint32_t, int64_t>)> kernel;
                     FUNCTOR_CUMSUM(uint32_t, int64_t);
                 }
                 else if (args[0].get_element_type() == element::u64 &&
                          args[1].get_element_type() == element::i32)
                 {
-                    std::function<decltype(
-                        runtime::cpu::kernel::reference_cumsum<uint64_t, int32_t>)>
-                        kernel;
+                    std::function<decltype(runtime::cpu::kernel::cumsum<uint64_t, int32_t>)> kernel;
                     FUNCTOR_CUMSUM(uint64_t, int32_t);
                 }
                 else if (args[0].get_element_type() == element::u64 &&
                          args[1].get_element_type() == element::i64)
                 {
-                    std::function<decltype(
-                        runtime::cpu::kernel::reference_cumsum<uint64_t, int64_t>)>
-                        kernel;
+                    std::function<decltype(runtime::cpu::kernel::cumsum<uint64_t, int64_t>)> kernel;
                     FUNCTOR_CUMSUM(uint64_t, int64_t);
                 }
             }
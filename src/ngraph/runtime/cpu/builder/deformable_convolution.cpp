@@ -0,0 +1,166 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/op/deformable_convolution.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/cpu_kernels.hpp"
+#include "ngraph/runtime/reference/deformable_convolution.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            static void gemm(const float* a, const float* b, float* c, size_t m, size_t n, size_t k)
+            {
+                cblas::cblas_sgemm(cblas::Layout::RowMajor,
+                                   cblas::Transpose::None,
+                                   cblas::Transpose::None,
+                                   m,
+                                   n,
+                                   k,
+                                   1.0f,
+                                   a,
+                                   max<size_t>(1, k),
+                                   b,
+                                   max<size_t>(1, n),
+                                   0.0f,
+                                   c,
+                                   max<size_t>(1, n));
+            }
+
+            static void
+                gemm(const double* a, const double* b, double* c, size_t m, size_t n, size_t k)
+            {
+                cblas::cblas_dgemm(cblas::Layout::RowMajor,
+                                   cblas::Transpose::None,
+                                   cblas::Transpose::None,
+                                   m,
+                                   n,
+                                   k,
+                                   1.0,
+                                   a,
+                                   max<size_t>(1, k),
+                                   b,
+                                   max<size_t>(1, n),
+                                   0.0,
+                                   c,
+                                   max<size_t>(1, n));
+            }
+
+            // Each group gathers the bilinearly sampled windows of all the batch into a
+            // column buffer, in parallel over output positions, and multiplies its filters
+            // with the columns of every batch element with a BLAS GEMM.
+            template <typename T>
+            static void build_deformable_convolution(CPU_ExternalFunction* external_function,
+                                                     const Node* node,
+                                                     const vector<TensorWrapper>& args,
+                                                     const vector<TensorWrapper>& out)
+            {
+                auto c = static_cast<const ngraph::op::v1::DeformableConvolution*>(node);
+                auto& functors = external_function->get_functors();
+                size_t data_index = external_function->get_buffer_index(args[0].get_name());
+                size_t offsets_index = external_function->get_buffer_index(args[1].get_name());
+                size_t filters_index = external_function->get_buffer_index(args[2].get_name());
+                size_t out_index = external_function->get_buffer_index(out[0].get_name());
+
+                reference::DeformableConvolutionGeometry geometry(
+                    args[0].get_shape(),
+                    args[2].get_shape(),
+                    out[0].get_shape(),
+                    c->get_strides(),
+                    c->get_dilations(),
+                    c->get_pads_begin(),
+                    static_cast<size_t>(c->get_group()),
+                    static_cast<size_t>(c->get_deformable_group()));
+
+                auto functor = [=](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    const T* data = static_cast<const T*>(ctx->buffer_data[data_index]);
+                    const T* offsets = static_cast<const T*>(ctx->buffer_data[offsets_index]);
+                    const T* filters = static_cast<const T*>(ctx->buffer_data[filters_index]);
+                    T* result = static_cast<T*>(ctx->buffer_data[out_index]);
+
+                    const size_t rows = geometry.column_rows();
+                    const size_t out_size = geometry.out_size();
+                    const size_t group_filters = geometry.filters / geometry.group;
+                    const size_t kernel_size = geometry.kernel_size();
+                    vector<T> columns(geometry.batch * rows * out_size);
+                    Eigen::TensorOpCost cost(2 * kernel_size * sizeof(T) + rows * 4 * sizeof(T),
+                                             rows * sizeof(T),
+                                             kernel_size * 20 + rows * 8);
+                    for (size_t g = 0; g < geometry.group; g++)
+                    {
+                        executor::GetCPUExecutor().get_device(ectx->arena).parallelFor(
+                            geometry.batch * out_size,
+                            cost,
+                            [&](Eigen::Index begin, Eigen::Index end) {
+                                reference::deformable_im2col(data,
+                                                             offsets,
+                                                             columns.data(),
+                                                             geometry,
+                                                             g,
+                                                             static_cast<size_t>(begin),
+                                                             static_cast<size_t>(end));
+                            });
+                        for (size_t n = 0; n < geometry.batch; n++)
+                        {
+                            gemm(filters + g * group_filters * rows,
+                                 columns.data() + n * rows * out_size,
+                                 result + (n * geometry.filters + g * group_filters) * out_size,
+                                 group_filters,
+                                 out_size,
+                                 rows);
+                        }
+                    }
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::v1::DeformableConvolution)
+            {
+                auto element_type = args[0].get_element_type();
+                if (element_type == element::f32)
+                {
+                    build_deformable_convolution<float>(external_function, node, args, out);
+                }
+                else if (element_type == element::f64)
+                {
+                    build_deformable_convolution<double>(external_function, node, args, out);
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported element type (" +
+                                       element_type.get_type_name() +
+                                       ") in CPU Builder for DeformableConvolution");
+                }
+            }
+
+            void register_builders_deformable_convolution_cpp()
+            {
+                REGISTER_OP_BUILDER(ngraph::op::v1::DeformableConvolution);
+            }
+        }
+    }
+}
@@ -0,0 +1,148 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/op/detection_output.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/reference/detection_output.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::v0::DetectionOutput)
+            {
+                auto& functors = external_function->get_functors();
+                auto detection = static_cast<const ngraph::op::v0::DetectionOutput*>(node);
+                if (args[0].get_element_type() != element::f32)
+                {
+                    throw ngraph_error("Unsupported type (" +
+                                       args[0].get_element_type().get_type_name() +
+                                       ") in CPU Builder for DetectionOutput");
+                }
+                vector<size_t> buffer_indices;
+                for (const auto& arg : args)
+                {
+                    buffer_indices.push_back(external_function->get_buffer_index(arg.get_name()));
+                }
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                bool has_aux_inputs = args.size() == 5;
+                auto attrs = detection->get_attrs();
+                auto shape = runtime::reference::detection_output_shape(
+                    attrs, args[0].get_shape(), args[2].get_shape());
+                size_t out_rows = shape_size(out[0].get_shape()) / 7;
+
+                // Boxes are decoded per image and location class, then suppressed per image
+                // and class, both in parallel on the executor of the arena. Only keep_top_k
+                // and the output rows are left to a single thread.
+                auto functor = [=](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    const float* box_logits =
+                        static_cast<const float*>(ctx->buffer_data[buffer_indices[0]]);
+                    const float* class_preds =
+                        static_cast<const float*>(ctx->buffer_data[buffer_indices[1]]);
+                    const float* proposals =
+                        static_cast<const float*>(ctx->buffer_data[buffer_indices[2]]);
+                    const float* arm_conf =
+                        has_aux_inputs
+                            ? static_cast<const float*>(ctx->buffer_data[buffer_indices[3]])
+                            : nullptr;
+                    const float* arm_loc =
+                        has_aux_inputs
+                            ? static_cast<const float*>(ctx->buffer_data[buffer_indices[4]])
+                            : nullptr;
+                    auto& device = executor::GetCPUExecutor().get_device(ectx->arena);
+
+                    size_t decode_tasks = shape.num_images * shape.num_loc_classes;
+                    vector<runtime::reference::DetectionBoxes> boxes(decode_tasks);
+                    Eigen::TensorOpCost decode_cost(shape.num_priors * 12 * sizeof(float),
+                                                    shape.num_priors * 4 * sizeof(float),
+                                                    shape.num_priors * 16);
+                    device.parallelFor(
+                        decode_tasks, decode_cost, [&](Eigen::Index begin, Eigen::Index end) {
+                            for (size_t i = static_cast<size_t>(begin);
+                                 i < static_cast<size_t>(end);
+                                 i++)
+                            {
+                                runtime::reference::decode_detection_boxes(
+                                    box_logits,
+                                    proposals,
+                                    arm_loc,
+                                    attrs,
+                                    shape,
+                                    i / shape.num_loc_classes,
+                                    i % shape.num_loc_classes,
+                                    boxes[i]);
+                            }
+                        });
+
+                    size_t nms_tasks = shape.num_images * shape.num_classes;
+                    vector<vector<pair<float, int64_t>>> kept(nms_tasks);
+                    Eigen::TensorOpCost nms_cost(
+                        shape.num_priors * 5 * sizeof(float), 0, shape.num_priors * 32);
+                    device.parallelFor(
+                        nms_tasks, nms_cost, [&](Eigen::Index begin, Eigen::Index end) {
+                            runtime::reference::NMSCandidates candidates;
+                            for (size_t i = static_cast<size_t>(begin);
+                                 i < static_cast<size_t>(end);
+                                 i++)
+                            {
+                                size_t image = i / shape.num_classes;
+                                size_t cls = i % shape.num_classes;
+                                if (static_cast<int>(cls) == attrs.background_label_id)
+                                {
+                                    continue;
+                                }
+                                size_t loc_class = attrs.share_location ? 0 : cls;
+                                runtime::reference::detection_class_nms(
+                                    class_preds,
+                                    arm_conf,
+                                    boxes[image * shape.num_loc_classes + loc_class],
+                                    attrs,
+                                    shape,
+                                    image,
+                                    cls,
+                                    candidates,
+                                    kept[i]);
+                            }
+                        });
+
+                    runtime::reference::detection_output_write(
+                        kept,
+                        boxes,
+                        attrs,
+                        shape,
+                        static_cast<float*>(ctx->buffer_data[out_buffer_index]),
+                        out_rows);
+                };
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_detection_output_cpp()
+            {
+                REGISTER_OP_BUILDER(ngraph::op::v0::DetectionOutput);
+            }
+        }
+    }
+}
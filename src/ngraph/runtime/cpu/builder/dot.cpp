@@ -19,7 +19,10 @@
 
 #include "ngraph/op/dot.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_kernels.hpp"
+#include "ngraph/runtime/cpu/dnnl_invoke.hpp"
+#include "ngraph/runtime/cpu/dnnl_utils.hpp"
 #include "ngraph/runtime/cpu/kernel/dot.hpp"
 
 using namespace std;
@@ -191,6 +194,57 @@ namespace ngraph
                     return;
                 }
 
+                // bf16 matrix products run as a DNNL inner product, which accumulates in f32
+                if (args[0].get_element_type() == element::bf16 &&
+                    args[1].get_element_type() == element::bf16 && (arg0_shape.size() == 2) &&
+                    (arg1_shape.size() == 2) && reduction_axes_count == 1 &&
+                    runtime::cpu::dnnl_utils::is_bf16_supported())
+                {
+                    auto& dnnl_emitter = external_function->get_dnnl_emitter();
+                    auto ip_desc = dnnl_emitter->get_dot_inner_product_forward_desc(node);
+                    dnnl::primitive_attr ip_attr;
+                    ip_attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
+                    size_t scratchpad_size = QUERY_SCRATCHPAD_2ARGS(ip_forward, ip_desc, ip_attr);
+
+                    size_t ip_index = dnnl_emitter->inner_product_forward_init(false);
+                    auto& deps = dnnl_emitter->get_primitive_deps(ip_index);
+
+                    auto functor = [&,
+                                    ip_desc,
+                                    ip_attr,
+                                    deps,
+                                    ip_index,
+                                    scratchpad_size,
+                                    arg0_buffer_index,
+                                    arg1_buffer_index,
+                                    out_buffer_index](CPURuntimeContext* ctx,
+                                                      CPUExecutionContext* /* ectx */) {
+                        if (ctx->dnnl_primitives[ip_index] == nullptr)
+                        {
+                            dnnl_emitter->build_inner_product_forward<false>(
+                                ctx->dnnl_memories,
+                                ctx->dnnl_primitives,
+                                ctx->dnnl_scratchpad_mds,
+                                ip_desc,
+                                ip_attr,
+                                executor::get_cpu_engine(),
+                                deps,
+                                ip_index);
+                        }
+                        cpu::dnnl_utils::set_memory_ptr(
+                            ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
+                        cpu::dnnl_utils::set_memory_ptr(
+                            ctx, deps[1], ctx->buffer_data[arg1_buffer_index]);
+                        cpu::dnnl_utils::set_memory_ptr(
+                            ctx, deps[2], ctx->buffer_data[out_buffer_index]);
+
+                        cpu::dnnl_utils::dnnl_invoke_primitive(
+                            ctx, ip_index, deps, cpu::dnnl_utils::OpType::DOT, scratchpad_size);
+                    };
+                    functors.emplace_back(functor);
+                    return;
+                }
+
                 if (out[0].get_element_type() == element::f32 && (arg0_shape.size() == 2) &&
                     (arg1_shape.size() == 2) && reduction_axes_count == 1)
                 {
@@ -17,6 +17,7 @@
 #include "ngraph/runtime/cpu/op/dropout.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/kernel/dropout.hpp"
+#include "ngraph/state/uniform_rng_state.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -43,27 +44,18 @@ namespace ngraph
 
                 size_t element_count = out[0].get_size();
 
+                // Without a seed the masks of successive calls continue one random sequence,
+                // with one every call gets the mask at the start of the sequence of the seed
                 bool use_seed = drop->get_use_seed();
-
-                // Note: for performance optimization in addition to parallel RNG with multiple,
-                // threads, we create, initialize and advance each msr here in builder instead of
-                // in kernel. By doing so here, we saved 30% vs. kernel
-                // msr.discard() has the biggest impact on performance.
-                // But we need discard only when use_seed==true to generate same mask.
-                size_t nthr = ngraph::runtime::cpu::executor::GetCPUExecutor().get_num_cores();
-                size_t chunk_size = (element_count + nthr - 1) / nthr;
-                std::vector<std::minstd_rand> vmsr(nthr);
-                if (use_seed)
-                {
-                    uint64_t seed = drop->get_seed();
-                    for (size_t i = 0; i < nthr; i++)
-                    {
-                        std::minstd_rand msr;
-                        msr.seed(seed);
-                        msr.discard(i * chunk_size);
-                        vmsr[i] = msr;
-                    }
-                }
+                uint64_t seed = drop->get_seed();
+                auto index = external_function->get_node_state_index(
+                    node, [use_seed, seed]() -> ngraph::State* {
+                        return use_seed ? new ngraph::UniformRNGState(seed)
+                                        : new ngraph::UniformRNGState();
+                    });
+                // A DropoutBackprop regenerates the mask, which is not written when nothing
+                // else reads it
+                bool write_mask = !node->get_output_target_inputs(1).empty();
 
                 if (args[0].get_element_type() == element::f32)
                 {
@@ -74,21 +66,26 @@ namespace ngraph
                                arg4_buffer_index,
                                out0_buffer_index,
                                out1_buffer_index,
-                               vmsr,
-                               use_seed](CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {
+                               index,
+                               use_seed,
+                               write_mask](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
                         bool training = static_cast<bool>(
                             static_cast<float*>(ctx->buffer_data[arg1_buffer_index])[0]);
                         double keep_prob =
                             static_cast<double*>(ctx->buffer_data[arg4_buffer_index])[0];
+                        auto state = static_cast<UniformRNGState*>(ctx->states[index]);
                         runtime::cpu::kernel::generate_dropout(
                             static_cast<float*>(ctx->buffer_data[arg_buffer_index]),
                             static_cast<float*>(ctx->buffer_data[out0_buffer_index]),
-                            static_cast<float*>(ctx->buffer_data[out1_buffer_index]),
+                            write_mask
+                                ? static_cast<float*>(ctx->buffer_data[out1_buffer_index])
+                                : nullptr,
                             element_count,
                             training,
                             keep_prob,
-                            vmsr,
-                            use_seed);
+                            state->get_generator(),
+                            use_seed || !training ? 0 : state->advance(element_count),
+                            ectx->arena);
                     };
                 }
                 else if (args[0].get_element_type() == element::f64)
@@ -100,21 +97,26 @@ namespace ngraph
                                arg4_buffer_index,
                                out0_buffer_index,
                                out1_buffer_index,
-                               vmsr,
-                               use_seed](CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {
+                               index,
+                               use_seed,
+                               write_mask](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
                         bool training = static_cast<bool>(
                             static_cast<double*>(ctx->buffer_data[arg1_buffer_index])[0]);
                         double keep_prob =
                             static_cast<double*>(ctx->buffer_data[arg4_buffer_index])[0];
+                        auto state = static_cast<UniformRNGState*>(ctx->states[index]);
                         runtime::cpu::kernel::generate_dropout(
                             static_cast<double*>(ctx->buffer_data[arg_buffer_index]),
                             static_cast<double*>(ctx->buffer_data[out0_buffer_index]),
-                            static_cast<double*>(ctx->buffer_data[out1_buffer_index]),
+                            write_mask
+                                ? static_cast<double*>(ctx->buffer_data[out1_buffer_index])
+                                : nullptr,
                             element_count,
                             training,
                             keep_prob,
-                            vmsr,
-                            use_seed);
+                            state->get_generator(),
+                            use_seed || !training ? 0 : state->advance(element_count),
+                            ectx->arena);
                     };
                 }
                 else
@@ -125,7 +127,106 @@ namespace ngraph
                 functors.emplace_back(functor);
             }
 
-            void register_builders_dropout_cpp() { REGISTER_OP_BUILDER(ngraph::op::Dropout); }
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::DropoutBackprop)
+            {
+                auto& functors = external_function->get_functors();
+
+                auto backprop = static_cast<const ngraph::op::DropoutBackprop*>(node);
+                auto forward = backprop->get_forward();
+                NGRAPH_CHECK(forward != nullptr,
+                             "DropoutBackprop ",
+                             node->get_name(),
+                             " has lost the control dependency on its forward Dropout");
+                CPUKernelFunctor functor;
+
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto arg4_buffer_index = external_function->get_buffer_index(args[4].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                size_t element_count = out[0].get_size();
+                bool scale = backprop->get_scale();
+
+                // The state of the forward op, whose functor has advanced it earlier in the call
+                bool use_seed = forward->get_use_seed();
+                uint64_t seed = forward->get_seed();
+                auto index = external_function->get_node_state_index(
+                    forward.get(), [use_seed, seed]() -> ngraph::State* {
+                        return use_seed ? new ngraph::UniformRNGState(seed)
+                                        : new ngraph::UniformRNGState();
+                    });
+
+                if (args[0].get_element_type() == element::f32)
+                {
+                    functor = [&,
+                               element_count,
+                               arg_buffer_index,
+                               arg1_buffer_index,
+                               arg4_buffer_index,
+                               out_buffer_index,
+                               index,
+                               use_seed,
+                               scale](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        bool training = static_cast<bool>(
+                            static_cast<float*>(ctx->buffer_data[arg1_buffer_index])[0]);
+                        double keep_prob =
+                            static_cast<double*>(ctx->buffer_data[arg4_buffer_index])[0];
+                        auto state = static_cast<UniformRNGState*>(ctx->states[index]);
+                        runtime::cpu::kernel::dropout_backprop(
+                            static_cast<float*>(ctx->buffer_data[arg_buffer_index]),
+                            static_cast<float*>(ctx->buffer_data[out_buffer_index]),
+                            element_count,
+                            training,
+                            keep_prob,
+                            scale,
+                            state->get_generator(),
+                            use_seed || !training ? 0 : state->get_last_offset(),
+                            ectx->arena);
+                    };
+                }
+                else if (args[0].get_element_type() == element::f64)
+                {
+                    functor = [&,
+                               element_count,
+                               arg_buffer_index,
+                               arg1_buffer_index,
+                               arg4_buffer_index,
+                               out_buffer_index,
+                               index,
+                               use_seed,
+                               scale](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        bool training = static_cast<bool>(
+                            static_cast<double*>(ctx->buffer_data[arg1_buffer_index])[0]);
+                        double keep_prob =
+                            static_cast<double*>(ctx->buffer_data[arg4_buffer_index])[0];
+                        auto state = static_cast<UniformRNGState*>(ctx->states[index]);
+                        runtime::cpu::kernel::dropout_backprop(
+                            static_cast<double*>(ctx->buffer_data[arg_buffer_index]),
+                            static_cast<double*>(ctx->buffer_data[out_buffer_index]),
+                            element_count,
+                            training,
+                            keep_prob,
+                            scale,
+                            state->get_generator(),
+                            use_seed || !training ? 0 : state->get_last_offset(),
+                            ectx->arena);
+                    };
+                }
+                else
+                {
+                    throw ngraph_error(std::string("Unsupported type") +
+                                       args[0].get_element_type().c_type_string() +
+                                       "for DropoutBackprop");
+                }
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_dropout_cpp()
+            {
+                REGISTER_OP_BUILDER(ngraph::op::Dropout);
+                REGISTER_OP_BUILDER(ngraph::op::DropoutBackprop);
+            }
         }
     }
 }
@@ -0,0 +1,84 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/kernel/elementwise_chain.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/op/elementwise_chain.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::ElementwiseChain)
+            {
+                auto& functors = external_function->get_functors();
+
+                auto chain = static_cast<const ngraph::op::ElementwiseChain*>(node);
+                auto steps = chain->get_steps();
+
+                vector<size_t> arg_buffer_indices;
+                for (auto& arg : args)
+                {
+                    arg_buffer_indices.push_back(
+                        external_function->get_buffer_index(arg.get_name()));
+                }
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                auto element_count = out[0].get_size();
+
+                std::function<decltype(runtime::cpu::kernel::elementwise_chain<float>)> kernel;
+                if (out[0].get_element_type() == element::f32)
+                {
+                    kernel = runtime::cpu::kernel::elementwise_chain<float>;
+                }
+                else if (out[0].get_element_type() == element::f64)
+                {
+                    kernel = runtime::cpu::kernel::elementwise_chain<double>;
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported element type for ElementwiseChain");
+                }
+
+                auto functor =
+                    [&, kernel, steps, arg_buffer_indices, out_buffer_index, element_count](
+                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        vector<void*> inputs;
+                        for (auto index : arg_buffer_indices)
+                        {
+                            inputs.push_back(ctx->buffer_data[index]);
+                        }
+                        kernel(inputs,
+                               ctx->buffer_data[out_buffer_index],
+                               element_count,
+                               steps,
+                               ectx->arena);
+                    };
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_elementwise_chain_cpp()
+            {
+                REGISTER_OP_BUILDER(ngraph::op::ElementwiseChain);
+            }
+        }
+    }
+}
@@ -0,0 +1,245 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/op/embedding_segments_sum.hpp"
+#include "ngraph/op/embeddingbag_offsets_sum.hpp"
+#include "ngraph/op/embeddingbag_packedsum.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/reference/embedding_bag.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            // Buffer indices of the inputs of an embedding bag op; optional inputs that are
+            // not connected are marked with no_input
+            static const size_t no_input = numeric_limits<size_t>::max();
+
+            static vector<size_t>
+                embedding_bag_buffer_indices(CPU_ExternalFunction* external_function,
+                                             const vector<TensorWrapper>& args,
+                                             size_t input_count)
+            {
+                vector<size_t> indices(input_count, no_input);
+                for (size_t i = 0; i < args.size() && i < input_count; i++)
+                {
+                    indices[i] = external_function->get_buffer_index(args[i].get_name());
+                }
+                return indices;
+            }
+
+            template <typename T>
+            static const T* optional_buffer(CPURuntimeContext* ctx, size_t buffer_index)
+            {
+                return buffer_index == no_input
+                           ? nullptr
+                           : static_cast<const T*>(ctx->buffer_data[buffer_index]);
+            }
+
+            // Bags are pooled in parallel on the executor of the arena; each bag gathers
+            // about indices_count / bags rows of row_size elements
+            template <typename T>
+            static void parallel_bags(int arena,
+                                      size_t bags,
+                                      size_t indices_count,
+                                      size_t row_size,
+                                      const function<void(size_t, size_t)>& kernel)
+            {
+                double rows_per_bag = bags == 0 ? 0.0 : static_cast<double>(indices_count) / bags;
+                Eigen::TensorOpCost cost(rows_per_bag * row_size * sizeof(T),
+                                         row_size * sizeof(T),
+                                         rows_per_bag * row_size);
+                executor::GetCPUExecutor().get_device(arena).parallelFor(
+                    bags, cost, [&](Eigen::Index begin, Eigen::Index end) {
+                        kernel(static_cast<size_t>(begin), static_cast<size_t>(end));
+                    });
+            }
+
+            template <typename T, typename U>
+            static CPUKernelFunctor embedding_bag_offsets_sum_functor(
+                const vector<size_t>& buffer_indices,
+                size_t indices_count,
+                const Shape& out_shape,
+                size_t out_buffer_index)
+            {
+                size_t row_size = out_shape.at(0) == 0 ? 0 : shape_size(out_shape) / out_shape[0];
+                return [buffer_indices, indices_count, out_shape, row_size, out_buffer_index](
+                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    parallel_bags<T>(
+                        ectx->arena,
+                        out_shape[0],
+                        indices_count,
+                        row_size,
+                        [&](size_t begin, size_t end) {
+                            runtime::reference::embedding_bag_offsets_sum<T, U>(
+                                static_cast<const T*>(ctx->buffer_data[buffer_indices[0]]),
+                                static_cast<const U*>(ctx->buffer_data[buffer_indices[1]]),
+                                static_cast<const U*>(ctx->buffer_data[buffer_indices[2]]),
+                                optional_buffer<U>(ctx, buffer_indices[3]),
+                                optional_buffer<T>(ctx, buffer_indices[4]),
+                                static_cast<T*>(ctx->buffer_data[out_buffer_index]),
+                                indices_count,
+                                out_shape,
+                                begin,
+                                end);
+                        });
+                };
+            }
+
+            template <typename T, typename U>
+            static CPUKernelFunctor embedding_bag_packed_sum_functor(
+                const vector<size_t>& buffer_indices,
+                const Shape& indices_shape,
+                const Shape& out_shape,
+                size_t out_buffer_index)
+            {
+                size_t row_size = out_shape.at(0) == 0 ? 0 : shape_size(out_shape) / out_shape[0];
+                return [buffer_indices, indices_shape, out_shape, row_size, out_buffer_index](
+                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    parallel_bags<T>(
+                        ectx->arena,
+                        out_shape[0],
+                        shape_size(indices_shape),
+                        row_size,
+                        [&](size_t begin, size_t end) {
+                            runtime::reference::embedding_bag_packed_sum<T, U>(
+                                static_cast<const T*>(ctx->buffer_data[buffer_indices[0]]),
+                                static_cast<const U*>(ctx->buffer_data[buffer_indices[1]]),
+                                optional_buffer<T>(ctx, buffer_indices[2]),
+                                static_cast<T*>(ctx->buffer_data[out_buffer_index]),
+                                indices_shape,
+                                out_shape,
+                                begin,
+                                end);
+                        });
+                };
+            }
+
+            template <typename T, typename U>
+            static CPUKernelFunctor embedding_segments_sum_functor(
+                const vector<size_t>& buffer_indices,
+                size_t indices_count,
+                const Shape& out_shape,
+                size_t out_buffer_index)
+            {
+                size_t row_size = out_shape.at(0) == 0 ? 0 : shape_size(out_shape) / out_shape[0];
+                return [buffer_indices, indices_count, out_shape, row_size, out_buffer_index](
+                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    parallel_bags<T>(
+                        ectx->arena,
+                        out_shape[0],
+                        indices_count,
+                        row_size,
+                        [&](size_t begin, size_t end) {
+                            runtime::reference::embedding_segments_sum<T, U>(
+                                static_cast<const T*>(ctx->buffer_data[buffer_indices[0]]),
+                                static_cast<const U*>(ctx->buffer_data[buffer_indices[1]]),
+                                static_cast<const U*>(ctx->buffer_data[buffer_indices[2]]),
+                                optional_buffer<U>(ctx, buffer_indices[4]),
+                                optional_buffer<T>(ctx, buffer_indices[5]),
+                                static_cast<T*>(ctx->buffer_data[out_buffer_index]),
+                                indices_count,
+                                out_shape,
+                                begin,
+                                end);
+                        });
+                };
+            }
+
+// Instantiates FUNCTOR for the element type of the table and the type of the indices
+#define EMBEDDING_BAG_FUNCTOR(FUNCTOR, ...)                                                        \
+    [&]() -> CPUKernelFunctor {                                                                    \
+        auto element_type = out[0].get_element_type();                                             \
+        bool i64_indices = args[1].get_element_type() == element::i64;                             \
+        if (element_type == element::f32)                                                          \
+        {                                                                                          \
+            return i64_indices ? FUNCTOR<float, int64_t>(__VA_ARGS__)                              \
+                               : FUNCTOR<float, int32_t>(__VA_ARGS__);                             \
+        }                                                                                          \
+        else if (element_type == element::f64)                                                     \
+        {                                                                                          \
+            return i64_indices ? FUNCTOR<double, int64_t>(__VA_ARGS__)                             \
+                               : FUNCTOR<double, int32_t>(__VA_ARGS__);                            \
+        }                                                                                          \
+        throw ngraph_error("Unsupported element type " + element_type.c_type_string() +            \
+                           " in CPU Builder for " + node->description());                          \
+    }()
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::v3::EmbeddingBagOffsetsSum)
+            {
+                auto& functors = external_function->get_functors();
+                auto buffer_indices = embedding_bag_buffer_indices(external_function, args, 5);
+                size_t indices_count = shape_size(args[1].get_shape());
+                auto out_shape = out[0].get_shape();
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                functors.emplace_back(EMBEDDING_BAG_FUNCTOR(embedding_bag_offsets_sum_functor,
+                                                            buffer_indices,
+                                                            indices_count,
+                                                            out_shape,
+                                                            out_buffer_index));
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::v3::EmbeddingBagPackedSum)
+            {
+                auto& functors = external_function->get_functors();
+                auto buffer_indices = embedding_bag_buffer_indices(external_function, args, 3);
+                auto indices_shape = args[1].get_shape();
+                auto out_shape = out[0].get_shape();
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                functors.emplace_back(EMBEDDING_BAG_FUNCTOR(embedding_bag_packed_sum_functor,
+                                                            buffer_indices,
+                                                            indices_shape,
+                                                            out_shape,
+                                                            out_buffer_index));
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::v3::EmbeddingSegmentsSum)
+            {
+                auto& functors = external_function->get_functors();
+                auto buffer_indices = embedding_bag_buffer_indices(external_function, args, 6);
+                size_t indices_count = shape_size(args[1].get_shape());
+                auto out_shape = out[0].get_shape();
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                functors.emplace_back(EMBEDDING_BAG_FUNCTOR(embedding_segments_sum_functor,
+                                                            buffer_indices,
+                                                            indices_count,
+                                                            out_shape,
+                                                            out_buffer_index));
+            }
+
+#undef EMBEDDING_BAG_FUNCTOR
+
+            void register_builders_embedding_bag_cpp()
+            {
+                REGISTER_OP_BUILDER(ngraph::op::v3::EmbeddingBagOffsetsSum);
+                REGISTER_OP_BUILDER(ngraph::op::v3::EmbeddingBagPackedSum);
+                REGISTER_OP_BUILDER(ngraph::op::v3::EmbeddingSegmentsSum);
+            }
+        }
+    }
+}
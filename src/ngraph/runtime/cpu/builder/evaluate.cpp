@@ -0,0 +1,137 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/log.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/host_tensor.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            bool can_build_evaluate(const ngraph::Node* node)
+            {
+                for (auto& output : node->outputs())
+                {
+                    if (output.get_partial_shape().is_dynamic() ||
+                        output.get_element_type().is_dynamic())
+                    {
+                        return false;
+                    }
+                }
+
+                // Ops don't tell whether they implement evaluate, so run it once on zeroed
+                // buffers, or the data of constant inputs
+                vector<vector<char>> buffers;
+                HostTensorVector inputs;
+                for (auto& input : node->inputs())
+                {
+                    if (input.get_partial_shape().is_dynamic() ||
+                        input.get_element_type().is_dynamic())
+                    {
+                        return false;
+                    }
+                    auto constant = as_type_ptr<ngraph::op::v0::Constant>(
+                        input.get_source_output().get_node_shared_ptr());
+                    if (constant)
+                    {
+                        inputs.push_back(make_shared<HostTensor>(constant));
+                    }
+                    else
+                    {
+                        buffers.emplace_back(shape_size(input.get_shape()) *
+                                             input.get_element_type().size());
+                        inputs.push_back(make_shared<HostTensor>(
+                            input.get_element_type(), input.get_shape(), buffers.back().data()));
+                    }
+                }
+                HostTensorVector outputs;
+                for (auto& output : node->outputs())
+                {
+                    outputs.push_back(
+                        make_shared<HostTensor>(output.get_element_type(), output.get_shape()));
+                }
+
+                try
+                {
+                    return node->evaluate(outputs, inputs);
+                }
+                catch (const exception& e)
+                {
+                    NGRAPH_DEBUG << node->get_name() << " can't be evaluated: " << e.what();
+                    return false;
+                }
+            }
+
+            void build_evaluate(CPU_ExternalFunction* external_function,
+                                const ngraph::Node* node,
+                                const vector<TensorWrapper>& args,
+                                const vector<TensorWrapper>& out)
+            {
+                NGRAPH_DEBUG << "Running " << node->get_name() << " through Node::evaluate";
+
+                struct TensorDesc
+                {
+                    size_t buffer_index;
+                    element::Type type;
+                    Shape shape;
+                };
+                vector<TensorDesc> arg_descs;
+                for (const auto& arg : args)
+                {
+                    arg_descs.push_back({external_function->get_buffer_index(arg.get_name()),
+                                         arg.get_element_type(),
+                                         arg.get_shape()});
+                }
+                vector<TensorDesc> out_descs;
+                for (const auto& output : out)
+                {
+                    out_descs.push_back({external_function->get_buffer_index(output.get_name()),
+                                         output.get_element_type(),
+                                         output.get_shape()});
+                }
+
+                // Keeps the node alive for as long as the functor
+                auto evaluated = node->shared_from_this();
+                auto& functors = external_function->get_functors();
+                auto functor = [evaluated, arg_descs, out_descs](CPURuntimeContext* ctx,
+                                                                 CPUExecutionContext* /* ectx */) {
+                    auto wrap = [ctx](const vector<TensorDesc>& descs) {
+                        HostTensorVector tensors;
+                        for (const auto& desc : descs)
+                        {
+                            tensors.push_back(make_shared<HostTensor>(
+                                desc.type, desc.shape, ctx->buffer_data[desc.buffer_index]));
+                        }
+                        return tensors;
+                    };
+                    if (!evaluated->evaluate(wrap(out_descs), wrap(arg_descs)))
+                    {
+                        throw unsupported_op("Evaluate failed for '" + evaluated->description() +
+                                             "' in CPU builder");
+                    }
+                };
+                functors.emplace_back(functor);
+            }
+        }
+    }
+}
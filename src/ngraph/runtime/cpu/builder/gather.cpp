@@ -19,7 +19,6 @@
 #include "ngraph/op/gather.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/kernel/gather.hpp"
-#include "ngraph/runtime/reference/gather.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -30,212 +29,61 @@ namespace ngraph
     {
         namespace cpu
         {
-            namespace
-            {
-                template <typename T>
-                CPUKernelFunctor prepare_functor(const Node* node,
-                                                 const vector<TensorWrapper>& args,
-                                                 const vector<TensorWrapper>& out,
-                                                 CPU_ExternalFunction* external_function)
-                {
-                    const ngraph::op::v0::Gather* gather =
-                        static_cast<const ngraph::op::v0::Gather*>(node);
-                    auto params_buffer_index =
-                        external_function->get_buffer_index(args[0].get_name());
-                    auto indices_buffer_index =
-                        external_function->get_buffer_index(args[1].get_name());
-                    auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
-
-                    bool is_int64 = args[1].get_element_type() == element::i64;
-                    auto axis = gather->get_axis();
-                    auto params_shape = args[0].get_shape();
-                    auto indices_shape = args[1].get_shape();
-                    auto out_shape = out[0].get_shape();
-
-                    if (is_int64)
-                    {
-                        if ((args[0].get_element_type() == element::f32 ||
-                             args[0].get_element_type() == element::f64 ||
-                             args[0].get_element_type() == element::u8 ||
-                             args[0].get_element_type() == element::i8) &&
-                            params_shape.size() <= 3 && out_shape.size() <= 5 &&
-                            is_optimized_et(args[0].get_element_type()))
-                        {
-                            std::function<decltype(runtime::cpu::kernel::gather_i64<float, 2, 2>)>
-                                kernel;
-
-                            SELECT_RANK35_ET4(kernel,
-                                              args[0].get_element_type(),
-                                              params_shape.size(),
-                                              out_shape.size(),
-                                              runtime::cpu::kernel::gather_i64);
-
-                            return [&,
-                                    kernel,
-                                    params_shape,
-                                    indices_shape,
-                                    out_shape,
-                                    axis,
-                                    params_buffer_index,
-                                    indices_buffer_index,
-                                    out_buffer_index](CPURuntimeContext* ctx,
-                                                      CPUExecutionContext* ectx) {
-                                kernel(ctx->buffer_data[params_buffer_index],
-                                       ctx->buffer_data[indices_buffer_index],
-                                       ctx->buffer_data[out_buffer_index],
-                                       params_shape,
-                                       indices_shape,
-                                       out_shape,
-                                       axis,
-                                       ectx->arena);
-                            };
-                        }
-                        else
-                        {
-                            return [&,
-                                    params_shape,
-                                    indices_shape,
-                                    out_shape,
-                                    axis,
-                                    params_buffer_index,
-                                    indices_buffer_index,
-                                    out_buffer_index](CPURuntimeContext* ctx,
-                                                      CPUExecutionContext* /* ectx */) {
-                                ngraph::runtime::reference::gather<T, int64_t>(
-                                    static_cast<T*>(ctx->buffer_data[params_buffer_index]),
-                                    static_cast<int64_t*>(ctx->buffer_data[indices_buffer_index]),
-                                    static_cast<T*>(ctx->buffer_data[out_buffer_index]),
-                                    params_shape,
-                                    indices_shape,
-                                    out_shape,
-                                    axis);
-                            };
-                        }
-                    }
-
-                    else
-                    {
-                        if ((args[0].get_element_type() == element::f32 ||
-                             args[0].get_element_type() == element::f64 ||
-                             args[0].get_element_type() == element::u8 ||
-                             args[0].get_element_type() == element::i8) &&
-                            params_shape.size() <= 3 && out_shape.size() <= 5 &&
-                            is_optimized_et(args[0].get_element_type()))
-                        {
-                            std::function<decltype(runtime::cpu::kernel::gather_i32<float, 2, 2>)>
-                                kernel;
-
-                            SELECT_RANK35_ET4(kernel,
-                                              args[0].get_element_type(),
-                                              params_shape.size(),
-                                              out_shape.size(),
-                                              runtime::cpu::kernel::gather_i32);
-
-                            return [&,
-                                    kernel,
-                                    params_shape,
-                                    indices_shape,
-                                    out_shape,
-                                    axis,
-                                    params_buffer_index,
-                                    indices_buffer_index,
-                                    out_buffer_index](CPURuntimeContext* ctx,
-                                                      CPUExecutionContext* ectx) {
-                                kernel(ctx->buffer_data[params_buffer_index],
-                                       ctx->buffer_data[indices_buffer_index],
-                                       ctx->buffer_data[out_buffer_index],
-                                       params_shape,
-                                       indices_shape,
-                                       out_shape,
-                                       axis,
-                                       ectx->arena);
-                            };
-                        }
-                        else
-                        {
-                            return [&,
-                                    params_shape,
-                                    indices_shape,
-                                    out_shape,
-                                    axis,
-                                    params_buffer_index,
-                                    indices_buffer_index,
-                                    out_buffer_index](CPURuntimeContext* ctx,
-                                                      CPUExecutionContext* /* ectx */) {
-                                ngraph::runtime::reference::gather<T, int32_t>(
-                                    static_cast<T*>(ctx->buffer_data[params_buffer_index]),
-                                    static_cast<int32_t*>(ctx->buffer_data[indices_buffer_index]),
-                                    static_cast<T*>(ctx->buffer_data[out_buffer_index]),
-                                    params_shape,
-                                    indices_shape,
-                                    out_shape,
-                                    axis);
-                            };
-                        }
-                    }
-                }
-            }
-
             template <>
             void Builder::BUILDER_DECL(ngraph::op::v0::Gather)
             {
                 auto& functors = external_function->get_functors();
-                CPUKernelFunctor functor;
                 if (args[1].get_element_type() != element::i64 &&
                     args[1].get_element_type() != element::i32)
                 {
                     throw ngraph_error("Unsupported index element type");
                 }
-                auto element_type = args[0].get_element_type();
-                if (element_type == element::f32)
-                {
-                    functor = prepare_functor<float>(node, args, out, external_function);
-                }
-                else if (element_type == element::i64)
-                {
-                    functor = prepare_functor<int64_t>(node, args, out, external_function);
-                }
-                else if (element_type == element::f64)
-                {
-                    functor = prepare_functor<double>(node, args, out, external_function);
-                }
-                else if (element_type == element::i8)
-                {
-                    functor = prepare_functor<int8_t>(node, args, out, external_function);
-                }
-                else if (element_type == element::i16)
-                {
-                    functor = prepare_functor<int16_t>(node, args, out, external_function);
-                }
-                else if (element_type == element::i32)
-                {
-                    functor = prepare_functor<int32_t>(node, args, out, external_function);
-                }
-                else if (element_type == element::u8)
-                {
-                    functor = prepare_functor<uint8_t>(node, args, out, external_function);
-                }
-                else if (element_type == element::u16)
-                {
-                    functor = prepare_functor<uint16_t>(node, args, out, external_function);
-                }
-                else if (element_type == element::u32)
-                {
-                    functor = prepare_functor<uint32_t>(node, args, out, external_function);
-                }
-                else if (element_type == element::u64)
-                {
-                    functor = prepare_functor<uint64_t>(node, args, out, external_function);
-                }
-                else if (element_type == element::boolean)
+
+                const ngraph::op::v0::Gather* gather =
+                    static_cast<const ngraph::op::v0::Gather*>(node);
+                auto params_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto indices_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                // Every element type is gathered as rows of bytes after the axis
+                auto axis = gather->get_axis();
+                auto params_shape = args[0].get_shape();
+                size_t outer = shape_size(Shape(params_shape.begin(), params_shape.begin() + axis));
+                size_t axis_length = params_shape[axis];
+                size_t num_indices = shape_size(args[1].get_shape());
+                size_t row_bytes =
+                    shape_size(Shape(params_shape.begin() + axis + 1, params_shape.end())) *
+                    args[0].get_element_type().size();
+
+                std::function<decltype(runtime::cpu::kernel::gather_rows<int64_t>)> kernel;
+                if (args[1].get_element_type() == element::i64)
                 {
-                    functor = prepare_functor<char>(node, args, out, external_function);
+                    kernel = runtime::cpu::kernel::gather_rows<int64_t>;
                 }
                 else
                 {
-                    throw ngraph_error("Unsupported type in CPU Builder for Gather");
+                    kernel = runtime::cpu::kernel::gather_rows<int32_t>;
                 }
 
+                auto functor = [&,
+                                kernel,
+                                outer,
+                                axis_length,
+                                num_indices,
+                                row_bytes,
+                                params_buffer_index,
+                                indices_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[params_buffer_index],
+                           ctx->buffer_data[indices_buffer_index],
+                           ctx->buffer_data[out_buffer_index],
+                           outer,
+                           axis_length,
+                           num_indices,
+                           row_bytes,
+                           ectx->arena);
+                };
                 functors.emplace_back(functor);
             }
 
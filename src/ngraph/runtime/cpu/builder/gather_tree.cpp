@@ -0,0 +1,128 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/op/gather_tree.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/reference/gather_tree.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            // The beams are traced back independently, so they are split between threads
+            template <typename T, typename L>
+            static void build_gather_tree(CPU_ExternalFunction* external_function,
+                                          const vector<TensorWrapper>& args,
+                                          const vector<TensorWrapper>& out)
+            {
+                auto& functors = external_function->get_functors();
+                size_t step_ids_index = external_function->get_buffer_index(args[0].get_name());
+                size_t parent_ids_index = external_function->get_buffer_index(args[1].get_name());
+                size_t lengths_index = external_function->get_buffer_index(args[2].get_name());
+                size_t end_token_index = external_function->get_buffer_index(args[3].get_name());
+                size_t out_index = external_function->get_buffer_index(out[0].get_name());
+                Shape shape = args[0].get_shape();
+
+                auto functor = [=](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    const T* step_ids = static_cast<const T*>(ctx->buffer_data[step_ids_index]);
+                    const T* parent_ids =
+                        static_cast<const T*>(ctx->buffer_data[parent_ids_index]);
+                    const L* lengths = static_cast<const L*>(ctx->buffer_data[lengths_index]);
+                    T end_token = static_cast<const T*>(ctx->buffer_data[end_token_index])[0];
+                    T* result = static_cast<T*>(ctx->buffer_data[out_index]);
+                    Eigen::TensorOpCost cost(2 * shape[0] * sizeof(T), shape[0] * sizeof(T), 0);
+                    executor::GetCPUExecutor().get_device(ectx->arena).parallelFor(
+                        shape[1] * shape[2], cost, [&](Eigen::Index begin, Eigen::Index end) {
+                            reference::gather_tree(step_ids,
+                                                   parent_ids,
+                                                   lengths,
+                                                   end_token,
+                                                   result,
+                                                   shape,
+                                                   static_cast<size_t>(begin),
+                                                   static_cast<size_t>(end));
+                        });
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <typename T>
+            static void build_gather_tree(CPU_ExternalFunction* external_function,
+                                          const vector<TensorWrapper>& args,
+                                          const vector<TensorWrapper>& out)
+            {
+                auto length_type = args[2].get_element_type();
+                if (length_type == args[0].get_element_type())
+                {
+                    build_gather_tree<T, T>(external_function, args, out);
+                }
+                else if (length_type == element::i32)
+                {
+                    build_gather_tree<T, int32_t>(external_function, args, out);
+                }
+                else if (length_type == element::i64)
+                {
+                    build_gather_tree<T, int64_t>(external_function, args, out);
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported max_seq_len type (" +
+                                       length_type.get_type_name() +
+                                       ") in CPU Builder for GatherTree");
+                }
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::v1::GatherTree)
+            {
+                (void)node;
+                auto element_type = args[0].get_element_type();
+                if (element_type == element::f32)
+                {
+                    build_gather_tree<float>(external_function, args, out);
+                }
+                else if (element_type == element::i32)
+                {
+                    build_gather_tree<int32_t>(external_function, args, out);
+                }
+                else if (element_type == element::i64)
+                {
+                    build_gather_tree<int64_t>(external_function, args, out);
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported element type (" +
+                                       element_type.get_type_name() +
+                                       ") in CPU Builder for GatherTree");
+                }
+            }
+
+            void register_builders_gather_tree_cpp()
+            {
+                REGISTER_OP_BUILDER(ngraph::op::v1::GatherTree);
+            }
+        }
+    }
+}
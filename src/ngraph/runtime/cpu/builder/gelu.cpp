@@ -14,12 +14,17 @@
 // limitations under the License.
 //*****************************************************************************
 
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
 #include "ngraph/op/gelu.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/dnnl_emitter.hpp"
 #include "ngraph/runtime/cpu/dnnl_invoke.hpp"
 #include "ngraph/runtime/cpu/dnnl_utils.hpp"
 #include "ngraph/runtime/cpu/op/gelu_backprop.hpp"
+#include "ngraph/runtime/reference/gelu.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -30,53 +35,56 @@ namespace ngraph
     {
         namespace cpu
         {
+            // The exact erf form of Gelu, for f64 and when NGRAPH_CPU_DNNL_ELTWISE leaves Gelu off
+            // the DNNL eltwise_gelu_erf kernel
+            template <typename T>
+            static void parallel_gelu(void* arg, void* out, size_t count, int arena)
+            {
+                Eigen::TensorOpCost cost(sizeof(T), sizeof(T), 20);
+                executor::GetCPUExecutor().get_device(arena).parallelFor(
+                    count, cost, [&](Eigen::Index begin, Eigen::Index end) {
+                        runtime::reference::gelu<T>(static_cast<const T*>(arg) + begin,
+                                                    static_cast<T*>(out) + begin,
+                                                    static_cast<size_t>(end - begin));
+                    });
+            }
+
             template <>
             void Builder::BUILDER_DECL(ngraph::op::v0::Gelu)
             {
-                auto& functors = external_function->get_functors();
-
-                auto input_buffer_index = external_function->get_buffer_index(args[0].get_name());
-                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
-
                 if (runtime::cpu::dnnl_utils::use_dnnl_kernel(node))
                 {
-                    auto& dnnl_emitter = external_function->get_dnnl_emitter();
-                    auto gelu_desc = dnnl_emitter->get_gelu_forward_desc(node);
-                    size_t scratchpad_size = QUERY_SCRATCHPAD(eltwise_forward, gelu_desc);
-
-                    // Gelu needs 3 primitives: input, result, and eltwise_forward
-                    auto gelu_index = dnnl_emitter->reserve_primitive_space(3);
-                    auto& deps = dnnl_emitter->get_primitive_deps(gelu_index);
-
-                    auto functor = [&,
-                                    gelu_desc,
-                                    gelu_index,
-                                    scratchpad_size,
-                                    input_buffer_index,
-                                    out_buffer_index](CPURuntimeContext* ctx,
-                                                      CPUExecutionContext* /* ectx */) {
-                        if (ctx->first_iteration)
-                        {
-                            dnnl_emitter->build_gelu(ctx->dnnl_memories,
-                                                     ctx->dnnl_primitives,
-                                                     ctx->dnnl_scratchpad_mds,
-                                                     gelu_desc,
-                                                     deps,
-                                                     gelu_index);
-                        }
-                        cpu::dnnl_utils::set_memory_ptr(
-                            ctx, deps[0], ctx->buffer_data[input_buffer_index]);
-                        cpu::dnnl_utils::set_memory_ptr(
-                            ctx, deps[1], ctx->buffer_data[out_buffer_index]);
-
-                        cpu::dnnl_utils::dnnl_invoke_primitive(
-                            ctx, gelu_index, deps, cpu::dnnl_utils::OpType::GELU, scratchpad_size);
-                    };
-                    functors.emplace_back(functor);
+                    BUILD_DNNL_ELTWISE_FUNCTOR;
                 }
                 else
                 {
-                    throw ngraph_error("Gelu is supported with DNNL kernel only for f32.");
+                    auto& functors = external_function->get_functors();
+                    auto input_buffer_index =
+                        external_function->get_buffer_index(args[0].get_name());
+                    auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                    std::function<void(void*, void*, size_t, int)> kernel;
+                    if (args[0].get_element_type() == element::f32)
+                    {
+                        kernel = parallel_gelu<float>;
+                    }
+                    else if (args[0].get_element_type() == element::f64)
+                    {
+                        kernel = parallel_gelu<double>;
+                    }
+                    else
+                    {
+                        throw ngraph_error("Gelu is supported only for f32 and f64.");
+                    }
+                    auto element_count = out[0].get_size();
+                    auto functor = [&, kernel, element_count, input_buffer_index, out_buffer_index](
+                                       CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        kernel(ctx->buffer_data[input_buffer_index],
+                               ctx->buffer_data[out_buffer_index],
+                               element_count,
+                               ectx->arena);
+                    };
+                    functors.emplace_back(functor);
                 }
             }
 
@@ -110,7 +118,7 @@ namespace ngraph
                                     delta_buffer_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
                                                       CPUExecutionContext* /* ectx */) {
-                        if (ctx->first_iteration)
+                        if (ctx->dnnl_primitives[gelu_b_index] == nullptr)
                         {
                             dnnl_emitter->build_gelu_backward(ctx->dnnl_memories,
                                                               ctx->dnnl_primitives,
@@ -120,6 +128,10 @@ namespace ngraph
                                                               deps,
                                                               gelu_b_index);
                         }
+                        if (ctx->build_primitives_only)
+                        {
+                            return;
+                        }
                         cpu::dnnl_utils::set_memory_ptr(
                             ctx, deps[0], ctx->buffer_data[arg_fwd_buffer_index]);
                         cpu::dnnl_utils::set_memory_ptr(
@@ -134,6 +146,7 @@ namespace ngraph
                             cpu::dnnl_utils::OpType::GELUBACKPROP,
                             scratchpad_size);
                     };
+                    external_function->add_primitive_build_functor(functors.size());
                     functors.emplace_back(functor);
                 }
                 else
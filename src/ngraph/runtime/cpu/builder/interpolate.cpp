@@ -0,0 +1,162 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/op/interpolate.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/reference/interpolate.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            // The index and weight tables only depend on the shapes, so they are built here
+            // once and the kernel just runs the passes. Each pass splits its output rows between
+            // threads; a row is a weighted sum of a few contiguous input rows, which is what the
+            // compiler vectorizes.
+            template <typename T>
+            static CPUKernelFunctor
+                interpolate_functor(size_t arg_buffer_index,
+                                    size_t out_buffer_index,
+                                    const Shape& arg_shape,
+                                    const op::v3::Interpolate::InterpolateAttrs& attrs,
+                                    const Shape& out_shape)
+            {
+                auto tables = reference::make_interpolate_tables(attrs, arg_shape, out_shape);
+                return [=](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    const T* arg = static_cast<const T*>(ctx->buffer_data[arg_buffer_index]);
+                    T* out = static_cast<T*>(ctx->buffer_data[out_buffer_index]);
+                    if (tables.empty())
+                    {
+                        memcpy(out, arg, shape_size(arg_shape) * sizeof(T));
+                        return;
+                    }
+                    vector<T> buffers[2];
+                    Shape shape = arg_shape;
+                    const T* src = arg;
+                    for (size_t k = 0; k < tables.size(); k++)
+                    {
+                        const auto& table = tables[k];
+                        Shape next = shape;
+                        next[table.axis] = table.output_size;
+                        T* dst = out;
+                        if (k + 1 < tables.size())
+                        {
+                            buffers[k % 2].resize(shape_size(next));
+                            dst = buffers[k % 2].data();
+                        }
+                        size_t inner = reference::interpolate_inner_size(shape, table.axis);
+                        Eigen::TensorOpCost cost(table.taps * inner * sizeof(T),
+                                                 inner * sizeof(T),
+                                                 2 * table.taps * inner);
+                        executor::GetCPUExecutor().get_device(ectx->arena).parallelFor(
+                            reference::interpolate_rows(shape, table),
+                            cost,
+                            [&](Eigen::Index begin, Eigen::Index end) {
+                                reference::interpolate_axis(src,
+                                                            dst,
+                                                            shape,
+                                                            table,
+                                                            static_cast<size_t>(begin),
+                                                            static_cast<size_t>(end));
+                            });
+                        src = dst;
+                        shape = next;
+                    }
+                };
+            }
+
+            static void build_interpolate(CPU_ExternalFunction* external_function,
+                                          const vector<TensorWrapper>& args,
+                                          const vector<TensorWrapper>& out,
+                                          const op::v3::Interpolate::InterpolateAttrs& attrs)
+            {
+                auto& functors = external_function->get_functors();
+                CPUKernelFunctor functor;
+
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                auto arg_shape = args[0].get_shape();
+                auto out_shape = out[0].get_shape();
+
+                auto element_type = args[0].get_element_type();
+                if (element_type == element::f32)
+                {
+                    functor = interpolate_functor<float>(
+                        arg_buffer_index, out_buffer_index, arg_shape, attrs, out_shape);
+                }
+                else if (element_type == element::f64)
+                {
+                    functor = interpolate_functor<double>(
+                        arg_buffer_index, out_buffer_index, arg_shape, attrs, out_shape);
+                }
+                else if (element_type == element::u8)
+                {
+                    functor = interpolate_functor<uint8_t>(
+                        arg_buffer_index, out_buffer_index, arg_shape, attrs, out_shape);
+                }
+                else if (element_type == element::i8)
+                {
+                    functor = interpolate_functor<int8_t>(
+                        arg_buffer_index, out_buffer_index, arg_shape, attrs, out_shape);
+                }
+                else if (element_type == element::i32)
+                {
+                    functor = interpolate_functor<int32_t>(
+                        arg_buffer_index, out_buffer_index, arg_shape, attrs, out_shape);
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported type (" + element_type.get_type_name() +
+                                       ") in CPU Builder for Interpolate");
+                }
+
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::v0::Interpolate)
+            {
+                auto interpolate = static_cast<const ngraph::op::v0::Interpolate*>(node);
+                build_interpolate(external_function,
+                                  args,
+                                  out,
+                                  reference::interpolate_attrs(interpolate->get_attrs()));
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::v3::Interpolate)
+            {
+                auto interpolate = static_cast<const ngraph::op::v3::Interpolate*>(node);
+                build_interpolate(external_function, args, out, interpolate->get_attrs());
+            }
+
+            void register_builders_interpolate_cpp()
+            {
+                REGISTER_OP_BUILDER(ngraph::op::v0::Interpolate);
+                REGISTER_OP_BUILDER(ngraph::op::v3::Interpolate);
+            }
+        }
+    }
+}
@@ -0,0 +1,121 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstring>
+#include <thread>
+
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_tensor.hpp"
+#include "ngraph/runtime/cpu/op/kv_cache_append.hpp"
+#include "ngraph/runtime/cpu/op/prefix_attention.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::KVCacheAppend)
+            {
+                auto append = static_cast<const ngraph::op::KVCacheAppend*>(node);
+                auto& functors = external_function->get_functors();
+
+                auto values_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto position_buffer_index =
+                    external_function->get_buffer_index(args[1].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                bool position_i64 = args[1].get_element_type() == element::i64;
+
+                const Shape& values_shape = args[0].get_shape();
+                size_t batch = values_shape[0];
+                size_t steps = values_shape[1];
+                size_t max_length = append->get_max_length();
+                size_t step_size = values_shape[2] * args[0].get_element_type().size();
+
+                // When only PrefixAttention ops read it, the output is the cache itself.
+                // Other readers may be views into the pool or the function outputs, so they
+                // get a copy.
+                bool in_place = true;
+                for (auto& input : node->output(0).get_target_inputs())
+                {
+                    in_place = in_place && is_type<ngraph::op::PrefixAttention>(input.get_node());
+                }
+
+                // One cache per runtime context, of which there are at most as many as
+                // hardware threads. A context runs one call at a time.
+                auto caches = make_shared<vector<unique_ptr<AlignedBuffer>>>(
+                    max(thread::hardware_concurrency(), 1u));
+
+                auto functor = [caches,
+                                in_place,
+                                position_i64,
+                                batch,
+                                steps,
+                                max_length,
+                                step_size,
+                                values_buffer_index,
+                                position_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* /* ectx */) {
+                    auto& cache = caches->at(ctx->context_index);
+                    if (!cache)
+                    {
+                        size_t size = batch * max_length * step_size;
+                        cache.reset(new AlignedBuffer(size, CPUTensor::BufferAlignment));
+                        memset(cache->get_ptr(), 0, size);
+                    }
+                    void* position_data = ctx->buffer_data[position_buffer_index];
+                    int64_t position = position_i64 ? *static_cast<int64_t*>(position_data)
+                                                    : *static_cast<int32_t*>(position_data);
+                    if (position < 0 || position + steps > max_length)
+                    {
+                        throw ngraph_error("KVCacheAppend of " + to_string(steps) +
+                                           " steps at position " + to_string(position) +
+                                           " overflows a cache of " + to_string(max_length));
+                    }
+
+                    auto values = static_cast<const char*>(ctx->buffer_data[values_buffer_index]);
+                    char* cache_data = cache->get_ptr<char>();
+                    for (size_t b = 0; b < batch; b++)
+                    {
+                        memcpy(cache_data + (b * max_length + position) * step_size,
+                               values + b * steps * step_size,
+                               steps * step_size);
+                    }
+                    if (in_place)
+                    {
+                        ctx->buffer_data[out_buffer_index] = cache_data;
+                    }
+                    else
+                    {
+                        memcpy(ctx->buffer_data[out_buffer_index], cache_data, cache->size());
+                    }
+                };
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_kv_cache_append_cpp()
+            {
+                REGISTER_OP_BUILDER(ngraph::op::KVCacheAppend);
+            }
+        }
+    }
+}
@@ -0,0 +1,213 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/op/layer_norm.hpp"
+#include "ngraph/op/mvn.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/reference/layer_norm.hpp"
+#include "ngraph/runtime/reference/mvn.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            // Marks the buffer of an optional input or output that the op does not have
+            static const size_t no_buffer = numeric_limits<size_t>::max();
+
+            template <typename T>
+            static T* optional_buffer(CPURuntimeContext* ctx, size_t buffer_index)
+            {
+                return buffer_index == no_buffer ? nullptr
+                                                 : static_cast<T*>(ctx->buffer_data[buffer_index]);
+            }
+
+            // Rows of row_size elements are normalized in parallel on the executor of the
+            // arena; a row is read twice and written once
+            template <typename T>
+            static void parallel_rows(int arena,
+                                      size_t rows,
+                                      size_t row_size,
+                                      const function<void(size_t, size_t)>& kernel)
+            {
+                Eigen::TensorOpCost cost(
+                    2 * row_size * sizeof(T), row_size * sizeof(T), 8 * row_size);
+                executor::GetCPUExecutor().get_device(arena).parallelFor(
+                    rows, cost, [&](Eigen::Index begin, Eigen::Index end) {
+                        kernel(static_cast<size_t>(begin), static_cast<size_t>(end));
+                    });
+            }
+
+            static size_t leading_size(const Shape& shape, size_t axis)
+            {
+                size_t size = 1;
+                for (size_t i = 0; i < axis; i++)
+                {
+                    size *= shape[i];
+                }
+                return size;
+            }
+
+            template <typename T>
+            static CPUKernelFunctor layer_norm_functor(const vector<size_t>& buffer_indices,
+                                                       const Shape& arg_shape,
+                                                       size_t begin_norm_axis,
+                                                       double epsilon)
+            {
+                size_t rows = leading_size(arg_shape, begin_norm_axis);
+                size_t row_size = rows == 0 ? 0 : shape_size(arg_shape) / rows;
+                return [buffer_indices, arg_shape, begin_norm_axis, epsilon, rows, row_size](
+                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    parallel_rows<T>(
+                        ectx->arena, rows, row_size, [&](size_t begin, size_t end) {
+                            runtime::reference::layer_norm<T>(
+                                static_cast<const T*>(ctx->buffer_data[buffer_indices[0]]),
+                                optional_buffer<const T>(ctx, buffer_indices[1]),
+                                optional_buffer<const T>(ctx, buffer_indices[2]),
+                                static_cast<T*>(ctx->buffer_data[buffer_indices[3]]),
+                                optional_buffer<T>(ctx, buffer_indices[4]),
+                                optional_buffer<T>(ctx, buffer_indices[5]),
+                                arg_shape,
+                                begin_norm_axis,
+                                epsilon,
+                                begin,
+                                end);
+                        });
+                };
+            }
+
+            template <typename T>
+            static CPUKernelFunctor mvn_functor(size_t arg_buffer_index,
+                                                size_t out_buffer_index,
+                                                const Shape& arg_shape,
+                                                const AxisSet& reduction_axes,
+                                                bool normalize_variance,
+                                                double eps)
+            {
+                size_t begin_axis;
+                if (!runtime::reference::detail::trailing_reduction(
+                        arg_shape, reduction_axes, begin_axis))
+                {
+                    // Strided rows share the state of one pass over the tensor
+                    return [=](CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {
+                        runtime::reference::mvn<T>(
+                            static_cast<const T*>(ctx->buffer_data[arg_buffer_index]),
+                            static_cast<T*>(ctx->buffer_data[out_buffer_index]),
+                            arg_shape,
+                            reduction_axes,
+                            normalize_variance,
+                            eps);
+                    };
+                }
+                size_t rows = leading_size(arg_shape, begin_axis);
+                size_t row_size = rows == 0 ? 0 : shape_size(arg_shape) / rows;
+                return [=](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    parallel_rows<T>(ectx->arena, rows, row_size, [&](size_t begin, size_t end) {
+                        runtime::reference::mvn<T>(
+                            static_cast<const T*>(ctx->buffer_data[arg_buffer_index]),
+                            static_cast<T*>(ctx->buffer_data[out_buffer_index]),
+                            arg_shape,
+                            reduction_axes,
+                            normalize_variance,
+                            eps,
+                            begin,
+                            end);
+                    });
+                };
+            }
+
+// Instantiates FUNCTOR for the element type of the output
+#define NORMALIZATION_FUNCTOR(FUNCTOR, ...)                                                        \
+    [&]() -> CPUKernelFunctor {                                                                    \
+        auto element_type = out[0].get_element_type();                                             \
+        if (element_type == element::f32)                                                          \
+        {                                                                                          \
+            return FUNCTOR<float>(__VA_ARGS__);                                                    \
+        }                                                                                          \
+        else if (element_type == element::f64)                                                     \
+        {                                                                                          \
+            return FUNCTOR<double>(__VA_ARGS__);                                                   \
+        }                                                                                          \
+        throw ngraph_error("Unsupported element type " + element_type.c_type_string() +            \
+                           " in CPU Builder for " + node->description());                          \
+    }()
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::v0::LayerNorm)
+            {
+                auto layer_norm = static_cast<const ngraph::op::v0::LayerNorm*>(node);
+                auto& functors = external_function->get_functors();
+
+                // data, scale, bias, normalized data, mean, variance
+                vector<size_t> buffer_indices(6, no_buffer);
+                buffer_indices[0] = external_function->get_buffer_index(args[0].get_name());
+                if (layer_norm->get_use_affine())
+                {
+                    buffer_indices[1] = external_function->get_buffer_index(args[1].get_name());
+                    buffer_indices[2] = external_function->get_buffer_index(args[2].get_name());
+                }
+                for (size_t i = 0; i < out.size(); i++)
+                {
+                    buffer_indices[3 + i] = external_function->get_buffer_index(out[i].get_name());
+                }
+
+                auto arg_shape = args[0].get_shape();
+                int64_t begin_norm_axis = layer_norm->get_begin_norm_axis();
+                if (begin_norm_axis < 0)
+                {
+                    begin_norm_axis += static_cast<int64_t>(arg_shape.size());
+                }
+                functors.emplace_back(NORMALIZATION_FUNCTOR(layer_norm_functor,
+                                                            buffer_indices,
+                                                            arg_shape,
+                                                            static_cast<size_t>(begin_norm_axis),
+                                                            layer_norm->get_epsilon()));
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::v0::MVN)
+            {
+                auto mvn = static_cast<const ngraph::op::v0::MVN*>(node);
+                auto& functors = external_function->get_functors();
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                functors.emplace_back(NORMALIZATION_FUNCTOR(mvn_functor,
+                                                            arg_buffer_index,
+                                                            out_buffer_index,
+                                                            args[0].get_shape(),
+                                                            mvn->get_reduction_axes(),
+                                                            mvn->get_normalize_variance(),
+                                                            mvn->get_eps()));
+            }
+
+#undef NORMALIZATION_FUNCTOR
+
+            void register_builders_layer_norm_cpp()
+            {
+                REGISTER_OP_BUILDER(ngraph::op::v0::LayerNorm);
+                REGISTER_OP_BUILDER(ngraph::op::v0::MVN);
+            }
+        }
+    }
+}
@@ -57,7 +57,7 @@ namespace ngraph
                                     input_buffer_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
                                                       CPUExecutionContext* /* ectx */) {
-                        if (ctx->first_iteration)
+                        if (ctx->dnnl_primitives[leaky_relu_index] == nullptr)
                         {
                             dnnl_emitter->build_leaky_relu(ctx->dnnl_memories,
                                                            ctx->dnnl_primitives,
@@ -66,6 +66,10 @@ namespace ngraph
                                                            deps,
                                                            leaky_relu_index);
                         }
+                        if (ctx->build_primitives_only)
+                        {
+                            return;
+                        }
                         cpu::dnnl_utils::set_memory_ptr(
                             ctx, deps[0], ctx->buffer_data[input_buffer_index]);
                         cpu::dnnl_utils::set_memory_ptr(
@@ -77,6 +81,7 @@ namespace ngraph
                                                                cpu::dnnl_utils::OpType::LEAKYRELU,
                                                                scratchpad_size);
                     };
+                    external_function->add_primitive_build_functor(functors.size());
                     functors.emplace_back(functor);
                 }
                 else
@@ -59,7 +59,7 @@ namespace ngraph
                                arg_buffer_index,
                                out_buffer_index](CPURuntimeContext* ctx,
                                                  CPUExecutionContext* /* ectx */) {
-                        if (ctx->first_iteration)
+                        if (ctx->dnnl_primitives[lrn_index] == nullptr)
                         {
                             dnnl_emitter->build_lrn_forward(ctx->dnnl_memories,
                                                             ctx->dnnl_primitives,
@@ -68,6 +68,10 @@ namespace ngraph
                                                             deps,
                                                             lrn_index);
                         }
+                        if (ctx->build_primitives_only)
+                        {
+                            return;
+                        }
                         cpu::dnnl_utils::set_memory_ptr(
                             ctx, deps[0], ctx->buffer_data[arg_buffer_index]);
                         cpu::dnnl_utils::set_memory_ptr(
@@ -76,6 +80,7 @@ namespace ngraph
                         cpu::dnnl_utils::dnnl_invoke_primitive(
                             ctx, lrn_index, deps, cpu::dnnl_utils::OpType::LRN, scratchpad_size);
                     };
+                    external_function->add_primitive_build_functor(functors.size());
                 }
                 else
                 {
@@ -91,7 +91,7 @@ namespace ngraph
                                 dst_iter_buffer_index,
                                 dst_iter_c_buffer_index](CPURuntimeContext* ctx,
                                                          CPUExecutionContext* ectx) {
-                    if (ctx->first_iteration)
+                    if (ctx->dnnl_primitives[lstm_index] == nullptr)
                     {
                         dnnl_emitter->build_rnn_forward(ctx->dnnl_memories,
                                                         ctx->dnnl_primitives,
@@ -101,6 +101,10 @@ namespace ngraph
                                                         deps,
                                                         lstm_index);
                     }
+                    if (ctx->build_primitives_only)
+                    {
+                        return;
+                    }
                     cpu::dnnl_utils::set_memory_ptr(
                         ctx, deps[0], ctx->buffer_data[src_layer_buffer_index]);
                     cpu::dnnl_utils::set_memory_ptr(
@@ -124,6 +128,7 @@ namespace ngraph
                     cpu::dnnl_utils::dnnl_invoke_primitive(
                         ctx, lstm_index, deps, cpu::dnnl_utils::OpType::LSTM, scratchpad_size);
                 };
+                external_function->add_primitive_build_functor(functors.size());
                 functors.emplace_back(functor);
             }
 
@@ -67,7 +67,7 @@ namespace ngraph
                                     arg0_buffer_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
                                                       CPUExecutionContext* /* ectx */) {
-                        if (ctx->first_iteration)
+                        if (ctx->dnnl_primitives[max_pool_index] == nullptr)
                         {
                             dnnl_emitter->build_pooling_forward(ctx->dnnl_memories,
                                                                 ctx->dnnl_primitives,
@@ -76,6 +76,10 @@ namespace ngraph
                                                                 deps,
                                                                 max_pool_index);
                         }
+                        if (ctx->build_primitives_only)
+                        {
+                            return;
+                        }
                         cpu::dnnl_utils::set_memory_ptr(
                             ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
                         cpu::dnnl_utils::set_memory_ptr(
@@ -87,6 +91,7 @@ namespace ngraph
                                                                cpu::dnnl_utils::OpType::MAXPOOL,
                                                                scratchpad_size);
                     };
+                    external_function->add_primitive_build_functor(functors.size());
                     functors.emplace_back(functor);
                 }
                 else
@@ -208,7 +213,7 @@ namespace ngraph
                                     functor_fprop,
                                     functor_bprop](CPURuntimeContext* ctx,
                                                    CPUExecutionContext* ectx) {
-                        if (ctx->first_iteration)
+                        if (ctx->dnnl_primitives[bwd_pool_index] == nullptr)
                         {
                             dnnl_emitter->build_max_pooling_backward(ctx->dnnl_memories,
                                                                      ctx->dnnl_primitives,
@@ -222,9 +227,14 @@ namespace ngraph
                                                                      fwd_pool_index,
                                                                      bwd_pool_index);
                         }
+                        if (ctx->build_primitives_only)
+                        {
+                            return;
+                        }
                         functor_fprop(ctx, ectx);
                         functor_bprop(ctx, ectx);
                     };
+                    external_function->add_primitive_build_functor(functors.size());
                     functors.emplace_back(functor);
                 }
                 else
@@ -294,7 +304,7 @@ namespace ngraph
                                 out0_buffer_index,
                                 out1_buffer_index](CPURuntimeContext* ctx,
                                                    CPUExecutionContext* /* ectx */) {
-                    if (ctx->first_iteration)
+                    if (ctx->dnnl_primitives[max_pool_index] == nullptr)
                     {
                         dnnl_emitter->build_max_pooling_with_indices_forward(
                             ctx->dnnl_memories,
@@ -304,6 +314,10 @@ namespace ngraph
                             deps,
                             max_pool_index);
                     }
+                    if (ctx->build_primitives_only)
+                    {
+                        return;
+                    }
                     cpu::dnnl_utils::set_memory_ptr(
                         ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
                     cpu::dnnl_utils::set_memory_ptr(
@@ -318,6 +332,7 @@ namespace ngraph
                         cpu::dnnl_utils::OpType::MAXPOOLWITHINDICES,
                         scratchpad_size);
                 };
+                external_function->add_primitive_build_functor(functors.size());
                 functors.emplace_back(functor);
             }
 
@@ -361,7 +376,7 @@ namespace ngraph
                                 arg2_buffer_index,
                                 out_buffer_index](CPURuntimeContext* ctx,
                                                   CPUExecutionContext* /* ectx */) {
-                    if (ctx->first_iteration)
+                    if (ctx->dnnl_primitives[max_pool_index] == nullptr)
                     {
                         dnnl_emitter->build_max_pooling_with_indices_backward(
                             ctx->dnnl_memories,
@@ -372,6 +387,10 @@ namespace ngraph
                             deps,
                             max_pool_index);
                     }
+                    if (ctx->build_primitives_only)
+                    {
+                        return;
+                    }
                     cpu::dnnl_utils::set_memory_ptr(
                         ctx, deps[0], ctx->buffer_data[arg1_buffer_index]);
                     cpu::dnnl_utils::set_memory_ptr(
@@ -386,6 +405,7 @@ namespace ngraph
                         cpu::dnnl_utils::OpType::MAXPOOLWITHINDICESBACKPROP,
                         scratchpad_size);
                 };
+                external_function->add_primitive_build_functor(functors.size());
                 functors.emplace_back(functor);
             }
 
@@ -19,6 +19,7 @@
 #include "ngraph/op/min.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/kernel/reduce_min.hpp"
+#include "ngraph/runtime/cpu/kernel/reduce_strided.hpp"
 
 #include "reduction.hpp"
 
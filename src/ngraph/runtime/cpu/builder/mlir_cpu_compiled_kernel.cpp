@@ -15,10 +15,10 @@
 //*****************************************************************************
 
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
 
-#include "contrib/mlir/backend/cpu/cpu_backend.hpp"
-#include "contrib/mlir/core/compiler.hpp"
 #include "contrib/mlir/runtime/cpu/cpu_runtime.hpp"
+#include "contrib/mlir/runtime/cpu/cpu_runtime_cache.hpp"
 #include "ngraph/op/experimental/compiled_kernel.hpp"
 #include "ngraph/runtime/cpu/cpu_runtime_context.hpp"
 
@@ -113,36 +113,28 @@ namespace ngraph
 
                     if (it == ctx->mlir_runtimes.end())
                     {
-                        // Compile the sub-graph and create a new runtime
-                        // We must create an MLIRContext that out lives the compilation/execution
-                        // The runtime contains the context and gets store in the CK cache
-
-                        // Runtime contains context and must be constructed in-place.
-                        // MLIR contexts cannot be copied over
-                        ctx->mlir_runtimes.emplace(std::piecewise_construct,
-                                                   std::make_tuple(compiled_kernel),
-                                                   std::make_tuple());
-                        MLIRCPURuntime& mlir_runtime =
-                            ctx->mlir_runtimes.find(compiled_kernel)->second;
-                        // Grab the context and initialize a core compiler
-                        mlir::MLIRContext& context = mlir_runtime.get_context();
-                        MLIRCompiler mlir_compiler(compiled_kernel->get_function(), context);
-                        // Compile to NG dialect
-                        mlir_compiler.compile();
-                        // Grab a context and initialize a CPU backend using same context
-                        MLIRCPUBackend mlir_backend(mlir_compiler.get_module(), context);
-                        // Codegen to LLVM dialect
-                        mlir_backend.codegen();
-                        // Store module into runtime, and invoke.
-                        mlir_runtime.set_module(mlir_backend.get_module());
-                        mlir_runtime.run(mem_ref_arg_vec, true /*firstIteration*/);
-                    }
-                    else
-                    {
-                        // We have found a cached runtime, just invoke.
-                        MLIRCPURuntime& mlir_runtime = it->second;
-                        mlir_runtime.run(mem_ref_arg_vec, false /*firstIteration*/);
+                        // Compile the sub-graph, or share the runtime of an identical one
+                        // compiled before, and keep it in the CK cache
+                        it = ctx->mlir_runtimes
+                                 .emplace(compiled_kernel,
+                                          MLIRCPURuntimeCache::get_runtime(
+                                              compiled_kernel->get_function()))
+                                 .first;
                     }
+                    // The parallel loops of the sub-graph run on the threads of the arena the
+                    // kernel executes on. A chunk of an outermost loop is assumed to be costly
+                    // enough for every thread to get one.
+                    auto& device = executor::GetCPUExecutor().get_device(ectx->arena);
+                    it->second->run(
+                        mem_ref_arg_vec,
+                        [&device](int64_t count,
+                                  const std::function<void(int64_t, int64_t)>& body) {
+                            device.parallelFor(count,
+                                               Eigen::TensorOpCost(0, 0, 1e5),
+                                               [&body](Eigen::Index begin, Eigen::Index end) {
+                                                   body(begin, end);
+                                               });
+                        });
                 };
 
                 functors.emplace_back(functor);
@@ -0,0 +1,198 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/op/non_max_suppression.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/reference/non_max_suppression.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            struct NMSAttributes
+            {
+                bool center_point_box;
+                bool sort_result_descending;
+            };
+
+            static int64_t read_max_output_boxes(const void* data, const element::Type& type)
+            {
+                return type == element::i32 ? *static_cast<const int32_t*>(data)
+                                            : *static_cast<const int64_t*>(data);
+            }
+
+            // Every batch and class is suppressed on its own, in parallel on the executor of
+            // the arena; the selections are then merged in batch and class order.
+            template <typename T, typename U>
+            static CPUKernelFunctor nms_functor(const vector<size_t>& buffer_indices,
+                                                const Shape& boxes_shape,
+                                                const Shape& scores_shape,
+                                                const element::Type& max_boxes_type,
+                                                size_t out_rows,
+                                                const NMSAttributes& attrs)
+            {
+                size_t num_classes = scores_shape[1];
+                size_t num_boxes = boxes_shape[1];
+                size_t problems = scores_shape[0] * num_classes;
+                return [=](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    const T* boxes = static_cast<const T*>(ctx->buffer_data[buffer_indices[0]]);
+                    const T* scores = static_cast<const T*>(ctx->buffer_data[buffer_indices[1]]);
+                    int64_t max_output_boxes_per_class = read_max_output_boxes(
+                        ctx->buffer_data[buffer_indices[2]], max_boxes_type);
+                    size_t max_output_boxes =
+                        static_cast<size_t>(max<int64_t>(max_output_boxes_per_class, 0));
+                    float iou_threshold = *static_cast<float*>(ctx->buffer_data[buffer_indices[3]]);
+                    float score_threshold =
+                        *static_cast<float*>(ctx->buffer_data[buffer_indices[4]]);
+
+                    vector<vector<runtime::reference::NMSSelection>> selections(problems);
+                    Eigen::TensorOpCost cost(
+                        num_boxes * 5 * sizeof(T), 0, num_boxes * (16 + max_output_boxes));
+                    executor::GetCPUExecutor().get_device(ectx->arena).parallelFor(
+                        problems, cost, [&](Eigen::Index begin, Eigen::Index end) {
+                            runtime::reference::NMSCandidates candidates;
+                            for (size_t i = static_cast<size_t>(begin);
+                                 i < static_cast<size_t>(end);
+                                 i++)
+                            {
+                                size_t batch = i / num_classes;
+                                runtime::reference::non_max_suppression_class(
+                                    boxes + batch * num_boxes * 4,
+                                    scores + i * num_boxes,
+                                    num_boxes,
+                                    attrs.center_point_box,
+                                    max_output_boxes,
+                                    iou_threshold,
+                                    score_threshold,
+                                    static_cast<int64_t>(batch),
+                                    static_cast<int64_t>(i % num_classes),
+                                    candidates,
+                                    selections[i]);
+                            }
+                        });
+
+                    vector<runtime::reference::NMSSelection> selected;
+                    for (const auto& selection : selections)
+                    {
+                        selected.insert(selected.end(), selection.begin(), selection.end());
+                    }
+                    runtime::reference::non_max_suppression_output(
+                        selected,
+                        attrs.sort_result_descending,
+                        static_cast<U*>(ctx->buffer_data[buffer_indices[5]]),
+                        out_rows);
+                };
+            }
+
+            static void build_nms(CPU_ExternalFunction* external_function,
+                                  const Node* node,
+                                  const vector<TensorWrapper>& args,
+                                  const vector<TensorWrapper>& out,
+                                  const NMSAttributes& attrs)
+            {
+                auto& functors = external_function->get_functors();
+                vector<size_t> buffer_indices;
+                for (const auto& arg : args)
+                {
+                    buffer_indices.push_back(external_function->get_buffer_index(arg.get_name()));
+                }
+                buffer_indices.push_back(external_function->get_buffer_index(out[0].get_name()));
+
+                auto element_type = args[0].get_element_type();
+                auto index_type = out[0].get_element_type();
+                auto max_boxes_type = args[2].get_element_type();
+                if (element_type != element::f32 || args[3].get_element_type() != element::f32 ||
+                    args[4].get_element_type() != element::f32)
+                {
+                    throw ngraph_error("Unsupported type in CPU Builder for " +
+                                       node->description());
+                }
+                if (max_boxes_type != element::i32 && max_boxes_type != element::i64)
+                {
+                    throw ngraph_error("Unsupported max_output_boxes_per_class type in CPU "
+                                       "Builder for " +
+                                       node->description());
+                }
+                auto boxes_shape = args[0].get_shape();
+                auto scores_shape = args[1].get_shape();
+                size_t out_rows = shape_size(out[0].get_shape()) / 3;
+                if (index_type == element::i64)
+                {
+                    functors.emplace_back(nms_functor<float, int64_t>(buffer_indices,
+                                                                     boxes_shape,
+                                                                     scores_shape,
+                                                                     max_boxes_type,
+                                                                     out_rows,
+                                                                     attrs));
+                }
+                else if (index_type == element::i32)
+                {
+                    functors.emplace_back(nms_functor<float, int32_t>(buffer_indices,
+                                                                     boxes_shape,
+                                                                     scores_shape,
+                                                                     max_boxes_type,
+                                                                     out_rows,
+                                                                     attrs));
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported index element type");
+                }
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::v1::NonMaxSuppression)
+            {
+                auto nms = static_cast<const ngraph::op::v1::NonMaxSuppression*>(node);
+                build_nms(external_function,
+                          node,
+                          args,
+                          out,
+                          {nms->get_box_encoding() ==
+                               ngraph::op::v1::NonMaxSuppression::BoxEncodingType::CENTER,
+                           nms->get_sort_result_descending()});
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::v3::NonMaxSuppression)
+            {
+                auto nms = static_cast<const ngraph::op::v3::NonMaxSuppression*>(node);
+                build_nms(external_function,
+                          node,
+                          args,
+                          out,
+                          {nms->get_box_encoding() ==
+                               ngraph::op::v3::NonMaxSuppression::BoxEncodingType::CENTER,
+                           nms->get_sort_result_descending()});
+            }
+
+            void register_builders_non_max_suppression_cpp()
+            {
+                REGISTER_OP_BUILDER(ngraph::op::v1::NonMaxSuppression);
+                REGISTER_OP_BUILDER(ngraph::op::v3::NonMaxSuppression);
+            }
+        }
+    }
+}
@@ -0,0 +1,121 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/grn.hpp"
+#include "ngraph/op/normalize_l2.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/reference/grn.hpp"
+#include "ngraph/runtime/reference/normalize_l2.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <typename T>
+            static CPUKernelFunctor normalize_l2_functor(size_t arg_buffer_index,
+                                                         size_t out_buffer_index,
+                                                         const Shape& arg_shape,
+                                                         const AxisSet& reduction_axes,
+                                                         float eps,
+                                                         op::EpsMode eps_mode)
+            {
+                return [=](CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {
+                    runtime::reference::normalize_l2<T>(
+                        static_cast<const T*>(ctx->buffer_data[arg_buffer_index]),
+                        static_cast<T*>(ctx->buffer_data[out_buffer_index]),
+                        arg_shape,
+                        reduction_axes,
+                        eps,
+                        eps_mode);
+                };
+            }
+
+            template <typename T>
+            static CPUKernelFunctor grn_functor(size_t arg_buffer_index,
+                                                size_t out_buffer_index,
+                                                const Shape& arg_shape,
+                                                float bias)
+            {
+                return [=](CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {
+                    runtime::reference::grn<T>(
+                        static_cast<const T*>(ctx->buffer_data[arg_buffer_index]),
+                        static_cast<T*>(ctx->buffer_data[out_buffer_index]),
+                        arg_shape,
+                        bias);
+                };
+            }
+
+// Instantiates FUNCTOR for the element type of the output
+#define NORMALIZATION_FUNCTOR(FUNCTOR, ...)                                                        \
+    [&]() -> CPUKernelFunctor {                                                                    \
+        auto element_type = out[0].get_element_type();                                             \
+        if (element_type == element::f32)                                                          \
+        {                                                                                          \
+            return FUNCTOR<float>(__VA_ARGS__);                                                    \
+        }                                                                                          \
+        else if (element_type == element::f64)                                                     \
+        {                                                                                          \
+            return FUNCTOR<double>(__VA_ARGS__);                                                   \
+        }                                                                                          \
+        throw ngraph_error("Unsupported element type " + element_type.c_type_string() +            \
+                           " in CPU Builder for " + node->description());                          \
+    }()
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::v0::NormalizeL2)
+            {
+                auto normalize = static_cast<const ngraph::op::v0::NormalizeL2*>(node);
+                auto& functors = external_function->get_functors();
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                functors.emplace_back(NORMALIZATION_FUNCTOR(normalize_l2_functor,
+                                                            arg_buffer_index,
+                                                            out_buffer_index,
+                                                            args[0].get_shape(),
+                                                            normalize->get_reduction_axes(),
+                                                            normalize->get_eps(),
+                                                            normalize->get_eps_mode()));
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::v0::GRN)
+            {
+                auto grn = static_cast<const ngraph::op::v0::GRN*>(node);
+                auto& functors = external_function->get_functors();
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                functors.emplace_back(NORMALIZATION_FUNCTOR(grn_functor,
+                                                            arg_buffer_index,
+                                                            out_buffer_index,
+                                                            args[0].get_shape(),
+                                                            grn->get_bias()));
+            }
+
+#undef NORMALIZATION_FUNCTOR
+
+            void register_builders_normalize_l2_cpp()
+            {
+                REGISTER_OP_BUILDER(ngraph::op::v0::NormalizeL2);
+                REGISTER_OP_BUILDER(ngraph::op::v0::GRN);
+            }
+        }
+    }
+}
@@ -0,0 +1,133 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/kernel/optimizer_update.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/op/optimizer_update.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::SGDMomentumUpdate)
+            {
+                auto& functors = external_function->get_functors();
+
+                vector<size_t> arg_indices;
+                for (auto& arg : args)
+                {
+                    arg_indices.push_back(external_function->get_buffer_index(arg.get_name()));
+                }
+                auto weights_index = external_function->get_buffer_index(out[0].get_name());
+                auto velocity_index = external_function->get_buffer_index(out[1].get_name());
+                auto element_count = out[0].get_size();
+
+                std::function<decltype(runtime::cpu::kernel::sgd_momentum_update<float>)> kernel;
+                if (out[0].get_element_type() == element::f32)
+                {
+                    kernel = runtime::cpu::kernel::sgd_momentum_update<float>;
+                }
+                else if (out[0].get_element_type() == element::f64)
+                {
+                    kernel = runtime::cpu::kernel::sgd_momentum_update<double>;
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported element type for SGDMomentumUpdate");
+                }
+
+                auto functor =
+                    [&, kernel, arg_indices, weights_index, velocity_index, element_count](
+                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        kernel(ctx->buffer_data[arg_indices[0]],
+                               ctx->buffer_data[arg_indices[1]],
+                               ctx->buffer_data[arg_indices[2]],
+                               ctx->buffer_data[arg_indices[3]],
+                               ctx->buffer_data[arg_indices[4]],
+                               ctx->buffer_data[weights_index],
+                               ctx->buffer_data[velocity_index],
+                               element_count,
+                               ectx->arena);
+                    };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::AdamUpdate)
+            {
+                auto& functors = external_function->get_functors();
+
+                vector<size_t> arg_indices;
+                for (auto& arg : args)
+                {
+                    arg_indices.push_back(external_function->get_buffer_index(arg.get_name()));
+                }
+                vector<size_t> out_indices;
+                for (auto& output : out)
+                {
+                    out_indices.push_back(external_function->get_buffer_index(output.get_name()));
+                }
+                auto element_count = out[0].get_size();
+
+                std::function<decltype(runtime::cpu::kernel::adam_update<float>)> kernel;
+                if (out[0].get_element_type() == element::f32)
+                {
+                    kernel = runtime::cpu::kernel::adam_update<float>;
+                }
+                else if (out[0].get_element_type() == element::f64)
+                {
+                    kernel = runtime::cpu::kernel::adam_update<double>;
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported element type for AdamUpdate");
+                }
+
+                auto functor = [&, kernel, arg_indices, out_indices, element_count](
+                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[arg_indices[0]],
+                           ctx->buffer_data[arg_indices[1]],
+                           ctx->buffer_data[arg_indices[2]],
+                           ctx->buffer_data[arg_indices[3]],
+                           ctx->buffer_data[arg_indices[4]],
+                           ctx->buffer_data[arg_indices[5]],
+                           ctx->buffer_data[arg_indices[6]],
+                           ctx->buffer_data[arg_indices[7]],
+                           ctx->buffer_data[arg_indices[8]],
+                           ctx->buffer_data[arg_indices[9]],
+                           ctx->buffer_data[out_indices[0]],
+                           ctx->buffer_data[out_indices[1]],
+                           ctx->buffer_data[out_indices[2]],
+                           element_count,
+                           ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_optimizer_update_cpp()
+            {
+                REGISTER_OP_BUILDER(ngraph::op::SGDMomentumUpdate);
+                REGISTER_OP_BUILDER(ngraph::op::AdamUpdate);
+            }
+        }
+    }
+}
@@ -0,0 +1,134 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/prelu.hpp"
+#include "ngraph/op/squared_difference.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/reference/prelu.hpp"
+#include "ngraph/runtime/reference/squared_difference.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <typename T>
+            static CPUKernelFunctor prelu_functor(size_t arg_buffer_index,
+                                                  size_t slope_buffer_index,
+                                                  size_t out_buffer_index,
+                                                  const Shape& arg_shape,
+                                                  const Shape& slope_shape)
+            {
+                return [=](CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {
+                    runtime::reference::prelu<T>(
+                        static_cast<const T*>(ctx->buffer_data[arg_buffer_index]),
+                        static_cast<const T*>(ctx->buffer_data[slope_buffer_index]),
+                        static_cast<T*>(ctx->buffer_data[out_buffer_index]),
+                        arg_shape,
+                        slope_shape);
+                };
+            }
+
+            template <typename T>
+            static CPUKernelFunctor squared_difference_functor(size_t arg0_buffer_index,
+                                                               size_t arg1_buffer_index,
+                                                               size_t out_buffer_index,
+                                                               const Shape& arg0_shape,
+                                                               const Shape& arg1_shape,
+                                                               const op::AutoBroadcastSpec& autob)
+            {
+                return [=](CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {
+                    runtime::reference::squared_difference<T>(
+                        static_cast<const T*>(ctx->buffer_data[arg0_buffer_index]),
+                        static_cast<const T*>(ctx->buffer_data[arg1_buffer_index]),
+                        static_cast<T*>(ctx->buffer_data[out_buffer_index]),
+                        arg0_shape,
+                        arg1_shape,
+                        autob);
+                };
+            }
+
+// Instantiates FUNCTOR for the element type of the output
+#define BINARY_FUSED_FUNCTOR(FUNCTOR, ...)                                                         \
+    [&]() -> CPUKernelFunctor {                                                                    \
+        auto element_type = out[0].get_element_type();                                             \
+        if (element_type == element::f32)                                                          \
+        {                                                                                          \
+            return FUNCTOR<float>(__VA_ARGS__);                                                    \
+        }                                                                                          \
+        else if (element_type == element::f64)                                                     \
+        {                                                                                          \
+            return FUNCTOR<double>(__VA_ARGS__);                                                   \
+        }                                                                                          \
+        else if (element_type == element::i32)                                                     \
+        {                                                                                          \
+            return FUNCTOR<int32_t>(__VA_ARGS__);                                                  \
+        }                                                                                          \
+        else if (element_type == element::i64)                                                     \
+        {                                                                                          \
+            return FUNCTOR<int64_t>(__VA_ARGS__);                                                  \
+        }                                                                                          \
+        throw ngraph_error("Unsupported element type " + element_type.c_type_string() +            \
+                           " in CPU Builder for " + node->description());                          \
+    }()
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::v0::PRelu)
+            {
+                auto& functors = external_function->get_functors();
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto slope_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                functors.emplace_back(BINARY_FUSED_FUNCTOR(prelu_functor,
+                                                           arg_buffer_index,
+                                                           slope_buffer_index,
+                                                           out_buffer_index,
+                                                           args[0].get_shape(),
+                                                           args[1].get_shape()));
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::v0::SquaredDifference)
+            {
+                auto squared_difference =
+                    static_cast<const ngraph::op::v0::SquaredDifference*>(node);
+                auto& functors = external_function->get_functors();
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                functors.emplace_back(BINARY_FUSED_FUNCTOR(squared_difference_functor,
+                                                           arg0_buffer_index,
+                                                           arg1_buffer_index,
+                                                           out_buffer_index,
+                                                           args[0].get_shape(),
+                                                           args[1].get_shape(),
+                                                           squared_difference->get_autob()));
+            }
+
+#undef BINARY_FUSED_FUNCTOR
+
+            void register_builders_prelu_cpp()
+            {
+                REGISTER_OP_BUILDER(ngraph::op::v0::PRelu);
+                REGISTER_OP_BUILDER(ngraph::op::v0::SquaredDifference);
+            }
+        }
+    }
+}
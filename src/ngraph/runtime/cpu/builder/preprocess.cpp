@@ -0,0 +1,156 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/kernel/preprocess.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/dnnl_utils.hpp"
+#include "ngraph/runtime/cpu/op/preprocess.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            // The output rows of the images are split between threads. The resize tables and
+            // the layout of the output only depend on the shapes, so they are set up here.
+            template <typename InType>
+            static CPUKernelFunctor preprocess_functor(size_t arg_buffer_index,
+                                                       size_t out_buffer_index,
+                                                       const Shape& frame_shape,
+                                                       bool channels_last,
+                                                       reference::InterpolateAxisTable rows,
+                                                       reference::InterpolateAxisTable cols,
+                                                       const vector<float>& scale,
+                                                       const vector<float>& shift,
+                                                       size_t block)
+            {
+                size_t items = frame_shape[0] * rows.output_size;
+                size_t row_cost = cols.output_size * frame_shape[channels_last ? 3 : 1];
+                size_t taps = rows.taps * cols.taps;
+                return [=](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    auto in = static_cast<const InType*>(ctx->buffer_data[arg_buffer_index]);
+                    float* out = static_cast<float*>(ctx->buffer_data[out_buffer_index]);
+                    Eigen::TensorOpCost cost(taps * row_cost * sizeof(InType),
+                                             row_cost * sizeof(float),
+                                             2 * (taps + 1) * row_cost);
+                    executor::GetCPUExecutor().get_device(ectx->arena).parallelFor(
+                        items, cost, [&](Eigen::Index begin, Eigen::Index end) {
+                            kernel::preprocess_rows(in,
+                                                    out,
+                                                    frame_shape,
+                                                    channels_last,
+                                                    rows,
+                                                    cols,
+                                                    scale.data(),
+                                                    shift.data(),
+                                                    block,
+                                                    static_cast<size_t>(begin),
+                                                    static_cast<size_t>(end));
+                        });
+                };
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Preprocess)
+            {
+                auto& functors = external_function->get_functors();
+
+                auto preprocess = static_cast<const ngraph::op::Preprocess*>(node);
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                Shape frame_shape = args[0].get_shape();
+                Shape out_shape = out[0].get_shape();
+                bool channels_last = preprocess->get_channels_last();
+                size_t height_axis = channels_last ? 1 : 2;
+
+                auto rows = kernel::preprocess_identity_table(frame_shape[height_axis]);
+                auto cols = kernel::preprocess_identity_table(frame_shape[height_axis + 1]);
+                const auto& resize_attrs = preprocess->get_resize_attrs();
+                if (!resize_attrs.axes.empty())
+                {
+                    Shape resized = frame_shape;
+                    resized[height_axis] = out_shape[2];
+                    resized[height_axis + 1] = out_shape[3];
+                    auto tables =
+                        reference::make_interpolate_tables(resize_attrs, frame_shape, resized);
+                    for (auto& table : tables)
+                    {
+                        (table.axis == height_axis ? rows : cols) = move(table);
+                    }
+                }
+                size_t block =
+                    dnnl_utils::get_channel_block_size(dnnl_utils::get_output_dnnl_md(node, 0));
+
+                CPUKernelFunctor functor;
+                auto et = args[0].get_element_type();
+                if (et == element::u8)
+                {
+                    functor = preprocess_functor<uint8_t>(arg_buffer_index,
+                                                          out_buffer_index,
+                                                          frame_shape,
+                                                          channels_last,
+                                                          rows,
+                                                          cols,
+                                                          preprocess->get_scale(),
+                                                          preprocess->get_shift(),
+                                                          block);
+                }
+                else if (et == element::i8)
+                {
+                    functor = preprocess_functor<int8_t>(arg_buffer_index,
+                                                         out_buffer_index,
+                                                         frame_shape,
+                                                         channels_last,
+                                                         rows,
+                                                         cols,
+                                                         preprocess->get_scale(),
+                                                         preprocess->get_shift(),
+                                                         block);
+                }
+                else if (et == element::f32)
+                {
+                    functor = preprocess_functor<float>(arg_buffer_index,
+                                                        out_buffer_index,
+                                                        frame_shape,
+                                                        channels_last,
+                                                        rows,
+                                                        cols,
+                                                        preprocess->get_scale(),
+                                                        preprocess->get_shift(),
+                                                        block);
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported element type for Preprocess");
+                }
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_preprocess_cpp()
+            {
+                REGISTER_OP_BUILDER(ngraph::op::Preprocess);
+            }
+        }
+    }
+}
@@ -79,9 +79,9 @@ namespace ngraph
                                    arg1_buffer_index,
                                    out_buffer_index](CPURuntimeContext* ctx,
                                                      CPUExecutionContext* /* ectx */) {
-                            // Create DNNL reorder primitive during the first iteration.
+                            // Create DNNL reorder primitive the first time the functor runs.
                             // Assumes the scales dont change for the duration of the graph
-                            if (ctx->first_iteration)
+                            if (ctx->dnnl_primitives[dequantize_index] == nullptr)
                             {
                                 vector<float> dyn_scales;
                                 dyn_scales.assign(
@@ -128,7 +128,7 @@ namespace ngraph
                                    arg0_buffer_index,
                                    out_buffer_index](CPURuntimeContext* ctx,
                                                      CPUExecutionContext* /* ectx */) {
-                            if (ctx->first_iteration)
+                            if (ctx->dnnl_primitives[dequantize_index] == nullptr)
                             {
                                 dnnl_emitter->build_quantize_reorder(ctx->dnnl_memories,
                                                                      ctx->dnnl_primitives,
@@ -139,6 +139,10 @@ namespace ngraph
                                                                      deps,
                                                                      dequantize_index);
                             }
+                            if (ctx->build_primitives_only)
+                            {
+                                return;
+                            }
                             cpu::dnnl_utils::set_memory_ptr(
                                 ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
                             cpu::dnnl_utils::set_memory_ptr(
@@ -151,6 +155,7 @@ namespace ngraph
                                 cpu::dnnl_utils::OpType::DEQUANTIZE,
                                 scratchpad_size);
                         };
+                        external_function->add_primitive_build_functor(functors.size());
                         functors.emplace_back(functor);
                     }
                 }
@@ -361,9 +366,9 @@ namespace ngraph
                                         arg1_buffer_index,
                                         out_buffer_index](CPURuntimeContext* ctx,
                                                           CPUExecutionContext* /* ectx */) {
-                            // Create DNNL reorder primitive during the first iteration.
+                            // Create DNNL reorder primitive the first time the functor runs.
                             // Assumes the scales dont change for the duration of the graph
-                            if (ctx->first_iteration)
+                            if (ctx->dnnl_primitives[quantize_index] == nullptr)
                             {
                                 vector<float> dyn_scales;
                                 dyn_scales.assign(
@@ -417,7 +422,7 @@ namespace ngraph
                                         arg0_buffer_index,
                                         out_buffer_index](CPURuntimeContext* ctx,
                                                           CPUExecutionContext* /* ectx */) {
-                            if (ctx->first_iteration)
+                            if (ctx->dnnl_primitives[quantize_index] == nullptr)
                             {
                                 dnnl_emitter->build_quantize_reorder(ctx->dnnl_memories,
                                                                      ctx->dnnl_primitives,
@@ -428,6 +433,10 @@ namespace ngraph
                                                                      deps,
                                                                      quantize_index);
                             }
+                            if (ctx->build_primitives_only)
+                            {
+                                return;
+                            }
                             cpu::dnnl_utils::set_memory_ptr(
                                 ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
                             cpu::dnnl_utils::set_memory_ptr(
@@ -440,6 +449,7 @@ namespace ngraph
                                 cpu::dnnl_utils::OpType::QUANTIZE,
                                 scratchpad_size);
                         };
+                        external_function->add_primitive_build_functor(functors.size());
                         functors.emplace_back(functor);
                     }
                 }
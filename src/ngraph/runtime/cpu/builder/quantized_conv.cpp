@@ -87,9 +87,9 @@ namespace ngraph
                                     arg6_buffer_index,
                                     out0_buffer_index](CPURuntimeContext* ctx,
                                                        CPUExecutionContext* /* ectx */) mutable {
-                        // Create DNNL convolution primitive during the first iteration.
+                        // Create DNNL convolution primitive the first time the functor runs.
                         // Assumes the scales dont change for the duration of the graph
-                        if (ctx->first_iteration)
+                        if (ctx->dnnl_primitives[conv_index] == nullptr)
                         {
                             vector<float> dyn_scales;
                             // Calculate the requantization scale
@@ -105,7 +105,7 @@ namespace ngraph
                                 ctx->dnnl_scratchpad_mds,
                                 conv_desc,
                                 conv_attr,
-                                executor::global_cpu_engine,
+                                executor::get_cpu_engine(),
                                 deps,
                                 conv_index);
                         }
@@ -367,7 +367,7 @@ namespace ngraph
                                     arg2_buffer_index,
                                     out0_buffer_index](CPURuntimeContext* ctx,
                                                        CPUExecutionContext* /* ectx */) mutable {
-                        if (ctx->first_iteration)
+                        if (ctx->dnnl_primitives[conv_index] == nullptr)
                         {
                             vector<float> dyn_scales;
                             dyn_scales.assign(
@@ -383,7 +383,7 @@ namespace ngraph
                                 ctx->dnnl_scratchpad_mds,
                                 conv_desc,
                                 conv_attr,
-                                executor::global_cpu_engine,
+                                executor::get_cpu_engine(),
                                 deps,
                                 conv_index);
                         }
@@ -452,7 +452,7 @@ namespace ngraph
                                     arg3_buffer_index,
                                     out0_buffer_index](CPURuntimeContext* ctx,
                                                        CPUExecutionContext* /* ectx */) mutable {
-                        if (ctx->first_iteration)
+                        if (ctx->dnnl_primitives[conv_index] == nullptr)
                         {
                             vector<float> dyn_scales;
                             dyn_scales.assign(
@@ -468,7 +468,7 @@ namespace ngraph
                                 ctx->dnnl_scratchpad_mds,
                                 conv_desc,
                                 conv_attr,
-                                executor::global_cpu_engine,
+                                executor::get_cpu_engine(),
                                 deps,
                                 conv_index);
                         }
@@ -550,7 +550,7 @@ namespace ngraph
                                     arg5_buffer_index,
                                     out0_buffer_index](CPURuntimeContext* ctx,
                                                        CPUExecutionContext* /* ectx */) mutable {
-                        if (ctx->first_iteration)
+                        if (ctx->dnnl_primitives[conv_index] == nullptr)
                         {
                             vector<float> dyn_scales;
                             vector<float> dyn_post_op_scales;
@@ -588,7 +588,7 @@ namespace ngraph
                                 ctx->dnnl_scratchpad_mds,
                                 conv_desc,
                                 conv_attr,
-                                executor::global_cpu_engine,
+                                executor::get_cpu_engine(),
                                 deps,
                                 conv_index);
                         }
@@ -678,7 +678,7 @@ namespace ngraph
                                     arg5_buffer_index,
                                     out0_buffer_index](CPURuntimeContext* ctx,
                                                        CPUExecutionContext* /* ectx */) mutable {
-                        if (ctx->first_iteration)
+                        if (ctx->dnnl_primitives[conv_index] == nullptr)
                         {
                             vector<float> dyn_scales;
                             vector<float> dyn_post_op_scales;
@@ -716,7 +716,7 @@ namespace ngraph
                                 ctx->dnnl_scratchpad_mds,
                                 conv_desc,
                                 conv_attr,
-                                executor::global_cpu_engine,
+                                executor::get_cpu_engine(),
                                 deps,
                                 conv_index);
                         }
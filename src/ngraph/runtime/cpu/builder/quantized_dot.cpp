@@ -82,7 +82,7 @@ namespace ngraph
                                     arg3_buffer_index,
                                     out0_buffer_index](CPURuntimeContext* ctx,
                                                        CPUExecutionContext* /* ectx */) mutable {
-                        if (ctx->first_iteration)
+                        if (ctx->dnnl_primitives[ip_index] == nullptr)
                         {
                             vector<float> dyn_scales;
                             dyn_scales.assign(
@@ -96,7 +96,7 @@ namespace ngraph
                                 ctx->dnnl_scratchpad_mds,
                                 ip_desc,
                                 ip_attr,
-                                executor::global_cpu_engine,
+                                executor::get_cpu_engine(),
                                 deps,
                                 ip_index);
                         }
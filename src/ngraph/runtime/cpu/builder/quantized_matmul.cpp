@@ -72,7 +72,7 @@ namespace ngraph
                                     arg2_buffer_index,
                                     out0_buffer_index](CPURuntimeContext* ctx,
                                                        CPUExecutionContext* /* ectx */) mutable {
-                        if (ctx->first_iteration)
+                        if (ctx->dnnl_primitives[ip_index] == nullptr)
                         {
                             vector<float> dyn_scales;
                             dyn_scales.push_back(
@@ -84,7 +84,7 @@ namespace ngraph
                                 ctx->dnnl_scratchpad_mds,
                                 ip_desc,
                                 ip_attr,
-                                executor::global_cpu_engine,
+                                executor::get_cpu_engine(),
                                 deps,
                                 ip_index);
                         }
@@ -16,7 +16,7 @@
 
 #include "ngraph/op/experimental/random_uniform.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
-#include "ngraph/runtime/reference/random_uniform.hpp"
+#include "ngraph/runtime/cpu/kernel/random.hpp"
 #include "ngraph/state/uniform_rng_state.hpp"
 
 using namespace std;
@@ -57,7 +57,7 @@ namespace ngraph
                            arg1_buffer_index,
                            arg3_buffer_index,
                            out_buffer_index,
-                           fixed_seed](CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {
+                           fixed_seed](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
                     // TODO: get shape when required
 
                     T min_val = static_cast<T*>(ctx->buffer_data[arg0_buffer_index])[0];
@@ -67,21 +67,26 @@ namespace ngraph
 
                     if (!use_fixed_seed)
                     {
-                        reference::random_uniform<T>(
+                        auto state = static_cast<UniformRNGState*>(ctx->states[index]);
+                        kernel::random_uniform<T>(
                             static_cast<T*>(ctx->buffer_data[out_buffer_index]),
                             min_val,
                             max_val,
                             element_count,
-                            static_cast<UniformRNGState*>(ctx->states[index]));
+                            state->get_generator(),
+                            state->advance(element_count),
+                            ectx->arena);
                     }
                     else
                     {
-                        reference::random_uniform_with_fixed_seed<T>(
+                        kernel::random_uniform<T>(
                             static_cast<T*>(ctx->buffer_data[out_buffer_index]),
                             min_val,
                             max_val,
                             element_count,
-                            fixed_seed);
+                            Philox(fixed_seed),
+                            0,
+                            ectx->arena);
                     }
                 };
                 return functor;
@@ -19,8 +19,7 @@
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
-#include "ngraph/runtime/reference/all.hpp"
-#include "ngraph/runtime/reference/any.hpp"
+#include "ngraph/runtime/cpu/kernel/reduce_strided.hpp"
 #include "ngraph/runtime/tensor.hpp"
 
 using namespace std;
@@ -40,20 +39,16 @@ namespace ngraph
                 auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
                 auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
-                auto arg0_shape = args[0].get_shape();
-                auto out_shape = out[0].get_shape();
-
-                auto reduction_axes = reduce->get_reduction_axes();
-                auto functor =
-                    [&, arg0_shape, out_shape, reduction_axes, arg0_buffer_index, out_buffer_index](
-                        CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {
-                        runtime::reference::any(
-                            static_cast<char*>(ctx->buffer_data[arg0_buffer_index]),
-                            static_cast<char*>(ctx->buffer_data[out_buffer_index]),
-                            arg0_shape,
-                            out_shape,
-                            reduction_axes);
-                    };
+                runtime::cpu::kernel::ReductionPlan plan(args[0].get_shape(),
+                                                         reduce->get_reduction_axes());
+                auto functor = [&, plan, arg0_buffer_index, out_buffer_index](
+                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    runtime::cpu::kernel::reduce_strided<char, runtime::cpu::kernel::AnyReducer>(
+                        ctx->buffer_data[arg0_buffer_index],
+                        ctx->buffer_data[out_buffer_index],
+                        plan,
+                        ectx->arena);
+                };
                 functors.emplace_back(functor);
             }
 
@@ -65,20 +60,16 @@ namespace ngraph
                 auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
                 auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
-                auto arg0_shape = args[0].get_shape();
-                auto out_shape = out[0].get_shape();
-
-                auto reduction_axes = reduce->get_reduction_axes();
-                auto functor =
-                    [&, arg0_shape, out_shape, reduction_axes, arg0_buffer_index, out_buffer_index](
-                        CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {
-                        runtime::reference::all(
-                            static_cast<char*>(ctx->buffer_data[arg0_buffer_index]),
-                            static_cast<char*>(ctx->buffer_data[out_buffer_index]),
-                            arg0_shape,
-                            out_shape,
-                            reduction_axes);
-                    };
+                runtime::cpu::kernel::ReductionPlan plan(args[0].get_shape(),
+                                                         reduce->get_reduction_axes());
+                auto functor = [&, plan, arg0_buffer_index, out_buffer_index](
+                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    runtime::cpu::kernel::reduce_strided<char, runtime::cpu::kernel::AllReducer>(
+                        ctx->buffer_data[arg0_buffer_index],
+                        ctx->buffer_data[out_buffer_index],
+                        plan,
+                        ectx->arena);
+                };
                 functors.emplace_back(functor);
             }
 
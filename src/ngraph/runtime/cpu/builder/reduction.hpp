@@ -80,113 +80,19 @@
             functors.emplace_back(functor);                                                        \
             return;                                                                                \
         }                                                                                          \
-                                                                                                   \
-        std::function<decltype(runtime::cpu::kernel::reduce_##K##_1rd<float, 2>)> kernel;          \
-        SELECT_ETS_AND_RANK7(                                                                      \
-            kernel, result_element_type, arg_rank, runtime::cpu::kernel::reduce_##K##_1rd);        \
-        auto functor = [&,                                                                         \
-                        kernel,                                                                    \
-                        arg_shape,                                                                 \
-                        result_shape,                                                              \
-                        reduction_axes,                                                            \
-                        arg_buffer_index,                                                          \
-                        out_buffer_index](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {     \
-            kernel(ctx->buffer_data[arg_buffer_index],                                             \
-                   ctx->buffer_data[out_buffer_index],                                             \
-                   arg_shape,                                                                      \
-                   result_shape,                                                                   \
-                   reduction_axes,                                                                 \
-                   ectx->arena);                                                                   \
-        };                                                                                         \
-        functors.emplace_back(functor);                                                            \
-        return;                                                                                    \
     }                                                                                              \
                                                                                                    \
-    if (reduction_axes.size() == 2 && arg_rank == 3 &&                                             \
-        is_optimized_et(args[0].get_element_type()))                                               \
-    {                                                                                              \
-        std::function<decltype(runtime::cpu::kernel::reduce_##K##_3d_2rd<float>)> kernel;          \
-        SELECT_ETS(kernel, result_element_type, runtime::cpu::kernel::reduce_##K##_3d_2rd);        \
-        auto functor = [&,                                                                         \
-                        kernel,                                                                    \
-                        arg_shape,                                                                 \
-                        result_shape,                                                              \
-                        reduction_axes,                                                            \
-                        arg_buffer_index,                                                          \
-                        out_buffer_index](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {     \
-            kernel(ctx->buffer_data[arg_buffer_index],                                             \
-                   ctx->buffer_data[out_buffer_index],                                             \
-                   arg_shape,                                                                      \
-                   result_shape,                                                                   \
-                   reduction_axes,                                                                 \
-                   ectx->arena);                                                                   \
-        };                                                                                         \
-        functors.emplace_back(functor);                                                            \
-        return;                                                                                    \
-    }                                                                                              \
+    runtime::cpu::kernel::ReductionPlan plan(arg_shape, reduction_axes);                           \
+    std::function<decltype(runtime::cpu::kernel::reduce_##K##_strided<float>)> strided_kernel;     \
                                                                                                    \
-    if (reduction_axes.size() == 2 && arg_rank == 4 &&                                             \
-        is_optimized_et(args[0].get_element_type()))                                               \
-    {                                                                                              \
-        std::function<decltype(runtime::cpu::kernel::reduce_##K##_4d_2rd<float>)> kernel;          \
-        SELECT_ETS(kernel, result_element_type, runtime::cpu::kernel::reduce_##K##_4d_2rd);        \
-        auto functor = [&,                                                                         \
-                        kernel,                                                                    \
-                        arg_shape,                                                                 \
-                        result_shape,                                                              \
-                        reduction_axes,                                                            \
-                        arg_buffer_index,                                                          \
-                        out_buffer_index](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {     \
-            kernel(ctx->buffer_data[arg_buffer_index],                                             \
-                   ctx->buffer_data[out_buffer_index],                                             \
-                   arg_shape,                                                                      \
-                   result_shape,                                                                   \
-                   reduction_axes,                                                                 \
-                   ectx->arena);                                                                   \
-        };                                                                                         \
-        functors.emplace_back(functor);                                                            \
-        return;                                                                                    \
-    }                                                                                              \
+    SELECT_KERNEL(                                                                                 \
+        strided_kernel, result_element_type, runtime::cpu::kernel::reduce_##K##_strided);          \
                                                                                                    \
-    if (reduction_axes.size() == 2 && arg_rank == 5 &&                                             \
-        is_optimized_et(args[0].get_element_type()))                                               \
-    {                                                                                              \
-        std::function<decltype(runtime::cpu::kernel::reduce_##K##_5d_2rd<float>)> kernel;          \
-        SELECT_ETS(kernel, result_element_type, runtime::cpu::kernel::reduce_##K##_5d_2rd);        \
-        auto functor = [&,                                                                         \
-                        kernel,                                                                    \
-                        arg_shape,                                                                 \
-                        result_shape,                                                              \
-                        reduction_axes,                                                            \
-                        arg_buffer_index,                                                          \
-                        out_buffer_index](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {     \
-            kernel(ctx->buffer_data[arg_buffer_index],                                             \
-                   ctx->buffer_data[out_buffer_index],                                             \
-                   arg_shape,                                                                      \
-                   result_shape,                                                                   \
-                   reduction_axes,                                                                 \
-                   ectx->arena);                                                                   \
-        };                                                                                         \
-        functors.emplace_back(functor);                                                            \
-        return;                                                                                    \
-    }                                                                                              \
-                                                                                                   \
-    std::function<decltype(runtime::cpu::kernel::K<float>)> ref_kernel;                            \
-                                                                                                   \
-    SELECT_KERNEL(ref_kernel, result_element_type, runtime::cpu::kernel::K);                       \
-                                                                                                   \
-    auto functor = [&,                                                                             \
-                    ref_kernel,                                                                    \
-                    arg_shape,                                                                     \
-                    result_shape,                                                                  \
-                    reduction_axes,                                                                \
-                    arg_buffer_index,                                                              \
-                    out_buffer_index](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {         \
-        ref_kernel(ctx->buffer_data[arg_buffer_index],                                             \
-                   ctx->buffer_data[out_buffer_index],                                             \
-                   arg_shape,                                                                      \
-                   result_shape,                                                                   \
-                   reduction_axes,                                                                 \
-                   ectx->arena);                                                                   \
+    auto functor = [&, strided_kernel, plan, arg_buffer_index, out_buffer_index](                  \
+        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {                                       \
+        strided_kernel(ctx->buffer_data[arg_buffer_index],                                         \
+                       ctx->buffer_data[out_buffer_index],                                         \
+                       plan,                                                                       \
+                       ectx->arena);                                                               \
     };                                                                                             \
     functors.emplace_back(functor)
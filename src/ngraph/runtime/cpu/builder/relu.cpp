@@ -54,7 +54,7 @@ namespace ngraph
                                     arg_buffer_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
                                                       CPUExecutionContext* /* ectx */) {
-                        if (ctx->first_iteration)
+                        if (ctx->dnnl_primitives[relu_index] == nullptr)
                         {
                             dnnl_emitter->build_relu_forward(ctx->dnnl_memories,
                                                              ctx->dnnl_primitives,
@@ -63,6 +63,10 @@ namespace ngraph
                                                              deps,
                                                              relu_index);
                         }
+                        if (ctx->build_primitives_only)
+                        {
+                            return;
+                        }
                         cpu::dnnl_utils::set_memory_ptr(
                             ctx, deps[0], ctx->buffer_data[arg_buffer_index]);
                         cpu::dnnl_utils::set_memory_ptr(
@@ -71,6 +75,7 @@ namespace ngraph
                         cpu::dnnl_utils::dnnl_invoke_primitive(
                             ctx, relu_index, deps, cpu::dnnl_utils::OpType::RELU, scratchpad_size);
                     };
+                    external_function->add_primitive_build_functor(functors.size());
                     functors.emplace_back(functor);
                 }
                 else
@@ -110,7 +115,7 @@ namespace ngraph
                                     delta_buffer_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
                                                       CPUExecutionContext* /* ectx */) {
-                        if (ctx->first_iteration)
+                        if (ctx->dnnl_primitives[relu_index] == nullptr)
                         {
                             dnnl_emitter->build_relu_backward(ctx->dnnl_memories,
                                                               ctx->dnnl_primitives,
@@ -120,6 +125,10 @@ namespace ngraph
                                                               deps,
                                                               relu_index);
                         }
+                        if (ctx->build_primitives_only)
+                        {
+                            return;
+                        }
                         cpu::dnnl_utils::set_memory_ptr(
                             ctx, deps[0], ctx->buffer_data[arg_fwd_buffer_index]);
                         cpu::dnnl_utils::set_memory_ptr(
@@ -134,6 +143,7 @@ namespace ngraph
                             cpu::dnnl_utils::OpType::RELUBACKPROP,
                             scratchpad_size);
                     };
+                    external_function->add_primitive_build_functor(functors.size());
                     functors.emplace_back(functor);
                 }
                 else
@@ -34,7 +34,7 @@ namespace ngraph
             static void get_reshape_kernel(
                 const ngraph::Node* node,
                 std::function<decltype(runtime::cpu::kernel::reshape_1d<float, 2>)>& kernel,
-                std::function<decltype(runtime::cpu::kernel::reshape_ref<float>)>& ref_kernel,
+                std::function<decltype(runtime::cpu::kernel::reshape_tiled<float>)>& tiled_kernel,
                 Shape& arg_shape,
                 Shape& result_shape,
                 AxisVector& input_order,
@@ -81,7 +81,13 @@ namespace ngraph
                     return;
                 }
 
-                if (arg_rank == 1 && is_optimized_et(result_element_type))
+                if (input_order.back() != arg_rank - 1)
+                {
+                    // The innermost axis moves; copy in cache-sized tiles
+                    SELECT_KERNEL(
+                        tiled_kernel, result_element_type, runtime::cpu::kernel::reshape_tiled)
+                }
+                else if (arg_rank == 1 && is_optimized_et(result_element_type))
                 {
                     SELECT_ETS_AND_RANK7(
                         kernel, result_element_type, result_rank, runtime::cpu::kernel::reshape_1d);
@@ -104,7 +110,7 @@ namespace ngraph
                 else
                 {
                     SELECT_KERNEL(
-                        ref_kernel, result_element_type, runtime::cpu::kernel::reshape_ref)
+                        tiled_kernel, result_element_type, runtime::cpu::kernel::reshape_tiled)
                 }
             }
 
@@ -112,7 +118,7 @@ namespace ngraph
             NodeExecutorTy Builder::BUILDER_CF_DECL(ngraph::op::v0::Reshape)
             {
                 std::function<decltype(runtime::cpu::kernel::reshape_1d<float, 2>)> kernel;
-                std::function<decltype(runtime::cpu::kernel::reshape_ref<float>)> ref_kernel;
+                std::function<decltype(runtime::cpu::kernel::reshape_tiled<float>)> tiled_kernel;
                 Shape arg_shape, result_shape;
                 AxisVector input_order;
                 size_t size;
@@ -120,7 +126,7 @@ namespace ngraph
 
                 get_reshape_kernel(node,
                                    kernel,
-                                   ref_kernel,
+                                   tiled_kernel,
                                    arg_shape,
                                    result_shape,
                                    input_order,
@@ -134,11 +140,11 @@ namespace ngraph
                         kernel(inputs[0], outputs[0], arg_shape, input_order, result_shape, 0);
                     };
                 }
-                else if (ref_kernel)
+                else if (tiled_kernel)
                 {
-                    functor = [ref_kernel, arg_shape, input_order, result_shape](
+                    functor = [tiled_kernel, arg_shape, input_order, result_shape](
                                   std::vector<void*> inputs, std::vector<void*> outputs) {
-                        ref_kernel(inputs[0], outputs[0], arg_shape, input_order, result_shape, 0);
+                        tiled_kernel(inputs[0], outputs[0], arg_shape, input_order, result_shape, 0);
                     };
                 }
                 else if (skip_reshape)
@@ -170,7 +176,7 @@ namespace ngraph
                 auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
                 std::function<decltype(runtime::cpu::kernel::reshape_1d<float, 2>)> kernel;
-                std::function<decltype(runtime::cpu::kernel::reshape_ref<float>)> ref_kernel;
+                std::function<decltype(runtime::cpu::kernel::reshape_tiled<float>)> tiled_kernel;
                 Shape arg_shape, result_shape;
                 AxisVector input_order;
                 size_t size;
@@ -178,7 +184,7 @@ namespace ngraph
 
                 get_reshape_kernel(node,
                                    kernel,
-                                   ref_kernel,
+                                   tiled_kernel,
                                    arg_shape,
                                    result_shape,
                                    input_order,
@@ -203,17 +209,17 @@ namespace ngraph
                                ectx->arena);
                     };
                 }
-                else if (ref_kernel)
+                else if (tiled_kernel)
                 {
                     functor = [&,
-                               ref_kernel,
+                               tiled_kernel,
                                arg_shape,
                                input_order,
                                result_shape,
                                arg_buffer_index,
                                out_buffer_index](CPURuntimeContext* ctx,
                                                  CPUExecutionContext* ectx) {
-                        ref_kernel(ctx->buffer_data[arg_buffer_index],
+                        tiled_kernel(ctx->buffer_data[arg_buffer_index],
                                    ctx->buffer_data[out_buffer_index],
                                    arg_shape,
                                    input_order,
@@ -29,6 +29,85 @@ namespace ngraph
     {
         namespace cpu
         {
+            // GRU Rnn on the DNNL gru_forward or lbr_gru_forward PRIMITIVE
+            template <typename PRIMITIVE>
+            static void build_gru(CPU_ExternalFunction* external_function,
+                                  const ngraph::Node* node,
+                                  const std::vector<TensorWrapper>& args,
+                                  const std::vector<TensorWrapper>& out)
+            {
+                auto& functors = external_function->get_functors();
+                auto src_layer_buffer_index =
+                    external_function->get_buffer_index(args[0].get_name());
+                auto src_iter_buffer_index =
+                    external_function->get_buffer_index(args[1].get_name());
+                auto weights_layer_buffer_index =
+                    external_function->get_buffer_index(args[2].get_name());
+                auto weights_iter_buffer_index =
+                    external_function->get_buffer_index(args[3].get_name());
+                auto bias_buffer_index = external_function->get_buffer_index(args[4].get_name());
+                auto dst_layer_buffer_index =
+                    external_function->get_buffer_index(out[0].get_name());
+                auto dst_iter_buffer_index = external_function->get_buffer_index(out[1].get_name());
+
+                auto& dnnl_emitter = external_function->get_dnnl_emitter();
+
+                // GRU needs 8 primitives: src_layer, src_iter, weights_layer, weights_iter, bias,
+                // dst_layer, dst_iter, and the gru_forward.
+                auto rnn_index = dnnl_emitter->reserve_primitive_space(8);
+                auto& deps = dnnl_emitter->get_primitive_deps(rnn_index);
+                auto gru_desc =
+                    dnnl_emitter
+                        ->get_gru_forward_desc<ngraph::op::Rnn, typename PRIMITIVE::desc>(
+                            node, args, out);
+                size_t scratchpad_size = dnnl_emitter->query_scratchpad_gru_forward(gru_desc);
+
+                auto functor = [&,
+                                gru_desc,
+                                rnn_index,
+                                scratchpad_size,
+                                src_layer_buffer_index,
+                                src_iter_buffer_index,
+                                weights_layer_buffer_index,
+                                weights_iter_buffer_index,
+                                bias_buffer_index,
+                                dst_layer_buffer_index,
+                                dst_iter_buffer_index](CPURuntimeContext* ctx,
+                                                       CPUExecutionContext* /* ectx */) {
+                    if (ctx->dnnl_primitives[rnn_index] == nullptr)
+                    {
+                        dnnl_emitter->build_gru_forward(ctx->dnnl_memories,
+                                                        ctx->dnnl_primitives,
+                                                        ctx->dnnl_scratchpad_mds,
+                                                        gru_desc,
+                                                        deps,
+                                                        rnn_index);
+                    }
+                    if (ctx->build_primitives_only)
+                    {
+                        return;
+                    }
+                    cpu::dnnl_utils::set_memory_ptr(
+                        ctx, deps[0], ctx->buffer_data[src_layer_buffer_index]);
+                    cpu::dnnl_utils::set_memory_ptr(
+                        ctx, deps[1], ctx->buffer_data[src_iter_buffer_index]);
+                    cpu::dnnl_utils::set_memory_ptr(
+                        ctx, deps[2], ctx->buffer_data[weights_layer_buffer_index]);
+                    cpu::dnnl_utils::set_memory_ptr(
+                        ctx, deps[3], ctx->buffer_data[weights_iter_buffer_index]);
+                    cpu::dnnl_utils::set_memory_ptr(
+                        ctx, deps[4], ctx->buffer_data[bias_buffer_index]);
+                    cpu::dnnl_utils::set_memory_ptr(
+                        ctx, deps[5], ctx->buffer_data[dst_layer_buffer_index]);
+                    cpu::dnnl_utils::set_memory_ptr(
+                        ctx, deps[6], ctx->buffer_data[dst_iter_buffer_index]);
+                    cpu::dnnl_utils::dnnl_invoke_primitive(
+                        ctx, rnn_index, deps, cpu::dnnl_utils::OpType::GRU, scratchpad_size);
+                };
+                external_function->add_primitive_build_functor(functors.size());
+                functors.emplace_back(functor);
+            }
+
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Rnn)
             {
@@ -85,7 +164,7 @@ namespace ngraph
                                     dst_layer_buffer_index,
                                     dst_iter_buffer_index](CPURuntimeContext* ctx,
                                                            CPUExecutionContext* /* ectx */) {
-                        if (ctx->first_iteration)
+                        if (ctx->dnnl_primitives[rnn_index] == nullptr)
                         {
                             dnnl_emitter->build_vanilla_rnn_forward(ctx->dnnl_memories,
                                                                     ctx->dnnl_primitives,
@@ -95,6 +174,10 @@ namespace ngraph
                                                                     deps,
                                                                     rnn_index);
                         }
+                        if (ctx->build_primitives_only)
+                        {
+                            return;
+                        }
                         cpu::dnnl_utils::set_memory_ptr(
                             ctx, deps[0], ctx->buffer_data[src_layer_buffer_index]);
                         cpu::dnnl_utils::set_memory_ptr(
@@ -117,6 +200,7 @@ namespace ngraph
                                                                cpu::dnnl_utils::OpType::VANILLA_RNN,
                                                                scratchpad_size);
                     };
+                    external_function->add_primitive_build_functor(functors.size());
                     functors.emplace_back(functor);
                 }
                 else if (rnn_op->is_type(ngraph::runtime::cpu::rnn_utils::rnntype::vanilla_lstm))
@@ -157,7 +241,7 @@ namespace ngraph
                                     dst_iter_buffer_index,
                                     dst_iter_c_buffer_index](CPURuntimeContext* ctx,
                                                              CPUExecutionContext* ectx) {
-                        if (ctx->first_iteration)
+                        if (ctx->dnnl_primitives[rnn_index] == nullptr)
                         {
                             dnnl_emitter->build_rnn_forward(ctx->dnnl_memories,
                                                             ctx->dnnl_primitives,
@@ -167,6 +251,10 @@ namespace ngraph
                                                             deps,
                                                             rnn_index);
                         }
+                        if (ctx->build_primitives_only)
+                        {
+                            return;
+                        }
                         cpu::dnnl_utils::set_memory_ptr(
                             ctx, deps[0], ctx->buffer_data[src_layer_buffer_index]);
                         cpu::dnnl_utils::set_memory_ptr(
@@ -191,8 +279,17 @@ namespace ngraph
                         cpu::dnnl_utils::dnnl_invoke_primitive(
                             ctx, rnn_index, deps, cpu::dnnl_utils::OpType::RNN, scratchpad_size);
                     };
+                    external_function->add_primitive_build_functor(functors.size());
                     functors.emplace_back(functor);
                 }
+                else if (rnn_op->is_type(ngraph::runtime::cpu::rnn_utils::rnntype::vanilla_gru))
+                {
+                    build_gru<dnnl::gru_forward>(external_function, node, args, out);
+                }
+                else if (rnn_op->is_type(ngraph::runtime::cpu::rnn_utils::rnntype::lbr_gru))
+                {
+                    build_gru<dnnl::lbr_gru_forward>(external_function, node, args, out);
+                }
             }
 
             void register_builders_rnn_cpp() { REGISTER_OP_BUILDER(ngraph::op::Rnn); }
@@ -0,0 +1,332 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/op/deformable_psroi_pooling.hpp"
+#include "ngraph/op/psroi_pooling.hpp"
+#include "ngraph/op/roi_align.hpp"
+#include "ngraph/op/roi_pooling.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/dnnl_utils.hpp"
+#include "ngraph/runtime/reference/roi_pooling.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            // The ROIs are independent, so they are split between threads. The feature map may
+            // be channel blocked (see set_layouts_roi_pooling); the result is native.
+            template <typename T>
+            static void build_roi_pooling(
+                CPU_ExternalFunction* external_function,
+                const Node* node,
+                const vector<TensorWrapper>& args,
+                const vector<TensorWrapper>& out,
+                function<void(const reference::ROIFeatureMap<T>&, void**, size_t, size_t)>
+                    kernel)
+            {
+                auto& functors = external_function->get_functors();
+                vector<size_t> arg_indices;
+                for (const auto& arg : args)
+                {
+                    arg_indices.push_back(external_function->get_buffer_index(arg.get_name()));
+                }
+                arg_indices.push_back(external_function->get_buffer_index(out[0].get_name()));
+                Shape input_shape = args[0].get_shape();
+                size_t block = 1;
+                if (args[0].get_element_type() == element::f32)
+                {
+                    block = dnnl_utils::get_channel_block_size(
+                        dnnl_utils::get_input_dnnl_md(node, 0));
+                }
+                size_t rois = args[1].get_shape()[0];
+                size_t bin_cost = shape_size(out[0].get_shape()) / max(rois, size_t(1));
+
+                auto functor = [=](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    vector<void*> buffers;
+                    for (auto index : arg_indices)
+                    {
+                        buffers.push_back(ctx->buffer_data[index]);
+                    }
+                    reference::ROIFeatureMap<T> input(
+                        static_cast<const T*>(buffers[0]), input_shape, block);
+                    Eigen::TensorOpCost cost(
+                        4 * bin_cost * sizeof(T), bin_cost * sizeof(T), 16 * bin_cost);
+                    executor::GetCPUExecutor().get_device(ectx->arena).parallelFor(
+                        rois, cost, [&](Eigen::Index begin, Eigen::Index end) {
+                            kernel(input,
+                                   buffers.data(),
+                                   static_cast<size_t>(begin),
+                                   static_cast<size_t>(end));
+                        });
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <typename T>
+            static void build_roi_align(CPU_ExternalFunction* external_function,
+                                        const Node* node,
+                                        const vector<TensorWrapper>& args,
+                                        const vector<TensorWrapper>& out)
+            {
+                auto roi_align = static_cast<const ngraph::op::v3::ROIAlign*>(node);
+                size_t batch = args[0].get_shape()[0];
+                size_t pooled_h = static_cast<size_t>(roi_align->get_pooled_h());
+                size_t pooled_w = static_cast<size_t>(roi_align->get_pooled_w());
+                int sampling_ratio = roi_align->get_sampling_ratio();
+                float spatial_scale = roi_align->get_spatial_scale();
+                auto mode = roi_align->get_mode();
+                // The output follows the three inputs
+                size_t result = args.size();
+                if (args[2].get_element_type() == element::i64)
+                {
+                    build_roi_pooling<T>(
+                        external_function,
+                        node,
+                        args,
+                        out,
+                        [=](const reference::ROIFeatureMap<T>& input,
+                            void** buffers,
+                            size_t begin,
+                            size_t end) {
+                            reference::roi_align(input,
+                                                 batch,
+                                                 static_cast<const T*>(buffers[1]),
+                                                 static_cast<const int64_t*>(buffers[2]),
+                                                 static_cast<T*>(buffers[result]),
+                                                 pooled_h,
+                                                 pooled_w,
+                                                 sampling_ratio,
+                                                 spatial_scale,
+                                                 mode,
+                                                 begin,
+                                                 end);
+                        });
+                }
+                else if (args[2].get_element_type() == element::i32)
+                {
+                    build_roi_pooling<T>(
+                        external_function,
+                        node,
+                        args,
+                        out,
+                        [=](const reference::ROIFeatureMap<T>& input,
+                            void** buffers,
+                            size_t begin,
+                            size_t end) {
+                            reference::roi_align(input,
+                                                 batch,
+                                                 static_cast<const T*>(buffers[1]),
+                                                 static_cast<const int32_t*>(buffers[2]),
+                                                 static_cast<T*>(buffers[result]),
+                                                 pooled_h,
+                                                 pooled_w,
+                                                 sampling_ratio,
+                                                 spatial_scale,
+                                                 mode,
+                                                 begin,
+                                                 end);
+                        });
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported index type (" +
+                                       args[2].get_element_type().get_type_name() +
+                                       ") in CPU Builder for ROIAlign");
+                }
+            }
+
+            template <typename T>
+            static void build_roi_pooling_v0(CPU_ExternalFunction* external_function,
+                                             const Node* node,
+                                             const vector<TensorWrapper>& args,
+                                             const vector<TensorWrapper>& out)
+            {
+                auto roi_pooling = static_cast<const ngraph::op::v0::ROIPooling*>(node);
+                size_t batch = args[0].get_shape()[0];
+                size_t pooled_h = roi_pooling->get_output_size()[0];
+                size_t pooled_w = roi_pooling->get_output_size()[1];
+                float spatial_scale = roi_pooling->get_spatial_scale();
+                string method = roi_pooling->get_method();
+                build_roi_pooling<T>(
+                    external_function,
+                    node,
+                    args,
+                    out,
+                    [=](const reference::ROIFeatureMap<T>& input,
+                        void** buffers,
+                        size_t begin,
+                        size_t end) {
+                        reference::roi_pooling(input,
+                                               batch,
+                                               static_cast<const T*>(buffers[1]),
+                                               static_cast<T*>(buffers[2]),
+                                               pooled_h,
+                                               pooled_w,
+                                               spatial_scale,
+                                               method,
+                                               begin,
+                                               end);
+                    });
+            }
+
+            template <typename T>
+            static void build_psroi_pooling(CPU_ExternalFunction* external_function,
+                                            const Node* node,
+                                            const vector<TensorWrapper>& args,
+                                            const vector<TensorWrapper>& out)
+            {
+                auto psroi = static_cast<const ngraph::op::v0::PSROIPooling*>(node);
+                size_t batch = args[0].get_shape()[0];
+                size_t output_dim = psroi->get_output_dim();
+                size_t group_size = psroi->get_group_size();
+                float spatial_scale = psroi->get_spatial_scale();
+                size_t bins_x = static_cast<size_t>(psroi->get_spatial_bins_x());
+                size_t bins_y = static_cast<size_t>(psroi->get_spatial_bins_y());
+                string mode = psroi->get_mode();
+                build_roi_pooling<T>(
+                    external_function,
+                    node,
+                    args,
+                    out,
+                    [=](const reference::ROIFeatureMap<T>& input,
+                        void** buffers,
+                        size_t begin,
+                        size_t end) {
+                        reference::psroi_pooling(input,
+                                                 batch,
+                                                 static_cast<const T*>(buffers[1]),
+                                                 static_cast<T*>(buffers[2]),
+                                                 output_dim,
+                                                 group_size,
+                                                 spatial_scale,
+                                                 bins_x,
+                                                 bins_y,
+                                                 mode,
+                                                 begin,
+                                                 end);
+                    });
+            }
+
+            template <typename T>
+            static void build_deformable_psroi_pooling(CPU_ExternalFunction* external_function,
+                                                       const Node* node,
+                                                       const vector<TensorWrapper>& args,
+                                                       const vector<TensorWrapper>& out)
+            {
+                auto psroi = static_cast<const ngraph::op::v1::DeformablePSROIPooling*>(node);
+                if (psroi->get_mode() != "bilinear_deformable")
+                {
+                    throw ngraph_error("Unsupported mode (" + psroi->get_mode() +
+                                       ") in CPU Builder for DeformablePSROIPooling");
+                }
+                size_t batch = args[0].get_shape()[0];
+                bool has_offsets = args.size() > 2;
+                size_t classes = has_offsets ? args[2].get_shape()[1] / 2 : 1;
+                size_t output_dim = static_cast<size_t>(psroi->get_output_dim());
+                size_t group_size = static_cast<size_t>(psroi->get_group_size());
+                float spatial_scale = psroi->get_spatial_scale();
+                size_t bins_x = static_cast<size_t>(psroi->get_spatial_bins_x());
+                size_t bins_y = static_cast<size_t>(psroi->get_spatial_bins_y());
+                float trans_std = psroi->get_trans_std();
+                size_t part_size = static_cast<size_t>(psroi->get_part_size());
+                size_t result = args.size();
+                build_roi_pooling<T>(
+                    external_function,
+                    node,
+                    args,
+                    out,
+                    [=](const reference::ROIFeatureMap<T>& input,
+                        void** buffers,
+                        size_t begin,
+                        size_t end) {
+                        reference::deformable_psroi_pooling(
+                            input,
+                            batch,
+                            static_cast<const T*>(buffers[1]),
+                            has_offsets ? static_cast<const T*>(buffers[2]) : nullptr,
+                            classes,
+                            static_cast<T*>(buffers[result]),
+                            output_dim,
+                            group_size,
+                            spatial_scale,
+                            bins_x,
+                            bins_y,
+                            trans_std,
+                            part_size,
+                            begin,
+                            end);
+                    });
+            }
+
+#define BUILD_ROI_POOLING(BUILDER)                                                                 \
+    auto element_type = args[0].get_element_type();                                               \
+    if (element_type == element::f32)                                                              \
+    {                                                                                              \
+        BUILDER<float>(external_function, node, args, out);                                        \
+    }                                                                                              \
+    else if (element_type == element::f64)                                                         \
+    {                                                                                              \
+        BUILDER<double>(external_function, node, args, out);                                       \
+    }                                                                                              \
+    else                                                                                           \
+    {                                                                                              \
+        throw ngraph_error("Unsupported type (" + element_type.get_type_name() +                   \
+                           ") in CPU Builder for " + node->description());                         \
+    }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::v3::ROIAlign)
+            {
+                BUILD_ROI_POOLING(build_roi_align)
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::v0::ROIPooling)
+            {
+                BUILD_ROI_POOLING(build_roi_pooling_v0)
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::v0::PSROIPooling)
+            {
+                BUILD_ROI_POOLING(build_psroi_pooling)
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::v1::DeformablePSROIPooling)
+            {
+                BUILD_ROI_POOLING(build_deformable_psroi_pooling)
+            }
+
+            void register_builders_roi_pooling_cpp()
+            {
+                REGISTER_OP_BUILDER(ngraph::op::v3::ROIAlign);
+                REGISTER_OP_BUILDER(ngraph::op::v0::ROIPooling);
+                REGISTER_OP_BUILDER(ngraph::op::v0::PSROIPooling);
+                REGISTER_OP_BUILDER(ngraph::op::v1::DeformablePSROIPooling);
+            }
+        }
+    }
+}
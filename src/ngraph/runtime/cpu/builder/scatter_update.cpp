@@ -0,0 +1,302 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstring>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/scatter_elements_update.hpp"
+#include "ngraph/op/scatter_nd.hpp"
+#include "ngraph/op/scatter_update.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/reference/scatter_elements_update.hpp"
+#include "ngraph/runtime/reference/scatter_nd_update.hpp"
+#include "ngraph/runtime/reference/scatter_update.hpp"
+#include "ngraph/validation_util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// The scatters only move elements, so the kernels are instantiated for the element size
+#define BUILD_SCATTER(BUILD, ...)                                                                  \
+    {                                                                                              \
+        bool is_int64 = args[1].get_element_type() == element::i64;                                \
+        if (!is_int64 && args[1].get_element_type() != element::i32)                               \
+        {                                                                                          \
+            throw ngraph_error("Unsupported index element type");                                  \
+        }                                                                                          \
+        switch (args[0].get_element_type().size())                                                 \
+        {                                                                                          \
+        case 1:                                                                                    \
+            is_int64 ? BUILD<uint8_t, int64_t>(__VA_ARGS__)                                        \
+                     : BUILD<uint8_t, int32_t>(__VA_ARGS__);                                       \
+            break;                                                                                 \
+        case 2:                                                                                    \
+            is_int64 ? BUILD<uint16_t, int64_t>(__VA_ARGS__)                                       \
+                     : BUILD<uint16_t, int32_t>(__VA_ARGS__);                                      \
+            break;                                                                                 \
+        case 4:                                                                                    \
+            is_int64 ? BUILD<uint32_t, int64_t>(__VA_ARGS__)                                       \
+                     : BUILD<uint32_t, int32_t>(__VA_ARGS__);                                      \
+            break;                                                                                 \
+        case 8:                                                                                    \
+            is_int64 ? BUILD<uint64_t, int64_t>(__VA_ARGS__)                                       \
+                     : BUILD<uint64_t, int32_t>(__VA_ARGS__);                                      \
+            break;                                                                                 \
+        default:                                                                                   \
+            throw ngraph_error("Unsupported type (" + args[0].get_element_type().c_type_string() + \
+                               ") in CPU Builder for " + node->description());                     \
+        }                                                                                          \
+    }
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            // The scatters are given a destructive in-place pair on their data by CPUAssignment.
+            // When the memory assignment lets the output reuse the buffer of the data, which it
+            // does when the data dies at the scatter, only the updates are written.
+            static size_t get_scatter_axis(const Node* node)
+            {
+                auto axis = as_type_ptr<ngraph::op::v0::Constant>(node->get_argument(3));
+                if (!axis)
+                {
+                    throw ngraph_error("The axis of " + node->description() +
+                                       " must be a constant in CPU Builder");
+                }
+                return static_cast<size_t>(normalize_axis(
+                    node, axis->cast_vector<int64_t>().at(0), node->get_input_shape(0).size()));
+            }
+
+            template <typename T, typename U>
+            static void build_scatter_update(CPU_ExternalFunction* external_function,
+                                             const vector<TensorWrapper>& args,
+                                             const vector<TensorWrapper>& out,
+                                             size_t axis)
+            {
+                auto& functors = external_function->get_functors();
+                auto data_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto indices_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto updates_buffer_index = external_function->get_buffer_index(args[2].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                size_t data_bytes = shape_size(args[0].get_shape()) * sizeof(T);
+                reference::ScatterUpdateShape shape(args[0].get_shape(), args[1].get_shape(), axis);
+
+                auto functor = [&,
+                                shape,
+                                data_bytes,
+                                data_buffer_index,
+                                indices_buffer_index,
+                                updates_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* ectx) {
+                    auto data = static_cast<const T*>(ctx->buffer_data[data_buffer_index]);
+                    auto indices = static_cast<const U*>(ctx->buffer_data[indices_buffer_index]);
+                    auto updates = static_cast<const T*>(ctx->buffer_data[updates_buffer_index]);
+                    auto output = static_cast<T*>(ctx->buffer_data[out_buffer_index]);
+                    if (data != output)
+                    {
+                        memcpy(output, data, data_bytes);
+                    }
+                    bool unique = reference::scatter_update_indices_are_unique(indices, shape);
+                    if (shape.rows() == 0)
+                    {
+                        return;
+                    }
+                    auto& device = executor::GetCPUExecutor().get_device(ectx->arena);
+                    double row_bytes = static_cast<double>(shape.inner * sizeof(T));
+                    if (unique)
+                    {
+                        // No two rows land in the same place
+                        device.parallelFor(shape.rows(),
+                                           Eigen::TensorOpCost(row_bytes, row_bytes, 0),
+                                           [&](Eigen::Index begin, Eigen::Index end) {
+                                               reference::scatter_update_rows(
+                                                   indices,
+                                                   updates,
+                                                   output,
+                                                   shape,
+                                                   static_cast<size_t>(begin),
+                                                   static_cast<size_t>(end));
+                                           });
+                    }
+                    else
+                    {
+                        // Repeated indices are written in order within each block of the data
+                        double block_bytes = row_bytes * shape.num_indices;
+                        device.parallelFor(shape.outer,
+                                           Eigen::TensorOpCost(block_bytes, block_bytes, 0),
+                                           [&](Eigen::Index begin, Eigen::Index end) {
+                                               reference::scatter_update_rows(
+                                                   indices,
+                                                   updates,
+                                                   output,
+                                                   shape,
+                                                   begin * shape.num_indices,
+                                                   end * shape.num_indices);
+                                           });
+                    }
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <typename T, typename U>
+            static void build_scatter_elements_update(CPU_ExternalFunction* external_function,
+                                                      const vector<TensorWrapper>& args,
+                                                      const vector<TensorWrapper>& out,
+                                                      size_t axis)
+            {
+                auto& functors = external_function->get_functors();
+                auto data_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto indices_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto updates_buffer_index = external_function->get_buffer_index(args[2].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                size_t data_bytes = shape_size(args[0].get_shape()) * sizeof(T);
+                reference::ScatterElementsUpdateShape shape(
+                    args[0].get_shape(), args[1].get_shape(), axis);
+
+                auto functor = [&,
+                                shape,
+                                data_bytes,
+                                data_buffer_index,
+                                indices_buffer_index,
+                                updates_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* ectx) {
+                    auto data = static_cast<const T*>(ctx->buffer_data[data_buffer_index]);
+                    auto indices = static_cast<const U*>(ctx->buffer_data[indices_buffer_index]);
+                    auto updates = static_cast<const T*>(ctx->buffer_data[updates_buffer_index]);
+                    auto output = static_cast<T*>(ctx->buffer_data[out_buffer_index]);
+                    if (data != output)
+                    {
+                        memcpy(output, data, data_bytes);
+                    }
+                    reference::scatter_elem_update_check_indices(indices, shape);
+                    if (shape.lines() == 0)
+                    {
+                        return;
+                    }
+                    // The lines along the axis never write to the same element
+                    double line_bytes = static_cast<double>(shape.num_indices * sizeof(T));
+                    executor::GetCPUExecutor().get_device(ectx->arena).parallelFor(
+                        shape.lines(),
+                        Eigen::TensorOpCost(
+                            line_bytes + shape.num_indices * sizeof(U), line_bytes, 0),
+                        [&](Eigen::Index begin, Eigen::Index end) {
+                            reference::scatter_elem_update_lines(indices,
+                                                                 updates,
+                                                                 output,
+                                                                 shape,
+                                                                 static_cast<size_t>(begin),
+                                                                 static_cast<size_t>(end));
+                        });
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <typename T, typename U>
+            static void build_scatter_nd(CPU_ExternalFunction* external_function,
+                                         const vector<TensorWrapper>& args,
+                                         const vector<TensorWrapper>& out)
+            {
+                auto& functors = external_function->get_functors();
+                auto data_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto indices_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto updates_buffer_index = external_function->get_buffer_index(args[2].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                Shape data_shape = args[0].get_shape();
+                Shape indices_shape = args[1].get_shape();
+                size_t data_bytes = shape_size(data_shape) * sizeof(T);
+                size_t slice_size = reference::scatter_nd_slice_size(data_shape, indices_shape);
+
+                auto functor = [&,
+                                data_shape,
+                                indices_shape,
+                                data_bytes,
+                                slice_size,
+                                data_buffer_index,
+                                indices_buffer_index,
+                                updates_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* ectx) {
+                    auto data = static_cast<const T*>(ctx->buffer_data[data_buffer_index]);
+                    auto indices = static_cast<const U*>(ctx->buffer_data[indices_buffer_index]);
+                    auto updates = static_cast<const T*>(ctx->buffer_data[updates_buffer_index]);
+                    auto output = static_cast<T*>(ctx->buffer_data[out_buffer_index]);
+                    if (data != output)
+                    {
+                        memcpy(output, data, data_bytes);
+                    }
+                    vector<size_t> offsets;
+                    bool unique = reference::scatter_nd_slice_offsets(
+                        indices, data_shape, indices_shape, offsets);
+                    if (!unique || offsets.size() < 2)
+                    {
+                        // Repeated slices are written in order
+                        reference::scatter_nd_update_slices(
+                            updates, output, offsets, slice_size, 0, offsets.size());
+                        return;
+                    }
+                    double slice_bytes = static_cast<double>(slice_size * sizeof(T));
+                    executor::GetCPUExecutor().get_device(ectx->arena).parallelFor(
+                        offsets.size(),
+                        Eigen::TensorOpCost(slice_bytes, slice_bytes, 0),
+                        [&](Eigen::Index begin, Eigen::Index end) {
+                            reference::scatter_nd_update_slices(updates,
+                                                                output,
+                                                                offsets,
+                                                                slice_size,
+                                                                static_cast<size_t>(begin),
+                                                                static_cast<size_t>(end));
+                        });
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::v3::ScatterUpdate)
+            {
+                size_t axis = get_scatter_axis(node);
+                BUILD_SCATTER(build_scatter_update, external_function, args, out, axis);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::v3::ScatterElementsUpdate)
+            {
+                size_t axis = get_scatter_axis(node);
+                BUILD_SCATTER(build_scatter_elements_update, external_function, args, out, axis);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::v0::ScatterND)
+            {
+                BUILD_SCATTER(build_scatter_nd, external_function, args, out);
+            }
+
+            void register_builders_scatter_update_cpp()
+            {
+                REGISTER_OP_BUILDER(ngraph::op::v3::ScatterUpdate);
+                REGISTER_OP_BUILDER(ngraph::op::v3::ScatterElementsUpdate);
+                REGISTER_OP_BUILDER(ngraph::op::v0::ScatterND);
+            }
+        }
+    }
+}
@@ -0,0 +1,162 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstring>
+
+#include "ngraph/distributed.hpp"
+#include "ngraph/op/recv.hpp"
+#include "ngraph/op/send.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/op/transfer_async.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::v0::Send)
+            {
+                auto& functors = external_function->get_functors();
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                auto count = out[0].get_size();
+                auto size = count * out[0].get_element_type().size();
+                auto data_type = args[0].get_element_type();
+                auto dest_id = static_cast<const ngraph::op::v0::Send*>(node)->get_dest_id();
+
+                auto functor =
+                    [&, arg_buffer_index, out_buffer_index, count, size, data_type, dest_id](
+                        CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {
+                        get_distributed_interface()->send(
+                            ctx->buffer_data[arg_buffer_index], data_type, count, dest_id);
+                        memcpy(ctx->buffer_data[out_buffer_index],
+                               ctx->buffer_data[arg_buffer_index],
+                               size);
+                    };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::v0::Recv)
+            {
+                auto& functors = external_function->get_functors();
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                auto count = out[0].get_size();
+                auto data_type = out[0].get_element_type();
+                auto src_id = static_cast<const ngraph::op::v0::Recv*>(node)->get_src_id();
+
+                // The input only gives the type and shape of the tensor received
+                auto functor = [&, out_buffer_index, count, data_type, src_id](
+                    CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {
+                    get_distributed_interface()->recv(
+                        ctx->buffer_data[out_buffer_index], data_type, count, src_id);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::SendStart)
+            {
+                auto& functors = external_function->get_functors();
+                auto request_index = external_function->get_distributed_request_index(node);
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                auto count = out[0].get_size();
+                auto size = count * out[0].get_element_type().size();
+                auto data_type = args[0].get_element_type();
+                auto dest_id = static_cast<const ngraph::op::SendStart*>(node)->get_dest_id();
+
+                auto functor = [&,
+                                request_index,
+                                arg_buffer_index,
+                                out_buffer_index,
+                                count,
+                                size,
+                                data_type,
+                                dest_id](CPURuntimeContext* ctx,
+                                         CPUExecutionContext* /* ectx */) {
+                    // The output is the input unless the input may change during the send
+                    if (ctx->buffer_data[out_buffer_index] != ctx->buffer_data[arg_buffer_index])
+                    {
+                        memcpy(ctx->buffer_data[out_buffer_index],
+                               ctx->buffer_data[arg_buffer_index],
+                               size);
+                    }
+                    ctx->distributed_requests[request_index] =
+                        get_distributed_interface()->send_async(
+                            ctx->buffer_data[out_buffer_index], data_type, count, dest_id);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::RecvStart)
+            {
+                auto& functors = external_function->get_functors();
+                auto request_index = external_function->get_distributed_request_index(node);
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                auto count = out[0].get_size();
+                auto data_type = out[0].get_element_type();
+                auto src_id = static_cast<const ngraph::op::RecvStart*>(node)->get_src_id();
+
+                auto functor = [&, request_index, out_buffer_index, count, data_type, src_id](
+                    CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {
+                    ctx->distributed_requests[request_index] =
+                        get_distributed_interface()->recv_async(
+                            ctx->buffer_data[out_buffer_index], data_type, count, src_id);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::TransferWait)
+            {
+                auto& functors = external_function->get_functors();
+                auto request_index =
+                    external_function->get_distributed_request_index(node->get_input_node_ptr(0));
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                auto size = out[0].get_size() * out[0].get_element_type().size();
+
+                auto functor = [&, request_index, arg_buffer_index, out_buffer_index, size](
+                    CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {
+                    auto& request = ctx->distributed_requests[request_index];
+                    NGRAPH_CHECK(request, "TransferWait ran before the start of its transfer");
+                    request->wait();
+                    request.reset();
+                    memcpy(ctx->buffer_data[out_buffer_index],
+                           ctx->buffer_data[arg_buffer_index],
+                           size);
+                };
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_send_recv_cpp()
+            {
+                REGISTER_OP_BUILDER(ngraph::op::v0::Send);
+                REGISTER_OP_BUILDER(ngraph::op::v0::Recv);
+                REGISTER_OP_BUILDER(ngraph::op::SendStart);
+                REGISTER_OP_BUILDER(ngraph::op::RecvStart);
+                REGISTER_OP_BUILDER(ngraph::op::TransferWait);
+            }
+        }
+    }
+}
@@ -56,7 +56,7 @@ namespace ngraph
                                 arg0_buffer_index,
                                 out_buffer_index](CPURuntimeContext* ctx,
                                                   CPUExecutionContext* /* ectx */) {
-                    if (ctx->first_iteration)
+                    if (ctx->dnnl_primitives[sigmoid_index] == nullptr)
                     {
                         dnnl_emitter->build_sigmoid_forward(ctx->dnnl_memories,
                                                             ctx->dnnl_primitives,
@@ -65,6 +65,10 @@ namespace ngraph
                                                             deps,
                                                             sigmoid_index);
                     }
+                    if (ctx->build_primitives_only)
+                    {
+                        return;
+                    }
                     cpu::dnnl_utils::set_memory_ptr(
                         ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
                     cpu::dnnl_utils::set_memory_ptr(
@@ -76,6 +80,7 @@ namespace ngraph
                                                            cpu::dnnl_utils::OpType::SIGMOID,
                                                            scratchpad_size);
                 };
+                external_function->add_primitive_build_functor(functors.size());
                 functors.emplace_back(functor);
             }
 
@@ -111,7 +116,7 @@ namespace ngraph
                                 arg1_buffer_index,
                                 out_buffer_index](CPURuntimeContext* ctx,
                                                   CPUExecutionContext* /* ectx */) {
-                    if (ctx->first_iteration)
+                    if (ctx->dnnl_primitives[sigmoid_index] == nullptr)
                     {
                         dnnl_emitter->build_sigmoid_backward(ctx->dnnl_memories,
                                                              ctx->dnnl_primitives,
@@ -121,6 +126,10 @@ namespace ngraph
                                                              deps,
                                                              sigmoid_index);
                     }
+                    if (ctx->build_primitives_only)
+                    {
+                        return;
+                    }
                     cpu::dnnl_utils::set_memory_ptr(
                         ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
                     cpu::dnnl_utils::set_memory_ptr(
@@ -134,6 +143,7 @@ namespace ngraph
                                                            cpu::dnnl_utils::OpType::SIGMOIDBACKPROP,
                                                            scratchpad_size);
                 };
+                external_function->add_primitive_build_functor(functors.size());
                 functors.emplace_back(functor);
             }
 
@@ -20,6 +20,7 @@
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/dnnl_invoke.hpp"
 #include "ngraph/runtime/cpu/dnnl_utils.hpp"
+#include "ngraph/runtime/cpu/kernel/block_copy.hpp"
 #include "ngraph/runtime/cpu/kernel/slice.hpp"
 
 using namespace std;
@@ -111,7 +112,7 @@ namespace ngraph
                                     arg_buffer_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
                                                       CPUExecutionContext* /* ectx */) {
-                        if (ctx->first_iteration)
+                        if (ctx->dnnl_primitives[slice_index] == nullptr)
                         {
                             dnnl_emitter->build_slice(ctx->dnnl_memories,
                                                       ctx->dnnl_primitives,
@@ -123,6 +124,10 @@ namespace ngraph
                                                       deps,
                                                       slice_index);
                         }
+                        if (ctx->build_primitives_only)
+                        {
+                            return;
+                        }
                         cpu::dnnl_utils::set_memory_ptr(
                             ctx, deps[0], ctx->buffer_data[arg_buffer_index]);
                         cpu::dnnl_utils::set_memory_ptr(
@@ -135,11 +140,64 @@ namespace ngraph
                                                                scratchpad_size);
                     };
 
+                    external_function->add_primitive_build_functor(functors.size());
                     functors.emplace_back(functor);
                 }
                 else
                 {
-                    if (is_strided(strides) && is_optimized_et(args[0].get_element_type()))
+                    // Slicing a single axis, as Split and VariadicSplit do, leaves rows that are
+                    // contiguous in both input and output
+                    size_t slice_axis = 0;
+                    while (slice_axis < arg_shape.size() &&
+                           out_shape[slice_axis] == arg_shape[slice_axis])
+                    {
+                        slice_axis++;
+                    }
+                    bool contiguous_rows = !is_strided(strides);
+                    for (size_t i = slice_axis + 1; i < arg_shape.size(); i++)
+                    {
+                        contiguous_rows = contiguous_rows && out_shape[i] == arg_shape[i];
+                    }
+
+                    if (contiguous_rows)
+                    {
+                        auto element_size = slice->get_input_element_type(0).size();
+                        size_t outer_count = 1;
+                        size_t inner_size = element_size;
+                        size_t out_row_size = shape_size(out_shape) * element_size;
+                        size_t arg_row_size = shape_size(arg_shape) * element_size;
+                        size_t offset = 0;
+                        if (slice_axis < arg_shape.size())
+                        {
+                            outer_count = shape_size(
+                                Shape(arg_shape.begin(), arg_shape.begin() + slice_axis));
+                            inner_size *= shape_size(
+                                Shape(arg_shape.begin() + slice_axis + 1, arg_shape.end()));
+                            out_row_size = out_shape[slice_axis] * inner_size;
+                            arg_row_size = arg_shape[slice_axis] * inner_size;
+                            offset = lower_bounds[slice_axis] * inner_size;
+                        }
+
+                        auto functor = [&,
+                                        outer_count,
+                                        out_row_size,
+                                        arg_row_size,
+                                        offset,
+                                        arg_buffer_index,
+                                        out_buffer_index](CPURuntimeContext* ctx,
+                                                          CPUExecutionContext* ectx) {
+                            runtime::cpu::kernel::parallel_block_copy(
+                                {{static_cast<char*>(ctx->buffer_data[arg_buffer_index]) + offset,
+                                  arg_row_size,
+                                  ctx->buffer_data[out_buffer_index],
+                                  out_row_size,
+                                  out_row_size}},
+                                outer_count,
+                                ectx->arena);
+                        };
+                        functors.emplace_back(functor);
+                    }
+                    else if (is_strided(strides) && is_optimized_et(args[0].get_element_type()))
                     {
                         std::function<decltype(runtime::cpu::kernel::strided_slice<float, 2>)>
                             kernel;
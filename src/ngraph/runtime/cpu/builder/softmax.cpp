@@ -62,7 +62,7 @@ namespace ngraph
                                     arg_buffer_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
                                                       CPUExecutionContext* /* ectx */) {
-                        if (ctx->first_iteration)
+                        if (ctx->dnnl_primitives[softmax_index] == nullptr)
                         {
                             dnnl_emitter->build_softmax_forward(ctx->dnnl_memories,
                                                                 ctx->dnnl_primitives,
@@ -71,6 +71,10 @@ namespace ngraph
                                                                 deps,
                                                                 softmax_index);
                         }
+                        if (ctx->build_primitives_only)
+                        {
+                            return;
+                        }
                         cpu::dnnl_utils::set_memory_ptr(
                             ctx, deps[0], ctx->buffer_data[arg_buffer_index]);
                         cpu::dnnl_utils::set_memory_ptr(
@@ -82,117 +86,26 @@ namespace ngraph
                                                                cpu::dnnl_utils::OpType::SOFTMAX,
                                                                scratchpad_size);
                     };
+                    external_function->add_primitive_build_functor(functors.size());
                     functors.emplace_back(functor);
                     return;
                 }
-                else if (is_optimized_et(args[0].get_element_type()))
+                else if (opt_kernel::SoftmaxPlan(arg_shape, axes).m_supported)
                 {
-                    if (axes.size() == arg_shape.size())
-                    {
-                        std::function<decltype(runtime::cpu::kernel::softmax_all<float, 1>)> kernel;
-
-                        SELECT_ETS_AND_RANK7(kernel,
-                                             args[0].get_element_type(),
-                                             args[0].get_shape().size(),
-                                             runtime::cpu::kernel::softmax_all);
-
-                        auto functor = [&, kernel, arg_shape, arg_buffer_index, out_buffer_index](
-                                           CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                            kernel(ctx->buffer_data[arg_buffer_index],
-                                   ctx->buffer_data[out_buffer_index],
-                                   arg_shape,
-                                   ectx->arena);
-                        };
-                        functors.emplace_back(functor);
-                        return;
-                    }
-                    else if (axes.size() == 1)
-                    {
-                        if (*axes.begin() == (arg_shape.size() - 1))
-                        {
-                            std::function<decltype(
-                                runtime::cpu::kernel::softmax_innermost_1rd<float, 1>)>
-                                kernel;
-
-                            SELECT_ETS_AND_RANK7(kernel,
-                                                 args[0].get_element_type(),
-                                                 args[0].get_shape().size(),
-                                                 runtime::cpu::kernel::softmax_innermost_1rd);
-
-                            auto functor =
-                                [&, kernel, arg_shape, arg_buffer_index, out_buffer_index](
-                                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                                    kernel(ctx->buffer_data[arg_buffer_index],
-                                           ctx->buffer_data[out_buffer_index],
-                                           arg_shape,
-                                           ectx->arena);
-                                };
-                            functors.emplace_back(functor);
-                            return;
-                        }
-                        else
-                        {
-                            std::function<decltype(runtime::cpu::kernel::softmax_1rd<float, 1>)>
-                                kernel;
-
-                            SELECT_ETS_AND_RANK7(kernel,
-                                                 args[0].get_element_type(),
-                                                 args[0].get_shape().size(),
-                                                 runtime::cpu::kernel::softmax_1rd);
-
-                            auto functor =
-                                [&, kernel, arg_shape, axes, arg_buffer_index, out_buffer_index](
-                                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                                    kernel(ctx->buffer_data[arg_buffer_index],
-                                           ctx->buffer_data[out_buffer_index],
-                                           arg_shape,
-                                           axes,
-                                           ectx->arena);
-                                };
-                            functors.emplace_back(functor);
-                            return;
-                        }
-                    }
-                    else if (arg_shape.size() == 3 && axes.size() == 2)
-                    {
-                        std::function<decltype(runtime::cpu::kernel::softmax_3d_2rd<float>)> kernel;
-
-                        SELECT_ETS(kernel,
-                                   args[0].get_element_type(),
-                                   runtime::cpu::kernel::softmax_3d_2rd);
-
-                        auto functor =
-                            [&, kernel, arg_shape, axes, arg_buffer_index, out_buffer_index](
-                                CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                                kernel(ctx->buffer_data[arg_buffer_index],
-                                       ctx->buffer_data[out_buffer_index],
-                                       arg_shape,
-                                       axes,
-                                       ectx->arena);
-                            };
-                        functors.emplace_back(functor);
-                        return;
-                    }
-                    else if (arg_shape.size() == 4 && axes.size() == 3)
-                    {
-                        std::function<decltype(runtime::cpu::kernel::softmax_4d_3rd<float>)> kernel;
-
-                        SELECT_ETS(kernel,
-                                   args[0].get_element_type(),
-                                   runtime::cpu::kernel::softmax_4d_3rd);
-
-                        auto functor =
-                            [&, kernel, arg_shape, axes, arg_buffer_index, out_buffer_index](
-                                CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                                kernel(ctx->buffer_data[arg_buffer_index],
-                                       ctx->buffer_data[out_buffer_index],
-                                       arg_shape,
-                                       axes,
-                                       ectx->arena);
-                            };
-                        functors.emplace_back(functor);
-                        return;
-                    }
+                    std::function<decltype(runtime::cpu::kernel::softmax<float>)> kernel;
+                    SELECT_KERNEL(
+                        kernel, args[0].get_element_type(), runtime::cpu::kernel::softmax);
+
+                    auto functor = [&, kernel, arg_shape, axes, arg_buffer_index, out_buffer_index](
+                                       CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        kernel(ctx->buffer_data[arg_buffer_index],
+                               ctx->buffer_data[out_buffer_index],
+                               arg_shape,
+                               axes,
+                               ectx->arena);
+                    };
+                    functors.emplace_back(functor);
+                    return;
                 }
                 std::function<decltype(runtime::cpu::kernel::ref_softmax<float>)> kernel;
                 SELECT_KERNEL(
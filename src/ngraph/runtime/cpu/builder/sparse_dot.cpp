@@ -0,0 +1,129 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/sparse_dot.hpp"
+#include "ngraph/runtime/cpu/op/sparse_dot.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <size_t Width>
+            static CPUKernelFunctor sparse_dot_functor(size_t m,
+                                                       size_t k,
+                                                       size_t n,
+                                                       size_t arg0_buffer_index,
+                                                       size_t arg1_buffer_index,
+                                                       size_t arg2_buffer_index,
+                                                       size_t arg3_buffer_index,
+                                                       size_t out_buffer_index)
+            {
+                return [m,
+                        k,
+                        n,
+                        arg0_buffer_index,
+                        arg1_buffer_index,
+                        arg2_buffer_index,
+                        arg3_buffer_index,
+                        out_buffer_index](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    kernel::sparse_dot<Width>(
+                        static_cast<const float*>(ctx->buffer_data[arg0_buffer_index]),
+                        static_cast<const float*>(ctx->buffer_data[arg1_buffer_index]),
+                        static_cast<const int32_t*>(ctx->buffer_data[arg2_buffer_index]),
+                        static_cast<const int32_t*>(ctx->buffer_data[arg3_buffer_index]),
+                        static_cast<float*>(ctx->buffer_data[out_buffer_index]),
+                        m,
+                        k,
+                        n,
+                        ectx->arena);
+                };
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::SparseDot)
+            {
+                auto& functors = external_function->get_functors();
+
+                auto dot = static_cast<const ngraph::op::SparseDot*>(node);
+                size_t k = dot->get_weights_shape()[0];
+                size_t n = dot->get_weights_shape()[1];
+                size_t m = k == 0 ? 0 : shape_size(args[0].get_shape()) / k;
+
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto arg2_buffer_index = external_function->get_buffer_index(args[2].get_name());
+                auto arg3_buffer_index = external_function->get_buffer_index(args[3].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                switch (dot->get_block_width())
+                {
+                case 1:
+                    functors.emplace_back(sparse_dot_functor<1>(m,
+                                                                k,
+                                                                n,
+                                                                arg0_buffer_index,
+                                                                arg1_buffer_index,
+                                                                arg2_buffer_index,
+                                                                arg3_buffer_index,
+                                                                out_buffer_index));
+                    break;
+                case 4:
+                    functors.emplace_back(sparse_dot_functor<4>(m,
+                                                                k,
+                                                                n,
+                                                                arg0_buffer_index,
+                                                                arg1_buffer_index,
+                                                                arg2_buffer_index,
+                                                                arg3_buffer_index,
+                                                                out_buffer_index));
+                    break;
+                case 8:
+                    functors.emplace_back(sparse_dot_functor<8>(m,
+                                                                k,
+                                                                n,
+                                                                arg0_buffer_index,
+                                                                arg1_buffer_index,
+                                                                arg2_buffer_index,
+                                                                arg3_buffer_index,
+                                                                out_buffer_index));
+                    break;
+                case 16:
+                    functors.emplace_back(sparse_dot_functor<16>(m,
+                                                                 k,
+                                                                 n,
+                                                                 arg0_buffer_index,
+                                                                 arg1_buffer_index,
+                                                                 arg2_buffer_index,
+                                                                 arg3_buffer_index,
+                                                                 out_buffer_index));
+                    break;
+                default:
+                    throw ngraph_error("Unsupported block width " +
+                                       to_string(dot->get_block_width()) +
+                                       " in CPU Builder for SparseDot");
+                }
+            }
+
+            void register_builders_sparse_dot_cpp() { REGISTER_OP_BUILDER(ngraph::op::SparseDot); }
+        }
+    }
+}
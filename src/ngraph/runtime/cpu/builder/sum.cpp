@@ -18,6 +18,8 @@
 
 #include "ngraph/op/sum.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/dnnl_utils.hpp"
+#include "ngraph/runtime/cpu/kernel/reduce_strided.hpp"
 #include "ngraph/runtime/cpu/kernel/reduce_sum.hpp"
 
 #include "reduction.hpp"
@@ -34,6 +36,32 @@ namespace ngraph
             template <>
             void Builder::BUILDER_DECL(ngraph::op::v0::Sum)
             {
+                // CPULayout keeps an nChw8c or nChw16c input of a spatial sum as it is
+                size_t block = 1;
+                if (args[0].get_element_type() == element::f32 && args[0].get_shape().size() == 4)
+                {
+                    block = dnnl_utils::get_channel_block_size(
+                        dnnl_utils::get_input_dnnl_md(node, 0));
+                }
+                if (block > 1)
+                {
+                    auto& functors = external_function->get_functors();
+                    auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                    auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                    auto arg_shape = args[0].get_shape();
+                    auto functor = [&, arg_shape, block, arg_buffer_index, out_buffer_index](
+                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        runtime::cpu::kernel::reduce_sum_spatial_blocked<float>(
+                            ctx->buffer_data[arg_buffer_index],
+                            ctx->buffer_data[out_buffer_index],
+                            arg_shape,
+                            block,
+                            ectx->arena);
+                    };
+                    functors.emplace_back(functor);
+                    return;
+                }
+
                 BUILD_REDUCTION_FUNCTOR(Sum, sum);
             }
 
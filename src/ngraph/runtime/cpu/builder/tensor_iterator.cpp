@@ -0,0 +1,360 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <array>
+#include <cstring>
+#include <limits>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/op/tensor_iterator.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/runtime/cpu/cpu_external_function.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            // The part of a sliced input or concatenated output that one iteration reads or
+            // writes: `outer` runs of part_bytes, one per index of the axes before the sliced
+            // axis. With no outer axes the part is a single run that the body can use in place.
+            struct TensorIteratorPart
+            {
+                size_t outer;
+                size_t row_bytes;
+                size_t part_bytes;
+                size_t step_bytes;
+                int64_t start;
+                int64_t stride;
+                int64_t part_size;
+
+                TensorIteratorPart(const Shape& shape,
+                                   const element::Type& type,
+                                   int64_t start_index,
+                                   int64_t stride_,
+                                   int64_t part_size_,
+                                   int64_t axis)
+                    : stride(stride_)
+                    , part_size(part_size_)
+                {
+                    size_t inner = 1;
+                    for (size_t i = static_cast<size_t>(axis) + 1; i < shape.size(); i++)
+                    {
+                        inner *= shape[i];
+                    }
+                    outer = 1;
+                    for (size_t i = 0; i < static_cast<size_t>(axis); i++)
+                    {
+                        outer *= shape[i];
+                    }
+                    int64_t axis_size = static_cast<int64_t>(shape[axis]);
+                    start = start_index < 0 ? start_index + axis_size : start_index;
+                    step_bytes = inner * type.size();
+                    row_bytes = static_cast<size_t>(axis_size) * step_bytes;
+                    part_bytes = static_cast<size_t>(part_size) * step_bytes;
+                }
+
+                bool is_contiguous() const { return outer == 1; }
+                // Byte offset of the part of `iteration` within a run of the full tensor. A
+                // negative stride walks the axis backwards, each part ending at its position.
+                size_t offset(int64_t iteration) const
+                {
+                    int64_t position = start + iteration * stride;
+                    int64_t first = stride < 0 ? position - part_size + 1 : position;
+                    return static_cast<size_t>(first) * step_bytes;
+                }
+                void gather(const char* full, char* part, int64_t iteration) const
+                {
+                    size_t begin = offset(iteration);
+                    for (size_t i = 0; i < outer; i++)
+                    {
+                        memcpy(part + i * part_bytes, full + i * row_bytes + begin, part_bytes);
+                    }
+                }
+                void scatter(const char* part, char* full, int64_t iteration) const
+                {
+                    size_t begin = offset(iteration);
+                    for (size_t i = 0; i < outer; i++)
+                    {
+                        memcpy(full + i * row_bytes + begin, part + i * part_bytes, part_bytes);
+                    }
+                }
+            };
+
+            // How the body results are stored: in place in a contiguous part of a
+            // concatenated output when there is one, otherwise alternately in two scratch
+            // buffers so that a merged value never overwrites the parameter it is computed
+            // from.
+            struct TensorIteratorResult
+            {
+                size_t bytes;
+                size_t in_place_output = numeric_limits<size_t>::max();
+            };
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::v0::TensorIterator)
+            {
+                using TI = ngraph::op::v0::TensorIterator;
+                auto& functors = external_function->get_functors();
+                auto ti = static_cast<const TI*>(node);
+                auto body = ti->get_body();
+                int64_t num_iterations = ti->get_num_iterations();
+                if (num_iterations < 0)
+                {
+                    throw ngraph_error("TensorIterator needs a static number of iterations");
+                }
+
+                // The body is compiled once, as a function of its own, and called on every
+                // iteration with pointers into the buffers of the TensorIterator
+                auto body_function = clone_function(
+                    Function(body->get_results(), body->get_parameters(), node->get_name()));
+                auto body_external_function = make_shared<CPU_ExternalFunction>(
+                    body_function, EXECUTION_MODE::DIRECT_EXECUTION);
+                ngraph::pass::PassConfig pass_config;
+                shared_ptr<CPU_CallFrame> body_call_frame =
+                    body_external_function->make_call_frame(pass_config, nullptr);
+
+                vector<size_t> arg_indices;
+                for (const auto& arg : args)
+                {
+                    arg_indices.push_back(external_function->get_buffer_index(arg.get_name()));
+                }
+                vector<size_t> out_indices;
+                for (const auto& output : out)
+                {
+                    out_indices.push_back(external_function->get_buffer_index(output.get_name()));
+                }
+
+                size_t num_params = body_function->get_parameters().size();
+                size_t num_results = body_function->get_results().size();
+                vector<size_t> param_bytes(num_params);
+                for (size_t i = 0; i < num_params; i++)
+                {
+                    const auto& param = body_function->get_parameters()[i];
+                    param_bytes[i] = shape_size(param->get_output_shape(0)) *
+                                     param->get_output_element_type(0).size();
+                }
+                vector<TensorIteratorResult> results(num_results);
+                for (size_t i = 0; i < num_results; i++)
+                {
+                    const auto& result = body_function->get_results()[i];
+                    results[i].bytes = shape_size(result->get_output_shape(0)) *
+                                       result->get_output_element_type(0).size();
+                }
+
+                vector<shared_ptr<TI::InputDescription>> inputs;
+                vector<TensorIteratorPart> input_parts;
+                for (const auto& description : ti->get_input_descriptions())
+                {
+                    inputs.push_back(description->copy());
+                    if (auto slice = as_type_ptr<TI::SliceInputDescription>(description))
+                    {
+                        input_parts.emplace_back(args[slice->m_input_index].get_shape(),
+                                                 args[slice->m_input_index].get_element_type(),
+                                                 slice->m_start,
+                                                 slice->m_stride,
+                                                 slice->m_part_size,
+                                                 slice->m_axis);
+                    }
+                    else
+                    {
+                        input_parts.emplace_back(Shape{1}, element::u8, 0, 0, 1, 0);
+                    }
+                }
+                vector<shared_ptr<TI::OutputDescription>> outputs;
+                vector<TensorIteratorPart> output_parts;
+                for (const auto& description : ti->get_output_descriptions())
+                {
+                    outputs.push_back(description->copy());
+                    if (auto concat = as_type_ptr<TI::ConcatOutputDescription>(description))
+                    {
+                        output_parts.emplace_back(out[concat->m_output_index].get_shape(),
+                                                  out[concat->m_output_index].get_element_type(),
+                                                  concat->m_start,
+                                                  concat->m_stride,
+                                                  concat->m_part_size,
+                                                  concat->m_axis);
+                        auto& result = results[concat->m_body_value_index];
+                        if (output_parts.back().is_contiguous() &&
+                            result.in_place_output == numeric_limits<size_t>::max())
+                        {
+                            result.in_place_output = outputs.size() - 1;
+                        }
+                    }
+                    else
+                    {
+                        output_parts.emplace_back(Shape{1}, element::u8, 0, 0, 1, 0);
+                    }
+                }
+
+                // Scratch space for parts that are not contiguous and for results that are not
+                // written in place, as offsets into a buffer that every runtime context has its
+                // own copy of so that concurrent calls do not share it
+                const size_t alignment = 64;
+                auto aligned = [alignment](size_t bytes) {
+                    return (bytes + alignment - 1) / alignment * alignment;
+                };
+                const size_t none = numeric_limits<size_t>::max();
+                size_t scratch_bytes = 0;
+                vector<size_t> param_scratch(num_params, none);
+                vector<array<size_t, 2>> result_scratch(num_results, {{none, none}});
+                for (size_t i = 0; i < inputs.size(); i++)
+                {
+                    if (is_type<TI::SliceInputDescription>(inputs[i]) &&
+                        !input_parts[i].is_contiguous())
+                    {
+                        size_t p = inputs[i]->m_body_parameter_index;
+                        param_scratch[p] = scratch_bytes;
+                        scratch_bytes += aligned(param_bytes[p]);
+                    }
+                }
+                for (size_t r = 0; r < num_results; r++)
+                {
+                    if (results[r].in_place_output == none)
+                    {
+                        for (size_t k = 0; k < 2; k++)
+                        {
+                            result_scratch[r][k] = scratch_bytes;
+                            scratch_bytes += aligned(results[r].bytes);
+                        }
+                    }
+                }
+                size_t scratch_buffer =
+                    scratch_bytes > 0 ? external_function->add_memory_buffer(scratch_bytes) : none;
+
+                auto functor = [body_call_frame,
+                                num_iterations,
+                                arg_indices,
+                                out_indices,
+                                param_bytes,
+                                results,
+                                inputs,
+                                input_parts,
+                                outputs,
+                                output_parts,
+                                param_scratch,
+                                result_scratch,
+                                scratch_buffer](CPURuntimeContext* ctx,
+                                                CPUExecutionContext* /* ectx */) {
+                    char* scratch =
+                        scratch_buffer == numeric_limits<size_t>::max()
+                            ? nullptr
+                            : ctx->memory_buffers[scratch_buffer]->get_ptr<char>();
+                    size_t num_params = param_bytes.size();
+                    size_t num_results = results.size();
+                    vector<void*> param_ptrs(num_params);
+                    vector<void*> result_ptrs(num_results);
+                    vector<void*> previous_result_ptrs(num_results);
+                    vector<bool> stale(num_params, true);
+                    for (int64_t iteration = 0; iteration < num_iterations; iteration++)
+                    {
+                        for (size_t i = 0; i < inputs.size(); i++)
+                        {
+                            const auto& input = inputs[i];
+                            size_t p = input->m_body_parameter_index;
+                            char* arg = static_cast<char*>(
+                                ctx->buffer_data[arg_indices[input->m_input_index]]);
+                            if (is_type<TI::SliceInputDescription>(input))
+                            {
+                                if (input_parts[i].is_contiguous())
+                                {
+                                    param_ptrs[p] = arg + input_parts[i].offset(iteration);
+                                }
+                                else
+                                {
+                                    char* part = scratch + param_scratch[p];
+                                    input_parts[i].gather(arg, part, iteration);
+                                    param_ptrs[p] = part;
+                                }
+                                stale[p] = true;
+                            }
+                            else if (auto merged =
+                                         as_type_ptr<TI::MergedInputDescription>(input))
+                            {
+                                param_ptrs[p] = iteration == 0
+                                                    ? arg
+                                                    : previous_result_ptrs
+                                                          [merged->m_body_value_index];
+                                stale[p] = true;
+                            }
+                            else
+                            {
+                                // Invariant inputs only change between calls
+                                param_ptrs[p] = arg;
+                                stale[p] = iteration == 0;
+                            }
+                        }
+                        for (size_t r = 0; r < num_results; r++)
+                        {
+                            size_t o = results[r].in_place_output;
+                            if (o != numeric_limits<size_t>::max())
+                            {
+                                size_t index = out_indices[outputs[o]->m_output_index];
+                                result_ptrs[r] = static_cast<char*>(ctx->buffer_data[index]) +
+                                                 output_parts[o].offset(iteration);
+                            }
+                            else
+                            {
+                                result_ptrs[r] = scratch + result_scratch[r][iteration % 2];
+                            }
+                        }
+
+                        body_call_frame->call_on_buffers(param_ptrs, result_ptrs, stale);
+
+                        for (size_t o = 0; o < outputs.size(); o++)
+                        {
+                            const auto& output = outputs[o];
+                            size_t r = output->m_body_value_index;
+                            char* full = static_cast<char*>(
+                                ctx->buffer_data[out_indices[output->m_output_index]]);
+                            const char* value = static_cast<const char*>(result_ptrs[r]);
+                            if (auto body_output =
+                                    as_type_ptr<TI::BodyOutputDescription>(output))
+                            {
+                                int64_t wanted = body_output->m_iteration < 0
+                                                     ? num_iterations + body_output->m_iteration
+                                                     : body_output->m_iteration;
+                                if (iteration == wanted)
+                                {
+                                    memcpy(full, value, results[r].bytes);
+                                }
+                            }
+                            else if (results[r].in_place_output != o)
+                            {
+                                output_parts[o].scatter(value, full, iteration);
+                            }
+                        }
+                        swap(result_ptrs, previous_result_ptrs);
+                    }
+                };
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_tensor_iterator_cpp()
+            {
+                REGISTER_OP_BUILDER(ngraph::op::v0::TensorIterator);
+            }
+        }
+    }
+}
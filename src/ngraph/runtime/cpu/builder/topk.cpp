@@ -14,10 +14,13 @@
 // limitations under the License.
 //*****************************************************************************
 
-#include <cstring>
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
 
 #include "ngraph/op/topk.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/kernel/arg_reduce.hpp"
 #include "ngraph/runtime/reference/topk.hpp"
 
 using namespace std;
@@ -29,6 +32,90 @@ namespace ngraph
     {
         namespace cpu
         {
+            // Slices along the TopK axis are independent, so they are split between threads.
+            // TopK with k = 1 is an ArgMax/ArgMin that also writes the values; both take the
+            // first of equal elements.
+            template <typename T, typename U>
+            static CPUKernelFunctor topk_functor(size_t arg_buffer_index,
+                                                 size_t out_indices_buffer_index,
+                                                 size_t out_values_buffer_index,
+                                                 const Shape& in_shape,
+                                                 const Shape& out_shape,
+                                                 size_t axis,
+                                                 size_t k,
+                                                 bool compute_max,
+                                                 op::v0::TopK::SortType sort)
+            {
+                size_t n = in_shape[axis];
+                if (k == 1 && n > 0)
+                {
+                    auto kernel = compute_max ? runtime::cpu::kernel::arg_reduce<true, T, U>
+                                              : runtime::cpu::kernel::arg_reduce<false, T, U>;
+                    return [=](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        kernel(ctx->buffer_data[arg_buffer_index],
+                               ctx->buffer_data[out_indices_buffer_index],
+                               ctx->buffer_data[out_values_buffer_index],
+                               in_shape,
+                               axis,
+                               ectx->arena);
+                    };
+                }
+                size_t slices = n == 0 ? 0 : shape_size(in_shape) / n;
+                return [=](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    Eigen::TensorOpCost cost(n * sizeof(T), k * (sizeof(T) + sizeof(U)), 4 * n);
+                    executor::GetCPUExecutor().get_device(ectx->arena).parallelFor(
+                        slices, cost, [&](Eigen::Index begin, Eigen::Index end) {
+                            ngraph::runtime::reference::topk<T, U>(
+                                static_cast<T*>(ctx->buffer_data[arg_buffer_index]),
+                                static_cast<U*>(ctx->buffer_data[out_indices_buffer_index]),
+                                static_cast<T*>(ctx->buffer_data[out_values_buffer_index]),
+                                in_shape,
+                                out_shape,
+                                axis,
+                                k,
+                                compute_max,
+                                sort,
+                                static_cast<size_t>(begin),
+                                static_cast<size_t>(end));
+                        });
+                };
+            }
+
+            template <typename T>
+            static CPUKernelFunctor topk_functor(bool is_int64,
+                                                 size_t arg_buffer_index,
+                                                 size_t out_indices_buffer_index,
+                                                 size_t out_values_buffer_index,
+                                                 const Shape& in_shape,
+                                                 const Shape& out_shape,
+                                                 size_t axis,
+                                                 size_t k,
+                                                 bool compute_max,
+                                                 op::v0::TopK::SortType sort)
+            {
+                if (is_int64)
+                {
+                    return topk_functor<T, int64_t>(arg_buffer_index,
+                                                    out_indices_buffer_index,
+                                                    out_values_buffer_index,
+                                                    in_shape,
+                                                    out_shape,
+                                                    axis,
+                                                    k,
+                                                    compute_max,
+                                                    sort);
+                }
+                return topk_functor<T, int32_t>(arg_buffer_index,
+                                                out_indices_buffer_index,
+                                                out_values_buffer_index,
+                                                in_shape,
+                                                out_shape,
+                                                axis,
+                                                k,
+                                                compute_max,
+                                                sort);
+            }
+
             template <>
             void Builder::BUILDER_DECL(ngraph::op::v0::TopK)
             {
@@ -57,162 +144,42 @@ namespace ngraph
                 auto element_type = args[0].get_element_type();
                 if (element_type == element::f32)
                 {
-                    if (is_int64)
-                    {
-                        functor = [&,
-                                   in_shape,
-                                   out_shape,
-                                   axis,
-                                   k,
-                                   compute_max,
-                                   sort,
-                                   arg_buffer_index,
-                                   out_indices_buffer_index,
-                                   out_values_buffer_index](CPURuntimeContext* ctx,
-                                                            CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::topk<float, int64_t>(
-                                static_cast<float*>(ctx->buffer_data[arg_buffer_index]),
-                                static_cast<int64_t*>(ctx->buffer_data[out_indices_buffer_index]),
-                                static_cast<float*>(ctx->buffer_data[out_values_buffer_index]),
-                                in_shape,
-                                out_shape,
-                                axis,
-                                k,
-                                compute_max,
-                                sort);
-                        };
-                    }
-                    else
-                    {
-                        functor = [&,
-                                   in_shape,
-                                   out_shape,
-                                   axis,
-                                   k,
-                                   compute_max,
-                                   sort,
-                                   arg_buffer_index,
-                                   out_indices_buffer_index,
-                                   out_values_buffer_index](CPURuntimeContext* ctx,
-                                                            CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::topk<float, int32_t>(
-                                static_cast<float*>(ctx->buffer_data[arg_buffer_index]),
-                                static_cast<int32_t*>(ctx->buffer_data[out_indices_buffer_index]),
-                                static_cast<float*>(ctx->buffer_data[out_values_buffer_index]),
-                                in_shape,
-                                out_shape,
-                                axis,
-                                k,
-                                compute_max,
-                                sort);
-                        };
-                    }
+                    functor = topk_functor<float>(is_int64,
+                                                  arg_buffer_index,
+                                                  out_indices_buffer_index,
+                                                  out_values_buffer_index,
+                                                  in_shape,
+                                                  out_shape,
+                                                  axis,
+                                                  k,
+                                                  compute_max,
+                                                  sort);
                 }
                 else if (element_type == element::f64)
                 {
-                    if (is_int64)
-                    {
-                        functor = [&,
-                                   in_shape,
-                                   out_shape,
-                                   axis,
-                                   k,
-                                   compute_max,
-                                   sort,
-                                   arg_buffer_index,
-                                   out_indices_buffer_index,
-                                   out_values_buffer_index](CPURuntimeContext* ctx,
-                                                            CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::topk<double, int64_t>(
-                                static_cast<double*>(ctx->buffer_data[arg_buffer_index]),
-                                static_cast<int64_t*>(ctx->buffer_data[out_indices_buffer_index]),
-                                static_cast<double*>(ctx->buffer_data[out_values_buffer_index]),
-                                in_shape,
-                                out_shape,
-                                axis,
-                                k,
-                                compute_max,
-                                sort);
-                        };
-                    }
-                    else
-                    {
-                        functor = [&,
-                                   in_shape,
-                                   out_shape,
-                                   axis,
-                                   k,
-                                   compute_max,
-                                   sort,
-                                   arg_buffer_index,
-                                   out_indices_buffer_index,
-                                   out_values_buffer_index](CPURuntimeContext* ctx,
-                                                            CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::topk<double, int32_t>(
-                                static_cast<double*>(ctx->buffer_data[arg_buffer_index]),
-                                static_cast<int32_t*>(ctx->buffer_data[out_indices_buffer_index]),
-                                static_cast<double*>(ctx->buffer_data[out_values_buffer_index]),
-                                in_shape,
-                                out_shape,
-                                axis,
-                                k,
-                                compute_max,
-                                sort);
-                        };
-                    }
+                    functor = topk_functor<double>(is_int64,
+                                                   arg_buffer_index,
+                                                   out_indices_buffer_index,
+                                                   out_values_buffer_index,
+                                                   in_shape,
+                                                   out_shape,
+                                                   axis,
+                                                   k,
+                                                   compute_max,
+                                                   sort);
                 }
                 else if (element_type == element::i32)
                 {
-                    if (is_int64)
-                    {
-                        functor = [&,
-                                   in_shape,
-                                   out_shape,
-                                   axis,
-                                   k,
-                                   compute_max,
-                                   sort,
-                                   arg_buffer_index,
-                                   out_indices_buffer_index,
-                                   out_values_buffer_index](CPURuntimeContext* ctx,
-                                                            CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::topk<int32_t, int64_t>(
-                                static_cast<int32_t*>(ctx->buffer_data[arg_buffer_index]),
-                                static_cast<int64_t*>(ctx->buffer_data[out_indices_buffer_index]),
-                                static_cast<int32_t*>(ctx->buffer_data[out_values_buffer_index]),
-                                in_shape,
-                                out_shape,
-                                axis,
-                                k,
-                                compute_max,
-                                sort);
-                        };
-                    }
-                    else
-                    {
-                        functor = [&,
-                                   in_shape,
-                                   out_shape,
-                                   axis,
-                                   k,
-                                   compute_max,
-                                   sort,
-                                   arg_buffer_index,
-                                   out_indices_buffer_index,
-                                   out_values_buffer_index](CPURuntimeContext* ctx,
-                                                            CPUExecutionContext* /* ectx */) {
-                            ngraph::runtime::reference::topk<int32_t, int32_t>(
-                                static_cast<int32_t*>(ctx->buffer_data[arg_buffer_index]),
-                                static_cast<int32_t*>(ctx->buffer_data[out_indices_buffer_index]),
-                                static_cast<int32_t*>(ctx->buffer_data[out_values_buffer_index]),
-                                in_shape,
-                                out_shape,
-                                axis,
-                                k,
-                                compute_max,
-                                sort);
-                        };
-                    }
+                    functor = topk_functor<int32_t>(is_int64,
+                                                    arg_buffer_index,
+                                                    out_indices_buffer_index,
+                                                    out_values_buffer_index,
+                                                    in_shape,
+                                                    out_shape,
+                                                    axis,
+                                                    k,
+                                                    compute_max,
+                                                    sort);
                 }
                 else
                 {
@@ -0,0 +1,75 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/experimental/variable.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/state/variable_state.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::v0::ReadVariable)
+            {
+                auto& functors = external_function->get_functors();
+
+                auto read = static_cast<const ngraph::op::v0::ReadVariable*>(node);
+                auto index = external_function->get_variable_state_index(
+                    read->get_variable_id(), args[0].get_element_type(), args[0].get_shape());
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto functor = [&, index, arg_buffer_index, out_buffer_index](
+                                   CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {
+                    static_cast<VariableState*>(ctx->states[index])
+                        ->read(ctx->buffer_data[out_buffer_index],
+                               ctx->buffer_data[arg_buffer_index]);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::v0::AssignVariable)
+            {
+                auto& functors = external_function->get_functors();
+
+                auto assign = static_cast<const ngraph::op::v0::AssignVariable*>(node);
+                auto index = external_function->get_variable_state_index(
+                    assign->get_variable_id(), args[0].get_element_type(), args[0].get_shape());
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+
+                auto functor = [&, index, arg_buffer_index](CPURuntimeContext* ctx,
+                                                            CPUExecutionContext* /* ectx */) {
+                    static_cast<VariableState*>(ctx->states[index])
+                        ->write(ctx->buffer_data[arg_buffer_index]);
+                };
+                functors.emplace_back(functor);
+            }
+
+            void register_builders_variable_cpp()
+            {
+                REGISTER_OP_BUILDER(ngraph::op::v0::ReadVariable);
+                REGISTER_OP_BUILDER(ngraph::op::v0::AssignVariable);
+            }
+        }
+    }
+}
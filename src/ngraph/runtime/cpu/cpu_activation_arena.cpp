@@ -0,0 +1,57 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+
+#include "ngraph/runtime/cpu/cpu_activation_arena.hpp"
+#include "ngraph/runtime/cpu/cpu_external_function.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::cpu::CPUActivationArena::CPUActivationArena(Allocator* allocator)
+    : m_allocator(allocator)
+{
+}
+
+size_t runtime::cpu::CPUActivationArena::get_size() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_size;
+}
+
+size_t runtime::cpu::CPUActivationArena::get_allocated_size() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_memory ? m_memory->size() : 0;
+}
+
+void runtime::cpu::CPUActivationArena::require(size_t bytes)
+{
+    lock_guard<mutex> lock(m_mutex);
+    m_size = max(m_size, bytes);
+}
+
+shared_ptr<runtime::AlignedBuffer> runtime::cpu::CPUActivationArena::get_memory()
+{
+    lock_guard<mutex> lock(m_mutex);
+    if (!m_memory || m_memory->size() < m_size)
+    {
+        const size_t alignment = CPU_ExternalFunction::s_memory_pool_alignment;
+        m_memory = make_shared<AlignedBuffer>(m_size, alignment, m_allocator);
+    }
+    return m_memory;
+}
@@ -0,0 +1,72 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/allocator.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            class CPU_CallFrame;
+
+            /// \brief Activation memory shared by the executables compiled against it, e.g.
+            ///        the stages of a pipeline that run one after another.
+            ///
+            /// The arena is as large as the largest activation pools and scratchpad of its
+            /// executables, and is allocated by the first call. Calls on the arena run one
+            /// at a time, so its executables have a single runtime context, and every call
+            /// recomputes all its values since the others overwrite them.
+            class CPU_BACKEND_API CPUActivationArena
+            {
+            public:
+                /// \param allocator Allocator of the arena memory, nullptr for the default.
+                ///        Must outlive the arena.
+                explicit CPUActivationArena(Allocator* allocator = nullptr);
+
+                /// \brief Bytes the arena needs for the executables compiled against it
+                size_t get_size() const;
+                /// \brief Bytes currently allocated, 0 before the first call
+                size_t get_allocated_size() const;
+
+            private:
+                friend class CPU_CallFrame;
+
+                /// Grows the arena to hold `bytes` when it is next allocated
+                void require(size_t bytes);
+                /// \returns Memory of at least get_size() bytes. When the arena grew, the
+                ///          previous memory stays alive as long as its users hold it.
+                std::shared_ptr<AlignedBuffer> get_memory();
+
+                Allocator* m_allocator;
+                size_t m_size{0};
+                std::shared_ptr<AlignedBuffer> m_memory;
+                mutable std::mutex m_mutex;
+                /// Held by the call running on the arena
+                std::mutex m_call_mutex;
+            };
+        }
+    }
+}
@@ -0,0 +1,221 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/runtime/cpu/cpu_autotune.hpp"
+#include "ngraph/runtime/cpu/cpu_backend.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+vector<runtime::cpu::CPUTuning> runtime::cpu::get_tuning_candidates(bool throughput)
+{
+    auto& cpu_executor = executor::GetCPUExecutor();
+    int cores = max(cpu_executor.get_num_cores(), 1);
+
+    vector<int> intra_op_threads{0};
+    for (int threads : {cores / 2, cores / 4})
+    {
+        if (threads > 0 &&
+            find(intra_op_threads.begin(), intra_op_threads.end(), threads) ==
+                intra_op_threads.end())
+        {
+            intra_op_threads.push_back(threads);
+        }
+    }
+    vector<bool> inter_op{true};
+    if (cpu_executor.get_num_thread_pools() > 1)
+    {
+        inter_op.push_back(false);
+    }
+    vector<int> concurrency{1};
+    if (throughput)
+    {
+        for (int calls : {2, 4})
+        {
+            if (calls <= static_cast<int>(thread::hardware_concurrency()))
+            {
+                concurrency.push_back(calls);
+            }
+        }
+    }
+    vector<bool> use_tbb{false};
+#if defined(NGRAPH_TBB_ENABLE)
+    use_tbb.push_back(true);
+#endif
+
+    vector<CPUTuning> candidates;
+    for (int threads : intra_op_threads)
+    {
+        for (bool inter : inter_op)
+        {
+            for (int calls : concurrency)
+            {
+                for (bool tbb : use_tbb)
+                {
+                    CPUTuning tuning;
+                    tuning.intra_op_threads = threads;
+                    tuning.inter_op = inter;
+                    tuning.concurrency = calls;
+                    tuning.use_tbb = tbb;
+                    candidates.push_back(tuning);
+                }
+            }
+        }
+    }
+    return candidates;
+}
+
+static double time_candidate(runtime::cpu::CPU_Backend& backend,
+                             const shared_ptr<Function>& func,
+                             const runtime::cpu::CPUTuning& tuning,
+                             size_t iterations,
+                             const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    backend.set_tuning(make_shared<runtime::cpu::CPUTuning>(tuning));
+    auto exec = backend.compile(clone_function(*func));
+
+    size_t clients = static_cast<size_t>(max(tuning.concurrency, 1));
+    vector<vector<shared_ptr<runtime::Tensor>>> outputs(clients);
+    for (auto& client_outputs : outputs)
+    {
+        for (auto& result : func->get_results())
+        {
+            client_outputs.push_back(backend.create_tensor(result->get_output_element_type(0),
+                                                           result->get_output_shape(0)));
+        }
+    }
+
+    auto run_clients = [&](size_t calls) {
+        auto start = chrono::steady_clock::now();
+        vector<thread> threads;
+        for (size_t client = 1; client < clients; client++)
+        {
+            threads.emplace_back([&, client]() {
+                for (size_t i = 0; i < calls; i++)
+                {
+                    exec->call(outputs[client], inputs);
+                }
+            });
+        }
+        for (size_t i = 0; i < calls; i++)
+        {
+            exec->call(outputs[0], inputs);
+        }
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+        return chrono::duration<double, micro>(chrono::steady_clock::now() - start).count();
+    };
+
+    // The first call of every context builds its primitives
+    run_clients(2);
+    double microseconds = run_clients(iterations) / (iterations * clients);
+    backend.remove_compiled_function(exec);
+    return microseconds;
+}
+
+vector<runtime::cpu::CPUTuningResult>
+    runtime::cpu::autotune(CPU_Backend& backend,
+                           const shared_ptr<Function>& func,
+                           size_t iterations,
+                           bool throughput,
+                           const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    iterations = max(iterations, size_t(1));
+    vector<shared_ptr<runtime::Tensor>> call_inputs = inputs;
+    if (call_inputs.empty())
+    {
+        for (auto& parameter : func->get_parameters())
+        {
+            auto tensor = backend.create_tensor(parameter->get_element_type(),
+                                                parameter->get_output_shape(0));
+            vector<char> zeros(tensor->get_size_in_bytes(), 0);
+            tensor->write(zeros.data(), zeros.size());
+            call_inputs.push_back(tensor);
+        }
+    }
+
+    auto previous_tuning = backend.get_tuning();
+    vector<CPUTuningResult> results;
+    try
+    {
+        for (auto& tuning : get_tuning_candidates(throughput))
+        {
+            double microseconds = time_candidate(backend, func, tuning, iterations, call_inputs);
+            NGRAPH_DEBUG << "Autotune " << func->get_name() << ": " << microseconds
+                         << "us per call with\n"
+                         << tuning.to_string();
+            results.push_back(CPUTuningResult{tuning, microseconds});
+        }
+    }
+    catch (...)
+    {
+        backend.set_tuning(previous_tuning);
+        throw;
+    }
+    backend.set_tuning(previous_tuning);
+
+    stable_sort(results.begin(),
+                results.end(),
+                [](const CPUTuningResult& a, const CPUTuningResult& b) {
+                    return a.microseconds_per_call < b.microseconds_per_call;
+                });
+    return results;
+}
+
+bool runtime::cpu::record_profile(const runtime::Executable& exec, CPUTuning& tuning)
+{
+    vector<pair<string, double>> op_profile;
+    bool timed = false;
+    for (auto& counter : exec.get_performance_data())
+    {
+        double microseconds = -1;
+        if (counter.call_count() > 0)
+        {
+            microseconds = double(counter.total_microseconds()) / counter.call_count();
+            timed = true;
+        }
+        op_profile.emplace_back(counter.get_node()->description(), microseconds);
+    }
+    if (timed)
+    {
+        tuning.op_profile = move(op_profile);
+    }
+    return timed;
+}
+
+bool runtime::cpu::store_tuning(const shared_ptr<Function>& func,
+                                const CPUTuning& tuning,
+                                const ngraph::pass::PassConfig& pass_config)
+{
+    auto cache_dir = get_compile_cache_dir();
+    if (cache_dir.empty())
+    {
+        return false;
+    }
+    auto key = compute_compile_cache_key(
+        serialize_for_cache_key(func), pass_config, EXECUTION_MODE::DIRECT_EXECUTION);
+    write_cached_tuning(cache_dir, key, tuning);
+    return true;
+}
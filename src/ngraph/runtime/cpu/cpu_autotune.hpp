@@ -0,0 +1,88 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/pass/pass_config.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+#include "ngraph/runtime/cpu/cpu_compile_cache.hpp"
+#include "ngraph/runtime/executable.hpp"
+#include "ngraph/runtime/tensor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            class CPU_Backend;
+
+            struct CPUTuningResult
+            {
+                CPUTuning tuning;
+                /// Wall time per call; with concurrent calls, the inverse of the throughput
+                double microseconds_per_call;
+            };
+
+            /// \brief The settings autotune() tries: the shared thread pools and pinned pools
+            ///        of half and a quarter of the cores, with and without inter-op
+            ///        parallelism and TBB. Only `throughput` tuning tries concurrent calls.
+            CPU_BACKEND_API std::vector<CPUTuning> get_tuning_candidates(bool throughput);
+
+            /// \brief Benchmarks `func` under each of get_tuning_candidates(throughput).
+            ///
+            /// Every candidate compiles a clone of `func` on `backend`, so `func` itself is
+            /// left as it is. A candidate with concurrency N is timed with N threads calling
+            /// at once, each on outputs of its own.
+            /// \param inputs Values to call with, zeros if empty
+            /// \returns The results of all the candidates, fastest first
+            CPU_BACKEND_API std::vector<CPUTuningResult>
+                autotune(CPU_Backend& backend,
+                         const std::shared_ptr<Function>& func,
+                         size_t iterations,
+                         bool throughput,
+                         const std::vector<std::shared_ptr<runtime::Tensor>>& inputs =
+                             std::vector<std::shared_ptr<runtime::Tensor>>());
+
+            /// \brief Sets `tuning.op_profile` from the op timings of `exec`, which must have
+            ///        been compiled with performance counters or run with
+            ///        NGRAPH_CPU_TIMING_SAMPLE_PERIOD, e.g. in production.
+            ///
+            /// Compiling the same function with the result, through CPU_Backend::set_tuning or
+            /// store_tuning(), runs ops that took at most NGRAPH_CPU_INLINE_OP_MICROSECONDS
+            /// inline, and others on the thread pools whatever their size. The op scheduler
+            /// starts the ready ops on the longest path of recorded time first.
+            /// \returns false if no op of `exec` has been timed yet
+            CPU_BACKEND_API bool record_profile(const runtime::Executable& exec,
+                                                CPUTuning& tuning);
+
+            /// \brief Stores `tuning` in the compile cache (NGRAPH_CPU_CACHE_DIR) so that
+            ///        CPU_Backend::compile runs `func` with it from now on, in this process or
+            ///        another. `func` must not have been compiled yet, as compiling rewrites
+            ///        it, and `pass_config` must be the one it will be compiled with.
+            /// \returns false if the compile cache is disabled
+            CPU_BACKEND_API bool
+                store_tuning(const std::shared_ptr<Function>& func,
+                             const CPUTuning& tuning,
+                             const ngraph::pass::PassConfig& pass_config =
+                                 ngraph::pass::PassConfig());
+        }
+    }
+}
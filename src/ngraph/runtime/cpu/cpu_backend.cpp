@@ -20,16 +20,24 @@
 
 #include "cpu_backend_visibility.h"
 
+#include <cstdio>
+#include <fstream>
+#include <thread>
+
+#include "ngraph/chrome_trace.hpp"
 #include "ngraph/env_util.hpp"
+#include "ngraph/file_util.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
-#include "ngraph/runtime/cpu/cpu_builder_registry.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/runtime/cpu/cpu_compile_cache.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
+#include "ngraph/runtime/cpu/cpu_numa.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor.hpp"
 #include "ngraph/runtime/cpu/static_initialize.hpp"
+#include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
 
 #ifdef NGRAPH_CPU_MLIR_ENABLE
@@ -43,34 +51,42 @@ using namespace std;
 extern "C" CPU_BACKEND_API void ngraph_register_cpu_backend()
 {
     runtime::BackendManager::register_backend("CPU", [](const std::string& config) {
-        static bool is_initialized = false;
-        if (!is_initialized)
-        {
 #if defined(NGRAPH_TBB_ENABLE)
-            // Force TBB to link to the backend
-            tbb::TBB_runtime_interface_version();
+        // Force TBB to link to the backend
+        static once_flag s_initialized;
+        call_once(s_initialized, []() { tbb::TBB_runtime_interface_version(); });
 #endif
-            ngraph::runtime::cpu::register_builders();
-            is_initialized = true;
-        }
         return make_shared<runtime::cpu::CPU_Backend>(config);
     });
 }
 
 runtime::cpu::CPU_Backend::CPU_Backend(const string& config)
     : m_allocator{nullptr}
+    , m_execution_mode{EXECUTION_MODE::DIRECT_EXECUTION}
+    , m_numa_node{-1}
+    , m_constant_store{make_shared<CPUConstantStore>()}
 {
-    if (config == "CODEGEN")
+    // config is a comma separated list such as "CODEGEN", "MLIR,numa_node=1" or "cpus=0-3:8"
+    const string numa_option = "numa_node=";
+    const string cpus_option = "cpus=";
+    for (const string& option : split(config, ',', true))
     {
-        m_execution_mode = EXECUTION_MODE::CODEGEN;
-    }
-    else if (config == "MLIR")
-    {
-        m_execution_mode = EXECUTION_MODE::MLIR;
-    }
-    else
-    {
-        m_execution_mode = EXECUTION_MODE::DIRECT_EXECUTION;
+        if (option == "CODEGEN")
+        {
+            m_execution_mode = EXECUTION_MODE::CODEGEN;
+        }
+        else if (option == "MLIR")
+        {
+            m_execution_mode = EXECUTION_MODE::MLIR;
+        }
+        else if (option.compare(0, numa_option.size(), numa_option) == 0)
+        {
+            set_numa_node(parse_string<int>(option.substr(numa_option.size())));
+        }
+        else if (option.compare(0, cpus_option.size(), cpus_option) == 0)
+        {
+            set_cpus(numa::parse_cpu_list(option.substr(cpus_option.size()), ':'));
+        }
     }
 }
 
@@ -79,6 +95,57 @@ runtime::cpu::CPU_Backend::~CPU_Backend()
     m_exec_map.clear();
 }
 
+void runtime::cpu::CPU_Backend::set_numa_node(int node)
+{
+    NGRAPH_CHECK(node >= -1 && node < numa::get_node_count(),
+                 "NUMA node ",
+                 node,
+                 " out of range [-1-",
+                 numa::get_node_count() - 1,
+                 "]");
+    m_numa_node = node;
+}
+
+int runtime::cpu::CPU_Backend::get_numa_node() const
+{
+    return m_numa_node;
+}
+
+void runtime::cpu::CPU_Backend::set_cpus(const vector<int>& cpus)
+{
+    for (int cpu : cpus)
+    {
+        NGRAPH_CHECK(cpu >= 0, "Invalid CPU ", cpu);
+    }
+    m_cpus = cpus;
+}
+
+const vector<int>& runtime::cpu::CPU_Backend::get_cpus() const
+{
+    return m_cpus;
+}
+
+void runtime::cpu::CPU_Backend::set_tuning(shared_ptr<CPUTuning> tuning)
+{
+    m_tuning = tuning;
+}
+
+const shared_ptr<runtime::cpu::CPUTuning>& runtime::cpu::CPU_Backend::get_tuning() const
+{
+    return m_tuning;
+}
+
+void runtime::cpu::CPU_Backend::set_activation_arena(shared_ptr<CPUActivationArena> arena)
+{
+    m_activation_arena = arena;
+}
+
+const shared_ptr<runtime::cpu::CPUActivationArena>&
+    runtime::cpu::CPU_Backend::get_activation_arena() const
+{
+    return m_activation_arena;
+}
+
 shared_ptr<runtime::cpu::CPU_CallFrame> runtime::cpu::CPU_Backend::make_call_frame(
     const shared_ptr<runtime::cpu::CPU_ExternalFunction>& external_function,
     ngraph::pass::PassConfig& pass_config,
@@ -104,6 +171,20 @@ shared_ptr<runtime::Tensor> runtime::cpu::CPU_Backend::create_tensor(
     return make_shared<runtime::cpu::CPUTensor>(element_type, shape, memory_pointer);
 }
 
+shared_ptr<runtime::Tensor>
+    runtime::cpu::CPU_Backend::create_tensor_view(const shared_ptr<runtime::Tensor>& base,
+                                                  const Shape& shape,
+                                                  size_t offset,
+                                                  const Strides& strides)
+{
+    auto cpu_base = dynamic_pointer_cast<runtime::cpu::CPUTensor>(base);
+    if (!cpu_base)
+    {
+        throw invalid_argument("Views need a base tensor created by the CPU backend");
+    }
+    return make_shared<runtime::cpu::CPUTensor>(cpu_base, shape, offset, strides);
+}
+
 shared_ptr<runtime::Executable>
     runtime::cpu::CPU_Backend::compile(shared_ptr<Function> func, bool performance_counters_enabled)
 {
@@ -116,6 +197,9 @@ shared_ptr<runtime::Executable>
                                        ngraph::pass::PassConfig& pass_config,
                                        bool performance_counters_enabled)
 {
+    // The passes run by the compile are traced within this event
+    event::Duration compile_event(
+        "compile", "CPU", R"({"function":")" + func->get_name() + R"("})");
 #ifdef NGRAPH_CPU_MLIR_ENABLE
     if (m_execution_mode == EXECUTION_MODE::MLIR)
     {
@@ -127,9 +211,10 @@ shared_ptr<runtime::Executable>
 #endif
 
     shared_ptr<runtime::Executable> rc;
-    // we will protect the access to map (m_exec_map) across multiple threads by creating a
-    // lock_gaurd
-    // m_exec_map_mutex will be released once the object `guard` goes out of scope
+    // Different functions compile concurrently. Compiling rewrites the function, so a thread
+    // asking for a function that is being compiled waits for that compile instead.
+    promise<shared_ptr<runtime::Executable>> compiled;
+    shared_future<shared_ptr<runtime::Executable>> pending;
     {
         std::lock_guard<std::mutex> guard(m_exec_map_mutex);
         auto it = m_exec_map.find(func);
@@ -138,17 +223,152 @@ shared_ptr<runtime::Executable>
             rc = it->second;
             return rc;
         }
+        auto compiling = m_pending_compiles.find(func);
+        if (compiling != m_pending_compiles.end())
+        {
+            pending = compiling->second;
+        }
+        else
+        {
+            m_pending_compiles.insert({func, compiled.get_future().share()});
+        }
+    }
+    if (pending.valid())
+    {
+        return pending.get();
+    }
+
+    try
+    {
+        auto cache_dir = get_compile_cache_dir();
+        if (!cache_dir.empty() && m_execution_mode == EXECUTION_MODE::DIRECT_EXECUTION)
+        {
+            rc = compile_with_disk_cache(
+                func, pass_config, performance_counters_enabled, cache_dir);
+        }
+        if (!rc)
+        {
+            rc = make_shared<CPU_Executable>(func,
+                                             pass_config,
+                                             get_host_memory_allocator(),
+                                             performance_counters_enabled,
+                                             m_execution_mode,
+                                             m_numa_node,
+                                             m_constant_store,
+                                             m_cpus,
+                                             m_tuning,
+                                             m_activation_arena);
+        }
+    }
+    catch (...)
+    {
+        {
+            std::lock_guard<std::mutex> guard(m_exec_map_mutex);
+            m_pending_compiles.erase(func);
+        }
+        compiled.set_exception(current_exception());
+        throw;
     }
-    rc = make_shared<CPU_Executable>(func,
-                                     pass_config,
-                                     get_host_memory_allocator(),
-                                     performance_counters_enabled,
-                                     m_execution_mode);
     {
         std::lock_guard<std::mutex> guard(m_exec_map_mutex);
         m_exec_map.insert({func, rc});
-        return rc;
+        m_pending_compiles.erase(func);
+    }
+    compiled.set_value(rc);
+    return rc;
+}
+
+shared_ptr<runtime::Executable>
+    runtime::cpu::CPU_Backend::compile_with_disk_cache(shared_ptr<Function> func,
+                                                       ngraph::pass::PassConfig& pass_config,
+                                                       bool performance_counters_enabled,
+                                                       const string& cache_dir)
+{
+    CPUSaveData save_data;
+    shared_ptr<Function> prepared;
+    string path;
+    try
+    {
+        save_data.key =
+            compute_compile_cache_key(serialize_for_cache_key(func), pass_config, m_execution_mode);
+        path = file_util::path_join(cache_dir, save_data.key + ".ngcpu");
+
+        if (file_util::exists(path))
+        {
+            ifstream in(path, ios::binary);
+            CPUSaveData cached;
+            if (read_save_data(in, cached) && cached.key == save_data.key)
+            {
+                save_data = cached;
+                prepared = deserialize(save_data.model);
+            }
+        }
+        save_data.tuning = m_tuning ? m_tuning : read_cached_tuning(cache_dir, save_data.key);
+
+        if (!prepared)
+        {
+            save_data.pass_config = pass_config;
+            prepared = run_cacheable_passes(func, save_data.pass_config);
+            save_data.model = serialize(prepared, 0);
+
+            // Write to a temporary file first so concurrent processes never see a partial entry.
+            // The name is unique to the process and thread as identical functions may compile
+            // concurrently.
+            file_util::make_directory(cache_dir);
+            string tmp_path = get_temporary_path(path);
+            {
+                ofstream out(tmp_path, ios::binary);
+                write_save_data(out, save_data);
+            }
+            if (rename(tmp_path.c_str(), path.c_str()) != 0)
+            {
+                file_util::remove_file(tmp_path);
+            }
+        }
+    }
+    catch (const exception& e)
+    {
+        NGRAPH_DEBUG << "CPU compile cache skipped for " << func->get_name() << ": " << e.what();
+        return nullptr;
+    }
+
+    auto exec = make_shared<CPU_Executable>(prepared,
+                                            save_data.pass_config,
+                                            get_host_memory_allocator(),
+                                            performance_counters_enabled,
+                                            m_execution_mode,
+                                            m_numa_node,
+                                            m_constant_store,
+                                            m_cpus,
+                                            save_data.tuning,
+                                            m_activation_arena);
+    exec->set_save_data(save_data);
+    return exec;
+}
+
+shared_ptr<runtime::Executable> runtime::cpu::CPU_Backend::load(istream& input_stream)
+{
+    CPUSaveData save_data;
+    if (!read_save_data(input_stream, save_data))
+    {
+        throw ngraph_error("Stream does not contain a CPU save file");
+    }
+    if (m_tuning)
+    {
+        save_data.tuning = m_tuning;
     }
+    auto exec = make_shared<CPU_Executable>(deserialize(save_data.model),
+                                            save_data.pass_config,
+                                            get_host_memory_allocator(),
+                                            false,
+                                            m_execution_mode,
+                                            m_numa_node,
+                                            m_constant_store,
+                                            m_cpus,
+                                            save_data.tuning,
+                                            m_activation_arena);
+    exec->set_save_data(save_data);
+    return exec;
 }
 
 bool runtime::cpu::CPU_Backend::is_supported(const Node& /* op */) const
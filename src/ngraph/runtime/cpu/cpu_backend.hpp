@@ -16,15 +16,18 @@
 
 #pragma once
 
+#include <future>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include "cpu_backend_visibility.h"
 #include "ngraph/pass/pass_config.hpp"
 #include "ngraph/runtime/allocator.hpp"
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
+#include "ngraph/runtime/cpu/cpu_constant_store.hpp"
 #include "ngraph/runtime/cpu/cpu_executable.hpp"
 #include "ngraph/runtime/cpu/cpu_execution_mode.hpp"
 
@@ -59,6 +62,12 @@ namespace ngraph
                     create_tensor(const ngraph::element::Type& element_type,
                                   const Shape& shape) override;
 
+                std::shared_ptr<ngraph::runtime::Tensor>
+                    create_tensor_view(const std::shared_ptr<ngraph::runtime::Tensor>& base,
+                                       const Shape& shape,
+                                       size_t offset,
+                                       const Strides& strides) override;
+
                 std::shared_ptr<ngraph::runtime::Executable>
                     compile(std::shared_ptr<Function> func,
                             bool enable_performance_counters = false) override;
@@ -70,20 +79,88 @@ namespace ngraph
 
                 void remove_compiled_function(std::shared_ptr<Executable> exec) override;
 
+                /// \brief Load an executable written by CPU_Executable::save.
+                std::shared_ptr<Executable> load(std::istream& input_stream) override;
+
                 Allocator* get_host_memory_allocator() override;
                 void set_host_memory_allocator(Allocator* allocator) override;
 
                 bool is_supported(const Node& node) const override;
                 bool is_supported_property(const Property prop) const override;
 
+                /// \brief Place executables compiled from now on on NUMA node `node`.
+                ///
+                /// Their intermediate buffers are bound to the node's memory and their kernels
+                /// run on a thread pool pinned to its CPUs. -1, the default, leaves placement
+                /// to the operating system. Also set by a "numa_node=N" backend config option.
+                void set_numa_node(int node);
+                int get_numa_node() const;
+
+                /// \brief Run the ops of executables compiled from now on on threads of their
+                ///        own, one bound to each of `cpus`.
+                ///
+                /// Executables of other backends never run on those threads, so models placed
+                /// on disjoint CPU sets do not compete for cores. Executables with the same set
+                /// share its threads. The thread calling an executable also runs part of the
+                /// work, so it is best bound to the same CPUs, e.g. with
+                /// numa::bind_current_thread_to_cpus. Empty, the default, uses the shared
+                /// thread pools. Also set by a "cpus=0-3:8" backend config option, with ':'
+                /// separating the ranges.
+                void set_cpus(const std::vector<int>& cpus);
+                const std::vector<int>& get_cpus() const;
+
+                /// \brief Compile the following executables with `tuning`, e.g. a candidate
+                ///        of autotune(), rather than the settings stored with their model.
+                ///
+                /// With nullptr, the default, an executable uses the tuning stored with its
+                /// model in the compile cache (NGRAPH_CPU_CACHE_DIR) or its save file, if any,
+                /// and otherwise the settings of the environment.
+                void set_tuning(std::shared_ptr<CPUTuning> tuning);
+                const std::shared_ptr<CPUTuning>& get_tuning() const;
+
+                /// \brief Compile the following executables against `arena`, which they
+                ///        share with each other and with the executables of other backends
+                ///        compiled against it. For executables run one after another, e.g.
+                ///        the stages of a pipeline, as their calls on it are serialized.
+                ///        nullptr, the default, gives every executable pools of its own.
+                void set_activation_arena(std::shared_ptr<CPUActivationArena> arena);
+                const std::shared_ptr<CPUActivationArena>& get_activation_arena() const;
+
+                /// \brief The store through which the executables of this backend share
+                ///        identical constants, including their DNNL-reordered copies.
+                ///        Disabled for a compilation by turning off the CPUConstantInterning
+                ///        pass.
+                const std::shared_ptr<CPUConstantStore>& get_constant_store() const
+                {
+                    return m_constant_store;
+                }
+
             private:
+                /// \brief Compile through the on-disk cache in `cache_dir`.
+                /// \returns nullptr if the function cannot be cached, e.g. when it holds ops
+                ///          the serializer does not support.
+                std::shared_ptr<Executable>
+                    compile_with_disk_cache(std::shared_ptr<Function> func,
+                                            ngraph::pass::PassConfig& pass_config,
+                                            bool performance_counters_enabled,
+                                            const std::string& cache_dir);
+
                 // this mutex will be used to protect the addition and deletion
                 // of function to m_exec_map across multiple threads
                 std::mutex m_exec_map_mutex;
                 std::unordered_map<std::shared_ptr<Function>, std::shared_ptr<Executable>>
                     m_exec_map;
+                /// Functions being compiled, which other threads compiling them wait for
+                std::unordered_map<std::shared_ptr<Function>,
+                                   std::shared_future<std::shared_ptr<Executable>>>
+                    m_pending_compiles;
                 Allocator* m_allocator;
                 EXECUTION_MODE m_execution_mode;
+                int m_numa_node;
+                std::vector<int> m_cpus;
+                std::shared_ptr<CPUTuning> m_tuning;
+                std::shared_ptr<CPUActivationArena> m_activation_arena;
+                std::shared_ptr<CPUConstantStore> m_constant_store;
             };
         }
     }
@@ -70,6 +70,9 @@
 #include "ngraph/runtime/cpu/cpu_builder_registry.hpp"
 #include "ngraph/runtime/cpu/cpu_kernels.hpp"
 #include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
+#include "ngraph/runtime/cpu/dnnl_emitter.hpp"
+#include "ngraph/runtime/cpu/dnnl_invoke.hpp"
+#include "ngraph/runtime/cpu/dnnl_utils.hpp"
 #include "ngraph/runtime/cpu/kernel/abs.hpp"
 #include "ngraph/runtime/cpu/kernel/acos.hpp"
 #include "ngraph/runtime/cpu/kernel/add.hpp"
@@ -359,7 +362,14 @@ namespace ngraph
             template <>
             void Builder::BUILDER_DECL(ngraph::op::v0::Sqrt)
             {
-                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::sqrt);
+                if (runtime::cpu::dnnl_utils::use_dnnl_kernel(node))
+                {
+                    BUILD_DNNL_ELTWISE_FUNCTOR;
+                }
+                else
+                {
+                    BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::sqrt);
+                }
             }
 
             template <>
@@ -395,13 +405,27 @@ namespace ngraph
             template <>
             void Builder::BUILDER_DECL(ngraph::op::v0::Exp)
             {
-                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::exp);
+                if (runtime::cpu::dnnl_utils::use_dnnl_kernel(node))
+                {
+                    BUILD_DNNL_ELTWISE_FUNCTOR;
+                }
+                else
+                {
+                    BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::exp);
+                }
             }
 
             template <>
             void Builder::BUILDER_DECL(ngraph::op::v0::Log)
             {
-                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::log);
+                if (runtime::cpu::dnnl_utils::use_dnnl_kernel(node))
+                {
+                    BUILD_DNNL_ELTWISE_FUNCTOR;
+                }
+                else
+                {
+                    BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::log);
+                }
             }
 
             template <>
@@ -437,7 +461,14 @@ namespace ngraph
             template <>
             void Builder::BUILDER_DECL(ngraph::op::v0::Tanh)
             {
-                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::tanh);
+                if (runtime::cpu::dnnl_utils::use_dnnl_kernel(node))
+                {
+                    BUILD_DNNL_ELTWISE_FUNCTOR;
+                }
+                else
+                {
+                    BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::tanh);
+                }
             }
 
             template <>
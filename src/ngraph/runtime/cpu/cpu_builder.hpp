@@ -50,6 +50,46 @@
     };                                                                                             \
     functors.emplace_back(functor)
 
+// A unary op on the DNNL eltwise JIT kernels: input, result and eltwise_forward primitives.
+// Needs dnnl_emitter.hpp, dnnl_invoke.hpp and dnnl_utils.hpp.
+#define BUILD_DNNL_ELTWISE_FUNCTOR                                                                 \
+    auto& functors = external_function->get_functors();                                            \
+    auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());              \
+    auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());               \
+                                                                                                   \
+    auto& dnnl_emitter = external_function->get_dnnl_emitter();                                    \
+    auto eltwise_desc = dnnl_emitter->get_eltwise_forward_desc(node);                              \
+    size_t scratchpad_size = QUERY_SCRATCHPAD(eltwise_forward, eltwise_desc);                      \
+    auto eltwise_index = dnnl_emitter->reserve_primitive_space(3);                                 \
+    auto& deps = dnnl_emitter->get_primitive_deps(eltwise_index);                                  \
+                                                                                                   \
+    auto functor = [&,                                                                             \
+                    eltwise_desc,                                                                  \
+                    eltwise_index,                                                                 \
+                    scratchpad_size,                                                               \
+                    arg0_buffer_index,                                                             \
+                    out0_buffer_index](CPURuntimeContext* ctx, CPUExecutionContext* /* ectx */) {  \
+        if (ctx->dnnl_primitives[eltwise_index] == nullptr)                                        \
+        {                                                                                          \
+            dnnl_emitter->build_eltwise_forward(ctx->dnnl_memories,                                \
+                                                ctx->dnnl_primitives,                              \
+                                                ctx->dnnl_scratchpad_mds,                          \
+                                                eltwise_desc,                                      \
+                                                deps,                                              \
+                                                eltwise_index);                                    \
+        }                                                                                          \
+        if (ctx->build_primitives_only)                                                            \
+        {                                                                                          \
+            return;                                                                                \
+        }                                                                                          \
+        cpu::dnnl_utils::set_memory_ptr(ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);        \
+        cpu::dnnl_utils::set_memory_ptr(ctx, deps[1], ctx->buffer_data[out0_buffer_index]);        \
+        cpu::dnnl_utils::dnnl_invoke_primitive(                                                    \
+            ctx, eltwise_index, deps, cpu::dnnl_utils::OpType::ELTWISE, scratchpad_size);          \
+    };                                                                                             \
+    external_function->add_primitive_build_functor(functors.size());                               \
+    functors.emplace_back(functor)
+
 #define BUILD_BINARY_ELEMWISE_FUNCTOR(OP)                                                          \
     (void)node;                                                                                    \
     auto& functors = external_function->get_functors();                                            \
@@ -132,6 +172,18 @@ namespace ngraph
 
             BuildOpMap& GetGlobalBuildDispatcher();
 
+            /// \brief Whether Node::evaluate runs `node` with its static shapes and types. Checked
+            ///        for ops without a builder, by evaluating the node once.
+            bool can_build_evaluate(const ngraph::Node* node);
+
+            /// \brief Fallback for ops without a builder: a functor running Node::evaluate
+            ///        directly on the buffers of the call. The layout pass gives such ops native
+            ///        layouts, so the buffers are plain.
+            void build_evaluate(CPU_ExternalFunction* external_function,
+                                const ngraph::Node* node,
+                                const std::vector<TensorWrapper>& inputs,
+                                const std::vector<TensorWrapper>& outputs);
+
             // build the map to use cpu kernel for node execution
             CPU_BACKEND_API BuildNodeExecutorMap& GetGlobalCFDispatcherCPU();
 
@@ -13,6 +13,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //*****************************************************************************
+#include <mutex>
+
 #include "ngraph/runtime/cpu/cpu_builder_registry.hpp"
 
 namespace ngraph
@@ -23,61 +25,90 @@ namespace ngraph
         {
             void register_builders()
             {
-                register_builders_add_cpp();
-                register_builders_allreduce_cpp();
-                register_builders_argmax_cpp();
-                register_builders_argmin_cpp();
-                register_builders_avg_pool_cpp();
-                register_builders_batch_norm_cpp();
-                register_builders_bounded_relu_cpp();
-                register_builders_broadcast_cpp();
-                register_builders_broadcast_distributed_cpp();
-                register_builders_concat_cpp();
-                register_builders_convert_cpp();
-                register_builders_convert_layout_cpp();
-                register_builders_convolution_cpp();
-                register_builders_cumsum_cpp();
-                register_builders_dot_cpp();
-                register_builders_dropout_cpp();
-                register_builders_embedding_lookup_cpp();
-                register_builders_erf_cpp();
-                register_builders_gather_cpp();
-                register_builders_gather_nd_cpp();
-                register_builders_gelu_cpp();
-                register_builders_leaky_relu_cpp();
-                register_builders_lrn_cpp();
-                register_builders_lstm_cpp();
-                register_builders_matmul_bias_cpp();
-                register_builders_max_cpp();
-                register_builders_max_pool_cpp();
-                register_builders_min_cpp();
-                register_builders_one_hot_cpp();
-                register_builders_pad_cpp();
-                register_builders_product_cpp();
-                register_builders_quantization_cpp();
-                register_builders_quantized_conv_cpp();
-                register_builders_quantized_dot_cpp();
-                register_builders_quantized_matmul_cpp();
-                register_builders_random_uniform_cpp();
-                register_builders_reduce_function_cpp();
-                register_builders_relu_cpp();
-                register_builders_replace_slice_cpp();
-                register_builders_reshape_cpp();
-                register_builders_reverse_cpp();
-                register_builders_reverse_sequence_cpp();
-                register_builders_rnn_cpp();
-                register_builders_scatter_add_cpp();
-                register_builders_scatter_nd_add_cpp();
-                register_builders_select_cpp();
-                register_builders_state_cpp();
-                register_builders_sigmoid_cpp();
-                register_builders_slice_cpp();
-                register_builders_softmax_cpp();
-                register_builders_sum_cpp();
-                register_builders_tile_cpp();
-                register_builders_topk_cpp();
-                register_builders_update_slice_cpp();
-                register_cpu_builders();
+                // Called by every compile rather than when the backend is created, so
+                // programs that never compile do not pay for it
+                static std::once_flag s_registered;
+                std::call_once(s_registered, []() {
+                    register_builders_add_cpp();
+                    register_builders_allreduce_cpp();
+                    register_builders_allreduce_async_cpp();
+                    register_builders_argmax_cpp();
+                    register_builders_argmin_cpp();
+                    register_builders_attention_cpp();
+                    register_builders_avg_pool_cpp();
+                    register_builders_batch_norm_cpp();
+                    register_builders_bounded_relu_cpp();
+                    register_builders_binary_convolution_cpp();
+                    register_builders_broadcast_cpp();
+                    register_builders_broadcast_distributed_cpp();
+                    register_builders_compressed_weights_cpp();
+                    register_builders_concat_cpp();
+                    register_builders_convert_cpp();
+                    register_builders_convert_layout_cpp();
+                    register_builders_convolution_cpp();
+                    register_builders_ctc_greedy_decoder_cpp();
+                    register_builders_cumsum_cpp();
+                    register_builders_deformable_convolution_cpp();
+                    register_builders_detection_output_cpp();
+                    register_builders_dot_cpp();
+                    register_builders_dropout_cpp();
+                    register_builders_elementwise_chain_cpp();
+                    register_builders_embedding_bag_cpp();
+                    register_builders_embedding_lookup_cpp();
+                    register_builders_erf_cpp();
+                    register_builders_gather_cpp();
+                    register_builders_gather_nd_cpp();
+                    register_builders_gather_tree_cpp();
+                    register_builders_gelu_cpp();
+                    register_builders_interpolate_cpp();
+                    register_builders_kv_cache_append_cpp();
+                    register_builders_layer_norm_cpp();
+                    register_builders_leaky_relu_cpp();
+                    register_builders_lrn_cpp();
+                    register_builders_lstm_cpp();
+                    register_builders_matmul_bias_cpp();
+                    register_builders_max_cpp();
+                    register_builders_max_pool_cpp();
+                    register_builders_min_cpp();
+                    register_builders_non_max_suppression_cpp();
+                    register_builders_normalize_l2_cpp();
+                    register_builders_one_hot_cpp();
+                    register_builders_optimizer_update_cpp();
+                    register_builders_pad_cpp();
+                    register_builders_prelu_cpp();
+                    register_builders_preprocess_cpp();
+                    register_builders_product_cpp();
+                    register_builders_quantization_cpp();
+                    register_builders_quantized_conv_cpp();
+                    register_builders_quantized_dot_cpp();
+                    register_builders_quantized_matmul_cpp();
+                    register_builders_random_uniform_cpp();
+                    register_builders_reduce_function_cpp();
+                    register_builders_relu_cpp();
+                    register_builders_replace_slice_cpp();
+                    register_builders_reshape_cpp();
+                    register_builders_reverse_cpp();
+                    register_builders_reverse_sequence_cpp();
+                    register_builders_rnn_cpp();
+                    register_builders_roi_pooling_cpp();
+                    register_builders_scatter_add_cpp();
+                    register_builders_scatter_nd_add_cpp();
+                    register_builders_scatter_update_cpp();
+                    register_builders_select_cpp();
+                    register_builders_send_recv_cpp();
+                    register_builders_state_cpp();
+                    register_builders_sigmoid_cpp();
+                    register_builders_slice_cpp();
+                    register_builders_softmax_cpp();
+                    register_builders_sparse_dot_cpp();
+                    register_builders_sum_cpp();
+                    register_builders_tensor_iterator_cpp();
+                    register_builders_tile_cpp();
+                    register_builders_topk_cpp();
+                    register_builders_update_slice_cpp();
+                    register_builders_variable_cpp();
+                    register_cpu_builders();
+                });
             }
         }
     }
@@ -24,25 +24,38 @@ namespace ngraph
             void register_builders();
             void register_builders_add_cpp();
             void register_builders_allreduce_cpp();
+            void register_builders_allreduce_async_cpp();
             void register_builders_argmax_cpp();
             void register_builders_argmin_cpp();
+            void register_builders_attention_cpp();
             void register_builders_avg_pool_cpp();
             void register_builders_batch_norm_cpp();
             void register_builders_bounded_relu_cpp();
+            void register_builders_binary_convolution_cpp();
             void register_builders_broadcast_cpp();
             void register_builders_broadcast_distributed_cpp();
+            void register_builders_compressed_weights_cpp();
             void register_builders_concat_cpp();
             void register_builders_convert_cpp();
             void register_builders_convert_layout_cpp();
             void register_builders_convolution_cpp();
+            void register_builders_ctc_greedy_decoder_cpp();
             void register_builders_cumsum_cpp();
+            void register_builders_deformable_convolution_cpp();
+            void register_builders_detection_output_cpp();
             void register_builders_dot_cpp();
             void register_builders_dropout_cpp();
+            void register_builders_elementwise_chain_cpp();
+            void register_builders_embedding_bag_cpp();
             void register_builders_embedding_lookup_cpp();
             void register_builders_erf_cpp();
             void register_builders_gather_cpp();
             void register_builders_gather_nd_cpp();
+            void register_builders_gather_tree_cpp();
             void register_builders_gelu_cpp();
+            void register_builders_interpolate_cpp();
+            void register_builders_kv_cache_append_cpp();
+            void register_builders_layer_norm_cpp();
             void register_builders_leaky_relu_cpp();
             void register_builders_lrn_cpp();
             void register_builders_lstm_cpp();
@@ -50,8 +63,13 @@ namespace ngraph
             void register_builders_max_cpp();
             void register_builders_max_pool_cpp();
             void register_builders_min_cpp();
+            void register_builders_non_max_suppression_cpp();
+            void register_builders_normalize_l2_cpp();
             void register_builders_one_hot_cpp();
+            void register_builders_optimizer_update_cpp();
             void register_builders_pad_cpp();
+            void register_builders_prelu_cpp();
+            void register_builders_preprocess_cpp();
             void register_builders_product_cpp();
             void register_builders_quantization_cpp();
             void register_builders_quantized_conv_cpp();
@@ -65,17 +83,23 @@ namespace ngraph
             void register_builders_reverse_cpp();
             void register_builders_reverse_sequence_cpp();
             void register_builders_rnn_cpp();
+            void register_builders_roi_pooling_cpp();
             void register_builders_scatter_add_cpp();
             void register_builders_scatter_nd_add_cpp();
+            void register_builders_scatter_update_cpp();
             void register_builders_select_cpp();
+            void register_builders_send_recv_cpp();
             void register_builders_state_cpp();
             void register_builders_sigmoid_cpp();
             void register_builders_slice_cpp();
             void register_builders_softmax_cpp();
+            void register_builders_sparse_dot_cpp();
             void register_builders_sum_cpp();
+            void register_builders_tensor_iterator_cpp();
             void register_builders_tile_cpp();
             void register_builders_topk_cpp();
             void register_builders_update_slice_cpp();
+            void register_builders_variable_cpp();
             void register_cpu_builders();
         }
     }
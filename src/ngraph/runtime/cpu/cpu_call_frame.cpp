@@ -15,15 +15,25 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <cstring>
 #include <thread>
 
+#include "ngraph/chrome_trace.hpp"
+#include "ngraph/distributed.hpp"
 #include "ngraph/env_util.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/cpu/cpu_activation_arena.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
+#include "ngraph/runtime/cpu/cpu_hw_counters.hpp"
+#include "ngraph/runtime/cpu/cpu_input_release.hpp"
+#include "ngraph/runtime/cpu/cpu_numa.hpp"
+#include "ngraph/runtime/cpu/cpu_pool_trimmer.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor.hpp"
 #include "ngraph/runtime/cpu/cpu_tracing.hpp"
 #include "ngraph/runtime/cpu/dnnl_emitter.hpp"
+#include "ngraph/runtime/huge_page_allocator.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -38,8 +48,19 @@ runtime::cpu::CPU_CallFrame::CPU_CallFrame(std::shared_ptr<CPU_ExternalFunction>
     , m_compiled_destroy_ctx_func(compiled_destroy_ctx_func)
     , m_compiled_function(compiled_function)
 {
-    const auto envConcurrency = getenv_int("NGRAPH_CPU_CONCURRENCY");
+    const auto envConcurrency = m_external_function->m_concurrency > 0
+                                    ? m_external_function->m_concurrency
+                                    : getenv_int("NGRAPH_CPU_CONCURRENCY");
     m_num_ctx = envConcurrency <= 0 ? 1 : envConcurrency;
+    if (m_external_function->is_direct_execution())
+    {
+        m_arena = m_external_function->m_activation_arena;
+    }
+    if (m_arena)
+    {
+        // Calls on an arena run one at a time
+        m_num_ctx = 1;
+    }
     if (m_num_ctx > std::thread::hardware_concurrency())
     {
         throw ngraph_error(
@@ -50,6 +71,10 @@ runtime::cpu::CPU_CallFrame::CPU_CallFrame(std::shared_ptr<CPU_ExternalFunction>
     }
 
     setup_runtime_context(allocator);
+    if (uses_pool_trimmer())
+    {
+        CPU_PoolTrimmer::get().add(this);
+    }
     if (!m_external_function->is_direct_execution())
     {
         // Invoke codegen runtime context initialization function.
@@ -60,6 +85,10 @@ runtime::cpu::CPU_CallFrame::CPU_CallFrame(std::shared_ptr<CPU_ExternalFunction>
 
 runtime::cpu::CPU_CallFrame::~CPU_CallFrame()
 {
+    if (uses_pool_trimmer())
+    {
+        CPU_PoolTrimmer::get().remove(this);
+    }
     cleanup_runtime_context();
     if (!m_external_function->is_direct_execution())
     {
@@ -67,19 +96,32 @@ runtime::cpu::CPU_CallFrame::~CPU_CallFrame()
     }
 }
 
-void runtime::cpu::CPU_CallFrame::inner_call(
+bool runtime::cpu::CPU_CallFrame::inner_call(
     const std::vector<std::shared_ptr<runtime::Tensor>>& output_tvs,
     const std::vector<std::shared_ptr<runtime::Tensor>>& input_tvs,
     const size_t id,
-    const bool disable_caching)
+    const bool disable_caching,
+    CallPriority priority,
+    const CancellationToken* cancellation,
+    InputRelease* input_release)
 {
     vector<void*> inputs;
     vector<void*> outputs;
+    // Dense copies of strided views, and of views of outputs in DNNL layouts
+    vector<shared_ptr<runtime::cpu::CPUTensor>> staged_inputs;
+    vector<pair<size_t, shared_ptr<runtime::cpu::CPUTensor>>> staged_outputs;
 
     for (size_t i = 0; i < input_tvs.size(); i++)
     {
         shared_ptr<runtime::cpu::CPUTensor> tv =
             static_pointer_cast<runtime::cpu::CPUTensor>(input_tvs[i]);
+        if (!tv)
+        {
+            // State parameters read the buffers of the context
+            NGRAPH_CHECK(is_state_parameter(i), "No tensor for input ", i);
+            inputs.push_back(nullptr);
+            continue;
+        }
         if (disable_caching)
         {
             m_ctx_vec[id]->p_en[i] = true;
@@ -89,75 +131,601 @@ void runtime::cpu::CPU_CallFrame::inner_call(
             m_ctx_vec[id]->p_en[i] = tv->get_stale();
         }
 
+        if (!tv->is_dense())
+        {
+            auto staged =
+                make_shared<runtime::cpu::CPUTensor>(tv->get_element_type(), tv->get_shape());
+            tv->read(staged->get_data_ptr(), staged->get_size_in_bytes());
+            staged_inputs.push_back(staged);
+            if (input_release)
+            {
+                input_release->release(i);
+            }
+            m_ctx_vec[id]->p_en[i] = true;
+            inputs.push_back(staged->get_data_ptr());
+            continue;
+        }
         inputs.push_back(tv->get_data_ptr());
     }
+    auto& result_layouts = m_external_function->get_result_layout_descriptors();
     for (size_t i = 0; i < output_tvs.size(); i++)
     {
         shared_ptr<runtime::cpu::CPUTensor> tv =
             static_pointer_cast<runtime::cpu::CPUTensor>(output_tvs[i]);
-        outputs.push_back(tv->get_data_ptr());
+        if (tv && needs_staging(*tv, result_layouts[i]))
+        {
+            auto staged =
+                make_shared<runtime::cpu::CPUTensor>(tv->get_element_type(), tv->get_shape());
+            staged->set_tensor_layout(result_layouts[i]);
+            staged_outputs.emplace_back(i, staged);
+            outputs.push_back(staged->get_data_ptr());
+            continue;
+        }
+        outputs.push_back(tv ? tv->get_data_ptr() : nullptr);
     }
 
-    // Invoke compiled computation
-    if (!m_external_function->is_direct_execution())
+    bool completed = execute(id, inputs, outputs, priority, cancellation, input_release);
+    if (completed)
     {
-        m_compiled_function(inputs.data(), outputs.data(), m_ctx_vec[id], cg_ctx);
+        for (auto& staged : staged_outputs)
+        {
+            auto& tv = output_tvs[staged.first];
+            size_t size = tv->get_size_in_bytes();
+            if (auto data = staged.second->get_host_data_ptr())
+            {
+                tv->write(data, size);
+            }
+            else
+            {
+                vector<char> row_major(size);
+                staged.second->read(row_major.data(), size);
+                tv->write(row_major.data(), size);
+            }
+        }
     }
-    else
+    return completed;
+}
+
+bool runtime::cpu::CPU_CallFrame::needs_staging(
+    const runtime::cpu::CPUTensor& tv, const shared_ptr<runtime::cpu::LayoutDescriptor>& layout)
+{
+    // Views keep the row-major layout of their base
+    return !tv.is_dense() || (tv.is_view() && layout && layout->is_dnnl_layout());
+}
+
+bool runtime::cpu::CPU_CallFrame::execute(size_t id,
+                                          vector<void*>& inputs,
+                                          vector<void*>& outputs,
+                                          CallPriority priority,
+                                          const CancellationToken* cancellation,
+                                          InputRelease* input_release)
+{
+    auto& cpu_executor = executor::GetCPUExecutor();
+    unique_lock<mutex> arena_lock;
+    if (m_arena)
+    {
+        arena_lock = unique_lock<mutex>(m_arena->m_call_mutex);
+    }
+    m_ctx_vec[id]->priority = priority;
+    m_ctx_vec[id]->cancellation = cancellation;
+    m_ctx_vec[id]->cancelled = false;
+    m_ctx_vec[id]->input_release = input_release;
+
+    // State pairs run on the buffers of the context rather than those of the call
+    vector<void*> state_inputs;
+    vector<void*> state_outputs;
+    vector<void*>* call_inputs = &inputs;
+    vector<void*>* call_outputs = &outputs;
+    if (!m_state_pairs.empty())
+    {
+        prepare_states(id);
+        state_inputs = inputs;
+        state_outputs = outputs;
+        for (size_t i = 0; i < m_state_pairs.size(); i++)
+        {
+            auto& state = m_ctx_states[id][i];
+            state_inputs[m_state_pairs[i].parameter] = state.buffers[state.current]->get_ptr();
+            state_outputs[m_state_pairs[i].result] = state.buffers[1 - state.current]->get_ptr();
+            m_ctx_vec[id]->p_en[m_state_pairs[i].parameter] = true;
+        }
+        call_inputs = &state_inputs;
+        call_outputs = &state_outputs;
+    }
+
+    cpu_executor.begin_call(priority);
+    try
+    {
+        // Invoke compiled computation
+        if (!m_external_function->is_direct_execution())
+        {
+            m_compiled_function(
+                call_inputs->data(), call_outputs->data(), m_ctx_vec[id], cg_ctx);
+        }
+        else
+        {
+            m_external_function->get_executor()(m_ctx_vec[id], *call_inputs, *call_outputs);
+        }
+    }
+    catch (...)
+    {
+        cpu_executor.end_call(priority);
+        throw;
+    }
+    cpu_executor.end_call(priority);
+    m_ctx_vec[id]->cancellation = nullptr;
+    m_ctx_vec[id]->input_release = nullptr;
+    if (m_arena)
     {
-        m_external_function->get_executor()(m_ctx_vec[id], inputs, outputs);
+        // The other executables on the arena overwrite the values this call leaves there
+        m_prev_ctx.store(m_num_ctx, std::memory_order_relaxed);
     }
 
+    if (m_ctx_vec[id]->cancelled)
+    {
+        // Values the skipped ops would have refreshed are stale, so the next call recomputes
+        // everything whichever context it runs on
+        m_prev_ctx.store(m_num_ctx, std::memory_order_relaxed);
+        return false;
+    }
+    swap_states(id);
+
     if (runtime::cpu::IsTracingEnabled())
     {
+        // The scratchpad and the workspaces are only allocated in direct execution
+        size_t scratchpad_bytes = 0;
+        size_t workspace_bytes = 0;
+        if (m_external_function->is_direct_execution())
+        {
+            AlignedBuffer* scratchpad = m_ctx_vec[id]->scratchpad_buffer;
+            scratchpad_bytes = scratchpad ? scratchpad->size() : 0;
+            workspace_bytes = m_external_function->get_dnnl_emitter()->get_workspace_bytes();
+        }
         GenerateTimeline(m_external_function->get_op_attrs(),
                          m_ctx_vec[id]->op_durations,
-                         m_external_function->get_function_name() + ".timeline.json");
+                         m_external_function->get_function_name() + ".timeline.json",
+                         m_ctx_vec[id]->op_counters,
+                         m_external_function->get_memory_timeline(),
+                         scratchpad_bytes,
+                         workspace_bytes);
     }
+    return true;
 }
 
-void runtime::cpu::CPU_CallFrame::call(
-    const std::vector<std::shared_ptr<runtime::Tensor>>& output_tvs,
-    const std::vector<std::shared_ptr<runtime::Tensor>>& input_tvs)
+size_t runtime::cpu::CPU_CallFrame::acquire_context()
 {
-    size_t id = 0;
-    auto disable_caching = false;
-    {
-        std::unique_lock<std::mutex> lck(m_mutex);
-        while (m_num_ctx_available == 0)
-        {
-            m_cv.wait(lck);
-        }
+    static thread_local const size_t thread_hint =
+        std::hash<std::thread::id>()(std::this_thread::get_id());
 
+    const size_t start = thread_hint % m_num_ctx;
+    while (true)
+    {
         for (size_t i = 0; i < m_num_ctx; i++)
         {
-            if (m_id_pool[i])
+            size_t id = (start + i) % m_num_ctx;
+            // Cheap relaxed check first so contended slots are not hammered with CAS
+            if (m_ctx_busy[id].load(std::memory_order_relaxed))
             {
-                id = i;
-                break;
+                continue;
+            }
+            bool expected = false;
+            if (m_ctx_busy[id].compare_exchange_strong(
+                    expected, true, std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                try
+                {
+                    prepare_context(id);
+                }
+                catch (...)
+                {
+                    release_context(id);
+                    throw;
+                }
+                return id;
             }
         }
-        NGRAPH_CHECK(id != m_num_ctx);
-        m_id_pool[id] = false;
-        if (id != m_prev_ctx)
+        std::this_thread::yield();
+    }
+}
+
+void runtime::cpu::CPU_CallFrame::release_context(size_t id)
+{
+    m_ctx_last_used[id].store(std::chrono::steady_clock::now().time_since_epoch().count(),
+                              std::memory_order_relaxed);
+    m_ctx_busy[id].store(false, std::memory_order_release);
+}
+
+void runtime::cpu::CPU_CallFrame::prepare_context(size_t id)
+{
+    if (!m_ctx_vec[id])
+    {
+        create_runtime_context(id);
+    }
+    if (m_arena && !m_ctx_trimmed[id] && m_ctx_arena_memory[id] != m_arena->get_memory())
+    {
+        // The arena grew for another executable
+        free_pools(id);
+        m_ctx_trimmed[id] = true;
+    }
+    if (m_ctx_trimmed[id])
+    {
+        allocate_pools(id);
+        m_ctx_trimmed[id] = false;
+    }
+}
+
+void runtime::cpu::CPU_CallFrame::claim_context(size_t id)
+{
+    bool expected = false;
+    while (!m_ctx_busy[id].compare_exchange_weak(
+        expected, true, std::memory_order_acquire, std::memory_order_relaxed))
+    {
+        expected = false;
+        std::this_thread::yield();
+    }
+}
+
+void runtime::cpu::CPU_CallFrame::pin_first_context(bool pinned)
+{
+    claim_context(0);
+    if (pinned)
+    {
+        prepare_context(0);
+    }
+    m_first_context_pinned = pinned;
+    release_context(0);
+}
+
+std::chrono::steady_clock::time_point runtime::cpu::CPU_CallFrame::get_last_used(size_t id) const
+{
+    return std::chrono::steady_clock::time_point(std::chrono::steady_clock::duration(
+        m_ctx_last_used[id].load(std::memory_order_relaxed)));
+}
+
+size_t runtime::cpu::CPU_CallFrame::trim_idle_contexts(
+    std::chrono::steady_clock::time_point idle_before)
+{
+    size_t freed = 0;
+    for (size_t id = 0; id < m_num_ctx; id++)
+    {
+        freed += trim_context(id, idle_before);
+    }
+    return freed;
+}
+
+size_t runtime::cpu::CPU_CallFrame::trim_context(size_t id,
+                                                 std::chrono::steady_clock::time_point idle_before)
+{
+    bool expected = false;
+    if (!uses_pool_trimmer() || m_ctx_busy[id].load(std::memory_order_relaxed) ||
+        !m_ctx_busy[id].compare_exchange_strong(
+            expected, true, std::memory_order_acquire, std::memory_order_relaxed))
+    {
+        return 0;
+    }
+    size_t freed = 0;
+    // The debugger keeps intermediates of the first context between steps
+    bool pinned = id == 0 && m_first_context_pinned;
+    if (m_ctx_vec[id] && !m_ctx_trimmed[id] && !pinned && get_last_used(id) < idle_before)
+    {
+        freed = m_ctx_pool_bytes[id];
+        free_pools(id);
+        m_ctx_trimmed[id] = true;
+        // The intermediates cached by the context are gone, so its next call recomputes all
+        size_t prev_ctx = id;
+        m_prev_ctx.compare_exchange_strong(prev_ctx, m_num_ctx, std::memory_order_relaxed);
+    }
+    m_ctx_busy[id].store(false, std::memory_order_release);
+    return freed;
+}
+
+void runtime::cpu::CPU_CallFrame::warm_up(
+    const std::vector<std::shared_ptr<runtime::Tensor>>& output_tvs,
+    const std::vector<std::shared_ptr<runtime::Tensor>>& input_tvs)
+{
+    propagate_layouts(output_tvs, m_external_function->get_result_layout_descriptors());
+    for (size_t id = 0; id < m_num_ctx; id++)
+    {
+        claim_context(id);
+        try
+        {
+            prepare_context(id);
+            m_ctx_vec[id]->pc = 0;
+            inner_call(output_tvs, input_tvs, id);
+            // The state still reads what it read before warming up
+            swap_states(id);
+        }
+        catch (...)
         {
-            // Disable caching since staleness hints are no longer
-            // applicable to this context
-            disable_caching = true;
+            release_context(id);
+            throw;
         }
-        m_prev_ctx = id;
-        m_num_ctx_available--;
+        release_context(id);
     }
+    m_prev_ctx.store(m_num_ctx, std::memory_order_relaxed);
+}
+
+bool runtime::cpu::CPU_CallFrame::call(
+    const std::vector<std::shared_ptr<runtime::Tensor>>& output_tvs,
+    const std::vector<std::shared_ptr<runtime::Tensor>>& input_tvs,
+    CallPriority priority,
+    const CancellationToken* cancellation,
+    InputRelease* input_release)
+{
+    return call_on_claimed_context(
+        acquire_context(), output_tvs, input_tvs, priority, cancellation, input_release);
+}
+
+bool runtime::cpu::CPU_CallFrame::call_on_context(
+    size_t id,
+    const std::vector<std::shared_ptr<runtime::Tensor>>& output_tvs,
+    const std::vector<std::shared_ptr<runtime::Tensor>>& input_tvs,
+    CallPriority priority,
+    const CancellationToken* cancellation)
+{
+    NGRAPH_CHECK(id < m_num_ctx, "No runtime context ", id, ", there are ", m_num_ctx);
+    claim_context(id);
+    try
+    {
+        prepare_context(id);
+    }
+    catch (...)
+    {
+        release_context(id);
+        throw;
+    }
+    return call_on_claimed_context(id, output_tvs, input_tvs, priority, cancellation);
+}
+
+bool runtime::cpu::CPU_CallFrame::call_on_claimed_context(
+    size_t id,
+    const std::vector<std::shared_ptr<runtime::Tensor>>& output_tvs,
+    const std::vector<std::shared_ptr<runtime::Tensor>>& input_tvs,
+    CallPriority priority,
+    const CancellationToken* cancellation,
+    InputRelease* input_release)
+{
+    event::Duration call_event(
+        "call",
+        "CPU",
+        event::Manager::is_tracing_enabled() ? R"({"context":)" + std::to_string(id) + "}" : "");
+    // Staleness hints are only applicable to the context used by the previous call
+    auto disable_caching = (m_prev_ctx.exchange(id, std::memory_order_relaxed) != id);
 
     m_ctx_vec[id]->pc = 0;
+    bool completed;
+    try
+    {
+        propagate_layouts(output_tvs, m_external_function->get_result_layout_descriptors());
+        completed = inner_call(
+            output_tvs, input_tvs, id, disable_caching, priority, cancellation, input_release);
+    }
+    catch (...)
+    {
+        // Ops such as KVCacheAppend check their inputs when they run
+        release_context(id);
+        throw;
+    }
+
+    release_context(id);
+    return completed;
+}
+
+void runtime::cpu::CPU_CallFrame::bind(
+    const std::vector<std::shared_ptr<runtime::Tensor>>& output_tvs,
+    const std::vector<std::shared_ptr<runtime::Tensor>>& input_tvs)
+{
     propagate_layouts(output_tvs, m_external_function->get_result_layout_descriptors());
-    inner_call(output_tvs, input_tvs, id, disable_caching);
+    unbind();
+    auto& result_layouts = m_external_function->get_result_layout_descriptors();
+    for (size_t i = 0; i < input_tvs.size(); i++)
+    {
+        NGRAPH_CHECK(static_pointer_cast<runtime::cpu::CPUTensor>(input_tvs[i])->is_dense(),
+                     "bind() needs dense tensors, input ",
+                     i,
+                     " is a strided view");
+    }
+    for (size_t i = 0; i < output_tvs.size(); i++)
+    {
+        NGRAPH_CHECK(!needs_staging(*static_pointer_cast<runtime::cpu::CPUTensor>(output_tvs[i]),
+                                    result_layouts[i]),
+                     "bind() needs outputs the call can write in place, output ",
+                     i,
+                     " is a view that would need a copy");
+    }
+    for (auto& tv : input_tvs)
+    {
+        m_bound_inputs.push_back(static_pointer_cast<runtime::cpu::CPUTensor>(tv));
+        m_bound_input_ptrs.push_back(m_bound_inputs.back()->get_data_ptr());
+    }
+    for (auto& tv : output_tvs)
+    {
+        m_bound_outputs.push_back(static_pointer_cast<runtime::cpu::CPUTensor>(tv));
+        m_bound_output_ptrs.push_back(m_bound_outputs.back()->get_data_ptr());
+    }
+    m_is_bound = true;
+}
 
-    m_mutex.lock();
-    m_id_pool[id] = true;
-    m_num_ctx_available++;
-    m_mutex.unlock();
-    m_cv.notify_one();
+void runtime::cpu::CPU_CallFrame::unbind()
+{
+    m_is_bound = false;
+    m_bound_inputs.clear();
+    m_bound_outputs.clear();
+    m_bound_input_ptrs.clear();
+    m_bound_output_ptrs.clear();
+}
+
+void runtime::cpu::CPU_CallFrame::call_bound()
+{
+    NGRAPH_CHECK(m_is_bound, "call_bound() requires tensors pinned by bind()");
+    size_t id = acquire_context();
+    auto disable_caching = (m_prev_ctx.exchange(id, std::memory_order_relaxed) != id);
+
+    auto ctx = m_ctx_vec[id];
+    ctx->pc = 0;
+    for (size_t i = 0; i < m_bound_inputs.size(); i++)
+    {
+        ctx->p_en[i] = disable_caching || m_bound_inputs[i]->get_stale();
+    }
+    execute(id, m_bound_input_ptrs, m_bound_output_ptrs);
+
+    release_context(id);
+}
+
+void runtime::cpu::CPU_CallFrame::call_on_buffers(std::vector<void*>& inputs,
+                                                   std::vector<void*>& outputs,
+                                                   const std::vector<bool>& stale)
+{
+    size_t id = acquire_context();
+    auto disable_caching = (m_prev_ctx.exchange(id, std::memory_order_relaxed) != id);
+
+    auto ctx = m_ctx_vec[id];
+    ctx->pc = 0;
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        ctx->p_en[i] = disable_caching || stale[i];
+    }
+    execute(id, inputs, outputs);
+
+    release_context(id);
+}
+
+void runtime::cpu::CPU_CallFrame::bind_state(size_t parameter_index, size_t result_index)
+{
+    auto& parameters = m_external_function->get_parameter_layout_descriptors();
+    auto& results = m_external_function->get_result_layout_descriptors();
+    NGRAPH_CHECK(parameter_index < parameters.size() && result_index < results.size(),
+                 "No parameter ",
+                 parameter_index,
+                 " or result ",
+                 result_index,
+                 " to hold state");
+    auto& parameter = parameters[parameter_index];
+    auto& result = results[result_index];
+    NGRAPH_CHECK(parameter->get_element_type() == result->get_element_type() &&
+                     parameter->get_shape() == result->get_shape(),
+                 "State parameter ",
+                 parameter_index,
+                 " and result ",
+                 result_index,
+                 " differ in element type or shape");
+    NGRAPH_CHECK(result->is_row_major_layout(),
+                 "State result ",
+                 result_index,
+                 " is not in the row-major layout its parameter reads");
+    for (auto& pair : m_state_pairs)
+    {
+        NGRAPH_CHECK(pair.parameter != parameter_index && pair.result != result_index,
+                     "Parameter ",
+                     parameter_index,
+                     " or result ",
+                     result_index,
+                     " already holds state");
+    }
+    m_state_pairs.push_back(StatePair{parameter_index,
+                                      result_index,
+                                      shape_size(result->get_shape()) *
+                                          result->get_element_type().size()});
+}
+
+bool runtime::cpu::CPU_CallFrame::is_state_parameter(size_t index) const
+{
+    for (auto& pair : m_state_pairs)
+    {
+        if (pair.parameter == index)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void runtime::cpu::CPU_CallFrame::prepare_states(size_t id)
+{
+    auto& states = m_ctx_states[id];
+    while (states.size() < m_state_pairs.size())
+    {
+        size_t size = m_state_pairs[states.size()].size;
+        StreamState state;
+        for (auto& buffer : state.buffers)
+        {
+            buffer.reset(new AlignedBuffer(size, runtime::cpu::CPUTensor::BufferAlignment));
+            memset(buffer->get_ptr(), 0, size);
+        }
+        state.current = 0;
+        states.push_back(move(state));
+    }
+}
+
+void runtime::cpu::CPU_CallFrame::swap_states(size_t id)
+{
+    for (auto& state : m_ctx_states[id])
+    {
+        state.current = 1 - state.current;
+    }
+}
+
+runtime::AlignedBuffer& runtime::cpu::CPU_CallFrame::get_state(size_t parameter_index, size_t id)
+{
+    prepare_states(id);
+    for (size_t i = 0; i < m_state_pairs.size(); i++)
+    {
+        if (m_state_pairs[i].parameter == parameter_index)
+        {
+            auto& state = m_ctx_states[id][i];
+            return *state.buffers[state.current];
+        }
+    }
+    throw ngraph_error("Parameter " + to_string(parameter_index) + " holds no state");
+}
+
+void runtime::cpu::CPU_CallFrame::reset_states()
+{
+    for (size_t id = 0; id < m_num_ctx; id++)
+    {
+        claim_context(id);
+        m_ctx_states[id].clear();
+        release_context(id);
+    }
+}
+
+void runtime::cpu::CPU_CallFrame::read_state(size_t parameter_index,
+                                             size_t id,
+                                             runtime::Tensor& target)
+{
+    NGRAPH_CHECK(id < m_num_ctx, "No runtime context ", id, ", there are ", m_num_ctx);
+    claim_context(id);
+    try
+    {
+        auto& state = get_state(parameter_index, id);
+        NGRAPH_CHECK(target.get_size_in_bytes() == state.size(), "State size mismatch");
+        target.write(state.get_ptr(), state.size());
+    }
+    catch (...)
+    {
+        release_context(id);
+        throw;
+    }
+    release_context(id);
+}
+
+void runtime::cpu::CPU_CallFrame::write_state(size_t parameter_index,
+                                              size_t id,
+                                              const runtime::Tensor& source)
+{
+    NGRAPH_CHECK(id < m_num_ctx, "No runtime context ", id, ", there are ", m_num_ctx);
+    claim_context(id);
+    try
+    {
+        auto& state = get_state(parameter_index, id);
+        NGRAPH_CHECK(source.get_size_in_bytes() == state.size(), "State size mismatch");
+        source.read(state.get_ptr(), state.size());
+    }
+    catch (...)
+    {
+        release_context(id);
+        throw;
+    }
+    release_context(id);
 }
 
 void runtime::cpu::CPU_CallFrame::propagate_layouts(
@@ -171,93 +739,286 @@ void runtime::cpu::CPU_CallFrame::propagate_layouts(
     }
     for (size_t i = 0; i < tvs.size(); i++)
     {
+        if (tvs[i] == nullptr)
+        {
+            // The result of a state pair
+            continue;
+        }
         if (layouts[i] == nullptr)
         {
             throw ngraph_error(
                 "Error propagating layouts - layout information missing from tensor");
         }
+        if (static_pointer_cast<runtime::cpu::CPUTensor>(tvs[i])->is_view())
+        {
+            // Views share the row-major memory of their base; calls stage other layouts
+            continue;
+        }
         tvs[i]->set_tensor_layout(layouts[i]);
     }
 }
 
 void runtime::cpu::CPU_CallFrame::setup_runtime_context(Allocator* allocator)
 {
+    m_allocator = allocator;
+    m_ctx_busy.reset(new std::atomic<bool>[m_num_ctx]);
+    m_ctx_pool_bytes.reset(new std::atomic<size_t>[m_num_ctx]);
+    m_ctx_last_used.reset(new std::atomic<std::chrono::steady_clock::rep>[m_num_ctx]);
+    m_ctx_vec.assign(m_num_ctx, nullptr);
+    m_ctx_trimmed.assign(m_num_ctx, false);
+    m_ctx_pool_slots.assign(m_num_ctx, std::vector<PoolSlot>());
+    m_ctx_arena_memory.assign(m_num_ctx, nullptr);
+    m_ctx_states.resize(m_num_ctx);
+    auto now = std::chrono::steady_clock::now().time_since_epoch().count();
     for (size_t i = 0; i < m_num_ctx; i++)
     {
-        m_id_pool[i] = true;
-        auto ctx = new CPURuntimeContext;
-        m_ctx_vec.push_back(ctx);
+        m_ctx_busy[i].store(false);
+        m_ctx_pool_bytes[i].store(0);
+        m_ctx_last_used[i].store(now);
+    }
+    if (m_arena)
+    {
+        // The arena is allocated by the first call, once all its executables are compiled
+        m_arena->require(get_pool_layout(nullptr));
+        create_runtime_context(0);
+        return;
+    }
+    // The other contexts are only created once concurrent calls need them
+    prepare_context(0);
+}
+
+void runtime::cpu::CPU_CallFrame::create_runtime_context(size_t id)
+{
+    auto ctx = new CPURuntimeContext;
+    m_ctx_vec[id] = ctx;
 
-        ctx->pc = 0;
-        ctx->op_durations = nullptr;
-        if (runtime::cpu::IsTracingEnabled())
+    ctx->pc = 0;
+    ctx->context_index = id;
+    ctx->priority = CallPriority::Normal;
+    ctx->cancellation = nullptr;
+    ctx->input_release = nullptr;
+    ctx->cancelled = false;
+    ctx->op_durations = nullptr;
+    ctx->op_counters = nullptr;
+    if (runtime::cpu::IsTracingEnabled())
+    {
+        ctx->op_durations = new int64_t[m_external_function->get_op_attrs().size()];
+        if (hw_counters::is_enabled())
         {
-            ctx->op_durations = new int64_t[m_external_function->get_op_attrs().size()];
+            ctx->op_counters = new hw_counters::Values[m_external_function->get_op_attrs().size()];
         }
-        ctx->p_en = new bool[m_external_function->get_parameter_layout_descriptors().size()];
+    }
+    ctx->p_en = new bool[m_external_function->get_parameter_layout_descriptors().size()];
+
+    ctx->first_iteration = true;
+    ctx->build_primitives_only = false;
+
+    ctx->buffer_data = std::vector<void*>(m_external_function->get_buffer_size());
+    ctx->scratchpad_buffer = nullptr;
+    // The pools are allocated by prepare_context()
+    m_ctx_trimmed[id] = true;
+
+    ctx->distributed_requests.resize(m_external_function->get_distributed_request_count());
+    if (m_external_function->is_direct_execution())
+    {
+        const auto& dnnl_emitter = m_external_function->get_dnnl_emitter();
+        ctx->dnnl_primitives =
+            std::vector<dnnl::primitive*>(dnnl_emitter->get_dnnl_primitives().size());
+        ctx->dnnl_memories = std::vector<dnnl::memory*>(dnnl_emitter->get_dnnl_memories().size());
+        ctx->dnnl_scratchpad_mds =
+            std::vector<dnnl::memory::desc*>(dnnl_emitter->get_dnnl_scratchpad_mds().size());
+    }
+    else
+    {
+        // single thread for codegen
+        NGRAPH_CHECK(m_num_ctx == 1);
+    }
 
-        ctx->first_iteration = true;
+    ctx->states = m_external_function->m_states.data();
+#if defined(NGRAPH_TBB_ENABLE)
+    if (m_external_function->is_direct_execution() && m_external_function->m_use_tbb)
+    {
+        // For codegen mode, graph and global control are now part of the code generated
+        // CPURuntimeContextCG class.
+        ctx->G = new tbb::flow::graph;
+        const auto envParallelism = getenv_int("NGRAPH_INTER_OP_PARALLELISM");
+        const auto parallelism = envParallelism <= 0 ? 1 : envParallelism;
+        ctx->c = new tbb::global_control(tbb::global_control::max_allowed_parallelism, parallelism);
+    }
+#endif
+}
 
-        ctx->buffer_data = std::vector<void*>(m_external_function->get_buffer_size());
+bool runtime::cpu::CPU_CallFrame::uses_pool_trimmer() const
+{
+    return m_external_function->is_direct_execution() && !m_arena;
+}
 
+size_t runtime::cpu::CPU_CallFrame::get_pool_layout(vector<size_t>* offsets) const
+{
+    // Pools are placed one after the other, the scratchpad last
+    size_t alignment = runtime::cpu::CPU_ExternalFunction::s_memory_pool_alignment;
+    size_t bytes = 0;
+    for (auto buffer_size : m_external_function->get_memory_buffer_sizes())
+    {
+        if (offsets)
+        {
+            offsets->push_back(bytes);
+        }
+        bytes += (buffer_size + alignment - 1) / alignment * alignment;
+    }
+    if (offsets)
+    {
+        offsets->push_back(bytes);
+    }
+    if (m_external_function->is_direct_execution())
+    {
+        bytes += m_external_function->get_dnnl_emitter()->get_max_scratchpad_size();
+    }
+    return bytes;
+}
+
+void runtime::cpu::CPU_CallFrame::allocate_pools(size_t id)
+{
+    auto ctx = m_ctx_vec[id];
+    vector<size_t> offsets;
+    size_t bytes = get_pool_layout(&offsets);
+    size_t scratchpad_size = bytes - offsets.back();
+    shared_ptr<AlignedBuffer> arena_memory;
+    if (m_arena)
+    {
+        arena_memory = m_arena->get_memory();
+        m_ctx_arena_memory[id] = arena_memory;
+    }
+    else
+    {
+        if (uses_pool_trimmer())
+        {
+            CPU_PoolTrimmer::get().reserve(bytes);
+        }
+        m_ctx_pool_bytes[id] = bytes;
+    }
+
+    try
+    {
         // Create temporary buffer pools
         size_t alignment = runtime::cpu::CPU_ExternalFunction::s_memory_pool_alignment;
-        for (auto buffer_size : m_external_function->get_memory_buffer_sizes())
+        auto& buffer_sizes = m_external_function->get_memory_buffer_sizes();
+        for (size_t i = 0; i < buffer_sizes.size(); i++)
         {
-            auto buffer = new AlignedBuffer(buffer_size, alignment, allocator);
+            AlignedBuffer* buffer;
+            if (arena_memory)
+            {
+                buffer = new AlignedBuffer(
+                    arena_memory->get_ptr(offsets[i]), buffer_sizes[i], arena_memory);
+            }
+            else
+            {
+                buffer = new AlignedBuffer(buffer_sizes[i], alignment, m_allocator);
+            }
             ctx->memory_buffers.push_back(buffer);
+            if (m_external_function->m_numa_node >= 0 && !arena_memory)
+            {
+                numa::bind_memory(
+                    buffer->get_ptr(), buffer->size(), m_external_function->m_numa_node);
+            }
         }
-        const auto& dnnl_emitter = m_external_function->get_dnnl_emitter();
         // Create scratchpad
-        auto scratchpad_size = dnnl_emitter->get_max_scratchpad_size();
-        if (m_external_function->is_direct_execution())
+        if (scratchpad_size > 0)
         {
-            ctx->dnnl_primitives =
-                std::vector<dnnl::primitive*>(dnnl_emitter->get_dnnl_primitives().size());
-            ctx->dnnl_memories =
-                std::vector<dnnl::memory*>(dnnl_emitter->get_dnnl_memories().size());
-            ctx->dnnl_scratchpad_mds =
-                std::vector<dnnl::memory::desc*>(dnnl_emitter->get_dnnl_scratchpad_mds().size());
-            if (scratchpad_size > 0)
+            if (arena_memory)
             {
-                ctx->scratchpad_buffer = new AlignedBuffer(scratchpad_size, alignment, allocator);
+                ctx->scratchpad_buffer = new AlignedBuffer(
+                    arena_memory->get_ptr(offsets.back()), scratchpad_size, arena_memory);
             }
             else
             {
-                ctx->scratchpad_buffer = nullptr;
+                ctx->scratchpad_buffer =
+                    new AlignedBuffer(scratchpad_size, alignment, m_allocator);
+                if (m_external_function->m_numa_node >= 0)
+                {
+                    numa::bind_memory(ctx->scratchpad_buffer->get_ptr(),
+                                      scratchpad_size,
+                                      m_external_function->m_numa_node);
+                }
             }
         }
-        else
+    }
+    catch (...)
+    {
+        free_pools(id);
+        throw;
+    }
+    if (m_external_function->m_prefault_memory)
+    {
+        // After NUMA binding, so that the pages are placed on the bound node
+        for (auto buffer : ctx->memory_buffers)
         {
-            // single thread for codegen
-            NGRAPH_CHECK(m_num_ctx == 1);
+            prefault_memory(buffer->get_ptr(), buffer->size());
         }
+        if (ctx->scratchpad_buffer)
+        {
+            prefault_memory(ctx->scratchpad_buffer->get_ptr(), scratchpad_size);
+        }
+    }
 
-        ctx->states = m_external_function->m_states.data();
-#if defined(NGRAPH_TBB_ENABLE)
-        if (m_external_function->is_direct_execution() && getenv_bool("NGRAPH_CPU_USE_TBB"))
+    // Intermediates of a context that already ran move to the new pools
+    for (const PoolSlot& pool_slot : m_ctx_pool_slots[id])
+    {
+        ctx->buffer_data[pool_slot.slot] =
+            static_cast<uint8_t*>(ctx->memory_buffers[pool_slot.buffer]->get_ptr()) +
+            pool_slot.offset;
+    }
+    m_ctx_pool_slots[id].clear();
+}
+
+void runtime::cpu::CPU_CallFrame::free_pools(size_t id)
+{
+    auto ctx = m_ctx_vec[id];
+    auto& pool_slots = m_ctx_pool_slots[id];
+    for (size_t slot = 0; slot < ctx->buffer_data.size(); slot++)
+    {
+        auto data = static_cast<uint8_t*>(ctx->buffer_data[slot]);
+        for (size_t buffer = 0; buffer < ctx->memory_buffers.size(); buffer++)
         {
-            // For codegen mode, graph and global control are now part of the code generated
-            // CPURuntimeContextCG class.
-            ctx->G = new tbb::flow::graph;
-            const auto envParallelism = getenv_int("NGRAPH_INTER_OP_PARALLELISM");
-            const auto parallelism = envParallelism <= 0 ? 1 : envParallelism;
-            ctx->c =
-                new tbb::global_control(tbb::global_control::max_allowed_parallelism, parallelism);
+            auto base = static_cast<uint8_t*>(ctx->memory_buffers[buffer]->get_ptr());
+            // Empty tensors may point at the end of a pool
+            if (base && data >= base && data <= base + ctx->memory_buffers[buffer]->size())
+            {
+                pool_slots.push_back(PoolSlot{slot, buffer, static_cast<size_t>(data - base)});
+                ctx->buffer_data[slot] = nullptr;
+                break;
+            }
         }
-#endif
     }
-    m_num_ctx_available = m_num_ctx;
+    for (auto buffer : ctx->memory_buffers)
+    {
+        delete buffer;
+    }
+    ctx->memory_buffers.clear();
+    delete ctx->scratchpad_buffer;
+    ctx->scratchpad_buffer = nullptr;
+
+    m_ctx_arena_memory[id] = nullptr;
+    size_t bytes = m_ctx_pool_bytes[id].exchange(0);
+    if (uses_pool_trimmer())
+    {
+        CPU_PoolTrimmer::get().release(bytes);
+    }
 }
 
 void runtime::cpu::CPU_CallFrame::cleanup_runtime_context()
 {
-    for (size_t i = 0; i < m_num_ctx; i++)
+    for (size_t id = 0; id < m_num_ctx; id++)
     {
-        auto ctx = m_ctx_vec.back();
-        m_ctx_vec.pop_back();
+        auto ctx = m_ctx_vec[id];
+        if (!ctx)
+        {
+            continue;
+        }
+        free_pools(id);
 
         delete[] ctx->op_durations;
+        delete[] ctx->op_counters;
         delete[] ctx->p_en;
         for (auto p : ctx->dnnl_primitives)
         {
@@ -267,21 +1028,13 @@ void runtime::cpu::CPU_CallFrame::cleanup_runtime_context()
         {
             delete m;
         }
-        for (auto buffer : ctx->memory_buffers)
-        {
-            delete buffer;
-        }
         for (auto s : ctx->dnnl_scratchpad_mds)
         {
             delete s;
         }
-        if (m_external_function->is_direct_execution())
-        {
-            delete ctx->scratchpad_buffer;
-        }
 
 #if defined(NGRAPH_TBB_ENABLE)
-        if (m_external_function->is_direct_execution() && getenv_bool("NGRAPH_CPU_USE_TBB"))
+        if (m_external_function->is_direct_execution() && m_external_function->m_use_tbb)
         {
             // For codegen mode, graph and global control are now part of a code generated
             // CPURuntimeContext class.
@@ -303,5 +1056,6 @@ void runtime::cpu::CPU_CallFrame::cleanup_runtime_context()
 #endif
         delete ctx;
     }
-    m_num_ctx_available = 0;
+    m_ctx_vec.clear();
+    m_ctx_busy.reset();
 }
@@ -16,14 +16,15 @@
 
 #pragma once
 
-#include <condition_variable>
+#include <atomic>
+#include <chrono>
 #include <functional>
 #include <memory>
-#include <mutex>
 #include <string>
 #include <vector>
 
 #include "ngraph/function.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/allocator.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/cpu_runtime_context.hpp"
@@ -39,6 +40,8 @@ namespace ngraph
         {
             class CPU_ExternalFunction;
             class CPU_Debugger;
+            class CPUActivationArena;
+            class CPUTensor;
 
             using InitContextFuncTy = CPURuntimeContextCG*();
             using DestroyContextFuncTy = void(CPURuntimeContextCG*);
@@ -67,8 +70,64 @@ namespace ngraph
                 /// \brief Invoke the function with values matching the signature of the function.
                 ///
                 /// Tuples will be expanded into their tensor views to build the call frame.
-                void call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                /// In direct execution, the call gives way between ops to concurrent calls of
+                /// a higher `priority`, stops early when `cancellation` says so, and tells
+                /// `input_release` when the ops reading each parameter are done.
+                /// \returns false if the call was stopped before running all its ops
+                bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                          const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
+                          CallPriority priority = CallPriority::Normal,
+                          const CancellationToken* cancellation = nullptr,
+                          InputRelease* input_release = nullptr);
+
+                /// \brief Runs the call on runtime context `id`, e.g. the context holding the
+                ///        state of a stream; waits for the context if it is busy
+                bool call_on_context(size_t id,
+                                     const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                                     const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
+                                     CallPriority priority = CallPriority::Normal,
+                                     const CancellationToken* cancellation = nullptr);
+
+                /// \brief Feeds result `result_index` of every call back as parameter
+                ///        `parameter_index` of the next call on the same runtime context.
+                ///
+                /// Not to be called while calls are running. See CPU_Executable::bind_state.
+                void bind_state(size_t parameter_index, size_t result_index);
+                /// \brief Sets the state of every context back to zeros
+                void reset_states();
+                /// \brief Copies the state parameter `parameter_index` reads next on context
+                ///        `id` into `target`, or from `source`
+                void read_state(size_t parameter_index, size_t id, runtime::Tensor& target);
+                void write_state(size_t parameter_index, size_t id, const runtime::Tensor& source);
+
+                /// \brief Runs the function on `outputs` and `inputs` once in every runtime
+                ///        context, creating the contexts, their pools and primitives.
+                ///
+                /// The values computed are not reused by the next call.
+                void warm_up(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                             const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+
+                /// \brief Pin `outputs` and `inputs` as the tensors call_bound() runs on.
+                ///
+                /// Output layouts are propagated here once. The tensors are kept alive until
+                /// unbind() or the next bind(), and their buffers must not be reallocated. Must
+                /// not be called while call_bound() is running.
+                void bind(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                           const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+                void unbind();
+                bool is_bound() const { return m_is_bound; }
+                /// \brief Invoke the function on the tensors pinned by bind(). Only their
+                ///        buffer pointers and staleness flags are passed to the runtime context.
+                void call_bound();
+
+                /// \brief Invoke the function on raw buffers holding its parameters and results
+                ///        in their native layouts.
+                ///
+                /// `stale` flags the parameters whose contents changed since the previous call,
+                /// so that values derived from the others can be reused.
+                void call_on_buffers(std::vector<void*>& inputs,
+                                     std::vector<void*>& outputs,
+                                     const std::vector<bool>& stale);
 
                 void propagate_layouts(const std::vector<std::shared_ptr<runtime::Tensor>>& tvs,
                                        const LayoutDescriptorPtrs& layouts) const;
@@ -77,26 +136,134 @@ namespace ngraph
                 void setup_cg_runtime_context();
                 void cleanup_runtime_context();
 
+                /// \brief Frees the activation pools and scratchpads of the contexts that are
+                ///        not running a call and were last used before `idle_before`. They are
+                ///        allocated again by their next call, which recomputes every value.
+                /// \returns The bytes freed
+                size_t trim_idle_contexts(std::chrono::steady_clock::time_point idle_before);
+                size_t trim_context(size_t id, std::chrono::steady_clock::time_point idle_before);
+                size_t get_num_contexts() const { return m_num_ctx; }
+                /// \brief Bytes of pools allocated for context `id`, 0 if it has none
+                size_t get_pool_bytes(size_t id) const { return m_ctx_pool_bytes[id]; }
+                std::chrono::steady_clock::time_point get_last_used(size_t id) const;
+                /// \brief Keeps the pools of the first context, which the debugger runs on
+                ///        without claiming it, from being trimmed
+                void pin_first_context(bool pinned);
+
             protected:
                 CPU_CallFrame(const CPU_CallFrame&) = delete;
                 CPU_CallFrame(CPU_CallFrame&&) = delete;
                 CPU_CallFrame& operator=(const CPU_CallFrame&) = delete;
 
-                void inner_call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                bool inner_call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                                 const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
                                 const size_t id,
-                                const bool disable_caching = true);
+                                const bool disable_caching = true,
+                                CallPriority priority = CallPriority::Normal,
+                                const CancellationToken* cancellation = nullptr,
+                                InputRelease* input_release = nullptr);
+                bool call_on_claimed_context(
+                    size_t id,
+                    const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                    const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
+                    CallPriority priority,
+                    const CancellationToken* cancellation,
+                    InputRelease* input_release = nullptr);
+                bool execute(size_t id,
+                             std::vector<void*>& inputs,
+                             std::vector<void*>& outputs,
+                             CallPriority priority = CallPriority::Normal,
+                             const CancellationToken* cancellation = nullptr,
+                             InputRelease* input_release = nullptr);
+
+                /// \brief Allocates the state buffers context `id` is missing, as zeros
+                void prepare_states(size_t id);
+                /// \brief Makes the buffers the results of context `id` wrote those the
+                ///        parameters read
+                void swap_states(size_t id);
+                bool is_state_parameter(size_t index) const;
+                /// \returns true if a call must write output `tv`, whose result has layout
+                ///          `layout`, to a dense buffer and copy it to `tv` afterwards
+                static bool
+                    needs_staging(const CPUTensor& tv,
+                                  const std::shared_ptr<runtime::cpu::LayoutDescriptor>& layout);
+                /// \returns The state of context `id` read by parameter `parameter_index`
+                AlignedBuffer& get_state(size_t parameter_index, size_t id);
+
+                /// \brief Claim a free runtime context without taking a lock.
+                ///
+                /// The search starts at a slot derived from the calling thread's id so that
+                /// a thread that calls repeatedly tends to reuse the same context (and the
+                /// same warm caches). If every context is busy the caller yields and retries.
+                size_t acquire_context();
+                /// \brief Waits for context `id` to be free and claims it, without preparing it
+                void claim_context(size_t id);
+                void release_context(size_t id);
+                /// \brief Creates the claimed context `id` on its first use and allocates its
+                ///        pools if they are missing.
+                void prepare_context(size_t id);
+                void create_runtime_context(size_t id);
+                void allocate_pools(size_t id);
+                void free_pools(size_t id);
+                /// \returns The bytes of the pools and scratchpad of a context, and in
+                ///          `offsets`, if given, where each pool and then the scratchpad start
+                ///          when placed in one block
+                size_t get_pool_layout(std::vector<size_t>* offsets) const;
+                /// Pools of contexts on an arena are not the trimmer's to free
+                bool uses_pool_trimmer() const;
 
                 std::shared_ptr<CPU_ExternalFunction> m_external_function;
 
-                std::mutex m_mutex;
-                std::condition_variable m_cv;
-                volatile size_t m_num_ctx_available = 0;
-                size_t m_prev_ctx = 0;
+                std::atomic<size_t> m_prev_ctx{0};
                 size_t m_num_ctx = 1;
-                std::unordered_map<size_t, bool> m_id_pool;
+                /// One flag per runtime context, set while a call is executing on it.
+                std::unique_ptr<std::atomic<bool>[]> m_ctx_busy;
+                /// Contexts other than the first are nullptr until a call needs them.
                 std::vector<CPURuntimeContext*> m_ctx_vec;
 
+                /// Where a buffer_data entry pointed into the pools before they were freed
+                struct PoolSlot
+                {
+                    size_t slot;
+                    size_t buffer;
+                    size_t offset;
+                };
+                runtime::Allocator* m_allocator = nullptr;
+                /// The fields below are accessed by whoever holds the busy flag of a context,
+                /// except for the atomics, which the pool trimmer reads as hints.
+                std::vector<char> m_ctx_trimmed;
+                std::vector<std::vector<PoolSlot>> m_ctx_pool_slots;
+                std::unique_ptr<std::atomic<size_t>[]> m_ctx_pool_bytes;
+                std::unique_ptr<std::atomic<std::chrono::steady_clock::rep>[]> m_ctx_last_used;
+                bool m_first_context_pinned = false;
+                /// Arena the pools of the context are placed in, or nullptr
+                std::shared_ptr<CPUActivationArena> m_arena;
+                /// Arena memory the pools of each context currently point into
+                std::vector<std::shared_ptr<AlignedBuffer>> m_ctx_arena_memory;
+
+                struct StatePair
+                {
+                    size_t parameter;
+                    size_t result;
+                    size_t size;
+                };
+                /// The two buffers of a state pair in one context. The parameter reads
+                /// buffers[current] while the result writes the other one.
+                struct StreamState
+                {
+                    std::unique_ptr<AlignedBuffer> buffers[2];
+                    size_t current;
+                };
+                std::vector<StatePair> m_state_pairs;
+                /// Accessed by whoever holds the busy flag of the context
+                std::vector<std::vector<StreamState>> m_ctx_states;
+
+                bool m_is_bound = false;
+                std::vector<std::shared_ptr<runtime::cpu::CPUTensor>> m_bound_inputs;
+                std::vector<std::shared_ptr<runtime::cpu::CPUTensor>> m_bound_outputs;
+                std::vector<void*> m_bound_input_ptrs;
+                std::vector<void*> m_bound_output_ptrs;
+
                 // Codegen specific
 
                 /// Function that initializes the context used in codegen mode.
@@ -0,0 +1,67 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <limits>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// \brief Stops the calls given it once cancelled or once its deadline has passed.
+            ///
+            /// Direct execution checks the token before each op, except on the first call of
+            /// a context, which also builds its primitives. A stopped call returns false and
+            /// leaves its outputs undefined. The token may be shared by several calls and
+            /// cancelled from any thread.
+            class CancellationToken
+            {
+            public:
+                using Clock = std::chrono::steady_clock;
+
+                void cancel() { m_cancelled.store(true, std::memory_order_relaxed); }
+                bool is_cancelled() const { return m_cancelled.load(std::memory_order_relaxed); }
+                void set_deadline(Clock::time_point deadline)
+                {
+                    m_deadline.store(deadline.time_since_epoch().count(),
+                                     std::memory_order_relaxed);
+                }
+                void set_timeout(Clock::duration timeout) { set_deadline(Clock::now() + timeout); }
+                bool should_stop() const
+                {
+                    if (is_cancelled())
+                    {
+                        return true;
+                    }
+                    Clock::rep deadline = m_deadline.load(std::memory_order_relaxed);
+                    return deadline != no_deadline &&
+                           Clock::now().time_since_epoch().count() >= deadline;
+                }
+
+            private:
+                static constexpr Clock::rep no_deadline = std::numeric_limits<Clock::rep>::max();
+
+                std::atomic<bool> m_cancelled{false};
+                std::atomic<Clock::rep> m_deadline{no_deadline};
+            };
+        }
+    }
+}
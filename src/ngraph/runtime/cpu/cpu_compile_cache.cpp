@@ -0,0 +1,399 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cctype>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#ifdef _WIN32
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+#include "ngraph/cpio.hpp"
+#include "ngraph/env_util.hpp"
+#include "ngraph/file_util.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/pass/convert_opset_1_to_0.hpp"
+#include "ngraph/pass/convert_opset_3_to_1.hpp"
+#include "ngraph/pass/implicit_broadcast_elimination.hpp"
+#include "ngraph/pass/like_replacement.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/nop_elimination.hpp"
+#include "ngraph/pass/zero_dim_tensor_elimination.hpp"
+#include "ngraph/runtime/cpu/cpu_compile_cache.hpp"
+#include "ngraph/serializer.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+extern "C" NGRAPH_API const char* get_ngraph_version_string();
+
+static const string s_save_info = "CPU Save File 1.0";
+
+// FNV-1a, used instead of std::hash so keys are stable across standard library versions
+static uint64_t fnv1a(const string& s, uint64_t hash = 14695981039346656037ULL)
+{
+    for (unsigned char c : s)
+    {
+        hash ^= c;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+static string pass_config_to_string(const ngraph::pass::PassConfig& pass_config)
+{
+    stringstream ss;
+    for (auto& kv : pass_config.get_enables())
+    {
+        ss << "enable " << kv.first << " " << kv.second << "\n";
+    }
+    for (auto& kv : pass_config.get_pass_attributes())
+    {
+        ss << "attribute " << kv.first << " " << kv.second << "\n";
+    }
+    return ss.str();
+}
+
+static ngraph::pass::PassConfig pass_config_from_string(const string& str)
+{
+    ngraph::pass::PassConfig pass_config;
+    stringstream ss(str);
+    string kind;
+    string name;
+    bool value;
+    while (ss >> kind >> name >> value)
+    {
+        if (kind == "enable")
+        {
+            pass_config.set_pass_enable(name, value);
+        }
+        else if (kind == "attribute")
+        {
+            pass_config.set_pass_attribute(name, value);
+        }
+    }
+    return pass_config;
+}
+
+string runtime::cpu::CPUTuning::to_string() const
+{
+    stringstream ss;
+    ss << "intra_op_threads " << intra_op_threads << "\n";
+    ss << "inter_op " << inter_op << "\n";
+    ss << "concurrency " << concurrency << "\n";
+    ss << "use_tbb " << use_tbb << "\n";
+    for (auto& op : op_profile)
+    {
+        ss << "op " << op.first << " " << op.second << "\n";
+    }
+    return ss.str();
+}
+
+bool runtime::cpu::CPUTuning::from_string(const string& str, CPUTuning& tuning)
+{
+    stringstream ss(str);
+    string name;
+    size_t count = 0;
+    tuning.op_profile.clear();
+    while (ss >> name)
+    {
+        if (name == "op")
+        {
+            string type;
+            double microseconds;
+            if (!(ss >> type >> microseconds))
+            {
+                return false;
+            }
+            tuning.op_profile.emplace_back(type, microseconds);
+            count++;
+            continue;
+        }
+        int value;
+        if (!(ss >> value))
+        {
+            return false;
+        }
+        if (name == "intra_op_threads")
+        {
+            tuning.intra_op_threads = value;
+        }
+        else if (name == "inter_op")
+        {
+            tuning.inter_op = value != 0;
+        }
+        else if (name == "concurrency")
+        {
+            tuning.concurrency = value;
+        }
+        else if (name == "use_tbb")
+        {
+            tuning.use_tbb = value != 0;
+        }
+        else
+        {
+            return false;
+        }
+        count++;
+    }
+    return count > 0;
+}
+
+string runtime::cpu::get_compile_cache_dir()
+{
+    return getenv_string("NGRAPH_CPU_CACHE_DIR");
+}
+
+unordered_map<string, string> runtime::cpu::get_canonical_names(const Function& func,
+                                                                 const string& function_name)
+{
+    unordered_map<string, string> names;
+    names[func.get_name()] = function_name;
+    size_t index = 0;
+    for (auto& node : func.get_ordered_ops())
+    {
+        string name = "Node_" + to_string(index++);
+        names[node->get_name()] = name;
+        for (size_t i = 0; i < node->get_output_size(); i++)
+        {
+            names[node->get_output_tensor(i).get_name()] = name + "_" + to_string(i);
+        }
+    }
+    return names;
+}
+
+// Replaces the longest name starting at each `_` separated part of an identifier
+static void replace_names_in_identifier(const string& id,
+                                        const unordered_map<string, string>& names,
+                                        string& result)
+{
+    size_t p = 0;
+    while (p < id.size())
+    {
+        bool replaced = false;
+        for (size_t q = id.size(); q > p && !replaced; q--)
+        {
+            if (q == id.size() || id[q] == '_')
+            {
+                auto it = names.find(id.substr(p, q - p));
+                if (it != names.end())
+                {
+                    result += it->second;
+                    p = q;
+                    replaced = true;
+                }
+            }
+        }
+        if (!replaced)
+        {
+            size_t next = id.find('_', p);
+            next = next == string::npos ? id.size() : next + 1;
+            result.append(id, p, next - p);
+            p = next;
+        }
+    }
+}
+
+string runtime::cpu::replace_names(const string& text, const unordered_map<string, string>& names)
+{
+    auto is_identifier_char = [](char c) {
+        return isalnum(static_cast<unsigned char>(c)) || c == '_';
+    };
+    string result;
+    result.reserve(text.size());
+    size_t i = 0;
+    while (i < text.size())
+    {
+        if (!is_identifier_char(text[i]))
+        {
+            result += text[i++];
+            continue;
+        }
+        size_t end = i;
+        while (end < text.size() && is_identifier_char(text[end]))
+        {
+            end++;
+        }
+        replace_names_in_identifier(text.substr(i, end - i), names, result);
+        i = end;
+    }
+    return result;
+}
+
+string runtime::cpu::serialize_for_cache_key(const shared_ptr<Function>& func)
+{
+    return replace_names(serialize(func, 0), get_canonical_names(*func, "Function"));
+}
+
+string runtime::cpu::get_temporary_path(const string& path)
+{
+    return path + "." + to_string(getpid()) + "." +
+           to_string(hash<thread::id>()(this_thread::get_id())) + ".tmp";
+}
+
+string runtime::cpu::compute_compile_cache_key(const string& serialized_function,
+                                               const ngraph::pass::PassConfig& pass_config,
+                                               EXECUTION_MODE mode)
+{
+    uint64_t hash = fnv1a(serialized_function);
+    hash = fnv1a(pass_config_to_string(pass_config), hash);
+    hash = fnv1a(get_ngraph_version_string(), hash);
+    hash = fnv1a(to_string(static_cast<int>(mode)), hash);
+
+    stringstream ss;
+    ss << hex << hash;
+    return ss.str();
+}
+
+string runtime::cpu::compute_codegen_cache_key(const string& source, const string& target_cpu)
+{
+    uint64_t hash = fnv1a(source);
+    hash = fnv1a(target_cpu, hash);
+    hash = fnv1a(get_ngraph_version_string(), hash);
+
+    stringstream ss;
+    ss << hex << hash;
+    return ss.str();
+}
+
+shared_ptr<Function>
+    runtime::cpu::run_cacheable_passes(const shared_ptr<Function>& func,
+                                       ngraph::pass::PassConfig& pass_config)
+{
+    auto clone = clone_function(*func);
+    auto enabled = [&pass_config](const string& name) {
+        auto& enables = pass_config.get_enables();
+        auto it = enables.find(name);
+        return it == enables.end() || it->second;
+    };
+
+    // Same order as the head of CPU_ExternalFunction::register_common_passes, minus
+    // FusedOpDecomposition which depends on the set of CPU kernels and always reruns.
+    ngraph::pass::Manager pass_manager;
+    vector<string> applied;
+#define REGISTER_CACHEABLE_PASS(name)                                                              \
+    if (enabled(#name))                                                                            \
+    {                                                                                              \
+        pass_manager.register_pass<ngraph::pass::name>();                                          \
+        applied.push_back(#name);                                                                  \
+    }
+    REGISTER_CACHEABLE_PASS(LikeReplacement)
+    REGISTER_CACHEABLE_PASS(ConvertOpset3To1)
+    REGISTER_CACHEABLE_PASS(ConvertOpset1To0)
+    REGISTER_CACHEABLE_PASS(ImplicitBroadcastElimination)
+    REGISTER_CACHEABLE_PASS(NopElimination)
+    REGISTER_CACHEABLE_PASS(ZeroDimTensorElimination)
+#undef REGISTER_CACHEABLE_PASS
+    pass_manager.run_passes(clone);
+
+    for (auto& name : applied)
+    {
+        pass_config.set_pass_enable(name, false);
+    }
+    return clone;
+}
+
+void runtime::cpu::write_cached_tuning(const string& cache_dir,
+                                       const string& key,
+                                       const CPUTuning& tuning)
+{
+    file_util::make_directory(cache_dir);
+    string path = file_util::path_join(cache_dir, key + ".tuning");
+    string tmp_path = get_temporary_path(path);
+    {
+        ofstream out(tmp_path);
+        out << tuning.to_string();
+    }
+    if (rename(tmp_path.c_str(), path.c_str()) != 0)
+    {
+        file_util::remove_file(tmp_path);
+    }
+}
+
+shared_ptr<runtime::cpu::CPUTuning> runtime::cpu::read_cached_tuning(const string& cache_dir,
+                                                                    const string& key)
+{
+    string path = file_util::path_join(cache_dir, key + ".tuning");
+    if (!file_util::exists(path))
+    {
+        return nullptr;
+    }
+    ifstream in(path);
+    stringstream ss;
+    ss << in.rdbuf();
+    auto tuning = make_shared<CPUTuning>();
+    return CPUTuning::from_string(ss.str(), *tuning) ? tuning : nullptr;
+}
+
+void runtime::cpu::write_save_data(ostream& out, const CPUSaveData& data)
+{
+    cpio::Writer writer(out);
+    writer.write("save_info", s_save_info.data(), s_save_info.size());
+    writer.write("key", data.key.data(), data.key.size());
+    string config = pass_config_to_string(data.pass_config);
+    writer.write("pass_config", config.data(), config.size());
+    writer.write("model", data.model.data(), data.model.size());
+    if (data.tuning)
+    {
+        string tuning = data.tuning->to_string();
+        writer.write("tuning", tuning.data(), tuning.size());
+    }
+}
+
+bool runtime::cpu::read_save_data(istream& in, CPUSaveData& data)
+{
+    cpio::Reader reader(in);
+    auto file_info = reader.get_file_info();
+    auto read_entry = [&](const string& name, string& value) {
+        for (const cpio::FileInfo& info : file_info)
+        {
+            if (info.get_name() == name)
+            {
+                vector<char> buffer = reader.read(info);
+                value = string(buffer.data(), buffer.size());
+                return true;
+            }
+        }
+        return false;
+    };
+
+    string save_info;
+    string config;
+    if (!read_entry("save_info", save_info) || save_info != s_save_info ||
+        !read_entry("key", data.key) || !read_entry("pass_config", config) ||
+        !read_entry("model", data.model))
+    {
+        return false;
+    }
+    data.pass_config = pass_config_from_string(config);
+    // Files saved before tuning was stored have no tuning entry
+    string tuning;
+    data.tuning = nullptr;
+    if (read_entry("tuning", tuning))
+    {
+        data.tuning = make_shared<CPUTuning>();
+        if (!CPUTuning::from_string(tuning, *data.tuning))
+        {
+            data.tuning = nullptr;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,132 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "cpu_backend_visibility.h"
+#include "ngraph/function.hpp"
+#include "ngraph/pass/pass_config.hpp"
+#include "ngraph/runtime/cpu/cpu_execution_mode.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// \brief Parallelism settings of a CPU executable, as found by autotune().
+            struct CPUTuning
+            {
+                /// Threads, pinned to cores of their own, that the ops of a call run on; 0 to
+                /// run on the shared thread pools
+                int intra_op_threads = 0;
+                /// Let independent ops of a call run concurrently on the inter-op thread pools
+                bool inter_op = true;
+                /// Calls that can run at once, each on a runtime context of its own; 0 to
+                /// follow NGRAPH_CPU_CONCURRENCY
+                int concurrency = 0;
+                /// Run the ops through a TBB flow graph; ignored in builds without TBB
+                bool use_tbb = false;
+                /// Type and average microseconds of each op of a call, in execution order, as
+                /// recorded by record_profile(); a negative time if the op was never timed.
+                /// Compiling the same graph with it sets which ops run inline and which ready
+                /// ops the op scheduler starts first.
+                std::vector<std::pair<std::string, double>> op_profile;
+
+                std::string to_string() const;
+                /// \returns false if `str` does not hold settings written by to_string
+                static bool from_string(const std::string& str, CPUTuning& tuning);
+            };
+
+            /// \brief Contents of a CPU save file, as written by CPU_Executable::save and read
+            ///        by CPU_Backend::load and the on-disk compile cache.
+            struct CPUSaveData
+            {
+                /// Cache key of the source function this model was produced from
+                std::string key;
+                /// Serialized function with the cacheable pass prefix already applied
+                std::string model;
+                /// Pass configuration to compile `model` with; the cacheable prefix passes are
+                /// disabled since they have already run.
+                ngraph::pass::PassConfig pass_config;
+                /// Parallelism settings to run `model` with, nullptr if it was not tuned
+                std::shared_ptr<CPUTuning> tuning;
+            };
+
+            /// \brief Returns the on-disk compile cache directory set through
+            ///        NGRAPH_CPU_CACHE_DIR, or an empty string if caching is disabled.
+            std::string get_compile_cache_dir();
+
+            /// \brief Maps the names of the function, its nodes and their output tensors, which
+            ///        are unique to the process, to names numbered in topological order, so
+            ///        that identically built functions get the same names.
+            /// \param function_name Name given to the function itself
+            std::unordered_map<std::string, std::string>
+                get_canonical_names(const Function& func, const std::string& function_name);
+
+            /// \brief Replaces the names of `names` in `text`, where they appear as identifiers
+            ///        or as `_` separated parts of identifiers.
+            std::string replace_names(const std::string& text,
+                                      const std::unordered_map<std::string, std::string>& names);
+
+            /// \brief Serializes `func` with canonical names, for compute_compile_cache_key
+            std::string serialize_for_cache_key(const std::shared_ptr<Function>& func);
+
+            /// \brief Returns a path next to `path` that no other thread or process writes,
+            ///        for writing an entry before renaming it into place.
+            std::string get_temporary_path(const std::string& path);
+
+            /// \brief Computes a cache key from a serialized function, the pass configuration,
+            ///        the execution mode and the nGraph version.
+            std::string compute_compile_cache_key(const std::string& serialized_function,
+                                                  const ngraph::pass::PassConfig& pass_config,
+                                                  EXECUTION_MODE mode);
+
+            /// \brief Computes the key of a CODEGEN object file from the emitted source, the
+            ///        name of the CPU the object code targets and the nGraph version.
+            std::string compute_codegen_cache_key(const std::string& source,
+                                                  const std::string& target_cpu);
+
+            /// \brief Clones `func` and runs the target-independent passes at the head of the
+            ///        CPU pipeline on the clone. The result contains only core ops and so can be
+            ///        round-tripped through the serializer.
+            /// \param pass_config Is updated to disable the passes that were applied.
+            std::shared_ptr<Function>
+                run_cacheable_passes(const std::shared_ptr<Function>& func,
+                                     ngraph::pass::PassConfig& pass_config);
+
+            /// \brief Stores `tuning` in `cache_dir` for the functions of compile cache key
+            ///        `key`, for CPU_Backend::compile to pick up.
+            void write_cached_tuning(const std::string& cache_dir,
+                                     const std::string& key,
+                                     const CPUTuning& tuning);
+            /// \returns The tuning stored for `key`, or nullptr if there is none
+            std::shared_ptr<CPUTuning> read_cached_tuning(const std::string& cache_dir,
+                                                          const std::string& key);
+
+            void write_save_data(std::ostream& out, const CPUSaveData& data);
+            /// \returns false if the stream does not hold a CPU save file of this version.
+            bool read_save_data(std::istream& in, CPUSaveData& data);
+        }
+    }
+}
@@ -0,0 +1,71 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+
+#include "ngraph/pass/pass_util.hpp"
+#include "ngraph/runtime/cpu/cpu_constant_store.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+shared_ptr<op::v0::Constant>
+    runtime::cpu::CPUConstantStore::intern(const shared_ptr<op::v0::Constant>& constant)
+{
+    size_t hash = ngraph::pass::hash_constant(*constant);
+
+    lock_guard<mutex> lock(m_mutex);
+    m_stats.lookups++;
+    auto& bucket = m_constants[hash];
+    bucket.erase(remove_if(bucket.begin(),
+                           bucket.end(),
+                           [](const weak_ptr<op::v0::Constant>& c) { return c.expired(); }),
+                 bucket.end());
+    shared_ptr<op::v0::Constant> result = constant;
+    for (auto& entry : bucket)
+    {
+        auto candidate = entry.lock();
+        if (!candidate)
+        {
+            continue;
+        }
+        if (candidate == constant)
+        {
+            return constant;
+        }
+        if (candidate->get_data_ptr() == constant->get_data_ptr())
+        {
+            // Already shares the buffer, e.g. a clone of an interned constant
+            break;
+        }
+        if (ngraph::pass::constants_equal(*candidate, *constant))
+        {
+            // The copy constructor shares the data buffer
+            result = make_shared<op::v0::Constant>(*candidate);
+            m_stats.hits++;
+            m_stats.shared_bytes += ngraph::pass::constant_byte_size(*constant);
+            break;
+        }
+    }
+    bucket.push_back(result);
+    return result;
+}
+
+runtime::cpu::CPUConstantStore::Stats runtime::cpu::CPUConstantStore::get_stats() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_stats;
+}
@@ -0,0 +1,72 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// \brief Content-addressed store of the constants used by the executables of one
+            ///        CPU backend, so that executables compiled from the same model share a
+            ///        single copy of its weights.
+            ///
+            /// The store only keeps weak references; the data of a constant is freed once no
+            /// executable uses it.
+            class CPU_BACKEND_API CPUConstantStore
+            {
+            public:
+                struct Stats
+                {
+                    /// Constants looked up in the store
+                    size_t lookups;
+                    /// Lookups that found a live constant with the same type, shape and data
+                    size_t hits;
+                    /// Bytes that did not need a copy of their own thanks to those hits
+                    size_t shared_bytes;
+                };
+
+                /// \brief Returns a constant with the data of `constant`. If a live constant of
+                ///        the same type, shape and data has been interned before, the result
+                ///        is a new node sharing that constant's buffer; otherwise `constant`
+                ///        itself is recorded and returned.
+                std::shared_ptr<ngraph::op::v0::Constant>
+                    intern(const std::shared_ptr<ngraph::op::v0::Constant>& constant);
+
+                Stats get_stats() const;
+
+            private:
+                mutable std::mutex m_mutex;
+                // Constants by hash of their data. Nodes sharing a buffer are all recorded, so
+                // the buffer can still be found after any one of their functions is destroyed.
+                std::unordered_map<size_t, std::vector<std::weak_ptr<ngraph::op::v0::Constant>>>
+                    m_constants;
+                Stats m_stats{0, 0, 0};
+            };
+        }
+    }
+}
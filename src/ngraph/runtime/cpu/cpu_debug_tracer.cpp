@@ -14,8 +14,14 @@
 // limitations under the License.
 //*****************************************************************************
 
+#ifdef NGRAPH_ZLIB_ENABLE
+#include <zlib.h>
+#endif
+
 #include "ngraph/runtime/cpu/cpu_debug_tracer.hpp"
 #include "ngraph/env_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/util.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -23,6 +29,17 @@ using namespace ngraph;
 runtime::cpu::CPU_DebugTracer::CPU_DebugTracer()
     : m_serial_number(0)
 {
+    m_sample_period = max(getenv_int("NGRAPH_CPU_TRACER_SAMPLE_PERIOD"), 1);
+    for (auto& op : split(getenv_string("NGRAPH_CPU_TRACER_OPS"), ','))
+    {
+        if (!op.empty())
+        {
+            m_traced_ops.insert(op);
+        }
+    }
+    int queue_mb = getenv_int("NGRAPH_CPU_TRACER_QUEUE_MB");
+    m_max_queued_bytes = size_t(queue_mb > 0 ? queue_mb : 256) << 20;
+
     static const auto debug_t = getenv_bool("NGRAPH_CPU_DEBUG_TRACER");
     if (debug_t)
     {
@@ -32,6 +49,25 @@ runtime::cpu::CPU_DebugTracer::CPU_DebugTracer()
     }
 }
 
+runtime::cpu::CPU_DebugTracer& runtime::cpu::CPU_DebugTracer::get()
+{
+    // Set up once, as functions may be built concurrently
+    static CPU_DebugTracer& debug_tracer = []() -> CPU_DebugTracer& {
+        static CPU_DebugTracer tracer;
+        if (getenv_bool("NGRAPH_CPU_DEBUG_TRACER"))
+        {
+            tracer.set_enable_tracing(true);
+        }
+        return tracer;
+    }();
+    return debug_tracer;
+}
+
+runtime::cpu::CPU_DebugTracer::~CPU_DebugTracer()
+{
+    close_streams();
+}
+
 void runtime::cpu::CPU_DebugTracer::init_streams()
 {
     if (m_tracer_stream.is_open())
@@ -51,7 +87,48 @@ void runtime::cpu::CPU_DebugTracer::init_streams()
     }
 
     m_tracer_stream.open(trace_file_path, ios_base::out | ios_base::ate);
-    m_tracer_bin_stream.open(trace_bin_file_path, std::ios_base::out | std::ios_base::ate);
+    if (getenv_bool("NGRAPH_CPU_TRACER_COMPRESS"))
+    {
+#ifdef NGRAPH_ZLIB_ENABLE
+        // Offsets in the meta log are into the decompressed data
+        m_compressed_bin_stream = gzopen(trace_bin_file_path.c_str(), "wb1");
+#else
+        NGRAPH_WARN << "nGraph was built without NGRAPH_ZLIB_ENABLE, the tensors traced are "
+                       "not compressed";
+#endif
+    }
+    if (!m_compressed_bin_stream)
+    {
+        m_tracer_bin_stream.open(trace_bin_file_path, std::ios_base::out | std::ios_base::ate);
+    }
+    m_bin_offset = 0;
+
+    m_stop = false;
+    m_writer = thread(&CPU_DebugTracer::write_dumps, this);
+}
+
+void runtime::cpu::CPU_DebugTracer::close_streams()
+{
+    if (!m_writer.joinable())
+    {
+        return;
+    }
+    {
+        lock_guard<mutex> lock(m_queue_mutex);
+        m_stop = true;
+    }
+    m_queue_changed.notify_all();
+    m_writer.join();
+
+    m_tracer_stream.close();
+    m_tracer_bin_stream.close();
+#ifdef NGRAPH_ZLIB_ENABLE
+    if (m_compressed_bin_stream)
+    {
+        gzclose(m_compressed_bin_stream);
+        m_compressed_bin_stream = nullptr;
+    }
+#endif
 }
 
 void runtime::cpu::CPU_DebugTracer::set_enable_tracing(bool new_state)
@@ -64,10 +141,109 @@ void runtime::cpu::CPU_DebugTracer::set_enable_tracing(bool new_state)
     m_enable_tracing = new_state;
 }
 
+bool runtime::cpu::CPU_DebugTracer::begin_call()
+{
+    return m_calls.fetch_add(1, memory_order_relaxed) % m_sample_period == 0;
+}
+
+bool runtime::cpu::CPU_DebugTracer::traces_op(const string& description) const
+{
+    return m_traced_ops.empty() || m_traced_ops.count(description) != 0;
+}
+
 void runtime::cpu::CPU_DebugTracer::end_of_kernel()
 {
     m_serial_number++;
+}
+
+void runtime::cpu::CPU_DebugTracer::flush()
+{
+    unique_lock<mutex> lock(m_queue_mutex);
+    m_queue_changed.wait(lock, [this] { return m_queue.empty() && m_writing == 0; });
+}
+
+void runtime::cpu::CPU_DebugTracer::enqueue(TensorDump&& dump)
+{
+    size_t bytes = dump.data.size();
+    {
+        unique_lock<mutex> lock(m_queue_mutex);
+        // A tensor larger than the whole queue waits until the queue is empty
+        m_queue_changed.wait(lock, [this, bytes] {
+            return m_queue.empty() || m_queued_bytes + bytes <= m_max_queued_bytes;
+        });
+        m_queued_bytes += bytes;
+        m_queue.push_back(move(dump));
+    }
+    m_queue_changed.notify_all();
+}
+
+void runtime::cpu::CPU_DebugTracer::write_dumps()
+{
+    unique_lock<mutex> lock(m_queue_mutex);
+    while (true)
+    {
+        m_queue_changed.wait(lock, [this] { return m_stop || !m_queue.empty(); });
+        if (m_queue.empty())
+        {
+            return;
+        }
+        TensorDump dump = move(m_queue.front());
+        m_queue.pop_front();
+        m_queued_bytes -= dump.data.size();
+        bool last = m_queue.empty();
+        m_writing++;
+        lock.unlock();
+        m_queue_changed.notify_all();
+
+        write_dump(dump);
+        if (last)
+        {
+            m_tracer_stream.flush();
+            m_tracer_bin_stream.flush();
+        }
 
-    m_tracer_stream.flush();
-    m_tracer_bin_stream.flush();
+        lock.lock();
+        m_writing--;
+        m_queue_changed.notify_all();
+    }
+}
+
+void runtime::cpu::CPU_DebugTracer::write_dump(const TensorDump& dump)
+{
+    m_tracer_stream << " K=" << std::left << std::setw(20) << dump.kernel_name
+                    << " S=" << std::left << std::setw(10) << dump.serial_number
+                    << " TID=" << std::left << std::setw(10) << dump.tid << dump.in_out;
+
+    string header = "TID=" + dump.tid + "\n";
+    write_bin(header.data(), header.size());
+
+    m_tracer_stream << " size=" << dump.size << " " << dump.shape << " ";
+
+    m_tracer_stream << "bin_data_offset=" << m_bin_offset;
+    write_bin(dump.data.data(), dump.data.size());
+
+    float mean;
+    float var;
+    dump.statistics(dump.data, dump.size, mean, var);
+
+    m_tracer_stream << " mean=" << mean;
+    m_tracer_stream << " var=" << var;
+
+    write_bin("\n", 1);
+    m_tracer_stream << "\n";
+}
+
+void runtime::cpu::CPU_DebugTracer::write_bin(const char* data, size_t size)
+{
+#ifdef NGRAPH_ZLIB_ENABLE
+    if (m_compressed_bin_stream)
+    {
+        gzwrite(m_compressed_bin_stream, data, static_cast<unsigned>(size));
+    }
+    else
+#endif
+    {
+        m_tracer_bin_stream.write(data, size);
+    }
+    m_bin_offset += size;
 }
@@ -17,34 +17,63 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
+#include <condition_variable>
 #include <cstring>
+#include <deque>
 #include <fstream>
 #include <functional>
 #include <iomanip>
 #include <iostream>
+#include <mutex>
 #include <numeric>
+#include <set>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
 #include "ngraph/runtime/tensor.hpp"
 
+struct gzFile_s;
+
 namespace ngraph
 {
     namespace runtime
     {
         namespace cpu
         {
+            /// \brief Dumps the tensors of every op run, with their mean and variance.
+            ///
+            /// The calling thread only copies the tensors into a bounded queue; a writer thread
+            /// computes the statistics and writes them out, blocking the callers while the
+            /// queue is full. It is configured with environment variables:
+            ///  - NGRAPH_CPU_TRACER_LOG, NGRAPH_CPU_BIN_TRACER_LOG: the files written
+            ///  - NGRAPH_CPU_TRACER_COMPRESS: gzip the tensor data, needs NGRAPH_ZLIB_ENABLE
+            ///  - NGRAPH_CPU_TRACER_SAMPLE_PERIOD: dump one call in every N, by default 1
+            ///  - NGRAPH_CPU_TRACER_OPS: dump only ops of these comma separated types
+            ///  - NGRAPH_CPU_TRACER_QUEUE_MB: the queue size, by default 256
             class CPU_DebugTracer
             {
             public:
                 CPU_DebugTracer();
+                ~CPU_DebugTracer();
+
+                /// \brief The tracer of the executables compiled, enabled by
+                ///        NGRAPH_CPU_DEBUG_TRACER
+                static CPU_DebugTracer& get();
 
                 void set_enable_tracing(bool new_state);
 
                 bool tracing_is_enabled() { return m_enable_tracing; }
+                /// \brief Counts a call, returning whether its tensors are to be dumped
+                bool begin_call();
+                /// \brief Whether the tensors of ops of type `description` are dumped
+                bool traces_op(const std::string& description) const;
                 void end_of_kernel();
+                /// \brief Waits until the tensors dumped so far are written
+                void flush();
 
                 template <typename T>
                 void dump_one_tensor(const std::string& kernel_name,
@@ -59,11 +88,56 @@ namespace ngraph
                 CPU_DebugTracer(CPU_DebugTracer&&) = delete;
                 CPU_DebugTracer& operator=(const CPU_DebugTracer&) = delete;
 
+                // A tensor waiting for the writer thread
+                struct TensorDump
+                {
+                    std::string kernel_name;
+                    std::string tid;
+                    size_t serial_number;
+                    std::string in_out;
+                    Shape shape;
+                    size_t size;
+                    std::vector<char> data;
+                    // Computes the mean and variance of data
+                    void (*statistics)(const std::vector<char>& data,
+                                       size_t size,
+                                       float& mean,
+                                       float& var);
+                };
+
+                template <typename T>
+                static void statistics(const std::vector<char>& data,
+                                       size_t size,
+                                       float& mean,
+                                       float& var);
+
                 void init_streams();
+                void close_streams();
+                void enqueue(TensorDump&& dump);
+                void write_dumps();
+                void write_dump(const TensorDump& dump);
+                void write_bin(const char* data, size_t size);
 
-                size_t m_serial_number;
+                std::atomic<size_t> m_serial_number;
                 std::fstream m_tracer_stream;
                 std::fstream m_tracer_bin_stream;
+                gzFile_s* m_compressed_bin_stream = nullptr;
+                // Bytes written to the tensor data so far, before compression
+                size_t m_bin_offset = 0;
+
+                size_t m_sample_period = 1;
+                std::atomic<size_t> m_calls{0};
+                std::set<std::string> m_traced_ops;
+
+                std::mutex m_queue_mutex;
+                std::condition_variable m_queue_changed;
+                std::deque<TensorDump> m_queue;
+                size_t m_queued_bytes = 0;
+                size_t m_max_queued_bytes = 0;
+                // Dumps taken off the queue but not written yet
+                size_t m_writing = 0;
+                bool m_stop = false;
+                std::thread m_writer;
 
                 bool m_enable_tracing = false;
             };
@@ -88,6 +162,18 @@ float find_variance(const std::vector<T>& f_data, float mean, size_t size)
     return sum / size;
 }
 
+template <typename T>
+void ngraph::runtime::cpu::CPU_DebugTracer::statistics(const std::vector<char>& data,
+                                                       size_t size,
+                                                       float& mean,
+                                                       float& var)
+{
+    std::vector<T> tensor_data(size);
+    memcpy(tensor_data.data(), data.data(), size * sizeof(T));
+    mean = std::accumulate(tensor_data.begin(), tensor_data.end(), 0.0f) / size;
+    var = find_variance<T>(tensor_data, mean, size);
+}
+
 template <typename T>
 void ngraph::runtime::cpu::CPU_DebugTracer::dump_one_tensor(const std::string& kernel_name,
                                                             const void* tensor,
@@ -96,32 +182,15 @@ void ngraph::runtime::cpu::CPU_DebugTracer::dump_one_tensor(const std::string& k
                                                             const ngraph::Shape& shape,
                                                             const std::string& in_out)
 {
-    std::string tid{tensor_name.substr(1 + tensor_name.find("_"))};
-    size_t num_bytes{(size * sizeof(T))};
-
-    std::vector<T> tensor_data(size);
-
-    memcpy(&tensor_data[0], tensor, num_bytes);
-
-    m_tracer_stream << " K=" << std::left << std::setw(20) << kernel_name << " S=" << std::left
-                    << std::setw(10) << m_serial_number << " TID=" << std::left << std::setw(10)
-                    << tid << in_out;
-
-    m_tracer_bin_stream << "TID=" << tid << '\n';
-
-    m_tracer_stream << " size=" << size << " " << shape << " ";
-
-    m_tracer_stream << "bin_data_offset=" << m_tracer_bin_stream.tellp();
-    m_tracer_bin_stream.write(reinterpret_cast<const char*>(tensor_data.data()),
-                              tensor_data.size() * sizeof(T));
-
-    auto mean = std::accumulate(tensor_data.begin(), tensor_data.end(), 0.0f) / size;
-
-    auto var = find_variance<T>(tensor_data, mean, size);
-
-    m_tracer_stream << " mean=" << mean;
-    m_tracer_stream << " var=" << var;
-
-    m_tracer_bin_stream << "\n";
-    m_tracer_stream << "\n";
+    TensorDump dump;
+    dump.kernel_name = kernel_name;
+    dump.tid = tensor_name.substr(1 + tensor_name.find("_"));
+    dump.serial_number = m_serial_number;
+    dump.in_out = in_out;
+    dump.shape = shape;
+    dump.size = size;
+    dump.data.resize(size * sizeof(T));
+    memcpy(dump.data.data(), tensor, dump.data.size());
+    dump.statistics = &statistics<T>;
+    enqueue(std::move(dump));
 }
@@ -41,9 +41,13 @@ void runtime::cpu::CPU_CountTracepoint::operator()(void** outputs, const std::st
 runtime::cpu::CPU_Debugger::CPU_Debugger(ngraph::runtime::cpu::CPU_CallFrame& callframe)
     : m_callframe(callframe)
 {
+    m_callframe.pin_first_context(true);
 }
 
-runtime::cpu::CPU_Debugger::~CPU_Debugger() {}
+runtime::cpu::CPU_Debugger::~CPU_Debugger()
+{
+    m_callframe.pin_first_context(false);
+}
 
 bool runtime::cpu::CPU_Debugger::step()
 {
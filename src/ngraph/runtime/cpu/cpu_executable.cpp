@@ -23,12 +23,18 @@
 #include "ngraph/env_util.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/pass/pass_util.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
 #include "ngraph/runtime/cpu/cpu_builder_registry.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
 #include "ngraph/runtime/cpu/cpu_executable.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
+#include "ngraph/runtime/cpu/cpu_input_release.hpp"
+#include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
+#include "ngraph/runtime/cpu/cpu_numa.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor.hpp"
 #include "ngraph/runtime/cpu/static_initialize.hpp"
 #include "ngraph/util.hpp"
@@ -45,10 +51,54 @@ runtime::cpu::CPU_Executable::CPU_Executable(shared_ptr<Function> func,
                                              ngraph::pass::PassConfig& pass_config,
                                              Allocator* allocator,
                                              bool performance_counters_enabled,
-                                             EXECUTION_MODE mode)
+                                             EXECUTION_MODE mode,
+                                             int numa_node,
+                                             shared_ptr<CPUConstantStore> constant_store,
+                                             const vector<int>& cpus,
+                                             shared_ptr<CPUTuning> tuning,
+                                             shared_ptr<CPUActivationArena> activation_arena)
 {
     m_external_function = make_shared<CPU_ExternalFunction>(func, mode);
+    m_external_function->m_activation_arena = activation_arena;
     m_external_function->m_emit_timing = performance_counters_enabled;
+    m_external_function->m_constant_store = constant_store;
+    if (numa_node >= 0)
+    {
+        m_external_function->m_numa_node = numa_node;
+        m_external_function->m_own_arena = true;
+        m_external_function->m_arena = executor::GetCPUExecutor().get_numa_arena(numa_node);
+    }
+    vector<int> arena_cpus = cpus;
+    if (tuning)
+    {
+        m_external_function->m_inter_op = tuning->inter_op;
+        m_external_function->m_concurrency = tuning->concurrency;
+        m_external_function->m_op_profile = tuning->op_profile;
+#if defined(NGRAPH_TBB_ENABLE)
+        m_external_function->m_use_tbb = tuning->use_tbb;
+#endif
+        size_t threads = static_cast<size_t>(max(tuning->intra_op_threads, 0));
+        if (threads > 0)
+        {
+            if (arena_cpus.empty() && numa_node >= 0)
+            {
+                arena_cpus = numa::get_node_cpus(numa_node);
+            }
+            if (arena_cpus.empty())
+            {
+                for (int cpu = 0; cpu < static_cast<int>(threads); cpu++)
+                {
+                    arena_cpus.push_back(cpu);
+                }
+            }
+            arena_cpus.resize(min(arena_cpus.size(), threads));
+        }
+    }
+    if (!arena_cpus.empty())
+    {
+        m_external_function->m_own_arena = true;
+        m_external_function->m_arena = executor::GetCPUExecutor().get_cpu_set_arena(arena_cpus);
+    }
     auto cf = m_external_function->make_call_frame(pass_config, allocator);
     m_call_frame = dynamic_pointer_cast<CPU_CallFrame>(cf);
 
@@ -60,6 +110,114 @@ std::shared_ptr<ngraph::runtime::cpu::CPU_CallFrame> runtime::cpu::CPU_Executabl
     return m_call_frame;
 }
 
+future<bool>
+    runtime::cpu::CPU_Executable::call_async(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                             const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    return call_async(outputs, inputs, CallPriority::Normal);
+}
+
+future<bool>
+    runtime::cpu::CPU_Executable::call_async(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                             const vector<shared_ptr<runtime::Tensor>>& inputs,
+                                             CallPriority priority,
+                                             shared_ptr<CancellationToken> cancellation)
+{
+    // Waiting here rather than on the call pool keeps its threads from blocking on calls that
+    // have not started yet
+    for (auto& tv : inputs)
+    {
+        tv->wait_for_read_ready();
+    }
+    for (auto& tv : outputs)
+    {
+        tv->wait_for_write_ready();
+    }
+
+    auto done = make_shared<promise<void>>();
+    auto result = make_shared<promise<bool>>();
+    shared_future<void> event = done->get_future().share();
+    // Inputs may be written for the next call once the ops reading them are done, which may
+    // be well before the call completes
+    auto input_release = make_shared<InputRelease>(inputs.size());
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        inputs[i]->set_pending_call(input_release->get_future(i), false);
+    }
+    for (auto& tv : outputs)
+    {
+        tv->set_pending_call(event, true);
+    }
+
+    auto call_frame = m_call_frame;
+    executor::GetCPUExecutor().schedule_call(
+        [call_frame, outputs, inputs, priority, cancellation, input_release, done, result]() {
+            try
+            {
+                result->set_value(call_frame->call(
+                    outputs, inputs, priority, cancellation.get(), input_release.get()));
+            }
+            catch (...)
+            {
+                result->set_exception(current_exception());
+            }
+            input_release->release_all();
+            done->set_value();
+        });
+    return result->get_future();
+}
+
+void runtime::cpu::CPU_Executable::bind(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                        const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    validate(outputs, inputs);
+    m_call_frame->bind(outputs, inputs);
+}
+
+void runtime::cpu::CPU_Executable::bind_state(size_t parameter_index, size_t result_index)
+{
+    m_call_frame->bind_state(parameter_index, result_index);
+}
+
+void runtime::cpu::CPU_Executable::reset_states()
+{
+    m_call_frame->reset_states();
+}
+
+void runtime::cpu::CPU_Executable::read_state(size_t parameter_index,
+                                              size_t context,
+                                              const shared_ptr<runtime::Tensor>& tensor)
+{
+    m_call_frame->read_state(parameter_index, context, *tensor);
+}
+
+void runtime::cpu::CPU_Executable::write_state(size_t parameter_index,
+                                               size_t context,
+                                               const shared_ptr<runtime::Tensor>& tensor)
+{
+    m_call_frame->write_state(parameter_index, context, *tensor);
+}
+
+bool runtime::cpu::CPU_Executable::call_on_context(
+    size_t context,
+    const vector<shared_ptr<runtime::Tensor>>& outputs,
+    const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    return m_call_frame->call_on_context(context, outputs, inputs);
+}
+
+void runtime::cpu::CPU_Executable::unbind()
+{
+    m_call_frame->unbind();
+}
+
+bool runtime::cpu::CPU_Executable::call_bound()
+{
+    m_call_frame->call_bound();
+
+    return true;
+}
+
 bool runtime::cpu::CPU_Executable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
                                         const vector<shared_ptr<runtime::Tensor>>& inputs)
 {
@@ -68,6 +226,14 @@ bool runtime::cpu::CPU_Executable::call(const vector<shared_ptr<runtime::Tensor>
     return true;
 }
 
+bool runtime::cpu::CPU_Executable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                        const vector<shared_ptr<runtime::Tensor>>& inputs,
+                                        CallPriority priority,
+                                        shared_ptr<CancellationToken> cancellation)
+{
+    return m_call_frame->call(outputs, inputs, priority, cancellation.get());
+}
+
 void runtime::cpu::CPU_Backend::remove_compiled_function(shared_ptr<Executable> exec)
 {
     std::lock_guard<std::mutex> guard(m_exec_map_mutex);
@@ -102,6 +268,137 @@ void runtime::cpu::CPU_Backend::set_host_memory_allocator(Allocator* allocator)
     m_allocator = allocator;
 }
 
+void runtime::cpu::CPU_Executable::save(ostream& output_stream)
+{
+    if (!m_save_data)
+    {
+        throw ngraph_error(
+            "CPU executable has no saved model; compile with NGRAPH_CPU_CACHE_DIR set to enable "
+            "save()");
+    }
+    write_save_data(output_stream, *m_save_data);
+}
+
+void runtime::cpu::CPU_Executable::export_library(const string& directory) const
+{
+    if (m_external_function->is_direct_execution())
+    {
+        throw ngraph_error("Only executables compiled to code can be exported");
+    }
+#if defined(CODEGEN_ENABLE)
+    m_external_function->export_library(directory);
+#endif
+}
+
+void runtime::cpu::CPU_Executable::set_save_data(const CPUSaveData& save_data)
+{
+    m_save_data.reset(new CPUSaveData(save_data));
+}
+
+void runtime::cpu::CPU_Executable::warm_up()
+{
+    vector<shared_ptr<runtime::Tensor>> inputs;
+    for (size_t i = 0; i < get_parameters().size(); i++)
+    {
+        auto tensor = create_input_tensor(i);
+        vector<char> zeros(tensor->get_size_in_bytes(), 0);
+        tensor->write(zeros.data(), zeros.size());
+        inputs.push_back(tensor);
+    }
+    warm_up(inputs);
+}
+
+void runtime::cpu::CPU_Executable::warm_up(const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    vector<shared_ptr<runtime::Tensor>> outputs;
+    for (size_t i = 0; i < get_results().size(); i++)
+    {
+        outputs.push_back(create_output_tensor(i));
+    }
+
+    // Calls on zeros must not leave their values in the variables
+    auto variables = m_external_function->get_variable_states();
+    vector<vector<char>> values(variables.size());
+    vector<bool> initialized(variables.size());
+    for (size_t i = 0; i < variables.size(); i++)
+    {
+        initialized[i] = variables[i]->is_initialized();
+        if (initialized[i])
+        {
+            values[i].resize(variables[i]->size());
+            variables[i]->read(values[i].data(), nullptr);
+        }
+    }
+    auto restore_variables = [&]() {
+        for (size_t i = 0; i < variables.size(); i++)
+        {
+            if (!initialized[i])
+            {
+                variables[i]->reset();
+            }
+            else
+            {
+                variables[i]->write(values[i].data());
+            }
+        }
+    };
+    try
+    {
+        validate(outputs, inputs);
+        m_call_frame->warm_up(outputs, inputs);
+    }
+    catch (...)
+    {
+        restore_variables();
+        throw;
+    }
+    restore_variables();
+}
+
+bool runtime::cpu::CPU_Executable::read_variable(const string& variable_id,
+                                                 const shared_ptr<runtime::Tensor>& tensor)
+{
+    VariableState* variable = find_variable(variable_id, tensor);
+    if (!variable->is_initialized())
+    {
+        return false;
+    }
+    tensor->write(variable->get_data_ptr(), variable->size());
+    return true;
+}
+
+void runtime::cpu::CPU_Executable::write_variable(const string& variable_id,
+                                                  const shared_ptr<runtime::Tensor>& tensor)
+{
+    VariableState* variable = find_variable(variable_id, tensor);
+    vector<char> value(variable->size());
+    tensor->read(value.data(), value.size());
+    variable->write(value.data());
+}
+
+VariableState* runtime::cpu::CPU_Executable::find_variable(const string& variable_id,
+                                                          const shared_ptr<runtime::Tensor>& tensor)
+{
+    VariableState* variable = m_external_function->get_variable_state(variable_id);
+    if (variable == nullptr)
+    {
+        throw ngraph_error("No op of the function uses variable " + variable_id);
+    }
+    NGRAPH_CHECK(variable->get_element_type() == tensor->get_element_type() &&
+                     variable->get_shape() == tensor->get_shape(),
+                 "Variable ",
+                 variable_id,
+                 " of element type ",
+                 variable->get_element_type(),
+                 " and shape ",
+                 variable->get_shape(),
+                 " does not match a tensor of element type ",
+                 tensor->get_element_type(),
+                 " and shape ",
+                 tensor->get_shape());
+    return variable;
+}
+
 vector<runtime::PerformanceCounter> runtime::cpu::CPU_Executable::get_performance_data() const
 {
     vector<runtime::PerformanceCounter> rc;
@@ -111,6 +408,64 @@ vector<runtime::PerformanceCounter> runtime::cpu::CPU_Executable::get_performanc
     return rc;
 }
 
+runtime::MemoryFootprint runtime::cpu::CPU_Executable::get_memory_footprint() const
+{
+    MemoryFootprint footprint;
+    for (auto& node : m_external_function->get_function()->get_ops())
+    {
+        if (auto constant = as_type_ptr<op::v0::Constant>(node))
+        {
+            const descriptor::Tensor& tensor = constant->get_output_tensor(0);
+            auto layout = dynamic_pointer_cast<runtime::cpu::LayoutDescriptor>(
+                tensor.get_tensor_layout());
+            if (layout && layout->is_dnnl_layout())
+            {
+                footprint.converted_constant_bytes += tensor.size();
+            }
+            else
+            {
+                footprint.constant_bytes += pass::constant_byte_size(*constant);
+            }
+        }
+    }
+
+    size_t alignment = CPU_ExternalFunction::s_memory_pool_alignment;
+    for (size_t buffer_size : m_external_function->get_memory_buffer_sizes())
+    {
+        footprint.activation_bytes_per_context +=
+            (buffer_size + alignment - 1) / alignment * alignment;
+    }
+    auto& dnnl_emitter = m_external_function->get_dnnl_emitter();
+    if (dnnl_emitter)
+    {
+        if (m_external_function->is_direct_execution())
+        {
+            footprint.scratchpad_bytes_per_context = dnnl_emitter->get_max_scratchpad_size();
+        }
+        footprint.workspace_bytes = dnnl_emitter->get_workspace_bytes();
+    }
+    for (size_t id = 0; id < m_call_frame->get_num_contexts(); id++)
+    {
+        if (m_call_frame->get_pool_bytes(id) > 0)
+        {
+            footprint.contexts++;
+        }
+    }
+#if defined(CODEGEN_ENABLE)
+    if (m_external_function->m_execution_engine)
+    {
+        footprint.code_bytes = m_external_function->m_execution_engine->get_code_bytes();
+    }
+#endif
+    return footprint;
+}
+
+const runtime::cpu::CPU_MemoryTimeline*
+    runtime::cpu::CPU_Executable::get_memory_timeline() const
+{
+    return m_external_function->get_memory_timeline();
+}
+
 shared_ptr<ngraph::op::v0::Parameter>
     runtime::cpu::CPU_Executable::get_parameter(size_t index) const
 {
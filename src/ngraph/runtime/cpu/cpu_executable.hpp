@@ -23,8 +23,14 @@
 #include "cpu_backend_visibility.h"
 #include "ngraph/pass/pass_config.hpp"
 #include "ngraph/runtime/allocator.hpp"
+#include "ngraph/runtime/cpu/cpu_activation_arena.hpp"
+#include "ngraph/runtime/cpu/cpu_cancellation.hpp"
+#include "ngraph/runtime/cpu/cpu_compile_cache.hpp"
+#include "ngraph/runtime/cpu/cpu_constant_store.hpp"
 #include "ngraph/runtime/cpu/cpu_execution_mode.hpp"
+#include "ngraph/runtime/cpu/cpu_runtime_context.hpp"
 #include "ngraph/runtime/executable.hpp"
+#include "ngraph/state/variable_state.hpp"
 
 namespace ngraph
 {
@@ -34,22 +40,144 @@ namespace ngraph
         {
             class CPU_ExternalFunction;
             class CPU_CallFrame;
+            class CPU_MemoryTimeline;
 
             class CPU_BACKEND_API CPU_Executable : public runtime::Executable
             {
             public:
+                /// \param numa_node NUMA node to place the execution contexts and the threads
+                ///        running them on, -1 to leave placement to the operating system
+                /// \param cpus CPUs to run the ops on, on threads of their own; empty to use
+                ///        the shared thread pools, or those of numa_node
+                /// \param constant_store Store to share constants with other executables
+                ///        through, nullptr to keep them private
+                /// \param tuning Parallelism settings overriding those of the environment, or
+                ///        nullptr. Its intra-op threads are pinned to the first of `cpus`, of
+                ///        the CPUs of numa_node, or of the machine.
+                /// \param activation_arena Arena to place the activation pools in, shared with
+                ///        the other executables compiled against it, or nullptr
                 CPU_Executable(std::shared_ptr<Function> func,
                                ngraph::pass::PassConfig& pass_config,
                                Allocator* allocator,
                                bool performance_counters_enabled,
-                               EXECUTION_MODE mode);
+                               EXECUTION_MODE mode,
+                               int numa_node = -1,
+                               std::shared_ptr<CPUConstantStore> constant_store = nullptr,
+                               const std::vector<int>& cpus = std::vector<int>(),
+                               std::shared_ptr<CPUTuning> tuning = nullptr,
+                               std::shared_ptr<CPUActivationArena> activation_arena = nullptr);
                 bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                           const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
 
+                /// \brief Waits for earlier asynchronous calls using the tensors, then runs
+                ///        the call on the executor's call pool.
+                ///
+                /// In direct execution, each input is released as soon as the ops reading it
+                /// are done: its wait_for_write_ready() returns then, so the input of the next
+                /// call can be written into it while the rest of this call runs.
+                std::future<bool> call_async(
+                    const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                    const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
+
+                /// \brief Runs the call with a priority over the calls running concurrently
+                ///        on the other contexts (NGRAPH_CPU_CONCURRENCY > 1) or executables.
+                ///
+                /// Between ops, the call waits while calls of a higher priority run, so
+                /// background work sharing the thread pools gives way to latency sensitive
+                /// inference. Calls without a priority are CallPriority::Normal.
+                /// \param cancellation Token to stop the call between ops with, when the
+                ///        client gave up on it or its deadline has passed; may be nullptr
+                /// \returns false if the call was stopped, leaving the outputs undefined
+                bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                          const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
+                          CallPriority priority,
+                          std::shared_ptr<CancellationToken> cancellation = nullptr);
+                std::future<bool>
+                    call_async(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                               const std::vector<std::shared_ptr<runtime::Tensor>>& inputs,
+                               CallPriority priority,
+                               std::shared_ptr<CancellationToken> cancellation = nullptr);
+
                 std::shared_ptr<CPU_CallFrame> get_call_frame();
 
+                /// \brief Keeps result `result_index` of every call in the executable as the
+                ///        value parameter `parameter_index` reads in the next call, e.g. the
+                ///        hidden and cell state of an RNN run on a stream of chunks.
+                ///
+                /// Each runtime context holds its own state in two buffers, which the
+                /// parameter and the result swap after every completed call, so the state is
+                /// never copied. A context is one stream; call_on_context() keeps concurrent
+                /// streams (NGRAPH_CPU_CONCURRENCY > 1) on their own contexts. The state
+                /// starts as zeros. Calls ignore the tensors given for the parameter and the
+                /// result, which may be nullptr. Not to be called while calls are running.
+                void bind_state(size_t parameter_index, size_t result_index);
+                /// \brief Sets the state of every context back to zeros, to start new streams
+                void reset_states();
+                /// \brief Copies the state of parameter `parameter_index` in runtime context
+                ///        `context` into `tensor`, or from it
+                void read_state(size_t parameter_index,
+                                size_t context,
+                                const std::shared_ptr<runtime::Tensor>& tensor);
+                void write_state(size_t parameter_index,
+                                 size_t context,
+                                 const std::shared_ptr<runtime::Tensor>& tensor);
+                /// \brief Runs the call on runtime context `context`, waiting for it if busy
+                bool call_on_context(size_t context,
+                                     const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                                     const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+
+                /// \brief Validate `outputs` and `inputs` once and pin them as the tensors
+                ///        call_bound() runs on, so repeated calls on the same buffers skip the
+                ///        per-call validation, layout propagation and argument marshalling.
+                void bind(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                          const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+                /// \brief Release the tensors pinned by bind().
+                void unbind();
+                /// \brief Run on the tensors pinned by bind().
+                bool call_bound();
+
+                /// \brief Runs every runtime context once on zeros, building its DNNL
+                ///        primitives and reordered weights and faulting in its pools.
+                void warm_up() override;
+                /// \brief Warms up on `inputs` rather than zeros, for functions that zeros
+                ///        are not valid inputs of, such as divisors of integers
+                void warm_up(const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+
                 std::vector<PerformanceCounter> get_performance_data() const override;
 
+                /// \brief Constants in DNNL layouts count as converted. Contexts are those with
+                ///        pools of their own allocated; pools placed in a shared activation arena
+                ///        belong to the arena.
+                MemoryFootprint get_memory_footprint() const override;
+
+                /// \brief Temporaries live during every op, in the order the ops run, and the
+                ///        op where they peak. nullptr when the executable is generated code
+                ///        rather than run directly.
+                const CPU_MemoryTimeline* get_memory_timeline() const;
+
+                /// \brief Save this executable in a form CPU_Backend::load can read.
+                ///
+                /// Only executables compiled with the on-disk compile cache enabled
+                /// (NGRAPH_CPU_CACHE_DIR) retain the model needed for saving.
+                void save(std::ostream& output_stream) override;
+                void set_save_data(const CPUSaveData& save_data);
+
+                /// \brief Writes the code generated for this executable to `directory` as a
+                ///        CMake project building a shared library that runs it without the JIT.
+                ///
+                /// The library has a C entry point, `<name>_create`, `<name>_call` and
+                /// `<name>_destroy` declared in `<name>_aot.h`, and maps the constants from
+                /// `<name>.weights` in the directory it is created with. It still links the
+                /// nGraph and CPU backend libraries the generated code calls into. Only
+                /// executables compiled to code, with the CODEGEN pass attribute or on
+                /// CPU:CODEGEN, without timing can be exported.
+                void export_library(const std::string& directory) const;
+
+                bool read_variable(const std::string& variable_id,
+                                   const std::shared_ptr<runtime::Tensor>& tensor) override;
+                void write_variable(const std::string& variable_id,
+                                    const std::shared_ptr<runtime::Tensor>& tensor) override;
+
                 std::shared_ptr<runtime::Tensor> create_input_tensor(size_t input_index) override;
 
                 std::shared_ptr<runtime::Tensor> create_input_tensor(size_t input_index,
@@ -79,9 +207,12 @@ namespace ngraph
             private:
                 std::shared_ptr<ngraph::op::v0::Parameter> get_parameter(size_t index) const;
                 std::shared_ptr<ngraph::op::v0::Result> get_result(size_t index) const;
+                VariableState* find_variable(const std::string& variable_id,
+                                             const std::shared_ptr<runtime::Tensor>& tensor);
 
                 std::shared_ptr<CPU_ExternalFunction> m_external_function;
                 std::shared_ptr<CPU_CallFrame> m_call_frame;
+                std::unique_ptr<CPUSaveData> m_save_data;
             };
         }
     }
@@ -14,12 +14,15 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <thread>
 
 #include "cpu_executor.hpp"
 
+#include "ngraph/check.hpp"
 #include "ngraph/env_util.hpp"
 #include "ngraph/except.hpp"
+#include "ngraph/runtime/cpu/cpu_numa.hpp"
 
 #define MAX_PARALLELISM_THRESHOLD 2
 
@@ -76,47 +79,245 @@ namespace ngraph
         {
             namespace executor
             {
+                // Eigen thread environment whose threads only run on a set of CPUs, such as
+                // those of one NUMA node
+                struct PinnedThreadEnvironment : public Eigen::StlThreadEnvironment
+                {
+                    explicit PinnedThreadEnvironment(const std::vector<int>& pinned_cpus)
+                        : cpus(pinned_cpus)
+                    {
+                    }
+
+                    EnvThread* CreateThread(std::function<void()> f)
+                    {
+                        std::vector<int> thread_cpus = cpus;
+                        return new EnvThread([thread_cpus, f]() {
+                            numa::bind_current_thread_to_cpus(thread_cpus);
+                            f();
+                        });
+                    }
+
+                    std::vector<int> cpus;
+                };
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+                // Runs the parallel regions of DNNL primitives on an Eigen thread pool, so
+                // they share threads with the Eigen kernels instead of an OpenMP runtime
+                class DNNLThreadPool : public dnnl::threadpool_iface
+                {
+                public:
+                    explicit DNNLThreadPool(Eigen::ThreadPoolInterface* pool)
+                        : m_pool(pool)
+                    {
+                    }
+
+                    int get_num_threads() const override { return m_pool->NumThreads(); }
+                    // DNNL runs nested regions sequentially, so a pool thread never waits on
+                    // work queued behind it
+                    bool get_in_parallel() const override
+                    {
+                        return m_pool->CurrentThreadId() != -1;
+                    }
+                    uint64_t get_flags() const override { return 0; }
+                    void parallel_for(int n, const std::function<void(int, int)>& fn) override
+                    {
+                        if (n <= 0)
+                        {
+                            return;
+                        }
+                        Eigen::Barrier barrier(static_cast<unsigned int>(n - 1));
+                        for (int i = 1; i < n; i++)
+                        {
+                            m_pool->Schedule([i, n, &fn, &barrier]() {
+                                fn(i, n);
+                                barrier.Notify();
+                            });
+                        }
+                        fn(0, n);
+                        barrier.Wait();
+                    }
+
+                private:
+                    Eigen::ThreadPoolInterface* m_pool;
+                };
+#endif
+
                 CPUExecutor::CPUExecutor(int num_thread_pools)
                     : m_num_thread_pools(num_thread_pools)
                 {
                     m_num_cores = GetNumCores();
-                    for (int i = 0; i < num_thread_pools; i++)
+                    m_num_numa_nodes = numa::get_node_count();
+                    for (auto& count : m_running_calls)
                     {
-                        int num_threads_per_pool;
+                        count.store(0);
+                    }
 
-                        // Eigen threadpool will still be used for reductions
-                        // and other tensor operations that dont use a parallelFor
-                        num_threads_per_pool = GetNumCores();
+                    // Eigen threadpool will still be used for reductions
+                    // and other tensor operations that dont use a parallelFor
+                    m_num_threads_per_pool = GetNumCores();
 
-                        // User override
-                        int32_t eigen_tp_count =
-                            ngraph::getenv_int("NGRAPH_CPU_EIGEN_THREAD_COUNT");
-                        if (eigen_tp_count > 0)
+                    // User override
+                    int32_t eigen_tp_count = ngraph::getenv_int("NGRAPH_CPU_EIGEN_THREAD_COUNT");
+                    if (eigen_tp_count > 0)
+                    {
+                        const int tp_count = eigen_tp_count;
+                        if (tp_count < 1 || tp_count > GetNumCores())
                         {
-                            const int tp_count = eigen_tp_count;
-                            if (tp_count < 1 || tp_count > GetNumCores())
-                            {
-                                throw ngraph_error(
-                                    "Unexpected value specified for NGRAPH_CPU_EIGEN_THREAD_COUNT "
-                                    "(" +
-                                    std::to_string(eigen_tp_count) +
-                                    "). Please specify a value in range [1-" +
-                                    std::to_string(GetNumCores()) + "]");
-                            }
-                            num_threads_per_pool = tp_count;
+                            throw ngraph_error(
+                                "Unexpected value specified for NGRAPH_CPU_EIGEN_THREAD_COUNT "
+                                "(" +
+                                std::to_string(eigen_tp_count) +
+                                "). Please specify a value in range [1-" +
+                                std::to_string(GetNumCores()) + "]");
                         }
+                        m_num_threads_per_pool = tp_count;
+                    }
 
-                        m_thread_pools.push_back(std::unique_ptr<Eigen::ThreadPool>(
-                            new Eigen::ThreadPool(num_threads_per_pool)));
-                        m_thread_pool_devices.push_back(
-                            std::unique_ptr<Eigen::ThreadPoolDevice>(new Eigen::ThreadPoolDevice(
-                                m_thread_pools[i].get(), num_threads_per_pool)));
+                    // NUMA and CPU set pools are created on demand in the slots after the
+                    // regular pools and the inline device, so the vectors never reallocate
+                    // while get_device is being called
+                    size_t slots = get_inline_arena() + 1 + max_cpu_set_arenas;
+                    m_thread_pools.resize(slots);
+                    m_thread_pool_devices.resize(slots);
+                    for (int i = 0; i < num_thread_pools; i++)
+                    {
+#if defined(NGRAPH_CPU_SHARED_THREADPOOL_ENABLE)
+                        // The inter-op arenas queue their work on one pool, so running them
+                        // concurrently does not start more threads than there are cores
+                        if (i > 0)
+                        {
+                            m_thread_pool_devices[i].reset(new Eigen::ThreadPoolDevice(
+                                m_thread_pools[0].get(), m_num_threads_per_pool));
+                            continue;
+                        }
+#endif
+                        m_thread_pools[i].reset(new Eigen::ThreadPool(m_num_threads_per_pool));
+                        m_thread_pool_devices[i].reset(new Eigen::ThreadPoolDevice(
+                            m_thread_pools[i].get(), m_num_threads_per_pool));
+                    }
+                    m_thread_pool_devices[get_inline_arena()].reset(
+                        new Eigen::ThreadPoolDevice(m_thread_pools[0].get(), 1));
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+                    m_dnnl_thread_pool.reset(new DNNLThreadPool(m_thread_pools[0].get()));
+#endif
 #if defined(NGRAPH_TBB_ENABLE)
+                    for (size_t i = 0; i < slots; i++)
+                    {
                         m_tbb_arenas.emplace_back(1);
+                    }
 #endif
+                }
+
+                int CPUExecutor::get_numa_arena(int node)
+                {
+                    NGRAPH_CHECK(node >= 0 && node < m_num_numa_nodes,
+                                 "NUMA node ",
+                                 node,
+                                 " out of range [0-",
+                                 m_num_numa_nodes - 1,
+                                 "]");
+                    int id = m_num_thread_pools + node;
+                    std::lock_guard<std::mutex> lock(m_arena_mutex);
+                    if (!m_thread_pool_devices[id])
+                    {
+                        int num_threads = m_num_threads_per_pool;
+                        int node_cpus = static_cast<int>(numa::get_node_cpus(node).size());
+                        if (node_cpus > 0 && node_cpus < num_threads)
+                        {
+                            num_threads = node_cpus;
+                        }
+                        m_thread_pools[id].reset(
+                            new Eigen::ThreadPoolTempl<PinnedThreadEnvironment>(
+                                num_threads, PinnedThreadEnvironment(numa::get_node_cpus(node))));
+                        m_thread_pool_devices[id].reset(
+                            new Eigen::ThreadPoolDevice(m_thread_pools[id].get(), num_threads));
+                    }
+                    return id;
+                }
+
+                int CPUExecutor::get_cpu_set_arena(const std::vector<int>& cpus)
+                {
+                    NGRAPH_CHECK(!cpus.empty(), "Empty CPU set");
+                    std::vector<int> key = cpus;
+                    std::sort(key.begin(), key.end());
+                    key.erase(std::unique(key.begin(), key.end()), key.end());
+                    std::lock_guard<std::mutex> lock(m_arena_mutex);
+                    auto it = m_cpu_set_arenas.find(key);
+                    if (it != m_cpu_set_arenas.end())
+                    {
+                        return it->second;
+                    }
+                    const int count = static_cast<int>(m_cpu_set_arenas.size());
+                    const int max_count = max_cpu_set_arenas;
+                    NGRAPH_CHECK(
+                        count < max_count, "At most ", max_count, " CPU sets can have arenas");
+                    int id = get_inline_arena() + 1 + count;
+                    int num_threads = static_cast<int>(key.size());
+                    m_thread_pools[id].reset(new Eigen::ThreadPoolTempl<PinnedThreadEnvironment>(
+                        num_threads, PinnedThreadEnvironment(key)));
+                    m_thread_pool_devices[id].reset(
+                        new Eigen::ThreadPoolDevice(m_thread_pools[id].get(), num_threads));
+                    m_cpu_set_arenas[key] = id;
+                    return id;
+                }
+
+                void CPUExecutor::schedule_call(std::function<void()> task)
+                {
+                    std::call_once(m_call_pool_once, [this]() {
+                        m_call_pool.reset(new Eigen::ThreadPool(m_num_thread_pools));
+                    });
+                    m_call_pool->Schedule(std::move(task));
+                }
+
+                void CPUExecutor::begin_call(CallPriority priority)
+                {
+                    m_running_calls[static_cast<int>(priority)].fetch_add(1);
+                }
+
+                void CPUExecutor::end_call(CallPriority priority)
+                {
+                    if (m_running_calls[static_cast<int>(priority)].fetch_sub(1) == 1)
+                    {
+                        // Taking the lock orders the wake-up after a waiter's last check
+                        std::lock_guard<std::mutex> lock(m_priority_mutex);
+                        m_priority_changed.notify_all();
                     }
                 }
 
+                void CPUExecutor::yield_to_higher_priority(CallPriority priority)
+                {
+                    auto outranked = [this, priority]() {
+                        for (int p = static_cast<int>(priority) + 1;
+                             p <= static_cast<int>(CallPriority::High);
+                             p++)
+                        {
+                            if (m_running_calls[p].load(std::memory_order_relaxed) > 0)
+                            {
+                                return true;
+                            }
+                        }
+                        return false;
+                    };
+                    if (!outranked())
+                    {
+                        return;
+                    }
+                    std::unique_lock<std::mutex> lock(m_priority_mutex);
+                    m_priority_changed.wait(lock, [&outranked]() { return !outranked(); });
+                }
+
+                dnnl::stream CPUExecutor::create_dnnl_stream()
+                {
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+                    dnnl::stream_attr attr(dnnl::engine::kind::cpu);
+                    attr.set_threadpool(m_dnnl_thread_pool.get());
+                    return dnnl::stream(
+                        get_cpu_engine(), dnnl::stream::flags::default_flags, attr);
+#else
+                    return dnnl::stream(get_cpu_engine());
+#endif
+                }
+
 #if defined(NGRAPH_TBB_ENABLE)
                 void CPUExecutor::execute(CPUKernelFunctor& f,
                                           CPURuntimeContext* ctx,
@@ -148,7 +349,12 @@ namespace ngraph
                     static CPUExecutor cpu_executor(num_thread_pools < 1 ? 1 : num_thread_pools);
                     return cpu_executor;
                 }
-                dnnl::engine global_cpu_engine(dnnl::engine::kind::cpu, 0);
+
+                dnnl::engine& get_cpu_engine()
+                {
+                    static dnnl::engine cpu_engine(dnnl::engine::kind::cpu, 0);
+                    return cpu_engine;
+                }
             }
         }
     }
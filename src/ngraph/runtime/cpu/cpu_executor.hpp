@@ -16,8 +16,13 @@
 
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
 #include <functional>
+#include <map>
+#include <mutex>
 #include <thread>
+#include <vector>
 
 #include <dnnl.hpp>
 
@@ -38,7 +43,9 @@ namespace ngraph
         {
             namespace executor
             {
-                extern dnnl::engine global_cpu_engine;
+                /// \brief The DNNL engine of the backend, created on first use rather than when
+                ///        the backend is loaded
+                dnnl::engine& get_cpu_engine();
 
                 // CPUExecutor owns the resources for executing a graph.
                 class CPUExecutor
@@ -51,6 +58,28 @@ namespace ngraph
                         return *m_thread_pool_devices[id].get();
                     }
 
+                    /// \brief Returns the arena whose threads are bound to the CPUs of NUMA
+                    ///        node `node`, creating its thread pool on first use.
+                    ///
+                    /// The returned id can be used as CPUExecutionContext::arena. NUMA arenas
+                    /// follow the get_num_thread_pools() regular ones.
+                    int get_numa_arena(int node);
+
+                    /// \brief Returns the arena of a single-thread device over the first thread
+                    ///        pool. Kernels given this arena run on the calling thread, as Eigen
+                    ///        and parallelFor evaluate inline when there is one thread.
+                    int get_inline_arena() { return m_num_thread_pools + m_num_numa_nodes; }
+
+                    /// \brief Returns the arena with one thread bound to each CPU of `cpus`,
+                    ///        creating its thread pool on first use.
+                    ///
+                    /// Executables given the same CPU set share the arena and no other
+                    /// executable runs on its threads. At most max_cpu_set_arenas different
+                    /// sets can be used.
+                    int get_cpu_set_arena(const std::vector<int>& cpus);
+
+                    static constexpr int max_cpu_set_arenas = 64;
+
 #if defined(NGRAPH_TBB_ENABLE)
                     void execute(CPUKernelFunctor& f,
                                  CPURuntimeContext* ctx,
@@ -61,17 +90,50 @@ namespace ngraph
                                  CPURuntimeContext* ctx,
                                  CPUExecutionContext* ectx);
 #endif
+                    /// \brief Runs `task` on the pool dedicated to asynchronous calls. The pool
+                    ///        has one thread per inter-op thread pool and is created on first
+                    ///        use; its threads only dispatch calls, kernels still run on the
+                    ///        regular pools.
+                    void schedule_call(std::function<void()> task);
+
+                    /// \brief Returns a stream to execute DNNL primitives on. When DNNL is built
+                    ///        with its threadpool runtime the primitives run on the threads of
+                    ///        the first thread pool, otherwise on DNNL's own threads.
+                    dnnl::stream create_dnnl_stream();
+
+                    /// \brief Registers a call of `priority` as running until end_call().
+                    void begin_call(CallPriority priority);
+                    void end_call(CallPriority priority);
+                    /// \brief Blocks while calls of a higher priority are running. Calls
+                    ///        check between ops, so lower priority work sharing the thread
+                    ///        pools gives way to urgent calls at op granularity.
+                    void yield_to_higher_priority(CallPriority priority);
+
                     int get_num_thread_pools() { return m_num_thread_pools; }
                     int get_num_cores() { return m_num_cores; }
+                    int get_num_numa_nodes() { return m_num_numa_nodes; }
 
                 private:
-                    std::vector<std::unique_ptr<Eigen::ThreadPool>> m_thread_pools;
+                    std::vector<std::unique_ptr<Eigen::ThreadPoolInterface>> m_thread_pools;
                     std::vector<std::unique_ptr<Eigen::ThreadPoolDevice>> m_thread_pool_devices;
 #if defined(NGRAPH_TBB_ENABLE)
                     std::vector<tbb::task_arena> m_tbb_arenas;
 #endif
                     int m_num_thread_pools;
                     int m_num_cores;
+                    int m_num_threads_per_pool;
+                    int m_num_numa_nodes;
+                    std::mutex m_arena_mutex;
+                    std::map<std::vector<int>, int> m_cpu_set_arenas;
+                    std::unique_ptr<Eigen::ThreadPoolInterface> m_call_pool;
+                    std::once_flag m_call_pool_once;
+                    /// Number of running calls of each priority
+                    std::atomic<int> m_running_calls[3];
+                    std::mutex m_priority_mutex;
+                    std::condition_variable m_priority_changed;
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
+                    std::unique_ptr<dnnl::threadpool_iface> m_dnnl_thread_pool;
+#endif
                 };
 
                 extern CPUExecutor& GetCPUExecutor();
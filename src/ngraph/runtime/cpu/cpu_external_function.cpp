@@ -14,10 +14,18 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <cstdlib>
 #include <fstream>
+#include <iterator>
+#include <limits>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <set>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <typeindex>
 #include <typeinfo>
@@ -39,6 +47,7 @@
 #include "contrib/mlir/core/pass/mlir_subgraph_extraction.hpp"
 #endif
 
+#include "ngraph/chrome_trace.hpp"
 #include "ngraph/descriptor/input.hpp"
 #include "ngraph/descriptor/output.hpp"
 #include "ngraph/env_util.hpp"
@@ -91,7 +100,9 @@
 #include "ngraph/op/gemm.hpp"
 #include "ngraph/op/greater.hpp"
 #include "ngraph/op/greater_equal.hpp"
+#include "ngraph/op/grn.hpp"
 #include "ngraph/op/group_conv.hpp"
+#include "ngraph/op/layer_norm.hpp"
 #include "ngraph/op/less.hpp"
 #include "ngraph/op/less_equal.hpp"
 #include "ngraph/op/log.hpp"
@@ -108,13 +119,16 @@
 #include "ngraph/op/min.hpp"
 #include "ngraph/op/minimum.hpp"
 #include "ngraph/op/multiply.hpp"
+#include "ngraph/op/mvn.hpp"
 #include "ngraph/op/negative.hpp"
+#include "ngraph/op/normalize_l2.hpp"
 #include "ngraph/op/not_equal.hpp"
 #include "ngraph/op/one_hot.hpp"
 #include "ngraph/op/op.hpp"
 #include "ngraph/op/pad.hpp"
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/op/power.hpp"
+#include "ngraph/op/prelu.hpp"
 #include "ngraph/op/product.hpp"
 #include "ngraph/op/quantize.hpp"
 #include "ngraph/op/quantized_convolution.hpp"
@@ -126,6 +140,7 @@
 #include "ngraph/op/reverse.hpp"
 #include "ngraph/op/reverse_sequence.hpp"
 #include "ngraph/op/scatter_add.hpp"
+#include "ngraph/op/scatter_nd.hpp"
 #include "ngraph/op/scatter_nd_add.hpp"
 #include "ngraph/op/select.hpp"
 #include "ngraph/op/sigmoid.hpp"
@@ -136,6 +151,7 @@
 #include "ngraph/op/softmax.hpp"
 #include "ngraph/op/softmax_crossentropy.hpp"
 #include "ngraph/op/sqrt.hpp"
+#include "ngraph/op/squared_difference.hpp"
 #include "ngraph/op/subtract.hpp"
 #include "ngraph/op/sum.hpp"
 #include "ngraph/op/tan.hpp"
@@ -158,19 +174,26 @@
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/memory_layout.hpp"
 #include "ngraph/pass/nop_elimination.hpp"
+#include "ngraph/pass/pass_util.hpp"
 #include "ngraph/pass/propagate_cacheability.hpp"
+#include "ngraph/pass/quantized_op_fusion.hpp"
 #include "ngraph/pass/reshape_elimination.hpp"
 #include "ngraph/pass/reshape_sinking.hpp"
+#include "ngraph/pass/transpose_sinking_v1.hpp"
 #include "ngraph/pass/zero_dim_tensor_elimination.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/cpu_builder_registry.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/runtime/cpu/cpu_cancellation.hpp"
+#include "ngraph/runtime/cpu/cpu_compile_cache.hpp"
 #include "ngraph/runtime/cpu/cpu_cse.hpp"
 #include "ngraph/runtime/cpu/cpu_emitter.hpp"
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
+#include "ngraph/runtime/cpu/cpu_hw_counters.hpp"
+#include "ngraph/runtime/cpu/cpu_input_release.hpp"
 #include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor.hpp"
 #include "ngraph/runtime/cpu/cpu_tracing.hpp"
@@ -194,18 +217,29 @@
 #include "ngraph/runtime/cpu/op/rnn.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
 #include "ngraph/runtime/cpu/op/update_slice.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_allreduce_bucketing.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_assignment.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_async_transfers.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_attention_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_collapse_dims.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_compressed_weights_fusion.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_constant_interning.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_dnnl_primitive_build.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_elementwise_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_horizontal_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_layout.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_mat_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_memory_assignment.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_memory_optimization.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_optimizer_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_post_layout_optimizations.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_preprocess_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_rnn_fusion.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_rnn_lowering.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_sparse_weights_conversion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_workspace_insertion.hpp"
+#include "ngraph/runtime/huge_page_allocator.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -255,6 +289,14 @@ runtime::cpu::CPU_ExternalFunction::CPU_ExternalFunction(
     , m_function_name(function->get_name())
     , m_is_built(false)
     , m_execution_mode(mode)
+    , m_numa_node(-1)
+    , m_own_arena(false)
+    , m_arena(0)
+    , m_defer_primitive_build(getenv_bool("NGRAPH_CPU_DEFER_PRIMITIVE_BUILD"))
+    , m_decompose_fused_ops(getenv_bool("NGRAPH_CPU_DECOMPOSE_FUSED_OPS"))
+    , m_prefault_memory(getenv_bool("NGRAPH_CPU_PREFAULT"))
+    , m_inter_op(true)
+    , m_concurrency(0)
 {
 }
 
@@ -274,6 +316,22 @@ public:
 
 static const string s_debug_dir = "cpu_codegen";
 
+// Functions with fewer ops than this per compile thread are emitted as a single translation unit
+static const size_t s_min_ops_per_codegen_part = 64;
+
+// Args of the trace event of an op, which tell which context and arena it ran on. The thread is
+// the tid of the event.
+static string op_event_args(const runtime::cpu::CPURuntimeContext* ctx,
+                            const runtime::cpu::CPUExecutionContext& ectx)
+{
+    if (!event::Manager::is_tracing_enabled())
+    {
+        return "";
+    }
+    return R"({"context":)" + to_string(ctx->context_index) + R"(,"arena":)" +
+           to_string(ectx.arena) + "}";
+}
+
 #if defined(CODEGEN_ENABLE)
 
 static string emit_string_array(const vector<string>& s, size_t max_line_length)
@@ -504,6 +562,7 @@ void runtime::cpu::CPU_ExternalFunction::compile(ngraph::pass::PassConfig& pass_
         return;
     }
 
+    register_builders();
     m_dnnl_emitter.reset(new DNNLEmitter());
 
     ngraph::pass::Manager pass_manager;
@@ -523,6 +582,14 @@ void runtime::cpu::CPU_ExternalFunction::compile(ngraph::pass::PassConfig& pass_
         femitter, node_function_map, common_function_string);
     pass_manager.run_passes(m_function);
 
+    m_dnnl_descriptors.clear();
+    if (m_dnnl_emitter->get_dnnl_descriptors_size() > 0)
+    {
+        ifstream desc_file(m_desc_filename, ios::binary);
+        m_dnnl_descriptors.assign(istreambuf_iterator<char>(desc_file),
+                                  istreambuf_iterator<char>());
+    }
+
     for (shared_ptr<Node> op : m_function->get_ordered_ops())
     {
         NGRAPH_INFO << *op;
@@ -683,17 +750,23 @@ using namespace ngraph;
         writer << "\n";
     }
 
+    // Constant addresses are bound at load time rather than emitted into the source so that the
+    // generated code, and so its object file, does not change from one process to the next.
+    // The declarations up to the entry point are repeated in each translation unit.
+    size_t declarations_begin = writer.get_code().size();
     writer << "// Declare all constants\n";
+    CodeWriter bind_constants;
     for (shared_ptr<Node> node : ordered_ops)
     {
         ngraph::op::v0::Constant* c = as_type<ngraph::op::v0::Constant>(node.get());
         if (c)
         {
-            m_active_constants.push_back(node);
             const descriptor::Tensor& tv = node->get_output_tensor(0);
             string type = tv.get_element_type().c_type_string();
-            writer << "static " << type << "* " << tv.get_name() << " = ((" << type << "*)("
-                   << c->get_data_ptr() << "));\n";
+            writer << "static " << type << "* " << tv.get_name() << " = nullptr;\n";
+            bind_constants << tv.get_name() << " = static_cast<" << type << "*>(constants["
+                           << m_active_constants.size() << "]);\n";
+            m_active_constants.push_back(node);
 
             auto output_tensor = &node->get_output_tensor(0);
             auto tensor_set = get_tensor_set(output_tensor);
@@ -744,6 +817,19 @@ using namespace ngraph;
     writer.block_end();
     writer.block_end();
     writer << "\n";
+    string declarations = writer.get_code().substr(declarations_begin);
+
+    // Defined once, in the translation unit of the entry point
+    writer << "extern \"C\" CPURuntimeContextCG* init_cg_ctx()\n";
+    writer.block_begin();
+    writer << "return new CPURuntimeContextCG;\n";
+    writer.block_end();
+    writer << "\n";
+    writer << "extern \"C\" void destroy_cg_ctx(CPURuntimeContextCG* cg_ctx)\n";
+    writer.block_begin();
+    writer << "delete cg_ctx;\n";
+    writer.block_end();
+    writer << "\n";
 
     set<string> output_names;
     for (shared_ptr<Node> op : m_function->get_results())
@@ -790,6 +876,52 @@ using namespace ngraph;
         }
     }
 
+    auto emit_bind_constants = [&bind_constants](CodeWriter& w, const string& name) {
+        w << "\nextern \"C\" void " << name << "_bind_constants(void** constants)\n";
+        w.block_begin();
+        w << bind_constants.get_code();
+        w.block_end();
+        w << "\n";
+    };
+    emit_bind_constants(writer, m_function->get_name());
+
+    // Large functions are split into parts that are compiled concurrently as separate
+    // translation units. Timing, tracing and the TBB flow graph keep state in locals of the
+    // entry point so they need a single translation unit.
+    size_t compile_threads = static_cast<size_t>(std::max<int32_t>(
+        1,
+        getenv_int("NGRAPH_CPU_CODEGEN_COMPILE_THREADS",
+                   static_cast<int32_t>(std::thread::hardware_concurrency()))));
+    size_t op_count = 0;
+    for (shared_ptr<Node> node : ordered_ops)
+    {
+        if (!node->is_parameter() && !node->is_constant())
+        {
+            op_count++;
+        }
+    }
+    size_t part_count = 1;
+    if (!m_emit_timing && !runtime::cpu::IsTracingEnabled())
+    {
+        part_count = std::max<size_t>(
+            1, std::min(compile_threads, op_count / s_min_ops_per_codegen_part));
+    }
+#if defined(NGRAPH_TBB_ENABLE)
+    if (m_use_tbb)
+    {
+        part_count = 1;
+    }
+#endif
+    const char* part_params =
+        "(void** inputs, void** outputs, cpu::CPURuntimeContext* ctx, CPURuntimeContextCG* cg_ctx, "
+        "size_t pool_base_ptr, bool* t_en)";
+    vector<string> part_names;
+    for (size_t i = 0; part_count > 1 && i < part_count; ++i)
+    {
+        part_names.push_back(m_function->get_name() + "_part" + to_string(i));
+        writer << "extern \"C\" void " << part_names.back() << part_params << ";\n";
+    }
+
     writer << "bool " << m_function->get_name() << "_t_en[" << tensor_index << "];\n";
 
     writer << "extern \"C\" void " << m_function->get_name() << func_params << "\n";
@@ -900,8 +1032,22 @@ using namespace ngraph;
         }
     }
 
+    // Offsets into the generated code where each part starts and, at the back, where the last
+    // one ends
+    vector<size_t> part_offsets;
+    size_t op_index = 0;
     for (shared_ptr<Node> node : ordered_ops)
     {
+        if (part_names.size() > part_offsets.size() &&
+            op_index * part_count / op_count >= part_offsets.size())
+        {
+            part_offsets.push_back(writer.get_code().size());
+        }
+        if (!node->is_parameter() && !node->is_constant())
+        {
+            op_index++;
+        }
+
         auto& n = *node; // Work around a compiler warning (*node inside typeid may have effects
         // with shared pointers, which is fine here but clang doesn't like it.)
         auto handler = dispatcher.find(type_index(typeid(n)));
@@ -1083,6 +1229,8 @@ using namespace ngraph;
         }
     }
 
+    part_offsets.push_back(writer.get_code().size());
+
 #if defined(NGRAPH_TBB_ENABLE)
     if (m_use_tbb)
     {
@@ -1126,25 +1274,136 @@ using namespace ngraph;
     // End generated function
     writer += "}\n\n";
 
-    // TODO: Cleanup and make this a utility function
-    string filename = file_util::path_join(s_debug_dir, m_function_name + "_codegen.cpp");
     string code = writer.get_code();
-    runtime::cpu::CPU_ExternalFunction::write_to_file(writer.get_code(), s_debug_dir, filename);
 
-    m_compiler.reset(new codegen::Compiler());
+    // Move the code of each part out of the entry point into its own translation unit and call
+    // it from there instead
+    vector<string> sources;
+    if (!part_names.empty())
+    {
+        CodeWriter calls;
+        calls.indent = 1;
+        for (size_t i = 0; i < part_names.size(); ++i)
+        {
+            calls << part_names[i] << "(inputs, outputs, ctx, cg_ctx, "
+                  << (temporaries_used ? "pool_base_ptr" : "0") << ", t_en);\n";
+
+            CodeWriter part;
+            part += pch_header_source;
+            part += declarations;
+            emit_bind_constants(part, part_names[i]);
+            part << "extern \"C\" void " << part_names[i] << part_params << "\n{\n";
+            part += code.substr(part_offsets[i], part_offsets[i + 1] - part_offsets[i]);
+            part << "}\n";
+            sources.push_back(part.get_code());
+        }
+        code = code.substr(0, part_offsets.front()) + calls.get_code() +
+               code.substr(part_offsets.back());
+    }
+    sources.insert(sources.begin(), code);
+
+    // TODO: Cleanup and make this a utility function
+    m_codegen_sources.clear();
+    for (size_t i = 0; i < sources.size(); ++i)
+    {
+        string source_name = (i == 0 ? m_function_name : part_names[i - 1]);
+        runtime::cpu::CPU_ExternalFunction::write_to_file(
+            sources[i],
+            s_debug_dir,
+            file_util::path_join(s_debug_dir, source_name + "_codegen.cpp"));
+        m_codegen_sources.emplace_back(source_name, sources[i]);
+    }
+
     m_execution_engine.reset(new codegen::ExecutionEngine());
 
-    m_compiler->set_precompiled_header_source(pch_header_source);
+    // Object files are keyed by the emitted source, so any change to the function, the passes
+    // or the emitters results in a new entry. The names in the source are numbered per process,
+    // so cached sources are compiled with canonical names instead, for an identically built
+    // function to find them.
+    vector<string> object_files(sources.size());
+    string entry_name = m_function_name;
+    auto cache_dir = get_compile_cache_dir();
+    if (!cache_dir.empty())
+    {
+        auto names = get_canonical_names(*m_function, "cg_function");
+        for (auto& source : sources)
+        {
+            source = replace_names(source, names);
+        }
+        for (auto& part_name : part_names)
+        {
+            part_name = replace_names(part_name, names);
+        }
+        entry_name = replace_names(m_function_name, names);
+        for (size_t i = 0; i < sources.size(); ++i)
+        {
+            auto key = compute_codegen_cache_key(pch_header_source + sources[i],
+                                                 codegen::ExecutionEngine::get_host_cpu_name());
+            object_files[i] = file_util::path_join(cache_dir, "codegen_" + key + ".o");
+        }
+    }
 
-    auto codegen_module = m_compiler->compile(code);
+    vector<size_t> uncached;
+    for (size_t i = 0; i < sources.size(); ++i)
+    {
+        if (!object_files[i].empty() && file_util::exists(object_files[i]) &&
+            m_execution_engine->add_object_file(object_files[i]))
+        {
+            NGRAPH_DEBUG << "Loaded " << m_function_name << " from " << object_files[i];
+        }
+        else
+        {
+            uncached.push_back(i);
+        }
+    }
 
-    if (codegen_module == nullptr)
+    if (!uncached.empty())
     {
-        throw runtime_error("function failed to compile");
+        m_compiler.reset(new codegen::Compiler());
+        m_compiler->set_precompiled_header_source(pch_header_source);
+
+        vector<string> uncached_sources;
+        for (size_t i : uncached)
+        {
+            uncached_sources.push_back(sources[i]);
+        }
+        auto codegen_modules = m_compiler->compile(uncached_sources, compile_threads);
+
+        for (size_t i = 0; i < uncached.size(); ++i)
+        {
+            if (codegen_modules[i] == nullptr)
+            {
+                throw runtime_error("function failed to compile");
+            }
+            const string& object_file = object_files[uncached[i]];
+            if (!object_file.empty())
+            {
+                file_util::make_directory(cache_dir);
+                m_execution_engine->set_object_file_path(object_file);
+            }
+            m_execution_engine->add_module(codegen_modules[i]);
+        }
     }
-    m_execution_engine->add_module(codegen_module);
     m_execution_engine->finalize();
 
+    vector<void*> constant_ptrs;
+    for (auto& node : m_active_constants)
+    {
+        constant_ptrs.push_back(const_cast<void*>(
+            static_pointer_cast<ngraph::op::v0::Constant>(node)->get_data_ptr()));
+    }
+    part_names.push_back(entry_name);
+    for (const string& name : part_names)
+    {
+        auto bind_constants_func =
+            m_execution_engine->find_function<void(void**)>(name + "_bind_constants");
+        if (bind_constants_func == nullptr)
+        {
+            throw runtime_error("could not find compiled bind constants function");
+        }
+        bind_constants_func(constant_ptrs.data());
+    }
+
     m_compiled_init_ctx_func = m_execution_engine->find_function<InitContextFuncTy>("init_cg_ctx");
 
     if (m_compiled_init_ctx_func == nullptr)
@@ -1160,7 +1419,7 @@ using namespace ngraph;
         throw runtime_error("could not find compiled destroy context function");
     }
 
-    m_compiled_function = m_execution_engine->find_function<EntryPointTy>(m_function_name);
+    m_compiled_function = m_execution_engine->find_function<EntryPointTy>(entry_name);
 
     if (m_compiled_function == nullptr)
     {
@@ -1210,6 +1469,357 @@ using namespace ngraph;
     }
 }
 
+// The library runs the generated code on a context of its own, so it needs the runtime libraries
+// the code calls into but not the JIT. Its constants are mapped from a file written next to it,
+// in the order the bind_constants functions expect them.
+void runtime::cpu::CPU_ExternalFunction::export_library(const string& directory) const
+{
+    if (!m_is_compiled)
+    {
+        throw ngraph_error("Only functions compiled to code can be exported");
+    }
+    if (m_emit_timing || runtime::cpu::IsTracingEnabled())
+    {
+        throw ngraph_error("Functions compiled with timing or tracing can not be exported");
+    }
+    if (!m_states.empty())
+    {
+        throw ngraph_error("Functions with random number generator states can not be exported");
+    }
+    const string& name = m_function_name;
+    file_util::make_directory(directory);
+
+    // Constants are aligned for the vector loads of the kernels
+    const size_t alignment = 64;
+    vector<size_t> constant_offsets;
+    size_t weights_size = 0;
+    {
+        string path = file_util::path_join(directory, name + ".weights");
+        ofstream weights(path, ios::binary);
+        for (auto& node : m_active_constants)
+        {
+            auto constant = static_pointer_cast<ngraph::op::v0::Constant>(node);
+            const descriptor::Tensor& tensor = constant->get_output_tensor(0);
+            auto layout = dynamic_pointer_cast<runtime::cpu::LayoutDescriptor>(
+                tensor.get_tensor_layout());
+            size_t bytes = layout && layout->is_dnnl_layout()
+                               ? tensor.size()
+                               : ngraph::pass::constant_byte_size(*constant);
+            size_t offset = (weights_size + alignment - 1) / alignment * alignment;
+            weights << string(offset - weights_size, '\0');
+            weights.write(static_cast<const char*>(constant->get_data_ptr()), bytes);
+            constant_offsets.push_back(offset);
+            weights_size = offset + bytes;
+        }
+        if (!weights)
+        {
+            throw ngraph_error("Failed to write " + path);
+        }
+    }
+    if (!m_dnnl_descriptors.empty())
+    {
+        ofstream desc_file(file_util::path_join(directory, name + ".desc"), ios::binary);
+        desc_file << m_dnnl_descriptors;
+    }
+
+    // The entry point reads the DNNL descriptors from the directory the library was created
+    // with rather than the working directory, and __dso_handle is the linker's
+    auto replace = [](string& code, const string& from, const string& to) {
+        size_t pos = code.find(from);
+        if (pos != string::npos)
+        {
+            code.replace(pos, from.size(), to);
+        }
+    };
+    vector<string> source_files;
+    for (auto& source : m_codegen_sources)
+    {
+        string code = source.second;
+        if (source.first == name)
+        {
+            replace(code,
+                    "void *__dso_handle = 0;\n",
+                    "extern \"C\" const char* " + name + "_desc_path();\n");
+            replace(code,
+                    "std::ifstream desc_file (\"" + m_desc_filename + "\"",
+                    "std::ifstream desc_file (" + name + "_desc_path()");
+        }
+        source_files.push_back(source.first + "_codegen.cpp");
+        ofstream out(file_util::path_join(directory, source_files.back()));
+        out << code;
+    }
+
+    CodeWriter header;
+    header << "// Generated by the nGraph CPU backend\n";
+    header << "#pragma once\n\n";
+    header << "#ifndef NGRAPH_AOT_API\n";
+    header << "#define NGRAPH_AOT_API __attribute__((visibility(\"default\")))\n";
+    header << "#endif\n\n";
+    header << "#ifdef __cplusplus\n";
+    header << "extern \"C\" {\n";
+    header << "#endif\n\n";
+    header << "typedef struct " << name << "_model " << name << "_model;\n\n";
+    header << "// Maps the constants from <directory>/" << name
+           << ".weights, shared by all the models\n";
+    header << "// of the library. Returns NULL on failure.\n";
+    header << "NGRAPH_AOT_API " << name << "_model* " << name
+           << "_create(const char* directory);\n";
+    header << "// Runs the function on the buffers of its " << parameter_layout_descriptors.size()
+           << " parameters and " << result_layout_descriptors.size() << " results, in order\n";
+    header << "// and in row-major layout. A model runs one call at a time. Returns 0 on "
+              "success.\n";
+    header << "NGRAPH_AOT_API int " << name << "_call(" << name
+           << "_model* model, void** inputs, void** outputs);\n";
+    header << "NGRAPH_AOT_API void " << name << "_destroy(" << name << "_model* model);\n\n";
+    header << "#ifdef __cplusplus\n";
+    header << "}\n";
+    header << "#endif\n";
+    ofstream(file_util::path_join(directory, name + "_aot.h")) << header.get_code();
+
+    auto join = [](const vector<size_t>& values) {
+        stringstream ss;
+        for (size_t value : values)
+        {
+            ss << value << ", ";
+        }
+        // Arrays may not be empty
+        ss << 0;
+        return ss.str();
+    };
+
+    CodeWriter entry;
+    entry << "// Generated by the nGraph CPU backend\n";
+#if defined(NGRAPH_TBB_ENABLE)
+    entry << "#define NGRAPH_TBB_ENABLE\n";
+#endif
+    entry << "#include <fcntl.h>\n";
+    entry << "#include <mutex>\n";
+    entry << "#include <string>\n";
+    entry << "#include <sys/mman.h>\n";
+    entry << "#include <sys/stat.h>\n";
+    entry << "#include <unistd.h>\n\n";
+    entry << "#include \"" << name << "_aot.h\"\n";
+    entry << "#include \"ngraph/distributed.hpp\"\n";
+    entry << "#include \"ngraph/runtime/aligned_buffer.hpp\"\n";
+    entry << "#include \"ngraph/runtime/cpu/cpu_runtime_context.hpp\"\n\n";
+    entry << "using namespace ngraph::runtime;\n\n";
+    entry << "struct CPURuntimeContextCG;\n";
+    entry << "extern \"C\" CPURuntimeContextCG* init_cg_ctx();\n";
+    entry << "extern \"C\" void destroy_cg_ctx(CPURuntimeContextCG* cg_ctx);\n";
+    entry << "extern \"C\" void " << name
+          << "(void** inputs, void** outputs, cpu::CPURuntimeContext* ctx, "
+             "CPURuntimeContextCG* cg_ctx);\n";
+    for (auto& source : m_codegen_sources)
+    {
+        entry << "extern \"C\" void " << source.first << "_bind_constants(void** constants);\n";
+    }
+    entry << "\n";
+    entry << "static const size_t s_weights_size = " << weights_size << ";\n";
+    entry << "static const size_t s_constant_count = " << constant_offsets.size() << ";\n";
+    entry << "static const size_t s_constant_offsets[] = {" << join(constant_offsets) << "};\n";
+    entry << "static const size_t s_memory_buffer_count = " << m_memory_buffer_sizes.size()
+          << ";\n";
+    entry << "static const size_t s_memory_buffer_sizes[] = {" << join(m_memory_buffer_sizes)
+          << "};\n";
+    entry << "static const size_t s_parameter_count = " << parameter_layout_descriptors.size()
+          << ";\n\n";
+    entry << "static std::mutex s_mutex;\n";
+    entry << "static size_t s_model_count = 0;\n";
+    entry << "static void* s_weights = nullptr;\n";
+    entry << "static std::string s_desc_path;\n\n";
+    entry << "extern \"C\" const char* " << name << "_desc_path()\n";
+    entry.block_begin();
+    entry << "return s_desc_path.c_str();\n";
+    entry.block_end();
+    entry << "\n";
+
+    entry << "struct " << name << "_model\n";
+    entry.block_begin();
+    entry << "cpu::CPURuntimeContext ctx;\n";
+    entry << "CPURuntimeContextCG* cg_ctx = nullptr;\n";
+    entry << "bool p_en[s_parameter_count + 1];\n\n";
+    entry << "~" << name << "_model()\n";
+    entry.block_begin();
+    entry << "if (cg_ctx)\n";
+    entry.block_begin();
+    entry << "destroy_cg_ctx(cg_ctx);\n";
+    entry.block_end();
+    entry << "for (auto buffer : ctx.memory_buffers)\n";
+    entry.block_begin();
+    entry << "delete buffer;\n";
+    entry.block_end();
+    entry.block_end();
+    entry.indent--;
+    entry << "};\n\n";
+
+    entry << "static bool map_weights(const std::string& directory)\n";
+    entry.block_begin();
+    entry << "std::string path = directory + \"/" << name << ".weights\";\n";
+    entry << "int fd = open(path.c_str(), O_RDONLY);\n";
+    entry << "if (fd < 0)\n";
+    entry.block_begin();
+    entry << "return false;\n";
+    entry.block_end();
+    entry << "struct stat st;\n";
+    entry << "void* weights = MAP_FAILED;\n";
+    entry << "if (fstat(fd, &st) == 0 && static_cast<size_t>(st.st_size) == s_weights_size)\n";
+    entry.block_begin();
+    entry << "weights = mmap(nullptr, s_weights_size, PROT_READ, MAP_PRIVATE, fd, 0);\n";
+    entry.block_end();
+    entry << "close(fd);\n";
+    entry << "if (weights == MAP_FAILED)\n";
+    entry.block_begin();
+    entry << "return false;\n";
+    entry.block_end();
+    entry << "s_weights = weights;\n";
+    entry << "void* constants[s_constant_count + 1];\n";
+    entry << "for (size_t i = 0; i < s_constant_count; i++)\n";
+    entry.block_begin();
+    entry << "constants[i] = static_cast<char*>(s_weights) + s_constant_offsets[i];\n";
+    entry.block_end();
+    for (auto& source : m_codegen_sources)
+    {
+        entry << source.first << "_bind_constants(constants);\n";
+    }
+    entry << "return true;\n";
+    entry.block_end();
+    entry << "\n";
+
+    entry << "static void release_weights()\n";
+    entry.block_begin();
+    entry << "if (--s_model_count == 0 && s_weights)\n";
+    entry.block_begin();
+    entry << "munmap(s_weights, s_weights_size);\n";
+    entry << "s_weights = nullptr;\n";
+    entry.block_end();
+    entry.block_end();
+    entry << "\n";
+
+    entry << name << "_model* " << name << "_create(const char* directory)\n";
+    entry.block_begin();
+    entry << "std::lock_guard<std::mutex> lock(s_mutex);\n";
+    entry << "if (s_model_count == 0)\n";
+    entry.block_begin();
+    entry << "s_desc_path = std::string(directory) + \"/" << name << ".desc\";\n";
+    entry << "if (s_weights_size > 0 && !map_weights(directory))\n";
+    entry.block_begin();
+    entry << "return nullptr;\n";
+    entry.block_end();
+    entry.block_end();
+    entry << "s_model_count++;\n";
+    entry << name << "_model* model = nullptr;\n";
+    entry << "try\n";
+    entry.block_begin();
+    entry << "model = new " << name << "_model;\n";
+    entry << "auto& ctx = model->ctx;\n";
+    entry << "ctx.op_durations = nullptr;\n";
+    entry << "ctx.op_counters = nullptr;\n";
+    entry << "ctx.p_en = model->p_en;\n";
+    entry << "for (size_t i = 0; i < s_parameter_count; i++)\n";
+    entry.block_begin();
+    entry << "ctx.p_en[i] = true;\n";
+    entry.block_end();
+    entry << "ctx.first_iteration = true;\n";
+    entry << "ctx.build_primitives_only = false;\n";
+    entry << "ctx.scratchpad_buffer = nullptr;\n";
+#if defined(NGRAPH_TBB_ENABLE)
+    entry << "ctx.G = nullptr;\n";
+    entry << "ctx.c = nullptr;\n";
+#endif
+    entry << "ctx.states = nullptr;\n";
+    entry << "ctx.pc = 0;\n";
+    entry << "ctx.context_index = 0;\n";
+    entry << "ctx.priority = cpu::CallPriority::Normal;\n";
+    entry << "ctx.cancellation = nullptr;\n";
+    entry << "ctx.input_release = nullptr;\n";
+    entry << "ctx.cancelled = false;\n";
+    entry << "for (size_t i = 0; i < s_memory_buffer_count; i++)\n";
+    entry.block_begin();
+    entry << "ctx.memory_buffers.push_back(new AlignedBuffer(s_memory_buffer_sizes[i], "
+          << s_memory_pool_alignment << "));\n";
+    entry.block_end();
+    entry << "model->cg_ctx = init_cg_ctx();\n";
+    entry.block_end();
+    entry << "catch (...)\n";
+    entry.block_begin();
+    entry << "delete model;\n";
+    entry << "release_weights();\n";
+    entry << "return nullptr;\n";
+    entry.block_end();
+    entry << "return model;\n";
+    entry.block_end();
+    entry << "\n";
+
+    entry << "int " << name << "_call(" << name
+          << "_model* model, void** inputs, void** outputs)\n";
+    entry.block_begin();
+    entry << "try\n";
+    entry.block_begin();
+    entry << name << "(inputs, outputs, &model->ctx, model->cg_ctx);\n";
+    entry.block_end();
+    entry << "catch (...)\n";
+    entry.block_begin();
+    entry << "return -1;\n";
+    entry.block_end();
+    entry << "return 0;\n";
+    entry.block_end();
+    entry << "\n";
+
+    entry << "void " << name << "_destroy(" << name << "_model* model)\n";
+    entry.block_begin();
+    entry << "std::lock_guard<std::mutex> lock(s_mutex);\n";
+    entry << "delete model;\n";
+    entry << "release_weights();\n";
+    entry.block_end();
+    source_files.insert(source_files.begin(), name + "_aot.cpp");
+    ofstream(file_util::path_join(directory, source_files.front())) << entry.get_code();
+
+    // The libraries default to those of this process, the headers to those it generated the
+    // code against
+    CodeWriter cmake;
+    cmake << "# Generated by the nGraph CPU backend\n";
+    cmake << "cmake_minimum_required(VERSION 3.4)\n";
+    cmake << "project(" << name << " CXX)\n\n";
+    cmake << "set(NGRAPH_LIBRARY_DIR \""
+          << runtime::Backend::get_backend_shared_library_search_directory()
+          << "\" CACHE PATH \"Directory of the nGraph libraries\")\n";
+    cmake << "find_library(NGRAPH_LIBRARY ngraph PATHS ${NGRAPH_LIBRARY_DIR} NO_DEFAULT_PATH)\n";
+    cmake << "find_library(CPU_BACKEND_LIBRARY cpu_backend PATHS ${NGRAPH_LIBRARY_DIR} "
+             "NO_DEFAULT_PATH)\n";
+    cmake << "find_library(DNNL_LIBRARY NAMES dnnl mkldnn PATHS ${NGRAPH_LIBRARY_DIR})\n";
+#if defined(NGRAPH_TBB_ENABLE)
+    cmake << "find_library(TBB_LIBRARY tbb PATHS ${NGRAPH_LIBRARY_DIR})\n";
+#endif
+    cmake << "\nadd_library(" << name << " SHARED";
+    for (auto& file : source_files)
+    {
+        cmake << " " << file;
+    }
+    cmake << ")\n";
+    cmake << "set_target_properties(" << name
+          << " PROPERTIES CXX_STANDARD 11 CXX_VISIBILITY_PRESET hidden)\n";
+    cmake << "target_compile_definitions(" << name
+          << " PRIVATE NGRAPH_IN_CODEGEN EIGEN_MPL2_ONLY";
+#if defined(NGRAPH_TBB_ENABLE)
+    cmake << " NGRAPH_TBB_ENABLE";
+#endif
+    cmake << ")\n";
+    cmake << "target_compile_options(" << name << " PRIVATE -O3 -march=native)\n";
+    cmake << "target_include_directories(" << name << " PRIVATE ${CMAKE_CURRENT_SOURCE_DIR}";
+    for (auto& path : codegen::Compiler::get_library_header_paths())
+    {
+        cmake << " \"" << path << "\"";
+    }
+    cmake << ")\n";
+    cmake << "target_link_libraries(" << name
+          << " PRIVATE ${CPU_BACKEND_LIBRARY} ${NGRAPH_LIBRARY} ${DNNL_LIBRARY}";
+#if defined(NGRAPH_TBB_ENABLE)
+    cmake << " ${TBB_LIBRARY}";
+#endif
+    cmake << ")\n";
+    ofstream(file_util::path_join(directory, "CMakeLists.txt")) << cmake.get_code();
+}
+
 #endif // defined(CODEGEN_ENABLE)
 
 void runtime::cpu::CPU_ExternalFunction::register_common_passes(
@@ -1237,25 +1847,42 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
             }
         }
 #endif
-        // this checks averts the decomposition of LSTMCell
-        // we will map LSTMCell to LSTM CPU op in the later
-        // graph pass
-        if (typeid(ngraph::op::v0::LSTMCell) == typeid(node))
+        if (typeid(ngraph::op::v0::GeluBackpropFactor) == typeid(node))
         {
-            // DNNL version < 1.0 doesnt support peephole for LSTM, we will skip if the LSTMCell
-            // has peephole. LSTMCell with no peephole support is constant initialized to zero
-            // TODO (pthoreho) : For DNNL > V1.0, change dnnl kernel integration to compute for
-            // LSTMCell with peephole as well.
-            // Not supported on codegen
-            return m_direct_execution && is_type<ngraph::op::v0::Constant>(node.get_argument(6));
+            return false;
         }
-        else if (typeid(ngraph::op::v0::GeluBackpropFactor) == typeid(node))
+        // Fused ops with a native DEX kernel; NGRAPH_CPU_DECOMPOSE_FUSED_OPS falls back to
+        // their decomposition
+        else if (typeid(ngraph::op::v0::Gelu) == typeid(node) ||
+                 typeid(ngraph::op::v0::LayerNorm) == typeid(node) ||
+                 typeid(ngraph::op::v0::MVN) == typeid(node) ||
+                 typeid(ngraph::op::v0::GRN) == typeid(node))
         {
-            return false;
+            auto type = node.get_output_element_type(0);
+            return dex && !m_decompose_fused_ops && (type == element::f32 || type == element::f64);
         }
-        else if (typeid(ngraph::op::v0::Gelu) == typeid(node))
+        else if (typeid(ngraph::op::v0::NormalizeL2) == typeid(node))
         {
-            return false;
+            // The reduction axes are read at build time
+            auto type = node.get_output_element_type(0);
+            return dex && !m_decompose_fused_ops &&
+                   (type == element::f32 || type == element::f64) &&
+                   is_type<ngraph::op::v0::Constant>(node.get_argument(1));
+        }
+        else if (typeid(ngraph::op::v0::PRelu) == typeid(node) ||
+                 typeid(ngraph::op::v0::SquaredDifference) == typeid(node))
+        {
+            auto type = node.get_output_element_type(0);
+            return dex && !m_decompose_fused_ops &&
+                   node.get_input_element_type(1) == node.get_input_element_type(0) &&
+                   (type == element::f32 || type == element::f64 || type == element::i32 ||
+                    type == element::i64);
+        }
+        else if (typeid(ngraph::op::v0::ScatterND) == typeid(node))
+        {
+            auto index_type = node.get_input_element_type(1);
+            return dex && !m_decompose_fused_ops &&
+                   (index_type == element::i32 || index_type == element::i64);
         }
         // GroupConvolution is only supported with DNNL
         else if (auto conv = as_type<ngraph::op::v0::GroupConvolution>(const_cast<Node*>(&node)))
@@ -1287,6 +1914,19 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
     };
 
     REGISTER_KNOBBED_PASS(LikeReplacement, true, ngraph::pass)
+    // Ahead of the decomposition of the MatMuls and of the opset downgrade, so the attention
+    // chain is still in its imported form. Only DEX has the kernel.
+    if (dex)
+    {
+        REGISTER_KNOBBED_PASS(CPUAttentionFusion, true, runtime::cpu::pass)
+        // The preprocessing of the inputs, as builder::add_preprocessing makes it
+        REGISTER_KNOBBED_PASS(CPUPreprocessFusion, true, runtime::cpu::pass)
+        // The RNN cells and sequences DNNL can run skip the decomposition; those left are
+        // decomposed
+        REGISTER_KNOBBED_PASS(CPURNNLowering, true, runtime::cpu::pass)
+    }
+    // While the MatMuls, squeezes and unsqueezes of opset-1 graphs are not decomposed yet
+    REGISTER_KNOBBED_PASS(TransposeSinkingV1, true, ngraph::pass)
     REGISTER_KNOBBED_PASS_WITH_ARGS(FusedOpDecomposition, true, ngraph::pass, is_supported)
     REGISTER_KNOBBED_PASS(ConvertOpset3To1, true, ngraph::pass)
     REGISTER_KNOBBED_PASS(ConvertOpset1To0, true, ngraph::pass)
@@ -1296,7 +1936,9 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
     REGISTER_KNOBBED_PASS(VanillaRNNFusion, true, runtime::cpu::pass)
     REGISTER_KNOBBED_PASS(LSTMFusion, true, runtime::cpu::pass)
     REGISTER_KNOBBED_PASS(RNNFusion, true, runtime::cpu::pass)
-    REGISTER_KNOBBED_PASS(AlgebraicSimplification, true, ngraph::pass)
+    // Rewrites that may change results are opted into
+    bool fast_math = pass_config.get_pass_attribute("AlgebraicSimplification::FastMath");
+    REGISTER_KNOBBED_PASS_WITH_ARGS(AlgebraicSimplification, true, ngraph::pass, fast_math)
     REGISTER_KNOBBED_PASS(MultiLayerRNNFusion, true, runtime::cpu::pass)
     REGISTER_KNOBBED_PASS(BiDirectionalRnn, true, runtime::cpu::pass)
     REGISTER_KNOBBED_PASS(CPURnnMatFusion, true, runtime::cpu::pass)
@@ -1308,6 +1950,14 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
         CoreFusion, true, ngraph::pass, ngraph::pass::FusionType::ALL_FUSIONS)
     REGISTER_KNOBBED_PASS_WITH_ARGS(FusedOpDecomposition, true, ngraph::pass, is_supported)
     REGISTER_KNOBBED_PASS(CPUPreFusion, true, runtime::cpu::pass)
+    // Before CPUFusion claims the float Dots and Convolutions of the chains
+    REGISTER_KNOBBED_PASS(QuantizedOpFusion, true, ngraph::pass)
+    // Ahead of CPUFusion, which would otherwise claim the Dots. Only DEX has the kernels.
+    if (dex)
+    {
+        REGISTER_KNOBBED_PASS(CPUCompressedWeightsFusion, true, runtime::cpu::pass)
+        REGISTER_KNOBBED_PASS(CPUSparseWeightsConversion, true, runtime::cpu::pass)
+    }
 
 // Disable CPUFusion if MLIR is enabled to preserve core ops.
 #ifdef NGRAPH_CPU_MLIR_ENABLE
@@ -1321,6 +1971,12 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
     REGISTER_KNOBBED_PASS(CPUQuantFusion, true, runtime::cpu::pass)
     REGISTER_KNOBBED_PASS(CPUHorizontalFusion, true, runtime::cpu::pass)
     REGISTER_KNOBBED_PASS(CPUCollapseDims, true, runtime::cpu::pass)
+    // Only DEX has kernels for the fused chains and optimizer updates; MLIR does its own fusion
+    if (dex && m_execution_mode != EXECUTION_MODE::MLIR)
+    {
+        REGISTER_KNOBBED_PASS(CPUOptimizerFusion, true, runtime::cpu::pass)
+        REGISTER_KNOBBED_PASS(CPUElementwiseFusion, true, runtime::cpu::pass)
+    }
 
 #ifdef NGRAPH_CPU_MLIR_ENABLE
     if (m_execution_mode == EXECUTION_MODE::MLIR)
@@ -1329,6 +1985,14 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
     }
 #endif
 
+    // Once the ops producing the gradients and the tensors sent are final. Only DEX has the
+    // kernels.
+    if (dex)
+    {
+        REGISTER_KNOBBED_PASS(CPUAllReduceBucketing, true, runtime::cpu::pass)
+        REGISTER_KNOBBED_PASS(CPUAsyncTransfers, true, runtime::cpu::pass)
+    }
+
     OutputVector nv_cwi; // We dont need CPUWorkspaceInsertion to return list of indices
     REGISTER_KNOBBED_PASS_WITH_ARGS(CPUWorkspaceInsertion, true, runtime::cpu::pass, nv_cwi, false)
     REGISTER_KNOBBED_PASS_WITH_ARGS(CPUAssignment, true, runtime::cpu::pass, this)
@@ -1338,6 +2002,11 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
         CommonSubexpressionElimination, true, ngraph::pass, runtime::cpu::get_cse_handlers_map())
     REGISTER_KNOBBED_PASS(CPUPostLayoutOptimizations, true, runtime::cpu::pass)
     REGISTER_KNOBBED_PASS(CPUConvertLayoutConstantFolding, true, runtime::cpu::pass)
+    if (m_constant_store)
+    {
+        REGISTER_KNOBBED_PASS_WITH_ARGS(
+            CPUConstantInterning, true, runtime::cpu::pass, m_constant_store)
+    }
     REGISTER_KNOBBED_PASS(CPUMemoryOptimization, true, runtime::cpu::pass)
     REGISTER_KNOBBED_PASS_WITH_ARGS(
         PropagateCacheability, true, ngraph::pass, runtime::cpu::get_annotations_factory())
@@ -1363,6 +2032,36 @@ bool runtime::cpu::CPU_ExternalFunction::computes_result(Node* node)
     return false;
 }
 
+// The cost estimate of an op for inline execution: the elements it reads and writes. Ops
+// below NGRAPH_CPU_INLINE_OP_ELEMENTS spend more on a thread-pool handoff than on compute.
+// Ops with a profiled time use that instead, against NGRAPH_CPU_INLINE_OP_MICROSECONDS.
+// DNNL primitives and ops running subgraphs are never inlined.
+static bool runs_inline(const Node* node,
+                        size_t threshold,
+                        double profiled_microseconds,
+                        double threshold_microseconds)
+{
+    if (threshold == 0 || runtime::cpu::dnnl_utils::use_dnnl_kernel(node) ||
+        is_type<op::v0::TensorIterator>(node))
+    {
+        return false;
+    }
+    if (profiled_microseconds >= 0)
+    {
+        return profiled_microseconds <= threshold_microseconds;
+    }
+    size_t elements = 0;
+    for (const auto& input : node->inputs())
+    {
+        elements += shape_size(input.get_shape());
+    }
+    for (const auto& output : node->outputs())
+    {
+        elements += shape_size(output.get_shape());
+    }
+    return elements <= threshold;
+}
+
 static void dump_one_kernel_with_type(runtime::cpu::CPU_DebugTracer& debug_tracer,
                                       runtime::cpu::TensorTracerAttributes& t_attrs,
                                       const std::string& kernel_name,
@@ -1425,6 +2124,10 @@ void runtime::cpu::CPU_ExternalFunction::dump_one_kernel(CPU_DebugTracer& debug_
                                                          bool is_it_input)
 {
     size_t index = ctx->pc;
+    if (!debug_tracer.traces_op(m_op_attrs.at(index).Description))
+    {
+        return;
+    }
     if (is_it_input)
     {
         for (size_t i = 0; i < m_op_attrs.at(index).Inputs.size(); i++)
@@ -1461,6 +2164,8 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
         return;
     }
 
+    register_builders();
+
 #if defined(NGRAPH_TBB_ENABLE)
     if (m_use_tbb && (runtime::cpu::IsTracingEnabled() || m_emit_timing))
     {
@@ -1482,11 +2187,7 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
     register_common_passes(pass_manager, pass_config);
     pass_manager.run_passes(m_function, false);
 
-    static runtime::cpu::CPU_DebugTracer debug_tracer;
-    if (getenv_bool("NGRAPH_CPU_DEBUG_TRACER"))
-    {
-        debug_tracer.set_enable_tracing(true);
-    }
+    static runtime::cpu::CPU_DebugTracer& debug_tracer = runtime::cpu::CPU_DebugTracer::get();
 
     // Store layouts assigned for arguments
     for (const auto& parameter : m_function->get_parameters())
@@ -1553,10 +2254,14 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
         {
             auto output_tensor = &node->get_output_tensor(0);
             m_buffer_indices[output_tensor->get_name()] = buffer_index;
-            constant_tensor_data.emplace_back(
-                buffer_index,
-                const_cast<void*>(
-                    static_pointer_cast<ngraph::op::v0::Constant>(node)->get_data_ptr()));
+            auto constant = static_pointer_cast<ngraph::op::v0::Constant>(node);
+            void* data = const_cast<void*>(constant->get_data_ptr());
+            if (m_prefault_memory)
+            {
+                // Reading loads lazy data and keeps file mapped weights shared
+                prefault_memory(data, output_tensor->size(), false);
+            }
+            constant_tensor_data.emplace_back(buffer_index, data);
             auto tensor_set = get_tensor_set(output_tensor);
             // process all tensors in the set containing the output tensor of the constant
             for (auto& ele_t : tensor_set)
@@ -1573,6 +2278,7 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
     }
 
     // Inputs
+    unordered_map<string, size_t> input_tensor_args;
     size_t arg_index = 0;
     for (auto& param : m_function->get_parameters())
     {
@@ -1587,6 +2293,7 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
             {
                 m_tensor_roles[ele_t->get_name()] = TensorRole::INPUT;
                 m_buffer_indices[ele_t->get_name()] = buffer_index;
+                input_tensor_args[ele_t->get_name()] = arg_index;
                 function_input_index_offset.emplace_back(m_buffer_indices[ele_t->get_name()],
                                                          arg_index,
                                                          ele_t->get_pool_offset(),
@@ -1618,6 +2325,61 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
     // After processing inputs, outputs, constants, and intermediates, set the buffer size.
     m_buffer_size = buffer_index;
 
+    // Buffers read and written by each op, identified by their CPUMemoryAssignment buffer set,
+    // for ordering ops run by the op scheduler
+    vector<pair<vector<size_t>, vector<size_t>>> op_buffers;
+    vector<size_t> dnnl_ops;
+    // Buffer sets of the temporary pool that each op uses, for the memory timeline
+    map<size_t, CPU_MemoryTimeline::Buffer> pool_buffers;
+    unordered_map<const descriptor::Tensor*, size_t> unassigned_buffers;
+    auto buffer_of = [&](const descriptor::Tensor* tensor) -> size_t {
+        auto it = tensor_to_bufferID.find(const_cast<descriptor::Tensor*>(tensor));
+        if (it != tensor_to_bufferID.end())
+        {
+            return it->second;
+        }
+        auto unassigned = unassigned_buffers.find(tensor);
+        if (unassigned == unassigned_buffers.end())
+        {
+            size_t id = numeric_limits<size_t>::max() - unassigned_buffers.size();
+            unassigned = unassigned_buffers.insert({tensor, id}).first;
+        }
+        return unassigned->second;
+    };
+
+    const int32_t inline_elements = getenv_int("NGRAPH_CPU_INLINE_OP_ELEMENTS", 2048);
+    const int32_t inline_microseconds = getenv_int("NGRAPH_CPU_INLINE_OP_MICROSECONDS", 5);
+    const int inline_arena = executor::GetCPUExecutor().get_inline_arena();
+
+    // Average microseconds of each op, negative if unknown, when the profile was recorded on
+    // a graph with the same ops
+    vector<double> op_microseconds;
+    if (!m_op_profile.empty())
+    {
+        bool matches = true;
+        for (shared_ptr<Node> node : m_function->get_ordered_ops())
+        {
+            if (node->is_parameter() || node->is_constant())
+            {
+                continue;
+            }
+            size_t index = op_microseconds.size();
+            if (index >= m_op_profile.size() ||
+                m_op_profile[index].first != node->description())
+            {
+                matches = false;
+                break;
+            }
+            op_microseconds.push_back(m_op_profile[index].second);
+        }
+        if (!matches || op_microseconds.size() != m_op_profile.size())
+        {
+            NGRAPH_DEBUG << "Op profile of " << m_function_name
+                         << " ignored as it was recorded on different ops";
+            op_microseconds.clear();
+        }
+    }
+
     for (shared_ptr<Node> node : m_function->get_ordered_ops())
     {
         if (node->is_parameter() || node->is_constant())
@@ -1627,7 +2389,18 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
         auto& n = *node; // Work around a compiler warning (*node inside typeid may have effects
         // with shared pointers, which is fine here but clang doesn't like it.)
         auto handler = GetGlobalBuildDispatcher().find(type_index(typeid(n)));
-        if (handler == GetGlobalBuildDispatcher().end())
+        BuildOpFunction build_op;
+        if (handler != GetGlobalBuildDispatcher().end())
+        {
+            build_op = handler->second;
+        }
+        else if (can_build_evaluate(node.get()))
+        {
+            // Only this op runs at reference speed instead of the whole function falling back
+            // to another backend
+            build_op = build_evaluate;
+        }
+        else
         {
             throw unsupported_op(node->description());
         }
@@ -1657,7 +2430,76 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
 
         m_op_attrs.emplace_back(node->description(), out_names, in_names, t_out_attrs, t_in_attrs);
         op_names.push_back(node->get_name());
-        handler->second(this, node.get(), in, out);
+        double profiled_microseconds =
+            op_microseconds.empty() ? -1 : op_microseconds[op_buffers.size()];
+        build_op(this, node.get(), in, out);
+        if (runs_inline(node.get(),
+                        inline_elements > 0 ? inline_elements : 0,
+                        profiled_microseconds,
+                        inline_microseconds))
+        {
+            auto kernel = functors.back();
+            functors.back() = [kernel, inline_arena](CPURuntimeContext* ctx,
+                                                     CPUExecutionContext* /* ectx */) {
+                CPUExecutionContext inline_ectx{inline_arena};
+                kernel(ctx, &inline_ectx);
+            };
+        }
+        // Parameters the op reads, directly or through tensors sharing their buffers
+        m_op_inputs_read.emplace_back();
+        for (const string& name : in_names)
+        {
+            auto arg = input_tensor_args.find(name);
+            auto& inputs_read = m_op_inputs_read.back();
+            if (arg != input_tensor_args.end() &&
+                find(inputs_read.begin(), inputs_read.end(), arg->second) == inputs_read.end())
+            {
+                inputs_read.push_back(arg->second);
+            }
+        }
+        op_buffers.emplace_back();
+        for (const TensorWrapper& tw : in)
+        {
+            op_buffers.back().first.push_back(buffer_of(tw.get_tensor().get()));
+        }
+        for (const TensorWrapper& tw : out)
+        {
+            op_buffers.back().second.push_back(buffer_of(tw.get_tensor().get()));
+        }
+        size_t op_index = op_buffers.size() - 1;
+        for (const vector<TensorWrapper>* tensors : {&in, &out})
+        {
+            for (const TensorWrapper& tw : *tensors)
+            {
+                size_t buffer = buffer_of(tw.get_tensor().get());
+                auto buffer_set = bufferID_to_tensorSets.find(buffer);
+                if (buffer_set == bufferID_to_tensorSets.end() ||
+                    buffer_set->second.first != TensorRole::INTERMEDIATE)
+                {
+                    continue;
+                }
+                auto it = pool_buffers.find(buffer);
+                if (it == pool_buffers.end())
+                {
+                    // The tensors of a set share its memory, some of them at an offset into it
+                    size_t begin = numeric_limits<size_t>::max();
+                    size_t end = 0;
+                    for (descriptor::Tensor* tensor : buffer_set->second.second)
+                    {
+                        begin = std::min(begin, tensor->get_pool_offset());
+                        end = std::max(end, tensor->get_pool_offset() + tensor->size());
+                    }
+                    CPU_MemoryTimeline::Buffer pool_buffer{
+                        tw.get_name(), begin, end - begin, op_index, op_index};
+                    it = pool_buffers.insert({buffer, pool_buffer}).first;
+                }
+                it->second.last_op = op_index;
+            }
+        }
+        if (runtime::cpu::dnnl_utils::use_dnnl_kernel(node.get()))
+        {
+            dnnl_ops.push_back(op_buffers.size() - 1);
+        }
 
         auto cacheable = true;
         auto reuse_memory = pass_config.get_pass_attribute("CPUMemoryAssignment::ReuseMemory") ||
@@ -1735,6 +2577,15 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
         m_perf_counters.emplace_back(node, 0, 0);
     }
 
+    m_input_reader_counts.assign(m_function->get_parameters().size(), 0);
+    for (auto& inputs_read : m_op_inputs_read)
+    {
+        for (size_t input : inputs_read)
+        {
+            m_input_reader_counts[input]++;
+        }
+    }
+
     if (getenv_bool("NGRAPH_DEX_DEBUG"))
     {
         string filename = file_util::path_join(s_debug_dir, m_function_name + "_debug.txt");
@@ -1798,9 +2649,139 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
     // This check ensures we have exactly one functor for Op.
     NGRAPH_CHECK(m_op_attrs.size() == functors.size());
 
+    size_t host_tensor_bytes = 0;
+    for (auto& param : m_function->get_parameters())
+    {
+        host_tensor_bytes += param->get_output_tensor(0).size();
+    }
+    for (size_t i = 0; i < m_function->get_output_size(); ++i)
+    {
+        host_tensor_bytes += m_function->get_output_op(i)->get_output_tensor(0).size();
+    }
+    size_t constant_bytes = 0;
+    for (auto& node : m_function->get_ordered_ops())
+    {
+        if (node->is_constant())
+        {
+            constant_bytes += node->get_output_tensor(0).size();
+        }
+    }
+    vector<CPU_MemoryTimeline::Buffer> timeline_buffers;
+    for (auto& p : pool_buffers)
+    {
+        timeline_buffers.push_back(p.second);
+    }
+    m_memory_timeline.reset(new CPU_MemoryTimeline(
+        functors.size(), move(timeline_buffers), host_tensor_bytes, constant_bytes));
+
+    bool reuse_memory = pass_config.get_pass_attribute("CPUMemoryAssignment::ReuseMemory") ||
+                        pass_config.get_pass_attribute("ReuseMemory");
+    size_t num_workers = executor::GetCPUExecutor().get_num_thread_pools();
+    // Reused intermediates alias across buffer sets, so ops can only run in program order
+    bool use_op_scheduler = m_inter_op && num_workers > 1 && !reuse_memory;
+    // The hardware counters of the process cannot be told apart between concurrent ops
+    use_op_scheduler = use_op_scheduler && !hw_counters::is_enabled();
+#if defined(NGRAPH_TBB_ENABLE)
+    use_op_scheduler = use_op_scheduler && !m_use_tbb;
+#endif
+    if (use_op_scheduler)
+    {
+        // An op depends on the last writer of every buffer it reads or writes and, when it
+        // writes a buffer, on every op that read it since, which also orders in-place ops.
+        vector<set<size_t>> predecessors(functors.size());
+        unordered_map<size_t, size_t> last_writer;
+        unordered_map<size_t, vector<size_t>> readers;
+        for (size_t op = 0; op < op_buffers.size(); op++)
+        {
+            for (size_t buffer : op_buffers[op].first)
+            {
+                auto it = last_writer.find(buffer);
+                if (it != last_writer.end())
+                {
+                    predecessors[op].insert(it->second);
+                }
+            }
+            for (size_t buffer : op_buffers[op].second)
+            {
+                auto it = last_writer.find(buffer);
+                if (it != last_writer.end())
+                {
+                    predecessors[op].insert(it->second);
+                }
+                for (size_t reader : readers[buffer])
+                {
+                    predecessors[op].insert(reader);
+                }
+            }
+            for (size_t buffer : op_buffers[op].first)
+            {
+                readers[buffer].push_back(op);
+            }
+            for (size_t buffer : op_buffers[op].second)
+            {
+                last_writer[buffer] = op;
+                readers[buffer].clear();
+            }
+            predecessors[op].erase(op);
+        }
+        // DNNL kernels of a context share one scratchpad buffer
+        for (size_t i = 1; i < dnnl_ops.size(); i++)
+        {
+            predecessors[dnnl_ops[i]].insert(dnnl_ops[i - 1]);
+        }
+        vector<vector<size_t>> successors(functors.size());
+        for (size_t op = 0; op < predecessors.size(); op++)
+        {
+            for (size_t predecessor : predecessors[op])
+            {
+                successors[predecessor].push_back(op);
+            }
+        }
+        // With a profile, the ready ops heading the most recorded time still to run start first
+        vector<double> priorities;
+        if (!op_microseconds.empty())
+        {
+            priorities.resize(successors.size());
+            for (size_t op = successors.size(); op-- > 0;)
+            {
+                double rest = 0;
+                for (size_t successor : successors[op])
+                {
+                    rest = std::max(rest, priorities[successor]);
+                }
+                priorities[op] = std::max(op_microseconds[op], 0.0) + rest;
+            }
+        }
+        m_op_scheduler.reset(
+            new CPU_OpScheduler(move(successors), num_workers, move(priorities)));
+    }
+
+    int sample_period = getenv_int("NGRAPH_CPU_TIMING_SAMPLE_PERIOD", 0);
+    if (sample_period > 0 && !m_emit_timing)
+    {
+        m_op_sampler.reset(new CPU_OpSampler(functors.size(), sample_period));
+    }
+
     executor = [&](CPURuntimeContext* ctx, vector<void*>& inputs, vector<void*>& outputs) {
         cpu::Timestamp start_ts, end_ts;
         uint64_t profiler_count = 0;
+        // The first call also builds the DNNL primitives, so it is never sampled. The TBB flow
+        // graph is built by the first call, so its ops are not sampled either.
+        bool sampled = m_op_sampler && !ctx->first_iteration && m_op_sampler->sample_call();
+        // Ops are only counted one at a time, so not through TBB or the op scheduler
+        bool count_hw = hw_counters::is_enabled() &&
+                        (runtime::cpu::IsTracingEnabled() || m_emit_timing);
+        hw_counters::Values start_counters;
+        if (count_hw)
+        {
+            hw_counters::get_process_counters().refresh();
+        }
+        // The first call builds the primitives and caches of the context, so it always runs
+        // to completion
+        auto stop_requested = [ctx]() {
+            return ctx->cancellation && !ctx->first_iteration &&
+                   ctx->cancellation->should_stop();
+        };
 
         if (ctx->first_iteration)
         {
@@ -1827,6 +2808,36 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
             ctx->buffer_data[get<0>(p)] = static_cast<uint8_t*>(outputs[get<1>(p)]) + get<2>(p);
         }
 
+        if (ctx->first_iteration && !m_defer_primitive_build && !m_primitive_build_functors.empty())
+        {
+            // DNNL primitives of different ops are independent, so they are built concurrently
+            // ahead of the first run instead of one by one as the ops first execute
+            size_t num_builders = std::min(
+                m_primitive_build_functors.size(),
+                static_cast<size_t>(std::max(executor::GetCPUExecutor().get_num_cores(), 1)));
+            CPU_OpScheduler builder(
+                vector<vector<size_t>>(m_primitive_build_functors.size()), num_builders);
+            ctx->build_primitives_only = true;
+            try
+            {
+                builder.run([&](size_t index, size_t worker) {
+                    CPUExecutionContext ectx{
+                        m_own_arena
+                            ? m_arena
+                            : static_cast<int>(
+                                  worker % executor::GetCPUExecutor().get_num_thread_pools())};
+                    executor::GetCPUExecutor().execute(
+                        functors.at(m_primitive_build_functors[index]), ctx, &ectx);
+                });
+            }
+            catch (...)
+            {
+                ctx->build_primitives_only = false;
+                throw;
+            }
+            ctx->build_primitives_only = false;
+        }
+
         auto functor = functors.begin();
 #if defined(NGRAPH_TBB_ENABLE)
         if (m_use_tbb)
@@ -1853,8 +2864,11 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                                     {
                                         start_ts = cpu::Clock::now();
                                     }
-                                    CPUExecutionContext ectx{0};
+                                    CPUExecutionContext ectx{m_arena};
+                                    event::Duration op_event(
+                                        op_names.at(index), "Op", op_event_args(ctx, ectx));
                                     executor::GetCPUExecutor().execute(*functor, ctx, &ectx, true);
+                                    op_event.stop();
                                     if (runtime::cpu::IsTracingEnabled() || m_emit_timing)
                                     {
                                         end_ts = cpu::Clock::now();
@@ -1965,11 +2979,120 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                 }
             }
 
+            // Parameters are released to the next call once the ops reading them are done
+            if (ctx->input_release && ctx->pc == 0)
+            {
+                ctx->input_release->start(m_input_reader_counts);
+            }
+            auto op_done = [ctx, this](size_t index) {
+                if (ctx->input_release)
+                {
+                    for (size_t input : m_op_inputs_read[index])
+                    {
+                        ctx->input_release->read_done(input);
+                    }
+                }
+            };
+
+            // Calls resumed from a breakpoint are traced whatever the sample period
+            bool trace_call = debug_tracer.tracing_is_enabled() &&
+                              (ctx->pc != 0 || debug_tracer.begin_call());
+
+            // The scheduler is skipped while debugging, which steps through ops in program order
+            unique_lock<mutex> scheduler_lock;
+            if (m_op_scheduler && ctx->pc == 0 && ctx->breakpoints.empty() && !trace_call)
+            {
+                // Concurrent calls on other contexts run sequentially rather than wait
+                scheduler_lock = unique_lock<mutex>(m_op_scheduler_mutex, try_to_lock);
+            }
+            if (scheduler_lock.owns_lock())
+            {
+                m_op_scheduler->run([&](size_t index, size_t worker) {
+                    // Ops left once the call is stopped are skipped
+                    if (ctx->cancelled.load(std::memory_order_relaxed) || stop_requested())
+                    {
+                        ctx->cancelled = true;
+                        return;
+                    }
+                    if (enables.at(index)(ctx) || ctx->first_iteration)
+                    {
+                        executor::GetCPUExecutor().yield_to_higher_priority(ctx->priority);
+                        cpu::Timestamp op_start_ts, op_end_ts;
+                        if (runtime::cpu::IsTracingEnabled() || m_emit_timing)
+                        {
+                            op_start_ts = cpu::Clock::now();
+                        }
+
+                        // Run on the thread pool of this worker so concurrent ops do not share
+                        // one Eigen pool, unless the executable has its own threads
+                        CPUExecutionContext ectx{
+                            m_own_arena
+                                ? m_arena
+                                : static_cast<int>(
+                                      worker % executor::GetCPUExecutor().get_num_thread_pools())};
+                        event::Duration op_event(
+                            op_names.at(index), "Op", op_event_args(ctx, ectx));
+                        uint64_t sample_start = sampled ? CPU_OpSampler::now() : 0;
+                        executor::GetCPUExecutor().execute(functors.at(index), ctx, &ectx);
+                        op_done(index);
+                        if (sampled)
+                        {
+                            m_op_sampler->record(index, CPU_OpSampler::now() - sample_start);
+                        }
+                        op_event.stop();
+
+                        if (runtime::cpu::IsTracingEnabled() || m_emit_timing)
+                        {
+                            op_end_ts = cpu::Clock::now();
+                            if (runtime::cpu::IsTracingEnabled())
+                            {
+                                ctx->op_durations[index] =
+                                    (std::chrono::duration_cast<cpu::Timescale>(op_end_ts -
+                                                                                op_start_ts))
+                                        .count();
+                            }
+                            if (m_emit_timing)
+                            {
+                                m_perf_counters[index].m_total_microseconds +=
+                                    std::chrono::duration_cast<std::chrono::microseconds>(
+                                        op_end_ts - op_start_ts)
+                                        .count();
+                                m_perf_counters[index].m_total_concurrency +=
+                                    m_op_scheduler->get_concurrency(index);
+                                m_perf_counters[index].m_call_count++;
+                            }
+                        }
+                    }
+                    else
+                    {
+                        op_done(index);
+                        if (runtime::cpu::IsTracingEnabled())
+                        {
+                            ctx->op_durations[index] = 0;
+                        }
+                        if (m_emit_timing)
+                        {
+                            m_perf_counters[index].m_call_count++;
+                        }
+                    }
+                });
+                ctx->pc = functors.size();
+                profiler_count = functors.size();
+            }
+
             for (; ctx->pc < functors.size(); ctx->pc++)
             {
+                if (stop_requested())
+                {
+                    ctx->cancelled = true;
+                    break;
+                }
                 auto index = profiler_count++;
                 if ((enables.at(ctx->pc))(ctx) || ctx->first_iteration)
                 {
+                    // Lower priority calls wait here while urgent calls use the pools
+                    executor::GetCPUExecutor().yield_to_higher_priority(ctx->priority);
+
                     // Each Op will have exactly one functor, start the clock before the exceution
                     // of functor
                     // and collect the profiler_count once the execution complets
@@ -1977,17 +3100,30 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                     {
                         start_ts = cpu::Clock::now();
                     }
+                    if (count_hw)
+                    {
+                        start_counters = hw_counters::get_process_counters().read();
+                    }
 
-                    CPUExecutionContext ectx{0};
+                    CPUExecutionContext ectx{m_arena};
 
-                    if (debug_tracer.tracing_is_enabled())
+                    if (trace_call)
                     {
                         this->dump_one_kernel(debug_tracer, ctx, true);
                     }
 
+                    event::Duration op_event(
+                        op_names.at(ctx->pc), "Op", op_event_args(ctx, ectx));
+                    uint64_t sample_start = sampled ? CPU_OpSampler::now() : 0;
                     executor::GetCPUExecutor().execute(functors.at(ctx->pc), ctx, &ectx);
+                    op_done(ctx->pc);
+                    if (sampled)
+                    {
+                        m_op_sampler->record(index, CPU_OpSampler::now() - sample_start);
+                    }
+                    op_event.stop();
 
-                    if (debug_tracer.tracing_is_enabled())
+                    if (trace_call)
                     {
                         this->dump_one_kernel(debug_tracer, ctx, false);
                     }
@@ -2017,13 +3153,33 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                             m_perf_counters[index].m_call_count++;
                         }
                     }
+                    if (count_hw)
+                    {
+                        hw_counters::Values counts =
+                            hw_counters::get_process_counters().read() - start_counters;
+                        if (ctx->op_counters)
+                        {
+                            ctx->op_counters[index] = counts;
+                        }
+                        if (m_emit_timing)
+                        {
+                            m_perf_counters[index].m_total_cycles += counts.cycles;
+                            m_perf_counters[index].m_total_instructions += counts.instructions;
+                            m_perf_counters[index].m_total_llc_misses += counts.llc_misses;
+                        }
+                    }
                 }
                 else
                 {
+                    op_done(ctx->pc);
                     if (runtime::cpu::IsTracingEnabled())
                     {
                         ctx->op_durations[index] = 0;
                     }
+                    if (ctx->op_counters)
+                    {
+                        ctx->op_counters[index] = hw_counters::Values();
+                    }
                     if (m_emit_timing)
                     {
                         m_perf_counters[index].m_call_count++;
@@ -2032,7 +3188,7 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
             }
         }
         ctx->first_iteration = false;
-        if (runtime::cpu::IsTracingEnabled())
+        if (runtime::cpu::IsTracingEnabled() && !ctx->cancelled)
         {
             NGRAPH_CHECK(m_op_attrs.size() == profiler_count);
         }
@@ -2062,6 +3218,70 @@ size_t runtime::cpu::CPU_ExternalFunction::get_buffer_index(const std::string& n
     }
 }
 
+size_t runtime::cpu::CPU_ExternalFunction::get_distributed_request_index(const Node* start)
+{
+    auto it = m_distributed_request_indices.find(start);
+    if (it == m_distributed_request_indices.end())
+    {
+        size_t index = m_distributed_request_indices.size();
+        it = m_distributed_request_indices.emplace(start, index).first;
+    }
+    return it->second;
+}
+
+size_t runtime::cpu::CPU_ExternalFunction::get_variable_state_index(
+    const string& variable_id, const element::Type& element_type, const Shape& shape)
+{
+    auto it = m_variable_state_indices.find(variable_id);
+    if (it == m_variable_state_indices.end())
+    {
+        size_t index = add_state(new VariableState(element_type, shape));
+        it = m_variable_state_indices.emplace(variable_id, index).first;
+    }
+    auto variable = static_cast<VariableState*>(m_states.at(it->second));
+    NGRAPH_CHECK(variable->get_element_type() == element_type && variable->get_shape() == shape,
+                 "Variable ",
+                 variable_id,
+                 " of element type ",
+                 variable->get_element_type(),
+                 " and shape ",
+                 variable->get_shape(),
+                 " is used with element type ",
+                 element_type,
+                 " and shape ",
+                 shape);
+    return it->second;
+}
+
+VariableState* runtime::cpu::CPU_ExternalFunction::get_variable_state(const string& variable_id)
+{
+    auto it = m_variable_state_indices.find(variable_id);
+    return it == m_variable_state_indices.end()
+               ? nullptr
+               : static_cast<VariableState*>(m_states.at(it->second));
+}
+
+vector<VariableState*> runtime::cpu::CPU_ExternalFunction::get_variable_states()
+{
+    vector<VariableState*> variables;
+    for (auto& variable_index : m_variable_state_indices)
+    {
+        variables.push_back(static_cast<VariableState*>(m_states.at(variable_index.second)));
+    }
+    return variables;
+}
+
+size_t runtime::cpu::CPU_ExternalFunction::get_node_state_index(
+    const Node* node, const function<ngraph::State*()>& create)
+{
+    auto it = m_node_state_indices.find(node);
+    if (it == m_node_state_indices.end())
+    {
+        it = m_node_state_indices.emplace(node, add_state(create())).first;
+    }
+    return it->second;
+}
+
 bool runtime::cpu::CPU_ExternalFunction::is_codegen(const ngraph::pass::PassConfig& pc)
 {
     auto attrs = pc.get_pass_attributes();
@@ -2160,6 +3380,15 @@ const vector<runtime::PerformanceCounter>& runtime::cpu::CPU_ExternalFunction::g
         release_function();
     }
 #endif
+    if (m_op_sampler)
+    {
+        vector<CPU_OpSampler::OpTime> op_times = m_op_sampler->get_op_times();
+        for (size_t i = 0; i < op_times.size() && i < m_perf_counters.size(); i++)
+        {
+            m_perf_counters[i].m_total_microseconds = op_times[i].microseconds;
+            m_perf_counters[i].m_call_count = op_times[i].calls;
+        }
+    }
     return m_perf_counters;
 }
 
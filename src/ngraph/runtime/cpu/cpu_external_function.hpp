@@ -20,6 +20,7 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <typeindex>
 #include <typeinfo>
@@ -39,14 +40,20 @@
 #include "ngraph/op/concat.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/pass_config.hpp"
+#include "ngraph/runtime/cpu/cpu_activation_arena.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/runtime/cpu/cpu_constant_store.hpp"
 #include "ngraph/runtime/cpu/cpu_debug_tracer.hpp"
 #include "ngraph/runtime/cpu/cpu_execution_mode.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
+#include "ngraph/runtime/cpu/cpu_memory_timeline.hpp"
+#include "ngraph/runtime/cpu/cpu_op_sampler.hpp"
+#include "ngraph/runtime/cpu/cpu_op_scheduler.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_wrapper.hpp"
 #include "ngraph/runtime/cpu/dnnl_emitter.hpp"
 #include "ngraph/runtime/performance_counter.hpp"
 #include "ngraph/state/state.hpp"
+#include "ngraph/state/variable_state.hpp"
 #include "ngraph/util.hpp"
 
 namespace ngraph
@@ -128,7 +135,19 @@ namespace ngraph
                 {
                     return m_memory_buffer_sizes;
                 }
+                // Adds a buffer of `size` bytes to the pools of every runtime context and returns
+                // its index in CPURuntimeContext::memory_buffers
+                size_t add_memory_buffer(size_t size)
+                {
+                    m_memory_buffer_sizes.push_back(size);
+                    return m_memory_buffer_sizes.size() - 1;
+                }
                 const std::vector<OpAttributes>& get_op_attrs() const { return m_op_attrs; }
+                // Memory in use during every functor, nullptr until the executor is built
+                const CPU_MemoryTimeline* get_memory_timeline() const
+                {
+                    return m_memory_timeline.get();
+                }
                 const std::unique_ptr<DNNLEmitter>& get_dnnl_emitter() const
                 {
                     return m_dnnl_emitter;
@@ -153,6 +172,21 @@ namespace ngraph
                     m_states.push_back(state);
                     return m_states.size() - 1;
                 }
+                // return an index into the cpu_runtime_context's states of the variable
+                // `variable_id`, the same for every op reading or assigning it, after checking
+                // that it has `element_type` and `shape`
+                size_t get_variable_state_index(const std::string& variable_id,
+                                                const element::Type& element_type,
+                                                const Shape& shape);
+                // the variable `variable_id`, nullptr if no op of the function uses it
+                VariableState* get_variable_state(const std::string& variable_id);
+                // the variables used by ops of the function
+                std::vector<VariableState*> get_variable_states();
+                // return an index into the cpu_runtime_context's states of the state of `node`,
+                // made by `create` for the first op asking for it, so that an op repeating the
+                // work of another, such as the backprop of a dropout, can share its state
+                size_t get_node_state_index(const Node* node,
+                                            const std::function<ngraph::State*()>& create);
 
                 const std::string& get_function_name() const { return m_function_name; }
                 const std::shared_ptr<ngraph::Function> get_function() { return m_function; }
@@ -160,10 +194,27 @@ namespace ngraph
                 static constexpr size_t s_memory_pool_alignment = 4096;
 
                 std::vector<CPUKernelFunctor>& get_functors() { return functors; }
+                /// \brief Marks the functor at `index` as one that builds its DNNL primitives
+                /// and returns without executing them when the context has
+                /// build_primitives_only set. These functors are run concurrently at the start
+                /// of the first iteration, unless NGRAPH_CPU_DEFER_PRIMITIVE_BUILD is set, in
+                /// which case each primitive is built the first time its functor runs.
+                void add_primitive_build_functor(size_t index)
+                {
+                    m_primitive_build_functors.push_back(index);
+                }
                 // return an index into the cpu_runtime_context's buffer_data vector to get the
                 // tensor
                 size_t get_buffer_index(const std::string& name);
                 size_t get_buffer_size() const { return m_buffer_size; }
+                // return an index into the cpu_runtime_context's distributed_requests vector
+                // for the request of the collective an op starts, the same every time it is
+                // asked for the op
+                size_t get_distributed_request_index(const Node* start);
+                size_t get_distributed_request_count() const
+                {
+                    return m_distributed_request_indices.size();
+                }
                 std::function<void(CPURuntimeContext*, std::vector<void*>&, std::vector<void*>&)>&
                     get_executor()
                 {
@@ -180,6 +231,11 @@ namespace ngraph
                                    const std::string& filename);
 
                 const std::vector<PerformanceCounter>& get_perf_counters();
+#if defined(CODEGEN_ENABLE)
+                /// \brief Writes the generated code, its constants and a CMake project building
+                ///        them into a shared library with a C entry point to `directory`.
+                void export_library(const std::string& directory) const;
+#endif
 
             protected:
                 void build(ngraph::pass::PassConfig& pass_config);
@@ -234,6 +290,10 @@ namespace ngraph
                 // Constant ops we need to keep a list of shared_ptr to each Constant
                 // so they don't get freed before we are done with them
                 NodeVector m_active_constants;
+                // The generated translation units by name, and the DNNL descriptors they
+                // read, kept for export_library()
+                std::vector<std::pair<std::string, std::string>> m_codegen_sources;
+                std::string m_dnnl_descriptors;
 #endif
                 static bool is_codegen(const ngraph::pass::PassConfig& pc);
                 std::unordered_set<descriptor::Tensor*>&
@@ -269,8 +329,15 @@ namespace ngraph
                 LayoutDescriptorPtrs result_layout_descriptors;
                 std::vector<size_t> m_memory_buffer_sizes;
                 std::vector<OpAttributes> m_op_attrs;
+                // The parameters each functor reads and the number of functors reading each
+                // parameter, for releasing them to the next call
+                std::vector<std::vector<size_t>> m_op_inputs_read;
+                std::vector<size_t> m_input_reader_counts;
 
                 std::unique_ptr<DNNLEmitter> m_dnnl_emitter;
+                std::unordered_map<const Node*, size_t> m_distributed_request_indices;
+                std::unordered_map<std::string, size_t> m_variable_state_indices;
+                std::unordered_map<const Node*, size_t> m_node_state_indices;
 
                 std::string m_function_name;
 
@@ -281,6 +348,17 @@ namespace ngraph
                     enable_nodename_list;
                 std::function<void(CPURuntimeContext*, std::vector<void*>&, std::vector<void*>&)>
                     executor;
+                // Runs independent functors concurrently when NGRAPH_INTER_OP_PARALLELISM > 1
+                // and TBB is not used, nullptr otherwise
+                std::unique_ptr<CPU_OpScheduler> m_op_scheduler;
+                std::mutex m_op_scheduler_mutex;
+                // Times the functors of every Nth call when NGRAPH_CPU_TIMING_SAMPLE_PERIOD is
+                // N and performance collection is off, nullptr otherwise
+                std::unique_ptr<CPU_OpSampler> m_op_sampler;
+                std::unique_ptr<CPU_MemoryTimeline> m_memory_timeline;
+                // Functors that can build their DNNL primitives alone, see
+                // add_primitive_build_functor
+                std::vector<size_t> m_primitive_build_functors;
                 // name of a tensor and index into the cpu_runtime_context's buffer_data vector to
                 // get the tensor
                 std::unordered_map<std::string, size_t> m_buffer_indices;
@@ -328,6 +406,31 @@ namespace ngraph
                 /// Name of the file to store descriptors for dnnl_primitives
                 const std::string m_desc_filename = "desc_file";
                 EXECUTION_MODE m_execution_mode;
+                // NUMA node the contexts are placed on, -1 if unbound
+                int m_numa_node;
+                // Executor arena all ops run on when the executable has its own threads, on a
+                // NUMA node or a CPU set; otherwise each op scheduler worker uses its own arena
+                bool m_own_arena;
+                int m_arena;
+                // Store the constants are shared through with other executables, or nullptr
+                std::shared_ptr<CPUConstantStore> m_constant_store;
+                // Build each DNNL primitive when its functor first runs rather than all of them
+                // concurrently at the start of the first iteration
+                bool m_defer_primitive_build;
+                // Decompose the fused ops that have native kernels
+                bool m_decompose_fused_ops;
+                // Fault in the pages of the constants and of each context's pools when they
+                // are set up, rather than during the first call
+                bool m_prefault_memory;
+                // Let the op scheduler run independent ops concurrently
+                bool m_inter_op;
+                // Runtime contexts of the call frame, 0 to follow NGRAPH_CPU_CONCURRENCY
+                int m_concurrency;
+                // Recorded type and average microseconds of each op, see CPUTuning::op_profile
+                std::vector<std::pair<std::string, double>> m_op_profile;
+                // Arena shared with other executables to place the activation pools in, or
+                // nullptr for pools of its own
+                std::shared_ptr<CPUActivationArena> m_activation_arena;
             };
         }
     }
@@ -0,0 +1,141 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef __linux__
+#include <dirent.h>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "ngraph/env_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/runtime/cpu/cpu_hw_counters.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+#ifdef __linux__
+static int open_counter(int tid, uint64_t config)
+{
+    perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    // Kernel events need a lower perf_event_paranoid than user space ones
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return static_cast<int>(syscall(__NR_perf_event_open, &attr, tid, -1, -1, 0));
+}
+
+static uint64_t read_counter(int fd)
+{
+    uint64_t value = 0;
+    if (fd < 0 || ::read(fd, &value, sizeof(value)) != sizeof(value))
+    {
+        return 0;
+    }
+    return value;
+}
+#endif
+
+bool runtime::cpu::hw_counters::is_enabled()
+{
+    static bool enabled = getenv_bool("NGRAPH_CPU_HW_COUNTERS");
+    return enabled;
+}
+
+runtime::cpu::hw_counters::ProcessCounters::~ProcessCounters()
+{
+#ifdef __linux__
+    for (const ThreadCounters& thread : m_threads)
+    {
+        for (int fd : thread.fds)
+        {
+            if (fd >= 0)
+            {
+                close(fd);
+            }
+        }
+    }
+#endif
+}
+
+void runtime::cpu::hw_counters::ProcessCounters::refresh()
+{
+#ifdef __linux__
+    lock_guard<mutex> lock(m_mutex);
+    if (m_unavailable)
+    {
+        return;
+    }
+    DIR* tasks = opendir("/proc/self/task");
+    if (tasks == nullptr)
+    {
+        return;
+    }
+    while (dirent* entry = readdir(tasks))
+    {
+        int tid = atoi(entry->d_name);
+        if (tid <= 0 ||
+            any_of(m_threads.begin(), m_threads.end(), [&](const ThreadCounters& thread) {
+                return thread.tid == tid;
+            }))
+        {
+            continue;
+        }
+        ThreadCounters thread{tid,
+                              {open_counter(tid, PERF_COUNT_HW_CPU_CYCLES),
+                               open_counter(tid, PERF_COUNT_HW_INSTRUCTIONS),
+                               open_counter(tid, PERF_COUNT_HW_CACHE_MISSES)}};
+        if (thread.fds[0] < 0 && m_threads.empty())
+        {
+            NGRAPH_WARN << "Hardware counters are unavailable, check perf_event_paranoid";
+            m_unavailable = true;
+            closedir(tasks);
+            return;
+        }
+        m_threads.push_back(thread);
+    }
+    closedir(tasks);
+#endif
+}
+
+runtime::cpu::hw_counters::Values runtime::cpu::hw_counters::ProcessCounters::read()
+{
+    Values values;
+#ifdef __linux__
+    lock_guard<mutex> lock(m_mutex);
+    for (const ThreadCounters& thread : m_threads)
+    {
+        values.cycles += read_counter(thread.fds[0]);
+        values.instructions += read_counter(thread.fds[1]);
+        values.llc_misses += read_counter(thread.fds[2]);
+    }
+#endif
+    return values;
+}
+
+runtime::cpu::hw_counters::ProcessCounters& runtime::cpu::hw_counters::get_process_counters()
+{
+    static ProcessCounters counters;
+    return counters;
+}
@@ -0,0 +1,99 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            // Hardware performance counters read through the Linux perf_event interface, so
+            // that the time of an op can be told apart as compute or memory bound. Enabled with
+            // NGRAPH_CPU_HW_COUNTERS together with NGRAPH_CPU_TRACING or performance
+            // collection. On other platforms, or where perf_event_paranoid forbids it, the
+            // counters read as 0.
+            namespace hw_counters
+            {
+                // Bytes moved by one last level cache miss
+                constexpr uint64_t cache_line_size = 64;
+
+                struct Values
+                {
+                    uint64_t cycles = 0;
+                    uint64_t instructions = 0;
+                    uint64_t llc_misses = 0;
+
+                    Values& operator+=(const Values& other)
+                    {
+                        cycles += other.cycles;
+                        instructions += other.instructions;
+                        llc_misses += other.llc_misses;
+                        return *this;
+                    }
+                    Values operator-(const Values& other) const
+                    {
+                        Values difference;
+                        difference.cycles = cycles - other.cycles;
+                        difference.instructions = instructions - other.instructions;
+                        difference.llc_misses = llc_misses - other.llc_misses;
+                        return difference;
+                    }
+                };
+
+                CPU_BACKEND_API bool is_enabled();
+
+                // Counts the events of all the threads of the process, since the kernels of
+                // one op run on the Eigen and DNNL worker threads rather than on the caller
+                class CPU_BACKEND_API ProcessCounters
+                {
+                public:
+                    ProcessCounters() = default;
+                    ~ProcessCounters();
+
+                    ProcessCounters(const ProcessCounters&) = delete;
+                    ProcessCounters& operator=(const ProcessCounters&) = delete;
+
+                    // Starts counting on the threads created since the last refresh
+                    void refresh();
+                    // Totals over the threads counted so far
+                    Values read();
+
+                private:
+                    struct ThreadCounters
+                    {
+                        int tid;
+                        // cycles, instructions, LLC misses; -1 when unavailable
+                        int fds[3];
+                    };
+
+                    std::mutex m_mutex;
+                    std::vector<ThreadCounters> m_threads;
+                    bool m_unavailable = false;
+                };
+
+                CPU_BACKEND_API ProcessCounters& get_process_counters();
+            }
+        }
+    }
+}
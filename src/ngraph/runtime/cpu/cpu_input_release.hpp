@@ -0,0 +1,104 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <atomic>
+#include <future>
+#include <memory>
+#include <vector>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// \brief Tells the clients of a call when it has read each of its parameters for
+            ///        the last time, so the inputs of the next call can be written into the
+            ///        same tensors while the ops after their last readers still run.
+            ///
+            /// Direct execution starts the count with the number of ops reading each
+            /// parameter, directly or through tensors sharing its buffer, and counts them down
+            /// as they complete. Parameters are otherwise released when the call ends, which
+            /// release_all() marks whatever the way the call ended.
+            class InputRelease
+            {
+            public:
+                explicit InputRelease(size_t inputs)
+                    : m_promises(inputs)
+                    , m_readers(new std::atomic<size_t>[inputs])
+                    , m_released(new std::atomic<bool>[inputs])
+                {
+                    for (size_t i = 0; i < inputs; i++)
+                    {
+                        m_futures.push_back(m_promises[i].get_future().share());
+                        m_readers[i].store(0, std::memory_order_relaxed);
+                        m_released[i].store(false, std::memory_order_relaxed);
+                    }
+                }
+
+                /// \brief Becomes ready once the call no longer reads parameter `input`
+                const std::shared_future<void>& get_future(size_t input) const
+                {
+                    return m_futures.at(input);
+                }
+
+                /// \brief Starts counting down `reader_counts`, releasing the parameters no
+                ///        op reads right away
+                void start(const std::vector<size_t>& reader_counts)
+                {
+                    for (size_t i = 0; i < reader_counts.size() && i < m_promises.size(); i++)
+                    {
+                        m_readers[i].store(reader_counts[i], std::memory_order_relaxed);
+                        if (reader_counts[i] == 0)
+                        {
+                            release(i);
+                        }
+                    }
+                }
+                /// \brief An op reading parameter `input` has completed
+                void read_done(size_t input)
+                {
+                    if (m_readers[input].fetch_sub(1, std::memory_order_acq_rel) == 1)
+                    {
+                        release(input);
+                    }
+                }
+                void release(size_t input)
+                {
+                    if (!m_released[input].exchange(true))
+                    {
+                        m_promises[input].set_value();
+                    }
+                }
+                void release_all()
+                {
+                    for (size_t i = 0; i < m_promises.size(); i++)
+                    {
+                        release(i);
+                    }
+                }
+
+            private:
+                std::vector<std::promise<void>> m_promises;
+                std::vector<std::shared_future<void>> m_futures;
+                std::unique_ptr<std::atomic<size_t>[]> m_readers;
+                std::unique_ptr<std::atomic<bool>[]> m_released;
+            };
+        }
+    }
+}
@@ -0,0 +1,73 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+
+#include "ngraph/check.hpp"
+#include "ngraph/runtime/cpu/cpu_memory_timeline.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::cpu::CPU_MemoryTimeline::CPU_MemoryTimeline(size_t num_ops,
+                                                     vector<Buffer> buffers,
+                                                     size_t host_tensor_bytes,
+                                                     size_t constant_bytes)
+    : m_buffers(move(buffers))
+    , m_live_bytes(num_ops, 0)
+    , m_pool_extent(num_ops, 0)
+    , m_host_tensor_bytes(host_tensor_bytes)
+    , m_constant_bytes(constant_bytes)
+{
+    for (const Buffer& buffer : m_buffers)
+    {
+        NGRAPH_CHECK(buffer.first_op <= buffer.last_op && buffer.last_op < num_ops,
+                     "Buffer ",
+                     buffer.name,
+                     " is used outside of the ops of the timeline");
+        for (size_t op = buffer.first_op; op <= buffer.last_op; op++)
+        {
+            m_live_bytes[op] += buffer.size;
+            m_pool_extent[op] = max(m_pool_extent[op], buffer.offset + buffer.size);
+        }
+    }
+    if (num_ops > 0)
+    {
+        m_peak_op = static_cast<size_t>(max_element(m_live_bytes.begin(), m_live_bytes.end()) -
+                                        m_live_bytes.begin());
+    }
+}
+
+vector<string> runtime::cpu::CPU_MemoryTimeline::get_live_buffers(size_t op) const
+{
+    vector<const Buffer*> live;
+    for (const Buffer& buffer : m_buffers)
+    {
+        if (buffer.first_op <= op && op <= buffer.last_op)
+        {
+            live.push_back(&buffer);
+        }
+    }
+    stable_sort(live.begin(), live.end(), [](const Buffer* b1, const Buffer* b2) {
+        return b1->size > b2->size;
+    });
+    vector<string> names;
+    for (const Buffer* buffer : live)
+    {
+        names.push_back(buffer->name);
+    }
+    return names;
+}
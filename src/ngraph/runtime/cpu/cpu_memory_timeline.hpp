@@ -0,0 +1,79 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            // Memory in use while each op of a CPU executable runs, from the offsets the
+            // temporaries were given in the memory pool and from the functors that use them.
+            // A buffer set of the pool is live from the first op that uses it to the last one,
+            // so the live bytes of an op are what rematerializing or running in place around
+            // it could save, and the extent is the part of the pool the op needs.
+            class CPU_BACKEND_API CPU_MemoryTimeline
+            {
+            public:
+                struct Buffer
+                {
+                    // Name of the first tensor of the buffer set the ops use
+                    std::string name;
+                    size_t offset;
+                    size_t size;
+                    size_t first_op;
+                    size_t last_op;
+                };
+
+                // host_tensor_bytes are those of the inputs and outputs of the function,
+                // which are live during every op, as are the constants
+                CPU_MemoryTimeline(size_t num_ops,
+                                   std::vector<Buffer> buffers,
+                                   size_t host_tensor_bytes,
+                                   size_t constant_bytes);
+
+                size_t get_num_ops() const { return m_live_bytes.size(); }
+                size_t get_live_bytes(size_t op) const { return m_live_bytes.at(op); }
+                // End of the last live buffer in the pool, which is at least the live bytes
+                // and more when the pool is fragmented
+                size_t get_pool_extent(size_t op) const { return m_pool_extent.at(op); }
+                // Names of the buffers live during op, the largest first
+                std::vector<std::string> get_live_buffers(size_t op) const;
+                // The op with the most live bytes, the first of them if several have as many.
+                // 0 if there are no ops.
+                size_t get_peak_op() const { return m_peak_op; }
+                size_t get_host_tensor_bytes() const { return m_host_tensor_bytes; }
+                size_t get_constant_bytes() const { return m_constant_bytes; }
+
+            private:
+                std::vector<Buffer> m_buffers;
+                std::vector<size_t> m_live_bytes;
+                std::vector<size_t> m_pool_extent;
+                size_t m_peak_op{0};
+                size_t m_host_tensor_bytes;
+                size_t m_constant_bytes;
+            };
+        }
+    }
+}
@@ -0,0 +1,160 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "ngraph/log.hpp"
+#include "ngraph/runtime/cpu/cpu_numa.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+#ifdef __linux__
+// Parses sysfs lists such as "0-3,8-11"
+static vector<int> read_list(const string& path)
+{
+    ifstream in(path);
+    string list;
+    if (!(in >> list))
+    {
+        return vector<int>();
+    }
+    return runtime::cpu::numa::parse_cpu_list(list);
+}
+#endif
+
+vector<int> runtime::cpu::numa::parse_cpu_list(const string& list, char separator)
+{
+    vector<int> values;
+    stringstream ss(list);
+    string range;
+    while (getline(ss, range, separator))
+    {
+        if (range.empty())
+        {
+            continue;
+        }
+        size_t dash = range.find('-');
+        int first = stoi(range.substr(0, dash));
+        int last = dash == string::npos ? first : stoi(range.substr(dash + 1));
+        for (int i = first; i <= last; i++)
+        {
+            values.push_back(i);
+        }
+    }
+    return values;
+}
+
+int runtime::cpu::numa::get_node_count()
+{
+#ifdef __linux__
+    static const int count = []() {
+        vector<int> nodes = read_list("/sys/devices/system/node/online");
+        return nodes.empty() ? 1 : nodes.back() + 1;
+    }();
+    return count;
+#else
+    return 1;
+#endif
+}
+
+vector<int> runtime::cpu::numa::get_node_cpus(int node)
+{
+#ifdef __linux__
+    return read_list("/sys/devices/system/node/node" + to_string(node) + "/cpulist");
+#else
+    (void)node;
+    return vector<int>{};
+#endif
+}
+
+bool runtime::cpu::numa::bind_current_thread(int node)
+{
+    return bind_current_thread_to_cpus(get_node_cpus(node));
+}
+
+bool runtime::cpu::numa::bind_current_thread_to_cpus(const vector<int>& cpus)
+{
+#ifdef __linux__
+    if (cpus.empty())
+    {
+        return false;
+    }
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (int cpu : cpus)
+    {
+        CPU_SET(cpu, &cpu_set);
+    }
+    if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) != 0)
+    {
+        NGRAPH_DEBUG << "Failed to bind thread to CPUs " << join(cpus);
+        return false;
+    }
+    return true;
+#else
+    (void)cpus;
+    return false;
+#endif
+}
+
+bool runtime::cpu::numa::bind_memory(void* ptr, size_t size, int node)
+{
+#if defined(__linux__) && defined(SYS_mbind)
+    // Values from <numaif.h>
+    const int mpol_bind = 2;
+    const unsigned mpol_mf_move = 1 << 1;
+
+    size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    size_t begin = (reinterpret_cast<size_t>(ptr) + page_size - 1) / page_size * page_size;
+    size_t end = (reinterpret_cast<size_t>(ptr) + size) / page_size * page_size;
+    const size_t bits_per_mask = 8 * sizeof(unsigned long);
+    if (node < 0 || end <= begin)
+    {
+        return false;
+    }
+    vector<unsigned long> node_mask(node / bits_per_mask + 1, 0);
+    node_mask[node / bits_per_mask] |= 1UL << (node % bits_per_mask);
+    long rc = syscall(SYS_mbind,
+                      reinterpret_cast<void*>(begin),
+                      end - begin,
+                      mpol_bind,
+                      node_mask.data(),
+                      node_mask.size() * bits_per_mask,
+                      mpol_mf_move);
+    if (rc != 0)
+    {
+        NGRAPH_DEBUG << "Failed to bind memory to NUMA node " << node;
+        return false;
+    }
+    return true;
+#else
+    (void)ptr;
+    (void)size;
+    (void)node;
+    return false;
+#endif
+}
@@ -0,0 +1,59 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            // Minimal NUMA support read from sysfs and the Linux affinity and memory policy
+            // syscalls, so no libnuma dependency is needed. On other platforms the machine is
+            // reported as a single node and binding is a no-op.
+            namespace numa
+            {
+                // Number of NUMA nodes, 1 when the topology is unavailable
+                CPU_BACKEND_API int get_node_count();
+
+                // CPUs belonging to node, empty when unknown
+                CPU_BACKEND_API std::vector<int> get_node_cpus(int node);
+
+                // Restricts the calling thread to the CPUs of node
+                CPU_BACKEND_API bool bind_current_thread(int node);
+
+                // Restricts the calling thread to cpus
+                CPU_BACKEND_API bool bind_current_thread_to_cpus(const std::vector<int>& cpus);
+
+                // CPUs of a list such as "0-3,8-11". Another separator than the comma lets the
+                // list appear inside a comma separated backend config.
+                CPU_BACKEND_API std::vector<int> parse_cpu_list(const std::string& list,
+                                                                char separator = ',');
+
+                // Places the pages of [ptr, ptr + size) on node, migrating pages already
+                // touched. Only whole pages inside the range are affected.
+                CPU_BACKEND_API bool bind_memory(void* ptr, size_t size, int node);
+            }
+        }
+    }
+}
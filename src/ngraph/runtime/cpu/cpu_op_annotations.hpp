@@ -18,6 +18,7 @@
 
 #include <functional>
 #include <memory>
+#include <vector>
 
 #include "ngraph/op/util/op_annotations.hpp"
 
@@ -34,9 +35,20 @@ namespace ngraph
                 CPUOpAnnotations() {}
                 bool is_dnnl_op() { return m_dnnl_op; }
                 void set_dnnl_op(bool val) { m_dnnl_op = val; }
+                /// \brief Adds a destructive pair that CPUMemoryAssignment may take if the
+                ///        input dies at the op. Only a pair it takes becomes an in-place pair.
+                void add_in_place_candidate(const ngraph::op::util::oi_pair& oi)
+                {
+                    m_in_place_candidates.push_back(oi);
+                }
+                const std::vector<ngraph::op::util::oi_pair>& get_in_place_candidates() const
+                {
+                    return m_in_place_candidates;
+                }
 
             private:
                 bool m_dnnl_op = false;
+                std::vector<ngraph::op::util::oi_pair> m_in_place_candidates;
             };
 
             std::function<std::shared_ptr<ngraph::op::util::OpAnnotations>(void)>
@@ -0,0 +1,121 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <unordered_map>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define NGRAPH_HAS_TSC
+#elif defined(_M_X64)
+#include <intrin.h>
+#define NGRAPH_HAS_TSC
+#endif
+
+#include "ngraph/runtime/cpu/cpu_op_sampler.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static atomic<uint64_t> s_next_sampler_id{0};
+
+runtime::cpu::CPU_OpSampler::ThreadCounters::ThreadCounters(size_t num_ops)
+    // Padded by a cache line so that no two threads write to the same one
+    : values(new atomic<uint64_t>[2 * num_ops + 8])
+{
+    for (size_t i = 0; i < 2 * num_ops + 8; i++)
+    {
+        values[i].store(0, memory_order_relaxed);
+    }
+}
+
+runtime::cpu::CPU_OpSampler::CPU_OpSampler(size_t num_ops, size_t period)
+    : m_num_ops(num_ops)
+    , m_period(period == 0 ? 1 : period)
+    , m_id(s_next_sampler_id++)
+    , m_start_ticks(now())
+    , m_start_time(chrono::steady_clock::now())
+{
+}
+
+uint64_t runtime::cpu::CPU_OpSampler::now()
+{
+#if defined(NGRAPH_HAS_TSC)
+    return __rdtsc();
+#else
+    return chrono::duration_cast<chrono::nanoseconds>(
+               chrono::steady_clock::now().time_since_epoch())
+        .count();
+#endif
+}
+
+runtime::cpu::CPU_OpSampler::ThreadCounters& runtime::cpu::CPU_OpSampler::get_thread_counters()
+{
+    thread_local unordered_map<uint64_t, ThreadCounters*> thread_counters;
+    auto it = thread_counters.find(m_id);
+    if (it != thread_counters.end())
+    {
+        return *it->second;
+    }
+    // Once per thread and sampler
+    lock_guard<mutex> lock(m_threads_mutex);
+    m_threads.emplace_back(new ThreadCounters(m_num_ops));
+    thread_counters[m_id] = m_threads.back().get();
+    return *m_threads.back();
+}
+
+void runtime::cpu::CPU_OpSampler::record(size_t op, uint64_t ticks)
+{
+    ThreadCounters& counters = get_thread_counters();
+    // Only this thread writes its counters, so no read-modify-write is needed
+    atomic<uint64_t>& total = counters.values[2 * op];
+    atomic<uint64_t>& calls = counters.values[2 * op + 1];
+    total.store(total.load(memory_order_relaxed) + ticks, memory_order_relaxed);
+    calls.store(calls.load(memory_order_relaxed) + 1, memory_order_relaxed);
+}
+
+double runtime::cpu::CPU_OpSampler::get_ticks_per_microsecond() const
+{
+#if defined(NGRAPH_HAS_TSC)
+    double elapsed = chrono::duration<double, micro>(chrono::steady_clock::now() - m_start_time)
+                         .count();
+    return elapsed > 0 ? (now() - m_start_ticks) / elapsed : 1;
+#else
+    return 1000;
+#endif
+}
+
+vector<runtime::cpu::CPU_OpSampler::OpTime> runtime::cpu::CPU_OpSampler::get_op_times()
+{
+    vector<uint64_t> ticks(m_num_ops, 0);
+    vector<OpTime> times(m_num_ops, OpTime{0, 0});
+    {
+        lock_guard<mutex> lock(m_threads_mutex);
+        for (const unique_ptr<ThreadCounters>& counters : m_threads)
+        {
+            for (size_t op = 0; op < m_num_ops; op++)
+            {
+                ticks[op] += counters->values[2 * op].load(memory_order_relaxed);
+                times[op].calls += counters->values[2 * op + 1].load(memory_order_relaxed);
+            }
+        }
+    }
+    double ticks_per_microsecond = get_ticks_per_microsecond();
+    for (size_t op = 0; op < m_num_ops; op++)
+    {
+        times[op].microseconds = static_cast<size_t>(ticks[op] / ticks_per_microsecond);
+    }
+    return times;
+}
@@ -0,0 +1,97 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            // Times the ops of every period-th call only, cheaply enough to stay on in
+            // production. Ticks are read from the time stamp counter where there is one, and
+            // are added up by every thread in counters of its own, so recording takes no lock
+            // and does not share cache lines between threads. The counters are only summed
+            // when they are read.
+            class CPU_BACKEND_API CPU_OpSampler
+            {
+            public:
+                CPU_OpSampler(size_t num_ops, size_t period);
+
+                // Whether the ops of the call starting now are to be timed
+                bool sample_call()
+                {
+                    return m_calls.fetch_add(1, std::memory_order_relaxed) % m_period == 0;
+                }
+
+                static uint64_t now();
+
+                // Adds the duration of a sampled run of op, in ticks of now()
+                void record(size_t op, uint64_t ticks);
+
+                struct OpTime
+                {
+                    size_t microseconds;
+                    size_t calls;
+                };
+                // Totals over all the threads of the sampled runs of every op
+                std::vector<OpTime> get_op_times();
+
+                size_t get_period() const { return m_period; }
+
+            private:
+                CPU_OpSampler(const CPU_OpSampler&) = delete;
+                CPU_OpSampler& operator=(const CPU_OpSampler&) = delete;
+
+                struct ThreadCounters
+                {
+                    explicit ThreadCounters(size_t num_ops);
+
+                    // ticks and calls of op i are at 2 * i and 2 * i + 1
+                    std::unique_ptr<std::atomic<uint64_t>[]> values;
+                };
+
+                ThreadCounters& get_thread_counters();
+                double get_ticks_per_microsecond() const;
+
+                size_t m_num_ops;
+                size_t m_period;
+                // Identifies the sampler in the thread local counter lists, which might
+                // outlive it
+                uint64_t m_id;
+                std::atomic<uint64_t> m_calls{0};
+                std::mutex m_threads_mutex;
+                std::vector<std::unique_ptr<ThreadCounters>> m_threads;
+
+                // The tick rate is measured against the steady clock over the life of the
+                // sampler, so it gets more accurate the longer profiling stays on
+                uint64_t m_start_ticks;
+                std::chrono::steady_clock::time_point m_start_time;
+            };
+        }
+    }
+}
@@ -0,0 +1,229 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+
+#include "ngraph/runtime/cpu/cpu_op_scheduler.hpp"
+#include "ngraph/check.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::cpu::CPU_OpScheduler::CPU_OpScheduler(vector<vector<size_t>> successors,
+                                               size_t num_workers,
+                                               vector<double> priorities)
+    : m_successors(move(successors))
+    , m_num_predecessors(m_successors.size(), 0)
+    , m_pending(new atomic<size_t>[m_successors.size()])
+    , m_concurrency(m_successors.size(), 0)
+{
+    NGRAPH_CHECK(num_workers > 0, "CPU_OpScheduler needs at least one worker");
+    for (const vector<size_t>& op_successors : m_successors)
+    {
+        for (size_t successor : op_successors)
+        {
+            NGRAPH_CHECK(successor < m_successors.size(), "Invalid successor ", successor);
+            m_num_predecessors[successor]++;
+        }
+    }
+    for (size_t op = 0; op < m_successors.size(); op++)
+    {
+        if (m_num_predecessors[op] == 0)
+        {
+            m_roots.push_back(op);
+        }
+    }
+    if (!priorities.empty())
+    {
+        NGRAPH_CHECK(priorities.size() == m_successors.size(),
+                     "CPU_OpScheduler needs a priority for every op");
+        // Queues are popped from the back, so ops are queued in order of increasing priority
+        auto lower = [&priorities](size_t a, size_t b) { return priorities[a] < priorities[b]; };
+        stable_sort(m_roots.begin(), m_roots.end(), lower);
+        for (vector<size_t>& op_successors : m_successors)
+        {
+            stable_sort(op_successors.begin(), op_successors.end(), lower);
+        }
+    }
+    for (size_t i = 0; i < num_workers; i++)
+    {
+        m_workers.emplace_back(new Worker());
+    }
+    // Worker 0 is the thread calling run()
+    for (size_t i = 1; i < num_workers; i++)
+    {
+        m_threads.emplace_back(&CPU_OpScheduler::worker_loop, this, i);
+    }
+}
+
+runtime::cpu::CPU_OpScheduler::~CPU_OpScheduler()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_shutdown = true;
+    }
+    m_start_cv.notify_all();
+    for (thread& t : m_threads)
+    {
+        t.join();
+    }
+}
+
+void runtime::cpu::CPU_OpScheduler::run(const function<void(size_t, size_t)>& task)
+{
+    if (m_successors.empty())
+    {
+        return;
+    }
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_task = &task;
+        m_failed = false;
+        m_exception = nullptr;
+        m_running = 0;
+        for (size_t op = 0; op < m_successors.size(); op++)
+        {
+            m_pending[op] = m_num_predecessors[op];
+        }
+        for (size_t i = 0; i < m_roots.size(); i++)
+        {
+            push(i % m_workers.size(), m_roots[i]);
+        }
+        m_remaining = m_successors.size();
+        m_active_workers = m_threads.size();
+        m_generation++;
+    }
+    m_start_cv.notify_all();
+
+    drain(0);
+
+    // The task must stay valid until every worker has left this run
+    unique_lock<mutex> lock(m_mutex);
+    m_done_cv.wait(lock, [this]() { return m_active_workers == 0; });
+    m_task = nullptr;
+    if (m_exception)
+    {
+        rethrow_exception(m_exception);
+    }
+}
+
+void runtime::cpu::CPU_OpScheduler::worker_loop(size_t worker)
+{
+    size_t generation = 0;
+    while (true)
+    {
+        {
+            unique_lock<mutex> lock(m_mutex);
+            m_start_cv.wait(lock,
+                            [&]() { return m_shutdown || m_generation != generation; });
+            if (m_shutdown)
+            {
+                return;
+            }
+            generation = m_generation;
+        }
+        drain(worker);
+        {
+            lock_guard<mutex> lock(m_mutex);
+            if (--m_active_workers == 0)
+            {
+                m_done_cv.notify_all();
+            }
+        }
+    }
+}
+
+void runtime::cpu::CPU_OpScheduler::drain(size_t worker)
+{
+    while (m_remaining > 0)
+    {
+        size_t op;
+        if (try_get(worker, op))
+        {
+            execute(op, worker);
+        }
+        else
+        {
+            this_thread::yield();
+        }
+    }
+}
+
+bool runtime::cpu::CPU_OpScheduler::try_get(size_t worker, size_t& op)
+{
+    {
+        Worker& own = *m_workers[worker];
+        lock_guard<mutex> lock(own.mutex);
+        if (!own.queue.empty())
+        {
+            op = own.queue.back();
+            own.queue.pop_back();
+            return true;
+        }
+    }
+    for (size_t i = 1; i < m_workers.size(); i++)
+    {
+        Worker& victim = *m_workers[(worker + i) % m_workers.size()];
+        lock_guard<mutex> lock(victim.mutex);
+        if (!victim.queue.empty())
+        {
+            op = victim.queue.front();
+            victim.queue.pop_front();
+            m_steal_count++;
+            return true;
+        }
+    }
+    return false;
+}
+
+void runtime::cpu::CPU_OpScheduler::push(size_t worker, size_t op)
+{
+    Worker& w = *m_workers[worker];
+    lock_guard<mutex> lock(w.mutex);
+    w.queue.push_back(op);
+}
+
+void runtime::cpu::CPU_OpScheduler::execute(size_t op, size_t worker)
+{
+    // After a failure the remaining ops are retired without running so the run drains
+    if (!m_failed)
+    {
+        m_concurrency[op] = ++m_running;
+        try
+        {
+            (*m_task)(op, worker);
+        }
+        catch (...)
+        {
+            lock_guard<mutex> lock(m_mutex);
+            if (!m_exception)
+            {
+                m_exception = current_exception();
+            }
+            m_failed = true;
+        }
+        --m_running;
+    }
+    for (size_t successor : m_successors[op])
+    {
+        if (--m_pending[successor] == 0)
+        {
+            push(worker, successor);
+        }
+    }
+    // Only retire the op once its successors are queued, otherwise workers could leave early
+    --m_remaining;
+}
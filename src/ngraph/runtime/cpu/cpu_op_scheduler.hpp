@@ -0,0 +1,104 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            // Runs a DAG of ops on a set of workers. Each worker owns a queue of ready ops, pops
+            // from its back and steals from the front of the other queues when it runs dry.
+            // An op becomes ready once all of its predecessors have completed.
+            class CPU_BACKEND_API CPU_OpScheduler
+            {
+            public:
+                // successors[i] lists the ops that may only start once op i has completed.
+                // num_workers includes the thread calling run(). When given, a worker starts
+                // the ready ops it owns in order of decreasing priority.
+                CPU_OpScheduler(std::vector<std::vector<size_t>> successors,
+                                size_t num_workers,
+                                std::vector<double> priorities = std::vector<double>());
+                ~CPU_OpScheduler();
+
+                // Calls task(op, worker) once for every op and returns when all have completed.
+                // If a task throws no further ops are started and the first exception is
+                // rethrown. Not reentrant.
+                void run(const std::function<void(size_t, size_t)>& task);
+
+                size_t get_num_workers() const { return m_workers.size(); }
+                // Number of ops running, including itself, when op was started by the last run
+                size_t get_concurrency(size_t op) const { return m_concurrency[op]; }
+                // Total number of ops taken from another worker's queue
+                size_t get_steal_count() const { return m_steal_count; }
+
+            private:
+                CPU_OpScheduler(const CPU_OpScheduler&) = delete;
+                CPU_OpScheduler& operator=(const CPU_OpScheduler&) = delete;
+
+                struct Worker
+                {
+                    std::mutex mutex;
+                    std::deque<size_t> queue;
+                };
+
+                void worker_loop(size_t worker);
+                void drain(size_t worker);
+                bool try_get(size_t worker, size_t& op);
+                void push(size_t worker, size_t op);
+                void execute(size_t op, size_t worker);
+
+                std::vector<std::vector<size_t>> m_successors;
+                // Ops without predecessors, in the order they are queued
+                std::vector<size_t> m_roots;
+                std::vector<size_t> m_num_predecessors;
+                std::unique_ptr<std::atomic<size_t>[]> m_pending;
+                std::vector<size_t> m_concurrency;
+                std::vector<std::unique_ptr<Worker>> m_workers;
+                std::vector<std::thread> m_threads;
+
+                const std::function<void(size_t, size_t)>* m_task{nullptr};
+                std::atomic<size_t> m_remaining{0};
+                std::atomic<size_t> m_running{0};
+                std::atomic<bool> m_failed{false};
+                std::atomic<size_t> m_steal_count{0};
+                std::exception_ptr m_exception;
+
+                std::mutex m_mutex;
+                std::condition_variable m_start_cv;
+                std::condition_variable m_done_cv;
+                size_t m_generation{0};
+                size_t m_active_workers{0};
+                bool m_shutdown{false};
+            };
+        }
+    }
+}
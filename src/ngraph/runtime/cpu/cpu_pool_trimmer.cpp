@@ -0,0 +1,140 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
+#include "ngraph/env_util.hpp"
+#include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/runtime/cpu/cpu_pool_trimmer.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::cpu::CPU_PoolTrimmer& runtime::cpu::CPU_PoolTrimmer::get()
+{
+    static CPU_PoolTrimmer trimmer;
+    return trimmer;
+}
+
+runtime::cpu::CPU_PoolTrimmer::CPU_PoolTrimmer()
+{
+    int32_t limit_mb = getenv_int("NGRAPH_CPU_POOL_LIMIT_MB", 0);
+    m_limit_bytes = limit_mb > 0 ? static_cast<size_t>(limit_mb) << 20 : 0;
+    int32_t idle_ms = getenv_int("NGRAPH_CPU_IDLE_TRIM_MS", 0);
+    m_idle_period = chrono::milliseconds(idle_ms > 0 ? idle_ms : 0);
+    if (m_idle_period.count() > 0)
+    {
+        m_thread = thread(&CPU_PoolTrimmer::trim_loop, this);
+    }
+}
+
+runtime::cpu::CPU_PoolTrimmer::~CPU_PoolTrimmer()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_stop_cv.notify_all();
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+}
+
+void runtime::cpu::CPU_PoolTrimmer::add(CPU_CallFrame* call_frame)
+{
+    lock_guard<mutex> lock(m_mutex);
+    m_call_frames.insert(call_frame);
+}
+
+void runtime::cpu::CPU_PoolTrimmer::remove(CPU_CallFrame* call_frame)
+{
+    // Taking the lock also waits for a trim that may be freeing pools of the call frame
+    lock_guard<mutex> lock(m_mutex);
+    m_call_frames.erase(call_frame);
+}
+
+void runtime::cpu::CPU_PoolTrimmer::reserve(size_t bytes)
+{
+    if (m_limit_bytes > 0 && m_pool_bytes + bytes > m_limit_bytes)
+    {
+        trim_to_limit(bytes);
+    }
+    m_pool_bytes += bytes;
+}
+
+void runtime::cpu::CPU_PoolTrimmer::release(size_t bytes)
+{
+    m_pool_bytes -= bytes;
+}
+
+size_t runtime::cpu::CPU_PoolTrimmer::trim(Clock::time_point idle_before)
+{
+    lock_guard<mutex> lock(m_mutex);
+    size_t freed = 0;
+    for (CPU_CallFrame* call_frame : m_call_frames)
+    {
+        freed += call_frame->trim_idle_contexts(idle_before);
+    }
+    return freed;
+}
+
+void runtime::cpu::CPU_PoolTrimmer::trim_to_limit(size_t bytes)
+{
+    lock_guard<mutex> lock(m_mutex);
+    vector<tuple<Clock::time_point, CPU_CallFrame*, size_t>> pools;
+    for (CPU_CallFrame* call_frame : m_call_frames)
+    {
+        for (size_t id = 0; id < call_frame->get_num_contexts(); id++)
+        {
+            if (call_frame->get_pool_bytes(id) > 0)
+            {
+                pools.emplace_back(call_frame->get_last_used(id), call_frame, id);
+            }
+        }
+    }
+    sort(pools.begin(), pools.end());
+    for (auto& pool : pools)
+    {
+        if (m_pool_bytes + bytes <= m_limit_bytes)
+        {
+            break;
+        }
+        // Pools of busy contexts are skipped
+        std::get<1>(pool)->trim_context(std::get<2>(pool), Clock::time_point::max());
+    }
+}
+
+void runtime::cpu::CPU_PoolTrimmer::trim_loop()
+{
+    unique_lock<mutex> lock(m_mutex);
+    while (!m_stop)
+    {
+        // Pools are freed between one and one and a half idle periods after their last call
+        m_stop_cv.wait_for(lock, m_idle_period / 2);
+        if (m_stop)
+        {
+            return;
+        }
+        auto idle_before = Clock::now() - m_idle_period;
+        for (CPU_CallFrame* call_frame : m_call_frames)
+        {
+            call_frame->trim_idle_contexts(idle_before);
+        }
+    }
+}
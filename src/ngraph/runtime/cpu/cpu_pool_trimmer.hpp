@@ -0,0 +1,85 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            class CPU_CallFrame;
+
+            // Frees the activation pools of idle runtime contexts across all the direct
+            // execution call frames of the process. Pools unused for NGRAPH_CPU_IDLE_TRIM_MS
+            // are freed by a background thread, and the least recently used idle pools are
+            // freed whenever allocating another would take the total over
+            // NGRAPH_CPU_POOL_LIMIT_MB. A context reallocates its pools on its next call.
+            class CPU_BACKEND_API CPU_PoolTrimmer
+            {
+            public:
+                using Clock = std::chrono::steady_clock;
+
+                static CPU_PoolTrimmer& get();
+                ~CPU_PoolTrimmer();
+
+                void add(CPU_CallFrame* call_frame);
+                void remove(CPU_CallFrame* call_frame);
+
+                // Accounts for `bytes` of pools about to be allocated. Pools of busy contexts
+                // are never freed, so the limit may be exceeded rather than wait.
+                void reserve(size_t bytes);
+                void release(size_t bytes);
+                // Bytes of activation pools currently allocated
+                size_t get_pool_bytes() const { return m_pool_bytes; }
+                // Frees the pools of the contexts not used since `idle_before`
+                // \returns The bytes freed
+                size_t trim(Clock::time_point idle_before);
+
+            private:
+                CPU_PoolTrimmer();
+                CPU_PoolTrimmer(const CPU_PoolTrimmer&) = delete;
+                CPU_PoolTrimmer& operator=(const CPU_PoolTrimmer&) = delete;
+
+                void trim_loop();
+                // Frees the least recently used idle pools until `bytes` more fit the limit
+                void trim_to_limit(size_t bytes);
+
+                std::atomic<size_t> m_pool_bytes{0};
+                size_t m_limit_bytes;
+                std::chrono::milliseconds m_idle_period;
+
+                std::mutex m_mutex;
+                std::condition_variable m_stop_cv;
+                std::set<CPU_CallFrame*> m_call_frames;
+                bool m_stop{false};
+                std::thread m_thread;
+            };
+        }
+    }
+}
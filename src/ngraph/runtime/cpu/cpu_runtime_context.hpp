@@ -16,8 +16,10 @@
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
 #include <cstdint>
+#include <memory>
 #include <set>
 
 #if defined(NGRAPH_TBB_ENABLE)
@@ -47,7 +49,17 @@ namespace ngraph
     namespace runtime
     {
         class AlignedBuffer;
+        namespace cpu
+        {
+            class CancellationToken;
+            class InputRelease;
+            namespace hw_counters
+            {
+                struct Values;
+            }
+        }
     }
+    class DistributedRequest;
     class State;
 }
 
@@ -61,12 +73,25 @@ namespace ngraph
             typedef std::chrono::time_point<Clock> Timestamp;
             typedef std::chrono::microseconds Timescale;
 
+            /// Priority of a call relative to the calls running concurrently on the other
+            /// contexts. Between ops, a call waits while calls of a higher priority run.
+            enum class CallPriority
+            {
+                Background,
+                Normal,
+                High
+            };
+
             extern "C" {
             struct CPURuntimeContext
             {
                 int64_t* op_durations;
+                // Hardware counts of every op for the timeline, when counters are enabled
+                hw_counters::Values* op_counters;
                 bool* p_en;
                 bool first_iteration;
+                // Set while DNNL functors are only asked to build their primitives
+                bool build_primitives_only;
                 // stores tensor pointers
                 std::vector<void*> buffer_data;
                 std::vector<dnnl::memory*> dnnl_memories;
@@ -75,6 +100,8 @@ namespace ngraph
                 std::vector<dnnl::memory::desc*> dnnl_scratchpad_mds;
                 AlignedBuffer* scratchpad_buffer;
                 std::vector<char*> dnnl_workspaces;
+                // Collectives started by an op and waited on by a later one
+                std::vector<std::unique_ptr<DistributedRequest>> distributed_requests;
 #if defined(NGRAPH_TBB_ENABLE)
                 tbb::flow::graph* G;
                 tbb::global_control* c;
@@ -82,12 +109,22 @@ namespace ngraph
                 State* const* states;
                 std::set<size_t> breakpoints;
                 size_t pc;
+                // Index of the context in its call frame, which tags the trace events of its ops
+                size_t context_index;
+                // Priority of the call running on the context
+                CallPriority priority;
+                // Token stopping the call running on the context between ops, or nullptr
+                const CancellationToken* cancellation;
+                // Set when the call stopped before running all its ops
+                std::atomic<bool> cancelled;
+                // Told when the ops reading each parameter are done, or nullptr
+                InputRelease* input_release;
 #ifdef NGRAPH_CPU_MLIR_ENABLE
-                /// Maps CompiledKernel nodes to their MLIR compiler
-                /// The MLIR compiler caches the compiled code on the first invocation,
-                /// and may in the future support re-compilation
+                /// Maps CompiledKernel nodes to their MLIR runtime
+                /// The runtime is compiled on the first invocation and is shared with the
+                /// identical sub-graphs through the MLIRCPURuntimeCache
                 std::unordered_map<ngraph::op::v0::CompiledKernel*,
-                                   ngraph::runtime::ngmlir::MLIRCPURuntime>
+                                   std::shared_ptr<ngraph::runtime::ngmlir::MLIRCPURuntime>>
                     mlir_runtimes;
 #endif
             };
@@ -77,6 +77,94 @@ runtime::cpu::CPUTensor::CPUTensor(const ngraph::element::Type& element_type, co
 {
 }
 
+runtime::cpu::CPUTensor::CPUTensor(const shared_ptr<CPUTensor>& base,
+                                   const Shape& shape,
+                                   size_t offset,
+                                   const Strides& strides)
+    : CPUTensor(base->get_element_type(),
+                shape,
+                base->get_data_ptr() + offset * base->get_element_type().size())
+{
+    NGRAPH_CHECK(strides.size() == shape.size(),
+                 "View strides ",
+                 strides,
+                 " do not match its shape ",
+                 shape);
+    NGRAPH_CHECK(base->m_dense && !base->needs_layout_conversion(),
+                 "Views need a dense base tensor in the row-major layout");
+    size_t last = offset;
+    for (size_t i = 0; i < shape.size(); i++)
+    {
+        last += shape[i] == 0 ? 0 : (shape[i] - 1) * strides[i];
+    }
+    NGRAPH_CHECK(shape_size(shape) == 0 || last < base->get_element_count(),
+                 "View of shape ",
+                 shape,
+                 " at ",
+                 offset,
+                 " with strides ",
+                 strides,
+                 " is past the end of its base of shape ",
+                 base->get_shape());
+    m_base = base->m_base ? base->m_base : base;
+    m_strides = strides;
+    // Strides of size-1 axes are never used
+    Strides dense_strides = row_major_strides(shape);
+    for (size_t i = 0; i < shape.size(); i++)
+    {
+        m_dense = m_dense && (shape[i] == 1 || strides[i] == dense_strides[i]);
+    }
+}
+
+ngraph::Strides runtime::cpu::CPUTensor::get_strides() const
+{
+    return m_base ? m_strides : runtime::Tensor::get_strides();
+}
+
+void runtime::cpu::CPUTensor::copy_strided(char* data, size_t n, bool to_view) const
+{
+    const Shape& shape = get_shape();
+    size_t element_size = get_element_type().size();
+    size_t count = n / element_size;
+    size_t rank = shape.size();
+    // The innermost axis is copied element by element, the others are walked by an odometer
+    size_t inner = rank == 0 ? 1 : shape[rank - 1];
+    size_t inner_stride = (rank == 0 ? 0 : m_strides[rank - 1]) * element_size;
+    vector<size_t> coordinate(rank, 0);
+    char* view = aligned_buffer;
+    for (size_t first = 0; first < count && inner > 0; first += inner)
+    {
+        size_t offset = 0;
+        for (size_t i = 0; i + 1 < rank; i++)
+        {
+            offset += coordinate[i] * m_strides[i];
+        }
+        char* line = view + offset * element_size;
+        size_t elements = min(inner, count - first);
+        for (size_t j = 0; j < elements; j++)
+        {
+            char* element = line + j * inner_stride;
+            char* dense = data + (first + j) * element_size;
+            if (to_view)
+            {
+                memcpy(element, dense, element_size);
+            }
+            else
+            {
+                memcpy(dense, element, element_size);
+            }
+        }
+        for (size_t i = rank > 0 ? rank - 1 : 0; i-- > 0;)
+        {
+            if (++coordinate[i] < shape[i])
+            {
+                break;
+            }
+            coordinate[i] = 0;
+        }
+    }
+}
+
 runtime::cpu::CPUTensor::~CPUTensor()
 {
     ngraph_free(buffer);
@@ -94,57 +182,45 @@ const char* runtime::cpu::CPUTensor::get_data_ptr() const
 
 void runtime::cpu::CPUTensor::write(const void* source, size_t n)
 {
+    wait_for_write_ready();
     if (n > buffer_size)
     {
         throw out_of_range("write access past end of tensor");
     }
+    if (!m_dense)
+    {
+        copy_strided(static_cast<char*>(const_cast<void*>(source)), n, true);
+        return;
+    }
     char* target = get_data_ptr();
     memcpy(target, source, n);
 }
 
 void runtime::cpu::CPUTensor::read(void* target, size_t n) const
 {
+    wait_for_read_ready();
     if (n > buffer_size)
     {
         throw out_of_range("read access past end of tensor");
     }
 
-    auto tvl = this->get_tensor_layout();
-    auto cpu_tvl = dynamic_cast<runtime::cpu::LayoutDescriptor*>(tvl.get());
-
-    auto needs_conversion = [&]() {
-        if (!cpu_tvl)
-        {
-            return false;
-        }
-        if (!cpu_tvl->is_dnnl_layout())
-        {
-            return false;
-        }
-        if (cpu_tvl->get_size() <= 1)
-        {
-            return false;
-        }
-        auto native_md = dnnl_utils::create_blocked_dnnl_md(
-            this->get_shape(), cpu_tvl->get_strides(), this->get_element_type());
-        if (dnnl_utils::compare_dnnl_mds(cpu_tvl->get_dnnl_md(), native_md))
-        {
-            return false;
-        }
-        return true;
-    };
-
-    if (needs_conversion())
+    if (!m_dense)
+    {
+        copy_strided(static_cast<char*>(target), n, false);
+    }
+    else if (needs_layout_conversion())
     {
+        auto tvl = this->get_tensor_layout();
+        auto cpu_tvl = static_cast<runtime::cpu::LayoutDescriptor*>(tvl.get());
         auto tensor_shape = this->get_shape();
         auto input_desc = cpu_tvl->get_dnnl_md();
         auto output_desc = dnnl_utils::create_blocked_dnnl_md(
             this->get_shape(), cpu_tvl->get_strides(), this->get_element_type());
 
-        memory input{input_desc, executor::global_cpu_engine, aligned_buffer};
-        memory output{output_desc, executor::global_cpu_engine, target};
+        memory input{input_desc, executor::get_cpu_engine(), aligned_buffer};
+        memory output{output_desc, executor::get_cpu_engine(), target};
         reorder prim{input, output};
-        dnnl::stream s(executor::global_cpu_engine);
+        dnnl::stream s = executor::GetCPUExecutor().create_dnnl_stream();
         prim.execute(s, {{DNNL_ARG_SRC, input}, {DNNL_ARG_DST, output}});
         s.wait();
     }
@@ -155,6 +231,36 @@ void runtime::cpu::CPUTensor::read(void* target, size_t n) const
     }
 }
 
+bool runtime::cpu::CPUTensor::needs_layout_conversion() const
+{
+    auto tvl = this->get_tensor_layout();
+    auto cpu_tvl = dynamic_cast<runtime::cpu::LayoutDescriptor*>(tvl.get());
+    if (!cpu_tvl)
+    {
+        return false;
+    }
+    if (!cpu_tvl->is_dnnl_layout())
+    {
+        return false;
+    }
+    if (cpu_tvl->get_size() <= 1)
+    {
+        return false;
+    }
+    auto native_md = dnnl_utils::create_blocked_dnnl_md(
+        this->get_shape(), cpu_tvl->get_strides(), this->get_element_type());
+    if (dnnl_utils::compare_dnnl_mds(cpu_tvl->get_dnnl_md(), native_md))
+    {
+        return false;
+    }
+    return true;
+}
+
+void* runtime::cpu::CPUTensor::get_host_data_ptr()
+{
+    return !m_dense || needs_layout_conversion() ? nullptr : get_data_ptr();
+}
+
 void runtime::cpu::CPUTensor::copy_from(const ngraph::runtime::Tensor& source)
 {
     if (get_element_count() != source.get_element_count())
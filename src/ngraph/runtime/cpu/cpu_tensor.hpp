@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 
 #include "ngraph/runtime/cpu/cpu_backend_visibility.h"
@@ -39,8 +40,23 @@ namespace ngraph
                 CPU_BACKEND_API CPUTensor(const ngraph::element::Type& element_type,
                                           const Shape& shape,
                                           void* memory_pointer);
+                /// \brief A view of `shape` elements of `base`, sharing its memory.
+                /// \param offset Row-major index in `base` of the first element of the view
+                /// \param strides Distance in elements of `base` between neighbours along each
+                ///        axis of the view
+                CPU_BACKEND_API CPUTensor(const std::shared_ptr<CPUTensor>& base,
+                                          const Shape& shape,
+                                          size_t offset,
+                                          const Strides& strides);
                 CPU_BACKEND_API virtual ~CPUTensor() override;
 
+                /// \brief Element strides of a view, row-major strides otherwise
+                Strides get_strides() const override;
+                bool is_view() const { return m_base != nullptr; }
+                /// \brief false for views whose elements are not contiguous and in row-major
+                ///        order, which calls gather into or scatter from a dense buffer
+                bool is_dense() const { return m_dense; }
+
                 CPU_BACKEND_API char* get_data_ptr();
                 CPU_BACKEND_API const char* get_data_ptr() const;
 
@@ -54,6 +70,10 @@ namespace ngraph
                 /// \param n Number of bytes to read, must be integral number of elements.
                 void read(void* p, size_t n) const override;
 
+                /// \brief The data of the tensor, nullptr if it has a DNNL layout other than the
+                /// row-major one
+                void* get_host_data_ptr() override;
+
                 /// \brief copy bytes directly from source to this tensor
                 /// \param source The source tensor
                 void copy_from(const ngraph::runtime::Tensor& source) override;
@@ -64,10 +84,17 @@ namespace ngraph
                 CPUTensor(const CPUTensor&) = delete;
                 CPUTensor(CPUTensor&&) = delete;
                 CPUTensor& operator=(const CPUTensor&) = delete;
+                bool needs_layout_conversion() const;
+
+                /// Copies between the elements of a strided view and dense `data`
+                void copy_strided(char* data, size_t n, bool to_view) const;
 
                 char* buffer;
                 char* aligned_buffer;
                 size_t buffer_size;
+                std::shared_ptr<CPUTensor> m_base;
+                Strides m_strides;
+                bool m_dense = true;
             };
         }
     }
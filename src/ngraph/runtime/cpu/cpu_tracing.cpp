@@ -32,6 +32,23 @@ void ngraph::runtime::cpu::to_json(nlohmann::json& json, const TraceEvent& event
     {
         args["Output" + std::to_string(i + 1)] = event.Outputs[i];
     }
+    if (event.Counters)
+    {
+        const hw_counters::Values& counters = *event.Counters;
+        args["cycles"] = std::to_string(counters.cycles);
+        args["instructions"] = std::to_string(counters.instructions);
+        args["LLC misses"] = std::to_string(counters.llc_misses);
+        if (counters.cycles > 0)
+        {
+            args["IPC"] = std::to_string(double(counters.instructions) / counters.cycles);
+        }
+        if (event.Duration > 0)
+        {
+            // Duration is in microseconds, so bytes per microsecond are MB/s
+            args["estimated bandwidth MB/s"] = std::to_string(
+                counters.llc_misses * hw_counters::cache_line_size / event.Duration);
+        }
+    }
 
     json = nlohmann::json{{"ph", event.Phase},
                           {"cat", event.Category},
@@ -43,11 +60,35 @@ void ngraph::runtime::cpu::to_json(nlohmann::json& json, const TraceEvent& event
                           {"args", args}};
 }
 
+static nlohmann::json memory_counter(int64_t ts,
+                                     const ngraph::runtime::cpu::CPU_MemoryTimeline& memory,
+                                     size_t pool_bytes,
+                                     size_t scratchpad_bytes,
+                                     size_t workspace_bytes)
+{
+    return nlohmann::json{{"ph", "C"},
+                          {"name", "Memory"},
+                          {"pid", 0},
+                          {"tid", 0},
+                          {"ts", ts},
+                          {"args",
+                           {{"temporaries", pool_bytes},
+                            {"DNNL scratchpad", scratchpad_bytes},
+                            {"DNNL workspaces", workspace_bytes},
+                            {"inputs and outputs", memory.get_host_tensor_bytes()},
+                            {"constants", memory.get_constant_bytes()}}}};
+}
+
 void ngraph::runtime::cpu::GenerateTimeline(const std::vector<OpAttributes>& op_attrs,
                                             int64_t* op_durations,
-                                            const std::string& file_name)
+                                            const std::string& file_name,
+                                            const hw_counters::Values* op_counters,
+                                            const CPU_MemoryTimeline* memory,
+                                            size_t scratchpad_bytes,
+                                            size_t workspace_bytes)
 {
     nlohmann::json timeline;
+    nlohmann::json memory_events = nlohmann::json::array();
     std::list<TraceEvent> trace;
     std::ofstream out(file_name);
 
@@ -63,10 +104,48 @@ void ngraph::runtime::cpu::GenerateTimeline(const std::vector<OpAttributes>& op_
                            op_durations[i],
                            op_attrs[i].Outputs,
                            op_attrs[i].Inputs);
+        if (op_counters)
+        {
+            trace.back().Counters = &op_counters[i];
+        }
+        if (memory && i < memory->get_num_ops())
+        {
+            memory_events.push_back(memory_counter(
+                ts, *memory, memory->get_live_bytes(i), scratchpad_bytes, workspace_bytes));
+            if (i == memory->get_peak_op())
+            {
+                std::string live_buffers;
+                for (const std::string& name : memory->get_live_buffers(i))
+                {
+                    live_buffers += (live_buffers.empty() ? "" : " ") + name;
+                }
+                memory_events.push_back(
+                    nlohmann::json{{"ph", "i"},
+                                   {"s", "g"},
+                                   {"name", "Memory peak"},
+                                   {"pid", 0},
+                                   {"tid", 0},
+                                   {"ts", ts},
+                                   {"args",
+                                    {{"op", op_attrs[i].Description},
+                                     {"outputs", op_attrs[i].Outputs},
+                                     {"temporaries", memory->get_live_bytes(i)},
+                                     {"pool extent", memory->get_pool_extent(i)},
+                                     {"live buffers", live_buffers}}}});
+            }
+        }
         ts += op_durations[i];
     }
+    if (memory)
+    {
+        memory_events.push_back(memory_counter(ts, *memory, 0, scratchpad_bytes, workspace_bytes));
+    }
 
     timeline["traceEvents"] = trace;
+    for (nlohmann::json& event : memory_events)
+    {
+        timeline["traceEvents"].push_back(event);
+    }
     out << timeline;
     out.close();
 
@@ -81,7 +160,11 @@ bool ngraph::runtime::cpu::IsTracingEnabled()
 #else
 void ngraph::runtime::cpu::GenerateTimeline(const std::vector<OpAttributes>& op_attrs,
                                             int64_t* op_durations,
-                                            const std::string& file_name)
+                                            const std::string& file_name,
+                                            const hw_counters::Values* op_counters,
+                                            const CPU_MemoryTimeline* memory,
+                                            size_t scratchpad_bytes,
+                                            size_t workspace_bytes)
 {
     return;
 }
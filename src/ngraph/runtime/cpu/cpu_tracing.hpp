@@ -21,6 +21,8 @@
 #include <vector>
 
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
+#include "ngraph/runtime/cpu/cpu_hw_counters.hpp"
+#include "ngraph/runtime/cpu/cpu_memory_timeline.hpp"
 #ifndef NGRAPH_JSON_DISABLE
 #include "nlohmann/json.hpp"
 #endif
@@ -45,6 +47,8 @@ namespace ngraph
                 int64_t Duration;
                 const std::vector<std::string>& Outputs;
                 const std::vector<std::string>& Inputs;
+                // Hardware counts of the op, if they were collected
+                const hw_counters::Values* Counters = nullptr;
 
                 TraceEvent(const std::string& ph,
                            const std::string& cat,
@@ -71,9 +75,15 @@ namespace ngraph
             void to_json(nlohmann::json& json, const TraceEvent& event);
 #endif
 
+            // With a memory timeline, the memory in use is added as a counter that changes with
+            // every op, and the op with the most live temporaries is marked
             void GenerateTimeline(const std::vector<OpAttributes>& op_attrs,
                                   int64_t* op_durations,
-                                  const std::string& file_name);
+                                  const std::string& file_name,
+                                  const hw_counters::Values* op_counters = nullptr,
+                                  const CPU_MemoryTimeline* memory = nullptr,
+                                  size_t scratchpad_bytes = 0,
+                                  size_t workspace_bytes = 0);
             bool IsTracingEnabled();
         }
     }
@@ -153,6 +153,16 @@ size_t DNNLEmitter::get_max_scratchpad_size() const
     return m_max_scratchpad_size;
 }
 
+size_t DNNLEmitter::get_workspace_bytes() const
+{
+    size_t bytes = 0;
+    for (const std::unique_ptr<DNNLWorkspace>& workspace : m_workspaces)
+    {
+        bytes += workspace->size;
+    }
+    return bytes;
+}
+
 dnnl::memory::desc DNNLEmitter::build_blocked_memory_descriptor(const dnnl::memory::dims& dim,
                                                                 const dnnl::memory::dims& strides,
                                                                 dnnl::memory::data_type dtype) const
@@ -171,7 +181,7 @@ size_t DNNLEmitter::build_quantize_reorder(const dnnl::memory::desc& input_desc,
     input_index = build_memory(input_desc);
     result_index = build_memory(result_desc);
     auto reorder_prim_desc = dnnl::reorder::primitive_desc(
-        executor::global_cpu_engine, input_desc, executor::global_cpu_engine, result_desc, attr);
+        executor::get_cpu_engine(), input_desc, executor::get_cpu_engine(), result_desc, attr);
     primitive_index = insert_primitive(new dnnl::reorder(reorder_prim_desc));
 
     NGRAPH_CHECK(m_primitive_deps.find(primitive_index) == m_primitive_deps.end(),
@@ -282,6 +292,17 @@ dnnl::eltwise_backward::desc DNNLEmitter::get_sigmoid_backward_desc(const ngraph
         dnnl::algorithm::eltwise_logistic, delta_desc, input_desc, 0, 0);
 }
 
+dnnl::eltwise_forward::desc DNNLEmitter::get_eltwise_forward_desc(const ngraph::Node* node)
+{
+    auto input_desc = dnnl_utils::get_input_dnnl_md(node, 0);
+
+    return dnnl::eltwise_forward::desc(dnnl::prop_kind::forward_inference,
+                                       dnnl_utils::get_eltwise_algorithm(node),
+                                       input_desc,
+                                       0,
+                                       0);
+}
+
 dnnl::batch_normalization_backward::desc
     DNNLEmitter::get_batchnorm_backward_desc(const ngraph::Node* node)
 {
@@ -406,6 +427,32 @@ size_t DNNLEmitter::inner_product_forward_init(bool with_bias)
     return m_dnnl_primitives.size() - 1;
 }
 
+dnnl::inner_product_forward::desc
+    DNNLEmitter::get_dot_inner_product_forward_desc(const ngraph::Node* node)
+{
+    auto arg0_shape = node->get_input_shape(0);
+    auto arg1_shape = node->get_input_shape(1);
+    auto m = static_cast<dnnl::memory::dim>(arg0_shape[0]);
+    auto k = static_cast<dnnl::memory::dim>(arg0_shape[1]);
+    auto n = static_cast<dnnl::memory::dim>(arg1_shape[1]);
+
+    auto data_desc =
+        dnnl::memory::desc(dnnl::memory::dims{m, k},
+                           dnnl_utils::get_dnnl_data_type(node->get_input_element_type(0)),
+                           dnnl::memory::dims{k, 1});
+    auto weights_desc =
+        dnnl::memory::desc(dnnl::memory::dims{n, k},
+                           dnnl_utils::get_dnnl_data_type(node->get_input_element_type(1)),
+                           dnnl::memory::dims{1, n});
+    auto result_desc =
+        dnnl::memory::desc(dnnl::memory::dims{m, n},
+                           dnnl_utils::get_dnnl_data_type(node->get_output_element_type(0)),
+                           dnnl::memory::dims{n, 1});
+
+    return dnnl::inner_product_forward::desc(
+        dnnl::prop_kind::forward_inference, data_desc, weights_desc, result_desc);
+}
+
 size_t DNNLEmitter::reserve_primitive_space(size_t count, bool fwd_bwd, bool new_workspace)
 {
     size_t size = m_dnnl_primitives.size();
@@ -474,7 +521,7 @@ size_t DNNLEmitter::build_quantized_inner_product_forward(const dnnl::memory::de
                                                               result_desc,
                                                           },
                                                           ip_attr,
-                                                          executor::global_cpu_engine}));
+                                                          executor::get_cpu_engine()}));
     m_primitive_deps[ip_index] = {input_data_index, weights_index, bias_index, result_index};
     return ip_index;
 }
@@ -507,7 +554,7 @@ size_t DNNLEmitter::build_quantized_inner_product_forward(const dnnl::memory::de
                                                               result_desc,
                                                           },
                                                           ip_attr,
-                                                          executor::global_cpu_engine}));
+                                                          executor::get_cpu_engine()}));
     m_primitive_deps[ip_index] = {input_data_index, weights_index, result_index};
     return ip_index;
 }
@@ -530,20 +577,20 @@ dnnl::memory::desc DNNLEmitter::build_memory_descriptor(const ngraph::Shape& sha
 
 size_t DNNLEmitter::build_memory(const dnnl::memory::desc& desc)
 {
-    size_t index = insert_memory(new dnnl::memory(desc, executor::global_cpu_engine, nullptr));
+    size_t index = insert_memory(new dnnl::memory(desc, executor::get_cpu_engine(), nullptr));
     return index;
 }
 
 void DNNLEmitter::build_memory(const dnnl::memory::desc& desc, size_t index)
 {
-    m_dnnl_memories[index] = new dnnl::memory(desc, executor::global_cpu_engine, nullptr);
+    m_dnnl_memories[index] = new dnnl::memory(desc, executor::get_cpu_engine(), nullptr);
 }
 
 void DNNLEmitter::build_memory(std::vector<dnnl::memory*>& dnnl_memories,
                                const dnnl::memory::desc& desc,
                                size_t index)
 {
-    dnnl_memories[index] = new dnnl::memory(desc, executor::global_cpu_engine, nullptr);
+    dnnl_memories[index] = new dnnl::memory(desc, executor::get_cpu_engine(), nullptr);
 }
 
 dnnl::sum::primitive_desc DNNLEmitter::get_elementwise_add_desc(const ngraph::Node* node)
@@ -559,7 +606,7 @@ dnnl::sum::primitive_desc DNNLEmitter::get_elementwise_add_desc(const ngraph::No
 
     // elementwise sum primtive descriptor
     dnnl::sum::primitive_desc sum_pd = dnnl::sum::primitive_desc(
-        result_desc, scale_vector, inputs_desc, executor::global_cpu_engine, attr);
+        result_desc, scale_vector, inputs_desc, executor::get_cpu_engine(), attr);
 
     return sum_pd;
 }
@@ -583,7 +630,7 @@ void DNNLEmitter::build_quantize_reorder(std::vector<dnnl::memory*>& dnnl_memori
     attr.set_output_scales(mask, scales);
     attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
     auto reorder_prim_desc = dnnl::reorder::primitive_desc(
-        executor::global_cpu_engine, input_desc, executor::global_cpu_engine, result_desc, attr);
+        executor::get_cpu_engine(), input_desc, executor::get_cpu_engine(), result_desc, attr);
 
     dnnl_scratchpad_mds[quantize_index] =
         new dnnl::memory::desc(reorder_prim_desc.scratchpad_desc());
@@ -602,7 +649,7 @@ void DNNLEmitter::build_deconvolutionbias_forward(
     dnnl::primitive_attr attr;
     attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
     auto deconv_pd =
-        dnnl::deconvolution_forward::primitive_desc(deconv_desc, attr, executor::global_cpu_engine);
+        dnnl::deconvolution_forward::primitive_desc(deconv_desc, attr, executor::get_cpu_engine());
     dnnl_scratchpad_mds[deconv_index] = new dnnl::memory::desc(deconv_pd.scratchpad_desc());
 
     size_t weights_index = deps[0];
@@ -614,7 +661,10 @@ void DNNLEmitter::build_deconvolutionbias_forward(
     size_t result_index = deps[3];
     build_memory(dnnl_memories, deconv_pd.dst_desc(), result_index);
 
-    dnnl_primitives[deconv_index] = new dnnl::deconvolution_forward(deconv_pd);
+    DNNLPrimitiveKey key("deconvolution_forward");
+    key.append(deconv_desc.data).append(attr).append(executor::get_cpu_engine().get());
+    dnnl_primitives[deconv_index] =
+        create_cached_primitive<dnnl::deconvolution_forward>(key, deconv_pd);
 }
 
 void DNNLEmitter::build_convolution_backward_weights_bias(
@@ -627,12 +677,12 @@ void DNNLEmitter::build_convolution_backward_weights_bias(
     size_t conv_index)
 {
     auto conv_fwd_pd =
-        dnnl::convolution_forward::primitive_desc(fwd_desc, executor::global_cpu_engine);
+        dnnl::convolution_forward::primitive_desc(fwd_desc, executor::get_cpu_engine());
 
     dnnl::primitive_attr attr;
     attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
     auto conv_bwd_pd = dnnl::convolution_backward_weights::primitive_desc(
-        bwd_desc, attr, executor::global_cpu_engine, conv_fwd_pd);
+        bwd_desc, attr, executor::get_cpu_engine(), conv_fwd_pd);
     dnnl_scratchpad_mds[conv_index] = new dnnl::memory::desc(conv_bwd_pd.scratchpad_desc());
 
     size_t src_index = deps[0];
@@ -644,7 +694,11 @@ void DNNLEmitter::build_convolution_backward_weights_bias(
     size_t diff_bias_index = deps[3];
     build_memory(dnnl_memories, conv_bwd_pd.diff_bias_desc(), diff_bias_index);
 
-    dnnl_primitives[conv_index] = new dnnl::convolution_backward_weights(conv_bwd_pd);
+    DNNLPrimitiveKey key("convolution_backward_weights");
+    key.append(bwd_desc.data).append(fwd_desc.data).append(attr);
+    key.append(executor::get_cpu_engine().get());
+    dnnl_primitives[conv_index] =
+        create_cached_primitive<dnnl::convolution_backward_weights>(key, conv_bwd_pd);
 }
 
 void DNNLEmitter::build_convolution_backward_weights(
@@ -658,12 +712,12 @@ void DNNLEmitter::build_convolution_backward_weights(
 {
     // Forward primitive descriptor corresponding to this backward weights descriptor
     auto conv_fwd_pd =
-        dnnl::convolution_forward::primitive_desc(fwd_desc, executor::global_cpu_engine);
+        dnnl::convolution_forward::primitive_desc(fwd_desc, executor::get_cpu_engine());
 
     dnnl::primitive_attr attr;
     attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
     auto conv_bwd_pd = dnnl::convolution_backward_weights::primitive_desc(
-        bwd_desc, attr, executor::global_cpu_engine, conv_fwd_pd);
+        bwd_desc, attr, executor::get_cpu_engine(), conv_fwd_pd);
     dnnl_scratchpad_mds[conv_index] = new dnnl::memory::desc(conv_bwd_pd.scratchpad_desc());
 
     size_t src_index = deps[0];
@@ -673,7 +727,11 @@ void DNNLEmitter::build_convolution_backward_weights(
     size_t diff_weights_index = deps[2];
     build_memory(dnnl_memories, conv_bwd_pd.diff_weights_desc(), diff_weights_index);
 
-    dnnl_primitives[conv_index] = new dnnl::convolution_backward_weights(conv_bwd_pd);
+    DNNLPrimitiveKey key("convolution_backward_weights");
+    key.append(bwd_desc.data).append(fwd_desc.data).append(attr);
+    key.append(executor::get_cpu_engine().get());
+    dnnl_primitives[conv_index] =
+        create_cached_primitive<dnnl::convolution_backward_weights>(key, conv_bwd_pd);
 }
 
 void DNNLEmitter::build_convolution_backward_data(
@@ -687,12 +745,12 @@ void DNNLEmitter::build_convolution_backward_data(
 {
     // Forward primitive descriptor corresponding to this backward weights descriptor
     auto conv_fwd_pd =
-        dnnl::convolution_forward::primitive_desc(fwd_desc, executor::global_cpu_engine);
+        dnnl::convolution_forward::primitive_desc(fwd_desc, executor::get_cpu_engine());
 
     dnnl::primitive_attr attr;
     attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
     auto conv_bwd_pd = dnnl::convolution_backward_data::primitive_desc(
-        bwd_desc, attr, executor::global_cpu_engine, conv_fwd_pd);
+        bwd_desc, attr, executor::get_cpu_engine(), conv_fwd_pd);
     dnnl_scratchpad_mds[conv_index] = new dnnl::memory::desc(conv_bwd_pd.scratchpad_desc());
 
     size_t weights_index = deps[0];
@@ -702,7 +760,11 @@ void DNNLEmitter::build_convolution_backward_data(
     size_t diff_src_index = deps[2];
     build_memory(dnnl_memories, conv_bwd_pd.diff_src_desc(), diff_src_index);
 
-    dnnl_primitives[conv_index] = new dnnl::convolution_backward_data(conv_bwd_pd);
+    DNNLPrimitiveKey key("convolution_backward_data");
+    key.append(bwd_desc.data).append(fwd_desc.data).append(attr);
+    key.append(executor::get_cpu_engine().get());
+    dnnl_primitives[conv_index] =
+        create_cached_primitive<dnnl::convolution_backward_data>(key, conv_bwd_pd);
 }
 
 void DNNLEmitter::build_pooling_forward(std::vector<dnnl::memory*>& dnnl_memories,
@@ -715,7 +777,7 @@ void DNNLEmitter::build_pooling_forward(std::vector<dnnl::memory*>& dnnl_memorie
     dnnl::primitive_attr attr;
     attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
     auto pool_pd =
-        dnnl::pooling_forward::primitive_desc(pool_desc, attr, executor::global_cpu_engine);
+        dnnl::pooling_forward::primitive_desc(pool_desc, attr, executor::get_cpu_engine());
     dnnl_scratchpad_mds[pool_index] = new dnnl::memory::desc(pool_pd.scratchpad_desc());
 
     size_t input_index = deps[0];
@@ -735,12 +797,12 @@ void DNNLEmitter::build_pooling_backward(std::vector<dnnl::memory*>& dnnl_memori
                                          size_t pool_index)
 {
     auto pool_fwd_pd =
-        dnnl::pooling_forward::primitive_desc(pool_fwd_desc, executor::global_cpu_engine);
+        dnnl::pooling_forward::primitive_desc(pool_fwd_desc, executor::get_cpu_engine());
 
     dnnl::primitive_attr attr;
     attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
     auto pool_bwd_pd = dnnl::pooling_backward::primitive_desc(
-        pool_desc, attr, executor::global_cpu_engine, pool_fwd_pd);
+        pool_desc, attr, executor::get_cpu_engine(), pool_fwd_pd);
     dnnl_scratchpad_mds[pool_index] = new dnnl::memory::desc(pool_bwd_pd.scratchpad_desc());
 
     size_t input_index = deps[0];
@@ -766,9 +828,9 @@ void DNNLEmitter::build_max_pooling_backward(std::vector<dnnl::memory*>& dnnl_me
     dnnl::primitive_attr attr;
     attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
     auto pool_fwd_pd =
-        dnnl::pooling_forward::primitive_desc(fwd_pool_desc, attr, executor::global_cpu_engine);
+        dnnl::pooling_forward::primitive_desc(fwd_pool_desc, attr, executor::get_cpu_engine());
     auto pool_bwd_pd = dnnl::pooling_backward::primitive_desc(
-        bwd_pool_desc, attr, executor::global_cpu_engine, pool_fwd_pd);
+        bwd_pool_desc, attr, executor::get_cpu_engine(), pool_fwd_pd);
     dnnl_scratchpad_mds[fwd_pool_index] = new dnnl::memory::desc(pool_fwd_pd.scratchpad_desc());
     dnnl_scratchpad_mds[bwd_pool_index] = new dnnl::memory::desc(pool_bwd_pd.scratchpad_desc());
 
@@ -808,7 +870,7 @@ void DNNLEmitter::build_max_pooling_with_indices_forward(
     dnnl::primitive_attr attr;
     attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
     auto pool_pd =
-        dnnl::pooling_forward::primitive_desc(max_pool_desc, attr, executor::global_cpu_engine);
+        dnnl::pooling_forward::primitive_desc(max_pool_desc, attr, executor::get_cpu_engine());
     dnnl_scratchpad_mds[max_pool_index] = new dnnl::memory::desc(pool_pd.scratchpad_desc());
 
     size_t src_index = deps[0];
@@ -832,12 +894,12 @@ void DNNLEmitter::build_max_pooling_with_indices_backward(
     size_t max_pool_index)
 {
     auto pool_fwd_pd =
-        dnnl::pooling_forward::primitive_desc(fwd_pool_desc, executor::global_cpu_engine);
+        dnnl::pooling_forward::primitive_desc(fwd_pool_desc, executor::get_cpu_engine());
 
     dnnl::primitive_attr attr;
     attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
     auto pool_bwd_pd = dnnl::pooling_backward::primitive_desc(
-        bwd_pool_desc, attr, executor::global_cpu_engine, pool_fwd_pd);
+        bwd_pool_desc, attr, executor::get_cpu_engine(), pool_fwd_pd);
     dnnl_scratchpad_mds[max_pool_index] = new dnnl::memory::desc(pool_bwd_pd.scratchpad_desc());
 
     size_t diff_dst_index = deps[0];
@@ -881,7 +943,7 @@ void DNNLEmitter::build_lrn_forward(std::vector<dnnl::memory*>& dnnl_memories,
 {
     dnnl::primitive_attr attr;
     attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
-    auto lrn_pd = dnnl::lrn_forward::primitive_desc(lrn_desc, attr, executor::global_cpu_engine);
+    auto lrn_pd = dnnl::lrn_forward::primitive_desc(lrn_desc, attr, executor::get_cpu_engine());
     dnnl_scratchpad_mds[lrn_index] = new dnnl::memory::desc(lrn_pd.scratchpad_desc());
 
     size_t input_index = deps[0];
@@ -902,7 +964,7 @@ void DNNLEmitter::build_relu_forward(std::vector<dnnl::memory*>& dnnl_memories,
     dnnl::primitive_attr attr;
     attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
     auto relu_pd =
-        dnnl::eltwise_forward::primitive_desc(relu_desc, attr, executor::global_cpu_engine);
+        dnnl::eltwise_forward::primitive_desc(relu_desc, attr, executor::get_cpu_engine());
     dnnl_scratchpad_mds[relu_index] = new dnnl::memory::desc(relu_pd.scratchpad_desc());
 
     size_t input_index = deps[0];
@@ -922,13 +984,13 @@ void DNNLEmitter::build_relu_backward(std::vector<dnnl::memory*>& dnnl_memories,
                                       size_t relu_index)
 {
     /* create forward relu primitive descriptor*/
-    auto relu_fwd_pd = dnnl::eltwise_forward::primitive_desc(fwd_desc, executor::global_cpu_engine);
+    auto relu_fwd_pd = dnnl::eltwise_forward::primitive_desc(fwd_desc, executor::get_cpu_engine());
 
     /* create backward relu primitive_descriptor */
     dnnl::primitive_attr attr;
     attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
     auto relu_bwd_pd = dnnl::eltwise_backward::primitive_desc(
-        bwd_desc, attr, executor::global_cpu_engine, relu_fwd_pd);
+        bwd_desc, attr, executor::get_cpu_engine(), relu_fwd_pd);
     dnnl_scratchpad_mds[relu_index] = new dnnl::memory::desc(relu_bwd_pd.scratchpad_desc());
 
     size_t input_index = deps[0];
@@ -941,6 +1003,27 @@ void DNNLEmitter::build_relu_backward(std::vector<dnnl::memory*>& dnnl_memories,
     dnnl_primitives[relu_index] = new dnnl::eltwise_backward(relu_bwd_pd);
 }
 
+void DNNLEmitter::build_eltwise_forward(std::vector<dnnl::memory*>& dnnl_memories,
+                                        std::vector<dnnl::primitive*>& dnnl_primitives,
+                                        std::vector<dnnl::memory::desc*>& dnnl_scratchpad_mds,
+                                        const dnnl::eltwise_forward::desc& eltwise_desc,
+                                        const std::vector<size_t>& deps,
+                                        size_t eltwise_index)
+{
+    dnnl::primitive_attr attr;
+    attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
+    auto eltwise_pd =
+        dnnl::eltwise_forward::primitive_desc(eltwise_desc, attr, executor::get_cpu_engine());
+    dnnl_scratchpad_mds[eltwise_index] = new dnnl::memory::desc(eltwise_pd.scratchpad_desc());
+
+    size_t input_index = deps[0];
+    build_memory(dnnl_memories, eltwise_pd.src_desc(), input_index);
+    size_t result_index = deps[1];
+    build_memory(dnnl_memories, eltwise_pd.dst_desc(), result_index);
+
+    dnnl_primitives[eltwise_index] = new dnnl::eltwise_forward(eltwise_pd);
+}
+
 void DNNLEmitter::build_sigmoid_forward(std::vector<dnnl::memory*>& dnnl_memories,
                                         std::vector<dnnl::primitive*>& dnnl_primitives,
                                         std::vector<dnnl::memory::desc*>& dnnl_scratchpad_mds,
@@ -951,7 +1034,7 @@ void DNNLEmitter::build_sigmoid_forward(std::vector<dnnl::memory*>& dnnl_memorie
     dnnl::primitive_attr attr;
     attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
     auto sigmoid_pd =
-        dnnl::eltwise_forward::primitive_desc(sigmoid_desc, attr, executor::global_cpu_engine);
+        dnnl::eltwise_forward::primitive_desc(sigmoid_desc, attr, executor::get_cpu_engine());
     dnnl_scratchpad_mds[sigmoid_index] = new dnnl::memory::desc(sigmoid_pd.scratchpad_desc());
 
     size_t input_index = deps[0];
@@ -972,12 +1055,12 @@ void DNNLEmitter::build_sigmoid_backward(std::vector<dnnl::memory*>& dnnl_memori
 {
     // sigmoid forward primitive desc
     auto sigmoid_fwd_pd =
-        dnnl::eltwise_forward::primitive_desc(fwd_desc, executor::global_cpu_engine);
+        dnnl::eltwise_forward::primitive_desc(fwd_desc, executor::get_cpu_engine());
 
     dnnl::primitive_attr attr;
     attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
     auto sigmoid_bwd_pd = dnnl::eltwise_backward::primitive_desc(
-        bwd_desc, attr, executor::global_cpu_engine, sigmoid_fwd_pd);
+        bwd_desc, attr, executor::get_cpu_engine(), sigmoid_fwd_pd);
     dnnl_scratchpad_mds[sigmoid_index] = new dnnl::memory::desc(sigmoid_bwd_pd.scratchpad_desc());
 
     size_t input_index = deps[0];
@@ -1025,7 +1108,7 @@ void DNNLEmitter::build_batchnorm_forward(
     bn_attr.set_post_ops(pops);
     bn_attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
     auto batchnorm_pd = dnnl::batch_normalization_forward::primitive_desc(
-        batchnorm_desc, bn_attr, executor::global_cpu_engine);
+        batchnorm_desc, bn_attr, executor::get_cpu_engine());
     dnnl_scratchpad_mds[batchnorm_index] = new dnnl::memory::desc(batchnorm_pd.scratchpad_desc());
 
     size_t input_index = deps[0];
@@ -1078,12 +1161,12 @@ void DNNLEmitter::build_batchnorm_backward(
                                                 epsilon,
                                                 dnnl::BN_FLAG_CLASS::use_scale_shift);
     auto batchnorm_fpd = dnnl::batch_normalization_forward::primitive_desc(
-        batchnorm_fdesc, executor::global_cpu_engine);
+        batchnorm_fdesc, executor::get_cpu_engine());
 
     dnnl::primitive_attr attr;
     attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
     auto batchnorm_pd = dnnl::batch_normalization_backward::primitive_desc(
-        batchnorm_desc, attr, executor::global_cpu_engine, batchnorm_fpd);
+        batchnorm_desc, attr, executor::get_cpu_engine(), batchnorm_fpd);
     dnnl_scratchpad_mds[batchnorm_index] = new dnnl::memory::desc(batchnorm_pd.scratchpad_desc());
 
     size_t weights_index = deps[0];
@@ -1131,7 +1214,7 @@ void DNNLEmitter::build_vanilla_rnn_forward(std::vector<dnnl::memory*>& dnnl_mem
     attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
 
     auto rnn_layer_prim_desc =
-        dnnl::vanilla_rnn_forward::primitive_desc(rnn_desc, attr, executor::global_cpu_engine);
+        dnnl::vanilla_rnn_forward::primitive_desc(rnn_desc, attr, executor::get_cpu_engine());
     dnnl_scratchpad_mds[rnn_index] = new dnnl::memory::desc(rnn_layer_prim_desc.scratchpad_desc());
     size_t workspace_index = deps[7];
     build_memory(dnnl_memories, rnn_layer_prim_desc.workspace_desc(), workspace_index);
@@ -1143,6 +1226,61 @@ void DNNLEmitter::build_vanilla_rnn_forward(std::vector<dnnl::memory*>& dnnl_mem
     dnnl_primitives[rnn_index] = new dnnl::vanilla_rnn_forward(rnn_layer_prim_desc);
 }
 
+template <typename PRIMITIVE>
+void DNNLEmitter::build_gru_primitive(std::vector<dnnl::memory*>& dnnl_memories,
+                                      std::vector<dnnl::primitive*>& dnnl_primitives,
+                                      std::vector<dnnl::memory::desc*>& dnnl_scratchpad_mds,
+                                      const typename PRIMITIVE::desc& rnn_desc,
+                                      const std::vector<size_t>& deps,
+                                      size_t rnn_index)
+{
+    size_t src_layer_index = deps[0];
+    build_memory(dnnl_memories, rnn_desc.data.src_layer_desc, src_layer_index);
+    size_t src_iter_index = deps[1];
+    build_memory(dnnl_memories, rnn_desc.data.src_iter_desc, src_iter_index);
+    size_t weights_layer_index = deps[2];
+    build_memory(dnnl_memories, rnn_desc.data.weights_layer_desc, weights_layer_index);
+    size_t weights_iter_index = deps[3];
+    build_memory(dnnl_memories, rnn_desc.data.weights_iter_desc, weights_iter_index);
+    size_t bias_index = deps[4];
+    build_memory(dnnl_memories, rnn_desc.data.bias_desc, bias_index);
+    size_t dst_layer_index = deps[5];
+    build_memory(dnnl_memories, rnn_desc.data.dst_layer_desc, dst_layer_index);
+    size_t dst_iter_index = deps[6];
+    build_memory(dnnl_memories, rnn_desc.data.dst_iter_desc, dst_iter_index);
+
+    // Inference only, so there is no workspace
+    dnnl::primitive_attr attr;
+    attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
+    auto rnn_prim_desc =
+        typename PRIMITIVE::primitive_desc(rnn_desc, attr, executor::get_cpu_engine());
+    dnnl_scratchpad_mds[rnn_index] = new dnnl::memory::desc(rnn_prim_desc.scratchpad_desc());
+
+    dnnl_primitives[rnn_index] = new PRIMITIVE(rnn_prim_desc);
+}
+
+void DNNLEmitter::build_gru_forward(std::vector<dnnl::memory*>& dnnl_memories,
+                                    std::vector<dnnl::primitive*>& dnnl_primitives,
+                                    std::vector<dnnl::memory::desc*>& dnnl_scratchpad_mds,
+                                    const dnnl::gru_forward::desc& rnn_desc,
+                                    const std::vector<size_t>& deps,
+                                    size_t rnn_index)
+{
+    build_gru_primitive<dnnl::gru_forward>(
+        dnnl_memories, dnnl_primitives, dnnl_scratchpad_mds, rnn_desc, deps, rnn_index);
+}
+
+void DNNLEmitter::build_gru_forward(std::vector<dnnl::memory*>& dnnl_memories,
+                                    std::vector<dnnl::primitive*>& dnnl_primitives,
+                                    std::vector<dnnl::memory::desc*>& dnnl_scratchpad_mds,
+                                    const dnnl::lbr_gru_forward::desc& rnn_desc,
+                                    const std::vector<size_t>& deps,
+                                    size_t rnn_index)
+{
+    build_gru_primitive<dnnl::lbr_gru_forward>(
+        dnnl_memories, dnnl_primitives, dnnl_scratchpad_mds, rnn_desc, deps, rnn_index);
+}
+
 void DNNLEmitter::build_rnn_forward(std::vector<dnnl::memory*>& dnnl_memories,
                                     std::vector<dnnl::primitive*>& dnnl_primitives,
                                     std::vector<dnnl::memory::desc*>& dnnl_scratchpad_mds,
@@ -1173,7 +1311,7 @@ void DNNLEmitter::build_rnn_forward(std::vector<dnnl::memory*>& dnnl_memories,
     dnnl::primitive_attr attr;
     attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
     auto rnn_layer_prim_desc =
-        dnnl::lstm_forward::primitive_desc(rnn_desc, attr, executor::global_cpu_engine);
+        dnnl::lstm_forward::primitive_desc(rnn_desc, attr, executor::get_cpu_engine());
     dnnl_scratchpad_mds[rnn_index] = new dnnl::memory::desc(rnn_layer_prim_desc.scratchpad_desc());
 
     size_t workspace_index = deps[9];
@@ -1247,7 +1385,7 @@ void DNNLEmitter::build_softmax_forward(std::vector<dnnl::memory*>& dnnl_memorie
     dnnl::primitive_attr attr;
     attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
     auto softmax_pd =
-        dnnl::softmax_forward::primitive_desc(softmax_desc, attr, executor::global_cpu_engine);
+        dnnl::softmax_forward::primitive_desc(softmax_desc, attr, executor::get_cpu_engine());
     dnnl_scratchpad_mds[softmax_index] = new dnnl::memory::desc(softmax_pd.scratchpad_desc());
 
     size_t input_index = deps[0];
@@ -1268,7 +1406,7 @@ void DNNLEmitter::build_leaky_relu(std::vector<dnnl::memory*>& dnnl_memories,
     dnnl::primitive_attr attr;
     attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
     auto leaky_relu_pd =
-        dnnl::eltwise_forward::primitive_desc(leaky_relu_desc, attr, executor::global_cpu_engine);
+        dnnl::eltwise_forward::primitive_desc(leaky_relu_desc, attr, executor::get_cpu_engine());
     dnnl_scratchpad_mds[leaky_relu_index] = new dnnl::memory::desc(leaky_relu_pd.scratchpad_desc());
 
     size_t input_index = deps[0];
@@ -1289,7 +1427,7 @@ void DNNLEmitter::build_bounded_relu(std::vector<dnnl::memory*>& dnnl_memories,
     dnnl::primitive_attr attr;
     attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
     auto bounded_relu_pd =
-        dnnl::eltwise_forward::primitive_desc(bounded_relu_desc, attr, executor::global_cpu_engine);
+        dnnl::eltwise_forward::primitive_desc(bounded_relu_desc, attr, executor::get_cpu_engine());
     dnnl_scratchpad_mds[bounded_relu_index] =
         new dnnl::memory::desc(bounded_relu_pd.scratchpad_desc());
 
@@ -1311,7 +1449,7 @@ void DNNLEmitter::build_gelu(std::vector<dnnl::memory*>& dnnl_memories,
     dnnl::primitive_attr attr;
     attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
     auto gelu_pd =
-        dnnl::eltwise_forward::primitive_desc(gelu_desc, attr, executor::global_cpu_engine);
+        dnnl::eltwise_forward::primitive_desc(gelu_desc, attr, executor::get_cpu_engine());
     dnnl_scratchpad_mds[gelu_index] = new dnnl::memory::desc(gelu_pd.scratchpad_desc());
 
     size_t input_index = deps[0];
@@ -1331,12 +1469,12 @@ void DNNLEmitter::build_gelu_backward(std::vector<dnnl::memory*>& dnnl_memories,
                                       size_t gelu_bprop_index)
 {
     // gelu forward primitive desc
-    auto gelu_fwd_pd = dnnl::eltwise_forward::primitive_desc(fwd_desc, executor::global_cpu_engine);
+    auto gelu_fwd_pd = dnnl::eltwise_forward::primitive_desc(fwd_desc, executor::get_cpu_engine());
 
     dnnl::primitive_attr attr;
     attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
     auto gelu_bwd_pd = dnnl::eltwise_backward::primitive_desc(
-        bwd_desc, attr, executor::global_cpu_engine, gelu_fwd_pd);
+        bwd_desc, attr, executor::get_cpu_engine(), gelu_fwd_pd);
     dnnl_scratchpad_mds[gelu_bprop_index] = new dnnl::memory::desc(gelu_bwd_pd.scratchpad_desc());
 
     size_t input_index = deps[0];
@@ -1368,7 +1506,7 @@ size_t DNNLEmitter::query_scratchpad_concat(const dnnl::concat::primitive_desc p
 size_t DNNLEmitter::query_scratchpad_pooling_forward(const dnnl::pooling_forward::desc& desc)
 {
     ATTR_S
-    auto pd = dnnl::pooling_forward::primitive_desc(desc, attr, executor::global_cpu_engine);
+    auto pd = dnnl::pooling_forward::primitive_desc(desc, attr, executor::get_cpu_engine());
     GET_SIZE
 }
 
@@ -1377,9 +1515,9 @@ size_t
                                                        const dnnl::pooling_backward::desc& bwd_desc)
 {
     ATTR_S
-    auto fwd_pd = dnnl::pooling_forward::primitive_desc(fwd_desc, executor::global_cpu_engine);
+    auto fwd_pd = dnnl::pooling_forward::primitive_desc(fwd_desc, executor::get_cpu_engine());
     auto pd =
-        dnnl::pooling_backward::primitive_desc(bwd_desc, attr, executor::global_cpu_engine, fwd_pd);
+        dnnl::pooling_backward::primitive_desc(bwd_desc, attr, executor::get_cpu_engine(), fwd_pd);
     GET_SIZE
 }
 
@@ -1389,9 +1527,9 @@ size_t
 {
     ATTR_S
     auto fwd_pd =
-        dnnl::pooling_forward::primitive_desc(fwd_desc, attr, executor::global_cpu_engine);
+        dnnl::pooling_forward::primitive_desc(fwd_desc, attr, executor::get_cpu_engine());
     auto pd =
-        dnnl::pooling_backward::primitive_desc(bwd_desc, attr, executor::global_cpu_engine, fwd_pd);
+        dnnl::pooling_backward::primitive_desc(bwd_desc, attr, executor::get_cpu_engine(), fwd_pd);
     dnnl::memory::desc scratchpad_md = pd.scratchpad_desc();
     size_t size = scratchpad_md.get_size();
     m_max_scratchpad_size = size > m_max_scratchpad_size ? size : m_max_scratchpad_size;
@@ -1406,9 +1544,9 @@ size_t DNNLEmitter::query_scratchpad_max_pooling_with_indices_backward(
 {
     ATTR_S
     auto fwd_pd =
-        dnnl::pooling_forward::primitive_desc(fwd_desc, attr, executor::global_cpu_engine);
+        dnnl::pooling_forward::primitive_desc(fwd_desc, attr, executor::get_cpu_engine());
     auto pd =
-        dnnl::pooling_backward::primitive_desc(bwd_desc, attr, executor::global_cpu_engine, fwd_pd);
+        dnnl::pooling_backward::primitive_desc(bwd_desc, attr, executor::get_cpu_engine(), fwd_pd);
     GET_SIZE
 }
 
@@ -1418,7 +1556,7 @@ size_t DNNLEmitter::query_scratchpad_batchnorm_forward(
     ATTR_S
     attr.set_post_ops(pops);
     auto pd =
-        dnnl::batch_normalization_forward::primitive_desc(desc, attr, executor::global_cpu_engine);
+        dnnl::batch_normalization_forward::primitive_desc(desc, attr, executor::get_cpu_engine());
     GET_SIZE
 }
 size_t DNNLEmitter::query_scratchpad_batchnorm_backward(
@@ -1432,9 +1570,9 @@ size_t DNNLEmitter::query_scratchpad_batchnorm_backward(
                                                             epsilon,
                                                             dnnl::BN_FLAG_CLASS::use_scale_shift);
     auto fwd_pd =
-        dnnl::batch_normalization_forward::primitive_desc(fwd_desc, executor::global_cpu_engine);
+        dnnl::batch_normalization_forward::primitive_desc(fwd_desc, executor::get_cpu_engine());
     auto pd = dnnl::batch_normalization_backward::primitive_desc(
-        desc, attr, executor::global_cpu_engine, fwd_pd);
+        desc, attr, executor::get_cpu_engine(), fwd_pd);
     GET_SIZE
 }
 
@@ -1443,7 +1581,7 @@ size_t
                                                       dnnl::primitive_attr& attr)
 {
     attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
-    auto pd = dnnl::convolution_forward::primitive_desc(desc, attr, executor::global_cpu_engine);
+    auto pd = dnnl::convolution_forward::primitive_desc(desc, attr, executor::get_cpu_engine());
     GET_SIZE
 }
 
@@ -1452,9 +1590,9 @@ size_t DNNLEmitter::query_scratchpad_convolution_backward_data(
     const dnnl::convolution_backward_data::desc& bwd_desc)
 {
     ATTR_S
-    auto fwd_pd = dnnl::convolution_forward::primitive_desc(fwd_desc, executor::global_cpu_engine);
+    auto fwd_pd = dnnl::convolution_forward::primitive_desc(fwd_desc, executor::get_cpu_engine());
     auto pd = dnnl::convolution_backward_data::primitive_desc(
-        bwd_desc, attr, executor::global_cpu_engine, fwd_pd);
+        bwd_desc, attr, executor::get_cpu_engine(), fwd_pd);
     GET_SIZE
 }
 
@@ -1463,9 +1601,9 @@ size_t DNNLEmitter::query_scratchpad_convolution_backward_weights(
     const dnnl::convolution_backward_weights::desc& bwd_desc)
 {
     ATTR_S
-    auto fwd_pd = dnnl::convolution_forward::primitive_desc(fwd_desc, executor::global_cpu_engine);
+    auto fwd_pd = dnnl::convolution_forward::primitive_desc(fwd_desc, executor::get_cpu_engine());
     auto pd = dnnl::convolution_backward_weights::primitive_desc(
-        bwd_desc, attr, executor::global_cpu_engine, fwd_pd);
+        bwd_desc, attr, executor::get_cpu_engine(), fwd_pd);
     GET_SIZE
 }
 
@@ -1473,14 +1611,14 @@ size_t DNNLEmitter::query_scratchpad_deconvolution_forward(
     const dnnl::deconvolution_forward::desc& desc)
 {
     ATTR_S
-    auto pd = dnnl::deconvolution_forward::primitive_desc(desc, attr, executor::global_cpu_engine);
+    auto pd = dnnl::deconvolution_forward::primitive_desc(desc, attr, executor::get_cpu_engine());
     GET_SIZE
 }
 
 size_t DNNLEmitter::query_scratchpad_eltwise_forward(const dnnl::eltwise_forward::desc& desc)
 {
     ATTR_S
-    auto pd = dnnl::eltwise_forward::primitive_desc(desc, attr, executor::global_cpu_engine);
+    auto pd = dnnl::eltwise_forward::primitive_desc(desc, attr, executor::get_cpu_engine());
     GET_SIZE
 }
 
@@ -1488,9 +1626,9 @@ size_t DNNLEmitter::query_scratchpad_eltwise_backward(const dnnl::eltwise_forwar
                                                       const dnnl::eltwise_backward::desc& bwd_desc)
 {
     ATTR_S
-    auto fwd_pd = dnnl::eltwise_forward::primitive_desc(fwd_desc, executor::global_cpu_engine);
+    auto fwd_pd = dnnl::eltwise_forward::primitive_desc(fwd_desc, executor::get_cpu_engine());
     auto pd =
-        dnnl::eltwise_backward::primitive_desc(bwd_desc, attr, executor::global_cpu_engine, fwd_pd);
+        dnnl::eltwise_backward::primitive_desc(bwd_desc, attr, executor::get_cpu_engine(), fwd_pd);
     GET_SIZE
 }
 
@@ -1498,7 +1636,7 @@ size_t DNNLEmitter::query_scratchpad_ip_forward(const dnnl::inner_product_forwar
                                                 dnnl::primitive_attr& attr)
 {
     attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
-    auto pd = dnnl::inner_product_forward::primitive_desc(desc, attr, executor::global_cpu_engine);
+    auto pd = dnnl::inner_product_forward::primitive_desc(desc, attr, executor::get_cpu_engine());
     GET_SIZE
 }
 
@@ -1507,14 +1645,14 @@ size_t DNNLEmitter::query_scratchpad_reorder(const dnnl::memory::desc& input_des
 {
     ATTR_S
     auto pd = dnnl::reorder::primitive_desc(
-        executor::global_cpu_engine, input_desc, executor::global_cpu_engine, result_desc, attr);
+        executor::get_cpu_engine(), input_desc, executor::get_cpu_engine(), result_desc, attr);
     GET_SIZE
 }
 
 size_t DNNLEmitter::query_scratchpad_rnn_forward(const dnnl::lstm_forward::desc& desc)
 {
     ATTR_S
-    auto pd = dnnl::lstm_forward::primitive_desc(desc, attr, executor::global_cpu_engine);
+    auto pd = dnnl::lstm_forward::primitive_desc(desc, attr, executor::get_cpu_engine());
     GET_SIZE
 }
 
@@ -1522,14 +1660,28 @@ size_t
     DNNLEmitter::query_scratchpad_vanilla_rnn_forward(const dnnl::vanilla_rnn_forward::desc& desc)
 {
     ATTR_S
-    auto pd = dnnl::vanilla_rnn_forward::primitive_desc(desc, attr, executor::global_cpu_engine);
+    auto pd = dnnl::vanilla_rnn_forward::primitive_desc(desc, attr, executor::get_cpu_engine());
+    GET_SIZE
+}
+
+size_t DNNLEmitter::query_scratchpad_gru_forward(const dnnl::gru_forward::desc& desc)
+{
+    ATTR_S
+    auto pd = dnnl::gru_forward::primitive_desc(desc, attr, executor::get_cpu_engine());
+    GET_SIZE
+}
+
+size_t DNNLEmitter::query_scratchpad_gru_forward(const dnnl::lbr_gru_forward::desc& desc)
+{
+    ATTR_S
+    auto pd = dnnl::lbr_gru_forward::primitive_desc(desc, attr, executor::get_cpu_engine());
     GET_SIZE
 }
 
 size_t DNNLEmitter::query_scratchpad_lrn_forward(const dnnl::lrn_forward::desc& desc)
 {
     ATTR_S
-    auto pd = dnnl::lrn_forward::primitive_desc(desc, attr, executor::global_cpu_engine);
+    auto pd = dnnl::lrn_forward::primitive_desc(desc, attr, executor::get_cpu_engine());
     GET_SIZE
 }
 
@@ -1542,8 +1694,8 @@ size_t DNNLEmitter::query_scratchpad_slice(dnnl::memory::desc& input_desc,
     auto dims = dnnl::memory::dims(result_shape.begin(), result_shape.end());
     auto offsets = dnnl::memory::dims(lower_bounds.begin(), lower_bounds.end());
     auto input_sub_desc = input_desc.submemory_desc(dims, offsets);
-    auto input = dnnl::memory(input_sub_desc, executor::global_cpu_engine);
-    auto output = dnnl::memory(output_desc, executor::global_cpu_engine);
+    auto input = dnnl::memory(input_sub_desc, executor::get_cpu_engine());
+    auto output = dnnl::memory(output_desc, executor::get_cpu_engine());
     auto pd = dnnl::reorder::primitive_desc(input, output, attr);
     GET_SIZE
 }
@@ -1551,6 +1703,6 @@ size_t DNNLEmitter::query_scratchpad_slice(dnnl::memory::desc& input_desc,
 size_t DNNLEmitter::query_scratchpad_softmax_forward(const dnnl::softmax_forward::desc& desc)
 {
     ATTR_S
-    auto pd = dnnl::softmax_forward::primitive_desc(desc, attr, executor::global_cpu_engine);
+    auto pd = dnnl::softmax_forward::primitive_desc(desc, attr, executor::get_cpu_engine());
     GET_SIZE
 }
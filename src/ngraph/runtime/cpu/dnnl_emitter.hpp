@@ -49,6 +49,7 @@
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_wrapper.hpp"
 #include "ngraph/runtime/cpu/dnnl_invoke.hpp"
+#include "ngraph/runtime/cpu/dnnl_primitive_cache.hpp"
 #include "ngraph/runtime/cpu/dnnl_utils.hpp"
 #include "ngraph/runtime/cpu/op/bounded_relu.hpp"
 #include "ngraph/runtime/cpu/op/conv_add.hpp"
@@ -116,9 +117,14 @@ namespace ngraph
             class DNNLWorkspace
             {
             public:
-                DNNLWorkspace(size_t size) { buf = reinterpret_cast<char*>(ngraph_malloc(size)); }
+                DNNLWorkspace(size_t size)
+                    : size(size)
+                {
+                    buf = reinterpret_cast<char*>(ngraph_malloc(size));
+                }
                 ~DNNLWorkspace() { ngraph_free(buf); }
                 char* buf;
+                size_t size;
 
                 DNNLWorkspace(const DNNLWorkspace&) = delete;
                 DNNLWorkspace(DNNLWorkspace&&) = delete;
@@ -155,6 +161,9 @@ namespace ngraph
                 size_t get_dnnl_descriptors_size();
                 std::vector<size_t>& get_primitive_deps(size_t index);
                 size_t get_max_scratchpad_size() const;
+                // Bytes of the workspaces built so far by all the contexts, which are kept for
+                // the life of the executable
+                size_t get_workspace_bytes() const;
 
                 size_t build_quantized_inner_product_forward(
                     const dnnl::memory::desc& input_data_desc,
@@ -459,6 +468,10 @@ namespace ngraph
 
                 dnnl::eltwise_backward::desc get_sigmoid_backward_desc(const ngraph::Node* node);
 
+                // Exp, Gelu, Log, Sqrt or Tanh with the algorithm of
+                // dnnl_utils::get_eltwise_algorithm
+                dnnl::eltwise_forward::desc get_eltwise_forward_desc(const ngraph::Node* node);
+
                 dnnl::sum::primitive_desc get_elementwise_add_desc(const ngraph::Node* node);
 
                 template <typename OP>
@@ -615,14 +628,12 @@ namespace ngraph
                     // from each pos.
                     Strides window_dilation_strides_adjusted;
 
-                    dnnl::algorithm convolution_algo = dnnl_utils::get_conv_algo();
-
-                    if ((node->get_input_element_type(0) != element::f32 &&
-                         convolution_algo != dnnl::algorithm::convolution_direct) ||
-                        convolution->get_input_shape(0)[1] <= 8)
-                    {
-                        convolution_algo = dnnl::algorithm::convolution_direct;
-                    }
+                    dnnl::algorithm convolution_algo = dnnl_utils::get_conv_forward_algo(
+                        node,
+                        convolution->get_window_movement_strides(),
+                        convolution->get_window_dilation_strides(),
+                        convolution->get_padding_below(),
+                        convolution->get_padding_above());
 
                     for (size_t s : convolution->get_window_dilation_strides())
                     {
@@ -708,6 +719,14 @@ namespace ngraph
                 size_t convolution_forward_init(bool with_bias = false);
                 size_t inner_product_forward_init(bool with_bias = false);
 
+                /// \brief Inner product descriptor for a row major 2D Dot of [m, k] and [k, n].
+                ///
+                /// The [k, n] weights are described in place as a [n, k] matrix with transposed
+                /// strides. For bf16 arguments DNNL accumulates in f32 and only rounds the
+                /// finished result.
+                dnnl::inner_product_forward::desc
+                    get_dot_inner_product_forward_desc(const ngraph::Node* node);
+
                 template <typename OP>
                 dnnl::inner_product_forward::desc
                     get_inner_product_forward_desc(const ngraph::Node* node)
@@ -1080,6 +1099,13 @@ namespace ngraph
                                          const std::vector<size_t>& deps,
                                          size_t relu_index);
 
+                void build_eltwise_forward(std::vector<dnnl::memory*>& dnnl_memories,
+                                           std::vector<dnnl::primitive*>& dnnl_primitives,
+                                           std::vector<dnnl::memory::desc*>& dnnl_scratchpad_mds,
+                                           const dnnl::eltwise_forward::desc& eltwise_desc,
+                                           const std::vector<size_t>& deps,
+                                           size_t eltwise_index);
+
                 void build_sigmoid_forward(std::vector<dnnl::memory*>& dnnl_memories,
                                            std::vector<dnnl::primitive*>& dnnl_primitives,
                                            std::vector<dnnl::memory::desc*>& dnnl_scratchpad_mds,
@@ -1213,7 +1239,7 @@ namespace ngraph
                     return dnnl::concat::primitive_desc(result_desc,
                                                         static_cast<int>(concat_dim),
                                                         inputs_desc,
-                                                        runtime::cpu::executor::global_cpu_engine,
+                                                        runtime::cpu::executor::get_cpu_engine(),
                                                         attr);
                 }
 
@@ -1400,6 +1426,81 @@ namespace ngraph
                                                            dst_layer_desc,
                                                            dst_iter_desc);
                 }
+                // DESC is the descriptor of gru_forward or, for the linear before reset GRU,
+                // lbr_gru_forward, whose bias has a fourth gate
+                template <typename OP, typename DESC>
+                DESC get_gru_forward_desc(const ngraph::Node* node,
+                                          const std::vector<TensorWrapper>& args,
+                                          const std::vector<TensorWrapper>& out)
+                {
+                    auto rnn_node = static_cast<const OP*>(node);
+                    auto src_sequence_length_max =
+                        static_cast<unsigned long>(rnn_node->get_src_sequence_length());
+                    auto direction = static_cast<unsigned long>(rnn_node->get_direction());
+                    auto num_fused_layers =
+                        static_cast<unsigned long>(rnn_node->get_num_fused_layers());
+                    auto feature_size =
+                        static_cast<unsigned long>(rnn_node->get_src_iter_feature_size());
+                    auto batch = static_cast<unsigned long>(rnn_node->get_batch_size());
+                    auto rnn_cell_n_gates =
+                        static_cast<unsigned long>(rnn_node->get_gates_per_cell());
+                    auto bias_n_gates =
+                        rnn_node->is_type(ngraph::runtime::cpu::rnn_utils::rnntype::lbr_gru)
+                            ? rnn_cell_n_gates + 1
+                            : rnn_cell_n_gates;
+
+                    auto get_dnnl_rnn_direction = [&]() {
+                        switch (direction)
+                        {
+                        case 1: return dnnl::rnn_direction::unidirectional_left2right;
+                        case 2: return dnnl::rnn_direction::bidirectional_concat;
+                        default: throw ngraph_error("unsupported dnnl rnn direction");
+                        }
+                    };
+
+                    Shape src_layer_tz{
+                        src_sequence_length_max,
+                        batch,
+                        static_cast<unsigned long>(rnn_node->get_src_layer_feature_size())};
+                    Shape src_iter_tz{num_fused_layers, direction, batch, feature_size};
+                    Shape wei_layer_tz{
+                        num_fused_layers,
+                        direction,
+                        static_cast<unsigned long>(rnn_node->get_src_layer_feature_size()),
+                        rnn_cell_n_gates,
+                        feature_size};
+                    Shape wei_iter_tz{
+                        num_fused_layers, direction, feature_size, rnn_cell_n_gates, feature_size};
+                    Shape bias_tz{num_fused_layers, direction, bias_n_gates, feature_size};
+                    Shape dst_layer_tz{src_sequence_length_max, batch, direction * feature_size};
+                    Shape dst_iter_tz{num_fused_layers, direction, batch, feature_size};
+
+                    auto src_layer_desc = build_memory_descriptor(
+                        src_layer_tz, args[0].get_element_type(), dnnl::memory::FORMAT::tnc);
+                    auto src_iter_desc = build_memory_descriptor(
+                        src_iter_tz, args[1].get_element_type(), dnnl::memory::FORMAT::ldnc);
+                    auto weights_layer_desc = build_memory_descriptor(
+                        wei_layer_tz, args[2].get_element_type(), dnnl::memory::FORMAT::ldigo);
+                    auto weights_iter_desc = build_memory_descriptor(
+                        wei_iter_tz, args[3].get_element_type(), dnnl::memory::FORMAT::ldigo);
+                    auto bias_desc = build_memory_descriptor(
+                        bias_tz, args[4].get_element_type(), dnnl::memory::FORMAT::ldgo);
+                    auto dst_layer_desc = build_memory_descriptor(
+                        dst_layer_tz, out[0].get_element_type(), dnnl::memory::FORMAT::tnc);
+                    auto dst_iter_desc = build_memory_descriptor(
+                        dst_iter_tz, out[1].get_element_type(), dnnl::memory::FORMAT::ldnc);
+
+                    return DESC(dnnl::prop_kind::forward_inference,
+                                get_dnnl_rnn_direction(),
+                                src_layer_desc,
+                                src_iter_desc,
+                                weights_layer_desc,
+                                weights_iter_desc,
+                                bias_desc,
+                                dst_layer_desc,
+                                dst_iter_desc);
+                }
+
                 void build_rnn_forward(std::vector<dnnl::memory*>& dnnl_memories,
                                        std::vector<dnnl::primitive*>& dnnl_primitives,
                                        std::vector<dnnl::memory::desc*>& dnnl_scratchpad_mds,
@@ -1417,6 +1518,20 @@ namespace ngraph
                                               std::vector<size_t>& deps,
                                               size_t rnn_idx);
 
+                void build_gru_forward(std::vector<dnnl::memory*>& dnnl_memories,
+                                       std::vector<dnnl::primitive*>& dnnl_primitives,
+                                       std::vector<dnnl::memory::desc*>& dnnl_scratchpad_mds,
+                                       const dnnl::gru_forward::desc& desc,
+                                       const std::vector<size_t>& deps,
+                                       size_t rnn_idx);
+
+                void build_gru_forward(std::vector<dnnl::memory*>& dnnl_memories,
+                                       std::vector<dnnl::primitive*>& dnnl_primitives,
+                                       std::vector<dnnl::memory::desc*>& dnnl_scratchpad_mds,
+                                       const dnnl::lbr_gru_forward::desc& desc,
+                                       const std::vector<size_t>& deps,
+                                       size_t rnn_idx);
+
                 template <bool with_bias>
                 void
                     build_convolution_forward(std::vector<dnnl::memory*>& dnnl_memories,
@@ -1453,8 +1568,10 @@ namespace ngraph
                     dnnl_scratchpad_mds[conv_idx] =
                         new dnnl::memory::desc(conv_pd.scratchpad_desc());
 
-                    dnnl::primitive* prim = new dnnl::convolution_forward(conv_pd);
-                    dnnl_primitives[conv_idx] = prim;
+                    DNNLPrimitiveKey key("convolution_forward");
+                    key.append(desc.data).append(attr).append(engine.get());
+                    dnnl_primitives[conv_idx] =
+                        create_cached_primitive<dnnl::convolution_forward>(key, conv_pd);
                 }
 
                 template <bool with_bias>
@@ -1492,8 +1609,10 @@ namespace ngraph
                     auto ip_pd = dnnl::inner_product_forward::primitive_desc(desc, attr, engine);
                     dnnl_scratchpad_mds[ip_idx] = new dnnl::memory::desc(ip_pd.scratchpad_desc());
 
-                    dnnl::primitive* prim = new dnnl::inner_product_forward(ip_pd);
-                    dnnl_primitives[ip_idx] = prim;
+                    DNNLPrimitiveKey key("inner_product_forward");
+                    key.append(desc.data).append(attr).append(engine.get());
+                    dnnl_primitives[ip_idx] =
+                        create_cached_primitive<dnnl::inner_product_forward>(key, ip_pd);
                 }
 
                 size_t query_scratchpad_sum(const dnnl::sum::primitive_desc);
@@ -1537,6 +1656,8 @@ namespace ngraph
                 size_t query_scratchpad_rnn_forward(const dnnl::lstm_forward::desc& desc);
                 size_t query_scratchpad_vanilla_rnn_forward(
                     const dnnl::vanilla_rnn_forward::desc& desc);
+                size_t query_scratchpad_gru_forward(const dnnl::gru_forward::desc& desc);
+                size_t query_scratchpad_gru_forward(const dnnl::lbr_gru_forward::desc& desc);
                 size_t query_scratchpad_slice(dnnl::memory::desc& input_desc,
                                               const dnnl::memory::desc& output_desc,
                                               const ngraph::Coordinate& lower_bounds,
@@ -1544,6 +1665,14 @@ namespace ngraph
                 size_t query_scratchpad_softmax_forward(const dnnl::softmax_forward::desc& desc);
 
             private:
+                template <typename PRIMITIVE>
+                void build_gru_primitive(std::vector<dnnl::memory*>& dnnl_memories,
+                                         std::vector<dnnl::primitive*>& dnnl_primitives,
+                                         std::vector<dnnl::memory::desc*>& dnnl_scratchpad_mds,
+                                         const typename PRIMITIVE::desc& desc,
+                                         const std::vector<size_t>& deps,
+                                         size_t rnn_idx);
+
                 std::vector<dnnl::memory*> m_dnnl_memories;
                 std::vector<dnnl::primitive*> m_dnnl_primitives;
                 std::vector<dnnl::stream> m_dnnl_streams;
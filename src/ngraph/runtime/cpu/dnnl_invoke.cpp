@@ -56,6 +56,7 @@ extern "C" void ngraph::runtime::cpu::dnnl_utils::dnnl_invoke_primitive(CPURunti
     case OpType::MAXPOOL:
     case OpType::QUANTIZE:
     case OpType::DEQUANTIZE:
+    case OpType::ELTWISE:
     case OpType::QUANTIZEDAVGPOOL:
     case OpType::QUANTIZEDMAXPOOL:
     case OpType::RELU:
@@ -105,6 +106,7 @@ extern "C" void ngraph::runtime::cpu::dnnl_utils::dnnl_invoke_primitive(CPURunti
     case OpType::CONVOLUTIONRELU:
     case OpType::CONVOLUTIONADD:
     case OpType::GROUPCONVOLUTION:
+    case OpType::DOT:
     case OpType::QUANTIZEDMATMUL:
     case OpType::QUANTIZEDCONVOLUTION:
     case OpType::QUANTIZEDCONVOLUTIONRELU:
@@ -170,6 +172,15 @@ extern "C" void ngraph::runtime::cpu::dnnl_utils::dnnl_invoke_primitive(CPURunti
                      {DNNL_ARG_DST_ITER, *ctx->dnnl_memories[deps[6]]},
                      {DNNL_ARG_WORKSPACE, *ctx->dnnl_memories[deps[7]]}};
         break;
+    case OpType::GRU:
+        exec_args = {{DNNL_ARG_SRC_LAYER, *ctx->dnnl_memories[deps[0]]},
+                     {DNNL_ARG_SRC_ITER, *ctx->dnnl_memories[deps[1]]},
+                     {DNNL_ARG_WEIGHTS_LAYER, *ctx->dnnl_memories[deps[2]]},
+                     {DNNL_ARG_WEIGHTS_ITER, *ctx->dnnl_memories[deps[3]]},
+                     {DNNL_ARG_BIAS, *ctx->dnnl_memories[deps[4]]},
+                     {DNNL_ARG_DST_LAYER, *ctx->dnnl_memories[deps[5]]},
+                     {DNNL_ARG_DST_ITER, *ctx->dnnl_memories[deps[6]]}};
+        break;
 
     case OpType::MAXPOOLBACKPROPFORWARD:
     case OpType::MAXPOOLWITHINDICES:
@@ -195,12 +206,12 @@ extern "C" void ngraph::runtime::cpu::dnnl_utils::dnnl_invoke_primitive(CPURunti
     if (scratchpad_size)
     {
         dnnl::memory scratchpad(*ctx->dnnl_scratchpad_mds[primitive_index],
-                                executor::global_cpu_engine,
+                                executor::get_cpu_engine(),
                                 ctx->scratchpad_buffer->get_ptr());
         exec_args.insert({DNNL_ARG_SCRATCHPAD, scratchpad});
     }
 
-    dnnl::stream s(executor::global_cpu_engine);
+    dnnl::stream s = executor::GetCPUExecutor().create_dnnl_stream();
     try
     {
         (*ctx->dnnl_primitives[primitive_index]).execute(s, exec_args);
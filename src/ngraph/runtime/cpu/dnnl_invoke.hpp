@@ -51,7 +51,9 @@ namespace ngraph
                     GELUBACKPROP,
                     GROUPCONVOLUTION,
                     GROUPCONVOLUTIONBIAS,
+                    GRU,
                     DECONVOLUTIONBIAS,
+                    DOT,
                     LEAKYRELU,
                     LRN,
                     LSTM,
@@ -62,6 +64,7 @@ namespace ngraph
                     MAXPOOLWITHINDICESBACKPROP,
                     QUANTIZE,
                     DEQUANTIZE,
+                    ELTWISE,
                     QUANTIZEDAVGPOOL,
                     QUANTIZEDMAXPOOL,
                     QUANTIZEDCONCAT,
@@ -0,0 +1,155 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <vector>
+
+#include "ngraph/env_util.hpp"
+#include "ngraph/runtime/cpu/dnnl_primitive_cache.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::cpu::DNNLPrimitiveKey::DNNLPrimitiveKey(const string& kind)
+    : m_key(kind)
+{
+    m_key.push_back('\0');
+}
+
+runtime::cpu::DNNLPrimitiveKey&
+    runtime::cpu::DNNLPrimitiveKey::append(const dnnl::primitive_attr& attr)
+{
+    append(attr.get_scratchpad_mode());
+
+    int mask;
+    vector<float> scales;
+    attr.get_output_scales(mask, scales);
+    append(mask);
+    append(scales.size());
+    m_key.append(reinterpret_cast<const char*>(scales.data()), scales.size() * sizeof(float));
+
+    const dnnl::post_ops ops = attr.get_post_ops();
+    append(ops.len());
+    for (int i = 0; i < ops.len(); i++)
+    {
+        auto kind = ops.kind(i);
+        append(kind);
+        float scale, alpha, beta;
+        dnnl::algorithm alg;
+        switch (kind)
+        {
+        case dnnl::primitive::kind::sum:
+            ops.get_params_sum(i, scale);
+            append(scale);
+            break;
+        case dnnl::primitive::kind::eltwise:
+            ops.get_params_eltwise(i, scale, alg, alpha, beta);
+            append(scale).append(alg).append(alpha).append(beta);
+            break;
+        default: m_valid = false; break;
+        }
+    }
+    return *this;
+}
+
+runtime::cpu::DNNLPrimitiveCache& runtime::cpu::DNNLPrimitiveCache::get()
+{
+    static DNNLPrimitiveCache cache;
+    return cache;
+}
+
+runtime::cpu::DNNLPrimitiveCache::DNNLPrimitiveCache()
+    : m_capacity(static_cast<size_t>(
+          std::max(getenv_int("NGRAPH_DNNL_PRIMITIVE_CACHE_CAPACITY", 1024), 0)))
+{
+}
+
+dnnl::primitive
+    runtime::cpu::DNNLPrimitiveCache::get_or_create(const DNNLPrimitiveKey& key,
+                                                    const function<dnnl::primitive()>& create)
+{
+    bool insert;
+    {
+        lock_guard<mutex> lock(m_mutex);
+        auto it = m_index.find(key.get());
+        if (it != m_index.end())
+        {
+            m_hits++;
+            m_entries.splice(m_entries.begin(), m_entries, it->second);
+            return it->second->second;
+        }
+        m_misses++;
+        insert = m_capacity > 0 && key.is_valid();
+    }
+
+    dnnl::primitive primitive = create();
+    if (!insert)
+    {
+        return primitive;
+    }
+
+    lock_guard<mutex> lock(m_mutex);
+    auto it = m_index.find(key.get());
+    if (it != m_index.end())
+    {
+        // Another thread built the same primitive meanwhile; keep the cached one
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+        return it->second->second;
+    }
+    m_entries.emplace_front(key.get(), primitive);
+    m_index.emplace(key.get(), m_entries.begin());
+    evict();
+    return primitive;
+}
+
+void runtime::cpu::DNNLPrimitiveCache::set_capacity(size_t capacity)
+{
+    lock_guard<mutex> lock(m_mutex);
+    m_capacity = capacity;
+    evict();
+}
+
+size_t runtime::cpu::DNNLPrimitiveCache::get_capacity() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_capacity;
+}
+
+runtime::cpu::DNNLPrimitiveCache::Stats runtime::cpu::DNNLPrimitiveCache::get_stats() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return Stats{m_hits, m_misses, m_evictions, m_entries.size(), m_capacity};
+}
+
+void runtime::cpu::DNNLPrimitiveCache::clear()
+{
+    lock_guard<mutex> lock(m_mutex);
+    m_entries.clear();
+    m_index.clear();
+    m_hits = 0;
+    m_misses = 0;
+    m_evictions = 0;
+}
+
+void runtime::cpu::DNNLPrimitiveCache::evict()
+{
+    while (m_entries.size() > m_capacity)
+    {
+        m_index.erase(m_entries.back().first);
+        m_entries.pop_back();
+        m_evictions++;
+    }
+}
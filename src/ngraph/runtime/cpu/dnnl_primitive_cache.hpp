@@ -0,0 +1,136 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+#include <dnnl.hpp>
+
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// \brief Builds the key identifying a DNNL primitive from the descriptors and
+            ///        attributes it is created with.
+            class CPU_BACKEND_API DNNLPrimitiveKey
+            {
+            public:
+                /// \param kind Distinguishes primitives whose descriptors share a layout, e.g.
+                ///        the forward and backward passes of the same op.
+                explicit DNNLPrimitiveKey(const std::string& kind);
+
+                /// Appends the raw bytes of a C descriptor, such as the `data` member of a
+                /// DNNL op or memory descriptor.
+                template <typename T>
+                DNNLPrimitiveKey& append(const T& desc)
+                {
+                    static_assert(std::is_trivially_copyable<T>::value,
+                                  "Only plain descriptor structs can be part of a key");
+                    m_key.append(reinterpret_cast<const char*>(&desc), sizeof(T));
+                    return *this;
+                }
+
+                /// Appends the scratchpad mode, output scales and post-ops of `attr`. Post-ops
+                /// other than sum and eltwise cannot be described, in which case the key is
+                /// marked invalid.
+                DNNLPrimitiveKey& append(const dnnl::primitive_attr& attr);
+
+                bool is_valid() const { return m_valid; }
+                const std::string& get() const { return m_key; }
+
+            private:
+                std::string m_key;
+                bool m_valid{true};
+            };
+
+            /// \brief Process-wide LRU cache of DNNL primitives shared by every executable and
+            ///        call frame of the CPU backend.
+            ///
+            /// The executables own handles to the primitives they use, so evicting an entry only
+            /// drops the cache's reference. Sharing is safe because all primitives are created
+            /// with a user-managed scratchpad. The capacity defaults to
+            /// NGRAPH_DNNL_PRIMITIVE_CACHE_CAPACITY, or 1024 if that is not set; a capacity of 0
+            /// disables caching.
+            class CPU_BACKEND_API DNNLPrimitiveCache
+            {
+            public:
+                struct Stats
+                {
+                    size_t hits;
+                    size_t misses;
+                    size_t evictions;
+                    size_t size;
+                    size_t capacity;
+                };
+
+                static DNNLPrimitiveCache& get();
+
+                /// Returns the primitive cached under `key`, calling `create` to build and
+                /// insert it if there is none. `create` runs without the cache locked, so
+                /// different primitives can be built concurrently.
+                dnnl::primitive get_or_create(const DNNLPrimitiveKey& key,
+                                              const std::function<dnnl::primitive()>& create);
+
+                /// Evicts least recently used entries down to `capacity`.
+                void set_capacity(size_t capacity);
+                size_t get_capacity() const;
+                Stats get_stats() const;
+                /// Drops all entries and resets the hit, miss and eviction counts.
+                void clear();
+
+            private:
+                DNNLPrimitiveCache();
+                DNNLPrimitiveCache(const DNNLPrimitiveCache&) = delete;
+                DNNLPrimitiveCache& operator=(const DNNLPrimitiveCache&) = delete;
+
+                void evict();
+
+                using Entry = std::pair<std::string, dnnl::primitive>;
+
+                mutable std::mutex m_mutex;
+                // Most recently used entries first
+                std::list<Entry> m_entries;
+                std::unordered_map<std::string, std::list<Entry>::iterator> m_index;
+                size_t m_capacity;
+                size_t m_hits{0};
+                size_t m_misses{0};
+                size_t m_evictions{0};
+            };
+
+            /// \brief Returns a new handle to the PRIMITIVE created from `pd`, shared through
+            ///        the process-wide cache under `key`.
+            template <typename PRIMITIVE, typename PRIMITIVE_DESC>
+            dnnl::primitive* create_cached_primitive(const DNNLPrimitiveKey& key,
+                                                     const PRIMITIVE_DESC& pd)
+            {
+                return new dnnl::primitive(DNNLPrimitiveCache::get().get_or_create(
+                    key, [&pd]() -> dnnl::primitive { return PRIMITIVE(pd); }));
+            }
+        }
+    }
+}
@@ -14,11 +14,24 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <set>
+#include <sstream>
 #include <string>
 #include <typeindex>
 #include <typeinfo>
+#include <unordered_map>
 #include <unordered_set>
 
+#include "ngraph/env_util.hpp"
+#include "ngraph/file_util.hpp"
+#include "ngraph/log.hpp"
 #include "ngraph/node.hpp"
 #include "ngraph/op/add.hpp"
 #include "ngraph/op/avg_pool.hpp"
@@ -26,14 +39,21 @@
 #include "ngraph/op/concat.hpp"
 #include "ngraph/op/conv_fused.hpp"
 #include "ngraph/op/convolution.hpp"
+#include "ngraph/op/exp.hpp"
+#include "ngraph/op/gelu.hpp"
+#include "ngraph/op/log.hpp"
 #include "ngraph/op/max_pool.hpp"
 #include "ngraph/op/relu.hpp"
 #include "ngraph/op/reshape.hpp"
+#include "ngraph/op/sqrt.hpp"
+#include "ngraph/op/tanh.hpp"
+#include "ngraph/runtime/cpu/cpu_compile_cache.hpp"
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
 #include "ngraph/type/element_type.hpp"
+#include "ngraph/util.hpp"
 
 #include "dnnl_utils.hpp"
 
@@ -203,6 +223,54 @@ void runtime::cpu::dnnl_utils::assign_dnnl_kernel(Node* node)
     ngraph_op->set_op_annotations(op_annotations);
 }
 
+bool runtime::cpu::dnnl_utils::use_dnnl_eltwise(const ngraph::Node* node)
+{
+    static const std::set<std::string> supported{"Exp", "Gelu", "Log", "Sqrt", "Tanh"};
+    if (node->get_input_element_type(0) != element::f32 ||
+        supported.count(node->description()) == 0)
+    {
+        return false;
+    }
+    auto selected = getenv_string("NGRAPH_CPU_DNNL_ELTWISE");
+    if (selected.empty())
+    {
+        return true;
+    }
+    for (auto& name : split(selected, ',', true))
+    {
+        if (name == node->description())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+dnnl::algorithm runtime::cpu::dnnl_utils::get_eltwise_algorithm(const ngraph::Node* node)
+{
+    if (is_type<ngraph::op::v0::Exp>(node))
+    {
+        return dnnl::algorithm::eltwise_exp;
+    }
+    else if (is_type<ngraph::op::v0::Gelu>(node))
+    {
+        return dnnl::algorithm::eltwise_gelu_erf;
+    }
+    else if (is_type<ngraph::op::v0::Log>(node))
+    {
+        return dnnl::algorithm::eltwise_log;
+    }
+    else if (is_type<ngraph::op::v0::Sqrt>(node))
+    {
+        return dnnl::algorithm::eltwise_sqrt;
+    }
+    else if (is_type<ngraph::op::v0::Tanh>(node))
+    {
+        return dnnl::algorithm::eltwise_tanh;
+    }
+    throw ngraph_error("No DNNL eltwise algorithm for " + node->description());
+}
+
 bool runtime::cpu::dnnl_utils::can_use_dnnl_batchnorm_fprop(const ngraph::Node* node)
 {
     auto input_rank = node->get_input_shape(2).size();
@@ -239,6 +307,195 @@ dnnl::algorithm runtime::cpu::dnnl_utils::get_conv_algo()
     return dnnl::algorithm::convolution_direct;
 }
 
+namespace
+{
+    // Forward convolution algorithms chosen by timing, by convolution geometry
+    struct ConvAlgoDatabase
+    {
+        std::mutex mutex;
+        bool loaded = false;
+        std::map<std::string, dnnl::algorithm> choices;
+    };
+
+    ConvAlgoDatabase& get_conv_algo_database()
+    {
+        static ConvAlgoDatabase database;
+        return database;
+    }
+
+    std::string get_conv_algo_database_path()
+    {
+        auto cache_dir = runtime::cpu::get_compile_cache_dir();
+        return cache_dir.empty() ? ""
+                                 : file_util::path_join(cache_dir, "dnnl_conv_algorithms.txt");
+    }
+
+    const std::map<std::string, dnnl::algorithm>& get_conv_algo_names()
+    {
+        static const std::map<std::string, dnnl::algorithm> names{
+            {"auto", dnnl::algorithm::convolution_auto},
+            {"direct", dnnl::algorithm::convolution_direct},
+            {"winograd", dnnl::algorithm::convolution_winograd}};
+        return names;
+    }
+
+    // Average time of a run of the convolution on zeroed buffers in the layouts it prefers
+    double time_conv_forward(const convolution_forward::desc& desc)
+    {
+        auto& engine = runtime::cpu::executor::get_cpu_engine();
+        convolution_forward::primitive_desc prim_desc(desc, engine);
+        std::unordered_map<int, memory> args{
+            {DNNL_ARG_SRC, memory(prim_desc.src_desc(), engine)},
+            {DNNL_ARG_WEIGHTS, memory(prim_desc.weights_desc(), engine)},
+            {DNNL_ARG_DST, memory(prim_desc.dst_desc(), engine)}};
+        for (auto& arg : args)
+        {
+            memset(arg.second.get_data_handle(), 0, arg.second.get_desc().get_size());
+        }
+        convolution_forward convolution(prim_desc);
+        auto stream = runtime::cpu::executor::GetCPUExecutor().create_dnnl_stream();
+        convolution.execute(stream, args);
+        stream.wait();
+
+        const int runs = 5;
+        auto start = chrono::steady_clock::now();
+        for (int i = 0; i < runs; i++)
+        {
+            convolution.execute(stream, args);
+        }
+        stream.wait();
+        return chrono::duration<double>(chrono::steady_clock::now() - start).count() / runs;
+    }
+}
+
+dnnl::algorithm
+    runtime::cpu::dnnl_utils::get_conv_forward_algo(const ngraph::Node* node,
+                                                    const Strides& strides,
+                                                    const Strides& dilations,
+                                                    const CoordinateDiff& padding_below,
+                                                    const CoordinateDiff& padding_above)
+{
+    auto algo = get_conv_algo();
+    auto& data_shape = node->get_input_shape(0);
+    auto& weights_shape = node->get_input_shape(1);
+    bool is_f32 = node->get_input_element_type(0) == element::f32;
+    // I/p channels less than 8 & convolution_algo = convolution_auto
+    // forces src format to be nChw16c & the weight format to be
+    // OIhw16i16o which invokes dnnl reference implementation of conv
+    // which crashes as it has no support for post ops
+    if ((!is_f32 && algo != dnnl::algorithm::convolution_direct) || data_shape[1] <= 8)
+    {
+        return dnnl::algorithm::convolution_direct;
+    }
+
+    // Winograd only covers ungrouped 2D 3x3 convolutions with unit strides and no dilation
+    auto is_one = [](size_t x) { return x == 1; };
+    if (!is_f32 || !getenv_bool("NGRAPH_CPU_CONV_AUTOTUNE") || data_shape.size() != 4 ||
+        weights_shape.size() != 4 || weights_shape[1] != data_shape[1] ||
+        weights_shape[2] != 3 || weights_shape[3] != 3 ||
+        !std::all_of(strides.begin(), strides.end(), is_one) ||
+        !std::all_of(dilations.begin(), dilations.end(), is_one))
+    {
+        return algo;
+    }
+
+    auto& result_shape = node->get_output_shape(0);
+    std::stringstream ss;
+    ss << join(data_shape, "x") << "," << join(weights_shape, "x") << ","
+       << join(result_shape, "x") << "," << join(padding_below, "x") << ","
+       << join(padding_above, "x");
+    auto key = ss.str();
+
+    // Convolutions are timed one at a time so they do not slow each other down
+    auto& database = get_conv_algo_database();
+    std::lock_guard<std::mutex> lock(database.mutex);
+    auto path = get_conv_algo_database_path();
+    if (!database.loaded)
+    {
+        database.loaded = true;
+        if (!path.empty() && file_util::exists(path))
+        {
+            std::ifstream in(path);
+            std::string entry_key;
+            std::string name;
+            while (in >> entry_key >> name)
+            {
+                auto it = get_conv_algo_names().find(name);
+                if (it != get_conv_algo_names().end())
+                {
+                    database.choices[entry_key] = it->second;
+                }
+            }
+        }
+    }
+    auto it = database.choices.find(key);
+    if (it != database.choices.end())
+    {
+        return it->second;
+    }
+
+    memory::desc data_desc(memory::dims(data_shape.begin(), data_shape.end()),
+                           memory::data_type::f32,
+                           memory::FORMAT::any);
+    memory::desc weights_desc(memory::dims(weights_shape.begin(), weights_shape.end()),
+                              memory::data_type::f32,
+                              memory::FORMAT::any);
+    memory::desc result_desc(memory::dims(result_shape.begin(), result_shape.end()),
+                             memory::data_type::f32,
+                             memory::FORMAT::any);
+    memory::dims dilations_adjusted(dilations.size(), 0);
+    auto best = algo;
+    double best_seconds = std::numeric_limits<double>::max();
+    std::vector<dnnl::algorithm> candidates{algo};
+    if (algo != dnnl::algorithm::convolution_winograd)
+    {
+        candidates.push_back(dnnl::algorithm::convolution_winograd);
+    }
+    for (auto candidate : candidates)
+    {
+        try
+        {
+            convolution_forward::desc desc(
+                prop_kind::forward_inference,
+                candidate,
+                data_desc,
+                weights_desc,
+                result_desc,
+                memory::dims(strides.begin(), strides.end()),
+                dilations_adjusted,
+                memory::dims(padding_below.begin(), padding_below.end()),
+                memory::dims(padding_above.begin(), padding_above.end()));
+            double seconds = time_conv_forward(desc);
+            if (seconds < best_seconds)
+            {
+                best = candidate;
+                best_seconds = seconds;
+            }
+        }
+        catch (const dnnl::error& e)
+        {
+            // Winograd is not implemented for every shape and instruction set
+            NGRAPH_DEBUG << "Convolution " << key << " cannot use algorithm "
+                         << static_cast<int>(candidate) << ": " << DNNL_ERROR_MESSAGE;
+        }
+    }
+
+    database.choices[key] = best;
+    if (!path.empty())
+    {
+        for (auto& name : get_conv_algo_names())
+        {
+            if (name.second == best)
+            {
+                file_util::make_directory(file_util::get_directory(path));
+                std::ofstream out(path, std::ios::app);
+                out << key << " " << name.first << "\n";
+            }
+        }
+    }
+    return best;
+}
+
 bool runtime::cpu::dnnl_utils::can_use_dnnl_batchnorm_bprop(const ngraph::Node* node)
 {
     auto input_rank = node->get_input_shape(2).size();
@@ -1197,6 +1454,23 @@ bool runtime::cpu::dnnl_utils::is_dnnl_desc_blocked_data_format(const dnnl::memo
     return blk.inner_nblks != 0;
 }
 
+size_t runtime::cpu::dnnl_utils::get_channel_block_size(const dnnl::memory::desc& desc)
+{
+    if (desc.data.ndims != 4)
+    {
+        return 1;
+    }
+    if (dnnl_md_matches_format_tag(desc, dnnl::memory::format_tag::nChw8c))
+    {
+        return 8;
+    }
+    if (dnnl_md_matches_format_tag(desc, dnnl::memory::format_tag::nChw16c))
+    {
+        return 16;
+    }
+    return 1;
+}
+
 bool runtime::cpu::dnnl_utils::is_bf16_supported()
 {
     try
@@ -18,11 +18,13 @@
 
 #include <dnnl.hpp>
 #include "ngraph/axis_vector.hpp"
+#include "ngraph/coordinate_diff.hpp"
 #include "ngraph/node.hpp"
 #include "ngraph/op/batch_norm.hpp"
 #include "ngraph/runtime/cpu/cpu_backend_visibility.h"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
+#include "ngraph/strides.hpp"
 #include "ngraph/type/element_type.hpp"
 
 #define TENSOR_MAX_DIMS DNNL_MAX_NDIMS
@@ -67,7 +69,6 @@ namespace ngraph
         {
             namespace dnnl_utils
             {
-                extern dnnl::engine global_cpu_engine;
 #ifndef _WIN32
                 extern "C" void mkl_serv_free_buffers();
 #endif
@@ -127,12 +128,29 @@ namespace ngraph
                 //
                 dnnl::algorithm get_conv_algo();
 
+                // Algorithm of the f32 or quantized forward convolution node: get_conv_algo(),
+                // or direct where auto would pick a reference kernel. With
+                // NGRAPH_CPU_CONV_AUTOTUNE, 2D 3x3 unit-stride f32 convolutions instead use
+                // the faster of that and Winograd, timed once per convolution geometry and
+                // remembered in NGRAPH_CPU_CACHE_DIR when the compile cache is enabled.
+                dnnl::algorithm get_conv_forward_algo(const ngraph::Node* node,
+                                                      const Strides& strides,
+                                                      const Strides& dilations,
+                                                      const CoordinateDiff& padding_below,
+                                                      const CoordinateDiff& padding_above);
+
                 // Placeholder for when "auto" support is added for deconv
                 dnnl::algorithm get_deconv_algo();
 
                 bool use_dnnl_kernel(const ngraph::Node* node);
                 void assign_dnnl_kernel(Node* node);
 
+                // Whether an f32 Exp, Gelu, Log, Sqrt or Tanh runs on the DNNL eltwise JIT
+                // kernels. NGRAPH_CPU_DNNL_ELTWISE lists the ops to lower by name, e.g.
+                // "Tanh,Exp" or "none"; when it is unset all of them are.
+                bool use_dnnl_eltwise(const ngraph::Node* node);
+                dnnl::algorithm get_eltwise_algorithm(const ngraph::Node* node);
+
                 std::map<element::Type, const dnnl::memory::data_type>& get_dnnl_data_type_map();
                 std::map<element::Type, const std::string>& get_dnnl_data_type_string_map();
                 std::map<dnnl::memory::FORMAT, const std::string>& get_dnnl_format_string_map();
@@ -221,6 +239,8 @@ namespace ngraph
                                                                        dnnl::memory::dims& strides,
                                                                        bool is_output);
                 bool is_dnnl_desc_blocked_data_format(const dnnl::memory::desc& desc);
+                // 8 or 16 for a 4D feature map in nChw8c or nChw16c, 1 for anything else
+                size_t get_channel_block_size(const dnnl::memory::desc& desc);
             }
         }
     }
@@ -0,0 +1,170 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // b is better than a; NaNs are never better, as in the reference kernels
+                template <bool Max, typename T>
+                inline bool arg_better(T b, T a)
+                {
+                    return Max ? b > a : b < a;
+                }
+
+                // Index of the first best element of a contiguous line. The best value is
+                // found with independent lanes, which vectorize, and its first position with a
+                // second scan that stops there. Like the reference, a NaN at position 0 is
+                // never replaced and other NaNs are never chosen.
+                template <bool Max, typename T>
+                size_t arg_reduce_contiguous(const T* in, size_t n)
+                {
+                    if (n == 0 || in[0] != in[0])
+                    {
+                        return 0;
+                    }
+                    constexpr size_t lanes = 16;
+                    T best[lanes];
+                    std::fill(best, best + lanes, in[0]);
+                    size_t i = 0;
+                    for (; i + lanes <= n; i += lanes)
+                    {
+                        for (size_t l = 0; l < lanes; l++)
+                        {
+                            best[l] = arg_better<Max>(in[i + l], best[l]) ? in[i + l] : best[l];
+                        }
+                    }
+                    for (; i < n; i++)
+                    {
+                        best[0] = arg_better<Max>(in[i], best[0]) ? in[i] : best[0];
+                    }
+                    T value = best[0];
+                    for (size_t l = 1; l < lanes; l++)
+                    {
+                        value = arg_better<Max>(best[l], value) ? best[l] : value;
+                    }
+                    for (i = 0; i < n; i++)
+                    {
+                        if (in[i] == value)
+                        {
+                            break;
+                        }
+                    }
+                    return i;
+                }
+
+                // ArgMax/ArgMin along an axis of length n with `inner` elements after it.
+                // Work items [begin, end) are whole lines when the axis is innermost, and
+                // chunks of `chunk` neighbouring lines otherwise, which are scanned together row
+                // by row. Values, when not null, receive the chosen elements.
+                template <bool Max, typename InType, typename OutType>
+                void arg_reduce_lines(const InType* in,
+                                      OutType* out,
+                                      InType* values,
+                                      size_t n,
+                                      size_t inner,
+                                      size_t begin,
+                                      size_t end)
+                {
+                    if (inner == 1)
+                    {
+                        for (size_t line = begin; line < end; line++)
+                        {
+                            const InType* src = in + line * n;
+                            size_t index = arg_reduce_contiguous<Max>(src, n);
+                            out[line] = static_cast<OutType>(index);
+                            if (values)
+                            {
+                                values[line] = src[index];
+                            }
+                        }
+                        return;
+                    }
+
+                    constexpr size_t chunk = 64;
+                    const size_t chunks = (inner + chunk - 1) / chunk;
+                    for (size_t w = begin; w < end; w++)
+                    {
+                        size_t outer = w / chunks;
+                        size_t first = (w % chunks) * chunk;
+                        size_t width = std::min(chunk, inner - first);
+                        const InType* src = in + outer * n * inner + first;
+                        InType best[chunk];
+                        OutType index[chunk];
+                        std::copy(src, src + width, best);
+                        std::fill(index, index + width, OutType(0));
+                        for (size_t i = 1; i < n; i++)
+                        {
+                            const InType* row = src + i * inner;
+                            for (size_t j = 0; j < width; j++)
+                            {
+                                bool better = arg_better<Max>(row[j], best[j]);
+                                best[j] = better ? row[j] : best[j];
+                                index[j] = better ? static_cast<OutType>(i) : index[j];
+                            }
+                        }
+                        std::copy(index, index + width, out + outer * inner + first);
+                        if (values)
+                        {
+                            std::copy(best, best + width, values + outer * inner + first);
+                        }
+                    }
+                }
+
+                template <bool Max, typename InType, typename OutType>
+                void arg_reduce(void* input,
+                                void* output,
+                                void* values,
+                                const Shape& input_shape,
+                                size_t axis,
+                                int arena)
+                {
+                    size_t n = input_shape[axis];
+                    size_t inner =
+                        shape_size(Shape(input_shape.begin() + axis + 1, input_shape.end()));
+                    size_t lines = n == 0 ? 0 : shape_size(input_shape) / n;
+                    size_t work = inner == 1 ? lines : (lines / inner) * ((inner + 63) / 64);
+                    size_t width = inner == 1 ? 1 : std::min(inner, size_t(64));
+
+                    auto in = static_cast<const InType*>(input);
+                    auto out = static_cast<OutType*>(output);
+                    auto vals = static_cast<InType*>(values);
+                    auto reduce = [&](Eigen::Index first, Eigen::Index last) {
+                        arg_reduce_lines<Max>(in, out, vals, n, inner, first, last);
+                    };
+                    Eigen::TensorOpCost cost(
+                        n * width * sizeof(InType), width * sizeof(OutType), 2 * n * width);
+                    ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        work, cost, reduce);
+                }
+            }
+        }
+    }
+}
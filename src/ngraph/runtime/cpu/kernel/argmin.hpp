@@ -16,11 +16,7 @@
 
 #pragma once
 
-#define EIGEN_USE_THREADS
-#include <unsupported/Eigen/CXX11/Tensor>
-
-#include "ngraph/axis_set.hpp"
-#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/kernel/arg_reduce.hpp"
 #include "ngraph/shape.hpp"
 
 namespace ngraph
@@ -31,34 +27,15 @@ namespace ngraph
         {
             namespace kernel
             {
-                template <typename InType, typename OutType, unsigned int Rank>
+                template <typename InType, typename OutType>
                 void argmin(void* input,
                             void* output,
                             const Shape& input_shape,
-                            const Shape& output_shape,
                             size_t axis,
                             int arena)
                 {
-                    Eigen::array<Eigen::Index, Rank - 1> out_dims;
-                    Eigen::array<Eigen::Index, Rank> in_dims;
-
-                    for (size_t i = 0; i < Rank; i++)
-                    {
-                        in_dims[i] = input_shape[i];
-                    }
-
-                    for (size_t i = 0; i < Rank - 1; i++)
-                    {
-                        out_dims[i] = output_shape[i];
-                    }
-
-                    Eigen::TensorMap<Eigen::Tensor<OutType, Rank - 1, Eigen::RowMajor>> out(
-                        static_cast<OutType*>(output), out_dims);
-                    Eigen::TensorMap<Eigen::Tensor<InType, Rank, Eigen::RowMajor>> in(
-                        static_cast<InType*>(input), in_dims);
-
-                    out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
-                        in.argmin(axis).template cast<OutType>();
+                    arg_reduce<false, InType, OutType>(
+                        input, output, nullptr, input_shape, axis, arena);
                 }
             }
         }
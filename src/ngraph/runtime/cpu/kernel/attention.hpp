@@ -0,0 +1,208 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// \brief Sizes of a ScaledDotProductAttention, the leading axes of its inputs
+                ///        flattened into batch.
+                struct AttentionShape
+                {
+                    size_t batch;
+                    size_t queries;
+                    size_t keys;
+                    size_t depth;
+                    size_t value_depth;
+                    // key is [keys, depth] rather than [depth, keys]
+                    bool transpose_key;
+                    float scale;
+                    // Offset of the mask of each batch index and strides of the mask along
+                    // the queries and the keys, 0 where it is broadcast
+                    std::vector<size_t> mask_batch_offsets;
+                    size_t mask_query_stride;
+                    size_t mask_key_stride;
+                    // With a causal prefix, query i is at position prefix_position + i of a
+                    // sequence and sees the keys up to it; the keys after the last query's
+                    // position, such as the unused rows of a KV cache, are never read
+                    bool causal_prefix;
+                    size_t prefix_position;
+                };
+
+                // Queries of a tile and keys of a block; a tile of queries keeps the scores
+                // of one block and its own accumulators, a few tens of KB
+                static const size_t attention_query_block = 32;
+                static const size_t attention_key_block = 64;
+
+                /// \brief Computes the output rows [query_begin, query_end) of batch index b,
+                ///        at most attention_query_block of them.
+                ///
+                /// The keys are visited block by block with an online softmax: each row keeps
+                /// the running maximum of its scores, the running sum of their exponentials
+                /// and the weighted sum of the values, rescaled whenever the maximum grows,
+                /// so only the scores of the current block ever exist.
+                inline void attention_tile(const float* query,
+                                           const float* key,
+                                           const float* value,
+                                           const float* mask,
+                                           float* out,
+                                           const AttentionShape& shape,
+                                           size_t b,
+                                           size_t query_begin,
+                                           size_t query_end)
+                {
+                    const size_t rows = query_end - query_begin;
+                    const size_t depth = shape.depth;
+                    const size_t value_depth = shape.value_depth;
+                    const float* q = query + (b * shape.queries + query_begin) * depth;
+                    const float* k = key + b * shape.keys * depth;
+                    const float* v = value + b * shape.keys * value_depth;
+                    float* o = out + (b * shape.queries + query_begin) * value_depth;
+
+                    float scores[attention_query_block * attention_key_block];
+                    float row_max[attention_query_block];
+                    float row_sum[attention_query_block];
+                    std::fill(row_max, row_max + rows, -std::numeric_limits<float>::infinity());
+                    std::fill(row_sum, row_sum + rows, 0.0f);
+                    std::vector<float> acc(rows * value_depth, 0.0f);
+
+                    size_t keys = shape.keys;
+                    if (shape.causal_prefix)
+                    {
+                        keys = std::min(keys, shape.prefix_position + query_end);
+                    }
+                    for (size_t key_begin = 0; key_begin < keys; key_begin += attention_key_block)
+                    {
+                        size_t block = std::min(attention_key_block, keys - key_begin);
+
+                        // scores = scale * q x k^T + mask for the block
+                        for (size_t i = 0; i < rows; i++)
+                        {
+                            float* s = scores + i * attention_key_block;
+                            const float* q_row = q + i * depth;
+                            if (shape.transpose_key)
+                            {
+                                for (size_t j = 0; j < block; j++)
+                                {
+                                    const float* k_row = k + (key_begin + j) * depth;
+                                    float dot = 0;
+                                    for (size_t d = 0; d < depth; d++)
+                                    {
+                                        dot += q_row[d] * k_row[d];
+                                    }
+                                    s[j] = dot;
+                                }
+                            }
+                            else
+                            {
+                                std::fill(s, s + block, 0.0f);
+                                for (size_t d = 0; d < depth; d++)
+                                {
+                                    float q_value = q_row[d];
+                                    const float* k_row = k + d * shape.keys + key_begin;
+                                    for (size_t j = 0; j < block; j++)
+                                    {
+                                        s[j] += q_value * k_row[j];
+                                    }
+                                }
+                            }
+                            for (size_t j = 0; j < block; j++)
+                            {
+                                s[j] *= shape.scale;
+                            }
+                            if (mask)
+                            {
+                                const float* m = mask + shape.mask_batch_offsets[b] +
+                                                 (query_begin + i) * shape.mask_query_stride +
+                                                 key_begin * shape.mask_key_stride;
+                                for (size_t j = 0; j < block; j++)
+                                {
+                                    s[j] += m[j * shape.mask_key_stride];
+                                }
+                            }
+                            if (shape.causal_prefix)
+                            {
+                                size_t seen = shape.prefix_position + query_begin + i + 1;
+                                for (size_t j = seen > key_begin ? seen - key_begin : 0; j < block;
+                                     j++)
+                                {
+                                    s[j] = -std::numeric_limits<float>::infinity();
+                                }
+                            }
+                        }
+
+                        // Online softmax update of the rows with the block
+                        for (size_t i = 0; i < rows; i++)
+                        {
+                            const float* s = scores + i * attention_key_block;
+                            float block_max = *std::max_element(s, s + block);
+                            float new_max = std::max(row_max[i], block_max);
+                            if (new_max == -std::numeric_limits<float>::infinity())
+                            {
+                                // Every score of the row so far is masked out
+                                continue;
+                            }
+                            float* a = acc.data() + i * value_depth;
+                            if (new_max != row_max[i])
+                            {
+                                float correction = std::exp(row_max[i] - new_max);
+                                row_sum[i] *= correction;
+                                for (size_t c = 0; c < value_depth; c++)
+                                {
+                                    a[c] *= correction;
+                                }
+                                row_max[i] = new_max;
+                            }
+                            for (size_t j = 0; j < block; j++)
+                            {
+                                float p = std::exp(s[j] - new_max);
+                                row_sum[i] += p;
+                                const float* v_row = v + (key_begin + j) * value_depth;
+                                for (size_t c = 0; c < value_depth; c++)
+                                {
+                                    a[c] += p * v_row[c];
+                                }
+                            }
+                        }
+                    }
+
+                    for (size_t i = 0; i < rows; i++)
+                    {
+                        float inv_sum = 1.0f / row_sum[i];
+                        const float* a = acc.data() + i * value_depth;
+                        float* o_row = o + i * value_depth;
+                        for (size_t c = 0; c < value_depth; c++)
+                        {
+                            o_row[c] = a[c] * inv_sum;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
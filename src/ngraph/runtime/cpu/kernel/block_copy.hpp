@@ -0,0 +1,101 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// \brief Rows of size bytes copied from src to dst, row o starting at
+                ///        o * src_stride and o * dst_stride respectively
+                struct BlockCopy
+                {
+                    const void* src;
+                    size_t src_stride;
+                    void* dst;
+                    size_t dst_stride;
+                    size_t size;
+                };
+
+                /// \brief Copies rows [0, outer_count) of every block on the executor's threads.
+                ///        Rows larger than a piece are split so a few large blocks still use
+                ///        every thread. Blocks with a null src are skipped.
+                inline void parallel_block_copy(const std::vector<BlockCopy>& blocks,
+                                                size_t outer_count,
+                                                int arena)
+                {
+                    const size_t piece_size = 64 * 1024;
+                    // First piece of each block among the pieces of a row
+                    std::vector<size_t> first_piece{0};
+                    size_t row_size = 0;
+                    for (auto& block : blocks)
+                    {
+                        size_t pieces = 0;
+                        if (block.src)
+                        {
+                            pieces =
+                                std::max<size_t>((block.size + piece_size - 1) / piece_size, 1);
+                            row_size += block.size;
+                        }
+                        first_piece.push_back(first_piece.back() + pieces);
+                    }
+                    size_t pieces_per_row = first_piece.back();
+                    if (pieces_per_row == 0 || outer_count == 0)
+                    {
+                        return;
+                    }
+
+                    auto copy = [&](Eigen::Index begin, Eigen::Index end) {
+                        for (Eigen::Index item = begin; item < end; ++item)
+                        {
+                            size_t row = item / pieces_per_row;
+                            size_t piece = item % pieces_per_row;
+                            size_t b = std::upper_bound(first_piece.begin(),
+                                                        first_piece.end(),
+                                                        piece) -
+                                       first_piece.begin() - 1;
+                            auto& block = blocks[b];
+                            size_t offset = (piece - first_piece[b]) * piece_size;
+                            size_t size = std::min(piece_size, block.size - offset);
+                            std::memcpy(static_cast<char*>(block.dst) + row * block.dst_stride +
+                                            offset,
+                                        static_cast<const char*>(block.src) +
+                                            row * block.src_stride + offset,
+                                        size);
+                        }
+                    };
+                    double bytes = static_cast<double>(row_size) / pieces_per_row;
+                    ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        outer_count * pieces_per_row, Eigen::TensorOpCost(bytes, bytes, 0), copy);
+                }
+            }
+        }
+    }
+}
@@ -15,15 +15,10 @@
 //*****************************************************************************
 
 #pragma once
-#include <functional>
-#include <iostream>
-#include <vector>
 
-#define EIGEN_USE_THREADS
-#include <unsupported/Eigen/CXX11/Tensor>
+#include <vector>
 
-#include "ngraph/runtime/cpu/cpu_executor.hpp"
-#include "ngraph/shape.hpp"
+#include "ngraph/runtime/cpu/kernel/block_copy.hpp"
 
 namespace ngraph
 {
@@ -33,37 +28,34 @@ namespace ngraph
         {
             namespace kernel
             {
-                template <typename ElementType, int Rank>
-                void concat(std::vector<void*> inputs,
-                            std::vector<Shape> input_shapes,
-                            void* output,
-                            Shape output_shape,
-                            int64_t axis)
+                /// \brief Concatenation as block copies
+                ///
+                /// Every tensor is viewed as outer_count rows, outer_count being the product of
+                /// the dimensions before the concatenation axis. Output row o is row o of every
+                /// input, one after the other. Inputs that are null are already in place.
+                inline void concat(const std::vector<void*>& inputs,
+                                   const std::vector<size_t>& input_row_sizes,
+                                   void* output,
+                                   size_t outer_count,
+                                   int arena)
                 {
-                    Eigen::array<Eigen::Index, Rank> out_dims;
-                    for (int i = 0; i < Rank; i++)
+                    size_t output_row_size = 0;
+                    for (auto size : input_row_sizes)
                     {
-                        out_dims[i] = output_shape[i];
+                        output_row_size += size;
                     }
-                    Eigen::TensorMap<Eigen::Tensor<ElementType, Rank, Eigen::RowMajor>> out(
-                        static_cast<ElementType*>(output), out_dims);
-
-                    Eigen::array<Eigen::Index, Rank> in_dims, concat_pos;
-                    concat_pos.fill(static_cast<Eigen::Index>(0));
-                    for (size_t i = 0; i < input_shapes.size(); i++)
+                    std::vector<BlockCopy> blocks;
+                    size_t offset = 0;
+                    for (size_t i = 0; i < inputs.size(); ++i)
                     {
-                        for (int j = 0; j < Rank; j++)
-                        {
-                            in_dims[j] = input_shapes[i][j];
-                        }
-
-                        Eigen::TensorMap<Eigen::Tensor<ElementType, Rank, Eigen::RowMajor>> in(
-                            static_cast<ElementType*>(inputs[i]), in_dims);
-                        out.slice(concat_pos, in_dims)
-                            .device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(
-                                0)) = in;
-                        concat_pos[axis] += in_dims[axis];
+                        blocks.push_back({inputs[i],
+                                          input_row_sizes[i],
+                                          static_cast<char*>(output) + offset,
+                                          output_row_size,
+                                          input_row_sizes[i]});
+                        offset += input_row_sizes[i];
                     }
+                    parallel_block_copy(blocks, outer_count, arena);
                 }
             }
         }
@@ -16,8 +16,16 @@
 
 #pragma once
 
+#include <algorithm>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/except.hpp"
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/reference/cum_sum.hpp"
+#include "ngraph/shape.hpp"
 
 namespace ngraph
 {
@@ -27,6 +35,203 @@ namespace ngraph
         {
             namespace kernel
             {
+                // Scans rows [first, last) of one line along the axis, for the inner elements
+                // [0, width) of each row. `carry` holds the running sum coming into the rows
+                // and is left holding the sum going out. Reverse scans go from the last row.
+                template <typename T>
+                void cumsum_rows(const T* in,
+                                 T* out,
+                                 size_t first,
+                                 size_t last,
+                                 size_t stride,
+                                 size_t width,
+                                 T* carry,
+                                 bool exclusive,
+                                 bool reverse,
+                                 bool write)
+                {
+                    for (size_t k = 0; k < last - first; k++)
+                    {
+                        size_t row = (reverse ? last - 1 - k : first + k) * stride;
+                        const T* src = in + row;
+                        if (!write)
+                        {
+                            for (size_t j = 0; j < width; j++)
+                            {
+                                carry[j] += src[j];
+                            }
+                        }
+                        else if (exclusive)
+                        {
+                            T* dst = out + row;
+                            for (size_t j = 0; j < width; j++)
+                            {
+                                T x = src[j];
+                                dst[j] = carry[j];
+                                carry[j] += x;
+                            }
+                        }
+                        else
+                        {
+                            T* dst = out + row;
+                            for (size_t j = 0; j < width; j++)
+                            {
+                                carry[j] += src[j];
+                                dst[j] = carry[j];
+                            }
+                        }
+                    }
+                }
+
+                // Cumulative sum as independent lines along the axis, each a chunk of up to
+                // `chunk` inner elements that are scanned together. When there are too few
+                // lines to occupy the threads, long axes are cut into blocks: the block sums
+                // are computed in parallel, turned into per-block carries serially, and the
+                // blocks are then scanned in parallel from their carries.
+                template <typename InputElementType, typename AxisElementType>
+                void cumsum(void* input_tensor,
+                            void* axis_tensor,
+                            void* out,
+                            const Shape& tensor_shape,
+                            const bool exclusive,
+                            const bool reverse,
+                            int arena)
+                {
+                    using T = InputElementType;
+                    const T* in = static_cast<const T*>(input_tensor);
+                    T* output = static_cast<T*>(out);
+
+                    int64_t rank = tensor_shape.size();
+                    int64_t axis = static_cast<const AxisElementType*>(axis_tensor)[0];
+                    if (axis < -rank || axis > rank)
+                    {
+                        throw ngraph_error("axis must be in the range [-rank, rank]");
+                    }
+                    axis = axis < 0 ? rank + axis : axis;
+                    if (axis == rank || shape_size(tensor_shape) == 0)
+                    {
+                        // Nothing to scan along; the reference gives zeros
+                        std::fill(output, output + shape_size(tensor_shape), T(0));
+                        return;
+                    }
+
+                    size_t outer = 1, inner = 1;
+                    for (int64_t i = 0; i < axis; i++)
+                    {
+                        outer *= tensor_shape[i];
+                    }
+                    for (int64_t i = axis + 1; i < rank; i++)
+                    {
+                        inner *= tensor_shape[i];
+                    }
+                    const size_t length = tensor_shape[axis];
+                    const size_t chunk = 64;
+                    const size_t chunks = (inner + chunk - 1) / chunk;
+                    const size_t lines = outer * chunks;
+
+                    auto& device =
+                        ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena);
+                    const size_t min_block = 4096;
+                    size_t blocks = 1;
+                    if (lines < static_cast<size_t>(device.numThreads()))
+                    {
+                        blocks = std::min(static_cast<size_t>(device.numThreads()) / lines,
+                                          length / min_block);
+                        blocks = std::max(blocks, size_t(1));
+                    }
+
+                    // A line is the scan of one chunk of inner elements of one outer index
+                    auto line_base = [&](size_t line, size_t& width) {
+                        size_t first = (line % chunks) * chunk;
+                        width = std::min(chunk, inner - first);
+                        return (line / chunks) * length * inner + first;
+                    };
+                    auto block_rows = [&](size_t block, size_t& first, size_t& last) {
+                        first = block * length / blocks;
+                        last = (block + 1) * length / blocks;
+                    };
+
+                    if (blocks == 1)
+                    {
+                        auto scan = [&](Eigen::Index begin, Eigen::Index end) {
+                            T carry[chunk];
+                            for (Eigen::Index line = begin; line < end; line++)
+                            {
+                                size_t width;
+                                size_t base = line_base(line, width);
+                                std::fill(carry, carry + width, T(0));
+                                cumsum_rows(in + base,
+                                            output + base,
+                                            0,
+                                            length,
+                                            inner,
+                                            width,
+                                            carry,
+                                            exclusive,
+                                            reverse,
+                                            true);
+                            }
+                        };
+                        size_t bytes = length * std::min(chunk, inner) * sizeof(T);
+                        device.parallelFor(
+                            lines, Eigen::TensorOpCost(bytes, bytes, length * chunk), scan);
+                        return;
+                    }
+
+                    // carries[(line * blocks + block) * chunk + j]
+                    std::vector<T> carries(lines * blocks * chunk, T(0));
+                    auto pass = [&](Eigen::Index begin, Eigen::Index end, bool write) {
+                        for (Eigen::Index i = begin; i < end; i++)
+                        {
+                            size_t line = i / blocks;
+                            size_t first, last, width;
+                            block_rows(i % blocks, first, last);
+                            size_t base = line_base(line, width);
+                            cumsum_rows(in + base,
+                                        output + base,
+                                        first,
+                                        last,
+                                        inner,
+                                        width,
+                                        &carries[i * chunk],
+                                        exclusive,
+                                        reverse,
+                                        write);
+                        }
+                    };
+                    size_t rows = length / blocks + 1;
+                    size_t bytes = rows * std::min(chunk, inner) * sizeof(T);
+
+                    device.parallelFor(lines * blocks,
+                                       Eigen::TensorOpCost(bytes, 0, rows * chunk),
+                                       [&](Eigen::Index begin, Eigen::Index end) {
+                                           pass(begin, end, false);
+                                       });
+
+                    // Block sums to exclusive carries, in scan order
+                    for (size_t line = 0; line < lines; line++)
+                    {
+                        T* c = &carries[line * blocks * chunk];
+                        for (size_t j = 0; j < chunk; j++)
+                        {
+                            T running = 0;
+                            for (size_t k = 0; k < blocks; k++)
+                            {
+                                size_t block = reverse ? blocks - 1 - k : k;
+                                T sum = c[block * chunk + j];
+                                c[block * chunk + j] = running;
+                                running += sum;
+                            }
+                        }
+                    }
+
+                    device.parallelFor(lines * blocks,
+                                       Eigen::TensorOpCost(bytes, bytes, rows * chunk),
+                                       [&](Eigen::Index begin, Eigen::Index end) {
+                                           pass(begin, end, true);
+                                       });
+                }
+
                 template <typename InputElementType, typename AxisElementType>
                 void reference_cumsum(void* input_tensor,
                                       void* axis_tensor,
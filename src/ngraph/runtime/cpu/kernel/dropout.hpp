@@ -16,9 +16,12 @@
 
 #pragma once
 
-#include <random>
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
 
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/shape.hpp"
+#include "ngraph/state/philox.hpp"
 
 namespace ngraph
 {
@@ -28,7 +31,10 @@ namespace ngraph
         {
             namespace kernel
             {
-                // Note: this kernel is for doing upscale in train
+                // Note: this kernel is for doing upscale in train.
+                // Element idx is dropped if the number of `generator` at offset + idx is below
+                // the dropout probability, so the mask is the same for any number of threads.
+                // out1_mask may be nullptr when the mask is regenerated by dropout_backprop.
                 template <typename T, typename M>
                 void generate_dropout(T* input,
                                       T* out0,
@@ -36,67 +42,81 @@ namespace ngraph
                                       const size_t nelems,
                                       const bool training,
                                       const double keep_prob,
-                                      const std::vector<std::minstd_rand>& vmsr,
-                                      const bool use_seed)
+                                      const Philox& generator,
+                                      const uint64_t offset,
+                                      int arena)
                 {
                     if (training)
-
                     {
-                        int32_t rnd_seed = rand();
                         M dropout_prob = 1 - static_cast<M>(keep_prob);
-#ifdef _OPENMP
-                        size_t nthr =
-                            ngraph::runtime::cpu::executor::GetCPUExecutor().get_num_cores();
-                        size_t chunk_size = (nelems + nthr - 1) / nthr;
-
-#pragma omp parallel num_threads(nthr)
-                        {
-                            size_t tid = omp_get_thread_num();
-#else
-                        size_t chunk_size = nelems;
+                        auto drop = [&](Eigen::Index first, Eigen::Index last) {
+                            generator.generate_uniform(
+                                offset + first, offset + last, [&](uint64_t position, double u) {
+                                    size_t idx = position - offset;
+                                    bool keep = !(static_cast<M>(u) < dropout_prob);
+                                    if (out1_mask != nullptr)
+                                    {
+                                        out1_mask[idx] = keep ? 1 : 0;
+                                    }
+                                    out0[idx] = keep ? input[idx] / static_cast<T>(keep_prob) : 0;
+                                });
+                        };
+                        Eigen::TensorOpCost cost(sizeof(T), sizeof(T) + sizeof(M), 16);
+                        ngraph::runtime::cpu::executor::GetCPUExecutor()
+                            .get_device(arena)
+                            .parallelFor(nelems, cost, drop);
+                    }
+                    else
+                    {
+                        // this is inference, ideally it should be optimized earlier
+                        for (size_t i = 0; i < nelems; i++)
                         {
-                            size_t tid = 0;
-#endif
-                            // Note :
-                            // In this implementation of dropout, we are trying to be same as PDPD
-                            // native implementation (and other frameworks).
-                            // https://github.com/NervanaSystems/ngraph-paddle/blob/14d88829b386c9f7601788c5539c08326dcbe2fe/paddle/fluid/operators/dropout_op.h#L58-L78
-                            // So, if framework passes same seed, then we will get same mask.
-                            std::minstd_rand msr;
-                            if (use_seed)
-                            {
-                                msr = vmsr[tid];
-                            }
-                            else
-                            {
-                                msr.seed(rnd_seed + tid);
-                            }
-                            std::uniform_real_distribution<> gen(0, 1);
-
-                            size_t idx_start = tid * chunk_size;
-                            size_t idx_end = std::min(idx_start + chunk_size, nelems);
-                            for (size_t idx = idx_start; idx < idx_end; ++idx)
+                            if (out1_mask != nullptr)
                             {
-                                if (static_cast<M>(gen(msr)) < dropout_prob)
-                                {
-                                    out1_mask[idx] = 0;
-                                    out0[idx] = 0;
-                                }
-                                else
-                                {
-                                    out1_mask[idx] = 1;
-                                    out0[idx] = input[idx] / static_cast<T>(keep_prob);
-                                }
+                                out1_mask[i] = 1;
                             }
+                            out0[i] = static_cast<T>(1);
                         }
                     }
+                }
+
+                // Gradient of generate_dropout with respect to its input, the mask regenerated
+                // from the numbers of `generator` the forward kernel used at `offset`. out is
+                // delta * mask, divided by keep_prob when `scale` is set.
+                template <typename T>
+                void dropout_backprop(const T* delta,
+                                      T* out,
+                                      const size_t nelems,
+                                      const bool training,
+                                      const double keep_prob,
+                                      const bool scale,
+                                      const Philox& generator,
+                                      const uint64_t offset,
+                                      int arena)
+                {
+                    T factor = scale ? 1 / static_cast<T>(keep_prob) : 1;
+                    if (training)
+                    {
+                        T dropout_prob = 1 - static_cast<T>(keep_prob);
+                        auto backprop = [&](Eigen::Index first, Eigen::Index last) {
+                            generator.generate_uniform(
+                                offset + first, offset + last, [&](uint64_t position, double u) {
+                                    size_t idx = position - offset;
+                                    out[idx] =
+                                        static_cast<T>(u) < dropout_prob ? 0 : delta[idx] * factor;
+                                });
+                        };
+                        Eigen::TensorOpCost cost(sizeof(T), sizeof(T), 16);
+                        ngraph::runtime::cpu::executor::GetCPUExecutor()
+                            .get_device(arena)
+                            .parallelFor(nelems, cost, backprop);
+                    }
                     else
                     {
-                        // this is inference, ideally it should be optimized earlier
+                        // the mask of inference is all ones
                         for (size_t i = 0; i < nelems; i++)
                         {
-                            out1_mask[i] = 1;
-                            out0[i] = static_cast<T>(1);
+                            out[i] = delta[i] * factor;
                         }
                     }
                 }
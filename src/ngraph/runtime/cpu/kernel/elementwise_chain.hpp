@@ -0,0 +1,117 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/op/elementwise_chain.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                template <typename ElementType>
+                void elementwise_chain(const std::vector<void*>& inputs,
+                                       void* output,
+                                       size_t count,
+                                       const std::vector<ngraph::op::ElementwiseChain::Step>& steps,
+                                       int arena)
+                {
+                    using OpType = ngraph::op::ElementwiseChain::OpType;
+                    using ArrayMap = Eigen::Map<Eigen::Array<ElementType, Eigen::Dynamic, 1>>;
+
+                    // Intermediate results are computed for blocks of this many elements at a
+                    // time so that they stay in cache
+                    const Eigen::Index block_size = 1024;
+
+                    auto evaluate = [&](Eigen::Index first, Eigen::Index last) {
+                        std::vector<ElementType> temporaries((steps.size() - 1) * block_size);
+                        std::vector<ElementType*> operands(inputs.size() + steps.size());
+                        for (Eigen::Index begin = first; begin < last; begin += block_size)
+                        {
+                            Eigen::Index n = std::min(block_size, last - begin);
+                            for (size_t i = 0; i < inputs.size(); i++)
+                            {
+                                operands[i] = static_cast<ElementType*>(inputs[i]) + begin;
+                            }
+                            for (size_t i = 0; i < steps.size(); i++)
+                            {
+                                const auto& step = steps[i];
+                                ElementType* result =
+                                    (i + 1 == steps.size())
+                                        ? static_cast<ElementType*>(output) + begin
+                                        : temporaries.data() + i * block_size;
+                                operands[inputs.size() + i] = result;
+
+                                ArrayMap out(result, n);
+                                ArrayMap arg0(operands[step.operands[0]], n);
+                                switch (step.type)
+                                {
+                                case OpType::Add:
+                                    out = arg0 + ArrayMap(operands[step.operands[1]], n);
+                                    break;
+                                case OpType::Subtract:
+                                    out = arg0 - ArrayMap(operands[step.operands[1]], n);
+                                    break;
+                                case OpType::Multiply:
+                                    out = arg0 * ArrayMap(operands[step.operands[1]], n);
+                                    break;
+                                case OpType::Divide:
+                                    out = arg0 / ArrayMap(operands[step.operands[1]], n);
+                                    break;
+                                case OpType::Maximum:
+                                    out = arg0.max(ArrayMap(operands[step.operands[1]], n));
+                                    break;
+                                case OpType::Minimum:
+                                    out = arg0.min(ArrayMap(operands[step.operands[1]], n));
+                                    break;
+                                case OpType::Negative: out = -arg0; break;
+                                case OpType::Abs: out = arg0.abs(); break;
+                                case OpType::Exp: out = arg0.exp(); break;
+                                case OpType::Log: out = arg0.log(); break;
+                                case OpType::Sqrt: out = arg0.sqrt(); break;
+                                case OpType::Tanh: out = arg0.tanh(); break;
+                                case OpType::Sigmoid:
+                                    out = (ElementType(1) + (-arg0).exp()).inverse();
+                                    break;
+                                case OpType::Relu: out = arg0.max(ElementType(0)); break;
+                                }
+                            }
+                        }
+                    };
+
+                    // Each element is loaded once per input and stored once, however long the
+                    // chain; the compute estimate is deliberately rough
+                    Eigen::TensorOpCost cost(sizeof(ElementType) * inputs.size(),
+                                             sizeof(ElementType),
+                                             10.0 * steps.size());
+                    ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        count, cost, evaluate);
+                }
+            }
+        }
+    }
+}
@@ -16,6 +16,9 @@
 
 #pragma once
 
+#include <cstring>
+#include <vector>
+
 #define EIGEN_USE_THREADS
 #include <unsupported/Eigen/CXX11/Tensor>
 
@@ -223,44 +226,106 @@ namespace ngraph
                     }
                 }
 
-                template <typename ElementType, unsigned int Rank1, unsigned int Rank2>
-                void gather_i64(void* inputs,
-                                void* indices,
-                                void* output,
-                                const Shape& inputs_shape,
-                                const Shape& indices_shape,
-                                const Shape& output_shape,
-                                size_t axis,
-                                int arena)
+                // Distance in indices at which upcoming rows are prefetched
+                constexpr Eigen::Index gather_prefetch_distance = 4;
+
+                // Gather as row copies, a row being everything after the axis: output row
+                // (o, k) is input row (o, indices[k]). Rows a few indices ahead are prefetched
+                // so lookups into large tables overlap their cache misses, and the rows are
+                // split across threads.
+                template <typename IndicesType>
+                void gather_rows(void* inputs,
+                                 void* indices,
+                                 void* output,
+                                 size_t outer,
+                                 size_t axis_length,
+                                 size_t num_indices,
+                                 size_t row_bytes,
+                                 int arena)
                 {
-                    gather<ElementType, int64_t, Rank1, Rank2>(inputs,
-                                                               indices,
-                                                               output,
-                                                               inputs_shape,
-                                                               indices_shape,
-                                                               output_shape,
-                                                               axis,
-                                                               arena);
+                    const char* in = static_cast<const char*>(inputs);
+                    const IndicesType* indices_ptr = static_cast<const IndicesType*>(indices);
+                    char* out = static_cast<char*>(output);
+                    auto row = [&](size_t i) {
+                        size_t o = i / num_indices;
+                        IndicesType index = indices_ptr[i % num_indices];
+                        // take care of negative indices
+                        size_t r = index >= 0 ? index : index + axis_length;
+                        return in + (o * axis_length + r) * row_bytes;
+                    };
+
+                    auto copy = [&](Eigen::Index first, Eigen::Index last) {
+                        for (Eigen::Index i = first; i < last; i++)
+                        {
+#if defined(__GNUC__)
+                            if (i + gather_prefetch_distance < last)
+                            {
+                                __builtin_prefetch(row(i + gather_prefetch_distance));
+                            }
+#endif
+                            memcpy(out + i * row_bytes, row(i), row_bytes);
+                        }
+                    };
+                    ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        outer * num_indices, Eigen::TensorOpCost(row_bytes, row_bytes, 0), copy);
                 }
 
-                template <typename ElementType, unsigned int Rank1, unsigned int Rank2>
-                void gather_i32(void* inputs,
-                                void* indices,
-                                void* output,
-                                const Shape& inputs_shape,
-                                const Shape& indices_shape,
-                                const Shape& output_shape,
-                                size_t axis,
-                                int arena)
+                // GatherND as slice copies: each index tuple along the last axis of indices
+                // selects a slice of params, which is copied to the next output slice.
+                template <typename IndicesType>
+                void gather_nd_rows(void* params,
+                                    void* indices,
+                                    void* output,
+                                    const Shape& params_shape,
+                                    const Shape& indices_shape,
+                                    size_t element_size,
+                                    int arena)
                 {
-                    gather<ElementType, int32_t, Rank1, Rank2>(inputs,
-                                                               indices,
-                                                               output,
-                                                               inputs_shape,
-                                                               indices_shape,
-                                                               output_shape,
-                                                               axis,
-                                                               arena);
+                    const char* in = static_cast<const char*>(params);
+                    const IndicesType* indices_ptr = static_cast<const IndicesType*>(indices);
+                    char* out = static_cast<char*>(output);
+
+                    size_t slice_rank = indices_shape.back();
+                    size_t num_slices =
+                        shape_size(Shape(indices_shape.begin(), indices_shape.end() - 1));
+                    size_t slice_bytes =
+                        shape_size(Shape(params_shape.begin() + slice_rank, params_shape.end())) *
+                        element_size;
+                    // Strides of the indexed axes, in slices
+                    std::vector<size_t> strides(slice_rank, 1);
+                    for (size_t i = slice_rank; i-- > 1;)
+                    {
+                        strides[i - 1] = strides[i] * params_shape[i];
+                    }
+
+                    auto slice = [&](size_t i) {
+                        size_t offset = 0;
+                        for (size_t j = 0; j < slice_rank; j++)
+                        {
+                            IndicesType index = indices_ptr[i * slice_rank + j];
+                            // take care of negative indices
+                            size_t r = index >= 0 ? index : index + params_shape[j];
+                            offset += r * strides[j];
+                        }
+                        return in + offset * slice_bytes;
+                    };
+
+                    auto copy = [&](Eigen::Index first, Eigen::Index last) {
+                        for (Eigen::Index i = first; i < last; i++)
+                        {
+#if defined(__GNUC__)
+                            if (i + gather_prefetch_distance < last)
+                            {
+                                __builtin_prefetch(slice(i + gather_prefetch_distance));
+                            }
+#endif
+                            memcpy(out + i * slice_bytes, slice(i), slice_bytes);
+                        }
+                    };
+                    ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        num_slices,
+                        Eigen::TensorOpCost(slice_bytes, slice_bytes, slice_rank),
+                        copy);
                 }
             }
         }
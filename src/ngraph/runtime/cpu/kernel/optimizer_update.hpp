@@ -0,0 +1,119 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cmath>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Each element of the outputs is computed from the same element of the inputs
+                // alone, and written after them, so outputs may alias the inputs they replace
+
+                template <typename ElementType>
+                void sgd_momentum_update(void* weights,
+                                         void* velocity,
+                                         void* gradient,
+                                         void* learning_rate,
+                                         void* momentum,
+                                         void* out_weights,
+                                         void* out_velocity,
+                                         size_t count,
+                                         int arena)
+                {
+                    const ElementType* w = static_cast<const ElementType*>(weights);
+                    const ElementType* v = static_cast<const ElementType*>(velocity);
+                    const ElementType* g = static_cast<const ElementType*>(gradient);
+                    ElementType* out_w = static_cast<ElementType*>(out_weights);
+                    ElementType* out_v = static_cast<ElementType*>(out_velocity);
+                    ElementType lr = *static_cast<const ElementType*>(learning_rate);
+                    ElementType mu = *static_cast<const ElementType*>(momentum);
+
+                    auto update = [&](Eigen::Index first, Eigen::Index last) {
+                        for (Eigen::Index i = first; i < last; i++)
+                        {
+                            ElementType new_v = mu * v[i] + g[i];
+                            ElementType new_w = w[i] - lr * new_v;
+                            out_v[i] = new_v;
+                            out_w[i] = new_w;
+                        }
+                    };
+                    Eigen::TensorOpCost cost(3 * sizeof(ElementType), 2 * sizeof(ElementType), 4);
+                    ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        count, cost, update);
+                }
+
+                template <typename ElementType>
+                void adam_update(void* weights,
+                                 void* m,
+                                 void* v,
+                                 void* gradient,
+                                 void* learning_rate,
+                                 void* beta1,
+                                 void* one_minus_beta1,
+                                 void* beta2,
+                                 void* one_minus_beta2,
+                                 void* epsilon,
+                                 void* out_weights,
+                                 void* out_m,
+                                 void* out_v,
+                                 size_t count,
+                                 int arena)
+                {
+                    const ElementType* w = static_cast<const ElementType*>(weights);
+                    const ElementType* m_in = static_cast<const ElementType*>(m);
+                    const ElementType* v_in = static_cast<const ElementType*>(v);
+                    const ElementType* g = static_cast<const ElementType*>(gradient);
+                    ElementType* w_out = static_cast<ElementType*>(out_weights);
+                    ElementType* m_out = static_cast<ElementType*>(out_m);
+                    ElementType* v_out = static_cast<ElementType*>(out_v);
+                    ElementType lr = *static_cast<const ElementType*>(learning_rate);
+                    ElementType b1 = *static_cast<const ElementType*>(beta1);
+                    ElementType c1 = *static_cast<const ElementType*>(one_minus_beta1);
+                    ElementType b2 = *static_cast<const ElementType*>(beta2);
+                    ElementType c2 = *static_cast<const ElementType*>(one_minus_beta2);
+                    ElementType eps = *static_cast<const ElementType*>(epsilon);
+
+                    auto update = [&](Eigen::Index first, Eigen::Index last) {
+                        for (Eigen::Index i = first; i < last; i++)
+                        {
+                            ElementType new_m = b1 * m_in[i] + c1 * g[i];
+                            ElementType new_v = b2 * v_in[i] + c2 * (g[i] * g[i]);
+                            ElementType new_w = w[i] - lr * new_m / (std::sqrt(new_v) + eps);
+                            m_out[i] = new_m;
+                            v_out[i] = new_v;
+                            w_out[i] = new_w;
+                        }
+                    };
+                    Eigen::TensorOpCost cost(4 * sizeof(ElementType), 3 * sizeof(ElementType), 16);
+                    ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        count, cost, update);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,158 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#pragma once
+
+#include <cstdint>
+
+#include "ngraph/runtime/reference/interpolate.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // The table of an axis that is not resized
+                inline reference::InterpolateAxisTable preprocess_identity_table(size_t size)
+                {
+                    reference::InterpolateAxisTable table;
+                    table.axis = 0;
+                    table.input_size = size;
+                    table.output_size = size;
+                    table.taps = 1;
+                    table.nearest = true;
+                    for (size_t i = 0; i < size; i++)
+                    {
+                        table.index.push_back(static_cast<int64_t>(i));
+                        table.weight.push_back(1.0f);
+                    }
+                    return table;
+                }
+
+                // Output rows [begin, end) of a Preprocess, a row being one row of an image in
+                // every channel. `rows` and `cols` give the frame rows and columns each output
+                // row and column reads with their weights. The output is NCHW when `block` is
+                // 1 and nChw<block>c otherwise, with the channels past the last one zeroed.
+                template <typename InType>
+                void preprocess_rows(const InType* in,
+                                     float* out,
+                                     const Shape& frame_shape,
+                                     bool channels_last,
+                                     const reference::InterpolateAxisTable& rows,
+                                     const reference::InterpolateAxisTable& cols,
+                                     const float* scale,
+                                     const float* shift,
+                                     size_t block,
+                                     size_t begin,
+                                     size_t end)
+                {
+                    size_t channels = frame_shape[channels_last ? 3 : 1];
+                    size_t height = frame_shape[channels_last ? 1 : 2];
+                    size_t width = frame_shape[channels_last ? 2 : 3];
+                    size_t image_stride = channels * height * width;
+                    size_t channel_stride = channels_last ? 1 : height * width;
+                    size_t row_stride = channels_last ? width * channels : width;
+                    size_t col_stride = channels_last ? channels : 1;
+                    size_t out_height = rows.output_size;
+                    size_t out_width = cols.output_size;
+                    size_t blocks = (channels + block - 1) / block;
+                    bool single_tap = rows.taps == 1 && cols.taps == 1;
+
+                    for (size_t item = begin; item < end; item++)
+                    {
+                        size_t n = item / out_height;
+                        size_t y = item % out_height;
+                        const InType* image = in + n * image_stride;
+
+                        auto pixel = [&](size_t c, size_t x) {
+                            const InType* plane = image + c * channel_stride;
+                            float value = 0.0f;
+                            if (single_tap)
+                            {
+                                int64_t r = rows.index[y];
+                                int64_t q = cols.index[x];
+                                if (r >= 0 && q >= 0)
+                                {
+                                    value = rows.weight[y] * cols.weight[x] *
+                                            static_cast<float>(
+                                                plane[r * row_stride + q * col_stride]);
+                                }
+                            }
+                            else
+                            {
+                                for (size_t i = 0; i < rows.taps; i++)
+                                {
+                                    int64_t r = rows.index[y * rows.taps + i];
+                                    if (r < 0)
+                                    {
+                                        continue;
+                                    }
+                                    const InType* line = plane + r * row_stride;
+                                    float row_value = 0.0f;
+                                    for (size_t j = 0; j < cols.taps; j++)
+                                    {
+                                        int64_t q = cols.index[x * cols.taps + j];
+                                        if (q >= 0)
+                                        {
+                                            row_value += cols.weight[x * cols.taps + j] *
+                                                         static_cast<float>(line[q * col_stride]);
+                                        }
+                                    }
+                                    value += rows.weight[y * rows.taps + i] * row_value;
+                                }
+                            }
+                            return scale[c] * value + shift[c];
+                        };
+
+                        if (block == 1)
+                        {
+                            // Rows of each channel plane are contiguous
+                            for (size_t c = 0; c < channels; c++)
+                            {
+                                float* dst =
+                                    out + ((n * channels + c) * out_height + y) * out_width;
+                                for (size_t x = 0; x < out_width; x++)
+                                {
+                                    dst[x] = pixel(c, x);
+                                }
+                            }
+                            continue;
+                        }
+                        for (size_t b = 0; b < blocks; b++)
+                        {
+                            float* dst =
+                                out + ((n * blocks + b) * out_height + y) * out_width * block;
+                            size_t first = b * block;
+                            for (size_t x = 0; x < out_width; x++)
+                            {
+                                for (size_t k = 0; k < block; k++)
+                                {
+                                    dst[x * block + k] =
+                                        first + k < channels ? pixel(first + k, x) : 0.0f;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
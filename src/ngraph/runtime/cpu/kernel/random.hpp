@@ -0,0 +1,79 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/reference/generate_mask.hpp"
+#include "ngraph/runtime/reference/random_uniform.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Philox computes every number from its position, so these split the output
+                // across the threads of the arena and produce the same values as the single
+                // threaded reference kernels
+
+                // Cycles per number of Philox4x32-10, which makes four at a time
+                static const int s_philox_cycles = 16;
+
+                template <typename T>
+                void random_uniform(T* out,
+                                    T min_val,
+                                    T max_val,
+                                    size_t count,
+                                    const Philox& generator,
+                                    uint64_t offset,
+                                    int arena)
+                {
+                    auto fill = [&](Eigen::Index first, Eigen::Index last) {
+                        reference::random_uniform_range(
+                            out, min_val, max_val, first, last, generator, offset);
+                    };
+                    Eigen::TensorOpCost cost(0, sizeof(T), s_philox_cycles);
+                    ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        count, cost, fill);
+                }
+
+                template <typename T>
+                void generate_mask(T* out,
+                                   size_t count,
+                                   bool training,
+                                   const Philox& generator,
+                                   uint64_t offset,
+                                   double prob,
+                                   int arena)
+                {
+                    auto fill = [&](Eigen::Index first, Eigen::Index last) {
+                        reference::generate_mask_range(
+                            out, first, last, training, generator, offset, prob);
+                    };
+                    Eigen::TensorOpCost cost(0, sizeof(T), s_philox_cycles);
+                    ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        count, cost, fill);
+                }
+            }
+        }
+    }
+}
@@ -20,7 +20,6 @@
 #include <unsupported/Eigen/CXX11/Tensor>
 
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
-#include "ngraph/runtime/reference/max.hpp"
 #include "ngraph/shape.hpp"
 
 namespace ngraph
@@ -119,68 +118,6 @@ namespace ngraph
                     out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
                         in.maximum(reduction_dims);
                 }
-
-                template <typename ElementType, unsigned int Rank>
-                void reduce_max_1rd(void* input,
-                                    void* output,
-                                    const Shape& input_shape,
-                                    const Shape& output_shape,
-                                    const AxisSet& reduction_axes,
-                                    int arena)
-                {
-                    reduce_max<ElementType, Rank, 1>(
-                        input, output, input_shape, output_shape, reduction_axes, arena);
-                }
-
-                template <typename ElementType>
-                void reduce_max_3d_2rd(void* input,
-                                       void* output,
-                                       const Shape& input_shape,
-                                       const Shape& output_shape,
-                                       const AxisSet& reduction_axes,
-                                       int arena)
-                {
-                    reduce_max<ElementType, 3, 2>(
-                        input, output, input_shape, output_shape, reduction_axes, arena);
-                }
-
-                template <typename ElementType>
-                void reduce_max_4d_2rd(void* input,
-                                       void* output,
-                                       const Shape& input_shape,
-                                       const Shape& output_shape,
-                                       const AxisSet& reduction_axes,
-                                       int arena)
-                {
-                    reduce_max<ElementType, 4, 2>(
-                        input, output, input_shape, output_shape, reduction_axes, arena);
-                }
-
-                template <typename ElementType>
-                void reduce_max_5d_2rd(void* input,
-                                       void* output,
-                                       const Shape& input_shape,
-                                       const Shape& output_shape,
-                                       const AxisSet& reduction_axes,
-                                       int arena)
-                {
-                    reduce_max<ElementType, 5, 2>(
-                        input, output, input_shape, output_shape, reduction_axes, arena);
-                }
-
-                template <typename ElementType>
-                void max(void* arg,
-                         void* out,
-                         const Shape& in_shape,
-                         const Shape& out_shape,
-                         const AxisSet& reduction_axes,
-                         int /* arena */)
-                {
-                    reference::max(static_cast<ElementType*>(arg),
-                                   static_cast<ElementType*>(out),
-                                   in_shape,
-                                   reduction_axes);
-                }
             }
         }
     }
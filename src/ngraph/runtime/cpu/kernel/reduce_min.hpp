@@ -20,7 +20,6 @@
 #include <unsupported/Eigen/CXX11/Tensor>
 
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
-#include "ngraph/runtime/reference/min.hpp"
 #include "ngraph/shape.hpp"
 
 namespace ngraph
@@ -119,68 +118,6 @@ namespace ngraph
                     out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
                         in.minimum(reduction_dims);
                 }
-
-                template <typename ElementType, unsigned int Rank>
-                void reduce_min_1rd(void* input,
-                                    void* output,
-                                    const Shape& input_shape,
-                                    const Shape& output_shape,
-                                    const AxisSet& reduction_axes,
-                                    int arena)
-                {
-                    reduce_min<ElementType, Rank, 1>(
-                        input, output, input_shape, output_shape, reduction_axes, arena);
-                }
-
-                template <typename ElementType>
-                void reduce_min_3d_2rd(void* input,
-                                       void* output,
-                                       const Shape& input_shape,
-                                       const Shape& output_shape,
-                                       const AxisSet& reduction_axes,
-                                       int arena)
-                {
-                    reduce_min<ElementType, 3, 2>(
-                        input, output, input_shape, output_shape, reduction_axes, arena);
-                }
-
-                template <typename ElementType>
-                void reduce_min_4d_2rd(void* input,
-                                       void* output,
-                                       const Shape& input_shape,
-                                       const Shape& output_shape,
-                                       const AxisSet& reduction_axes,
-                                       int arena)
-                {
-                    reduce_min<ElementType, 4, 2>(
-                        input, output, input_shape, output_shape, reduction_axes, arena);
-                }
-
-                template <typename ElementType>
-                void reduce_min_5d_2rd(void* input,
-                                       void* output,
-                                       const Shape& input_shape,
-                                       const Shape& output_shape,
-                                       const AxisSet& reduction_axes,
-                                       int arena)
-                {
-                    reduce_min<ElementType, 5, 2>(
-                        input, output, input_shape, output_shape, reduction_axes, arena);
-                }
-
-                template <typename ElementType>
-                void min(void* arg,
-                         void* out,
-                         const Shape& in_shape,
-                         const Shape& out_shape,
-                         const AxisSet& reduction_axes,
-                         int /* arena */)
-                {
-                    reference::min(static_cast<ElementType*>(arg),
-                                   static_cast<ElementType*>(out),
-                                   in_shape,
-                                   reduction_axes);
-                }
             }
         }
     }
@@ -0,0 +1,316 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Reducers start from the same identities as the reference kernels and combine
+                // in the same way, so empty reductions and NaNs give the same results.
+                template <typename T>
+                struct SumReducer
+                {
+                    static T identity() { return T(0); }
+                    static T apply(T a, T b) { return a + b; }
+                };
+
+                template <typename T>
+                struct ProductReducer
+                {
+                    static T identity() { return T(1); }
+                    static T apply(T a, T b) { return a * b; }
+                };
+
+                template <typename T>
+                struct MaxReducer
+                {
+                    static T identity()
+                    {
+                        return std::numeric_limits<T>::has_infinity
+                                   ? T(-std::numeric_limits<T>::infinity())
+                                   : std::numeric_limits<T>::lowest();
+                    }
+                    static T apply(T a, T b) { return b > a ? b : a; }
+                };
+
+                template <typename T>
+                struct MinReducer
+                {
+                    static T identity()
+                    {
+                        return std::numeric_limits<T>::has_infinity
+                                   ? T(std::numeric_limits<T>::infinity())
+                                   : std::numeric_limits<T>::max();
+                    }
+                    static T apply(T a, T b) { return b < a ? b : a; }
+                };
+
+                template <typename T>
+                struct AnyReducer
+                {
+                    static T identity() { return T(0); }
+                    static T apply(T a, T b) { return a || b; }
+                };
+
+                template <typename T>
+                struct AllReducer
+                {
+                    static T identity() { return T(1); }
+                    static T apply(T a, T b) { return a && b; }
+                };
+
+                // A reduction with size-1 axes dropped and neighbouring axes of the same kind
+                // merged. What is left alternates between kept and reduced runs. When the
+                // innermost run is kept, each output row accumulates whole input rows; when it
+                // is reduced, each output element reduces contiguous spans of the input.
+                struct ReductionPlan
+                {
+                    ReductionPlan(const Shape& input_shape, const AxisSet& reduction_axes)
+                    {
+                        m_empty = shape_size(input_shape) == 0;
+                        Shape dims;
+                        std::vector<bool> reduced;
+                        for (size_t i = 0; i < input_shape.size(); i++)
+                        {
+                            if (input_shape[i] == 1)
+                            {
+                                continue;
+                            }
+                            bool r = reduction_axes.count(i) != 0;
+                            if (!dims.empty() && reduced.back() == r)
+                            {
+                                dims.back() *= input_shape[i];
+                            }
+                            else
+                            {
+                                dims.push_back(input_shape[i]);
+                                reduced.push_back(r);
+                            }
+                        }
+
+                        m_inner = dims.empty() ? 1 : dims.back();
+                        m_inner_reduced = !dims.empty() && reduced.back();
+                        size_t stride = m_inner;
+                        for (size_t i = dims.size() > 0 ? dims.size() - 1 : 0; i-- > 0;)
+                        {
+                            auto& sizes = reduced[i] ? m_reduced_sizes : m_kept_sizes;
+                            auto& strides = reduced[i] ? m_reduced_strides : m_kept_strides;
+                            sizes.insert(sizes.begin(), dims[i]);
+                            strides.insert(strides.begin(), stride);
+                            stride *= dims[i];
+                        }
+                        m_kept_count = shape_size(m_kept_sizes);
+                        m_reduced_count = shape_size(m_reduced_sizes);
+                    }
+
+                    static constexpr size_t chunk_size = 256;
+
+                    // Work items are output elements, or chunks of output rows
+                    size_t get_work_count() const
+                    {
+                        return m_inner_reduced
+                                   ? m_kept_count
+                                   : m_kept_count * ((m_inner + chunk_size - 1) / chunk_size);
+                    }
+
+                    size_t get_work_size() const
+                    {
+                        const size_t chunk = chunk_size;
+                        return m_reduced_count *
+                               (m_inner_reduced ? m_inner : std::min(m_inner, chunk));
+                    }
+
+                    static size_t offset(size_t index,
+                                         const std::vector<size_t>& sizes,
+                                         const std::vector<size_t>& strides)
+                    {
+                        size_t result = 0;
+                        for (size_t i = sizes.size(); i-- > 0;)
+                        {
+                            result += (index % sizes[i]) * strides[i];
+                            index /= sizes[i];
+                        }
+                        return result;
+                    }
+
+                    bool m_empty;
+                    bool m_inner_reduced;
+                    size_t m_inner;
+                    size_t m_kept_count;
+                    size_t m_reduced_count;
+                    std::vector<size_t> m_kept_sizes;
+                    std::vector<size_t> m_kept_strides;
+                    std::vector<size_t> m_reduced_sizes;
+                    std::vector<size_t> m_reduced_strides;
+                };
+
+                template <typename ElementType, template <typename> class Reducer>
+                void reduce_strided(const ElementType* in,
+                                    ElementType* out,
+                                    const ReductionPlan& plan,
+                                    size_t begin,
+                                    size_t end)
+                {
+                    using R = Reducer<ElementType>;
+                    const size_t inner = plan.m_inner;
+
+                    if (!plan.m_inner_reduced)
+                    {
+                        const size_t chunk = ReductionPlan::chunk_size;
+                        const size_t chunks = (inner + chunk - 1) / chunk;
+                        for (size_t w = begin; w < end; w++)
+                        {
+                            size_t k = w / chunks;
+                            size_t first = (w % chunks) * chunk;
+                            size_t count = std::min(chunk, inner - first);
+                            const ElementType* base =
+                                in +
+                                ReductionPlan::offset(k, plan.m_kept_sizes, plan.m_kept_strides) +
+                                first;
+                            ElementType* acc = out + k * inner + first;
+                            std::fill(acc, acc + count, R::identity());
+                            for (size_t r = 0; r < plan.m_reduced_count; r++)
+                            {
+                                const ElementType* src =
+                                    base + ReductionPlan::offset(
+                                               r, plan.m_reduced_sizes, plan.m_reduced_strides);
+                                for (size_t j = 0; j < count; j++)
+                                {
+                                    acc[j] = R::apply(acc[j], src[j]);
+                                }
+                            }
+                        }
+                        return;
+                    }
+
+                    // Independent lanes let the contiguous loop vectorize
+                    constexpr size_t lanes = 8;
+                    for (size_t k = begin; k < end; k++)
+                    {
+                        const ElementType* base =
+                            in + ReductionPlan::offset(k, plan.m_kept_sizes, plan.m_kept_strides);
+                        ElementType acc[lanes];
+                        std::fill(acc, acc + lanes, R::identity());
+                        for (size_t r = 0; r < plan.m_reduced_count; r++)
+                        {
+                            const ElementType* src =
+                                base + ReductionPlan::offset(
+                                           r, plan.m_reduced_sizes, plan.m_reduced_strides);
+                            size_t j = 0;
+                            for (; j + lanes <= inner; j += lanes)
+                            {
+                                for (size_t l = 0; l < lanes; l++)
+                                {
+                                    acc[l] = R::apply(acc[l], src[j + l]);
+                                }
+                            }
+                            for (; j < inner; j++)
+                            {
+                                acc[0] = R::apply(acc[0], src[j]);
+                            }
+                        }
+                        ElementType result = acc[0];
+                        for (size_t l = 1; l < lanes; l++)
+                        {
+                            result = R::apply(result, acc[l]);
+                        }
+                        out[k] = result;
+                    }
+                }
+
+                template <typename ElementType, template <typename> class Reducer>
+                void reduce_strided(void* input,
+                                    void* output,
+                                    const ReductionPlan& plan,
+                                    int arena)
+                {
+                    auto in = static_cast<const ElementType*>(input);
+                    auto out = static_cast<ElementType*>(output);
+                    if (plan.m_empty)
+                    {
+                        size_t count =
+                            plan.m_kept_count * (plan.m_inner_reduced ? 1 : plan.m_inner);
+                        std::fill(out, out + count, Reducer<ElementType>::identity());
+                        return;
+                    }
+
+                    auto reduce = [&](Eigen::Index first, Eigen::Index last) {
+                        reduce_strided<ElementType, Reducer>(in, out, plan, first, last);
+                    };
+                    size_t work = plan.get_work_size();
+                    Eigen::TensorOpCost cost(work * sizeof(ElementType),
+                                             std::min(work, plan.m_inner) * sizeof(ElementType),
+                                             work);
+                    ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        plan.get_work_count(), cost, reduce);
+                }
+
+                template <typename ElementType>
+                void reduce_sum_strided(void* input,
+                                        void* output,
+                                        const ReductionPlan& plan,
+                                        int arena)
+                {
+                    reduce_strided<ElementType, SumReducer>(input, output, plan, arena);
+                }
+
+                template <typename ElementType>
+                void reduce_product_strided(void* input,
+                                            void* output,
+                                            const ReductionPlan& plan,
+                                            int arena)
+                {
+                    reduce_strided<ElementType, ProductReducer>(input, output, plan, arena);
+                }
+
+                template <typename ElementType>
+                void reduce_max_strided(void* input,
+                                        void* output,
+                                        const ReductionPlan& plan,
+                                        int arena)
+                {
+                    reduce_strided<ElementType, MaxReducer>(input, output, plan, arena);
+                }
+
+                template <typename ElementType>
+                void reduce_min_strided(void* input,
+                                        void* output,
+                                        const ReductionPlan& plan,
+                                        int arena)
+                {
+                    reduce_strided<ElementType, MinReducer>(input, output, plan, arena);
+                }
+            }
+        }
+    }
+}
@@ -20,7 +20,6 @@
 #include <unsupported/Eigen/CXX11/Tensor>
 
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
-#include "ngraph/runtime/reference/sum.hpp"
 #include "ngraph/shape.hpp"
 
 namespace ngraph
@@ -120,66 +119,41 @@ namespace ngraph
                         in.sum(reduction_dims);
                 }
 
-                template <typename ElementType, unsigned int Rank>
-                void reduce_sum_1rd(void* input,
-                                    void* output,
-                                    const Shape& input_shape,
-                                    const Shape& output_shape,
-                                    const AxisSet& reduction_axes,
-                                    int arena)
-                {
-                    reduce_sum<ElementType, Rank, 1>(
-                        input, output, input_shape, output_shape, reduction_axes, arena);
-                }
-
-                template <typename ElementType>
-                void reduce_sum_3d_2rd(void* input,
-                                       void* output,
-                                       const Shape& input_shape,
-                                       const Shape& output_shape,
-                                       const AxisSet& reduction_axes,
-                                       int arena)
-                {
-                    reduce_sum<ElementType, 3, 2>(
-                        input, output, input_shape, output_shape, reduction_axes, arena);
-                }
-
-                template <typename ElementType>
-                void reduce_sum_4d_2rd(void* input,
-                                       void* output,
-                                       const Shape& input_shape,
-                                       const Shape& output_shape,
-                                       const AxisSet& reduction_axes,
-                                       int arena)
-                {
-                    reduce_sum<ElementType, 4, 2>(
-                        input, output, input_shape, output_shape, reduction_axes, arena);
-                }
-
-                template <typename ElementType>
-                void reduce_sum_5d_2rd(void* input,
-                                       void* output,
-                                       const Shape& input_shape,
-                                       const Shape& output_shape,
-                                       const AxisSet& reduction_axes,
-                                       int arena)
-                {
-                    reduce_sum<ElementType, 5, 2>(
-                        input, output, input_shape, output_shape, reduction_axes, arena);
-                }
-
+                // Sum over the spatial axes of an NCHW input laid out in nChw8c or nChw16c,
+                // with channels in blocks of `block` padded to a whole block. The output is
+                // native N x C.
                 template <typename ElementType>
-                void sum(void* arg,
-                         void* out,
-                         const Shape& in_shape,
-                         const Shape& out_shape,
-                         const AxisSet& reduction_axes,
-                         int /* arena */)
+                void reduce_sum_spatial_blocked(void* input,
+                                                void* output,
+                                                const Shape& input_shape,
+                                                size_t block,
+                                                int arena)
                 {
-                    reference::sum(static_cast<ElementType*>(arg),
-                                   static_cast<ElementType*>(out),
-                                   in_shape,
-                                   reduction_axes);
+                    const ElementType* in = static_cast<const ElementType*>(input);
+                    ElementType* out = static_cast<ElementType*>(output);
+                    size_t channels = input_shape[1];
+                    size_t blocks = (channels + block - 1) / block;
+                    size_t pixels = input_shape[2] * input_shape[3];
+
+                    auto reduce = [&](Eigen::Index first, Eigen::Index last) {
+                        for (Eigen::Index i = first; i < last; i++)
+                        {
+                            size_t n = i / channels;
+                            size_t c = i % channels;
+                            const ElementType* plane =
+                                in + ((n * blocks + c / block) * pixels * block + c % block);
+                            ElementType sum = 0;
+                            for (size_t p = 0; p < pixels; p++)
+                            {
+                                sum += plane[p * block];
+                            }
+                            out[i] = sum;
+                        }
+                    };
+                    Eigen::TensorOpCost cost(
+                        pixels * sizeof(ElementType), sizeof(ElementType), pixels);
+                    ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        input_shape[0] * channels, cost, reduce);
                 }
             }
         }
@@ -21,7 +21,7 @@
 
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
-#include "ngraph/runtime/reference/reshape.hpp"
+#include "ngraph/runtime/opt_kernel/reshape.hpp"
 #include "ngraph/shape.hpp"
 
 namespace ngraph
@@ -144,19 +144,32 @@ namespace ngraph
                                                      arena);
                 }
 
+                /// \brief Cache-blocked permuted copy, parallelized over the rows or blocks
+                ///        it is made of
                 template <typename ElementType>
-                void reshape_ref(const void* arg,
-                                 void* out,
-                                 const Shape& in_shape,
-                                 const AxisVector& in_axis_order,
-                                 const Shape& out_shape,
-                                 int /* arena */)
+                void reshape_tiled(const void* arg,
+                                   void* out,
+                                   const Shape& in_shape,
+                                   const AxisVector& in_axis_order,
+                                   const Shape& /* out_shape */,
+                                   int arena)
                 {
-                    reference::reshape(static_cast<const ElementType*>(arg),
-                                       static_cast<ElementType*>(out),
-                                       in_shape,
-                                       in_axis_order,
-                                       out_shape);
+                    opt_kernel::TransposePlan plan(in_shape, in_axis_order);
+                    size_t outer_count = plan.get_outer_count();
+                    if (outer_count == 0)
+                    {
+                        return;
+                    }
+                    double bytes = sizeof(ElementType) * plan.m_count / outer_count;
+                    Eigen::TensorOpCost cost(bytes, bytes, 0);
+                    ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        outer_count, cost, [&](Eigen::Index begin, Eigen::Index end) {
+                            opt_kernel::transpose(static_cast<const ElementType*>(arg),
+                                                  static_cast<ElementType*>(out),
+                                                  plan,
+                                                  begin,
+                                                  end);
+                        });
                 }
             }
         }
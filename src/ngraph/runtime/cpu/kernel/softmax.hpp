@@ -21,6 +21,7 @@
 
 #include "ngraph/axis_set.hpp"
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/opt_kernel/softmax.hpp"
 #include "ngraph/runtime/reference/softmax.hpp"
 #include "ngraph/shape.hpp"
 
@@ -32,138 +33,34 @@ namespace ngraph
         {
             namespace kernel
             {
-                template <typename ElementType, unsigned int Rank>
-                void softmax_all(void* input, void* output, const Shape& input_shape, int arena)
-                {
-                    Eigen::array<Eigen::Index, Rank> in_dims, rdims;
-                    rdims.fill(1);
-
-                    for (size_t i = 0; i < Rank; i++)
-                    {
-                        in_dims[i] = input_shape[i];
-                    }
-
-                    Eigen::TensorMap<Eigen::Tensor<ElementType, Rank, Eigen::RowMajor>> out(
-                        static_cast<ElementType*>(output), in_dims),
-                        in(static_cast<ElementType*>(input), in_dims);
-
-                    out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
-                        (in - in.maximum().eval().reshape(rdims).broadcast(in_dims)).exp();
-                    out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
-                        out * out.sum().inverse().eval().reshape(rdims).broadcast(in_dims);
-                }
-
-                template <typename ElementType, unsigned int Rank, unsigned int AxisCount>
+                /// \brief Fused two-pass softmax, split across the executor's threads over
+                ///        non-reduced positions
+                template <typename ElementType>
                 void softmax(void* input,
                              void* output,
                              const Shape& input_shape,
                              const AxisSet& softmax_axes,
                              int arena)
                 {
-                    Eigen::array<Eigen::Index, Rank> in_dims, rdims, bcast;
-                    Eigen::array<Eigen::Index, AxisCount> axes;
-                    rdims.fill(1);
-
-                    for (size_t i = 0; i < Rank; i++)
+                    opt_kernel::SoftmaxPlan plan(input_shape, softmax_axes);
+                    size_t work_count = plan.get_work_count();
+                    if (work_count == 0)
                     {
-                        in_dims[i] = input_shape[i];
+                        return;
                     }
-
-                    for (size_t i = 0; i < Rank; i++)
-                    {
-                        if (softmax_axes.count(i))
-                        {
-                            rdims[i] = 1;
-                        }
-                        else
-                        {
-                            rdims[i] = in_dims[i];
-                        }
-                    }
-                    for (size_t i = 0; i < Rank; i++)
-                    {
-                        bcast[i] = in_dims[i] / rdims[i];
-                    }
-
-                    size_t i = 0;
-                    for (auto axis : softmax_axes)
-                    {
-                        axes[i++] = axis;
-                    }
-
-                    Eigen::TensorMap<Eigen::Tensor<ElementType, Rank, Eigen::RowMajor>> out(
-                        static_cast<ElementType*>(output), in_dims),
-                        in(static_cast<ElementType*>(input), in_dims);
-
-                    out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
-                        (in - in.maximum(axes).eval().reshape(rdims).broadcast(bcast)).exp();
-                    out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
-                        out * out.sum(axes).inverse().eval().reshape(rdims).broadcast(bcast);
-                }
-
-                template <typename ElementType, unsigned int Rank>
-                void softmax_innermost_1rd(void* input,
-                                           void* output,
-                                           const Shape& input_shape,
-                                           int arena)
-                {
-                    Eigen::array<Eigen::Index, Rank> in_dims, rdims, bcast;
-                    Eigen::IndexList<Eigen::type2index<Rank - 1>> axis;
-                    rdims.fill(1);
-
-                    for (size_t i = 0; i < Rank; i++)
-                    {
-                        in_dims[i] = input_shape[i];
-                    }
-
-                    for (size_t i = 0; i < Rank - 1; i++)
-                    {
-                        rdims[i] = in_dims[i];
-                    }
-
-                    for (size_t i = 0; i < Rank; i++)
-                    {
-                        bcast[i] = in_dims[i] / rdims[i];
-                    }
-
-                    Eigen::TensorMap<Eigen::Tensor<ElementType, Rank, Eigen::RowMajor>> out(
-                        static_cast<ElementType*>(output), in_dims),
-                        in(static_cast<ElementType*>(input), in_dims);
-
-                    out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
-                        (in - in.maximum(axis).eval().reshape(rdims).broadcast(bcast)).exp();
-                    out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
-                        out * out.sum(axis).inverse().eval().reshape(rdims).broadcast(bcast);
-                }
-
-                template <typename ElementType, unsigned int Rank>
-                void softmax_1rd(void* input,
-                                 void* output,
-                                 const Shape& input_shape,
-                                 const AxisSet& softmax_axes,
-                                 int arena)
-                {
-                    softmax<ElementType, Rank, 1>(input, output, input_shape, softmax_axes, arena);
-                }
-
-                template <typename ElementType>
-                void softmax_3d_2rd(void* input,
-                                    void* output,
-                                    const Shape& input_shape,
-                                    const AxisSet& softmax_axes,
-                                    int arena)
-                {
-                    softmax<ElementType, 3, 2>(input, output, input_shape, softmax_axes, arena);
-                }
-
-                template <typename ElementType>
-                void softmax_4d_3rd(void* input,
-                                    void* output,
-                                    const Shape& input_shape,
-                                    const AxisSet& softmax_axes,
-                                    int arena)
-                {
-                    softmax<ElementType, 4, 3>(input, output, input_shape, softmax_axes, arena);
+                    double bytes = sizeof(ElementType) * plan.m_count / work_count;
+                    // Two reads, one write and roughly two exponentials per element
+                    double elements = static_cast<double>(plan.m_count) / work_count;
+                    Eigen::TensorOpCost cost(2 * bytes, bytes, 40 * elements);
+                    ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        work_count, cost, [&](Eigen::Index begin, Eigen::Index end) {
+                            opt_kernel::softmax(static_cast<const ElementType*>(input),
+                                                static_cast<ElementType*>(output),
+                                                plan,
+                                                false,
+                                                begin,
+                                                end);
+                        });
                 }
 
                 template <typename ElementType>
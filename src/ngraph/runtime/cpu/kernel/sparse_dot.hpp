@@ -0,0 +1,121 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Rows of data multiplied together with each block of weights
+                constexpr size_t sparse_dot_rows = 4;
+
+                // Work items [begin, end) of a SparseDot, an item being one column block of
+                // up to sparse_dot_rows rows of data. Each nonzero block of weights is loaded
+                // once for the rows of the item and accumulated in registers across its
+                // Width columns.
+                template <size_t Width>
+                void sparse_dot_blocks(const float* data,
+                                       const float* values,
+                                       const int32_t* indices,
+                                       const int32_t* offsets,
+                                       float* out,
+                                       size_t m,
+                                       size_t k,
+                                       size_t n,
+                                       size_t begin,
+                                       size_t end)
+                {
+                    const size_t column_blocks = (n + Width - 1) / Width;
+                    for (size_t w = begin; w < end; w++)
+                    {
+                        size_t row = (w / column_blocks) * sparse_dot_rows;
+                        size_t block = w % column_blocks;
+                        size_t rows = std::min(sparse_dot_rows, m - row);
+                        float acc[sparse_dot_rows][Width] = {};
+                        for (int32_t j = offsets[block]; j < offsets[block + 1]; j++)
+                        {
+                            const float* weights = values + size_t(j) * Width;
+                            const float* x = data + row * k + indices[j];
+                            for (size_t r = 0; r < rows; r++)
+                            {
+                                float a = x[r * k];
+                                for (size_t c = 0; c < Width; c++)
+                                {
+                                    acc[r][c] += a * weights[c];
+                                }
+                            }
+                        }
+                        size_t first = block * Width;
+                        size_t columns = std::min(Width, n - first);
+                        for (size_t r = 0; r < rows; r++)
+                        {
+                            std::copy(acc[r], acc[r] + columns, out + (row + r) * n + first);
+                        }
+                    }
+                }
+
+                template <size_t Width>
+                void sparse_dot(const float* data,
+                                const float* values,
+                                const int32_t* indices,
+                                const int32_t* offsets,
+                                float* out,
+                                size_t m,
+                                size_t k,
+                                size_t n,
+                                int arena)
+                {
+                    const size_t column_blocks = (n + Width - 1) / Width;
+                    const size_t row_tiles = (m + sparse_dot_rows - 1) / sparse_dot_rows;
+                    size_t nonzero_blocks = size_t(offsets[column_blocks]);
+                    // The average cost of an item
+                    double blocks = column_blocks == 0 ? 0 : double(nonzero_blocks) / column_blocks;
+                    Eigen::TensorOpCost cost(blocks * (Width + sparse_dot_rows) * sizeof(float),
+                                             sparse_dot_rows * Width * sizeof(float),
+                                             2 * blocks * sparse_dot_rows * Width);
+                    ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        row_tiles * column_blocks,
+                        cost,
+                        [&](Eigen::Index first, Eigen::Index last) {
+                            sparse_dot_blocks<Width>(data,
+                                                     values,
+                                                     indices,
+                                                     offsets,
+                                                     out,
+                                                     m,
+                                                     k,
+                                                     n,
+                                                     static_cast<size_t>(first),
+                                                     static_cast<size_t>(last));
+                        });
+                }
+            }
+        }
+    }
+}
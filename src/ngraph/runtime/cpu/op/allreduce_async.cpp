@@ -0,0 +1,79 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/op/allreduce_async.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr NodeTypeInfo op::AllReduceStart::type_info;
+constexpr NodeTypeInfo op::AllReduceWait::type_info;
+
+op::AllReduceStart::AllReduceStart(const OutputVector& args, reduction::Type reduce_type)
+    : Op(args)
+    , m_reduce_type(reduce_type)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::AllReduceStart::validate_and_infer_types()
+{
+    NODE_VALIDATION_CHECK(this, get_input_size() > 0, "AllReduceStart needs at least one input");
+    element::Type type = get_input_element_type(0);
+    size_t elements = 0;
+    for (size_t i = 0; i < get_input_size(); i++)
+    {
+        NODE_VALIDATION_CHECK(this,
+                              get_input_element_type(i) == type &&
+                                  get_input_partial_shape(i).is_static(),
+                              "Input ",
+                              i,
+                              " must be a static tensor of the element type of input 0 (",
+                              type,
+                              ")");
+        elements += shape_size(get_input_shape(i));
+    }
+    set_output_type(0, type, Shape{elements});
+}
+
+shared_ptr<Node> op::AllReduceStart::clone_with_new_inputs(const OutputVector& new_args) const
+{
+    return make_shared<AllReduceStart>(new_args, m_reduce_type);
+}
+
+op::AllReduceWait::AllReduceWait(const Output<Node>& bucket)
+    : Op({bucket})
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::AllReduceWait::validate_and_infer_types()
+{
+    auto start = as_type<AllReduceStart>(get_input_node_ptr(0));
+    NODE_VALIDATION_CHECK(
+        this, start != nullptr, "The input of AllReduceWait must be an AllReduceStart");
+    set_output_size(start->get_input_size());
+    for (size_t i = 0; i < start->get_input_size(); i++)
+    {
+        set_output_type(i, start->get_input_element_type(i), start->get_input_shape(i));
+    }
+}
+
+shared_ptr<Node> op::AllReduceWait::clone_with_new_inputs(const OutputVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<AllReduceWait>(new_args.at(0));
+}
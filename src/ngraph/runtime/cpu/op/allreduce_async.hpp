@@ -0,0 +1,68 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/distributed.hpp"
+#include "ngraph/op/op.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Packs its inputs, of one element type, into a flat bucket and starts the
+        ///        all-reduce of the bucket without waiting for it.
+        ///
+        /// The output is the bucket, which is only reduced once the AllReduceWait of this op
+        /// has run. Nothing but that AllReduceWait may read it.
+        class AllReduceStart : public Op
+        {
+        public:
+            CPU_BACKEND_API
+            static constexpr NodeTypeInfo type_info{"AllReduceStart", 0};
+            const NodeTypeInfo& get_type_info() const override { return type_info; }
+            CPU_BACKEND_API AllReduceStart(const OutputVector& args,
+                                           reduction::Type reduce_type = reduction::Type::SUM);
+
+            void validate_and_infer_types() override;
+
+            virtual std::shared_ptr<Node>
+                clone_with_new_inputs(const OutputVector& new_args) const override;
+
+            reduction::Type get_reduce_type() const { return m_reduce_type; }
+
+        protected:
+            reduction::Type m_reduce_type;
+        };
+
+        /// \brief Waits for the all-reduce of the bucket its AllReduceStart input started and
+        ///        unpacks the bucket into one output per input of the AllReduceStart.
+        class AllReduceWait : public Op
+        {
+        public:
+            CPU_BACKEND_API
+            static constexpr NodeTypeInfo type_info{"AllReduceWait", 0};
+            const NodeTypeInfo& get_type_info() const override { return type_info; }
+            CPU_BACKEND_API AllReduceWait(const Output<Node>& bucket);
+
+            void validate_and_infer_types() override;
+
+            virtual std::shared_ptr<Node>
+                clone_with_new_inputs(const OutputVector& new_args) const override;
+        };
+    }
+}
@@ -0,0 +1,135 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+
+#include "ngraph/runtime/cpu/op/attention.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr NodeTypeInfo op::ScaledDotProductAttention::type_info;
+
+op::ScaledDotProductAttention::ScaledDotProductAttention(const Output<Node>& query,
+                                                         const Output<Node>& key,
+                                                         const Output<Node>& value,
+                                                         float scale,
+                                                         bool transpose_key)
+    : Op({query, key, value})
+    , m_scale(scale)
+    , m_transpose_key(transpose_key)
+{
+    constructor_validate_and_infer_types();
+}
+
+op::ScaledDotProductAttention::ScaledDotProductAttention(const Output<Node>& query,
+                                                         const Output<Node>& key,
+                                                         const Output<Node>& value,
+                                                         const Output<Node>& mask,
+                                                         float scale,
+                                                         bool transpose_key)
+    : Op({query, key, value, mask})
+    , m_scale(scale)
+    , m_transpose_key(transpose_key)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::ScaledDotProductAttention::validate_and_infer_types()
+{
+    for (size_t i = 0; i < get_input_size(); i++)
+    {
+        NODE_VALIDATION_CHECK(this,
+                              get_input_element_type(i) == element::f32 &&
+                                  get_input_partial_shape(i).is_static(),
+                              "Input ",
+                              i,
+                              " must be a static f32 tensor");
+    }
+
+    const Shape& query_shape = get_input_shape(0);
+    const Shape& key_shape = get_input_shape(1);
+    const Shape& value_shape = get_input_shape(2);
+    size_t rank = query_shape.size();
+    NODE_VALIDATION_CHECK(this,
+                          rank >= 2 && key_shape.size() == rank && value_shape.size() == rank &&
+                              equal(query_shape.begin(),
+                                    query_shape.end() - 2,
+                                    key_shape.begin()) &&
+                              equal(query_shape.begin(),
+                                    query_shape.end() - 2,
+                                    value_shape.begin()),
+                          "Query, key and value must have the same leading axes (shapes ",
+                          query_shape,
+                          ", ",
+                          key_shape,
+                          ", ",
+                          value_shape,
+                          ")");
+
+    size_t depth = query_shape[rank - 1];
+    size_t keys = value_shape[rank - 2];
+    size_t key_depth = key_shape[m_transpose_key ? rank - 1 : rank - 2];
+    size_t key_keys = key_shape[m_transpose_key ? rank - 2 : rank - 1];
+    NODE_VALIDATION_CHECK(this,
+                          key_depth == depth && key_keys == keys,
+                          "Key of shape ",
+                          key_shape,
+                          " does not match query of shape ",
+                          query_shape,
+                          " and value of shape ",
+                          value_shape);
+
+    if (has_mask())
+    {
+        Shape scores_shape(query_shape.begin(), query_shape.end() - 1);
+        scores_shape.push_back(keys);
+        const Shape& mask_shape = get_input_shape(3);
+        bool broadcastable = mask_shape.size() <= rank;
+        for (size_t i = 0; broadcastable && i < mask_shape.size(); i++)
+        {
+            size_t dim = mask_shape[mask_shape.size() - 1 - i];
+            broadcastable = dim == 1 || dim == scores_shape[rank - 1 - i];
+        }
+        NODE_VALIDATION_CHECK(this,
+                              broadcastable,
+                              "Mask of shape ",
+                              mask_shape,
+                              " does not broadcast to the scores of shape ",
+                              scores_shape);
+    }
+
+    Shape output_shape(query_shape);
+    output_shape.back() = value_shape.back();
+    set_output_type(0, element::f32, output_shape);
+}
+
+shared_ptr<Node>
+    op::ScaledDotProductAttention::clone_with_new_inputs(const OutputVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    if (new_args.size() == 4)
+    {
+        return make_shared<ScaledDotProductAttention>(new_args.at(0),
+                                                      new_args.at(1),
+                                                      new_args.at(2),
+                                                      new_args.at(3),
+                                                      m_scale,
+                                                      m_transpose_key);
+    }
+    return make_shared<ScaledDotProductAttention>(
+        new_args.at(0), new_args.at(1), new_args.at(2), m_scale, m_transpose_key);
+}
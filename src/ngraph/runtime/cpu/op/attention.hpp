@@ -0,0 +1,66 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/op/op.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief softmax(scale * query x key^T + mask) x value, with the softmax over the
+        ///        keys, computed without materializing the [..., queries, keys] scores.
+        ///
+        /// query is [..., queries, depth] and value [..., keys, value_depth]. key is
+        /// [..., keys, depth] when transpose_key is set, as the second input of a MatMul
+        /// with transpose_b, and [..., depth, keys] otherwise. The leading axes of the
+        /// three must be equal. The optional additive mask is numpy broadcast to
+        /// [..., queries, keys].
+        class ScaledDotProductAttention : public Op
+        {
+        public:
+            CPU_BACKEND_API
+            static constexpr NodeTypeInfo type_info{"ScaledDotProductAttention", 0};
+            const NodeTypeInfo& get_type_info() const override { return type_info; }
+            CPU_BACKEND_API ScaledDotProductAttention(const Output<Node>& query,
+                                                      const Output<Node>& key,
+                                                      const Output<Node>& value,
+                                                      float scale,
+                                                      bool transpose_key);
+            CPU_BACKEND_API ScaledDotProductAttention(const Output<Node>& query,
+                                                      const Output<Node>& key,
+                                                      const Output<Node>& value,
+                                                      const Output<Node>& mask,
+                                                      float scale,
+                                                      bool transpose_key);
+
+            void validate_and_infer_types() override;
+
+            virtual std::shared_ptr<Node>
+                clone_with_new_inputs(const OutputVector& new_args) const override;
+
+            float get_scale() const { return m_scale; }
+            bool get_transpose_key() const { return m_transpose_key; }
+            bool has_mask() const { return get_input_size() == 4; }
+
+        protected:
+            float m_scale;
+            bool m_transpose_key;
+        };
+    }
+}
@@ -0,0 +1,129 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/op/compressed_weights.hpp"
+#include "ngraph/op/experimental/decompress_weights.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Checks the compressed weights inputs 1 and 2 of `node`, as op::v0::DecompressWeights does.
+static void validate_compressed_weights(const Node* node,
+                                        const Shape& weights_shape,
+                                        size_t axis,
+                                        size_t bits)
+{
+    NODE_VALIDATION_CHECK(node,
+                          weights_shape.size() == 2 && axis < 2 && (bits == 8 || bits == 4),
+                          "Unsupported compressed weights of shape ",
+                          weights_shape,
+                          " with channel axis ",
+                          axis,
+                          " and ",
+                          bits,
+                          " bits");
+    NODE_VALIDATION_CHECK(
+        node,
+        node->get_input_element_type(1) == element::i8 &&
+            node->get_input_partial_shape(1).compatible(
+                op::v0::DecompressWeights::get_packed_shape(weights_shape, bits)),
+        "Packed weights do not match weights of shape ",
+        weights_shape);
+    NODE_VALIDATION_CHECK(node,
+                          node->get_input_element_type(2) == element::f32 &&
+                              node->get_input_partial_shape(2).compatible(
+                                  Shape{weights_shape[axis]}),
+                          "Scales do not match weights of shape ",
+                          weights_shape);
+}
+
+constexpr NodeTypeInfo op::CompressedDot::type_info;
+
+op::CompressedDot::CompressedDot(const Output<Node>& data,
+                                 const Output<Node>& packed,
+                                 const Output<Node>& scales,
+                                 const Shape& weights_shape,
+                                 size_t axis,
+                                 size_t bits)
+    : Op({data, packed, scales})
+    , m_weights_shape(weights_shape)
+    , m_axis(axis)
+    , m_bits(bits)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::CompressedDot::validate_and_infer_types()
+{
+    validate_compressed_weights(this, m_weights_shape, m_axis, m_bits);
+
+    const PartialShape& data_shape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(this,
+                          get_input_element_type(0) == element::f32 && data_shape.is_static() &&
+                              data_shape.rank().get_length() >= 1,
+                          "Data must be a static f32 tensor of rank 1 or more");
+    Shape output_shape = data_shape.to_shape();
+    NODE_VALIDATION_CHECK(this,
+                          output_shape.back() == m_weights_shape[0],
+                          "Data of shape ",
+                          output_shape,
+                          " does not match weights of shape ",
+                          m_weights_shape);
+    output_shape.back() = m_weights_shape[1];
+    set_output_type(0, element::f32, output_shape);
+}
+
+shared_ptr<Node> op::CompressedDot::clone_with_new_inputs(const OutputVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<CompressedDot>(
+        new_args.at(0), new_args.at(1), new_args.at(2), m_weights_shape, m_axis, m_bits);
+}
+
+constexpr NodeTypeInfo op::CompressedEmbeddingLookup::type_info;
+
+op::CompressedEmbeddingLookup::CompressedEmbeddingLookup(const Output<Node>& indices,
+                                                         const Output<Node>& packed,
+                                                         const Output<Node>& scales,
+                                                         const Shape& weights_shape,
+                                                         size_t axis,
+                                                         size_t bits)
+    : Op({indices, packed, scales})
+    , m_weights_shape(weights_shape)
+    , m_axis(axis)
+    , m_bits(bits)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::CompressedEmbeddingLookup::validate_and_infer_types()
+{
+    validate_compressed_weights(this, m_weights_shape, m_axis, m_bits);
+
+    const PartialShape& indices_shape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(this, indices_shape.is_static(), "Indices must have a static shape");
+    Shape output_shape = indices_shape.to_shape();
+    output_shape.push_back(m_weights_shape[1]);
+    set_output_type(0, element::f32, output_shape);
+}
+
+shared_ptr<Node>
+    op::CompressedEmbeddingLookup::clone_with_new_inputs(const OutputVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<CompressedEmbeddingLookup>(
+        new_args.at(0), new_args.at(1), new_args.at(2), m_weights_shape, m_axis, m_bits);
+}
@@ -0,0 +1,86 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/op/op.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Dot of data [..., k] and weights [k, n] held in the compressed storage of
+        ///        op::v0::DecompressWeights, which the kernel dequantizes while it packs them.
+        class CompressedDot : public Op
+        {
+        public:
+            CPU_BACKEND_API
+            static constexpr NodeTypeInfo type_info{"CompressedDot", 0};
+            const NodeTypeInfo& get_type_info() const override { return type_info; }
+            CPU_BACKEND_API CompressedDot(const Output<Node>& data,
+                                          const Output<Node>& packed,
+                                          const Output<Node>& scales,
+                                          const Shape& weights_shape,
+                                          size_t axis,
+                                          size_t bits);
+
+            void validate_and_infer_types() override;
+
+            virtual std::shared_ptr<Node>
+                clone_with_new_inputs(const OutputVector& new_args) const override;
+
+            const Shape& get_weights_shape() const { return m_weights_shape; }
+            size_t get_axis() const { return m_axis; }
+            size_t get_bits() const { return m_bits; }
+
+        protected:
+            Shape m_weights_shape;
+            size_t m_axis;
+            size_t m_bits;
+        };
+
+        /// \brief EmbeddingLookup of a table [rows, cols] held in the compressed storage of
+        ///        op::v0::DecompressWeights. Only the rows looked up are dequantized.
+        class CompressedEmbeddingLookup : public Op
+        {
+        public:
+            CPU_BACKEND_API
+            static constexpr NodeTypeInfo type_info{"CompressedEmbeddingLookup", 0};
+            const NodeTypeInfo& get_type_info() const override { return type_info; }
+            CPU_BACKEND_API CompressedEmbeddingLookup(const Output<Node>& indices,
+                                                      const Output<Node>& packed,
+                                                      const Output<Node>& scales,
+                                                      const Shape& weights_shape,
+                                                      size_t axis,
+                                                      size_t bits);
+
+            void validate_and_infer_types() override;
+
+            virtual std::shared_ptr<Node>
+                clone_with_new_inputs(const OutputVector& new_args) const override;
+
+            const Shape& get_weights_shape() const { return m_weights_shape; }
+            size_t get_axis() const { return m_axis; }
+            size_t get_bits() const { return m_bits; }
+
+        protected:
+            Shape m_weights_shape;
+            size_t m_axis;
+            size_t m_bits;
+        };
+    }
+}
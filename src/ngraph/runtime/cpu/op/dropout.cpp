@@ -24,6 +24,7 @@ using namespace std;
 using namespace ngraph;
 
 constexpr NodeTypeInfo op::Dropout::type_info;
+constexpr NodeTypeInfo op::DropoutBackprop::type_info;
 
 op::Dropout::Dropout(const Output<Node>& input,
                      const Output<Node>& gm_const,
@@ -71,3 +72,55 @@ uint64_t op::Dropout::get_seed() const
     }
     return seed;
 }
+
+op::DropoutBackprop::DropoutBackprop(const Output<Node>& delta,
+                                     const shared_ptr<Dropout>& forward,
+                                     bool scale)
+    : Op({delta,
+          forward->input_value(1),
+          forward->input_value(2),
+          forward->input_value(3),
+          forward->input_value(4)})
+    , m_scale(scale)
+{
+    add_control_dependency(forward);
+    constructor_validate_and_infer_types();
+
+    NODE_VALIDATION_CHECK(this,
+                          delta.get_element_type() == forward->get_input_element_type(0) &&
+                              delta.get_shape() == forward->get_input_shape(0),
+                          "Delta must have the element type and shape of the Dropout input");
+    set_output_type(0, delta.get_element_type(), delta.get_shape());
+}
+
+op::DropoutBackprop::DropoutBackprop(const OutputVector& args, bool scale)
+    : Op(args)
+    , m_scale(scale)
+{
+    constructor_validate_and_infer_types();
+    set_output_type(0, get_input_element_type(0), get_input_shape(0));
+}
+
+shared_ptr<Node> op::DropoutBackprop::clone_with_new_inputs(const OutputVector& new_args) const
+{
+    if (new_args.size() != 5)
+    {
+        throw ngraph_error("Incorrect number of new arguments");
+    }
+
+    // The control dependency on the forward op is copied with the other control dependencies
+    // by the callers cloning graphs
+    return shared_ptr<Node>(new DropoutBackprop(new_args, m_scale));
+}
+
+shared_ptr<op::Dropout> op::DropoutBackprop::get_forward() const
+{
+    for (auto& dependency : get_control_dependencies())
+    {
+        if (auto forward = as_type_ptr<Dropout>(dependency))
+        {
+            return forward;
+        }
+    }
+    return nullptr;
+}
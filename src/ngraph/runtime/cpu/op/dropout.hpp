@@ -43,5 +43,32 @@ namespace ngraph
             virtual std::shared_ptr<Node>
                 clone_with_new_inputs(const OutputVector& new_args) const override;
         };
+
+        /// \brief Backprop of a Dropout that regenerates its mask from the random numbers of
+        ///        the forward op instead of reading the mask from memory.
+        ///
+        /// The output is delta * mask, divided by keep_prob when `scale` is set. The op keeps
+        /// a control dependency on the forward Dropout, which has to run before it in every
+        /// call, and takes the training flag, seed and keep_prob inputs of that op.
+        class DropoutBackprop : public Op
+        {
+        public:
+            CPU_BACKEND_API
+            static constexpr NodeTypeInfo type_info{"DropoutBackprop", 0};
+            const NodeTypeInfo& get_type_info() const override { return type_info; }
+            DropoutBackprop(const Output<Node>& delta,
+                            const std::shared_ptr<Dropout>& forward,
+                            bool scale);
+
+            /// \return the forward Dropout whose mask this op applies
+            std::shared_ptr<Dropout> get_forward() const;
+            bool get_scale() const { return m_scale; }
+            virtual std::shared_ptr<Node>
+                clone_with_new_inputs(const OutputVector& new_args) const override;
+
+        private:
+            DropoutBackprop(const OutputVector& args, bool scale);
+            bool m_scale;
+        };
     }
 }
@@ -0,0 +1,141 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/op/elementwise_chain.hpp"
+#include "ngraph/op/abs.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/exp.hpp"
+#include "ngraph/op/log.hpp"
+#include "ngraph/op/maximum.hpp"
+#include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/negative.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/op/sigmoid.hpp"
+#include "ngraph/op/sqrt.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/op/tanh.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr NodeTypeInfo op::ElementwiseChain::type_info;
+
+op::ElementwiseChain::ElementwiseChain(const OutputVector& args, const vector<Step>& steps)
+    : Op(args)
+    , m_steps(steps)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::ElementwiseChain::validate_and_infer_types()
+{
+    NODE_VALIDATION_CHECK(this, get_input_size() > 0, "ElementwiseChain needs at least one input");
+    NODE_VALIDATION_CHECK(this, !m_steps.empty(), "ElementwiseChain needs at least one step");
+
+    auto et = get_input_element_type(0);
+    auto shape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(this,
+                          et == element::f32 || et == element::f64,
+                          "ElementwiseChain element type must be f32 or f64, got ",
+                          et);
+    for (size_t i = 1; i < get_input_size(); i++)
+    {
+        NODE_VALIDATION_CHECK(this,
+                              get_input_element_type(i) == et,
+                              "ElementwiseChain input element types do not match");
+        NODE_VALIDATION_CHECK(this,
+                              get_input_partial_shape(i).same_scheme(shape),
+                              "ElementwiseChain input shapes do not match");
+    }
+
+    for (size_t i = 0; i < m_steps.size(); i++)
+    {
+        auto& step = m_steps[i];
+        NODE_VALIDATION_CHECK(this,
+                              step.operands.size() == get_arity(step.type),
+                              "ElementwiseChain step ",
+                              i,
+                              " has the wrong number of operands");
+        for (size_t operand : step.operands)
+        {
+            NODE_VALIDATION_CHECK(this,
+                                  operand < get_input_size() + i,
+                                  "ElementwiseChain step ",
+                                  i,
+                                  " refers to an input or step that does not precede it");
+        }
+    }
+
+    set_output_type(0, et, shape);
+}
+
+shared_ptr<Node> op::ElementwiseChain::clone_with_new_inputs(const OutputVector& new_args) const
+{
+    return make_shared<ElementwiseChain>(new_args, m_steps);
+}
+
+bool op::ElementwiseChain::get_op_type(const Node& node, OpType& type)
+{
+    static const unordered_map<NodeTypeInfo, OpType> op_types{
+        {op::v1::Add::type_info, OpType::Add},
+        {op::v1::Subtract::type_info, OpType::Subtract},
+        {op::v1::Multiply::type_info, OpType::Multiply},
+        {op::v1::Divide::type_info, OpType::Divide},
+        {op::v1::Maximum::type_info, OpType::Maximum},
+        {op::v1::Minimum::type_info, OpType::Minimum},
+        {op::v0::Negative::type_info, OpType::Negative},
+        {op::v0::Abs::type_info, OpType::Abs},
+        {op::v0::Exp::type_info, OpType::Exp},
+        {op::v0::Log::type_info, OpType::Log},
+        {op::v0::Sqrt::type_info, OpType::Sqrt},
+        {op::v0::Tanh::type_info, OpType::Tanh},
+        {op::v0::Sigmoid::type_info, OpType::Sigmoid},
+        {op::v0::Relu::type_info, OpType::Relu}};
+
+    auto it = op_types.find(node.get_type_info());
+    if (it == op_types.end())
+    {
+        return false;
+    }
+    // Divide with integer semantics ("pythondiv") only differs for integral types, which a chain
+    // never has
+    type = it->second;
+    return true;
+}
+
+size_t op::ElementwiseChain::get_arity(OpType type)
+{
+    switch (type)
+    {
+    case OpType::Add:
+    case OpType::Subtract:
+    case OpType::Multiply:
+    case OpType::Divide:
+    case OpType::Maximum:
+    case OpType::Minimum: return 2;
+    case OpType::Negative:
+    case OpType::Abs:
+    case OpType::Exp:
+    case OpType::Log:
+    case OpType::Sqrt:
+    case OpType::Tanh:
+    case OpType::Sigmoid:
+    case OpType::Relu: return 1;
+    }
+    return 0;
+}
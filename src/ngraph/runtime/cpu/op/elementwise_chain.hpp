@@ -0,0 +1,83 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <vector>
+
+#include "ngraph/op/op.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief A tree of elementwise operations over inputs of one shape and floating point
+        ///        element type, evaluated in a single pass without materializing the
+        ///        intermediate results.
+        class ElementwiseChain : public Op
+        {
+        public:
+            CPU_BACKEND_API
+            static constexpr NodeTypeInfo type_info{"ElementwiseChain", 0};
+            const NodeTypeInfo& get_type_info() const override { return type_info; }
+            enum class OpType
+            {
+                Add,
+                Subtract,
+                Multiply,
+                Divide,
+                Maximum,
+                Minimum,
+                Negative,
+                Abs,
+                Exp,
+                Log,
+                Sqrt,
+                Tanh,
+                Sigmoid,
+                Relu
+            };
+
+            /// One operation of the chain. An operand below the number of inputs refers to that
+            /// input, any other to the result of step (operand - number of inputs). The result
+            /// of the last step is the output.
+            struct Step
+            {
+                OpType type;
+                std::vector<size_t> operands;
+            };
+
+            CPU_BACKEND_API ElementwiseChain(const OutputVector& args,
+                                             const std::vector<Step>& steps);
+
+            void validate_and_infer_types() override;
+
+            virtual std::shared_ptr<Node>
+                clone_with_new_inputs(const OutputVector& new_args) const override;
+
+            const std::vector<Step>& get_steps() const { return m_steps; }
+            /// \brief Sets `type` to the chain operation computing `node`.
+            /// \returns false if `node` has no chain equivalent.
+            static CPU_BACKEND_API bool get_op_type(const Node& node, OpType& type);
+            /// \returns the number of operands an operation of `type` takes.
+            static CPU_BACKEND_API size_t get_arity(OpType type);
+
+        private:
+            std::vector<Step> m_steps;
+        };
+    }
+}
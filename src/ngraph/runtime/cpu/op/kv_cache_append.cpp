@@ -0,0 +1,59 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/op/kv_cache_append.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr NodeTypeInfo op::KVCacheAppend::type_info;
+
+op::KVCacheAppend::KVCacheAppend(const Output<Node>& values,
+                                 const Output<Node>& position,
+                                 size_t max_length)
+    : Op({values, position})
+    , m_max_length(max_length)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::KVCacheAppend::validate_and_infer_types()
+{
+    const PartialShape& values_shape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(this,
+                          values_shape.is_static() && values_shape.rank().get_length() == 3,
+                          "Values must be static of rank 3, [batch, steps, depth]");
+    const element::Type& position_type = get_input_element_type(1);
+    NODE_VALIDATION_CHECK(this,
+                          (position_type == element::i32 || position_type == element::i64) &&
+                              get_input_partial_shape(1).compatible(PartialShape{}),
+                          "Position must be an i32 or i64 scalar");
+    Shape output_shape = values_shape.to_shape();
+    NODE_VALIDATION_CHECK(this,
+                          output_shape[1] <= m_max_length,
+                          "Cannot append ",
+                          output_shape[1],
+                          " steps to a cache of ",
+                          m_max_length);
+    output_shape[1] = m_max_length;
+    set_output_type(0, get_input_element_type(0), output_shape);
+}
+
+shared_ptr<Node> op::KVCacheAppend::clone_with_new_inputs(const OutputVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<KVCacheAppend>(new_args.at(0), new_args.at(1), m_max_length);
+}
@@ -0,0 +1,56 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/op/op.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Writes `values` [batch, steps, depth] into a key or value cache of
+        ///        `max_length` steps at step `position`, a scalar i32 or i64, and outputs the
+        ///        cache [batch, max_length, depth].
+        ///
+        /// The cache persists from one call to the next, one per runtime context, and starts
+        /// as zeros. Only the steps before position + steps are meaningful; they are read
+        /// with PrefixAttention, which then reads the cache in place. Each decoding step
+        /// of a sequence thus runs the same compiled function with a new position.
+        class KVCacheAppend : public Op
+        {
+        public:
+            CPU_BACKEND_API
+            static constexpr NodeTypeInfo type_info{"KVCacheAppend", 0};
+            const NodeTypeInfo& get_type_info() const override { return type_info; }
+            CPU_BACKEND_API KVCacheAppend(const Output<Node>& values,
+                                          const Output<Node>& position,
+                                          size_t max_length);
+
+            void validate_and_infer_types() override;
+
+            virtual std::shared_ptr<Node>
+                clone_with_new_inputs(const OutputVector& new_args) const override;
+
+            bool has_state() const override { return true; }
+            size_t get_max_length() const { return m_max_length; }
+
+        protected:
+            size_t m_max_length;
+        };
+    }
+}
@@ -55,8 +55,8 @@ namespace ngraph
                  const Output<Node>& weights_iter,
                  const Output<Node>& bias,
                  ngraph::runtime::cpu::rnn_utils::rnntype rnn_type);
-            Shape get_output_tensor_shape() const { return m_output_tensor_shape; }
-            Shape get_output_cell_shape() const { return m_output_cell_shape; }
+            const Shape& get_output_tensor_shape() const { return m_output_tensor_shape; }
+            const Shape& get_output_cell_shape() const { return m_output_cell_shape; }
             ngraph::runtime::cpu::rnn_utils::rnntype get_rnn_type() const { return m_rnntype; }
             size_t get_num_timesteps() const { return m_num_timesteps; }
             size_t get_src_sequence_length() const { return m_src_sequence_length; }
@@ -43,8 +43,8 @@ namespace ngraph
 
             bool get_is_a_transposed() const { return m_transpose_w; }
             bool get_is_b_transposed() const { return m_transpose_x; }
-            Shape get_a_shape() const { return m_shape_w; }
-            Shape get_b_shape() const { return m_shape_x; }
+            const Shape& get_a_shape() const { return m_shape_w; }
+            const Shape& get_b_shape() const { return m_shape_x; }
             const AxisSet& get_broadcast_axes() const { return m_broadcast_axes; }
             virtual std::shared_ptr<Node>
                 clone_with_new_inputs(const OutputVector& new_args) const override;
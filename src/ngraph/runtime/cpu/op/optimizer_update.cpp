@@ -0,0 +1,134 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/op/optimizer_update.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr NodeTypeInfo op::SGDMomentumUpdate::type_info;
+constexpr NodeTypeInfo op::AdamUpdate::type_info;
+
+// The first `tensors` inputs of an update are tensors of one shape, the others scalars, all of
+// one floating point element type
+static void validate_update_inputs(Node* node, size_t tensors)
+{
+    auto et = node->get_input_element_type(0);
+    auto shape = node->get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(node,
+                          et == element::f32 || et == element::f64,
+                          "Optimizer update element type must be f32 or f64, got ",
+                          et);
+    for (size_t i = 0; i < node->get_input_size(); i++)
+    {
+        NODE_VALIDATION_CHECK(node,
+                              node->get_input_element_type(i) == et,
+                              "Optimizer update input ",
+                              i,
+                              " does not have element type ",
+                              et);
+        if (i < tensors)
+        {
+            NODE_VALIDATION_CHECK(node,
+                                  node->get_input_partial_shape(i).same_scheme(shape),
+                                  "Optimizer update input ",
+                                  i,
+                                  " does not have the shape of the weights");
+        }
+        else
+        {
+            NODE_VALIDATION_CHECK(node,
+                                  node->get_input_partial_shape(i).same_scheme(PartialShape{}),
+                                  "Optimizer update input ",
+                                  i,
+                                  " must be a scalar");
+        }
+    }
+}
+
+op::SGDMomentumUpdate::SGDMomentumUpdate(const Output<Node>& weights,
+                                         const Output<Node>& velocity,
+                                         const Output<Node>& gradient,
+                                         const Output<Node>& learning_rate,
+                                         const Output<Node>& momentum)
+    : Op({weights, velocity, gradient, learning_rate, momentum})
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::SGDMomentumUpdate::validate_and_infer_types()
+{
+    validate_update_inputs(this, 3);
+    set_output_size(2);
+    set_output_type(0, get_input_element_type(0), get_input_partial_shape(0));
+    set_output_type(1, get_input_element_type(0), get_input_partial_shape(0));
+}
+
+shared_ptr<Node> op::SGDMomentumUpdate::clone_with_new_inputs(const OutputVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<SGDMomentumUpdate>(
+        new_args.at(0), new_args.at(1), new_args.at(2), new_args.at(3), new_args.at(4));
+}
+
+op::AdamUpdate::AdamUpdate(const Output<Node>& weights,
+                           const Output<Node>& m,
+                           const Output<Node>& v,
+                           const Output<Node>& gradient,
+                           const Output<Node>& learning_rate,
+                           const Output<Node>& beta1,
+                           const Output<Node>& one_minus_beta1,
+                           const Output<Node>& beta2,
+                           const Output<Node>& one_minus_beta2,
+                           const Output<Node>& epsilon)
+    : Op({weights,
+          m,
+          v,
+          gradient,
+          learning_rate,
+          beta1,
+          one_minus_beta1,
+          beta2,
+          one_minus_beta2,
+          epsilon})
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::AdamUpdate::validate_and_infer_types()
+{
+    validate_update_inputs(this, 4);
+    set_output_size(3);
+    for (size_t i = 0; i < 3; i++)
+    {
+        set_output_type(i, get_input_element_type(0), get_input_partial_shape(0));
+    }
+}
+
+shared_ptr<Node> op::AdamUpdate::clone_with_new_inputs(const OutputVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<AdamUpdate>(new_args.at(0),
+                                   new_args.at(1),
+                                   new_args.at(2),
+                                   new_args.at(3),
+                                   new_args.at(4),
+                                   new_args.at(5),
+                                   new_args.at(6),
+                                   new_args.at(7),
+                                   new_args.at(8),
+                                   new_args.at(9));
+}
@@ -0,0 +1,89 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/op/op.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief One step of SGD with momentum for a weight tensor, in a single pass over it:
+        ///
+        ///    velocity' = momentum * velocity + gradient
+        ///    weights' = weights - learning_rate * velocity'
+        ///
+        /// The weights, velocity and gradient are tensors of one shape and floating point
+        /// element type, and the learning rate and momentum are scalars of that type. The
+        /// outputs are the new weights and the new velocity. Each element of the outputs is
+        /// only written after the same element of the inputs is read, so the new weights and
+        /// velocity may be written over the old ones.
+        class SGDMomentumUpdate : public Op
+        {
+        public:
+            CPU_BACKEND_API
+            static constexpr NodeTypeInfo type_info{"SGDMomentumUpdate", 0};
+            const NodeTypeInfo& get_type_info() const override { return type_info; }
+            CPU_BACKEND_API SGDMomentumUpdate(const Output<Node>& weights,
+                                              const Output<Node>& velocity,
+                                              const Output<Node>& gradient,
+                                              const Output<Node>& learning_rate,
+                                              const Output<Node>& momentum);
+
+            void validate_and_infer_types() override;
+
+            virtual std::shared_ptr<Node>
+                clone_with_new_inputs(const OutputVector& new_args) const override;
+        };
+
+        /// \brief One step of Adam for a weight tensor, in a single pass over it:
+        ///
+        ///    m' = beta1 * m + one_minus_beta1 * gradient
+        ///    v' = beta2 * v + one_minus_beta2 * gradient * gradient
+        ///    weights' = weights - learning_rate * m' / (sqrt(v') + epsilon)
+        ///
+        /// The weights, moments and gradient are tensors of one shape and floating point
+        /// element type, the other inputs scalars of that type. The learning rate includes the
+        /// bias correction of the step, and the complements of the decay rates are inputs so
+        /// that the update computes what the ops it replaces did, whatever they were rounded
+        /// to. The outputs are the new weights, m and v, which may be written over the old
+        /// ones.
+        class AdamUpdate : public Op
+        {
+        public:
+            CPU_BACKEND_API
+            static constexpr NodeTypeInfo type_info{"AdamUpdate", 0};
+            const NodeTypeInfo& get_type_info() const override { return type_info; }
+            CPU_BACKEND_API AdamUpdate(const Output<Node>& weights,
+                                       const Output<Node>& m,
+                                       const Output<Node>& v,
+                                       const Output<Node>& gradient,
+                                       const Output<Node>& learning_rate,
+                                       const Output<Node>& beta1,
+                                       const Output<Node>& one_minus_beta1,
+                                       const Output<Node>& beta2,
+                                       const Output<Node>& one_minus_beta2,
+                                       const Output<Node>& epsilon);
+
+            void validate_and_infer_types() override;
+
+            virtual std::shared_ptr<Node>
+                clone_with_new_inputs(const OutputVector& new_args) const override;
+        };
+    }
+}
@@ -0,0 +1,73 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/op/prefix_attention.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr NodeTypeInfo op::PrefixAttention::type_info;
+
+op::PrefixAttention::PrefixAttention(const Output<Node>& query,
+                                     const Output<Node>& key,
+                                     const Output<Node>& value,
+                                     const Output<Node>& position,
+                                     float scale)
+    : Op({query, key, value, position})
+    , m_scale(scale)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::PrefixAttention::validate_and_infer_types()
+{
+    for (size_t i = 0; i < 3; i++)
+    {
+        NODE_VALIDATION_CHECK(this,
+                              get_input_element_type(i) == element::f32 &&
+                                  get_input_partial_shape(i).is_static() &&
+                                  get_input_partial_shape(i).rank().get_length() == 3,
+                              "Query, key and value must be static f32 tensors of rank 3");
+    }
+    const element::Type& position_type = get_input_element_type(3);
+    NODE_VALIDATION_CHECK(this,
+                          (position_type == element::i32 || position_type == element::i64) &&
+                              get_input_partial_shape(3).compatible(PartialShape{}),
+                          "Position must be an i32 or i64 scalar");
+
+    const Shape& query_shape = get_input_shape(0);
+    const Shape& key_shape = get_input_shape(1);
+    const Shape& value_shape = get_input_shape(2);
+    NODE_VALIDATION_CHECK(this,
+                          key_shape[0] == query_shape[0] && value_shape[0] == query_shape[0] &&
+                              key_shape[2] == query_shape[2] && value_shape[1] == key_shape[1] &&
+                              query_shape[1] <= key_shape[1],
+                          "Query ",
+                          query_shape,
+                          ", key ",
+                          key_shape,
+                          " and value ",
+                          value_shape,
+                          " do not match");
+    set_output_type(0, element::f32, Shape{query_shape[0], query_shape[1], value_shape[2]});
+}
+
+shared_ptr<Node> op::PrefixAttention::clone_with_new_inputs(const OutputVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<PrefixAttention>(
+        new_args.at(0), new_args.at(1), new_args.at(2), new_args.at(3), m_scale);
+}
@@ -0,0 +1,57 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/op/op.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Causal attention of queries [batch, queries, depth] at steps position,
+        ///        position + 1, ... of a sequence over the keys [batch, length, depth] and
+        ///        values [batch, length, value_depth] of its steps so far.
+        ///
+        /// Query i sees the keys and values of steps 0 to position + i, so the steps of a
+        /// KVCacheAppend output past the last query are never read. `position` is a scalar
+        /// i32 or i64. The output is [batch, queries, value_depth]; heads are folded into
+        /// the batch.
+        class PrefixAttention : public Op
+        {
+        public:
+            CPU_BACKEND_API
+            static constexpr NodeTypeInfo type_info{"PrefixAttention", 0};
+            const NodeTypeInfo& get_type_info() const override { return type_info; }
+            CPU_BACKEND_API PrefixAttention(const Output<Node>& query,
+                                            const Output<Node>& key,
+                                            const Output<Node>& value,
+                                            const Output<Node>& position,
+                                            float scale);
+
+            void validate_and_infer_types() override;
+
+            virtual std::shared_ptr<Node>
+                clone_with_new_inputs(const OutputVector& new_args) const override;
+
+            float get_scale() const { return m_scale; }
+
+        protected:
+            float m_scale;
+        };
+    }
+}
@@ -0,0 +1,90 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/op/preprocess.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr NodeTypeInfo op::Preprocess::type_info;
+
+op::Preprocess::Preprocess(const Output<Node>& frames,
+                           bool channels_last,
+                           const Shape& output_shape,
+                           const op::v3::Interpolate::InterpolateAttrs& resize_attrs,
+                           const vector<float>& scale,
+                           const vector<float>& shift)
+    : Op({frames})
+    , m_channels_last(channels_last)
+    , m_output_shape(output_shape)
+    , m_resize_attrs(resize_attrs)
+    , m_scale(scale)
+    , m_shift(shift)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::Preprocess::validate_and_infer_types()
+{
+    auto et = get_input_element_type(0);
+    NODE_VALIDATION_CHECK(this,
+                          et == element::u8 || et == element::i8 || et == element::f32,
+                          "Preprocess frames must be u8, i8 or f32, got ",
+                          et);
+    NODE_VALIDATION_CHECK(this,
+                          get_input_partial_shape(0).is_static() &&
+                              get_input_partial_shape(0).rank().get_length() == 4 &&
+                              m_output_shape.size() == 4,
+                          "Preprocess frames and output must be static 4D tensors");
+
+    const Shape& frame_shape = get_input_shape(0);
+    size_t channel_axis = m_channels_last ? 3 : 1;
+    size_t height_axis = m_channels_last ? 1 : 2;
+    size_t channels = frame_shape[channel_axis];
+    NODE_VALIDATION_CHECK(this,
+                          frame_shape[0] == m_output_shape[0] && channels == m_output_shape[1],
+                          "Preprocess output ",
+                          m_output_shape,
+                          " does not have the batch and channels of the frames ",
+                          frame_shape);
+    for (auto axis : m_resize_attrs.axes)
+    {
+        NODE_VALIDATION_CHECK(this,
+                              axis == height_axis || axis == height_axis + 1,
+                              "Preprocess only resizes the spatial axes");
+    }
+    if (m_resize_attrs.axes.empty())
+    {
+        NODE_VALIDATION_CHECK(this,
+                              frame_shape[height_axis] == m_output_shape[2] &&
+                                  frame_shape[height_axis + 1] == m_output_shape[3],
+                              "Preprocess output ",
+                              m_output_shape,
+                              " must have the spatial size of the frames when not resizing");
+    }
+    NODE_VALIDATION_CHECK(this,
+                          m_scale.size() == channels && m_shift.size() == channels,
+                          "Preprocess needs a scale and a shift per channel");
+
+    set_output_type(0, element::f32, m_output_shape);
+}
+
+shared_ptr<Node> op::Preprocess::clone_with_new_inputs(const OutputVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<Preprocess>(
+        new_args.at(0), m_channels_last, m_output_shape, m_resize_attrs, m_scale, m_shift);
+}
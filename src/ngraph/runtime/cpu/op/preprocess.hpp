@@ -0,0 +1,71 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#pragma once
+
+#include <vector>
+
+#include "ngraph/op/interpolate.hpp"
+#include "ngraph/op/op.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Turns u8, i8 or f32 frames into an f32 NCHW tensor in one pass: converts
+        ///        them to f32, resizes them, computes scale * x + shift per channel and
+        ///        transposes NHWC frames.
+        ///
+        /// The resize is skipped when the axes of resize_attrs are empty; otherwise they are
+        /// the spatial axes of the input. The output may have the channel blocked layout of the
+        /// convolution using it (see set_layouts_preprocess).
+        class Preprocess : public Op
+        {
+        public:
+            CPU_BACKEND_API
+            static constexpr NodeTypeInfo type_info{"Preprocess", 0};
+            const NodeTypeInfo& get_type_info() const override { return type_info; }
+            CPU_BACKEND_API Preprocess(const Output<Node>& frames,
+                                       bool channels_last,
+                                       const Shape& output_shape,
+                                       const op::v3::Interpolate::InterpolateAttrs& resize_attrs,
+                                       const std::vector<float>& scale,
+                                       const std::vector<float>& shift);
+
+            void validate_and_infer_types() override;
+
+            virtual std::shared_ptr<Node>
+                clone_with_new_inputs(const OutputVector& new_args) const override;
+
+            bool get_channels_last() const { return m_channels_last; }
+            const op::v3::Interpolate::InterpolateAttrs& get_resize_attrs() const
+            {
+                return m_resize_attrs;
+            }
+            const std::vector<float>& get_scale() const { return m_scale; }
+            const std::vector<float>& get_shift() const { return m_shift; }
+
+        protected:
+            bool m_channels_last;
+            Shape m_output_shape;
+            op::v3::Interpolate::InterpolateAttrs m_resize_attrs;
+            std::vector<float> m_scale;
+            std::vector<float> m_shift;
+        };
+    }
+}
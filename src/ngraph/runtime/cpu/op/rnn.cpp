@@ -115,9 +115,14 @@ op::Rnn::Rnn(const Output<Node>& src_layer,
         throw ngraph_error("src_layer size is not equal t*n*c");
     }
 
+    // The linear before reset GRU has one more bias, for the recurrent part of the candidate
+    size_t extra_bias_size =
+        m_rnntype == ngraph::runtime::cpu::rnn_utils::rnntype::lbr_gru ? m_dst_iter_feature_size
+                                                                        : 0;
     if ((bias.get_shape()[0] / (m_direction * m_num_fused_layers)) !=
-            (weights_layer.get_shape()[1]) ||
-        (bias.get_shape()[0] / (m_direction * m_num_fused_layers)) != (weights_iter.get_shape()[1]))
+            (weights_layer.get_shape()[1] + extra_bias_size) ||
+        (bias.get_shape()[0] / (m_direction * m_num_fused_layers)) !=
+            (weights_iter.get_shape()[1] + extra_bias_size))
     {
         throw ngraph_error("bias and weights_shape are not compatible");
     }
@@ -32,6 +32,9 @@ namespace ngraph
                 {
                     vanilla_rnn,
                     vanilla_gru,
+                    // GRU applying the reset gate after the recurrent linear transformation of
+                    // the candidate gate, which has a bias of its own
+                    lbr_gru,
                     vanilla_lstm
                 };
             }
@@ -0,0 +1,95 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/op/sparse_dot.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr NodeTypeInfo op::SparseDot::type_info;
+
+op::SparseDot::SparseDot(const Output<Node>& data,
+                         const Output<Node>& values,
+                         const Output<Node>& indices,
+                         const Output<Node>& offsets,
+                         const Shape& weights_shape,
+                         size_t block_width)
+    : Op({data, values, indices, offsets})
+    , m_weights_shape(weights_shape)
+    , m_block_width(block_width)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::SparseDot::validate_and_infer_types()
+{
+    NODE_VALIDATION_CHECK(this,
+                          m_weights_shape.size() == 2 && m_block_width > 0,
+                          "Unsupported sparse weights of shape ",
+                          m_weights_shape,
+                          " with blocks of ",
+                          m_block_width,
+                          " columns");
+    const PartialShape& values_shape = get_input_partial_shape(1);
+    const PartialShape& indices_shape = get_input_partial_shape(2);
+    PartialShape offsets_shape{static_cast<int64_t>(get_column_blocks() + 1)};
+    NODE_VALIDATION_CHECK(this,
+                          get_input_element_type(1) == element::f32 &&
+                              get_input_element_type(2) == element::i32 &&
+                              get_input_element_type(3) == element::i32,
+                          "Sparse weights must have f32 values and i32 indices and offsets");
+    NODE_VALIDATION_CHECK(
+        this,
+        values_shape.rank().compatible(1) && indices_shape.rank().compatible(1) &&
+            get_input_partial_shape(3).compatible(offsets_shape),
+        "Sparse weights do not match weights of shape ",
+        m_weights_shape);
+    if (values_shape.is_static() && indices_shape.is_static())
+    {
+        NODE_VALIDATION_CHECK(this,
+                              values_shape.to_shape()[0] ==
+                                  indices_shape.to_shape()[0] * m_block_width,
+                              "Sparse weights need ",
+                              m_block_width,
+                              " values per index");
+    }
+
+    const PartialShape& data_shape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(this,
+                          get_input_element_type(0) == element::f32 && data_shape.is_static() &&
+                              data_shape.rank().get_length() >= 1,
+                          "Data must be a static f32 tensor of rank 1 or more");
+    Shape output_shape = data_shape.to_shape();
+    NODE_VALIDATION_CHECK(this,
+                          output_shape.back() == m_weights_shape[0],
+                          "Data of shape ",
+                          output_shape,
+                          " does not match weights of shape ",
+                          m_weights_shape);
+    output_shape.back() = m_weights_shape[1];
+    set_output_type(0, element::f32, output_shape);
+}
+
+shared_ptr<Node> op::SparseDot::clone_with_new_inputs(const OutputVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<SparseDot>(new_args.at(0),
+                                  new_args.at(1),
+                                  new_args.at(2),
+                                  new_args.at(3),
+                                  m_weights_shape,
+                                  m_block_width);
+}
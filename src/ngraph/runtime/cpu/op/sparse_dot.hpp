@@ -0,0 +1,64 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/op/op.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Dot of data [..., k] and sparse weights [k, n].
+        ///
+        /// The weights are stored by blocks of `block_width` neighbouring output columns of
+        /// one input row. The column blocks are compressed like the rows of a CSR matrix:
+        /// `offsets` [n / block_width + 1] (i32) delimits the nonzero blocks of each column
+        /// block, `indices` (i32) holds their input rows and `values` their
+        /// `block_width` weights each. Columns past n in the last block are zeros.
+        class SparseDot : public Op
+        {
+        public:
+            CPU_BACKEND_API
+            static constexpr NodeTypeInfo type_info{"SparseDot", 0};
+            const NodeTypeInfo& get_type_info() const override { return type_info; }
+            CPU_BACKEND_API SparseDot(const Output<Node>& data,
+                                      const Output<Node>& values,
+                                      const Output<Node>& indices,
+                                      const Output<Node>& offsets,
+                                      const Shape& weights_shape,
+                                      size_t block_width);
+
+            void validate_and_infer_types() override;
+
+            virtual std::shared_ptr<Node>
+                clone_with_new_inputs(const OutputVector& new_args) const override;
+
+            const Shape& get_weights_shape() const { return m_weights_shape; }
+            size_t get_block_width() const { return m_block_width; }
+            /// \brief Number of column blocks, the last one possibly partial
+            size_t get_column_blocks() const
+            {
+                return (m_weights_shape[1] + m_block_width - 1) / m_block_width;
+            }
+
+        protected:
+            Shape m_weights_shape;
+            size_t m_block_width;
+        };
+    }
+}
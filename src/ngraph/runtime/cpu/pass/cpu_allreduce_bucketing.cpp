@@ -0,0 +1,152 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <map>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "ngraph/env_util.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/allreduce.hpp"
+#include "ngraph/runtime/cpu/op/allreduce_async.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_allreduce_bucketing.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::cpu::pass::CPUAllReduceBucketing::CPUAllReduceBucketing()
+    : m_bucket_bytes(25 << 20)
+{
+    int32_t bucket_bytes = getenv_int("NGRAPH_CPU_ALLREDUCE_BUCKET_BYTES");
+    if (bucket_bytes >= 0)
+    {
+        m_bucket_bytes = static_cast<size_t>(bucket_bytes);
+    }
+}
+
+bool runtime::cpu::pass::CPUAllReduceBucketing::run_on_function(shared_ptr<Function> function)
+{
+    // Position of every op in the schedule, and the reductions, each of which is
+    // schedulable as soon as its gradient is produced
+    unordered_map<const Node*, size_t> positions;
+    unordered_set<const Node*> after_reduction;
+    vector<shared_ptr<op::v0::AllReduce>> reductions;
+    size_t position = 0;
+    for (const shared_ptr<Node>& node : function->get_ordered_ops())
+    {
+        positions[node.get()] = position++;
+        bool reduced = false;
+        for (const Output<Node>& value : node->input_values())
+        {
+            reduced = reduced || after_reduction.count(value.get_node());
+        }
+        auto reduction = as_type_ptr<op::v0::AllReduce>(node);
+        if (reduction)
+        {
+            if (reduced)
+            {
+                // Bucketing a reduction with one it depends on would make a cycle
+                return false;
+            }
+            // Compressed reductions keep the rounding error of their gradient, so each stays
+            // on its own
+            if (reduction->get_input_partial_shape(0).is_static() &&
+                reduction->get_compression() == reduction::Compression::NONE &&
+                reduction->get_control_dependencies().empty() &&
+                reduction->get_control_dependents().empty())
+            {
+                reductions.push_back(reduction);
+            }
+        }
+        if (reduced || reduction)
+        {
+            after_reduction.insert(node.get());
+        }
+    }
+    if (reductions.empty())
+    {
+        return false;
+    }
+    stable_sort(reductions.begin(),
+                reductions.end(),
+                [&positions](const shared_ptr<op::v0::AllReduce>& r1,
+                             const shared_ptr<op::v0::AllReduce>& r2) {
+                    return positions.at(r1->get_input_node_ptr(0)) <
+                           positions.at(r2->get_input_node_ptr(0));
+                });
+
+    struct Bucket
+    {
+        vector<shared_ptr<op::v0::AllReduce>> reductions;
+        size_t bytes = 0;
+    };
+    // The buckets in the order their last gradient is produced
+    vector<Bucket> buckets;
+    // Index in buckets of the bucket being filled, by element type and reduction
+    map<pair<element::Type, reduction::Type>, size_t> open_buckets;
+    for (const shared_ptr<op::v0::AllReduce>& reduction : reductions)
+    {
+        auto key = make_pair(reduction->get_input_element_type(0), reduction->get_reduce_type());
+        size_t bytes = shape_size(reduction->get_input_shape(0)) * key.first.size();
+        auto it = open_buckets.find(key);
+        if (it != open_buckets.end() && buckets[it->second].bytes + bytes > m_bucket_bytes)
+        {
+            open_buckets.erase(it);
+            it = open_buckets.end();
+        }
+        if (it == open_buckets.end())
+        {
+            it = open_buckets.emplace(key, buckets.size()).first;
+            buckets.emplace_back();
+        }
+        buckets[it->second].reductions.push_back(reduction);
+        buckets[it->second].bytes += bytes;
+    }
+    stable_sort(buckets.begin(), buckets.end(), [&positions](const Bucket& b1, const Bucket& b2) {
+        return positions.at(b1.reductions.back()->get_input_node_ptr(0)) <
+               positions.at(b2.reductions.back()->get_input_node_ptr(0));
+    });
+
+    vector<shared_ptr<Node>> starts;
+    vector<shared_ptr<Node>> waits;
+    for (const Bucket& bucket : buckets)
+    {
+        OutputVector gradients;
+        for (const shared_ptr<op::v0::AllReduce>& reduction : bucket.reductions)
+        {
+            gradients.push_back(reduction->input_value(0));
+        }
+        auto start =
+            make_shared<op::AllReduceStart>(gradients, bucket.reductions[0]->get_reduce_type());
+        auto wait = make_shared<op::AllReduceWait>(start);
+        if (!starts.empty())
+        {
+            start->add_control_dependency(starts.back());
+        }
+        for (size_t i = 0; i < bucket.reductions.size(); i++)
+        {
+            replace_node(bucket.reductions[i], OutputVector{wait->output(i)});
+        }
+        starts.push_back(start);
+        waits.push_back(wait);
+    }
+    for (const shared_ptr<Node>& wait : waits)
+    {
+        wait->add_control_dependency(starts.back());
+    }
+    return true;
+}
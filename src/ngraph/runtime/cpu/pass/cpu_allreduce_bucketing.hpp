@@ -0,0 +1,58 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+
+#include "ngraph/pass/pass.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace pass
+            {
+                /// \brief Replaces the AllReduces of the gradients with AllReduceStarts of
+                ///        buckets of them and AllReduceWaits, so the reduction of a bucket
+                ///        overlaps with the backprop of the gradients still to come.
+                ///
+                /// The gradients are bucketed in the order they are produced, up to
+                /// bucket_bytes a bucket, by element type and by reduction. Every start runs
+                /// after the one before it and once all the gradients of its bucket are
+                /// produced; every wait runs after the last start. bucket_bytes defaults to
+                /// NGRAPH_CPU_ALLREDUCE_BUCKET_BYTES, else 25MiB. The pass leaves the graph
+                /// alone when a reduction depends on another one.
+                class CPU_BACKEND_API CPUAllReduceBucketing : public ngraph::pass::FunctionPass
+                {
+                public:
+                    CPUAllReduceBucketing();
+                    CPUAllReduceBucketing(size_t bucket_bytes)
+                        : m_bucket_bytes(bucket_bytes)
+                    {
+                    }
+                    bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+
+                private:
+                    size_t m_bucket_bytes;
+                };
+            }
+        }
+    }
+}
@@ -34,11 +34,13 @@
 #include "ngraph/op/convert.hpp"
 #include "ngraph/op/convolution.hpp"
 #include "ngraph/op/dequantize.hpp"
+#include "ngraph/op/exp.hpp"
 #include "ngraph/op/experimental/quantized_conv_bias.hpp"
 #include "ngraph/op/experimental/quantized_conv_relu.hpp"
 #include "ngraph/op/experimental/quantized_dot_bias.hpp"
 #include "ngraph/op/gelu.hpp"
 #include "ngraph/op/group_conv.hpp"
+#include "ngraph/op/log.hpp"
 #include "ngraph/op/lrn.hpp"
 #include "ngraph/op/max_pool.hpp"
 #include "ngraph/op/quantize.hpp"
@@ -46,9 +48,14 @@
 #include "ngraph/op/relu.hpp"
 #include "ngraph/op/replace_slice.hpp"
 #include "ngraph/op/scatter_add.hpp"
+#include "ngraph/op/scatter_elements_update.hpp"
+#include "ngraph/op/scatter_nd.hpp"
+#include "ngraph/op/scatter_update.hpp"
 #include "ngraph/op/sigmoid.hpp"
 #include "ngraph/op/slice.hpp"
 #include "ngraph/op/softmax.hpp"
+#include "ngraph/op/sqrt.hpp"
+#include "ngraph/op/tanh.hpp"
 #include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
 #include "ngraph/runtime/cpu/dnnl_utils.hpp"
 #include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
@@ -56,13 +63,16 @@
 #include "ngraph/runtime/cpu/op/conv_add.hpp"
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
 #include "ngraph/runtime/cpu/op/deconv.hpp"
+#include "ngraph/runtime/cpu/op/elementwise_chain.hpp"
 #include "ngraph/runtime/cpu/op/gelu_backprop.hpp"
 #include "ngraph/runtime/cpu/op/group_conv_bias.hpp"
 #include "ngraph/runtime/cpu/op/leaky_relu.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/max_pool_with_indices.hpp"
+#include "ngraph/runtime/cpu/op/optimizer_update.hpp"
 #include "ngraph/runtime/cpu/op/quantized_matmul.hpp"
 #include "ngraph/runtime/cpu/op/rnn.hpp"
+#include "ngraph/runtime/cpu/op/transfer_async.hpp"
 #include "ngraph/runtime/cpu/op/update_slice.hpp"
 
 using namespace std;
@@ -537,6 +547,72 @@ namespace ngraph
                     scatter_add->set_op_annotations(op_annotations);
                 }
 
+                // The update scatters write their output in place of the data when it dies
+                // with them
+                static void assign_scatter_update(Node* node)
+                {
+                    auto op_annotations =
+                        std::make_shared<ngraph::runtime::cpu::CPUOpAnnotations>();
+                    if (get_user_count(node->input_value(0)) == 1)
+                    {
+                        // Safe to overwrite input
+                        op_annotations->add_in_place_oi_pair({0, 0, true});
+                    }
+                    static_cast<ngraph::op::Op*>(node)->set_op_annotations(op_annotations);
+                }
+
+                // The optimizer updates write the new weights and state in place of the old
+                // ones when those die with them
+                static void assign_optimizer_update(Node* node, size_t tensors)
+                {
+                    auto op_annotations =
+                        std::make_shared<ngraph::runtime::cpu::CPUOpAnnotations>();
+                    for (size_t i = 0; i < tensors; i++)
+                    {
+                        if (get_user_count(node->input_value(i)) == 1)
+                        {
+                            // Safe to overwrite input
+                            op_annotations->add_in_place_oi_pair({i, i, true});
+                        }
+                    }
+                    static_cast<ngraph::op::Op*>(node)->set_op_annotations(op_annotations);
+                }
+
+                template <>
+                void CPUAssignment::ASSIGN_DECL(ngraph::op::SGDMomentumUpdate)
+                {
+                    (void)external_function;
+                    assign_optimizer_update(node, 2);
+                }
+
+                template <>
+                void CPUAssignment::ASSIGN_DECL(ngraph::op::AdamUpdate)
+                {
+                    (void)external_function;
+                    assign_optimizer_update(node, 3);
+                }
+
+                template <>
+                void CPUAssignment::ASSIGN_DECL(ngraph::op::v3::ScatterUpdate)
+                {
+                    (void)external_function;
+                    assign_scatter_update(node);
+                }
+
+                template <>
+                void CPUAssignment::ASSIGN_DECL(ngraph::op::v3::ScatterElementsUpdate)
+                {
+                    (void)external_function;
+                    assign_scatter_update(node);
+                }
+
+                template <>
+                void CPUAssignment::ASSIGN_DECL(ngraph::op::v0::ScatterND)
+                {
+                    (void)external_function;
+                    assign_scatter_update(node);
+                }
+
                 template <>
                 void CPUAssignment::ASSIGN_DECL(ngraph::op::v0::LRN)
                 {
@@ -564,6 +640,47 @@ namespace ngraph
                     }
                 }
 
+                // The eltwise primitives are built by the DEX builders only
+                static void assign_dnnl_eltwise(CPU_ExternalFunction* external_function,
+                                                ngraph::Node* node)
+                {
+                    if (external_function->is_direct_execution() &&
+                        runtime::cpu::dnnl_utils::use_dnnl_eltwise(node))
+                    {
+                        runtime::cpu::dnnl_utils::assign_dnnl_kernel(node);
+                    }
+                }
+
+                template <>
+                void CPUAssignment::ASSIGN_DECL(ngraph::op::v0::Exp)
+                {
+                    assign_dnnl_eltwise(external_function, node);
+                }
+
+                template <>
+                void CPUAssignment::ASSIGN_DECL(ngraph::op::v0::Gelu)
+                {
+                    assign_dnnl_eltwise(external_function, node);
+                }
+
+                template <>
+                void CPUAssignment::ASSIGN_DECL(ngraph::op::v0::Log)
+                {
+                    assign_dnnl_eltwise(external_function, node);
+                }
+
+                template <>
+                void CPUAssignment::ASSIGN_DECL(ngraph::op::v0::Sqrt)
+                {
+                    assign_dnnl_eltwise(external_function, node);
+                }
+
+                template <>
+                void CPUAssignment::ASSIGN_DECL(ngraph::op::v0::Tanh)
+                {
+                    assign_dnnl_eltwise(external_function, node);
+                }
+
                 template <>
                 void CPUAssignment::ASSIGN_DECL(ngraph::op::v0::SigmoidBackprop)
                 {
@@ -660,7 +777,11 @@ namespace ngraph
                             runtime::cpu::dnnl_utils::assign_dnnl_kernel(node);
                         }
                     }
-                    else if (rnn_op->is_type(ngraph::runtime::cpu::rnn_utils::rnntype::vanilla_rnn))
+                    else if (rnn_op->is_type(
+                                 ngraph::runtime::cpu::rnn_utils::rnntype::vanilla_rnn) ||
+                             rnn_op->is_type(
+                                 ngraph::runtime::cpu::rnn_utils::rnntype::vanilla_gru) ||
+                             rnn_op->is_type(ngraph::runtime::cpu::rnn_utils::rnntype::lbr_gru))
                     {
                         auto weights_layer_rank = node->get_input_shape(2).size();
                         auto weights_iter_rank = node->get_input_shape(3).size();
@@ -730,27 +851,6 @@ namespace ngraph
                     }
                 }
 
-                template <>
-                void CPUAssignment::ASSIGN_DECL(ngraph::op::v0::Gelu)
-                {
-                    (void)external_function;
-                    auto gelu = static_cast<ngraph::op::v0::Gelu*>(node);
-
-                    if (node->get_input_element_type(0) == element::f32)
-                    {
-                        auto op_annotations =
-                            std::make_shared<ngraph::runtime::cpu::CPUOpAnnotations>();
-                        op_annotations->set_dnnl_op(true);
-                        runtime::cpu::dnnl_utils::assign_dnnl_kernel(node);
-                        if (get_user_count(node->input_value(0)) == 1)
-                        {
-                            // Safe to overwrite input
-                            op_annotations->add_in_place_oi_pair({0, 0, true});
-                        }
-                        gelu->set_op_annotations(op_annotations);
-                    }
-                }
-
                 template <>
                 void CPUAssignment::ASSIGN_DECL(ngraph::op::GeluBackprop)
                 {
@@ -996,6 +1096,18 @@ namespace ngraph
                         convert->set_op_annotations(op_annotations);
                     }
                 }
+
+                template <>
+                void CPUAssignment::ASSIGN_DECL(ngraph::op::SendStart)
+                {
+                    (void)external_function;
+                    auto send = static_cast<ngraph::op::SendStart*>(node);
+                    // The send streams its input from where it is
+                    auto op_annotations =
+                        std::make_shared<ngraph::runtime::cpu::CPUOpAnnotations>();
+                    op_annotations->add_in_place_oi_pair({0, 0, false});
+                    send->set_op_annotations(op_annotations);
+                }
             }
         }
     }
@@ -1060,6 +1172,11 @@ static const runtime::cpu::pass::AssignOpMap s_dispatcher{
      &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::CPULeakyRelu>},
     {TI(ngraph::op::v0::Sigmoid),
      &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::v0::Sigmoid>},
+    {TI(ngraph::op::v0::Exp), &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::v0::Exp>},
+    {TI(ngraph::op::v0::Gelu), &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::v0::Gelu>},
+    {TI(ngraph::op::v0::Log), &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::v0::Log>},
+    {TI(ngraph::op::v0::Sqrt), &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::v0::Sqrt>},
+    {TI(ngraph::op::v0::Tanh), &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::v0::Tanh>},
     {TI(ngraph::op::v0::SigmoidBackprop),
      &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::v0::SigmoidBackprop>},
     {TI(ngraph::op::Lstm), &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::Lstm>},
@@ -1095,11 +1212,65 @@ static const runtime::cpu::pass::AssignOpMap s_dispatcher{
      &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::DeconvolutionBias>},
     {TI(ngraph::op::v0::ScatterAdd),
      &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::v0::ScatterAdd>},
-    {TI(ngraph::op::v0::Gelu), &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::v0::Gelu>},
+    {TI(ngraph::op::v3::ScatterUpdate),
+     &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::v3::ScatterUpdate>},
+    {TI(ngraph::op::v3::ScatterElementsUpdate),
+     &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::v3::ScatterElementsUpdate>},
+    {TI(ngraph::op::v0::ScatterND),
+     &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::v0::ScatterND>},
     {TI(ngraph::op::GeluBackprop),
      &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::GeluBackprop>},
+    {TI(ngraph::op::SendStart), &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::SendStart>},
+    {TI(ngraph::op::SGDMomentumUpdate),
+     &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::SGDMomentumUpdate>},
+    {TI(ngraph::op::AdamUpdate),
+     &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::AdamUpdate>},
 };
 
+// Elementwise arithmetic, which covers the Add accumulations and most of the elementwise ops
+// of backprop graphs, reads each element before it writes the same element of the output, and
+// so do the fused chains of them, so the output can overwrite any input of its shape and type.
+// The pairs are only candidates: CPUMemoryAssignment turns one into an in-place pair where
+// liveness shows that the input dies at the op and that it is neither a function input nor a
+// constant.
+static void assign_elementwise_in_place(Node* node)
+{
+    if (!node->is_unary_elementwise_arithmetic() && !node->is_binary_elementwise_arithmetic() &&
+        !is_type<ngraph::op::ElementwiseChain>(node))
+    {
+        return;
+    }
+    if (node->get_output_size() != 1 || node->get_output_partial_shape(0).is_dynamic())
+    {
+        return;
+    }
+    auto op = static_cast<ngraph::op::Op*>(node);
+    auto op_annotations =
+        std::static_pointer_cast<runtime::cpu::CPUOpAnnotations>(op->get_op_annotations());
+    if (op_annotations && !op_annotations->get_in_place_oi_pairs().empty())
+    {
+        return;
+    }
+    // DNNL only computes the eltwise and sum primitives in place of their first source
+    size_t inputs = (op_annotations && op_annotations->is_dnnl_op()) ? 1 : node->get_input_size();
+    for (size_t i = 0; i < inputs; i++)
+    {
+        if (node->get_input_element_type(i) != node->get_output_element_type(0) ||
+            node->get_input_partial_shape(i).is_dynamic() ||
+            node->get_input_shape(i) != node->get_output_shape(0) ||
+            get_user_count(node->input_value(i)) != 1)
+        {
+            continue;
+        }
+        if (!op_annotations)
+        {
+            op_annotations = std::make_shared<ngraph::runtime::cpu::CPUOpAnnotations>();
+            op->set_op_annotations(op_annotations);
+        }
+        op_annotations->add_in_place_candidate({0, i, true});
+    }
+}
+
 bool runtime::cpu::pass::CPUAssignment::run_on_call_graph(
     const std::list<std::shared_ptr<Node>>& nodes)
 {
@@ -1111,6 +1282,7 @@ bool runtime::cpu::pass::CPUAssignment::run_on_call_graph(
         {
             handler->second(m_external_function, node.get());
         }
+        assign_elementwise_in_place(node.get());
     }
 
     return false;
@@ -0,0 +1,162 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <unordered_set>
+#include <utility>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/recv.hpp"
+#include "ngraph/op/send.hpp"
+#include "ngraph/runtime/cpu/op/transfer_async.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_async_transfers.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    // node and every node it depends on, through its arguments or its control dependencies
+    unordered_set<Node*> get_ancestors(Node* node)
+    {
+        unordered_set<Node*> ancestors{node};
+        vector<Node*> stack{node};
+        while (!stack.empty())
+        {
+            Node* n = stack.back();
+            stack.pop_back();
+            vector<Node*> predecessors;
+            for (const Output<Node>& value : n->input_values())
+            {
+                predecessors.push_back(value.get_node());
+            }
+            for (const shared_ptr<Node>& dependency : n->get_control_dependencies())
+            {
+                predecessors.push_back(dependency.get());
+            }
+            for (Node* predecessor : predecessors)
+            {
+                if (ancestors.insert(predecessor).second)
+                {
+                    stack.push_back(predecessor);
+                }
+            }
+        }
+        return ancestors;
+    }
+
+    // node and every node which depends on it
+    unordered_set<Node*> get_descendants(Node* node)
+    {
+        unordered_set<Node*> descendants{node};
+        vector<Node*> stack{node};
+        while (!stack.empty())
+        {
+            Node* n = stack.back();
+            stack.pop_back();
+            vector<Node*> successors;
+            for (const shared_ptr<Node>& user : n->get_users())
+            {
+                successors.push_back(user.get());
+            }
+            for (Node* dependent : n->get_control_dependents())
+            {
+                successors.push_back(dependent);
+            }
+            for (Node* successor : successors)
+            {
+                if (descendants.insert(successor).second)
+                {
+                    stack.push_back(successor);
+                }
+            }
+        }
+        return descendants;
+    }
+}
+
+bool runtime::cpu::pass::CPUAsyncTransfers::run_on_function(shared_ptr<Function> function)
+{
+    vector<pair<shared_ptr<Node>, shared_ptr<Node>>> transfers;
+    for (const shared_ptr<Node>& node : function->get_ordered_ops())
+    {
+        shared_ptr<Node> start;
+        if (auto send = as_type_ptr<op::v0::Send>(node))
+        {
+            start = make_shared<op::SendStart>(send->input_value(0), send->get_dest_id());
+        }
+        else if (auto recv = as_type_ptr<op::v0::Recv>(node))
+        {
+            start = make_shared<op::RecvStart>(recv->input_value(0), recv->get_src_id());
+        }
+        else
+        {
+            continue;
+        }
+        auto wait = make_shared<op::TransferWait>(start);
+        start->add_node_control_dependencies(node);
+        replace_node(node, wait);
+        transfers.emplace_back(start, wait);
+    }
+
+    for (const pair<shared_ptr<Node>, shared_ptr<Node>>& transfer : transfers)
+    {
+        // With the dependencies the transfers before this one were given
+        unordered_set<Node*> before = get_ancestors(transfer.first.get());
+        unordered_set<Node*> after = get_descendants(transfer.second.get());
+        unordered_set<Node*> independent;
+        vector<shared_ptr<Node>> independent_ops;
+        for (const shared_ptr<Node>& node : function->get_ordered_ops())
+        {
+            if (!before.count(node.get()) && !after.count(node.get()) && node->is_op() &&
+                !node->is_parameter() && !node->is_constant() && !node->is_output())
+            {
+                independent.insert(node.get());
+                independent_ops.push_back(node);
+            }
+        }
+        // Ordering the first and the last of the independent ops orders all of them
+        for (const shared_ptr<Node>& node : independent_ops)
+        {
+            bool first = true;
+            for (const Output<Node>& value : node->input_values())
+            {
+                first = first && !independent.count(value.get_node());
+            }
+            for (const shared_ptr<Node>& dependency : node->get_control_dependencies())
+            {
+                first = first && !independent.count(dependency.get());
+            }
+            bool last = true;
+            for (const shared_ptr<Node>& user : node->get_users())
+            {
+                last = last && !independent.count(user.get());
+            }
+            for (Node* dependent : node->get_control_dependents())
+            {
+                last = last && !independent.count(dependent);
+            }
+            if (first)
+            {
+                node->add_control_dependency(transfer.first);
+            }
+            if (last)
+            {
+                transfer.second->add_control_dependency(node);
+            }
+        }
+    }
+    return !transfers.empty();
+}
@@ -0,0 +1,218 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/pass/cpu_attention_fusion.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/matmul.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/softmax.hpp"
+#include "ngraph/runtime/cpu/op/attention.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// The value of a Constant of identical f32 elements, possibly broadcast by a v0 Broadcast
+static bool get_scalar_value(const Output<Node>& output, float& value)
+{
+    auto node = output.get_node_shared_ptr();
+    if (auto broadcast = as_type_ptr<op::v0::Broadcast>(node))
+    {
+        node = broadcast->get_input_node_shared_ptr(0);
+    }
+    auto constant = as_type_ptr<op::v0::Constant>(node);
+    if (!constant || constant->get_output_element_type(0) != element::f32 ||
+        shape_size(constant->get_output_shape(0)) == 0 ||
+        !constant->get_all_data_elements_bitwise_identical())
+    {
+        return false;
+    }
+    value = constant->get_data_ptr<float>()[0];
+    return true;
+}
+
+// The only user of the output of node is the node being fused
+static bool has_single_user(const shared_ptr<Node>& node)
+{
+    return node->get_output_size() == 1 && node->get_users().size() == 1;
+}
+
+static bool is_last_axis_softmax(const shared_ptr<Node>& node)
+{
+    auto rank = node->get_output_partial_shape(0).rank();
+    if (rank.is_dynamic())
+    {
+        return false;
+    }
+    size_t last_axis = static_cast<size_t>(rank.get_length()) - 1;
+    if (auto softmax = as_type_ptr<op::v1::Softmax>(node))
+    {
+        return softmax->get_axis() == last_axis;
+    }
+    if (auto softmax = as_type_ptr<op::v0::Softmax>(node))
+    {
+        return softmax->are_axes_constant() && softmax->get_axes() == AxisSet{last_axis};
+    }
+    return false;
+}
+
+// Matches scores * scale or scores / scale, returning the scores and the scale
+static bool match_scale(const shared_ptr<Node>& node, Output<Node>& scores, float& scale)
+{
+    float value;
+    auto& output_shape = node->get_output_partial_shape(0);
+    if (is_type<op::v1::Multiply>(node))
+    {
+        for (size_t i = 0; i < 2; i++)
+        {
+            if (get_scalar_value(node->input_value(1 - i), value) &&
+                node->get_input_partial_shape(i) == output_shape)
+            {
+                scores = node->input_value(i);
+                scale = value;
+                return true;
+            }
+        }
+    }
+    else if (is_type<op::v1::Divide>(node))
+    {
+        if (get_scalar_value(node->input_value(1), value) && value != 0 &&
+            node->get_input_partial_shape(0) == output_shape)
+        {
+            scores = node->input_value(0);
+            scale = 1.0f / value;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Whether query, key and value are static f32 tensors of the same rank and leading axes, as
+// ScaledDotProductAttention takes them; the MatMuls have checked the other axes and the Add
+// that the mask broadcasts to the scores
+static bool are_attention_inputs(const OutputVector& inputs)
+{
+    for (auto& input : inputs)
+    {
+        if (input.get_element_type() != element::f32 || input.get_partial_shape().is_dynamic())
+        {
+            return false;
+        }
+    }
+    const Shape& query_shape = inputs[0].get_shape();
+    size_t rank = query_shape.size();
+    for (size_t i = 1; i < 3; i++)
+    {
+        const Shape& shape = inputs[i].get_shape();
+        if (rank < 2 || shape.size() != rank ||
+            !equal(query_shape.begin(), query_shape.end() - 2, shape.begin()))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool runtime::cpu::pass::CPUAttentionFusion::run_on_function(shared_ptr<Function> function)
+{
+    bool modified = false;
+    for (auto& node : function->get_ordered_ops())
+    {
+        auto context = as_type_ptr<op::v0::MatMul>(node);
+        if (!context || context->get_transpose_a() || context->get_transpose_b())
+        {
+            continue;
+        }
+        auto softmax = context->get_input_node_shared_ptr(0);
+        if (!is_last_axis_softmax(softmax) || !has_single_user(softmax))
+        {
+            continue;
+        }
+
+        // Optional mask and scale in front of the softmax
+        Output<Node> scores = softmax->input_value(0);
+        Output<Node> mask;
+        float scale = 1.0f;
+        auto add = as_type_ptr<op::v1::Add>(scores.get_node_shared_ptr());
+        if (add && has_single_user(add) && add->get_autob().m_type != op::AutoBroadcastType::PDPD)
+        {
+            for (size_t i = 0; i < 2; i++)
+            {
+                auto operand = add->input_value(i);
+                auto operand_node = operand.get_node_shared_ptr();
+                Output<Node> scaled;
+                float value;
+                bool is_scores = is_type<op::v0::MatMul>(operand_node) ||
+                                 (match_scale(operand_node, scaled, value) &&
+                                  is_type<op::v0::MatMul>(scaled.get_node_shared_ptr()));
+                if (is_scores && operand.get_partial_shape() == add->get_output_partial_shape(0))
+                {
+                    scores = operand;
+                    mask = add->input_value(1 - i);
+                    break;
+                }
+            }
+            if (!mask.get_node())
+            {
+                continue;
+            }
+        }
+        auto scores_node = scores.get_node_shared_ptr();
+        if (!is_type<op::v0::MatMul>(scores_node) && has_single_user(scores_node) &&
+            match_scale(scores_node, scores, scale))
+        {
+            scores_node = scores.get_node_shared_ptr();
+        }
+
+        auto product = as_type_ptr<op::v0::MatMul>(scores_node);
+        if (!product || product->get_transpose_a() || !has_single_user(product))
+        {
+            continue;
+        }
+        OutputVector inputs{
+            product->input_value(0), product->input_value(1), context->input_value(1)};
+        if (mask.get_node())
+        {
+            inputs.push_back(mask);
+        }
+        if (!are_attention_inputs(inputs))
+        {
+            continue;
+        }
+
+        shared_ptr<Node> attention;
+        if (mask.get_node())
+        {
+            attention = make_shared<op::ScaledDotProductAttention>(
+                inputs[0], inputs[1], inputs[2], inputs[3], scale, product->get_transpose_b());
+        }
+        else
+        {
+            attention = make_shared<op::ScaledDotProductAttention>(
+                inputs[0], inputs[1], inputs[2], scale, product->get_transpose_b());
+        }
+        if (attention->get_output_shape(0) != context->get_output_shape(0))
+        {
+            continue;
+        }
+        replace_node(context, attention);
+        modified = true;
+    }
+    return modified;
+}
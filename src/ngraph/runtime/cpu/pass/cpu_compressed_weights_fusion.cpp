@@ -0,0 +1,87 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/pass/cpu_compressed_weights_fusion.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/embedding_lookup.hpp"
+#include "ngraph/op/experimental/decompress_weights.hpp"
+#include "ngraph/runtime/cpu/op/compressed_weights.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+bool runtime::cpu::pass::CPUCompressedWeightsFusion::run_on_function(shared_ptr<Function> function)
+{
+    bool modified = false;
+    for (auto& node : function->get_ordered_ops())
+    {
+        bool is_dot = is_type<ngraph::op::v0::Dot>(node);
+        if (!is_dot && !is_type<ngraph::op::v0::EmbeddingLookup>(node))
+        {
+            continue;
+        }
+        auto decompress =
+            as_type_ptr<ngraph::op::v0::DecompressWeights>(node->get_input_node_shared_ptr(1));
+        if (!decompress || decompress->get_weights_shape().size() != 2 ||
+            !decompress->get_input_node_ptr(0)->is_constant() ||
+            !decompress->get_input_node_ptr(1)->is_constant())
+        {
+            continue;
+        }
+
+        auto data = node->input_value(0);
+        auto packed = decompress->input_value(0);
+        auto scales = decompress->input_value(1);
+        shared_ptr<Node> replacement;
+        if (is_dot)
+        {
+            auto dot = static_pointer_cast<ngraph::op::v0::Dot>(node);
+            if (dot->get_reduction_axes_count() != 1 ||
+                data.get_element_type() != element::f32 || data.get_partial_shape().is_dynamic())
+            {
+                continue;
+            }
+            replacement = make_shared<ngraph::op::CompressedDot>(data,
+                                                                 packed,
+                                                                 scales,
+                                                                 decompress->get_weights_shape(),
+                                                                 decompress->get_axis(),
+                                                                 decompress->get_bits());
+        }
+        else
+        {
+            auto index_type = data.get_element_type();
+            if ((index_type != element::f32 && index_type != element::i32 &&
+                 index_type != element::i64) ||
+                data.get_partial_shape().is_dynamic())
+            {
+                continue;
+            }
+            replacement =
+                make_shared<ngraph::op::CompressedEmbeddingLookup>(data,
+                                                                   packed,
+                                                                   scales,
+                                                                   decompress->get_weights_shape(),
+                                                                   decompress->get_axis(),
+                                                                   decompress->get_bits());
+        }
+        replace_node(node, replacement);
+        modified = true;
+    }
+    return modified;
+}
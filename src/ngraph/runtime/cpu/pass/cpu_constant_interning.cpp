@@ -0,0 +1,52 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/pass/cpu_constant_interning.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/pass/pass_util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+bool runtime::cpu::pass::CPUConstantInterning::run_on_function(shared_ptr<Function> function)
+{
+    bool replaced = false;
+    for (auto& node : function->get_ordered_ops())
+    {
+        auto constant = as_type_ptr<op::v0::Constant>(node);
+        // Only the unpadded part of a padded DNNL layout is hashed and compared, so constants
+        // in such layouts keep their own buffer
+        if (!constant ||
+            constant->get_output_tensor(0).size() != ngraph::pass::constant_byte_size(*constant))
+        {
+            continue;
+        }
+        auto interned = m_store->intern(constant);
+        if (interned != constant)
+        {
+            // Keep the layout CPULayout assigned, which may be a DNNL one
+            auto& tensor = constant->get_output_tensor(0);
+            if (tensor.get_tensor_layout())
+            {
+                interned->get_output_tensor(0).set_tensor_layout(tensor.get_tensor_layout());
+            }
+            replace_node(constant, interned);
+            replaced = true;
+        }
+    }
+    return replaced;
+}
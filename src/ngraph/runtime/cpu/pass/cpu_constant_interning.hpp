@@ -0,0 +1,51 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+
+#include "ngraph/pass/pass.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+#include "ngraph/runtime/cpu/cpu_constant_store.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace pass
+            {
+                /// \brief Replaces every constant with one sharing its data with identical
+                ///        constants of other functions through a CPUConstantStore. Runs after
+                ///        layout constant folding so the reordered weights are shared as well.
+                class CPU_BACKEND_API CPUConstantInterning : public ngraph::pass::FunctionPass
+                {
+                public:
+                    CPUConstantInterning(std::shared_ptr<CPUConstantStore> store)
+                        : m_store(store)
+                    {
+                    }
+                    bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+
+                private:
+                    std::shared_ptr<CPUConstantStore> m_store;
+                };
+            }
+        }
+    }
+}
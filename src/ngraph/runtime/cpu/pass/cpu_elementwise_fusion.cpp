@@ -0,0 +1,148 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <map>
+#include <unordered_map>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/runtime/cpu/op/elementwise_chain.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_elementwise_fusion.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static bool is_fusible(const Node& node)
+{
+    ngraph::op::ElementwiseChain::OpType type;
+    if (!ngraph::op::ElementwiseChain::get_op_type(node, type) || node.get_output_size() != 1 ||
+        !node.get_control_dependencies().empty() || !node.get_control_dependents().empty())
+    {
+        return false;
+    }
+    auto et = node.get_output_element_type(0);
+    if ((et != element::f32 && et != element::f64) || node.get_output_partial_shape(0).is_dynamic())
+    {
+        return false;
+    }
+    for (auto& input : node.inputs())
+    {
+        if (input.get_element_type() != et || input.get_partial_shape().is_dynamic() ||
+            input.get_shape() != node.get_output_shape(0))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// True if every user of the output of `producer` is `consumer`
+static bool only_feeds(Node* producer, Node* consumer)
+{
+    for (auto& input : producer->output(0).get_target_inputs())
+    {
+        if (input.get_node() != consumer)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool runtime::cpu::pass::CPUElementwiseFusion::run_on_function(shared_ptr<Function> function)
+{
+    // Groups of fusible nodes, keyed by the node computing the group's result and listed in
+    // topological order. Only the result of a group has users outside of it, so each group is a
+    // tree and fusing it cannot create a cycle.
+    unordered_map<Node*, NodeVector> groups;
+    NodeVector roots;
+    for (auto& node : function->get_ordered_ops())
+    {
+        if (!is_fusible(*node))
+        {
+            continue;
+        }
+        NodeVector members;
+        for (auto& input : node->inputs())
+        {
+            auto producer = input.get_source_output().get_node();
+            auto it = groups.find(producer);
+            if (it != groups.end() && only_feeds(producer, node.get()))
+            {
+                members.insert(members.end(), it->second.begin(), it->second.end());
+                groups.erase(it);
+            }
+        }
+        members.push_back(node);
+        groups[node.get()] = members;
+        roots.push_back(node);
+    }
+
+    bool replaced = false;
+    for (auto& root : roots)
+    {
+        auto it = groups.find(root.get());
+        if (it == groups.end() || it->second.size() < 2)
+        {
+            continue;
+        }
+        const NodeVector& members = it->second;
+
+        map<Node*, size_t> step_index;
+        for (size_t i = 0; i < members.size(); i++)
+        {
+            step_index[members[i].get()] = i;
+        }
+
+        // Values computed outside of the group become the inputs of the chain
+        OutputVector args;
+        map<Output<Node>, size_t> arg_index;
+        for (auto& member : members)
+        {
+            for (auto& input : member->inputs())
+            {
+                auto source = input.get_source_output();
+                if (step_index.count(source.get_node()) == 0 && arg_index.count(source) == 0)
+                {
+                    arg_index[source] = args.size();
+                    args.push_back(source);
+                }
+            }
+        }
+
+        vector<ngraph::op::ElementwiseChain::Step> steps;
+        for (auto& member : members)
+        {
+            ngraph::op::ElementwiseChain::Step step;
+            ngraph::op::ElementwiseChain::get_op_type(*member, step.type);
+            for (auto& input : member->inputs())
+            {
+                auto source = input.get_source_output();
+                auto sit = step_index.find(source.get_node());
+                step.operands.push_back(sit == step_index.end() ? arg_index.at(source)
+                                                                : args.size() + sit->second);
+            }
+            steps.push_back(step);
+        }
+
+        NGRAPH_DEBUG << "CPUElementwiseFusion: fusing " << members.size() << " ops into "
+                     << root->get_name();
+        auto chain = make_shared<ngraph::op::ElementwiseChain>(args, steps);
+        replace_node(root, chain);
+        replaced = true;
+    }
+    return replaced;
+}
@@ -183,6 +183,198 @@ void ngraph::runtime::cpu::pass::CPUFusion::construct_matmulbias()
     this->add_matcher(m, callback);
 }
 
+// Returns the per-column values of `node`, a broadcast to the {rows, columns} output of a
+// MatmulBias, as a {columns} vector; an empty Output if `node` varies along the rows
+static ngraph::Output<ngraph::Node> get_matmul_column_values(const ngraph::Output<ngraph::Node>& node)
+{
+    using namespace ngraph;
+
+    auto bcast = as_type_ptr<op::v0::Broadcast>(node.get_node_shared_ptr());
+    if (!bcast || bcast->get_output_shape(0).size() != 2)
+    {
+        return Output<Node>();
+    }
+
+    auto columns = bcast->get_output_shape(0)[1];
+    auto arg = bcast->input_value(0);
+    if (bcast->get_broadcast_axes() == AxisSet{0} && arg.get_shape() == Shape{columns})
+    {
+        return arg;
+    }
+    if (shape_size(arg.get_shape()) == 1)
+    {
+        if (arg.get_shape().size() != 0)
+        {
+            arg = std::make_shared<op::v0::Reshape>(
+                arg, get_default_order(arg.get_shape()), Shape{});
+        }
+        return std::make_shared<op::v0::Broadcast>(arg, Shape{columns}, AxisSet{0});
+    }
+    return Output<Node>();
+}
+
+// Folds `mmb * scale + shift`, with scale and shift given per output column, into the weights
+// and bias of `mmb`. Either of scale and shift may be empty. Returns nullptr if `mmb` can't
+// absorb them.
+static std::shared_ptr<ngraph::Node>
+    fold_matmulbias_affine(const std::shared_ptr<ngraph::op::MatmulBias>& mmb,
+                           const ngraph::Output<ngraph::Node>& scale,
+                           const ngraph::Output<ngraph::Node>& shift)
+{
+    using namespace ngraph;
+
+    if (mmb->get_users().size() > 1 || mmb->get_output_element_type(0) != element::f32)
+    {
+        return nullptr;
+    }
+
+    // the weights must be used as they are, without the reshape init_cblas_arg allows
+    auto weights = mmb->input_value(1);
+    if (weights.get_shape() != mmb->get_b_shape())
+    {
+        return nullptr;
+    }
+
+    auto columns = mmb->get_output_shape(0)[1];
+    Output<Node> bias;
+    if (mmb->get_input_size() > 2)
+    {
+        bias = mmb->input_value(2);
+        if (mmb->get_broadcast_axes() == AxisSet{0, 1} && shape_size(bias.get_shape()) == 1)
+        {
+            bias = get_matmul_column_values(std::make_shared<op::v0::Broadcast>(
+                bias, mmb->get_output_shape(0), AxisSet{0, 1}));
+        }
+        else if (mmb->get_broadcast_axes() != AxisSet{0} || bias.get_shape() != Shape{columns})
+        {
+            return nullptr;
+        }
+    }
+
+    // new weights = weights * scale along the output columns
+    // new bias = bias * scale + shift
+    if (scale != Output<Node>())
+    {
+        weights = std::make_shared<op::v1::Multiply>(
+            weights,
+            std::make_shared<op::v0::Broadcast>(
+                scale, weights.get_shape(), mmb->get_is_b_transposed() ? AxisSet{1} : AxisSet{0}));
+        if (bias != Output<Node>())
+        {
+            bias = std::make_shared<op::v1::Multiply>(bias, scale);
+        }
+    }
+    if (shift != Output<Node>())
+    {
+        bias = bias == Output<Node>() ? shift : std::make_shared<op::v1::Add>(bias, shift);
+    }
+
+    return std::make_shared<op::MatmulBias>(mmb->input_value(0),
+                                            weights,
+                                            bias,
+                                            mmb->get_a_shape(),
+                                            mmb->get_b_shape(),
+                                            mmb->get_is_a_transposed(),
+                                            mmb->get_is_b_transposed(),
+                                            bias == Output<Node>() ? AxisSet{} : AxisSet{0});
+}
+
+void ngraph::runtime::cpu::pass::CPUFusion::construct_matmulbias_affine_folding()
+{
+    // MatmulBias * broadcast(A) -> MatmulBias(W, x * A, b * A)
+    // MatmulBias + broadcast(B) -> MatmulBias(W, x, b + B)
+    // for A and B constant along the rows, as left by decomposed ScaleShifts
+    Shape shape{2, 4};
+    auto mmb = std::make_shared<pattern::op::Label>(
+        element::f32, shape, pattern::has_class<ngraph::op::MatmulBias>());
+    auto A = std::make_shared<pattern::op::Label>(
+        element::f32, shape, pattern::has_class<ngraph::op::v0::Broadcast>());
+    auto B = std::make_shared<pattern::op::Label>(
+        element::f32, shape, pattern::has_class<ngraph::op::v0::Broadcast>());
+    auto multiply = std::make_shared<ngraph::op::v1::Multiply>(mmb, A);
+    auto add = std::make_shared<ngraph::op::v1::Add>(mmb, B);
+
+    auto make_callback = [mmb](std::shared_ptr<pattern::op::Label> affine, bool is_scale) {
+        return [mmb, affine, is_scale](pattern::Matcher& m) {
+            NGRAPH_DEBUG << "In callback for MatmulBias affine folding against node = "
+                         << m.get_match_root()->get_name();
+            auto pvm = m.get_pattern_value_map();
+
+            auto values = get_matmul_column_values(pvm[affine]);
+            if (values == Output<Node>())
+            {
+                NGRAPH_DEBUG << "Affine values vary along the rows";
+                return false;
+            }
+
+            auto mmb_m = as_type_ptr<ngraph::op::MatmulBias>(pvm[mmb].get_node_shared_ptr());
+            auto folded = fold_matmulbias_affine(
+                mmb_m, is_scale ? values : Output<Node>(), is_scale ? Output<Node>() : values);
+            if (!folded)
+            {
+                return false;
+            }
+            m.get_match_value().replace(folded->output(0));
+            return true;
+        };
+    };
+
+    this->add_matcher(
+        std::make_shared<ngraph::pattern::Matcher>(multiply, "CPUFusion.MatmulBiasScaleFolding"),
+        make_callback(A, true));
+    this->add_matcher(
+        std::make_shared<ngraph::pattern::Matcher>(add, "CPUFusion.MatmulBiasShiftFolding"),
+        make_callback(B, false));
+}
+
+void ngraph::runtime::cpu::pass::CPUFusion::construct_matmulbias_batch_norm_folding()
+{
+    auto mmb = std::make_shared<pattern::op::Label>(
+        element::f32, Shape{2, 2}, pattern::has_class<ngraph::op::MatmulBias>());
+    auto mean = std::make_shared<pattern::op::Label>(element::f32, Shape{2});
+    auto var = std::make_shared<pattern::op::Label>(element::f32, Shape{2});
+    auto gamma = std::make_shared<pattern::op::Label>(element::f32, Shape{2});
+    auto beta = std::make_shared<pattern::op::Label>(element::f32, Shape{2});
+    double eps = 0.001;
+    auto bn = std::make_shared<ngraph::op::v0::BatchNormInference>(eps, gamma, beta, mmb, mean, var);
+
+    auto callback = [mmb, mean, var, gamma, beta](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In callback for MatmulBias BatchNorm folding against node = "
+                     << m.get_match_root()->get_name();
+        auto pvm = m.get_pattern_value_map();
+
+        auto m_bn = m.get_match_root_as<ngraph::op::v0::BatchNormInference>();
+        NGRAPH_CHECK(m_bn,
+                     "match root node ",
+                     *m.get_match_root(),
+                     " not of type `ngraph::op::v0::BatchNormInference`");
+
+        // scale = gamma / sqrt(variance + epsilon)
+        // shift = beta - mean * scale
+        auto bn_eps =
+            ngraph::op::v0::Constant::create(element::f32, Shape{}, {m_bn->get_eps_value()});
+        auto var_eps = std::make_shared<ngraph::op::v1::Add>(
+            pvm[var],
+            std::make_shared<ngraph::op::v0::Broadcast>(bn_eps, pvm[var].get_shape(), AxisSet{0}));
+        auto scale = std::make_shared<ngraph::op::v1::Divide>(
+            pvm[gamma], std::make_shared<ngraph::op::v0::Sqrt>(var_eps));
+        auto shift = std::make_shared<ngraph::op::v1::Subtract>(
+            pvm[beta], std::make_shared<ngraph::op::v1::Multiply>(pvm[mean], scale));
+
+        auto mmb_m = as_type_ptr<ngraph::op::MatmulBias>(pvm[mmb].get_node_shared_ptr());
+        auto folded = fold_matmulbias_affine(mmb_m, scale, shift);
+        if (!folded)
+        {
+            return false;
+        }
+        m.get_match_value().replace(folded->output(0));
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(bn, "CPUFusion.MatmulBiasBatchNormFolding");
+    this->add_matcher(m, callback);
+}
+
 void ngraph::runtime::cpu::pass::CPUFusion::construct_matmul()
 {
     Shape shape_w{2, 4};
@@ -1176,6 +1368,60 @@ void ngraph::runtime::cpu::pass::CPUFusion::construct_dropout()
     this->add_matcher(m, callback);
 }
 
+void ngraph::runtime::cpu::pass::CPUFusion::construct_dropout_backprop()
+{
+    Shape shape{1, 1, 2, 2};
+    auto mask = std::make_shared<pattern::op::Label>(
+        element::f32, shape, [](const Output<Node>& value) {
+            return value.get_index() == 1 && is_type<ngraph::op::Dropout>(value.get_node());
+        });
+    auto delta = std::make_shared<pattern::op::Label>(element::f32, shape);
+    auto mult = std::make_shared<ngraph::op::v1::Multiply>(mask, delta);
+
+    auto callback = [mask, delta](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In a callback for construct_dropout_backprop against "
+                     << m.get_match_root()->get_name();
+        auto pvm = m.get_pattern_value_map();
+
+        auto forward = std::static_pointer_cast<ngraph::op::Dropout>(
+            pvm[mask].get_node_shared_ptr());
+        Output<Node> delta_value = pvm[delta];
+        if (delta_value.get_shape() != forward->get_input_shape(0))
+        {
+            NGRAPH_DEBUG << "mask of Dropout is broadcast in the backprop";
+            return false;
+        }
+
+        // The gradient of the division of the forward output by keep_prob is also folded in
+        bool scale = false;
+        auto keep_prob = as_type_ptr<ngraph::op::v0::Constant>(forward->get_argument(4));
+        auto divide = as_type_ptr<ngraph::op::v1::Divide>(delta_value.get_node_shared_ptr());
+        if (keep_prob && divide && divide->get_output_target_inputs(0).size() == 1 &&
+            divide->get_input_shape(0) == divide->get_output_shape(0))
+        {
+            auto divisor = as_type_ptr<ngraph::op::v0::Constant>(divide->get_argument(1));
+            if (divisor && divisor->get_all_data_elements_bitwise_identical())
+            {
+                auto divisor_value = divisor->cast_vector<double>().at(0);
+                auto keep_prob_value = keep_prob->cast_vector<double>().at(0);
+                if (static_cast<float>(divisor_value) == static_cast<float>(keep_prob_value))
+                {
+                    delta_value = divide->input_value(0);
+                    scale = true;
+                }
+            }
+        }
+
+        auto backprop =
+            std::make_shared<ngraph::op::DropoutBackprop>(delta_value, forward, scale);
+        m.get_match_value().replace(backprop->output(0));
+        return true;
+    };
+
+    auto m = std::make_shared<pattern::Matcher>(mult, "CPUFusion.DropoutBackprop");
+    this->add_matcher(m, callback);
+}
+
 void ngraph::runtime::cpu::pass::CPUFusion::construct_conv_bias_add_relu()
 {
     Shape shape{2, 2, 1, 1};
@@ -2594,6 +2840,12 @@ void ngraph::runtime::cpu::pass::CPUQuantFusion::construct_quantized_matmul()
         {
             return false;
         }
+        // The pattern matches zero points of any value, but QuantizedMatmul has none
+        if (!(ngraph::is_zero(qdot->input_value(3)) && ngraph::is_zero(qdot->input_value(5)) &&
+              ngraph::is_zero(qdot->input_value(7))))
+        {
+            return false;
+        }
 
         auto reshape_input1 = std::make_shared<op::v0::Reshape>(
             input_1, AxisVector{1, 0}, Shape{input_1.get_shape()[1], input_1.get_shape()[0]});
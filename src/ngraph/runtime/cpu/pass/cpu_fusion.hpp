@@ -68,6 +68,8 @@ public:
         {
             construct_matmul();
             construct_matmulbias();
+            construct_matmulbias_affine_folding();
+            construct_matmulbias_batch_norm_folding();
             construct_fprop_bn();
             construct_conv_bias_bprop();
             construct_conv_bias_folded_batch_norm();
@@ -93,6 +95,8 @@ public:
                 construct_deconvolution_affine_folding_relu();
             }
             construct_dropout();
+            // construct_dropout_backprop() should always be after construct_dropout()
+            construct_dropout_backprop();
             construct_batch_norm_infer_relu_with_multiply_add();
         }
     }
@@ -100,6 +104,8 @@ public:
 private:
     void construct_matmul();
     void construct_matmulbias();
+    void construct_matmulbias_affine_folding();
+    void construct_matmulbias_batch_norm_folding();
     void construct_conv_bias();
     void construct_conv_bias_bprop();
     void construct_fprop_bn();
@@ -123,6 +129,7 @@ private:
     void construct_deconvolution_affine_folding();
     void construct_deconvolution_affine_folding_relu();
     void construct_dropout();
+    void construct_dropout_backprop();
 };
 
 class CPU_BACKEND_API ngraph::runtime::cpu::pass::CPUQuantFusion : public ngraph::pass::GraphRewrite
@@ -26,6 +26,7 @@
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pattern/matcher.hpp"
 #include "ngraph/pattern/op/label.hpp"
+#include "ngraph/runtime/cpu/op/matmul_bias.hpp"
 
 using namespace ngraph;
 using namespace std;
@@ -196,3 +197,163 @@ void ngraph::runtime::cpu::pass::CPUHorizontalFusion::cpu_conv_horizontal_fusion
         make_shared<pattern::Matcher>(conv_bias, "CPUHorizontalFusion.CpuConvHorizontalFusion");
     this->add_matcher(m, callback);
 }
+
+// Whether the MatmulBias ops compute the same product of their first argument with weights
+// that can be concatenated along the output columns, with biases broadcast along the rows if
+// they have any. The weights and biases must be parameters or constants, which the GEMM can
+// use concatenated without the fused node depending on one of the ops it replaces.
+static bool can_fuse_matmuls(const std::shared_ptr<ngraph::op::MatmulBias> mm1,
+                             const std::shared_ptr<ngraph::op::MatmulBias> mm2)
+{
+    if (mm1->get_is_a_transposed() != mm2->get_is_a_transposed() ||
+        mm1->get_is_b_transposed() != mm2->get_is_b_transposed())
+    {
+        NGRAPH_DEBUG << "matmul_horizontal_fusion: skip matmul with different transposes\n";
+        return false;
+    }
+    if (mm1->get_input_size() != mm2->get_input_size() ||
+        mm1->get_broadcast_axes() != mm2->get_broadcast_axes())
+    {
+        NGRAPH_DEBUG << "matmul_horizontal_fusion: skip matmul with different bias\n";
+        return false;
+    }
+    if (mm2->get_input_size() > 2 &&
+        (mm2->get_broadcast_axes() != AxisSet{0} || mm2->get_input_shape(2).size() != 1))
+    {
+        NGRAPH_DEBUG << "matmul_horizontal_fusion: skip matmul with a bias not broadcast "
+                        "along the rows\n";
+        return false;
+    }
+    if (mm1->get_input_shape(0) != mm2->get_input_shape(0) ||
+        mm1->get_a_shape() != mm2->get_a_shape() ||
+        mm1->get_input_element_type(1) != mm2->get_input_element_type(1))
+    {
+        NGRAPH_DEBUG << "matmul_horizontal_fusion: skip matmul with different argument\n";
+        return false;
+    }
+    for (size_t i = 1; i < mm2->get_input_size(); i++)
+    {
+        auto arg = mm2->get_input_node_ptr(i);
+        if (!arg->is_constant() && !arg->is_parameter())
+        {
+            NGRAPH_DEBUG << "matmul_horizontal_fusion: skip matmul with computed weights\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+void ngraph::runtime::cpu::pass::CPUHorizontalFusion::cpu_matmul_horizontal_fusion()
+{
+    auto has_multiple_users = [](Output<Node> n) { return n.get_target_inputs().size() > 1; };
+
+    auto data = std::make_shared<pattern::op::Label>(element::f32, Shape{2, 4}, has_multiple_users);
+    auto weights = std::make_shared<pattern::op::Label>(element::f32, Shape{4, 3});
+    auto bias = std::make_shared<pattern::op::Label>(element::f32, Shape{3});
+
+    auto callback = [data](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "matmul_horizontal_fusion: In a callback for matmul horizontal fusion for "
+                     << m.get_match_root()->get_name();
+
+        auto matmul_root = m.get_match_root_as<op::MatmulBias>();
+        NGRAPH_CHECK(matmul_root,
+                     "match root node ",
+                     *m.get_match_root(),
+                     " not of type `op::MatmulBias`");
+
+        // check if the node has been replaced
+        if (matmul_root->get_users().empty())
+        {
+            NGRAPH_DEBUG << "matmul_horizontal_fusion: root node has been replaced\n";
+            return false;
+        }
+
+        auto data_value = m.get_pattern_value_map()[data];
+        OutputVector weights_nodes;
+        OutputVector bias_nodes;
+        std::vector<std::shared_ptr<op::MatmulBias>> matmul_nodes;
+        for (auto input : data_value.get_target_inputs())
+        {
+            auto u = input.get_node()->shared_from_this();
+            if (!is_used(u.get()))
+            {
+                NGRAPH_DEBUG << "matmul_horizontal_fusion: dead node\n";
+                continue;
+            }
+            auto matmul_u = as_type_ptr<op::MatmulBias>(u);
+            if (!matmul_u || input.get_index() != 0)
+            {
+                NGRAPH_DEBUG << "matmul_horizontal_fusion: " << u->get_name()
+                             << " is not a matmul of the data\n";
+                continue;
+            }
+            if (!can_fuse_matmuls(matmul_root, matmul_u))
+            {
+                continue;
+            }
+
+            weights_nodes.push_back(matmul_u->input_value(1));
+            if (matmul_u->get_input_size() > 2)
+            {
+                bias_nodes.push_back(matmul_u->input_value(2));
+            }
+            matmul_nodes.push_back(matmul_u);
+        }
+
+        if (matmul_nodes.size() <= 1)
+        {
+            NGRAPH_DEBUG << "matmul_horizontal_fusion: need more than one nodes to do fusion\n";
+            return false;
+        }
+
+        // The columns of the product are the rows of transposed weights
+        bool transpose_x = matmul_root->get_is_b_transposed();
+        size_t column_axis = transpose_x ? 0 : 1;
+        auto concat_weights =
+            std::make_shared<ngraph::op::v0::Concat>(weights_nodes, column_axis);
+        Output<Node> concat_bias;
+        if (!bias_nodes.empty())
+        {
+            concat_bias = std::make_shared<ngraph::op::v0::Concat>(bias_nodes, 0);
+        }
+        auto matmul_new =
+            std::make_shared<ngraph::op::MatmulBias>(data_value,
+                                                     concat_weights,
+                                                     concat_bias,
+                                                     matmul_root->get_a_shape(),
+                                                     concat_weights->get_output_shape(0),
+                                                     matmul_root->get_is_a_transposed(),
+                                                     transpose_x,
+                                                     matmul_root->get_broadcast_axes());
+        NGRAPH_DEBUG << "matmul_horizontal_fusion: new matmul shape "
+                     << matmul_new->get_output_shape(0) << "\n";
+
+        // Each op gets its columns of the product. With a single row they are contiguous and
+        // CPUMemoryOptimization slices them in place.
+        size_t index = 0;
+        for (auto mm : matmul_nodes)
+        {
+            auto slice_shape = mm->get_output_shape(0);
+            auto lower_bounds = Coordinate{0, index};
+            index += slice_shape[1];
+            auto upper_bounds = Coordinate{slice_shape[0], index};
+            auto slice =
+                std::make_shared<ngraph::op::v0::Slice>(matmul_new, lower_bounds, upper_bounds);
+            replace_node(mm, slice);
+        }
+
+        return true;
+    };
+
+    auto matmul = std::make_shared<ngraph::op::MatmulBias>(
+        data, weights, Output<Node>(), Shape{2, 4}, Shape{4, 3}, false, false);
+    auto m = make_shared<pattern::Matcher>(matmul,
+                                           "CPUHorizontalFusion.CpuMatmulHorizontalFusion");
+    this->add_matcher(m, callback);
+
+    auto matmul_bias = std::make_shared<ngraph::op::MatmulBias>(
+        data, weights, bias, Shape{2, 4}, Shape{4, 3}, false, false, AxisSet{0});
+    auto m_bias = make_shared<pattern::Matcher>(
+        matmul_bias, "CPUHorizontalFusion.CpuMatmulBiasHorizontalFusion");
+    this->add_matcher(m_bias, callback);
+}
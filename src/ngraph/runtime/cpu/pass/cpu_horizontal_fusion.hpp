@@ -39,8 +39,12 @@ public:
         : GraphRewrite()
     {
         cpu_conv_horizontal_fusion();
+        cpu_matmul_horizontal_fusion();
     }
 
 private:
     void cpu_conv_horizontal_fusion();
+    // MatmulBias ops with the same first argument, such as the query, key and value
+    // projections of attention, run as one GEMM on their concatenated weights
+    void cpu_matmul_horizontal_fusion();
 };
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <map>
 #include <memory>
 #include <string>
 #include <typeindex>
@@ -35,6 +36,7 @@
 #include "ngraph/op/conv_fused.hpp"
 #include "ngraph/op/convert.hpp"
 #include "ngraph/op/convolution.hpp"
+#include "ngraph/op/deformable_psroi_pooling.hpp"
 #include "ngraph/op/dequantize.hpp"
 #include "ngraph/op/experimental/quantized_conv_bias.hpp"
 #include "ngraph/op/experimental/quantized_conv_relu.hpp"
@@ -43,14 +45,18 @@
 #include "ngraph/op/lrn.hpp"
 #include "ngraph/op/max_pool.hpp"
 #include "ngraph/op/op.hpp"
+#include "ngraph/op/psroi_pooling.hpp"
 #include "ngraph/op/quantize.hpp"
 #include "ngraph/op/quantized_convolution.hpp"
 #include "ngraph/op/relu.hpp"
 #include "ngraph/op/reshape.hpp"
 #include "ngraph/op/result.hpp"
+#include "ngraph/op/roi_align.hpp"
+#include "ngraph/op/roi_pooling.hpp"
 #include "ngraph/op/sigmoid.hpp"
 #include "ngraph/op/slice.hpp"
 #include "ngraph/op/softmax.hpp"
+#include "ngraph/op/sum.hpp"
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
@@ -65,6 +71,7 @@
 #include "ngraph/runtime/cpu/op/leaky_relu.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/max_pool_with_indices.hpp"
+#include "ngraph/runtime/cpu/op/preprocess.hpp"
 #include "ngraph/runtime/cpu/op/quantized_matmul.hpp"
 #include "ngraph/runtime/cpu/op/rnn.hpp"
 
@@ -174,9 +181,11 @@ static void set_output_layouts(shared_ptr<Node>& node, const vector<memory::desc
     }
 }
 
+// Inputs before `first_native_input` keep the layout of their producer
 static void set_native_layouts(runtime::cpu::CPU_ExternalFunction* external_function,
                                std::shared_ptr<Node> node,
-                               bool use_replace = true)
+                               bool use_replace = true,
+                               size_t first_native_input = 0)
 {
     OutputVector new_args;
     bool replace_node = false;
@@ -190,7 +199,7 @@ static void set_native_layouts(runtime::cpu::CPU_ExternalFunction* external_func
         auto tvl = tv->get_tensor_layout();
         auto cpu_tvl = dynamic_cast<runtime::cpu::LayoutDescriptor*>(tvl.get());
 
-        if (cpu_tvl && cpu_tvl->is_dnnl_layout())
+        if (index >= first_native_input && cpu_tvl && cpu_tvl->is_dnnl_layout())
         {
             auto native_md = dnnl_utils::create_blocked_dnnl_md(shape, cpu_tvl->get_strides(), et);
             if (!dnnl_utils::compare_dnnl_mds(cpu_tvl->get_dnnl_md(), native_md))
@@ -282,8 +291,122 @@ static void set_layouts_unaryeltwise(ngraph::runtime::cpu::CPU_ExternalFunction*
     }
 }
 
+// The ROI pooling kernels read a feature map in nChw8c or nChw16c as it is, so the output of a
+// DNNL convolution is not reordered for them. The boxes and the result are native.
+static void set_layouts_roi_pooling(ngraph::runtime::cpu::CPU_ExternalFunction* external_function,
+                                    std::shared_ptr<ngraph::Node> node)
+{
+    auto input_md = dnnl_utils::get_input_dnnl_md(node.get(), 0);
+    if (node->get_input_element_type(0) == element::f32 &&
+        dnnl_utils::get_channel_block_size(input_md) > 1)
+    {
+        set_native_layouts(external_function, node, true, 1);
+    }
+    else
+    {
+        set_native_layouts(external_function, node);
+    }
+}
+
+namespace
+{
+    // Bytes the ops using an output reorder if it has a DNNL blocked layout, and if it has the
+    // native one
+    struct LayoutDemand
+    {
+        size_t blocked_bytes{0};
+        size_t native_bytes{0};
+    };
+
+    using LayoutDemands = map<pair<const Node*, size_t>, LayoutDemand>;
+
+    // Ops whose output gets the layout of their first input, so that what their users reorder
+    // is reordered on account of that input too
+    bool passes_layout_on(const Node* node)
+    {
+        if (node->get_output_size() != 1)
+        {
+            return false;
+        }
+        return node->is_unary_elementwise_arithmetic() ||
+               node->is_binary_elementwise_arithmetic() ||
+               is_type<ngraph::op::v0::MaxPool>(node) || is_type<ngraph::op::v0::AvgPool>(node) ||
+               is_type<ngraph::op::v0::Concat>(node) || is_type<ngraph::op::v0::Slice>(node);
+    }
+
+    // Ops that read an output in nChw8c or nChw16c as they read it in NCHW
+    bool reads_any_layout(const Node* node)
+    {
+        auto sum = as_type<const ngraph::op::v0::Sum>(node);
+        return sum && sum->get_input_element_type(0) == element::f32 &&
+               sum->get_input_shape(0).size() == 4 && sum->get_reduction_axes() == AxisSet{2, 3};
+    }
+
+    // The demands of every output of the graph, from the users back to the producers. DNNL
+    // kernels with layout requirements reorder native inputs, and the other ops, including the
+    // results, blocked ones, so that the layout choices made op by op can account for the
+    // reorders they cause anywhere downstream.
+    LayoutDemands compute_layout_demands(const list<shared_ptr<Node>>& nodes)
+    {
+        LayoutDemands demands;
+        for (auto it = nodes.rbegin(); it != nodes.rend(); ++it)
+        {
+            const Node* node = it->get();
+            for (auto output : node->outputs())
+            {
+                size_t bytes = shape_size(output.get_shape()) * output.get_element_type().size();
+                LayoutDemand demand;
+                for (auto input : output.get_target_inputs())
+                {
+                    const Node* user = input.get_node();
+                    if (passes_layout_on(user))
+                    {
+                        const LayoutDemand& user_demand = demands[{user, 0}];
+                        demand.blocked_bytes += user_demand.blocked_bytes;
+                        demand.native_bytes += user_demand.native_bytes;
+                    }
+                    else if (dnnl_utils::use_dnnl_kernel(user))
+                    {
+                        demand.native_bytes += bytes;
+                    }
+                    else if (reads_any_layout(user))
+                    {
+                        continue;
+                    }
+                    else
+                    {
+                        demand.blocked_bytes += bytes;
+                    }
+                }
+                demands[{node, output.get_index()}] = demand;
+            }
+        }
+        return demands;
+    }
+}
+
+// A sum over the spatial axes of nChw8c or nChw16c reads the input as it is, as global average
+// pooling at the end of a network of DNNL convolutions does. The result is native.
+static void set_layouts_sum(ngraph::runtime::cpu::CPU_ExternalFunction* external_function,
+                            std::shared_ptr<ngraph::Node> node)
+{
+    auto input_md = dnnl_utils::get_input_dnnl_md(node.get(), 0);
+    if (reads_any_layout(node.get()) && dnnl_utils::get_channel_block_size(input_md) > 1)
+    {
+        set_native_layouts(external_function, node, true, 1);
+    }
+    else
+    {
+        set_native_layouts(external_function, node);
+    }
+}
+
+// When the arguments have different layouts the result takes the one of the argument
+// NGRAPH_PASS_CPU_LAYOUT_ELTWISE selects, or else the one reordering the fewest bytes overall:
+// those of the other argument and those the users of the result reorder.
 void set_layouts_binaryeltwise(ngraph::runtime::cpu::CPU_ExternalFunction* external_function,
-                               std::shared_ptr<ngraph::Node> node)
+                               std::shared_ptr<ngraph::Node> node,
+                               const LayoutDemands& demands)
 {
     std::vector<dnnl::memory::desc> arg_mds{dnnl_utils::get_input_dnnl_md(node.get(), 0),
                                             dnnl_utils::get_input_dnnl_md(node.get(), 1)};
@@ -302,6 +425,25 @@ void set_layouts_binaryeltwise(ngraph::runtime::cpu::CPU_ExternalFunction* exter
         vector<memory::desc> o_mds;
         const int32_t user_select = getenv_int("NGRAPH_PASS_CPU_LAYOUT_ELTWISE");
         int select = (user_select == 0 || user_select == 1) ? user_select : 0;
+        bool blocked0 = dnnl_utils::is_dnnl_desc_blocked_data_format(arg_mds[0]);
+        bool blocked1 = dnnl_utils::is_dnnl_desc_blocked_data_format(arg_mds[1]);
+        auto demand = demands.find({node.get(), 0});
+        if (user_select != 0 && user_select != 1 && blocked0 != blocked1 &&
+            demand != demands.end())
+        {
+            size_t cost[2];
+            for (size_t i = 0; i < 2; i++)
+            {
+                bool blocked = i == 0 ? blocked0 : blocked1;
+                cost[i] = shape_size(node->get_input_shape(1 - i)) *
+                              node->get_input_element_type(1 - i).size() +
+                          (blocked ? demand->second.blocked_bytes : demand->second.native_bytes);
+            }
+            select = cost[1] < cost[0] ? 1 : 0;
+            NGRAPH_DEBUG << node->get_name() << " takes the layout of argument " << select
+                         << ", reordering " << cost[select] << " bytes instead of "
+                         << cost[1 - select];
+        }
         i_mds.push_back(arg_mds[select]);
         i_mds.push_back(arg_mds[select]);
         o_mds.push_back(arg_mds[select]);
@@ -377,18 +519,14 @@ namespace ngraph
                         dnnl_result_shape, et_result, memory::FORMAT::any);
 
                     std::unique_ptr<convolution_forward::desc> fwd_desc{nullptr};
-                    auto convolution_algo = dnnl_utils::get_conv_algo();
-
-                    // I/p channels less than 8 & convolution_algo = convolution_auto
-                    // forces src format to be nChw16c & the weight format to be
-                    // OIhw16i16o which invokes dnnl reference implementation of conv
-                    // which crashes as it has no support for post ops
-                    if ((node->get_input_element_type(0) != element::f32 &&
-                         convolution_algo != dnnl::algorithm::convolution_direct) ||
-                        arg0_shape[1] <= 8)
-                    {
-                        convolution_algo = dnnl::algorithm::convolution_direct;
-                    }
+                    // Must match the algorithm the emitter builds the primitive with, as the
+                    // layouts chosen here depend on it
+                    auto convolution_algo = dnnl_utils::get_conv_forward_algo(
+                        node.get(),
+                        convolution->get_window_movement_strides(),
+                        convolution->get_window_dilation_strides(),
+                        convolution->get_padding_below(),
+                        convolution->get_padding_above());
 
                     if (use_bias)
                     {
@@ -441,7 +579,7 @@ namespace ngraph
                         }
                     }
                     convolution_forward::primitive_desc prim_desc(*fwd_desc,
-                                                                  executor::global_cpu_engine);
+                                                                  executor::get_cpu_engine());
                     i_mds.push_back(prim_desc.src_desc());
                     i_mds.push_back(prim_desc.weights_desc());
 
@@ -516,7 +654,7 @@ namespace ngraph
                         }
                     }
                     inner_product_forward::primitive_desc prim_desc(*fwd_desc,
-                                                                    executor::global_cpu_engine);
+                                                                    executor::get_cpu_engine());
                     i_mds.push_back(prim_desc.src_desc());
                     i_mds.push_back(prim_desc.weights_desc());
 
@@ -902,7 +1040,7 @@ namespace ngraph
                                                                 dnnl_padding_above PADDING);
 
                         deconvolution_forward::primitive_desc deconv_prim_desc(
-                            deconv_desc, executor::global_cpu_engine);
+                            deconv_desc, executor::get_cpu_engine());
 
                         vector<memory::desc> i_mds;
                         vector<memory::desc> o_mds;
@@ -979,10 +1117,10 @@ namespace ngraph
                                                            dnnl_padding_below,
                                                            dnnl_padding_above PADDING);
                         convolution_forward::primitive_desc fwd_prim_desc(
-                            fwd_desc, executor::global_cpu_engine);
+                            fwd_desc, executor::get_cpu_engine());
 
                         convolution_backward_data::primitive_desc prim_desc(
-                            bwd_desc, executor::global_cpu_engine, fwd_prim_desc);
+                            bwd_desc, executor::get_cpu_engine(), fwd_prim_desc);
 
                         vector<memory::desc> i_mds;
                         vector<memory::desc> o_mds;
@@ -1087,9 +1225,9 @@ namespace ngraph
                                                                      dnnl_padding_above PADDING));
                     }
                     convolution_forward::primitive_desc fwd_prim_desc(*fwd_desc,
-                                                                      executor::global_cpu_engine);
+                                                                      executor::get_cpu_engine());
                     convolution_backward_weights::primitive_desc prim_desc(
-                        *bwd_desc, executor::global_cpu_engine, fwd_prim_desc);
+                        *bwd_desc, executor::get_cpu_engine(), fwd_prim_desc);
                     i_mds.push_back(prim_desc.src_desc());
                     i_mds.push_back(prim_desc.diff_dst_desc());
                     o_mds.push_back(prim_desc.diff_weights_desc());
@@ -1181,7 +1319,7 @@ namespace ngraph
                                                           dnnl_padding_below,
                                                           dnnl_padding_above PADDING);
                         auto prim_desc =
-                            pooling_forward::primitive_desc(desc, executor::global_cpu_engine);
+                            pooling_forward::primitive_desc(desc, executor::get_cpu_engine());
                         i_mds.push_back(input_desc);
                         o_mds.push_back(prim_desc.dst_desc());
                     }
@@ -1273,7 +1411,7 @@ namespace ngraph
                                                                   dnnl_padding_below,
                                                                   dnnl_padding_above PADDING);
                             auto fwd_prim_desc = pooling_forward::primitive_desc(
-                                fwd_desc, executor::global_cpu_engine);
+                                fwd_desc, executor::get_cpu_engine());
                             auto bwd_desc = pooling_backward::desc(algorithm_enumerator,
                                                                    result_desc,
                                                                    input_desc,
@@ -1282,7 +1420,7 @@ namespace ngraph
                                                                    dnnl_padding_below,
                                                                    dnnl_padding_above PADDING);
                             auto prim_desc = pooling_backward::primitive_desc(
-                                bwd_desc, executor::global_cpu_engine, fwd_prim_desc);
+                                bwd_desc, executor::get_cpu_engine(), fwd_prim_desc);
                             i_mds.push_back(input_desc);
                             o_mds.push_back(prim_desc.diff_src_desc());
                         }
@@ -1341,7 +1479,7 @@ namespace ngraph
                                                           dnnl_padding_below,
                                                           dnnl_padding_above PADDING);
                         auto prim_desc =
-                            pooling_forward::primitive_desc(desc, executor::global_cpu_engine);
+                            pooling_forward::primitive_desc(desc, executor::get_cpu_engine());
                         i_mds.push_back(input_desc);
                         o_mds.push_back(prim_desc.dst_desc());
 
@@ -1374,7 +1512,7 @@ namespace ngraph
                                                                   dnnl_padding_below,
                                                                   dnnl_padding_above PADDING);
                                 auto prim_desc = pooling_forward::primitive_desc(
-                                    desc, executor::global_cpu_engine);
+                                    desc, executor::get_cpu_engine());
                                 o_mds.push_back(prim_desc.workspace_desc());
                             }
                         }
@@ -1572,7 +1710,7 @@ namespace ngraph
                                                               dnnl_padding_above PADDING);
 
                         auto fwd_prim_desc =
-                            pooling_forward::primitive_desc(fwd_desc, executor::global_cpu_engine);
+                            pooling_forward::primitive_desc(fwd_desc, executor::get_cpu_engine());
 
                         auto bwd_desc = pooling_backward::desc(algorithm_enumerator,
                                                                diff_src_desc,
@@ -1583,7 +1721,7 @@ namespace ngraph
                                                                dnnl_padding_above PADDING);
 
                         auto prim_desc = pooling_backward::primitive_desc(
-                            bwd_desc, executor::global_cpu_engine, fwd_prim_desc);
+                            bwd_desc, executor::get_cpu_engine(), fwd_prim_desc);
 
                         i_mds.push_back(diff_src_desc);
                         i_mds.push_back(diff_dst_desc);
@@ -1686,6 +1824,22 @@ namespace ngraph
                     return true;
                 }
 
+                // Whether the transpose of the reshape only moves axes of one element, which
+                // leaves the data in the same order, so that the output is a view of the input
+                static bool keeps_data_order(const ngraph::op::v0::Reshape* reshape)
+                {
+                    auto input_shape = reshape->get_input_shape(0);
+                    AxisVector moved_axes;
+                    for (auto axis : reshape->get_input_order())
+                    {
+                        if (input_shape[axis] != 1)
+                        {
+                            moved_axes.push_back(axis);
+                        }
+                    }
+                    return is_sorted(moved_axes.begin(), moved_axes.end());
+                }
+
                 static bool can_be_squeezed(const ngraph::op::v0::Reshape* reshape,
                                             const dnnl::memory::desc& md,
                                             AxisVector& squeezed_axis)
@@ -1798,14 +1952,14 @@ namespace ngraph
                         }
                         else
                         {
-                            if (!reshape->get_is_transpose())
+                            if (!reshape->get_is_transpose() || keeps_data_order(reshape))
                                 skip_reshape = true;
                         }
                     }
                     else
                     {
                         // Input is in row-major layout
-                        if (reshape->get_is_transpose())
+                        if (reshape->get_is_transpose() && !keeps_data_order(reshape))
                         {
                             auto input_strides = cpu_tvl->get_strides();
                             auto axis_order = reshape->get_input_order();
@@ -2081,7 +2235,24 @@ namespace ngraph
                         dnnl::memory::format_tag result_format = dnnl::memory::format_tag::undef;
                         if (dnnl_utils::is_dnnl_desc_blocked_data_format(input_md))
                         {
-                            set_native_layouts(external_function, node);
+                            // A slice of whole channel blocks is a sub-memory of nChw8c or
+                            // nChw16c that the reorder copies without unblocking it
+                            size_t block = dnnl_utils::get_channel_block_size(input_md);
+                            if (block > 1 && lower_bounds[1] % block == 0 &&
+                                result_shape[1] % block == 0)
+                            {
+                                auto result_desc = dnnl_utils::create_default_dnnl_md(
+                                    node.get(),
+                                    0,
+                                    true,
+                                    block == 8 ? dnnl::memory::format_tag::nChw8c
+                                               : dnnl::memory::format_tag::nChw16c);
+                                set_output_layouts(node, vector<memory::desc>{result_desc});
+                            }
+                            else
+                            {
+                                set_native_layouts(external_function, node);
+                            }
                             return;
                         }
                         else
@@ -2173,7 +2344,7 @@ namespace ngraph
                         auto prim_desc = concat::primitive_desc(result_desc,
                                                                 static_cast<int>(concat_dim),
                                                                 inputs_desc,
-                                                                executor::global_cpu_engine);
+                                                                executor::get_cpu_engine());
                         o_mds.push_back(prim_desc.dst_desc());
                     }
                     catch (const dnnl::error& e)
@@ -2250,6 +2421,36 @@ namespace ngraph
                     }
                 }
 
+                template <>
+                void CPULayout::LAYOUT_DECL(ngraph::op::v3::ROIAlign)
+                {
+                    set_layouts_roi_pooling(external_function, node);
+                }
+
+                template <>
+                void CPULayout::LAYOUT_DECL(ngraph::op::v0::ROIPooling)
+                {
+                    set_layouts_roi_pooling(external_function, node);
+                }
+
+                template <>
+                void CPULayout::LAYOUT_DECL(ngraph::op::v0::PSROIPooling)
+                {
+                    set_layouts_roi_pooling(external_function, node);
+                }
+
+                template <>
+                void CPULayout::LAYOUT_DECL(ngraph::op::v1::DeformablePSROIPooling)
+                {
+                    set_layouts_roi_pooling(external_function, node);
+                }
+
+                template <>
+                void CPULayout::LAYOUT_DECL(ngraph::op::v0::Sum)
+                {
+                    set_layouts_sum(external_function, node);
+                }
+
                 template <>
                 void CPULayout::LAYOUT_DECL(ngraph::op::v0::Convert)
                 {
@@ -2279,6 +2480,64 @@ namespace ngraph
                         set_output_layouts(node, o_mds);
                     }
                 }
+
+                // The layout a DNNL convolution picks for its data, undefined for other ops
+                static memory::desc get_convolution_src_md(const shared_ptr<Node>& node)
+                {
+                    vector<memory::desc> i_mds;
+                    vector<memory::desc> o_mds;
+                    if (!dnnl_utils::use_dnnl_kernel(node.get()))
+                    {
+                        return memory::desc();
+                    }
+                    if (is_type<ngraph::op::v0::Convolution>(node))
+                    {
+                        ConvolutionLayout<ngraph::op::v0::Convolution, false>(node, i_mds, o_mds);
+                    }
+                    else if (is_type<ngraph::op::ConvolutionRelu>(node))
+                    {
+                        ConvolutionLayout<ngraph::op::ConvolutionRelu, false>(node, i_mds, o_mds);
+                    }
+                    else if (is_type<ngraph::op::ConvolutionAdd>(node))
+                    {
+                        ConvolutionLayout<ngraph::op::ConvolutionAdd, false>(node, i_mds, o_mds);
+                    }
+                    else if (is_type<ngraph::op::v0::ConvolutionBias>(node))
+                    {
+                        ConvolutionLayout<ngraph::op::v0::ConvolutionBias, true>(
+                            node, i_mds, o_mds);
+                    }
+                    else if (is_type<ngraph::op::v0::ConvolutionBiasAdd>(node))
+                    {
+                        ConvolutionLayout<ngraph::op::v0::ConvolutionBiasAdd, true>(
+                            node, i_mds, o_mds);
+                    }
+                    return i_mds.empty() ? memory::desc() : i_mds[0];
+                }
+
+                // The frames are read native. When the only user is a DNNL convolution that
+                // picks nChw8c or nChw16c for its data, the output is written in that layout
+                // rather than reordered to it.
+                template <>
+                void CPULayout::LAYOUT_DECL(ngraph::op::Preprocess)
+                {
+                    vector<memory::desc> i_mds{dnnl_utils::create_default_dnnl_md(
+                        node.get(), 0, false, memory::FORMAT::nchw)};
+                    vector<memory::desc> o_mds{dnnl_utils::create_default_dnnl_md(
+                        node.get(), 0, true, memory::FORMAT::nchw)};
+                    auto users = node->output(0).get_target_inputs();
+                    if (users.size() == 1 && users.begin()->get_index() == 0)
+                    {
+                        auto src_md =
+                            get_convolution_src_md(users.begin()->get_node()->shared_from_this());
+                        if (dnnl_utils::get_channel_block_size(src_md) > 1)
+                        {
+                            o_mds[0] = src_md;
+                        }
+                    }
+                    node = insert_input_conversions(external_function, node, i_mds);
+                    set_output_layouts(node, o_mds);
+                }
             }
         }
     }
@@ -2289,6 +2548,7 @@ namespace ngraph
 static const runtime::cpu::pass::LayoutOpMap s_dispatcher{
     {TI(ngraph::op::v0::Concat), &runtime::cpu::pass::CPULayout::layout<ngraph::op::v0::Concat>},
     {TI(ngraph::op::v0::Convert), &runtime::cpu::pass::CPULayout::layout<ngraph::op::v0::Convert>},
+    {TI(ngraph::op::Preprocess), &runtime::cpu::pass::CPULayout::layout<ngraph::op::Preprocess>},
     {TI(ngraph::op::v0::AvgPool), &runtime::cpu::pass::CPULayout::layout<ngraph::op::v0::AvgPool>},
     {TI(ngraph::op::v0::AvgPoolBackprop),
      &runtime::cpu::pass::CPULayout::layout<ngraph::op::v0::AvgPoolBackprop>},
@@ -2360,10 +2620,20 @@ static const runtime::cpu::pass::LayoutOpMap s_dispatcher{
      &runtime::cpu::pass::CPULayout::layout<ngraph::op::v0::QuantizedDotBias>},
     {TI(ngraph::op::QuantizedMatmul),
      &runtime::cpu::pass::CPULayout::layout<ngraph::op::QuantizedMatmul>},
+    {TI(ngraph::op::v3::ROIAlign),
+     &runtime::cpu::pass::CPULayout::layout<ngraph::op::v3::ROIAlign>},
+    {TI(ngraph::op::v0::ROIPooling),
+     &runtime::cpu::pass::CPULayout::layout<ngraph::op::v0::ROIPooling>},
+    {TI(ngraph::op::v0::PSROIPooling),
+     &runtime::cpu::pass::CPULayout::layout<ngraph::op::v0::PSROIPooling>},
+    {TI(ngraph::op::v1::DeformablePSROIPooling),
+     &runtime::cpu::pass::CPULayout::layout<ngraph::op::v1::DeformablePSROIPooling>},
+    {TI(ngraph::op::v0::Sum), &runtime::cpu::pass::CPULayout::layout<ngraph::op::v0::Sum>},
 };
 
 bool runtime::cpu::pass::CPULayout::run_on_call_graph(const std::list<std::shared_ptr<Node>>& nodes)
 {
+    auto demands = compute_layout_demands(nodes);
     for (const auto& node : nodes)
     {
         auto& n = *node;
@@ -2378,7 +2648,7 @@ bool runtime::cpu::pass::CPULayout::run_on_call_graph(const std::list<std::share
         }
         else if (node->is_binary_elementwise_arithmetic())
         {
-            set_layouts_binaryeltwise(m_external_function, node);
+            set_layouts_binaryeltwise(m_external_function, node, demands);
         }
         else
         {
@@ -666,14 +666,26 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
         auto op = std::static_pointer_cast<op::Op>(node);
         if (auto op_annotations = op->get_op_annotations())
         {
-            for (auto oi_pair : op_annotations->get_in_place_oi_pairs())
+            // candidates only become in-place pairs when their input buffer is taken over
+            auto oi_pairs = op_annotations->get_in_place_oi_pairs();
+            size_t num_assigned_pairs = oi_pairs.size();
+            if (auto cpu_op_annotations =
+                    std::dynamic_pointer_cast<runtime::cpu::CPUOpAnnotations>(op_annotations))
+            {
+                auto& candidates = cpu_op_annotations->get_in_place_candidates();
+                oi_pairs.insert(oi_pairs.end(), candidates.begin(), candidates.end());
+            }
+            for (size_t i = 0; i < oi_pairs.size(); i++)
             {
+                auto oi_pair = oi_pairs[i];
                 auto output_tensor = &node->output(oi_pair.output).get_tensor();
                 auto input_tensor = &node->input_value(oi_pair.input).get_tensor();
                 auto input_op = node->input_value(oi_pair.input).get_node_shared_ptr();
 
+                // an output takes over the buffer of at most one of its inputs
                 if (oi_pair.destructive && node->liveness_free_list.count(input_tensor) != 0 &&
-                    node->liveness_new_list.count(output_tensor) != 0)
+                    node->liveness_new_list.count(output_tensor) != 0 &&
+                    no_new.count(output_tensor) == 0)
                 {
                     if (auto input_op_annotations = input_op->get_op_annotations())
                     {
@@ -745,6 +757,10 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
                     NGRAPH_DEBUG << "output_tensor is " << output_tensor->get_name();
                     no_free.insert(input_tensor);
                     no_new.insert(output_tensor);
+                    if (i >= num_assigned_pairs)
+                    {
+                        op_annotations->add_in_place_oi_pair(oi_pair);
+                    }
 
                     // set the tensor offset for tensors in the set containing the output tensor
                     // to the starting offset
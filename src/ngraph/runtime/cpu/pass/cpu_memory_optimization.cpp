@@ -249,6 +249,9 @@ bool runtime::cpu::pass::CPUMemoryOptimization::run_on_function(std::shared_ptr<
                 continue;
             }
 
+            // The slice is a contiguous part of its input when the axes after the last sliced
+            // one are whole and it keeps a single element of the axes before it, as a slice of
+            // one batch element or time step of a row does
             auto product = 1;
             int axis = in_shape.size() - 1;
             for (int i = in_shape.size() - 1; i >= 0; i--)
@@ -261,11 +264,11 @@ bool runtime::cpu::pass::CPUMemoryOptimization::run_on_function(std::shared_ptr<
             }
             for (int i = 0; i < axis; i++)
             {
-                product *= in_shape[i];
+                product *= out_shape[i];
             }
             if (product != 1)
             {
-                NGRAPH_DEBUG << "cpu_memory_optimization: The product of input shape "
+                NGRAPH_DEBUG << "cpu_memory_optimization: The product of output shape "
                                 "before slice axis is not 1, no in place slice";
                 continue;
             }
@@ -0,0 +1,329 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <unordered_set>
+
+#include "ngraph/log.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/sqrt.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/runtime/cpu/op/optimizer_update.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_optimizer_fusion.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    // Sets `scalar` to the value every element of `value` is: the element of a Broadcast of a
+    // single element, or a scalar Constant for a Constant with all elements equal. CPUCollapseDims
+    // may have reshaped the Broadcasts.
+    bool match_uniform(const Output<Node>& value, Output<Node>& scalar)
+    {
+        Node* node = value.get_node();
+        if (is_type<op::v0::Reshape>(node))
+        {
+            return match_uniform(node->input_value(0), scalar);
+        }
+        if (auto broadcast = as_type<op::v0::Broadcast>(node))
+        {
+            auto element = broadcast->input_value(0);
+            if (element.get_partial_shape().is_dynamic() || shape_size(element.get_shape()) != 1)
+            {
+                return false;
+            }
+            while (is_type<op::v0::Reshape>(element.get_node()))
+            {
+                element = element.get_node()->input_value(0);
+            }
+            scalar = element.get_shape().empty()
+                         ? element
+                         : make_shared<op::v0::Reshape>(
+                               element, get_default_order(element.get_shape()), Shape{});
+            return true;
+        }
+        else if (auto constant = as_type<op::v0::Constant>(node))
+        {
+            if (shape_size(constant->get_output_shape(0)) > 0 &&
+                constant->get_all_data_elements_bitwise_identical())
+            {
+                scalar = make_shared<op::v0::Constant>(
+                    constant->get_output_element_type(0), Shape{}, constant->get_data_ptr());
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Matches scale * x, in either order, for a uniform scale
+    bool match_scaled(const Output<Node>& value, Output<Node>& scale, Output<Node>& x)
+    {
+        auto multiply = as_type<op::v1::Multiply>(value.get_node());
+        if (multiply == nullptr)
+        {
+            return false;
+        }
+        for (size_t i = 0; i < 2; i++)
+        {
+            if (match_uniform(multiply->input_value(i), scale))
+            {
+                x = multiply->input_value(1 - i);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Matches beta * state + scale * term, in any order, where term is matched by
+    // match_term(term) and state is the other addend
+    bool match_decay(const Output<Node>& value,
+                     const function<bool(const Output<Node>&)>& match_term,
+                     Output<Node>& beta,
+                     Output<Node>& state,
+                     Output<Node>& scale)
+    {
+        auto add = as_type<op::v1::Add>(value.get_node());
+        if (add == nullptr)
+        {
+            return false;
+        }
+        for (size_t i = 0; i < 2; i++)
+        {
+            Output<Node> term;
+            if (match_scaled(add->input_value(i), scale, term) && match_term(term) &&
+                match_scaled(add->input_value(1 - i), beta, state))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // True if `node` is `target` or computed from it
+    bool depends_on(Node* node, const unordered_set<Node*>& targets)
+    {
+        unordered_set<Node*> visited;
+        vector<Node*> stack{node};
+        while (!stack.empty())
+        {
+            Node* current = stack.back();
+            stack.pop_back();
+            if (targets.count(current) != 0)
+            {
+                return true;
+            }
+            if (visited.insert(current).second)
+            {
+                for (auto& input : current->inputs())
+                {
+                    stack.push_back(input.get_source_output().get_node());
+                }
+            }
+        }
+        return false;
+    }
+
+    // The tensors an update reads and writes must all be static and like the new weights
+    bool are_like(const Output<Node>& weights, const OutputVector& tensors)
+    {
+        auto et = weights.get_element_type();
+        if ((et != element::f32 && et != element::f64) || weights.get_partial_shape().is_dynamic())
+        {
+            return false;
+        }
+        for (auto& tensor : tensors)
+        {
+            if (tensor.get_element_type() != et || tensor.get_partial_shape().is_dynamic() ||
+                tensor.get_shape() != weights.get_shape())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool has_control_edges(const Node* node)
+    {
+        return !node->get_control_dependencies().empty() ||
+               !node->get_control_dependents().empty();
+    }
+
+    // weights - learning_rate * velocity', velocity' = momentum * velocity + gradient
+    bool fuse_sgd_momentum(const shared_ptr<Node>& subtract)
+    {
+        Output<Node> weights = subtract->input_value(0);
+        Output<Node> learning_rate;
+        Output<Node> new_velocity;
+        if (!match_scaled(subtract->input_value(1), learning_rate, new_velocity))
+        {
+            return false;
+        }
+        auto add = as_type<op::v1::Add>(new_velocity.get_node());
+        if (add == nullptr || has_control_edges(add))
+        {
+            return false;
+        }
+        Output<Node> momentum;
+        Output<Node> velocity;
+        Output<Node> gradient;
+        bool matched = false;
+        for (size_t i = 0; i < 2 && !matched; i++)
+        {
+            if (match_scaled(add->input_value(i), momentum, velocity))
+            {
+                gradient = add->input_value(1 - i);
+                matched = true;
+            }
+        }
+        if (!matched || !are_like(subtract->output(0), {weights, velocity, gradient}) ||
+            depends_on(weights.get_node(), {add}) || depends_on(learning_rate.get_node(), {add}))
+        {
+            return false;
+        }
+
+        NGRAPH_DEBUG << "CPUOptimizerFusion: SGD with momentum update at "
+                     << subtract->get_name();
+        auto update = make_shared<op::SGDMomentumUpdate>(
+            weights, velocity, gradient, learning_rate, momentum);
+        new_velocity.replace(update->output(1));
+        subtract->output(0).replace(update->output(0));
+        return true;
+    }
+
+    // weights - learning_rate * m' / (sqrt(v') + epsilon), with
+    // m' = beta1 * m + one_minus_beta1 * gradient and
+    // v' = beta2 * v + one_minus_beta2 * gradient * gradient
+    bool fuse_adam(const shared_ptr<Node>& subtract)
+    {
+        Output<Node> weights = subtract->input_value(0);
+        Output<Node> step = subtract->input_value(1);
+
+        // learning_rate * m' / d or learning_rate * (m' / d)
+        Output<Node> learning_rate;
+        Output<Node> new_m;
+        Output<Node> denominator;
+        Output<Node> quotient;
+        if (auto divide = as_type<op::v1::Divide>(step.get_node()))
+        {
+            if (!match_scaled(divide->input_value(0), learning_rate, new_m))
+            {
+                return false;
+            }
+            denominator = divide->input_value(1);
+        }
+        else if (match_scaled(step, learning_rate, quotient) &&
+                 is_type<op::v1::Divide>(quotient.get_node()))
+        {
+            new_m = quotient.get_node()->input_value(0);
+            denominator = quotient.get_node()->input_value(1);
+        }
+        else
+        {
+            return false;
+        }
+
+        auto add_epsilon = as_type<op::v1::Add>(denominator.get_node());
+        if (add_epsilon == nullptr)
+        {
+            return false;
+        }
+        Output<Node> epsilon;
+        Output<Node> new_v;
+        bool matched = false;
+        for (size_t i = 0; i < 2 && !matched; i++)
+        {
+            auto sqrt = as_type<op::v0::Sqrt>(add_epsilon->get_input_node_ptr(i));
+            if (sqrt != nullptr && match_uniform(add_epsilon->input_value(1 - i), epsilon))
+            {
+                new_v = sqrt->input_value(0);
+                matched = true;
+            }
+        }
+        if (!matched)
+        {
+            return false;
+        }
+
+        Output<Node> gradient;
+        auto is_square = [&gradient](const Output<Node>& term) {
+            auto multiply = as_type<op::v1::Multiply>(term.get_node());
+            if (multiply == nullptr || multiply->input_value(0) != multiply->input_value(1))
+            {
+                return false;
+            }
+            gradient = multiply->input_value(0);
+            return true;
+        };
+        auto is_gradient = [&gradient](const Output<Node>& term) { return term == gradient; };
+        Output<Node> beta1;
+        Output<Node> m;
+        Output<Node> one_minus_beta1;
+        Output<Node> beta2;
+        Output<Node> v;
+        Output<Node> one_minus_beta2;
+        if (!match_decay(new_v, is_square, beta2, v, one_minus_beta2) ||
+            !match_decay(new_m, is_gradient, beta1, m, one_minus_beta1) ||
+            has_control_edges(new_m.get_node()) || has_control_edges(new_v.get_node()) ||
+            !are_like(subtract->output(0), {weights, m, v, gradient}))
+        {
+            return false;
+        }
+        unordered_set<Node*> state{new_m.get_node(), new_v.get_node()};
+        if (depends_on(weights.get_node(), state) || depends_on(learning_rate.get_node(), state) ||
+            depends_on(epsilon.get_node(), state))
+        {
+            return false;
+        }
+
+        NGRAPH_DEBUG << "CPUOptimizerFusion: Adam update at " << subtract->get_name();
+        auto update = make_shared<op::AdamUpdate>(weights,
+                                                  m,
+                                                  v,
+                                                  gradient,
+                                                  learning_rate,
+                                                  beta1,
+                                                  one_minus_beta1,
+                                                  beta2,
+                                                  one_minus_beta2,
+                                                  epsilon);
+        new_m.replace(update->output(1));
+        new_v.replace(update->output(2));
+        subtract->output(0).replace(update->output(0));
+        return true;
+    }
+}
+
+bool runtime::cpu::pass::CPUOptimizerFusion::run_on_function(shared_ptr<Function> function)
+{
+    bool replaced = false;
+    for (auto& node : function->get_ordered_ops())
+    {
+        if (!is_type<op::v1::Subtract>(node) || has_control_edges(node.get()))
+        {
+            continue;
+        }
+        if (fuse_adam(node) || fuse_sgd_momentum(node))
+        {
+            replaced = true;
+        }
+    }
+    return replaced;
+}
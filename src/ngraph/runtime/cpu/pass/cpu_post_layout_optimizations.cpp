@@ -31,6 +31,7 @@
 #include "ngraph/pattern/matcher.hpp"
 #include "ngraph/pattern/op/label.hpp"
 #include "ngraph/pattern/op/skip.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
@@ -275,15 +276,15 @@ void ngraph::runtime::cpu::pass::CPUPostLayoutOptimizations::
 }
 
 // fold Constant + ConvertLayout to Constant
-template <typename T>
 static shared_ptr<ngraph::op::v0::Constant> fold_constant_convertlayout_helper(
     const shared_ptr<op::v0::Constant>& input,
     const shared_ptr<runtime::cpu::op::ConvertLayout>& convertlayout,
     dnnl::memory::desc& input_desc,
     dnnl::memory::desc& result_desc)
 {
-    std::vector<T> result_vec(convertlayout->get_output_tensor(0).size() /
-                              input->get_output_element_type(0).size());
+    // Padded layouts take more space than the plain constant, so the result is held in a buffer
+    // of the layout's size
+    auto result_buffer = make_shared<runtime::AlignedBuffer>(result_desc.get_size());
 
     bool input_format_is_nchw = runtime::cpu::dnnl_utils::dnnl_md_matches_format_tag(
         input_desc.data, dnnl::memory::format_tag::nchw);
@@ -332,14 +333,15 @@ static shared_ptr<ngraph::op::v0::Constant> fold_constant_convertlayout_helper(
 
     // build dnnl primitive and execute
     dnnl::memory in{input_desc,
-                    runtime::cpu::executor::global_cpu_engine,
+                    runtime::cpu::executor::get_cpu_engine(),
                     const_cast<void*>(input->get_data_ptr())};
-    dnnl::memory out{result_desc, runtime::cpu::executor::global_cpu_engine, result_vec.data()};
+    dnnl::memory out{
+        result_desc, runtime::cpu::executor::get_cpu_engine(), result_buffer->get_ptr()};
     dnnl::reorder reorder{in, out};
 
     std::unordered_map<int, dnnl::memory> exec_args = {{DNNL_ARG_SRC, in}, {DNNL_ARG_DST, out}};
 
-    dnnl::stream s(runtime::cpu::executor::global_cpu_engine);
+    dnnl::stream s(runtime::cpu::executor::get_cpu_engine());
     try
     {
         reorder.execute(s, exec_args);
@@ -350,8 +352,9 @@ static shared_ptr<ngraph::op::v0::Constant> fold_constant_convertlayout_helper(
         throw ngraph_error("Could not run mkdnn primitive " + std::string(e.message));
     }
 
-    return make_shared<ngraph::op::v0::Constant>(
-        convertlayout->get_output_element_type(0), convertlayout->get_output_shape(0), result_vec);
+    return make_shared<ngraph::op::v0::Constant>(convertlayout->get_output_element_type(0),
+                                                 convertlayout->get_output_shape(0),
+                                                 result_buffer);
 }
 
 bool ngraph::runtime::cpu::pass::CPUConvertLayoutConstantFolding::run_on_function(
@@ -364,90 +367,20 @@ bool ngraph::runtime::cpu::pass::CPUConvertLayoutConstantFolding::run_on_functio
         {
             auto m_convertlayout = static_pointer_cast<runtime::cpu::op::ConvertLayout>(n);
             auto output_md = dnnl_utils::get_output_dnnl_md(m_convertlayout.get(), 0);
-            // do not do constant folding if the output is padded data layout
-            if (dnnl_utils::is_dnnl_padded_layout(
-                    output_md, ngraph::get_default_order(m_convertlayout->get_output_shape(0))))
-            {
-                continue;
-            }
-
             auto arg = m_convertlayout->get_input_node_shared_ptr(0);
             if (is_type<ngraph::op::v0::Constant>(arg))
             {
                 auto m_input = static_pointer_cast<ngraph::op::v0::Constant>(arg);
                 auto input_md = dnnl_utils::get_input_dnnl_md(m_convertlayout.get(), 0);
 
-                std::shared_ptr<ngraph::op::v0::Constant> replacement;
-
-                switch (m_input->get_output_element_type(0))
-                {
-                case element::Type_t::undefined:
-                    NGRAPH_CHECK(
-                        false,
-                        "Encountered 'undefined' element type in construct_constant_convertlayout");
-                    break;
-                case element::Type_t::dynamic:
-                    NGRAPH_CHECK(
-                        false,
-                        "Encountered 'dynamic' element type in construct_constant_convertlayout");
-                    break;
-                case element::Type_t::u1:
-                    NGRAPH_CHECK(
-                        false, "Encountered 'u1' element type in construct_constant_convertlayout");
-                    break;
-                case element::Type_t::boolean:
-                    replacement = fold_constant_convertlayout_helper<char>(
-                        m_input, m_convertlayout, input_md, output_md);
-                    break;
-                case element::Type_t::bf16:
-                    replacement = fold_constant_convertlayout_helper<bfloat16>(
-                        m_input, m_convertlayout, input_md, output_md);
-                    break;
-                case element::Type_t::f16:
-                    replacement = fold_constant_convertlayout_helper<float16>(
-                        m_input, m_convertlayout, input_md, output_md);
-                    break;
-                case element::Type_t::f32:
-                    replacement = fold_constant_convertlayout_helper<float>(
-                        m_input, m_convertlayout, input_md, output_md);
-                    break;
-                case element::Type_t::f64:
-                    replacement = fold_constant_convertlayout_helper<double>(
-                        m_input, m_convertlayout, input_md, output_md);
-                    break;
-                case element::Type_t::i8:
-                    replacement = fold_constant_convertlayout_helper<int8_t>(
-                        m_input, m_convertlayout, input_md, output_md);
-                    break;
-                case element::Type_t::i16:
-                    replacement = fold_constant_convertlayout_helper<int16_t>(
-                        m_input, m_convertlayout, input_md, output_md);
-                    break;
-                case element::Type_t::i32:
-                    replacement = fold_constant_convertlayout_helper<int32_t>(
-                        m_input, m_convertlayout, input_md, output_md);
-                    break;
-                case element::Type_t::i64:
-                    replacement = fold_constant_convertlayout_helper<int64_t>(
-                        m_input, m_convertlayout, input_md, output_md);
-                    break;
-                case element::Type_t::u8:
-                    replacement = fold_constant_convertlayout_helper<uint8_t>(
-                        m_input, m_convertlayout, input_md, output_md);
-                    break;
-                case element::Type_t::u16:
-                    replacement = fold_constant_convertlayout_helper<uint16_t>(
-                        m_input, m_convertlayout, input_md, output_md);
-                    break;
-                case element::Type_t::u32:
-                    replacement = fold_constant_convertlayout_helper<uint32_t>(
-                        m_input, m_convertlayout, input_md, output_md);
-                    break;
-                case element::Type_t::u64:
-                    replacement = fold_constant_convertlayout_helper<uint64_t>(
-                        m_input, m_convertlayout, input_md, output_md);
-                    break;
-                }
+                auto element_type = m_input->get_output_element_type(0);
+                NGRAPH_CHECK(element_type.is_static() && element_type != element::undefined &&
+                                 element_type != element::u1,
+                             "Encountered '",
+                             element_type,
+                             "' element type in construct_constant_convertlayout");
+                auto replacement = fold_constant_convertlayout_helper(
+                    m_input, m_convertlayout, input_md, output_md);
 
                 auto tv = replacement->get_output_tensor_ptr(0);
                 auto layout = std::make_shared<ngraph::runtime::cpu::LayoutDescriptor>(*tv);
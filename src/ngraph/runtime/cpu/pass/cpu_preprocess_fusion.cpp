@@ -0,0 +1,224 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/pass/cpu_preprocess_fusion.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/convert.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/interpolate.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/op/transpose.hpp"
+#include "ngraph/runtime/cpu/op/preprocess.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// The values of an f32 Constant numpy broadcast against a 4D tensor with `channels` channels on
+// `channel_axis`: one value for all of them, or one per channel
+static bool get_channel_values(const Output<Node>& output,
+                               size_t channel_axis,
+                               size_t channels,
+                               vector<float>& values)
+{
+    auto constant = as_type_ptr<op::v0::Constant>(output.get_node_shared_ptr());
+    if (!constant || constant->get_output_element_type(0) != element::f32)
+    {
+        return false;
+    }
+    const Shape& shape = constant->get_output_shape(0);
+    if (shape.size() > 4 || shape_size(shape) == 0)
+    {
+        return false;
+    }
+    size_t offset = 4 - shape.size();
+    for (size_t i = 0; i < shape.size(); i++)
+    {
+        if (shape[i] != 1 && (i + offset != channel_axis || shape[i] != channels))
+        {
+            return false;
+        }
+    }
+    auto data = constant->get_vector<float>();
+    values.resize(channels);
+    for (size_t c = 0; c < channels; c++)
+    {
+        values[c] = data.size() == 1 ? data[0] : data[c];
+    }
+    return true;
+}
+
+namespace
+{
+    struct PreprocessMatch
+    {
+        size_t length{0};
+        op::v3::Interpolate::InterpolateAttrs resize_attrs;
+        vector<float> scale;
+        vector<float> shift;
+    };
+}
+
+// What a Preprocess of `frames` computes of the start of `chain`. The length is 0 if it is not
+// worth fusing.
+static PreprocessMatch match_preprocess(const Output<Node>& frames,
+                                        const NodeVector& chain,
+                                        bool channels_last)
+{
+    PreprocessMatch match;
+    size_t channels = frames.get_shape()[channels_last ? 3 : 1];
+    size_t height_axis = channels_last ? 1 : 2;
+    match.scale.assign(channels, 1.0f);
+    match.shift.assign(channels, 0.0f);
+
+    size_t i = 0;
+    Output<Node> value = frames;
+    auto at = [&](size_t index) { return index < chain.size() ? chain[index] : nullptr; };
+    if (frames.get_element_type() != element::f32)
+    {
+        auto convert = as_type_ptr<op::v0::Convert>(at(i));
+        if (!convert || convert->get_convert_element_type() != element::f32)
+        {
+            return PreprocessMatch();
+        }
+        value = chain[i++];
+    }
+
+    if (auto resize = as_type_ptr<op::v3::Interpolate>(at(i)))
+    {
+        const auto& attrs = resize->get_attrs();
+        bool spatial = !attrs.axes.empty();
+        for (auto axis : attrs.axes)
+        {
+            spatial = spatial && (axis == height_axis || axis == height_axis + 1);
+        }
+        if (spatial && !attrs.antialias && resize->get_output_partial_shape(0).is_static())
+        {
+            match.resize_attrs = attrs;
+            value = chain[i++];
+        }
+    }
+
+    for (; i < chain.size(); i++)
+    {
+        auto node = chain[i];
+        bool add = is_type<op::v1::Add>(node);
+        bool subtract = is_type<op::v1::Subtract>(node);
+        bool multiply = is_type<op::v1::Multiply>(node);
+        bool divide = is_type<op::v1::Divide>(node);
+        if ((!add && !subtract && !multiply && !divide) ||
+            node->get_autob().m_type == op::AutoBroadcastType::PDPD ||
+            node->get_output_shape(0) != value.get_shape())
+        {
+            break;
+        }
+        size_t arg = node->input_value(0) == value ? 1 : 0;
+        vector<float> values;
+        if (node->input_value(1 - arg) != value || ((subtract || divide) && arg == 0) ||
+            !get_channel_values(
+                node->input_value(arg), channels_last ? 3 : 1, channels, values))
+        {
+            break;
+        }
+        for (size_t c = 0; c < channels; c++)
+        {
+            if (add || subtract)
+            {
+                match.shift[c] += add ? values[c] : -values[c];
+            }
+            else
+            {
+                float factor = multiply ? values[c] : 1.0f / values[c];
+                match.scale[c] *= factor;
+                match.shift[c] *= factor;
+            }
+        }
+        value = node;
+    }
+
+    if (channels_last)
+    {
+        auto transpose = as_type_ptr<op::v1::Transpose>(at(i));
+        auto order = transpose ? as_type_ptr<op::v0::Constant>(
+                                     transpose->input_value(1).get_node_shared_ptr())
+                               : nullptr;
+        if (!order || order->cast_vector<int64_t>() != vector<int64_t>{0, 3, 1, 2})
+        {
+            return PreprocessMatch();
+        }
+        i++;
+    }
+    match.length = i >= 2 ? i : 0;
+    return match;
+}
+
+bool runtime::cpu::pass::CPUPreprocessFusion::run_on_function(shared_ptr<Function> function)
+{
+    bool replaced = false;
+    for (auto& parameter : function->get_parameters())
+    {
+        auto et = parameter->get_element_type();
+        if ((et != element::u8 && et != element::i8 && et != element::f32) ||
+            !parameter->get_output_partial_shape(0).is_static() ||
+            parameter->get_output_shape(0).size() != 4)
+        {
+            continue;
+        }
+
+        // The nodes each using the only output of the one before
+        NodeVector chain;
+        Output<Node> value = parameter->output(0);
+        while (value.get_target_inputs().size() == 1)
+        {
+            auto node = value.get_target_inputs().begin()->get_node()->shared_from_this();
+            if (node->get_output_size() != 1 || node->is_output() ||
+                node->get_output_partial_shape(0).is_dynamic())
+            {
+                break;
+            }
+            chain.push_back(node);
+            value = node->output(0);
+        }
+
+        bool channels_last = true;
+        auto match = match_preprocess(parameter->output(0), chain, channels_last);
+        if (match.length == 0)
+        {
+            channels_last = false;
+            match = match_preprocess(parameter->output(0), chain, channels_last);
+        }
+        if (match.length == 0)
+        {
+            continue;
+        }
+
+        auto last = chain[match.length - 1];
+        NGRAPH_DEBUG << "CPUPreprocessFusion: fusing " << match.length << " ops from "
+                     << parameter->get_name() << " to " << last->get_name();
+        auto preprocess = make_shared<ngraph::op::Preprocess>(parameter,
+                                                              channels_last,
+                                                              last->get_output_shape(0),
+                                                              match.resize_attrs,
+                                                              match.scale,
+                                                              match.shift);
+        replace_node(last, preprocess);
+        replaced = true;
+    }
+    return replaced;
+}
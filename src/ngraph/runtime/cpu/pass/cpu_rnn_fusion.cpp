@@ -32,7 +32,6 @@
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/dot.hpp"
 #include "ngraph/op/exp.hpp"
-#include "ngraph/op/lstm_cell.hpp"
 #include "ngraph/op/multiply.hpp"
 #include "ngraph/op/negative.hpp"
 #include "ngraph/op/parameter.hpp"
@@ -141,107 +140,6 @@ void ngraph::runtime::cpu::pass::VanillaRNNFusion::construct_vanilla_rnn()
     this->add_matcher(m, callback);
 }
 
-void ngraph::runtime::cpu::pass::LSTMFusion::construct_onnx_lstmcell_fprop()
-{
-    size_t ref_batch_size = 2;
-    size_t ref_input_size = 3;
-    size_t ref_hidden_size = 3;
-    size_t ref_gates_count = 4;
-
-    auto X =
-        std::make_shared<pattern::op::Label>(element::f32, Shape{ref_batch_size, ref_input_size});
-    auto W = std::make_shared<pattern::op::Label>(
-        element::f32, Shape{ref_gates_count * ref_hidden_size, ref_input_size});
-    auto R = std::make_shared<pattern::op::Label>(
-        element::f32, Shape{ref_gates_count * ref_hidden_size, ref_hidden_size});
-    auto B = std::make_shared<pattern::op::Label>(element::f32,
-                                                  Shape{ref_gates_count * ref_hidden_size});
-    auto peep_hole = std::make_shared<pattern::op::Label>(element::f32, Shape{3 * ref_hidden_size});
-    auto H_t =
-        std::make_shared<pattern::op::Label>(element::f32, Shape{ref_batch_size, ref_hidden_size});
-    auto C_t =
-        std::make_shared<pattern::op::Label>(element::f32, Shape{ref_batch_size, ref_hidden_size});
-
-    auto ref_lstm_cell =
-        std::make_shared<op::v0::LSTMCell>(X,
-                                           H_t,
-                                           C_t,
-                                           W,
-                                           R,
-                                           B,
-                                           peep_hole,
-                                           ref_hidden_size,
-                                           op::LSTMWeightsFormat::IOFC,
-                                           std::vector<std::string>{"sigmoid", "tanh", "tanh"},
-                                           std::vector<float>{},
-                                           std::vector<float>{},
-                                           0.f,
-                                           false);
-
-    auto callback = [X, W, R, H_t, C_t](pattern::Matcher& m) {
-        NGRAPH_DEBUG << "In construct_onnx_lstmcell_fprop callback against " << *m.get_match_root();
-        auto pattern_map = m.get_pattern_map();
-        ngraph::runtime::cpu::rnn_utils::rnntype rnn_type =
-            ngraph::runtime::cpu::rnn_utils::rnntype::vanilla_lstm;
-
-        auto lstmcell_op = m.get_match_root_as<op::v0::LSTMCell>();
-        NGRAPH_CHECK(lstmcell_op,
-                     "match root node ",
-                     *m.get_match_root(),
-                     " not of type `op::v0::LSTMCell`");
-        auto src_iter = std::make_shared<ngraph::op::v0::Concat>(
-            OutputVector{pattern_map[H_t], pattern_map[C_t]}, 0);
-
-        auto W_ifco = lstmcell_op->get_argument(3);
-        auto R_ifco = lstmcell_op->get_argument(4);
-        auto bias_ifco = lstmcell_op->get_argument(5);
-
-        // We need to reorder W, R and bias to IFCO gate order.
-        // Note: ie.: ONNX runtime provides W, R and bias in the gate order [IOFC] but
-        // DNNL computes LSTM kernel in the [IFCO] order.
-        if (lstmcell_op->get_weights_format() != op::LSTMWeightsFormat::IFCO)
-        {
-            W_ifco = lstmcell_op->convert_node_format(W_ifco);
-            R_ifco = lstmcell_op->convert_node_format(R_ifco);
-            bias_ifco = lstmcell_op->convert_node_format(bias_ifco);
-        }
-
-        auto W_reshape = std::make_shared<op::v0::Reshape>(
-            W_ifco,
-            AxisVector{1, 0},
-            Shape{W_ifco->get_output_shape(0)[1], W_ifco->get_output_shape(0)[0]});
-        auto R_reshape = std::make_shared<op::v0::Reshape>(
-            R_ifco,
-            AxisVector{1, 0},
-            Shape{R_ifco->get_output_shape(0)[1], R_ifco->get_output_shape(0)[0]});
-
-        auto lstm_node = std::make_shared<ngraph::op::Lstm>(pattern_map[X],
-                                                            pattern_map[H_t],
-                                                            pattern_map[C_t],
-                                                            W_reshape,
-                                                            R_reshape,
-                                                            bias_ifco,
-                                                            rnn_type);
-        if (lstm_node->get_output_size() != 3)
-        {
-            throw ngraph_error("Lstm node doesnt have three outputs");
-        }
-
-        auto dst_layer = m.get_match_value().get_node()->output(0);
-        auto dst_iter = m.get_match_value().get_node()->output(1);
-        // dst_iter of lstm dnnl output holds the results of both recurrent state
-        // tensor outputs. we need to slice the ct.
-        // find the user's for {ht} and replace them with lstm output 2
-        dst_iter.replace(lstm_node->output(2));
-        // find the user's for {ht} and replace them with lstm output 1
-        dst_layer.replace(lstm_node->output(1));
-        return true;
-    };
-
-    auto m = std::make_shared<ngraph::pattern::Matcher>(ref_lstm_cell, "LSTMFusion.onnx_lstm_cell");
-    this->add_matcher(m, callback);
-}
-
 void ngraph::runtime::cpu::pass::LSTMFusion::construct_sigmoid()
 {
     // construct variance
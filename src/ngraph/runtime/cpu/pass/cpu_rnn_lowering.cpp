@@ -0,0 +1,278 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <map>
+
+#include "ngraph/builder/split.hpp"
+#include "ngraph/op/concat.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/gru_cell.hpp"
+#include "ngraph/op/lstm_cell.hpp"
+#include "ngraph/op/lstm_sequence.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/reverse.hpp"
+#include "ngraph/runtime/cpu/op/lstm.hpp"
+#include "ngraph/runtime/cpu/op/rnn.hpp"
+#include "ngraph/runtime/cpu/op/rnn_utils.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_rnn_lowering.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// All inputs are static f32 tensors, the only type of the DNNL RNN primitives
+static bool has_f32_inputs(const Node& node)
+{
+    for (const auto& input : node.inputs())
+    {
+        if (input.get_element_type() != element::f32 || input.get_partial_shape().is_dynamic())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// DNNL has neither clipping nor configurable activations for its LSTM and GRU cells
+static bool has_default_activations(const vector<string>& activations,
+                                    const vector<float>& activations_alpha,
+                                    const vector<float>& activations_beta,
+                                    float clip,
+                                    const vector<string>& default_activations)
+{
+    return activations == default_activations && activations_alpha.empty() &&
+           activations_beta.empty() && clip == 0.f;
+}
+
+// DNNL LSTM has no peepholes, so they must be a constant of zeros
+static bool is_zero_constant(const Output<Node>& value)
+{
+    auto constant = as_type_ptr<op::v0::Constant>(value.get_node_shared_ptr());
+    if (!constant)
+    {
+        return false;
+    }
+    auto values = constant->cast_vector<float>();
+    return all_of(values.begin(), values.end(), [](float v) { return v == 0.f; });
+}
+
+// Reorders the four LSTM gates along axis to the IFCO order of DNNL
+static Output<Node> to_ifco(const Output<Node>& value, op::LSTMWeightsFormat format, int axis)
+{
+    static const map<op::LSTMWeightsFormat, vector<size_t>> gate_order_conversion_map{
+        {op::LSTMWeightsFormat::FICO, {1, 0, 2, 3}},
+        {op::LSTMWeightsFormat::ICOF, {0, 3, 1, 2}},
+        {op::LSTMWeightsFormat::IFOC, {0, 1, 3, 2}},
+        {op::LSTMWeightsFormat::IOFC, {0, 2, 3, 1}},
+    };
+    if (format == op::LSTMWeightsFormat::IFCO)
+    {
+        return value;
+    }
+    OutputVector gates = builder::split(value, 4, axis);
+    OutputVector ifco_gates;
+    for (size_t gate : gate_order_conversion_map.at(format))
+    {
+        ifco_gates.push_back(gates.at(gate));
+    }
+    return make_shared<op::v0::Concat>(ifco_gates, axis);
+}
+
+// Weights of shape [gates * hidden, input], or [directions, gates * hidden, input], to the ldigo
+// layout of DNNL, [directions * input, gates * hidden]
+static Output<Node> to_ldigo(const Output<Node>& weights)
+{
+    const Shape& shape = weights.get_shape();
+    if (shape.size() == 2)
+    {
+        return make_shared<op::v0::Reshape>(weights, AxisVector{1, 0}, Shape{shape[1], shape[0]});
+    }
+    return make_shared<op::v0::Reshape>(
+        weights, AxisVector{0, 2, 1}, Shape{shape[0] * shape[2], shape[1]});
+}
+
+static bool lower_lstm_cell(const shared_ptr<op::v0::LSTMCell>& cell)
+{
+    if (!has_f32_inputs(*cell) ||
+        !has_default_activations(cell->get_activations(),
+                                 cell->get_activations_alpha(),
+                                 cell->get_activations_beta(),
+                                 cell->get_clip(),
+                                 {"sigmoid", "tanh", "tanh"}) ||
+        cell->get_input_forget() || !is_zero_constant(cell->input_value(6)))
+    {
+        return false;
+    }
+
+    auto format = cell->get_weights_format();
+    auto lstm = make_shared<op::Lstm>(cell->input_value(0),
+                                      cell->input_value(1),
+                                      cell->input_value(2),
+                                      to_ldigo(to_ifco(cell->input_value(3), format, 0)),
+                                      to_ldigo(to_ifco(cell->input_value(4), format, 0)),
+                                      to_ifco(cell->input_value(5), format, 0),
+                                      runtime::cpu::rnn_utils::rnntype::vanilla_lstm);
+    cell->output(0).replace(lstm->output(1));
+    cell->output(1).replace(lstm->output(2));
+    return true;
+}
+
+static bool lower_lstm_sequence(const shared_ptr<op::v0::LSTMSequence>& sequence)
+{
+    using direction = op::v0::LSTMSequence::direction;
+    if (!has_f32_inputs(*sequence) ||
+        !has_default_activations(sequence->get_activations(),
+                                 sequence->get_activations_alpha(),
+                                 sequence->get_activations_beta(),
+                                 sequence->get_clip_threshold(),
+                                 {"sigmoid", "tanh", "tanh"}) ||
+        sequence->get_input_forget() || !is_zero_constant(sequence->input_value(7)))
+    {
+        return false;
+    }
+
+    // X is [seq_length, batch_size, input_size] and the states are [num_directions,
+    // batch_size, hidden_size]
+    const Shape& x_shape = sequence->get_input_shape(0);
+    size_t seq_length = x_shape.at(0);
+    size_t batch_size = x_shape.at(1);
+    size_t input_size = x_shape.at(2);
+    size_t num_directions = sequence->get_input_shape(1).at(0);
+    size_t hidden_size = static_cast<size_t>(sequence->get_hidden_size());
+    if (sequence->get_output_shape(0) !=
+        Shape{seq_length, num_directions, batch_size, hidden_size})
+    {
+        return false;
+    }
+
+    // DNNL runs every batch over the whole sequence
+    auto seq_lengths =
+        as_type_ptr<op::v0::Constant>(sequence->input_value(3).get_node_shared_ptr());
+    if (!seq_lengths)
+    {
+        return false;
+    }
+    for (int64_t length : seq_lengths->cast_vector<int64_t>())
+    {
+        if (length != static_cast<int64_t>(seq_length))
+        {
+            return false;
+        }
+    }
+
+    // The reverse direction runs forward on the reversed sequence; bidirectional sequences
+    // concatenate the two directions in DNNL itself
+    bool is_reverse = sequence->get_direction() == direction::REVERSE;
+    Output<Node> X = sequence->input_value(0);
+    if (is_reverse)
+    {
+        X = make_shared<op::v0::Reverse>(X, AxisSet{0});
+    }
+    auto format = sequence->get_weights_format();
+    auto rnn = make_shared<op::Rnn>(
+        make_shared<op::v0::Reshape>(
+            X, AxisVector{0, 1, 2}, Shape{seq_length * batch_size, input_size}),
+        make_shared<op::v0::Reshape>(sequence->input_value(1),
+                                     AxisVector{0, 1, 2},
+                                     Shape{num_directions * batch_size, hidden_size}),
+        make_shared<op::v0::Reshape>(sequence->input_value(2),
+                                     AxisVector{0, 1, 2},
+                                     Shape{num_directions * batch_size, hidden_size}),
+        to_ldigo(to_ifco(sequence->input_value(4), format, 1)),
+        to_ldigo(to_ifco(sequence->input_value(5), format, 1)),
+        make_shared<op::v0::Reshape>(to_ifco(sequence->input_value(6), format, 1),
+                                     AxisVector{0, 1},
+                                     Shape{num_directions * 4 * hidden_size}),
+        seq_length,
+        4,
+        seq_length,
+        2,
+        num_directions,
+        1,
+        runtime::cpu::rnn_utils::rnntype::vanilla_lstm);
+
+    // The layer output is [seq_length * batch_size, num_directions * hidden_size]
+    Output<Node> Y = make_shared<op::v0::Reshape>(
+        rnn->output(0),
+        AxisVector{0, 1},
+        Shape{seq_length, batch_size, num_directions, hidden_size});
+    Y = make_shared<op::v0::Reshape>(
+        Y, AxisVector{0, 2, 1, 3}, Shape{seq_length, num_directions, batch_size, hidden_size});
+    if (is_reverse)
+    {
+        Y = make_shared<op::v0::Reverse>(Y, AxisSet{0});
+    }
+    Shape state_shape{num_directions, batch_size, hidden_size};
+    sequence->output(0).replace(Y);
+    sequence->output(1).replace(
+        make_shared<op::v0::Reshape>(rnn->output(1), AxisVector{0, 1}, state_shape));
+    sequence->output(2).replace(
+        make_shared<op::v0::Reshape>(rnn->output(2), AxisVector{0, 1}, state_shape));
+    return true;
+}
+
+static bool lower_gru_cell(const shared_ptr<op::v3::GRUCell>& cell)
+{
+    if (!has_f32_inputs(*cell) || !has_default_activations(cell->get_activations(),
+                                                           cell->get_activations_alpha(),
+                                                           cell->get_activations_beta(),
+                                                           cell->get_clip(),
+                                                           {"sigmoid", "tanh"}))
+    {
+        return false;
+    }
+
+    // The zrh gates are the update, reset and candidate gates of DNNL, in the same order, and
+    // the bias of the linear before reset variant is laid out as the one of lbr_gru
+    auto rnn_type = cell->get_linear_before_reset()
+                        ? runtime::cpu::rnn_utils::rnntype::lbr_gru
+                        : runtime::cpu::rnn_utils::rnntype::vanilla_gru;
+    auto rnn = make_shared<op::Rnn>(cell->input_value(0),
+                                    cell->input_value(1),
+                                    to_ldigo(cell->input_value(2)),
+                                    to_ldigo(cell->input_value(3)),
+                                    cell->input_value(4),
+                                    1,
+                                    3,
+                                    1,
+                                    1,
+                                    1,
+                                    1,
+                                    rnn_type);
+    cell->output(0).replace(rnn->output(0));
+    return true;
+}
+
+bool runtime::cpu::pass::CPURNNLowering::run_on_function(shared_ptr<Function> function)
+{
+    bool modified = false;
+    for (const auto& node : function->get_ordered_ops())
+    {
+        if (auto cell = as_type_ptr<op::v0::LSTMCell>(node))
+        {
+            modified |= lower_lstm_cell(cell);
+        }
+        else if (auto sequence = as_type_ptr<op::v0::LSTMSequence>(node))
+        {
+            modified |= lower_lstm_sequence(sequence);
+        }
+        else if (auto gru_cell = as_type_ptr<op::v3::GRUCell>(node))
+        {
+            modified |= lower_gru_cell(gru_cell);
+        }
+    }
+    return modified;
+}
@@ -0,0 +1,46 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace pass
+            {
+                /// \brief Lowers LSTMCell, LSTMSequence and GRUCell to the Lstm and Rnn ops that
+                ///        run on DNNL RNN primitives, before they are decomposed.
+                ///
+                /// The weights are transposed and their gates reordered to the DNNL layout by
+                /// nodes that constant folding evaluates at compile time. Cells with peepholes,
+                /// clipping, coupled input and forget gates or activations other than the
+                /// defaults have no DNNL equivalent and are left to the decomposition, as are
+                /// sequences whose lengths differ between batches.
+                class CPU_BACKEND_API CPURNNLowering : public ngraph::pass::FunctionPass
+                {
+                public:
+                    bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+                };
+            }
+        }
+    }
+}
@@ -0,0 +1,152 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/cpu/pass/cpu_sparse_weights_conversion.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/runtime/cpu/op/sparse_dot.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Block widths tried, widest first; the SparseDot builder has kernels for each
+static const size_t s_block_widths[] = {16, 8, 4, 1};
+
+// The weights [k, n] of a Dot, read from a Constant [k, n] or from a Constant [n, k] through a
+// transposing Reshape, as MatMuls with transposed weights are decomposed
+static const op::v0::Constant* get_weights(const Node* dot, bool& transposed)
+{
+    const Node* weights = dot->get_input_node_ptr(1);
+    transposed = false;
+    if (auto reshape = as_type<const op::v0::Reshape>(weights))
+    {
+        if (reshape->get_input_shape(0).size() != 2 || !reshape->get_is_transpose() ||
+            reshape->get_input_order() != AxisVector{1, 0})
+        {
+            return nullptr;
+        }
+        transposed = true;
+        weights = reshape->get_input_node_ptr(0);
+    }
+    auto constant = as_type<const op::v0::Constant>(weights);
+    return constant && constant->get_output_element_type(0) == element::f32 &&
+                   constant->get_output_shape(0).size() == 2
+               ? constant
+               : nullptr;
+}
+
+bool runtime::cpu::pass::CPUSparseWeightsConversion::run_on_function(shared_ptr<Function> function)
+{
+    bool modified = false;
+    for (auto& node : function->get_ordered_ops())
+    {
+        auto dot = as_type_ptr<ngraph::op::v0::Dot>(node);
+        if (!dot || dot->get_reduction_axes_count() != 1)
+        {
+            continue;
+        }
+        auto data = dot->input_value(0);
+        if (data.get_element_type() != element::f32 || data.get_partial_shape().is_dynamic() ||
+            data.get_shape().empty())
+        {
+            continue;
+        }
+        bool transposed;
+        auto constant = get_weights(dot.get(), transposed);
+        if (!constant || shape_size(constant->get_output_shape(0)) < m_min_elements)
+        {
+            continue;
+        }
+
+        Shape weights_shape = dot->get_input_shape(1);
+        const size_t k = weights_shape[0];
+        const size_t n = weights_shape[1];
+        const float* dense = constant->get_data_ptr<float>();
+        auto weight = [&](size_t row, size_t column) {
+            return transposed ? dense[column * k + row] : dense[row * n + column];
+        };
+        auto is_nonzero_block = [&](size_t row, size_t block, size_t width) {
+            for (size_t column = block * width; column < min(n, (block + 1) * width); column++)
+            {
+                if (weight(row, column) != 0.0f)
+                {
+                    return true;
+                }
+            }
+            return false;
+        };
+
+        size_t width = 0;
+        for (size_t candidate : s_block_widths)
+        {
+            size_t blocks = (n + candidate - 1) / candidate;
+            size_t nonzero = 0;
+            for (size_t block = 0; block < blocks; block++)
+            {
+                for (size_t row = 0; row < k; row++)
+                {
+                    nonzero += is_nonzero_block(row, block, candidate);
+                }
+            }
+            if (nonzero <= m_max_density * blocks * k)
+            {
+                width = candidate;
+                break;
+            }
+        }
+        if (width == 0)
+        {
+            continue;
+        }
+
+        size_t blocks = (n + width - 1) / width;
+        vector<int32_t> offsets{0};
+        vector<int32_t> indices;
+        vector<float> values;
+        for (size_t block = 0; block < blocks; block++)
+        {
+            for (size_t row = 0; row < k; row++)
+            {
+                if (!is_nonzero_block(row, block, width))
+                {
+                    continue;
+                }
+                indices.push_back(static_cast<int32_t>(row));
+                for (size_t column = block * width; column < (block + 1) * width; column++)
+                {
+                    values.push_back(column < n ? weight(row, column) : 0.0f);
+                }
+            }
+            offsets.push_back(static_cast<int32_t>(indices.size()));
+        }
+        NGRAPH_DEBUG << "Sparse weights for " << dot->get_name() << ": " << indices.size()
+                     << " of " << blocks * k << " blocks of " << width << " columns";
+
+        auto sparse = make_shared<ngraph::op::SparseDot>(
+            data,
+            ngraph::op::v0::Constant::create(element::f32, Shape{values.size()}, values),
+            ngraph::op::v0::Constant::create(element::i32, Shape{indices.size()}, indices),
+            ngraph::op::v0::Constant::create(element::i32, Shape{offsets.size()}, offsets),
+            weights_shape,
+            width);
+        replace_node(dot, sparse);
+        modified = true;
+    }
+    return modified;
+}
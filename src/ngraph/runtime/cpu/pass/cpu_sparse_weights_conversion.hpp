@@ -0,0 +1,57 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+#include "ngraph/runtime/cpu/cpu_backend_visibility.h"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace pass
+            {
+                /// \brief Replaces the Dots of f32 data with sparse Constant weights, or with a
+                ///        transpose of them, by SparseDots.
+                ///
+                /// The weights are stored by blocks of 16, 8, 4 or 1 neighbouring output
+                /// columns, the widest whose fraction of nonzero blocks is at most
+                /// `max_density`; weights with no such block width stay dense. Weights of
+                /// fewer than `min_elements` elements are left alone.
+                class CPU_BACKEND_API CPUSparseWeightsConversion
+                    : public ngraph::pass::FunctionPass
+                {
+                public:
+                    CPUSparseWeightsConversion(double max_density = 0.25,
+                                               size_t min_elements = 4096)
+                        : m_max_density(max_density)
+                        , m_min_elements(min_elements)
+                    {
+                    }
+
+                    bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+
+                private:
+                    double m_max_density;
+                    size_t m_min_elements;
+                };
+            }
+        }
+    }
+}
@@ -0,0 +1,256 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <exception>
+#include <thread>
+
+#include "ngraph/check.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/runtime/data_parallel_executable.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::DataParallelExecutable::DataParallelExecutable(const shared_ptr<Function>& function,
+                                                        const vector<shared_ptr<Backend>>& backends,
+                                                        reduction::Type reduction)
+    : m_reduction(reduction)
+{
+    NGRAPH_CHECK(!backends.empty(), "DataParallelExecutable requires at least one backend");
+    set_parameters_and_results(*function);
+
+    const ParameterVector& parameters = function->get_parameters();
+    for (auto& parameter : parameters)
+    {
+        NGRAPH_CHECK(parameter->get_partial_shape().is_static(),
+                     "DataParallelExecutable requires static shapes, ",
+                     *parameter,
+                     " has shape ",
+                     parameter->get_partial_shape());
+    }
+    NGRAPH_CHECK(!parameters.empty() && parameters[0]->get_output_shape(0).size() > 0,
+                 "The first parameter of ",
+                 *function,
+                 " must have a batch axis");
+    size_t batch = parameters[0]->get_output_shape(0)[0];
+    size_t replica_count = backends.size();
+    NGRAPH_CHECK(batch >= replica_count,
+                 "A batch of ",
+                 batch,
+                 " cannot be split across ",
+                 replica_count,
+                 " replicas");
+    for (auto& parameter : parameters)
+    {
+        const Shape& shape = parameter->get_output_shape(0);
+        m_split_inputs.push_back(shape.size() > 0 && shape[0] == batch);
+    }
+
+    // The first batch % replica_count replicas take one more row than the others
+    size_t begin = 0;
+    for (size_t r = 0; r < replica_count; r++)
+    {
+        size_t end = begin + batch / replica_count + (r < batch % replica_count ? 1 : 0);
+        m_slices.emplace_back(begin, end);
+        begin = end;
+    }
+
+    // Each replica compiles a clone of the function whose split parameters have the shape of
+    // its slice; the clone infers the shapes of everything else from them
+    vector<shared_ptr<Function>> replica_functions;
+    for (size_t r = 0; r < replica_count; r++)
+    {
+        NodeMap node_map;
+        for (size_t i = 0; i < parameters.size(); i++)
+        {
+            Shape shape = parameters[i]->get_output_shape(0);
+            if (m_split_inputs[i])
+            {
+                shape[0] = m_slices[r].second - m_slices[r].first;
+            }
+            auto parameter =
+                make_shared<op::v0::Parameter>(parameters[i]->get_element_type(), shape);
+            parameter->set_friendly_name(parameters[i]->get_friendly_name());
+            node_map[parameters[i].get()] = parameter;
+        }
+        replica_functions.push_back(clone_function(*function, node_map));
+    }
+
+    // An output is gathered if its leading dimension is the batch on the function and the
+    // slice on every replica, and reduced if it has the same shape everywhere
+    for (size_t i = 0; i < function->get_output_size(); i++)
+    {
+        const Shape& shape = function->get_output_shape(i);
+        bool gathered = shape.size() > 0 && shape[0] == batch;
+        bool reduced = true;
+        for (size_t r = 0; r < replica_count; r++)
+        {
+            const Shape& replica_shape = replica_functions[r]->get_output_shape(i);
+            Shape slice_shape = shape;
+            if (gathered)
+            {
+                slice_shape[0] = m_slices[r].second - m_slices[r].first;
+            }
+            gathered = gathered && replica_shape == slice_shape;
+            reduced = reduced && replica_shape == shape;
+        }
+        NGRAPH_CHECK(gathered || reduced,
+                     "Output ",
+                     i,
+                     " of ",
+                     *function,
+                     " neither follows the batch nor keeps its shape on every replica");
+        m_gathered_outputs.push_back(gathered);
+    }
+
+    for (size_t r = 0; r < replica_count; r++)
+    {
+        Replica replica;
+        replica.backend = backends[r];
+        replica.executable = replica.backend->compile(replica_functions[r]);
+        for (auto& parameter : replica_functions[r]->get_parameters())
+        {
+            replica.inputs.push_back(replica.backend->create_tensor(
+                parameter->get_element_type(), parameter->get_output_shape(0)));
+        }
+        for (size_t i = 0; i < replica_functions[r]->get_output_size(); i++)
+        {
+            replica.outputs.push_back(
+                replica.backend->create_tensor(replica_functions[r]->get_output_element_type(i),
+                                               replica_functions[r]->get_output_shape(i)));
+        }
+        m_replicas.push_back(replica);
+    }
+}
+
+bool runtime::DataParallelExecutable::call(const vector<shared_ptr<Tensor>>& outputs,
+                                           const vector<shared_ptr<Tensor>>& inputs)
+{
+    lock_guard<mutex> lock(m_mutex);
+    size_t replica_count = m_replicas.size();
+    size_t batch = m_slices.back().second;
+
+    // Inputs that are not split are given to the first replica as they are, since they
+    // belong to its backend
+    vector<vector<shared_ptr<Tensor>>> replica_inputs(replica_count);
+    vector<char> staging;
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        size_t bytes = inputs[i]->get_size_in_bytes();
+        staging.resize(bytes);
+        inputs[i]->read(staging.data(), bytes);
+        for (size_t r = 0; r < replica_count; r++)
+        {
+            auto& tensor = m_replicas[r].inputs[i];
+            if (m_split_inputs[i])
+            {
+                size_t row_bytes = bytes / batch;
+                tensor->write(staging.data() + m_slices[r].first * row_bytes,
+                              tensor->get_size_in_bytes());
+                replica_inputs[r].push_back(tensor);
+            }
+            else if (r == 0)
+            {
+                replica_inputs[r].push_back(inputs[i]);
+            }
+            else
+            {
+                tensor->write(staging.data(), bytes);
+                replica_inputs[r].push_back(tensor);
+            }
+        }
+    }
+
+    // The first replica runs on the calling thread
+    vector<char> completed(replica_count, false);
+    vector<exception_ptr> errors(replica_count);
+    auto run = [&](size_t r) {
+        try
+        {
+            completed[r] = m_replicas[r].executable->call(m_replicas[r].outputs, replica_inputs[r]);
+        }
+        catch (...)
+        {
+            errors[r] = current_exception();
+        }
+    };
+    vector<thread> threads;
+    for (size_t r = 1; r < replica_count; r++)
+    {
+        threads.emplace_back(run, r);
+    }
+    run(0);
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+    for (size_t r = 0; r < replica_count; r++)
+    {
+        if (errors[r])
+        {
+            rethrow_exception(errors[r]);
+        }
+        if (!completed[r])
+        {
+            return false;
+        }
+    }
+
+    vector<vector<char>> replica_values(replica_count);
+    for (size_t i = 0; i < outputs.size(); i++)
+    {
+        size_t bytes = outputs[i]->get_size_in_bytes();
+        staging.resize(bytes);
+        if (m_gathered_outputs[i])
+        {
+            size_t row_bytes = bytes / batch;
+            for (size_t r = 0; r < replica_count; r++)
+            {
+                auto& tensor = m_replicas[r].outputs[i];
+                tensor->read(staging.data() + m_slices[r].first * row_bytes,
+                             tensor->get_size_in_bytes());
+            }
+        }
+        else
+        {
+            vector<const char*> values;
+            for (size_t r = 0; r < replica_count; r++)
+            {
+                replica_values[r].resize(bytes);
+                m_replicas[r].outputs[i]->read(replica_values[r].data(), bytes);
+                values.push_back(replica_values[r].data());
+            }
+            const element::Type& element_type = outputs[i]->get_element_type();
+            reduction::reduce(staging.data(),
+                              values,
+                              element_type.size() == 0 ? 0 : bytes / element_type.size(),
+                              element_type,
+                              m_reduction);
+        }
+        outputs[i]->write(staging.data(), bytes);
+    }
+    return true;
+}
+
+void runtime::DataParallelExecutable::warm_up()
+{
+    lock_guard<mutex> lock(m_mutex);
+    for (auto& replica : m_replicas)
+    {
+        replica.executable->warm_up();
+    }
+}
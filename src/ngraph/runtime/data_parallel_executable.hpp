@@ -0,0 +1,90 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "ngraph/distributed.hpp"
+#include "ngraph/function.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/executable.hpp"
+#include "ngraph/runtime/tensor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class DataParallelExecutable;
+    }
+}
+
+/// \brief Runs a Function on several backends at once, each on a slice of the batch.
+///
+/// The batch axis is axis 0, and the batch size is the leading dimension of the first
+/// parameter. Parameters with that leading dimension are split into one contiguous slice per
+/// replica; the others, such as weights, are copied whole to every replica. Each replica
+/// compiles a clone of the function with its slice shapes, so the function must infer its
+/// shapes from the parameters rather than hard-code the batch size.
+///
+/// Replicas run concurrently, each on a thread of its own. An output whose leading dimension
+/// follows the batch is gathered from the slices. Any other output, such as the gradients of a
+/// training graph, must have the same shape on every replica and is all-reduced across them
+/// with the given reduction. Values are moved through host memory.
+///
+/// With the GPU backend, create one backend per device, e.g. "GPU:device=1". The tensors
+/// passed to call belong to the first backend, and calls are serialized.
+class NGRAPH_API ngraph::runtime::DataParallelExecutable : public Executable
+{
+public:
+    /// \param function The function to run. It is not modified.
+    /// \param backends One backend per replica
+    /// \param reduction How the outputs that are not gathered are combined
+    DataParallelExecutable(const std::shared_ptr<Function>& function,
+                           const std::vector<std::shared_ptr<Backend>>& backends,
+                           reduction::Type reduction = reduction::Type::SUM);
+
+    bool call(const std::vector<std::shared_ptr<Tensor>>& outputs,
+              const std::vector<std::shared_ptr<Tensor>>& inputs) override;
+
+    /// \brief Warms up the executable of every replica
+    void warm_up() override;
+
+    /// \brief The batch slice of each replica, as [begin, end) along axis 0
+    const std::vector<std::pair<size_t, size_t>>& get_slices() const { return m_slices; }
+    /// \brief True for the inputs split along the batch axis
+    const std::vector<bool>& get_split_inputs() const { return m_split_inputs; }
+    /// \brief True for the outputs gathered from the slices, false for the reduced ones
+    const std::vector<bool>& get_gathered_outputs() const { return m_gathered_outputs; }
+
+private:
+    struct Replica
+    {
+        std::shared_ptr<Backend> backend;
+        std::shared_ptr<Executable> executable;
+        std::vector<std::shared_ptr<Tensor>> inputs;
+        std::vector<std::shared_ptr<Tensor>> outputs;
+    };
+
+    std::vector<Replica> m_replicas;
+    std::vector<std::pair<size_t, size_t>> m_slices;
+    std::vector<bool> m_split_inputs;
+    std::vector<bool> m_gathered_outputs;
+    reduction::Type m_reduction;
+    std::mutex m_mutex;
+};
@@ -0,0 +1,350 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstring>
+
+#include "ngraph/runtime/dynamic/batching_executable.hpp"
+#include "ngraph/specialize_function.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Copies `count` batch rows of a tensor with layout [outer, batch, inner] from `src` starting at
+// row `src_offset` into `dst` starting at row `dst_offset`.
+static void copy_batch_rows(const char* src,
+                            size_t src_batch,
+                            size_t src_offset,
+                            char* dst,
+                            size_t dst_batch,
+                            size_t dst_offset,
+                            size_t count,
+                            size_t outer,
+                            size_t row_bytes)
+{
+    for (size_t o = 0; o < outer; o++)
+    {
+        memcpy(dst + (o * dst_batch + dst_offset) * row_bytes,
+               src + (o * src_batch + src_offset) * row_bytes,
+               count * row_bytes);
+    }
+}
+
+static size_t outer_size(const Shape& shape, size_t axis)
+{
+    return shape_size(Shape(shape.begin(), shape.begin() + axis));
+}
+
+static size_t row_bytes(const Shape& shape, size_t axis, const element::Type& type)
+{
+    return shape_size(Shape(shape.begin() + axis + 1, shape.end())) * type.size();
+}
+
+runtime::dynamic::BatchingExecutable::BatchingExecutable(
+    shared_ptr<Function> wrapped_function,
+    shared_ptr<runtime::Backend> wrapped_backend,
+    size_t batch_axis,
+    size_t max_batch_size,
+    chrono::microseconds max_latency,
+    bool enable_performance_collection)
+    : m_wrapped_function(wrapped_function)
+    , m_wrapped_backend(wrapped_backend)
+    , m_batch_axis(batch_axis)
+    , m_max_batch_size(max_batch_size)
+    , m_max_latency(max_latency)
+    , m_enable_performance_collection(enable_performance_collection)
+{
+    NGRAPH_CHECK(m_max_batch_size > 0, "max_batch_size must be positive");
+    for (auto& param : m_wrapped_function->get_parameters())
+    {
+        NGRAPH_CHECK(param->get_output_partial_shape(0).rank().is_static() &&
+                         param->get_output_partial_shape(0).rank().get_length() >
+                             static_cast<int64_t>(m_batch_axis),
+                     "Parameter ",
+                     *param,
+                     " has no batch axis ",
+                     m_batch_axis);
+        NGRAPH_CHECK(param->get_output_element_type(0).is_static(),
+                     "Parameter ",
+                     *param,
+                     " must have a static element type");
+    }
+    set_parameters_and_results(*wrapped_function);
+    m_dispatcher = thread(&BatchingExecutable::dispatch_loop, this);
+}
+
+runtime::dynamic::BatchingExecutable::~BatchingExecutable()
+{
+    {
+        lock_guard<mutex> lock(m_queue_mutex);
+        m_shutdown = true;
+    }
+    m_queue_cv.notify_all();
+    m_dispatcher.join();
+}
+
+size_t runtime::dynamic::BatchingExecutable::get_batch_bucket(size_t batch_size) const
+{
+    return std::min(ExecutableCache::bucket_dimension(batch_size), m_max_batch_size);
+}
+
+bool runtime::dynamic::BatchingExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                                const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    NGRAPH_CHECK(inputs.size() == m_parameters.size(),
+                 "Expected ",
+                 m_parameters.size(),
+                 " inputs, got ",
+                 inputs.size());
+    NGRAPH_CHECK(outputs.size() == m_results.size(),
+                 "Expected ",
+                 m_results.size(),
+                 " outputs, got ",
+                 outputs.size());
+    NGRAPH_CHECK(!inputs.empty(), "BatchingExecutable requires at least one input");
+
+    size_t batch_size = inputs[0]->get_shape().at(m_batch_axis);
+    for (auto& tensor : inputs)
+    {
+        NGRAPH_CHECK(tensor->get_shape().at(m_batch_axis) == batch_size,
+                     "All inputs must have the same size along the batch axis");
+    }
+    NGRAPH_CHECK(batch_size > 0 && batch_size <= m_max_batch_size,
+                 "Batch size ",
+                 batch_size,
+                 " is outside of the range [1, ",
+                 m_max_batch_size,
+                 "]");
+
+    auto request = make_shared<Request>();
+    request->outputs = &outputs;
+    request->inputs = &inputs;
+    request->batch_size = batch_size;
+    request->enqueue_time = chrono::steady_clock::now();
+    auto done = request->done.get_future();
+    {
+        lock_guard<mutex> lock(m_queue_mutex);
+        m_queue.push_back(request);
+    }
+    m_queue_cv.notify_one();
+    return done.get();
+}
+
+void runtime::dynamic::BatchingExecutable::dispatch_loop()
+{
+    while (true)
+    {
+        vector<shared_ptr<Request>> batch;
+        {
+            unique_lock<mutex> lock(m_queue_mutex);
+            m_queue_cv.wait(lock, [this]() { return m_shutdown || !m_queue.empty(); });
+            if (m_queue.empty())
+            {
+                // Shutting down with nothing left to run
+                return;
+            }
+
+            // Wait for more work until the oldest request hits its deadline or the batch is full
+            auto deadline = m_queue.front()->enqueue_time + m_max_latency;
+            auto pending = [this]() {
+                size_t samples = 0;
+                for (auto& r : m_queue)
+                {
+                    samples += r->batch_size;
+                }
+                return samples;
+            };
+            while (!m_shutdown && pending() < m_max_batch_size &&
+                   m_queue_cv.wait_until(lock, deadline) != cv_status::timeout)
+            {
+            }
+
+            size_t samples = 0;
+            while (!m_queue.empty() && samples + m_queue.front()->batch_size <= m_max_batch_size)
+            {
+                samples += m_queue.front()->batch_size;
+                batch.push_back(m_queue.front());
+                m_queue.pop_front();
+            }
+        }
+        run_batch(batch);
+    }
+}
+
+shared_ptr<runtime::Executable>
+    runtime::dynamic::BatchingExecutable::get_bucket_executable(size_t bucket)
+{
+    vector<int> key{static_cast<int>(bucket)};
+    shared_ptr<Executable> cached_exec;
+    shared_ptr<Function> cached_func;
+    if (m_cache->find_entry(key, cached_exec, cached_func))
+    {
+        return cached_exec;
+    }
+
+    vector<element::Type> arg_element_types;
+    vector<PartialShape> arg_shapes;
+    for (auto& param : m_wrapped_function->get_parameters())
+    {
+        PartialShape shape = param->get_output_partial_shape(0);
+        vector<Dimension> dims(shape.rank().get_length());
+        for (size_t i = 0; i < dims.size(); i++)
+        {
+            dims[i] = (i == m_batch_axis ? Dimension(bucket) : shape[i]);
+        }
+        arg_element_types.push_back(param->get_output_element_type(0));
+        arg_shapes.push_back(PartialShape(dims));
+    }
+    auto clone = specialize_function(m_wrapped_function,
+                                     arg_element_types,
+                                     arg_shapes,
+                                     vector<void*>(arg_shapes.size(), nullptr));
+    for (auto& result : clone->get_results())
+    {
+        NGRAPH_CHECK(result->get_output_partial_shape(0).is_static(),
+                     "Shape staticization failed for result node ",
+                     *result);
+        NGRAPH_CHECK(result->get_output_shape(0).size() > m_batch_axis &&
+                         result->get_output_shape(0)[m_batch_axis] == bucket,
+                     "Result ",
+                     *result,
+                     " does not preserve the batch axis");
+    }
+
+    stopwatch timer;
+    timer.start();
+    auto exec = m_wrapped_backend->compile(clone, m_enable_performance_collection);
+    timer.stop();
+    m_cache->add_entry(key, exec, clone, timer.get_microseconds());
+
+    auto& bucket_inputs = m_bucket_inputs[bucket];
+    bucket_inputs.clear();
+    for (auto& param : clone->get_parameters())
+    {
+        bucket_inputs.push_back(m_wrapped_backend->create_tensor(
+            param->get_output_element_type(0), param->get_output_shape(0)));
+    }
+    auto& bucket_outputs = m_bucket_outputs[bucket];
+    bucket_outputs.clear();
+    for (auto& result : clone->get_results())
+    {
+        bucket_outputs.push_back(m_wrapped_backend->create_tensor(
+            result->get_output_element_type(0), result->get_output_shape(0)));
+    }
+    return exec;
+}
+
+void runtime::dynamic::BatchingExecutable::run_batch(const vector<shared_ptr<Request>>& batch)
+{
+    try
+    {
+        size_t total = 0;
+        for (auto& request : batch)
+        {
+            total += request->batch_size;
+        }
+        size_t bucket = get_batch_bucket(total);
+        auto exec = get_bucket_executable(bucket);
+        auto& bucket_inputs = m_bucket_inputs[bucket];
+        auto& bucket_outputs = m_bucket_outputs[bucket];
+
+        // Gather every request's inputs into the batched tensors; padding rows stay zero
+        vector<char> staging;
+        vector<char> slice;
+        for (size_t i = 0; i < bucket_inputs.size(); i++)
+        {
+            auto& batched = bucket_inputs[i];
+            const Shape& shape = batched->get_shape();
+            size_t outer = outer_size(shape, m_batch_axis);
+            size_t row = row_bytes(shape, m_batch_axis, batched->get_element_type());
+            staging.assign(batched->get_size_in_bytes(), 0);
+
+            size_t offset = 0;
+            for (auto& request : batch)
+            {
+                auto& input = request->inputs->at(i);
+                NGRAPH_CHECK(input->get_element_type() == batched->get_element_type() &&
+                                 input->get_size_in_bytes() ==
+                                     outer * row * request->batch_size,
+                             "Input ",
+                             i,
+                             " does not match the batched parameter shape ",
+                             shape);
+                slice.resize(input->get_size_in_bytes());
+                input->read(slice.data(), slice.size());
+                copy_batch_rows(slice.data(),
+                                request->batch_size,
+                                0,
+                                staging.data(),
+                                bucket,
+                                offset,
+                                request->batch_size,
+                                outer,
+                                row);
+                offset += request->batch_size;
+            }
+            batched->write(staging.data(), staging.size());
+        }
+
+        bool rc = exec->call(bucket_outputs, bucket_inputs);
+
+        // Scatter batched outputs back to each caller
+        for (size_t i = 0; i < bucket_outputs.size(); i++)
+        {
+            auto& batched = bucket_outputs[i];
+            const Shape& shape = batched->get_shape();
+            size_t outer = outer_size(shape, m_batch_axis);
+            size_t row = row_bytes(shape, m_batch_axis, batched->get_element_type());
+            staging.resize(batched->get_size_in_bytes());
+            batched->read(staging.data(), staging.size());
+
+            size_t offset = 0;
+            for (auto& request : batch)
+            {
+                auto& output = request->outputs->at(i);
+                NGRAPH_CHECK(output->get_size_in_bytes() == outer * row * request->batch_size,
+                             "Output ",
+                             i,
+                             " does not match the batched result shape ",
+                             shape);
+                slice.resize(output->get_size_in_bytes());
+                copy_batch_rows(staging.data(),
+                                bucket,
+                                offset,
+                                slice.data(),
+                                request->batch_size,
+                                0,
+                                request->batch_size,
+                                outer,
+                                row);
+                output->write(slice.data(), slice.size());
+                offset += request->batch_size;
+            }
+        }
+
+        for (auto& request : batch)
+        {
+            request->done.set_value(rc);
+        }
+    }
+    catch (...)
+    {
+        for (auto& request : batch)
+        {
+            request->done.set_exception(current_exception());
+        }
+    }
+}
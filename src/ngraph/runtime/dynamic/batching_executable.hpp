@@ -0,0 +1,106 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/executable.hpp"
+#include "ngraph/runtime/executable_cache.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace dynamic
+        {
+            class BatchingExecutable;
+        }
+    }
+}
+
+///
+/// \brief Wrapper class that coalesces many small concurrent calls into one batched call.
+///
+/// The wrapped function must have a batch dimension at `batch_axis` on every parameter and
+/// every result; all other dimensions must be static. This class intercepts `call` and:
+///
+/// 1. queues the caller's tensors and blocks the caller;
+/// 2. a dispatcher thread gathers queued requests along the batch axis until either
+///    `max_batch_size` samples are pending or the oldest request has waited `max_latency`;
+/// 3. the batch is padded up to a power-of-two bucket, run through one executable compiled
+///    for that bucket (held in an `ExecutableCache`), and the outputs are scattered back
+///    to each caller's tensors.
+///
+class NGRAPH_API ngraph::runtime::dynamic::BatchingExecutable : public ngraph::runtime::Executable
+{
+public:
+    BatchingExecutable(std::shared_ptr<Function> wrapped_function,
+                       std::shared_ptr<ngraph::runtime::Backend> wrapped_backend,
+                       size_t batch_axis,
+                       size_t max_batch_size,
+                       std::chrono::microseconds max_latency,
+                       bool enable_performance_collection = false);
+    virtual ~BatchingExecutable() override;
+
+    virtual bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                      const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
+
+    /// \brief Returns the compiled batch size used to run `batch_size` coalesced samples.
+    size_t get_batch_bucket(size_t batch_size) const;
+
+private:
+    struct Request
+    {
+        const std::vector<std::shared_ptr<runtime::Tensor>>* outputs;
+        const std::vector<std::shared_ptr<runtime::Tensor>>* inputs;
+        size_t batch_size;
+        std::chrono::steady_clock::time_point enqueue_time;
+        std::promise<bool> done;
+    };
+
+    void dispatch_loop();
+    void run_batch(const std::vector<std::shared_ptr<Request>>& batch);
+    std::shared_ptr<Executable> get_bucket_executable(size_t bucket);
+
+    std::shared_ptr<ngraph::Function> m_wrapped_function;
+    std::shared_ptr<ngraph::runtime::Backend> m_wrapped_backend;
+    std::shared_ptr<ngraph::runtime::ExecutableCache> m_cache =
+        std::make_shared<ngraph::runtime::ExecutableCache>();
+    size_t m_batch_axis;
+    size_t m_max_batch_size;
+    std::chrono::microseconds m_max_latency;
+    bool m_enable_performance_collection;
+
+    /// Batched input and output tensors, allocated once per bucket
+    std::map<size_t, std::vector<std::shared_ptr<runtime::Tensor>>> m_bucket_inputs;
+    std::map<size_t, std::vector<std::shared_ptr<runtime::Tensor>>> m_bucket_outputs;
+
+    std::mutex m_queue_mutex;
+    std::condition_variable m_queue_cv;
+    std::deque<std::shared_ptr<Request>> m_queue;
+    bool m_shutdown = false;
+    std::thread m_dispatcher;
+};
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include "ngraph/runtime/dynamic/dynamic_backend.hpp"
+#include "ngraph/env_util.hpp"
 #include "ngraph/runtime/dynamic/dynamic_executable.hpp"
 #include "ngraph/runtime/dynamic/dynamic_tensor.hpp"
 
@@ -54,6 +55,7 @@ shared_ptr<runtime::Executable>
     runtime::dynamic::DynamicBackend::compile(shared_ptr<Function> function,
                                               bool enable_performance_collection)
 {
+    static bool s_shape_polymorphic = getenv_bool("NGRAPH_DYNAMIC_SHAPE_POLYMORPHIC");
     return make_shared<runtime::dynamic::DynamicExecutable>(
-        function, m_wrapped_backend, enable_performance_collection);
+        function, m_wrapped_backend, enable_performance_collection, s_shape_polymorphic);
 }
@@ -45,7 +45,10 @@ namespace ngraph
 ///   whose shape can be updated after creation. Internally, `DynamicTensor`
 ///   wraps static tensors managed by the wrapped backend.
 /// * `compile` will return a special `DynamicExecutable` object, which allows
-///   dynamic shapes to be supported via graph cloning.
+///   dynamic shapes to be supported via graph cloning. Setting
+///   `NGRAPH_DYNAMIC_SHAPE_POLYMORPHIC=1` makes it run the function with symbolic shapes
+///   instead whenever every op implements `Node::evaluate`. Those ops run on the host, not
+///   on the wrapped backend; see `DynamicExecutable`.
 ///
 /// This class is instantiated by `ngraph::runtime::Backend::create`.
 ///
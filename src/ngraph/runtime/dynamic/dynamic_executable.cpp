@@ -15,9 +15,14 @@
 //*****************************************************************************
 
 #include <iterator>
+#include <set>
+#include <unordered_map>
 
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
 #include "ngraph/op/avg_pool.hpp"
 #include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/constant.hpp"
 #include "ngraph/op/convolution.hpp"
 #include "ngraph/op/experimental/dyn_broadcast.hpp"
 #include "ngraph/op/experimental/dyn_replace_slice.hpp"
@@ -25,23 +30,29 @@
 #include "ngraph/op/experimental/generate_mask.hpp"
 #include "ngraph/op/range.hpp"
 #include "ngraph/op/reshape.hpp"
+#include "ngraph/op/result.hpp"
 #include "ngraph/op/transpose.hpp"
 #include "ngraph/pass/constant_folding.hpp"
 #include "ngraph/pass/convert_opset_1_to_0.hpp"
 #include "ngraph/pass/convert_opset_3_to_1.hpp"
 #include "ngraph/pass/dyn_elimination.hpp"
+#include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/memory_layout.hpp"
 #include "ngraph/pass/shape_relevance.hpp"
 #include "ngraph/runtime/dynamic/dynamic_executable.hpp"
 #include "ngraph/runtime/dynamic/dynamic_tensor.hpp"
+#include "ngraph/runtime/host_tensor.hpp"
 #include "ngraph/specialize_function.hpp"
+#include "ngraph/util.hpp"
 
 using namespace std;
 using namespace ngraph;
 
 runtime::dynamic::DynamicExecutable::DynamicExecutable(shared_ptr<Function> wrapped_function,
                                                        shared_ptr<runtime::Backend> wrapped_backend,
-                                                       bool enable_performance_collection)
+                                                       bool enable_performance_collection,
+                                                       bool enable_shape_polymorphism)
     : m_wrapped_function(wrapped_function)
     , m_wrapped_backend(wrapped_backend)
     , m_enable_performance_collection(enable_performance_collection)
@@ -51,6 +62,519 @@ runtime::dynamic::DynamicExecutable::DynamicExecutable(shared_ptr<Function> wrap
     passes.run_passes(m_wrapped_function);
 
     set_parameters_and_results(*wrapped_function);
+
+    if (enable_shape_polymorphism)
+    {
+        build_polymorphic_plan();
+    }
+}
+
+namespace
+{
+    // Alignment HostTensor uses for its buffers, and so for the planned pool
+    const size_t s_pool_alignment = 64;
+
+    // Hands out one slot of the planned pool. HostTensor pads its requests by alignment + 1
+    // so that it can align an unaligned block; pool slots are already aligned, so only the
+    // unpadded size has to fit. Anything larger comes from the fallback allocator.
+    class PlannedSlotAllocator : public runtime::Allocator
+    {
+    public:
+        PlannedSlotAllocator(char* ptr, size_t size, runtime::Allocator* fallback)
+            : m_ptr(ptr)
+            , m_size(size)
+            , m_fallback(fallback)
+        {
+        }
+
+        void* malloc(size_t size, size_t alignment) override
+        {
+            if (size <= m_size + alignment + 1 && reinterpret_cast<size_t>(m_ptr) % alignment == 0)
+            {
+                return m_ptr;
+            }
+            return m_fallback->malloc(size, alignment);
+        }
+
+        void free(void* ptr) override
+        {
+            if (ptr != m_ptr)
+            {
+                m_fallback->free(ptr);
+            }
+        }
+
+    private:
+        char* m_ptr;
+        size_t m_size;
+        runtime::Allocator* m_fallback;
+    };
+}
+
+void runtime::dynamic::DynamicExecutable::build_polymorphic_plan()
+{
+    // Values of shape-relevant parameters determine shapes, which only specialization handles
+    for (auto& param : m_wrapped_function->get_parameters())
+    {
+        if (param->is_relevant_to_shapes())
+        {
+            NGRAPH_DEBUG << "Parameter " << *param
+                         << " is relevant to shapes, shape polymorphism disabled";
+            return;
+        }
+    }
+
+    unordered_map<Node*, size_t> result_index;
+    const ResultVector& results = m_wrapped_function->get_results();
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        result_index[results[i].get()] = i;
+    }
+
+    unordered_map<Node*, size_t> first_slot;
+    for (auto& node : m_wrapped_function->get_ordered_ops())
+    {
+        first_slot[node.get()] = m_slot_count;
+        m_slot_count += node->get_output_size();
+        if (auto constant = as_type_ptr<op::v0::Constant>(node))
+        {
+            m_constant_slots.emplace_back(first_slot[node.get()],
+                                          make_shared<HostTensor>(constant));
+        }
+        else if (!node->is_parameter())
+        {
+            // Results are steps too so that they are copied out before the planned pool reuses
+            // their memory
+            PolymorphicStep step;
+            step.node = node.get();
+            step.result_index = node->is_output() ? result_index.at(node.get()) : 0;
+            for (auto& input : node->inputs())
+            {
+                auto source = input.get_source_output();
+                step.inputs.push_back(first_slot.at(source.get_node()) + source.get_index());
+            }
+            for (size_t i = 0; !node->is_output() && i < node->get_output_size(); i++)
+            {
+                step.outputs.push_back(first_slot[node.get()] + i);
+            }
+            m_steps.push_back(step);
+        }
+    }
+    for (auto& param : m_wrapped_function->get_parameters())
+    {
+        m_parameter_slots.push_back(first_slot.at(param.get()));
+    }
+    m_shape_polymorphic = true;
+
+    build_upper_bound_plan(first_slot);
+}
+
+void runtime::dynamic::DynamicExecutable::build_upper_bound_plan(
+    const unordered_map<Node*, size_t>& first_slot)
+{
+    vector<Shape> bounds;
+    for (auto& param : m_wrapped_function->get_parameters())
+    {
+        const PartialShape& shape = param->get_output_partial_shape(0);
+        if (shape.rank().is_dynamic())
+        {
+            return;
+        }
+        Shape bound;
+        for (size_t i = 0; i < static_cast<size_t>(shape.rank().get_length()); i++)
+        {
+            if (!shape[i].get_interval().has_upper_bound())
+            {
+                return;
+            }
+            bound.push_back(shape[i].get_max_length());
+        }
+        bounds.push_back(bound);
+    }
+
+    // Lay out the values of a clone specialized to the upper bounds
+    NodeMap node_map;
+    auto clone = clone_function(*m_wrapped_function, node_map);
+    try
+    {
+        for (size_t i = 0; i < bounds.size(); i++)
+        {
+            clone->get_parameters()[i]->set_partial_shape(bounds[i]);
+        }
+        clone->validate_nodes_and_infer_types();
+    }
+    catch (const ngraph_error& e)
+    {
+        NGRAPH_DEBUG << "No upper bound memory plan: " << e.what();
+        return;
+    }
+    pass::Manager passes;
+    passes.register_pass<pass::Liveness>();
+    passes.register_pass<pass::MemoryLayout>(s_pool_alignment);
+    passes.run_passes(clone);
+
+    size_t pool_size = clone->get_temporary_pool_size();
+    if (pool_size == 0)
+    {
+        return;
+    }
+    m_planned_pool.reset(new AlignedBuffer(pool_size, s_pool_alignment));
+    m_slot_allocators.resize(m_slot_count);
+    for (auto& node : m_wrapped_function->get_ordered_ops())
+    {
+        auto& clone_node = node_map.at(node.get());
+        for (size_t i = 0; i < clone_node->get_output_size(); i++)
+        {
+            descriptor::Tensor* tensor = &clone_node->output(i).get_tensor();
+            if (clone_node->liveness_new_list.count(tensor) != 0)
+            {
+                m_slot_allocators[first_slot.at(node.get()) + i].reset(new PlannedSlotAllocator(
+                    m_planned_pool->get_ptr<char>() + tensor->get_pool_offset(),
+                    tensor->size(),
+                    &m_arena));
+            }
+        }
+    }
+}
+
+runtime::dynamic::ShapePropagator& runtime::dynamic::DynamicExecutable::get_shape_propagator()
+{
+    // Built on first use so executables that never ask do not pay for the clone
+    lock_guard<mutex> lock(m_shape_propagator_mutex);
+    if (!m_shape_propagator)
+    {
+        m_shape_propagator.reset(new ShapePropagator(m_wrapped_function));
+    }
+    return *m_shape_propagator;
+}
+
+vector<Shape>
+    runtime::dynamic::DynamicExecutable::get_output_shapes(const vector<Shape>& input_shapes)
+{
+    return get_shape_propagator().get_output_shapes(input_shapes);
+}
+
+bool runtime::dynamic::DynamicExecutable::call_polymorphic(
+    const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+    const std::vector<std::shared_ptr<runtime::Tensor>>& inputs)
+{
+    NGRAPH_CHECK(m_parameter_slots.size() == inputs.size());
+    NGRAPH_CHECK(m_wrapped_function->get_results().size() == outputs.size());
+
+    // Must outlive values so no intermediate is released after the arena is reset or used
+    // after the planned pool is handed to another call. A concurrent call that finds the
+    // arena busy allocates normally.
+    unique_lock<mutex> arena_lock(m_arena_mutex, try_to_lock);
+    Allocator* allocator = nullptr;
+    bool use_pool = false;
+    if (arena_lock.owns_lock())
+    {
+        m_arena.reset();
+        allocator = &m_arena;
+        use_pool = m_planned_pool != nullptr;
+    }
+
+    vector<HostTensorPtr> values(m_slot_count);
+    for (auto& constant : m_constant_slots)
+    {
+        values[constant.first] = constant.second;
+    }
+
+    const ParameterVector& parameters = m_wrapped_function->get_parameters();
+    vector<Shape> input_shapes;
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        shared_ptr<runtime::Tensor> input = inputs[i];
+        if (auto dynamic_tensor = dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(input))
+        {
+            NGRAPH_CHECK(dynamic_tensor->has_storage());
+            input = dynamic_tensor->get_wrapped_tensor();
+        }
+        NGRAPH_CHECK(parameters[i]->get_output_partial_shape(0).relaxes(input->get_shape()),
+                     "Input ",
+                     i,
+                     " has shape ",
+                     input->get_shape(),
+                     " which is incompatible with ",
+                     parameters[i]->get_output_partial_shape(0));
+
+        auto host_tensor = dynamic_pointer_cast<HostTensor>(input);
+        if (!host_tensor)
+        {
+            host_tensor = make_shared<HostTensor>(
+                input->get_element_type(), input->get_shape(), "", allocator);
+            input->read(host_tensor->get_data_ptr(), input->get_size_in_bytes());
+        }
+        values[m_parameter_slots[i]] = host_tensor;
+        input_shapes.push_back(input->get_shape());
+    }
+
+    // Outputs are sized before any op runs, from result shapes memoized per input shape
+    // signature. Results whose shape depends on values are sized when they are written.
+    vector<PartialShape> output_shapes =
+        get_shape_propagator().get_output_partial_shapes(input_shapes);
+    for (size_t i = 0; i < outputs.size(); i++)
+    {
+        if (output_shapes[i].is_dynamic())
+        {
+            continue;
+        }
+        if (auto dynamic_tensor = dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(outputs[i]))
+        {
+            dynamic_tensor->make_storage(m_wrapped_function->get_output_element_type(i),
+                                         output_shapes[i].to_shape());
+        }
+        else
+        {
+            NGRAPH_CHECK(outputs[i]->get_partial_shape().relaxes(output_shapes[i]),
+                         "Output ",
+                         i,
+                         " has shape ",
+                         outputs[i]->get_partial_shape(),
+                         " which is incompatible with ",
+                         output_shapes[i]);
+        }
+    }
+
+    for (auto& step : m_steps)
+    {
+        if (step.node->is_output())
+        {
+            auto& value = values[step.inputs[0]];
+            shared_ptr<runtime::Tensor> output = outputs[step.result_index];
+            if (auto dynamic_tensor = dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(output))
+            {
+                if (output_shapes[step.result_index].is_dynamic())
+                {
+                    dynamic_tensor->make_storage(value->get_element_type(), value->get_shape());
+                }
+                output = dynamic_tensor->get_wrapped_tensor();
+            }
+            output->write(value->get_data_ptr(), value->get_size_in_bytes());
+            continue;
+        }
+
+        HostTensorVector step_inputs;
+        for (size_t slot : step.inputs)
+        {
+            step_inputs.push_back(values[slot]);
+        }
+        HostTensorVector step_outputs;
+        for (size_t i = 0; i < step.outputs.size(); i++)
+        {
+            Allocator* output_allocator = allocator;
+            if (use_pool && m_slot_allocators[step.outputs[i]])
+            {
+                output_allocator = m_slot_allocators[step.outputs[i]].get();
+            }
+            auto output = make_shared<HostTensor>(step.node->get_output_element_type(i),
+                                                  step.node->get_output_partial_shape(i),
+                                                  "",
+                                                  output_allocator);
+            values[step.outputs[i]] = output;
+            step_outputs.push_back(output);
+        }
+
+        // Evaluators that need static shapes either decline or fail a shape check
+        bool evaluated = false;
+        try
+        {
+            evaluated = step.node->evaluate(step_outputs, step_inputs);
+        }
+        catch (const ngraph_error& e)
+        {
+            NGRAPH_DEBUG << "Evaluating " << *step.node << " failed: " << e.what();
+        }
+        if (!evaluated)
+        {
+            NGRAPH_WARN << *step.node << " has no shape-polymorphic evaluator, "
+                        << m_wrapped_function->get_name() << " falls back to specialization";
+            return false;
+        }
+    }
+
+    return true;
+}
+
+shared_ptr<runtime::dynamic::DynamicExecutable::HybridPlan>
+    runtime::dynamic::DynamicExecutable::build_hybrid_plan(const shared_ptr<Function>& clone)
+{
+    auto plan = make_shared<HybridPlan>();
+    plan->clone = clone;
+    set<Node*> host_nodes;
+    for (auto& node : clone->get_ordered_ops())
+    {
+        if (node->is_parameter() || node->is_constant())
+        {
+            continue;
+        }
+        bool on_host = node->is_output();
+        for (auto& output : node->outputs())
+        {
+            on_host = on_host || output.get_partial_shape().is_dynamic();
+        }
+        for (auto& input : node->inputs())
+        {
+            on_host = on_host || host_nodes.count(input.get_source_output().get_node()) != 0;
+        }
+        if (on_host)
+        {
+            host_nodes.insert(node.get());
+            plan->host_nodes.push_back(node);
+        }
+    }
+
+    // The compiled part returns the values the host ops read
+    set<pair<Node*, size_t>> returned;
+    ResultVector results;
+    for (auto& node : plan->host_nodes)
+    {
+        for (auto& input : node->inputs())
+        {
+            auto source = input.get_source_output();
+            Node* source_node = source.get_node();
+            if (host_nodes.count(source_node) == 0 && !source_node->is_parameter() &&
+                !source_node->is_constant() &&
+                returned.insert(make_pair(source_node, source.get_index())).second)
+            {
+                plan->executable_outputs.push_back(source);
+                results.push_back(make_shared<op::v0::Result>(source));
+            }
+        }
+    }
+    if (!results.empty())
+    {
+        // Compiled from a copy, as the backend passes rewrite what they compile
+        auto compiled_part = make_shared<Function>(results, clone->get_parameters());
+        plan->executable = m_wrapped_backend->compile(clone_function(*compiled_part),
+                                                      m_enable_performance_collection);
+    }
+    NGRAPH_DEBUG << "Evaluating " << plan->host_nodes.size() << " ops of "
+                 << m_wrapped_function->get_name() << " on host after "
+                 << plan->executable_outputs.size() << " compiled outputs";
+    return plan;
+}
+
+bool runtime::dynamic::DynamicExecutable::call_hybrid(
+    const HybridPlan& plan,
+    const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+    const std::vector<std::shared_ptr<runtime::Tensor>>& inputs)
+{
+    const ParameterVector& parameters = plan.clone->get_parameters();
+    NGRAPH_CHECK(parameters.size() == inputs.size());
+    NGRAPH_CHECK(plan.clone->get_results().size() == outputs.size());
+
+    vector<shared_ptr<runtime::Tensor>> wrapped_inputs;
+    for (auto& input : inputs)
+    {
+        if (auto dynamic_tensor = dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(input))
+        {
+            NGRAPH_CHECK(dynamic_tensor->has_storage());
+            wrapped_inputs.push_back(dynamic_tensor->get_wrapped_tensor());
+        }
+        else
+        {
+            wrapped_inputs.push_back(input);
+        }
+    }
+
+    map<pair<Node*, size_t>, HostTensorPtr> values;
+    if (plan.executable)
+    {
+        vector<shared_ptr<runtime::Tensor>> compiled_outputs;
+        for (auto& output : plan.executable_outputs)
+        {
+            compiled_outputs.push_back(
+                m_wrapped_backend->create_tensor(output.get_element_type(), output.get_shape()));
+        }
+        if (!plan.executable->call(compiled_outputs, wrapped_inputs))
+        {
+            return false;
+        }
+        for (size_t i = 0; i < compiled_outputs.size(); i++)
+        {
+            auto& output = plan.executable_outputs[i];
+            auto value = make_shared<HostTensor>(output.get_element_type(), output.get_shape());
+            compiled_outputs[i]->read(value->get_data_ptr(), value->get_size_in_bytes());
+            values[make_pair(output.get_node(), output.get_index())] = value;
+        }
+    }
+
+    auto value_of = [&](const Output<Node>& source) {
+        auto key = make_pair(source.get_node(), source.get_index());
+        auto it = values.find(key);
+        if (it != values.end())
+        {
+            return it->second;
+        }
+        HostTensorPtr value;
+        if (auto constant = as_type_ptr<op::v0::Constant>(source.get_node_shared_ptr()))
+        {
+            value = make_shared<HostTensor>(constant);
+        }
+        else
+        {
+            auto parameter = as_type_ptr<op::v0::Parameter>(source.get_node_shared_ptr());
+            NGRAPH_CHECK(parameter, "No value for ", source);
+            auto index = distance(parameters.begin(),
+                                  find(parameters.begin(), parameters.end(), parameter));
+            auto& input = wrapped_inputs.at(index);
+            value = dynamic_pointer_cast<HostTensor>(input);
+            if (!value)
+            {
+                value = make_shared<HostTensor>(input->get_element_type(), input->get_shape());
+                input->read(value->get_data_ptr(), input->get_size_in_bytes());
+            }
+        }
+        values[key] = value;
+        return value;
+    };
+
+    const ResultVector& results = plan.clone->get_results();
+    for (auto& node : plan.host_nodes)
+    {
+        if (node->is_output())
+        {
+            auto value = value_of(node->input_value(0));
+            auto index = distance(results.begin(), find(results.begin(), results.end(), node));
+            shared_ptr<runtime::Tensor> output = outputs.at(index);
+            if (auto dynamic_tensor = dynamic_pointer_cast<runtime::dynamic::DynamicTensor>(output))
+            {
+                dynamic_tensor->make_storage(value->get_element_type(), value->get_shape());
+                output = dynamic_tensor->get_wrapped_tensor();
+            }
+            else if (auto host_tensor = dynamic_pointer_cast<HostTensor>(output))
+            {
+                if (host_tensor->get_partial_shape().is_dynamic())
+                {
+                    host_tensor->set_unary(value);
+                }
+            }
+            output->write(value->get_data_ptr(), value->get_size_in_bytes());
+            continue;
+        }
+
+        HostTensorVector node_inputs;
+        for (auto& input : node->input_values())
+        {
+            node_inputs.push_back(value_of(input));
+        }
+        HostTensorVector node_outputs;
+        for (size_t i = 0; i < node->get_output_size(); i++)
+        {
+            auto output = make_shared<HostTensor>(node->get_output_element_type(i),
+                                                  node->get_output_partial_shape(i));
+            values[make_pair(node.get(), i)] = output;
+            node_outputs.push_back(output);
+        }
+        if (!node->evaluate(node_outputs, node_inputs))
+        {
+            throw ngraph_error("Shape staticization failed for " + node->get_name() +
+                               ", which has no evaluator to run it after an op whose output "
+                               "shape depends on values");
+        }
+    }
+    return true;
 }
 
 // Due to clang++-3.9 bugs, this needs to be a non-static separate function from
@@ -84,13 +608,21 @@ bool runtime::dynamic::DynamicExecutable::call(
     const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
     const std::vector<std::shared_ptr<runtime::Tensor>>& inputs)
 {
+    if (m_shape_polymorphic)
+    {
+        if (call_polymorphic(outputs, inputs))
+        {
+            return true;
+        }
+        m_shape_polymorphic = false;
+    }
+
     // TODO: Get cached executable out if it exists.
     // We will cache on:
     // (1) all shapes;
     // (2) all values of shape-relevant input tensors.
 
     std::vector<int> merged_input_shapes;
-    std::ostringstream key;
     size_t loop_count = 0;
     for (auto& input : inputs)
     {
@@ -120,16 +652,26 @@ bool runtime::dynamic::DynamicExecutable::call(
         loop_count++;
     }
 
-    std::copy(merged_input_shapes.begin(),
-              merged_input_shapes.end(),
-              std::ostream_iterator<int>(key, ", "));
+    shared_ptr<HybridPlan> hybrid_plan;
+    {
+        lock_guard<mutex> lock(m_hybrid_plans_mutex);
+        auto it = m_hybrid_plans.find(merged_input_shapes);
+        if (it != m_hybrid_plans.end())
+        {
+            hybrid_plan = it->second;
+        }
+    }
+    if (hybrid_plan)
+    {
+        return call_hybrid(*hybrid_plan, outputs, inputs);
+    }
 
-    if (m_cache->is_cached(merged_input_shapes))
+    std::shared_ptr<runtime::Executable> cached_executable;
+    std::shared_ptr<Function> clone;
+    if (m_cache->find_entry(merged_input_shapes, cached_executable, clone))
     {
-        std::vector<std::shared_ptr<runtime::Tensor>> wrapped_inputs;
         std::vector<std::shared_ptr<runtime::Tensor>> wrapped_outputs;
 
-        std::shared_ptr<Function> clone = m_cache->get_cloned_function(merged_input_shapes);
         const ResultVector& results = clone->get_results();
         for (auto& result : results)
         {
@@ -154,7 +696,7 @@ bool runtime::dynamic::DynamicExecutable::call(
             }
         }
 
-        return m_cache->get_cached_entry(merged_input_shapes)->call(wrapped_outputs, inputs);
+        return cached_executable->call(wrapped_outputs, inputs);
     }
     else
     {
@@ -164,7 +706,6 @@ bool runtime::dynamic::DynamicExecutable::call(
         std::vector<element::Type> arg_element_types;
         std::vector<PartialShape> arg_shapes;
 
-        std::shared_ptr<Function> clone;
         {
             // We'll use AlignedBuffers to back the base pointers, storing them in this vector for
             // RAII
@@ -261,9 +802,16 @@ bool runtime::dynamic::DynamicExecutable::call(
         const ResultVector& results = clone->get_results();
         for (auto& result : results)
         {
-            NGRAPH_CHECK(result->get_output_partial_shape(0).is_static(),
-                         "Shape staticization failed for result node ",
-                         *result);
+            if (result->get_output_partial_shape(0).is_dynamic())
+            {
+                // Some shape depends on values, so part of the clone runs on host
+                hybrid_plan = build_hybrid_plan(clone);
+                {
+                    lock_guard<mutex> lock(m_hybrid_plans_mutex);
+                    m_hybrid_plans[merged_input_shapes] = hybrid_plan;
+                }
+                return call_hybrid(*hybrid_plan, outputs, inputs);
+            }
         }
         NGRAPH_CHECK(results.size() == outputs.size());
 
@@ -282,10 +830,14 @@ bool runtime::dynamic::DynamicExecutable::call(
             }
         }
 
+        stopwatch timer;
+        timer.start();
         auto compiled_executable =
             m_wrapped_backend->compile(clone, m_enable_performance_collection);
+        timer.stop();
         // Put compiled executable in the cache.
-        m_cache->add_entry(merged_input_shapes, compiled_executable, clone);
+        m_cache->add_entry(
+            merged_input_shapes, compiled_executable, clone, timer.get_microseconds());
         auto result = compiled_executable->call(wrapped_outputs, wrapped_inputs);
 
         return result;
@@ -16,12 +16,19 @@
 
 #pragma once
 
+#include <atomic>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/arena_allocator.hpp"
 #include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/dynamic/shape_propagator.hpp"
 #include "ngraph/runtime/executable.hpp"
 #include "ngraph/runtime/executable_cache.hpp"
 
@@ -48,21 +55,107 @@ namespace ngraph
 /// 2. compiles the clone using the wrapped backend;
 /// 3. fowards the input tensors to the clone executable for actual execution.
 ///
+/// When shape polymorphism is enabled the executable first tries to run the stored function
+/// as is: the graph is planned once with its symbolic dimensions and every call evaluates the
+/// ops on host tensors whose shapes are only fixed at call time, so no per-shape clone or
+/// compile is needed. Only ops that implement `Node::evaluate` can run this way, and they run
+/// on the host reference implementation rather than on the kernels of the wrapped backend.
+/// The first call that hits an op without a shape-polymorphic evaluator (or a function whose
+/// parameter values determine shapes) turns the mode off for good, with a warning, and the
+/// executable falls back to the specialization path above. The output tensors are sized before
+/// the ops run, from result shapes a `ShapePropagator` memoizes per input shape signature.
+///
+/// If every dimension of every parameter has an upper bound (for example `Dimension(1, 512)`),
+/// the polymorphic plan also lays out one memory pool with `pass::MemoryLayout` for the
+/// function specialized to those bounds. Calls whose shapes fit reuse that pool for all
+/// intermediates; a value that outgrows its planned slot is allocated from the arena instead.
+///
+/// Ops whose output shapes depend on input values, such as NonZero, cannot be specialized
+/// away. When a specialized clone still has dynamic results, only the ops before them are
+/// compiled; those ops and everything downstream of them are evaluated on host tensors after
+/// each call of the compiled part. This plan is cached per input shape like a compiled clone,
+/// so a value-dependent output shape never triggers a recompile.
+///
 /// `DynamicExecutable` objects are produced by `DynamicBackend::compile()`.
 ///
-class ngraph::runtime::dynamic::DynamicExecutable : public ngraph::runtime::Executable
+class NGRAPH_API ngraph::runtime::dynamic::DynamicExecutable : public ngraph::runtime::Executable
 {
 public:
     DynamicExecutable(std::shared_ptr<Function> wrapped_function,
                       std::shared_ptr<ngraph::runtime::Backend> wrapped_backend,
-                      bool enable_performance_collection = false);
+                      bool enable_performance_collection = false,
+                      bool enable_shape_polymorphism = false);
     virtual bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                       const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
 
+    /// \brief True while calls are served without specializing the function.
+    bool is_shape_polymorphic() const { return m_shape_polymorphic; }
+
+    /// \brief Returns the result shapes for the given input shapes without specializing or
+    ///        compiling anything, e.g. to allocate static output tensors before a call.
+    ///        Not available when a parameter value is relevant to shapes.
+    std::vector<Shape> get_output_shapes(const std::vector<Shape>& input_shapes);
+
+    /// \brief Size in bytes of the pool planned for the parameter upper bounds, 0 if none.
+    size_t get_planned_pool_size() const { return m_planned_pool ? m_planned_pool->size() : 0; }
+
 private:
+    /// One op of the shape-polymorphic plan; inputs and outputs index into the value slots
+    struct PolymorphicStep
+    {
+        Node* node;
+        std::vector<size_t> inputs;
+        std::vector<size_t> outputs;
+        /// For Result nodes, the function output written by this step
+        size_t result_index;
+    };
+
+    /// A specialization whose results are not all static
+    struct HybridPlan
+    {
+        std::shared_ptr<Function> clone;
+        /// Compiled ops of the clone feeding the host ops, nullptr if only parameters and
+        /// constants do
+        std::shared_ptr<runtime::Executable> executable;
+        /// The values of the clone that `executable` returns, in order
+        std::vector<Output<Node>> executable_outputs;
+        /// Ops with a dynamic output or input and all results, in topological order
+        std::vector<std::shared_ptr<Node>> host_nodes;
+    };
+
+    std::shared_ptr<HybridPlan> build_hybrid_plan(const std::shared_ptr<Function>& clone);
+    bool call_hybrid(const HybridPlan& plan,
+                     const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                     const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+    void build_polymorphic_plan();
+    void build_upper_bound_plan(const std::unordered_map<Node*, size_t>& first_slot);
+    ShapePropagator& get_shape_propagator();
+    /// \returns false if some op could not be evaluated without static shapes
+    bool call_polymorphic(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                          const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+
     std::shared_ptr<ngraph::Function> m_wrapped_function;
     std::shared_ptr<ngraph::runtime::Backend> m_wrapped_backend;
     std::shared_ptr<ngraph::runtime::ExecutableCache> m_cache =
         std::make_shared<ngraph::runtime::ExecutableCache>();
     bool m_enable_performance_collection;
+    std::map<std::vector<int>, std::shared_ptr<HybridPlan>> m_hybrid_plans;
+    std::mutex m_hybrid_plans_mutex;
+    std::unique_ptr<ShapePropagator> m_shape_propagator;
+    std::mutex m_shape_propagator_mutex;
+
+    std::atomic<bool> m_shape_polymorphic{false};
+    size_t m_slot_count = 0;
+    std::vector<size_t> m_parameter_slots;
+    std::vector<std::pair<size_t, HostTensorPtr>> m_constant_slots;
+    std::vector<PolymorphicStep> m_steps;
+    /// Intermediates of one polymorphic call; reset per call so it grows to the largest shape
+    /// seen so far and then stops allocating
+    ArenaAllocator m_arena;
+    std::mutex m_arena_mutex;
+    /// Pool laid out for the upper bounds and one allocator per value slot handing out its
+    /// planned part of the pool (nullptr for slots the plan does not cover). Only used by the
+    /// call holding m_arena_mutex.
+    std::unique_ptr<AlignedBuffer> m_planned_pool;
+    std::vector<std::unique_ptr<Allocator>> m_slot_allocators;
 };
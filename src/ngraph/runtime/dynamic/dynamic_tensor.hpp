@@ -53,7 +53,7 @@ namespace ngraph
 ///    called until the storage has been released via `release_storage()`.
 /// 4. `release_storage()` unassigns previously assigned storage.
 ///
-class ngraph::runtime::dynamic::DynamicTensor : public ngraph::runtime::Tensor
+class NGRAPH_API ngraph::runtime::dynamic::DynamicTensor : public ngraph::runtime::Tensor
 {
 public:
     DynamicTensor(const element::Type& element_type,
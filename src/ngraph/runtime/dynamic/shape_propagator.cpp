@@ -0,0 +1,155 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <set>
+#include <utility>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/runtime/dynamic/shape_propagator.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::dynamic::ShapePropagator::ShapePropagator(const shared_ptr<Function>& function,
+                                                   size_t cache_size)
+    : m_cache_size(cache_size)
+{
+    for (auto& param : function->get_parameters())
+    {
+        if (param->is_relevant_to_shapes())
+        {
+            m_supported = false;
+            return;
+        }
+    }
+    m_function = clone_function(*function);
+    for (auto& node : m_function->get_ordered_ops())
+    {
+        m_ops.push_back(node);
+    }
+}
+
+vector<Shape>
+    runtime::dynamic::ShapePropagator::get_output_shapes(const vector<Shape>& input_shapes)
+{
+    vector<PartialShape> partial_shapes = get_output_partial_shapes(input_shapes);
+    vector<Shape> output_shapes;
+    for (size_t i = 0; i < partial_shapes.size(); i++)
+    {
+        NGRAPH_CHECK(partial_shapes[i].is_static(),
+                     "Shape propagation did not produce a static shape for result ",
+                     i);
+        output_shapes.push_back(partial_shapes[i].to_shape());
+    }
+    return output_shapes;
+}
+
+vector<PartialShape> runtime::dynamic::ShapePropagator::get_output_partial_shapes(
+    const vector<Shape>& input_shapes)
+{
+    NGRAPH_CHECK(m_supported, "Shape propagation needs the values of shape-relevant parameters");
+
+    lock_guard<mutex> lock(m_mutex);
+    auto it = m_memo.find(input_shapes);
+    if (it != m_memo.end())
+    {
+        return it->second;
+    }
+
+    const ParameterVector& parameters = m_function->get_parameters();
+    NGRAPH_CHECK(parameters.size() == input_shapes.size(),
+                 "Expected ",
+                 parameters.size(),
+                 " input shapes, got ",
+                 input_shapes.size());
+
+    // Outputs whose shapes differ from the previous signature; only the nodes reading them are
+    // re-inferred
+    set<pair<Node*, size_t>> changed;
+    size_t reinferred = 0;
+    try
+    {
+        for (size_t i = 0; i < parameters.size(); i++)
+        {
+            PartialShape shape(input_shapes[i]);
+            if (!m_consistent || !parameters[i]->get_output_partial_shape(0).same_scheme(shape))
+            {
+                parameters[i]->set_partial_shape(shape);
+                parameters[i]->validate_and_infer_types();
+                changed.insert(make_pair(parameters[i].get(), 0));
+            }
+        }
+
+        for (auto& node : m_ops)
+        {
+            if (node->is_parameter())
+            {
+                continue;
+            }
+            bool inputs_changed = false;
+            for (auto& input : node->inputs())
+            {
+                auto source = input.get_source_output();
+                if (!m_consistent ||
+                    changed.count(make_pair(source.get_node(), source.get_index())) != 0)
+                {
+                    inputs_changed = true;
+                    break;
+                }
+            }
+            if (!inputs_changed)
+            {
+                continue;
+            }
+
+            vector<PartialShape> old_shapes;
+            for (auto& output : node->outputs())
+            {
+                old_shapes.push_back(output.get_partial_shape());
+            }
+            node->validate_and_infer_types();
+            reinferred++;
+            for (size_t i = 0; i < old_shapes.size(); i++)
+            {
+                if (!node->get_output_partial_shape(i).same_scheme(old_shapes[i]))
+                {
+                    changed.insert(make_pair(node.get(), i));
+                }
+            }
+        }
+    }
+    catch (...)
+    {
+        m_consistent = false;
+        throw;
+    }
+    m_consistent = true;
+    m_last_reinferred_count = reinferred;
+
+    vector<PartialShape> output_shapes;
+    for (auto& result : m_function->get_results())
+    {
+        output_shapes.push_back(result->get_output_partial_shape(0));
+    }
+
+    if (m_memo.size() >= m_cache_size)
+    {
+        m_memo.clear();
+    }
+    m_memo.emplace(input_shapes, output_shapes);
+    return output_shapes;
+}
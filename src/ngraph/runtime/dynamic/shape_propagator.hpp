@@ -0,0 +1,77 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/partial_shape.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace dynamic
+        {
+            class ShapePropagator;
+        }
+    }
+}
+
+///
+/// \brief Computes the result shapes of a function for concrete input shapes without cloning
+///        or revalidating the whole graph each time.
+///
+/// The propagator keeps one private clone of the function. For a new input shape signature
+/// it refines the clone's parameters and re-runs shape inference only on the nodes reading an
+/// output whose shape actually changed; results are memoized per signature. Functions
+/// with a parameter whose value is relevant to shapes (see `pass::ShapeRelevance`) need the
+/// values, not only the shapes, and are not supported.
+///
+class NGRAPH_API ngraph::runtime::dynamic::ShapePropagator
+{
+public:
+    /// \param function   Function whose parameters have been flagged by ShapeRelevance.
+    /// \param cache_size Number of memoized signatures kept before the memo is cleared.
+    ShapePropagator(const std::shared_ptr<Function>& function, size_t cache_size = 1024);
+
+    /// \brief False if some parameter value determines shapes.
+    bool is_supported() const { return m_supported; }
+    /// \brief Returns the result shapes for `input_shapes`, one per parameter.
+    std::vector<Shape> get_output_shapes(const std::vector<Shape>& input_shapes);
+    /// \brief Like get_output_shapes, but results whose shape depends on values are dynamic
+    ///        instead of an error.
+    std::vector<PartialShape> get_output_partial_shapes(const std::vector<Shape>& input_shapes);
+
+    /// \brief Number of nodes re-inferred by the most recent memo miss.
+    size_t get_last_reinferred_count() const { return m_last_reinferred_count; }
+
+private:
+    bool m_supported = true;
+    size_t m_cache_size;
+    std::shared_ptr<Function> m_function;
+    std::vector<std::shared_ptr<Node>> m_ops;
+    std::map<std::vector<Shape>, std::vector<PartialShape>> m_memo;
+    size_t m_last_reinferred_count = 0;
+    /// False after an inference failed part way; the next miss then re-infers everything
+    bool m_consistent = true;
+    std::mutex m_mutex;
+};
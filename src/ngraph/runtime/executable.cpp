@@ -17,7 +17,10 @@
 #include <sstream>
 
 #include "ngraph/file_util.hpp"
+#include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/pass/pass_util.hpp"
 #include "ngraph/runtime/executable.hpp"
 #include "ngraph/runtime/tensor.hpp"
 #include "ngraph/util.hpp"
@@ -29,6 +32,21 @@ runtime::Executable::Executable() {}
 
 runtime::Executable::~Executable() {}
 
+future<bool> runtime::Executable::call_async(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                                const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    promise<bool> result;
+    try
+    {
+        result.set_value(call(outputs, inputs));
+    }
+    catch (...)
+    {
+        result.set_exception(current_exception());
+    }
+    return result.get_future();
+}
+
 bool runtime::Executable::call_with_validate(const vector<shared_ptr<runtime::Tensor>>& outputs,
                                              const vector<shared_ptr<runtime::Tensor>>& inputs)
 {
@@ -107,6 +125,8 @@ const ngraph::ResultVector& runtime::Executable::get_results() const
     return m_results;
 }
 
+void runtime::Executable::warm_up() {}
+
 size_t runtime::Executable::get_preferred_pipeline_depth() const
 {
     return 2;
@@ -123,11 +143,36 @@ vector<runtime::PerformanceCounter> runtime::Executable::get_performance_data()
     return vector<PerformanceCounter>();
 }
 
+runtime::MemoryFootprint runtime::Executable::get_memory_footprint() const
+{
+    MemoryFootprint footprint;
+    NodeVector results(m_results.begin(), m_results.end());
+    traverse_nodes(results, [&](shared_ptr<Node> node) {
+        if (auto constant = as_type_ptr<op::v0::Constant>(node))
+        {
+            footprint.constant_bytes += pass::constant_byte_size(*constant);
+        }
+    });
+    return footprint;
+}
+
 void runtime::Executable::save(std::ostream& /* output_stream */)
 {
     throw runtime_error("save operation unimplemented.");
 }
 
+bool runtime::Executable::read_variable(const string& /* variable_id */,
+                                        const shared_ptr<runtime::Tensor>& /* tensor */)
+{
+    throw runtime_error("read_variable unimplemented");
+}
+
+void runtime::Executable::write_variable(const string& /* variable_id */,
+                                         const shared_ptr<runtime::Tensor>& /* tensor */)
+{
+    throw runtime_error("write_variable unimplemented");
+}
+
 shared_ptr<runtime::Tensor> runtime::Executable::create_input_tensor(size_t /* input_index */)
 {
     throw runtime_error("create_input_tensor unimplemented");
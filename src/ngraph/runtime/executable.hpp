@@ -16,9 +16,11 @@
 
 #pragma once
 
+#include <future>
 #include <memory>
 
 #include "ngraph/function.hpp"
+#include "ngraph/runtime/memory_footprint.hpp"
 #include "ngraph/runtime/performance_counter.hpp"
 #include "ngraph/runtime/tensor.hpp"
 #include "ngraph/shape.hpp"
@@ -44,6 +46,18 @@ public:
     virtual bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                       const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) = 0;
 
+    /// \brief Starts a single iteration of a Function without waiting for it to complete.
+    ///
+    /// Until the returned future is ready the tensors may only be accessed through
+    /// Tensor::read and Tensor::write, which wait for the call as needed, and this executable
+    /// must be kept alive. The default implementation completes the call before returning.
+    /// \param outputs vector of runtime::Tensor used as outputs
+    /// \param inputs vector of runtime::Tensor used as inputs
+    /// \returns A future holding the result of call, or the exception it threw
+    virtual std::future<bool>
+        call_async(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                   const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+
     /// \brief Executes a single iteration of a Function.
     /// \param outputs vector of runtime::Tensor used as outputs
     /// \param inputs vector of runtime::Tensor used as inputs
@@ -51,10 +65,24 @@ public:
     bool call_with_validate(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                             const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
 
+    /// \brief Does the work of the first call ahead of time, so that the first call on real
+    ///        inputs runs as fast as the following ones.
+    ///
+    /// Backends run the function on zeros here as many times as they need, which counts in
+    /// the performance data like any call, and leave the values of its variables as they
+    /// were. The default implementation does nothing.
+    virtual void warm_up();
+
     /// \brief Collect performance information gathered on a Function.
     /// \returns Vector of PerformanceCounter information.
     virtual std::vector<PerformanceCounter> get_performance_data() const;
 
+    /// \brief Reports the memory this executable holds, for capacity planning.
+    ///
+    /// Pools allocated lazily count once the calls needing them have run. The default
+    /// implementation only reports the constants reachable from the results.
+    virtual MemoryFootprint get_memory_footprint() const;
+
     /// \brief Validates a Function.
     /// \param outputs vector of runtime::Tensor used as outputs
     /// \param inputs vector of runtime::Tensor used as inputs
@@ -77,6 +105,21 @@ public:
     ///    Saved stream may be read with Backend::load
     virtual void save(std::ostream& output_stream);
 
+    /// \brief Copies the value of a variable of the function, see op::v0::ReadVariable, into
+    ///        `tensor`.
+    /// \param variable_id id of the variable
+    /// \param tensor tensor of the element type and shape of the variable
+    /// \returns false if the variable has not been assigned yet, in which case `tensor` is
+    ///          left unchanged
+    virtual bool read_variable(const std::string& variable_id,
+                               const std::shared_ptr<runtime::Tensor>& tensor);
+
+    /// \brief Sets the value of a variable of the function for the following calls.
+    /// \param variable_id id of the variable
+    /// \param tensor tensor of the element type and shape of the variable
+    virtual void write_variable(const std::string& variable_id,
+                                const std::shared_ptr<runtime::Tensor>& tensor);
+
     /// \brief Create an input Tensor
     /// \param input_index The index position in the input Parameter vector. This would be the same
     /// order of Parameters passed into the inputs in the call() method.
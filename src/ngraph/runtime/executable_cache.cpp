@@ -14,17 +14,15 @@
 // limitations under the License.
 //*****************************************************************************
 
-#include <exception>
-#include <iterator>
-
-#include "ngraph/env_util.hpp"
 #include "ngraph/runtime/executable_cache.hpp"
-#include "ngraph/util.hpp"
+#include "ngraph/env_util.hpp"
+#include "ngraph/except.hpp"
 
 using namespace ngraph;
 using namespace std;
 
-runtime::ExecutableCache::ExecutableCache()
+runtime::ExecutableCache::ExecutableCache(bool enable_shape_bucketing)
+    : m_enable_shape_bucketing(enable_shape_bucketing)
 {
     int32_t cache_size = getenv_int("NGRAPH_CACHE_SIZE");
     if (cache_size <= 0)
@@ -35,95 +33,142 @@ runtime::ExecutableCache::ExecutableCache()
     {
         m_cache_size = cache_size;
     }
-
-    m_map = {};
-    m_list = {};
+    m_map.reserve(m_cache_size);
 }
 
 runtime::ExecutableCache::~ExecutableCache() {}
 
-void runtime::ExecutableCache::convert_shape_to_string(const vector<int>& shape, ostringstream& key)
+size_t runtime::ExecutableCache::KeyHash::operator()(const vector<int>& key) const
+{
+    // FNV-1a over the key values
+    size_t hash = 14695981039346656037ULL;
+    for (int v : key)
+    {
+        hash ^= static_cast<size_t>(static_cast<unsigned int>(v));
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+size_t runtime::ExecutableCache::bucket_dimension(size_t dim)
+{
+    size_t bucket = 1;
+    while (bucket < dim)
+    {
+        bucket <<= 1;
+    }
+    return dim == 0 ? 0 : bucket;
+}
+
+vector<int> runtime::ExecutableCache::bucket_shape(const vector<int>& shape)
+{
+    vector<int> bucketed(shape);
+    for (int& v : bucketed)
+    {
+        if (v >= 0)
+        {
+            v = static_cast<int>(bucket_dimension(static_cast<size_t>(v)));
+        }
+    }
+    return bucketed;
+}
+
+vector<int> runtime::ExecutableCache::make_key(const vector<int>& shape) const
+{
+    return m_enable_shape_bucketing ? bucket_shape(shape) : shape;
+}
+
+runtime::ExecutableCache::Entry* runtime::ExecutableCache::lookup(const vector<int>& key)
 {
-    if (!shape.empty())
+    auto it = m_map.find(key);
+    if (it == m_map.end())
     {
-        std::copy(shape.begin(), shape.end(), std::ostream_iterator<int>(key, ", "));
+        m_stats.misses++;
+        return nullptr;
     }
+    m_stats.hits++;
+    // move this reference to the front of the LRU list
+    m_list.splice(m_list.begin(), m_list, it->second.lru_pos);
+    return &it->second;
 }
 
 void runtime::ExecutableCache::add_entry(const vector<int>& shape,
                                          shared_ptr<runtime::Executable> exec,
-                                         shared_ptr<Function> func)
+                                         shared_ptr<Function> func,
+                                         size_t compile_time_us)
 {
     std::lock_guard<std::mutex> guard(m_mutex);
-    ostringstream key;
+    auto key = make_key(shape);
+    m_stats.compile_time_us += compile_time_us;
+
+    auto it = m_map.find(key);
+    if (it != m_map.end())
+    {
+        it->second.exec = exec;
+        it->second.func = func;
+        m_list.splice(m_list.begin(), m_list, it->second.lru_pos);
+        return;
+    }
+
     // check if the cache is full
     if (m_list.size() == m_cache_size)
     {
-        // The cache is full
-        ostringstream key;
-        convert_shape_to_string(m_list.back(), key);
+        m_map.erase(m_list.back());
         m_list.pop_back();
-        m_map.erase(key.str());
+        m_stats.evictions++;
     }
 
-    convert_shape_to_string(shape, key);
-    m_map.insert({key.str(), exec});
-    m_list.push_front(shape);
-    m_clone_function_map.insert({key.str(), func});
+    m_list.push_front(key);
+    m_map.insert({key, Entry{exec, func, m_list.begin()}});
 }
 
 bool runtime::ExecutableCache::is_cached(const vector<int>& shape)
 {
-    for (auto itr = m_list.begin(); itr != m_list.end(); itr++)
+    std::lock_guard<std::mutex> guard(m_mutex);
+    return m_map.find(make_key(shape)) != m_map.end();
+}
+
+bool runtime::ExecutableCache::find_entry(const vector<int>& shape,
+                                          shared_ptr<Executable>& exec,
+                                          shared_ptr<Function>& func)
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    auto entry = lookup(make_key(shape));
+    if (entry == nullptr)
     {
-        if (*itr == shape)
-        {
-            return true;
-        }
+        return false;
     }
-    return false;
+    exec = entry->exec;
+    func = entry->func;
+    return true;
 }
 
 shared_ptr<runtime::Executable> runtime::ExecutableCache::get_cached_entry(const vector<int>& shape)
 {
     std::lock_guard<std::mutex> guard(m_mutex);
-    ostringstream key;
-    convert_shape_to_string(shape, key);
-
-    // find the entry and return the function
-    auto it = m_map.find(key.str());
-    if (it == m_map.end())
+    auto entry = lookup(make_key(shape));
+    if (entry == nullptr)
     {
         throw ngraph_error("Entry not found in cache");
     }
-    else
-    {
-        // update list to push this reference to the front
-        for (auto itr = m_list.begin(); itr != m_list.end(); itr++)
-        {
-            if (*itr == shape)
-            {
-                m_list.remove(shape);
-                m_list.push_front(shape);
-                break;
-            }
-        }
-        return it->second;
-    }
+    return entry->exec;
 }
 
-// Need the clone function to get the output shape so that
-// storage can be allocated for output
 shared_ptr<Function> runtime::ExecutableCache::get_cloned_function(const vector<int>& shape)
 {
     std::lock_guard<std::mutex> guard(m_mutex);
-    ostringstream key;
-    convert_shape_to_string(shape, key);
-    // find the entry and return the function
-    auto it = m_clone_function_map.find(key.str());
-    if (it == m_clone_function_map.end())
+    auto it = m_map.find(make_key(shape));
+    if (it == m_map.end())
     {
         throw ngraph_error("Cloned function not found");
     }
-    return it->second;
+    return it->second.func;
+}
+
+runtime::ExecutableCache::Statistics runtime::ExecutableCache::get_statistics()
+{
+    std::lock_guard<std::mutex> guard(m_mutex);
+    Statistics stats = m_stats;
+    stats.entries = m_map.size();
+    return stats;
 }
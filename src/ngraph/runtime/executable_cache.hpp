@@ -34,28 +34,74 @@ namespace ngraph
     }
 }
 
-class ngraph::runtime::ExecutableCache
+/// \brief LRU cache of compiled executables keyed by a vector of (shape) integers.
+///
+/// Keys are hashed directly; every lookup is a single hash probe and an O(1) LRU update
+/// under one lock. When shape bucketing is enabled every non-negative key value is rounded
+/// up to the next power of two before it is used, so callers that pad their inputs to the
+/// bucketed shape can share one executable across many nearby shapes. Bucketing is only
+/// correct for callers that actually pad to the bucketed shape, so it is off by default.
+class NGRAPH_API ngraph::runtime::ExecutableCache
 {
 public:
-    using GraphCache = std::unordered_map<std::string, std::shared_ptr<Executable>>;
-    using ClonedFunctionMap = std::unordered_map<std::string, std::shared_ptr<Function>>;
+    struct Statistics
+    {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t evictions = 0;
+        size_t entries = 0;
+        /// Total compile time reported through add_entry, in microseconds
+        size_t compile_time_us = 0;
+    };
 
-    ExecutableCache();
+    ExecutableCache(bool enable_shape_bucketing = false);
 
     virtual ~ExecutableCache();
 
     void add_entry(const std::vector<int>& shape,
                    std::shared_ptr<Executable> exec,
-                   std::shared_ptr<Function> func);
+                   std::shared_ptr<Function> func,
+                   size_t compile_time_us = 0);
     bool is_cached(const std::vector<int>& shape);
     std::shared_ptr<Executable> get_cached_entry(const std::vector<int>& shape);
-    void convert_shape_to_string(const std::vector<int>& shape, std::ostringstream& key);
     std::shared_ptr<Function> get_cloned_function(const std::vector<int>& shape);
 
+    /// \brief Looks up an entry with a single lock acquisition.
+    /// \returns true and fills `exec` and `func` on a hit, false on a miss.
+    bool find_entry(const std::vector<int>& shape,
+                    std::shared_ptr<Executable>& exec,
+                    std::shared_ptr<Function>& func);
+
+    Statistics get_statistics();
+    bool is_shape_bucketing_enabled() const { return m_enable_shape_bucketing; }
+    /// \brief Rounds `dim` up to the next power of two (0 and 1 are left unchanged).
+    static size_t bucket_dimension(size_t dim);
+    /// \brief Applies bucket_dimension to every non-negative value; negative separators are
+    ///        left unchanged.
+    static std::vector<int> bucket_shape(const std::vector<int>& shape);
+
 private:
+    struct KeyHash
+    {
+        size_t operator()(const std::vector<int>& key) const;
+    };
+    using LRUList = std::list<std::vector<int>>;
+    struct Entry
+    {
+        std::shared_ptr<Executable> exec;
+        std::shared_ptr<Function> func;
+        LRUList::iterator lru_pos;
+    };
+    using GraphCache = std::unordered_map<std::vector<int>, Entry, KeyHash>;
+
+    std::vector<int> make_key(const std::vector<int>& shape) const;
+    /// Must be called with m_mutex held
+    Entry* lookup(const std::vector<int>& key);
+
     size_t m_cache_size;
+    bool m_enable_shape_bucketing;
     GraphCache m_map;
-    ClonedFunctionMap m_clone_function_map;
-    std::list<std::vector<int>> m_list;
+    LRUList m_list;
+    Statistics m_stats;
     std::mutex m_mutex;
 };
@@ -62,6 +62,12 @@ bool runtime::gcpu::GCPUExecutable::call(const vector<shared_ptr<runtime::Tensor
         func_outputs.push_back(host_tensor);
     }
 
+    // Must outlive tensor_map so no intermediate tensor is released after the arena is reset or
+    // used after the memory pool is handed to another call
+    unique_lock<mutex> arena_lock;
+    Allocator* allocator = acquire_call_allocator(arena_lock);
+    char* pool = get_memory_pool(arena_lock);
+
     // map function params -> HostTensor
     unordered_map<descriptor::Tensor*, shared_ptr<HostTensor>> tensor_map;
     size_t input_count = 0;
@@ -112,10 +118,7 @@ bool runtime::gcpu::GCPUExecutable::call(const vector<shared_ptr<runtime::Tensor
             auto it = tensor_map.find(tensor);
             if (it == tensor_map.end())
             {
-                const Shape& shape = op->get_output_shape(i);
-                const element::Type& type = op->get_output_element_type(i);
-                string name = op->output(i).get_tensor().get_name();
-                host_tensor = make_shared<runtime::HostTensor>(type, shape, name);
+                host_tensor = create_intermediate_tensor(op->output(i), allocator, pool);
                 tensor_map.insert({tensor, host_tensor});
             }
             else
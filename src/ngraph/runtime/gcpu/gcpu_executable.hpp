@@ -26,6 +26,7 @@
 #include "ngraph/ops.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/gcpu/kernel/dot.hpp"
 #include "ngraph/runtime/host_tensor.hpp"
 #include "ngraph/runtime/interpreter/int_executable.hpp"
 #include "ngraph/runtime/opt_kernel/broadcast.hpp"
@@ -102,6 +103,18 @@ private:
                                      broadcast_axes);
             break;
         }
+        case ngraph::runtime::interpreter::OP_TYPEID::Dot_v0:
+        {
+            const op::v0::Dot* dot = static_cast<const op::v0::Dot*>(&node);
+            kernel::dot<T>(args[0]->get_data_ptr<const T>(),
+                           args[1]->get_data_ptr<const T>(),
+                           out[0]->get_data_ptr<T>(),
+                           node.get_input_shape(0),
+                           node.get_input_shape(1),
+                           node.get_output_shape(0),
+                           dot->get_reduction_axes_count());
+            break;
+        }
         case ngraph::runtime::interpreter::OP_TYPEID::Reshape_v0:
         {
             const op::v0::Reshape* reshape = static_cast<const op::v0::Reshape*>(&node);
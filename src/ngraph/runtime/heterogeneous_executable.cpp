@@ -0,0 +1,344 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <deque>
+#include <unordered_map>
+
+#include "ngraph/check.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/pass/pass_util.hpp"
+#include "ngraph/runtime/heterogeneous_executable.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Copies a tensor between backends through host memory
+static void transfer(const runtime::Tensor& source, runtime::Tensor& target)
+{
+    vector<char> staging(source.get_size_in_bytes());
+    source.read(staging.data(), staging.size());
+    target.write(staging.data(), staging.size());
+}
+
+runtime::HeterogeneousExecutable::HeterogeneousExecutable(
+    const shared_ptr<Function>& function,
+    const vector<shared_ptr<Backend>>& backends,
+    const CostFunction& cost)
+    : m_backends(backends)
+{
+    NGRAPH_CHECK(!m_backends.empty(), "HeterogeneousExecutable requires at least one backend");
+    set_parameters_and_results(*function);
+
+    // Place every op on the cheapest backend supporting it. Parameters, results and constants
+    // are not placed; constants are cloned into the segments using them.
+    vector<shared_ptr<Node>> ops = function->get_ordered_ops();
+    unordered_map<Node*, size_t> placement;
+    for (auto& node : ops)
+    {
+        if (node->is_parameter() || node->is_output() || node->is_constant())
+        {
+            continue;
+        }
+        size_t best = m_backends.size();
+        double best_cost = 0;
+        for (size_t b = 0; b < m_backends.size(); b++)
+        {
+            if (m_backends[b]->is_supported(*node))
+            {
+                double c = cost ? cost(*node, b) : static_cast<double>(b);
+                if (best == m_backends.size() || c < best_cost)
+                {
+                    best = b;
+                    best_cost = c;
+                }
+            }
+        }
+        NGRAPH_CHECK(best < m_backends.size(), "No backend supports ", *node);
+        placement[node.get()] = best;
+    }
+
+    // Schedule the placed ops in topological order, staying on the current backend while it
+    // has ready ops, so that each switch of backend starts a new segment
+    unordered_map<Node*, size_t> pending;
+    unordered_map<Node*, vector<shared_ptr<Node>>> successors;
+    vector<deque<shared_ptr<Node>>> ready(m_backends.size());
+    for (auto& node : ops)
+    {
+        if (placement.count(node.get()) == 0)
+        {
+            continue;
+        }
+        size_t& count = pending[node.get()];
+        NodeVector predecessors = node->get_control_dependencies();
+        for (auto& arg : node->input_values())
+        {
+            predecessors.push_back(arg.get_node_shared_ptr());
+        }
+        for (auto& predecessor : predecessors)
+        {
+            if (placement.count(predecessor.get()) != 0)
+            {
+                successors[predecessor.get()].push_back(node);
+                count++;
+            }
+        }
+        if (count == 0)
+        {
+            ready[placement[node.get()]].push_back(node);
+        }
+    }
+    vector<vector<shared_ptr<Node>>> segment_ops;
+    unordered_map<Node*, size_t> segment_of;
+    size_t current = m_backends.size();
+    while (true)
+    {
+        if (current == m_backends.size() || ready[current].empty())
+        {
+            current = 0;
+            while (current < m_backends.size() && ready[current].empty())
+            {
+                current++;
+            }
+            if (current == m_backends.size())
+            {
+                break;
+            }
+            segment_ops.emplace_back();
+            m_segments.emplace_back();
+            m_segments.back().backend = current;
+        }
+        auto node = ready[current].front();
+        ready[current].pop_front();
+        segment_of[node.get()] = segment_ops.size() - 1;
+        segment_ops.back().push_back(node);
+        for (auto& successor : successors[node.get()])
+        {
+            if (--pending[successor.get()] == 0)
+            {
+                ready[placement[successor.get()]].push_back(successor);
+            }
+        }
+    }
+    NGRAPH_CHECK(segment_of.size() == placement.size(), "Function ", *function, " has a cycle");
+
+    // Each segment becomes a function whose parameters are the values it reads from outside
+    for (size_t s = 0; s < m_segments.size(); s++)
+    {
+        Segment& segment = m_segments[s];
+        unordered_map<Node*, shared_ptr<Node>> clones;
+        map<Output<Node>, shared_ptr<op::v0::Parameter>> segment_parameters;
+        ParameterVector parameters;
+        for (auto& node : segment_ops[s])
+        {
+            OutputVector args;
+            for (auto& arg : node->input_values())
+            {
+                Node* producer = arg.get_node();
+                auto it = segment_of.find(producer);
+                if ((it != segment_of.end() && it->second == s) ||
+                    (producer->is_constant() && clones.count(producer) != 0))
+                {
+                    args.push_back(clones.at(producer)->output(arg.get_index()));
+                }
+                else if (producer->is_constant())
+                {
+                    auto constant = producer->copy_with_new_inputs(OutputVector{});
+                    clones[producer] = constant;
+                    args.push_back(constant->output(arg.get_index()));
+                }
+                else
+                {
+                    auto& parameter = segment_parameters[arg];
+                    if (!parameter)
+                    {
+                        parameter = make_shared<op::v0::Parameter>(arg.get_element_type(),
+                                                                   arg.get_partial_shape());
+                        parameters.push_back(parameter);
+                        segment.inputs.push_back(get_value(arg));
+                    }
+                    args.push_back(parameter->output(0));
+                }
+            }
+            auto clone = node->copy_with_new_inputs(args);
+            clone->set_friendly_name(node->get_friendly_name());
+            clones[node.get()] = clone;
+        }
+
+        // Values used by results or other segments become results of the segment
+        ResultVector results;
+        for (auto& node : segment_ops[s])
+        {
+            for (auto& output : node->outputs())
+            {
+                for (auto& target : output.get_target_inputs())
+                {
+                    auto it = segment_of.find(target.get_node());
+                    if (it == segment_of.end() || it->second != s)
+                    {
+                        size_t value = get_value(output);
+                        m_values[value].backend = segment.backend;
+                        m_values[value].computed = true;
+                        segment.outputs.push_back(value);
+                        results.push_back(make_shared<op::v0::Result>(
+                            clones.at(node.get())->output(output.get_index())));
+                        break;
+                    }
+                }
+            }
+        }
+        segment.function = make_shared<Function>(
+            results, parameters, function->get_name() + "_" + to_string(s));
+        segment.executable = m_backends[segment.backend]->compile(segment.function);
+    }
+    for (auto& result : function->get_results())
+    {
+        m_result_values.push_back(get_value(result->input_value(0)));
+    }
+
+    // Allocate each computed value on its backend and on every other backend reading it
+    m_tensors.resize(m_values.size(), vector<shared_ptr<Tensor>>(m_backends.size()));
+    auto allocate = [&](size_t value, size_t backend) {
+        auto& tensor = m_tensors[value][backend];
+        if (!tensor)
+        {
+            const Output<Node>& output = m_values[value].output;
+            NGRAPH_CHECK(output.get_partial_shape().is_static(),
+                         "HeterogeneousExecutable requires static shapes, ",
+                         *output.get_node(),
+                         " has shape ",
+                         output.get_partial_shape());
+            tensor =
+                m_backends[backend]->create_tensor(output.get_element_type(), output.get_shape());
+        }
+        return tensor;
+    };
+    for (auto& segment : m_segments)
+    {
+        for (size_t value : segment.outputs)
+        {
+            allocate(value, segment.backend);
+        }
+        for (size_t value : segment.inputs)
+        {
+            if (m_values[value].backend != segment.backend)
+            {
+                allocate(value, segment.backend);
+            }
+        }
+    }
+    for (size_t value : m_result_values)
+    {
+        auto node = m_values[value].output.get_node_shared_ptr();
+        auto constant = as_type_ptr<op::v0::Constant>(node);
+        if (constant && !m_tensors[value][0])
+        {
+            allocate(value, 0)->write(constant->get_data_ptr(), pass::constant_byte_size(*constant));
+        }
+    }
+}
+
+size_t runtime::HeterogeneousExecutable::get_value(const Output<Node>& output)
+{
+    auto it = m_value_map.find(output);
+    if (it == m_value_map.end())
+    {
+        int64_t parameter = -1;
+        if (auto p = as_type_ptr<op::v0::Parameter>(output.get_node_shared_ptr()))
+        {
+            auto position = find(m_parameters.begin(), m_parameters.end(), p);
+            parameter = position - m_parameters.begin();
+        }
+        it = m_value_map.emplace(output, m_values.size()).first;
+        m_values.push_back(Value{output, 0, parameter, false});
+    }
+    return it->second;
+}
+
+bool runtime::HeterogeneousExecutable::call(const vector<shared_ptr<Tensor>>& outputs,
+                                            const vector<shared_ptr<Tensor>>& inputs)
+{
+    lock_guard<mutex> lock(m_mutex);
+    vector<vector<shared_ptr<Tensor>>> tensors = m_tensors;
+    for (size_t value = 0; value < m_values.size(); value++)
+    {
+        if (m_values[value].parameter >= 0)
+        {
+            tensors[value][0] = inputs.at(m_values[value].parameter);
+        }
+    }
+
+    // Results computed on the first backend are written straight into the outputs
+    vector<bool> written(m_result_values.size(), false);
+    vector<bool> aliased(m_values.size(), false);
+    for (size_t i = 0; i < m_result_values.size(); i++)
+    {
+        size_t value = m_result_values[i];
+        if (m_values[value].computed && m_values[value].backend == 0 && !aliased[value])
+        {
+            tensors[value][0] = outputs.at(i);
+            aliased[value] = true;
+            written[i] = true;
+        }
+    }
+
+    size_t backend_count = m_backends.size();
+    vector<bool> transferred(m_values.size() * backend_count, false);
+    for (const Segment& segment : m_segments)
+    {
+        vector<shared_ptr<Tensor>> segment_inputs;
+        for (size_t value : segment.inputs)
+        {
+            size_t home = m_values[value].backend;
+            if (home != segment.backend && !transferred[value * backend_count + segment.backend])
+            {
+                transfer(*tensors[value][home], *tensors[value][segment.backend]);
+                transferred[value * backend_count + segment.backend] = true;
+            }
+            segment_inputs.push_back(tensors[value][segment.backend]);
+        }
+        vector<shared_ptr<Tensor>> segment_outputs;
+        for (size_t value : segment.outputs)
+        {
+            segment_outputs.push_back(tensors[value][segment.backend]);
+        }
+        if (!segment.executable->call(segment_outputs, segment_inputs))
+        {
+            return false;
+        }
+    }
+
+    for (size_t i = 0; i < m_result_values.size(); i++)
+    {
+        if (!written[i])
+        {
+            size_t value = m_result_values[i];
+            transfer(*tensors[value][m_values[value].backend], *outputs.at(i));
+        }
+    }
+    return true;
+}
+
+void runtime::HeterogeneousExecutable::warm_up()
+{
+    lock_guard<mutex> lock(m_mutex);
+    for (const Segment& segment : m_segments)
+    {
+        segment.executable->warm_up();
+    }
+}
@@ -0,0 +1,108 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/executable.hpp"
+#include "ngraph/runtime/tensor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class HeterogeneousExecutable;
+    }
+}
+
+/// \brief Runs a Function whose ops are spread over several backends.
+///
+/// Every op is placed on the cheapest backend that supports it. The ops are then grouped, in
+/// topological order, into segments of consecutive ops with the same placement. Each segment
+/// is compiled as its own Function on its backend and the segments run one after another.
+/// Values crossing between backends are copied through host memory. Constants are cloned into
+/// every segment that uses them.
+///
+/// The tensors passed to call belong to the first backend. Shapes must be static, and calls
+/// are serialized because intermediate tensors are owned by the executable.
+class NGRAPH_API ngraph::runtime::HeterogeneousExecutable : public Executable
+{
+public:
+    /// \brief The cost of running node on backends[backend_index]. Only called for backends
+    ///        that support node.
+    using CostFunction = std::function<double(const Node& node, size_t backend_index)>;
+
+    /// \brief A group of ops compiled together on one backend
+    struct Segment
+    {
+        size_t backend;
+        std::shared_ptr<Function> function;
+        std::shared_ptr<Executable> executable;
+        /// Values read by the parameters of function
+        std::vector<size_t> inputs;
+        /// Values written by the results of function
+        std::vector<size_t> outputs;
+    };
+
+    /// \param function The function to run. It is not modified.
+    /// \param backends The candidate backends
+    /// \param cost Chooses between backends supporting an op. By default the first backend
+    ///        supporting the op is used.
+    HeterogeneousExecutable(const std::shared_ptr<Function>& function,
+                            const std::vector<std::shared_ptr<Backend>>& backends,
+                            const CostFunction& cost = nullptr);
+
+    bool call(const std::vector<std::shared_ptr<Tensor>>& outputs,
+              const std::vector<std::shared_ptr<Tensor>>& inputs) override;
+
+    /// \brief Warms up the executable of every segment
+    void warm_up() override;
+
+    const std::vector<Segment>& get_segments() const { return m_segments; }
+
+private:
+    /// \brief A value passed between segments, or from a parameter or constant to the results
+    struct Value
+    {
+        Output<Node> output;
+        /// The backend holding the value: the producing segment's, or 0 for parameters and
+        /// constants
+        size_t backend;
+        /// Index of the parameter providing the value, or -1
+        int64_t parameter;
+        /// True if a segment computes the value
+        bool computed;
+    };
+
+    size_t get_value(const Output<Node>& output);
+
+    std::vector<std::shared_ptr<Backend>> m_backends;
+    std::vector<Segment> m_segments;
+    std::vector<Value> m_values;
+    std::map<Output<Node>, size_t> m_value_map;
+    /// m_tensors[value][backend] holds the copy of a value on a backend
+    std::vector<std::vector<std::shared_ptr<Tensor>>> m_tensors;
+    /// The value returned by each result
+    std::vector<size_t> m_result_values;
+    std::mutex m_mutex;
+};
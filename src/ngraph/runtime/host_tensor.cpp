@@ -59,6 +59,32 @@ runtime::HostTensor::HostTensor(const element::Type& element_type,
     // Defer allocation until ptr is requested
 }
 
+runtime::HostTensor::HostTensor(const element::Type& element_type,
+                                const Shape& shape,
+                                const std::string& name,
+                                Allocator* allocator)
+    : runtime::Tensor(std::make_shared<ngraph::descriptor::Tensor>(element_type, shape, name))
+    , m_allocator(allocator)
+    , m_buffer_size(0)
+{
+    if (get_partial_shape().is_static() && get_element_type().is_static())
+    {
+        allocate_buffer();
+    }
+}
+
+runtime::HostTensor::HostTensor(const element::Type& element_type,
+                                const PartialShape& partial_shape,
+                                const std::string& name,
+                                Allocator* allocator)
+    : runtime::Tensor(
+          std::make_shared<ngraph::descriptor::Tensor>(element_type, partial_shape, name))
+    , m_allocator(allocator)
+    , m_buffer_size(0)
+{
+    // Defer allocation until ptr is requested
+}
+
 runtime::HostTensor::HostTensor(const std::string& name)
     : HostTensor(element::dynamic, PartialShape::dynamic())
 {
@@ -88,7 +114,9 @@ void runtime::HostTensor::allocate_buffer()
     {
         // Add 1 so that even for zero-sized tensor we get at least 1 byte
         size_t allocation_size = m_buffer_size + alignment + 1;
-        uint8_t* allocated_buffer_pool = static_cast<uint8_t*>(ngraph_malloc(allocation_size));
+        uint8_t* allocated_buffer_pool =
+            static_cast<uint8_t*>(m_allocator ? m_allocator->malloc(allocation_size, alignment)
+                                              : ngraph_malloc(allocation_size));
         m_allocated_buffer_pool = allocated_buffer_pool;
         size_t mod = size_t(allocated_buffer_pool) % alignment;
         if (mod == 0)
@@ -116,10 +144,23 @@ void runtime::HostTensor::initialize(const std::shared_ptr<op::v0::Constant>& co
 }
 
 runtime::HostTensor::~HostTensor()
+{
+    free_buffer();
+}
+
+void runtime::HostTensor::free_buffer()
 {
     if (m_allocated_buffer_pool != nullptr)
     {
-        ngraph_free(m_allocated_buffer_pool);
+        if (m_allocator)
+        {
+            m_allocator->free(m_allocated_buffer_pool);
+        }
+        else
+        {
+            ngraph_free(m_allocated_buffer_pool);
+        }
+        m_allocated_buffer_pool = nullptr;
     }
 }
 
@@ -132,7 +173,7 @@ void* runtime::HostTensor::get_data_ptr()
     else if (shape_size(m_descriptor->get_shape()) * get_element_type().size() != m_buffer_size)
     {
         // A buffer is allocated but is the wrong size
-        ngraph_free(m_allocated_buffer_pool);
+        free_buffer();
         allocate_buffer();
     }
     return m_aligned_buffer_pool;
@@ -49,6 +49,16 @@ public:
     HostTensor(const element::Type& element_type,
                const PartialShape& partial_shape,
                const std::string& name = "");
+    /// \brief Construct a HostTensor whose buffer comes from `allocator`. The allocator must
+    ///        outlive the tensor; it is called with the alignment the tensor requires.
+    HostTensor(const element::Type& element_type,
+               const Shape& shape,
+               const std::string& name,
+               Allocator* allocator);
+    HostTensor(const element::Type& element_type,
+               const PartialShape& partial_shape,
+               const std::string& name,
+               Allocator* allocator);
     HostTensor(const std::string& name = "");
     explicit HostTensor(const Output<Node>&);
     explicit HostTensor(const std::shared_ptr<op::v0::Constant>& constant);
@@ -58,6 +68,7 @@ public:
 
     void* get_data_ptr();
     const void* get_data_ptr() const;
+    void* get_host_data_ptr() override { return get_data_ptr(); }
 
     template <typename T>
     T* get_data_ptr()
@@ -124,10 +135,12 @@ public:
 
 private:
     void allocate_buffer();
+    void free_buffer();
     HostTensor(const HostTensor&) = delete;
     HostTensor(HostTensor&&) = delete;
     HostTensor& operator=(const HostTensor&) = delete;
 
+    Allocator* m_allocator{nullptr};
     void* m_memory_pointer{nullptr};
     void* m_allocated_buffer_pool{nullptr};
     void* m_aligned_buffer_pool{nullptr};
@@ -0,0 +1,232 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <string>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "ngraph/log.hpp"
+#include "ngraph/runtime/huge_page_allocator.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+static size_t get_page_size()
+{
+#ifdef __linux__
+    static const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return page_size;
+#else
+    return 4096;
+#endif
+}
+
+void runtime::prefault_memory(void* ptr, size_t size, bool write)
+{
+    if (ptr == nullptr || size == 0)
+    {
+        return;
+    }
+    const size_t page_size = get_page_size();
+    volatile char* begin = static_cast<char*>(ptr);
+    // The first byte may sit in the middle of a page, later ones are at page starts
+    size_t first = (page_size - reinterpret_cast<size_t>(ptr) % page_size) % page_size;
+    char sum = begin[0];
+    if (write)
+    {
+        begin[0] = sum;
+    }
+    for (size_t offset = first; offset < size; offset += page_size)
+    {
+        char value = begin[offset];
+        if (write)
+        {
+            begin[offset] = value;
+        }
+        sum ^= value;
+    }
+    (void)sum;
+}
+
+size_t runtime::HugePageAllocator::get_huge_page_size()
+{
+    static const size_t huge_page_size = []() {
+        size_t size = 2 * 1024 * 1024;
+#ifdef __linux__
+        ifstream meminfo("/proc/meminfo");
+        string key;
+        size_t kilobytes;
+        while (meminfo >> key)
+        {
+            if (key == "Hugepagesize:" && meminfo >> kilobytes && kilobytes > 0)
+            {
+                size = kilobytes * 1024;
+                break;
+            }
+            meminfo.ignore(numeric_limits<streamsize>::max(), '\n');
+        }
+#endif
+        return size;
+    }();
+    return huge_page_size;
+}
+
+runtime::HugePageAllocator::HugePageAllocator(Mode mode, bool prefault, Allocator* fallback)
+    : m_mode(mode)
+    , m_prefault(prefault)
+    , m_fallback(fallback ? fallback : get_default_allocator())
+{
+}
+
+runtime::HugePageAllocator::~HugePageAllocator()
+{
+#ifdef __linux__
+    for (auto& mapping : m_mappings)
+    {
+        munmap(mapping.first, mapping.second);
+    }
+#endif
+}
+
+void* runtime::HugePageAllocator::map(size_t size, bool explicit_pages)
+{
+#ifdef __linux__
+    const size_t huge_page_size = get_huge_page_size();
+    if (explicit_pages)
+    {
+        // hugetlbfs mappings come huge page aligned and are faulted in with MAP_POPULATE
+        int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | (m_prefault ? MAP_POPULATE : 0);
+        void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, flags, -1, 0);
+        return ptr == MAP_FAILED ? nullptr : ptr;
+    }
+
+    // Over-map by a huge page and trim both ends, so that every huge page of the range can
+    // be backed by a transparent huge page
+    size_t mapped_size = size + huge_page_size;
+    void* mapped =
+        mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapped == MAP_FAILED)
+    {
+        return nullptr;
+    }
+    char* begin = static_cast<char*>(mapped);
+    size_t head = (huge_page_size - reinterpret_cast<size_t>(begin) % huge_page_size) %
+                  huge_page_size;
+    char* ptr = begin + head;
+    if (head > 0)
+    {
+        munmap(begin, head);
+    }
+    if (mapped_size - head > size)
+    {
+        munmap(ptr + size, mapped_size - head - size);
+    }
+#ifdef MADV_HUGEPAGE
+    if (madvise(ptr, size, MADV_HUGEPAGE) != 0)
+    {
+        NGRAPH_DEBUG << "Transparent huge pages are unavailable, using regular pages";
+    }
+#endif
+    if (m_prefault)
+    {
+        prefault_memory(ptr, size);
+    }
+    return ptr;
+#else
+    (void)size;
+    (void)explicit_pages;
+    return nullptr;
+#endif
+}
+
+void* runtime::HugePageAllocator::malloc(size_t size, size_t alignment)
+{
+    const size_t huge_page_size = get_huge_page_size();
+    size_t mapped_size = (max(size, size_t(1)) + huge_page_size - 1) / huge_page_size *
+                         huge_page_size;
+    void* ptr = nullptr;
+    if (alignment <= huge_page_size)
+    {
+        if (m_mode == Mode::Explicit)
+        {
+            ptr = map(mapped_size, true);
+        }
+        if (ptr == nullptr)
+        {
+            ptr = map(mapped_size, false);
+        }
+    }
+    if (ptr == nullptr)
+    {
+        ptr = m_fallback->malloc(size, alignment);
+        if (m_prefault)
+        {
+            prefault_memory(ptr, size);
+        }
+        lock_guard<mutex> lock(m_mutex);
+        m_fallback_count++;
+        return ptr;
+    }
+    lock_guard<mutex> lock(m_mutex);
+    m_mappings[ptr] = mapped_size;
+    m_mapped_bytes += mapped_size;
+    return ptr;
+}
+
+void runtime::HugePageAllocator::free(void* ptr)
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+    size_t size = 0;
+    {
+        lock_guard<mutex> lock(m_mutex);
+        auto it = m_mappings.find(ptr);
+        if (it != m_mappings.end())
+        {
+            size = it->second;
+            m_mapped_bytes -= size;
+            m_mappings.erase(it);
+        }
+    }
+    if (size == 0)
+    {
+        m_fallback->free(ptr);
+        return;
+    }
+#ifdef __linux__
+    munmap(ptr, size);
+#endif
+}
+
+size_t runtime::HugePageAllocator::get_mapped_bytes() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_mapped_bytes;
+}
+
+size_t runtime::HugePageAllocator::get_fallback_count() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_fallback_count;
+}
@@ -0,0 +1,97 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <unordered_map>
+
+#include "ngraph/runtime/allocator.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class HugePageAllocator;
+
+        /// \brief Touches one byte of every page of [ptr, ptr + size) so that the page
+        ///        faults happen now rather than on first use. The contents are left as they
+        ///        were.
+        /// \param write Rewrite the byte, which fresh anonymous memory needs to get pages of
+        ///              its own. Reading is enough for memory already written, and keeps
+        ///              private file mappings shared.
+        NGRAPH_API
+        void prefault_memory(void* ptr, size_t size, bool write = true);
+    }
+}
+
+/// \brief Allocator for large, long lived buffers such as activation pools, backed by huge
+/// pages to cut page faults and TLB misses.
+///
+/// Allocations are rounded up to whole huge pages. Explicit mode maps pages from the
+/// hugetlbfs pool (vm.nr_hugepages) and falls back to transparent mode when the pool is
+/// exhausted. Transparent mode maps huge page aligned memory and advises the kernel to back
+/// it with transparent huge pages. When no mapping can be made at all, or on platforms other
+/// than Linux, allocations go to the fallback allocator. Use it for a backend through
+/// Backend::set_host_memory_allocator.
+///
+/// This class is thread safe.
+class NGRAPH_API ngraph::runtime::HugePageAllocator : public ngraph::runtime::Allocator
+{
+public:
+    enum class Mode
+    {
+        Transparent,
+        Explicit
+    };
+
+    /// \param prefault Fault in every page as it is allocated
+    /// \param fallback Allocator used when huge pages cannot be mapped, the default
+    ///                 allocator if null. Its lifetime must exceed the lifetime of this
+    ///                 HugePageAllocator.
+    HugePageAllocator(Mode mode = Mode::Transparent,
+                      bool prefault = false,
+                      Allocator* fallback = nullptr);
+    ~HugePageAllocator() override;
+
+    /// \brief Memory aligned to at least a huge page, whatever `alignment` up to it
+    void* malloc(size_t size, size_t alignment) override;
+    void free(void* ptr) override;
+
+    /// \brief Size in bytes of a huge page, 2MB when the system does not tell
+    static size_t get_huge_page_size();
+
+    /// \brief Bytes currently mapped in huge page mode, including rounding
+    size_t get_mapped_bytes() const;
+    /// \brief Number of allocations served by the fallback allocator since construction
+    size_t get_fallback_count() const;
+
+private:
+    HugePageAllocator(const HugePageAllocator&) = delete;
+    HugePageAllocator& operator=(const HugePageAllocator&) = delete;
+
+    void* map(size_t size, bool explicit_pages);
+
+    Mode m_mode;
+    bool m_prefault;
+    Allocator* m_fallback;
+    mutable std::mutex m_mutex;
+    // Sizes of the live mappings, what is not in here came from the fallback
+    std::unordered_map<void*, size_t> m_mappings;
+    size_t m_mapped_bytes{0};
+    size_t m_fallback_count{0};
+};
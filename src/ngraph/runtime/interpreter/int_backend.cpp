@@ -22,6 +22,7 @@
 #include "ngraph/runtime/host_tensor.hpp"
 #include "ngraph/runtime/interpreter/int_backend.hpp"
 #include "ngraph/runtime/interpreter/int_executable.hpp"
+#include "ngraph/runtime/interpreter/int_thread_pool.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
 
@@ -30,8 +31,10 @@ using namespace ngraph;
 
 extern "C" INTERPRETER_BACKEND_API void ngraph_register_interpreter_backend()
 {
-    runtime::BackendManager::register_backend("INTERPRETER", [](const std::string& /* config */) {
-        return std::make_shared<runtime::interpreter::INTBackend>();
+    runtime::BackendManager::register_backend("INTERPRETER", [](const std::string& config) {
+        auto backend = std::make_shared<runtime::interpreter::INTBackend>();
+        backend->configure(config);
+        return backend;
     });
 }
 
@@ -42,6 +45,33 @@ runtime::interpreter::INTBackend::INTBackend(const vector<string>& unsupported_o
 {
 }
 
+void runtime::interpreter::INTBackend::configure(const string& config)
+{
+    const string threads_option = "threads=";
+    for (const string& option : split(config, ',', true))
+    {
+        if (option.compare(0, threads_option.size(), threads_option) == 0)
+        {
+            set_num_threads(parse_string<size_t>(option.substr(threads_option.size())));
+        }
+        else if (!option.empty())
+        {
+            throw ngraph_error("Unknown INTERPRETER backend option '" + option + "'");
+        }
+    }
+}
+
+void runtime::interpreter::INTBackend::set_num_threads(size_t num_threads)
+{
+    NGRAPH_CHECK(num_threads > 0, "INTERPRETER needs at least one thread");
+    m_thread_pool = num_threads > 1 ? make_shared<INTThreadPool>(num_threads) : nullptr;
+}
+
+size_t runtime::interpreter::INTBackend::get_num_threads() const
+{
+    return m_thread_pool ? m_thread_pool->get_num_threads() : 1;
+}
+
 shared_ptr<runtime::Tensor> runtime::interpreter::INTBackend::create_tensor()
 {
     return make_shared<runtime::HostTensor>();
@@ -70,7 +100,9 @@ shared_ptr<runtime::Executable>
     runtime::interpreter::INTBackend::compile(shared_ptr<Function> function,
                                               bool enable_performance_collection)
 {
-    return make_shared<INTExecutable>(function, enable_performance_collection);
+    auto exec = make_shared<INTExecutable>(function, enable_performance_collection);
+    exec->set_thread_pool(m_thread_pool);
+    return exec;
 }
 
 bool runtime::interpreter::INTBackend::is_supported(const Node& node) const
@@ -101,7 +133,9 @@ std::shared_ptr<runtime::Executable> runtime::interpreter::INTBackend::load(istr
             {
                 vector<char> buffer = reader.read(info);
                 string model_string = string(buffer.data(), buffer.size());
-                exec = shared_ptr<INTExecutable>(new INTExecutable(model_string));
+                auto int_exec = shared_ptr<INTExecutable>(new INTExecutable(model_string));
+                int_exec->set_thread_pool(m_thread_pool);
+                exec = int_exec;
                 break;
             }
         }
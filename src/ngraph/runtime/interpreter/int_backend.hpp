@@ -36,6 +36,7 @@ namespace ngraph
             class INTBackend;
             class INTExecutable;
             class INTBackendConstructor;
+            class INTThreadPool;
         }
     }
 }
@@ -68,6 +69,16 @@ public:
 
     bool supports_dynamic_tensors() override { return true; }
 
+    /// \brief Partition large kernels of executables compiled from now on across
+    ///        `num_threads` threads. 1, the default, runs every kernel on the calling thread.
+    ///        Also set by the "threads=N" option, e.g. Backend::create("INTERPRETER:threads=8").
+    void set_num_threads(size_t num_threads);
+    size_t get_num_threads() const;
+
+    /// \brief Applies a comma separated list of options, such as "threads=8"
+    void configure(const std::string& config);
+
 private:
     std::set<std::string> m_unsupported_op_name_list;
+    std::shared_ptr<INTThreadPool> m_thread_pool;
 };
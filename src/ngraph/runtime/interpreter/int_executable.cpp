@@ -28,6 +28,7 @@
 #include "ngraph/pass/like_replacement.hpp"
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/memory_layout.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
@@ -39,20 +40,21 @@ using descriptor::layout::DenseTensorLayout;
 
 runtime::interpreter::OP_TYPEID runtime::interpreter::INTExecutable::get_typeid(const Node& node)
 {
-    const NodeTypeInfo& type_info = node.get_type_info();
+    // Keyed by the address of the static type_info of each op, which get_type_info returns,
+    // so the lookup hashes a pointer instead of comparing type names.
     // This expands the op list in op_tbl.hpp into a list of enumerations that look like this:
-    // {Abs::type_info, OP_TYPEID::Abs},
-    // {Acos::type_info, OP_TYPEID::Acos},
+    // {&Abs::type_info, OP_TYPEID::Abs},
+    // {&Acos::type_info, OP_TYPEID::Acos},
     // ...
-    static const map<NodeTypeInfo, OP_TYPEID> type_info_map{
+    static const unordered_map<const NodeTypeInfo*, OP_TYPEID> type_info_map{
 #define NGRAPH_OP(NAME, VERSION)                                                                   \
-    {ngraph::op::v##VERSION::NAME::type_info, OP_TYPEID::NAME##_v##VERSION},
+    {&ngraph::op::v##VERSION::NAME::type_info, OP_TYPEID::NAME##_v##VERSION},
 #include "ngraph/op_version_tbl.hpp"
 #undef NGRAPH_OP
     };
     OP_TYPEID rc = OP_TYPEID::UnknownOp;
 
-    auto it = type_info_map.find(type_info);
+    auto it = type_info_map.find(&node.get_type_info());
     if (it != type_info_map.end())
     {
         rc = it->second;
@@ -79,6 +81,7 @@ runtime::interpreter::INTExecutable::INTExecutable(const shared_ptr<Function>& f
         {
         case OP_TYPEID::Clamp_v0:
         case OP_TYPEID::MatMul_v0:
+        case OP_TYPEID::ScatterND_v0:
         {
             retval = true;
             break;
@@ -96,12 +99,30 @@ runtime::interpreter::INTExecutable::INTExecutable(const shared_ptr<Function>& f
     pass_manager.register_pass<pass::FusedOpDecomposition>(is_supported);
     // pass_manager.register_pass<pass::AssignLayout<DenseTensorLayout>>();
     pass_manager.register_pass<pass::Liveness>();
+    bool plan_memory = !m_function->is_dynamic();
+    if (plan_memory)
+    {
+        pass_manager.register_pass<pass::MemoryLayout>(get_alignment());
+    }
     pass_manager.run_passes(m_function);
     for (auto node : m_function->get_ordered_ops())
     {
         m_nodes.push_back(node);
+        if (plan_memory)
+        {
+            for (const descriptor::Tensor* tensor : node->liveness_new_list)
+            {
+                m_tensor_offsets[tensor] = tensor->get_pool_offset();
+            }
+        }
     }
+    if (plan_memory)
+    {
+        m_planned_pool_size = m_function->get_temporary_pool_size();
+    }
+    set_memory_plan_enabled(true);
     set_parameters_and_results(*m_function);
+    build_call_plan();
 }
 
 runtime::interpreter::INTExecutable::INTExecutable(const std::string& model_string)
@@ -114,127 +135,148 @@ runtime::interpreter::INTExecutable::INTExecutable(const std::string& model_stri
         m_nodes.push_back(node);
     }
     set_parameters_and_results(*m_function);
+    build_call_plan();
 }
 
-bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
-                                               const vector<shared_ptr<runtime::Tensor>>& inputs)
+element::Type runtime::interpreter::INTExecutable::get_kernel_element_type(const Node& node)
 {
-    event::Duration d1("call", "Interpreter");
-
-    // convert inputs to HostTensor
-    vector<shared_ptr<HostTensor>> func_inputs;
-    for (auto tensor : inputs)
+    const Node* op = &node;
+    element::Type type;
+    if (is_type<op::v0::Convert>(op) || is_type<op::v0::Quantize>(op) ||
+        is_type<op::v0::Dequantize>(op) || is_type<op::v0::ArgMin>(op) ||
+        is_type<op::v0::ArgMax>(op) || is_type<op::v1::NonMaxSuppression>(op) ||
+        is_type<op::v3::NonMaxSuppression>(op) || is_type<op::v0::AssignVariable>(op))
     {
-        auto host_tensor = static_pointer_cast<runtime::HostTensor>(tensor);
-        func_inputs.push_back(host_tensor);
+        type = op->get_input_element_type(0);
     }
-    if (m_nan_check_enabled)
+    else if (is_type<op::v1::Equal>(op) || is_type<op::v1::Greater>(op) ||
+             is_type<op::v1::GreaterEqual>(op) || is_type<op::v1::Less>(op) ||
+             is_type<op::v1::LessEqual>(op) || is_type<op::v1::NotEqual>(op))
     {
-        perform_nan_check(func_inputs);
+        // Get the type of the second input, not the first
+        // All BinaryElementwiseComparision ops have the same type for inputs
+        // Select has bool for first input and the type we are interested in for the second
+        type = op->get_input_element_type(1);
     }
-
-    // convert outputs to HostTensor
-    vector<shared_ptr<HostTensor>> func_outputs;
-    for (auto tensor : outputs)
+    else if (is_type<op::v0::TopK>(op))
+    {
+        type = op->get_output_element_type(1);
+    }
+    else
     {
-        auto host_tensor = static_pointer_cast<runtime::HostTensor>(tensor);
-        func_outputs.push_back(host_tensor);
+        type = op->get_output_element_type(0);
     }
+    return type;
+}
+
+void runtime::interpreter::INTExecutable::build_call_plan()
+{
+    unordered_map<const descriptor::Tensor*, size_t> slots;
+    auto slot_of = [&slots](const descriptor::Tensor& tensor) {
+        return slots.insert({&tensor, slots.size()}).first->second;
+    };
 
-    // map function params -> HostTensor
-    unordered_map<descriptor::Tensor*, shared_ptr<HostTensor>> tensor_map;
-    size_t input_count = 0;
+    // function params -> the first slots, in the order of the call's inputs
     for (auto param : get_parameters())
     {
         for (size_t i = 0; i < param->get_output_size(); ++i)
         {
-            descriptor::Tensor* tensor = &param->output(i).get_tensor();
-            tensor_map.insert({tensor, func_inputs[input_count++]});
+            slot_of(param->output(i).get_tensor());
         }
     }
 
-    // map function outputs -> HostTensor
-    for (size_t output_count = 0; output_count < get_results().size(); ++output_count)
+    // function outputs -> the slots after them, in the order of the call's outputs
+    for (auto output : get_results())
     {
-        auto output = get_results()[output_count];
         if (!is_type<op::v0::Result>(output))
         {
             throw ngraph_error("One of function's outputs isn't op::v0::Result");
         }
-        descriptor::Tensor* tensor = &output->get_output_tensor(0);
-        tensor_map.insert({tensor, func_outputs[output_count]});
+        slot_of(output->get_output_tensor(0));
     }
 
-    // for each ordered op in the graph
+    m_call_plan.clear();
     for (auto op : m_nodes)
     {
-        event::Duration d2(op->description(), "Interpreter");
         if (op->is_parameter())
         {
             continue;
         }
-
-        // get op inputs from map
-        vector<shared_ptr<HostTensor>> op_inputs;
+        CallStep step;
+        step.node = op;
+        step.type = get_kernel_element_type(*op);
         for (auto input : op->inputs())
         {
-            descriptor::Tensor* tensor = &input.get_tensor();
-            op_inputs.push_back(tensor_map.at(tensor));
+            step.inputs.push_back(slot_of(input.get_tensor()));
         }
-
-        // get op outputs from map or create
-        vector<shared_ptr<HostTensor>> op_outputs;
         for (size_t i = 0; i < op->get_output_size(); ++i)
         {
-            descriptor::Tensor* tensor = &op->output(i).get_tensor();
-            shared_ptr<HostTensor> host_tensor;
-            auto it = tensor_map.find(tensor);
-            if (it == tensor_map.end())
-            {
-                const PartialShape& shape = op->get_output_partial_shape(i);
-                const element::Type& type = op->get_output_element_type(i);
-                string name = op->output(i).get_tensor().get_name();
-                host_tensor = make_shared<runtime::HostTensor>(type, shape, name);
-                tensor_map.insert({tensor, host_tensor});
-            }
-            else
-            {
-                host_tensor = it->second;
-            }
-            op_outputs.push_back(host_tensor);
+            step.outputs.push_back(slot_of(op->output(i).get_tensor()));
         }
+        m_call_plan.push_back(move(step));
+    }
+    m_tensor_slot_count = slots.size();
+}
 
-        // get op type
-        element::Type type;
-        if (is_type<op::v0::Convert>(op) || is_type<op::v0::Quantize>(op) ||
-            is_type<op::v0::Dequantize>(op) || is_type<op::v0::ArgMin>(op) ||
-            is_type<op::v0::ArgMax>(op))
-        {
-            type = op->get_input_element_type(0);
-        }
-        else if (is_type<op::v1::Equal>(op) || is_type<op::v1::Greater>(op) ||
-                 is_type<op::v1::GreaterEqual>(op) || is_type<op::v1::Less>(op) ||
-                 is_type<op::v1::LessEqual>(op) || is_type<op::v1::NotEqual>(op))
-        {
-            // Get the type of the second input, not the first
-            // All BinaryElementwiseComparision ops have the same type for inputs
-            // Select has bool for first input and the type we are interested in for the second
-            type = op->get_input_element_type(1);
-        }
-        else if (is_type<op::v0::TopK>(op))
+bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                               const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    event::Duration d1("call", "Interpreter");
+
+    // Must outlive tensors so no intermediate tensor is released after the arena is reset or
+    // used after the memory pool is handed to another call
+    unique_lock<mutex> arena_lock;
+    Allocator* allocator = acquire_call_allocator(arena_lock);
+    char* pool = get_memory_pool(arena_lock);
+
+    // The call's tensors in the slots resolved by build_call_plan, inputs and outputs first
+    vector<shared_ptr<HostTensor>> tensors(m_tensor_slot_count);
+    size_t slot = 0;
+    for (auto& tensor : inputs)
+    {
+        tensors[slot++] = static_pointer_cast<runtime::HostTensor>(tensor);
+    }
+    if (m_nan_check_enabled)
+    {
+        perform_nan_check(
+            vector<shared_ptr<HostTensor>>(tensors.begin(), tensors.begin() + inputs.size()));
+    }
+    for (auto& tensor : outputs)
+    {
+        tensors[slot++] = static_pointer_cast<runtime::HostTensor>(tensor);
+    }
+
+    // for each ordered op in the graph
+    vector<shared_ptr<HostTensor>> op_inputs;
+    vector<shared_ptr<HostTensor>> op_outputs;
+    for (const CallStep& step : m_call_plan)
+    {
+        const shared_ptr<Node>& op = step.node;
+        event::Duration d2(op->description(), "Interpreter");
+
+        op_inputs.clear();
+        for (size_t input : step.inputs)
         {
-            type = op->get_output_element_type(1);
+            op_inputs.push_back(tensors[input]);
         }
-        else
+
+        // get op outputs from the call's outputs or create
+        op_outputs.clear();
+        for (size_t i = 0; i < step.outputs.size(); ++i)
         {
-            type = op->get_output_element_type(0);
+            shared_ptr<HostTensor>& host_tensor = tensors[step.outputs[i]];
+            if (!host_tensor)
+            {
+                host_tensor = create_intermediate_tensor(op->output(i), allocator, pool);
+            }
+            op_outputs.push_back(host_tensor);
         }
 
         if (m_performance_counters_enabled)
         {
             m_timer_map[op].start();
         }
-        generate_calls(type, *op.get(), op_outputs, op_inputs);
+        generate_calls(step.type, *op, op_outputs, op_inputs);
         if (m_performance_counters_enabled)
         {
             m_timer_map[op].stop();
@@ -282,6 +324,68 @@ void runtime::interpreter::INTExecutable::set_nan_check(bool enable)
     m_nan_check_enabled = enable;
 }
 
+void runtime::interpreter::INTExecutable::set_arena_enabled(bool enable)
+{
+    lock_guard<mutex> lock(m_arena_mutex);
+    if (!enable)
+    {
+        m_arena.reset();
+    }
+    else if (!m_arena)
+    {
+        m_arena.reset(new ArenaAllocator());
+    }
+}
+
+void runtime::interpreter::INTExecutable::set_memory_plan_enabled(bool enable)
+{
+    lock_guard<mutex> lock(m_arena_mutex);
+    if (!enable)
+    {
+        m_memory_pool.reset();
+    }
+    else if (!m_memory_pool && m_planned_pool_size > 0)
+    {
+        m_memory_pool.reset(new AlignedBuffer(m_planned_pool_size, get_alignment()));
+    }
+}
+
+runtime::Allocator*
+    runtime::interpreter::INTExecutable::acquire_call_allocator(unique_lock<mutex>& lock)
+{
+    Allocator* allocator = nullptr;
+    lock = unique_lock<mutex>(m_arena_mutex, try_to_lock);
+    if (lock.owns_lock() && m_arena)
+    {
+        m_arena->reset();
+        allocator = m_arena.get();
+    }
+    return allocator;
+}
+
+char* runtime::interpreter::INTExecutable::get_memory_pool(const unique_lock<mutex>& lock)
+{
+    return lock.owns_lock() && m_memory_pool ? m_memory_pool->get_ptr<char>() : nullptr;
+}
+
+shared_ptr<runtime::HostTensor> runtime::interpreter::INTExecutable::create_intermediate_tensor(
+    const Output<Node>& output, Allocator* allocator, char* pool)
+{
+    const element::Type& type = output.get_element_type();
+    const string& name = output.get_tensor().get_name();
+    shared_ptr<HostTensor> tensor;
+    auto it = pool ? m_tensor_offsets.find(&output.get_tensor()) : m_tensor_offsets.end();
+    if (it != m_tensor_offsets.end())
+    {
+        tensor = make_shared<HostTensor>(type, output.get_shape(), pool + it->second, name);
+    }
+    else
+    {
+        tensor = make_shared<HostTensor>(type, output.get_partial_shape(), name, allocator);
+    }
+    return tensor;
+}
+
 vector<runtime::PerformanceCounter>
     runtime::interpreter::INTExecutable::get_performance_data() const
 {
@@ -293,6 +397,15 @@ vector<runtime::PerformanceCounter>
     return rc;
 }
 
+runtime::MemoryFootprint runtime::interpreter::INTExecutable::get_memory_footprint() const
+{
+    MemoryFootprint footprint = Executable::get_memory_footprint();
+    footprint.activation_bytes_per_context =
+        get_memory_pool_size() + (m_arena ? m_arena->get_capacity() : 0);
+    footprint.contexts = 1;
+    return footprint;
+}
+
 void runtime::interpreter::INTExecutable::perform_nan_check(
     const vector<shared_ptr<HostTensor>>& tensors, const Node* op)
 {
@@ -351,6 +464,56 @@ void runtime::interpreter::INTExecutable::save(ostream& out)
     writer.write("model", model.data(), model.size());
 }
 
+VariableState& runtime::interpreter::INTExecutable::get_variable(const string& variable_id,
+                                                                const element::Type& element_type,
+                                                                const Shape& shape)
+{
+    auto it = m_variables.find(variable_id);
+    if (it == m_variables.end())
+    {
+        it = m_variables
+                 .emplace(variable_id,
+                          unique_ptr<VariableState>(new VariableState(element_type, shape)))
+                 .first;
+    }
+    VariableState& variable = *it->second;
+    NGRAPH_CHECK(variable.get_element_type() == element_type && variable.get_shape() == shape,
+                 "Variable ",
+                 variable_id,
+                 " of element type ",
+                 variable.get_element_type(),
+                 " and shape ",
+                 variable.get_shape(),
+                 " is used with element type ",
+                 element_type,
+                 " and shape ",
+                 shape);
+    return variable;
+}
+
+bool runtime::interpreter::INTExecutable::read_variable(const string& variable_id,
+                                                        const shared_ptr<Tensor>& tensor)
+{
+    VariableState& variable =
+        get_variable(variable_id, tensor->get_element_type(), tensor->get_shape());
+    if (!variable.is_initialized())
+    {
+        return false;
+    }
+    tensor->write(variable.get_data_ptr(), variable.size());
+    return true;
+}
+
+void runtime::interpreter::INTExecutable::write_variable(const string& variable_id,
+                                                         const shared_ptr<Tensor>& tensor)
+{
+    VariableState& variable =
+        get_variable(variable_id, tensor->get_element_type(), tensor->get_shape());
+    vector<char> value(variable.size());
+    tensor->read(value.data(), value.size());
+    variable.write(value.data());
+}
+
 shared_ptr<ngraph::op::v0::Parameter>
     runtime::interpreter::INTExecutable::get_parameter(size_t index) const
 {
@@ -19,6 +19,7 @@
 #include <initializer_list>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -27,9 +28,11 @@
 #include "ngraph/log.hpp"
 #include "ngraph/ops.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/arena_allocator.hpp"
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/host_tensor.hpp"
 #include "ngraph/runtime/interpreter/int_backend_visibility.hpp"
+#include "ngraph/runtime/interpreter/int_thread_pool.hpp"
 #include "ngraph/runtime/reference/abs.hpp"
 #include "ngraph/runtime/reference/acos.hpp"
 #include "ngraph/runtime/reference/acosh.hpp"
@@ -48,6 +51,7 @@
 #include "ngraph/runtime/reference/avg_pool.hpp"
 #include "ngraph/runtime/reference/batch_mat_mul.hpp"
 #include "ngraph/runtime/reference/batch_norm.hpp"
+#include "ngraph/runtime/reference/binary_convolution.hpp"
 #include "ngraph/runtime/reference/broadcast.hpp"
 #include "ngraph/runtime/reference/broadcast_distributed.hpp"
 #include "ngraph/runtime/reference/ceiling.hpp"
@@ -59,10 +63,15 @@
 #include "ngraph/runtime/reference/copy.hpp"
 #include "ngraph/runtime/reference/cos.hpp"
 #include "ngraph/runtime/reference/cosh.hpp"
+#include "ngraph/runtime/reference/ctc_greedy_decoder.hpp"
 #include "ngraph/runtime/reference/cum_sum.hpp"
+#include "ngraph/runtime/reference/decompress_weights.hpp"
+#include "ngraph/runtime/reference/deformable_convolution.hpp"
 #include "ngraph/runtime/reference/dequantize.hpp"
+#include "ngraph/runtime/reference/detection_output.hpp"
 #include "ngraph/runtime/reference/divide.hpp"
 #include "ngraph/runtime/reference/dot.hpp"
+#include "ngraph/runtime/reference/embedding_bag.hpp"
 #include "ngraph/runtime/reference/embedding_lookup.hpp"
 #include "ngraph/runtime/reference/equal.hpp"
 #include "ngraph/runtime/reference/erf.hpp"
@@ -70,9 +79,11 @@
 #include "ngraph/runtime/reference/floor.hpp"
 #include "ngraph/runtime/reference/gather.hpp"
 #include "ngraph/runtime/reference/gather_nd.hpp"
+#include "ngraph/runtime/reference/gather_tree.hpp"
 #include "ngraph/runtime/reference/generate_mask.hpp"
 #include "ngraph/runtime/reference/greater.hpp"
 #include "ngraph/runtime/reference/greater_equal.hpp"
+#include "ngraph/runtime/reference/interpolate.hpp"
 #include "ngraph/runtime/reference/less.hpp"
 #include "ngraph/runtime/reference/less_equal.hpp"
 #include "ngraph/runtime/reference/log.hpp"
@@ -86,6 +97,7 @@
 #include "ngraph/runtime/reference/minimum.hpp"
 #include "ngraph/runtime/reference/multiply.hpp"
 #include "ngraph/runtime/reference/negate.hpp"
+#include "ngraph/runtime/reference/non_max_suppression.hpp"
 #include "ngraph/runtime/reference/not.hpp"
 #include "ngraph/runtime/reference/not_equal.hpp"
 #include "ngraph/runtime/reference/one_hot.hpp"
@@ -102,10 +114,14 @@
 #include "ngraph/runtime/reference/reshape.hpp"
 #include "ngraph/runtime/reference/result.hpp"
 #include "ngraph/runtime/reference/reverse.hpp"
+#include "ngraph/runtime/reference/roi_pooling.hpp"
 #include "ngraph/runtime/reference/reverse_sequence.hpp"
 #include "ngraph/runtime/reference/round.hpp"
 #include "ngraph/runtime/reference/scatter_add.hpp"
+#include "ngraph/runtime/reference/scatter_elements_update.hpp"
 #include "ngraph/runtime/reference/scatter_nd_add.hpp"
+#include "ngraph/runtime/reference/scatter_nd_update.hpp"
+#include "ngraph/runtime/reference/scatter_update.hpp"
 #include "ngraph/runtime/reference/select.hpp"
 #include "ngraph/runtime/reference/send.hpp"
 #include "ngraph/runtime/reference/shape_of.hpp"
@@ -127,6 +143,7 @@
 #include "ngraph/slice_plan.hpp"
 #include "ngraph/state/bernoulli_rng_state.hpp"
 #include "ngraph/state/uniform_rng_state.hpp"
+#include "ngraph/state/variable_state.hpp"
 #include "ngraph/util.hpp"
 
 namespace ngraph
@@ -167,9 +184,42 @@ public:
 
     virtual void save(std::ostream& output_stream) override;
 
+    bool read_variable(const std::string& variable_id,
+                       const std::shared_ptr<Tensor>& tensor) override;
+
+    void write_variable(const std::string& variable_id,
+                        const std::shared_ptr<Tensor>& tensor) override;
+
     void set_nan_check(bool enable);
 
+    /// \brief Allocate intermediate tensors from an arena owned by this executable and reset
+    ///        at the start of every call, instead of one system allocation per tensor.
+    ///        Enabled by default.
+    void set_arena_enabled(bool enable);
+
+    /// \brief The arena used for intermediate tensors, nullptr when disabled
+    const ArenaAllocator* get_arena() const { return m_arena.get(); }
+
+    /// \brief Bind intermediate tensors of static functions to offsets in a single pool
+    ///        planned by pass::MemoryLayout at compile time. Enabled by default. Tensors without
+    ///        a planned offset still use the arena.
+    void set_memory_plan_enabled(bool enable);
+
+    /// \brief Size in bytes of the statically planned pool holding intermediate tensors
+    size_t get_memory_pool_size() const { return m_memory_pool ? m_memory_pool->size() : 0; }
+
+    /// \brief Run large kernels in partitions of their outermost output axis on `thread_pool`,
+    ///        nullptr to run every kernel on the calling thread. Set by INTBackend when it is
+    ///        created with the "threads=N" option.
+    void set_thread_pool(const std::shared_ptr<INTThreadPool>& thread_pool)
+    {
+        m_thread_pool = thread_pool;
+    }
+
     std::vector<PerformanceCounter> get_performance_data() const override;
+    /// \brief Activations are the planned pool and the arena holding the other intermediate
+    ///        tensors, which grows to the largest call so far
+    MemoryFootprint get_memory_footprint() const override;
 
     std::shared_ptr<runtime::Tensor> create_input_tensor(size_t input_index) override;
 
@@ -273,6 +323,11 @@ protected:
     AxisSet as_axis_set(const HostTensor* tensor) const;
     AxisVector as_axis_vector(const HostTensor* tensor) const;
 
+    /// \brief Returns the variable `variable_id`, created on first use, and checks that it
+    ///        has `element_type` and `shape`
+    VariableState& get_variable(const std::string& variable_id,
+                                const element::Type& element_type,
+                                const Shape& shape);
     std::shared_ptr<ngraph::op::v0::Parameter> get_parameter(size_t index) const;
     std::shared_ptr<ngraph::op::v0::Result> get_result(size_t index) const;
     int get_alignment() const { return 64; }
@@ -283,10 +338,53 @@ protected:
     std::unordered_map<std::shared_ptr<const Node>, stopwatch> m_timer_map;
     NodeVector m_nodes;
     std::unordered_map<const Node*, std::shared_ptr<State>> m_states;
+    std::unordered_map<std::string, std::unique_ptr<VariableState>> m_variables;
     std::set<std::string> m_unsupported_op_name_list;
+    std::unique_ptr<ArenaAllocator> m_arena{new ArenaAllocator()};
+    std::mutex m_arena_mutex;
+
+    /// \brief Returns the allocator for the intermediate tensors of one call. If the arena is
+    ///        enabled and not in use by a concurrent call it is locked with `lock` and reset,
+    ///        otherwise nullptr is returned and tensors use the default allocation.
+    Allocator* acquire_call_allocator(std::unique_lock<std::mutex>& lock);
+
+    /// \brief Pool laid out by pass::MemoryLayout for static functions. Like the arena it may
+    ///        only be used by the call holding `lock`, nullptr is returned otherwise.
+    char* get_memory_pool(const std::unique_lock<std::mutex>& lock);
+
+    /// \brief Creates the tensor for an intermediate value, bound to its planned offset in
+    ///        `pool` when there is one and allocated from `allocator` otherwise
+    std::shared_ptr<HostTensor>
+        create_intermediate_tensor(const Output<Node>& output, Allocator* allocator, char* pool);
+
+    std::shared_ptr<INTThreadPool> m_thread_pool;
+    std::unique_ptr<AlignedBuffer> m_memory_pool;
+    size_t m_planned_pool_size = 0;
+    std::unordered_map<const descriptor::Tensor*, size_t> m_tensor_offsets;
+
+    /// \brief One node of the call plan: the slots of the per-call tensor table it reads and
+    ///        writes, and the element type its kernel is instantiated for
+    struct CallStep
+    {
+        std::shared_ptr<Node> node;
+        element::Type type;
+        std::vector<size_t> inputs;
+        std::vector<size_t> outputs;
+    };
+
+    /// \brief Numbers the tensors of m_nodes, the function's parameters first and its results
+    ///        next, and resolves the slots and kernel element type of every node so call does
+    ///        no lookups per node
+    void build_call_plan();
+
+    std::vector<CallStep> m_call_plan;
+    size_t m_tensor_slot_count = 0;
 
     static OP_TYPEID get_typeid(const Node& node);
 
+    /// \brief The element type op_engine is instantiated with for `node`
+    static element::Type get_kernel_element_type(const Node& node);
+
     static void perform_nan_check(const std::vector<std::shared_ptr<HostTensor>>&,
                                   const Node* op = nullptr);
 
@@ -295,11 +393,602 @@ protected:
                                 const std::vector<std::shared_ptr<HostTensor>>& outputs,
                                 const std::vector<std::shared_ptr<HostTensor>>& inputs);
 
+    /// \brief Elementwise and reduction kernels are only partitioned from this many output
+    ///        elements on, below it the threads cost more than they save
+    static const size_t s_parallel_min_elements = 1 << 15;
+
+    template <typename T>
+    using UnaryKernel = void (*)(const T*, T*, size_t);
+
+    template <typename T>
+    using BinaryKernel = void (*)(const T*,
+                                  const T*,
+                                  T*,
+                                  const Shape&,
+                                  const Shape&,
+                                  const op::AutoBroadcastSpec&);
+
+    /// \brief Runs the kernel of `node` in partitions of its outermost output axis on
+    ///        m_thread_pool.
+    /// \returns false if the op is not partitioned and op_engine must run it instead.
+    template <typename T>
+    bool parallel_op_engine(const Node& node,
+                            const std::vector<std::shared_ptr<HostTensor>>& out,
+                            const std::vector<std::shared_ptr<HostTensor>>& args)
+    {
+        if (node.get_output_size() != 1 || node.get_output_partial_shape(0).is_dynamic() ||
+            node.get_output_shape(0).empty() || node.get_output_shape(0)[0] < 2)
+        {
+            return false;
+        }
+        const Shape& out_shape = node.get_output_shape(0);
+        size_t out_size = shape_size(out_shape);
+        bool is_large = out_size >= s_parallel_min_elements;
+        T* out_data = out[0]->get_data_ptr<T>();
+        size_t out_stride = out_size / out_shape[0];
+        // Runs kernel(begin, end) on ranges of the outermost output axis
+        auto partition = [&](const std::function<void(size_t, size_t)>& kernel) {
+            m_thread_pool->parallel_for(out_shape[0], kernel);
+            return true;
+        };
+        // `shape` with its outermost axis cut to the partition [begin, end)
+        auto cut = [](Shape shape, size_t begin, size_t end) {
+            shape[0] = end - begin;
+            return shape;
+        };
+        // Partitions the data input of a batched spatial op, [N, C, ...] to [N, ...]
+        auto batch_stride = [&]() { return shape_size(args[0]->get_shape()) / out_shape[0]; };
+
+        switch (get_typeid(node))
+        {
+        case OP_TYPEID::Abs_v0: return is_large && parallel_unary<T>(reference::abs<T>, out, args);
+        case OP_TYPEID::Exp_v0: return is_large && parallel_unary<T>(reference::exp<T>, out, args);
+        case OP_TYPEID::Log_v0: return is_large && parallel_unary<T>(reference::log<T>, out, args);
+        case OP_TYPEID::Negative_v0:
+            return is_large && parallel_unary<T>(reference::negate<T>, out, args);
+        case OP_TYPEID::Relu_v0:
+            return is_large && parallel_unary<T>(reference::relu<T>, out, args);
+        case OP_TYPEID::Sigmoid_v0:
+            return is_large && parallel_unary<T>(reference::sigmoid<T>, out, args);
+        case OP_TYPEID::Sqrt_v0:
+            return is_large && parallel_unary<T>(reference::sqrt<T>, out, args);
+        case OP_TYPEID::Tanh_v0:
+            return is_large && parallel_unary<T>(reference::tanh<T>, out, args);
+        case OP_TYPEID::Add_v1:
+            return is_large && parallel_binary<T>(reference::add<T>,
+                                                  static_cast<const op::v1::Add&>(node).get_autob(),
+                                                  out,
+                                                  args);
+        case OP_TYPEID::Subtract_v1:
+            return is_large &&
+                   parallel_binary<T>(reference::subtract<T>,
+                                      static_cast<const op::v1::Subtract&>(node).get_autob(),
+                                      out,
+                                      args);
+        case OP_TYPEID::Multiply_v1:
+            return is_large &&
+                   parallel_binary<T>(reference::multiply<T>,
+                                      static_cast<const op::v1::Multiply&>(node).get_autob(),
+                                      out,
+                                      args);
+        case OP_TYPEID::Maximum_v1:
+            return is_large &&
+                   parallel_binary<T>(reference::maximum<T>,
+                                      static_cast<const op::v1::Maximum&>(node).get_autob(),
+                                      out,
+                                      args);
+        case OP_TYPEID::Minimum_v1:
+            return is_large &&
+                   parallel_binary<T>(reference::minimum<T>,
+                                      static_cast<const op::v1::Minimum&>(node).get_autob(),
+                                      out,
+                                      args);
+        case OP_TYPEID::Dot_v0:
+        {
+            const op::v0::Dot* dot = static_cast<const op::v0::Dot*>(&node);
+            const Shape& arg0_shape = args[0]->get_shape();
+            if (arg0_shape.size() <= dot->get_reduction_axes_count())
+            {
+                // The outermost output axis comes from arg1
+                return false;
+            }
+            size_t arg0_stride = shape_size(arg0_shape) / arg0_shape[0];
+            return partition([&](size_t begin, size_t end) {
+                reference::dot(args[0]->get_data_ptr<const T>() + begin * arg0_stride,
+                               args[1]->get_data_ptr<const T>(),
+                               out_data + begin * out_stride,
+                               cut(arg0_shape, begin, end),
+                               args[1]->get_shape(),
+                               cut(out_shape, begin, end),
+                               dot->get_reduction_axes_count());
+            });
+        }
+        case OP_TYPEID::Convolution_v0:
+        {
+            const op::v0::Convolution* c = static_cast<const op::v0::Convolution*>(&node);
+            size_t arg0_stride = batch_stride();
+            return partition([&](size_t begin, size_t end) {
+                reference::convolution<T>(args[0]->get_data_ptr<const T>() + begin * arg0_stride,
+                                          args[1]->get_data_ptr<const T>(),
+                                          out_data + begin * out_stride,
+                                          cut(args[0]->get_shape(), begin, end),
+                                          args[1]->get_shape(),
+                                          cut(out_shape, begin, end),
+                                          c->get_window_movement_strides(),
+                                          c->get_window_dilation_strides(),
+                                          c->get_padding_below(),
+                                          c->get_padding_above(),
+                                          c->get_data_dilation_strides());
+            });
+        }
+        case OP_TYPEID::MaxPool_v0:
+        {
+            const op::v0::MaxPool* max_pool = static_cast<const op::v0::MaxPool*>(&node);
+            size_t arg0_stride = batch_stride();
+            return partition([&](size_t begin, size_t end) {
+                reference::max_pool<T>(args[0]->get_data_ptr<const T>() + begin * arg0_stride,
+                                       out_data + begin * out_stride,
+                                       cut(args[0]->get_shape(), begin, end),
+                                       cut(out_shape, begin, end),
+                                       max_pool->get_window_shape(),
+                                       max_pool->get_window_movement_strides(),
+                                       max_pool->get_padding_below(),
+                                       max_pool->get_padding_above());
+            });
+        }
+        case OP_TYPEID::AvgPool_v0:
+        {
+            const op::v0::AvgPool* avg_pool = static_cast<const op::v0::AvgPool*>(&node);
+            size_t arg0_stride = batch_stride();
+            return partition([&](size_t begin, size_t end) {
+                reference::avg_pool<T>(args[0]->get_data_ptr<const T>() + begin * arg0_stride,
+                                       out_data + begin * out_stride,
+                                       cut(args[0]->get_shape(), begin, end),
+                                       cut(out_shape, begin, end),
+                                       avg_pool->get_window_shape(),
+                                       avg_pool->get_window_movement_strides(),
+                                       avg_pool->get_padding_below(),
+                                       avg_pool->get_padding_above(),
+                                       avg_pool->get_include_padding_in_avg_computation());
+            });
+        }
+        case OP_TYPEID::Softmax_v0:
+        {
+            const op::v0::Softmax* softmax = static_cast<const op::v0::Softmax*>(&node);
+            if (!is_large || softmax->get_axes().count(0) != 0)
+            {
+                return false;
+            }
+            return partition([&](size_t begin, size_t end) {
+                reference::softmax<T>(args[0]->get_data_ptr<const T>() + begin * out_stride,
+                                      out_data + begin * out_stride,
+                                      cut(out_shape, begin, end),
+                                      softmax->get_axes());
+            });
+        }
+        case OP_TYPEID::Sum_v0:
+        {
+            AxisSet reduction_axes = as_axis_set(args[1].get());
+            if (shape_size(args[0]->get_shape()) < s_parallel_min_elements ||
+                reduction_axes.count(0) != 0)
+            {
+                return false;
+            }
+            size_t arg0_stride = batch_stride();
+            return partition([&](size_t begin, size_t end) {
+                reference::sum<T>(args[0]->get_data_ptr<const T>() + begin * arg0_stride,
+                                  out_data + begin * out_stride,
+                                  cut(args[0]->get_shape(), begin, end),
+                                  reduction_axes);
+            });
+        }
+        case OP_TYPEID::EmbeddingBagOffsetsSum_v3:
+        case OP_TYPEID::EmbeddingBagPackedSum_v3:
+        case OP_TYPEID::EmbeddingSegmentsSum_v3:
+        {
+            // The work is in the gathered rows, not in the output
+            if (shape_size(args[1]->get_shape()) * out_stride < s_parallel_min_elements)
+            {
+                return false;
+            }
+            return partition([&](size_t begin, size_t end) {
+                embedding_bag_sum<T>(node, out, args, begin, end);
+            });
+        }
+        default: return false;
+        }
+    }
+
+    /// \brief Runs the pooling kernel of an EmbeddingBag or EmbeddingSegmentsSum node on the
+    ///        bags [begin, end) of its output
+    template <typename T, typename U>
+    void embedding_bag_sum(const Node& node,
+                           const std::vector<std::shared_ptr<HostTensor>>& out,
+                           const std::vector<std::shared_ptr<HostTensor>>& args,
+                           size_t begin,
+                           size_t end)
+    {
+        const T* emb_table = args[0]->get_data_ptr<const T>();
+        const U* indices = args[1]->get_data_ptr<const U>();
+        size_t indices_count = shape_size(args[1]->get_shape());
+        T* out_data = out[0]->get_data_ptr<T>();
+        const Shape& out_shape = out[0]->get_shape();
+        auto optional_input = [&](size_t index) {
+            return args.size() > index ? args[index]->get_data_ptr() : nullptr;
+        };
+        switch (get_typeid(node))
+        {
+        case OP_TYPEID::EmbeddingBagOffsetsSum_v3:
+            reference::embedding_bag_offsets_sum<T, U>(emb_table,
+                                                       indices,
+                                                       args[2]->get_data_ptr<const U>(),
+                                                       static_cast<const U*>(optional_input(3)),
+                                                       static_cast<const T*>(optional_input(4)),
+                                                       out_data,
+                                                       indices_count,
+                                                       out_shape,
+                                                       begin,
+                                                       end);
+            break;
+        case OP_TYPEID::EmbeddingBagPackedSum_v3:
+            reference::embedding_bag_packed_sum<T, U>(emb_table,
+                                                      indices,
+                                                      static_cast<const T*>(optional_input(2)),
+                                                      out_data,
+                                                      args[1]->get_shape(),
+                                                      out_shape,
+                                                      begin,
+                                                      end);
+            break;
+        case OP_TYPEID::EmbeddingSegmentsSum_v3:
+            reference::embedding_segments_sum<T, U>(emb_table,
+                                                    indices,
+                                                    args[2]->get_data_ptr<const U>(),
+                                                    static_cast<const U*>(optional_input(4)),
+                                                    static_cast<const T*>(optional_input(5)),
+                                                    out_data,
+                                                    indices_count,
+                                                    out_shape,
+                                                    begin,
+                                                    end);
+            break;
+        default: throw ngraph_error("Unexpected op in embedding_bag_sum");
+        }
+    }
+
+    template <typename T>
+    void embedding_bag_sum(const Node& node,
+                           const std::vector<std::shared_ptr<HostTensor>>& out,
+                           const std::vector<std::shared_ptr<HostTensor>>& args,
+                           size_t begin,
+                           size_t end)
+    {
+        element::Type index_type = node.get_input_element_type(1);
+        if (index_type == element::i32)
+        {
+            embedding_bag_sum<T, int32_t>(node, out, args, begin, end);
+        }
+        else if (index_type == element::i64)
+        {
+            embedding_bag_sum<T, int64_t>(node, out, args, begin, end);
+        }
+        else
+        {
+            throw ngraph_error(std::string("Unsupported index type ") +
+                               index_type.c_type_string() + std::string(" in ") +
+                               node.description());
+        }
+    }
+
+    /// \brief Runs a BinaryConvolution node whose filters have the element type F
+    template <typename T, typename F>
+    void binary_convolution(const Node& node,
+                            const std::vector<std::shared_ptr<HostTensor>>& out,
+                            const std::vector<std::shared_ptr<HostTensor>>& args)
+    {
+        auto c = static_cast<const op::v1::BinaryConvolution*>(&node);
+        reference::binary_convolution(args[0]->get_data_ptr<const T>(),
+                                      args[1]->get_data_ptr<const F>(),
+                                      out[0]->get_data_ptr<T>(),
+                                      args[0]->get_shape(),
+                                      args[1]->get_shape(),
+                                      out[0]->get_shape(),
+                                      c->get_strides(),
+                                      c->get_dilations(),
+                                      c->get_pads_begin(),
+                                      c->get_pad_value());
+    }
+
+    /// \brief Runs a GatherTree node whose max_seq_len has the element type L
+    template <typename T, typename L>
+    void gather_tree(const std::vector<std::shared_ptr<HostTensor>>& out,
+                     const std::vector<std::shared_ptr<HostTensor>>& args)
+    {
+        const Shape& shape = args[0]->get_shape();
+        reference::gather_tree(args[0]->get_data_ptr<const T>(),
+                               args[1]->get_data_ptr<const T>(),
+                               args[2]->get_data_ptr<const L>(),
+                               args[3]->get_data_ptr<const T>()[0],
+                               out[0]->get_data_ptr<T>(),
+                               shape,
+                               0,
+                               shape[1] * shape[2]);
+    }
+
+    /// \brief Runs a ROIAlign, ROIPooling, PSROIPooling or DeformablePSROIPooling node over all
+    ///        of its ROIs
+    void roi_pooling(const Node& node,
+                     const std::vector<std::shared_ptr<HostTensor>>& out,
+                     const std::vector<std::shared_ptr<HostTensor>>& args)
+    {
+        element::Type type = node.get_output_element_type(0);
+        if (type == element::f32)
+        {
+            roi_pooling<float>(node, out, args);
+        }
+        else if (type == element::f64)
+        {
+            roi_pooling<double>(node, out, args);
+        }
+        else
+        {
+            throw ngraph_error(std::string("Unsupported element type ") + type.c_type_string() +
+                               std::string(" in ") + node.description());
+        }
+    }
+
+    template <typename T>
+    void roi_pooling(const Node& node,
+                     const std::vector<std::shared_ptr<HostTensor>>& out,
+                     const std::vector<std::shared_ptr<HostTensor>>& args)
+    {
+        const Shape& input_shape = args[0]->get_shape();
+        reference::ROIFeatureMap<T> input(args[0]->get_data_ptr<const T>(), input_shape);
+        size_t batch = input_shape[0];
+        size_t rois = args[1]->get_shape()[0];
+        const T* coords = args[1]->get_data_ptr<const T>();
+        T* result = out[0]->get_data_ptr<T>();
+        switch (get_typeid(node))
+        {
+        case OP_TYPEID::ROIAlign_v3:
+        {
+            auto roi_align = static_cast<const op::v3::ROIAlign*>(&node);
+            element::Type index_type = node.get_input_element_type(2);
+            if (index_type == element::i64)
+            {
+                reference::roi_align(input,
+                                     batch,
+                                     coords,
+                                     args[2]->get_data_ptr<const int64_t>(),
+                                     result,
+                                     roi_align->get_pooled_h(),
+                                     roi_align->get_pooled_w(),
+                                     roi_align->get_sampling_ratio(),
+                                     roi_align->get_spatial_scale(),
+                                     roi_align->get_mode(),
+                                     0,
+                                     rois);
+            }
+            else if (index_type == element::i32)
+            {
+                reference::roi_align(input,
+                                     batch,
+                                     coords,
+                                     args[2]->get_data_ptr<const int32_t>(),
+                                     result,
+                                     roi_align->get_pooled_h(),
+                                     roi_align->get_pooled_w(),
+                                     roi_align->get_sampling_ratio(),
+                                     roi_align->get_spatial_scale(),
+                                     roi_align->get_mode(),
+                                     0,
+                                     rois);
+            }
+            else
+            {
+                throw ngraph_error(std::string("Unsupported index type ") +
+                                   index_type.c_type_string() + std::string(" in ") +
+                                   node.description());
+            }
+            break;
+        }
+        case OP_TYPEID::ROIPooling_v0:
+        {
+            auto roi_pooling = static_cast<const op::v0::ROIPooling*>(&node);
+            reference::roi_pooling(input,
+                                   batch,
+                                   coords,
+                                   result,
+                                   roi_pooling->get_output_size()[0],
+                                   roi_pooling->get_output_size()[1],
+                                   roi_pooling->get_spatial_scale(),
+                                   roi_pooling->get_method(),
+                                   0,
+                                   rois);
+            break;
+        }
+        case OP_TYPEID::PSROIPooling_v0:
+        {
+            auto psroi = static_cast<const op::v0::PSROIPooling*>(&node);
+            reference::psroi_pooling(input,
+                                     batch,
+                                     coords,
+                                     result,
+                                     psroi->get_output_dim(),
+                                     psroi->get_group_size(),
+                                     psroi->get_spatial_scale(),
+                                     psroi->get_spatial_bins_x(),
+                                     psroi->get_spatial_bins_y(),
+                                     psroi->get_mode(),
+                                     0,
+                                     rois);
+            break;
+        }
+        case OP_TYPEID::DeformablePSROIPooling_v1:
+        {
+            auto psroi = static_cast<const op::v1::DeformablePSROIPooling*>(&node);
+            NGRAPH_CHECK(psroi->get_mode() == "bilinear_deformable",
+                         "Unsupported DeformablePSROIPooling mode ",
+                         psroi->get_mode());
+            bool has_offsets = args.size() > 2;
+            reference::deformable_psroi_pooling(
+                input,
+                batch,
+                coords,
+                has_offsets ? args[2]->get_data_ptr<const T>() : nullptr,
+                has_offsets ? args[2]->get_shape()[1] / 2 : 1,
+                result,
+                psroi->get_output_dim(),
+                psroi->get_group_size(),
+                psroi->get_spatial_scale(),
+                psroi->get_spatial_bins_x(),
+                psroi->get_spatial_bins_y(),
+                psroi->get_trans_std(),
+                psroi->get_part_size(),
+                0,
+                rois);
+            break;
+        }
+        default: throw ngraph_error("Unexpected ROI pooling node " + node.description());
+        }
+    }
+
+    /// \brief Runs a v1 or v3 NonMaxSuppression node. The scalar inputs are read from their
+    ///        tensors, so they need not be constants.
+    template <typename T>
+    void non_max_suppression(const Node& node,
+                             const std::vector<std::shared_ptr<HostTensor>>& out,
+                             const std::vector<std::shared_ptr<HostTensor>>& args)
+    {
+        bool center_point_box;
+        bool sort_result_descending;
+        if (get_typeid(node) == OP_TYPEID::NonMaxSuppression_v1)
+        {
+            auto nms = static_cast<const op::v1::NonMaxSuppression*>(&node);
+            center_point_box = nms->get_box_encoding() ==
+                               op::v1::NonMaxSuppression::BoxEncodingType::CENTER;
+            sort_result_descending = nms->get_sort_result_descending();
+        }
+        else
+        {
+            auto nms = static_cast<const op::v3::NonMaxSuppression*>(&node);
+            center_point_box = nms->get_box_encoding() ==
+                               op::v3::NonMaxSuppression::BoxEncodingType::CENTER;
+            sort_result_descending = nms->get_sort_result_descending();
+        }
+        int64_t max_output_boxes_per_class = read_index_vector(args[2]).at(0);
+        float iou_threshold = read_float_vector(args[3]).at(0);
+        float score_threshold = read_float_vector(args[4]).at(0);
+        size_t out_rows = shape_size(out[0]->get_shape()) / 3;
+        const T* boxes = args[0]->get_data_ptr<const T>();
+        const T* scores = args[1]->get_data_ptr<const T>();
+        element::Type index_type = node.get_output_element_type(0);
+        if (index_type == element::i64)
+        {
+            reference::non_max_suppression<T, int64_t>(boxes,
+                                                       scores,
+                                                       out[0]->get_data_ptr<int64_t>(),
+                                                       args[0]->get_shape(),
+                                                       args[1]->get_shape(),
+                                                       out_rows,
+                                                       max_output_boxes_per_class,
+                                                       iou_threshold,
+                                                       score_threshold,
+                                                       center_point_box,
+                                                       sort_result_descending);
+        }
+        else if (index_type == element::i32)
+        {
+            reference::non_max_suppression<T, int32_t>(boxes,
+                                                       scores,
+                                                       out[0]->get_data_ptr<int32_t>(),
+                                                       args[0]->get_shape(),
+                                                       args[1]->get_shape(),
+                                                       out_rows,
+                                                       max_output_boxes_per_class,
+                                                       iou_threshold,
+                                                       score_threshold,
+                                                       center_point_box,
+                                                       sort_result_descending);
+        }
+        else
+        {
+            throw ngraph_error(std::string("Unsupported index type ") +
+                               index_type.c_type_string() + std::string(" in ") +
+                               node.description());
+        }
+    }
+
+    /// \brief Partitions an elementwise kernel into ranges of elements
+    template <typename T>
+    bool parallel_unary(UnaryKernel<T> kernel,
+                        const std::vector<std::shared_ptr<HostTensor>>& out,
+                        const std::vector<std::shared_ptr<HostTensor>>& args)
+    {
+        const T* arg = args[0]->get_data_ptr<const T>();
+        T* result = out[0]->get_data_ptr<T>();
+        m_thread_pool->parallel_for(shape_size(args[0]->get_shape()),
+                                    [&](size_t begin, size_t end) {
+                                        kernel(arg + begin, result + begin, end - begin);
+                                    });
+        return true;
+    }
+
+    /// \brief Partitions a broadcasting binary kernel along the outermost output axis. An
+    ///        input with a lower rank, or a single entry on that axis, is broadcast along it
+    ///        and passed whole to every partition.
+    template <typename T>
+    bool parallel_binary(BinaryKernel<T> kernel,
+                         const op::AutoBroadcastSpec& autob,
+                         const std::vector<std::shared_ptr<HostTensor>>& out,
+                         const std::vector<std::shared_ptr<HostTensor>>& args)
+    {
+        if (autob.m_type == op::AutoBroadcastType::PDPD)
+        {
+            return false;
+        }
+        const Shape& out_shape = out[0]->get_shape();
+        const Shape& arg0_shape = args[0]->get_shape();
+        const Shape& arg1_shape = args[1]->get_shape();
+        auto is_partitioned = [&](const Shape& shape) {
+            return shape.size() == out_shape.size() && shape[0] == out_shape[0];
+        };
+        bool partition_arg0 = is_partitioned(arg0_shape);
+        bool partition_arg1 = is_partitioned(arg1_shape);
+        size_t arg0_stride = partition_arg0 ? shape_size(arg0_shape) / arg0_shape[0] : 0;
+        size_t arg1_stride = partition_arg1 ? shape_size(arg1_shape) / arg1_shape[0] : 0;
+        size_t out_stride = shape_size(out_shape) / out_shape[0];
+        m_thread_pool->parallel_for(out_shape[0], [&](size_t begin, size_t end) {
+            Shape arg0_partition_shape = arg0_shape;
+            Shape arg1_partition_shape = arg1_shape;
+            if (partition_arg0)
+            {
+                arg0_partition_shape[0] = end - begin;
+            }
+            if (partition_arg1)
+            {
+                arg1_partition_shape[0] = end - begin;
+            }
+            kernel(args[0]->get_data_ptr<const T>() + begin * arg0_stride,
+                   args[1]->get_data_ptr<const T>() + begin * arg1_stride,
+                   out[0]->get_data_ptr<T>() + begin * out_stride,
+                   arg0_partition_shape,
+                   arg1_partition_shape,
+                   autob);
+        });
+        return true;
+    }
+
     template <typename T>
     void op_engine(const Node& node,
                    const std::vector<std::shared_ptr<HostTensor>>& out,
                    const std::vector<std::shared_ptr<HostTensor>>& args)
     {
+        if (m_thread_pool && parallel_op_engine<T>(node, out, args))
+        {
+            return;
+        }
+
 // We want to check that every OP_TYPEID enumeration is included in the list.
 // These GCC flags enable compile-time checking so that if an enumeration
 // is not in the list an error is generated.
@@ -452,6 +1141,15 @@ protected:
                 args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
             break;
         }
+        case OP_TYPEID::AssignVariable_v0:
+        {
+            const op::v0::AssignVariable* assign =
+                static_cast<const op::v0::AssignVariable*>(&node);
+            VariableState& variable = get_variable(
+                assign->get_variable_id(), args[0]->get_element_type(), args[0]->get_shape());
+            variable.write(args[0]->get_data_ptr());
+            break;
+        }
         case OP_TYPEID::Atan_v0:
         {
             Shape output_shape = args[0]->get_shape();
@@ -569,6 +1267,29 @@ protected:
                                             apb->get_include_padding_in_avg_computation());
             break;
         }
+        case OP_TYPEID::BinaryConvolution_v1:
+        {
+            element::Type filter_type = node.get_input_element_type(1);
+            if (filter_type == node.get_input_element_type(0))
+            {
+                binary_convolution<T, T>(node, out, args);
+            }
+            else if (filter_type == element::boolean || filter_type == element::u8)
+            {
+                binary_convolution<T, uint8_t>(node, out, args);
+            }
+            else if (filter_type == element::i8)
+            {
+                binary_convolution<T, int8_t>(node, out, args);
+            }
+            else
+            {
+                throw ngraph_error(std::string("Unsupported filter type ") +
+                                   filter_type.c_type_string() + std::string(" in ") +
+                                   node.description());
+            }
+            break;
+        }
         case OP_TYPEID::Broadcast_v0:
         {
             const op::v0::Broadcast* broadcast = static_cast<const op::v0::Broadcast*>(&node);
@@ -827,6 +1548,57 @@ protected:
             throw unsupported_op("Unsupported op 'CropAndResize_v0'");
             break;
         }
+        case OP_TYPEID::CTCGreedyDecoder_v0:
+        {
+            auto decoder = static_cast<const op::v0::CTCGreedyDecoder*>(&node);
+            if (node.get_input_element_type(1) != node.get_input_element_type(0))
+            {
+                throw ngraph_error("Unexpected type");
+            }
+            const Shape& data_shape = args[0]->get_shape();
+            reference::ctc_greedy_decoder(args[0]->get_data_ptr<const T>(),
+                                          args[1]->get_data_ptr<const T>(),
+                                          out[0]->get_data_ptr<T>(),
+                                          data_shape,
+                                          decoder->get_ctc_merge_repeated(),
+                                          0,
+                                          data_shape[1]);
+            break;
+        }
+        case OP_TYPEID::DecompressWeights_v0:
+        {
+            const op::v0::DecompressWeights* decompress =
+                static_cast<const op::v0::DecompressWeights*>(&node);
+            reference::decompress_weights(args[0]->get_data_ptr<const int8_t>(),
+                                          args[1]->get_data_ptr<const float>(),
+                                          out[0]->get_data_ptr<float>(),
+                                          decompress->get_weights_shape(),
+                                          decompress->get_axis(),
+                                          decompress->get_bits());
+            break;
+        }
+        case OP_TYPEID::DeformableConvolution_v1:
+        {
+            auto c = static_cast<const op::v1::DeformableConvolution*>(&node);
+            reference::deformable_convolution(args[0]->get_data_ptr<const T>(),
+                                              args[1]->get_data_ptr<const T>(),
+                                              args[2]->get_data_ptr<const T>(),
+                                              out[0]->get_data_ptr<T>(),
+                                              args[0]->get_shape(),
+                                              args[2]->get_shape(),
+                                              out[0]->get_shape(),
+                                              c->get_strides(),
+                                              c->get_dilations(),
+                                              c->get_pads_begin(),
+                                              static_cast<size_t>(c->get_group()),
+                                              static_cast<size_t>(c->get_deformable_group()));
+            break;
+        }
+        case OP_TYPEID::DeformablePSROIPooling_v1:
+        {
+            roi_pooling(node, out, args);
+            break;
+        }
         case OP_TYPEID::Dequantize_v0:
         {
             const op::v0::Dequantize* dequantize = static_cast<const op::v0::Dequantize*>(&node);
@@ -861,6 +1633,24 @@ protected:
 
             break;
         }
+        case OP_TYPEID::DetectionOutput_v0:
+        {
+            const op::v0::DetectionOutput* detection =
+                static_cast<const op::v0::DetectionOutput*>(&node);
+            bool has_aux_inputs = args.size() == 5;
+            reference::detection_output<T>(
+                args[0]->get_data_ptr<const T>(),
+                args[1]->get_data_ptr<const T>(),
+                args[2]->get_data_ptr<const T>(),
+                has_aux_inputs ? args[3]->get_data_ptr<const T>() : nullptr,
+                has_aux_inputs ? args[4]->get_data_ptr<const T>() : nullptr,
+                out[0]->get_data_ptr<T>(),
+                detection->get_attrs(),
+                args[0]->get_shape(),
+                args[2]->get_shape(),
+                out[0]->get_shape());
+            break;
+        }
         case OP_TYPEID::Divide_v1:
         {
             const op::v1::Divide* divide = static_cast<const op::v1::Divide*>(&node);
@@ -909,6 +1699,13 @@ protected:
                                         slice_plan);
             break;
         }
+        case OP_TYPEID::EmbeddingBagOffsetsSum_v3:
+        case OP_TYPEID::EmbeddingBagPackedSum_v3:
+        case OP_TYPEID::EmbeddingSegmentsSum_v3:
+        {
+            embedding_bag_sum<T>(node, out, args, 0, out[0]->get_shape().at(0));
+            break;
+        }
         case OP_TYPEID::EmbeddingLookup_v0:
         {
             const op::v0::EmbeddingLookup* embed =
@@ -1076,6 +1873,27 @@ protected:
             }
             break;
         }
+        case OP_TYPEID::GatherTree_v1:
+        {
+            element::Type length_type = node.get_input_element_type(2);
+            if (length_type == node.get_input_element_type(0))
+            {
+                gather_tree<T, T>(out, args);
+            }
+            else if (length_type == element::i32)
+            {
+                gather_tree<T, int32_t>(out, args);
+            }
+            else if (length_type == element::i64)
+            {
+                gather_tree<T, int64_t>(out, args);
+            }
+            else
+            {
+                throw ngraph_error("Unexpected type");
+            }
+            break;
+        }
         case OP_TYPEID::GenerateMask_v0:
         {
             bool use_seed = static_cast<bool>(args[2]->get_data_ptr<const int32_t>()[0]);
@@ -1134,6 +1952,22 @@ protected:
                                      greater_eq->get_autob());
             break;
         }
+        case OP_TYPEID::Interpolate_v0:
+        case OP_TYPEID::Interpolate_v3:
+        {
+            auto attrs =
+                get_typeid(node) == OP_TYPEID::Interpolate_v0
+                    ? reference::interpolate_attrs(
+                          static_cast<const op::v0::Interpolate*>(&node)->get_attrs())
+                    : static_cast<const op::v3::Interpolate*>(&node)->get_attrs();
+            auto tables = reference::make_interpolate_tables(
+                attrs, args[0]->get_shape(), node.get_output_shape(0));
+            reference::interpolate<T>(args[0]->get_data_ptr<const T>(),
+                                      out[0]->get_data_ptr<T>(),
+                                      args[0]->get_shape(),
+                                      tables);
+            break;
+        }
         case OP_TYPEID::Less_v1:
         {
             auto less = static_cast<const op::v1::Less*>(&node);
@@ -1335,6 +2169,12 @@ protected:
                 args[0]->get_data_ptr<const T>(), out[0]->get_data_ptr<T>(), element_count);
             break;
         }
+        case OP_TYPEID::NonMaxSuppression_v1:
+        case OP_TYPEID::NonMaxSuppression_v3:
+        {
+            non_max_suppression<T>(node, out, args);
+            break;
+        }
         case OP_TYPEID::NotEqual_v1:
         {
             auto not_equal = static_cast<const op::v1::NotEqual*>(&node);
@@ -1359,6 +2199,11 @@ protected:
                                   oh->get_one_hot_axis());
             break;
         }
+        case OP_TYPEID::PSROIPooling_v0:
+        {
+            roi_pooling(node, out, args);
+            break;
+        }
         case OP_TYPEID::Parameter_v0: break;
         case OP_TYPEID::Passthrough_v0:
         {
@@ -1698,6 +2543,12 @@ protected:
             memcpy(out[0]->get_data_ptr<T>(), args[0]->get_data_ptr<T>(), memSize);
             break;
         }
+        case OP_TYPEID::ROIAlign_v3:
+        case OP_TYPEID::ROIPooling_v0:
+        {
+            roi_pooling(node, out, args);
+            break;
+        }
         case OP_TYPEID::Range_v0:
         {
             const op::v0::Range* op = static_cast<const op::v0::Range*>(&node);
@@ -1780,6 +2631,14 @@ protected:
                               reduction_axes);
             break;
         }
+        case OP_TYPEID::ReadVariable_v0:
+        {
+            const op::v0::ReadVariable* read = static_cast<const op::v0::ReadVariable*>(&node);
+            VariableState& variable = get_variable(
+                read->get_variable_id(), args[0]->get_element_type(), args[0]->get_shape());
+            variable.read(out[0]->get_data_ptr(), args[0]->get_data_ptr());
+            break;
+        }
         case OP_TYPEID::Relu_v0:
         {
             Shape output_shape = args[0]->get_shape();
@@ -1934,6 +2793,65 @@ protected:
             }
             break;
         }
+        case OP_TYPEID::ScatterElementsUpdate_v3:
+        {
+            int64_t axis = read_index_vector(args[3]).at(0);
+            if (axis < 0)
+            {
+                axis += static_cast<int64_t>(args[0]->get_shape().size());
+            }
+            if (node.get_input_element_type(1) == element::i64)
+            {
+                reference::scatter_elem_update<T, int64_t>(args[0]->get_data_ptr<const T>(),
+                                                           args[1]->get_data_ptr<int64_t>(),
+                                                           args[2]->get_data_ptr<const T>(),
+                                                           axis,
+                                                           out[0]->get_data_ptr<T>(),
+                                                           args[0]->get_shape(),
+                                                           args[1]->get_shape());
+            }
+            else if (node.get_input_element_type(1) == element::i32)
+            {
+                reference::scatter_elem_update<T, int32_t>(args[0]->get_data_ptr<const T>(),
+                                                           args[1]->get_data_ptr<int32_t>(),
+                                                           args[2]->get_data_ptr<const T>(),
+                                                           axis,
+                                                           out[0]->get_data_ptr<T>(),
+                                                           args[0]->get_shape(),
+                                                           args[1]->get_shape());
+            }
+            else
+            {
+                throw ngraph_error("Unexpected type");
+            }
+            break;
+        }
+        case OP_TYPEID::ScatterND_v0:
+        {
+            if (node.get_input_element_type(1) == element::i64)
+            {
+                reference::scatter_nd_update<T, int64_t>(args[0]->get_data_ptr<const T>(),
+                                                         args[1]->get_data_ptr<int64_t>(),
+                                                         args[2]->get_data_ptr<const T>(),
+                                                         out[0]->get_data_ptr<T>(),
+                                                         args[0]->get_shape(),
+                                                         args[1]->get_shape());
+            }
+            else if (node.get_input_element_type(1) == element::i32)
+            {
+                reference::scatter_nd_update<T, int32_t>(args[0]->get_data_ptr<const T>(),
+                                                         args[1]->get_data_ptr<int32_t>(),
+                                                         args[2]->get_data_ptr<const T>(),
+                                                         out[0]->get_data_ptr<T>(),
+                                                         args[0]->get_shape(),
+                                                         args[1]->get_shape());
+            }
+            else
+            {
+                throw ngraph_error("Unexpected type");
+            }
+            break;
+        }
         case OP_TYPEID::ScatterNDAdd_v0:
         {
             if (node.get_input_element_type(1) == element::i64)
@@ -1964,6 +2882,39 @@ protected:
             }
             break;
         }
+        case OP_TYPEID::ScatterUpdate_v3:
+        {
+            int64_t axis = read_index_vector(args[3]).at(0);
+            if (axis < 0)
+            {
+                axis += static_cast<int64_t>(args[0]->get_shape().size());
+            }
+            if (node.get_input_element_type(1) == element::i64)
+            {
+                reference::scatter_update<T, int64_t>(args[0]->get_data_ptr<const T>(),
+                                                      args[1]->get_data_ptr<int64_t>(),
+                                                      args[2]->get_data_ptr<const T>(),
+                                                      out[0]->get_data_ptr<T>(),
+                                                      args[0]->get_shape(),
+                                                      args[1]->get_shape(),
+                                                      static_cast<size_t>(axis));
+            }
+            else if (node.get_input_element_type(1) == element::i32)
+            {
+                reference::scatter_update<T, int32_t>(args[0]->get_data_ptr<const T>(),
+                                                      args[1]->get_data_ptr<int32_t>(),
+                                                      args[2]->get_data_ptr<const T>(),
+                                                      out[0]->get_data_ptr<T>(),
+                                                      args[0]->get_shape(),
+                                                      args[1]->get_shape(),
+                                                      static_cast<size_t>(axis));
+            }
+            else
+            {
+                throw ngraph_error("Unexpected type");
+            }
+            break;
+        }
         case OP_TYPEID::Select_v0:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
@@ -2206,7 +3157,6 @@ protected:
         case OP_TYPEID::AvgPool_v1:
         case OP_TYPEID::BatchMatMulTranspose_v0:
         case OP_TYPEID::BatchToSpace_v1:
-        case OP_TYPEID::BinaryConvolution_v1:
         case OP_TYPEID::Broadcast_v1:
         case OP_TYPEID::Broadcast_v3:
         case OP_TYPEID::Bucketize_v3:
@@ -2218,23 +3168,15 @@ protected:
         case OP_TYPEID::ConvolutionBiasBackpropFiltersBias_v0:
         case OP_TYPEID::CrossEntropy_v0:
         case OP_TYPEID::CrossEntropyBackprop_v0:
-        case OP_TYPEID::CTCGreedyDecoder_v0:
-        case OP_TYPEID::DeformableConvolution_v1:
-        case OP_TYPEID::DeformablePSROIPooling_v1:
         case OP_TYPEID::DepthToSpace_v0:
-        case OP_TYPEID::DetectionOutput_v0:
         case OP_TYPEID::DynBroadcast_v0:
         case OP_TYPEID::DynPad_v0:
         case OP_TYPEID::DynReplaceSlice_v0:
         case OP_TYPEID::Elu_v0:
-        case OP_TYPEID::EmbeddingBagOffsetsSum_v3:
-        case OP_TYPEID::EmbeddingBagPackedSum_v3:
-        case OP_TYPEID::EmbeddingSegmentsSum_v3:
         case OP_TYPEID::ExtractImagePatches_v3:
         case OP_TYPEID::FakeQuantize_v0:
         case OP_TYPEID::FloorMod_v1:
         case OP_TYPEID::Gather_v1:
-        case OP_TYPEID::GatherTree_v1:
         case OP_TYPEID::Gelu_v0:
         case OP_TYPEID::GeluBackpropFactor_v0:
         case OP_TYPEID::Gemm_v0:
@@ -2246,8 +3188,6 @@ protected:
         case OP_TYPEID::GroupConvolutionBackpropFilters_v0:
         case OP_TYPEID::GRUCell_v3:
         case OP_TYPEID::HardSigmoid_v0:
-        case OP_TYPEID::Interpolate_v0:
-        case OP_TYPEID::Interpolate_v3:
         case OP_TYPEID::LayerNorm_v0:
         case OP_TYPEID::LayerNormBackprop_v0:
         case OP_TYPEID::LSTMCell_v0:
@@ -2255,8 +3195,6 @@ protected:
         case OP_TYPEID::MaxPool_v1:
         case OP_TYPEID::Mod_v1:
         case OP_TYPEID::MVN_v0:
-        case OP_TYPEID::NonMaxSuppression_v1:
-        case OP_TYPEID::NonMaxSuppression_v3:
         case OP_TYPEID::NonZero_v3:
         case OP_TYPEID::NormalizeL2_v0:
         case OP_TYPEID::OneHot_v1:
@@ -2267,18 +3205,12 @@ protected:
         case OP_TYPEID::PriorBox_v0:
         case OP_TYPEID::PriorBoxClustered_v0:
         case OP_TYPEID::Proposal_v0:
-        case OP_TYPEID::PSROIPooling_v0:
         case OP_TYPEID::RegionYolo_v0:
         case OP_TYPEID::ReorgYolo_v0:
         case OP_TYPEID::Reverse_v1:
         case OP_TYPEID::RNNCell_v0:
-        case OP_TYPEID::ROIAlign_v3:
-        case OP_TYPEID::ROIPooling_v0:
         case OP_TYPEID::ScalarConstantLike_v0:
         case OP_TYPEID::ScaleShift_v0:
-        case OP_TYPEID::ScatterElementsUpdate_v3:
-        case OP_TYPEID::ScatterND_v0:
-        case OP_TYPEID::ScatterUpdate_v3:
         case OP_TYPEID::Select_v1:
         case OP_TYPEID::Selu_v0:
         case OP_TYPEID::ShuffleChannels_v0:
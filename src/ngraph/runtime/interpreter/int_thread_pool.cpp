@@ -0,0 +1,141 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <exception>
+
+#include "ngraph/runtime/interpreter/int_thread_pool.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::interpreter::INTThreadPool::INTThreadPool(size_t num_threads)
+{
+    for (size_t i = 1; i < num_threads; i++)
+    {
+        m_threads.emplace_back(&INTThreadPool::worker, this);
+    }
+}
+
+runtime::interpreter::INTThreadPool::~INTThreadPool()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_task_available.notify_all();
+    for (thread& t : m_threads)
+    {
+        t.join();
+    }
+}
+
+void runtime::interpreter::INTThreadPool::worker()
+{
+    while (true)
+    {
+        function<void()> task;
+        {
+            unique_lock<mutex> lock(m_mutex);
+            m_task_available.wait(lock, [this]() { return m_stop || !m_tasks.empty(); });
+            if (m_tasks.empty())
+            {
+                return;
+            }
+            task = move(m_tasks.front());
+            m_tasks.pop_front();
+        }
+        task();
+    }
+}
+
+bool runtime::interpreter::INTThreadPool::run_pending_task()
+{
+    function<void()> task;
+    {
+        lock_guard<mutex> lock(m_mutex);
+        if (m_tasks.empty())
+        {
+            return false;
+        }
+        task = move(m_tasks.front());
+        m_tasks.pop_front();
+    }
+    task();
+    return true;
+}
+
+void runtime::interpreter::INTThreadPool::parallel_for(size_t count,
+                                                       const function<void(size_t, size_t)>& f)
+{
+    size_t num_chunks = min(count, get_num_threads());
+    if (num_chunks <= 1)
+    {
+        if (count > 0)
+        {
+            f(0, count);
+        }
+        return;
+    }
+
+    mutex join_mutex;
+    condition_variable join_done;
+    size_t pending = num_chunks - 1;
+    exception_ptr error;
+    auto run_chunk = [&](size_t chunk) {
+        try
+        {
+            f(chunk * count / num_chunks, (chunk + 1) * count / num_chunks);
+        }
+        catch (...)
+        {
+            lock_guard<mutex> lock(join_mutex);
+            if (!error)
+            {
+                error = current_exception();
+            }
+        }
+    };
+
+    {
+        lock_guard<mutex> lock(m_mutex);
+        for (size_t chunk = 1; chunk < num_chunks; chunk++)
+        {
+            m_tasks.push_back([&, chunk]() {
+                run_chunk(chunk);
+                lock_guard<mutex> lock(join_mutex);
+                if (--pending == 0)
+                {
+                    join_done.notify_all();
+                }
+            });
+        }
+    }
+    m_task_available.notify_all();
+
+    run_chunk(0);
+    while (run_pending_task())
+    {
+    }
+    {
+        unique_lock<mutex> lock(join_mutex);
+        join_done.wait(lock, [&]() { return pending == 0; });
+    }
+    if (error)
+    {
+        rethrow_exception(error);
+    }
+}
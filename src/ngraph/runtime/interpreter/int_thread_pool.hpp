@@ -0,0 +1,69 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ngraph/runtime/interpreter/int_backend_visibility.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace interpreter
+        {
+            class INTThreadPool;
+        }
+    }
+}
+
+/// \brief Fixed set of threads running the partitions of a reference kernel
+///
+/// The thread calling parallel_for runs one partition itself and helps with queued ones while
+/// it waits, so concurrent calls from several executables sharing a pool cannot deadlock.
+class INTERPRETER_BACKEND_API ngraph::runtime::interpreter::INTThreadPool
+{
+public:
+    /// \brief Starts num_threads - 1 workers, the caller of parallel_for being the last one
+    explicit INTThreadPool(size_t num_threads);
+    INTThreadPool(const INTThreadPool&) = delete;
+    INTThreadPool& operator=(const INTThreadPool&) = delete;
+    ~INTThreadPool();
+
+    size_t get_num_threads() const { return m_threads.size() + 1; }
+
+    /// \brief Calls f(begin, end) on contiguous ranges covering [0, count), one per thread at
+    ///        most, and returns when all have finished. The first exception thrown by f is
+    ///        rethrown.
+    void parallel_for(size_t count, const std::function<void(size_t, size_t)>& f);
+
+private:
+    void worker();
+    // Runs one queued task if there is any
+    bool run_pending_task();
+
+    std::vector<std::thread> m_threads;
+    std::deque<std::function<void()>> m_tasks;
+    std::mutex m_mutex;
+    std::condition_variable m_task_available;
+    bool m_stop = false;
+};
@@ -0,0 +1,34 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/memory_footprint.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+ostream& runtime::operator<<(ostream& out, const MemoryFootprint& footprint)
+{
+    out << "constants: " << footprint.constant_bytes << " bytes\n";
+    out << "converted constants: " << footprint.converted_constant_bytes << " bytes\n";
+    out << "activations: " << footprint.activation_bytes_per_context << " bytes per context\n";
+    out << "scratchpads: " << footprint.scratchpad_bytes_per_context << " bytes per context\n";
+    out << "contexts: " << footprint.contexts << "\n";
+    out << "workspaces: " << footprint.workspace_bytes << " bytes\n";
+    out << "code: " << footprint.code_bytes << " bytes\n";
+    out << "total: " << footprint.get_total_bytes() << " bytes"
+        << (footprint.device_memory ? " (device memory except the code)" : "") << "\n";
+    return out;
+}
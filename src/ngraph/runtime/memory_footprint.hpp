@@ -0,0 +1,63 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <ostream>
+
+#include "ngraph/ngraph_visibility.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        /// \brief Memory held by a compiled Executable, see Executable::get_memory_footprint.
+        ///
+        /// Fields a backend does not track are 0. Constants shared with other executables,
+        /// such as those of a CPU backend interning them, are counted by each of them.
+        struct NGRAPH_API MemoryFootprint
+        {
+            /// Constants in the layout the function gives them in
+            size_t constant_bytes = 0;
+            /// Copies of constants converted to the layouts the kernels prefer
+            size_t converted_constant_bytes = 0;
+            /// Intermediate values of one call in flight
+            size_t activation_bytes_per_context = 0;
+            /// Scratch memory of the kernels of one call in flight
+            size_t scratchpad_bytes_per_context = 0;
+            /// Contexts currently holding activations and scratchpads, one per concurrent call
+            size_t contexts = 0;
+            /// Workspaces and kernel arguments kept for the life of the executable
+            size_t workspace_bytes = 0;
+            /// Generated machine code
+            size_t code_bytes = 0;
+            /// True if the bytes other than the code are device rather than host memory
+            bool device_memory = false;
+
+            size_t get_total_bytes() const
+            {
+                return constant_bytes + converted_constant_bytes +
+                       contexts * (activation_bytes_per_context + scratchpad_bytes_per_context) +
+                       workspace_bytes + code_bytes;
+            }
+        };
+
+        /// \brief Writes one field per line
+        NGRAPH_API
+        std::ostream& operator<<(std::ostream& out, const MemoryFootprint& footprint);
+    }
+}
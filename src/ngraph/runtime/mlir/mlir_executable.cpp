@@ -15,9 +15,7 @@
 //*****************************************************************************
 
 #include "ngraph/runtime/mlir/mlir_executable.hpp"
-#include "contrib/mlir/backend/cpu/cpu_backend.hpp"
-#include "contrib/mlir/core/compiler.hpp"
-#include "contrib/mlir/runtime/cpu/cpu_runtime.hpp"
+#include "contrib/mlir/runtime/cpu/cpu_runtime_cache.hpp"
 #include "ngraph/chrome_trace.hpp"
 #include "ngraph/cpio.hpp"
 #include "ngraph/descriptor/layout/dense_tensor_layout.hpp"
@@ -111,18 +109,10 @@ bool runtime::mlir::MlirExecutable::call(const vector<shared_ptr<runtime::Tensor
 {
     event::Duration d1("call", "Interpreter");
 
-    if (m_first_iteration)
+    if (!m_mlir_runtime)
     {
-        ::mlir::MLIRContext& context = m_mlir_runtime.get_context();
-        runtime::ngmlir::MLIRCompiler mlir_compiler(m_function, context);
-        // Compile to NG dialect
-        mlir_compiler.compile();
-        // Grab a context and initialize a CPU backend using same context
-        runtime::ngmlir::MLIRCPUBackend mlir_backend(mlir_compiler.get_module(), context);
-        // Codegen to LLVM dialect
-        mlir_backend.codegen();
-        // Store module into runtime, and invoke.
-        m_mlir_runtime.set_module(mlir_backend.get_module());
+        // Compile the function, or share the runtime of an identical one compiled before
+        m_mlir_runtime = runtime::ngmlir::MLIRCPURuntimeCache::get_runtime(m_function);
     }
 
     std::vector<runtime::ngmlir::MemRefArg> mem_ref_arg_vec;
@@ -155,8 +145,7 @@ bool runtime::mlir::MlirExecutable::call(const vector<shared_ptr<runtime::Tensor
         mem_ref_arg_vec.push_back(mem_ref_arg);
     }
 
-    m_mlir_runtime.run(mem_ref_arg_vec, m_first_iteration);
-    m_first_iteration = false;
+    m_mlir_runtime->run(mem_ref_arg_vec);
 
     return true;
 }
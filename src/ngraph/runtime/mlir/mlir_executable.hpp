@@ -87,8 +87,7 @@ protected:
     std::shared_ptr<Function> m_function;
     NodeVector m_nodes;
     std::unordered_map<const Node*, std::shared_ptr<State>> m_states;
-    runtime::ngmlir::MLIRCPURuntime m_mlir_runtime;
-    bool m_first_iteration = true;
+    std::shared_ptr<runtime::ngmlir::MLIRCPURuntime> m_mlir_runtime;
 
     static OP_TYPEID get_typeid(const Node& node);
 };
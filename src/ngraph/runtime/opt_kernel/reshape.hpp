@@ -16,9 +16,13 @@
 
 #pragma once
 
+#include <algorithm>
+#include <vector>
+
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/runtime/reference/reshape.hpp"
 #include "ngraph/shape.hpp"
+#include "ngraph/util.hpp"
 
 namespace ngraph
 {
@@ -26,230 +30,224 @@ namespace ngraph
     {
         namespace opt_kernel
         {
-            template <typename T>
-            void reshape_in0(const T* in,
-                             T* out,
-                             const Shape& in_shape,
-                             const AxisVector& in_axis_order,
-                             const Shape& out_shape)
-            {
-                *out = *in;
-            }
-
-            template <typename T>
-            void reshape_in1(const T* in,
-                             T* out,
-                             const Shape& in_shape,
-                             const AxisVector& in_axis_order,
-                             const Shape& out_shape)
+            /// \brief A permuted copy reduced to its essentials
+            ///
+            /// Axes of size 1 are dropped and runs of input axes that stay adjacent in the output
+            /// are merged, so e.g. NCHW to NHWC becomes a batch of (C, HW) to (HW, C) transposes.
+            /// The copy is then a loop over "outer" output indices, each of which either copies
+            /// a contiguous row, when the innermost axis is not moved, or transposes a 2D block
+            /// of the two axes that are innermost in the input and the output.
+            struct TransposePlan
             {
-                size_t size[1];
-                size_t in_index[1];
-                size_t* map_index[1];
-                for (size_t i = 0; i < 1; i++)
-                {
-                    size[i] = in_shape[in_axis_order[i]];
-                    map_index[in_axis_order[i]] = &in_index[i];
-                }
-                for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
+                TransposePlan(const Shape& in_shape, const AxisVector& in_axis_order)
                 {
-                    *out++ = in[*map_index[0]];
-                }
-            }
-
-            template <typename T>
-            void reshape_in2(const T* in,
-                             T* out,
-                             const Shape& in_shape,
-                             const AxisVector& in_axis_order,
-                             const Shape& out_shape)
-            {
-                size_t size[2];
-                size_t in_index[2];
-                size_t* map_index[2];
-                for (size_t i = 0; i < 2; i++)
-                {
-                    size[i] = in_shape[in_axis_order[i]];
-                    map_index[in_axis_order[i]] = &in_index[i];
-                }
-                for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
-                {
-                    for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
+                    // Drop axes of size 1
+                    std::vector<size_t> squeezed_axis(in_shape.size());
+                    Shape shape;
+                    for (size_t i = 0; i < in_shape.size(); ++i)
                     {
-                        // clang-format off
-                        *out++ = in[*map_index[0] * in_shape[1] +
-                                    *map_index[1]];
-                        // clang-format on
+                        squeezed_axis[i] = shape.size();
+                        if (in_shape[i] != 1)
+                        {
+                            shape.push_back(in_shape[i]);
+                        }
                     }
-                }
-            }
-
-            template <typename T>
-            void reshape_in3(const T* in,
-                             T* out,
-                             const Shape& in_shape,
-                             const AxisVector& in_axis_order,
-                             const Shape& out_shape)
-            {
-                size_t size[3];
-                size_t in_index[3];
-                size_t* map_index[3];
-                for (size_t i = 0; i < 3; i++)
-                {
-                    size[i] = in_shape[in_axis_order[i]];
-                    map_index[in_axis_order[i]] = &in_index[i];
-                }
-                for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
-                {
-                    for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
+                    // Merge output axes that are consecutive input axes
+                    std::vector<std::pair<size_t, size_t>> runs;
+                    for (auto axis : in_axis_order)
                     {
-                        for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2])
+                        if (in_shape[axis] == 1)
                         {
-                            // clang-format off
-                            *out++ = in[*map_index[0] * in_shape[1] * in_shape[2] +
-                                        *map_index[1] * in_shape[2] +
-                                        *map_index[2]];
-                            // clang-format on
+                            continue;
+                        }
+                        size_t squeezed = squeezed_axis[axis];
+                        if (!runs.empty() && runs.back().second + 1 == squeezed)
+                        {
+                            runs.back().second = squeezed;
+                        }
+                        else
+                        {
+                            runs.push_back({squeezed, squeezed});
+                        }
+                    }
+                    std::vector<size_t> run_starts;
+                    for (auto& run : runs)
+                    {
+                        run_starts.push_back(run.first);
+                    }
+                    std::sort(run_starts.begin(), run_starts.end());
+                    Shape merged_shape(runs.size());
+                    AxisVector order;
+                    for (auto& run : runs)
+                    {
+                        size_t axis =
+                            std::lower_bound(run_starts.begin(), run_starts.end(), run.first) -
+                            run_starts.begin();
+                        order.push_back(axis);
+                        merged_shape[axis] = 1;
+                        for (size_t i = run.first; i <= run.second; ++i)
+                        {
+                            merged_shape[axis] *= shape[i];
                         }
                     }
-                }
-            }
 
-            template <typename T>
-            void reshape_in4(const T* in,
-                             T* out,
-                             const Shape& in_shape,
-                             const AxisVector& in_axis_order,
-                             const Shape& out_shape)
-            {
-                size_t size[4];
-                size_t in_index[4];
-                size_t* map_index[4];
-                for (size_t i = 0; i < 4; i++)
-                {
-                    size[i] = in_shape[in_axis_order[i]];
-                    map_index[in_axis_order[i]] = &in_index[i];
-                }
-                for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
-                {
-                    for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
+                    size_t rank = merged_shape.size();
+                    m_count = shape_size(in_shape);
+                    std::vector<size_t> in_strides(rank);
+                    std::vector<size_t> out_strides(rank);
+                    for (size_t i = rank, in_stride = 1, out_stride = 1; i-- > 0;)
                     {
-                        for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2])
+                        in_strides[i] = in_stride;
+                        in_stride *= merged_shape[i];
+                        out_strides[i] = out_stride;
+                        out_stride *= merged_shape[order[i]];
+                    }
+
+                    if (rank < 2 || order.back() == rank - 1)
+                    {
+                        // Rows along the innermost axis are contiguous in both
+                        m_row_size = rank == 0 ? 1 : merged_shape[rank - 1];
+                        for (size_t i = 0; i + 1 < rank; ++i)
                         {
-                            for (in_index[3] = 0; in_index[3] < size[3]; ++in_index[3])
-                            {
-                                // clang-format off
-                                *out++ =
-                                    in[*map_index[0] * in_shape[1] * in_shape[2] * in_shape[3] +
-                                       *map_index[1] * in_shape[2] * in_shape[3] +
-                                       *map_index[2] * in_shape[3] +
-                                       *map_index[3]];
-                                // clang-format on
-                            }
+                            m_outer_sizes.push_back(merged_shape[order[i]]);
+                            m_outer_in_strides.push_back(in_strides[order[i]]);
+                            m_outer_out_strides.push_back(out_strides[i]);
                         }
+                        return;
                     }
-                }
-            }
 
-            template <typename T>
-            void reshape_in5(const T* in,
-                             T* out,
-                             const Shape& in_shape,
-                             const AxisVector& in_axis_order,
-                             const Shape& out_shape)
-            {
-                size_t size[5];
-                size_t in_index[5];
-                size_t* map_index[5];
-                for (size_t i = 0; i < 5; i++)
-                {
-                    size[i] = in_shape[in_axis_order[i]];
-                    map_index[in_axis_order[i]] = &in_index[i];
-                }
-                for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
-                {
-                    for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
+                    m_tiled = true;
+                    size_t inner_out_axis = order.back();
+                    size_t inner_in_position =
+                        std::find(order.begin(), order.end(), rank - 1) - order.begin();
+                    m_rows = merged_shape[rank - 1];
+                    m_columns = merged_shape[inner_out_axis];
+                    m_in_row_stride = in_strides[inner_out_axis];
+                    m_out_row_stride = out_strides[inner_in_position];
+                    for (size_t i = 0; i + 1 < rank; ++i)
                     {
-                        for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2])
+                        if (i != inner_in_position)
                         {
-                            for (in_index[3] = 0; in_index[3] < size[3]; ++in_index[3])
-                            {
-                                for (in_index[4] = 0; in_index[4] < size[4]; ++in_index[4])
-                                {
-                                    // clang-format off
-                                    *out++ =
-                                        in[*map_index[0] * in_shape[1] * in_shape[2] * in_shape[3] * in_shape[4] +
-                                           *map_index[1] * in_shape[2] * in_shape[3] * in_shape[4] +
-                                           *map_index[2] * in_shape[3] * in_shape[4] +
-                                           *map_index[3] * in_shape[4] +
-                                           *map_index[4]];
-                                    // clang-format on
-                                }
-                            }
+                            m_outer_sizes.push_back(merged_shape[order[i]]);
+                            m_outer_in_strides.push_back(in_strides[order[i]]);
+                            m_outer_out_strides.push_back(out_strides[i]);
                         }
                     }
                 }
-            }
 
+                /// \return The number of rows or blocks the copy is made of
+                size_t get_outer_count() const
+                {
+                    return m_count == 0 ? 0 : shape_size(m_outer_sizes);
+                }
+
+                size_t m_count;
+                std::vector<size_t> m_outer_sizes;
+                std::vector<size_t> m_outer_in_strides;
+                std::vector<size_t> m_outer_out_strides;
+                bool m_tiled{false};
+                // Contiguous rows
+                size_t m_row_size{0};
+                // Transposed blocks: m_rows input rows of m_columns, written as m_columns
+                // output rows of m_rows
+                size_t m_rows{0};
+                size_t m_columns{0};
+                size_t m_in_row_stride{0};
+                size_t m_out_row_stride{0};
+            };
+
+            /// \brief Copies the rows or blocks [begin, end) of a plan
             template <typename T>
-            void reshape_in6(const T* in,
-                             T* out,
-                             const Shape& in_shape,
-                             const AxisVector& in_axis_order,
-                             const Shape& out_shape)
+            void transpose(
+                const T* in, T* out, const TransposePlan& plan, size_t begin, size_t end)
             {
-                size_t size[6];
-                size_t in_index[6];
-                size_t* map_index[6];
-                for (size_t i = 0; i < 6; i++)
+                if (begin >= end)
+                {
+                    return;
+                }
+                const size_t rank = plan.m_outer_sizes.size();
+                std::vector<size_t> index(rank);
+                size_t in_offset = 0;
+                size_t out_offset = 0;
+                for (size_t i = rank, rest = begin; i-- > 0;)
                 {
-                    size[i] = in_shape[in_axis_order[i]];
-                    map_index[in_axis_order[i]] = &in_index[i];
+                    index[i] = rest % plan.m_outer_sizes[i];
+                    rest /= plan.m_outer_sizes[i];
+                    in_offset += index[i] * plan.m_outer_in_strides[i];
+                    out_offset += index[i] * plan.m_outer_out_strides[i];
                 }
-                for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
+                // Tiles of a cache line or so square stay in cache for reads and writes
+                const size_t tile = std::max<size_t>(64 / sizeof(T), 4);
+                for (size_t k = begin; k < end; ++k)
                 {
-                    for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
+                    const T* src = in + in_offset;
+                    T* dst = out + out_offset;
+                    if (!plan.m_tiled)
                     {
-                        for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2])
+                        std::copy(src, src + plan.m_row_size, dst);
+                    }
+                    else
+                    {
+                        for (size_t r0 = 0; r0 < plan.m_rows; r0 += tile)
                         {
-                            for (in_index[3] = 0; in_index[3] < size[3]; ++in_index[3])
+                            size_t r1 = std::min(r0 + tile, plan.m_rows);
+                            for (size_t c0 = 0; c0 < plan.m_columns; c0 += tile)
                             {
-                                for (in_index[4] = 0; in_index[4] < size[4]; ++in_index[4])
+                                size_t c1 = std::min(c0 + tile, plan.m_columns);
+                                for (size_t r = r0; r < r1; ++r)
                                 {
-                                    for (in_index[5] = 0; in_index[5] < size[5]; ++in_index[5])
+                                    T* dst_row = dst + r * plan.m_out_row_stride;
+                                    for (size_t c = c0; c < c1; ++c)
                                     {
-                                        // clang-format off
-                                        *out++ = in[*map_index[0] * in_shape[1] * in_shape[2] * in_shape[3] * in_shape[4] * in_shape[5] +
-                                                    *map_index[1] * in_shape[2] * in_shape[3] * in_shape[4] * in_shape[5] +
-                                                    *map_index[2] * in_shape[3] * in_shape[4] * in_shape[5] +
-                                                    *map_index[3] * in_shape[4] * in_shape[5] +
-                                                    *map_index[4] * in_shape[5] +
-                                                    *map_index[5]];
-                                        // clang-format on
+                                        dst_row[c] = src[c * plan.m_in_row_stride + r];
                                     }
                                 }
                             }
                         }
                     }
+                    for (size_t i = rank; i-- > 0;)
+                    {
+                        in_offset += plan.m_outer_in_strides[i];
+                        out_offset += plan.m_outer_out_strides[i];
+                        if (++index[i] < plan.m_outer_sizes[i])
+                        {
+                            break;
+                        }
+                        in_offset -= plan.m_outer_sizes[i] * plan.m_outer_in_strides[i];
+                        out_offset -= plan.m_outer_sizes[i] * plan.m_outer_out_strides[i];
+                        index[i] = 0;
+                    }
                 }
             }
+
+            /// \brief Permuted copy of in to out
+            ///
+            /// \param num_threads Number of threads the rows or blocks of the copy are split
+            ///        across
             template <typename T>
             void reshape(const T* in,
                          T* out,
                          const Shape& in_shape,
                          const AxisVector& in_axis_order,
-                         const Shape& out_shape)
+                         const Shape& /* out_shape */,
+                         size_t num_threads = 1)
             {
-                switch (in_shape.size())
+                TransposePlan plan(in_shape, in_axis_order);
+                size_t outer_count = plan.get_outer_count();
+                size_t parts = std::min(num_threads, outer_count);
+                if (parts > 1)
+                {
+                    parallel_for(parts, parts, [&](size_t part) {
+                        transpose(in,
+                                  out,
+                                  plan,
+                                  outer_count * part / parts,
+                                  outer_count * (part + 1) / parts);
+                    });
+                }
+                else
                 {
-                case 0: reshape_in0<T>(in, out, in_shape, in_axis_order, out_shape); break;
-                case 1: reshape_in1<T>(in, out, in_shape, in_axis_order, out_shape); break;
-                case 2: reshape_in2<T>(in, out, in_shape, in_axis_order, out_shape); break;
-                case 3: reshape_in3<T>(in, out, in_shape, in_axis_order, out_shape); break;
-                case 4: reshape_in4<T>(in, out, in_shape, in_axis_order, out_shape); break;
-                case 5: reshape_in5<T>(in, out, in_shape, in_axis_order, out_shape); break;
-                case 6: reshape_in6<T>(in, out, in_shape, in_axis_order, out_shape); break;
-                default: reference::reshape(in, out, in_shape, in_axis_order, out_shape); break;
+                    transpose(in, out, plan, 0, outer_count);
                 }
             }
         }
@@ -0,0 +1,190 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/runtime/reference/softmax.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/util.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace opt_kernel
+        {
+            /// \brief Softmax viewed as [outer, reduced, inner]
+            ///
+            /// Axes of size 1 are ignored and adjacent axes are merged, which brings any set of
+            /// softmax axes that are contiguous, once size 1 axes are dropped, to that form.
+            /// Other axis sets are not supported.
+            struct SoftmaxPlan
+            {
+                SoftmaxPlan(const Shape& shape, const AxisSet& axes)
+                {
+                    m_count = shape_size(shape);
+                    // 0 before the reduced axes, 1 within them and 2 after them
+                    int part = 0;
+                    for (size_t i = 0; i < shape.size(); ++i)
+                    {
+                        if (shape[i] == 1)
+                        {
+                            continue;
+                        }
+                        bool reduced = axes.count(i) > 0;
+                        if (reduced && part == 2)
+                        {
+                            m_supported = false;
+                        }
+                        part = reduced ? 1 : (part == 0 ? 0 : 2);
+                        (part == 0 ? m_outer : (part == 1 ? m_reduced : m_inner)) *= shape[i];
+                    }
+                }
+
+                /// \return The number of independent pieces of work
+                size_t get_work_count() const
+                {
+                    return m_count == 0 ? 0 : m_outer * ((m_inner + chunk_size - 1) / chunk_size);
+                }
+
+                /// \brief Inner positions handled together, so their running maxima and sums
+                ///        stay in registers or L1
+                static constexpr size_t chunk_size = 64;
+                size_t m_count;
+                size_t m_outer{1};
+                size_t m_reduced{1};
+                size_t m_inner{1};
+                bool m_supported{true};
+            };
+
+            /// \brief Softmax, or log-softmax if log is set, of the pieces [begin, end) of a plan
+            ///
+            /// The first pass keeps a running maximum and a sum of exponentials rescaled
+            /// whenever the maximum grows, which needs one exponential per element. The second
+            /// pass writes the results, so every element is read twice and written once.
+            template <typename T>
+            void softmax(
+                const T* arg, T* out, const SoftmaxPlan& plan, bool log, size_t begin, size_t end)
+            {
+                using Acc =
+                    typename std::conditional<std::is_same<T, double>::value, double, float>::type;
+                const size_t chunk = SoftmaxPlan::chunk_size;
+                const size_t chunks = (plan.m_inner + chunk - 1) / chunk;
+                Acc max[SoftmaxPlan::chunk_size];
+                Acc sum[SoftmaxPlan::chunk_size];
+                for (size_t piece = begin; piece < end; ++piece)
+                {
+                    size_t outer = piece / chunks;
+                    size_t inner_begin = (piece % chunks) * chunk;
+                    size_t width = std::min(chunk, plan.m_inner - inner_begin);
+                    size_t base = outer * plan.m_reduced * plan.m_inner + inner_begin;
+
+                    const T* row = arg + base;
+                    for (size_t i = 0; i < width; ++i)
+                    {
+                        max[i] = static_cast<Acc>(row[i]);
+                        sum[i] = 1;
+                    }
+                    for (size_t r = 1; r < plan.m_reduced; ++r)
+                    {
+                        row = arg + base + r * plan.m_inner;
+                        for (size_t i = 0; i < width; ++i)
+                        {
+                            Acc x = static_cast<Acc>(row[i]);
+                            Acc d = x - max[i];
+                            Acc e = std::exp(-std::abs(d));
+                            sum[i] = d > 0 ? sum[i] * e + 1 : sum[i] + e;
+                            max[i] = d > 0 ? x : max[i];
+                        }
+                    }
+
+                    for (size_t i = 0; i < width; ++i)
+                    {
+                        // Folded into the per-element offset or scale of the second pass
+                        sum[i] = log ? max[i] + std::log(sum[i]) : 1 / sum[i];
+                    }
+                    for (size_t r = 0; r < plan.m_reduced; ++r)
+                    {
+                        row = arg + base + r * plan.m_inner;
+                        T* out_row = out + base + r * plan.m_inner;
+                        if (log)
+                        {
+                            for (size_t i = 0; i < width; ++i)
+                            {
+                                out_row[i] = static_cast<T>(static_cast<Acc>(row[i]) - sum[i]);
+                            }
+                        }
+                        else
+                        {
+                            for (size_t i = 0; i < width; ++i)
+                            {
+                                out_row[i] = static_cast<T>(
+                                    std::exp(static_cast<Acc>(row[i]) - max[i]) * sum[i]);
+                            }
+                        }
+                    }
+                }
+            }
+
+            /// \brief Softmax, or log-softmax if log is set, over axes of shape
+            ///
+            /// \param num_threads Number of threads the non-reduced positions are split across
+            template <typename T>
+            void softmax(const T* arg,
+                         T* out,
+                         const Shape& shape,
+                         const AxisSet& axes,
+                         bool log = false,
+                         size_t num_threads = 1)
+            {
+                SoftmaxPlan plan(shape, axes);
+                if (!plan.m_supported)
+                {
+                    reference::softmax(arg, out, shape, axes);
+                    if (log)
+                    {
+                        std::transform(out, out + plan.m_count, out, [](T x) {
+                            return static_cast<T>(std::log(x));
+                        });
+                    }
+                    return;
+                }
+                size_t work_count = plan.get_work_count();
+                size_t parts = std::min(num_threads, work_count);
+                if (parts > 1)
+                {
+                    parallel_for(parts, parts, [&](size_t part) {
+                        softmax(arg,
+                                out,
+                                plan,
+                                log,
+                                work_count * part / parts,
+                                work_count * (part + 1) / parts);
+                    });
+                }
+                else
+                {
+                    softmax(arg, out, plan, log, 0, work_count);
+                }
+            }
+        }
+    }
+}
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <string>
 
 #include "ngraph/node.hpp"
@@ -41,9 +42,45 @@ namespace ngraph
                 return m_call_count == 0 ? 0 : m_total_microseconds / m_call_count;
             }
             size_t call_count() const { return m_call_count; }
+            /// \brief Average number of ops running, this one included, when the op started.
+            ///        Only collected by backends that run ops concurrently, 0 otherwise.
+            double concurrency() const
+            {
+                return m_call_count == 0 ? 0 : double(m_total_concurrency) / m_call_count;
+            }
+            /// \brief Average hardware counts of a call of the op. Only collected by backends
+            ///        that read hardware counters, and only when asked to, 0 otherwise.
+            uint64_t cycles() const
+            {
+                return m_call_count == 0 ? 0 : m_total_cycles / m_call_count;
+            }
+            uint64_t instructions() const
+            {
+                return m_call_count == 0 ? 0 : m_total_instructions / m_call_count;
+            }
+            uint64_t llc_misses() const
+            {
+                return m_call_count == 0 ? 0 : m_total_llc_misses / m_call_count;
+            }
+            double instructions_per_cycle() const
+            {
+                return m_total_cycles == 0 ? 0 : double(m_total_instructions) / m_total_cycles;
+            }
+            /// \brief Memory bandwidth in bytes per second estimated from the last level cache
+            ///        misses, one cache line each
+            double estimated_memory_bandwidth() const
+            {
+                return m_total_microseconds == 0
+                           ? 0
+                           : double(m_total_llc_misses) * 64 * 1e6 / m_total_microseconds;
+            }
             std::shared_ptr<const Node> m_node;
             size_t m_total_microseconds;
             size_t m_call_count;
+            size_t m_total_concurrency{0};
+            uint64_t m_total_cycles{0};
+            uint64_t m_total_instructions{0};
+            uint64_t m_total_llc_misses{0};
         };
     }
 }
@@ -0,0 +1,120 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <exception>
+#include <future>
+
+#include "ngraph/check.hpp"
+#include "ngraph/runtime/pipeline.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::Pipeline::Pipeline(const shared_ptr<Executable>& executable, size_t depth)
+    : m_executable(executable)
+{
+    if (depth == 0)
+    {
+        depth = m_executable->get_preferred_pipeline_depth();
+    }
+    NGRAPH_CHECK(depth > 0, "Pipeline depth must be positive");
+    m_inputs.resize(depth);
+    m_outputs.resize(depth);
+    for (size_t i = 0; i < m_executable->get_parameters().size(); i++)
+    {
+        auto tensors = m_executable->create_input_tensor(i, depth);
+        for (size_t stage = 0; stage < depth; stage++)
+        {
+            m_inputs[stage].push_back(tensors.at(stage));
+        }
+    }
+    for (size_t i = 0; i < m_executable->get_results().size(); i++)
+    {
+        auto tensors = m_executable->create_output_tensor(i, depth);
+        for (size_t stage = 0; stage < depth; stage++)
+        {
+            m_outputs[stage].push_back(tensors.at(stage));
+        }
+    }
+}
+
+size_t runtime::Pipeline::run(const FillFunction& fill, const DrainFunction& drain)
+{
+    size_t depth = get_depth();
+    vector<future<bool>> pending(depth);
+    exception_ptr error;
+
+    // Waits for the iteration on `stage` and drains it, remembering the first failure
+    auto complete = [&](size_t iteration) {
+        size_t stage = iteration % depth;
+        try
+        {
+            pending[stage].get();
+            if (!error)
+            {
+                drain(iteration, m_outputs[stage]);
+            }
+        }
+        catch (...)
+        {
+            if (!error)
+            {
+                error = current_exception();
+            }
+        }
+    };
+
+    size_t iteration = 0;
+    while (!error)
+    {
+        size_t stage = iteration % depth;
+        if (pending[stage].valid())
+        {
+            complete(iteration - depth);
+            if (error)
+            {
+                break;
+            }
+        }
+        try
+        {
+            if (!fill(iteration, m_inputs[stage]))
+            {
+                break;
+            }
+            pending[stage] = m_executable->call_async(m_outputs[stage], m_inputs[stage]);
+        }
+        catch (...)
+        {
+            error = current_exception();
+            break;
+        }
+        iteration++;
+    }
+
+    for (size_t i = iteration > depth ? iteration - depth : 0; i < iteration; i++)
+    {
+        if (pending[i % depth].valid())
+        {
+            complete(i);
+        }
+    }
+    if (error)
+    {
+        rethrow_exception(error);
+    }
+    return iteration;
+}
@@ -0,0 +1,76 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "ngraph/runtime/executable.hpp"
+#include "ngraph/runtime/tensor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class Pipeline;
+    }
+}
+
+/// \brief Streams iterations of an Executable through a ring of pipeline stages.
+///
+/// Each stage owns the input and output tensors created by
+/// Executable::create_input_tensor(index, depth) and create_output_tensor(index, depth).
+/// Iteration i runs on stage i % depth: while it executes through Executable::call_async the
+/// caller fills the inputs of the following stages and drains the outputs of the stage that
+/// completed before, so input copies overlap with compute.
+class NGRAPH_API ngraph::runtime::Pipeline
+{
+public:
+    /// Writes the inputs of `iteration`, returning false to end the stream instead
+    using FillFunction =
+        std::function<bool(size_t iteration, const std::vector<std::shared_ptr<Tensor>>& inputs)>;
+    /// Reads the outputs of `iteration`, called in iteration order
+    using DrainFunction =
+        std::function<void(size_t iteration, const std::vector<std::shared_ptr<Tensor>>& outputs)>;
+
+    /// \param executable The executable to run
+    /// \param depth Number of stages, or 0 for executable->get_preferred_pipeline_depth()
+    Pipeline(const std::shared_ptr<Executable>& executable, size_t depth = 0);
+
+    /// \brief Runs iterations until `fill` returns false.
+    ///
+    /// Returns once every started iteration has been drained. If an iteration fails its
+    /// exception is rethrown after the iterations already started have completed.
+    /// \returns The number of iterations run
+    size_t run(const FillFunction& fill, const DrainFunction& drain);
+
+    size_t get_depth() const { return m_inputs.size(); }
+    const std::vector<std::shared_ptr<Tensor>>& get_inputs(size_t stage) const
+    {
+        return m_inputs.at(stage);
+    }
+    const std::vector<std::shared_ptr<Tensor>>& get_outputs(size_t stage) const
+    {
+        return m_outputs.at(stage);
+    }
+
+private:
+    std::shared_ptr<Executable> m_executable;
+    std::vector<std::vector<std::shared_ptr<Tensor>>> m_inputs;
+    std::vector<std::vector<std::shared_ptr<Tensor>>> m_outputs;
+};
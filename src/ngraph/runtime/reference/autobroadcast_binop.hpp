@@ -16,7 +16,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
+#include <vector>
 
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/op/util/attr_types.hpp"
@@ -28,6 +30,137 @@ namespace ngraph
     {
         namespace reference
         {
+            namespace detail
+            {
+                /// \brief Applies elementwise_functor with NUMPY broadcasting.
+                ///
+                /// Both shapes are left padded with ones, and runs of adjacent axes along which
+                /// the same arguments are broadcast are merged. For example a [2, 3, 4] tensor and
+                /// a [4] bias become a [6, 4] tensor and a [1, 4] bias, and identical shapes become
+                /// one axis. The innermost merged axis is then a unit stride loop over both
+                /// arguments, or over one argument and a repeated element of the other, while
+                /// the outer axes are walked with running offsets instead of coordinates.
+                template <typename T, typename U, typename Functor>
+                void numpy_autobroadcast_binop(const T* arg0,
+                                               const T* arg1,
+                                               U* out,
+                                               const Shape& arg0_shape,
+                                               const Shape& arg1_shape,
+                                               Functor elementwise_functor)
+                {
+                    enum class Broadcast
+                    {
+                        NONE,
+                        ARG0,
+                        ARG1
+                    };
+
+                    size_t rank = std::max(arg0_shape.size(), arg1_shape.size());
+                    size_t arg0_padding = rank - arg0_shape.size();
+                    size_t arg1_padding = rank - arg1_shape.size();
+                    std::vector<size_t> dims;
+                    std::vector<Broadcast> broadcasts;
+                    size_t output_size = 1;
+                    for (size_t i = 0; i < rank; i++)
+                    {
+                        size_t arg0_dim = i < arg0_padding ? 1 : arg0_shape[i - arg0_padding];
+                        size_t arg1_dim = i < arg1_padding ? 1 : arg1_shape[i - arg1_padding];
+                        size_t dim = arg0_dim == 1 ? arg1_dim : arg0_dim;
+                        output_size *= dim;
+                        if (dim == 1)
+                        {
+                            continue;
+                        }
+                        Broadcast broadcast =
+                            arg0_dim == 1 ? Broadcast::ARG0
+                                          : (arg1_dim == 1 ? Broadcast::ARG1 : Broadcast::NONE);
+                        if (!dims.empty() && broadcasts.back() == broadcast)
+                        {
+                            dims.back() *= dim;
+                        }
+                        else
+                        {
+                            dims.push_back(dim);
+                            broadcasts.push_back(broadcast);
+                        }
+                    }
+                    if (output_size == 0)
+                    {
+                        return;
+                    }
+                    if (dims.empty())
+                    {
+                        out[0] = elementwise_functor(arg0[0], arg1[0]);
+                        return;
+                    }
+
+                    // Element strides of each argument along the merged axes, 0 when broadcast
+                    size_t outer_rank = dims.size() - 1;
+                    std::vector<size_t> arg0_strides(outer_rank);
+                    std::vector<size_t> arg1_strides(outer_rank);
+                    size_t arg0_stride = broadcasts.back() == Broadcast::ARG0 ? 1 : dims.back();
+                    size_t arg1_stride = broadcasts.back() == Broadcast::ARG1 ? 1 : dims.back();
+                    for (size_t i = outer_rank; i-- > 0;)
+                    {
+                        arg0_strides[i] = broadcasts[i] == Broadcast::ARG0 ? 0 : arg0_stride;
+                        arg1_strides[i] = broadcasts[i] == Broadcast::ARG1 ? 0 : arg1_stride;
+                        arg0_stride *= broadcasts[i] == Broadcast::ARG0 ? 1 : dims[i];
+                        arg1_stride *= broadcasts[i] == Broadcast::ARG1 ? 1 : dims[i];
+                    }
+
+                    size_t inner_size = dims.back();
+                    std::vector<size_t> counter(outer_rank, 0);
+                    size_t arg0_offset = 0;
+                    size_t arg1_offset = 0;
+                    for (size_t out_offset = 0; out_offset < output_size; out_offset += inner_size)
+                    {
+                        const T* a = arg0 + arg0_offset;
+                        const T* b = arg1 + arg1_offset;
+                        U* c = out + out_offset;
+                        switch (broadcasts.back())
+                        {
+                        case Broadcast::NONE:
+                            for (size_t i = 0; i < inner_size; i++)
+                            {
+                                c[i] = elementwise_functor(a[i], b[i]);
+                            }
+                            break;
+                        case Broadcast::ARG0:
+                        {
+                            const T a0 = a[0];
+                            for (size_t i = 0; i < inner_size; i++)
+                            {
+                                c[i] = elementwise_functor(a0, b[i]);
+                            }
+                            break;
+                        }
+                        case Broadcast::ARG1:
+                        {
+                            const T b0 = b[0];
+                            for (size_t i = 0; i < inner_size; i++)
+                            {
+                                c[i] = elementwise_functor(a[i], b0);
+                            }
+                            break;
+                        }
+                        }
+
+                        for (size_t i = outer_rank; i-- > 0;)
+                        {
+                            arg0_offset += arg0_strides[i];
+                            arg1_offset += arg1_strides[i];
+                            if (++counter[i] < dims[i])
+                            {
+                                break;
+                            }
+                            arg0_offset -= arg0_strides[i] * dims[i];
+                            arg1_offset -= arg1_strides[i] * dims[i];
+                            counter[i] = 0;
+                        }
+                    }
+                }
+            }
+
             /// \brief Helper function to implement autobroadcasting elementwise binop references.
             ///
             /// \tparam T Element type of the input tensors.
@@ -63,106 +196,34 @@ namespace ngraph
                     }
                     break;
                 case op::AutoBroadcastType::NUMPY:
-                    // We'll be using CoordinateTransform to handle the broadcasting. The general
-                    // procedure is as follows:
-                    //
-                    // (1) Left pad the shorter of the two shapes with ones.
-                    // (2) Squeeze (remove ones from) both shapes, and record the squeezed axis
-                    //     indices.
-                    // (3) Using CoordinateTransform, broadcast both args to the final output
-                    //     shape. The "broadcasted axes" will be those that were squeezed in step
-                    //     2.
-                    //
                     // Example:
                     //
-                    //    Input shape->Padded shape->Squeezed Shape/Squeezed Axes
-                    //    -----------  ------------  ----------------------------
-                    // a: [ 3, 2, 1]   [ 3, 2, 1]    [ 3, 2   ]     {2}
-                    // b: [    1, 6]   [ 1, 1, 6]    [       6]     {0,1}
+                    //    Input shape->Padded shape
+                    //    -----------  ------------
+                    // a: [ 3, 2, 1]   [ 3, 2, 1]
+                    // b: [    1, 6]   [ 1, 1, 6]
                     //                   |  |  |
                     //                   v  v  v
                     //                 Output shape
                     //                 ------------
                     //                 [ 3, 2, 6]
-                    {
-                        Shape arg0_padded_shape = arg0_shape;
-                        Shape arg1_padded_shape = arg1_shape;
-
-                        while (arg0_padded_shape.size() < arg1_padded_shape.size())
-                        {
-                            arg0_padded_shape.insert(arg0_padded_shape.begin(), 1);
-                        }
-
-                        while (arg1_padded_shape.size() < arg0_padded_shape.size())
-                        {
-                            arg1_padded_shape.insert(arg1_padded_shape.begin(), 1);
-                        }
-
-                        Shape arg0_squeezed_shape;
-                        Shape arg1_squeezed_shape;
-                        AxisSet arg0_squeezed_axes;
-                        AxisSet arg1_squeezed_axes;
-                        Shape output_shape;
-
-                        for (size_t i = 0; i < arg0_padded_shape.size(); i++)
-                        {
-                            if (arg0_padded_shape[i] == 1)
-                            {
-                                arg0_squeezed_axes.insert(i);
-                            }
-                            else
-                            {
-                                arg0_squeezed_shape.push_back(arg0_padded_shape[i]);
-                            }
-
-                            if (arg1_padded_shape[i] == 1)
-                            {
-                                arg1_squeezed_axes.insert(i);
-                            }
-                            else
-                            {
-                                arg1_squeezed_shape.push_back(arg1_padded_shape[i]);
-                            }
-
-                            output_shape.push_back(arg0_padded_shape[i] == 1
-                                                       ? arg1_padded_shape[i]
-                                                       : arg0_padded_shape[i]);
-                        }
-
-                        CoordinateTransform arg0_transform(arg0_squeezed_shape);
-                        CoordinateTransform arg1_transform(arg1_squeezed_shape);
-                        CoordinateTransform output_transform(output_shape);
-
-                        for (const Coordinate& output_coord : output_transform)
-                        {
-                            Coordinate arg0_coord = reduce(output_coord, arg0_squeezed_axes);
-                            Coordinate arg1_coord = reduce(output_coord, arg1_squeezed_axes);
-                            out[output_transform.index(output_coord)] =
-                                elementwise_functor(arg0[arg0_transform.index(arg0_coord)],
-                                                    arg1[arg1_transform.index(arg1_coord)]);
-                        }
-                    }
+                    detail::numpy_autobroadcast_binop(
+                        arg0, arg1, out, arg0_shape, arg1_shape, elementwise_functor);
                     break;
                 case op::AutoBroadcastType::PDPD:
-                    // We'll be using CoordinateTransform to handle the broadcasting. No need to
-                    // process arg0 and output shape will be the same as arg0. We need to process
-                    // arg1 and the general procedure is as follows:
+                    // No need to process arg0 and output shape will be the same as arg0. arg1 is
+                    // padded to the rank of arg0 and then broadcast the NUMPY way:
                     //
                     // (1) Trim trailing ones from arg1 shape.
                     // (2) Left and right pad arg1 to match arg0 shape. Axis is the index start
                     //     to align between arg0 and arg1.
-                    // (3) Squeeze (remove ones from) arg1 shape, and record the squeezed axis
-                    //     indices.
-                    // (3) Using CoordinateTransform, broadcast arg1 to the final output
-                    //     shape. The "broadcasted axes" will be those that were squeezed in step
-                    //     23.
                     //
                     // Example:
                     //
-                    //    Input shape->   Padded shape->   Squeezed Shape/Squeezed Axes
-                    //    -----------  ------------  ----------------------------
-                    // a: [ 3, 4, 5, 6]   [ 3, 4, 5, 6]    [ 3, 4, 5, 6]
-                    // b: [    4, 5,  ]   [ 1, 4, 5, 1]    [    4, 5   ]     {0,3}
+                    //    Input shape->   Padded shape
+                    //    -----------     ------------
+                    // a: [ 3, 4, 5, 6]   [ 3, 4, 5, 6]
+                    // b: [    4, 5,  ]   [ 1, 4, 5, 1]
                     //                      |  |  |
                     //                      v  v  v
                     //                     Output shape
@@ -192,32 +253,8 @@ namespace ngraph
                             arg1_padded_shape.insert(arg1_padded_shape.end(), 1);
                         }
 
-                        Shape arg1_squeezed_shape;
-                        AxisSet arg1_squeezed_axes;
-
-                        for (size_t i = 0; i < arg0_shape.size(); i++)
-                        {
-                            if (arg1_padded_shape[i] == 1)
-                            {
-                                arg1_squeezed_axes.insert(i);
-                            }
-                            else
-                            {
-                                arg1_squeezed_shape.push_back(arg1_padded_shape[i]);
-                            }
-                        }
-
-                        CoordinateTransform arg0_transform(arg0_shape);
-                        CoordinateTransform arg1_transform(arg1_squeezed_shape);
-                        CoordinateTransform output_transform(arg0_shape);
-
-                        for (const Coordinate& output_coord : output_transform)
-                        {
-                            Coordinate arg1_coord = reduce(output_coord, arg1_squeezed_axes);
-                            out[output_transform.index(output_coord)] =
-                                elementwise_functor(arg0[arg0_transform.index(output_coord)],
-                                                    arg1[arg1_transform.index(arg1_coord)]);
-                        }
+                        detail::numpy_autobroadcast_binop(
+                            arg0, arg1, out, arg0_shape, arg1_padded_shape, elementwise_functor);
                     }
                 }
             }
@@ -0,0 +1,255 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "ngraph/check.hpp"
+#include "ngraph/coordinate_diff.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/strides.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            inline size_t popcount64(uint64_t x)
+            {
+#if defined(__GNUC__) || defined(__clang__)
+                return static_cast<size_t>(__builtin_popcountll(x));
+#else
+                x = x - ((x >> 1) & 0x5555555555555555ULL);
+                x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+                x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+                return static_cast<size_t>((x * 0x0101010101010101ULL) >> 56);
+#endif
+            }
+
+            /// \brief Words of 64 bits holding one bit per channel
+            inline size_t binary_channel_words(size_t channels) { return (channels + 63) / 64; }
+            /// \brief The bit of a value of a binary convolution: 1 for positive values, which
+            ///        stand for 1, and 0 for the others, which stand for -1
+            template <typename T>
+            bool binary_bit(T value)
+            {
+                return value > T(0);
+            }
+
+            /// \brief Packs the channels of [N, C, spatial...] items [begin, end) into
+            ///        [N, spatial..., words], bit c % 64 of word c / 64 holding channel c. An
+            ///        item is one spatial position of one batch element. The unused bits of
+            ///        the last word are 0.
+            template <typename T>
+            void pack_binary_channels(const T* in,
+                                      uint64_t* out,
+                                      size_t channels,
+                                      size_t spatial,
+                                      size_t begin,
+                                      size_t end)
+            {
+                const size_t words = binary_channel_words(channels);
+                for (size_t item = begin; item < end; item++)
+                {
+                    size_t n = item / spatial;
+                    size_t s = item % spatial;
+                    const T* src = in + n * channels * spatial + s;
+                    uint64_t* dst = out + item * words;
+                    for (size_t w = 0; w < words; w++)
+                    {
+                        uint64_t word = 0;
+                        size_t last = std::min(channels, (w + 1) * 64);
+                        for (size_t c = w * 64; c < last; c++)
+                        {
+                            word |= uint64_t(binary_bit(src[c * spatial])) << (c % 64);
+                        }
+                        dst[w] = word;
+                    }
+                }
+            }
+
+            /// \brief The geometry of a binary convolution of up to 3 spatial dimensions, the
+            ///        missing outer ones taken as 1
+            struct BinaryConvolutionGeometry
+            {
+                BinaryConvolutionGeometry(const Shape& data_shape,
+                                          const Shape& filters_shape,
+                                          const Shape& out_shape,
+                                          const Strides& strides,
+                                          const Strides& dilations,
+                                          const CoordinateDiff& pads_begin)
+                {
+                    size_t rank = data_shape.size() - 2;
+                    NGRAPH_CHECK(rank >= 1 && rank <= 3,
+                                 "BinaryConvolution supports 1 to 3 spatial dimensions");
+                    batch = data_shape[0];
+                    channels = data_shape[1];
+                    filters = filters_shape[0];
+                    for (size_t i = 0; i < 3; i++)
+                    {
+                        size_t axis = i + rank - 3;
+                        bool present = i + rank >= 3;
+                        in[i] = present ? data_shape[2 + axis] : 1;
+                        kernel[i] = present ? filters_shape[2 + axis] : 1;
+                        out[i] = present ? out_shape[2 + axis] : 1;
+                        stride[i] = present ? strides[axis] : 1;
+                        dilation[i] = present ? dilations[axis] : 1;
+                        pad[i] = present ? pads_begin[axis] : 0;
+                    }
+                }
+
+                /// \brief The input coordinate along `axis` of output `o` and kernel `k`,
+                ///        negative or past the input in the padding
+                std::ptrdiff_t input_index(size_t axis, size_t o, size_t k) const
+                {
+                    return std::ptrdiff_t(o * stride[axis] + k * dilation[axis]) - pad[axis];
+                }
+                bool is_inside(size_t axis, std::ptrdiff_t i) const
+                {
+                    return i >= 0 && i < std::ptrdiff_t(in[axis]);
+                }
+
+                size_t in_size() const { return in[0] * in[1] * in[2]; }
+                size_t kernel_size() const { return kernel[0] * kernel[1] * kernel[2]; }
+                size_t out_size() const { return out[0] * out[1] * out[2]; }
+                size_t batch;
+                size_t channels;
+                size_t filters;
+                size_t in[3];
+                size_t kernel[3];
+                size_t out[3];
+                size_t stride[3];
+                size_t dilation[3];
+                std::ptrdiff_t pad[3];
+            };
+
+            /// \brief XNOR-popcount convolution of output positions [begin, end), a position
+            ///        being one spatial point of one batch element for all the filters.
+            ///
+            /// `data` and `filters` are packed by pack_binary_channels. Each term is 1 when
+            /// the bits of the data and the filter agree and -1 otherwise, so a window of
+            /// `channels * kernel_size` terms sums to their number less twice the count of
+            /// disagreeing bits. Padding counts as `pad_bit` in every channel.
+            template <typename T>
+            void binary_convolution(const uint64_t* data,
+                                    const uint64_t* filters,
+                                    T* out,
+                                    const BinaryConvolutionGeometry& geometry,
+                                    bool pad_bit,
+                                    size_t begin,
+                                    size_t end)
+            {
+                const auto& g = geometry;
+                const size_t words = binary_channel_words(g.channels);
+                const size_t kernel_size = g.kernel_size();
+                const size_t out_size = g.out_size();
+                const std::ptrdiff_t terms = static_cast<std::ptrdiff_t>(g.channels * kernel_size);
+
+                std::vector<uint64_t> pad(words, 0);
+                for (size_t c = 0; pad_bit && c < g.channels; c++)
+                {
+                    pad[c / 64] |= uint64_t(1) << (c % 64);
+                }
+                // The data words under each kernel position, gathered once for all filters
+                std::vector<const uint64_t*> window(kernel_size);
+                for (size_t position = begin; position < end; position++)
+                {
+                    size_t n = position / out_size;
+                    size_t p = position % out_size;
+                    size_t od = p / (g.out[1] * g.out[2]);
+                    size_t oh = p / g.out[2] % g.out[1];
+                    size_t ow = p % g.out[2];
+                    size_t k = 0;
+                    for (size_t kd = 0; kd < g.kernel[0]; kd++)
+                    {
+                        std::ptrdiff_t id = g.input_index(0, od, kd);
+                        for (size_t kh = 0; kh < g.kernel[1]; kh++)
+                        {
+                            std::ptrdiff_t ih = g.input_index(1, oh, kh);
+                            for (size_t kw = 0; kw < g.kernel[2]; kw++, k++)
+                            {
+                                std::ptrdiff_t iw = g.input_index(2, ow, kw);
+                                bool inside = g.is_inside(0, id) && g.is_inside(1, ih) &&
+                                              g.is_inside(2, iw);
+                                size_t item = ((n * g.in[0] + id) * g.in[1] + ih) * g.in[2] + iw;
+                                window[k] = inside ? data + item * words : pad.data();
+                            }
+                        }
+                    }
+
+                    for (size_t f = 0; f < g.filters; f++)
+                    {
+                        const uint64_t* filter = filters + f * kernel_size * words;
+                        size_t mismatches = 0;
+                        for (size_t k = 0; k < kernel_size; k++)
+                        {
+                            const uint64_t* d = window[k];
+                            const uint64_t* w = filter + k * words;
+                            for (size_t i = 0; i < words; i++)
+                            {
+                                mismatches += popcount64(d[i] ^ w[i]);
+                            }
+                        }
+                        out[(n * g.filters + f) * out_size + p] =
+                            static_cast<T>(terms - 2 * static_cast<std::ptrdiff_t>(mismatches));
+                    }
+                }
+            }
+
+            /// \brief BinaryConvolution of [N, C, spatial...] `data` with [O, C, kernel...]
+            ///        `filters` in the XNOR_POPCOUNT mode, packing both first
+            template <typename T, typename F>
+            void binary_convolution(const T* data,
+                                    const F* filters,
+                                    T* out,
+                                    const Shape& data_shape,
+                                    const Shape& filters_shape,
+                                    const Shape& out_shape,
+                                    const Strides& strides,
+                                    const Strides& dilations,
+                                    const CoordinateDiff& pads_begin,
+                                    float pad_value)
+            {
+                BinaryConvolutionGeometry geometry(
+                    data_shape, filters_shape, out_shape, strides, dilations, pads_begin);
+                const size_t words = binary_channel_words(geometry.channels);
+                size_t data_items = geometry.batch * geometry.in_size();
+                size_t filter_items = geometry.filters * geometry.kernel_size();
+                std::vector<uint64_t> packed_data(data_items * words);
+                std::vector<uint64_t> packed_filters(filter_items * words);
+                pack_binary_channels(
+                    data, packed_data.data(), geometry.channels, geometry.in_size(), 0, data_items);
+                pack_binary_channels(filters,
+                                     packed_filters.data(),
+                                     geometry.channels,
+                                     geometry.kernel_size(),
+                                     0,
+                                     filter_items);
+                binary_convolution(packed_data.data(),
+                                   packed_filters.data(),
+                                   out,
+                                   geometry,
+                                   binary_bit(pad_value),
+                                   0,
+                                   geometry.batch * geometry.out_size());
+            }
+        }
+    }
+}
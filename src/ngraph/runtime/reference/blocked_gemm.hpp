@@ -0,0 +1,282 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            namespace detail
+            {
+                // Register tile of the micro kernel, and the cache blocking of the M, K and N
+                // dimensions. A packed MC x KC panel of A is sized for L2, and a KC x NR sliver
+                // of the packed B panel stays in L1 while the micro kernel walks the A panel.
+                constexpr size_t gemm_mr = 4;
+                constexpr size_t gemm_nr = 8;
+                constexpr size_t gemm_mc = 64;
+                constexpr size_t gemm_kc = 256;
+                constexpr size_t gemm_nc = 512;
+
+                inline size_t gemm_round_up(size_t value, size_t multiple)
+                {
+                    return (value + multiple - 1) / multiple * multiple;
+                }
+
+                /// \brief Packs rows [0, mc) and columns [0, kc) of the row major matrix a into
+                ///        strips of gemm_mr rows, stored column by column. Rows past mc are zero.
+                template <typename INPUT, typename ACCUMULATION>
+                void gemm_pack_a(
+                    const INPUT* a, size_t lda, size_t mc, size_t kc, ACCUMULATION* packed)
+                {
+                    for (size_t i0 = 0; i0 < mc; i0 += gemm_mr)
+                    {
+                        size_t rows = std::min(gemm_mr, mc - i0);
+                        for (size_t p = 0; p < kc; p++)
+                        {
+                            for (size_t i = 0; i < rows; i++)
+                            {
+                                packed[i] = static_cast<ACCUMULATION>(a[(i0 + i) * lda + p]);
+                            }
+                            for (size_t i = rows; i < gemm_mr; i++)
+                            {
+                                packed[i] = 0;
+                            }
+                            packed += gemm_mr;
+                        }
+                    }
+                }
+
+                /// \brief Packs rows [0, kc) and columns [0, nc) of the row major matrix b into
+                ///        strips of gemm_nr columns, stored row by row. Columns past nc are zero.
+                template <typename INPUT, typename ACCUMULATION>
+                void gemm_pack_b(
+                    const INPUT* b, size_t ldb, size_t kc, size_t nc, ACCUMULATION* packed)
+                {
+                    for (size_t j0 = 0; j0 < nc; j0 += gemm_nr)
+                    {
+                        size_t cols = std::min(gemm_nr, nc - j0);
+                        for (size_t p = 0; p < kc; p++)
+                        {
+                            const INPUT* row = b + p * ldb + j0;
+                            for (size_t j = 0; j < cols; j++)
+                            {
+                                packed[j] = static_cast<ACCUMULATION>(row[j]);
+                            }
+                            for (size_t j = cols; j < gemm_nr; j++)
+                            {
+                                packed[j] = 0;
+                            }
+                            packed += gemm_nr;
+                        }
+                    }
+                }
+
+                /// \brief Adds the product of a packed gemm_mr x kc strip of A and a packed
+                ///        kc x gemm_nr strip of B to a gemm_mr x gemm_nr tile of acc.
+                template <typename ACCUMULATION>
+                void gemm_micro_kernel(size_t kc,
+                                       const ACCUMULATION* a,
+                                       const ACCUMULATION* b,
+                                       ACCUMULATION* acc,
+                                       size_t ldacc)
+                {
+                    ACCUMULATION tile[gemm_mr][gemm_nr];
+                    for (size_t i = 0; i < gemm_mr; i++)
+                    {
+                        for (size_t j = 0; j < gemm_nr; j++)
+                        {
+                            tile[i][j] = acc[i * ldacc + j];
+                        }
+                    }
+                    for (size_t p = 0; p < kc; p++)
+                    {
+                        for (size_t i = 0; i < gemm_mr; i++)
+                        {
+                            ACCUMULATION a_value = a[i];
+                            for (size_t j = 0; j < gemm_nr; j++)
+                            {
+                                tile[i][j] = tile[i][j] + a_value * b[j];
+                            }
+                        }
+                        a += gemm_mr;
+                        b += gemm_nr;
+                    }
+                    for (size_t i = 0; i < gemm_mr; i++)
+                    {
+                        for (size_t j = 0; j < gemm_nr; j++)
+                        {
+                            acc[i * ldacc + j] = tile[i][j];
+                        }
+                    }
+                }
+
+                /// \brief Narrows an accumulated value with a plain conversion.
+                template <typename ACCUMULATION, typename OUTPUT>
+                struct GemmConvert
+                {
+                    OUTPUT operator()(ACCUMULATION value) const
+                    {
+                        return static_cast<OUTPUT>(value);
+                    }
+                };
+
+                /// \brief Narrows an integer accumulator of zero point adjusted products to
+                ///        a quantized output, rounding like the quantized reference kernels.
+                template <typename ACCUMULATION, typename OUTPUT>
+                struct GemmRequantize
+                {
+                    float scale;
+                    OUTPUT zero_point;
+
+                    OUTPUT operator()(ACCUMULATION value) const
+                    {
+                        return static_cast<OUTPUT>(
+                            static_cast<OUTPUT>(std::round(static_cast<float>(value) * scale)) +
+                            zero_point);
+                    }
+                };
+            }
+
+            /// \brief Computes the row major matrix product c[m, n] = a[m, k] * b[k, n].
+            ///
+            /// Blocks of A and B are converted to ACCUMULATION and packed into contiguous panels,
+            /// and a register tiled micro kernel accumulates each block of C in an ACCUMULATION
+            /// buffer that is only narrowed to OUTPUT once the whole of k has been summed. Every
+            /// output element is summed in increasing k order, so the result is identical to the
+            /// naive triple loop accumulating in ACCUMULATION.
+            ///
+            /// `narrow` converts each finished ACCUMULATION value to OUTPUT, e.g. to fuse the
+            /// requantization of an integer product into the write back.
+            ///
+            /// B is not read directly but packed one panel at a time by
+            /// `pack_b(pc, jc, kc, nc, packed)`, which must pack rows [pc, pc + kc) and columns
+            /// [jc, jc + nc) of B like detail::gemm_pack_b. This lets B be produced on the fly,
+            /// e.g. dequantized from compressed storage, without ever materializing it.
+            template <typename INPUT0,
+                      typename OUTPUT,
+                      typename ACCUMULATION,
+                      typename PACK_B,
+                      typename NARROW>
+            void blocked_gemm_packed_b(const INPUT0* a,
+                                       const PACK_B& pack_b,
+                                       OUTPUT* c,
+                                       size_t m,
+                                       size_t n,
+                                       size_t k,
+                                       const NARROW& narrow)
+            {
+                using namespace detail;
+
+                if (m == 0 || n == 0)
+                {
+                    return;
+                }
+
+                size_t mc_max = std::min(gemm_mc, gemm_round_up(m, gemm_mr));
+                size_t nc_max = std::min(gemm_nc, gemm_round_up(n, gemm_nr));
+                size_t kc_max = std::min(gemm_kc, k);
+                std::vector<ACCUMULATION> a_packed(mc_max * kc_max);
+                std::vector<ACCUMULATION> b_packed(kc_max * nc_max);
+                std::vector<ACCUMULATION> acc(mc_max * nc_max);
+
+                for (size_t jc = 0; jc < n; jc += gemm_nc)
+                {
+                    size_t nc = std::min(gemm_nc, n - jc);
+                    size_t nc_padded = gemm_round_up(nc, gemm_nr);
+                    for (size_t ic = 0; ic < m; ic += gemm_mc)
+                    {
+                        size_t mc = std::min(gemm_mc, m - ic);
+                        size_t mc_padded = gemm_round_up(mc, gemm_mr);
+                        std::fill(acc.begin(), acc.begin() + mc_padded * nc_padded, 0);
+
+                        // The K blocks are innermost so that a block of C is complete before it
+                        // is narrowed, at the cost of packing each B panel once per block of M.
+                        for (size_t pc = 0; pc < k; pc += gemm_kc)
+                        {
+                            size_t kc = std::min(gemm_kc, k - pc);
+                            gemm_pack_a(a + ic * k + pc, k, mc, kc, a_packed.data());
+                            pack_b(pc, jc, kc, nc, b_packed.data());
+                            for (size_t j0 = 0; j0 < nc_padded; j0 += gemm_nr)
+                            {
+                                for (size_t i0 = 0; i0 < mc_padded; i0 += gemm_mr)
+                                {
+                                    gemm_micro_kernel(kc,
+                                                      a_packed.data() + i0 * kc,
+                                                      b_packed.data() + j0 * kc,
+                                                      acc.data() + i0 * nc_padded + j0,
+                                                      nc_padded);
+                                }
+                            }
+                        }
+
+                        for (size_t i = 0; i < mc; i++)
+                        {
+                            const ACCUMULATION* acc_row = acc.data() + i * nc_padded;
+                            OUTPUT* c_row = c + (ic + i) * n + jc;
+                            for (size_t j = 0; j < nc; j++)
+                            {
+                                c_row[j] = narrow(acc_row[j]);
+                            }
+                        }
+                    }
+                }
+            }
+
+            /// \brief Computes the row major matrix product c[m, n] = a[m, k] * b[k, n], see
+            ///        blocked_gemm_packed_b.
+            template <typename INPUT0,
+                      typename INPUT1,
+                      typename OUTPUT,
+                      typename ACCUMULATION,
+                      typename NARROW>
+            void blocked_gemm(const INPUT0* a,
+                              const INPUT1* b,
+                              OUTPUT* c,
+                              size_t m,
+                              size_t n,
+                              size_t k,
+                              const NARROW& narrow)
+            {
+                blocked_gemm_packed_b<INPUT0, OUTPUT, ACCUMULATION>(
+                    a,
+                    [b, n](size_t pc, size_t jc, size_t kc, size_t nc, ACCUMULATION* packed) {
+                        detail::gemm_pack_b(b + pc * n + jc, n, kc, nc, packed);
+                    },
+                    c,
+                    m,
+                    n,
+                    k,
+                    narrow);
+            }
+
+            template <typename INPUT0, typename INPUT1, typename OUTPUT, typename ACCUMULATION>
+            void blocked_gemm(
+                const INPUT0* a, const INPUT1* b, OUTPUT* c, size_t m, size_t n, size_t k)
+            {
+                blocked_gemm<INPUT0, INPUT1, OUTPUT, ACCUMULATION>(
+                    a, b, c, m, n, k, detail::GemmConvert<ACCUMULATION, OUTPUT>());
+            }
+        }
+    }
+}
@@ -57,22 +57,18 @@ namespace ngraph
                     out_end_coord[concatenation_axis] =
                         concatenation_pos + in_shapes[i][concatenation_axis];
 
-                    CoordinateTransform input_transform(in_shapes[i]);
                     CoordinateTransform output_chunk_transform(
                         out_shape, out_start_coord, out_end_coord);
 
-                    NGRAPH_CHECK(shape_size(input_transform.get_target_shape()) ==
+                    NGRAPH_CHECK(shape_size(in_shapes[i]) ==
                                  shape_size(output_chunk_transform.get_target_shape()));
 
-                    CoordinateTransform::Iterator output_chunk_it = output_chunk_transform.begin();
-
-                    for (const Coordinate& input_coord : input_transform)
+                    // The input is read in row-major order, so its index is the target index
+                    for (auto output_chunk_it = output_chunk_transform.index_begin();
+                         output_chunk_it.valid(); ++output_chunk_it)
                     {
-                        size_t input_index = input_transform.index(input_coord);
-                        size_t output_chunk_index = output_chunk_transform.index(*output_chunk_it);
-                        ++output_chunk_it;
-
-                        out[output_chunk_index] = args[i][input_index];
+                        out[output_chunk_it.source_index()] =
+                            args[i][output_chunk_it.target_index()];
                     }
 
                     concatenation_pos += in_shapes[i][concatenation_axis];
@@ -18,6 +18,9 @@
 
 #include <cstddef>
 
+#include "ngraph/type/bfloat16.hpp"
+#include "ngraph/type/float16.hpp"
+
 namespace ngraph
 {
     namespace runtime
@@ -33,6 +36,30 @@ namespace ngraph
                 }
             }
 
+            template <>
+            inline void convert<float16, float>(const float16* arg, float* out, size_t count)
+            {
+                float16::to_float_buffer(arg, out, count);
+            }
+
+            template <>
+            inline void convert<float, float16>(const float* arg, float16* out, size_t count)
+            {
+                float16::from_float_buffer(arg, out, count);
+            }
+
+            template <>
+            inline void convert<bfloat16, float>(const bfloat16* arg, float* out, size_t count)
+            {
+                bfloat16::to_float_buffer(arg, out, count);
+            }
+
+            template <>
+            inline void convert<float, bfloat16>(const float* arg, bfloat16* out, size_t count)
+            {
+                bfloat16::from_float_buffer(arg, out, count);
+            }
+
             template <typename T>
             void convert_to_bool(const T* arg, char* out, size_t count)
             {
@@ -0,0 +1,537 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include "ngraph/coordinate_diff.hpp"
+#include "ngraph/runtime/reference/blocked_gemm.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/shape_util.hpp"
+#include "ngraph/strides.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            namespace detail
+            {
+                /// \brief Strides of the batch and channel axes of the three convolution
+                ///        tensors. Spatial axes always trail, so within one batch and channel
+                ///        a spatial position is a flat row major offset.
+                struct ConvolutionGeometry
+                {
+                    ConvolutionGeometry(const Shape& in_shape,
+                                        const Shape& filter_shape,
+                                        const Shape& out_shape,
+                                        size_t in_batch_axis,
+                                        size_t in_channel_axis,
+                                        size_t filter_out_channel_axis,
+                                        size_t filter_in_channel_axis,
+                                        size_t out_batch_axis,
+                                        size_t out_channel_axis)
+                        : in_spatial(in_shape.begin() + 2, in_shape.end())
+                        , filter_spatial(filter_shape.begin() + 2, filter_shape.end())
+                        , out_spatial(out_shape.begin() + 2, out_shape.end())
+                        , batch_size(in_shape[in_batch_axis])
+                        , in_channels(in_shape[in_channel_axis])
+                        , out_channels(out_shape[out_channel_axis])
+                        , in_batch_stride(row_major_strides(in_shape)[in_batch_axis])
+                        , in_channel_stride(row_major_strides(in_shape)[in_channel_axis])
+                        , filter_out_channel_stride(
+                              row_major_strides(filter_shape)[filter_out_channel_axis])
+                        , filter_in_channel_stride(
+                              row_major_strides(filter_shape)[filter_in_channel_axis])
+                        , out_batch_stride(row_major_strides(out_shape)[out_batch_axis])
+                        , out_channel_stride(row_major_strides(out_shape)[out_channel_axis])
+                    {
+                    }
+
+                    Shape in_spatial;
+                    Shape filter_spatial;
+                    Shape out_spatial;
+                    size_t batch_size;
+                    size_t in_channels;
+                    size_t out_channels;
+                    size_t in_batch_stride;
+                    size_t in_channel_stride;
+                    size_t filter_out_channel_stride;
+                    size_t filter_in_channel_stride;
+                    size_t out_batch_stride;
+                    size_t out_channel_stride;
+                };
+
+                /// \brief Writes the [out_channels, P] matrix of one batch to out, where P is
+                ///        the number of output spatial positions.
+                template <typename OUTPUT>
+                void scatter_convolution_output(const ConvolutionGeometry& g,
+                                                const OUTPUT* matrix,
+                                                OUTPUT* out)
+                {
+                    size_t out_spatial_size = shape_size(g.out_spatial);
+                    for (size_t co = 0; co < g.out_channels; co++)
+                    {
+                        std::copy(matrix + co * out_spatial_size,
+                                  matrix + (co + 1) * out_spatial_size,
+                                  out + co * g.out_channel_stride);
+                    }
+                }
+
+                /// \brief Convolution as one GEMM per batch.
+                ///
+                /// The filter becomes an [out_channels, F * in_channels] matrix and the input
+                /// of each batch an [F * in_channels, P] matrix of the input values under each
+                /// filter position, with zeros for padding and dilation holes, where F is the
+                /// filter spatial size. Rows are ordered filter position major, as in the
+                /// coordinate walk of general_convolution, so sums are added in the same order.
+                ///
+                /// The matrices hold COLUMN and WEIGHT values with the zero points already
+                /// subtracted, so padding contributes nothing to a quantized sum, and `narrow`
+                /// converts each accumulated output value.
+                template <typename INPUT,
+                          typename FILTER,
+                          typename OUTPUT,
+                          typename ACCUMULATION,
+                          typename COLUMN,
+                          typename WEIGHT,
+                          typename NARROW>
+                void im2col_convolution(const ConvolutionGeometry& g,
+                                        const INPUT* in,
+                                        const FILTER* filter,
+                                        OUTPUT* out,
+                                        const Strides& stride,
+                                        const Strides& filter_dilation,
+                                        const CoordinateDiff& in_pad_below,
+                                        const Strides& in_dilation,
+                                        COLUMN in_zero_point,
+                                        WEIGHT filter_zero_point,
+                                        const NARROW& narrow)
+                {
+                    size_t n_spatial = g.in_spatial.size();
+                    size_t filter_spatial_size = shape_size(g.filter_spatial);
+                    size_t out_spatial_size = shape_size(g.out_spatial);
+                    size_t k = filter_spatial_size * g.in_channels;
+
+                    std::vector<WEIGHT> weights(g.out_channels * k);
+                    for (size_t co = 0; co < g.out_channels; co++)
+                    {
+                        for (size_t f = 0; f < filter_spatial_size; f++)
+                        {
+                            for (size_t c = 0; c < g.in_channels; c++)
+                            {
+                                weights[(co * filter_spatial_size + f) * g.in_channels + c] =
+                                    static_cast<WEIGHT>(filter[co * g.filter_out_channel_stride +
+                                                               c * g.filter_in_channel_stride +
+                                                               f] -
+                                                        filter_zero_point);
+                            }
+                        }
+                    }
+
+                    // For every spatial axis, the input offset under filter position f and
+                    // output position o is at offsets[axis][f * out_dim + o], or -1 when it
+                    // falls in the padding or a dilation hole.
+                    Strides in_spatial_strides = row_major_strides(g.in_spatial);
+                    std::vector<std::vector<std::ptrdiff_t>> offsets(n_spatial);
+                    for (size_t i = 0; i < n_spatial; i++)
+                    {
+                        size_t out_dim = g.out_spatial[i];
+                        offsets[i].resize(g.filter_spatial[i] * out_dim);
+                        for (size_t f = 0; f < g.filter_spatial[i]; f++)
+                        {
+                            for (size_t o = 0; o < out_dim; o++)
+                            {
+                                std::ptrdiff_t pos = static_cast<std::ptrdiff_t>(
+                                                         o * stride[i] + f * filter_dilation[i]) -
+                                                     in_pad_below[i];
+                                std::ptrdiff_t dilation = in_dilation[i];
+                                bool valid = pos >= 0 && pos % dilation == 0 &&
+                                             pos / dilation <
+                                                 static_cast<std::ptrdiff_t>(g.in_spatial[i]);
+                                offsets[i][f * out_dim + o] =
+                                    valid ? pos / dilation *
+                                                static_cast<std::ptrdiff_t>(in_spatial_strides[i])
+                                          : -1;
+                            }
+                        }
+                    }
+
+                    std::vector<COLUMN> columns(k * out_spatial_size);
+                    std::vector<OUTPUT> product;
+                    bool direct_output = g.out_channel_stride == out_spatial_size;
+                    if (!direct_output)
+                    {
+                        product.resize(g.out_channels * out_spatial_size);
+                    }
+
+                    // The innermost spatial axis is copied in a run, the others are walked
+                    size_t outer_axes = n_spatial == 0 ? 0 : n_spatial - 1;
+                    size_t inner_dim = n_spatial == 0 ? 1 : g.out_spatial.back();
+                    std::vector<size_t> filter_coord(n_spatial);
+                    std::vector<size_t> out_coord(n_spatial);
+                    for (size_t n = 0; n < g.batch_size; n++)
+                    {
+                        const INPUT* batch_in = in + n * g.in_batch_stride;
+                        std::fill(filter_coord.begin(), filter_coord.end(), 0);
+                        for (size_t f = 0; f < filter_spatial_size; f++)
+                        {
+                            const std::ptrdiff_t* inner_offsets =
+                                n_spatial == 0
+                                    ? nullptr
+                                    : offsets[n_spatial - 1].data() +
+                                          filter_coord[n_spatial - 1] * inner_dim;
+                            for (size_t c = 0; c < g.in_channels; c++)
+                            {
+                                const INPUT* channel_in = batch_in + c * g.in_channel_stride;
+                                COLUMN* row = columns.data() + (f * g.in_channels + c) *
+                                                                   out_spatial_size;
+                                std::fill(out_coord.begin(), out_coord.end(), 0);
+                                for (size_t p = 0; p < out_spatial_size; p += inner_dim)
+                                {
+                                    std::ptrdiff_t base = 0;
+                                    bool valid = true;
+                                    for (size_t i = 0; i < outer_axes; i++)
+                                    {
+                                        std::ptrdiff_t offset =
+                                            offsets[i][filter_coord[i] * g.out_spatial[i] +
+                                                       out_coord[i]];
+                                        valid = valid && offset >= 0;
+                                        base += offset;
+                                    }
+                                    for (size_t o = 0; o < inner_dim; o++)
+                                    {
+                                        std::ptrdiff_t offset = inner_offsets ? inner_offsets[o]
+                                                                              : 0;
+                                        row[p + o] = valid && offset >= 0
+                                                         ? static_cast<COLUMN>(
+                                                               channel_in[base + offset] -
+                                                               in_zero_point)
+                                                         : COLUMN(0);
+                                    }
+                                    for (size_t i = outer_axes; i-- > 0;)
+                                    {
+                                        if (++out_coord[i] < g.out_spatial[i])
+                                        {
+                                            break;
+                                        }
+                                        out_coord[i] = 0;
+                                    }
+                                }
+                            }
+                            for (size_t i = n_spatial; i-- > 0;)
+                            {
+                                if (++filter_coord[i] < g.filter_spatial[i])
+                                {
+                                    break;
+                                }
+                                filter_coord[i] = 0;
+                            }
+                        }
+
+                        OUTPUT* batch_out = out + n * g.out_batch_stride;
+                        blocked_gemm<WEIGHT, COLUMN, OUTPUT, ACCUMULATION>(
+                            weights.data(),
+                            columns.data(),
+                            direct_output ? batch_out : product.data(),
+                            g.out_channels,
+                            out_spatial_size,
+                            k,
+                            narrow);
+                        if (!direct_output)
+                        {
+                            scatter_convolution_output(g, product.data(), batch_out);
+                        }
+                    }
+                }
+
+                /// \brief Whether winograd_convolution applies: a floating point 3x3 filter
+                ///        with unit strides and no dilation over two spatial axes.
+                template <typename ACCUMULATION>
+                bool is_winograd_convolution(const ConvolutionGeometry& g,
+                                             const Strides& stride,
+                                             const Strides& filter_dilation,
+                                             const Strides& in_dilation)
+                {
+                    return std::is_floating_point<ACCUMULATION>::value &&
+                           g.filter_spatial == Shape{3, 3} && stride == Strides{1, 1} &&
+                           filter_dilation == Strides{1, 1} && in_dilation == Strides{1, 1};
+                }
+
+                /// \brief Winograd F(2x2, 3x3) convolution.
+                ///
+                /// Each 2x2 output tile is computed from a 4x4 input tile as
+                /// A^T [(G g G^T) . (B^T d B)] A, summed over input channels. The sum over
+                /// channels of each of the 16 elementwise products is a GEMM of the transformed
+                /// [out_channels, in_channels] filters and [in_channels, tiles] inputs. This
+                /// uses 16 instead of 36 multiplications per tile and channel pair, but the
+                /// result is only equal to the direct convolution up to rounding.
+                template <typename INPUT, typename FILTER, typename OUTPUT, typename ACCUMULATION>
+                void winograd_convolution(const ConvolutionGeometry& g,
+                                          const INPUT* in,
+                                          const FILTER* filter,
+                                          OUTPUT* out,
+                                          const CoordinateDiff& in_pad_below)
+                {
+                    using ACC = ACCUMULATION;
+                    const std::ptrdiff_t in_h = g.in_spatial[0];
+                    const std::ptrdiff_t in_w = g.in_spatial[1];
+                    const size_t out_h = g.out_spatial[0];
+                    const size_t out_w = g.out_spatial[1];
+                    const size_t tiles_h = (out_h + 1) / 2;
+                    const size_t tiles_w = (out_w + 1) / 2;
+                    const size_t tiles = tiles_h * tiles_w;
+                    const size_t in_channels = g.in_channels;
+                    const size_t out_channels = g.out_channels;
+
+                    // u[xi][co * in_channels + c] is element xi of G g G^T
+                    std::vector<ACC> u(16 * out_channels * in_channels);
+                    for (size_t co = 0; co < out_channels; co++)
+                    {
+                        for (size_t c = 0; c < in_channels; c++)
+                        {
+                            const FILTER* w = filter + co * g.filter_out_channel_stride +
+                                              c * g.filter_in_channel_stride;
+                            ACC gg[4][3];
+                            for (size_t j = 0; j < 3; j++)
+                            {
+                                ACC g0 = w[j], g1 = w[3 + j], g2 = w[6 + j];
+                                gg[0][j] = g0;
+                                gg[1][j] = (g0 + g1 + g2) / 2;
+                                gg[2][j] = (g0 - g1 + g2) / 2;
+                                gg[3][j] = g2;
+                            }
+                            for (size_t i = 0; i < 4; i++)
+                            {
+                                ACC* row = u.data() + (i * 4) * out_channels * in_channels +
+                                           co * in_channels + c;
+                                size_t step = out_channels * in_channels;
+                                row[0] = gg[i][0];
+                                row[step] = (gg[i][0] + gg[i][1] + gg[i][2]) / 2;
+                                row[2 * step] = (gg[i][0] - gg[i][1] + gg[i][2]) / 2;
+                                row[3 * step] = gg[i][2];
+                            }
+                        }
+                    }
+
+                    std::vector<ACC> v(16 * in_channels * tiles);
+                    std::vector<ACC> m(16 * out_channels * tiles);
+                    std::vector<OUTPUT> product;
+                    bool direct_output = g.out_channel_stride == out_h * out_w;
+                    if (!direct_output)
+                    {
+                        product.resize(out_channels * out_h * out_w);
+                    }
+
+                    for (size_t n = 0; n < g.batch_size; n++)
+                    {
+                        // v[xi][c * tiles + t] is element xi of B^T d B
+                        for (size_t c = 0; c < in_channels; c++)
+                        {
+                            const INPUT* channel_in =
+                                in + n * g.in_batch_stride + c * g.in_channel_stride;
+                            for (size_t t = 0; t < tiles; t++)
+                            {
+                                std::ptrdiff_t y0 = 2 * (t / tiles_w) - in_pad_below[0];
+                                std::ptrdiff_t x0 = 2 * (t % tiles_w) - in_pad_below[1];
+                                ACC d[4][4];
+                                for (std::ptrdiff_t y = 0; y < 4; y++)
+                                {
+                                    for (std::ptrdiff_t x = 0; x < 4; x++)
+                                    {
+                                        std::ptrdiff_t iy = y0 + y, ix = x0 + x;
+                                        d[y][x] = iy >= 0 && iy < in_h && ix >= 0 && ix < in_w
+                                                      ? static_cast<ACC>(channel_in[iy * in_w + ix])
+                                                      : ACC(0);
+                                    }
+                                }
+                                ACC bd[4][4];
+                                for (size_t x = 0; x < 4; x++)
+                                {
+                                    bd[0][x] = d[0][x] - d[2][x];
+                                    bd[1][x] = d[1][x] + d[2][x];
+                                    bd[2][x] = d[2][x] - d[1][x];
+                                    bd[3][x] = d[1][x] - d[3][x];
+                                }
+                                size_t step = in_channels * tiles;
+                                for (size_t i = 0; i < 4; i++)
+                                {
+                                    ACC* row = v.data() + (i * 4) * step + c * tiles + t;
+                                    row[0] = bd[i][0] - bd[i][2];
+                                    row[step] = bd[i][1] + bd[i][2];
+                                    row[2 * step] = bd[i][2] - bd[i][1];
+                                    row[3 * step] = bd[i][1] - bd[i][3];
+                                }
+                            }
+                        }
+
+                        for (size_t xi = 0; xi < 16; xi++)
+                        {
+                            blocked_gemm<ACC, ACC, ACC, ACC>(
+                                u.data() + xi * out_channels * in_channels,
+                                v.data() + xi * in_channels * tiles,
+                                m.data() + xi * out_channels * tiles,
+                                out_channels,
+                                tiles,
+                                in_channels);
+                        }
+
+                        OUTPUT* batch_out = out + n * g.out_batch_stride;
+                        OUTPUT* result = direct_output ? batch_out : product.data();
+                        size_t step = out_channels * tiles;
+                        for (size_t co = 0; co < out_channels; co++)
+                        {
+                            OUTPUT* channel_out = result + co * out_h * out_w;
+                            for (size_t t = 0; t < tiles; t++)
+                            {
+                                const ACC* mt = m.data() + co * tiles + t;
+                                ACC am[2][4];
+                                for (size_t x = 0; x < 4; x++)
+                                {
+                                    am[0][x] = mt[x * step] + mt[(4 + x) * step] +
+                                               mt[(8 + x) * step];
+                                    am[1][x] = mt[(4 + x) * step] - mt[(8 + x) * step] -
+                                               mt[(12 + x) * step];
+                                }
+                                size_t y0 = 2 * (t / tiles_w);
+                                size_t x0 = 2 * (t % tiles_w);
+                                for (size_t y = 0; y < 2 && y0 + y < out_h; y++)
+                                {
+                                    ACC y_tile[2] = {am[y][0] + am[y][1] + am[y][2],
+                                                     am[y][1] - am[y][2] - am[y][3]};
+                                    for (size_t x = 0; x < 2 && x0 + x < out_w; x++)
+                                    {
+                                        channel_out[(y0 + y) * out_w + x0 + x] =
+                                            static_cast<OUTPUT>(y_tile[x]);
+                                    }
+                                }
+                            }
+                        }
+                        if (!direct_output)
+                        {
+                            scatter_convolution_output(g, product.data(), batch_out);
+                        }
+                    }
+                }
+
+                /// \brief Non-quantized convolution through the Winograd or the im2col engine.
+                template <typename INPUT, typename FILTER, typename OUTPUT, typename ACCUMULATION>
+                void gemm_convolution(const INPUT* in,
+                                      const FILTER* filter,
+                                      OUTPUT* out,
+                                      const Shape& in_shape,
+                                      const Shape& filter_shape,
+                                      const Shape& out_shape,
+                                      const Strides& stride,
+                                      const Strides& filter_dilation,
+                                      const CoordinateDiff& in_pad_below,
+                                      const Strides& in_dilation,
+                                      size_t in_batch_axis,
+                                      size_t in_channel_axis,
+                                      size_t filter_out_channel_axis,
+                                      size_t filter_in_channel_axis,
+                                      size_t out_batch_axis,
+                                      size_t out_channel_axis)
+                {
+                    ConvolutionGeometry g(in_shape,
+                                          filter_shape,
+                                          out_shape,
+                                          in_batch_axis,
+                                          in_channel_axis,
+                                          filter_out_channel_axis,
+                                          filter_in_channel_axis,
+                                          out_batch_axis,
+                                          out_channel_axis);
+                    if (is_winograd_convolution<ACCUMULATION>(
+                            g, stride, filter_dilation, in_dilation))
+                    {
+                        winograd_convolution<INPUT, FILTER, OUTPUT, ACCUMULATION>(
+                            g, in, filter, out, in_pad_below);
+                    }
+                    else
+                    {
+                        im2col_convolution<INPUT, FILTER, OUTPUT, ACCUMULATION>(
+                            g,
+                            in,
+                            filter,
+                            out,
+                            stride,
+                            filter_dilation,
+                            in_pad_below,
+                            in_dilation,
+                            INPUT(0),
+                            FILTER(0),
+                            GemmConvert<ACCUMULATION, OUTPUT>());
+                    }
+                }
+
+                /// \brief Quantized convolution through the im2col engine. Both operands are
+                ///        widened to ACCUMULATION minus their zero points and the requantization
+                ///        is fused into the write back of the GEMM.
+                template <typename INPUT, typename FILTER, typename OUTPUT, typename ACCUMULATION>
+                void quantized_gemm_convolution(const INPUT* in,
+                                                const FILTER* filter,
+                                                OUTPUT* out,
+                                                const Shape& in_shape,
+                                                const Shape& filter_shape,
+                                                const Shape& out_shape,
+                                                const Strides& stride,
+                                                const Strides& filter_dilation,
+                                                const CoordinateDiff& in_pad_below,
+                                                const Strides& in_dilation,
+                                                size_t in_batch_axis,
+                                                size_t in_channel_axis,
+                                                size_t filter_out_channel_axis,
+                                                size_t filter_in_channel_axis,
+                                                size_t out_batch_axis,
+                                                size_t out_channel_axis,
+                                                float scale,
+                                                INPUT input_zero_point,
+                                                FILTER filter_zero_point,
+                                                OUTPUT output_zero_point)
+                {
+                    ConvolutionGeometry g(in_shape,
+                                          filter_shape,
+                                          out_shape,
+                                          in_batch_axis,
+                                          in_channel_axis,
+                                          filter_out_channel_axis,
+                                          filter_in_channel_axis,
+                                          out_batch_axis,
+                                          out_channel_axis);
+                    GemmRequantize<ACCUMULATION, OUTPUT> requantize{scale, output_zero_point};
+                    im2col_convolution<INPUT, FILTER, OUTPUT, ACCUMULATION>(
+                        g,
+                        in,
+                        filter,
+                        out,
+                        stride,
+                        filter_dilation,
+                        in_pad_below,
+                        in_dilation,
+                        static_cast<ACCUMULATION>(input_zero_point),
+                        static_cast<ACCUMULATION>(filter_zero_point),
+                        requantize);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,74 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief CTCGreedyDecoder of batch elements [begin, end) of [T, N, C] `data`.
+            ///
+            /// The class of each frame is its first largest logit, the last class being the
+            /// blank. Frames whose `sequence_mask` [T, N] is 0 are skipped. Blanks are dropped,
+            /// and so are repeats of the class of the previous frame if `merge_repeated`. The
+            /// classes left go to the start of row n of the [N, T, 1, 1] output, which the
+            /// rest fills with -1.
+            template <typename T, typename M>
+            void ctc_greedy_decoder(const T* data,
+                                    const M* sequence_mask,
+                                    T* out,
+                                    const Shape& data_shape,
+                                    bool merge_repeated,
+                                    size_t begin,
+                                    size_t end)
+            {
+                const size_t max_time = data_shape[0];
+                const size_t batch_size = data_shape[1];
+                const size_t classes = data_shape[2];
+                const size_t blank = classes - 1;
+                for (size_t n = begin; n < end; n++)
+                {
+                    T* row = out + n * max_time;
+                    size_t decoded = 0;
+                    size_t previous = classes;
+                    for (size_t t = 0; t < max_time; t++)
+                    {
+                        if (classes == 0 || sequence_mask[t * batch_size + n] == M(0))
+                        {
+                            continue;
+                        }
+                        const T* logits = data + (t * batch_size + n) * classes;
+                        size_t best = std::max_element(logits, logits + classes) - logits;
+                        if (best != blank && !(merge_repeated && best == previous))
+                        {
+                            row[decoded++] = static_cast<T>(best);
+                        }
+                        previous = best;
+                    }
+                    std::fill(row + decoded, row + max_time, T(-1));
+                }
+            }
+        }
+    }
+}
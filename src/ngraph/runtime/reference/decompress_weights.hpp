@@ -0,0 +1,175 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "ngraph/runtime/reference/blocked_gemm.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            namespace detail
+            {
+                /// \returns the number of bytes a packed row of `cols` values takes.
+                inline size_t packed_row_size(size_t cols, size_t bits)
+                {
+                    return (cols * bits + 7) / 8;
+                }
+
+                /// \returns value `col` of a packed row of quantized weights.
+                inline int32_t packed_value(const int8_t* row, size_t col, size_t bits)
+                {
+                    if (bits == 8)
+                    {
+                        return row[col];
+                    }
+                    uint8_t byte = static_cast<uint8_t>(row[col / 2]);
+                    int32_t nibble = (col % 2 == 0) ? (byte & 0x0F) : (byte >> 4);
+                    return nibble >= 8 ? nibble - 16 : nibble;
+                }
+
+                /// \brief Maps a row of weights, viewed as rows of their last axis, to the
+                ///        index of its channel along `axis`. Only valid if `axis` is not the
+                ///        last axis, in which case the channel is the column.
+                inline size_t channel_of_row(size_t row, const Shape& shape, size_t axis)
+                {
+                    size_t inner_rows = 1;
+                    for (size_t i = axis + 1; i + 1 < shape.size(); i++)
+                    {
+                        inner_rows *= shape[i];
+                    }
+                    return (row / inner_rows) % shape[axis];
+                }
+            }
+
+            /// \brief Decompresses rows [row_begin, row_end) of the last axis of weights of
+            ///        `shape` into `out`, see op::v0::DecompressWeights.
+            inline void decompress_weight_rows(const int8_t* packed,
+                                               const float* scales,
+                                               float* out,
+                                               const Shape& shape,
+                                               size_t axis,
+                                               size_t bits,
+                                               size_t row_begin,
+                                               size_t row_end)
+            {
+                size_t cols = shape.back();
+                size_t row_size = detail::packed_row_size(cols, bits);
+                bool column_channels = (axis + 1 == shape.size());
+                for (size_t row = row_begin; row < row_end; row++)
+                {
+                    const int8_t* packed_row = packed + row * row_size;
+                    if (column_channels)
+                    {
+                        for (size_t col = 0; col < cols; col++)
+                        {
+                            out[col] = detail::packed_value(packed_row, col, bits) * scales[col];
+                        }
+                    }
+                    else
+                    {
+                        float scale = scales[detail::channel_of_row(row, shape, axis)];
+                        for (size_t col = 0; col < cols; col++)
+                        {
+                            out[col] = detail::packed_value(packed_row, col, bits) * scale;
+                        }
+                    }
+                    out += cols;
+                }
+            }
+
+            inline void decompress_weights(const int8_t* packed,
+                                           const float* scales,
+                                           float* out,
+                                           const Shape& shape,
+                                           size_t axis,
+                                           size_t bits)
+            {
+                size_t rows = shape.empty() ? 0 : shape_size(shape) / shape.back();
+                decompress_weight_rows(packed, scales, out, shape, axis, bits, 0, rows);
+            }
+
+            /// \brief Computes out[m, n] = arg0[m, k] * w[k, n] for compressed weights w, see
+            ///        op::v0::DecompressWeights, with a channel axis of 0 or 1.
+            ///
+            /// The weights are dequantized panel by panel while the blocked GEMM packs them,
+            /// so the f32 weights are never materialized.
+            inline void compressed_dot(const float* arg0,
+                                       const int8_t* packed,
+                                       const float* scales,
+                                       float* out,
+                                       size_t m,
+                                       size_t k,
+                                       size_t n,
+                                       size_t axis,
+                                       size_t bits)
+            {
+                size_t row_size = detail::packed_row_size(n, bits);
+                auto pack_b = [=](size_t pc, size_t jc, size_t kc, size_t nc, float* panel) {
+                    for (size_t j0 = 0; j0 < nc; j0 += detail::gemm_nr)
+                    {
+                        size_t cols = std::min(detail::gemm_nr, nc - j0);
+                        for (size_t p = 0; p < kc; p++)
+                        {
+                            const int8_t* packed_row = packed + (pc + p) * row_size;
+                            for (size_t j = 0; j < cols; j++)
+                            {
+                                size_t col = jc + j0 + j;
+                                float scale = (axis == 0) ? scales[pc + p] : scales[col];
+                                panel[j] = detail::packed_value(packed_row, col, bits) * scale;
+                            }
+                            for (size_t j = cols; j < detail::gemm_nr; j++)
+                            {
+                                panel[j] = 0;
+                            }
+                            panel += detail::gemm_nr;
+                        }
+                    }
+                };
+                blocked_gemm_packed_b<float, float, float>(
+                    arg0, pack_b, out, m, n, k, detail::GemmConvert<float, float>());
+            }
+
+            /// \brief Looks up rows of compressed weights of shape [rows, cols], see
+            ///        op::v0::DecompressWeights, dequantizing only the rows that are looked up.
+            template <typename U>
+            void compressed_embedding(const U* indices,
+                                      const int8_t* packed,
+                                      const float* scales,
+                                      float* out,
+                                      size_t indices_count,
+                                      const Shape& shape,
+                                      size_t axis,
+                                      size_t bits)
+            {
+                size_t vec_len = shape.at(1);
+                for (size_t i = 0; i < indices_count; i++)
+                {
+                    size_t row = static_cast<size_t>(indices[i]);
+                    decompress_weight_rows(packed, scales, out, shape, axis, bits, row, row + 1);
+                    out += vec_len;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,270 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "ngraph/check.hpp"
+#include "ngraph/coordinate_diff.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/strides.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief The geometry of a 2D deformable convolution
+            struct DeformableConvolutionGeometry
+            {
+                DeformableConvolutionGeometry(const Shape& data_shape,
+                                              const Shape& filters_shape,
+                                              const Shape& out_shape,
+                                              const Strides& strides,
+                                              const Strides& dilations,
+                                              const CoordinateDiff& pads_begin,
+                                              size_t groups,
+                                              size_t deformable_groups)
+                {
+                    NGRAPH_CHECK(data_shape.size() == 4,
+                                 "DeformableConvolution supports 2 spatial dimensions only");
+                    batch = data_shape[0];
+                    channels = data_shape[1];
+                    filters = filters_shape[0];
+                    group = std::max(groups, size_t(1));
+                    deformable_group = std::max(deformable_groups, size_t(1));
+                    NGRAPH_CHECK(channels % group == 0 && filters % group == 0 &&
+                                     channels % deformable_group == 0,
+                                 "DeformableConvolution channels do not split into groups");
+                    for (size_t i = 0; i < 2; i++)
+                    {
+                        in[i] = data_shape[2 + i];
+                        kernel[i] = filters_shape[2 + i];
+                        out[i] = out_shape[2 + i];
+                        stride[i] = strides[i];
+                        dilation[i] = dilations[i];
+                        pad[i] = pads_begin[i];
+                    }
+                }
+
+                size_t in_size() const { return in[0] * in[1]; }
+                size_t kernel_size() const { return kernel[0] * kernel[1]; }
+                size_t out_size() const { return out[0] * out[1]; }
+                /// \brief Rows of the column buffer of one group: its channels times the kernel
+                size_t column_rows() const { return channels / group * kernel_size(); }
+                size_t batch;
+                size_t channels;
+                size_t filters;
+                size_t group;
+                size_t deformable_group;
+                size_t in[2];
+                size_t kernel[2];
+                size_t out[2];
+                size_t stride[2];
+                size_t dilation[2];
+                std::ptrdiff_t pad[2];
+            };
+
+            /// \brief Bilinear interpolation of a point in the plane: the indices of the four
+            ///        neighbours and their weights, those outside the plane weighing 0
+            struct BilinearSample
+            {
+                template <typename T>
+                BilinearSample(T y, T x, size_t height, size_t width)
+                {
+                    std::fill(index, index + 4, size_t(0));
+                    std::fill(weight, weight + 4, 0.0);
+                    if (!(y > T(-1) && y < T(height) && x > T(-1) && x < T(width)))
+                    {
+                        return;
+                    }
+                    double y0 = std::floor(double(y));
+                    double x0 = std::floor(double(x));
+                    double dy = double(y) - y0;
+                    double dx = double(x) - x0;
+                    const std::ptrdiff_t ys[2] = {std::ptrdiff_t(y0), std::ptrdiff_t(y0) + 1};
+                    const std::ptrdiff_t xs[2] = {std::ptrdiff_t(x0), std::ptrdiff_t(x0) + 1};
+                    const double wy[2] = {1 - dy, dy};
+                    const double wx[2] = {1 - dx, dx};
+                    for (size_t i = 0; i < 2; i++)
+                    {
+                        for (size_t j = 0; j < 2; j++)
+                        {
+                            bool inside = ys[i] >= 0 && ys[i] < std::ptrdiff_t(height) &&
+                                          xs[j] >= 0 && xs[j] < std::ptrdiff_t(width);
+                            index[i * 2 + j] = inside ? size_t(ys[i]) * width + size_t(xs[j]) : 0;
+                            weight[i * 2 + j] = inside ? wy[i] * wx[j] : 0.0;
+                        }
+                    }
+                }
+
+                size_t index[4];
+                double weight[4];
+            };
+
+            /// \brief Gathers the deformed windows of output positions [begin, end) of group
+            ///        `g` into `columns`, laid out as [N, column_rows, out_size] with a row for
+            ///        every channel of the group and kernel position. A position is one
+            ///        spatial point of one batch element.
+            ///
+            /// `offsets` is [N, deformable_group * 2 * kernel_size, out...], the offsets of
+            /// kernel position k being at 2k along y and 2k + 1 along x. The interpolation of
+            /// a kernel position is computed once and applied to all the channels of its
+            /// deformable group.
+            template <typename T>
+            void deformable_im2col(const T* data,
+                                   const T* offsets,
+                                   T* columns,
+                                   const DeformableConvolutionGeometry& geometry,
+                                   size_t g,
+                                   size_t begin,
+                                   size_t end)
+            {
+                const auto& geo = geometry;
+                const size_t in_size = geo.in_size();
+                const size_t out_size = geo.out_size();
+                const size_t kernel_size = geo.kernel_size();
+                const size_t rows = geo.column_rows();
+                const size_t group_channels = geo.channels / geo.group;
+                const size_t deformable_channels = geo.channels / geo.deformable_group;
+                const size_t first_channel = g * group_channels;
+                const size_t last_channel = first_channel + group_channels;
+                for (size_t position = begin; position < end; position++)
+                {
+                    size_t n = position / out_size;
+                    size_t p = position % out_size;
+                    size_t oh = p / geo.out[1];
+                    size_t ow = p % geo.out[1];
+                    const T* batch_data = data + n * geo.channels * in_size;
+                    T* batch_columns = columns + n * rows * out_size + p;
+                    for (size_t dg = first_channel / deformable_channels;
+                         dg * deformable_channels < last_channel;
+                         dg++)
+                    {
+                        const T* dg_offsets =
+                            offsets + (n * geo.deformable_group + dg) * 2 * kernel_size * out_size;
+                        size_t c_begin = std::max(first_channel, dg * deformable_channels);
+                        size_t c_end = std::min(last_channel, (dg + 1) * deformable_channels);
+                        for (size_t k = 0; k < kernel_size; k++)
+                        {
+                            size_t kh = k / geo.kernel[1];
+                            size_t kw = k % geo.kernel[1];
+                            T y = T(std::ptrdiff_t(oh * geo.stride[0] + kh * geo.dilation[0]) -
+                                    geo.pad[0]) +
+                                  dg_offsets[(2 * k) * out_size + p];
+                            T x = T(std::ptrdiff_t(ow * geo.stride[1] + kw * geo.dilation[1]) -
+                                    geo.pad[1]) +
+                                  dg_offsets[(2 * k + 1) * out_size + p];
+                            BilinearSample sample(y, x, geo.in[0], geo.in[1]);
+                            for (size_t c = c_begin; c < c_end; c++)
+                            {
+                                const T* plane = batch_data + c * in_size;
+                                double value = 0;
+                                for (size_t i = 0; i < 4; i++)
+                                {
+                                    value += sample.weight[i] * double(plane[sample.index[i]]);
+                                }
+                                size_t row = (c - first_channel) * kernel_size + k;
+                                batch_columns[row * out_size] = static_cast<T>(value);
+                            }
+                        }
+                    }
+                }
+            }
+
+            /// \brief Rows [begin, end) of `out` = `weights` [M, K] * `columns` [K, N]
+            template <typename T>
+            void deformable_convolution_gemm(const T* weights,
+                                             const T* columns,
+                                             T* out,
+                                             size_t n,
+                                             size_t k,
+                                             size_t begin,
+                                             size_t end)
+            {
+                for (size_t i = begin; i < end; i++)
+                {
+                    T* row = out + i * n;
+                    std::fill(row, row + n, T(0));
+                    for (size_t r = 0; r < k; r++)
+                    {
+                        T w = weights[i * k + r];
+                        const T* column_row = columns + r * n;
+                        for (size_t j = 0; j < n; j++)
+                        {
+                            row[j] += w * column_row[j];
+                        }
+                    }
+                }
+            }
+
+            /// \brief DeformableConvolution of [N, C, H, W] `data` with [O, C / group, KH, KW]
+            ///        `filters`, sampling the windows at `offsets`
+            template <typename T>
+            void deformable_convolution(const T* data,
+                                        const T* offsets,
+                                        const T* filters,
+                                        T* out,
+                                        const Shape& data_shape,
+                                        const Shape& filters_shape,
+                                        const Shape& out_shape,
+                                        const Strides& strides,
+                                        const Strides& dilations,
+                                        const CoordinateDiff& pads_begin,
+                                        size_t group,
+                                        size_t deformable_group)
+            {
+                DeformableConvolutionGeometry geometry(data_shape,
+                                                       filters_shape,
+                                                       out_shape,
+                                                       strides,
+                                                       dilations,
+                                                       pads_begin,
+                                                       group,
+                                                       deformable_group);
+                const size_t rows = geometry.column_rows();
+                const size_t out_size = geometry.out_size();
+                const size_t group_filters = geometry.filters / geometry.group;
+                std::vector<T> columns(geometry.batch * rows * out_size);
+                for (size_t g = 0; g < geometry.group; g++)
+                {
+                    deformable_im2col(data,
+                                      offsets,
+                                      columns.data(),
+                                      geometry,
+                                      g,
+                                      0,
+                                      geometry.batch * out_size);
+                    for (size_t n = 0; n < geometry.batch; n++)
+                    {
+                        deformable_convolution_gemm(
+                            filters + g * group_filters * rows,
+                            columns.data() + n * rows * out_size,
+                            out + (n * geometry.filters + g * group_filters) * out_size,
+                            out_size,
+                            rows,
+                            0,
+                            group_filters);
+                    }
+                }
+            }
+        }
+    }
+}
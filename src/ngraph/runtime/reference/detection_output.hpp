@@ -0,0 +1,411 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "ngraph/check.hpp"
+#include "ngraph/op/detection_output.hpp"
+#include "ngraph/runtime/reference/non_max_suppression.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Sizes of a DetectionOutput computation
+            struct DetectionOutputShape
+            {
+                size_t num_images;
+                size_t num_priors;
+                size_t num_classes;
+                size_t num_loc_classes;
+                size_t prior_size;
+                size_t priors_batch;
+                size_t priors_channels;
+            };
+
+            inline DetectionOutputShape
+                detection_output_shape(const op::DetectionOutputAttrs& attrs,
+                                       const Shape& box_logits_shape,
+                                       const Shape& proposals_shape)
+            {
+                DetectionOutputShape shape;
+                shape.num_images = box_logits_shape[0];
+                shape.num_classes = static_cast<size_t>(attrs.num_classes);
+                shape.num_loc_classes = attrs.share_location ? 1 : shape.num_classes;
+                shape.prior_size = attrs.normalized ? 4 : 5;
+                shape.priors_batch = proposals_shape[0];
+                shape.priors_channels = proposals_shape[1];
+                shape.num_priors = proposals_shape[2] / shape.prior_size;
+                NGRAPH_CHECK(attrs.variance_encoded_in_target || shape.priors_channels == 2,
+                             "DetectionOutput proposals need a variance channel unless the "
+                             "variance is encoded in the target");
+                return shape;
+            }
+
+            /// \brief Decoded boxes of one image and location class, in prior order
+            struct DetectionBoxes
+            {
+                std::vector<float> xmin;
+                std::vector<float> ymin;
+                std::vector<float> xmax;
+                std::vector<float> ymax;
+            };
+
+            namespace detail
+            {
+                struct DetectionBox
+                {
+                    float xmin;
+                    float ymin;
+                    float xmax;
+                    float ymax;
+                };
+
+                // Applies the regression loc to prior, both as [xmin, ymin, xmax, ymax]
+                inline DetectionBox decode_detection_box(const op::DetectionOutputAttrs& attrs,
+                                                         const DetectionBox& prior,
+                                                         const float* variance,
+                                                         const DetectionBox& loc)
+                {
+                    static const float unit_variance[4] = {1, 1, 1, 1};
+                    const float* var = attrs.variance_encoded_in_target ? unit_variance : variance;
+                    DetectionBox decoded;
+                    if (attrs.code_type == "caffe.PriorBoxParameter.CENTER_SIZE")
+                    {
+                        float prior_width = prior.xmax - prior.xmin;
+                        float prior_height = prior.ymax - prior.ymin;
+                        float prior_center_x = (prior.xmin + prior.xmax) / 2;
+                        float prior_center_y = (prior.ymin + prior.ymax) / 2;
+                        float center_x = var[0] * loc.xmin * prior_width + prior_center_x;
+                        float center_y = var[1] * loc.ymin * prior_height + prior_center_y;
+                        float width = std::exp(var[2] * loc.xmax) * prior_width;
+                        float height = std::exp(var[3] * loc.ymax) * prior_height;
+                        decoded.xmin = center_x - width / 2;
+                        decoded.ymin = center_y - height / 2;
+                        decoded.xmax = center_x + width / 2;
+                        decoded.ymax = center_y + height / 2;
+                    }
+                    else
+                    {
+                        decoded.xmin = prior.xmin + var[0] * loc.xmin;
+                        decoded.ymin = prior.ymin + var[1] * loc.ymin;
+                        decoded.xmax = prior.xmax + var[2] * loc.xmax;
+                        decoded.ymax = prior.ymax + var[3] * loc.ymax;
+                    }
+                    return decoded;
+                }
+
+                inline float clip_unit(float value)
+                {
+                    return std::min(std::max(value, 0.0f), 1.0f);
+                }
+
+                template <typename T>
+                DetectionBox load_detection_box(const T* data)
+                {
+                    return {static_cast<float>(data[0]),
+                            static_cast<float>(data[1]),
+                            static_cast<float>(data[2]),
+                            static_cast<float>(data[3])};
+                }
+            }
+
+            /// \brief Decodes the predicted boxes of one image and location class.
+            ///
+            /// \param arm_loc  Box refinements of the auxiliary input, applied to the priors
+            ///                 first, or nullptr
+            template <typename T>
+            void decode_detection_boxes(const T* box_logits,
+                                        const T* proposals,
+                                        const T* arm_loc,
+                                        const op::DetectionOutputAttrs& attrs,
+                                        const DetectionOutputShape& shape,
+                                        size_t image,
+                                        size_t loc_class,
+                                        DetectionBoxes& boxes)
+            {
+                size_t num_priors = shape.num_priors;
+                size_t prior_batch = shape.priors_batch == 1 ? 0 : image;
+                const T* priors =
+                    proposals + prior_batch * shape.priors_channels * num_priors * shape.prior_size;
+                const T* variances = priors + num_priors * shape.prior_size;
+                size_t offset = attrs.normalized ? 0 : 1;
+                float width_scale = attrs.normalized ? 1.0f : 1.0f / attrs.input_width;
+                float height_scale = attrs.normalized ? 1.0f : 1.0f / attrs.input_height;
+                boxes.xmin.resize(num_priors);
+                boxes.ymin.resize(num_priors);
+                boxes.xmax.resize(num_priors);
+                boxes.ymax.resize(num_priors);
+                for (size_t p = 0; p < num_priors; p++)
+                {
+                    detail::DetectionBox prior =
+                        detail::load_detection_box(priors + p * shape.prior_size + offset);
+                    prior.xmin *= width_scale;
+                    prior.ymin *= height_scale;
+                    prior.xmax *= width_scale;
+                    prior.ymax *= height_scale;
+                    float variance[4] = {0, 0, 0, 0};
+                    if (!attrs.variance_encoded_in_target)
+                    {
+                        for (size_t j = 0; j < 4; j++)
+                        {
+                            variance[j] = static_cast<float>(variances[p * 4 + j]);
+                        }
+                    }
+                    if (arm_loc)
+                    {
+                        prior = detail::decode_detection_box(
+                            attrs,
+                            prior,
+                            variance,
+                            detail::load_detection_box(arm_loc + (image * num_priors + p) * 4));
+                    }
+                    const T* loc =
+                        box_logits +
+                        ((image * num_priors + p) * shape.num_loc_classes + loc_class) * 4;
+                    detail::DetectionBox decoded = detail::decode_detection_box(
+                        attrs, prior, variance, detail::load_detection_box(loc));
+                    if (attrs.clip_before_nms)
+                    {
+                        decoded.xmin = detail::clip_unit(decoded.xmin);
+                        decoded.ymin = detail::clip_unit(decoded.ymin);
+                        decoded.xmax = detail::clip_unit(decoded.xmax);
+                        decoded.ymax = detail::clip_unit(decoded.ymax);
+                    }
+                    boxes.xmin[p] = decoded.xmin;
+                    boxes.ymin[p] = decoded.ymin;
+                    boxes.xmax[p] = decoded.xmax;
+                    boxes.ymax[p] = decoded.ymax;
+                }
+            }
+
+            /// \brief Runs the suppression of one image and class.
+            ///
+            /// \param arm_conf  Objectness of the auxiliary input, or nullptr. Priors whose
+            ///                  objectness is below attrs.objectness_score only score for the
+            ///                  background.
+            /// \param kept      Receives (score, prior) of the kept boxes, best first
+            template <typename T>
+            void detection_class_nms(const T* class_preds,
+                                     const T* arm_conf,
+                                     const DetectionBoxes& boxes,
+                                     const op::DetectionOutputAttrs& attrs,
+                                     const DetectionOutputShape& shape,
+                                     size_t image,
+                                     size_t cls,
+                                     NMSCandidates& candidates,
+                                     std::vector<std::pair<float, int64_t>>& kept)
+            {
+                kept.clear();
+                size_t num_priors = shape.num_priors;
+                bool background = static_cast<int>(cls) == attrs.background_label_id;
+                std::vector<std::pair<float, int64_t>> scored;
+                for (size_t p = 0; p < num_priors; p++)
+                {
+                    size_t prior = image * num_priors + p;
+                    float score;
+                    if (arm_conf &&
+                        static_cast<float>(arm_conf[prior * 2 + 1]) < attrs.objectness_score)
+                    {
+                        score = background ? 1.0f : 0.0f;
+                    }
+                    else
+                    {
+                        score = static_cast<float>(class_preds[prior * shape.num_classes + cls]);
+                    }
+                    if (score > attrs.confidence_threshold)
+                    {
+                        scored.emplace_back(score, static_cast<int64_t>(p));
+                    }
+                }
+                detail::sort_by_score(scored);
+                if (attrs.top_k > -1 && static_cast<size_t>(attrs.top_k) < scored.size())
+                {
+                    scored.resize(static_cast<size_t>(attrs.top_k));
+                }
+
+                candidates.clear();
+                for (const auto& entry : scored)
+                {
+                    size_t p = static_cast<size_t>(entry.second);
+                    candidates.push_back(
+                        boxes.xmin[p], boxes.ymin[p], boxes.xmax[p], boxes.ymax[p]);
+                }
+                std::vector<size_t> selected;
+                greedy_nms(candidates, attrs.nms_threshold, scored.size(), selected);
+                for (size_t position : selected)
+                {
+                    kept.push_back(scored[position]);
+                }
+            }
+
+            /// \brief Applies keep_top_k to the kept boxes of every image and writes the
+            ///        [image, label, score, xmin, ymin, xmax, ymax] rows of the output. The row
+            ///        after the last detection has image -1.
+            ///
+            /// \param kept   Kept boxes, indexed by image * num_classes + class
+            /// \param boxes  Decoded boxes, indexed by image * num_loc_classes + location class
+            template <typename T>
+            void detection_output_write(
+                const std::vector<std::vector<std::pair<float, int64_t>>>& kept,
+                const std::vector<DetectionBoxes>& boxes,
+                const op::DetectionOutputAttrs& attrs,
+                const DetectionOutputShape& shape,
+                T* out,
+                size_t out_rows)
+            {
+                struct Detection
+                {
+                    float score;
+                    size_t cls;
+                    size_t prior;
+                };
+                int keep_top_k = attrs.keep_top_k.empty() ? -1 : attrs.keep_top_k[0];
+                std::fill(out, out + out_rows * 7, T(0));
+                size_t count = 0;
+                std::vector<Detection> detections;
+                for (size_t image = 0; image < shape.num_images && count < out_rows; image++)
+                {
+                    detections.clear();
+                    for (size_t cls = 0; cls < shape.num_classes; cls++)
+                    {
+                        if (static_cast<int>(cls) == attrs.background_label_id)
+                        {
+                            continue;
+                        }
+                        for (const auto& entry : kept[image * shape.num_classes + cls])
+                        {
+                            detections.push_back(
+                                {entry.first, cls, static_cast<size_t>(entry.second)});
+                        }
+                    }
+                    if (keep_top_k > -1 && detections.size() > static_cast<size_t>(keep_top_k))
+                    {
+                        // Keep the best boxes over all classes, then restore the class order
+                        std::stable_sort(detections.begin(),
+                                         detections.end(),
+                                         [](const Detection& a, const Detection& b) {
+                                             return a.score > b.score;
+                                         });
+                        detections.resize(static_cast<size_t>(keep_top_k));
+                        std::stable_sort(detections.begin(),
+                                         detections.end(),
+                                         [](const Detection& a, const Detection& b) {
+                                             return a.cls < b.cls;
+                                         });
+                    }
+                    for (const Detection& detection : detections)
+                    {
+                        if (count == out_rows)
+                        {
+                            break;
+                        }
+                        size_t loc_class = attrs.share_location ? 0 : detection.cls;
+                        const DetectionBoxes& image_boxes =
+                            boxes[image * shape.num_loc_classes + loc_class];
+                        float coordinates[4] = {image_boxes.xmin[detection.prior],
+                                                image_boxes.ymin[detection.prior],
+                                                image_boxes.xmax[detection.prior],
+                                                image_boxes.ymax[detection.prior]};
+                        T* row = out + count * 7;
+                        row[0] = static_cast<T>(image);
+                        row[1] = static_cast<T>(attrs.decrease_label_id
+                                                    ? static_cast<int>(detection.cls) - 1
+                                                    : static_cast<int>(detection.cls));
+                        row[2] = static_cast<T>(detection.score);
+                        for (size_t j = 0; j < 4; j++)
+                        {
+                            row[3 + j] = static_cast<T>(attrs.clip_after_nms
+                                                            ? detail::clip_unit(coordinates[j])
+                                                            : coordinates[j]);
+                        }
+                        count++;
+                    }
+                }
+                if (count < out_rows)
+                {
+                    out[count * 7] = T(-1);
+                }
+            }
+
+            /// \param arm_conf  Optional auxiliary class predictions, or nullptr
+            /// \param arm_loc   Optional auxiliary box predictions, or nullptr
+            template <typename T>
+            void detection_output(const T* box_logits,
+                                  const T* class_preds,
+                                  const T* proposals,
+                                  const T* arm_conf,
+                                  const T* arm_loc,
+                                  T* out,
+                                  const op::DetectionOutputAttrs& attrs,
+                                  const Shape& box_logits_shape,
+                                  const Shape& proposals_shape,
+                                  const Shape& out_shape)
+            {
+                DetectionOutputShape shape =
+                    detection_output_shape(attrs, box_logits_shape, proposals_shape);
+                std::vector<DetectionBoxes> boxes(shape.num_images * shape.num_loc_classes);
+                for (size_t image = 0; image < shape.num_images; image++)
+                {
+                    for (size_t loc_class = 0; loc_class < shape.num_loc_classes; loc_class++)
+                    {
+                        decode_detection_boxes(box_logits,
+                                               proposals,
+                                               arm_loc,
+                                               attrs,
+                                               shape,
+                                               image,
+                                               loc_class,
+                                               boxes[image * shape.num_loc_classes + loc_class]);
+                    }
+                }
+                std::vector<std::vector<std::pair<float, int64_t>>> kept(shape.num_images *
+                                                                         shape.num_classes);
+                NMSCandidates candidates;
+                for (size_t image = 0; image < shape.num_images; image++)
+                {
+                    for (size_t cls = 0; cls < shape.num_classes; cls++)
+                    {
+                        if (static_cast<int>(cls) == attrs.background_label_id)
+                        {
+                            continue;
+                        }
+                        size_t loc_class = attrs.share_location ? 0 : cls;
+                        detection_class_nms(class_preds,
+                                            arm_conf,
+                                            boxes[image * shape.num_loc_classes + loc_class],
+                                            attrs,
+                                            shape,
+                                            image,
+                                            cls,
+                                            candidates,
+                                            kept[image * shape.num_classes + cls]);
+                    }
+                }
+                detection_output_write(kept, boxes, attrs, shape, out, shape_size(out_shape) / 7);
+            }
+        }
+    }
+}
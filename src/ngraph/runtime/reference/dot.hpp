@@ -18,11 +18,12 @@
 
 #include <cmath>
 #include <utility>
+#include <vector>
 
 #include <cfenv>
 #include <functional>
 #include "convolution.hpp"
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/blocked_gemm.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -56,114 +57,43 @@ namespace ngraph
                     is_quantized = true;
                 }
 
+                // Row major arguments are an [M, K] and a [K, N] matrix, where K spans the
+                // dotted axes, and the output is the [M, N] matrix product.
+                size_t k = shape_size(
+                    Shape(arg1_shape.begin(), arg1_shape.begin() + reduction_axes_count));
+                size_t m = shape_size(
+                    Shape(arg0_shape.begin(), arg0_shape.end() - reduction_axes_count));
+                size_t n = shape_size(
+                    Shape(arg1_shape.begin() + reduction_axes_count, arg1_shape.end()));
+
                 auto old_mode = std::fegetround();
                 std::fesetround(FE_TONEAREST);
-                // Get the sizes of the dot axes. It's easiest to pull them from arg1 because
-                // they're right up front.
-                Shape dot_axis_sizes(reduction_axes_count);
-                std::copy(arg1_shape.begin(),
-                          arg1_shape.begin() + reduction_axes_count,
-                          dot_axis_sizes.begin());
-
-                CoordinateTransform arg0_transform(arg0_shape);
-                CoordinateTransform arg1_transform(arg1_shape);
-                CoordinateTransform output_transform(out_shape);
-
-                // Create coordinate transforms for arg0 and arg1 that throw away the dotted axes.
-                size_t arg0_projected_rank = arg0_shape.size() - reduction_axes_count;
-                size_t arg1_projected_rank = arg1_shape.size() - reduction_axes_count;
-
-                Shape arg0_projected_shape(arg0_projected_rank);
-                std::copy(arg0_shape.begin(),
-                          arg0_shape.begin() + arg0_projected_rank,
-                          arg0_projected_shape.begin());
-
-                Shape arg1_projected_shape(arg1_projected_rank);
-                std::copy(arg1_shape.begin() + reduction_axes_count,
-                          arg1_shape.end(),
-                          arg1_projected_shape.begin());
-
-                CoordinateTransform arg0_projected_transform(arg0_projected_shape);
-                CoordinateTransform arg1_projected_transform(arg1_projected_shape);
-
-                // Create a coordinate transform that allows us to iterate over all possible values
-                // for the dotted axes.
-                CoordinateTransform dot_axes_transform(dot_axis_sizes);
-
-                for (const Coordinate& arg0_projected_coord : arg0_projected_transform)
+                if (!is_quantized)
                 {
-                    for (const Coordinate& arg1_projected_coord : arg1_projected_transform)
-                    {
-                        // The output coordinate is just the concatenation of the projected
-                        // coordinates.
-                        Coordinate out_coord(arg0_projected_coord.size() +
-                                             arg1_projected_coord.size());
-
-                        auto out_coord_it = std::copy(arg0_projected_coord.begin(),
-                                                      arg0_projected_coord.end(),
-                                                      out_coord.begin());
-                        std::copy(
-                            arg1_projected_coord.begin(), arg1_projected_coord.end(), out_coord_it);
-
-                        // Zero out to start the sum.
-                        ACCUMULATION sum = 0;
-
-                        size_t out_index = output_transform.index(out_coord);
-
-                        // Walk along the dotted axes.
-                        Coordinate arg0_coord(arg0_shape.size());
-                        Coordinate arg1_coord(arg1_shape.size());
-                        auto arg0_it = std::copy(arg0_projected_coord.begin(),
-                                                 arg0_projected_coord.end(),
-                                                 arg0_coord.begin());
-                        for (const Coordinate& dot_axis_positions : dot_axes_transform)
-                        {
-                            // In order to find the points to multiply together, we need to inject
-                            // our current positions along the dotted axes back into the projected
-                            // arg0 and arg1 coordinates.
-                            std::copy(
-                                dot_axis_positions.begin(), dot_axis_positions.end(), arg0_it);
-
-                            auto arg1_it = std::copy(dot_axis_positions.begin(),
-                                                     dot_axis_positions.end(),
-                                                     arg1_coord.begin());
-                            std::copy(
-                                arg1_projected_coord.begin(), arg1_projected_coord.end(), arg1_it);
-
-                            // Multiply and add to the sum.
-                            if (is_quantized)
-                            {
-                                sum = sum + ((static_cast<ACCUMULATION>(
-                                                  arg0[arg0_transform.index(arg0_coord)]) -
-                                              static_cast<ACCUMULATION>(*input0_zero_point)) *
-                                             (static_cast<ACCUMULATION>(
-                                                  arg1[arg1_transform.index(arg1_coord)]) -
-                                              static_cast<ACCUMULATION>(*input1_zero_point)));
-                            }
-                            else
-                            {
-                                sum = sum + (static_cast<ACCUMULATION>(
-                                                 arg0[arg0_transform.index(arg0_coord)]) *
-                                             static_cast<ACCUMULATION>(
-                                                 arg1[arg1_transform.index(arg1_coord)]));
-                            }
-                        }
-
-                        if (is_quantized)
-                        {
-                            float scale = *input0_scale * *input1_scale / *output_scale;
-                            // Write the sum back.
-                            out[out_index] =
-                                static_cast<OUTPUT>(std::round(static_cast<float>(sum) * scale)) +
-                                *output_zero_point;
-                        }
-                        else
-                        {
-                            out[out_index] = sum;
-                        }
-                    }
+                    blocked_gemm<INPUT0, INPUT1, OUTPUT, ACCUMULATION>(arg0, arg1, out, m, n, k);
                     std::fesetround(old_mode);
+                    return;
+                }
+
+                // The zero points are subtracted while widening, so the GEMM sums exact integer
+                // products and the requantization is fused into its write back
+                std::vector<ACCUMULATION> arg0_shifted(m * k);
+                for (size_t i = 0; i < arg0_shifted.size(); i++)
+                {
+                    arg0_shifted[i] = static_cast<ACCUMULATION>(arg0[i]) -
+                                      static_cast<ACCUMULATION>(*input0_zero_point);
+                }
+                std::vector<ACCUMULATION> arg1_shifted(k * n);
+                for (size_t i = 0; i < arg1_shifted.size(); i++)
+                {
+                    arg1_shifted[i] = static_cast<ACCUMULATION>(arg1[i]) -
+                                      static_cast<ACCUMULATION>(*input1_zero_point);
                 }
+                detail::GemmRequantize<ACCUMULATION, OUTPUT> requantize{
+                    *input0_scale * *input1_scale / *output_scale, *output_zero_point};
+                blocked_gemm<ACCUMULATION, ACCUMULATION, OUTPUT, ACCUMULATION>(
+                    arg0_shifted.data(), arg1_shifted.data(), out, m, n, k, requantize);
+                std::fesetround(old_mode);
             }
         }
     }
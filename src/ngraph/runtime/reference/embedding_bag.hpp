@@ -0,0 +1,237 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            namespace detail
+            {
+                // out = sum over i of weights[i] * emb_table[indices[i]], weights defaulting to 1.
+                // The row of the next index is prefetched while the current one is added.
+                template <typename T, typename U>
+                void pool_embedding_rows(const T* emb_table,
+                                         const U* indices,
+                                         const T* weights,
+                                         size_t count,
+                                         size_t row_size,
+                                         T* out)
+                {
+                    std::fill(out, out + row_size, T(0));
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        const T* row = emb_table + row_size * static_cast<size_t>(indices[i]);
+#if defined(__GNUC__)
+                        if (i + 1 < count)
+                        {
+                            __builtin_prefetch(emb_table +
+                                               row_size * static_cast<size_t>(indices[i + 1]));
+                        }
+#endif
+                        if (weights)
+                        {
+                            T weight = weights[i];
+                            for (size_t j = 0; j < row_size; j++)
+                            {
+                                out[j] += weight * row[j];
+                            }
+                        }
+                        else
+                        {
+                            for (size_t j = 0; j < row_size; j++)
+                            {
+                                out[j] += row[j];
+                            }
+                        }
+                    }
+                }
+
+                // An empty bag is the row at default_index, or zeros without one
+                template <typename T, typename U>
+                void fill_empty_bag(const T* emb_table,
+                                    const U* default_index,
+                                    size_t row_size,
+                                    T* out)
+                {
+                    if (default_index)
+                    {
+                        memcpy(out,
+                               emb_table + row_size * static_cast<size_t>(*default_index),
+                               row_size * sizeof(T));
+                    }
+                    else
+                    {
+                        std::fill(out, out + row_size, T(0));
+                    }
+                }
+            }
+
+            /// \brief Sums the embedding rows of each bag. Bag b pools indices[offsets[b]] up
+            ///        to the start of the next bag, the last bag ending at indices_count.
+            ///
+            /// Only the bags [bag_begin, bag_end) are computed, so that disjoint ranges can be
+            /// computed concurrently.
+            /// \param default_index Row used for empty bags, empty bags are zero if nullptr
+            /// \param per_sample_weights Scale of each index, or nullptr
+            template <typename T, typename U>
+            void embedding_bag_offsets_sum(const T* emb_table,
+                                           const U* indices,
+                                           const U* offsets,
+                                           const U* default_index,
+                                           const T* per_sample_weights,
+                                           T* out,
+                                           size_t indices_count,
+                                           const Shape& out_shape,
+                                           size_t bag_begin = 0,
+                                           size_t bag_end = std::numeric_limits<size_t>::max())
+            {
+                size_t bags = out_shape.at(0);
+                if (bags == 0)
+                {
+                    return;
+                }
+                size_t row_size = shape_size(out_shape) / bags;
+                bag_end = std::min(bag_end, bags);
+                for (size_t b = bag_begin; b < bag_end; b++)
+                {
+                    size_t begin = static_cast<size_t>(offsets[b]);
+                    size_t end = b + 1 < bags ? static_cast<size_t>(offsets[b + 1]) : indices_count;
+                    T* bag = out + b * row_size;
+                    if (begin >= end)
+                    {
+                        detail::fill_empty_bag(emb_table, default_index, row_size, bag);
+                    }
+                    else
+                    {
+                        detail::pool_embedding_rows(
+                            emb_table,
+                            indices + begin,
+                            per_sample_weights ? per_sample_weights + begin : nullptr,
+                            end - begin,
+                            row_size,
+                            bag);
+                    }
+                }
+            }
+
+            /// \brief Sums the embedding rows of each bag, bag b pooling row b of the
+            ///        [bags, indices_per_bag] indices. See embedding_bag_offsets_sum for
+            ///        bag_begin and bag_end.
+            template <typename T, typename U>
+            void embedding_bag_packed_sum(const T* emb_table,
+                                          const U* indices,
+                                          const T* per_sample_weights,
+                                          T* out,
+                                          const Shape& indices_shape,
+                                          const Shape& out_shape,
+                                          size_t bag_begin = 0,
+                                          size_t bag_end = std::numeric_limits<size_t>::max())
+            {
+                size_t bags = out_shape.at(0);
+                if (bags == 0)
+                {
+                    return;
+                }
+                size_t row_size = shape_size(out_shape) / bags;
+                size_t indices_per_bag = indices_shape.at(1);
+                bag_end = std::min(bag_end, bags);
+                for (size_t b = bag_begin; b < bag_end; b++)
+                {
+                    size_t begin = b * indices_per_bag;
+                    detail::pool_embedding_rows(
+                        emb_table,
+                        indices + begin,
+                        per_sample_weights ? per_sample_weights + begin : nullptr,
+                        indices_per_bag,
+                        row_size,
+                        out + b * row_size);
+                }
+            }
+
+            /// \brief Sums the embedding rows of each segment, index i belonging to segment
+            ///        segment_ids[i]. Only the segments [segment_begin, segment_end) are
+            ///        computed. Segment ids need not be sorted.
+            /// \param default_index Row used for empty segments, empty segments are zero if
+            ///        nullptr
+            /// \param per_sample_weights Scale of each index, or nullptr
+            template <typename T, typename U>
+            void embedding_segments_sum(
+                const T* emb_table,
+                const U* indices,
+                const U* segment_ids,
+                const U* default_index,
+                const T* per_sample_weights,
+                T* out,
+                size_t indices_count,
+                const Shape& out_shape,
+                size_t segment_begin = 0,
+                size_t segment_end = std::numeric_limits<size_t>::max())
+            {
+                size_t segments = out_shape.at(0);
+                if (segments == 0)
+                {
+                    return;
+                }
+                size_t row_size = shape_size(out_shape) / segments;
+                segment_end = std::min(segment_end, segments);
+                if (segment_begin >= segment_end)
+                {
+                    return;
+                }
+                std::vector<bool> filled(segment_end - segment_begin, false);
+                for (size_t i = 0; i < indices_count; i++)
+                {
+                    size_t segment = static_cast<size_t>(segment_ids[i]);
+                    if (segment < segment_begin || segment >= segment_end)
+                    {
+                        continue;
+                    }
+                    T* target = out + segment * row_size;
+                    const T* row = emb_table + row_size * static_cast<size_t>(indices[i]);
+                    T weight = per_sample_weights ? per_sample_weights[i] : T(1);
+                    if (!filled[segment - segment_begin])
+                    {
+                        filled[segment - segment_begin] = true;
+                        std::fill(target, target + row_size, T(0));
+                    }
+                    for (size_t j = 0; j < row_size; j++)
+                    {
+                        target[j] += weight * row[j];
+                    }
+                }
+                for (size_t s = segment_begin; s < segment_end; s++)
+                {
+                    if (!filled[s - segment_begin])
+                    {
+                        detail::fill_empty_bag(
+                            emb_table, default_index, row_size, out + s * row_size);
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,95 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+#include "ngraph/check.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief GatherTree of beams [begin, end), a beam being one of the
+            ///        `shape[2]` beams of one of the `shape[1]` batch elements.
+            ///
+            /// Each beam is traced back from its last step through `parent_ids`, collecting
+            /// the ids of the steps on its path. Steps past the length of the sequence, and
+            /// steps after the first `end_token` of the beam, become `end_token`.
+            template <typename T, typename L>
+            void gather_tree(const T* step_ids,
+                             const T* parent_ids,
+                             const L* max_seq_len,
+                             T end_token,
+                             T* out,
+                             const Shape& shape,
+                             size_t begin,
+                             size_t end)
+            {
+                const size_t max_time = shape[0];
+                const size_t batch_size = shape[1];
+                const size_t beam_width = shape[2];
+                const size_t time_stride = batch_size * beam_width;
+                for (size_t item = begin; item < end; item++)
+                {
+                    size_t batch = item / beam_width;
+                    size_t beam = item % beam_width;
+                    T* beam_out = out + item;
+                    const std::ptrdiff_t length = std::min(
+                        std::ptrdiff_t(max_time),
+                        std::max(std::ptrdiff_t(0), std::ptrdiff_t(max_seq_len[batch])));
+                    for (size_t time = size_t(length); time < max_time; time++)
+                    {
+                        beam_out[time * time_stride] = end_token;
+                    }
+
+                    size_t parent = beam;
+                    for (std::ptrdiff_t time = length - 1; time >= 0; time--)
+                    {
+                        size_t index = size_t(time) * time_stride + batch * beam_width + parent;
+                        beam_out[size_t(time) * time_stride] = step_ids[index];
+                        std::ptrdiff_t next = std::ptrdiff_t(parent_ids[index]);
+                        NGRAPH_CHECK(next >= 0 && size_t(next) < beam_width,
+                                     "GatherTree parent index ",
+                                     next,
+                                     " is out of the range of the beam width ",
+                                     beam_width);
+                        parent = size_t(next);
+                    }
+
+                    bool finished = false;
+                    for (size_t time = 0; time < size_t(length); time++)
+                    {
+                        T& value = beam_out[time * time_stride];
+                        if (finished)
+                        {
+                            value = end_token;
+                        }
+                        else if (value == end_token)
+                        {
+                            finished = true;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
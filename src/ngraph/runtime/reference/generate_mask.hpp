@@ -16,8 +16,6 @@
 
 #pragma once
 
-#include <random>
-
 #include "ngraph/state/bernoulli_rng_state.hpp"
 
 namespace ngraph
@@ -26,32 +24,53 @@ namespace ngraph
     {
         namespace reference
         {
+            /// \brief Fills out[begin, end) with Bernoulli trials of probability `prob` on the
+            ///        numbers of `generator` from position offset + begin on, or with ones when
+            ///        not training. The values of a range do not depend on how the output is
+            ///        split into ranges.
+            template <typename T>
+            void generate_mask_range(T* out,
+                                     size_t begin,
+                                     size_t end,
+                                     bool training,
+                                     const Philox& generator,
+                                     uint64_t offset,
+                                     double prob)
+            {
+                if (!training)
+                {
+                    for (size_t i = begin; i < end; i++)
+                    {
+                        out[i] = static_cast<T>(1);
+                    }
+                    return;
+                }
+                generator.generate_uniform(
+                    offset + begin, offset + end, [&](uint64_t position, double u) {
+                        out[position - offset] = static_cast<T>(u < prob ? 1 : 0);
+                    });
+            }
+
             template <typename T>
             void generate_mask(T* out,
                                size_t count,
                                ngraph::BernoulliRNGState* rng_state,
                                bool training)
             {
-                auto& gen = rng_state->get_generator();
-                auto& bd = rng_state->get_distribution();
-
-                for (size_t i = 0; i < count; i++)
-                {
-                    out[i] = training ? static_cast<T>(bd(gen)) : static_cast<T>(1);
-                }
+                generate_mask_range(out,
+                                    0,
+                                    count,
+                                    training,
+                                    rng_state->get_generator(),
+                                    training ? rng_state->advance(count) : 0,
+                                    rng_state->get_probability());
             }
 
             template <typename T>
             void generate_mask_no_state(
                 T* out, size_t count, bool training, uint32_t seed, double prob)
             {
-                std::mt19937 gen(seed);
-                std::bernoulli_distribution bd(prob);
-
-                for (size_t i = 0; i < count; i++)
-                {
-                    out[i] = training ? static_cast<T>(bd(gen)) : static_cast<T>(1);
-                }
+                generate_mask_range(out, 0, count, training, Philox(seed), 0, prob);
             }
         }
     }
@@ -0,0 +1,50 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cmath>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/op/util/attr_types.hpp"
+#include "ngraph/runtime/reference/normalize_l2.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Global response normalization, out = arg / sqrt(sum of arg^2 over the
+            ///        channels + bias).
+            ///
+            /// Like the decomposition of the op the data is seen as a 4D tensor padded with
+            /// leading unit axes, so the channel axis of a 3D tensor is its first axis and a
+            /// 2D tensor has no channels to sum over.
+            template <typename T>
+            void grn(const T* arg, T* out, const Shape& arg_shape, float bias)
+            {
+                AxisSet channel_axis;
+                if (arg_shape.size() >= 3)
+                {
+                    channel_axis.insert(arg_shape.size() - 3);
+                }
+                normalize_l2(arg, out, arg_shape, channel_axis, bias, op::EpsMode::ADD);
+            }
+        }
+    }
+}
@@ -0,0 +1,495 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include "ngraph/check.hpp"
+#include "ngraph/op/interpolate.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief How the values along one interpolated axis are computed: every output index
+            ///        is a weighted sum of `taps` input indices. An index of -1 is a tap that
+            ///        falls in the padding and contributes nothing.
+            ///
+            /// Interpolation is separable, so a resize over several axes is a sequence of one
+            /// axis passes, each driven by the table of its axis. The tables only depend on the
+            /// shapes and the attributes and are built once for a given shape.
+            struct InterpolateAxisTable
+            {
+                size_t axis;
+                size_t input_size;
+                size_t output_size;
+                size_t taps;
+                bool nearest;
+                std::vector<int64_t> index;
+                std::vector<float> weight;
+            };
+
+            /// \brief The attributes of a v0 Interpolate expressed as v3 attributes. Nearest
+            ///        without aligned corners picks floor(i / scale), every other mode samples
+            ///        the centres of the pixels.
+            inline op::v3::Interpolate::InterpolateAttrs
+                interpolate_attrs(const op::v0::InterpolateAttrs& attrs)
+            {
+                using v3 = op::v3::Interpolate;
+                v3::InterpolateAttrs result;
+                result.axes = attrs.axes;
+                if (attrs.mode == "nearest")
+                {
+                    result.mode = v3::InterpolateMode::nearest;
+                }
+                else if (attrs.mode == "linear")
+                {
+                    result.mode = v3::InterpolateMode::linear;
+                }
+                else if (attrs.mode == "cubic")
+                {
+                    result.mode = v3::InterpolateMode::cubic;
+                }
+                else if (attrs.mode == "area")
+                {
+                    result.mode = v3::InterpolateMode::area;
+                }
+                else
+                {
+                    NGRAPH_CHECK(false, "Unsupported interpolation mode: ", attrs.mode);
+                }
+                if (attrs.align_corners)
+                {
+                    result.coordinate_transformation_mode =
+                        v3::CoordinateTransformMode::align_corners;
+                    result.nearest_mode = v3::NearestMode::round_prefer_floor;
+                }
+                else if (result.mode == v3::InterpolateMode::nearest)
+                {
+                    result.coordinate_transformation_mode = v3::CoordinateTransformMode::asymmetric;
+                    result.nearest_mode = v3::NearestMode::floor;
+                }
+                else
+                {
+                    result.coordinate_transformation_mode = v3::CoordinateTransformMode::half_pixel;
+                }
+                result.antialias = attrs.antialias;
+                result.pads_begin = attrs.pads_begin;
+                result.pads_end = attrs.pads_end;
+                return result;
+            }
+
+            /// \brief The coordinate in the (padded) input that output index `o` samples
+            inline double
+                interpolate_source_coordinate(op::v3::Interpolate::CoordinateTransformMode mode,
+                                              size_t o,
+                                              double scale,
+                                              size_t input_size,
+                                              size_t output_size)
+            {
+                using Mode = op::v3::Interpolate::CoordinateTransformMode;
+                double x = static_cast<double>(o);
+                switch (mode)
+                {
+                case Mode::half_pixel: return (x + 0.5) / scale - 0.5;
+                case Mode::pytorch_half_pixel:
+                    return output_size > 1 ? (x + 0.5) / scale - 0.5 : 0.0;
+                case Mode::asymmetric: return x / scale;
+                case Mode::tf_half_pixel_for_nn: return (x + 0.5) / scale;
+                case Mode::align_corners:
+                    return output_size == 1
+                               ? 0.0
+                               : x * static_cast<double>(input_size - 1) /
+                                     static_cast<double>(output_size - 1);
+                }
+                return x / scale;
+            }
+
+            /// \brief Rounds the source coordinate `x` to an index in [0, last]. Coordinates
+            ///        outside the input, such as those of the asymmetric and half pixel modes
+            ///        near the edges, round to the nearest edge.
+            inline int64_t interpolate_nearest_index(op::v3::Interpolate::NearestMode mode,
+                                                     double x,
+                                                     double scale,
+                                                     int64_t last)
+            {
+                using Mode = op::v3::Interpolate::NearestMode;
+                double rounded = std::floor(x);
+                switch (mode)
+                {
+                case Mode::round_prefer_floor: rounded = std::ceil(x - 0.5); break;
+                case Mode::round_prefer_ceil: rounded = std::floor(x + 0.5); break;
+                case Mode::floor: rounded = std::floor(x); break;
+                case Mode::ceil: rounded = std::ceil(x); break;
+                case Mode::simple: rounded = scale < 1.0 ? std::ceil(x) : std::floor(x); break;
+                }
+                // Clamped before the conversion, which is undefined for values out of range
+                return static_cast<int64_t>(
+                    std::min(std::max(rounded, 0.0), static_cast<double>(last)));
+            }
+
+            /// \brief Weight of the cubic convolution kernel at distance `d`
+            inline double interpolate_cubic_weight(double d, double a)
+            {
+                d = std::abs(d);
+                if (d <= 1.0)
+                {
+                    return ((a + 2.0) * d - (a + 3.0)) * d * d + 1.0;
+                }
+                if (d < 2.0)
+                {
+                    return ((a * d - 5.0 * a) * d + 8.0 * a) * d - 4.0 * a;
+                }
+                return 0.0;
+            }
+
+            /// \brief Builds the table of one axis. `input_size` does not include the padding.
+            inline InterpolateAxisTable
+                make_interpolate_table(const op::v3::Interpolate::InterpolateAttrs& attrs,
+                                       size_t axis,
+                                       size_t input_size,
+                                       size_t pad_begin,
+                                       size_t pad_end,
+                                       size_t output_size)
+            {
+                using Mode = op::v3::Interpolate::InterpolateMode;
+                size_t padded_size = input_size + pad_begin + pad_end;
+                NGRAPH_CHECK(padded_size > 0, "Interpolate needs a non-empty input axis");
+                int64_t last = static_cast<int64_t>(padded_size) - 1;
+                double scale = static_cast<double>(output_size) / padded_size;
+                bool antialias = attrs.antialias && scale < 1.0;
+
+                InterpolateAxisTable table;
+                table.axis = axis;
+                table.input_size = input_size;
+                table.output_size = output_size;
+                table.nearest = attrs.mode == Mode::nearest;
+                switch (attrs.mode)
+                {
+                case Mode::nearest: table.taps = 1; break;
+                case Mode::linear:
+                case Mode::linear_onnx:
+                    table.taps =
+                        antialias ? 2 * static_cast<size_t>(std::ceil(1.0 / scale)) + 1 : 2;
+                    break;
+                case Mode::cubic: table.taps = 4; break;
+                case Mode::area:
+                    table.taps = static_cast<size_t>(std::ceil(1.0 / scale)) + 1;
+                    break;
+                }
+                table.index.assign(output_size * table.taps, -1);
+                table.weight.assign(output_size * table.taps, 0.0f);
+
+                for (size_t o = 0; o < output_size; o++)
+                {
+                    int64_t* index = &table.index[o * table.taps];
+                    float* weight = &table.weight[o * table.taps];
+                    size_t tap = 0;
+                    auto add_tap = [&](int64_t padded_index, double w) {
+                        index[tap] = padded_index;
+                        weight[tap] = static_cast<float>(w);
+                        tap++;
+                    };
+                    if (attrs.mode == Mode::area)
+                    {
+                        double begin = o / scale;
+                        double end = std::min((o + 1) / scale, static_cast<double>(padded_size));
+                        for (int64_t i = static_cast<int64_t>(std::floor(begin));
+                             i < static_cast<int64_t>(std::ceil(end)) && tap < table.taps;
+                             i++)
+                        {
+                            double overlap = std::min(end, i + 1.0) - std::max(begin, double(i));
+                            add_tap(i, overlap / (end - begin));
+                        }
+                    }
+                    else
+                    {
+                        double x = interpolate_source_coordinate(
+                            attrs.coordinate_transformation_mode,
+                            o,
+                            scale,
+                            padded_size,
+                            output_size);
+                        if (attrs.mode == Mode::nearest)
+                        {
+                            add_tap(
+                                interpolate_nearest_index(attrs.nearest_mode, x, scale, last),
+                                1.0);
+                        }
+                        else if (attrs.mode == Mode::cubic)
+                        {
+                            int64_t i = static_cast<int64_t>(std::floor(x));
+                            double t = x - i;
+                            for (int64_t k = -1; k <= 2; k++)
+                            {
+                                add_tap(std::min(std::max(i + k, int64_t(0)), last),
+                                        interpolate_cubic_weight(t - k, attrs.cube_coeff));
+                            }
+                        }
+                        else if (antialias)
+                        {
+                            // A triangle filter stretched by the downscaling factor, normalized
+                            // over the taps that fall inside the input
+                            double support = 1.0 / scale;
+                            double sum = 0.0;
+                            for (int64_t i = static_cast<int64_t>(std::ceil(x - support));
+                                 i <= static_cast<int64_t>(std::floor(x + support)) &&
+                                 tap < table.taps;
+                                 i++)
+                            {
+                                double w = 1.0 - std::abs(x - i) * scale;
+                                if (i >= 0 && i <= last && w > 0.0)
+                                {
+                                    add_tap(i, w);
+                                    sum += w;
+                                }
+                            }
+                            for (size_t k = 0; k < tap; k++)
+                            {
+                                weight[k] = static_cast<float>(weight[k] / sum);
+                            }
+                        }
+                        else
+                        {
+                            x = std::min(std::max(x, 0.0), static_cast<double>(last));
+                            int64_t i = static_cast<int64_t>(std::floor(x));
+                            double t = x - i;
+                            add_tap(i, 1.0 - t);
+                            add_tap(std::min(i + 1, last), t);
+                        }
+                    }
+                    // Taps in the padding are zeros; the rest move to unpadded indices
+                    for (size_t k = 0; k < tap; k++)
+                    {
+                        int64_t i = index[k] - static_cast<int64_t>(pad_begin);
+                        index[k] = i >= 0 && i < static_cast<int64_t>(input_size) ? i : -1;
+                    }
+                }
+                return table;
+            }
+
+            /// \brief Builds the tables of all the axes that change a resize of `input_shape`
+            ///        to `output_shape`, in the order the passes run: axes that shrink first,
+            ///        so that the later passes work on less data. The pads are indexed by the
+            ///        axes of the input; pads of the axes that are not interpolated are ignored
+            ///        like in the shape inference.
+            inline std::vector<InterpolateAxisTable>
+                make_interpolate_tables(const op::v3::Interpolate::InterpolateAttrs& attrs,
+                                        const Shape& input_shape,
+                                        const Shape& output_shape)
+            {
+                std::vector<InterpolateAxisTable> tables;
+                for (size_t axis : attrs.axes)
+                {
+                    size_t pad_begin = axis < attrs.pads_begin.size() ? attrs.pads_begin[axis] : 0;
+                    size_t pad_end = axis < attrs.pads_end.size() ? attrs.pads_end[axis] : 0;
+                    auto table = make_interpolate_table(attrs,
+                                                        axis,
+                                                        input_shape[axis],
+                                                        pad_begin,
+                                                        pad_end,
+                                                        output_shape[axis]);
+                    // An axis that keeps its size often samples each input index exactly
+                    bool identity = table.input_size == table.output_size;
+                    for (size_t o = 0; identity && o < table.output_size; o++)
+                    {
+                        float own = 0.0f;
+                        for (size_t k = 0; k < table.taps; k++)
+                        {
+                            size_t t = o * table.taps + k;
+                            if (table.index[t] == static_cast<int64_t>(o))
+                            {
+                                own += table.weight[t];
+                            }
+                            else
+                            {
+                                identity = identity && table.weight[t] == 0.0f;
+                            }
+                        }
+                        identity = identity && own == 1.0f;
+                    }
+                    if (!identity)
+                    {
+                        tables.push_back(std::move(table));
+                    }
+                }
+                std::stable_sort(tables.begin(),
+                                 tables.end(),
+                                 [](const InterpolateAxisTable& a, const InterpolateAxisTable& b) {
+                                     return a.output_size * b.input_size <
+                                            b.output_size * a.input_size;
+                                 });
+                return tables;
+            }
+
+            /// \brief The tensor seen by a pass as [rows, inner]: a row is one output index of
+            ///        the axis for one index of the axes before it
+            inline size_t interpolate_inner_size(const Shape& shape, size_t axis)
+            {
+                size_t inner = 1;
+                for (size_t i = axis + 1; i < shape.size(); i++)
+                {
+                    inner *= shape[i];
+                }
+                return inner;
+            }
+
+            inline size_t interpolate_rows(const Shape& shape, const InterpolateAxisTable& table)
+            {
+                size_t outer = 1;
+                for (size_t i = 0; i < table.axis; i++)
+                {
+                    outer *= shape[i];
+                }
+                return outer * table.output_size;
+            }
+
+            namespace detail
+            {
+                template <typename T>
+                void interpolate_row(const T* src,
+                                     T* dst,
+                                     size_t inner,
+                                     const int64_t* index,
+                                     const float* weight,
+                                     size_t taps,
+                                     std::true_type /* floating point */)
+                {
+                    std::fill(dst, dst + inner, T(0));
+                    for (size_t k = 0; k < taps; k++)
+                    {
+                        if (index[k] < 0)
+                        {
+                            continue;
+                        }
+                        const T* s = src + index[k] * inner;
+                        T w = static_cast<T>(weight[k]);
+                        for (size_t j = 0; j < inner; j++)
+                        {
+                            dst[j] += w * s[j];
+                        }
+                    }
+                }
+
+                template <typename T>
+                void interpolate_row(const T* src,
+                                     T* dst,
+                                     size_t inner,
+                                     const int64_t* index,
+                                     const float* weight,
+                                     size_t taps,
+                                     std::false_type /* floating point */)
+                {
+                    for (size_t j = 0; j < inner; j++)
+                    {
+                        float sum = 0.0f;
+                        for (size_t k = 0; k < taps; k++)
+                        {
+                            if (index[k] >= 0)
+                            {
+                                sum += weight[k] * static_cast<float>(src[index[k] * inner + j]);
+                            }
+                        }
+                        dst[j] = static_cast<T>(std::round(sum));
+                    }
+                }
+            }
+
+            /// \brief One pass over rows [row_begin, row_end) of the resize of `table.axis`.
+            ///        `shape` is the shape of `arg`. The rows are independent, so a pass can be
+            ///        split between threads; each row is a sum of contiguous input rows.
+            template <typename T>
+            void interpolate_axis(const T* arg,
+                                  T* out,
+                                  const Shape& shape,
+                                  const InterpolateAxisTable& table,
+                                  size_t row_begin,
+                                  size_t row_end)
+            {
+                size_t inner = interpolate_inner_size(shape, table.axis);
+                for (size_t r = row_begin; r < row_end; r++)
+                {
+                    size_t o = r % table.output_size;
+                    const T* src = arg + (r / table.output_size) * table.input_size * inner;
+                    T* dst = out + r * inner;
+                    const int64_t* index = &table.index[o * table.taps];
+                    if (table.nearest)
+                    {
+                        if (index[0] < 0)
+                        {
+                            std::fill(dst, dst + inner, T(0));
+                        }
+                        else
+                        {
+                            std::memcpy(dst, src + index[0] * inner, inner * sizeof(T));
+                        }
+                    }
+                    else
+                    {
+                        detail::interpolate_row(src,
+                                                dst,
+                                                inner,
+                                                index,
+                                                &table.weight[o * table.taps],
+                                                table.taps,
+                                                std::is_floating_point<T>());
+                    }
+                }
+            }
+
+            /// \brief Runs the passes of `tables` on `arg`
+            template <typename T>
+            void interpolate(const T* arg,
+                             T* out,
+                             const Shape& arg_shape,
+                             const std::vector<InterpolateAxisTable>& tables)
+            {
+                if (tables.empty())
+                {
+                    std::memcpy(out, arg, shape_size(arg_shape) * sizeof(T));
+                    return;
+                }
+                std::vector<T> buffers[2];
+                Shape shape = arg_shape;
+                const T* src = arg;
+                for (size_t k = 0; k < tables.size(); k++)
+                {
+                    const auto& table = tables[k];
+                    Shape next = shape;
+                    next[table.axis] = table.output_size;
+                    T* dst = out;
+                    if (k + 1 < tables.size())
+                    {
+                        buffers[k % 2].resize(shape_size(next));
+                        dst = buffers[k % 2].data();
+                    }
+                    interpolate_axis(src, dst, shape, table, 0, interpolate_rows(shape, table));
+                    src = dst;
+                    shape = next;
+                }
+            }
+        }
+    }
+}
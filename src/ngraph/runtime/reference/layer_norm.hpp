@@ -0,0 +1,113 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            namespace detail
+            {
+                // Mean and population variance of count contiguous values in a single pass
+                // with Welford's update, which stays accurate on rows with a large mean
+                template <typename T>
+                void welford_mean_variance(const T* arg, size_t count, T& mean, T& variance)
+                {
+                    T m = 0;
+                    T m2 = 0;
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        T delta = arg[i] - m;
+                        m += delta / static_cast<T>(i + 1);
+                        m2 += delta * (arg[i] - m);
+                    }
+                    mean = m;
+                    variance = count == 0 ? 0 : m2 / static_cast<T>(count);
+                }
+            }
+
+            /// \brief Layer normalization of the rows [row_begin, row_end) of arg, a row being
+            ///        the elements of the axes from begin_norm_axis on.
+            ///
+            /// out = (arg - mean) / sqrt(variance + epsilon) * scale + bias, where scale and
+            /// bias hold one value per element of a row and may be null when the op has no
+            /// affine transformation. mean and variance receive the statistics of each row
+            /// when not null.
+            template <typename T>
+            void layer_norm(const T* arg,
+                            const T* scale,
+                            const T* bias,
+                            T* out,
+                            T* mean,
+                            T* variance,
+                            const Shape& arg_shape,
+                            size_t begin_norm_axis,
+                            double epsilon,
+                            size_t row_begin = 0,
+                            size_t row_end = std::numeric_limits<size_t>::max())
+            {
+                size_t rows = 1;
+                for (size_t i = 0; i < begin_norm_axis; i++)
+                {
+                    rows *= arg_shape[i];
+                }
+                size_t row_size = rows == 0 ? 0 : shape_size(arg_shape) / rows;
+                row_end = std::min(row_end, rows);
+                for (size_t row = row_begin; row < row_end; row++)
+                {
+                    const T* in_row = arg + row * row_size;
+                    T* out_row = out + row * row_size;
+                    T row_mean;
+                    T row_variance;
+                    detail::welford_mean_variance(in_row, row_size, row_mean, row_variance);
+                    T inv_stddev = static_cast<T>(1) / std::sqrt(row_variance + epsilon);
+                    if (scale && bias)
+                    {
+                        for (size_t i = 0; i < row_size; i++)
+                        {
+                            out_row[i] = (in_row[i] - row_mean) * inv_stddev * scale[i] + bias[i];
+                        }
+                    }
+                    else
+                    {
+                        for (size_t i = 0; i < row_size; i++)
+                        {
+                            out_row[i] = (in_row[i] - row_mean) * inv_stddev;
+                        }
+                    }
+                    if (mean)
+                    {
+                        mean[row] = row_mean;
+                    }
+                    if (variance)
+                    {
+                        variance[row] = row_variance;
+                    }
+                }
+            }
+        }
+    }
+}
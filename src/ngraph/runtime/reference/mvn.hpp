@@ -0,0 +1,162 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/runtime/reference/layer_norm.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            namespace detail
+            {
+                // Calls f(i, r) for every element i of a tensor of the given shape in row-major
+                // order, r being the index of the element it reduces to when the axes are
+                // reduced away
+                template <typename F>
+                void for_each_reduced_index(const Shape& shape, const AxisSet& axes, F f)
+                {
+                    size_t rank = shape.size();
+                    std::vector<size_t> reduced_strides(rank, 0);
+                    size_t stride = 1;
+                    for (size_t axis = rank; axis-- > 0;)
+                    {
+                        if (axes.count(axis) == 0)
+                        {
+                            reduced_strides[axis] = stride;
+                            stride *= shape[axis];
+                        }
+                    }
+                    std::vector<size_t> coord(rank, 0);
+                    size_t count = shape_size(shape);
+                    size_t r = 0;
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        f(i, r);
+                        for (size_t axis = rank; axis-- > 0;)
+                        {
+                            r += reduced_strides[axis];
+                            if (++coord[axis] < shape[axis])
+                            {
+                                break;
+                            }
+                            r -= reduced_strides[axis] * coord[axis];
+                            coord[axis] = 0;
+                        }
+                    }
+                }
+
+                // Whether the reduction axes are exactly the trailing axes of the shape, the
+                // first of which is then returned in begin_axis
+                inline bool
+                    trailing_reduction(const Shape& shape, const AxisSet& axes, size_t& begin_axis)
+                {
+                    begin_axis = shape.size() - axes.size();
+                    for (size_t axis : axes)
+                    {
+                        if (axis < begin_axis)
+                        {
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+            }
+
+            /// \brief Mean variance normalization of arg over the reduction axes.
+            ///
+            /// out = arg - mean, divided by sqrt(variance) + eps when normalize_variance is
+            /// set. When the reduction axes are the trailing axes of the shape the rows of
+            /// normalized elements are contiguous and [row_begin, row_end) selects the rows
+            /// to compute; otherwise the whole tensor is normalized in one call.
+            template <typename T>
+            void mvn(const T* arg,
+                     T* out,
+                     const Shape& arg_shape,
+                     const AxisSet& reduction_axes,
+                     bool normalize_variance,
+                     double eps,
+                     size_t row_begin = 0,
+                     size_t row_end = std::numeric_limits<size_t>::max())
+            {
+                size_t begin_axis;
+                if (detail::trailing_reduction(arg_shape, reduction_axes, begin_axis))
+                {
+                    size_t rows = 1;
+                    for (size_t i = 0; i < begin_axis; i++)
+                    {
+                        rows *= arg_shape[i];
+                    }
+                    size_t row_size = rows == 0 ? 0 : shape_size(arg_shape) / rows;
+                    row_end = std::min(row_end, rows);
+                    for (size_t row = row_begin; row < row_end; row++)
+                    {
+                        const T* in_row = arg + row * row_size;
+                        T* out_row = out + row * row_size;
+                        T mean;
+                        T variance;
+                        detail::welford_mean_variance(in_row, row_size, mean, variance);
+                        T scale = normalize_variance
+                                      ? static_cast<T>(1) / (std::sqrt(variance) + T(eps))
+                                      : static_cast<T>(1);
+                        for (size_t i = 0; i < row_size; i++)
+                        {
+                            out_row[i] = (in_row[i] - mean) * scale;
+                        }
+                    }
+                    return;
+                }
+
+                // The normalized elements are strided; one pass of Welford's update per
+                // element into the state of its reduced slot, then one pass to normalize
+                size_t slots = 1;
+                for (size_t i = 0; i < arg_shape.size(); i++)
+                {
+                    slots *= reduction_axes.count(i) == 0 ? arg_shape[i] : 1;
+                }
+                std::vector<T> mean(slots, 0);
+                std::vector<T> m2(slots, 0);
+                std::vector<size_t> count(slots, 0);
+                detail::for_each_reduced_index(arg_shape, reduction_axes, [&](size_t i, size_t r) {
+                    T delta = arg[i] - mean[r];
+                    mean[r] += delta / static_cast<T>(++count[r]);
+                    m2[r] += delta * (arg[i] - mean[r]);
+                });
+                for (size_t r = 0; r < slots; r++)
+                {
+                    m2[r] = normalize_variance && count[r] != 0
+                                ? static_cast<T>(1) /
+                                      (std::sqrt(m2[r] / static_cast<T>(count[r])) + T(eps))
+                                : static_cast<T>(1);
+                }
+                detail::for_each_reduced_index(arg_shape, reduction_axes, [&](size_t i, size_t r) {
+                    out[i] = (arg[i] - mean[r]) * m2[r];
+                });
+            }
+        }
+    }
+}
@@ -0,0 +1,269 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Candidate boxes of one suppression problem in decreasing score order. The
+            ///        coordinates are kept in separate arrays so that the overlap of one box with
+            ///        all the candidates after it is a loop the compiler can vectorize.
+            struct NMSCandidates
+            {
+                std::vector<float> xmin;
+                std::vector<float> ymin;
+                std::vector<float> xmax;
+                std::vector<float> ymax;
+                std::vector<float> area;
+
+                size_t size() const { return xmin.size(); }
+                void clear()
+                {
+                    xmin.clear();
+                    ymin.clear();
+                    xmax.clear();
+                    ymax.clear();
+                    area.clear();
+                }
+                void push_back(float x0, float y0, float x1, float y1)
+                {
+                    xmin.push_back(x0);
+                    ymin.push_back(y0);
+                    xmax.push_back(x1);
+                    ymax.push_back(y1);
+                    area.push_back(x1 < x0 || y1 < y0 ? 0.0f : (x1 - x0) * (y1 - y0));
+                }
+            };
+
+            /// \brief A box kept by NonMaxSuppression
+            struct NMSSelection
+            {
+                float score;
+                int64_t batch;
+                int64_t cls;
+                int64_t box;
+            };
+
+            namespace detail
+            {
+                /// \brief Sorts (score, index) pairs by decreasing score, keeping equal scores in
+                ///        index order
+                inline void sort_by_score(std::vector<std::pair<float, int64_t>>& scored)
+                {
+                    std::stable_sort(scored.begin(),
+                                     scored.end(),
+                                     [](const std::pair<float, int64_t>& a,
+                                        const std::pair<float, int64_t>& b) {
+                                         return a.first > b.first;
+                                     });
+                }
+            }
+
+            /// \brief Greedy suppression over candidates sorted by decreasing score. A candidate
+            ///        is kept unless a kept candidate before it overlaps it with an IoU above
+            ///        iou_threshold. Each kept box suppresses the candidates after it in one pass,
+            ///        so the candidates are only sorted once.
+            ///
+            /// \param selected  Receives the positions of the kept candidates, best first
+            inline void greedy_nms(const NMSCandidates& candidates,
+                                   float iou_threshold,
+                                   size_t max_selected,
+                                   std::vector<size_t>& selected)
+            {
+                size_t n = candidates.size();
+                std::vector<char> suppressed(n, 0);
+                const float* xmin = candidates.xmin.data();
+                const float* ymin = candidates.ymin.data();
+                const float* xmax = candidates.xmax.data();
+                const float* ymax = candidates.ymax.data();
+                const float* area = candidates.area.data();
+                char* dead = suppressed.data();
+                for (size_t i = 0; i < n && selected.size() < max_selected; i++)
+                {
+                    if (dead[i])
+                    {
+                        continue;
+                    }
+                    selected.push_back(i);
+                    float x0 = xmin[i];
+                    float y0 = ymin[i];
+                    float x1 = xmax[i];
+                    float y1 = ymax[i];
+                    float a = area[i];
+                    for (size_t j = i + 1; j < n; j++)
+                    {
+                        float w = std::max(0.0f, std::min(x1, xmax[j]) - std::max(x0, xmin[j]));
+                        float h = std::max(0.0f, std::min(y1, ymax[j]) - std::max(y0, ymin[j]));
+                        float intersection = w * h;
+                        // IoU > threshold without the division; an empty union never suppresses
+                        dead[j] |= static_cast<char>(intersection >
+                                                     iou_threshold * (a + area[j] - intersection));
+                    }
+                }
+            }
+
+            /// \brief Runs NonMaxSuppression for one batch and class.
+            ///
+            /// \param boxes   The num_boxes boxes of the batch
+            /// \param scores  The num_boxes scores of the class in the batch
+            /// \param center_point_box  Boxes are [x_center, y_center, width, height] instead of
+            ///                          two opposite corners [y1, x1, y2, x2]
+            /// \param candidates  Scratch storage, reused between calls
+            /// \param selected  The kept boxes are appended here, best first
+            template <typename T>
+            void non_max_suppression_class(const T* boxes,
+                                           const T* scores,
+                                           size_t num_boxes,
+                                           bool center_point_box,
+                                           size_t max_output_boxes,
+                                           float iou_threshold,
+                                           float score_threshold,
+                                           int64_t batch,
+                                           int64_t cls,
+                                           NMSCandidates& candidates,
+                                           std::vector<NMSSelection>& selected)
+            {
+                if (max_output_boxes == 0)
+                {
+                    return;
+                }
+                std::vector<std::pair<float, int64_t>> scored;
+                for (size_t i = 0; i < num_boxes; i++)
+                {
+                    float score = static_cast<float>(scores[i]);
+                    if (score > score_threshold)
+                    {
+                        scored.emplace_back(score, static_cast<int64_t>(i));
+                    }
+                }
+                detail::sort_by_score(scored);
+
+                candidates.clear();
+                for (const auto& entry : scored)
+                {
+                    const T* box = boxes + 4 * entry.second;
+                    float b0 = static_cast<float>(box[0]);
+                    float b1 = static_cast<float>(box[1]);
+                    float b2 = static_cast<float>(box[2]);
+                    float b3 = static_cast<float>(box[3]);
+                    if (center_point_box)
+                    {
+                        candidates.push_back(
+                            b0 - b2 / 2, b1 - b3 / 2, b0 + b2 / 2, b1 + b3 / 2);
+                    }
+                    else
+                    {
+                        candidates.push_back(std::min(b1, b3),
+                                             std::min(b0, b2),
+                                             std::max(b1, b3),
+                                             std::max(b0, b2));
+                    }
+                }
+
+                std::vector<size_t> kept;
+                greedy_nms(candidates, iou_threshold, max_output_boxes, kept);
+                for (size_t position : kept)
+                {
+                    selected.push_back(
+                        {scored[position].first, batch, cls, scored[position].second});
+                }
+            }
+
+            /// \brief Writes the [batch, class, box] triplets of the kept boxes, given in batch
+            ///        and class order, filling the rows that are not needed with -1.
+            ///
+            /// \param sort_result_descending  Order the boxes of all batches and classes by
+            ///                                decreasing score
+            template <typename U>
+            void non_max_suppression_output(std::vector<NMSSelection>& selected,
+                                            bool sort_result_descending,
+                                            U* out,
+                                            size_t out_rows)
+            {
+                if (sort_result_descending)
+                {
+                    std::stable_sort(selected.begin(),
+                                     selected.end(),
+                                     [](const NMSSelection& a, const NMSSelection& b) {
+                                         return a.score > b.score;
+                                     });
+                }
+                size_t rows = std::min(selected.size(), out_rows);
+                for (size_t i = 0; i < rows; i++)
+                {
+                    out[3 * i] = static_cast<U>(selected[i].batch);
+                    out[3 * i + 1] = static_cast<U>(selected[i].cls);
+                    out[3 * i + 2] = static_cast<U>(selected[i].box);
+                }
+                std::fill(out + 3 * rows, out + 3 * out_rows, static_cast<U>(-1));
+            }
+
+            /// \param boxes_shape   [num_batches, num_boxes, 4]
+            /// \param scores_shape  [num_batches, num_classes, num_boxes]
+            /// \param out_rows      Number of triplets the output has room for
+            template <typename T, typename U>
+            void non_max_suppression(const T* boxes,
+                                     const T* scores,
+                                     U* out,
+                                     const Shape& boxes_shape,
+                                     const Shape& scores_shape,
+                                     size_t out_rows,
+                                     int64_t max_output_boxes_per_class,
+                                     float iou_threshold,
+                                     float score_threshold,
+                                     bool center_point_box,
+                                     bool sort_result_descending)
+            {
+                size_t num_batches = scores_shape[0];
+                size_t num_classes = scores_shape[1];
+                size_t num_boxes = boxes_shape[1];
+                size_t max_output_boxes =
+                    static_cast<size_t>(std::max<int64_t>(max_output_boxes_per_class, 0));
+                NMSCandidates candidates;
+                std::vector<NMSSelection> selected;
+                for (size_t batch = 0; batch < num_batches; batch++)
+                {
+                    for (size_t cls = 0; cls < num_classes; cls++)
+                    {
+                        non_max_suppression_class(boxes + batch * num_boxes * 4,
+                                                  scores + (batch * num_classes + cls) * num_boxes,
+                                                  num_boxes,
+                                                  center_point_box,
+                                                  max_output_boxes,
+                                                  iou_threshold,
+                                                  score_threshold,
+                                                  static_cast<int64_t>(batch),
+                                                  static_cast<int64_t>(cls),
+                                                  candidates,
+                                                  selected);
+                    }
+                }
+                non_max_suppression_output(selected, sort_result_descending, out, out_rows);
+            }
+        }
+    }
+}
@@ -17,6 +17,8 @@
 #pragma once
 
 #include <cstddef>
+#include <vector>
+
 #include "ngraph/shape.hpp"
 
 namespace ngraph
@@ -60,58 +62,53 @@ namespace ngraph
                 return non_zero_count;
             }
 
-            /// \brief Return indices of non-zero entries in input argument.
-            ///
-            /// \param arg Input tensor
-            /// \param arg_shape Input tensor shape
-            /// \param out Output containing indices of non-zero entries in arg
-            template <typename T, typename U>
-            void non_zero(const T* arg, U* out, const Shape& arg_shape)
+            /// \brief Appends the flat indices of the non-zero entries [begin, end) of `arg`
+            ///        to `positions`, so that a chunk of the input is read once.
+            template <typename T>
+            void non_zero_positions(const T* arg,
+                                    size_t begin,
+                                    size_t end,
+                                    std::vector<size_t>& positions)
             {
-                T zero = 0;
-                size_t arg_rank = arg_shape.size();
-                size_t arg_count = shape_size(arg_shape);
-
-                size_t non_zero_count = non_zero_get_count(arg, arg_shape);
-
-                // Input arg only contains 0s
-                if (non_zero_count == 0)
+                const T zero = 0;
+                for (size_t i = begin; i < end; i++)
                 {
-                    return;
+                    if (arg[i] != zero)
+                    {
+                        positions.push_back(i);
+                    }
                 }
+            }
 
-                // Input arg is non-zero scalar
+            /// \brief Writes the indices of the non-zero entries at flat `positions` to
+            ///        columns [first_column, first_column + positions.size()) of the
+            ///        [rank, non_zero_count] output. Chunks of the input whose positions were
+            ///        gathered separately write their columns independently.
+            template <typename U>
+            void non_zero_write(const std::vector<size_t>& positions,
+                                size_t first_column,
+                                size_t non_zero_count,
+                                const Shape& arg_shape,
+                                U* out)
+            {
+                const size_t arg_rank = arg_shape.size();
+                // Input arg is a non-zero scalar
                 if (arg_rank == 0)
                 {
-                    out[0] = static_cast<U>(0);
+                    if (!positions.empty())
+                    {
+                        out[0] = static_cast<U>(0);
+                    }
                     return;
                 }
-
-                // Dimensional size for the arg_shape. This is used to map one-dimentional
-                // arg array indices to corresponding arg_rank-dimentional shape indices.
-                // i.e., arg_shape {2, 3, 2} => elem_per_axis {6, 2, 1}.
-                // Array index 4 in arg (arg[4]) correspond to 3-D index of [0][2][0]
-                std::vector<size_t> elem_per_axis;
-                elem_per_axis.reserve(arg_rank);
-
-                size_t temp = arg_count;
-                for (size_t i = 0; i < arg_rank; i++)
+                // i.e., arg_shape {2, 3, 2} => elem_per_axis {6, 2, 1}
+                std::vector<size_t> elem_per_axis(arg_rank);
+                size_t temp = shape_size(arg_shape);
+                for (size_t j = 0; j < arg_rank; j++)
                 {
-                    temp = temp / arg_shape[i];
-                    elem_per_axis.push_back(temp);
+                    temp = temp / arg_shape[j];
+                    elem_per_axis[j] = temp;
                 }
-
-                // Column index in out to record a non-zero entry
-                size_t col_index = 0;
-
-                // Array index in out to write non-zero index value
-                size_t out_index = 0;
-
-                // Find non-zero entries in arg and write the indices info in out.
-                // For a non-zero entry, map its array index to corresponding indices
-                // in arg_shape, then, write each of the arg_shape index value to
-                // out array at the position that is determined by entry's dimension
-                // distance and number of non-zero entries prior to it.
                 // i,e., Given input with shape{2, 3, 2}, rank = 3
                 // input [[[0, 2], [0, 0], [3, 4]],
                 //        [[5, 0], [6, 0], [7, 8]]]
@@ -120,27 +117,30 @@ namespace ngraph
                 // output [[0, 0, 0, 1, 1, 1, 1],
                 //         [0, 2, 2, 0, 1, 2, 2],
                 //         [1, 0, 1, 0, 0, 0, 1]]
-                //
-                // input[0][2][0] = 3 is arg[4]
-                // output for this entry out[1] = 0, out[8] = 2, out[15] = 0
-                for (size_t i = 0; i < arg_count; i++)
+                for (size_t c = 0; c < positions.size(); c++)
                 {
-                    if (arg[i] != zero)
+                    temp = positions[c];
+                    for (size_t j = 0; j < arg_rank; j++)
                     {
-                        temp = i;
-
-                        for (size_t j = 0; j < arg_rank; j++)
-                        {
-                            out_index = j * non_zero_count + col_index;
-                            out[out_index] = static_cast<U>(temp / elem_per_axis[j]);
-
-                            temp = temp % elem_per_axis[j];
-                        }
-
-                        col_index++;
+                        out[j * non_zero_count + first_column + c] =
+                            static_cast<U>(temp / elem_per_axis[j]);
+                        temp = temp % elem_per_axis[j];
                     }
                 }
             }
+
+            /// \brief Return indices of non-zero entries in input argument.
+            ///
+            /// \param arg Input tensor
+            /// \param arg_shape Input tensor shape
+            /// \param out Output containing indices of non-zero entries in arg
+            template <typename T, typename U>
+            void non_zero(const T* arg, U* out, const Shape& arg_shape)
+            {
+                std::vector<size_t> positions;
+                non_zero_positions(arg, 0, shape_size(arg_shape), positions);
+                non_zero_write(positions, 0, positions.size(), arg_shape, out);
+            }
         }
     }
 }
@@ -0,0 +1,65 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/op/util/attr_types.hpp"
+#include "ngraph/runtime/reference/mvn.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief out = arg / sqrt(sum of arg^2 over the reduction axes), eps being added
+            ///        to or taken as a lower bound of the sum depending on eps_mode.
+            template <typename T>
+            void normalize_l2(const T* arg,
+                              T* out,
+                              const Shape& arg_shape,
+                              const AxisSet& reduction_axes,
+                              float eps,
+                              op::EpsMode eps_mode)
+            {
+                size_t slots = 1;
+                for (size_t i = 0; i < arg_shape.size(); i++)
+                {
+                    slots *= reduction_axes.count(i) == 0 ? arg_shape[i] : 1;
+                }
+                std::vector<T> norm(slots, 0);
+                detail::for_each_reduced_index(arg_shape, reduction_axes, [&](size_t i, size_t r) {
+                    norm[r] += arg[i] * arg[i];
+                });
+                for (T& value : norm)
+                {
+                    value = eps_mode == op::EpsMode::MAX ? std::max(value, static_cast<T>(eps))
+                                                         : value + static_cast<T>(eps);
+                    value = static_cast<T>(1) / std::sqrt(value);
+                }
+                detail::for_each_reduced_index(arg_shape, reduction_axes, [&](size_t i, size_t r) {
+                    out[i] = arg[i] * norm[r];
+                });
+            }
+        }
+    }
+}
@@ -65,6 +65,17 @@ namespace ngraph
                 NGRAPH_CHECK(shape_size(input_transform.get_target_shape()) ==
                              shape_size(output_transform.get_target_shape()));
 
+                if (pad_mode == op::PadMode::CONSTANT)
+                {
+                    // The output is visited in row-major order, so its index is the target index
+                    for (auto in_it = input_transform.index_begin(); in_it.valid(); ++in_it)
+                    {
+                        out[in_it.target_index()] =
+                            in_it.has_source() ? arg0[in_it.source_index()] : *arg1;
+                    }
+                    return;
+                }
+
                 for (const Coordinate& in_coord : input_transform)
                 {
                     const Coordinate& out_coord = *output_it;
@@ -0,0 +1,66 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+#include "ngraph/op/util/attr_types.hpp"
+#include "ngraph/runtime/reference/autobroadcast_binop.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief out = arg < 0 ? arg * slope : arg.
+            ///
+            /// A 1D slope of more than one element holds one value per index of the first axis
+            /// of arg with the same length, as in the decomposition of the op; any other slope
+            /// is numpy broadcast to arg.
+            template <typename T>
+            void prelu(const T* arg,
+                       const T* slope,
+                       T* out,
+                       const Shape& arg_shape,
+                       const Shape& slope_shape)
+            {
+                if (slope_shape.size() == 1 && slope_shape[0] != 1)
+                {
+                    auto axis = std::find(arg_shape.begin(), arg_shape.end(), slope_shape[0]);
+                    size_t channels = slope_shape[0];
+                    size_t inner = shape_size(Shape(axis + 1, arg_shape.end()));
+                    size_t count = shape_size(arg_shape);
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        out[i] = arg[i] < 0 ? arg[i] * slope[(i / inner) % channels] : arg[i];
+                    }
+                    return;
+                }
+                autobroadcast_binop(arg,
+                                    slope,
+                                    out,
+                                    arg_shape,
+                                    slope_shape,
+                                    op::AutoBroadcastSpec(op::AutoBroadcastType::NUMPY),
+                                    [](T x, T s) -> T { return x < 0 ? x * s : x; });
+            }
+        }
+    }
+}
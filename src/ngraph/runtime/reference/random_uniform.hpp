@@ -16,8 +16,6 @@
 
 #pragma once
 
-#include <random>
-
 #include "ngraph/state/uniform_rng_state.hpp"
 
 namespace ngraph
@@ -26,25 +24,42 @@ namespace ngraph
     {
         namespace reference
         {
+            /// \brief Fills out[begin, end) with the numbers of `generator` from position
+            ///        offset + begin on, scaled to [min_val, max_val). The values of a range do
+            ///        not depend on how the output is split into ranges.
+            template <typename T>
+            void random_uniform_range(T* out,
+                                      T min_val,
+                                      T max_val,
+                                      size_t begin,
+                                      size_t end,
+                                      const Philox& generator,
+                                      uint64_t offset)
+            {
+                generator.generate_uniform(
+                    offset + begin, offset + end, [&](uint64_t position, double u) {
+                        out[position - offset] = static_cast<T>(u) * (max_val - min_val) + min_val;
+                    });
+            }
+
             template <typename T>
             void random_uniform(
                 T* out, T min_val, T max_val, size_t count, ngraph::UniformRNGState* rng_state)
             {
-                auto& gen = rng_state->get_generator();
-                auto& bd = rng_state->get_distribution();
-
-                for (size_t i = 0; i < count; i++)
-                {
-                    out[i] = static_cast<T>(bd(gen)) * (max_val - min_val) + min_val;
-                }
+                random_uniform_range(out,
+                                     min_val,
+                                     max_val,
+                                     0,
+                                     count,
+                                     rng_state->get_generator(),
+                                     rng_state->advance(count));
             }
 
             template <typename T>
             void random_uniform_with_fixed_seed(
                 T* out, T min_val, T max_val, size_t count, size_t fixed_seed)
             {
-                ngraph::UniformRNGState rng_state(fixed_seed);
-                random_uniform(out, min_val, max_val, count, &rng_state);
+                random_uniform_range(out, min_val, max_val, 0, count, Philox(fixed_seed), 0);
             }
         }
     }
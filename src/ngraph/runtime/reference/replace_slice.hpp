@@ -38,31 +38,24 @@ namespace ngraph
                                const Shape& out_shape)
             {
                 // Step 1: Copy the entire replacement context to the output.
-                CoordinateTransform copy_transform(out_shape);
-
-                for (Coordinate copy_coord : copy_transform)
+                size_t out_size = shape_size(out_shape);
+                for (size_t i = 0; i < out_size; i++)
                 {
-                    out[copy_transform.index(copy_coord)] = arg0[copy_transform.index(copy_coord)];
+                    out[i] = arg0[i];
                 }
 
                 // Step 2: Overwrite the slice for replacement.
-                CoordinateTransform input_transform(arg1_shape);
                 CoordinateTransform output_transform(
                     out_shape, lower_bounds, upper_bounds, strides);
 
-                NGRAPH_CHECK(shape_size(input_transform.get_target_shape()) ==
+                NGRAPH_CHECK(shape_size(arg1_shape) ==
                              shape_size(output_transform.get_target_shape()));
 
-                CoordinateTransform::Iterator output_it = output_transform.begin();
-
-                for (const Coordinate& input_coord : input_transform)
+                // arg1 is read in row-major order, so its index is the target index
+                for (auto output_it = output_transform.index_begin(); output_it.valid();
+                     ++output_it)
                 {
-                    const Coordinate& output_coord = *output_it;
-
-                    out[output_transform.index(output_coord)] =
-                        arg1[input_transform.index(input_coord)];
-
-                    ++output_it;
+                    out[output_it.source_index()] = arg1[output_it.target_index()];
                 }
             }
         }
@@ -43,21 +43,14 @@ namespace ngraph
 
                 CoordinateTransform input_transform(
                     in_shape, in_start_corner, in_shape, in_strides, in_axis_order);
-                CoordinateTransform output_transform(out_shape);
 
                 NGRAPH_CHECK(shape_size(input_transform.get_target_shape()) ==
-                             shape_size(output_transform.get_target_shape()));
+                             shape_size(out_shape));
 
-                CoordinateTransform::Iterator output_it = output_transform.begin();
-
-                for (const Coordinate& input_coord : input_transform)
+                // The output is visited in row-major order, so its index is the target index
+                for (auto input_it = input_transform.index_begin(); input_it.valid(); ++input_it)
                 {
-                    const Coordinate& output_coord = *output_it;
-
-                    out[output_transform.index(output_coord)] =
-                        arg[input_transform.index(input_coord)];
-
-                    ++output_it;
+                    out[input_it.target_index()] = arg[input_it.source_index()];
                 }
             }
         }
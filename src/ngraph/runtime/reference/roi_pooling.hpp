@@ -0,0 +1,573 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "ngraph/check.hpp"
+#include "ngraph/op/roi_align.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief A feature map [N, C, H, W] whose channels may be interleaved in blocks of
+            ///        `block`, as in the nChw8c and nChw16c layouts. A plane holds the H x W
+            ///        values of one channel, `block` elements apart.
+            template <typename T>
+            struct ROIFeatureMap
+            {
+                ROIFeatureMap(const T* data_, const Shape& shape, size_t block_ = 1)
+                    : data(data_)
+                    , channels(shape[1])
+                    , height(shape[2])
+                    , width(shape[3])
+                    , block(block_)
+                {
+                    NGRAPH_CHECK(shape.size() == 4, "ROI pooling expects a 4D feature map");
+                }
+
+                const T* plane(size_t n, size_t c) const
+                {
+                    size_t blocks = (channels + block - 1) / block;
+                    return data + (n * blocks + c / block) * height * width * block + c % block;
+                }
+
+                const T* data;
+                size_t channels;
+                size_t height;
+                size_t width;
+                size_t block;
+            };
+
+            /// \brief Bilinear interpolation at one point of a plane, as the offsets and weights
+            ///        of its four neighbours. The coordinates of a sample only depend on the
+            ///        ROI, so the samples are computed once and reused for every channel.
+            template <typename T>
+            struct ROIBilinearSample
+            {
+                size_t offset[4];
+                T weight[4];
+
+                T apply(const T* plane) const
+                {
+                    return weight[0] * plane[offset[0]] + weight[1] * plane[offset[1]] +
+                           weight[2] * plane[offset[2]] + weight[3] * plane[offset[3]];
+                }
+            };
+
+            /// \brief The sample at (y, x), clamped to the plane
+            template <typename T>
+            ROIBilinearSample<T> roi_bilinear_sample(const ROIFeatureMap<T>& map, T y, T x)
+            {
+                T last_y = static_cast<T>(map.height - 1);
+                T last_x = static_cast<T>(map.width - 1);
+                y = std::min(std::max(y, T(0)), last_y);
+                x = std::min(std::max(x, T(0)), last_x);
+                size_t y0 = static_cast<size_t>(y);
+                size_t x0 = static_cast<size_t>(x);
+                size_t y1 = std::min(y0 + 1, map.height - 1);
+                size_t x1 = std::min(x0 + 1, map.width - 1);
+                T ly = y - y0;
+                T lx = x - x0;
+                ROIBilinearSample<T> sample;
+                sample.offset[0] = (y0 * map.width + x0) * map.block;
+                sample.offset[1] = (y0 * map.width + x1) * map.block;
+                sample.offset[2] = (y1 * map.width + x0) * map.block;
+                sample.offset[3] = (y1 * map.width + x1) * map.block;
+                sample.weight[0] = (1 - ly) * (1 - lx);
+                sample.weight[1] = (1 - ly) * lx;
+                sample.weight[2] = ly * (1 - lx);
+                sample.weight[3] = ly * lx;
+                return sample;
+            }
+
+            /// \brief A sample that contributes zero
+            template <typename T>
+            ROIBilinearSample<T> roi_zero_sample()
+            {
+                return ROIBilinearSample<T>{{0, 0, 0, 0}, {0, 0, 0, 0}};
+            }
+
+            template <typename T>
+            size_t roi_batch_index(T index, size_t batch)
+            {
+                NGRAPH_CHECK(index >= 0 && static_cast<size_t>(index) < batch,
+                             "ROI batch index ",
+                             index,
+                             " is out of range");
+                return static_cast<size_t>(index);
+            }
+
+            /// \brief ROIAlign of rois [roi_begin, roi_end). `rois` holds (x1, y1, x2, y2) boxes
+            ///        and the output is [R, C, pooled_h, pooled_w] in the native layout.
+            template <typename T, typename U>
+            void roi_align(const ROIFeatureMap<T>& input,
+                           size_t batch,
+                           const T* rois,
+                           const U* batch_indices,
+                           T* out,
+                           size_t pooled_h,
+                           size_t pooled_w,
+                           int sampling_ratio,
+                           float spatial_scale,
+                           op::v3::ROIAlign::PoolingMode mode,
+                           size_t roi_begin,
+                           size_t roi_end)
+            {
+                T height = static_cast<T>(input.height);
+                T width = static_cast<T>(input.width);
+                size_t bins = pooled_h * pooled_w;
+                std::vector<ROIBilinearSample<T>> samples;
+                for (size_t r = roi_begin; r < roi_end; r++)
+                {
+                    const T* roi = rois + r * 4;
+                    T x1 = roi[0] * spatial_scale;
+                    T y1 = roi[1] * spatial_scale;
+                    T roi_w = std::max(roi[2] * spatial_scale - x1, T(1));
+                    T roi_h = std::max(roi[3] * spatial_scale - y1, T(1));
+                    T bin_h = roi_h / pooled_h;
+                    T bin_w = roi_w / pooled_w;
+                    size_t grid_h = sampling_ratio > 0
+                                        ? static_cast<size_t>(sampling_ratio)
+                                        : static_cast<size_t>(std::ceil(roi_h / pooled_h));
+                    size_t grid_w = sampling_ratio > 0
+                                        ? static_cast<size_t>(sampling_ratio)
+                                        : static_cast<size_t>(std::ceil(roi_w / pooled_w));
+                    size_t count = grid_h * grid_w;
+
+                    samples.clear();
+                    for (size_t ph = 0; ph < pooled_h; ph++)
+                    {
+                        for (size_t pw = 0; pw < pooled_w; pw++)
+                        {
+                            for (size_t iy = 0; iy < grid_h; iy++)
+                            {
+                                T y = y1 + ph * bin_h + (iy + T(0.5)) * bin_h / grid_h;
+                                for (size_t ix = 0; ix < grid_w; ix++)
+                                {
+                                    T x = x1 + pw * bin_w + (ix + T(0.5)) * bin_w / grid_w;
+                                    samples.push_back(y < -1 || y > height || x < -1 || x > width
+                                                          ? roi_zero_sample<T>()
+                                                          : roi_bilinear_sample(input, y, x));
+                                }
+                            }
+                        }
+                    }
+
+                    size_t n = roi_batch_index(batch_indices[r], batch);
+                    for (size_t c = 0; c < input.channels; c++)
+                    {
+                        const T* plane = input.plane(n, c);
+                        T* dst = out + (r * input.channels + c) * bins;
+                        const ROIBilinearSample<T>* sample = samples.data();
+                        for (size_t bin = 0; bin < bins; bin++)
+                        {
+                            if (mode == op::v3::ROIAlign::PoolingMode::AVG)
+                            {
+                                T sum = 0;
+                                for (size_t k = 0; k < count; k++)
+                                {
+                                    sum += sample[k].apply(plane);
+                                }
+                                dst[bin] = count == 0 ? T(0) : sum / count;
+                            }
+                            else
+                            {
+                                T max = count == 0 ? T(0) : std::numeric_limits<T>::lowest();
+                                for (size_t k = 0; k < count; k++)
+                                {
+                                    max = std::max(max, sample[k].apply(plane));
+                                }
+                                dst[bin] = max;
+                            }
+                            sample += count;
+                        }
+                    }
+                }
+            }
+
+            /// \brief ROIPooling of rois [roi_begin, roi_end). `rois` holds
+            ///        (batch, x1, y1, x2, y2) boxes. The max method pools the input cells that
+            ///        each bin covers; the bilinear method samples one point per bin from boxes
+            ///        given in normalized coordinates.
+            template <typename T>
+            void roi_pooling(const ROIFeatureMap<T>& input,
+                             size_t batch,
+                             const T* rois,
+                             T* out,
+                             size_t pooled_h,
+                             size_t pooled_w,
+                             float spatial_scale,
+                             const std::string& method,
+                             size_t roi_begin,
+                             size_t roi_end)
+            {
+                bool bilinear = method == "bilinear";
+                NGRAPH_CHECK(bilinear || method == "max", "Unsupported ROIPooling method ", method);
+                size_t bins = pooled_h * pooled_w;
+                std::vector<int64_t> h_begin(pooled_h), h_end(pooled_h);
+                std::vector<int64_t> w_begin(pooled_w), w_end(pooled_w);
+                std::vector<ROIBilinearSample<T>> samples;
+                for (size_t r = roi_begin; r < roi_end; r++)
+                {
+                    const T* roi = rois + r * 5;
+                    size_t n = roi_batch_index(roi[0], batch);
+                    if (bilinear)
+                    {
+                        T last_y = static_cast<T>(input.height - 1);
+                        T last_x = static_cast<T>(input.width - 1);
+                        T y_scale = pooled_h > 1 ? (roi[4] - roi[2]) * last_y / (pooled_h - 1) : 0;
+                        T x_scale = pooled_w > 1 ? (roi[3] - roi[1]) * last_x / (pooled_w - 1) : 0;
+                        samples.clear();
+                        for (size_t ph = 0; ph < pooled_h; ph++)
+                        {
+                            T y = pooled_h > 1 ? roi[2] * last_y + ph * y_scale
+                                               : T(0.5) * (roi[2] + roi[4]) * last_y;
+                            for (size_t pw = 0; pw < pooled_w; pw++)
+                            {
+                                T x = pooled_w > 1 ? roi[1] * last_x + pw * x_scale
+                                                   : T(0.5) * (roi[1] + roi[3]) * last_x;
+                                samples.push_back(y < 0 || y > last_y || x < 0 || x > last_x
+                                                      ? roi_zero_sample<T>()
+                                                      : roi_bilinear_sample(input, y, x));
+                            }
+                        }
+                    }
+                    else
+                    {
+                        // The cells of each row and column of bins
+                        auto bin_ranges = [](T start,
+                                             T end,
+                                             size_t pooled,
+                                             size_t size,
+                                             std::vector<int64_t>& begin,
+                                             std::vector<int64_t>& stop) {
+                            int64_t first = static_cast<int64_t>(std::round(start));
+                            T length = std::max(std::round(end) - first + 1, T(1));
+                            T bin = length / pooled;
+                            int64_t limit = static_cast<int64_t>(size);
+                            for (size_t p = 0; p < pooled; p++)
+                            {
+                                int64_t b = static_cast<int64_t>(std::floor(p * bin)) + first;
+                                int64_t e = static_cast<int64_t>(std::ceil((p + 1) * bin)) + first;
+                                begin[p] = std::min(std::max(b, int64_t(0)), limit);
+                                stop[p] = std::min(std::max(e, int64_t(0)), limit);
+                            }
+                        };
+                        bin_ranges(roi[2] * spatial_scale,
+                                   roi[4] * spatial_scale,
+                                   pooled_h,
+                                   input.height,
+                                   h_begin,
+                                   h_end);
+                        bin_ranges(roi[1] * spatial_scale,
+                                   roi[3] * spatial_scale,
+                                   pooled_w,
+                                   input.width,
+                                   w_begin,
+                                   w_end);
+                    }
+
+                    for (size_t c = 0; c < input.channels; c++)
+                    {
+                        const T* plane = input.plane(n, c);
+                        T* dst = out + (r * input.channels + c) * bins;
+                        if (bilinear)
+                        {
+                            for (size_t bin = 0; bin < bins; bin++)
+                            {
+                                dst[bin] = samples[bin].apply(plane);
+                            }
+                            continue;
+                        }
+                        for (size_t ph = 0; ph < pooled_h; ph++)
+                        {
+                            for (size_t pw = 0; pw < pooled_w; pw++)
+                            {
+                                bool empty = h_end[ph] <= h_begin[ph] || w_end[pw] <= w_begin[pw];
+                                T max = empty ? T(0) : std::numeric_limits<T>::lowest();
+                                for (int64_t h = h_begin[ph]; h < h_end[ph]; h++)
+                                {
+                                    const T* row = plane + h * input.width * input.block;
+                                    for (int64_t w = w_begin[pw]; w < w_end[pw]; w++)
+                                    {
+                                        max = std::max(max, row[w * input.block]);
+                                    }
+                                }
+                                dst[ph * pooled_w + pw] = max;
+                            }
+                        }
+                    }
+                }
+            }
+
+            /// \brief PSROIPooling of rois [roi_begin, roi_end). Output channel c of bin
+            ///        (ph, pw) averages input channel (c * group + ph) * group + pw in the
+            ///        average mode; in the bilinear mode it averages one sample from each of
+            ///        the spatial bins, with channel (bin_y * bins_x + bin_x) * output_dim + c.
+            template <typename T>
+            void psroi_pooling(const ROIFeatureMap<T>& input,
+                               size_t batch,
+                               const T* rois,
+                               T* out,
+                               size_t output_dim,
+                               size_t group_size,
+                               float spatial_scale,
+                               size_t bins_x,
+                               size_t bins_y,
+                               const std::string& mode,
+                               size_t roi_begin,
+                               size_t roi_end)
+            {
+                bool bilinear = mode == "bilinear";
+                NGRAPH_CHECK(bilinear || mode == "average", "Unsupported PSROIPooling mode ", mode);
+                size_t bins = group_size * group_size;
+                NGRAPH_CHECK(input.channels == output_dim * (bilinear ? bins_x * bins_y : bins),
+                             "PSROIPooling input channels do not match the output dimension");
+                std::vector<size_t> h_begin(group_size), h_end(group_size);
+                std::vector<size_t> w_begin(group_size), w_end(group_size);
+                std::vector<ROIBilinearSample<T>> samples;
+                for (size_t r = roi_begin; r < roi_end; r++)
+                {
+                    const T* roi = rois + r * 5;
+                    size_t n = roi_batch_index(roi[0], batch);
+                    if (bilinear)
+                    {
+                        T last_y = static_cast<T>(input.height - 1);
+                        T last_x = static_cast<T>(input.width - 1);
+                        T start_w = roi[1] * spatial_scale;
+                        T start_h = roi[2] * spatial_scale;
+                        T bin_w = (roi[3] * spatial_scale - start_w) / bins_x;
+                        T bin_h = (roi[4] * spatial_scale - start_h) / bins_y;
+                        T scale_h = group_size > 1 ? bin_h * last_y / (group_size - 1) : 0;
+                        T scale_w = group_size > 1 ? bin_w * last_x / (group_size - 1) : 0;
+                        // samples[((by * bins_x + bx) * group + ph) * group + pw]
+                        samples.clear();
+                        for (size_t by = 0; by < bins_y; by++)
+                        {
+                            for (size_t bx = 0; bx < bins_x; bx++)
+                            {
+                                T y_min = start_h + by * bin_h;
+                                T x_min = start_w + bx * bin_w;
+                                for (size_t ph = 0; ph < group_size; ph++)
+                                {
+                                    T y = group_size > 1 ? y_min * last_y + ph * scale_h
+                                                         : (y_min + bin_h / 2) * last_y;
+                                    for (size_t pw = 0; pw < group_size; pw++)
+                                    {
+                                        T x = group_size > 1 ? x_min * last_x + pw * scale_w
+                                                             : (x_min + bin_w / 2) * last_x;
+                                        samples.push_back(
+                                            y < 0 || y > last_y || x < 0 || x > last_x
+                                                ? roi_zero_sample<T>()
+                                                : roi_bilinear_sample(input, y, x));
+                                    }
+                                }
+                            }
+                        }
+                        for (size_t c = 0; c < output_dim; c++)
+                        {
+                            T* dst = out + (r * output_dim + c) * bins;
+                            std::fill(dst, dst + bins, T(0));
+                            for (size_t b = 0; b < bins_y * bins_x; b++)
+                            {
+                                const T* plane = input.plane(n, b * output_dim + c);
+                                const ROIBilinearSample<T>* sample = &samples[b * bins];
+                                for (size_t bin = 0; bin < bins; bin++)
+                                {
+                                    dst[bin] += sample[bin].apply(plane);
+                                }
+                            }
+                            for (size_t bin = 0; bin < bins; bin++)
+                            {
+                                dst[bin] /= static_cast<T>(bins_x * bins_y);
+                            }
+                        }
+                        continue;
+                    }
+
+                    auto bin_ranges = [&](T first,
+                                          T last,
+                                          size_t size,
+                                          std::vector<size_t>& begin,
+                                          std::vector<size_t>& stop) {
+                        T start = std::round(first) * spatial_scale;
+                        T end = (std::round(last) + 1) * spatial_scale;
+                        T bin = std::max(end - start, T(0.1)) / group_size;
+                        T limit = static_cast<T>(size);
+                        for (size_t p = 0; p < group_size; p++)
+                        {
+                            T b = std::floor(start + p * bin);
+                            T e = std::ceil(start + (p + 1) * bin);
+                            begin[p] = static_cast<size_t>(std::min(std::max(b, T(0)), limit));
+                            stop[p] = static_cast<size_t>(std::min(std::max(e, T(0)), limit));
+                        }
+                    };
+                    bin_ranges(roi[2], roi[4], input.height, h_begin, h_end);
+                    bin_ranges(roi[1], roi[3], input.width, w_begin, w_end);
+                    for (size_t c = 0; c < output_dim; c++)
+                    {
+                        T* dst = out + (r * output_dim + c) * bins;
+                        for (size_t ph = 0; ph < group_size; ph++)
+                        {
+                            for (size_t pw = 0; pw < group_size; pw++)
+                            {
+                                const T* plane =
+                                    input.plane(n, (c * group_size + ph) * group_size + pw);
+                                T sum = 0;
+                                for (size_t h = h_begin[ph]; h < h_end[ph]; h++)
+                                {
+                                    const T* row = plane + h * input.width * input.block;
+                                    for (size_t w = w_begin[pw]; w < w_end[pw]; w++)
+                                    {
+                                        sum += row[w * input.block];
+                                    }
+                                }
+                                size_t count =
+                                    (h_end[ph] - h_begin[ph]) * (w_end[pw] - w_begin[pw]);
+                                dst[ph * group_size + pw] = count == 0 ? T(0) : sum / count;
+                            }
+                        }
+                    }
+                }
+            }
+
+            /// \brief DeformablePSROIPooling of rois [roi_begin, roi_end) in the
+            ///        bilinear_deformable mode. Each bin is moved by the offset of its class
+            ///        and part, given as fractions of the ROI size in `offsets`
+            ///        [R, 2 * classes, part_size, part_size], or not moved when `offsets` is
+            ///        null. A bin averages the samples of its bins_y x bins_x grid that fall
+            ///        inside the feature map.
+            template <typename T>
+            void deformable_psroi_pooling(const ROIFeatureMap<T>& input,
+                                          size_t batch,
+                                          const T* rois,
+                                          const T* offsets,
+                                          size_t classes,
+                                          T* out,
+                                          size_t output_dim,
+                                          size_t group_size,
+                                          float spatial_scale,
+                                          size_t bins_x,
+                                          size_t bins_y,
+                                          float trans_std,
+                                          size_t part_size,
+                                          size_t roi_begin,
+                                          size_t roi_end)
+            {
+                NGRAPH_CHECK(input.channels == output_dim * group_size * group_size,
+                             "DeformablePSROIPooling input channels do not match the output "
+                             "dimension");
+                if (offsets == nullptr)
+                {
+                    classes = 1;
+                }
+                size_t channels_per_class = output_dim / classes;
+                size_t bins = group_size * group_size;
+                size_t grid = bins_x * bins_y;
+                T last_y = static_cast<T>(input.height - 1);
+                T last_x = static_cast<T>(input.width - 1);
+                std::vector<ROIBilinearSample<T>> samples;
+                std::vector<size_t> counts;
+                for (size_t r = roi_begin; r < roi_end; r++)
+                {
+                    const T* roi = rois + r * 5;
+                    size_t n = roi_batch_index(roi[0], batch);
+                    T start_w = std::round(roi[1]) * spatial_scale - T(0.5);
+                    T start_h = std::round(roi[2]) * spatial_scale - T(0.5);
+                    T roi_w = std::max((std::round(roi[3]) + 1) * spatial_scale - T(0.5) - start_w,
+                                       T(0.1));
+                    T roi_h = std::max((std::round(roi[4]) + 1) * spatial_scale - T(0.5) - start_h,
+                                       T(0.1));
+                    T bin_w = roi_w / group_size;
+                    T bin_h = roi_h / group_size;
+
+                    // samples[((class * group + ph) * group + pw) * grid + k], where the first
+                    // counts[...] samples of a bin are the ones inside the feature map
+                    samples.assign(classes * bins * grid, roi_zero_sample<T>());
+                    counts.assign(classes * bins, 0);
+                    for (size_t cls = 0; cls < classes; cls++)
+                    {
+                        for (size_t ph = 0; ph < group_size; ph++)
+                        {
+                            size_t part_h = ph * part_size / group_size;
+                            for (size_t pw = 0; pw < group_size; pw++)
+                            {
+                                size_t part_w = pw * part_size / group_size;
+                                T trans_x = 0;
+                                T trans_y = 0;
+                                if (offsets)
+                                {
+                                    const T* trans = offsets + (r * classes + cls) * 2 *
+                                                                   part_size * part_size;
+                                    size_t part = part_h * part_size + part_w;
+                                    trans_x = trans[part] * trans_std;
+                                    trans_y = trans[part_size * part_size + part] * trans_std;
+                                }
+                                T w_start = pw * bin_w + start_w + trans_x * roi_w;
+                                T h_start = ph * bin_h + start_h + trans_y * roi_h;
+                                size_t bin = (cls * group_size + ph) * group_size + pw;
+                                for (size_t iy = 0; iy < bins_y; iy++)
+                                {
+                                    T y = h_start + iy * bin_h / bins_y;
+                                    for (size_t ix = 0; ix < bins_x; ix++)
+                                    {
+                                        T x = w_start + ix * bin_w / bins_x;
+                                        if (x < T(-0.5) || x > last_x + T(0.5) ||
+                                            y < T(-0.5) || y > last_y + T(0.5))
+                                        {
+                                            continue;
+                                        }
+                                        samples[bin * grid + counts[bin]++] =
+                                            roi_bilinear_sample(input, y, x);
+                                    }
+                                }
+                            }
+                        }
+                    }
+
+                    for (size_t c = 0; c < output_dim; c++)
+                    {
+                        size_t cls = std::min(c / channels_per_class, classes - 1);
+                        T* dst = out + (r * output_dim + c) * bins;
+                        for (size_t bin = 0; bin < bins; bin++)
+                        {
+                            const T* plane = input.plane(n, c * bins + bin);
+                            size_t sampled = cls * bins + bin;
+                            const ROIBilinearSample<T>* sample = &samples[sampled * grid];
+                            T sum = 0;
+                            for (size_t k = 0; k < counts[sampled]; k++)
+                            {
+                                sum += sample[k].apply(plane);
+                            }
+                            dst[bin] = counts[sampled] == 0 ? T(0) : sum / counts[sampled];
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
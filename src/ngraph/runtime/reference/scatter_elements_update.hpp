@@ -17,9 +17,9 @@
 #pragma once
 
 #include <cstring>
+#include <vector>
 
 #include "ngraph/check.hpp"
-#include "ngraph/coordinate_transform.hpp"
 #include "ngraph/shape.hpp"
 
 namespace ngraph
@@ -28,6 +28,104 @@ namespace ngraph
     {
         namespace reference
         {
+            // ScatterElementsUpdate writes every update to the position of its own coordinate
+            // with the axis coordinate replaced by the index. Updates only collide when their
+            // coordinates differ on the axis alone, so the lines of indices along the axis can
+            // be written independently of each other.
+            struct ScatterElementsUpdateShape
+            {
+                Shape indices_shape;
+                size_t axis;
+                size_t axis_size;
+                size_t num_indices;
+                std::vector<size_t> data_strides;
+                std::vector<size_t> indices_strides;
+
+                ScatterElementsUpdateShape(const Shape& data_shape,
+                                           const Shape& indices_shape_,
+                                           size_t axis_)
+                    : indices_shape(indices_shape_)
+                    , axis(axis_)
+                    , axis_size(data_shape.at(axis_))
+                    , num_indices(indices_shape_.at(axis_))
+                    , data_strides(data_shape.size())
+                    , indices_strides(indices_shape_.size())
+                {
+                    size_t data_stride = 1;
+                    size_t indices_stride = 1;
+                    for (size_t i = data_shape.size(); i-- > 0;)
+                    {
+                        data_strides[i] = data_stride;
+                        indices_strides[i] = indices_stride;
+                        data_stride *= data_shape[i];
+                        indices_stride *= indices_shape[i];
+                    }
+                }
+
+                size_t lines() const
+                {
+                    return num_indices == 0 ? 0 : shape_size(indices_shape) / num_indices;
+                }
+            };
+
+            template <typename IndicesType>
+            void scatter_elem_update_check_indices(const IndicesType* indices,
+                                                   const ScatterElementsUpdateShape& shape)
+            {
+                size_t count = shape_size(shape.indices_shape);
+                for (size_t i = 0; i < count; i++)
+                {
+                    int64_t index = static_cast<int64_t>(indices[i]);
+                    NGRAPH_CHECK(index >= 0 && index < static_cast<int64_t>(shape.axis_size),
+                                 "Provided index ",
+                                 index,
+                                 " is out of input data bounds [0, ",
+                                 shape.axis_size,
+                                 ") on axis ",
+                                 shape.axis,
+                                 ".");
+                }
+            }
+
+            // Writes the updates of the lines [line_begin, line_end) into out, which already
+            // holds the data. The indices must have been checked.
+            template <typename DataType, typename IndicesType>
+            void scatter_elem_update_lines(const IndicesType* indices,
+                                           const DataType* updates,
+                                           DataType* out,
+                                           const ScatterElementsUpdateShape& shape,
+                                           size_t line_begin,
+                                           size_t line_end)
+            {
+                size_t rank = shape.indices_shape.size();
+                size_t indices_axis_stride = shape.indices_strides[shape.axis];
+                size_t data_axis_stride = shape.data_strides[shape.axis];
+                for (size_t line = line_begin; line < line_end; line++)
+                {
+                    // Coordinate of the line on the indices axes other than the axis
+                    size_t rest = line;
+                    size_t indices_offset = 0;
+                    size_t data_offset = 0;
+                    for (size_t i = rank; i-- > 0;)
+                    {
+                        if (i == shape.axis)
+                        {
+                            continue;
+                        }
+                        size_t coordinate = rest % shape.indices_shape[i];
+                        rest /= shape.indices_shape[i];
+                        indices_offset += coordinate * shape.indices_strides[i];
+                        data_offset += coordinate * shape.data_strides[i];
+                    }
+                    for (size_t k = 0; k < shape.num_indices; k++)
+                    {
+                        size_t i = indices_offset + k * indices_axis_stride;
+                        size_t index = static_cast<size_t>(indices[i]);
+                        out[data_offset + index * data_axis_stride] = updates[i];
+                    }
+                }
+            }
+
             template <typename DataType, typename IndicesType>
             void scatter_elem_update(const DataType* input_data,
                                      const IndicesType* indices,
@@ -37,28 +135,19 @@ namespace ngraph
                                      const Shape& data_shape,
                                      const Shape& indices_shape)
             {
-                // Copy inputs to out
-                std::memcpy(out_buf, input_data, sizeof(DataType) * shape_size(data_shape));
+                if (input_data != out_buf)
+                {
+                    std::memcpy(out_buf, input_data, sizeof(DataType) * shape_size(data_shape));
+                }
 
                 // 3D example
                 // output[indices[i][j][k]][j][k] = updates[i][j][k] if axis = 0,
                 // output[i][indices[i][j][k]][k] = updates[i][j][k] if axis = 1,
                 // output[i][j][indices[i][j][k]] = updates[i][j][k] if axis = 2
-
-                CoordinateTransform indices_transform{indices_shape};
-                CoordinateTransform data_transform{data_shape};
-
-                for (const Coordinate& indices_cord : indices_transform)
-                {
-                    const size_t indices_idx = indices_transform.index(indices_cord);
-                    Coordinate out_cord(indices_cord);
-                    out_cord.at(axis) = indices[indices_idx];
-                    NGRAPH_CHECK(data_transform.has_source_coordinate(out_cord),
-                                 "Provided index coordinates are out of input data bounds: ",
-                                 out_cord,
-                                 ".");
-                    out_buf[data_transform.index(out_cord)] = updates[indices_idx];
-                }
+                ScatterElementsUpdateShape shape(
+                    data_shape, indices_shape, static_cast<size_t>(axis));
+                scatter_elem_update_check_indices(indices, shape);
+                scatter_elem_update_lines(indices, updates, out_buf, shape, 0, shape.lines());
             }
         }
     }
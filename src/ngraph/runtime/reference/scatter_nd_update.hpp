@@ -0,0 +1,129 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "ngraph/check.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            // Each of the indices_shape[:-1] index tuples addresses a slice of the trailing
+            // data_shape[k:] axes, k being the length of the tuples.
+            inline size_t scatter_nd_slice_size(const Shape& data_shape, const Shape& indices_shape)
+            {
+                size_t slice_size = 1;
+                for (size_t i = indices_shape.back(); i < data_shape.size(); i++)
+                {
+                    slice_size *= data_shape[i];
+                }
+                return slice_size;
+            }
+
+            // Fills offsets with the element offset in the data of the slice of every index
+            // tuple, checking that the tuples are within the data, and returns whether the
+            // slices are all distinct, in which case they can be written in any order.
+            template <typename U>
+            bool scatter_nd_slice_offsets(const U* indices,
+                                          const Shape& data_shape,
+                                          const Shape& indices_shape,
+                                          std::vector<size_t>& offsets)
+            {
+                size_t k = indices_shape.back();
+                size_t num_slices = 1;
+                for (size_t i = 0; i + 1 < indices_shape.size(); i++)
+                {
+                    num_slices *= indices_shape[i];
+                }
+                std::vector<size_t> strides(k);
+                size_t stride = scatter_nd_slice_size(data_shape, indices_shape);
+                for (size_t d = k; d-- > 0;)
+                {
+                    strides[d] = stride;
+                    stride *= data_shape[d];
+                }
+                offsets.resize(num_slices);
+                for (size_t s = 0; s < num_slices; s++)
+                {
+                    size_t offset = 0;
+                    for (size_t d = 0; d < k; d++)
+                    {
+                        int64_t index = static_cast<int64_t>(indices[s * k + d]);
+                        NGRAPH_CHECK(index >= 0 && index < static_cast<int64_t>(data_shape[d]),
+                                     "ScatterND index ",
+                                     index,
+                                     " is out of range [0, ",
+                                     data_shape[d],
+                                     ") on axis ",
+                                     d);
+                        offset += static_cast<size_t>(index) * strides[d];
+                    }
+                    offsets[s] = offset;
+                }
+                std::vector<size_t> sorted(offsets);
+                std::sort(sorted.begin(), sorted.end());
+                return std::adjacent_find(sorted.begin(), sorted.end()) == sorted.end();
+            }
+
+            // Copies the update slices [slice_begin, slice_end) to their offsets in out, which
+            // already holds the data
+            template <typename T>
+            void scatter_nd_update_slices(const T* updates,
+                                          T* out,
+                                          const std::vector<size_t>& offsets,
+                                          size_t slice_size,
+                                          size_t slice_begin,
+                                          size_t slice_end)
+            {
+                for (size_t s = slice_begin; s < slice_end; s++)
+                {
+                    std::memcpy(
+                        out + offsets[s], updates + s * slice_size, slice_size * sizeof(T));
+                }
+            }
+
+            template <typename T, typename U>
+            void scatter_nd_update(const T* data,
+                                   const U* indices,
+                                   const T* updates,
+                                   T* out,
+                                   const Shape& data_shape,
+                                   const Shape& indices_shape)
+            {
+                if (data != out)
+                {
+                    std::memcpy(out, data, shape_size(data_shape) * sizeof(T));
+                }
+                std::vector<size_t> offsets;
+                scatter_nd_slice_offsets(indices, data_shape, indices_shape, offsets);
+                scatter_nd_update_slices(updates,
+                                         out,
+                                         offsets,
+                                         scatter_nd_slice_size(data_shape, indices_shape),
+                                         0,
+                                         offsets.size());
+            }
+        }
+    }
+}
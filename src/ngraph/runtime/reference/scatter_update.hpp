@@ -0,0 +1,124 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstring>
+#include <vector>
+
+#include "ngraph/check.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            // ScatterUpdate views the data as [outer, axis_size, inner] and the updates as
+            // [outer, num_indices, inner]; update row j of block o replaces row indices[j] of
+            // the same block of the output.
+            struct ScatterUpdateShape
+            {
+                size_t outer;
+                size_t axis_size;
+                size_t inner;
+                size_t num_indices;
+
+                ScatterUpdateShape(const Shape& data_shape,
+                                   const Shape& indices_shape,
+                                   size_t axis)
+                    : outer(1)
+                    , axis_size(data_shape.at(axis))
+                    , inner(1)
+                    , num_indices(shape_size(indices_shape))
+                {
+                    for (size_t i = 0; i < axis; i++)
+                    {
+                        outer *= data_shape[i];
+                    }
+                    for (size_t i = axis + 1; i < data_shape.size(); i++)
+                    {
+                        inner *= data_shape[i];
+                    }
+                }
+
+                size_t rows() const { return outer * num_indices; }
+            };
+
+            // Checks that every index is within the axis and returns whether they are all
+            // distinct, in which case the update rows can be written in any order.
+            template <typename U>
+            bool scatter_update_indices_are_unique(const U* indices,
+                                                   const ScatterUpdateShape& shape)
+            {
+                std::vector<bool> seen(shape.axis_size, false);
+                bool unique = true;
+                for (size_t j = 0; j < shape.num_indices; j++)
+                {
+                    int64_t index = static_cast<int64_t>(indices[j]);
+                    NGRAPH_CHECK(index >= 0 && index < static_cast<int64_t>(shape.axis_size),
+                                 "ScatterUpdate index ",
+                                 index,
+                                 " is out of range [0, ",
+                                 shape.axis_size,
+                                 ")");
+                    unique = unique && !seen[index];
+                    seen[index] = true;
+                }
+                return unique;
+            }
+
+            // Writes the update rows [row_begin, row_end) of the [outer, num_indices] rows into
+            // out, which already holds the data. The indices must have been checked.
+            template <typename T, typename U>
+            void scatter_update_rows(const U* indices,
+                                     const T* updates,
+                                     T* out,
+                                     const ScatterUpdateShape& shape,
+                                     size_t row_begin,
+                                     size_t row_end)
+            {
+                for (size_t row = row_begin; row < row_end; row++)
+                {
+                    size_t o = row / shape.num_indices;
+                    size_t index = static_cast<size_t>(indices[row % shape.num_indices]);
+                    std::memcpy(out + (o * shape.axis_size + index) * shape.inner,
+                                updates + row * shape.inner,
+                                shape.inner * sizeof(T));
+                }
+            }
+
+            template <typename T, typename U>
+            void scatter_update(const T* data,
+                                const U* indices,
+                                const T* updates,
+                                T* out,
+                                const Shape& data_shape,
+                                const Shape& indices_shape,
+                                size_t axis)
+            {
+                if (data != out)
+                {
+                    std::memcpy(out, data, shape_size(data_shape) * sizeof(T));
+                }
+                ScatterUpdateShape shape(data_shape, indices_shape, axis);
+                scatter_update_indices_are_unique(indices, shape);
+                scatter_update_rows(indices, updates, out, shape, 0, shape.rows());
+            }
+        }
+    }
+}
@@ -37,20 +37,14 @@ namespace ngraph
                        const Shape& out_shape)
             {
                 CoordinateTransform input_transform(arg_shape, lower_bounds, upper_bounds, strides);
-                CoordinateTransform output_transform(out_shape);
-
-                CoordinateTransform::Iterator output_it = output_transform.begin();
 
                 NGRAPH_CHECK(shape_size(input_transform.get_target_shape()) ==
-                             shape_size(output_transform.get_target_shape()));
+                             shape_size(out_shape));
 
-                for (const Coordinate& in_coord : input_transform)
+                // The output is visited in row-major order, so its index is the target index
+                for (auto in_it = input_transform.index_begin(); in_it.valid(); ++in_it)
                 {
-                    const Coordinate& out_coord = *output_it;
-
-                    out[output_transform.index(out_coord)] = arg[input_transform.index(in_coord)];
-
-                    ++output_it;
+                    out[in_it.target_index()] = arg[in_it.source_index()];
                 }
             }
         }
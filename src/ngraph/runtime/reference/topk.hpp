@@ -18,9 +18,12 @@
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
 #include <numeric>
+#include <tuple>
+#include <vector>
 
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/shape.hpp"
 #include "ngraph/op/topk.hpp"
 
 namespace ngraph
@@ -69,6 +72,45 @@ namespace ngraph
                 return std::get<1>(a) > std::get<1>(b);
             }
 
+            namespace detail
+            {
+                // A bounded heap costs one comparison for most elements once it is full, while
+                // nth_element copies and partitions the whole slice. The heap wins as long as k
+                // is a small fraction of the axis.
+                inline bool topk_use_heap(size_t n, size_t k) { return k > 0 && k * 8 <= n; }
+
+                // Keeps the k best elements of the strided slice in a heap whose front is the
+                // worst element kept so far, then orders the result best first.
+                template <typename T, typename U, typename Compare>
+                void topk_heap_select(const T* arg,
+                                      size_t n,
+                                      size_t stride,
+                                      size_t k,
+                                      std::vector<std::tuple<T, U>>& heap,
+                                      Compare better)
+                {
+                    heap.clear();
+                    for (size_t i = 0; i < n; i++)
+                    {
+                        std::tuple<T, U> entry(arg[i * stride], static_cast<U>(i));
+                        if (heap.size() < k)
+                        {
+                            heap.push_back(entry);
+                            std::push_heap(heap.begin(), heap.end(), better);
+                        }
+                        else if (better(entry, heap.front()))
+                        {
+                            std::pop_heap(heap.begin(), heap.end(), better);
+                            heap.back() = entry;
+                            std::push_heap(heap.begin(), heap.end(), better);
+                        }
+                    }
+                    std::sort_heap(heap.begin(), heap.end(), better);
+                }
+            }
+
+            // Slices are the lines along "axis", numbered in row-major order of the remaining
+            // axes; [slice_begin, slice_end) lets callers split the work between threads.
             template <typename T, typename U>
             void topk(const T* arg,
                       U* out_indices,
@@ -78,87 +120,103 @@ namespace ngraph
                       size_t axis,
                       size_t k,
                       bool compute_max,
-                      op::v0::TopK::SortType sort = op::v0::TopK::SortType::none)
+                      op::v0::TopK::SortType sort = op::v0::TopK::SortType::none,
+                      size_t slice_begin = 0,
+                      size_t slice_end = std::numeric_limits<size_t>::max())
             {
                 using namespace std;
-                // reorder source axis visit order and make "axis" inner most
-                size_t ndim = static_cast<size_t>(in_shape.size());
-                Coordinate start_corner(ndim, 0);
-                Coordinate end_corner(in_shape);
-                end_corner[axis] = 1;
-                Strides strides(ndim, 1);
-                AxisVector axis_order(ndim);
-                iota(axis_order.begin(), axis_order.end(), 0);
-                axis_order.erase(axis_order.begin() + axis);
-                axis_order.push_back(axis);
-                // Create CoordinateTransforms that visits only the first element along "axis"
-                CoordinateTransform input_transform(
-                    in_shape, start_corner, end_corner, strides, axis_order);
-                CoordinateTransform output_transform(
-                    out_shape, start_corner, end_corner, strides, axis_order);
+                size_t n = in_shape[axis];
+                size_t inner = shape_size(Shape(in_shape.begin() + axis + 1, in_shape.end()));
+                size_t slices = n == 0 ? 0 : shape_size(in_shape) / n;
+                size_t out_n = out_shape[axis];
+                slice_end = std::min(slice_end, slices);
+                bool use_heap = detail::topk_use_heap(n, k);
                 // Create temp vector for sorting.
-                vector<tuple<T, U>> workspace(in_shape[axis]);
-                vector<size_t> in_strides = ngraph::row_major_strides(in_shape);
-                vector<size_t> out_strides = ngraph::row_major_strides(out_shape);
-                auto in_axis_stride = in_strides[axis];
-                auto out_axis_stride = out_strides[axis];
-                for (const Coordinate& coord : input_transform)
+                vector<tuple<T, U>> workspace;
+                workspace.reserve(use_heap ? k : n);
+                for (size_t slice = slice_begin; slice < slice_end; slice++)
                 {
-                    auto arg_index = input_transform.index(coord);
-                    auto out_index = output_transform.index(coord);
-                    // Fill the temp vector
-                    U i = 0;
-                    for (tuple<T, U>& entry : workspace)
-                    {
-                        get<0>(entry) = arg[arg_index];
-                        get<1>(entry) = i;
-                        arg_index += in_axis_stride;
-                        i++;
-                    }
-                    // Sort the temp vector
-                    if (compute_max)
-                    {
-                        nth_element(workspace.begin(),
-                                    workspace.begin() + k,
-                                    workspace.end(),
-                                    compare_max<T, U>);
-                    }
-                    else
-                    {
-                        nth_element(workspace.begin(),
-                                    workspace.begin() + k,
-                                    workspace.end(),
-                                    compare_min<T, U>);
-                    }
-                    // Write temp vector to output
-                    if (compute_max)
+                    size_t outer_index = slice / inner;
+                    size_t inner_index = slice % inner;
+                    const T* in = arg + outer_index * n * inner + inner_index;
+                    size_t out_index = outer_index * out_n * inner + inner_index;
+                    if (use_heap)
                     {
-                        switch (sort)
+                        // The heap leaves the result in value order, so only an index sort is
+                        // left to do.
+                        if (compute_max)
+                        {
+                            detail::topk_heap_select<T, U>(
+                                in, n, inner, k, workspace, compare_max<T, U>);
+                        }
+                        else
+                        {
+                            detail::topk_heap_select<T, U>(
+                                in, n, inner, k, workspace, compare_min<T, U>);
+                        }
+                        if (sort == op::v0::TopK::SortType::index)
                         {
-                        case op::v0::TopK::SortType::none: break;
-                        case op::v0::TopK::SortType::index:
                             std::sort(workspace.begin(),
-                                      workspace.begin() + k,
-                                      sort_indices_descending<T, U>);
-                            break;
-                        case op::v0::TopK::SortType::value:
-                            std::sort(workspace.begin(), workspace.begin() + k, compare_max<T, U>);
-                            break;
+                                      workspace.end(),
+                                      compute_max ? sort_indices_descending<T, U>
+                                                  : sort_indices_ascending<T, U>);
                         }
                     }
                     else
                     {
-                        switch (sort)
+                        // Fill the temp vector
+                        workspace.resize(n);
+                        for (size_t i = 0; i < n; i++)
                         {
-                        case op::v0::TopK::SortType::none: break;
-                        case op::v0::TopK::SortType::index:
-                            std::sort(workspace.begin(),
-                                      workspace.begin() + k,
-                                      sort_indices_ascending<T, U>);
-                            break;
-                        case op::v0::TopK::SortType::value:
-                            std::sort(workspace.begin(), workspace.begin() + k, compare_min<T, U>);
-                            break;
+                            workspace[i] = tuple<T, U>(in[i * inner], static_cast<U>(i));
+                        }
+                        // Sort the temp vector
+                        if (compute_max)
+                        {
+                            nth_element(workspace.begin(),
+                                        workspace.begin() + k,
+                                        workspace.end(),
+                                        compare_max<T, U>);
+                        }
+                        else
+                        {
+                            nth_element(workspace.begin(),
+                                        workspace.begin() + k,
+                                        workspace.end(),
+                                        compare_min<T, U>);
+                        }
+                        // Write temp vector to output
+                        if (compute_max)
+                        {
+                            switch (sort)
+                            {
+                            case op::v0::TopK::SortType::none: break;
+                            case op::v0::TopK::SortType::index:
+                                std::sort(workspace.begin(),
+                                          workspace.begin() + k,
+                                          sort_indices_descending<T, U>);
+                                break;
+                            case op::v0::TopK::SortType::value:
+                                std::sort(
+                                    workspace.begin(), workspace.begin() + k, compare_max<T, U>);
+                                break;
+                            }
+                        }
+                        else
+                        {
+                            switch (sort)
+                            {
+                            case op::v0::TopK::SortType::none: break;
+                            case op::v0::TopK::SortType::index:
+                                std::sort(workspace.begin(),
+                                          workspace.begin() + k,
+                                          sort_indices_ascending<T, U>);
+                                break;
+                            case op::v0::TopK::SortType::value:
+                                std::sort(
+                                    workspace.begin(), workspace.begin() + k, compare_min<T, U>);
+                                break;
+                            }
                         }
                     }
                     for (size_t j = 0; j < k; j++)
@@ -166,7 +224,7 @@ namespace ngraph
                         tuple<T, U> entry = workspace[j];
                         out_values[out_index] = get<0>(entry);
                         out_indices[out_index] = get<1>(entry);
-                        out_index += out_axis_stride;
+                        out_index += inner;
                     }
                 }
             }
@@ -0,0 +1,360 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <map>
+#include <typeindex>
+#include <unordered_map>
+
+#include "ngraph/check.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/pass/pass_util.hpp"
+#include "ngraph/runtime/shared_backbone.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    // Identifies a node by what it computes: the same key in two functions means the node
+    // produces the same values. Inputs are the ids of the keys of the argument nodes.
+    class SubgraphKey
+    {
+    public:
+        SubgraphKey(const shared_ptr<Node>& node,
+                    const string& attributes,
+                    vector<pair<size_t, size_t>> inputs)
+            : m_node(node)
+            , m_type(typeid(*node))
+            , m_attributes(attributes)
+            , m_constant(as_type_ptr<op::v0::Constant>(node))
+            , m_inputs(move(inputs))
+        {
+            vector<size_t> hashes{hash<type_index>()(m_type), hash<string>()(m_attributes)};
+            for (auto& input : m_inputs)
+            {
+                hashes.push_back(input.first);
+                hashes.push_back(input.second);
+            }
+            if (m_constant)
+            {
+                hashes.push_back(pass::hash_constant(*m_constant));
+            }
+            m_hash = hash_combine(hashes);
+        }
+
+        size_t get_hash() const { return m_hash; }
+        bool operator==(const SubgraphKey& other) const
+        {
+            if (m_hash != other.m_hash || m_type != other.m_type ||
+                m_attributes != other.m_attributes || m_inputs != other.m_inputs ||
+                m_node->get_output_size() != other.m_node->get_output_size())
+            {
+                return false;
+            }
+            if (m_constant && !pass::constants_equal(*m_constant, *other.m_constant))
+            {
+                return false;
+            }
+            for (size_t i = 0; i < m_node->get_output_size(); i++)
+            {
+                if (m_node->get_output_element_type(i) !=
+                        other.m_node->get_output_element_type(i) ||
+                    !m_node->get_output_partial_shape(i).same_scheme(
+                        other.m_node->get_output_partial_shape(i)))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+    private:
+        shared_ptr<Node> m_node;
+        type_index m_type;
+        string m_attributes;
+        shared_ptr<op::v0::Constant> m_constant;
+        vector<pair<size_t, size_t>> m_inputs;
+        size_t m_hash;
+    };
+
+    struct SubgraphKeyHash
+    {
+        size_t operator()(const SubgraphKey& key) const { return key.get_hash(); }
+    };
+
+    // Nodes that can be moved into the backbone: stateless ops whose attributes can all be
+    // compared, without control dependencies that would tie them to one function
+    bool is_shareable(Node& node, string& attributes)
+    {
+        if (!node.is_op() || node.is_output() || node.is_parameter() || node.has_state() ||
+            !node.get_control_dependencies().empty())
+        {
+            return false;
+        }
+        return is_type<op::v0::Constant>(&node) || pass::get_attribute_key(node, attributes);
+    }
+
+    shared_ptr<Node> clone_node(const shared_ptr<Node>& node, const OutputVector& args)
+    {
+        auto clone = node->copy_with_new_inputs(args);
+        clone->set_friendly_name(node->get_friendly_name());
+        return clone;
+    }
+}
+
+runtime::SharedBackbone::Partition
+    runtime::SharedBackbone::partition(const vector<shared_ptr<Function>>& functions)
+{
+    NGRAPH_CHECK(!functions.empty(), "SharedBackbone requires at least one function");
+    const ParameterVector& parameters = functions[0]->get_parameters();
+    for (auto& f : functions)
+    {
+        NGRAPH_CHECK(f->get_parameters().size() == parameters.size(),
+                     "Functions of a shared backbone must have the same parameters");
+        for (size_t i = 0; i < parameters.size(); i++)
+        {
+            NGRAPH_CHECK(
+                f->get_parameters()[i]->get_element_type() == parameters[i]->get_element_type() &&
+                    f->get_parameters()[i]->get_partial_shape().same_scheme(
+                        parameters[i]->get_partial_shape()),
+                "Parameter ",
+                i,
+                " of function ",
+                f->get_name(),
+                " does not match the other functions");
+        }
+    }
+
+    // Give every node an id, equal for nodes computing the same values. Parameter i has id i.
+    // An id is shared when it occurs in every function.
+    unordered_map<SubgraphKey, size_t, SubgraphKeyHash> key_ids;
+    vector<size_t> function_count(parameters.size(), functions.size());
+    vector<size_t> last_function(parameters.size(), functions.size());
+    vector<unordered_map<Node*, size_t>> node_ids(functions.size());
+    vector<vector<shared_ptr<Node>>> ordered_ops(functions.size());
+    for (size_t k = 0; k < functions.size(); k++)
+    {
+        const ParameterVector& f_parameters = functions[k]->get_parameters();
+        for (size_t i = 0; i < f_parameters.size(); i++)
+        {
+            node_ids[k][f_parameters[i].get()] = i;
+        }
+        ordered_ops[k] = functions[k]->get_ordered_ops();
+        for (auto& node : ordered_ops[k])
+        {
+            if (node->is_parameter())
+            {
+                continue;
+            }
+            size_t id = function_count.size();
+            string attributes;
+            if (is_shareable(*node, attributes))
+            {
+                vector<pair<size_t, size_t>> inputs;
+                for (auto& arg : node->input_values())
+                {
+                    inputs.emplace_back(node_ids[k].at(arg.get_node()), arg.get_index());
+                }
+                id = key_ids.emplace(SubgraphKey(node, attributes, move(inputs)), id)
+                         .first->second;
+            }
+            if (id == function_count.size())
+            {
+                function_count.push_back(0);
+                last_function.push_back(functions.size());
+            }
+            if (last_function[id] != k)
+            {
+                last_function[id] = k;
+                function_count[id]++;
+            }
+            node_ids[k][node.get()] = id;
+        }
+    }
+    auto is_shared = [&](size_t id) {
+        return id >= parameters.size() && function_count[id] == functions.size();
+    };
+
+    // The backbone holds the shared nodes, cloned from the first function
+    Partition partition;
+    ParameterVector backbone_parameters;
+    vector<shared_ptr<Node>> backbone_nodes(function_count.size());
+    for (size_t i = 0; i < parameters.size(); i++)
+    {
+        auto parameter = make_shared<op::v0::Parameter>(parameters[i]->get_element_type(),
+                                                         parameters[i]->get_partial_shape());
+        parameter->set_friendly_name(parameters[i]->get_friendly_name());
+        backbone_parameters.push_back(parameter);
+        backbone_nodes[i] = parameter;
+    }
+    for (auto& node : ordered_ops[0])
+    {
+        size_t id = node_ids[0].at(node.get());
+        if (is_shared(id) && !backbone_nodes[id])
+        {
+            OutputVector args;
+            for (auto& arg : node->input_values())
+            {
+                args.push_back(
+                    backbone_nodes[node_ids[0].at(arg.get_node())]->output(arg.get_index()));
+            }
+            backbone_nodes[id] = clone_node(node, args);
+        }
+    }
+
+    // Each head computes the rest of its function. Values it needs from the backbone or the
+    // original parameters become its parameters.
+    map<pair<size_t, size_t>, size_t> backbone_output_index;
+    OutputVector backbone_outputs;
+    for (size_t k = 0; k < functions.size(); k++)
+    {
+        ParameterVector head_parameters;
+        vector<HeadInput> head_inputs;
+        map<pair<size_t, size_t>, shared_ptr<Node>> head_parameter_map;
+        unordered_map<Node*, shared_ptr<Node>> head_nodes;
+        auto head_value = [&](const Output<Node>& value) -> Output<Node> {
+            size_t id = node_ids[k].at(value.get_node());
+            if (id >= parameters.size() && !is_shared(id))
+            {
+                return head_nodes.at(value.get_node())->output(value.get_index());
+            }
+            auto source = make_pair(id, value.get_index());
+            auto it = head_parameter_map.find(source);
+            if (it == head_parameter_map.end())
+            {
+                HeadInput input{HeadInput::Source::parameter, id};
+                if (id >= parameters.size())
+                {
+                    auto index = backbone_output_index.find(source);
+                    if (index == backbone_output_index.end())
+                    {
+                        index = backbone_output_index.emplace(source, backbone_outputs.size())
+                                    .first;
+                        backbone_outputs.push_back(
+                            backbone_nodes[id]->output(value.get_index()));
+                    }
+                    input = HeadInput{HeadInput::Source::backbone, index->second};
+                }
+                auto parameter = make_shared<op::v0::Parameter>(
+                    value.get_element_type(), value.get_partial_shape());
+                parameter->set_friendly_name(value.get_node()->get_friendly_name());
+                head_parameters.push_back(parameter);
+                head_inputs.push_back(input);
+                it = head_parameter_map.emplace(source, parameter).first;
+            }
+            return it->second->output(0);
+        };
+        for (auto& node : ordered_ops[k])
+        {
+            size_t id = node_ids[k].at(node.get());
+            if (id < parameters.size() || is_shared(id))
+            {
+                continue;
+            }
+            OutputVector args;
+            for (auto& arg : node->input_values())
+            {
+                args.push_back(head_value(arg));
+            }
+            head_nodes[node.get()] = clone_node(node, args);
+        }
+        ResultVector results;
+        for (auto& result : functions[k]->get_results())
+        {
+            results.push_back(as_type_ptr<op::v0::Result>(head_nodes.at(result.get())));
+        }
+        partition.heads.push_back(
+            make_shared<Function>(results, head_parameters, functions[k]->get_name()));
+        partition.head_inputs.push_back(head_inputs);
+    }
+
+    if (!backbone_outputs.empty())
+    {
+        ResultVector results;
+        for (auto& output : backbone_outputs)
+        {
+            results.push_back(make_shared<op::v0::Result>(output));
+        }
+        partition.backbone = make_shared<Function>(results, backbone_parameters, "backbone");
+    }
+    return partition;
+}
+
+runtime::SharedBackbone::SharedBackbone(const shared_ptr<Backend>& backend,
+                                        const vector<shared_ptr<Function>>& functions)
+    : m_partition(partition(functions))
+{
+    if (m_partition.backbone)
+    {
+        m_backbone = backend->compile(m_partition.backbone);
+        for (size_t i = 0; i < m_partition.backbone->get_results().size(); i++)
+        {
+            m_backbone_outputs.push_back(m_backbone->create_output_tensor(i));
+        }
+    }
+    for (auto& head : m_partition.heads)
+    {
+        m_heads.push_back(backend->compile(head));
+    }
+}
+
+bool runtime::SharedBackbone::call_backbone(const vector<shared_ptr<Tensor>>& inputs)
+{
+    return !m_backbone || m_backbone->call(m_backbone_outputs, inputs);
+}
+
+bool runtime::SharedBackbone::call_head(size_t index,
+                                        const vector<shared_ptr<Tensor>>& outputs,
+                                        const vector<shared_ptr<Tensor>>& inputs)
+{
+    vector<shared_ptr<Tensor>> head_inputs;
+    for (const HeadInput& input : m_partition.head_inputs.at(index))
+    {
+        head_inputs.push_back(input.source == HeadInput::Source::parameter
+                                  ? inputs.at(input.index)
+                                  : m_backbone_outputs.at(input.index));
+    }
+    return m_heads.at(index)->call(outputs, head_inputs);
+}
+
+bool runtime::SharedBackbone::call(size_t index,
+                                   const vector<shared_ptr<Tensor>>& outputs,
+                                   const vector<shared_ptr<Tensor>>& inputs)
+{
+    NGRAPH_CHECK(index < m_heads.size(), "No function ", index, " in shared backbone");
+    lock_guard<mutex> lock(m_mutex);
+    return call_backbone(inputs) && call_head(index, outputs, inputs);
+}
+
+bool runtime::SharedBackbone::call_all(const vector<vector<shared_ptr<Tensor>>>& outputs,
+                                       const vector<shared_ptr<Tensor>>& inputs)
+{
+    NGRAPH_CHECK(outputs.size() == m_heads.size(),
+                 "Expected outputs for ",
+                 m_heads.size(),
+                 " functions, got ",
+                 outputs.size());
+    lock_guard<mutex> lock(m_mutex);
+    bool rc = call_backbone(inputs);
+    for (size_t i = 0; rc && i < m_heads.size(); i++)
+    {
+        rc = call_head(i, outputs[i], inputs);
+    }
+    return rc;
+}
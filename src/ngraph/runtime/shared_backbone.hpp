@@ -0,0 +1,104 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/executable.hpp"
+#include "ngraph/runtime/tensor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class SharedBackbone;
+    }
+}
+
+/// \brief Compiles a family of functions that share a common backbone.
+///
+/// Nodes that appear in every function, matched structurally by type, attributes, constant
+/// data and inputs, are split into a backbone function that is compiled once. Each function
+/// keeps a head that computes its results from the backbone outputs and its own parameters.
+/// A call runs the backbone and then the heads, so the family pays for the shared weights and
+/// their compilation only once.
+///
+/// All functions must take the same parameters, in the same order. Calls are serialized
+/// because the backbone outputs are kept in tensors owned by this object.
+class NGRAPH_API ngraph::runtime::SharedBackbone
+{
+public:
+    /// \brief Where a parameter of a head gets its value
+    struct HeadInput
+    {
+        enum class Source
+        {
+            parameter,
+            backbone
+        };
+        Source source;
+        /// Index into the parameters of the functions or into the results of the backbone
+        size_t index;
+    };
+
+    /// \brief Functions split into a backbone and one head per function
+    struct Partition
+    {
+        /// Computes the nodes shared by all functions; nullptr if they share none
+        std::shared_ptr<Function> backbone;
+        /// heads[i] computes the results of function i
+        std::vector<std::shared_ptr<Function>> heads;
+        /// head_inputs[i][j] is the source of parameter j of heads[i]
+        std::vector<std::vector<HeadInput>> head_inputs;
+    };
+
+    /// \brief Splits functions into a backbone and heads. The functions are not modified.
+    static Partition partition(const std::vector<std::shared_ptr<Function>>& functions);
+
+    /// \brief Partitions functions and compiles the backbone and the heads on backend
+    SharedBackbone(const std::shared_ptr<Backend>& backend,
+                   const std::vector<std::shared_ptr<Function>>& functions);
+
+    /// \brief Computes the results of function `index`
+    bool call(size_t index,
+              const std::vector<std::shared_ptr<Tensor>>& outputs,
+              const std::vector<std::shared_ptr<Tensor>>& inputs);
+
+    /// \brief Computes the results of every function, running the backbone once
+    /// \param outputs outputs[i] receives the results of function i
+    bool call_all(const std::vector<std::vector<std::shared_ptr<Tensor>>>& outputs,
+                  const std::vector<std::shared_ptr<Tensor>>& inputs);
+
+    const Partition& get_partition() const { return m_partition; }
+    size_t get_function_count() const { return m_heads.size(); }
+
+private:
+    bool call_backbone(const std::vector<std::shared_ptr<Tensor>>& inputs);
+    bool call_head(size_t index,
+                   const std::vector<std::shared_ptr<Tensor>>& outputs,
+                   const std::vector<std::shared_ptr<Tensor>>& inputs);
+
+    Partition m_partition;
+    std::shared_ptr<Executable> m_backbone;
+    std::vector<std::shared_ptr<Executable>> m_heads;
+    std::vector<std::shared_ptr<Tensor>> m_backbone_outputs;
+    std::mutex m_mutex;
+};
@@ -14,6 +14,9 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <chrono>
+
 #include "ngraph/runtime/tensor.hpp"
 #include "ngraph/descriptor/layout/tensor_layout.hpp"
 #include "ngraph/log.hpp"
@@ -83,6 +86,77 @@ void runtime::Tensor::set_stale(bool val)
     m_stale = val;
 }
 
+runtime::Tensor& runtime::Tensor::operator=(const Tensor& other)
+{
+    if (this != &other)
+    {
+        unique_lock<mutex> lock(m_pending_mutex, defer_lock);
+        unique_lock<mutex> other_lock(other.m_pending_mutex, defer_lock);
+        std::lock(lock, other_lock);
+        m_descriptor = other.m_descriptor;
+        m_stale = other.m_stale;
+        m_original_partial_shape = other.m_original_partial_shape;
+        m_pending_write = other.m_pending_write;
+        m_pending_reads = other.m_pending_reads;
+    }
+    return *this;
+}
+
+void runtime::Tensor::wait_for_read_ready() const
+{
+    // The futures are waited for without the lock, so that calls can still be recorded
+    shared_future<void> write;
+    {
+        lock_guard<mutex> lock(m_pending_mutex);
+        write = m_pending_write;
+    }
+    if (write.valid())
+    {
+        write.wait();
+    }
+}
+
+void runtime::Tensor::wait_for_write_ready() const
+{
+    wait_for_read_ready();
+    vector<shared_future<void>> reads;
+    {
+        lock_guard<mutex> lock(m_pending_mutex);
+        reads = m_pending_reads;
+    }
+    for (auto& read : reads)
+    {
+        read.wait();
+    }
+}
+
+void* runtime::Tensor::get_host_data_ptr()
+{
+    return nullptr;
+}
+
+void runtime::Tensor::set_pending_call(const shared_future<void>& done, bool is_output)
+{
+    lock_guard<mutex> lock(m_pending_mutex);
+    if (is_output)
+    {
+        // A call writing the tensor starts after the earlier ones have completed
+        m_pending_write = done;
+        m_pending_reads.clear();
+    }
+    else
+    {
+        m_pending_reads.erase(remove_if(m_pending_reads.begin(),
+                                        m_pending_reads.end(),
+                                        [](const shared_future<void>& read) {
+                                            return read.wait_for(chrono::seconds(0)) ==
+                                                   future_status::ready;
+                                        }),
+                              m_pending_reads.end());
+        m_pending_reads.push_back(done);
+    }
+}
+
 void runtime::Tensor::copy_from(const ngraph::runtime::Tensor& source)
 {
     if (get_element_count() != source.get_element_count())
@@ -16,7 +16,9 @@
 
 #pragma once
 
+#include <future>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "ngraph/descriptor/layout/tensor_layout.hpp"
@@ -41,7 +43,7 @@ namespace ngraph
 
         public:
             virtual ~Tensor() {}
-            Tensor& operator=(const Tensor&) = default;
+            Tensor& operator=(const Tensor& other);
 
             /// \brief Get tensor shape
             /// \return const reference to a Shape
@@ -101,12 +103,24 @@ namespace ngraph
             /// \param n Number of bytes to read, must be integral number of elements.
             virtual void read(void* p, size_t n) const = 0;
 
+            /// \brief Get the data of the tensor to read and write it in place, for tensors whose
+            ///    data is in host memory in the row-major layout of their shape. Callers wait for
+            ///    the calls using the tensor with wait_for_write_ready() first.
+            /// \return pointer to the data, or nullptr if it is not directly accessible
+            virtual void* get_host_data_ptr();
+
             /// \brief check tensor for new data, call may block.
             ///    backends may use this to ensure tensor is updated (eg: lazy eval).
-            virtual void wait_for_read_ready() {}
+            ///    By default waits for asynchronous calls writing this tensor to complete.
+            virtual void wait_for_read_ready() const;
             /// \brief notify tensor of new data, call may block.
             ///    backends may use this as indication of new data in tensor.
-            virtual void wait_for_write_ready() {}
+            ///    By default waits for asynchronous calls using this tensor to complete.
+            virtual void wait_for_write_ready() const;
+            /// \brief Record that an asynchronous call uses this tensor until `done` is ready.
+            /// \param done Becomes ready when the call has completed
+            /// \param is_output true if the call writes this tensor, false if it only reads it
+            void set_pending_call(const std::shared_future<void>& done, bool is_output);
             /// \brief copy bytes directly from source to this tensor
             /// \param source The source tensor
             virtual void copy_from(const ngraph::runtime::Tensor& source) NGRAPH_DEPRECATED(
@@ -117,6 +131,12 @@ namespace ngraph
             std::shared_ptr<ngraph::descriptor::Tensor> m_descriptor;
             bool m_stale;
             PartialShape m_original_partial_shape;
+            /// Guards the pending calls, which calls on other threads record and wait for
+            mutable std::mutex m_pending_mutex;
+            /// Completion of the last asynchronous call writing this tensor
+            std::shared_future<void> m_pending_write;
+            /// Completion of the asynchronous calls reading this tensor
+            std::vector<std::shared_future<void>> m_pending_reads;
         };
     }
 }
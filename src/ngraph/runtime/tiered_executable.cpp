@@ -0,0 +1,154 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/tiered_executable.hpp"
+#include "ngraph/check.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::TieredExecutable::TieredExecutable(const shared_ptr<Function>& function,
+                                            const shared_ptr<Backend>& backend,
+                                            const pass::PassConfig& fast_config,
+                                            const pass::PassConfig& optimized_config)
+{
+    NGRAPH_CHECK(backend, "TieredExecutable requires a backend");
+    set_parameters_and_results(*function);
+
+    // Compiling may rewrite the function, so every tier compiles its own clone
+    pass::PassConfig config = fast_config;
+    m_fast = backend->compile(clone_function(*function), config);
+    NGRAPH_CHECK(m_fast, "Fast tier compile of ", function->get_name(), " failed");
+    atomic_store(&m_current, m_fast);
+
+    shared_ptr<Function> optimized_function = clone_function(*function);
+    m_optimized = async(launch::async, [this, backend, optimized_function, optimized_config]() {
+        pass::PassConfig config = optimized_config;
+        auto optimized = backend->compile(optimized_function, config);
+        if (!optimized)
+        {
+            throw ngraph_error("Optimized tier compile failed");
+        }
+        atomic_store(&m_current, optimized);
+    });
+}
+
+runtime::TieredExecutable::~TieredExecutable()
+{
+    // The background compile refers to this executable
+    if (m_optimized.valid())
+    {
+        m_optimized.wait();
+    }
+}
+
+shared_ptr<runtime::Executable> runtime::TieredExecutable::get_current() const
+{
+    return atomic_load(&m_current);
+}
+
+bool runtime::TieredExecutable::call(const vector<shared_ptr<Tensor>>& outputs,
+                                     const vector<shared_ptr<Tensor>>& inputs)
+{
+    // The copy keeps the executable alive if the tiers switch during the call
+    return get_current()->call(outputs, inputs);
+}
+
+void runtime::TieredExecutable::warm_up()
+{
+    get_current()->warm_up();
+}
+
+vector<runtime::PerformanceCounter> runtime::TieredExecutable::get_performance_data() const
+{
+    return get_current()->get_performance_data();
+}
+
+shared_ptr<runtime::Tensor> runtime::TieredExecutable::create_input_tensor(size_t input_index)
+{
+    return m_fast->create_input_tensor(input_index);
+}
+
+shared_ptr<runtime::Tensor> runtime::TieredExecutable::create_input_tensor(size_t input_index,
+                                                                           void* memory_pointer)
+{
+    return m_fast->create_input_tensor(input_index, memory_pointer);
+}
+
+shared_ptr<runtime::Tensor> runtime::TieredExecutable::create_output_tensor(size_t output_index)
+{
+    return m_fast->create_output_tensor(output_index);
+}
+
+shared_ptr<runtime::Tensor> runtime::TieredExecutable::create_output_tensor(size_t output_index,
+                                                                            void* memory_pointer)
+{
+    return m_fast->create_output_tensor(output_index, memory_pointer);
+}
+
+bool runtime::TieredExecutable::is_optimized() const
+{
+    return get_current() != m_fast;
+}
+
+bool runtime::TieredExecutable::wait_for_optimized()
+{
+    if (m_optimized.valid())
+    {
+        try
+        {
+            m_optimized.get();
+        }
+        catch (const exception& e)
+        {
+            NGRAPH_WARN << "TieredExecutable keeps the fast tier: " << e.what();
+        }
+    }
+    return is_optimized();
+}
+
+pass::PassConfig runtime::TieredExecutable::fast_pass_config()
+{
+    // Pass names are interpreted by the backends, which ignore the ones they do not know
+    static const vector<string> optional_passes{"AlgebraicSimplification",
+                                                "BatchFusion",
+                                                "BiDirectionalRnn",
+                                                "CPUAttentionFusion",
+                                                "CPUCollapseDims",
+                                                "CPUElementwiseFusion",
+                                                "CPUFusion",
+                                                "CPUHorizontalFusion",
+                                                "CPUMemoryOptimization",
+                                                "CPUPostLayoutOptimizations",
+                                                "CPUPreFusion",
+                                                "CPUQuantFusion",
+                                                "CPURnnMatFusion",
+                                                "LSTMFusion",
+                                                "MultiLayerRNNFusion",
+                                                "QuantizedOpFusion",
+                                                "RNNFusion",
+                                                "ReshapeElimination",
+                                                "TransposeSinkingV1",
+                                                "VanillaRNNFusion"};
+    pass::PassConfig config;
+    for (auto& name : optional_passes)
+    {
+        config.set_pass_enable(name, false);
+    }
+    return config;
+}
@@ -0,0 +1,94 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <future>
+#include <memory>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/pass/pass_config.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/executable.hpp"
+#include "ngraph/runtime/tensor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class TieredExecutable;
+    }
+}
+
+/// \brief Serves calls from a quickly compiled executable while a fully optimized one is
+///        compiled in the background.
+///
+/// The constructor compiles a clone of the function with `fast_config`, which normally
+/// disables the expensive optimization passes, and returns. A background thread then compiles
+/// another clone with `optimized_config`. Once that compile finishes the optimized executable
+/// replaces the fast one for all the following calls; calls already running finish on the
+/// fast executable. If the optimized compile fails the fast executable keeps serving.
+///
+/// Both tiers are compiled on the same backend so they accept the same tensors. The optimized
+/// compile runs concurrently with whatever else the caller does with the backend. Variables of
+/// the function, see op::v0::ReadVariable, are not carried over when the tiers switch.
+class NGRAPH_API ngraph::runtime::TieredExecutable : public Executable
+{
+public:
+    /// \param function The function to run. It is not modified.
+    /// \param backend The backend compiling both tiers
+    /// \param fast_config The pass configuration of the fast tier
+    /// \param optimized_config The pass configuration of the optimized tier
+    TieredExecutable(const std::shared_ptr<Function>& function,
+                     const std::shared_ptr<Backend>& backend,
+                     const pass::PassConfig& fast_config = fast_pass_config(),
+                     const pass::PassConfig& optimized_config = pass::PassConfig());
+    ~TieredExecutable() override;
+
+    bool call(const std::vector<std::shared_ptr<Tensor>>& outputs,
+              const std::vector<std::shared_ptr<Tensor>>& inputs) override;
+
+    /// \brief Warms up the executable serving calls, the fast one until the switch
+    void warm_up() override;
+    std::vector<PerformanceCounter> get_performance_data() const override;
+
+    std::shared_ptr<Tensor> create_input_tensor(size_t input_index) override;
+    std::shared_ptr<Tensor> create_input_tensor(size_t input_index,
+                                                void* memory_pointer) override;
+    std::shared_ptr<Tensor> create_output_tensor(size_t output_index) override;
+    std::shared_ptr<Tensor> create_output_tensor(size_t output_index,
+                                                 void* memory_pointer) override;
+
+    /// \returns true once calls run on the optimized executable
+    bool is_optimized() const;
+
+    /// \brief Waits for the background compile to finish.
+    /// \returns true if calls now run on the optimized executable, false if its compile failed
+    bool wait_for_optimized();
+
+    /// \brief A pass configuration disabling the optional optimization passes of the
+    ///        backends, for the fast tier. Passes required for correctness are left enabled.
+    static pass::PassConfig fast_pass_config();
+
+private:
+    std::shared_ptr<Executable> get_current() const;
+
+    std::shared_ptr<Executable> m_fast;
+    /// The executable serving calls, read and replaced with the atomic shared_ptr accessors
+    std::shared_ptr<Executable> m_current;
+    std::future<void> m_optimized;
+};
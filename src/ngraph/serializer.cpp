@@ -16,10 +16,13 @@
 
 #include <fstream>
 #include <functional>
+#include <mutex>
 #include <queue>
 #include <stack>
+#include <thread>
 
 #include "ngraph/attribute_visitor.hpp"
+#include "ngraph/chrome_trace.hpp"
 #include "ngraph/cpio.hpp"
 #include "ngraph/env_util.hpp"
 #include "ngraph/factory.hpp"
@@ -32,6 +35,10 @@
 #include "ngraph/util.hpp"
 #include "nlohmann/json.hpp"
 
+#ifdef NGRAPH_ZLIB_ENABLE
+#include <zlib.h>
+#endif
+
 using namespace ngraph;
 using namespace std;
 using json = nlohmann::json;
@@ -284,13 +291,19 @@ public:
     shared_ptr<Node> deserialize_node_reference(json j);
     shared_ptr<Node> deserialize_node(json j);
     AxisSet deserialize_axis_set(json j);
+    /// \brief Creates the Constants of a list of serialized ops ahead of the other nodes,
+    ///        on NGRAPH_DESERIALIZE_THREADS threads (all hardware threads by default)
+    void decode_constants(const json& ops);
     shared_ptr<op::v0::TensorIterator::InputDescription>
         deserialize_tensor_iterator_input_description(json j);
     shared_ptr<op::v0::TensorIterator::OutputDescription>
         deserialize_tensor_iterator_output_description(json j);
 
 protected:
+    shared_ptr<Node> deserialize_constant(const json& node_js, const string& node_name);
+
     unordered_map<string, shared_ptr<Node>> m_node_map;
+    unordered_map<string, shared_ptr<Node>> m_decoded_constants;
     unordered_map<string, shared_ptr<Function>> m_function_map;
     function<const_data_callback_t> m_const_data_callback;
     map<string, Output<Node>> m_goe_alias;
@@ -435,26 +448,151 @@ void ngraph::serialize(ostream& out, shared_ptr<ngraph::Function> func, size_t i
     out << ::serialize(func, indent, false);
 }
 
-#if defined ENABLE_CPIO_FILE
-static void serialize_to_cpio(ostream& out, shared_ptr<ngraph::Function> func, size_t indent)
+// Suffix of the names of records holding zlib compressed constant data
+static const string compressed_record_suffix = ".z";
+
+// Compresses data into compressed, returning false if that would not make it smaller
+static bool compress_constant_data(const void* data, size_t size, vector<char>& compressed)
 {
-    string j = ::serialize(func, indent, true);
-    cpio::Writer writer(out);
-    writer.write(func->get_name(), j.c_str(), static_cast<uint32_t>(j.size()));
-
-    traverse_nodes(const_cast<Function*>(func.get()),
-                   [&](shared_ptr<Node> node) {
-                       if (auto c = node->as_type<op::v0::Constant>())
-                       {
-                           uint32_t size =
-                               static_cast<uint32_t>(shape_size(c->get_output_shape(0)) *
-                                                     c->get_output_element_type(0).size());
-                           writer.write(c->get_name(), c->get_data_ptr(), size);
-                       }
-                   },
-                   true);
+#ifdef NGRAPH_ZLIB_ENABLE
+    uLongf compressed_size = compressBound(static_cast<uLong>(size));
+    compressed.resize(compressed_size);
+    int rc = compress2(reinterpret_cast<Bytef*>(compressed.data()),
+                       &compressed_size,
+                       static_cast<const Bytef*>(data),
+                       static_cast<uLong>(size),
+                       Z_DEFAULT_COMPRESSION);
+    NGRAPH_CHECK(rc == Z_OK, "Failed to compress constant data: ", rc);
+    compressed.resize(compressed_size);
+    return compressed_size < size;
+#else
+    (void)data;
+    (void)size;
+    (void)compressed;
+    throw ngraph_error("nGraph was built without NGRAPH_ZLIB_ENABLE, constants cannot be"
+                       " compressed");
+#endif
 }
+
+// Decompresses the data of a compressed record straight into buffer. next_input points at the
+// next chunk of compressed data and returns its size, or 0 at the end of the record.
+static void decompress_constant_data(const function<size_t(const char**)>& next_input,
+                                     runtime::AlignedBuffer& buffer)
+{
+#ifdef NGRAPH_ZLIB_ENABLE
+    z_stream stream{};
+    NGRAPH_CHECK(inflateInit(&stream) == Z_OK, "Failed to initialize zlib");
+    stream.next_out = buffer.get_ptr<Bytef>();
+    stream.avail_out = static_cast<uInt>(buffer.size());
+    int rc = Z_OK;
+    while (rc == Z_OK)
+    {
+        const char* input = nullptr;
+        size_t input_size = next_input(&input);
+        if (input_size == 0)
+        {
+            break;
+        }
+        stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input));
+        stream.avail_in = static_cast<uInt>(input_size);
+        while (rc == Z_OK && stream.avail_in > 0)
+        {
+            rc = inflate(&stream, Z_NO_FLUSH);
+        }
+    }
+    size_t decompressed_size = stream.total_out;
+    inflateEnd(&stream);
+    NGRAPH_CHECK(rc == Z_STREAM_END && decompressed_size == buffer.size(),
+                 "Compressed constant data is corrupt");
+#else
+    (void)next_input;
+    (void)buffer;
+    throw ngraph_error("nGraph was built without NGRAPH_ZLIB_ENABLE, compressed constants cannot"
+                       " be loaded");
 #endif
+}
+
+// Writes the graph record followed by one record per Constant
+static void write_cpio(ostream& out,
+                       shared_ptr<ngraph::Function> func,
+                       const string& model,
+                       bool compress_constants)
+{
+    cpio::Writer writer(out);
+    writer.write(func->get_name(), model.c_str(), static_cast<uint32_t>(model.size()));
+
+    vector<char> compressed;
+    traverse_nodes(func.get(), [&](shared_ptr<Node> node) {
+        if (auto c = as_type_ptr<op::v0::Constant>(node))
+        {
+            uint32_t size = static_cast<uint32_t>(shape_size(c->get_output_shape(0)) *
+                                                  c->get_output_element_type(0).size());
+            if (compress_constants && compress_constant_data(c->get_data_ptr(), size, compressed))
+            {
+                // Decompressed into an aligned buffer, so the record itself needs no alignment
+                writer.write(c->get_name() + compressed_record_suffix,
+                             compressed.data(),
+                             static_cast<uint32_t>(compressed.size()));
+            }
+            else
+            {
+                // Align the payload so deserialize_mapped can reference it in place
+                writer.write(
+                    c->get_name(), c->get_data_ptr(), size, op::v0::Constant::host_alignment());
+            }
+        }
+    });
+}
+
+// Parses a graph record written as json text or, by serialize_binary, as MessagePack
+static json parse_model_record(const char* data, size_t size)
+{
+    // A MessagePack array of one function starts with the fixarray marker 0x91, a byte that
+    // cannot start a json text
+    if (size > 0 && static_cast<uint8_t>(data[0]) == 0x91)
+    {
+        return json::from_msgpack(data, data + size);
+    }
+    return json::parse(data, data + size);
+}
+
+void ngraph::serialize_to_cpio(ostream& out,
+                               shared_ptr<ngraph::Function> func,
+                               size_t indent,
+                               bool compress_constants)
+{
+    write_cpio(out, func, ::serialize(func, indent, true), compress_constants);
+}
+
+void ngraph::serialize_to_cpio(const string& path,
+                               shared_ptr<ngraph::Function> func,
+                               size_t indent,
+                               bool compress_constants)
+{
+    ofstream out(path, ios_base::binary | ios_base::out);
+    serialize_to_cpio(out, func, indent, compress_constants);
+}
+
+void ngraph::serialize_binary(ostream& out,
+                              shared_ptr<ngraph::Function> func,
+                              bool compress_constants)
+{
+    JSONSerializer serializer;
+    serializer.set_binary_constant_data(true);
+
+    json j;
+    j.push_back(serializer.serialize_function(*func));
+    vector<uint8_t> record = json::to_msgpack(j);
+    write_cpio(out, func, string(record.begin(), record.end()), compress_constants);
+}
+
+void ngraph::serialize_binary(const string& path,
+                              shared_ptr<ngraph::Function> func,
+                              bool compress_constants)
+{
+    ofstream out(path, ios_base::binary | ios_base::out);
+    serialize_binary(out, func, compress_constants);
+}
 
 static string serialize(shared_ptr<Function> func, size_t indent, bool binary_constant_data)
 {
@@ -484,6 +622,7 @@ std::string ngraph::serialize(std::shared_ptr<ngraph::Function> func, size_t ind
 
 shared_ptr<ngraph::Function> ngraph::deserialize(istream& in)
 {
+    event::Duration import_event("deserialize", "Import");
     shared_ptr<Function> rc;
     if (cpio::is_cpio(in))
     {
@@ -493,25 +632,53 @@ shared_ptr<ngraph::Function> ngraph::deserialize(istream& in)
         {
             // The first file is the model
             uint32_t size = static_cast<uint32_t>(file_info[0].get_size());
-            char* data = new char[size];
-            reader.read(file_info[0].get_name(), data, size);
-            string jstr(data, size);
-            delete[] data;
-            json js = json::parse(jstr);
+            vector<char> data(size);
+            reader.read(file_info[0].get_name(), data.data(), size);
+            json js = parse_model_record(data.data(), size);
             JSONDeserializer deserializer;
+            mutex read_mutex;
+            unordered_map<string, const cpio::FileInfo*> file_map;
+            for (const cpio::FileInfo& info : file_info)
+            {
+                file_map[info.get_name()] = &info;
+            }
             deserializer.set_const_data_callback(
                 [&](const string& const_name, const element::Type& et, const Shape& shape) {
                     shared_ptr<Node> const_node;
-                    for (const cpio::FileInfo& info : file_info)
+                    auto it = file_map.find(const_name);
+                    if (it != file_map.end())
                     {
-                        if (info.get_name() == const_name)
-                        {
-                            void* const_data = ngraph_malloc(info.get_size());
-                            reader.read(const_name, const_data, info.get_size());
-                            const_node = make_shared<op::v0::Constant>(et, shape, const_data);
-                            ngraph_free(const_data);
-                            break;
-                        }
+                        const cpio::FileInfo& info = *it->second;
+                        auto buffer = make_shared<runtime::AlignedBuffer>(
+                            info.get_size(), op::v0::Constant::host_alignment());
+                        // Constants are decoded concurrently but share the stream
+                        lock_guard<mutex> lock{read_mutex};
+                        reader.read(const_name, buffer->get_ptr(), info.get_size());
+                        const_node = make_shared<op::v0::Constant>(et, shape, buffer);
+                    }
+                    else if ((it = file_map.find(const_name + compressed_record_suffix)) !=
+                             file_map.end())
+                    {
+                        const cpio::FileInfo& info = *it->second;
+                        auto buffer = make_shared<runtime::AlignedBuffer>(
+                            shape_size(shape) * et.size(), op::v0::Constant::host_alignment());
+                        // Stream the record through a small window instead of reading it whole
+                        vector<char> window(min(info.get_size(), size_t{1} << 16));
+                        size_t offset = 0;
+                        // Only the reads share the stream, decompression runs unlocked
+                        decompress_constant_data(
+                            [&](const char** input) {
+                                size_t size = min(window.size(), info.get_size() - offset);
+                                {
+                                    lock_guard<mutex> lock{read_mutex};
+                                    reader.read(info, offset, window.data(), size);
+                                }
+                                offset += size;
+                                *input = window.data();
+                                return size;
+                            },
+                            *buffer);
+                        const_node = make_shared<op::v0::Constant>(et, shape, buffer);
                     }
                     return const_node;
                 });
@@ -531,6 +698,103 @@ shared_ptr<ngraph::Function> ngraph::deserialize(istream& in)
     return rc;
 }
 
+// Returns the data of a constant record in a mapped archive, referencing the mapping if possible
+static shared_ptr<runtime::AlignedBuffer>
+    load_mapped_constant(const shared_ptr<cpio::MappedReader>& reader,
+                         const cpio::FileInfo& info,
+                         bool compressed,
+                         size_t size)
+{
+    shared_ptr<runtime::AlignedBuffer> buffer;
+    char* data = reader->get_data(info);
+    if (compressed)
+    {
+        buffer = make_shared<runtime::AlignedBuffer>(size, op::v0::Constant::host_alignment());
+        bool consumed = false;
+        decompress_constant_data(
+            [&](const char** input) {
+                *input = data;
+                size_t input_size = consumed ? 0 : info.get_size();
+                consumed = true;
+                return input_size;
+            },
+            *buffer);
+    }
+    else if (reinterpret_cast<size_t>(data) % op::v0::Constant::host_alignment() == 0)
+    {
+        // Reference the mapping directly; the buffer keeps the reader alive
+        buffer = make_shared<runtime::AlignedBuffer>(data, info.get_size(), reader);
+    }
+    else
+    {
+        buffer = make_shared<runtime::AlignedBuffer>(info.get_size(),
+                                                     op::v0::Constant::host_alignment());
+        memcpy(buffer->get_ptr(), data, info.get_size());
+    }
+    return buffer;
+}
+
+shared_ptr<ngraph::Function> ngraph::deserialize_mapped(const string& path, bool lazy_constants)
+{
+    if (!cpio::is_cpio(path))
+    {
+        return deserialize(path);
+    }
+
+    event::Duration import_event("deserialize_mapped", "Import");
+    shared_ptr<Function> rc;
+    auto reader = make_shared<cpio::MappedReader>(path);
+    const vector<cpio::FileInfo>& file_info = reader->get_file_info();
+    if (file_info.size() > 0)
+    {
+        // The first file is the model
+        const cpio::FileInfo& model_info = file_info[0];
+        json js = parse_model_record(reader->get_data(model_info), model_info.get_size());
+
+        unordered_map<string, const cpio::FileInfo*> file_map;
+        for (const cpio::FileInfo& info : file_info)
+        {
+            file_map[info.get_name()] = &info;
+        }
+        JSONDeserializer deserializer;
+        deserializer.set_const_data_callback(
+            [&](const string& const_name, const element::Type& et, const Shape& shape) {
+                shared_ptr<Node> const_node;
+                bool compressed = false;
+                auto it = file_map.find(const_name);
+                if (it == file_map.end())
+                {
+                    it = file_map.find(const_name + compressed_record_suffix);
+                    compressed = true;
+                }
+                if (it != file_map.end())
+                {
+                    const cpio::FileInfo& info = *it->second;
+                    size_t size = shape_size(shape) * et.size();
+                    if (lazy_constants)
+                    {
+                        // The loader holds the reader, so the mapping outlives the deserializer
+                        const_node = make_shared<op::v0::Constant>(
+                            et, shape, [reader, info, compressed, size]() {
+                                return load_mapped_constant(reader, info, compressed, size);
+                            });
+                    }
+                    else
+                    {
+                        const_node = make_shared<op::v0::Constant>(
+                            et, shape, load_mapped_constant(reader, info, compressed, size));
+                    }
+                }
+                return const_node;
+            });
+        for (json func : js)
+        {
+            rc = deserializer.deserialize_function(func);
+        }
+    }
+    return rc;
+}
+
 shared_ptr<ngraph::Function> ngraph::deserialize(const string& s)
 {
     shared_ptr<Function> rc;
@@ -542,6 +806,7 @@ shared_ptr<ngraph::Function> ngraph::deserialize(const string& s)
     }
     else
     {
+        event::Duration import_event("deserialize", "Import");
         json js = json::parse(s);
         JSONDeserializer deserializer;
         for (json func : js)
@@ -813,6 +1078,7 @@ shared_ptr<Function> JSONDeserializer::deserialize_function(json func_js)
 {
     string func_name = func_js.at("name").get<string>();
     vector<json> func_result = func_js.at("result");
+    decode_constants(func_js.at("ops"));
     for (json node_js : func_js.at("ops"))
     {
         deserialize_node(node_js);
@@ -850,6 +1116,65 @@ shared_ptr<Function> JSONDeserializer::deserialize_function(json func_js)
     return rc;
 }
 
+shared_ptr<Node> JSONDeserializer::deserialize_constant(const json& node_js,
+                                                        const string& node_name)
+{
+    shared_ptr<Node> node;
+    auto type_node_js = has_key(node_js, "element_type") ? node_js : node_js.at("value_type");
+    auto element_type = read_element_type(type_node_js.at("element_type"));
+    Shape shape = type_node_js.at("shape");
+    if (!has_key(node_js, "value") && m_const_data_callback)
+    {
+        // Binary constant data stored outside of the json
+        node = m_const_data_callback(node_name, element_type, shape);
+        NGRAPH_CHECK(node, "Binary data for constant '", node_name, "' not found");
+    }
+    else
+    {
+        auto value = node_js.at("value").get<vector<string>>();
+        node = make_shared<op::v0::Constant>(element_type, shape, value);
+    }
+    return node;
+}
+
+void JSONDeserializer::decode_constants(const json& ops)
+{
+    vector<const json*> constants;
+    for (const json& node_js : ops)
+    {
+        if (node_js.at("op").get<string>() == "Constant" &&
+            get_value<size_t>(node_js, "op_version") == 0)
+        {
+            constants.push_back(&node_js);
+        }
+    }
+
+    // Decoding the payloads (hex text or binary records) dominates the load time of large
+    // models and does not depend on other nodes
+    const auto hardware_threads = max(static_cast<int32_t>(thread::hardware_concurrency()), 1);
+    const auto num_threads = static_cast<size_t>(
+        max(getenv_int("NGRAPH_DESERIALIZE_THREADS", hardware_threads), 1));
+    vector<shared_ptr<Node>> nodes(constants.size());
+    parallel_for(constants.size(), num_threads, [&](size_t i) {
+        const json& node_js = *constants[i];
+        try
+        {
+            nodes[i] = deserialize_constant(node_js, node_js.at("name").get<string>());
+        }
+        catch (...)
+        {
+            // Left to deserialize_node, which reports the error with the node name
+        }
+    });
+    for (size_t i = 0; i < constants.size(); ++i)
+    {
+        if (nodes[i])
+        {
+            m_decoded_constants[constants[i]->at("name").get<string>()] = move(nodes[i]);
+        }
+    }
+}
+
 shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
 {
     auto& factory_registry = FactoryRegistry<Node>::get();
@@ -934,7 +1259,11 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
         }
         case OP_TYPEID::AllReduce_v0:
         {
-            node = make_shared<op::v0::AllReduce>(args[0]);
+            auto reduce_type = as_type<reduction::Type>(
+                get_or_default<string>(node_js, "reduce_type", as_string(reduction::Type::SUM)));
+            auto compression = as_type<reduction::Compression>(get_or_default<string>(
+                node_js, "compression", as_string(reduction::Compression::NONE)));
+            node = make_shared<op::v0::AllReduce>(args[0], reduce_type, compression);
             break;
         }
         case OP_TYPEID::And_v0:
@@ -968,6 +1297,12 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
             node = make_shared<op::v0::Asin>(args[0]);
             break;
         }
+        case OP_TYPEID::AssignVariable_v0:
+        {
+            auto variable_id = node_js.at("variable_id").get<string>();
+            node = make_shared<op::v0::AssignVariable>(args[0], variable_id);
+            break;
+        }
         case OP_TYPEID::Atan_v0:
         {
             node = make_shared<op::v0::Atan>(args[0]);
@@ -1094,12 +1429,16 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
         }
         case OP_TYPEID::Constant_v0:
         {
-            auto type_node_js =
-                has_key(node_js, "element_type") ? node_js : node_js.at("value_type");
-            auto element_type = read_element_type(type_node_js.at("element_type"));
-            auto shape = type_node_js.at("shape");
-            auto value = node_js.at("value").get<vector<string>>();
-            node = make_shared<op::v0::Constant>(element_type, shape, value);
+            auto it = m_decoded_constants.find(node_name);
+            if (it != m_decoded_constants.end())
+            {
+                node = it->second;
+                m_decoded_constants.erase(it);
+            }
+            else
+            {
+                node = deserialize_constant(node_js, node_name);
+            }
             break;
         }
         case OP_TYPEID::Convert_v0:
@@ -1310,6 +1649,14 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
         }
         case OP_TYPEID::CTCGreedyDecoder_v0: { break;
         }
+        case OP_TYPEID::DecompressWeights_v0:
+        {
+            auto shape = node_js.at("shape").get<vector<size_t>>();
+            auto axis = node_js.at("axis").get<size_t>();
+            auto bits = node_js.at("bits").get<size_t>();
+            node = make_shared<op::v0::DecompressWeights>(args[0], args[1], shape, axis, bits);
+            break;
+        }
         case OP_TYPEID::DeformableConvolution_v1:
         {
             const auto strides = node_js.at("strides").get<vector<size_t>>();
@@ -2200,6 +2547,12 @@ shared_ptr<Node> JSONDeserializer::deserialize_node(json node_js)
             node = make_shared<op::v0::Range>(args[0], args[1], args[2]);
             break;
         }
+        case OP_TYPEID::ReadVariable_v0:
+        {
+            auto variable_id = node_js.at("variable_id").get<string>();
+            node = make_shared<op::v0::ReadVariable>(args[0], variable_id);
+            break;
+        }
         case OP_TYPEID::Relu_v0:
         {
             node = make_shared<op::v0::Relu>(args[0]);
@@ -2745,7 +3098,12 @@ json JSONSerializer::serialize_node(const Node& n)
         node["reduction_axes"] = serialize_axis_set(tmp->get_reduction_axes());
         break;
     }
-    case OP_TYPEID::AllReduce_v0: { break;
+    case OP_TYPEID::AllReduce_v0:
+    {
+        auto tmp = static_cast<const op::v0::AllReduce*>(&n);
+        node["reduce_type"] = as_string(tmp->get_reduce_type());
+        node["compression"] = as_string(tmp->get_compression());
+        break;
     }
     case OP_TYPEID::Any_v0:
     {
@@ -2755,6 +3113,12 @@ json JSONSerializer::serialize_node(const Node& n)
     }
     case OP_TYPEID::Asin_v0: { break;
     }
+    case OP_TYPEID::AssignVariable_v0:
+    {
+        auto tmp = static_cast<const op::v0::AssignVariable*>(&n);
+        node["variable_id"] = tmp->get_variable_id();
+        break;
+    }
     case OP_TYPEID::Atan_v0: { break;
     }
     case OP_TYPEID::Atan2_v0:
@@ -2852,8 +3216,12 @@ json JSONSerializer::serialize_node(const Node& n)
     case OP_TYPEID::Constant_v0:
     {
         auto tmp = static_cast<const op::v0::Constant*>(&n);
-        if (tmp->get_all_data_elements_bitwise_identical() &&
-            shape_size(tmp->get_output_shape(0)) > 0)
+        if (m_binary_constant_data)
+        {
+            // Data is written as a separate record by serialize_to_cpio
+        }
+        else if (tmp->get_all_data_elements_bitwise_identical() &&
+                 shape_size(tmp->get_output_shape(0)) > 0)
         {
             vector<string> vs;
             vs.push_back(tmp->convert_value_to_string(0));
@@ -2972,6 +3340,14 @@ json JSONSerializer::serialize_node(const Node& n)
     }
     case OP_TYPEID::CTCGreedyDecoder_v0: { break;
     }
+    case OP_TYPEID::DecompressWeights_v0:
+    {
+        auto tmp = static_cast<const op::v0::DecompressWeights*>(&n);
+        node["shape"] = tmp->get_weights_shape();
+        node["axis"] = tmp->get_axis();
+        node["bits"] = tmp->get_bits();
+        break;
+    }
     case OP_TYPEID::DetectionOutput_v0: { break;
     }
     case OP_TYPEID::PSROIPooling_v0: { break;
@@ -3446,6 +3822,12 @@ json JSONSerializer::serialize_node(const Node& n)
     }
     case OP_TYPEID::Range_v0: { break;
     }
+    case OP_TYPEID::ReadVariable_v0:
+    {
+        auto tmp = static_cast<const op::v0::ReadVariable*>(&n);
+        node["variable_id"] = tmp->get_variable_id();
+        break;
+    }
     case OP_TYPEID::Recv_v0:
     {
         auto tmp = static_cast<const op::v0::Recv*>(&n);
@@ -51,6 +51,60 @@ namespace ngraph
     NGRAPH_API
     void serialize(std::ostream& out, std::shared_ptr<ngraph::Function> func, size_t indent = 0);
 
+    /// \brief Serialize a Function to a cpio archive with constant data stored in binary
+    ///    records, each aligned to Constant::host_alignment() within the archive.
+    /// \param out The output stream to which the archive is written.
+    /// \param func The Function to serialize
+    /// \param indent Formatting of the json model record, as for serialize().
+    /// \param compress_constants If true, constant data is stored zlib compressed when that makes
+    ///    it smaller. Compressed constants are decompressed into their buffer on load, so they
+    ///    are always copied, even by deserialize_mapped. Requires a build with NGRAPH_ZLIB_ENABLE.
+    NGRAPH_API
+    void serialize_to_cpio(std::ostream& out,
+                           std::shared_ptr<ngraph::Function> func,
+                           size_t indent = 0,
+                           bool compress_constants = false);
+
+    /// \brief Serialize a Function to a cpio archive file. See serialize_to_cpio above.
+    NGRAPH_API
+    void serialize_to_cpio(const std::string& path,
+                           std::shared_ptr<ngraph::Function> func,
+                           size_t indent = 0,
+                           bool compress_constants = false);
+
+    /// \brief Serialize a Function to a cpio archive like serialize_to_cpio, with the graph
+    ///    record encoded as MessagePack instead of json text.
+    ///
+    /// The record holds the same schema as the json graph but is several times faster to load,
+    /// as no text has to be parsed. deserialize and deserialize_mapped detect the encoding.
+    /// \param out The output stream to which the archive is written.
+    /// \param func The Function to serialize
+    /// \param compress_constants As for serialize_to_cpio.
+    NGRAPH_API
+    void serialize_binary(std::ostream& out,
+                          std::shared_ptr<ngraph::Function> func,
+                          bool compress_constants = false);
+
+    /// \brief Serialize a Function to a binary cpio archive file. See serialize_binary above.
+    NGRAPH_API
+    void serialize_binary(const std::string& path,
+                          std::shared_ptr<ngraph::Function> func,
+                          bool compress_constants = false);
+
+    /// \brief Deserialize a Function from a cpio archive file without copying constant data.
+    ///
+    /// The archive is memory-mapped and Constants reference their data in the mapping, so
+    /// weights are loaded lazily by the OS and shared between processes loading the same file.
+    /// The mapping stays alive as long as any Constant references it. Files that are not cpio
+    /// archives are deserialized normally.
+    /// \param path Path to an archive written by serialize_to_cpio
+    /// \param lazy_constants If true, Constants read their record the first time their data is
+    ///    accessed instead of during deserialization. Records that are never used, for example
+    ///    by a function that is only partially compiled, are then never copied or decompressed.
+    NGRAPH_API
+    std::shared_ptr<ngraph::Function> deserialize_mapped(const std::string& path,
+                                                         bool lazy_constants = false);
+
     /// \brief Deserialize a Function
     /// \param in An isteam to the input data
     NGRAPH_API
@@ -42,3 +42,39 @@ std::shared_ptr<ngraph::Function> ngraph::deserialize(const std::string& str)
 {
     throw std::runtime_error("serializer disabled in build");
 }
+
+void ngraph::serialize_to_cpio(std::ostream& out,
+                               std::shared_ptr<ngraph::Function> func,
+                               size_t indent,
+                               bool compress_constants)
+{
+    throw std::runtime_error("serializer disabled in build");
+}
+
+void ngraph::serialize_to_cpio(const std::string& path,
+                               std::shared_ptr<ngraph::Function> func,
+                               size_t indent,
+                               bool compress_constants)
+{
+    throw std::runtime_error("serializer disabled in build");
+}
+
+void ngraph::serialize_binary(std::ostream& out,
+                              std::shared_ptr<ngraph::Function> func,
+                              bool compress_constants)
+{
+    throw std::runtime_error("serializer disabled in build");
+}
+
+void ngraph::serialize_binary(const std::string& path,
+                              std::shared_ptr<ngraph::Function> func,
+                              bool compress_constants)
+{
+    throw std::runtime_error("serializer disabled in build");
+}
+
+std::shared_ptr<ngraph::Function> ngraph::deserialize_mapped(const std::string& path,
+                                                             bool lazy_constants)
+{
+    throw std::runtime_error("serializer disabled in build");
+}
@@ -43,11 +43,21 @@ ngraph::Shape::Shape(const std::vector<size_t>& axis_lengths)
 {
 }
 
+ngraph::Shape::Shape(std::vector<size_t>&& axis_lengths) noexcept
+    : std::vector<size_t>(std::move(axis_lengths))
+{
+}
+
 ngraph::Shape::Shape(const Shape& axis_lengths)
     : std::vector<size_t>(axis_lengths)
 {
 }
 
+ngraph::Shape::Shape(Shape&& axis_lengths) noexcept
+    : std::vector<size_t>(std::move(axis_lengths))
+{
+}
+
 ngraph::Shape::Shape(size_t n, size_t initial_value)
     : std::vector<size_t>(n, initial_value)
 {
@@ -63,7 +73,7 @@ ngraph::Shape& ngraph::Shape::operator=(const Shape& v)
 
 ngraph::Shape& ngraph::Shape::operator=(Shape&& v) noexcept
 {
-    static_cast<std::vector<size_t>*>(this)->operator=(v);
+    static_cast<std::vector<size_t>*>(this)->operator=(std::move(v));
     return *this;
 }
 
@@ -36,8 +36,12 @@ namespace ngraph
 
         NGRAPH_API Shape(const std::vector<size_t>& axis_lengths);
 
+        NGRAPH_API Shape(std::vector<size_t>&& axis_lengths) noexcept;
+
         NGRAPH_API Shape(const Shape& axis_lengths);
 
+        NGRAPH_API Shape(Shape&& axis_lengths) noexcept;
+
         NGRAPH_API explicit Shape(size_t n, size_t initial_value = 0);
 
         NGRAPH_API ~Shape();
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include "ngraph/specialize_function.hpp"
+#include <unordered_set>
 #include <pass/constant_folding.hpp>
 #include "ngraph/op/constant.hpp"
 #include "ngraph/op/tensor_iterator.hpp"
@@ -44,6 +45,9 @@ std::shared_ptr<Function>
     NGRAPH_CHECK(f->get_parameters().size() == parameter_values.size());
 
     NodeMap m;
+    // Nodes whose specialized copies produce the same values as the originals. Their users
+    // keep the original output types instead of inferring them again.
+    std::unordered_set<const Node*> identical;
 
     for (size_t i = 0; i < parameter_shapes.size(); i++)
     {
@@ -60,6 +64,11 @@ std::shared_ptr<Function>
         {
             m[f->get_parameters()[i].get()] = std::make_shared<op::v0::Parameter>(
                 parameter_element_types[i], parameter_shapes[i]);
+            if (parameter_element_types[i] == f->get_parameters()[i]->get_element_type() &&
+                parameter_shapes[i].same_scheme(f->get_parameters()[i]->get_partial_shape()))
+            {
+                identical.insert(f->get_parameters()[i].get());
+            }
         }
         m[f->get_parameters()[i].get()]->get_rt_info() = f->get_parameters()[i]->get_rt_info();
     }
@@ -72,10 +81,16 @@ std::shared_ptr<Function>
         }
 
         OutputVector new_args;
+        bool identical_args = true;
         for (auto input : old_node->inputs())
         {
             auto output = input.get_source_output();
             new_args.push_back(output.for_node(m[output.get_node()]));
+            identical_args = identical_args && identical.count(output.get_node()) != 0;
+        }
+        if (identical_args)
+        {
+            identical.insert(old_node.get());
         }
 
         if (share_constants && as_type_ptr<op::v0::Constant>(old_node))
@@ -84,7 +99,11 @@ std::shared_ptr<Function>
         }
         else
         {
-            m[old_node.get()] = old_node->copy_with_new_inputs(new_args);
+            m[old_node.get()] =
+                identical_args
+                    ? old_node->copy_with_identical_inputs(new_args,
+                                                           old_node->get_control_dependencies())
+                    : old_node->copy_with_new_inputs(new_args);
             //  TODO: workaround for shape inference, delete it after fix
             if (::ngraph::as_type_ptr<ngraph::op::v0::TensorIterator>(m[old_node.get()]))
             {
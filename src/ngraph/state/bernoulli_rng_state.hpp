@@ -16,31 +16,41 @@
 
 #pragma once
 
-#include <functional>
-#include <memory>
-#include <random>
+#include <cstdint>
 
+#include "philox.hpp"
 #include "state.hpp"
 
 namespace ngraph
 {
+    /// \brief Bernoulli trials on the uniform numbers of a Philox sequence, consumed from the
+    ///        start in order of the calls of the op. A trial at u gives 1 if u < probability.
     class NGRAPH_API BernoulliRNGState : public State
     {
     public:
         BernoulliRNGState(unsigned int seed, double probability)
             : State()
             , m_generator(seed)
-            , m_distribution(probability)
+            , m_probability(probability)
         {
         }
         virtual void activate() override;
         virtual void deactivate() override;
         virtual ~BernoulliRNGState() override {}
-        std::mt19937& get_generator() { return m_generator; }
-        std::bernoulli_distribution& get_distribution() { return m_distribution; }
+        const Philox& get_generator() const { return m_generator; }
+        double get_probability() const { return m_probability; }
+        /// \brief Reserves the next `count` numbers of the sequence
+        /// \returns the position of the first of them
+        uint64_t advance(uint64_t count)
+        {
+            uint64_t offset = m_offset;
+            m_offset += count;
+            return offset;
+        }
 
     protected:
-        std::mt19937 m_generator;
-        std::bernoulli_distribution m_distribution;
+        Philox m_generator;
+        double m_probability;
+        uint64_t m_offset{0};
     };
 }
@@ -0,0 +1,83 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace ngraph
+{
+    /// \brief Philox4x32-10 counter-based random number generator, from Salmon et al.,
+    ///        "Parallel Random Numbers: As Easy as 1, 2, 3".
+    ///
+    /// The numbers of a seed form one sequence in which the number at any position is
+    /// computed directly from the position, so any range of it can be generated without the
+    /// numbers before it. Threads filling parts of a tensor get the same numbers whichever way
+    /// the tensor is split between them.
+    class Philox
+    {
+    public:
+        explicit Philox(uint64_t seed = 0)
+            : m_key{{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)}}
+        {
+        }
+
+        /// \brief The four 32 bit numbers at positions 4 * block to 4 * block + 3
+        std::array<uint32_t, 4> block(uint64_t block) const
+        {
+            std::array<uint32_t, 4> counter{
+                {static_cast<uint32_t>(block), static_cast<uint32_t>(block >> 32), 0, 0}};
+            std::array<uint32_t, 2> key = m_key;
+            for (size_t round = 0; round < 10; round++)
+            {
+                uint64_t product0 = static_cast<uint64_t>(s_multiplier0) * counter[0];
+                uint64_t product1 = static_cast<uint64_t>(s_multiplier1) * counter[2];
+                counter = {{static_cast<uint32_t>(product1 >> 32) ^ counter[1] ^ key[0],
+                            static_cast<uint32_t>(product1),
+                            static_cast<uint32_t>(product0 >> 32) ^ counter[3] ^ key[1],
+                            static_cast<uint32_t>(product0)}};
+                key[0] += s_weyl0;
+                key[1] += s_weyl1;
+            }
+            return counter;
+        }
+
+        /// \brief Calls f(position, u) for the uniform number u in [0, 1) at every position
+        ///        in [begin, end)
+        template <typename F>
+        void generate_uniform(uint64_t begin, uint64_t end, F&& f) const
+        {
+            uint64_t position = begin;
+            while (position < end)
+            {
+                std::array<uint32_t, 4> numbers = block(position / 4);
+                for (size_t lane = position % 4; lane < 4 && position < end; lane++, position++)
+                {
+                    f(position, numbers[lane] * (1.0 / 4294967296.0));
+                }
+            }
+        }
+
+    private:
+        static constexpr uint32_t s_multiplier0 = 0xD2511F53;
+        static constexpr uint32_t s_multiplier1 = 0xCD9E8D57;
+        static constexpr uint32_t s_weyl0 = 0x9E3779B9;
+        static constexpr uint32_t s_weyl1 = 0xBB67AE85;
+
+        std::array<uint32_t, 2> m_key;
+    };
+}
@@ -16,37 +16,48 @@
 
 #pragma once
 
-#include <functional>
-#include <memory>
+#include <cstdint>
 #include <random>
 
+#include "philox.hpp"
 #include "state.hpp"
 
 namespace ngraph
 {
+    /// \brief Uniform random numbers of a Philox sequence, consumed from the start in order
+    ///        of the calls of the op
     class UniformRNGState : public State
     {
     public:
-        UniformRNGState(std::mt19937::result_type seed)
+        UniformRNGState(uint64_t seed)
             : State()
-            , m_generator(std::mt19937::result_type(seed))
-            , m_distribution()
+            , m_generator(seed)
         {
         }
         UniformRNGState()
             : State()
             , m_generator(std::random_device()())
-            , m_distribution()
         {
         }
         virtual void activate() override {}
         virtual void deactivate() override {}
         virtual ~UniformRNGState() override {}
-        std::mt19937& get_generator() { return m_generator; }
-        std::uniform_real_distribution<double>& get_distribution() { return m_distribution; }
+        const Philox& get_generator() const { return m_generator; }
+        /// \brief Reserves the next `count` numbers of the sequence
+        /// \returns the position of the first of them
+        uint64_t advance(uint64_t count)
+        {
+            m_last_offset = m_offset;
+            m_offset += count;
+            return m_last_offset;
+        }
+        /// \brief The position returned by the last advance, for ops regenerating the
+        ///        numbers another op reserved
+        uint64_t get_last_offset() const { return m_last_offset; }
 
     private:
-        std::mt19937 m_generator;
-        std::uniform_real_distribution<double> m_distribution;
+        Philox m_generator;
+        uint64_t m_offset{0};
+        uint64_t m_last_offset{0};
     };
 }
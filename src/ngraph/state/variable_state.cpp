@@ -0,0 +1,53 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstring>
+
+#include "ngraph/state/variable_state.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+VariableState::VariableState(const element::Type& element_type, const Shape& shape)
+    : State()
+    , m_element_type(element_type)
+    , m_shape(shape)
+    , m_buffer(element_type.size() * shape_size(shape))
+{
+}
+
+void VariableState::activate() {}
+
+void VariableState::deactivate() {}
+
+void VariableState::write(const void* source)
+{
+    // An assignment of the value just read, or computed in place of it, needs no copy
+    if (source != m_buffer.get_ptr())
+    {
+        memcpy(m_buffer.get_ptr(), source, size());
+    }
+    m_initialized = true;
+}
+
+void VariableState::read(void* target, const void* initial_value) const
+{
+    const void* source = m_initialized ? m_buffer.get_ptr() : initial_value;
+    if (target != source)
+    {
+        memcpy(target, source, size());
+    }
+}
@@ -0,0 +1,55 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/type/element_type.hpp"
+#include "state.hpp"
+
+namespace ngraph
+{
+    /// \brief The persistent buffer of a variable, which keeps its value from one call of an
+    ///        executable to the next. Until it is written the variable has no value of its own
+    ///        and reads see the initial value of the ReadVariable.
+    class NGRAPH_API VariableState : public State
+    {
+    public:
+        VariableState(const element::Type& element_type, const Shape& shape);
+        virtual void activate() override;
+        virtual void deactivate() override;
+        virtual ~VariableState() override {}
+        const element::Type& get_element_type() const { return m_element_type; }
+        const Shape& get_shape() const { return m_shape; }
+        size_t size() const { return m_buffer.size(); }
+        void* get_data_ptr() { return m_buffer.get_ptr(); }
+        bool is_initialized() const { return m_initialized; }
+        /// \brief Copies size() bytes of `source` into the variable
+        void write(const void* source);
+        /// \brief Forgets the value written, so that reads see the initial value again
+        void reset() { m_initialized = false; }
+        /// \brief Copies the value of the variable into `target`, or size() bytes of
+        ///        `initial_value` if it has not been written yet
+        void read(void* target, const void* initial_value) const;
+
+    protected:
+        element::Type m_element_type;
+        Shape m_shape;
+        runtime::AlignedBuffer m_buffer;
+        bool m_initialized{false};
+    };
+}
@@ -43,11 +43,21 @@ ngraph::Strides::Strides(const std::vector<size_t>& axis_strides)
 {
 }
 
+ngraph::Strides::Strides(std::vector<size_t>&& axis_strides) noexcept
+    : std::vector<size_t>(std::move(axis_strides))
+{
+}
+
 ngraph::Strides::Strides(const Strides& axis_strides)
     : std::vector<size_t>(axis_strides)
 {
 }
 
+ngraph::Strides::Strides(Strides&& axis_strides) noexcept
+    : std::vector<size_t>(std::move(axis_strides))
+{
+}
+
 ngraph::Strides::Strides(size_t n, size_t initial_value)
     : std::vector<size_t>(n, initial_value)
 {
@@ -61,7 +71,7 @@ ngraph::Strides& ngraph::Strides::operator=(const Strides& v)
 
 ngraph::Strides& ngraph::Strides::operator=(Strides&& v) noexcept
 {
-    static_cast<std::vector<size_t>*>(this)->operator=(v);
+    static_cast<std::vector<size_t>*>(this)->operator=(std::move(v));
     return *this;
 }
 
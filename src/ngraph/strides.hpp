@@ -35,8 +35,12 @@ namespace ngraph
 
         NGRAPH_API Strides(const std::vector<size_t>& axis_strides);
 
+        NGRAPH_API Strides(std::vector<size_t>&& axis_strides) noexcept;
+
         NGRAPH_API Strides(const Strides& axis_strides);
 
+        NGRAPH_API Strides(Strides&& axis_strides) noexcept;
+
         NGRAPH_API explicit Strides(size_t n, size_t initial_value = 0);
 
         template <class InputIterator>
@@ -35,6 +35,10 @@
 #include <iostream>
 #include <limits>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #include "ngraph/type/bfloat16.hpp"
 
 using namespace std;
@@ -49,19 +53,59 @@ bool float_isnan(const float& x)
 
 std::vector<float> bfloat16::to_float_vector(const std::vector<bfloat16>& v_bf16)
 {
-    std::vector<float> v_f32(v_bf16.begin(), v_bf16.end());
+    std::vector<float> v_f32(v_bf16.size());
+    to_float_buffer(v_bf16.data(), v_f32.data(), v_bf16.size());
     return v_f32;
 }
 
 std::vector<bfloat16> bfloat16::from_float_vector(const std::vector<float>& v_f32)
 {
-    std::vector<bfloat16> v_bf16;
-    v_bf16.reserve(v_f32.size());
-    for (float a : v_f32)
+    std::vector<bfloat16> v_bf16(v_f32.size());
+    from_float_buffer(v_f32.data(), v_bf16.data(), v_f32.size());
+    return v_bf16;
+}
+
+void bfloat16::to_float_buffer(const bfloat16* source, float* target, size_t count)
+{
+    size_t i = 0;
+#if defined(__SSE2__)
+    // Widening is exact: each value becomes the upper half of a float
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 8 <= count; i += 8)
     {
-        v_bf16.push_back(static_cast<bfloat16>(a));
+        __m128i bits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(target + i), _mm_unpacklo_epi16(zero, bits));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(target + i + 4),
+                         _mm_unpackhi_epi16(zero, bits));
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        target[i] = static_cast<float>(source[i]);
+    }
+}
+
+void bfloat16::from_float_buffer(const float* source, bfloat16* target, size_t count)
+{
+    size_t i = 0;
+#if defined(__SSE2__) && defined(ROUND_MODE_TO_NEAREST_EVEN)
+    // Same bit arithmetic as round_to_nearest_even(). The arithmetic shift keeps each result
+    // in int16 range so the signed saturating pack returns its low 16 bits unchanged.
+    const __m128i round_bit = _mm_set1_epi32(0x8000);
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+        __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i + 4));
+        low = _mm_add_epi32(low, _mm_and_si128(_mm_srli_epi32(low, 1), round_bit));
+        high = _mm_add_epi32(high, _mm_and_si128(_mm_srli_epi32(high, 1), round_bit));
+        __m128i packed = _mm_packs_epi32(_mm_srai_epi32(low, 16), _mm_srai_epi32(high, 16));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(target + i), packed);
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        target[i] = bfloat16(source[i]);
     }
-    return v_bf16;
 }
 
 std::string bfloat16::to_string() const
@@ -65,6 +65,11 @@ namespace ngraph
 
         static std::vector<float> to_float_vector(const std::vector<bfloat16>&);
         static std::vector<bfloat16> from_float_vector(const std::vector<float>&);
+        /// \brief Converts `count` values, giving the same results as converting each one.
+        ///
+        /// Uses SSE2 when the build targets it and a scalar loop otherwise.
+        static void to_float_buffer(const bfloat16* source, float* target, size_t count);
+        static void from_float_buffer(const float* source, bfloat16* target, size_t count);
         static constexpr bfloat16 from_bits(uint16_t bits) { return bfloat16(bits, true); }
         uint16_t to_bits() const;
         friend std::ostream& operator<<(std::ostream& out, const bfloat16& obj)
@@ -35,6 +35,10 @@
 #include <iostream>
 #include <limits>
 
+#if defined(__F16C__)
+#include <immintrin.h>
+#endif
+
 #include "ngraph/type/float16.hpp"
 
 using namespace std;
@@ -93,29 +97,36 @@ float16::float16(float value)
         return;
     }
     int16_t biased_exp_16 = (biased_exp_field_32 >> 23) - 127 + 15;
-    // In the normalized_16 realm
-    if ((frac & rhalf_16) == rodd_16 || (frac & rnorm_16) != 0)
+    if (biased_exp_16 > 0)
     {
-        frac += reven_16;
-        if (0 != (frac & emask_16))
+        // In the normalized_16 realm
+        if ((frac & rhalf_16) == rodd_16 || (frac & rnorm_16) != 0)
         {
-            frac &= emask_16;
-            biased_exp_16++;
+            frac += reven_16;
+            if (0 != (frac & emask_16))
+            {
+                frac &= emask_16;
+                biased_exp_16++;
+            }
         }
-    }
-    frac &= fmask_16;
-    if (biased_exp_16 > 30)
-    {
-        // Infinity
-        m_value = ((iv & smask) | emask_16 | 0) >> 16;
+        frac &= fmask_16;
+        if (biased_exp_16 > 30)
+        {
+            // Infinity
+            m_value = ((iv & smask) | emask_16 | 0) >> 16;
+            return;
+        }
+        m_value = ((iv & smask) | biased_exp_16 << 26 | frac) >> 16;
         return;
     }
-    if (biased_exp_16 > 0)
+    if (biased_exp_16 < -10)
     {
-        m_value = ((iv & smask) | biased_exp_16 << 26 | frac) >> 16;
+        // Less than half of the smallest denormal
+        m_value = (iv & smask) >> 16;
         return;
     }
-    // Restore the hidden 1
+    // Restore the hidden 1. The exponent is the unrounded one, rounding up into the normal
+    // range carries into the exponent field below.
     frac = 0x04000000 | ((iv & fmask_32) << 3);
     // Will any bits be shifted off?
     uint32_t sticky = (frac & ((1 << (1 - biased_exp_16)) - 1)) ? 1 : 0;
@@ -206,6 +217,40 @@ float16::operator float() const
     return f_val;
 }
 
+void float16::to_float_buffer(const float16* source, float* target, size_t count)
+{
+    size_t i = 0;
+#if defined(__F16C__)
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i bits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+        _mm256_storeu_ps(target + i, _mm256_cvtph_ps(bits));
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        target[i] = static_cast<float>(source[i]);
+    }
+}
+
+void float16::from_float_buffer(const float* source, float16* target, size_t count)
+{
+    size_t i = 0;
+#if defined(__F16C__)
+    // Matches the scalar constructor for every value except the payload of signaling NaNs,
+    // which the hardware quiets
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i bits = _mm256_cvtps_ph(_mm256_loadu_ps(source + i), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(target + i), bits);
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        target[i] = float16(source[i]);
+    }
+}
+
 bool std::isnan(float16 x)
 {
     // Sign doesn't matter, frac not zero (infinity)
@@ -58,6 +58,12 @@ namespace ngraph
         bool operator>=(const float16& other) const;
         operator float() const;
 
+        /// \brief Converts `count` values, giving the same results as converting each one.
+        ///
+        /// Uses F16C when the build targets it and a scalar loop otherwise.
+        static void to_float_buffer(const float16* source, float* target, size_t count);
+        static void from_float_buffer(const float* source, float16* target, size_t count);
+
         static constexpr float16 from_bits(uint16_t bits) { return float16(bits, true); }
         uint16_t to_bits() const;
         friend std::ostream& operator<<(std::ostream& out, const float16& obj)
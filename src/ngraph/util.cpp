@@ -15,11 +15,15 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <atomic>
 #include <deque>
+#include <exception>
 #include <forward_list>
 #include <iomanip>
 #include <map>
+#include <mutex>
 #include <numeric>
+#include <thread>
 #include <unordered_set>
 
 #include "ngraph/coordinate_diff.hpp"
@@ -197,6 +201,55 @@ size_t ngraph::round_up(size_t size, size_t alignment)
     return size + alignment - remainder;
 }
 
+void ngraph::parallel_for(size_t count, size_t num_threads, const function<void(size_t)>& f)
+{
+    num_threads = min(num_threads, count);
+    if (num_threads <= 1)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            f(i);
+        }
+        return;
+    }
+
+    atomic<size_t> next{0};
+    exception_ptr error;
+    mutex error_mutex;
+    const auto run = [&]() {
+        for (size_t i = next++; i < count; i = next++)
+        {
+            try
+            {
+                f(i);
+            }
+            catch (...)
+            {
+                lock_guard<mutex> lock{error_mutex};
+                if (!error)
+                {
+                    error = current_exception();
+                }
+                next = count;
+            }
+        }
+    };
+    vector<thread> threads;
+    for (size_t t = 1; t < num_threads; ++t)
+    {
+        threads.emplace_back(run);
+    }
+    run();
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+    if (error)
+    {
+        rethrow_exception(error);
+    }
+}
+
 ngraph::FpropCache ngraph::cache_fprop(std::shared_ptr<ngraph::Function> fprop,
                                        std::shared_ptr<ngraph::Function> bprop)
 {
@@ -236,6 +236,11 @@ namespace ngraph
 
     NGRAPH_API
     size_t round_up(size_t size, size_t alignment);
+
+    /// \brief Calls f(i) for every i in [0, count) on up to num_threads threads, the calling
+    ///        thread being one of them, and rethrows the first exception thrown by f.
+    NGRAPH_API
+    void parallel_for(size_t count, size_t num_threads, const std::function<void(size_t)>& f);
     bool is_valid_permutation(ngraph::AxisVector permutation, ngraph::Rank rank = Rank::dynamic());
     template <typename T>
     T apply_permutation(T input, ngraph::AxisVector order);
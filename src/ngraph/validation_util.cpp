@@ -1063,19 +1063,38 @@ pair<bool, uint64_t> ngraph::maximum_value(const Output<Node>& value)
     return pair<bool, uint64_t>(val.m_value < numeric_limits<uint64_t>::max(), val.m_value);
 }
 
+shared_ptr<Evaluator<HostTensorPtr>::Memo> ngraph::make_host_tensor_memo()
+{
+    return make_shared<Evaluator<HostTensorPtr>::Memo>([](const HostTensorPtr& tensor) {
+        if (!tensor)
+        {
+            return string();
+        }
+        stringstream key;
+        key << tensor->get_element_type() << tensor->get_partial_shape() << ":";
+        key.write(static_cast<const char*>(tensor->get_data_ptr()),
+                  tensor->get_size_in_bytes());
+        return key.str();
+    });
+}
+
 void ngraph::evaluate_nodes(std::map<RawNodeOutput, HostTensorPtr>& value_map,
                             std::map<RawNodeOutput, HostTensorPtr>& output_tensor_map,
-                            const OutputVector& outputs)
+                            const OutputVector& outputs,
+                            size_t num_threads,
+                            const shared_ptr<Evaluator<HostTensorPtr>::Memo>& memo)
 {
     Evaluator<HostTensorPtr> evaluator({}, value_map);
+    evaluator.set_num_threads(num_threads);
+    evaluator.set_memo(memo);
     evaluator.set_univeral_handler(
-        [&output_tensor_map](Node* node,
-                             const HostTensorVector& input_tensors) -> HostTensorVector {
+        [&output_tensor_map, &memo](Node* node,
+                                    const HostTensorVector& input_tensors) -> HostTensorVector {
             HostTensorVector output_tensors;
             for (auto v : node->outputs())
             {
                 auto it = output_tensor_map.find(v);
-                if (it == output_tensor_map.end())
+                if (memo || it == output_tensor_map.end())
                 {
                     auto c = make_shared<HostTensor>(v);
                     output_tensors.push_back(c);
@@ -1094,8 +1113,18 @@ void ngraph::evaluate_nodes(std::map<RawNodeOutput, HostTensorPtr>& value_map,
                 NGRAPH_CHECK(false, "Evaluation failed on ", node);
             }
         });
-    for (auto value : outputs)
+    evaluator.evaluate(outputs);
+    if (memo)
     {
-        evaluator.evaluate(value);
+        // Memoized results are never the caller's tensors, which it may overwrite later
+        for (auto& entry : output_tensor_map)
+        {
+            auto it = value_map.find(entry.first);
+            if (it != value_map.end() && it->second && it->second != entry.second)
+            {
+                entry.second->set_unary(it->second);
+                entry.second->write(it->second->get_data_ptr(), it->second->get_size_in_bytes());
+            }
+        }
     }
 }
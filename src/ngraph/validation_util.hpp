@@ -19,6 +19,7 @@
 #include <tuple>
 
 #include "ngraph/coordinate_diff.hpp"
+#include "ngraph/evaluator.hpp"
 #include "ngraph/op/constant.hpp"
 #include "ngraph/op/op.hpp"
 #include "ngraph/op/util/attr_types.hpp"
@@ -196,9 +197,18 @@ namespace ngraph
     /// function.
     /// \param output_tensor_map Tensors to use for particular outputs
     /// \param outputs Root set of values to try to compute
-    NGRAPH_API void evaluate_nodes(std::map<RawNodeOutput, HostTensorPtr>& value_map,
-                                   std::map<RawNodeOutput, HostTensorPtr>& output_tensor_map,
-                                   const OutputVector& outputs);
+    /// \param num_threads Number of threads independent nodes may be evaluated on
+    /// \param memo If set, results of nodes evaluated on the same input values are reused.
+    /// Reused results are tensors shared with earlier evaluations.
+    NGRAPH_API void
+        evaluate_nodes(std::map<RawNodeOutput, HostTensorPtr>& value_map,
+                       std::map<RawNodeOutput, HostTensorPtr>& output_tensor_map,
+                       const OutputVector& outputs,
+                       size_t num_threads = 1,
+                       const std::shared_ptr<Evaluator<HostTensorPtr>::Memo>& memo = nullptr);
+
+    /// \brief A memo for evaluate_nodes, keyed by the type, shape and contents of tensors
+    NGRAPH_API std::shared_ptr<Evaluator<HostTensorPtr>::Memo> make_host_tensor_memo();
 
     namespace opset1
     {
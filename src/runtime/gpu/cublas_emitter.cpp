@@ -17,6 +17,7 @@
 #include "cublas_emitter.hpp"
 #include "gpu_emitter.hpp"
 #include "gpu_primitive_emitter.hpp"
+#include "gpu_util.hpp"
 #include "ngraph/util.hpp"
 
 using namespace ngraph;
@@ -53,6 +54,11 @@ size_t runtime::gpu::CUBLASEmitter::build_dot(const element::Type& dtype,
 
         size_t firstIndex = (arg0_shape.empty() ? 0 : 1);
         size_t secondIndex = (arg0_shape.empty() ? 1 : 0);
+        if (dtype == element::f16)
+        {
+            // the tensor is a count x 1 matrix scaled by the 1 x 1 scalar
+            return build_tensor_op_gemm(count, 1, 1, secondIndex, firstIndex, hash);
+        }
 
         dot.reset(new gpu::primitive{[=](void** inputs, void** outputs) {
             CUBLAS_SAFE_CALL(cublasScopy(*m_ctx->cublas_handle,
@@ -86,6 +92,10 @@ size_t runtime::gpu::CUBLASEmitter::build_dot(const element::Type& dtype,
         }
 
         size_t count = shape_size(arg0_shape);
+        if (dtype == element::f16)
+        {
+            return build_tensor_op_gemm(1, 1, count, 0, 1, hash);
+        }
         dot.reset(new gpu::primitive{[=](void** inputs, void** outputs) {
             CUBLAS_SAFE_CALL(cublasSdot(*m_ctx->cublas_handle,
                                         count,
@@ -104,6 +114,10 @@ size_t runtime::gpu::CUBLASEmitter::build_dot(const element::Type& dtype,
     // matrix vector
     else if ((arg0_shape.size() == 2) && (arg1_shape.size() == 1) && (reduction_axes == 1))
     {
+        if (dtype == element::f16)
+        {
+            return build_tensor_op_gemm(arg0_shape[0], 1, arg0_shape[1], 0, 1, hash);
+        }
         dot.reset(new gpu::primitive{[=](void** inputs, void** outputs) {
             const float alpha = 1.0;
             const float beta = 0;
@@ -181,11 +195,16 @@ size_t runtime::gpu::CUBLASEmitter::build_dot(const element::Type& dtype,
             }
         }
 
+        if (dtype == element::f16)
+        {
+            return build_tensor_op_gemm(m, n, k, 0, 1, hash);
+        }
         dot.reset(new gpu::primitive{[=](void** inputs, void** outputs) {
             const float alpha = 1.0;
             const float beta = 0;
 
             CUBLAS_SAFE_CALL(cublasSetPointerMode(*m_ctx->cublas_handle, CUBLAS_POINTER_MODE_HOST));
+            set_tf32_math(true);
             CUBLAS_SAFE_CALL(cublasSgemm(*m_ctx->cublas_handle,
                                          CUBLAS_OP_N,
                                          CUBLAS_OP_N,
@@ -200,6 +219,7 @@ size_t runtime::gpu::CUBLASEmitter::build_dot(const element::Type& dtype,
                                          &beta,
                                          static_cast<float*>(outputs[0]),
                                          n));
+            set_tf32_math(false);
             CUBLAS_SAFE_CALL(
                 cublasSetPointerMode(*m_ctx->cublas_handle, CUBLAS_POINTER_MODE_DEVICE));
 
@@ -211,6 +231,62 @@ size_t runtime::gpu::CUBLASEmitter::build_dot(const element::Type& dtype,
     return primitive_index;
 }
 
+size_t runtime::gpu::CUBLASEmitter::build_tensor_op_gemm(
+    size_t m, size_t n, size_t k, size_t a_index, size_t b_index, const std::string& hash)
+{
+#if CUDART_VERSION >= 9000
+    // Row major C(m x n) = A(m x k) * B(k x n) is column major C^T = B^T * A^T. The f16
+    // inputs and output are accumulated in f32 so that long reductions keep their precision.
+    std::unique_ptr<gpu::primitive> gemm(new gpu::primitive{[=](void** inputs, void** outputs) {
+        const float alpha = 1.0;
+        const float beta = 0;
+
+        CUBLAS_SAFE_CALL(cublasSetPointerMode(*m_ctx->cublas_handle, CUBLAS_POINTER_MODE_HOST));
+        CUBLAS_SAFE_CALL(cublasGemmEx(*m_ctx->cublas_handle,
+                                      CUBLAS_OP_N,
+                                      CUBLAS_OP_N,
+                                      n,
+                                      m,
+                                      k,
+                                      &alpha,
+                                      inputs[b_index],
+                                      CUDA_R_16F,
+                                      n,
+                                      inputs[a_index],
+                                      CUDA_R_16F,
+                                      k,
+                                      &beta,
+                                      outputs[0],
+                                      CUDA_R_16F,
+                                      n,
+#if CUBLAS_VER_MAJOR >= 11
+                                      CUBLAS_COMPUTE_32F,
+#else
+                                      CUDA_R_32F,
+#endif
+                                      CUBLAS_GEMM_DEFAULT_TENSOR_OP));
+        CUBLAS_SAFE_CALL(cublasSetPointerMode(*m_ctx->cublas_handle, CUBLAS_POINTER_MODE_DEVICE));
+
+        debug_sync();
+    }});
+    return this->m_primitive_emitter->register_primitive(gemm, hash);
+#else
+    throw std::runtime_error("f16 dot requires CUDA 9 or later");
+#endif
+}
+
+void runtime::gpu::CUBLASEmitter::set_tf32_math(bool enable)
+{
+#if CUBLAS_VER_MAJOR >= 11
+    if (is_tf32_allowed())
+    {
+        CUBLAS_SAFE_CALL(cublasSetMathMode(*m_ctx->cublas_handle,
+                                           enable ? CUBLAS_TF32_TENSOR_OP_MATH
+                                                  : CUBLAS_DEFAULT_MATH));
+    }
+#endif
+}
+
 void runtime::gpu::CUBLASEmitter::sync()
 {
     CUDA_RT_SAFE_CALL(cudaDeviceSynchronize());
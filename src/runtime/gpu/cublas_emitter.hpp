@@ -49,6 +49,15 @@ namespace ngraph
                 CUBLASEmitter(GPUPrimitiveEmitter* emitter, GPURuntimeContext* ctx);
                 GPUPrimitiveEmitter* m_primitive_emitter;
                 GPURuntimeContext* m_ctx;
+                // f16 dot of a row major m x k and k x n matrix on tensor cores
+                size_t build_tensor_op_gemm(size_t m,
+                                            size_t n,
+                                            size_t k,
+                                            size_t a_index,
+                                            size_t b_index,
+                                            const std::string& hash);
+                // Switch the handle to TF32 tensor op math around an f32 GEMM when allowed
+                void set_tf32_math(bool enable);
                 std::string get_error_string(std::vector<std::string>& arg_names,
                                              std::vector<Shape>& shapes,
                                              const Node* node);
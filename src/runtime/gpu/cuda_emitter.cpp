@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <functional>
 #include <iostream>
 #include <limits>
 #include <ostream>
@@ -31,6 +32,7 @@
 #include "gpu_runtime_context.hpp"
 #include "gpu_util.hpp"
 #include "ngraph/code_writer.hpp"
+#include "ngraph/function.hpp"
 #include "ngraph/util.hpp"
 #include "type_info.hpp"
 
@@ -204,7 +206,7 @@ size_t runtime::gpu::CUDAEmitter::build_concat(const std::string& dtype,
                                           1,
                                           1, // block dim
                                           0,
-                                          nullptr, // shared mem and stream
+                                          m_ctx->stream, // shared mem and stream
                                           args_list.data(),
                                           nullptr)); // arguments
             debug_sync();
@@ -309,7 +311,7 @@ size_t runtime::gpu::CUDAEmitter::build_topk(const std::vector<element::Type>& d
                                               1,
                                               1,
                                               0,
-                                              nullptr, // stream
+                                              m_ctx->stream, // stream
                                               args_list,
                                               nullptr)); // arguments
                 debug_sync();
@@ -333,7 +335,7 @@ size_t runtime::gpu::CUDAEmitter::build_topk(const std::vector<element::Type>& d
                                               1,
                                               1,
                                               shared_data_bytes, // shared mem
-                                              nullptr,           // stream
+                                              m_ctx->stream,     // stream
                                               args_list,
                                               nullptr)); // arguments
                 debug_sync();
@@ -396,7 +398,7 @@ size_t runtime::gpu::CUDAEmitter::build_onehot(const std::array<std::string, 2>&
         new gpu::primitive{[=](void** inputs, void** outputs) mutable {
             std::vector<void*> args_list{
                 &inputs[0], &outputs[0], &hot_axis_stride, &hot_axis_shape, &nthreads};
-            runtime::gpu::cuda_memset(outputs[0], 0, output_size);
+            runtime::gpu::cuda_memset_async(outputs[0], 0, output_size, m_ctx->stream);
             CUDA_SAFE_CALL(cuLaunchKernel(*compiled_kernel.get(),
                                           aligned_grid_size_x,
                                           1,
@@ -405,7 +407,7 @@ size_t runtime::gpu::CUDAEmitter::build_onehot(const std::array<std::string, 2>&
                                           1,
                                           1, // block dim
                                           0,
-                                          nullptr, // shared mem and stream
+                                          m_ctx->stream, // shared mem and stream
                                           args_list.data(),
                                           nullptr)); // arguments
             debug_sync();
@@ -476,7 +478,7 @@ size_t runtime::gpu::CUDAEmitter::build_reverse(const std::array<std::string, 2>
                                       1,
                                       1, // block dim
                                       0,
-                                      nullptr, // shared mem and stream
+                                      m_ctx->stream, // shared mem and stream
                                       args_list.data(),
                                       nullptr)); // arguments
         debug_sync();
@@ -561,7 +563,7 @@ size_t runtime::gpu::CUDAEmitter::build_pad(const std::vector<std::string>& dtyp
                                           1,
                                           1, // block dim
                                           0,
-                                          nullptr, // shared mem and stream
+                                          m_ctx->stream, // shared mem and stream
                                           args_list,
                                           nullptr)); // arguments
             debug_sync();
@@ -649,7 +651,7 @@ size_t runtime::gpu::CUDAEmitter::build_pad_fill(const std::vector<std::string>&
                                           1,
                                           1, // block dim
                                           0,
-                                          nullptr, // shared mem and stream
+                                          m_ctx->stream, // shared mem and stream
                                           args_list,
                                           nullptr)); // arguments
             debug_sync();
@@ -733,7 +735,7 @@ size_t runtime::gpu::CUDAEmitter::build_reshape(const std::array<std::string, 2>
                                           1,
                                           1, // block dim
                                           0,
-                                          nullptr, // shared mem and stream
+                                          m_ctx->stream, // shared mem and stream
                                           args_list,
                                           nullptr)); // arguments
             debug_sync();
@@ -819,7 +821,7 @@ size_t runtime::gpu::CUDAEmitter::build_reshape_2d(const std::array<std::string,
                                           block_size,
                                           1, // block dim
                                           0,
-                                          nullptr, // shared mem and stream
+                                          m_ctx->stream, // shared mem and stream
                                           args_list,
                                           nullptr)); // arguments
             debug_sync();
@@ -909,7 +911,7 @@ size_t runtime::gpu::CUDAEmitter::build_reshape_3d(const std::array<std::string,
                                           block_size[1],
                                           block_size[2], // block dim
                                           0,
-                                          nullptr, // shared mem and stream
+                                          m_ctx->stream, // shared mem and stream
                                           args_list,
                                           nullptr)); // arguments
             debug_sync();
@@ -996,7 +998,7 @@ size_t runtime::gpu::CUDAEmitter::build_slice(const std::array<std::string, 2>&
                                       1,
                                       1, // block dim
                                       0,
-                                      nullptr, // shared mem and stream
+                                      m_ctx->stream, // shared mem and stream
                                       args_list.data(),
                                       nullptr)); // arguments
         debug_sync();
@@ -1077,7 +1079,7 @@ size_t runtime::gpu::CUDAEmitter::build_reverse_sequence(const std::array<std::s
                                       1,
                                       1, // block dim
                                       0,
-                                      nullptr, // shared mem and stream
+                                      m_ctx->stream, // shared mem and stream
                                       args_list.data(),
                                       nullptr)); // arguments
         debug_sync();
@@ -1135,7 +1137,7 @@ size_t runtime::gpu::CUDAEmitter::build_1d_max_pool(const std::array<std::string
                                           1,
                                           1, // block dim
                                           0,
-                                          nullptr, // shared mem and stream
+                                          m_ctx->stream, // shared mem and stream
                                           args_list,
                                           nullptr)); // arguments
             debug_sync();
@@ -1320,7 +1322,7 @@ size_t runtime::gpu::CUDAEmitter::build_avg_pool(const std::array<std::string, 2
                                           1,
                                           1,
                                           0,
-                                          nullptr,
+                                          m_ctx->stream,
                                           args_list,
                                           nullptr));
             debug_sync();
@@ -1394,7 +1396,64 @@ size_t runtime::gpu::CUDAEmitter::build_elementwise_n_to_1(const std::vector<std
                                           1,
                                           1, // block dim
                                           0,
-                                          nullptr, // shared mem and stream
+                                          m_ctx->stream, // shared mem and stream
+                                          args_list.data(),
+                                          nullptr)); // arguments
+            debug_sync();
+        }});
+
+    return this->m_primitive_emitter->register_primitive(ew, hash);
+}
+
+size_t runtime::gpu::CUDAEmitter::build_fused_elementwise(const Function& body)
+{
+    // the expression, with the shapes its broadcasts are indexed with, names the kernel
+    CodeWriter expression;
+    CudaKernelBuilder::get_fused_elementwise_op(expression, "fused_ew", body);
+    std::stringstream kernel_name;
+    kernel_name << "fused_ew_" << std::hex << std::hash<std::string>()(expression.get_code());
+
+    // the kernel is specialized for the shape, so it also identifies the primitive
+    auto hash = kernel_name.str();
+    size_t primitive_index = m_primitive_emitter->lookup(hash);
+    if (primitive_index != std::numeric_limits<size_t>::max())
+    {
+        return primitive_index;
+    }
+
+    auto compiled_kernel = m_ctx->compiled_kernel_pool->get(kernel_name.str());
+    if (compiled_kernel == nullptr)
+    {
+        CodeWriter writer;
+        CudaKernelBuilder::add_pod_typedefs(writer);
+        CudaKernelBuilder::get_fused_elementwise_op(writer, kernel_name.str(), body);
+        compiled_kernel = m_ctx->compiled_kernel_pool->set(kernel_name.str(), writer.get_code());
+    }
+    size_t num_inputs = body.get_parameters().size();
+    uint32_t nthreads = static_cast<uint32_t>(shape_size(body.get_output_shape(0)));
+    uint32_t block_size_x = 512;
+    int num_SMs;
+    CUDA_RT_SAFE_CALL(cudaDeviceGetAttribute(&num_SMs, cudaDevAttrMultiProcessorCount, 0));
+    uint32_t aligned_grid_size_x = fmin(num_SMs * 32, align_to_block_size(nthreads, block_size_x));
+
+    std::unique_ptr<gpu::primitive> ew(
+        new gpu::primitive{[=](void** inputs, void** outputs) mutable {
+            std::vector<void*> args_list;
+            for (size_t i = 0; i < num_inputs; i++)
+            {
+                args_list.push_back(&inputs[i]);
+            }
+            args_list.push_back(&outputs[0]);
+            args_list.push_back(&nthreads);
+            CUDA_SAFE_CALL(cuLaunchKernel(*compiled_kernel.get(),
+                                          aligned_grid_size_x,
+                                          1,
+                                          1, // grid dim
+                                          block_size_x,
+                                          1,
+                                          1, // block dim
+                                          0,
+                                          m_ctx->stream, // shared mem and stream
                                           args_list.data(),
                                           nullptr)); // arguments
             debug_sync();
@@ -1456,7 +1515,7 @@ size_t runtime::gpu::CUDAEmitter::build_memset(const std::string& dtype, uint32_
                                           1,
                                           1, // block dim
                                           0,
-                                          nullptr, // shared mem and stream
+                                          m_ctx->stream, // shared mem and stream
                                           args_list,
                                           nullptr)); // arguments
             debug_sync();
@@ -1521,7 +1580,7 @@ size_t runtime::gpu::CUDAEmitter::build_cudnn_bn_inv_var(const std::vector<std::
                                           1,
                                           1, // block dim
                                           0,
-                                          nullptr, // shared mem and stream
+                                          m_ctx->stream, // shared mem and stream
                                           args_list,
                                           nullptr)); // arguments
             debug_sync();
@@ -1742,7 +1801,7 @@ size_t runtime::gpu::CUDAEmitter::build_softmax(const std::vector<element::Type>
                                               1,
                                               1,
                                               0,
-                                              nullptr,
+                                              m_ctx->stream,
                                               args_list,
                                               nullptr));
                 debug_sync();
@@ -1800,7 +1859,7 @@ size_t runtime::gpu::CUDAEmitter::build_softmax(const std::vector<element::Type>
                                               1,
                                               1,
                                               shared_data_bytes,
-                                              nullptr,
+                                              m_ctx->stream,
                                               args_list,
                                               nullptr));
                 debug_sync();
@@ -1910,7 +1969,7 @@ size_t runtime::gpu::CUDAEmitter::build_reduce_to_nd(const std::vector<element::
                                           1,
                                           1,
                                           0,
-                                          nullptr,
+                                          m_ctx->stream,
                                           args_list,
                                           nullptr));
             debug_sync();
@@ -1984,7 +2043,7 @@ size_t runtime::gpu::CUDAEmitter::build_reduce_to_scalar(const std::vector<eleme
                                           1,
                                           1,
                                           shared_data_bytes,
-                                          nullptr,
+                                          m_ctx->stream,
                                           args_list,
                                           nullptr));
             debug_sync();
@@ -2053,7 +2112,7 @@ size_t
                                           1,
                                           1,
                                           0,
-                                          nullptr,
+                                          m_ctx->stream,
                                           args_list,
                                           nullptr));
         }});
@@ -2147,7 +2206,7 @@ size_t runtime::gpu::CUDAEmitter::build_reduce(const std::vector<element::Type>&
         size_t size = nthreads * data_bytes;
         std::unique_ptr<gpu::primitive> memcopy(
             new gpu::primitive{[=](void** inputs, void** outputs) mutable {
-                runtime::gpu::cuda_memcpyDtD(outputs[0], inputs[0], size);
+                runtime::gpu::cuda_memcpyDtD_async(outputs[0], inputs[0], size, m_ctx->stream);
             }});
         primitive_index = this->m_primitive_emitter->insert(std::move(memcopy));
     }
@@ -2332,7 +2391,7 @@ size_t
                                           1,
                                           1,
                                           0,
-                                          nullptr,
+                                          m_ctx->stream,
                                           args_list,
                                           nullptr));
             debug_sync();
@@ -2431,7 +2490,7 @@ size_t runtime::gpu::CUDAEmitter::build_broadcast(const std::array<std::string,
                                           1,
                                           1,
                                           0,
-                                          nullptr,
+                                          m_ctx->stream,
                                           args_list,
                                           nullptr));
             debug_sync();
@@ -2626,7 +2685,7 @@ size_t runtime::gpu::CUDAEmitter::build_primitive(const op::v0::ReplaceSlice* no
         size_t size = nthreads * node->get_input_element_type(1).size();
         std::unique_ptr<gpu::primitive> kernel_launch(
             new gpu::primitive{[=](void** inputs, void** outputs) mutable {
-                runtime::gpu::cuda_memcpyDtD(outputs[0], inputs[0], size);
+                runtime::gpu::cuda_memcpyDtD_async(outputs[0], inputs[0], size, m_ctx->stream);
                 runtime::gpu::invoke_primitive(
                     m_ctx, pad_index, std::vector<void*>{inputs[1]}.data(), outputs);
             }});
@@ -2836,7 +2895,7 @@ size_t runtime::gpu::CUDAEmitter::build_convolution(const std::array<std::string
                                           threads.y,
                                           threads.z,
                                           0,
-                                          nullptr,
+                                          m_ctx->stream,
                                           args_list,
                                           nullptr));
             debug_sync();
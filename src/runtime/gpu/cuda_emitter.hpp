@@ -31,6 +31,7 @@
 
 namespace ngraph
 {
+    class Function;
     class NVShape;
 
     namespace runtime
@@ -116,6 +117,9 @@ namespace ngraph
                         dtypes, tensor_shape, CudaOpMap<T>::op, CudaOpMap<T>::math_kernel);
                 }
 
+                // The kernel of a FusedElementwise op, compiled once per distinct body
+                size_t build_fused_elementwise(const Function& body);
+
                 size_t build_cudnn_bn_inv_var(const std::vector<std::string>& dtypes,
                                               NVShape tensor_shape,
                                               const double& eps);
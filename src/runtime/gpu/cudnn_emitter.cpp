@@ -16,7 +16,9 @@
 
 #include <algorithm>
 #include <iostream>
+#include <mutex>
 #include <sstream>
+#include <unordered_map>
 #include <vector>
 
 #include "cudnn_emitter.hpp"
@@ -147,6 +149,7 @@ cudnnDataType_t runtime::gpu::CUDNNEmitter::get_cudnn_datatype(std::string dtype
 {
     static const std::unordered_map<std::string, cudnnDataType_t> datatype_map{
         {"float", CUDNN_DATA_FLOAT},
+        {"float16", CUDNN_DATA_HALF},
         {"double", CUDNN_DATA_DOUBLE},
         {"int8_t", CUDNN_DATA_INT8},
         {"int32_t", CUDNN_DATA_INT32}};
@@ -474,6 +477,8 @@ cudnnConvolutionDescriptor_t& runtime::gpu::CUDNNEmitter::get_cudnn_convolution_
         padding_int.push_back(0);
     }
 
+    // half convolutions accumulate in float, which is also what the tensor cores do
+    cudnnDataType_t compute_type = (data_type == CUDNN_DATA_HALF) ? CUDNN_DATA_FLOAT : data_type;
     if (padding.size() == 2)
     {
         CUDNN_SAFE_CALL(cudnnSetConvolution2dDescriptor(conv_descriptor,
@@ -484,7 +489,7 @@ cudnnConvolutionDescriptor_t& runtime::gpu::CUDNNEmitter::get_cudnn_convolution_
                                                         window_dilation_strides_int[0],
                                                         window_dilation_strides_int[1],
                                                         mode,
-                                                        data_type));
+                                                        compute_type));
     }
     else
     {
@@ -494,8 +499,10 @@ cudnnConvolutionDescriptor_t& runtime::gpu::CUDNNEmitter::get_cudnn_convolution_
                                                         window_movement_strides_int.data(),
                                                         window_dilation_strides_int.data(),
                                                         mode,
-                                                        data_type));
+                                                        compute_type));
     }
+    CUDNN_SAFE_CALL(cudnnSetConvolutionMathType(
+        conv_descriptor, get_convolution_math_type(data_type, CUDNN_TENSOR_OP_MATH)));
     return conv_descriptor;
 }
 
@@ -965,14 +972,16 @@ size_t runtime::gpu::CUDNNEmitter::build_primitive(const op::v0::Max* node)
 
         kernel_launch.reset(new gpu::primitive{[=](void** inputs, void** outputs) mutable {
             void* temp_d = runtime::gpu::invoke_memory_primitive(m_ctx, idx_float_inf);
-            runtime::gpu::cuda_memcpyDtD(outputs[0], temp_d, output_size * output_element_size);
+            runtime::gpu::cuda_memcpyDtD_async(
+                outputs[0], temp_d, output_size * output_element_size, m_ctx->stream);
         }});
     }
     else if (input_size == output_size)
     {
         // no reduction
         kernel_launch.reset(new gpu::primitive{[=](void** inputs, void** outputs) mutable {
-            runtime::gpu::cuda_memcpyDtD(outputs[0], inputs[0], output_size * output_element_size);
+            runtime::gpu::cuda_memcpyDtD_async(
+                outputs[0], inputs[0], output_size * output_element_size, m_ctx->stream);
         }});
     }
     else
@@ -1027,14 +1036,16 @@ size_t runtime::gpu::CUDNNEmitter::build_primitive(const op::v0::Min* node)
 
         kernel_launch.reset(new gpu::primitive{[=](void** inputs, void** outputs) mutable {
             void* temp_d = runtime::gpu::invoke_memory_primitive(m_ctx, idx_float_inf);
-            runtime::gpu::cuda_memcpyDtD(outputs[0], temp_d, output_size * output_element_size);
+            runtime::gpu::cuda_memcpyDtD_async(
+                outputs[0], temp_d, output_size * output_element_size, m_ctx->stream);
         }});
     }
     else if (input_size == output_size)
     {
         // no reduction
         kernel_launch.reset(new gpu::primitive{[=](void** inputs, void** outputs) mutable {
-            runtime::gpu::cuda_memcpyDtD(outputs[0], inputs[0], output_size * output_element_size);
+            runtime::gpu::cuda_memcpyDtD_async(
+                outputs[0], inputs[0], output_size * output_element_size, m_ctx->stream);
         }});
     }
     else
@@ -1279,6 +1290,61 @@ size_t runtime::gpu::CUDNNEmitter::build_primitive(const op::gpu::Rnn* node)
 }
 #endif
 
+std::string runtime::gpu::CUDNNEmitter::get_convolution_algo_key(
+    const std::string& kind,
+    cudnnDataType_t data_type,
+    const Shape& shape_0,
+    const Shape& shape_1,
+    const Shape& shape_2,
+    const Strides& window_movement_strides,
+    const Strides& window_dilation_strides,
+    const Shape& padding_below,
+    algo_search find_algo)
+{
+    int device = 0;
+    CUDA_RT_SAFE_CALL(cudaGetDevice(&device));
+    std::stringstream ss;
+    ss << kind << "_dev" << device << "_dtype" << data_type << "_search"
+       << static_cast<int>(find_algo) << "_i" << join(shape_0, "_") << "_i" << join(shape_1, "_")
+       << "_o" << join(shape_2, "_") << "_s" << join(window_movement_strides, "_") << "_d"
+       << join(window_dilation_strides, "_") << "_p" << join(padding_below, "_");
+    return ss.str();
+}
+
+runtime::gpu::CUDNNEmitter::convolution_algo runtime::gpu::CUDNNEmitter::find_convolution_algo(
+    const std::string& key, const std::function<convolution_algo()>& search)
+{
+    static std::mutex mutex;
+    static std::unordered_map<std::string, convolution_algo> cache;
+    // searches are serialized so that explicit ones do not time algorithms against each other
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = cache.find(key);
+    if (it == cache.end())
+    {
+        it = cache.insert({key, search()}).first;
+    }
+    return it->second;
+}
+
+cudnnMathType_t runtime::gpu::CUDNNEmitter::get_convolution_math_type(cudnnDataType_t data_type,
+                                                                     cudnnMathType_t requested)
+{
+    if (data_type == CUDNN_DATA_HALF)
+    {
+        return requested;
+    }
+#if CUDNN_MAJOR >= 8
+    // the default math of cuDNN 8 lets float convolutions run in TF32
+    if (!is_tf32_allowed())
+    {
+        return CUDNN_FMA_MATH;
+    }
+    return requested == CUDNN_TENSOR_OP_MATH ? CUDNN_DEFAULT_MATH : requested;
+#else
+    return CUDNN_DEFAULT_MATH;
+#endif
+}
+
 size_t runtime::gpu::CUDNNEmitter::build_convolution(const std::string& dtype,
                                                      const Shape& input_tensor_shape,
                                                      const Shape& input_filter_shape,
@@ -1303,25 +1369,39 @@ size_t runtime::gpu::CUDNNEmitter::build_convolution(const std::string& dtype,
 
     if (find_algo != algo_search::NONE)
     {
-        int num_algos;
-        int max_algos = 0;
-        CUDNN_SAFE_CALL(
-            cudnnGetConvolutionForwardAlgorithmMaxCount(*m_ctx->cudnn_handle, &max_algos));
-        std::vector<cudnnConvolutionFwdAlgoPerf_t> results(max_algos);
-        auto cudnn_algo_search = (find_algo == algo_search::EXPLICIT)
-                                     ? cudnnFindConvolutionForwardAlgorithm
-                                     : cudnnGetConvolutionForwardAlgorithm_v7;
-        CUDNN_SAFE_CALL((*cudnn_algo_search)(*m_ctx->cudnn_handle,
-                                             tensor_desc_0,
-                                             filter_desc,
-                                             conv_desc,
-                                             tensor_desc_1,
-                                             static_cast<int>(results.size()),
-                                             &num_algos,
-                                             results.data()));
-        results.resize(num_algos);
-        conv_fwd_algo =
-            select_cudnn_algo<cudnnConvolutionFwdAlgoPerf_t, cudnnConvolutionFwdAlgo_t>(results);
+        std::string key = get_convolution_algo_key("fwd",
+                                                   data_type,
+                                                   input_tensor_shape,
+                                                   input_filter_shape,
+                                                   output_tensor_shape,
+                                                   window_movement_strides,
+                                                   window_dilation_strides,
+                                                   padding_below,
+                                                   find_algo);
+        convolution_algo choice = find_convolution_algo(key, [&]() {
+            int num_algos;
+            int max_algos = 0;
+            CUDNN_SAFE_CALL(cudnnGetConvolutionForwardAlgorithmMaxCount(*m_ctx->cudnn_handle,
+                                                                      &max_algos));
+            std::vector<cudnnConvolutionFwdAlgoPerf_t> results(max_algos);
+            auto cudnn_algo_search = (find_algo == algo_search::EXPLICIT)
+                                         ? cudnnFindConvolutionForwardAlgorithm
+                                         : cudnnGetConvolutionForwardAlgorithm_v7;
+            CUDNN_SAFE_CALL((*cudnn_algo_search)(*m_ctx->cudnn_handle,
+                                                 tensor_desc_0,
+                                                 filter_desc,
+                                                 conv_desc,
+                                                 tensor_desc_1,
+                                                 static_cast<int>(results.size()),
+                                                 &num_algos,
+                                                 results.data()));
+            results.resize(num_algos);
+            auto& result = select_cudnn_algo(results);
+            return convolution_algo{static_cast<int>(result.algo), result.mathType};
+        });
+        conv_fwd_algo = static_cast<cudnnConvolutionFwdAlgo_t>(choice.algo);
+        CUDNN_SAFE_CALL(cudnnSetConvolutionMathType(
+            conv_desc, get_convolution_math_type(data_type, choice.math_type)));
     }
 
     void* alpha = m_host_parameters.allocate_by_datatype(data_type, 1.0);
@@ -1389,26 +1469,39 @@ size_t runtime::gpu::CUDNNEmitter::build_convolution_backward_data(
     cudnnConvolutionBwdDataAlgo_t conv_bwd_data_algo = CUDNN_CONVOLUTION_BWD_DATA_ALGO_0;
     if (find_algo != algo_search::NONE)
     {
-        int num_algos;
-        int max_algos = 0;
-        CUDNN_SAFE_CALL(
-            cudnnGetConvolutionBackwardDataAlgorithmMaxCount(*m_ctx->cudnn_handle, &max_algos));
-        std::vector<cudnnConvolutionBwdDataAlgoPerf_t> results(max_algos);
-        auto cudnn_algo_search = (find_algo == algo_search::EXPLICIT)
-                                     ? cudnnFindConvolutionBackwardDataAlgorithm
-                                     : cudnnGetConvolutionBackwardDataAlgorithm_v7;
-        CUDNN_SAFE_CALL((*cudnn_algo_search)(*m_ctx->cudnn_handle,
-                                             filter_desc,
-                                             tensor_desc_0,
-                                             conv_desc,
-                                             tensor_desc_1,
-                                             static_cast<int>(results.size()),
-                                             &num_algos,
-                                             results.data()));
-        results.resize(num_algos);
-        conv_bwd_data_algo =
-            select_cudnn_algo<cudnnConvolutionBwdDataAlgoPerf_t, cudnnConvolutionBwdDataAlgo_t>(
-                results);
+        std::string key = get_convolution_algo_key("bwd_data",
+                                                   data_type,
+                                                   input_filter_shape,
+                                                   input_tensor_shape,
+                                                   output_tensor_shape,
+                                                   window_movement_strides,
+                                                   window_dilation_strides,
+                                                   padding_below,
+                                                   find_algo);
+        convolution_algo choice = find_convolution_algo(key, [&]() {
+            int num_algos;
+            int max_algos = 0;
+            CUDNN_SAFE_CALL(cudnnGetConvolutionBackwardDataAlgorithmMaxCount(*m_ctx->cudnn_handle,
+                                                                      &max_algos));
+            std::vector<cudnnConvolutionBwdDataAlgoPerf_t> results(max_algos);
+            auto cudnn_algo_search = (find_algo == algo_search::EXPLICIT)
+                                         ? cudnnFindConvolutionBackwardDataAlgorithm
+                                         : cudnnGetConvolutionBackwardDataAlgorithm_v7;
+            CUDNN_SAFE_CALL((*cudnn_algo_search)(*m_ctx->cudnn_handle,
+                                                 filter_desc,
+                                                 tensor_desc_0,
+                                                 conv_desc,
+                                                 tensor_desc_1,
+                                                 static_cast<int>(results.size()),
+                                                 &num_algos,
+                                                 results.data()));
+            results.resize(num_algos);
+            auto& result = select_cudnn_algo(results);
+            return convolution_algo{static_cast<int>(result.algo), result.mathType};
+        });
+        conv_bwd_data_algo = static_cast<cudnnConvolutionBwdDataAlgo_t>(choice.algo);
+        CUDNN_SAFE_CALL(cudnnSetConvolutionMathType(
+            conv_desc, get_convolution_math_type(data_type, choice.math_type)));
     }
 
     void* alpha = m_host_parameters.allocate_by_datatype(data_type, 1.0);
@@ -1476,26 +1569,39 @@ size_t runtime::gpu::CUDNNEmitter::build_convolution_backward_filter(
     cudnnConvolutionBwdFilterAlgo_t conv_bwd_filter_algo = CUDNN_CONVOLUTION_BWD_FILTER_ALGO_0;
     if (find_algo != algo_search::NONE)
     {
-        int num_algos;
-        int max_algos = 0;
-        CUDNN_SAFE_CALL(
-            cudnnGetConvolutionBackwardFilterAlgorithmMaxCount(*m_ctx->cudnn_handle, &max_algos));
-        std::vector<cudnnConvolutionBwdFilterAlgoPerf_t> results(max_algos);
-        auto cudnn_algo_search = (find_algo == algo_search::EXPLICIT)
-                                     ? cudnnFindConvolutionBackwardFilterAlgorithm
-                                     : cudnnGetConvolutionBackwardFilterAlgorithm_v7;
-        CUDNN_SAFE_CALL((*cudnn_algo_search)(*m_ctx->cudnn_handle,
-                                             tensor_desc_0,
-                                             tensor_desc_1,
-                                             conv_desc,
-                                             filter_desc,
-                                             static_cast<int>(results.size()),
-                                             &num_algos,
-                                             results.data()));
-        results.resize(num_algos);
-        conv_bwd_filter_algo =
-            select_cudnn_algo<cudnnConvolutionBwdFilterAlgoPerf_t, cudnnConvolutionBwdFilterAlgo_t>(
-                results);
+        std::string key = get_convolution_algo_key("bwd_filter",
+                                                   data_type,
+                                                   input_tensor_shape_0,
+                                                   input_tensor_shape_1,
+                                                   output_filter_shape,
+                                                   window_movement_strides,
+                                                   window_dilation_strides,
+                                                   padding_below,
+                                                   find_algo);
+        convolution_algo choice = find_convolution_algo(key, [&]() {
+            int num_algos;
+            int max_algos = 0;
+            CUDNN_SAFE_CALL(cudnnGetConvolutionBackwardFilterAlgorithmMaxCount(*m_ctx->cudnn_handle,
+                                                                      &max_algos));
+            std::vector<cudnnConvolutionBwdFilterAlgoPerf_t> results(max_algos);
+            auto cudnn_algo_search = (find_algo == algo_search::EXPLICIT)
+                                         ? cudnnFindConvolutionBackwardFilterAlgorithm
+                                         : cudnnGetConvolutionBackwardFilterAlgorithm_v7;
+            CUDNN_SAFE_CALL((*cudnn_algo_search)(*m_ctx->cudnn_handle,
+                                                 tensor_desc_0,
+                                                 tensor_desc_1,
+                                                 conv_desc,
+                                                 filter_desc,
+                                                 static_cast<int>(results.size()),
+                                                 &num_algos,
+                                                 results.data()));
+            results.resize(num_algos);
+            auto& result = select_cudnn_algo(results);
+            return convolution_algo{static_cast<int>(result.algo), result.mathType};
+        });
+        conv_bwd_filter_algo = static_cast<cudnnConvolutionBwdFilterAlgo_t>(choice.algo);
+        CUDNN_SAFE_CALL(cudnnSetConvolutionMathType(
+            conv_desc, get_convolution_math_type(data_type, choice.math_type)));
     }
 
     size_t workspace_size_in_bytes = 0;
@@ -18,6 +18,7 @@
 
 #include <functional>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include <cublas_v2.h>
@@ -197,8 +198,8 @@ namespace ngraph
                                                      cudnnConvolutionMode_t mode,
                                                      cudnnDataType_t data_type);
 
-                template <typename PERF_TYPE, typename ALGO_TYPE>
-                ALGO_TYPE
+                template <typename PERF_TYPE>
+                const PERF_TYPE&
                     select_cudnn_algo(const std::vector<PERF_TYPE>& perf_results,
                                       size_t workspace_byte = std::numeric_limits<size_t>::max())
                 {
@@ -208,13 +209,39 @@ namespace ngraph
                         if (result.status == CUDNN_STATUS_SUCCESS &&
                             result.memory <= workspace_byte)
                         {
-                            return result.algo;
+                            return result;
                         }
                     }
                     throw ngraph_error(
                         "No suitable cuDNN algorithm was found for the requested operation.");
                 }
 
+                // The algorithm and math type picked by an algorithm search. The choices are
+                // shared by every function compiled in the process, so that the search, which
+                // times every algorithm when it is explicit, runs once per convolution shape.
+                struct convolution_algo
+                {
+                    int algo;
+                    cudnnMathType_t math_type;
+                };
+                static std::string get_convolution_algo_key(const std::string& kind,
+                                                            cudnnDataType_t data_type,
+                                                            const Shape& shape_0,
+                                                            const Shape& shape_1,
+                                                            const Shape& shape_2,
+                                                            const Strides& window_movement_strides,
+                                                            const Strides& window_dilation_strides,
+                                                            const Shape& padding_below,
+                                                            algo_search find_algo);
+                // The cached choice for key, running search the first time key is asked for
+                static convolution_algo
+                    find_convolution_algo(const std::string& key,
+                                          const std::function<convolution_algo()>& search);
+                // Tensor op math for half convolutions; for float ones, TF32 tensor ops only
+                // when they are allowed and FMA otherwise
+                static cudnnMathType_t get_convolution_math_type(cudnnDataType_t data_type,
+                                                                 cudnnMathType_t requested);
+
                 CUDNNDescriptors m_descriptors;
                 CUDNNHostParameters m_host_parameters;
 
@@ -46,6 +46,8 @@ namespace ngraph
                     void* r = nullptr;
                     switch (data_type)
                     {
+                    // cuDNN takes the scaling factors of half tensors as float
+                    case CUDNN_DATA_HALF:
                     case CUDNN_DATA_FLOAT:
                         r = m_host_parameters->cache(static_cast<float>(value));
                         break;
@@ -58,7 +60,6 @@ namespace ngraph
                     case CUDNN_DATA_INT32:
                         r = m_host_parameters->cache(static_cast<int32_t>(value));
                         break;
-                    case CUDNN_DATA_HALF:
                     case CUDNN_DATA_INT8x4:
                     case CUDNN_DATA_UINT8:
                     case CUDNN_DATA_UINT8x4:
@@ -19,13 +19,17 @@
 #include <cuda_runtime.h>
 #include <cudnn.h>
 
+#include "cuda_error_check.hpp"
 #include "gpu_backend.hpp"
+#include "gpu_cuda_stream_pool.hpp"
 #include "gpu_executable.hpp"
 #include "gpu_external_function.hpp"
 #include "gpu_internal_function.hpp"
 #include "gpu_primitive_emitter.hpp"
 #include "gpu_tensor.hpp"
 #include "gpu_util.hpp"
+#include "ngraph/check.hpp"
+#include "ngraph/except.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/op/batch_norm.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
@@ -36,8 +40,10 @@ using namespace std;
 
 extern "C" GPU_BACKEND_API void ngraph_register_gpu_backend()
 {
-    runtime::BackendManager::register_backend("GPU", [](const std::string& /* config */) {
-        return make_shared<runtime::gpu::GPUBackend>();
+    runtime::BackendManager::register_backend("GPU", [](const std::string& config) {
+        auto backend = make_shared<runtime::gpu::GPUBackend>();
+        backend->configure(config);
+        return backend;
     });
 }
 
@@ -46,10 +52,49 @@ runtime::gpu::GPUBackend::GPUBackend()
 {
 }
 
-runtime::gpu::GPUBackend::BackendContext::BackendContext()
+void runtime::gpu::GPUBackend::configure(const string& config)
+{
+    for (const string& option : split(config, ',', true))
+    {
+        if (option == "cuda_graph")
+        {
+            NGRAPH_CHECK(GPUExecutable::is_cuda_graph_supported(),
+                         "GPU backend option 'cuda_graph' needs CUDA 10.2 or later");
+            m_cuda_graph = true;
+        }
+        else if (option.compare(0, 7, "device=") == 0)
+        {
+            m_device = parse_string<int>(option.substr(7));
+            NGRAPH_CHECK(m_device >= 0 && m_device < get_device_count(),
+                         "GPU backend option '",
+                         option,
+                         "' names a device that is not visible");
+        }
+        else if (option.compare(0, 8, "streams=") == 0)
+        {
+            m_streams = parse_string<size_t>(option.substr(8));
+            NGRAPH_CHECK(m_streams > 0, "GPU backend option '", option, "' needs a stream");
+        }
+        else if (!option.empty())
+        {
+            throw ngraph_error("Unknown GPU backend option '" + option + "'");
+        }
+    }
+}
+
+int runtime::gpu::GPUBackend::get_device_count()
+{
+    int count = 0;
+    CUDA_RT_SAFE_CALL(cudaGetDeviceCount(&count));
+    return count;
+}
+
+runtime::gpu::GPUBackend::BackendContext::BackendContext(bool dedicated_streams,
+                                                         int device,
+                                                         size_t streams)
     : m_runtime_context(new GPURuntimeContext)
     , m_primitive_emitter(new GPUPrimitiveEmitter(m_runtime_context))
-    , m_cuda_manager(new CudaContextManager)
+    , m_cuda_manager(new CudaContextManager(device))
 {
     // Create context use driver API and make it current, the runtime call will pickup the context
     // http://docs.nvidia.com/cuda/cuda-c-programming-guide/index.html
@@ -74,6 +119,10 @@ runtime::gpu::GPUBackend::BackendContext::BackendContext()
 
     // register with c-api runtime context
     m_runtime_context->compiled_kernel_pool = new CudaFunctionPool;
+
+    m_runtime_context->stream_pool =
+        new CudaStreamPool(streams, !dedicated_streams);
+    set_stream(m_runtime_context.get(), 0);
 }
 
 void runtime::gpu::GPUBackend::BackendContext::prepare_runtime_context()
@@ -97,6 +146,7 @@ runtime::gpu::GPUBackend::BackendContext::~BackendContext()
     cudnnDestroy(*m_runtime_context->cudnn_handle);
     delete m_runtime_context->cudnn_handle;
     delete m_runtime_context->compiled_kernel_pool;
+    delete m_runtime_context->stream_pool;
 }
 
 shared_ptr<runtime::Tensor> runtime::gpu::GPUBackend::create_tensor()
@@ -107,6 +157,8 @@ shared_ptr<runtime::Tensor> runtime::gpu::GPUBackend::create_tensor()
 shared_ptr<runtime::Tensor>
     runtime::gpu::GPUBackend::create_tensor(const element::Type& element_type, const Shape& shape)
 {
+    // Allocate on the device of this backend, whichever the calling thread was using
+    CUDA_RT_SAFE_CALL(cudaSetDevice(m_device));
     return make_shared<runtime::gpu::GPUTensor>(element_type, shape);
 }
 
@@ -117,6 +169,7 @@ shared_ptr<runtime::Tensor> runtime::gpu::GPUBackend::create_tensor(
     {
         throw ngraph_error("The pointer passed to create_tensor is not a device pointer.");
     }
+    CUDA_RT_SAFE_CALL(cudaSetDevice(m_device));
     return make_shared<runtime::gpu::GPUTensor>(element_type, shape, memory_pointer);
 }
 
@@ -131,7 +184,7 @@ shared_ptr<runtime::Executable> runtime::gpu::GPUBackend::compile(shared_ptr<Fun
     }
     else
     {
-        rc = make_shared<GPUExecutable>(func, timing_enable);
+        rc = make_shared<GPUExecutable>(func, timing_enable, m_cuda_graph, m_device, m_streams);
         m_exec_map.insert({func, rc});
     }
     return rc;
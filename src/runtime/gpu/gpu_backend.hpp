@@ -46,6 +46,21 @@ namespace ngraph
             public:
                 GPUBackend();
 
+                /// \brief Applies a comma separated list of backend options, as given after the
+                ///        colon in "GPU:cuda_graph"
+                ///
+                /// cuda_graph: capture each call of an executable into a CUDA graph and
+                /// replay it on the following calls. Capture is repeated when the call is given
+                /// different tensors.
+                /// device=N: allocate tensors and run executables on device N instead of 0.
+                /// streams=N: spread the independent branches of each executable over N CUDA
+                /// streams. Ops on different streams may run in any order, so intermediate
+                /// tensors no longer share memory and executables need more device memory.
+                void configure(const std::string& config);
+
+                /// \brief The number of CUDA devices visible to the process
+                static int get_device_count();
+
                 std::shared_ptr<ngraph::runtime::Tensor> create_tensor() override;
 
                 std::shared_ptr<ngraph::runtime::Tensor>
@@ -65,7 +80,13 @@ namespace ngraph
                 class BackendContext
                 {
                 public:
-                    BackendContext();
+                    /// \param dedicated_streams queue the primitives on created streams even
+                    ///        when there is a single one, so that they can be captured
+                    /// \param device ordinal of the CUDA device to run on
+                    /// \param streams number of streams the primitives are spread over
+                    BackendContext(bool dedicated_streams = false,
+                                   int device = 0,
+                                   size_t streams = 1);
                     ~BackendContext();
                     void prepare_runtime_context();
                     void bind_cuda_context_to_thread();
@@ -79,6 +100,9 @@ namespace ngraph
 
             private:
                 std::map<std::shared_ptr<Function>, std::shared_ptr<Executable>> m_exec_map;
+                bool m_cuda_graph = false;
+                int m_device = 0;
+                size_t m_streams = 1;
             };
         }
     }
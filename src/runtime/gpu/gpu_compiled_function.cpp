@@ -41,11 +41,13 @@
 
 #include "gpu_backend.hpp"
 #include "gpu_compiled_function.hpp"
+#include "gpu_cuda_stream_pool.hpp"
 #include "gpu_external_function.hpp"
 #include "gpu_internal_function.hpp"
 #include "op/batch_norm.hpp"
 #include "op/rnn.hpp"
 #include "pass/gpu_batch_norm_cache.hpp"
+#include "pass/gpu_elementwise_fusion.hpp"
 #include "pass/gpu_layout.hpp"
 #include "pass/gpu_rnn_fusion.hpp"
 #include "pass/tensor_memory_reservation.hpp"
@@ -152,9 +154,13 @@ void runtime::gpu::GPUCompiledFunction::compile()
     pass_manager.register_pass<ngraph::pass::FusedOpDecomposition>();
     pass_manager.register_pass<ngraph::pass::ImplicitBroadcastElimination>();
     pass_manager.register_pass<runtime::gpu::pass::GPULayout>(this);
+    pass_manager.register_pass<runtime::gpu::pass::ElementwiseFusion>();
     pass_manager.register_pass<ngraph::pass::AssignLayout<descriptor::layout::DenseTensorLayout>>();
     pass_manager.register_pass<ngraph::pass::Liveness>();
-    pass_manager.register_pass<ngraph::pass::MemoryLayout>(get_memory_alignment());
+    // ops on different streams can run in any order, so a buffer freed by one of them cannot be
+    // handed to a later op
+    bool multi_stream = m_shared_context->m_runtime_context->stream_pool->size() > 1;
+    pass_manager.register_pass<ngraph::pass::MemoryLayout>(get_memory_alignment(), multi_stream);
     pass_manager.register_pass<runtime::gpu::pass::TensorMemoryReservation>(
         *allocator, m_tensor_memory_buffers);
     string dump_filename = file_util::path_join(get_output_dir(), m_function_name + "_ops.txt");
@@ -0,0 +1,141 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "cuda_error_check.hpp"
+#include "gpu_cuda_caching_allocator.hpp"
+
+using namespace ngraph;
+
+runtime::gpu::CudaCachingAllocator::~CudaCachingAllocator()
+{
+    for (auto& cached : m_cached)
+    {
+        for (auto& entry : cached.second)
+        {
+            CUDA_RT_SAFE_CALL_NO_THROW(cudaFree(entry.first));
+            CUDA_RT_SAFE_CALL_NO_THROW(cudaEventDestroy(entry.second.freed));
+        }
+    }
+}
+
+size_t runtime::gpu::CudaCachingAllocator::round_size(size_t size)
+{
+    constexpr size_t small_granularity = 512;
+    constexpr size_t large_threshold = 1 << 20;
+    constexpr size_t large_granularity = 2 << 20;
+    size_t granularity = size <= large_threshold ? small_granularity : large_granularity;
+    return std::max<size_t>((size + granularity - 1) / granularity * granularity, granularity);
+}
+
+void* runtime::gpu::CudaCachingAllocator::allocate(size_t size, cudaStream_t stream)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    size_t rounded = round_size(size);
+    void* ptr = nullptr;
+    block b;
+    b.size = rounded;
+    b.stream = stream;
+
+    auto it = m_cached.find({stream, rounded});
+    if (it != m_cached.end() && !it->second.empty())
+    {
+        ptr = it->second.back().first;
+        b.freed = it->second.back().second.freed;
+        it->second.pop_back();
+        if (stream == nullptr)
+        {
+            CUDA_RT_SAFE_CALL(cudaEventSynchronize(b.freed));
+        }
+        else
+        {
+            CUDA_RT_SAFE_CALL(cudaStreamWaitEvent(stream, b.freed, 0));
+        }
+        m_stats.cached_bytes -= rounded;
+        m_stats.num_cache_hits++;
+    }
+    else
+    {
+        if (cudaMalloc(&ptr, rounded) != cudaSuccess)
+        {
+            // give the cached blocks back and try again
+            cudaGetLastError();
+            release_cached_blocks();
+            CUDA_RT_SAFE_CALL(cudaMalloc(&ptr, rounded));
+        }
+        m_stats.num_device_allocations++;
+    }
+
+    m_allocated[ptr] = b;
+    m_stats.allocated_bytes += rounded;
+    m_stats.peak_allocated_bytes = std::max(m_stats.peak_allocated_bytes, m_stats.allocated_bytes);
+    return ptr;
+}
+
+void runtime::gpu::CudaCachingAllocator::free(void* ptr)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_allocated.find(ptr);
+    if (it == m_allocated.end())
+    {
+        throw std::runtime_error("Device memory freed was not allocated by the GPU backend.");
+    }
+    block b = it->second;
+    m_allocated.erase(it);
+    if (b.freed == nullptr)
+    {
+        CUDA_RT_SAFE_CALL(cudaEventCreateWithFlags(&b.freed, cudaEventDisableTiming));
+    }
+    CUDA_RT_SAFE_CALL(cudaEventRecord(b.freed, b.stream));
+    m_cached[{b.stream, b.size}].push_back({ptr, b});
+    m_stats.allocated_bytes -= b.size;
+    m_stats.cached_bytes += b.size;
+}
+
+void runtime::gpu::CudaCachingAllocator::trim()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    release_cached_blocks();
+}
+
+runtime::gpu::CudaCachingAllocator::Stats runtime::gpu::CudaCachingAllocator::get_stats()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+void runtime::gpu::CudaCachingAllocator::release_cached_blocks()
+{
+    for (auto& cached : m_cached)
+    {
+        for (auto& entry : cached.second)
+        {
+            // cudaFree waits for the work still using the block
+            CUDA_RT_SAFE_CALL(cudaFree(entry.first));
+            CUDA_RT_SAFE_CALL(cudaEventDestroy(entry.second.freed));
+        }
+    }
+    m_cached.clear();
+    m_stats.cached_bytes = 0;
+}
+
+runtime::gpu::CudaCachingAllocator& runtime::gpu::CudaCachingAllocator::get()
+{
+    static CudaCachingAllocator* allocator = new CudaCachingAllocator;
+    return *allocator;
+}
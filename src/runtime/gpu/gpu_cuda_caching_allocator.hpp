@@ -0,0 +1,92 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cuda_runtime.h>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace gpu
+        {
+            // Keeps freed device memory for reuse instead of returning it to cudaFree, so
+            // tensors, workspaces and kernel scratch space of executables created one after
+            // the other do not go through cudaMalloc each time.
+            //
+            // Sizes are rounded up to a size class, 512 bytes up to 1MB and 2MB above, and a
+            // freed block is only handed out again for its size class. Blocks are cached per
+            // stream: a block allocated for a stream is reused on that stream behind the work
+            // queued when it was freed, while one allocated for no particular stream, which
+            // may be used on any, is reused once that work has completed. The cache is
+            // released when cudaMalloc runs out of memory, or explicitly with trim.
+            class CudaCachingAllocator
+            {
+            public:
+                struct Stats
+                {
+                    // bytes handed out and not freed, after rounding to the size classes
+                    size_t allocated_bytes = 0;
+                    size_t peak_allocated_bytes = 0;
+                    // bytes freed and kept for reuse
+                    size_t cached_bytes = 0;
+                    size_t num_device_allocations = 0;
+                    size_t num_cache_hits = 0;
+                };
+
+                CudaCachingAllocator() = default;
+                ~CudaCachingAllocator();
+
+                CudaCachingAllocator(CudaCachingAllocator const&) = delete;
+                CudaCachingAllocator& operator=(CudaCachingAllocator const&) = delete;
+
+                void* allocate(size_t size, cudaStream_t stream = nullptr);
+                void free(void* ptr);
+                // Returns the cached blocks to the device
+                void trim();
+                Stats get_stats();
+
+                static size_t round_size(size_t size);
+
+                // The allocator behind create_gpu_buffer and free_gpu_buffer. It is never
+                // destroyed, the memory it caches is released with the CUDA context.
+                static CudaCachingAllocator& get();
+
+            private:
+                struct block
+                {
+                    size_t size;
+                    cudaStream_t stream;
+                    // recorded on the stream when the block is freed
+                    cudaEvent_t freed = nullptr;
+                };
+                void release_cached_blocks();
+
+                std::mutex m_mutex;
+                std::unordered_map<void*, block> m_allocated;
+                std::map<std::pair<cudaStream_t, size_t>, std::vector<std::pair<void*, block>>>
+                    m_cached;
+                Stats m_stats;
+            };
+        }
+    }
+}
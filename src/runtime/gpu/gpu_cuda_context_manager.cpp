@@ -22,10 +22,10 @@
 
 using namespace ngraph;
 
-runtime::gpu::CudaContextManager::CudaContextManager()
+runtime::gpu::CudaContextManager::CudaContextManager(int device)
 {
     CUDA_SAFE_CALL(cuInit(0));
-    CUDA_SAFE_CALL(cuDeviceGet(&m_device, 0));
+    CUDA_SAFE_CALL(cuDeviceGet(&m_device, device));
     CUDA_SAFE_CALL(cuDevicePrimaryCtxRetain(&m_context, m_device));
 }
 
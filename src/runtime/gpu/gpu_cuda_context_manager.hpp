@@ -29,7 +29,7 @@ namespace ngraph
             class CudaContextManager
             {
             public:
-                CudaContextManager();
+                CudaContextManager(int device = 0);
                 ~CudaContextManager();
 
                 CudaContextManager(CudaContextManager const&) = delete;
@@ -14,10 +14,13 @@
 // limitations under the License.
 //*****************************************************************************
 #include <algorithm>
+#include <unordered_map>
 
 #include "gpu_cuda_kernel_builder.hpp"
+#include "gpu_cuda_kernel_ops.hpp"
 #include "gpu_kernel_args.hpp"
 #include "ngraph/code_writer.hpp"
+#include "ngraph/function.hpp"
 #include "nvrtc/helpers.hpp"
 #include "type_info.hpp"
 
@@ -58,6 +61,140 @@ void runtime::gpu::CudaKernelBuilder::get_elementwise_op(CodeWriter& writer,
     return;
 }
 
+void runtime::gpu::CudaKernelBuilder::get_fused_elementwise_op(CodeWriter& writer,
+                                                               const std::string& name,
+                                                               const Function& body)
+{
+    // booleans are computed as bool and stored as char, as get_elementwise_op does
+    auto value_type = [](const element::Type& type) {
+        return type == element::boolean ? std::string("bool") : type.c_type_string();
+    };
+    const Shape& shape = body.get_output_shape(0);
+    const Strides strides = row_major_strides(shape);
+
+    std::unordered_map<const Node*, std::string> values;
+    std::unordered_map<const Node*, size_t> parameters;
+    for (size_t i = 0; i < body.get_parameters().size(); i++)
+    {
+        parameters[body.get_parameters()[i].get()] = i;
+    }
+    std::set<std::string> helpers;
+    std::vector<std::string> statements;
+    auto get_value = [&](const Output<Node>& output) {
+        const Node* node = output.get_node();
+        auto it = values.find(node);
+        if (it == values.end())
+        {
+            // a parameter read elementwise, loaded the first time it is used
+            std::string value = "p" + std::to_string(parameters.at(node));
+            statements.push_back(value_type(output.get_element_type()) + " " + value + " = in" +
+                                 std::to_string(parameters.at(node)) + "[tid];");
+            it = values.insert({node, value}).first;
+        }
+        return it->second;
+    };
+
+    for (auto& op : body.get_ordered_ops())
+    {
+        if (op->is_parameter() || op->is_output())
+        {
+            continue;
+        }
+        std::string value = "v" + std::to_string(values.size());
+        std::string type = value_type(op->get_output_element_type(0));
+        auto broadcast = as_type_ptr<op::v0::Broadcast>(op);
+        const Node* source = op->get_input_node_ptr(0);
+        if (broadcast && parameters.count(source) != 0)
+        {
+            // the element of the input the output coordinate of tid is broadcast from
+            const AxisSet& axes = broadcast->get_broadcast_axes();
+            Shape input_shape = op->get_input_shape(0);
+            Strides input_strides = row_major_strides(input_shape);
+            std::stringstream index;
+            for (size_t i = 0, j = 0; i < shape.size(); i++)
+            {
+                if (axes.count(i) != 0)
+                {
+                    continue;
+                }
+                index << (j == 0 ? "" : " + ") << "tid";
+                if (strides[i] != 1)
+                {
+                    index << " / " << strides[i] << "u";
+                }
+                if (i != 0)
+                {
+                    index << " % " << shape[i] << "u";
+                }
+                if (input_strides[j] != 1)
+                {
+                    index << " * " << input_strides[j] << "u";
+                }
+                j++;
+            }
+            statements.push_back(type + " " + value + " = in" +
+                                 std::to_string(parameters.at(source)) + "[" +
+                                 (index.str().empty() ? "0" : index.str()) + "];");
+        }
+        else if (broadcast)
+        {
+            // a broadcast along no axes of a value of the chain
+            value = get_value(op->input_value(0));
+        }
+        else
+        {
+            auto cuda_op = get_cuda_elementwise_op(*op);
+            NGRAPH_CHECK(cuda_op, "No CUDA kernel for ", op->description());
+            std::vector<std::string> dtypes;
+            std::vector<std::string> operands;
+            for (auto& input : op->input_values())
+            {
+                dtypes.push_back(input.get_element_type().c_type_string());
+                operands.push_back(get_value(input));
+            }
+            dtypes.push_back(type);
+            std::string function = cuda_op->op;
+            if (cuda_op->math_kernel)
+            {
+                // helpers are named by signature, as an op can appear with different types
+                function += "_" + join(dtypes, "_");
+                if (helpers.insert(function).second)
+                {
+                    get_device_helper(writer, function, cuda_op->math_kernel, dtypes);
+                }
+            }
+            statements.push_back(type + " " + value + " = " + function + "(" + join(operands) +
+                                 ");");
+        }
+        values[op.get()] = value;
+    }
+
+    writer << "extern \"C\" __global__ void cuda_" << name << "(";
+    for (auto& parameter : body.get_parameters())
+    {
+        writer << parameter->get_element_type().c_type_string() << "* in"
+               << parameters.at(parameter.get()) << ", ";
+    }
+    auto result = body.get_results().at(0)->input_value(0);
+    writer << value_type(result.get_element_type()) << "* out, uint32_t n)\n";
+    writer.block_begin();
+    {
+        writer << "uint32_t tid = blockIdx.x * blockDim.x + threadIdx.x; \n";
+        writer << "uint32_t step = gridDim.x * blockDim.x; \n";
+        writer << "for ( ;tid < n; tid += step)\n";
+        writer.block_begin();
+        {
+            for (auto& statement : statements)
+            {
+                writer << statement << "\n";
+            }
+            writer << "out[tid] = " << get_value(result) << ";\n";
+        }
+        writer.block_end();
+    }
+    writer.block_end();
+}
+
 void runtime::gpu::CudaKernelBuilder::get_memset_op(CodeWriter& writer,
                                                     const std::string& name,
                                                     const std::string& data_type,
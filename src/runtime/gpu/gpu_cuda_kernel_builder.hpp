@@ -24,6 +24,7 @@
 namespace ngraph
 {
     class CodeWriter;
+    class Function;
     namespace runtime
     {
         namespace gpu
@@ -37,6 +38,12 @@ namespace ngraph
                                                const std::string& op,
                                                const std::vector<std::string>& data_types);
 
+                // One kernel evaluating the body of a FusedElementwise op for every element of
+                // its output
+                static void get_fused_elementwise_op(CodeWriter& writer,
+                                                     const std::string& name,
+                                                     const Function& body);
+
                 static void get_memset_op(CodeWriter& writer,
                                           const std::string& name,
                                           const std::string& data_type,
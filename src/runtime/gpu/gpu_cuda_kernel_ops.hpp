@@ -16,6 +16,10 @@
 
 #pragma once
 
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+
 #include "ngraph/ops.hpp"
 
 namespace ngraph
@@ -335,6 +339,62 @@ namespace ngraph
                 static constexpr const char* op = "sigmoid_backprop";
                 static constexpr const char* math_kernel = "x1 / (2 + expf(-x0) + expf(x0))";
             };
+
+            struct CudaElementwiseOp
+            {
+                const char* op;
+                const char* math_kernel;
+            };
+
+            // The CudaOpMap entry of the ops the GPU emitter lowers to an elementwise kernel,
+            // looked up by the type of a node; nullptr for any other op
+            inline const CudaElementwiseOp* get_cuda_elementwise_op(const Node& node)
+            {
+#define NGRAPH_GPU_ELEMENTWISE_OP(T)                                                               \
+    {std::type_index(typeid(T)), CudaElementwiseOp{CudaOpMap<T>::op, CudaOpMap<T>::math_kernel}},
+                static const std::unordered_map<std::type_index, CudaElementwiseOp> ops{
+                    NGRAPH_GPU_ELEMENTWISE_OP(ngraph::op::v0::Abs)
+                    NGRAPH_GPU_ELEMENTWISE_OP(ngraph::op::v0::Acos)
+                    NGRAPH_GPU_ELEMENTWISE_OP(ngraph::op::v0::Asin)
+                    NGRAPH_GPU_ELEMENTWISE_OP(ngraph::op::v0::Atan)
+                    NGRAPH_GPU_ELEMENTWISE_OP(ngraph::op::v0::Ceiling)
+                    NGRAPH_GPU_ELEMENTWISE_OP(ngraph::op::v0::Convert)
+                    NGRAPH_GPU_ELEMENTWISE_OP(ngraph::op::v0::Cos)
+                    NGRAPH_GPU_ELEMENTWISE_OP(ngraph::op::v0::Cosh)
+                    NGRAPH_GPU_ELEMENTWISE_OP(ngraph::op::v0::Exp)
+                    NGRAPH_GPU_ELEMENTWISE_OP(ngraph::op::v0::Floor)
+                    NGRAPH_GPU_ELEMENTWISE_OP(ngraph::op::v0::Log)
+                    NGRAPH_GPU_ELEMENTWISE_OP(ngraph::op::v0::Negative)
+                    NGRAPH_GPU_ELEMENTWISE_OP(ngraph::op::v0::Relu)
+                    NGRAPH_GPU_ELEMENTWISE_OP(ngraph::op::v0::ReluBackprop)
+                    NGRAPH_GPU_ELEMENTWISE_OP(ngraph::op::v0::Sigmoid)
+                    NGRAPH_GPU_ELEMENTWISE_OP(ngraph::op::v0::SigmoidBackprop)
+                    NGRAPH_GPU_ELEMENTWISE_OP(ngraph::op::v0::Sign)
+                    NGRAPH_GPU_ELEMENTWISE_OP(ngraph::op::v0::Sin)
+                    NGRAPH_GPU_ELEMENTWISE_OP(ngraph::op::v0::Sinh)
+                    NGRAPH_GPU_ELEMENTWISE_OP(ngraph::op::v0::Sqrt)
+                    NGRAPH_GPU_ELEMENTWISE_OP(ngraph::op::v0::Tan)
+                    NGRAPH_GPU_ELEMENTWISE_OP(ngraph::op::v0::Tanh)
+                    NGRAPH_GPU_ELEMENTWISE_OP(ngraph::op::v1::Add)
+                    NGRAPH_GPU_ELEMENTWISE_OP(ngraph::op::v1::Divide)
+                    NGRAPH_GPU_ELEMENTWISE_OP(ngraph::op::v1::Equal)
+                    NGRAPH_GPU_ELEMENTWISE_OP(ngraph::op::v1::Greater)
+                    NGRAPH_GPU_ELEMENTWISE_OP(ngraph::op::v1::GreaterEqual)
+                    NGRAPH_GPU_ELEMENTWISE_OP(ngraph::op::v1::Less)
+                    NGRAPH_GPU_ELEMENTWISE_OP(ngraph::op::v1::LessEqual)
+                    NGRAPH_GPU_ELEMENTWISE_OP(ngraph::op::v1::LogicalAnd)
+                    NGRAPH_GPU_ELEMENTWISE_OP(ngraph::op::v1::LogicalNot)
+                    NGRAPH_GPU_ELEMENTWISE_OP(ngraph::op::v1::LogicalOr)
+                    NGRAPH_GPU_ELEMENTWISE_OP(ngraph::op::v1::Maximum)
+                    NGRAPH_GPU_ELEMENTWISE_OP(ngraph::op::v1::Multiply)
+                    NGRAPH_GPU_ELEMENTWISE_OP(ngraph::op::v1::NotEqual)
+                    NGRAPH_GPU_ELEMENTWISE_OP(ngraph::op::v1::Power)
+                    NGRAPH_GPU_ELEMENTWISE_OP(ngraph::op::v1::Subtract)
+                };
+#undef NGRAPH_GPU_ELEMENTWISE_OP
+                auto it = ops.find(std::type_index(typeid(node)));
+                return it == ops.end() ? nullptr : &it->second;
+            }
         }
     }
 }
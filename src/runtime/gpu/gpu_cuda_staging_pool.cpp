@@ -0,0 +1,144 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cstring>
+
+#include "cuda_error_check.hpp"
+#include "gpu_cuda_staging_pool.hpp"
+
+using namespace ngraph;
+
+runtime::gpu::CudaStagingPool::CudaStagingPool(size_t chunk_size, size_t num_chunks)
+    : m_chunk_size(chunk_size)
+    , m_next_chunk(0)
+{
+    CUDA_RT_SAFE_CALL(cudaStreamCreateWithFlags(&m_stream, cudaStreamNonBlocking));
+    for (size_t i = 0; i < num_chunks; i++)
+    {
+        chunk c;
+        CUDA_RT_SAFE_CALL(cudaHostAlloc(&c.host, chunk_size, cudaHostAllocDefault));
+        CUDA_RT_SAFE_CALL(cudaEventCreateWithFlags(&c.done, cudaEventDisableTiming));
+        m_chunks.push_back(c);
+    }
+}
+
+runtime::gpu::CudaStagingPool::~CudaStagingPool()
+{
+    CUDA_RT_SAFE_CALL_NO_THROW(cudaStreamSynchronize(m_stream));
+    for (auto& c : m_chunks)
+    {
+        CUDA_RT_SAFE_CALL_NO_THROW(cudaEventDestroy(c.done));
+        CUDA_RT_SAFE_CALL_NO_THROW(cudaFreeHost(c.host));
+    }
+    CUDA_RT_SAFE_CALL_NO_THROW(cudaStreamDestroy(m_stream));
+}
+
+runtime::gpu::CudaStagingPool::chunk& runtime::gpu::CudaStagingPool::next_chunk()
+{
+    chunk& c = m_chunks[m_next_chunk];
+    m_next_chunk = (m_next_chunk + 1) % m_chunks.size();
+    // the buffer is reused once the copy it was last staged for has completed
+    CUDA_RT_SAFE_CALL(cudaEventSynchronize(c.done));
+    return c;
+}
+
+void runtime::gpu::CudaStagingPool::write(
+    void* dst, const void* src, size_t size, cudaEvent_t after_event, cudaEvent_t done_event)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    CUDA_RT_SAFE_CALL(cudaStreamWaitEvent(m_stream, after_event, 0));
+    for (size_t offset = 0; offset < size; offset += m_chunk_size)
+    {
+        size_t n = std::min(m_chunk_size, size - offset);
+        chunk& c = next_chunk();
+        std::memcpy(c.host, static_cast<const char*>(src) + offset, n);
+        CUDA_RT_SAFE_CALL(cudaMemcpyAsync(
+            static_cast<char*>(dst) + offset, c.host, n, cudaMemcpyHostToDevice, m_stream));
+        CUDA_RT_SAFE_CALL(cudaEventRecord(c.done, m_stream));
+    }
+    CUDA_RT_SAFE_CALL(cudaEventRecord(done_event, m_stream));
+}
+
+void runtime::gpu::CudaStagingPool::read(void* dst,
+                                         const void* src,
+                                         size_t size,
+                                         cudaEvent_t after_event)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    CUDA_RT_SAFE_CALL(cudaStreamWaitEvent(m_stream, after_event, 0));
+    // keep up to all the buffers in flight, unstaging the oldest piece before its buffer is
+    // staged for a new one
+    std::vector<std::pair<chunk*, size_t>> in_flight;
+    auto unstage = [&](size_t piece) {
+        chunk& c = *in_flight[piece].first;
+        size_t offset = piece * m_chunk_size;
+        CUDA_RT_SAFE_CALL(cudaEventSynchronize(c.done));
+        std::memcpy(static_cast<char*>(dst) + offset, c.host, in_flight[piece].second);
+    };
+    for (size_t offset = 0, piece = 0; offset < size; offset += m_chunk_size, piece++)
+    {
+        if (piece >= m_chunks.size())
+        {
+            unstage(piece - m_chunks.size());
+        }
+        size_t n = std::min(m_chunk_size, size - offset);
+        chunk& c = next_chunk();
+        CUDA_RT_SAFE_CALL(cudaMemcpyAsync(
+            c.host, static_cast<const char*>(src) + offset, n, cudaMemcpyDeviceToHost, m_stream));
+        CUDA_RT_SAFE_CALL(cudaEventRecord(c.done, m_stream));
+        in_flight.push_back({&c, n});
+    }
+    size_t num_pieces = in_flight.size();
+    for (size_t piece = num_pieces - std::min(num_pieces, m_chunks.size()); piece < num_pieces;
+         piece++)
+    {
+        unstage(piece);
+    }
+}
+
+void runtime::gpu::CudaStagingPool::copy(void* dst,
+                                         const void* src,
+                                         size_t size,
+                                         const std::vector<cudaEvent_t>& after_events,
+                                         const std::vector<cudaEvent_t>& done_events)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto event : after_events)
+    {
+        CUDA_RT_SAFE_CALL(cudaStreamWaitEvent(m_stream, event, 0));
+    }
+    CUDA_RT_SAFE_CALL(cudaMemcpyAsync(dst, src, size, cudaMemcpyDeviceToDevice, m_stream));
+    for (auto event : done_events)
+    {
+        CUDA_RT_SAFE_CALL(cudaEventRecord(event, m_stream));
+    }
+}
+
+std::shared_ptr<runtime::gpu::CudaStagingPool> runtime::gpu::CudaStagingPool::get_default()
+{
+    // 4 buffers of 4MB let an upload be staged while the previous pieces are copied
+    static std::mutex mutex;
+    static std::weak_ptr<CudaStagingPool> pool;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto current = pool.lock();
+    if (!current)
+    {
+        current = std::make_shared<CudaStagingPool>(4 * 1024 * 1024, 4);
+        pool = current;
+    }
+    return current;
+}
@@ -0,0 +1,82 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cuda_runtime.h>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace gpu
+        {
+            // Copies between pageable host memory and the device through a ring of pinned
+            // staging buffers, on a copy stream that does not synchronize with the streams
+            // the primitives run on. Uploads return once the data is staged, so the caller can
+            // reuse its memory while the copy overlaps with the work already queued on the
+            // device. Ordering with that work is left to the caller, through the events given
+            // to each copy.
+            class CudaStagingPool
+            {
+            public:
+                CudaStagingPool(size_t chunk_size, size_t num_chunks);
+                ~CudaStagingPool();
+
+                CudaStagingPool(CudaStagingPool const&) = delete;
+                CudaStagingPool& operator=(CudaStagingPool const&) = delete;
+
+                // Queues a copy from host to device behind after_event and records done_event
+                // behind it
+                void write(void* dst,
+                           const void* src,
+                           size_t size,
+                           cudaEvent_t after_event,
+                           cudaEvent_t done_event);
+                // Copies from device to host behind after_event and waits for the copy
+                void read(void* dst, const void* src, size_t size, cudaEvent_t after_event);
+                // Queues a copy on the device behind after_events and records done_events behind
+                // it
+                void copy(void* dst,
+                          const void* src,
+                          size_t size,
+                          const std::vector<cudaEvent_t>& after_events,
+                          const std::vector<cudaEvent_t>& done_events);
+
+                // The pool shared by the GPU tensors alive in the process
+                static std::shared_ptr<CudaStagingPool> get_default();
+
+            private:
+                struct chunk
+                {
+                    void* host;
+                    // recorded after the last copy using the buffer
+                    cudaEvent_t done;
+                };
+                chunk& next_chunk();
+
+                std::mutex m_mutex;
+                cudaStream_t m_stream;
+                size_t m_chunk_size;
+                std::vector<chunk> m_chunks;
+                size_t m_next_chunk;
+            };
+        }
+    }
+}
@@ -0,0 +1,65 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+
+#include "cuda_error_check.hpp"
+#include "gpu_cuda_stream_pool.hpp"
+
+using namespace ngraph;
+
+runtime::gpu::CudaStreamPool::CudaStreamPool(size_t size, bool use_default_stream)
+{
+    if (size <= 1 && use_default_stream)
+    {
+        m_streams.push_back(nullptr);
+        return;
+    }
+    // The streams block on the default stream, so the synchronous copies in and out of the
+    // tensors stay ordered with the primitives
+    for (size_t i = 0; i < std::max<size_t>(size, 1); i++)
+    {
+        cudaStream_t stream;
+        CUDA_RT_SAFE_CALL(cudaStreamCreate(&stream));
+        m_streams.push_back(stream);
+    }
+}
+
+runtime::gpu::CudaStreamPool::~CudaStreamPool()
+{
+    for (auto event : m_events)
+    {
+        CUDA_RT_SAFE_CALL_NO_THROW(cudaEventDestroy(event));
+    }
+    for (auto stream : m_streams)
+    {
+        if (stream)
+        {
+            CUDA_RT_SAFE_CALL_NO_THROW(cudaStreamDestroy(stream));
+        }
+    }
+}
+
+cudaEvent_t runtime::gpu::CudaStreamPool::get_event(size_t index)
+{
+    while (m_events.size() <= index)
+    {
+        cudaEvent_t event;
+        CUDA_RT_SAFE_CALL(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+        m_events.push_back(event);
+    }
+    return m_events[index];
+}
@@ -0,0 +1,52 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cuda_runtime.h>
+#include <vector>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace gpu
+        {
+            // The streams the primitives of a backend context are queued on, and the events
+            // that order them. A pool of one stream uses the default stream unless
+            // use_default_stream is false, so a context without concurrency behaves as if there
+            // were no pool. Work on the default stream cannot be captured into a CUDA graph.
+            class CudaStreamPool
+            {
+            public:
+                CudaStreamPool(size_t size, bool use_default_stream = true);
+                ~CudaStreamPool();
+
+                CudaStreamPool(CudaStreamPool const&) = delete;
+                CudaStreamPool& operator=(CudaStreamPool const&) = delete;
+
+                size_t size() const { return m_streams.size(); }
+                cudaStream_t get(size_t index) const { return m_streams.at(index); }
+                // Events are created the first time they are asked for
+                cudaEvent_t get_event(size_t index);
+
+            private:
+                std::vector<cudaStream_t> m_streams;
+                std::vector<cudaEvent_t> m_events;
+            };
+        }
+    }
+}
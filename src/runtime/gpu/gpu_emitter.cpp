@@ -39,6 +39,7 @@
 #include "ngraph/ops.hpp"
 #include "ngraph/util.hpp"
 #include "op/batch_norm.hpp"
+#include "op/fused_elementwise.hpp"
 #include "op/rnn.hpp"
 #include "type_info.hpp"
 
@@ -506,6 +507,18 @@ std::string runtime::gpu::GPU_Emitter::emit_Floor(EMIT_ARGS)
         compiled_function, function_name, node, args, out);
 }
 
+std::string runtime::gpu::GPU_Emitter::emit_FusedElementwise(EMIT_ARGS)
+{
+    if (out[0].get_size() == 0)
+    {
+        return "";
+    }
+    auto fused = static_cast<const ngraph::op::gpu::FusedElementwise*>(node);
+    auto& cuda_emitter = compiled_function->get_primitive_emitter()->get_cuda_emitter();
+    auto index = cuda_emitter->build_fused_elementwise(*fused->get_body());
+    return compiled_function->add_to_runtime(index, function_name, args, out);
+}
+
 std::string runtime::gpu::GPU_Emitter::emit_Greater(EMIT_ARGS)
 {
     return emit_elementwise<ngraph::op::v1::Greater>(
@@ -19,10 +19,13 @@
 #include <cuda_runtime.h>
 #include <cudnn.h>
 
+#include "cuda_error_check.hpp"
+#include "gpu_cuda_stream_pool.hpp"
 #include "gpu_executable.hpp"
 #include "gpu_external_function.hpp"
 #include "gpu_internal_function.hpp"
 #include "gpu_primitive_emitter.hpp"
+#include "gpu_runtime_context.hpp"
 #include "gpu_tensor.hpp"
 #include "gpu_util.hpp"
 #include "ngraph/graph_util.hpp"
@@ -33,9 +36,14 @@
 using namespace ngraph;
 using namespace std;
 
-runtime::gpu::GPUExecutable::GPUExecutable(shared_ptr<Function> func, bool enable_timing)
-    : m_context(new GPUBackend::BackendContext())
-
+runtime::gpu::GPUExecutable::GPUExecutable(shared_ptr<Function> func,
+                                           bool enable_timing,
+                                           bool cuda_graph,
+                                           int device,
+                                           size_t streams)
+    : m_context(new GPUBackend::BackendContext(cuda_graph, device, streams))
+    // the stopwatches of the timed primitives synchronize, which cannot be captured
+    , m_cuda_graph(cuda_graph && !enable_timing)
 {
     if (m_compiled_function == nullptr)
     {
@@ -76,6 +84,11 @@ bool runtime::gpu::GPUExecutable::call(const vector<shared_ptr<runtime::Tensor>>
         throw runtime_error("compile() must be called before call().");
     }
 
+    // the io pointers, the intermediate tensors and the current stream of the context belong
+    // to the executable, so calls to it are serialized; separate executables have their own
+    // context and streams and run concurrently
+    std::lock_guard<std::mutex> lock(m_call_mutex);
+
     // ensure the GPURuntimeContext primitive pointers are valid
     m_context->prepare_runtime_context();
 
@@ -83,10 +96,155 @@ bool runtime::gpu::GPUExecutable::call(const vector<shared_ptr<runtime::Tensor>>
     initialize_io(m_inputs.data(), inputs);
     initialize_io(m_outputs.data(), outputs);
 
+    // the call starts behind the copies and the earlier calls using its tensors, and the
+    // copies and calls queued after it, on any stream, wait for it through the tensors
     auto ctx = m_context->m_runtime_context.get();
+    cudaStream_t stream = ctx->stream_pool->get(0);
+    for (auto& tv : inputs)
+    {
+        static_pointer_cast<runtime::gpu::GPUTensor>(tv)->wait_on_stream(stream);
+    }
+    for (auto& tv : outputs)
+    {
+        static_pointer_cast<runtime::gpu::GPUTensor>(tv)->wait_on_stream(stream);
+    }
+
+    if (m_cuda_graph)
+    {
+        call_graph(ctx);
+    }
+    else
+    {
+        m_runtime(m_inputs.data(), m_outputs.data(), ctx);
+    }
+
+    for (auto& tv : inputs)
+    {
+        static_pointer_cast<runtime::gpu::GPUTensor>(tv)->record_use(stream);
+    }
+    for (auto& tv : outputs)
+    {
+        static_pointer_cast<runtime::gpu::GPUTensor>(tv)->record_use(stream);
+    }
+
+    return true;
+}
+
+runtime::gpu::GPUExecutable::~GPUExecutable()
+{
+#if CUDART_VERSION >= 10020
+    if (m_graph_exec)
+    {
+        m_context->bind_cuda_context_to_thread();
+        CUDA_RT_SAFE_CALL_NO_THROW(
+            cudaGraphExecDestroy(static_cast<cudaGraphExec_t>(m_graph_exec)));
+    }
+#endif
+}
+
+bool runtime::gpu::GPUExecutable::is_cuda_graph_supported()
+{
+#if CUDART_VERSION >= 10020
+    return true;
+#else
+    return false;
+#endif
+}
+
+void runtime::gpu::GPUExecutable::call_graph(GPURuntimeContext* ctx)
+{
+#if CUDART_VERSION >= 10020
+    // kernel arguments are baked into the graph, so the graph is captured again, and the
+    // executable updated in place, when the call is given different tensors
+    vector<void*> io(m_inputs);
+    io.insert(io.end(), m_outputs.begin(), m_outputs.end());
+    if (m_graph_exec == nullptr || io != m_graph_io)
+    {
+        if (!capture_graph(ctx))
+        {
+            m_cuda_graph = false;
+            m_runtime(m_inputs.data(), m_outputs.data(), ctx);
+            return;
+        }
+        m_graph_io = io;
+    }
+    CUDA_RT_SAFE_CALL(cudaGraphLaunch(static_cast<cudaGraphExec_t>(m_graph_exec),
+                                      ctx->stream_pool->get(0)));
+#else
     m_runtime(m_inputs.data(), m_outputs.data(), ctx);
+#endif
+}
 
+bool runtime::gpu::GPUExecutable::capture_graph(GPURuntimeContext* ctx)
+{
+#if CUDART_VERSION >= 10020
+    set_stream(ctx, 0);
+    cudaStream_t stream = ctx->stream;
+    CUDA_RT_SAFE_CALL(cudaStreamBeginCapture(stream, cudaStreamCaptureModeThreadLocal));
+    bool captured = true;
+    try
+    {
+        m_runtime(m_inputs.data(), m_outputs.data(), ctx);
+    }
+    catch (const std::exception&)
+    {
+        // a primitive which synchronizes or copies to pageable memory cannot be captured,
+        // running it directly reports any other error
+        captured = false;
+    }
+    cudaGraph_t graph = nullptr;
+    captured = cudaStreamEndCapture(stream, &graph) == cudaSuccess && captured;
+    if (!captured)
+    {
+        // clear the error left by the invalidated capture
+        cudaGetLastError();
+        if (graph)
+        {
+            CUDA_RT_SAFE_CALL(cudaGraphDestroy(graph));
+        }
+        return false;
+    }
+
+    auto exec = static_cast<cudaGraphExec_t>(m_graph_exec);
+    if (exec)
+    {
+        cudaGraphNode_t error_node;
+        cudaGraphExecUpdateResult result;
+        if (cudaGraphExecUpdate(exec, graph, &error_node, &result) != cudaSuccess)
+        {
+            // the topology changed, instantiate the new graph instead
+            cudaGetLastError();
+            m_graph_exec = nullptr;
+            CUDA_RT_SAFE_CALL(cudaGraphExecDestroy(exec));
+            exec = nullptr;
+        }
+    }
+    if (exec == nullptr)
+    {
+        CUDA_RT_SAFE_CALL(cudaGraphInstantiate(&exec, graph, nullptr, nullptr, 0));
+    }
+    CUDA_RT_SAFE_CALL(cudaGraphDestroy(graph));
+    m_graph_exec = exec;
     return true;
+#else
+    return false;
+#endif
+}
+
+runtime::MemoryFootprint runtime::gpu::GPUExecutable::get_memory_footprint() const
+{
+    // The constants are uploaded to the argspace along with the kernel arguments
+    MemoryFootprint footprint = Executable::get_memory_footprint();
+    const GPUMemoryManager& manager = m_context->m_primitive_emitter->get_memory_manager();
+    size_t argspace = manager.get_argspace_size();
+    footprint.workspace_bytes = manager.get_workspace_size() +
+                                (argspace > footprint.constant_bytes
+                                     ? argspace - footprint.constant_bytes
+                                     : 0);
+    footprint.activation_bytes_per_context = manager.get_tensor_pool_size();
+    footprint.contexts = 1;
+    footprint.device_memory = true;
+    return footprint;
 }
 
 vector<runtime::PerformanceCounter> runtime::gpu::GPUExecutable::get_performance_data() const
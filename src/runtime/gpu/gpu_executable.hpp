@@ -18,6 +18,7 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 
 #include "gpu_backend.hpp"
 #include "gpu_backend_visibility.hpp"
@@ -40,15 +41,38 @@ namespace ngraph
             class GPUExecutable : public Executable
             {
             public:
-                GPUExecutable(std::shared_ptr<Function> func, bool enable_timing);
+                GPUExecutable(std::shared_ptr<Function> func,
+                              bool enable_timing,
+                              bool cuda_graph = false,
+                              int device = 0,
+                              size_t streams = 1);
+                ~GPUExecutable() override;
 
+                /// \brief Runs the executable. The io pointers, the intermediate tensors and
+                ///        the streams belong to the executable, so concurrent calls to the same
+                ///        executable run one after the other. Executables compiled from
+                ///        different functions, for instance clones, run concurrently.
                 bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                           const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
 
                 // void remove_compiled_function(std::shared_ptr<Function> func) override;
                 std::vector<PerformanceCounter> get_performance_data() const override;
+                /// \brief Reports device memory: the constants copied to the device, the tensor
+                ///        pools and the workspaces and kernel arguments
+                MemoryFootprint get_memory_footprint() const override;
+
+                /// \brief Whether the CUDA runtime the backend is built with can capture and
+                ///        update graphs
+                static bool is_cuda_graph_supported();
 
             private:
+                /// \brief Replays the graph captured for the current io pointers, capturing
+                ///        it first if the pointers changed. Falls back to running the
+                ///        primitives directly, for this and the following calls, if one of them
+                ///        cannot be captured.
+                void call_graph(GPURuntimeContext* ctx);
+                bool capture_graph(GPURuntimeContext* ctx);
+
                 std::shared_ptr<GPUCompiledFunction> m_compiled_function;
                 EntryPoint m_runtime;
                 std::vector<void*> m_inputs;
@@ -64,6 +88,13 @@ namespace ngraph
                                   const std::vector<std::shared_ptr<runtime::Tensor>>& source);
 
                 std::shared_ptr<GPUBackend::BackendContext> m_context;
+                std::mutex m_call_mutex;
+
+                bool m_cuda_graph;
+                // the graph executable, as a cudaGraphExec_t, and the io pointers it was captured
+                // with
+                void* m_graph_exec = nullptr;
+                std::vector<void*> m_graph_io;
             };
         }
     }
@@ -475,8 +475,11 @@ void runtime::gpu::GPUExternalFunction::emit_functions()
                 }
             }
 
+            auto& primitive_emitter = m_shared_context->m_primitive_emitter;
+            size_t op_index = 0;
             for (shared_ptr<Node> node : m_function_ordered_ops.at(current_function))
             {
+                size_t index = op_index++;
                 vector<GPUTensorWrapper> in;
                 vector<string> node_input_names;
                 vector<string> node_output_names;
@@ -511,7 +514,9 @@ void runtime::gpu::GPUExternalFunction::emit_functions()
                 auto it = m_node_function_map.find(node.get());
                 if (it == m_node_function_map.end())
                 {
+                    primitive_emitter->set_current_op(current_function->get_name(), index);
                     m_writer << emit_op(this, current_function->get_name(), node.get(), in, out);
+                    primitive_emitter->clear_current_op();
                 }
                 else
                 {
@@ -24,14 +24,17 @@
 #include <string>
 #include <tuple>
 
+#include "cuda_error_check.hpp"
 #include "gpu_backend.hpp"
 #include "gpu_call_frame.hpp"
+#include "gpu_cuda_stream_pool.hpp"
 #include "gpu_emitter.hpp"
 #include "gpu_internal_function.hpp"
 #include "gpu_invoke.hpp"
 #include "gpu_kernel_emitters.hpp"
 #include "gpu_runtime_constructor.hpp"
 #include "gpu_runtime_context.hpp"
+#include "gpu_stream_schedule.hpp"
 #include "gpu_tensor_wrapper.hpp"
 #include "gpu_util.hpp"
 #include "ngraph/code_writer.hpp"
@@ -222,6 +225,83 @@ std::string runtime::gpu::GPUInternalFunction::add_call_to_runtime(
     return writer.get_code();
 }
 
+std::string
+    runtime::gpu::GPUInternalFunction::add_stream_fork(const std::string& function_name,
+                                                       const GPUStreamSchedule& schedule)
+{
+    size_t num_streams = schedule.get_num_streams();
+    m_runtime_constructor->add(function_name, [num_streams](GPUCallFrame&, GPURuntimeContext* ctx) {
+        runtime::gpu::set_stream(ctx, 0);
+        cudaEvent_t start = ctx->stream_pool->get_event(0);
+        CUDA_RT_SAFE_CALL(cudaEventRecord(start, ctx->stream));
+        for (size_t s = 1; s < num_streams; s++)
+        {
+            CUDA_RT_SAFE_CALL(cudaStreamWaitEvent(ctx->stream_pool->get(s), start, 0));
+        }
+    });
+    return "\n// fork " + std::to_string(num_streams) + " streams\n";
+}
+
+std::string
+    runtime::gpu::GPUInternalFunction::add_stream_join(const std::string& function_name,
+                                                       const GPUStreamSchedule& schedule)
+{
+    size_t num_streams = schedule.get_num_streams();
+    m_runtime_constructor->add(function_name, [num_streams](GPUCallFrame&, GPURuntimeContext* ctx) {
+        runtime::gpu::set_stream(ctx, 0);
+        for (size_t s = 1; s < num_streams; s++)
+        {
+            cudaEvent_t end = ctx->stream_pool->get_event(s);
+            CUDA_RT_SAFE_CALL(cudaEventRecord(end, ctx->stream_pool->get(s)));
+            CUDA_RT_SAFE_CALL(cudaStreamWaitEvent(ctx->stream, end, 0));
+        }
+    });
+    return "\n// join " + std::to_string(num_streams) + " streams\n";
+}
+
+std::string
+    runtime::gpu::GPUInternalFunction::add_stream_wait(const std::string& function_name,
+                                                       const GPUStreamSchedule& schedule,
+                                                       const Node* node)
+{
+    const GPUStreamSchedule::Step& step = schedule.get_step(node);
+    size_t stream = step.stream;
+    std::vector<size_t> events = step.wait_events;
+    m_runtime_constructor->add(function_name,
+                               [stream, events](GPUCallFrame&, GPURuntimeContext* ctx) {
+                                   runtime::gpu::set_stream(ctx, stream);
+                                   for (size_t event : events)
+                                   {
+                                       CUDA_RT_SAFE_CALL(cudaStreamWaitEvent(
+                                           ctx->stream, ctx->stream_pool->get_event(event), 0));
+                                   }
+                               });
+    std::stringstream ss;
+    ss << "// stream " << stream;
+    if (!events.empty())
+    {
+        ss << ", wait events " << join(events);
+    }
+    ss << "\n";
+    return ss.str();
+}
+
+std::string
+    runtime::gpu::GPUInternalFunction::add_stream_record(const std::string& function_name,
+                                                         const GPUStreamSchedule& schedule,
+                                                         const Node* node)
+{
+    size_t event = schedule.get_step(node).record_event;
+    if (event == GPUStreamSchedule::no_event)
+    {
+        return "";
+    }
+    m_runtime_constructor->add(function_name, [event](GPUCallFrame&, GPURuntimeContext* ctx) {
+        CUDA_RT_SAFE_CALL(cudaEventRecord(ctx->stream_pool->get_event(event), ctx->stream));
+    });
+    return "// record event " + std::to_string(event) + "\n";
+}
+
 std::string runtime::gpu::GPUInternalFunction::compose_manifest(
     size_t primitive_index,
     const std::vector<runtime::gpu::GPUTensorWrapper>& args,
@@ -329,6 +409,19 @@ void runtime::gpu::GPUInternalFunction::build_functions()
             }
         }
 
+        // Only the ops of the function being compiled are spread over the streams, the
+        // functions it calls run on the stream of the op calling them
+        unique_ptr<GPUStreamSchedule> schedule;
+        size_t num_streams = m_shared_context->m_runtime_context->stream_pool->size();
+        if (current_function == m_function && num_streams > 1)
+        {
+            schedule.reset(
+                new GPUStreamSchedule(m_function_ordered_ops.at(current_function), num_streams));
+            m_manifest << add_stream_fork(current_function->get_name(), *schedule);
+        }
+
+        auto& primitive_emitter = m_shared_context->m_primitive_emitter;
+        size_t op_index = 0;
         for (shared_ptr<Node> node : m_function_ordered_ops.at(current_function))
         {
             vector<string> node_input_names;
@@ -365,9 +458,23 @@ void runtime::gpu::GPUInternalFunction::build_functions()
                 // emit_debug_function_entry(node.get());
             }
 
+            bool on_stream = schedule && GPUStreamSchedule::is_scheduled(node.get());
+            if (on_stream)
+            {
+                m_manifest << add_stream_wait(current_function->get_name(), *schedule, node.get());
+            }
+
             // Emit operation body
             // m_writer << emit_op(this, node.get(), in, out);
+            primitive_emitter->set_current_op(current_function->get_name(), op_index++);
             m_manifest << emit_op(this, current_function->get_name(), node.get(), in, out);
+            primitive_emitter->clear_current_op();
+
+            if (on_stream)
+            {
+                m_manifest << add_stream_record(
+                    current_function->get_name(), *schedule, node.get());
+            }
 
             // Emit operation epilogue
             // if (!node->is_parameter() && !node->is_constant())
@@ -375,6 +482,11 @@ void runtime::gpu::GPUInternalFunction::build_functions()
             //     emit_debug_function_exit(node.get());
             // }
         }
+
+        if (schedule)
+        {
+            m_manifest << add_stream_join(current_function->get_name(), *schedule);
+        }
     }
 }
 
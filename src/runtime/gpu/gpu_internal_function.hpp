@@ -42,6 +42,7 @@ namespace ngraph
         {
             class GPU_Emitter;
             class GPURuntimeConstructor;
+            class GPUStreamSchedule;
             struct GPURuntimeContext;
 
             class GPUInternalFunction : public GPUCompiledFunction
@@ -73,6 +74,18 @@ namespace ngraph
             private:
                 void build_functions();
                 std::string emit_op(EMIT_ARGS);
+                // Steps ordering the ops of a function scheduled on several streams, see
+                // GPUStreamSchedule
+                std::string add_stream_fork(const std::string& function_name,
+                                            const GPUStreamSchedule& schedule);
+                std::string add_stream_join(const std::string& function_name,
+                                            const GPUStreamSchedule& schedule);
+                std::string add_stream_wait(const std::string& function_name,
+                                            const GPUStreamSchedule& schedule,
+                                            const Node* node);
+                std::string add_stream_record(const std::string& function_name,
+                                              const GPUStreamSchedule& schedule,
+                                              const Node* node);
                 std::string
                     compose_manifest(size_t primitive_index,
                                      const std::vector<runtime::gpu::GPUTensorWrapper>& args,
@@ -14,10 +14,13 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <cstring>
 
+#include "gpu_cuda_stream_pool.hpp"
 #include "gpu_memory_manager.hpp"
 #include "gpu_primitive_emitter.hpp"
+#include "gpu_runtime_context.hpp"
 #include "gpu_util.hpp"
 
 using namespace ngraph;
@@ -28,24 +31,47 @@ runtime::gpu::GPUMemoryManager::GPUMemoryManager(GPUPrimitiveEmitter* emitter)
     : m_buffer_offset(0)
     , m_buffered_mem(initial_buffer_size, 0)
     , m_workspace_manager(new pass::MemoryManager(runtime::gpu::GPUMemoryManager::alignment))
-    , m_argspace_mem(1, {nullptr, 0})
-    , m_workspace_mem(1, {nullptr, 0})
+    , m_argspace_mem(1, {nullptr, 0, 0})
+    , m_workspace_mem(1, {nullptr, 0, 0})
     , m_primitive_emitter(emitter)
+    , m_current_op(0)
 {
 }
 
 size_t runtime::gpu::GPUMemoryManager::get_allocation_size() const
 {
-    size_t allocation_size = 0;
-    for (auto const& alloc : m_argspace_mem)
-    {
-        allocation_size += alloc.size;
-    }
-    for (auto const& alloc : m_workspace_mem)
+    return get_argspace_size() + get_workspace_size() + get_tensor_pool_size();
+}
+
+size_t runtime::gpu::GPUMemoryManager::get_argspace_size() const
+{
+    return get_total_size(m_argspace_mem);
+}
+
+size_t runtime::gpu::GPUMemoryManager::get_workspace_size() const
+{
+    return get_total_size(m_workspace_mem);
+}
+
+size_t runtime::gpu::GPUMemoryManager::get_tensor_pool_size() const
+{
+    return get_total_size(m_tensor_pool_mem);
+}
+
+size_t runtime::gpu::GPUMemoryManager::get_total_size(const std::list<allocation>& allocations)
+{
+    size_t size = 0;
+    for (auto const& alloc : allocations)
     {
-        allocation_size += alloc.size;
+        size += alloc.size;
     }
-    return allocation_size;
+    return size;
+}
+
+size_t runtime::gpu::GPUMemoryManager::get_num_streams() const
+{
+    GPURuntimeContext* ctx = m_primitive_emitter->get_runtime_context();
+    return (ctx && ctx->stream_pool) ? ctx->stream_pool->size() : 1;
 }
 
 runtime::gpu::GPUMemoryManager::~GPUMemoryManager()
@@ -58,6 +84,10 @@ runtime::gpu::GPUMemoryManager::~GPUMemoryManager()
     {
         runtime::gpu::free_gpu_buffer(alloc.ptr);
     }
+    for (auto& alloc : m_tensor_pool_mem)
+    {
+        runtime::gpu::free_gpu_buffer(alloc.ptr);
+    }
 }
 
 void runtime::gpu::GPUMemoryManager::allocate()
@@ -79,7 +109,7 @@ void runtime::gpu::GPUMemoryManager::allocate()
         runtime::gpu::cuda_memcpyHtD(
             m_argspace_mem.back().ptr, m_buffered_mem.data(), m_buffer_offset);
         // add an empty node to the end of the list and zero offset
-        m_argspace_mem.push_back({nullptr, 0});
+        m_argspace_mem.push_back({nullptr, 0, 0});
         m_buffered_mem.clear();
         m_buffered_mem.resize(initial_buffer_size, 0);
         m_buffer_offset = 0;
@@ -88,12 +118,150 @@ void runtime::gpu::GPUMemoryManager::allocate()
     auto workspace_size = m_workspace_manager->max_allocated();
     if (workspace_size)
     {
-        m_workspace_mem.back().ptr = runtime::gpu::create_gpu_buffer(workspace_size);
-        m_workspace_mem.back().size = workspace_size;
-        m_workspace_mem.push_back({nullptr, 0});
+        // primitives running concurrently on different streams each get their own copy of
+        // the workspace
+        size_t stride = ngraph::pass::MemoryManager::align(
+            workspace_size, runtime::gpu::GPUMemoryManager::alignment);
+        size_t size = stride * get_num_streams();
+        m_workspace_mem.back().ptr = runtime::gpu::create_gpu_buffer(size);
+        m_workspace_mem.back().size = size;
+        m_workspace_mem.back().stride = stride;
+        m_workspace_mem.push_back({nullptr, 0, 0});
         m_workspace_manager.reset(
             new pass::MemoryManager(runtime::gpu::GPUMemoryManager::alignment));
     }
+
+    // the pools are sized once the workspaces of their ops are placed
+    for (auto& plan : m_pool_plans)
+    {
+        plan_tensor_pool(*plan.second);
+    }
+    m_pool_plans.clear();
+    m_current_plan.reset();
+
+    for (auto& alloc : m_tensor_pool_mem)
+    {
+        if (alloc.ptr == nullptr)
+        {
+            alloc.ptr = runtime::gpu::create_gpu_buffer(alloc.size);
+        }
+    }
+}
+
+void runtime::gpu::GPUMemoryManager::plan_tensor_pool(tensor_pool_plan& plan)
+{
+    auto align = [](size_t offset) {
+        return ngraph::pass::MemoryManager::align(offset,
+                                                  runtime::gpu::GPUMemoryManager::alignment);
+    };
+
+    // the largest workspaces first, each at the lowest offset free while its ops run
+    std::vector<std::shared_ptr<pooled_workspace>> workspaces = plan.workspaces;
+    std::stable_sort(workspaces.begin(),
+                     workspaces.end(),
+                     [](const std::shared_ptr<pooled_workspace>& a,
+                        const std::shared_ptr<pooled_workspace>& b) { return a->size > b->size; });
+    size_t pool_size = plan.pool->size;
+    std::vector<std::shared_ptr<pooled_workspace>> placed;
+    for (auto& workspace : workspaces)
+    {
+        if (workspace->exclusive)
+        {
+            continue;
+        }
+        std::vector<std::pair<size_t, size_t>> busy;
+        for (size_t op : workspace->ops)
+        {
+            if (op < plan.live_ranges.size())
+            {
+                busy.insert(busy.end(), plan.live_ranges[op].begin(), plan.live_ranges[op].end());
+            }
+        }
+        for (auto& other : placed)
+        {
+            bool concurrent = std::any_of(other->ops.begin(), other->ops.end(), [&](size_t op) {
+                return workspace->ops.count(op) != 0;
+            });
+            if (concurrent)
+            {
+                busy.push_back({other->offset, other->offset + other->size});
+            }
+        }
+        std::sort(busy.begin(), busy.end());
+        size_t offset = 0;
+        for (auto& range : busy)
+        {
+            if (offset + workspace->size <= range.first)
+            {
+                break;
+            }
+            offset = std::max(offset, align(range.second));
+        }
+        workspace->offset = offset;
+        pool_size = std::max(pool_size, offset + workspace->size);
+        placed.push_back(workspace);
+    }
+    for (auto& workspace : workspaces)
+    {
+        if (workspace->exclusive)
+        {
+            workspace->offset = align(pool_size);
+            pool_size = workspace->offset + workspace->size;
+        }
+    }
+    plan.pool->size = align(pool_size);
+    plan.allocated = true;
+}
+
+void runtime::gpu::GPUMemoryManager::set_current_op(const std::string& function, size_t index)
+{
+    auto it = m_pool_plans.find(function);
+    m_current_plan = it == m_pool_plans.end() ? nullptr : it->second;
+    m_current_op = index;
+    m_op_workspaces.clear();
+}
+
+void runtime::gpu::GPUMemoryManager::clear_current_op()
+{
+    m_current_plan.reset();
+    m_op_workspaces.clear();
+}
+
+void runtime::gpu::GPUMemoryManager::cache_workspaces(const std::string& hash)
+{
+    if (!m_op_workspaces.empty())
+    {
+        auto& workspaces = m_primitive_workspaces[hash];
+        workspaces.insert(workspaces.end(), m_op_workspaces.begin(), m_op_workspaces.end());
+    }
+}
+
+void runtime::gpu::GPUMemoryManager::reuse_workspaces(const std::string& hash)
+{
+    auto it = m_primitive_workspaces.find(hash);
+    if (it == m_primitive_workspaces.end())
+    {
+        return;
+    }
+    for (auto& use : it->second)
+    {
+        auto& plan = use.first;
+        auto& workspace = use.second;
+        // once allocated, the pool of an earlier compile is not in use by this one
+        if (plan->allocated)
+        {
+            continue;
+        }
+        if (plan == m_current_plan)
+        {
+            workspace->ops.insert(m_current_op);
+            m_op_workspaces.push_back(use);
+        }
+        else
+        {
+            workspace->exclusive = true;
+        }
+    }
 }
 
 size_t runtime::gpu::GPUMemoryManager::queue_for_transfer(const void* data, size_t size)
@@ -160,6 +328,34 @@ size_t runtime::gpu::GPUAllocator::reserve_workspace(size_t size, bool zero_init
         return m_manager->m_primitive_emitter->insert([]() { return nullptr; });
     }
 
+    GPURuntimeContext* ctx = m_manager->m_primitive_emitter->get_runtime_context();
+    if (auto plan = m_manager->m_current_plan)
+    {
+        auto workspace = std::make_shared<GPUMemoryManager::pooled_workspace>();
+        workspace->size = size;
+        workspace->ops.insert(m_manager->m_current_op);
+        workspace->exclusive = false;
+        workspace->offset = 0;
+        plan->workspaces.push_back(workspace);
+        m_manager->m_op_workspaces.push_back({plan, workspace});
+        gpu::memory_primitive mem_primitive = [=]() {
+            void* pool = (*plan->pool).ptr;
+            if (pool == nullptr)
+            {
+                throw std::runtime_error("An attempt was made to use unallocated device memory.");
+            }
+            auto workspace_ptr =
+                static_cast<void*>(static_cast<uint8_t*>(pool) + workspace->offset);
+            if (zero_initialize)
+            {
+                runtime::gpu::cuda_memset_async(
+                    workspace_ptr, 0, size, ctx ? ctx->stream : nullptr);
+            }
+            return workspace_ptr;
+        };
+        return m_manager->m_primitive_emitter->insert(std::move(mem_primitive));
+    }
+
     size_t offset = m_manager->m_workspace_manager->allocate(size);
     m_active.push(offset);
     auto local = std::prev(m_manager->m_workspace_mem.end());
@@ -171,17 +367,52 @@ size_t runtime::gpu::GPUAllocator::reserve_workspace(size_t size, bool zero_init
         {
             throw std::runtime_error("An attempt was made to use unallocated device memory.");
         }
-        auto gpu_mem = static_cast<uint8_t*>(workspace);
+        size_t stream_index = ctx ? ctx->stream_index : 0;
+        auto gpu_mem = static_cast<uint8_t*>(workspace) + stream_index * (*local).stride;
         auto workspace_ptr = static_cast<void*>(gpu_mem + offset);
         if (zero_initialize)
         {
-            runtime::gpu::cuda_memset(workspace_ptr, 0, size);
+            runtime::gpu::cuda_memset_async(
+                workspace_ptr, 0, size, ctx ? ctx->stream : nullptr);
         }
         return workspace_ptr;
     };
     return m_manager->m_primitive_emitter->insert(std::move(mem_primitive));
 }
 
+size_t runtime::gpu::GPUAllocator::reserve_tensor_pool(size_t size)
+{
+    m_manager->m_tensor_pool_mem.push_back({nullptr, size, 0});
+    auto local = std::prev(m_manager->m_tensor_pool_mem.end());
+    gpu::memory_primitive mem_primitive = [=]() {
+        void* pool = (*local).ptr;
+        if (pool == nullptr)
+        {
+            throw std::runtime_error("An attempt was made to use unallocated device memory.");
+        }
+        return pool;
+    };
+    return m_manager->m_primitive_emitter->insert(std::move(mem_primitive));
+}
+
+size_t runtime::gpu::GPUAllocator::reserve_tensor_pool(
+    size_t size,
+    const std::string& function,
+    std::vector<std::vector<std::pair<size_t, size_t>>> live_ranges)
+{
+    size_t index = reserve_tensor_pool(size);
+    // ops on different streams may run at once
+    if (m_manager->get_num_streams() == 1)
+    {
+        auto plan = std::make_shared<GPUMemoryManager::tensor_pool_plan>();
+        plan->pool = std::prev(m_manager->m_tensor_pool_mem.end());
+        plan->live_ranges = std::move(live_ranges);
+        plan->allocated = false;
+        m_manager->m_pool_plans[function] = plan;
+    }
+    return index;
+}
+
 void runtime::gpu::GPUAllocator::close()
 {
     while (!m_active.empty())
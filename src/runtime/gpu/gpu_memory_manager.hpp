@@ -18,7 +18,11 @@
 
 #include <list>
 #include <memory>
+#include <set>
 #include <stack>
+#include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "ngraph/pass/memory_layout.hpp"
@@ -48,6 +52,18 @@ namespace ngraph
                 }
                 size_t reserve_argspace(const void* data, size_t size);
                 size_t reserve_workspace(size_t size, bool zero_initialize = true);
+                // Memory for the intermediate tensors of a function. Unlike workspace, which
+                // is scratch memory private to a primitive and replicated for every stream of
+                // the runtime context, the pool is shared by the primitives of all streams.
+                size_t reserve_tensor_pool(size_t size);
+                // As above, for the function `function` whose op i uses the byte ranges
+                // live_ranges[i] of the pool. On a single stream, the workspaces reserved for
+                // its ops are placed in the pool where it is free while they run, rather than
+                // in workspace memory of their own.
+                size_t reserve_tensor_pool(
+                    size_t size,
+                    const std::string& function,
+                    std::vector<std::vector<std::pair<size_t, size_t>>> live_ranges);
 
                 void close();
 
@@ -66,8 +82,22 @@ namespace ngraph
 
                 void allocate();
                 size_t get_allocation_size() const;
+                // kernel arguments and constants
+                size_t get_argspace_size() const;
+                // workspaces not placed in a tensor pool, one copy per stream
+                size_t get_workspace_size() const;
+                size_t get_tensor_pool_size() const;
                 GPUAllocator build_allocator() { return GPUAllocator(this); }
 
+                // The workspaces reserved until clear_current_op() are used by op `index` of
+                // `function`
+                void set_current_op(const std::string& function, size_t index);
+                void clear_current_op();
+                // A primitive was cached under `hash`, or is reused from the cache, by the
+                // current op: every op using it uses its workspaces
+                void cache_workspaces(const std::string& hash);
+                void reuse_workspaces(const std::string& hash);
+
             private:
                 GPUMemoryManager(GPUPrimitiveEmitter* emitter);
                 size_t queue_for_transfer(const void* data, size_t size);
@@ -81,11 +111,48 @@ namespace ngraph
                 {
                     void* ptr;
                     size_t size;
+                    // distance between the copies of a workspace for consecutive streams
+                    size_t stride;
+                };
+
+                // A workspace placed in the tensor pool of a function
+                struct pooled_workspace
+                {
+                    size_t size;
+                    // the ops of the function running the primitives that use it
+                    std::set<size_t> ops;
+                    // used elsewhere as well, so it gets space no tensor shares
+                    bool exclusive;
+                    size_t offset;
                 };
 
+                struct tensor_pool_plan
+                {
+                    std::list<allocation>::iterator pool;
+                    std::vector<std::vector<std::pair<size_t, size_t>>> live_ranges;
+                    std::vector<std::shared_ptr<pooled_workspace>> workspaces;
+                    bool allocated;
+                };
+
+                using pooled_workspace_use = std::pair<std::shared_ptr<tensor_pool_plan>,
+                                                       std::shared_ptr<pooled_workspace>>;
+                using pooled_workspaces = std::vector<pooled_workspace_use>;
+
+                size_t get_num_streams() const;
+                static size_t get_total_size(const std::list<allocation>& allocations);
+                void plan_tensor_pool(tensor_pool_plan& plan);
+
                 std::list<allocation> m_argspace_mem;
                 std::list<allocation> m_workspace_mem;
+                std::list<allocation> m_tensor_pool_mem;
                 GPUPrimitiveEmitter* m_primitive_emitter;
+
+                std::unordered_map<std::string, std::shared_ptr<tensor_pool_plan>> m_pool_plans;
+                std::shared_ptr<tensor_pool_plan> m_current_plan;
+                size_t m_current_op;
+                // pooled workspaces used by the current op
+                pooled_workspaces m_op_workspaces;
+                std::unordered_map<std::string, pooled_workspaces> m_primitive_workspaces;
             };
         }
     }
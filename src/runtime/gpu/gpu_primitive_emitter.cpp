@@ -22,7 +22,8 @@ using namespace ngraph;
 using namespace ngraph::runtime::gpu;
 
 GPUPrimitiveEmitter::GPUPrimitiveEmitter()
-    : m_memory_manager(this)
+    : m_ctx(nullptr)
+    , m_memory_manager(this)
     , m_host_parameters(new GPUHostParameters)
     , m_host_emitter(new HostEmitter(this, nullptr))
     , m_cuda_emitter(new CUDAEmitter(this, nullptr, nullptr))
@@ -32,7 +33,8 @@ GPUPrimitiveEmitter::GPUPrimitiveEmitter()
 }
 
 GPUPrimitiveEmitter::GPUPrimitiveEmitter(const std::unique_ptr<GPURuntimeContext>& ctx)
-    : m_memory_manager(this)
+    : m_ctx(ctx.get())
+    , m_memory_manager(this)
     , m_host_parameters(new GPUHostParameters)
     , m_host_emitter(new HostEmitter(this, ctx.get()))
     , m_cuda_emitter(new CUDAEmitter(this, ctx.get(), this->m_host_parameters))
@@ -74,6 +76,7 @@ size_t GPUPrimitiveEmitter::lookup(const std::string& hash)
     auto it = m_primitive_map.find(hash);
     if (it != m_primitive_map.end())
     {
+        m_memory_manager.reuse_workspaces(hash);
         return it->second;
     }
     return std::numeric_limits<size_t>::max();
@@ -81,6 +84,7 @@ size_t GPUPrimitiveEmitter::lookup(const std::string& hash)
 void GPUPrimitiveEmitter::cache(const std::string& hash, const size_t& index)
 {
     m_primitive_map.insert({hash, index});
+    m_memory_manager.cache_workspaces(hash);
 }
 
 size_t GPUPrimitiveEmitter::register_primitive(std::unique_ptr<gpu::primitive>& f, std::string hash)
@@ -50,8 +50,17 @@ namespace ngraph
                 void cache(const std::string& hash, const size_t& index);
                 GPUAllocator get_memory_allocator() { return m_memory_manager.build_allocator(); }
                 void allocate_primitive_memory() { m_memory_manager.allocate(); }
+                // Emitting op `index` of `function`, whose workspaces can then share its
+                // tensor pool
+                void set_current_op(const std::string& function, size_t index)
+                {
+                    m_memory_manager.set_current_op(function, index);
+                }
+                void clear_current_op() { m_memory_manager.clear_current_op(); }
                 size_t sizeof_device_allocation() { return m_memory_manager.get_allocation_size(); }
+                const GPUMemoryManager& get_memory_manager() const { return m_memory_manager; }
                 GPUKernelArgs add_kernel_args() { return GPUKernelArgs(m_host_parameters); }
+                GPURuntimeContext* get_runtime_context() const { return m_ctx; }
                 size_t register_primitive(std::unique_ptr<gpu::primitive>&, std::string);
 
             private:
@@ -59,6 +68,7 @@ namespace ngraph
                 std::vector<gpu::memory_primitive> m_gpu_mem_primitives;
                 std::unordered_map<std::string, size_t> m_primitive_map;
                 std::vector<std::unique_ptr<gpu::primitive>> m_managed_primitives;
+                GPURuntimeContext* m_ctx;
                 GPUMemoryManager m_memory_manager;
                 std::shared_ptr<GPUHostParameters> m_host_parameters;
                 std::unique_ptr<HostEmitter> m_host_emitter;
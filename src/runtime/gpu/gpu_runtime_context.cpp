@@ -14,6 +14,8 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include "cuda_error_check.hpp"
+#include "gpu_cuda_stream_pool.hpp"
 #include "gpu_runtime_context.hpp"
 #include "gpu_util.hpp"
 
@@ -36,3 +38,15 @@ extern "C" size_t runtime::gpu::us_stopwatch(GPURuntimeContext* ctx, size_t idx)
 {
     return ctx->stopwatch_pool->get(idx).get_total_microseconds();
 }
+
+extern "C" void runtime::gpu::set_stream(GPURuntimeContext* ctx, size_t idx)
+{
+    cudaStream_t stream = ctx->stream_pool->get(idx);
+    ctx->stream_index = idx;
+    if (stream != ctx->stream)
+    {
+        ctx->stream = stream;
+        CUDNN_SAFE_CALL(cudnnSetStream(*ctx->cudnn_handle, stream));
+        CUBLAS_SAFE_CALL(cublasSetStream(*ctx->cublas_handle, stream));
+    }
+}
@@ -32,6 +32,7 @@ namespace ngraph
         namespace gpu
         {
             class StopWatchPool;
+            class CudaStreamPool;
 
             using primitive = std::function<void(void**, void**)>;
             using memory_primitive = std::function<void*(void)>;
@@ -51,12 +52,19 @@ namespace ngraph
                 // native compiler and clang. If all of the emitted CUDA ops are refactored
                 // to use the GPUPrimitiveEmitter, the above pointer can be removed. It is left now
                 // for backward compatability.
+                // The stream the primitives are queued on, selected with set_stream. The
+                // workspace of a primitive is offset by stream_index so that primitives running
+                // concurrently on different streams do not share scratch memory.
+                cudaStream_t stream = nullptr;
+                size_t stream_index = 0;
+                CudaStreamPool* stream_pool = nullptr;
             };
 
             void start_stopwatch(GPURuntimeContext* ctx, size_t idx);
             void stop_stopwatch(GPURuntimeContext* ctx, size_t idx);
             size_t count_stopwatch(GPURuntimeContext* ctx, size_t idx);
             size_t us_stopwatch(GPURuntimeContext* ctx, size_t idx);
+            void set_stream(GPURuntimeContext* ctx, size_t idx);
             }
         }
     }
@@ -0,0 +1,123 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+
+#include "gpu_stream_schedule.hpp"
+#include "ngraph/op/util/op_annotations.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+constexpr size_t runtime::gpu::GPUStreamSchedule::no_event;
+
+runtime::gpu::GPUStreamSchedule::GPUStreamSchedule(const NodeVector& ops, size_t num_streams)
+    : m_num_streams(max<size_t>(num_streams, 1))
+    , m_num_events(m_num_streams)
+    , m_stream_sizes(m_num_streams, 0)
+{
+    // 1-based position of every op on its stream, and the last op of every stream
+    unordered_map<const Node*, size_t> positions;
+    vector<const Node*> tails(m_num_streams, nullptr);
+    // waited[s][t] is the position on stream t that stream s is already ordered after
+    vector<vector<size_t>> waited(m_num_streams, vector<size_t>(m_num_streams, 0));
+
+    for (const shared_ptr<Node>& op : ops)
+    {
+        const Node* node = op.get();
+        if (!is_scheduled(node))
+        {
+            continue;
+        }
+
+        vector<const Node*> dependencies;
+        for (Input<Node> input : op->inputs())
+        {
+            const Node* producer = input.get_source_output().get_node();
+            if (m_steps.count(producer) != 0)
+            {
+                dependencies.push_back(producer);
+            }
+        }
+        // an op which overwrites one of its inputs must also wait for the other readers of it
+        if (auto op_annotations = op->get_op_annotations())
+        {
+            for (auto oi_pair : op_annotations->get_in_place_oi_pairs())
+            {
+                if (!oi_pair.destructive)
+                {
+                    continue;
+                }
+                for (auto reader : op->input_value(oi_pair.input).get_target_inputs())
+                {
+                    const Node* reader_node = reader.get_node();
+                    if (reader_node != node && m_steps.count(reader_node) != 0)
+                    {
+                        dependencies.push_back(reader_node);
+                    }
+                }
+            }
+        }
+
+        Step step;
+        auto follows =
+            find_if(dependencies.begin(), dependencies.end(), [&](const Node* dependency) {
+                return tails[m_steps.at(dependency).stream] == dependency;
+            });
+        if (follows != dependencies.end())
+        {
+            step.stream = m_steps.at(*follows).stream;
+        }
+        else
+        {
+            step.stream = static_cast<size_t>(
+                min_element(m_stream_sizes.begin(), m_stream_sizes.end()) -
+                m_stream_sizes.begin());
+        }
+
+        for (const Node* dependency : dependencies)
+        {
+            Step& producer_step = m_steps.at(dependency);
+            size_t position = positions.at(dependency);
+            size_t& ordered_after = waited[step.stream][producer_step.stream];
+            if (producer_step.stream == step.stream || ordered_after >= position)
+            {
+                continue;
+            }
+            ordered_after = position;
+            if (producer_step.record_event == no_event)
+            {
+                producer_step.record_event = m_num_events++;
+            }
+            step.wait_events.push_back(producer_step.record_event);
+        }
+
+        positions[node] = ++m_stream_sizes[step.stream];
+        tails[step.stream] = node;
+        m_steps[node] = step;
+    }
+}
+
+size_t runtime::gpu::GPUStreamSchedule::get_num_used_streams() const
+{
+    return static_cast<size_t>(
+        count_if(m_stream_sizes.begin(), m_stream_sizes.end(), [](size_t s) { return s > 0; }));
+}
+
+bool runtime::gpu::GPUStreamSchedule::is_scheduled(const Node* node)
+{
+    return !node->is_parameter() && !node->is_constant();
+}
@@ -0,0 +1,75 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+#include "ngraph/node.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace gpu
+        {
+            // Assigns the ops of a function, in their execution order, to streams so that
+            // independent branches of the graph run concurrently. An op stays on the stream of
+            // one of its producers when it would immediately follow it there, and otherwise
+            // starts on the least loaded stream. Dependencies between streams are expressed
+            // with events: the producer records one after it is queued and the consumer's
+            // stream waits on it before the consumer is queued.
+            //
+            // Event 0 is recorded on stream 0 at the start of a call and waited on by the other
+            // streams, so a call does not overtake the previous one. Event s, for s > 0, is
+            // recorded on stream s at the end of a call and waited on by stream 0, so that
+            // all the work of a call has finished once stream 0 has.
+            class GPUStreamSchedule
+            {
+            public:
+                static constexpr size_t no_event = std::numeric_limits<size_t>::max();
+
+                struct Step
+                {
+                    size_t stream = 0;
+                    // events the stream waits on before the op is queued
+                    std::vector<size_t> wait_events;
+                    // event recorded after the op is queued, if another stream depends on it
+                    size_t record_event = no_event;
+                };
+
+                GPUStreamSchedule(const NodeVector& ops, size_t num_streams);
+
+                size_t get_num_streams() const { return m_num_streams; }
+                // Number of streams that were given at least one op
+                size_t get_num_used_streams() const;
+                size_t get_num_events() const { return m_num_events; }
+                const Step& get_step(const Node* node) const { return m_steps.at(node); }
+
+                // Parameters and constants are not queued on any stream
+                static bool is_scheduled(const Node* node);
+
+            private:
+                size_t m_num_streams;
+                size_t m_num_events;
+                std::vector<size_t> m_stream_sizes;
+                std::unordered_map<const Node*, Step> m_steps;
+            };
+        }
+    }
+}
@@ -20,6 +20,7 @@
 
 #include "cuda_error_check.hpp"
 #include "gpu_backend.hpp"
+#include "gpu_cuda_staging_pool.hpp"
 #include "gpu_tensor.hpp"
 #include "gpu_util.hpp"
 #include "ngraph/descriptor/layout/dense_tensor_layout.hpp"
@@ -32,7 +33,10 @@ runtime::gpu::GPUTensor::GPUTensor(const ngraph::element::Type& element_type,
                                    void* memory_pointer)
     : runtime::Tensor(std::make_shared<ngraph::descriptor::Tensor>(element_type, shape, ""))
     , m_custom_memory(false)
+    , m_staging_pool(CudaStagingPool::get_default())
 {
+    CUDA_RT_SAFE_CALL(cudaEventCreateWithFlags(&m_copy_event, cudaEventDisableTiming));
+    CUDA_RT_SAFE_CALL(cudaEventCreateWithFlags(&m_use_event, cudaEventDisableTiming));
     m_descriptor->set_tensor_layout(
         std::make_shared<ngraph::descriptor::layout::DenseTensorLayout>(*m_descriptor));
 
@@ -62,6 +66,10 @@ runtime::gpu::GPUTensor::GPUTensor(const ngraph::element::Type& element_type, co
 
 runtime::gpu::GPUTensor::~GPUTensor()
 {
+    CUDA_RT_SAFE_CALL_NO_THROW(cudaEventSynchronize(m_copy_event));
+    CUDA_RT_SAFE_CALL_NO_THROW(cudaEventSynchronize(m_use_event));
+    CUDA_RT_SAFE_CALL_NO_THROW(cudaEventDestroy(m_copy_event));
+    CUDA_RT_SAFE_CALL_NO_THROW(cudaEventDestroy(m_use_event));
     if (!m_custom_memory && (m_allocated_buffer_pool != nullptr))
     {
         runtime::gpu::free_gpu_buffer(m_allocated_buffer_pool);
@@ -70,12 +78,41 @@ runtime::gpu::GPUTensor::~GPUTensor()
 
 void runtime::gpu::GPUTensor::write(const void* source, size_t n_bytes)
 {
-    runtime::gpu::cuda_memcpyHtD(m_allocated_buffer_pool, source, n_bytes);
+    // asynchronous calls of other backends are waited for on the host, the ones of this
+    // backend on the copy stream
+    Tensor::wait_for_write_ready();
+    m_staging_pool->write(m_allocated_buffer_pool, source, n_bytes, m_use_event, m_copy_event);
 }
 
 void runtime::gpu::GPUTensor::read(void* target, size_t n_bytes) const
 {
-    runtime::gpu::cuda_memcpyDtH(target, m_allocated_buffer_pool, n_bytes);
+    Tensor::wait_for_read_ready();
+    m_staging_pool->read(target, m_allocated_buffer_pool, n_bytes, m_use_event);
+}
+
+void runtime::gpu::GPUTensor::wait_for_read_ready() const
+{
+    Tensor::wait_for_read_ready();
+    CUDA_RT_SAFE_CALL(cudaEventSynchronize(m_copy_event));
+    CUDA_RT_SAFE_CALL(cudaEventSynchronize(m_use_event));
+}
+
+void runtime::gpu::GPUTensor::wait_for_write_ready() const
+{
+    Tensor::wait_for_write_ready();
+    CUDA_RT_SAFE_CALL(cudaEventSynchronize(m_copy_event));
+    CUDA_RT_SAFE_CALL(cudaEventSynchronize(m_use_event));
+}
+
+void runtime::gpu::GPUTensor::wait_on_stream(cudaStream_t stream) const
+{
+    CUDA_RT_SAFE_CALL(cudaStreamWaitEvent(stream, m_copy_event, 0));
+    CUDA_RT_SAFE_CALL(cudaStreamWaitEvent(stream, m_use_event, 0));
+}
+
+void runtime::gpu::GPUTensor::record_use(cudaStream_t stream)
+{
+    CUDA_RT_SAFE_CALL(cudaEventRecord(m_use_event, stream));
 }
 
 void runtime::gpu::GPUTensor::copy_from(const runtime::Tensor& source)
@@ -92,8 +129,12 @@ void runtime::gpu::GPUTensor::copy_from(const runtime::Tensor& source)
         {
             throw invalid_argument("runtime::gpu::GPUTensor::copy_from element types must match.");
         }
-        runtime::gpu::cuda_memcpyDtD(
-            m_allocated_buffer_pool, src.m_allocated_buffer_pool, source.get_size_in_bytes());
+        // the copy also counts as a use of the source, recorded by its copy event
+        m_staging_pool->copy(m_allocated_buffer_pool,
+                             src.m_allocated_buffer_pool,
+                             source.get_size_in_bytes(),
+                             {m_use_event, src.m_use_event},
+                             {m_copy_event, src.m_copy_event});
     }
     catch (const std::bad_cast& e)
     {
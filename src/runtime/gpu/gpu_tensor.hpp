@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cuda_runtime.h>
 #include <memory>
 
 #include "ngraph/runtime/backend.hpp"
@@ -28,6 +29,7 @@ namespace ngraph
     {
         namespace gpu
         {
+            class CudaStagingPool;
             class GPUTensor;
         }
     }
@@ -41,11 +43,14 @@ public:
     virtual ~GPUTensor() override;
 
     /// \brief Write bytes directly into the tensor
+    ///
+    /// The data is staged in pinned memory and copied asynchronously, after the calls using
+    /// the tensor, so the source can be reused as soon as this returns.
     /// \param p Pointer to source of data
     /// \param n_bytes Number of bytes to write, must be integral number of elements.
     void write(const void* p, size_t n_bytes) override;
 
-    /// \brief Read bytes directly from the tensor
+    /// \brief Read bytes directly from the tensor, once the calls writing it have completed
     /// \param p Pointer to destination for data
     /// \param n_bytes Number of bytes to read, must be integral number of elements.
     void read(void* p, size_t n_bytes) const override;
@@ -54,11 +59,26 @@ public:
     /// \param source Another GPU tensor
     void copy_from(const runtime::Tensor& source) override;
 
+    /// \brief Waits for the copies and the calls using the tensor
+    void wait_for_read_ready() const override;
+    void wait_for_write_ready() const override;
+
+    /// \brief Orders the work queued next on stream after the pending copies and calls using
+    ///        the tensor
+    void wait_on_stream(cudaStream_t stream) const;
+    /// \brief Records that the work queued so far on stream uses the tensor
+    void record_use(cudaStream_t stream);
+
     void* m_allocated_buffer_pool = nullptr;
     size_t m_buffer_size;
     bool m_custom_memory;
 
 private:
+    std::shared_ptr<CudaStagingPool> m_staging_pool;
+    // recorded behind the last copy to or from the tensor, and behind the last call using it
+    cudaEvent_t m_copy_event;
+    cudaEvent_t m_use_event;
+
     GPUTensor(const GPUTensor&) = delete;
     GPUTensor(GPUTensor&&) = delete;
     GPUTensor& operator=(const GPUTensor&) = delete;
@@ -23,8 +23,10 @@
 #include <string>
 
 #include "cuda_error_check.hpp"
+#include "gpu_cuda_caching_allocator.hpp"
 #include "gpu_util.hpp"
 #include "ngraph/check.hpp"
+#include "ngraph/env_util.hpp"
 #include "ngraph/util.hpp"
 
 using namespace ngraph;
@@ -45,8 +47,7 @@ void runtime::gpu::check_cuda_errors(CUresult err)
 
 void* runtime::gpu::create_gpu_buffer(size_t buffer_size, const void* data)
 {
-    void* allocated_buffer_pool;
-    CUDA_RT_SAFE_CALL(cudaMalloc(static_cast<void**>(&allocated_buffer_pool), buffer_size));
+    void* allocated_buffer_pool = CudaCachingAllocator::get().allocate(buffer_size);
     if (data)
     {
         runtime::gpu::cuda_memcpyHtD(allocated_buffer_pool, data, buffer_size);
@@ -58,7 +59,7 @@ void runtime::gpu::free_gpu_buffer(void* buffer)
 {
     if (buffer)
     {
-        CUDA_RT_SAFE_CALL(cudaFree(buffer));
+        CudaCachingAllocator::get().free(buffer);
     }
 }
 
@@ -93,6 +94,29 @@ void runtime::gpu::cuda_memset(void* dst, int value, size_t buffer_size)
     CUDA_RT_SAFE_CALL(cudaMemset(dst, value, buffer_size));
 }
 
+void runtime::gpu::cuda_memcpyDtD_async(void* dst,
+                                        const void* src,
+                                        size_t buffer_size,
+                                        cudaStream_t stream)
+{
+    CUDA_RT_SAFE_CALL(
+        cudaMemcpyAsync(dst, src, buffer_size, cudaMemcpyDeviceToDevice, stream));
+}
+
+void runtime::gpu::cuda_memset_async(void* dst,
+                                     int value,
+                                     size_t buffer_size,
+                                     cudaStream_t stream)
+{
+    CUDA_RT_SAFE_CALL(cudaMemsetAsync(dst, value, buffer_size, stream));
+}
+
+bool runtime::gpu::is_tf32_allowed()
+{
+    static const bool allowed = getenv_bool("NGRAPH_GPU_ALLOW_TF32");
+    return allowed;
+}
+
 namespace
 {
     // Unsigned integer exponentiation by squaring adapted
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cuda_runtime.h>
 #include <cudnn.h>
 #include <memory>
 #include <vector>
@@ -35,6 +36,15 @@ namespace ngraph
             void cuda_memcpyHtD(void* dst, const void* src, size_t buffer_size);
             void cuda_memcpyDtH(void* dst, const void* src, size_t buffer_size);
             void cuda_memset(void* dst, int value, size_t buffer_size);
+            // Queue the copy or fill on stream, in order with the primitives queued there
+            void cuda_memcpyDtD_async(void* dst,
+                                      const void* src,
+                                      size_t buffer_size,
+                                      cudaStream_t stream);
+            void cuda_memset_async(void* dst, int value, size_t buffer_size, cudaStream_t stream);
+            // Whether f32 GEMMs and convolutions may run on tensor cores in TF32, which keeps
+            // only 10 bits of mantissa; opted into with NGRAPH_GPU_ALLOW_TF32
+            bool is_tf32_allowed();
             std::pair<uint64_t, uint64_t> idiv_magic_u32(uint64_t max_numerator, uint64_t divisor);
             std::pair<uint64_t, uint64_t> idiv_magic_u64(uint64_t divisor);
             uint32_t idiv_ceil(int n, int d);
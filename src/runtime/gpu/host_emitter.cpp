@@ -51,7 +51,10 @@ size_t runtime::gpu::HostEmitter::build_memcpy(const cudaMemcpyKind& kind,
 
     std::unique_ptr<gpu::primitive> launch_kernel(
         new gpu::primitive{[=](void** inputs, void** outputs) mutable {
-            CUDA_RT_SAFE_CALL(cudaMemcpy(outputs[dst], inputs[src], size, kind));
+            // pageable host memory is staged, so the host side of the copy can be reused once
+            // the call returns
+            CUDA_RT_SAFE_CALL(
+                cudaMemcpyAsync(outputs[dst], inputs[src], size, kind, m_ctx->stream));
         }});
 
     return this->m_primitive_emitter->register_primitive(launch_kernel, hash);
@@ -76,13 +79,13 @@ size_t runtime::gpu::HostEmitter::build_zero_out(size_t dst, size_t size, bool i
     {
         launch_kernel.reset(new gpu::primitive{[=](void** inputs, void** outputs) mutable {
             void* tensor = gpu::invoke_memory_primitive(m_ctx, dst);
-            CUDA_RT_SAFE_CALL(cudaMemset(tensor, 0, size));
+            CUDA_RT_SAFE_CALL(cudaMemsetAsync(tensor, 0, size, m_ctx->stream));
         }});
     }
     else
     {
         launch_kernel.reset(new gpu::primitive{[=](void** inputs, void** outputs) mutable {
-            CUDA_RT_SAFE_CALL(cudaMemset(outputs[dst], 0, size));
+            CUDA_RT_SAFE_CALL(cudaMemsetAsync(outputs[dst], 0, size, m_ctx->stream));
         }});
     }
 
@@ -0,0 +1,63 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "op/fused_elementwise.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr NodeTypeInfo op::gpu::FusedElementwise::type_info;
+
+op::gpu::FusedElementwise::FusedElementwise(const OutputVector& args,
+                                            const shared_ptr<Function>& body)
+    : Op(args)
+    , m_body(body)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::gpu::FusedElementwise::validate_and_infer_types()
+{
+    const ParameterVector& parameters = m_body->get_parameters();
+    NODE_VALIDATION_CHECK(this,
+                          parameters.size() == get_input_size(),
+                          "The body has ",
+                          parameters.size(),
+                          " parameters but the op has ",
+                          get_input_size(),
+                          " inputs");
+    for (size_t i = 0; i < parameters.size(); i++)
+    {
+        NODE_VALIDATION_CHECK(this,
+                              parameters[i]->get_element_type() == get_input_element_type(i) &&
+                                  parameters[i]->get_output_shape(0) == get_input_shape(i),
+                              "Input ",
+                              i,
+                              " does not match parameter ",
+                              i,
+                              " of the body");
+    }
+    NODE_VALIDATION_CHECK(
+        this, m_body->get_output_size() == 1, "The body must have a single result");
+    set_output_type(0, m_body->get_output_element_type(0), m_body->get_output_shape(0));
+}
+
+shared_ptr<Node>
+    op::gpu::FusedElementwise::clone_with_new_inputs(const OutputVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<FusedElementwise>(new_args, m_body);
+}
@@ -0,0 +1,56 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+
+#include "ngraph/function.hpp"
+#include "ngraph/op/op.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        namespace gpu
+        {
+            // A chain of elementwise ops collapsed into a single kernel by the elementwise
+            // fusion pass.
+
+            // INPUTS:
+            // [0..n) - the tensors read by the chain, in the order of the parameters of the body
+
+            // The body reads each of its parameters either elementwise or through a broadcast
+            // to the output shape, applies elementwise ops to the values it read and returns a
+            // single result with the shape of the output of this op.
+            class FusedElementwise : public Op
+            {
+            public:
+                FusedElementwise(const OutputVector& args, const std::shared_ptr<Function>& body);
+                static constexpr NodeTypeInfo type_info{"FusedElementwise", 0};
+                const NodeTypeInfo& get_type_info() const override { return type_info; }
+                void validate_and_infer_types() override;
+                virtual std::shared_ptr<Node>
+                    clone_with_new_inputs(const OutputVector& new_args) const override;
+
+                const std::shared_ptr<Function>& get_body() const { return m_body; }
+
+            private:
+                std::shared_ptr<Function> m_body;
+            };
+        }
+    }
+}
@@ -0,0 +1,156 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "gpu_cuda_kernel_ops.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "op/fused_elementwise.hpp"
+#include "pass/gpu_elementwise_fusion.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    // A single output of the shape of the chain, and no ordering constraints on the node
+    bool fits_chain(const Node& node, const Shape& shape)
+    {
+        return node.get_output_size() == 1 && node.get_output_shape(0) == shape &&
+               node.get_control_dependencies().empty() && node.get_control_dependents().empty();
+    }
+
+    bool is_broadcast_leaf(const Node& node, const Shape& shape)
+    {
+        return is_type<op::v0::Broadcast>(&node) && fits_chain(node, shape);
+    }
+}
+
+bool runtime::gpu::pass::ElementwiseFusion::is_fusible(const Node& node)
+{
+    return runtime::gpu::get_cuda_elementwise_op(node) != nullptr;
+}
+
+bool runtime::gpu::pass::ElementwiseFusion::run_on_function(shared_ptr<Function> f)
+{
+    bool replaced = false;
+    unordered_set<const Node*> fused;
+    NodeVector ops = f->get_ordered_ops();
+    unordered_map<const Node*, size_t> positions;
+    for (size_t i = 0; i < ops.size(); i++)
+    {
+        positions[ops[i].get()] = i;
+    }
+
+    // the users of a chain are visited before it, so the first op of a chain seen is its root
+    for (auto it = ops.rbegin(); it != ops.rend(); ++it)
+    {
+        shared_ptr<Node> root = *it;
+        if (fused.count(root.get()) != 0 || !is_fusible(*root) ||
+            !fits_chain(*root, root->get_output_shape(0)) ||
+            shape_size(root->get_output_shape(0)) == 0)
+        {
+            continue;
+        }
+        const Shape& shape = root->get_output_shape(0);
+
+        // grow the chain until no producer outside of it has all its users inside of it
+        unordered_set<const Node*> chain{root.get()};
+        NodeVector members{root};
+        bool grown = true;
+        while (grown)
+        {
+            grown = false;
+            for (size_t m = 0; m < members.size(); m++)
+            {
+                if (is_type<op::v0::Broadcast>(members[m]))
+                {
+                    continue;
+                }
+                for (auto& value : members[m]->input_values())
+                {
+                    shared_ptr<Node> producer = value.get_node_shared_ptr();
+                    if (chain.count(producer.get()) != 0 || fused.count(producer.get()) != 0)
+                    {
+                        continue;
+                    }
+                    bool joins = is_broadcast_leaf(*producer, shape);
+                    if (!joins && is_fusible(*producer) && fits_chain(*producer, shape))
+                    {
+                        auto users = producer->output(0).get_target_inputs();
+                        joins = all_of(users.begin(), users.end(), [&](const Input<Node>& user) {
+                            return chain.count(user.get_node()) != 0;
+                        });
+                    }
+                    if (joins)
+                    {
+                        chain.insert(producer.get());
+                        members.push_back(producer);
+                        grown = true;
+                    }
+                }
+            }
+        }
+        if (members.size() < 2)
+        {
+            continue;
+        }
+
+        // clone the chain, in execution order, over parameters for the values it reads
+        sort(members.begin(),
+             members.end(),
+             [&](const shared_ptr<Node>& a, const shared_ptr<Node>& b) {
+                 return positions.at(a.get()) < positions.at(b.get());
+             });
+        OutputVector args;
+        ParameterVector parameters;
+        map<Output<Node>, Output<Node>> body_values;
+        for (auto& member : members)
+        {
+            OutputVector new_inputs;
+            for (auto& value : member->input_values())
+            {
+                auto body_value = body_values.find(value);
+                if (body_value == body_values.end())
+                {
+                    auto parameter = make_shared<op::v0::Parameter>(value.get_element_type(),
+                                                                    value.get_shape());
+                    args.push_back(value);
+                    parameters.push_back(parameter);
+                    body_value = body_values.insert({value, parameter->output(0)}).first;
+                }
+                new_inputs.push_back(body_value->second);
+            }
+            body_values[member->output(0)] = member->copy_with_new_inputs(new_inputs, {});
+            if (!is_type<op::v0::Broadcast>(member))
+            {
+                fused.insert(member.get());
+            }
+        }
+        auto body = make_shared<Function>(OutputVector{body_values.at(root->output(0))},
+                                          parameters,
+                                          root->get_friendly_name());
+        auto fused_op = make_shared<op::gpu::FusedElementwise>(args, body);
+        replace_node(root, fused_op);
+        replaced = true;
+    }
+    return replaced;
+}
@@ -0,0 +1,52 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace gpu
+        {
+            namespace pass
+            {
+                class ElementwiseFusion;
+            }
+        }
+    }
+}
+
+// Collapses chains of elementwise ops, and the broadcasts feeding them, into FusedElementwise
+// ops which are emitted as a single kernel. An op joins the chain of its users only when all of
+// its users are in it, so the intermediate values never need to be written to memory. A
+// broadcast is read in place by every chain it feeds, and only stays in the graph for its other
+// users.
+class ngraph::runtime::gpu::pass::ElementwiseFusion : public ngraph::pass::FunctionPass
+{
+public:
+    ElementwiseFusion()
+        : FunctionPass()
+    {
+    }
+
+    virtual bool run_on_function(std::shared_ptr<ngraph::Function> f);
+
+    // Elementwise ops the GPU emitter has a CUDA kernel for
+    static bool is_fusible(const Node& node);
+};
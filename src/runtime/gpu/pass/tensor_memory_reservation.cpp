@@ -15,6 +15,9 @@
 //*****************************************************************************
 
 #include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "gpu_memory_manager.hpp"
 #include "ngraph/function.hpp"
@@ -34,7 +37,40 @@ bool runtime::gpu::pass::TensorMemoryReservation::run_on_function(shared_ptr<Fun
     // intermediate memory reservation
     if (mem_pool_size)
     {
-        size_t pool_idx = m_allocator.reserve_workspace(mem_pool_size, false);
+        // the byte ranges of the pool holding live tensors while each op runs
+        vector<shared_ptr<Node>> ops = f->get_ordered_ops();
+        vector<vector<pair<size_t, size_t>>> live_ranges(ops.size());
+        unordered_map<descriptor::Tensor*, size_t> defined;
+        auto add_live_range = [&](descriptor::Tensor* tensor, size_t first, size_t last) {
+            size_t offset = tensor->get_pool_offset();
+            for (size_t i = first; i <= last; i++)
+            {
+                live_ranges[i].push_back({offset, offset + tensor->size()});
+            }
+        };
+        for (size_t i = 0; i < ops.size(); i++)
+        {
+            for (descriptor::Tensor* tensor : ops[i]->liveness_new_list)
+            {
+                defined[tensor] = i;
+            }
+            for (descriptor::Tensor* tensor : ops[i]->liveness_free_list)
+            {
+                auto it = defined.find(tensor);
+                add_live_range(tensor, it == defined.end() ? 0 : it->second, i);
+                if (it != defined.end())
+                {
+                    defined.erase(it);
+                }
+            }
+        }
+        for (auto& tensor : defined)
+        {
+            add_live_range(tensor.first, tensor.second, ops.size() - 1);
+        }
+
+        size_t pool_idx =
+            m_allocator.reserve_tensor_pool(mem_pool_size, f->get_name(), move(live_ranges));
         m_memory_buffers.insert({f->get_name(), pool_idx});
         reservation = true;
     }
@@ -14,6 +14,8 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <chrono>
+
 #include "benchmark.hpp"
 #include "benchmark_utils.hpp"
 #include "ngraph/file_util.hpp"
@@ -90,16 +92,14 @@ vector<runtime::PerformanceCounter> run_benchmark(shared_ptr<Function> f,
                                                   bool timing_detail,
                                                   size_t warmup_iterations,
                                                   bool copy_data,
-                                                  bool dump_results)
+                                                  bool dump_results,
+                                                  ModelStatistics& statistics)
 {
-    stopwatch timer;
-    timer.start();
     auto backend = runtime::Backend::create(backend_name);
-    auto exec = backend->compile(f, timing_detail);
-    timer.stop();
+    auto exec = compile_with_statistics(*backend, f, timing_detail, statistics);
     stringstream ss;
     ss.imbue(locale(""));
-    ss << "compile time: " << timer.get_milliseconds() << "ms" << endl;
+    ss << "compile time: " << statistics.compile_ms << "ms" << endl;
 
     vector<shared_ptr<runtime::HostTensor>> arg_data;
     vector<shared_ptr<runtime::Tensor>> args;
@@ -145,6 +145,7 @@ vector<runtime::PerformanceCounter> run_benchmark(shared_ptr<Function> f,
         {
             t1.start();
         }
+        auto call_start = chrono::steady_clock::now();
         if (copy_data)
         {
             for (size_t arg_index = 0; arg_index < args.size(); arg_index++)
@@ -169,6 +170,16 @@ vector<runtime::PerformanceCounter> run_benchmark(shared_ptr<Function> f,
                              data->get_element_count() * data->get_element_type().size());
             }
         }
+        double latency =
+            chrono::duration<double, micro>(chrono::steady_clock::now() - call_start).count();
+        if (i == 0)
+        {
+            statistics.first_call_ms = latency / 1000;
+        }
+        if (i >= warmup_iterations)
+        {
+            statistics.latencies.record(latency);
+        }
     }
     t1.stop();
     float time = t1.get_milliseconds();
@@ -180,6 +191,7 @@ vector<runtime::PerformanceCounter> run_benchmark(shared_ptr<Function> f,
         dump_result_tensors(result_data);
     }
 
+    statistics.memory_footprint = exec->get_memory_footprint();
     vector<runtime::PerformanceCounter> perf_data = exec->get_performance_data();
     return perf_data;
 }
@@ -0,0 +1,75 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <iomanip>
+#include <iostream>
+
+#include "benchmark_autotune.hpp"
+#include "benchmark_utils.hpp"
+#include "ngraph/runtime/backend.hpp"
+
+#ifdef NGRAPH_CPU_ENABLE
+#include "ngraph/runtime/cpu/cpu_autotune.hpp"
+#include "ngraph/runtime/cpu/cpu_backend.hpp"
+#endif
+
+using namespace std;
+using namespace ngraph;
+
+bool run_benchmark_autotune(shared_ptr<Function> f,
+                            const string& backend_name,
+                            size_t iterations,
+                            bool throughput)
+{
+#ifdef NGRAPH_CPU_ENABLE
+    auto backend = runtime::Backend::create(backend_name);
+    auto cpu_backend = dynamic_pointer_cast<runtime::cpu::CPU_Backend>(backend);
+    if (!cpu_backend)
+    {
+        return false;
+    }
+
+    vector<shared_ptr<runtime::Tensor>> args;
+    for (auto& param : f->get_parameters())
+    {
+        auto tensor = backend->create_tensor(param->get_element_type(), param->get_output_shape(0));
+        random_init(tensor);
+        args.push_back(tensor);
+    }
+    auto results = runtime::cpu::autotune(*cpu_backend, f, iterations, throughput, args);
+
+    cout << setw(18) << "intra_op_threads" << setw(10) << "inter_op" << setw(13)
+         << "concurrency" << setw(9) << "use_tbb" << setw(14) << "us/call" << "\n";
+    for (auto& result : results)
+    {
+        auto& tuning = result.tuning;
+        cout << setw(18) << tuning.intra_op_threads << setw(10) << tuning.inter_op << setw(13)
+             << tuning.concurrency << setw(9) << tuning.use_tbb << setw(14) << fixed
+             << setprecision(1) << result.microseconds_per_call << "\n";
+    }
+    if (!results.empty() && runtime::cpu::store_tuning(f, results.front().tuning))
+    {
+        cout << "Stored the fastest settings in the compile cache\n";
+    }
+    return true;
+#else
+    (void)f;
+    (void)backend_name;
+    (void)iterations;
+    (void)throughput;
+    return false;
+#endif
+}
@@ -0,0 +1,34 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "ngraph/function.hpp"
+
+/// \brief Benchmarks `f` under every parallelism setting the CPU autotuner tries and prints
+///        the time per call of each, fastest first.
+///
+/// With `throughput` concurrent calls are tried too and the time per call is the inverse of
+/// the throughput. The fastest settings are stored in the compile cache when
+/// NGRAPH_CPU_CACHE_DIR is set, where the CPU backend finds them when it compiles `f` again.
+/// \returns false if `backend_name` is not a CPU backend
+bool run_benchmark_autotune(std::shared_ptr<ngraph::Function> f,
+                            const std::string& backend_name,
+                            size_t iterations,
+                            bool throughput);
@@ -0,0 +1,223 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "benchmark_load.hpp"
+#include "benchmark_utils.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/host_tensor.hpp"
+#include "ngraph/runtime/tensor.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    using load_clock = chrono::steady_clock;
+
+    // The tensors a client calls the executable with
+    struct Client
+    {
+        vector<shared_ptr<runtime::HostTensor>> arg_data;
+        vector<shared_ptr<runtime::Tensor>> args;
+        vector<shared_ptr<runtime::HostTensor>> result_data;
+        vector<shared_ptr<runtime::Tensor>> results;
+        LatencyHistogram latencies;
+    };
+
+    void call(runtime::Executable& exec, Client& client, bool copy_data)
+    {
+        if (copy_data)
+        {
+            for (size_t arg_index = 0; arg_index < client.args.size(); arg_index++)
+            {
+                const shared_ptr<runtime::Tensor>& arg = client.args[arg_index];
+                if (arg->get_stale())
+                {
+                    const shared_ptr<runtime::HostTensor>& data = client.arg_data[arg_index];
+                    arg->write(data->get_data_ptr(), data->get_size_in_bytes());
+                }
+            }
+        }
+        exec.call(client.results, client.args);
+        if (copy_data)
+        {
+            for (size_t result_index = 0; result_index < client.results.size(); result_index++)
+            {
+                const shared_ptr<runtime::HostTensor>& data = client.result_data[result_index];
+                client.results[result_index]->read(data->get_data_ptr(),
+                                                   data->get_size_in_bytes());
+            }
+        }
+    }
+}
+
+vector<runtime::PerformanceCounter> run_benchmark_load(shared_ptr<Function> f,
+                                                       const string& backend_name,
+                                                       size_t iterations,
+                                                       bool timing_detail,
+                                                       size_t warmup_iterations,
+                                                       bool copy_data,
+                                                       size_t clients,
+                                                       double qps,
+                                                       ModelStatistics& statistics)
+{
+    auto backend = runtime::Backend::create(backend_name);
+    auto exec = compile_with_statistics(*backend, f, timing_detail, statistics);
+    stringstream ss;
+    ss.imbue(locale(""));
+    ss << "compile time: " << statistics.compile_ms << "ms" << endl;
+
+    vector<Client> client_data(clients);
+    for (Client& client : client_data)
+    {
+        for (shared_ptr<op::v0::Parameter> param : f->get_parameters())
+        {
+            auto tensor =
+                backend->create_tensor(param->get_element_type(), param->get_output_shape(0));
+            auto tensor_data = make_shared<runtime::HostTensor>(param->get_element_type(),
+                                                                param->get_output_shape(0));
+            random_init(tensor_data);
+            tensor->write(tensor_data->get_data_ptr(), tensor_data->get_size_in_bytes());
+            if (param->get_cacheable())
+            {
+                tensor->set_stale(false);
+            }
+            client.args.push_back(tensor);
+            client.arg_data.push_back(tensor_data);
+        }
+        for (shared_ptr<Node> out : f->get_results())
+        {
+            client.results.push_back(
+                backend->create_tensor(out->get_output_element_type(0), out->get_output_shape(0)));
+            client.result_data.push_back(make_shared<runtime::HostTensor>(
+                out->get_output_element_type(0), out->get_output_shape(0)));
+        }
+    }
+
+    // The first call is made alone, before the clients start, so that its latency is not
+    // hidden by the other clients initializing the executable at the same time
+    {
+        set_denormals_flush_to_zero();
+        auto first_call_start = load_clock::now();
+        call(*exec, client_data[0], copy_data);
+        statistics.first_call_ms =
+            chrono::duration<double, milli>(load_clock::now() - first_call_start).count();
+    }
+
+    // The clients warm up, then wait for the others so that the measurement starts at once
+    mutex start_mutex;
+    condition_variable start_condition;
+    size_t warm_clients = 0;
+    bool started = false;
+    load_clock::time_point start_time;
+    exception_ptr error;
+    mutex error_mutex;
+    atomic<bool> failed(false);
+
+    auto run_client = [&](size_t client_index) {
+        Client& client = client_data[client_index];
+        set_denormals_flush_to_zero();
+        try
+        {
+            for (size_t i = 0; i < warmup_iterations; i++)
+            {
+                call(*exec, client, copy_data);
+            }
+        }
+        catch (...)
+        {
+            lock_guard<mutex> lock(error_mutex);
+            error = current_exception();
+            failed = true;
+        }
+
+        {
+            unique_lock<mutex> lock(start_mutex);
+            if (++warm_clients == clients)
+            {
+                start_time = load_clock::now();
+                started = true;
+                start_condition.notify_all();
+            }
+            start_condition.wait(lock, [&]() { return started; });
+        }
+
+        try
+        {
+            for (size_t i = 0; i < iterations && !failed; i++)
+            {
+                load_clock::time_point scheduled = load_clock::now();
+                if (qps > 0)
+                {
+                    // Calls are dealt to the clients in turn
+                    double request = static_cast<double>(i * clients + client_index);
+                    scheduled = start_time + chrono::duration_cast<load_clock::duration>(
+                                                 chrono::duration<double>(request / qps));
+                    this_thread::sleep_until(scheduled);
+                }
+                call(*exec, client, copy_data);
+                client.latencies.record(
+                    chrono::duration<double, micro>(load_clock::now() - scheduled).count());
+            }
+        }
+        catch (...)
+        {
+            lock_guard<mutex> lock(error_mutex);
+            error = current_exception();
+            failed = true;
+        }
+    };
+
+    vector<thread> threads;
+    for (size_t i = 0; i < clients; i++)
+    {
+        threads.emplace_back(run_client, i);
+    }
+    for (thread& t : threads)
+    {
+        t.join();
+    }
+    double elapsed = chrono::duration<double>(load_clock::now() - start_time).count();
+    if (error)
+    {
+        rethrow_exception(error);
+    }
+
+    for (const Client& client : client_data)
+    {
+        statistics.latencies.merge(client.latencies);
+    }
+
+    ss << clients << " clients, " << (qps > 0 ? "open" : "closed") << " loop";
+    if (qps > 0)
+    {
+        ss << " at " << qps << " calls/s";
+    }
+    ss << endl;
+    ss << "throughput: " << statistics.latencies.count() / elapsed << " calls/s" << endl;
+    cout << ss.str();
+
+    statistics.memory_footprint = exec->get_memory_footprint();
+    vector<runtime::PerformanceCounter> perf_data = exec->get_performance_data();
+    return perf_data;
+}
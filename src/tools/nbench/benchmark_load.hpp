@@ -0,0 +1,45 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark_utils.hpp"
+#include "ngraph/function.hpp"
+#include "ngraph/runtime/performance_counter.hpp"
+
+/// \brief Calls one executable from `clients` threads at once, reports the throughput and
+///        records the first call and the latency of every measured call into `statistics`.
+///
+/// Every client makes `warmup_iterations` calls before the measurement starts and then
+/// `iterations` measured calls. With `qps` 0 the load is closed-loop: a client makes its next
+/// call as soon as the previous one returns. Otherwise the load is open-loop: calls are
+/// scheduled at a fixed rate of `qps` over all the clients, and the latency of a call is
+/// measured from its scheduled time, so that the time it waited for a busy client counts.
+std::vector<ngraph::runtime::PerformanceCounter>
+    run_benchmark_load(std::shared_ptr<ngraph::Function> f,
+                       const std::string& backend_name,
+                       size_t iterations,
+                       bool timing_detail,
+                       size_t warmup_iterations,
+                       bool copy_data,
+                       size_t clients,
+                       double qps,
+                       ModelStatistics& statistics);
@@ -14,16 +14,14 @@
 // limitations under the License.
 //*****************************************************************************
 
-#include <array>
-#include <condition_variable>
-#include <mutex>
-#include <thread>
+#include <chrono>
 
 #include "benchmark.hpp"
 #include "benchmark_utils.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/host_tensor.hpp"
+#include "ngraph/runtime/pipeline.hpp"
 #include "ngraph/runtime/tensor.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
@@ -31,101 +29,27 @@
 using namespace std;
 using namespace ngraph;
 
-class TensorCollection
-{
-public:
-    vector<shared_ptr<runtime::HostTensor>> parameter_data;
-    vector<shared_ptr<runtime::HostTensor>> result_data;
-
-    vector<shared_ptr<runtime::Tensor>> input_tensors;
-    vector<shared_ptr<runtime::Tensor>> output_tensors;
-
-private:
-};
-
-static mutex s_mutex;
-static condition_variable s_condition;
-static size_t current_iteration = 0;
-static size_t s_iterations;
-static size_t s_warmup_iterations;
-static stopwatch s_timer;
-
-static void
-    thread_entry(runtime::Executable* exec, const TensorCollection& tensors, size_t pipeline_stage)
-{
-    bool data_written = false;
-    const vector<shared_ptr<runtime::Tensor>>& args = tensors.input_tensors;
-    const vector<shared_ptr<runtime::Tensor>>& results = tensors.output_tensors;
-    while (current_iteration < s_iterations + s_warmup_iterations)
-    {
-        if (!data_written)
-        {
-            for (size_t arg_index = 0; arg_index < args.size(); arg_index++)
-            {
-                const shared_ptr<runtime::Tensor>& arg = args[arg_index];
-                if (arg->get_stale())
-                {
-                    const shared_ptr<runtime::HostTensor>& data = tensors.parameter_data[arg_index];
-                    arg->write(data->get_data_ptr(),
-                               data->get_element_count() * data->get_element_type().size());
-                }
-            }
-            data_written = true;
-        }
-        unique_lock<mutex> lock(s_mutex);
-        if ((current_iteration & 1) != pipeline_stage)
-        {
-            s_condition.wait(lock);
-        }
-        else
-        {
-            if (current_iteration == s_warmup_iterations)
-            {
-                s_timer.start();
-            }
-            // our turn to run
-            exec->call(results, args);
-            current_iteration++;
-            data_written = false;
-            s_condition.notify_all();
-            lock.unlock();
-            for (size_t result_index = 0; result_index < results.size(); result_index++)
-            {
-                const shared_ptr<runtime::HostTensor>& data = tensors.result_data[result_index];
-                const shared_ptr<runtime::Tensor>& result = results[result_index];
-                result->read(data->get_data_ptr(),
-                             data->get_element_count() * data->get_element_type().size());
-            }
-            if (current_iteration == (s_iterations + s_warmup_iterations - 1))
-            {
-                s_timer.stop();
-            }
-        }
-    }
-}
-
 vector<runtime::PerformanceCounter> run_benchmark_pipelined(shared_ptr<Function> f,
                                                             const string& backend_name,
                                                             size_t iterations,
                                                             bool timing_detail,
                                                             int warmup_iterations,
-                                                            bool /* copy_data */)
+                                                            bool /* copy_data */,
+                                                            ModelStatistics& statistics)
 {
-    constexpr size_t pipeline_depth = 2;
-    s_iterations = iterations;
-    s_warmup_iterations = warmup_iterations;
-    array<TensorCollection, pipeline_depth> tensor_collections;
-    stopwatch timer;
-    timer.start();
     auto backend = runtime::Backend::create(backend_name);
-    auto exec = backend->compile(f, timing_detail);
-    timer.stop();
+    auto exec = compile_with_statistics(*backend, f, timing_detail, statistics);
     stringstream ss;
     ss.imbue(locale(""));
-    ss << "compile time: " << timer.get_milliseconds() << "ms" << endl;
+    ss << "compile time: " << statistics.compile_ms << "ms" << endl;
     set_denormals_flush_to_zero();
 
-    // Create random input data for all input tensors
+    runtime::Pipeline pipeline(exec);
+    size_t pipeline_depth = pipeline.get_depth();
+
+    // Random input data and space for the results of every stage
+    vector<vector<shared_ptr<runtime::HostTensor>>> parameter_data(pipeline_depth);
+    vector<vector<shared_ptr<runtime::HostTensor>>> result_data(pipeline_depth);
     for (size_t i = 0; i < pipeline_depth; i++)
     {
         for (shared_ptr<op::v0::Parameter> param : f->get_parameters())
@@ -133,59 +57,68 @@ vector<runtime::PerformanceCounter> run_benchmark_pipelined(shared_ptr<Function>
             auto tensor_data = make_shared<runtime::HostTensor>(param->get_element_type(),
                                                                 param->get_output_shape(0));
             random_init(tensor_data);
-            tensor_collections[i].parameter_data.push_back(tensor_data);
+            parameter_data[i].push_back(tensor_data);
         }
-    }
-
-    // Create output tensors for all outputs
-    for (size_t i = 0; i < pipeline_depth; i++)
-    {
         for (shared_ptr<Node> result : f->get_results())
         {
             auto tensor_data = make_shared<runtime::HostTensor>(result->get_output_element_type(0),
                                                                 result->get_output_shape(0));
-            tensor_collections[i].result_data.push_back(tensor_data);
+            result_data[i].push_back(tensor_data);
         }
     }
 
-    // Create input tensors for all Parameters
-    array<vector<shared_ptr<runtime::Tensor>>, pipeline_depth> input_tensors_array;
-    size_t input_index = 0;
-    for (shared_ptr<op::v0::Parameter> param : f->get_parameters())
-    {
-        auto input_tensors = exec->create_input_tensor(input_index++, pipeline_depth);
-        for (size_t i = 0; i < pipeline_depth; i++)
+    size_t total_iterations = iterations + warmup_iterations;
+    stopwatch run_timer;
+    // An iteration lasts from its fill to its drain, both on this thread
+    vector<chrono::steady_clock::time_point> fill_times(total_iterations);
+    auto fill = [&](size_t iteration, const vector<shared_ptr<runtime::Tensor>>& args) {
+        if (iteration == total_iterations)
         {
-            tensor_collections[i].input_tensors.push_back(input_tensors[i]);
+            return false;
         }
-    }
-
-    // Create output tensors for all Results
-    array<vector<shared_ptr<runtime::Tensor>>, pipeline_depth> output_tensors_array;
-    size_t output_index = 0;
-    for (shared_ptr<Node> result : f->get_results())
-    {
-        auto output_tensors = exec->create_output_tensor(output_index++, pipeline_depth);
-        for (size_t i = 0; i < pipeline_depth; i++)
+        if (iteration == static_cast<size_t>(warmup_iterations))
         {
-            tensor_collections[i].output_tensors.push_back(output_tensors[i]);
+            run_timer.start();
         }
-    }
-
-    thread threads[pipeline_depth];
-    for (size_t i = 0; i < pipeline_depth; i++)
-    {
-        threads[i] = thread(thread_entry, exec.get(), tensor_collections[i], i);
-    }
+        fill_times[iteration] = chrono::steady_clock::now();
+        const auto& data = parameter_data[iteration % pipeline_depth];
+        for (size_t arg_index = 0; arg_index < args.size(); arg_index++)
+        {
+            if (args[arg_index]->get_stale())
+            {
+                args[arg_index]->write(data[arg_index]->get_data_ptr(),
+                                       data[arg_index]->get_size_in_bytes());
+            }
+        }
+        return true;
+    };
+    auto drain = [&](size_t iteration, const vector<shared_ptr<runtime::Tensor>>& results) {
+        const auto& data = result_data[iteration % pipeline_depth];
+        for (size_t result_index = 0; result_index < results.size(); result_index++)
+        {
+            results[result_index]->read(data[result_index]->get_data_ptr(),
+                                        data[result_index]->get_size_in_bytes());
+        }
+        double latency =
+            chrono::duration<double, micro>(chrono::steady_clock::now() - fill_times[iteration])
+                .count();
+        if (iteration == 0)
+        {
+            statistics.first_call_ms = latency / 1000;
+        }
+        if (iteration >= static_cast<size_t>(warmup_iterations))
+        {
+            statistics.latencies.record(latency);
+        }
+    };
+    pipeline.run(fill, drain);
+    run_timer.stop();
 
-    for (size_t i = 0; i < pipeline_depth; i++)
-    {
-        threads[i].join();
-    }
-    float time = s_timer.get_milliseconds();
+    float time = run_timer.get_milliseconds();
     ss << time / iterations << "ms per iteration" << endl;
     cout << ss.str();
 
+    statistics.memory_footprint = exec->get_memory_footprint();
     vector<runtime::PerformanceCounter> perf_data = exec->get_performance_data();
     return perf_data;
 }
@@ -21,6 +21,7 @@
 #include <string>
 #include <vector>
 
+#include "benchmark_utils.hpp"
 #include "ngraph/function.hpp"
 #include "ngraph/runtime/performance_counter.hpp"
 
@@ -30,4 +31,5 @@ std::vector<ngraph::runtime::PerformanceCounter>
                             size_t iterations,
                             bool timing_detail,
                             int warmup_iterations,
-                            bool copy_data);
+                            bool copy_data,
+                            ModelStatistics& statistics);
@@ -0,0 +1,261 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <iomanip>
+
+#include "benchmark_roofline.hpp"
+#include "benchmark_utils.hpp"
+#include "ngraph/op/experimental/batch_mat_mul.hpp"
+#include "ngraph/op/util/arithmetic_reduction.hpp"
+#include "ngraph/ops.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    double tensor_bytes(const element::Type& type, const PartialShape& shape)
+    {
+        return shape.is_static() ? double(type.size()) * shape_size(shape.to_shape()) : 0;
+    }
+
+    // Length of the dimension a matrix product reduces over, from the shape of its first
+    // argument
+    size_t inner_dimension(const Shape& arg0_shape, bool transposed)
+    {
+        size_t rank = arg0_shape.size();
+        if (rank == 0)
+        {
+            return 1;
+        }
+        if (rank == 1)
+        {
+            return arg0_shape[0];
+        }
+        return transposed ? arg0_shape[rank - 2] : arg0_shape[rank - 1];
+    }
+
+    // Best time of `iterations` calls of a function of one op on the backend, in seconds,
+    // with the work of the op
+    double time_single_op(runtime::Backend& backend,
+                          shared_ptr<Node> op,
+                          const ParameterVector& parameters,
+                          OpCost& cost)
+    {
+        const size_t iterations = 5;
+        auto f = make_shared<Function>(op, parameters);
+        cost = estimate_op_cost(*op);
+        auto exec = backend.compile(f);
+        vector<shared_ptr<runtime::Tensor>> args;
+        for (const shared_ptr<op::v0::Parameter>& parameter : parameters)
+        {
+            auto tensor = backend.create_tensor(parameter->get_element_type(),
+                                                parameter->get_output_shape(0));
+            random_init(tensor);
+            args.push_back(tensor);
+        }
+        vector<shared_ptr<runtime::Tensor>> results{
+            backend.create_tensor(op->get_output_element_type(0), op->get_output_shape(0))};
+        // The first call initializes the kernels
+        exec->call(results, args);
+        double best = 0;
+        for (size_t i = 0; i < iterations; i++)
+        {
+            stopwatch timer;
+            timer.start();
+            exec->call(results, args);
+            timer.stop();
+            double seconds = timer.get_nanoseconds() / 1e9;
+            best = (i == 0 ? seconds : min(best, seconds));
+        }
+        return best;
+    }
+}
+
+OpCost estimate_op_cost(const Node& node)
+{
+    OpCost cost;
+    for (const Input<const Node>& input : node.inputs())
+    {
+        cost.bytes += tensor_bytes(input.get_element_type(), input.get_partial_shape());
+    }
+    for (const Output<const Node>& output : node.outputs())
+    {
+        cost.bytes += tensor_bytes(output.get_element_type(), output.get_partial_shape());
+    }
+    if (node.get_output_size() == 0 || node.get_output_partial_shape(0).is_dynamic() ||
+        (node.get_input_size() > 0 && node.get_input_partial_shape(0).is_dynamic()))
+    {
+        return cost;
+    }
+
+    const Shape& output_shape = node.get_output_shape(0);
+    double outputs = double(shape_size(output_shape));
+    string description = node.description();
+    if (auto dot = dynamic_cast<const op::v0::Dot*>(&node))
+    {
+        const Shape& arg0_shape = dot->get_input_shape(0);
+        size_t reduction_count = dot->get_reduction_axes_count();
+        size_t reduced = 1;
+        for (size_t i = arg0_shape.size() - reduction_count; i < arg0_shape.size(); i++)
+        {
+            reduced *= arg0_shape[i];
+        }
+        cost.flops = reduction_count == 0 ? outputs : 2 * outputs * reduced;
+    }
+    else if (auto matmul = dynamic_cast<const op::v0::MatMul*>(&node))
+    {
+        cost.flops =
+            2 * outputs * inner_dimension(matmul->get_input_shape(0), matmul->get_transpose_a());
+    }
+    else if (dynamic_cast<const op::v0::BatchMatMul*>(&node))
+    {
+        cost.flops = 2 * outputs * inner_dimension(node.get_input_shape(0), false);
+    }
+    else if (auto batch_matmul = dynamic_cast<const op::v0::BatchMatMulTranspose*>(&node))
+    {
+        cost.flops = 2 * outputs * inner_dimension(batch_matmul->get_input_shape(0),
+                                                   batch_matmul->get_transpose_arg0());
+    }
+    else if (description.find("Convolution") != string::npos &&
+             description.find("Backprop") == string::npos &&
+             description.find("Deformable") == string::npos && node.get_input_size() >= 2 &&
+             node.get_input_partial_shape(1).is_static() && node.get_input_shape(1).size() >= 3 &&
+             output_shape.size() >= 3 && output_shape[1] != 0)
+    {
+        // Every output element takes one multiply-add per filter element of its output
+        // channel, whether or not the filters are grouped. The fused CPU convolutions keep
+        // the filters as their second input too.
+        double filter_elements = double(shape_size(node.get_input_shape(1)));
+        cost.flops = 2 * outputs * filter_elements / output_shape[1];
+    }
+    else if (node.is_unary_elementwise_arithmetic() || node.is_binary_elementwise_arithmetic())
+    {
+        cost.flops = outputs;
+    }
+    else if (dynamic_cast<const op::util::ArithmeticReduction*>(&node))
+    {
+        cost.flops = double(shape_size(node.get_input_shape(0)));
+    }
+    return cost;
+}
+
+MachinePeaks measure_machine_peaks(const string& backend_name)
+{
+    auto backend = runtime::Backend::create(backend_name);
+    MachinePeaks peaks;
+
+    Shape matrix{1024, 1024};
+    auto a = make_shared<op::v0::Parameter>(element::f32, matrix);
+    auto b = make_shared<op::v0::Parameter>(element::f32, matrix);
+    OpCost dot_cost;
+    double dot_seconds =
+        time_single_op(*backend, make_shared<op::v0::Dot>(a, b), ParameterVector{a, b}, dot_cost);
+    peaks.gflops = dot_seconds == 0 ? 0 : dot_cost.flops / dot_seconds / 1e9;
+
+    // Large enough that the tensors do not fit in the caches
+    Shape elements{size_t(1) << 24};
+    auto x = make_shared<op::v0::Parameter>(element::f32, elements);
+    auto y = make_shared<op::v0::Parameter>(element::f32, elements);
+    OpCost add_cost;
+    double add_seconds =
+        time_single_op(*backend, make_shared<op::v1::Add>(x, y), ParameterVector{x, y}, add_cost);
+    peaks.gbytes_per_second = add_seconds == 0 ? 0 : add_cost.bytes / add_seconds / 1e9;
+    return peaks;
+}
+
+void print_roofline(ostream& out,
+                    const vector<runtime::PerformanceCounter>& perf_data,
+                    const MachinePeaks& peaks)
+{
+    struct Row
+    {
+        string name;
+        string type;
+        double seconds;
+        OpCost cost;
+        double bound_seconds;
+        bool compute_bound;
+    };
+    vector<Row> rows;
+    for (const runtime::PerformanceCounter& p : perf_data)
+    {
+        shared_ptr<const Node> node = p.get_node();
+        if (node == nullptr || p.call_count() == 0)
+        {
+            continue;
+        }
+        Row row;
+        row.name = node->get_name();
+        row.type = node->description();
+        row.seconds = double(p.total_microseconds()) / p.call_count() / 1e6;
+        row.cost = estimate_op_cost(*node);
+        if (row.cost.bytes == 0 && row.cost.flops == 0)
+        {
+            continue;
+        }
+        double compute_seconds = peaks.gflops == 0 ? 0 : row.cost.flops / (peaks.gflops * 1e9);
+        double memory_seconds =
+            peaks.gbytes_per_second == 0 ? 0 : row.cost.bytes / (peaks.gbytes_per_second * 1e9);
+        row.bound_seconds = max(compute_seconds, memory_seconds);
+        row.compute_bound = compute_seconds > memory_seconds;
+        rows.push_back(row);
+    }
+    // The ops furthest in time from their bound are where the model has the most to gain
+    sort(rows.begin(), rows.end(), [](const Row& r1, const Row& r2) {
+        return r1.seconds - r1.bound_seconds > r2.seconds - r2.bound_seconds;
+    });
+
+    out << "\n---- Roofline ----\n";
+    out << "Peak compute: " << fixed << setprecision(1) << peaks.gflops << " GFLOP/s\n";
+    out << "Peak bandwidth: " << peaks.gbytes_per_second << " GB/s\n";
+    out << "Ridge point: " << setprecision(2) << peaks.ridge_point() << " FLOP/byte\n";
+    size_t name_width = 4;
+    for (const Row& row : rows)
+    {
+        name_width = max(name_width, row.name.size() + row.type.size() + 3);
+    }
+    out << setw(name_width) << left << "op" << right << setw(10) << "us" << setw(10) << "MFLOP"
+        << setw(10) << "MB" << setw(10) << "FLOP/B" << setw(10) << "GFLOP/s" << setw(10)
+        << "GB/s" << setw(10) << "of bound" << setw(10) << "bound" << setw(10) << "lost us"
+        << "\n";
+    double total_seconds = 0;
+    double total_bound_seconds = 0;
+    for (const Row& row : rows)
+    {
+        double seconds = max(row.seconds, 1e-9);
+        out << setw(name_width) << left << (row.name + " (" + row.type + ")") << right
+            << setprecision(1) << setw(10) << row.seconds * 1e6 << setw(10)
+            << row.cost.flops / 1e6 << setw(10) << row.cost.bytes / 1e6 << setprecision(2)
+            << setw(10) << row.cost.arithmetic_intensity() << setprecision(1) << setw(10)
+            << row.cost.flops / seconds / 1e9 << setw(10) << row.cost.bytes / seconds / 1e9
+            << setw(9) << min(100.0, row.bound_seconds / seconds * 100) << "%" << setw(10)
+            << (row.compute_bound ? "compute" : "memory") << setw(10)
+            << max(0.0, row.seconds - row.bound_seconds) * 1e6 << "\n";
+        total_seconds += row.seconds;
+        total_bound_seconds += min(row.bound_seconds, row.seconds);
+    }
+    if (total_seconds > 0)
+    {
+        out << "Ops reach " << setprecision(1) << total_bound_seconds / total_seconds * 100
+            << "% of their roofline bound overall, " << (total_seconds - total_bound_seconds) * 1e6
+            << "us per call above it\n";
+    }
+    out << defaultfloat;
+}
@@ -0,0 +1,66 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "ngraph/node.hpp"
+#include "ngraph/runtime/performance_counter.hpp"
+
+/// \brief Work of one call of an op, estimated from its shapes
+struct OpCost
+{
+    /// \brief Floating point operations, a multiply-add counting as two. 0 for ops which only
+    ///        move data, or whose arithmetic is not modelled
+    double flops = 0;
+    /// \brief Bytes of the inputs read and of the outputs written, each once. This is the least
+    ///        traffic the op can have, as if every tensor were streamed through the caches
+    double bytes = 0;
+    double arithmetic_intensity() const { return bytes == 0 ? 0 : flops / bytes; }
+};
+
+/// \brief Estimates the work of `node` from its shapes. The arithmetic of Convolution, Dot,
+///        MatMul, BatchMatMul, elementwise arithmetic and arithmetic reductions is modelled;
+///        other ops only count the bytes they move.
+OpCost estimate_op_cost(const ngraph::Node& node);
+
+/// \brief Attainable rates of the machine
+struct MachinePeaks
+{
+    double gflops = 0;
+    double gbytes_per_second = 0;
+    /// \brief Arithmetic intensity above which an op is bound by compute rather than memory
+    double ridge_point() const
+    {
+        return gbytes_per_second == 0 ? 0 : gflops / gbytes_per_second;
+    }
+};
+
+/// \brief Measures the peaks on `backend_name` with its own kernels: a large single precision
+///        Dot for compute and a large Add for memory bandwidth. These are the rates a model can
+///        attain on the backend, which are below the figures of the data sheet.
+MachinePeaks measure_machine_peaks(const std::string& backend_name);
+
+/// \brief Prints, for every timed op, its FLOPs and bytes, the GFLOP/s and GB/s it achieved,
+///        its arithmetic intensity and the fraction of the roofline bound it reached, the ops
+///        wasting the most time against the bound first.
+void print_roofline(std::ostream& out,
+                    const std::vector<ngraph::runtime::PerformanceCounter>& perf_data,
+                    const MachinePeaks& peaks);
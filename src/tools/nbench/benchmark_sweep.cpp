@@ -0,0 +1,213 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+
+#include "benchmark_sweep.hpp"
+#include "benchmark_utils.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/host_tensor.hpp"
+#include "ngraph/runtime/tensor.hpp"
+#include "ngraph/specialize_function.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    using sweep_clock = chrono::steady_clock;
+
+    // Clone of f whose parameters are dynamic along axis
+    shared_ptr<Function> make_sweepable(const Function& f, size_t axis)
+    {
+        shared_ptr<Function> sweepable = clone_function(f);
+        bool swept = false;
+        for (const shared_ptr<op::v0::Parameter>& param : sweepable->get_parameters())
+        {
+            PartialShape shape = param->get_partial_shape();
+            if (shape.rank().is_static() && axis < static_cast<size_t>(shape.rank().get_length()))
+            {
+                shape[axis] = Dimension::dynamic();
+                param->set_partial_shape(shape);
+                swept = true;
+            }
+        }
+        NGRAPH_CHECK(swept, "No parameter of the model has a dimension ", axis, " to sweep");
+        sweepable->validate_nodes_and_infer_types();
+        return sweepable;
+    }
+
+    Shape sweep_shape(const PartialShape& shape, size_t axis, size_t size)
+    {
+        PartialShape swept = shape;
+        if (swept.rank().is_static() && axis < static_cast<size_t>(swept.rank().get_length()))
+        {
+            swept[axis] = size;
+        }
+        return swept.to_shape();
+    }
+
+    // Times the calls of exec with the given arguments into point
+    void measure(runtime::Executable& exec,
+                 const vector<shared_ptr<runtime::Tensor>>& results,
+                 const vector<shared_ptr<runtime::Tensor>>& args,
+                 const vector<shared_ptr<runtime::HostTensor>>& arg_data,
+                 size_t iterations,
+                 size_t warmup_iterations,
+                 bool copy_data,
+                 SweepPoint& point)
+    {
+        vector<char> result_buffer;
+        for (size_t i = 0; i < iterations + warmup_iterations + 1; i++)
+        {
+            auto call_start = sweep_clock::now();
+            if (copy_data)
+            {
+                for (size_t arg_index = 0; arg_index < args.size(); arg_index++)
+                {
+                    if (args[arg_index]->get_stale())
+                    {
+                        args[arg_index]->write(arg_data[arg_index]->get_data_ptr(),
+                                               arg_data[arg_index]->get_size_in_bytes());
+                    }
+                }
+            }
+            exec.call(results, args);
+            if (copy_data)
+            {
+                for (const shared_ptr<runtime::Tensor>& result : results)
+                {
+                    result_buffer.resize(result->get_size_in_bytes());
+                    result->read(result_buffer.data(), result_buffer.size());
+                }
+            }
+            double latency =
+                chrono::duration<double, micro>(sweep_clock::now() - call_start).count();
+            // The first call is reported on its own, then come the warm-up calls
+            if (i == 0)
+            {
+                point.first_call_ms = latency / 1000;
+            }
+            else if (i > warmup_iterations)
+            {
+                point.latencies.record(latency);
+            }
+        }
+    }
+
+    void print_sweep(const vector<SweepPoint>& points, size_t axis, bool dynamic)
+    {
+        stringstream ss;
+        ss << fixed << setprecision(3);
+        ss << "\n---- Sweep of dimension " << axis << (dynamic ? " (dynamic wrapper)" : "")
+           << " ----\n";
+        ss << setw(8) << "size" << setw(14) << (dynamic ? "recompile ms" : "compile ms")
+           << setw(14) << "first ms" << setw(12) << "mean ms" << setw(12) << "p50 ms"
+           << setw(12) << "p99 ms" << setw(16) << "items/s" << "\n";
+        for (const SweepPoint& point : points)
+        {
+            double mean = point.latencies.mean();
+            // Through the dynamic wrapper the first call of a size pays for its compilation
+            double compile_ms = dynamic ? point.first_call_ms - mean : point.compile_ms;
+            ss << setw(8) << point.size << setw(14) << compile_ms << setw(14)
+               << point.first_call_ms << setw(12) << mean << setw(12)
+               << point.latencies.percentile(50) << setw(12) << point.latencies.percentile(99)
+               << setw(16) << (mean > 0 ? point.size * 1000 / mean : 0) << "\n";
+        }
+        cout << ss.str();
+    }
+}
+
+vector<SweepPoint> run_benchmark_sweep(shared_ptr<Function> f,
+                                       const string& backend_name,
+                                       size_t iterations,
+                                       size_t warmup_iterations,
+                                       bool copy_data,
+                                       size_t axis,
+                                       const vector<size_t>& sizes,
+                                       bool dynamic)
+{
+    shared_ptr<Function> sweepable = make_sweepable(*f, axis);
+    auto backend = runtime::Backend::create(backend_name, dynamic);
+    shared_ptr<runtime::Executable> dynamic_exec;
+    if (dynamic)
+    {
+        dynamic_exec = backend->compile(sweepable);
+    }
+    set_denormals_flush_to_zero();
+
+    vector<SweepPoint> points;
+    for (size_t size : sizes)
+    {
+        SweepPoint point;
+        point.size = size;
+
+        vector<element::Type> parameter_types;
+        vector<PartialShape> parameter_shapes;
+        vector<shared_ptr<runtime::HostTensor>> arg_data;
+        vector<shared_ptr<runtime::Tensor>> args;
+        for (const shared_ptr<op::v0::Parameter>& param : sweepable->get_parameters())
+        {
+            Shape shape = sweep_shape(param->get_partial_shape(), axis, size);
+            auto tensor = backend->create_tensor(param->get_element_type(), shape);
+            auto tensor_data = make_shared<runtime::HostTensor>(param->get_element_type(), shape);
+            random_init(tensor_data);
+            tensor->write(tensor_data->get_data_ptr(), tensor_data->get_size_in_bytes());
+            if (param->get_cacheable())
+            {
+                tensor->set_stale(false);
+            }
+            args.push_back(tensor);
+            arg_data.push_back(tensor_data);
+            parameter_types.push_back(param->get_element_type());
+            parameter_shapes.push_back(shape);
+        }
+
+        shared_ptr<runtime::Executable> exec = dynamic_exec;
+        shared_ptr<Function> specialized = sweepable;
+        if (!dynamic)
+        {
+            stopwatch timer;
+            timer.start();
+            specialized = specialize_function(sweepable,
+                                              parameter_types,
+                                              parameter_shapes,
+                                              vector<void*>(parameter_types.size(), nullptr));
+            exec = backend->compile(specialized);
+            timer.stop();
+            point.compile_ms = timer.get_milliseconds();
+        }
+
+        vector<shared_ptr<runtime::Tensor>> results;
+        for (const shared_ptr<op::v0::Result>& result : specialized->get_results())
+        {
+            const PartialShape& shape = result->get_output_partial_shape(0);
+            const element::Type& type = result->get_output_element_type(0);
+            results.push_back(shape.is_static() ? backend->create_tensor(type, shape.to_shape())
+                                                : backend->create_dynamic_tensor(type, shape));
+        }
+
+        measure(*exec, results, args, arg_data, iterations, warmup_iterations, copy_data, point);
+        points.push_back(point);
+    }
+
+    print_sweep(points, axis, dynamic);
+    return points;
+}
@@ -0,0 +1,54 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "latency_histogram.hpp"
+#include "ngraph/function.hpp"
+
+/// \brief What was measured at one size of a shape sweep
+struct SweepPoint
+{
+    size_t size = 0;
+    /// \brief Time to specialize and compile the function for this size; 0 through the dynamic
+    /// wrapper, which compiles on the first call instead
+    double compile_ms = 0;
+    /// \brief Latency of the first call at this size, which through the dynamic wrapper includes
+    /// specializing and compiling the function
+    double first_call_ms = 0;
+    LatencyHistogram latencies;
+};
+
+/// \brief Benchmarks `f` with dimension `axis` of every parameter of rank greater than `axis`
+///        set to each of `sizes` in turn, e.g. the batch size for axis 0 or the sequence length
+///        for axis 1, and prints the throughput against the latency at every size.
+///
+/// The parameters of a clone of `f` are made dynamic along `axis`. Without `dynamic` the clone
+/// is specialized to every size with `specialize_function` and compiled for it. With `dynamic`
+/// the clone is compiled once on the dynamic wrapper of the backend and called with tensors of
+/// every size, so that the first call at a size measures the cost of the recompilation.
+std::vector<SweepPoint> run_benchmark_sweep(std::shared_ptr<ngraph::Function> f,
+                                            const std::string& backend_name,
+                                            size_t iterations,
+                                            size_t warmup_iterations,
+                                            bool copy_data,
+                                            size_t axis,
+                                            const std::vector<size_t>& sizes,
+                                            bool dynamic);
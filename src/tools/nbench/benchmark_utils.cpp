@@ -17,9 +17,16 @@
 #if defined(__x86_64__) || defined(__amd64__)
 #include <xmmintrin.h>
 #endif
+#include <algorithm>
+#include <fstream>
+#include <mutex>
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
 
 #include "benchmark_utils.hpp"
 #include "ngraph/file_util.hpp"
+#include "ngraph/pass/manager.hpp"
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/host_tensor.hpp"
 #include "ngraph/runtime/tensor.hpp"
@@ -68,6 +75,81 @@ void init_int_tensor<uint8_t>(shared_ptr<runtime::Tensor> tensor, uint8_t min, u
     tensor->write(vec.data(), vec.size() * sizeof(uint8_t));
 }
 
+void reset_peak_resident_bytes()
+{
+#if defined(__linux)
+    // Writing 5 to clear_refs resets the VmHWM of the process, since Linux 4.0
+    ofstream clear_refs("/proc/self/clear_refs");
+    clear_refs << "5";
+#endif
+}
+
+int64_t get_peak_resident_bytes()
+{
+#if defined(__linux)
+    ifstream status("/proc/self/status");
+    string line;
+    while (getline(status, line))
+    {
+        if (line.compare(0, 6, "VmHWM:") == 0)
+        {
+            return stoll(line.substr(6)) * 1024;
+        }
+    }
+#endif
+#if defined(__APPLE__)
+    // ru_maxrss is the peak over the life of the process, in bytes
+    rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+    {
+        return usage.ru_maxrss;
+    }
+#endif
+    return 0;
+}
+
+shared_ptr<runtime::Executable> compile_with_statistics(runtime::Backend& backend,
+                                                        shared_ptr<Function> f,
+                                                        bool timing_detail,
+                                                        ModelStatistics& statistics)
+{
+    mutex pass_mutex;
+    pass::Manager::set_profile_callback([&](const pass::PassProfile& profile) {
+        lock_guard<mutex> lock(pass_mutex);
+        auto it = find_if(statistics.pass_microseconds.begin(),
+                          statistics.pass_microseconds.end(),
+                          [&](const pair<string, size_t>& p) { return p.first == profile.name; });
+        if (it == statistics.pass_microseconds.end())
+        {
+            statistics.pass_microseconds.emplace_back(profile.name, profile.microseconds);
+        }
+        else
+        {
+            it->second += profile.microseconds;
+        }
+    });
+    reset_peak_resident_bytes();
+    stopwatch timer;
+    timer.start();
+    shared_ptr<runtime::Executable> exec;
+    try
+    {
+        exec = backend.compile(f, timing_detail);
+    }
+    catch (...)
+    {
+        pass::Manager::set_profile_callback(nullptr);
+        throw;
+    }
+    timer.stop();
+    pass::Manager::set_profile_callback(nullptr);
+
+    statistics.compile_ms = timer.get_milliseconds();
+    statistics.compile_peak_bytes = get_peak_resident_bytes();
+    statistics.temporary_pool_bytes = f->get_temporary_pool_size();
+    return exec;
+}
+
 void set_denormals_flush_to_zero()
 {
 #if defined(__x86_64__) || defined(__amd64__)
@@ -14,16 +14,59 @@
 // limitations under the License.
 //*****************************************************************************
 
+#pragma once
+
 #include <random>
+#include <string>
+#include <utility>
+#include <vector>
 
-#include "benchmark.hpp"
+#include "latency_histogram.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/host_tensor.hpp"
+#include "ngraph/runtime/memory_footprint.hpp"
 #include "ngraph/runtime/tensor.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
 
+/// \brief What nbench measures about a model besides the per-op timings
+struct ModelStatistics
+{
+    double deserialize_ms = 0;
+    double compile_ms = 0;
+    /// \brief Peak resident memory of the process during the import and the compile of the
+    /// model, or 0 where the platform does not report it
+    int64_t import_peak_bytes = 0;
+    int64_t compile_peak_bytes = 0;
+    /// \brief Size of the pool the backend assigned the temporaries of the model to, if it
+    /// compiles the function in place as the CPU backend does
+    size_t temporary_pool_bytes = 0;
+    size_t constant_bytes = 0;
+    /// \brief Time of each pass run during the compile, summed over its runs, in order of
+    /// first run
+    std::vector<std::pair<std::string, size_t>> pass_microseconds;
+    /// \brief Latency of the first call, which includes any lazy initialization
+    double first_call_ms = 0;
+    /// \brief Latencies of the measured calls
+    LatencyHistogram latencies;
+    /// \brief Memory the executable holds after the measured calls
+    ngraph::runtime::MemoryFootprint memory_footprint;
+};
+
+/// \brief Resets the peak resident memory of the process, where the platform allows it, so
+/// that get_peak_resident_bytes reports the peak from now on
+void reset_peak_resident_bytes();
+int64_t get_peak_resident_bytes();
+
+/// \brief Compiles `f` on `backend`, recording the compile time, the time of every pass run
+/// by the backend, the peak resident memory and the temporary pool size into `statistics`
+std::shared_ptr<ngraph::runtime::Executable>
+    compile_with_statistics(ngraph::runtime::Backend& backend,
+                            std::shared_ptr<ngraph::Function> f,
+                            bool timing_detail,
+                            ModelStatistics& statistics);
+
 void set_denormals_flush_to_zero();
 
 void random_init(std::shared_ptr<ngraph::runtime::Tensor> tensor);
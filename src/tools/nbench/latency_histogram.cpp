@@ -0,0 +1,207 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+#include "latency_histogram.hpp"
+
+using namespace std;
+
+// A bucket is 1/64 of a power of two wide above 128ns, and 1ns wide below
+static constexpr size_t s_precision_bits = 7;
+static constexpr size_t s_half_range = size_t(1) << (s_precision_bits - 1);
+static constexpr size_t s_bucket_count = (64 - s_precision_bits + 1) * s_half_range + s_half_range;
+
+static const vector<pair<string, double>> s_percentiles{
+    {"p50", 50}, {"p90", 90}, {"p99", 99}, {"p99.9", 99.9}};
+
+LatencyHistogram::LatencyHistogram()
+    : m_buckets(s_bucket_count, 0)
+    , m_count(0)
+    , m_min(numeric_limits<uint64_t>::max())
+    , m_max(0)
+    , m_sum(0)
+    , m_sum_of_squares(0)
+{
+}
+
+size_t LatencyHistogram::get_bucket(uint64_t value)
+{
+    size_t shift = 0;
+    while ((value >> shift) >= (uint64_t(1) << s_precision_bits))
+    {
+        shift++;
+    }
+    return shift * s_half_range + static_cast<size_t>(value >> shift);
+}
+
+uint64_t LatencyHistogram::get_bucket_value(size_t bucket)
+{
+    size_t shift = bucket < 2 * s_half_range ? 0 : bucket / s_half_range - 1;
+    uint64_t low = static_cast<uint64_t>(bucket - shift * s_half_range) << shift;
+    // the middle of the bucket
+    return low + ((uint64_t(1) << shift) >> 1);
+}
+
+void LatencyHistogram::record(double microseconds)
+{
+    double nanoseconds = std::max(microseconds * 1000, 0.0);
+    uint64_t value = static_cast<uint64_t>(llround(nanoseconds));
+    m_buckets[get_bucket(value)]++;
+    m_count++;
+    m_min = std::min(m_min, value);
+    m_max = std::max(m_max, value);
+    m_sum += nanoseconds;
+    m_sum_of_squares += nanoseconds * nanoseconds;
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other)
+{
+    for (size_t i = 0; i < m_buckets.size(); i++)
+    {
+        m_buckets[i] += other.m_buckets[i];
+    }
+    m_count += other.m_count;
+    m_min = std::min(m_min, other.m_min);
+    m_max = std::max(m_max, other.m_max);
+    m_sum += other.m_sum;
+    m_sum_of_squares += other.m_sum_of_squares;
+}
+
+double LatencyHistogram::min() const
+{
+    return m_count == 0 ? 0 : m_min / 1000.0;
+}
+
+double LatencyHistogram::max() const
+{
+    return m_max / 1000.0;
+}
+
+double LatencyHistogram::mean() const
+{
+    return m_count == 0 ? 0 : m_sum / m_count / 1000;
+}
+
+double LatencyHistogram::stddev() const
+{
+    if (m_count < 2)
+    {
+        return 0;
+    }
+    double average = m_sum / m_count;
+    double variance = (m_sum_of_squares - m_count * average * average) / (m_count - 1);
+    return sqrt(std::max(variance, 0.0)) / 1000;
+}
+
+double LatencyHistogram::coefficient_of_variation() const
+{
+    double m = mean();
+    return m == 0 ? 0 : stddev() / m;
+}
+
+double LatencyHistogram::percentile(double percent) const
+{
+    if (m_count == 0)
+    {
+        return 0;
+    }
+    // nearest rank
+    size_t rank = static_cast<size_t>(ceil(percent / 100 * m_count));
+    rank = std::min(std::max<size_t>(rank, 1), m_count);
+    size_t seen = 0;
+    for (size_t i = 0; i < m_buckets.size(); i++)
+    {
+        seen += m_buckets[i];
+        if (seen >= rank)
+        {
+            uint64_t value = std::min(std::max(get_bucket_value(i), m_min), m_max);
+            return value / 1000.0;
+        }
+    }
+    return max();
+}
+
+size_t LatencyHistogram::outliers() const
+{
+    double q1 = percentile(25);
+    double q3 = percentile(75);
+    double fence = (q3 + 1.5 * (q3 - q1)) * 1000;
+    size_t count = 0;
+    for (size_t i = 0; i < m_buckets.size(); i++)
+    {
+        if (m_buckets[i] > 0 && get_bucket_value(i) > fence)
+        {
+            count += m_buckets[i];
+        }
+    }
+    return count;
+}
+
+void LatencyHistogram::print(ostream& out) const
+{
+    stringstream ss;
+    ss << fixed << setprecision(3);
+    ss << "latency over " << m_count << " calls:" << endl;
+    ss << "    min " << min() / 1000 << "ms, mean " << mean() / 1000 << "ms, max "
+       << max() / 1000 << "ms" << endl;
+    ss << "   ";
+    for (auto& p : s_percentiles)
+    {
+        ss << " " << p.first << " " << percentile(p.second) / 1000 << "ms";
+    }
+    ss << endl;
+    ss << "    stddev " << stddev() / 1000 << "ms, cv " << coefficient_of_variation()
+       << ", outliers " << outliers() << endl;
+    out << ss.str();
+}
+
+string LatencyHistogram::csv_header()
+{
+    string header = "calls,min_ms,mean_ms,stddev_ms,cv";
+    for (auto& p : s_percentiles)
+    {
+        header += "," + p.first + "_ms";
+    }
+    return header + ",max_ms,outliers";
+}
+
+void LatencyHistogram::write_csv_row(ostream& out) const
+{
+    out << m_count << "," << min() / 1000 << "," << mean() / 1000 << "," << stddev() / 1000
+        << "," << coefficient_of_variation();
+    for (auto& p : s_percentiles)
+    {
+        out << "," << percentile(p.second) / 1000;
+    }
+    out << "," << max() / 1000 << "," << outliers();
+}
+
+void LatencyHistogram::write_json_members(ostream& out) const
+{
+    out << "\"calls\": " << m_count << ", \"min_ms\": " << min() / 1000
+        << ", \"mean_ms\": " << mean() / 1000 << ", \"stddev_ms\": " << stddev() / 1000
+        << ", \"cv\": " << coefficient_of_variation();
+    for (auto& p : s_percentiles)
+    {
+        out << ", \"" << p.first << "_ms\": " << percentile(p.second) / 1000;
+    }
+    out << ", \"max_ms\": " << max() / 1000 << ", \"outliers\": " << outliers();
+}
@@ -0,0 +1,69 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/// \brief HDR-style histogram of call latencies.
+///
+/// Latencies are counted in nanosecond buckets whose width grows with the value, so that any
+/// recorded latency is known within 1% whatever its magnitude, in constant memory. The
+/// count, minimum, maximum, mean and standard deviation are kept exactly.
+class LatencyHistogram
+{
+public:
+    LatencyHistogram();
+
+    void record(double microseconds);
+    void merge(const LatencyHistogram& other);
+
+    size_t count() const { return m_count; }
+    double min() const;
+    double max() const;
+    double mean() const;
+    double stddev() const;
+    /// Standard deviation over mean
+    double coefficient_of_variation() const;
+    /// Latency below which `percent` of the calls completed, in microseconds
+    double percentile(double percent) const;
+    /// Number of calls slower than the upper Tukey fence, Q3 + 1.5 * (Q3 - Q1)
+    size_t outliers() const;
+
+    /// Prints the statistics, in milliseconds
+    void print(std::ostream& out) const;
+
+    /// Names of the columns written by write_csv_row, in order
+    static std::string csv_header();
+    /// Writes the statistics, in milliseconds, as CSV fields
+    void write_csv_row(std::ostream& out) const;
+    /// Writes the statistics, in milliseconds, as the members of a JSON object
+    void write_json_members(std::ostream& out) const;
+
+private:
+    static size_t get_bucket(uint64_t value);
+    static uint64_t get_bucket_value(size_t bucket);
+
+    std::vector<uint64_t> m_buckets;
+    size_t m_count;
+    uint64_t m_min;
+    uint64_t m_max;
+    double m_sum;
+    double m_sum_of_squares;
+};
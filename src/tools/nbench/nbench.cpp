@@ -25,11 +25,16 @@
 // $ env LD_LIBRARY_PATH=$HOME/ngraph_dist/lib env NGRAPH_INTERPRETER_EMIT_TIMING=1 ./nbench
 // sample models are under ../../test/models
 
+#include <algorithm>
 #include <fstream>
 #include <iomanip>
 
 #include "benchmark.hpp"
+#include "benchmark_autotune.hpp"
+#include "benchmark_load.hpp"
 #include "benchmark_pipelined.hpp"
+#include "benchmark_roofline.hpp"
+#include "benchmark_sweep.hpp"
 #include "ngraph/distributed.hpp"
 #include "ngraph/except.hpp"
 #include "ngraph/file_util.hpp"
@@ -154,6 +159,176 @@ void print_results(vector<PerfShape> perf_data, bool timing_detail)
     }
 }
 
+static string json_string(const string& s)
+{
+    string escaped = "\"";
+    for (char c : s)
+    {
+        if (c == '"' || c == '\\')
+        {
+            escaped += '\\';
+        }
+        escaped += c;
+    }
+    return escaped + "\"";
+}
+
+// Prints what was measured about a model besides the op timings: compile time and memory,
+// and how far the first call is from the steady state
+void print_model_statistics(const ModelStatistics& stats, bool timing_detail)
+{
+    stringstream ss;
+    ss.imbue(locale(""));
+    ss << "\n---- Compile and Memory ----\n";
+    ss << "deserialize: " << stats.deserialize_ms << "ms, compile: " << stats.compile_ms
+       << "ms\n";
+    if (stats.import_peak_bytes > 0)
+    {
+        ss << "peak resident memory: " << stats.import_peak_bytes << " bytes after import, "
+           << stats.compile_peak_bytes << " bytes during compile\n";
+    }
+    ss << "constants: " << stats.constant_bytes << " bytes, temporary pool: "
+       << stats.temporary_pool_bytes << " bytes\n";
+    ss << "executable memory footprint:\n" << stats.memory_footprint;
+    ss << "first call: " << stats.first_call_ms << "ms";
+    if (stats.latencies.count() > 0)
+    {
+        ss << ", steady state mean: " << stats.latencies.mean() << "ms ("
+           << stats.first_call_ms / stats.latencies.mean() << "x)";
+    }
+    ss << "\n";
+    if (timing_detail && !stats.pass_microseconds.empty())
+    {
+        ss << "--\n";
+        ss << "compile passes:\n";
+        for (const pair<string, size_t>& pass_time : stats.pass_microseconds)
+        {
+            ss << "    " << pass_time.first << ": " << pass_time.second / 1000.0 << "ms\n";
+        }
+    }
+    cout << ss.str();
+}
+
+// Sums the time of every compile pass over all the models
+vector<pair<string, size_t>> aggregate_pass_times(const vector<ModelStatistics>& stats)
+{
+    vector<pair<string, size_t>> result;
+    for (const ModelStatistics& model_stats : stats)
+    {
+        for (const pair<string, size_t>& pass_time : model_stats.pass_microseconds)
+        {
+            auto it = find_if(result.begin(), result.end(), [&](const pair<string, size_t>& p) {
+                return p.first == pass_time.first;
+            });
+            if (it == result.end())
+            {
+                result.push_back(pass_time);
+            }
+            else
+            {
+                it->second += pass_time.second;
+            }
+        }
+    }
+    sort(result.begin(),
+         result.end(),
+         [](const pair<string, size_t>& a, const pair<string, size_t>& b) {
+             return a.second > b.second;
+         });
+    return result;
+}
+
+// Writes the statistics of the benchmarked models in the format implied by the file
+// extension, one JSON object or CSV row per model, for regressions to be tracked across builds
+void write_report(const string& file_name,
+                  const string& backend,
+                  const string& mode,
+                  int clients,
+                  const vector<string>& model_names,
+                  const vector<ModelStatistics>& model_stats)
+{
+    ofstream out(file_name);
+    if (!out)
+    {
+        throw runtime_error("Cannot write report file " + file_name);
+    }
+    if (file_util::get_file_ext(file_name) == ".csv")
+    {
+        out << "model,backend,mode,clients,deserialize_ms,compile_ms,import_peak_bytes,"
+               "compile_peak_bytes,constant_bytes,temporary_pool_bytes,footprint_bytes,"
+               "first_call_ms,"
+            << LatencyHistogram::csv_header() << "\n";
+        for (size_t i = 0; i < model_stats.size(); i++)
+        {
+            const ModelStatistics& stats = model_stats[i];
+            out << model_names[i] << "," << backend << "," << mode << "," << clients << ","
+                << stats.deserialize_ms << "," << stats.compile_ms << ","
+                << stats.import_peak_bytes << "," << stats.compile_peak_bytes << ","
+                << stats.constant_bytes << "," << stats.temporary_pool_bytes << ","
+                << stats.memory_footprint.get_total_bytes() << "," << stats.first_call_ms
+                << ",";
+            stats.latencies.write_csv_row(out);
+            out << "\n";
+        }
+    }
+    else
+    {
+        out << "[\n";
+        for (size_t i = 0; i < model_stats.size(); i++)
+        {
+            const ModelStatistics& stats = model_stats[i];
+            out << "    {\"model\": " << json_string(model_names[i])
+                << ", \"backend\": " << json_string(backend) << ", \"mode\": \"" << mode
+                << "\", \"clients\": " << clients
+                << ", \"deserialize_ms\": " << stats.deserialize_ms
+                << ", \"compile_ms\": " << stats.compile_ms
+                << ", \"import_peak_bytes\": " << stats.import_peak_bytes
+                << ", \"compile_peak_bytes\": " << stats.compile_peak_bytes
+                << ", \"constant_bytes\": " << stats.constant_bytes
+                << ", \"temporary_pool_bytes\": " << stats.temporary_pool_bytes
+                << ", \"footprint_bytes\": " << stats.memory_footprint.get_total_bytes()
+                << ", \"first_call_ms\": " << stats.first_call_ms << ", ";
+            stats.latencies.write_json_members(out);
+            out << ", \"passes\": {";
+            for (size_t j = 0; j < stats.pass_microseconds.size(); j++)
+            {
+                out << (j > 0 ? ", " : "") << json_string(stats.pass_microseconds[j].first)
+                    << ": " << stats.pass_microseconds[j].second / 1000.0;
+            }
+            out << "}}" << (i + 1 < model_stats.size() ? "," : "") << "\n";
+        }
+        out << "]\n";
+    }
+}
+
+// Parses the sizes of a sweep, either a list "1,2,4,8" or the powers of two of a range "1:64"
+vector<size_t> parse_sweep_sizes(const string& spec)
+{
+    vector<size_t> sizes;
+    size_t colon = spec.find(':');
+    if (colon != string::npos)
+    {
+        size_t first = stoul(spec.substr(0, colon));
+        size_t last = stoul(spec.substr(colon + 1));
+        for (size_t size = max<size_t>(first, 1); size <= last; size *= 2)
+        {
+            sizes.push_back(size);
+        }
+    }
+    else
+    {
+        for (const string& size : split(spec, ','))
+        {
+            sizes.push_back(stoul(size));
+        }
+    }
+    if (sizes.empty() || find(sizes.begin(), sizes.end(), 0) != sizes.end())
+    {
+        throw invalid_argument(spec);
+    }
+    return sizes;
+}
+
 int main(int argc, char** argv)
 {
     string model_arg;
@@ -169,6 +344,14 @@ int main(int argc, char** argv)
     bool dump_results = false;
     bool dot_file = false;
     bool double_buffer = false;
+    int clients = 0;
+    double qps = 0;
+    MachinePeaks peaks;
+    string report_file;
+    vector<size_t> sweep_sizes;
+    int sweep_axis = 0;
+    bool sweep_dynamic = false;
+    string autotune;
     string visualize_output_format = ".pdf";
 
     for (int i = 1; i < argc; i++)
@@ -236,6 +419,79 @@ int main(int argc, char** argv)
         {
             double_buffer = true;
         }
+        else if (arg == "-c" || arg == "--clients")
+        {
+            try
+            {
+                clients = stoi(argv[++i]);
+            }
+            catch (...)
+            {
+                cout << "Invalid Argument\n";
+                failed = true;
+            }
+        }
+        else if (arg == "--qps")
+        {
+            try
+            {
+                qps = stod(argv[++i]);
+            }
+            catch (...)
+            {
+                cout << "Invalid Argument\n";
+                failed = true;
+            }
+        }
+        else if (arg == "--peak_gflops" || arg == "--peak_gbps")
+        {
+            try
+            {
+                double& peak = (arg == "--peak_gflops" ? peaks.gflops : peaks.gbytes_per_second);
+                peak = stod(argv[++i]);
+            }
+            catch (...)
+            {
+                cout << "Invalid Argument\n";
+                failed = true;
+            }
+        }
+        else if (arg == "--sweep")
+        {
+            try
+            {
+                sweep_sizes = parse_sweep_sizes(argv[++i]);
+            }
+            catch (...)
+            {
+                cout << "Invalid Argument\n";
+                failed = true;
+            }
+        }
+        else if (arg == "--sweep_axis")
+        {
+            try
+            {
+                sweep_axis = stoi(argv[++i]);
+            }
+            catch (...)
+            {
+                cout << "Invalid Argument\n";
+                failed = true;
+            }
+        }
+        else if (arg == "--sweep_dynamic")
+        {
+            sweep_dynamic = true;
+        }
+        else if (arg == "--autotune")
+        {
+            autotune = argv[++i];
+        }
+        else if (arg == "--report")
+        {
+            report_file = argv[++i];
+        }
         else if (arg == "-w" || arg == "--warmup_iterations")
         {
             try
@@ -269,6 +525,32 @@ int main(int argc, char** argv)
         cout << "Either file or directory must be specified\n";
         failed = true;
     }
+    else if (peaks.gflops < 0 || peaks.gbytes_per_second < 0)
+    {
+        cout << "--peak_gflops and --peak_gbps must be positive\n";
+        failed = true;
+    }
+    else if (clients < 0 || qps < 0 || (qps > 0 && clients == 0))
+    {
+        cout << "--qps requires --clients, and both must be positive\n";
+        failed = true;
+    }
+    else if (sweep_axis < 0 || (!sweep_sizes.empty() && (clients > 0 || double_buffer)))
+    {
+        cout << "--sweep cannot be combined with --clients or --double_buffer\n";
+        failed = true;
+    }
+    else if (!autotune.empty() && autotune != "latency" && autotune != "throughput")
+    {
+        cout << "--autotune must be latency or throughput\n";
+        failed = true;
+    }
+    else if (!report_file.empty() && file_util::get_file_ext(report_file) != ".json" &&
+             file_util::get_file_ext(report_file) != ".csv")
+    {
+        cout << "Report file " << report_file << " must end with .json or .csv\n";
+        failed = true;
+    }
 
     if (failed)
     {
@@ -284,15 +566,38 @@ OPTIONS
         -b|--backend              Backend to use (default: CPU)
         -d|--directory            Directory to scan for models. All models are benchmarked.
         -i|--iterations           Iterations (default: 10)
-        -s|--statistics           Display op statistics
+        -s|--statistics           Display op statistics. With a backend, also time every op
+                                  and report its FLOPs, bytes, GFLOP/s, GB/s and arithmetic
+                                  intensity against the peaks of the machine
+        --peak_gflops             Peak compute of the machine for the roofline, measured with
+                                  a large Dot on the backend by default
+        --peak_gbps               Peak memory bandwidth of the machine for the roofline,
+                                  measured with a large Add on the backend by default
         -v|--visualize            Visualize a model (WARNING: requires Graphviz installed)
                                   Default pdf but takes optional arg to specify output extension
-        --timing_detail           Gather detailed timing
+        --timing_detail           Gather detailed timing, including the time of every compile
+                                  pass
         -w|--warmup_iterations    Number of warm-up iterations
         --no_copy_data            Disable copy of input/result data every iteration
         --dump_results            Dump result tensors to standard output.
         --dot                     Generate Graphviz dot file
         --double_buffer           Double buffer inputs and outputs
+        -c|--clients              Call the model from this many threads at once and report
+                                  throughput and latency percentiles. Iterations are per client
+        --qps                     With --clients, schedule calls at this total rate (open loop)
+                                  instead of calling back to back (closed loop)
+        --sweep                   Benchmark the model at each of these sizes of the swept
+                                  dimension, given as a list 1,2,4,8 or as a range 1:64 of
+                                  powers of two, and report throughput against latency
+        --sweep_axis              Dimension of the parameters to sweep (default: 0, the batch)
+        --sweep_dynamic           With --sweep, call one dynamic executable with every size
+                                  instead of specializing the model to each, to measure the
+                                  cost of its recompilation
+        --report                  Write the compile, memory and latency statistics of every
+                                  model to a .json or .csv file
+        --autotune                latency or throughput: time the model under every CPU
+                                  parallelism setting the autotuner tries, and store the
+                                  fastest in the compile cache when NGRAPH_CPU_CACHE_DIR is set
 )###";
         return 1;
     }
@@ -317,6 +622,10 @@ OPTIONS
     }
 
     vector<PerfShape> aggregate_perf_data;
+    vector<string> benchmarked_models;
+    vector<ModelStatistics> model_stats;
+    string mode = clients > 0 ? (qps > 0 ? "open_loop" : "closed_loop")
+                              : (double_buffer ? "pipelined" : "sequential");
     int rc = 0;
     for (const string& model : models)
     {
@@ -432,35 +741,109 @@ OPTIONS
             if (!backend.empty())
             {
                 cout << "\n---- Benchmark ----\n";
+                ModelStatistics model_statistics;
+                reset_peak_resident_bytes();
                 stopwatch t1;
                 t1.start();
                 shared_ptr<Function> f = deserialize(model);
+                t1.stop();
+                model_statistics.deserialize_ms = t1.get_milliseconds();
+                model_statistics.import_peak_bytes = get_peak_resident_bytes();
+                for (shared_ptr<Node> node : f->get_ops())
+                {
+                    if (node->is_constant())
+                    {
+                        model_statistics.constant_bytes +=
+                            node->get_output_element_type(0).size() *
+                            shape_size(node->get_output_shape(0));
+                    }
+                }
                 stringstream ss;
                 ss.imbue(locale(""));
-                ss << t1.get_milliseconds();
+                ss << model_statistics.deserialize_ms;
                 cout << "deserialize took " << ss.str() << "ms\n";
                 vector<runtime::PerformanceCounter> perf_data;
-                if (double_buffer)
+                // The roofline needs the time of every op
+                bool op_timing = timing_detail || statistics;
+                if (!autotune.empty())
+                {
+                    if (!run_benchmark_autotune(
+                            f, backend, iterations, autotune == "throughput"))
+                    {
+                        cout << "--autotune requires a CPU backend\n";
+                    }
+                    continue;
+                }
+                if (!sweep_sizes.empty())
+                {
+                    NGRAPH_CHECK(!dump_results, "'dump_results' not implemented in sweep mode");
+                    run_benchmark_sweep(f,
+                                        backend,
+                                        iterations,
+                                        warmup_iterations,
+                                        copy_data,
+                                        sweep_axis,
+                                        sweep_sizes,
+                                        sweep_dynamic);
+                    continue;
+                }
+                if (clients > 0)
+                {
+                    NGRAPH_CHECK(!dump_results, "'dump_results' not implemented in load mode");
+                    NGRAPH_CHECK(!double_buffer, "'double_buffer' not implemented in load mode");
+                    perf_data = run_benchmark_load(f,
+                                                   backend,
+                                                   iterations,
+                                                   op_timing,
+                                                   warmup_iterations,
+                                                   copy_data,
+                                                   clients,
+                                                   qps,
+                                                   model_statistics);
+                }
+                else if (double_buffer)
                 {
                     NGRAPH_CHECK(!dump_results,
                                  "'dump_results' not implemented in double buffer mode");
-                    perf_data = run_benchmark_pipelined(
-                        f, backend, iterations, timing_detail, warmup_iterations, copy_data);
+                    perf_data = run_benchmark_pipelined(f,
+                                                        backend,
+                                                        iterations,
+                                                        op_timing,
+                                                        warmup_iterations,
+                                                        copy_data,
+                                                        model_statistics);
                 }
                 else
                 {
                     perf_data = run_benchmark(f,
                                               backend,
                                               iterations,
-                                              timing_detail,
+                                              op_timing,
                                               warmup_iterations,
                                               copy_data,
-                                              dump_results);
+                                              dump_results,
+                                              model_statistics);
                 }
+                model_statistics.latencies.print(cout);
+                print_model_statistics(model_statistics, timing_detail);
+                benchmarked_models.push_back(model);
+                model_stats.push_back(model_statistics);
                 auto perf_shape = to_perf_shape(f, perf_data);
                 aggregate_perf_data.insert(
                     aggregate_perf_data.end(), perf_shape.begin(), perf_shape.end());
                 print_results(perf_shape, timing_detail);
+                if (statistics && !perf_data.empty())
+                {
+                    if (peaks.gflops == 0 || peaks.gbytes_per_second == 0)
+                    {
+                        MachinePeaks measured = measure_machine_peaks(backend);
+                        peaks.gflops = peaks.gflops == 0 ? measured.gflops : peaks.gflops;
+                        peaks.gbytes_per_second = peaks.gbytes_per_second == 0
+                                                      ? measured.gbytes_per_second
+                                                      : peaks.gbytes_per_second;
+                    }
+                    print_roofline(cout, perf_data, peaks);
+                }
             }
         }
         catch (ngraph::unsupported_op& ue)
@@ -482,6 +865,20 @@ OPTIONS
         cout << "---- Aggregate over all models\n";
         cout << "============================================================================\n";
         print_results(aggregate_perf_data, timing_detail);
+        if (timing_detail)
+        {
+            cout << "\n---- Compile passes ----\n";
+            for (const pair<string, size_t>& pass_time : aggregate_pass_times(model_stats))
+            {
+                cout << pass_time.first << ": " << pass_time.second / 1000.0 << "ms\n";
+            }
+        }
+    }
+
+    if (!report_file.empty())
+    {
+        write_report(
+            report_file, backend, mode, max(clients, 1), benchmarked_models, model_stats);
     }
 
     return rc;
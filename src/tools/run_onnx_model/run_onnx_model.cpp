@@ -14,14 +14,20 @@
 // limitations under the License.
 //*****************************************************************************
 #include <fstream>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <iostream>
 #include <random>
 #include <string>
+#include <thread>
 #include <tuple>
 
 #include "gtest/gtest.h"
+#include "latency_histogram.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/frontend/onnx_import/onnx.hpp"
+#include "ngraph/graph_util.hpp"
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/tensor.hpp"
 #include "ngraph/serializer.hpp"
@@ -38,15 +44,29 @@ void help()
 {
     cout << R"###(
 DESCRIPTION
-    Run an ONNX model
+    Run an ONNX model, optionally benchmarking it and checking its outputs on another backend
 
 SYNOPSIS
         run_onnx_model -m|--model <model file> [-i|--input <input file>]  [-b|--backend <backend name>]
+                       [-n|--iterations <count>] [-w|--warmup <count>] [-t|--threads <count>]
+                       [-r|--reference <backend name>] [--rtol <tolerance>] [--atol <tolerance>]
+                       [-q|--quiet]
 
 OPTIONS
-        -m or --model    Path to ONNX protobuf file with extension .onnx or .prototext  
-        -i or --input    Path to a raw binary file with an array of input data. If not provided, model will be executed with random data.
-        -b or --backend  nGraph backend name, such as INTERPRETER, CPU, GPU, NNP, INTELGPU, where available. Default backend: CPU
+        -m or --model       Path to ONNX protobuf file with extension .onnx or .prototext  
+        -i or --input       Path to a raw binary file with an array of input data. If not provided, model will be executed with random data.
+        -b or --backend     nGraph backend name, such as INTERPRETER, CPU, GPU, NNP, INTELGPU, where available. Default backend: CPU
+        -n or --iterations  Number of timed calls made by each thread. Default: 1
+        -w or --warmup      Number of untimed warm-up calls made by each thread. Default: 0
+        -t or --threads     Number of threads calling at once, on outputs of their own. Default: 1
+        -r or --reference   Backend whose outputs those of --backend must match, e.g. INTERPRETER
+        --rtol              Relative tolerance of the comparison with --reference. Default: 1e-5
+        --atol              Absolute tolerance of the comparison with --reference. Default: 1e-8
+        -q or --quiet       Do not print the outputs
+
+    The time taken to parse, convert, validate and compile the model is always reported, and the
+    latency percentiles and throughput of the calls when more than one is made. The exit status is
+    3 if a call fails or the outputs do not match those of the reference backend.
 
 )###";
 }
@@ -221,13 +241,58 @@ void print_outputs(const vector<shared_ptr<runtime::Tensor>>& outputs)
     }
 }
 
+// Compare outputs with those of a reference backend, element by element, within
+// atol + rtol * |reference|. Return whether they all match.
+bool compare_outputs(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                     const vector<shared_ptr<runtime::Tensor>>& reference_outputs,
+                     double rtol,
+                     double atol)
+{
+    bool all_match = true;
+    for (size_t i = 0; i < outputs.size(); i++)
+    {
+        vector<float> values = read_float_vector(outputs.at(i));
+        vector<float> reference = read_float_vector(reference_outputs.at(i));
+        size_t mismatches = 0;
+        double max_abs_diff = 0;
+        for (size_t j = 0; j < values.size(); j++)
+        {
+            double diff = std::abs(double(values[j]) - double(reference[j]));
+            // NaN differences count as mismatches and not towards the maximum
+            if (!(diff <= atol + rtol * std::abs(double(reference[j]))))
+            {
+                mismatches++;
+            }
+            if (diff > max_abs_diff)
+            {
+                max_abs_diff = diff;
+            }
+        }
+        cout << "Output " << i << " max abs diff: " << max_abs_diff << ", " << mismatches << " of "
+             << values.size() << " elements out of tolerance" << endl;
+        all_match = all_match && mismatches == 0;
+    }
+    return all_match;
+}
+
+double milliseconds_since(chrono::steady_clock::time_point start)
+{
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
 int main(int argc, char** argv)
 {
     vector<string> input_paths{};
     string model;
     string backend_type = "CPU";
+    string reference_type;
+    size_t iterations = 1;
+    size_t warmup = 0;
+    size_t thread_count = 1;
+    double rtol = 1e-5;
+    double atol = 1e-8;
+    bool quiet = false;
     vector<shared_ptr<runtime::Tensor>> inputs;
-    vector<shared_ptr<runtime::Tensor>> outputs;
     std::shared_ptr<ngraph::Function> function;
     std::shared_ptr<runtime::Backend> backend;
 
@@ -237,8 +302,24 @@ int main(int argc, char** argv)
         string arg2 = "";
         tie(arg, arg2) = validate_argument(arg, arg2);
 
+        if (arg == "-h" || arg == "--help")
+        {
+            help();
+            return 0;
+        }
+        else if (arg == "-q" || arg == "--quiet")
+        {
+            quiet = true;
+            continue;
+        }
+
         if (arg2 == "")
         {
+            if (i + 1 >= argc)
+            {
+                cout << "Missing value for " << arg << endl;
+                return 2;
+            }
             arg2 = argv[++i];
         }
 
@@ -254,18 +335,44 @@ int main(int argc, char** argv)
         {
             input_paths.push_back(arg2);
         }
-        else if (arg == "-h" || arg == "--help")
+        else if (arg == "-n" || arg == "--iterations")
         {
-            help();
-            return 0;
+            iterations = max<size_t>(stoul(arg2), 1);
+        }
+        else if (arg == "-w" || arg == "--warmup")
+        {
+            warmup = stoul(arg2);
+        }
+        else if (arg == "-t" || arg == "--threads")
+        {
+            thread_count = max<size_t>(stoul(arg2), 1);
+        }
+        else if (arg == "-r" || arg == "--reference")
+        {
+            reference_type = arg2;
+        }
+        else if (arg == "--rtol")
+        {
+            rtol = stod(arg2);
+        }
+        else if (arg == "--atol")
+        {
+            atol = stod(arg2);
         }
     }
 
     ifstream f(model);
     if (f)
     {
-        function = ngraph::onnx_import::import_onnx_model(model);
+        onnx_import::ImportStatistics statistics;
+        function = ngraph::onnx_import::import_onnx_model(model, statistics);
         cout << "Model file path:" << model << endl;
+        cout << "Parse time: " << statistics.parse_microseconds / 1000 << "ms" << endl;
+        cout << "Conversion time: " << statistics.convert_microseconds / 1000 << "ms" << endl;
+
+        auto validate_start = chrono::steady_clock::now();
+        function->validate_nodes_and_infer_types();
+        cout << "Validation time: " << milliseconds_since(validate_start) << "ms" << endl;
     }
     else
     {
@@ -273,13 +380,19 @@ int main(int argc, char** argv)
         return 1;
     }
 
+    std::shared_ptr<runtime::Backend> reference_backend;
     try
     {
         backend = ngraph::runtime::Backend::create(backend_type);
+        if (!reference_type.empty())
+        {
+            reference_backend = ngraph::runtime::Backend::create(reference_type);
+        }
     }
     catch (runtime_error e)
     {
-        cout << "Backend " << backend_type << " not supported." << endl;
+        cout << "Backend " << (backend ? reference_type : backend_type) << " not supported."
+             << endl;
         return 2;
     }
 
@@ -298,20 +411,109 @@ int main(int argc, char** argv)
         return 2;
     }
 
-    outputs = make_outputs(backend, function);
+    vector<vector<shared_ptr<runtime::Tensor>>> outputs(thread_count);
+    for (auto& thread_outputs : outputs)
+    {
+        thread_outputs = make_outputs(backend, function);
+    }
 
-    if (function)
+    // Compiling rewrites the function, so the reference compiles a copy made beforehand
+    std::shared_ptr<ngraph::Function> reference_function;
+    if (reference_backend)
     {
-        auto handle = backend->compile(function);
+        reference_function = clone_function(*function);
+    }
+
+    auto compile_start = chrono::steady_clock::now();
+    auto handle = backend->compile(function);
+    cout << "Compile time: " << milliseconds_since(compile_start) << "ms" << endl;
 
-        if (handle->call_with_validate(outputs, inputs))
+    if (!handle->call_with_validate(outputs[0], inputs))
+    {
+        cout << "FAILED" << endl;
+        return 3;
+    }
+
+    if (iterations > 1 || warmup > 0 || thread_count > 1)
+    {
+        vector<LatencyHistogram> latencies(thread_count);
+        vector<char> succeeded(thread_count, 1);
+        auto run_calls = [&](size_t calls, bool timed) {
+            vector<thread> threads;
+            for (size_t t = 0; t < thread_count; t++)
+            {
+                threads.emplace_back([&, t]() {
+                    for (size_t i = 0; i < calls && succeeded[t]; i++)
+                    {
+                        auto start = chrono::steady_clock::now();
+                        succeeded[t] = handle->call(outputs[t], inputs);
+                        if (timed)
+                        {
+                            latencies[t].record(
+                                chrono::duration<double, micro>(chrono::steady_clock::now() -
+                                                                start)
+                                    .count());
+                        }
+                    }
+                });
+            }
+            for (auto& t : threads)
+            {
+                t.join();
+            }
+        };
+
+        run_calls(warmup, false);
+        auto run_start = chrono::steady_clock::now();
+        run_calls(iterations, true);
+        double run_milliseconds = milliseconds_since(run_start);
+
+        if (find(succeeded.begin(), succeeded.end(), 0) != succeeded.end())
         {
-            print_outputs(outputs);
+            cout << "FAILED" << endl;
+            return 3;
         }
-        else
+        for (size_t t = 1; t < thread_count; t++)
         {
-            cout << "FAILED" << endl;
+            latencies[0].merge(latencies[t]);
+        }
+        cout << "Calls: " << iterations << " on each of " << thread_count << " threads after "
+             << warmup << " warm-up calls" << endl;
+        latencies[0].print(cout);
+        cout << "Throughput: " << latencies[0].count() * 1000 / run_milliseconds << " calls/s"
+             << endl;
+    }
+
+    if (!quiet)
+    {
+        print_outputs(outputs[0]);
+    }
+
+    if (reference_backend)
+    {
+        auto reference_outputs = make_outputs(reference_backend, reference_function);
+        vector<shared_ptr<runtime::Tensor>> reference_inputs;
+        for (auto& input : inputs)
+        {
+            auto tensor =
+                reference_backend->create_tensor(input->get_element_type(), input->get_shape());
+            vector<char> data(input->get_size_in_bytes());
+            input->read(data.data(), data.size());
+            tensor->write(data.data(), data.size());
+            reference_inputs.push_back(tensor);
+        }
+        auto reference_handle = reference_backend->compile(reference_function);
+        if (!reference_handle->call_with_validate(reference_outputs, reference_inputs))
+        {
+            cout << "Reference backend " << reference_type << " FAILED" << endl;
+            return 3;
+        }
+        if (!compare_outputs(outputs[0], reference_outputs, rtol, atol))
+        {
+            cout << "MISMATCH against " << reference_type << endl;
+            return 3;
         }
+        cout << "Outputs match " << reference_type << endl;
     }
 
     return 0;
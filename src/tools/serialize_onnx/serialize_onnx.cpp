@@ -33,11 +33,18 @@ DESCRIPTION
     Serialize an ONNX model
 
 SYNOPSIS
-        serialize_onnx [-i|--input <input file>] [-o|--output <output file>]
+        serialize_onnx [-i|--input <input file>] [-o|--output <output file>] [-b|--binary]
+                       [-z|--compress]
 
 OPTIONS
         -i or --input  input ONNX file
         -o or --output output serialized model
+        -b or --binary write a cpio archive holding the json graph and the raw constant data
+                       instead of a json file with hex encoded constants. Each constant is
+                       written straight from its buffer, and the archive can be loaded with
+                       ngraph::deserialize or memory-mapped with ngraph::deserialize_mapped.
+        -z or --compress with --binary, store constant data zlib compressed where that makes it
+                       smaller. Requires nGraph built with NGRAPH_ZLIB_ENABLE.
 )###";
 }
 
@@ -45,6 +52,8 @@ int main(int argc, char** argv)
 {
     string input;
     string output;
+    bool binary = false;
+    bool compress = false;
     for (int i = 1; i < argc; i++)
     {
         string arg = argv[i];
@@ -56,6 +65,14 @@ int main(int argc, char** argv)
         {
             input = argv[++i];
         }
+        else if (arg == "-b" || arg == "--binary")
+        {
+            binary = true;
+        }
+        else if (arg == "-z" || arg == "--compress")
+        {
+            compress = true;
+        }
         else if (arg == "-h" || arg == "--help")
         {
             help();
@@ -70,7 +87,14 @@ int main(int argc, char** argv)
 
         ngraph::stopwatch timer;
         timer.start();
-        ngraph::serialize(output, function, 2);
+        if (binary)
+        {
+            ngraph::serialize_to_cpio(output, function, 2, compress);
+        }
+        else
+        {
+            ngraph::serialize(output, function, 2);
+        }
         timer.stop();
         cout << "serialize took   " << timer.get_milliseconds() << "ms\n";
     }
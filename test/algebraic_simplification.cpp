@@ -34,6 +34,7 @@
 #include "ngraph/op/log.hpp"
 #include "ngraph/op/multiply.hpp"
 #include "ngraph/op/negative.hpp"
+#include "ngraph/op/power.hpp"
 #include "ngraph/op/product.hpp"
 #include "ngraph/op/sqrt.hpp"
 #include "ngraph/op/subtract.hpp"
@@ -47,8 +48,10 @@
 #include "ngraph/pattern/matcher.hpp"
 #include "ngraph/pattern/op/label.hpp"
 #include "ngraph/pattern/op/skip.hpp"
+#include "ngraph/runtime/backend.hpp"
 #include "ngraph/serializer.hpp"
 #include "util/all_close.hpp"
+#include "util/all_close_f.hpp"
 #include "util/matcher.hpp"
 #include "util/test_tools.hpp"
 
@@ -878,6 +881,174 @@ TEST(algebraic_simplification, log_no_divide)
     ASSERT_EQ(neg_inner->get_argument(0), log_mul);
 }
 
+TEST(algebraic_simplification, log_exp)
+{
+    auto a = make_shared<op::v0::Parameter>(element::f32, Shape{96, 100});
+    auto log_exp = make_shared<op::v0::Log>(make_shared<op::v0::Exp>(a));
+    auto exp_log = make_shared<op::v0::Exp>(make_shared<op::v0::Log>(log_exp));
+    auto f = std::make_shared<Function>(ngraph::OutputVector{exp_log}, ParameterVector{a});
+
+    // Only in fast math, as exp(log(x)) is NaN for negative x
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AlgebraicSimplification>();
+    pass_manager.run_passes(f);
+    ASSERT_EQ(count_ops_of_type<op::v0::Exp>(f), 2);
+
+    pass::Manager fast_math_manager;
+    fast_math_manager.register_pass<pass::AlgebraicSimplification>(true);
+    fast_math_manager.run_passes(f);
+    ASSERT_EQ(f->get_results().at(0)->get_argument(0), a);
+}
+
+TEST(algebraic_simplification, log_exp_integer)
+{
+    // log(exp(3)) is 2 in integers
+    auto a = make_shared<op::v0::Parameter>(element::i32, Shape{2});
+    auto log_exp = make_shared<op::v0::Log>(make_shared<op::v0::Exp>(a));
+    auto exp_log = make_shared<op::v0::Exp>(make_shared<op::v0::Log>(a));
+    auto f = make_shared<Function>(OutputVector{log_exp, exp_log}, ParameterVector{a});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AlgebraicSimplification>(true);
+    pass_manager.run_passes(f);
+    ASSERT_EQ(count_ops_of_type<op::v0::Exp>(f), 2);
+    ASSERT_EQ(count_ops_of_type<op::v0::Log>(f), 2);
+}
+
+TEST(algebraic_simplification, power_small_integer_exponents)
+{
+    for (int exponent : {1, 2, 3, 4})
+    {
+        auto a = make_shared<op::v0::Parameter>(element::f32, Shape{2, 3});
+        auto c = op::v0::Constant::create(element::f32, Shape{}, {exponent});
+        auto bc = make_shared<op::v0::Broadcast>(c, Shape{2, 3}, AxisSet{0, 1});
+        auto power = make_shared<op::v1::Power>(a, bc);
+        auto f = make_shared<Function>(OutputVector{power}, ParameterVector{a});
+
+        pass::Manager pass_manager;
+        pass_manager.register_pass<pass::AlgebraicSimplification>();
+        pass_manager.run_passes(f);
+
+        ASSERT_EQ(count_ops_of_type<op::v1::Power>(f), 0);
+        size_t multiplies = exponent == 1 ? 0 : (exponent == 2 ? 1 : 2);
+        ASSERT_EQ(count_ops_of_type<op::v1::Multiply>(f), multiplies);
+
+        auto backend = runtime::Backend::create("INTERPRETER");
+        auto t_a = backend->create_tensor(element::f32, Shape{2, 3});
+        copy_data(t_a, vector<float>{1, 2, 3, -1, -2, 0.5});
+        auto result = backend->create_tensor(element::f32, Shape{2, 3});
+        backend->compile(f)->call_with_validate({result}, {t_a});
+
+        vector<float> expected;
+        for (float x : {1.f, 2.f, 3.f, -1.f, -2.f, 0.5f})
+        {
+            expected.push_back(std::pow(x, exponent));
+        }
+        EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result)));
+    }
+}
+
+TEST(algebraic_simplification, power_negative)
+{
+    auto a = make_shared<op::v0::Parameter>(element::f32, Shape{2, 3});
+    auto b = make_shared<op::v0::Parameter>(element::f32, Shape{2, 3});
+    auto c = op::v0::Constant::create(element::f32, Shape{2, 3}, {5});
+    auto power_5 = make_shared<op::v1::Power>(a, c);
+    auto power_b = make_shared<op::v1::Power>(a, b);
+    auto f = make_shared<Function>(OutputVector{power_5, power_b}, ParameterVector{a, b});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AlgebraicSimplification>();
+    pass_manager.run_passes(f);
+    ASSERT_EQ(count_ops_of_type<op::v1::Power>(f), 2);
+}
+
+TEST(algebraic_simplification, divide_by_constant)
+{
+    auto a = make_shared<op::v0::Parameter>(element::f32, Shape{2, 2});
+    auto c = op::v0::Constant::create(element::f32, Shape{2, 2}, {2.0, 4.0, 0.5, 8.0});
+    auto s = op::v0::Constant::create(element::f32, Shape{}, {4});
+    auto bs = make_shared<op::v0::Broadcast>(s, Shape{2, 2}, AxisSet{0, 1});
+    auto div = make_shared<op::v1::Divide>(make_shared<op::v1::Divide>(a, c), bs);
+    auto f = make_shared<Function>(OutputVector{div}, ParameterVector{a});
+
+    // Only in fast math, as multiplying by the reciprocal may be an ulp off
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AlgebraicSimplification>();
+    pass_manager.run_passes(f);
+    ASSERT_EQ(count_ops_of_type<op::v1::Divide>(f), 2);
+
+    pass::Manager fast_math_manager;
+    fast_math_manager.register_pass<pass::AlgebraicSimplification>(true);
+    fast_math_manager.run_passes(f);
+    ASSERT_EQ(count_ops_of_type<op::v1::Divide>(f), 0);
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto t_a = backend->create_tensor(element::f32, Shape{2, 2});
+    copy_data(t_a, vector<float>{16, 32, 1, -64});
+    auto result = backend->create_tensor(element::f32, Shape{2, 2});
+    backend->compile(f)->call_with_validate({result}, {t_a});
+    EXPECT_TRUE(test::all_close_f((vector<float>{2, 2, 0.5, -2}), read_vector<float>(result)));
+}
+
+TEST(algebraic_simplification, divide_negative)
+{
+    auto a = make_shared<op::v0::Parameter>(element::f32, Shape{2, 2});
+    auto i = make_shared<op::v0::Parameter>(element::i32, Shape{2, 2});
+    auto zero = op::v0::Constant::create(element::f32, Shape{2, 2}, {1.0, 0.0, 2.0, 4.0});
+    auto int_c = op::v0::Constant::create(element::i32, Shape{2, 2}, {3});
+    auto div_zero = make_shared<op::v1::Divide>(a, zero);
+    auto div_int = make_shared<op::v1::Divide>(i, int_c);
+    auto f = make_shared<Function>(OutputVector{div_zero, div_int}, ParameterVector{a, i});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AlgebraicSimplification>(true);
+    pass_manager.run_passes(f);
+    ASSERT_EQ(count_ops_of_type<op::v1::Divide>(f), 2);
+}
+
+TEST(algebraic_simplification, sum_broadcast)
+{
+    auto a = make_shared<op::v0::Parameter>(element::f32, Shape{3});
+    auto broadcast = make_shared<op::v0::Broadcast>(a, Shape{4, 3, 5}, AxisSet{0, 2});
+    auto sum = make_shared<op::v0::Sum>(broadcast, AxisSet{2});
+    auto f = make_shared<Function>(OutputVector{sum}, ParameterVector{a});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AlgebraicSimplification>();
+    pass_manager.run_passes(f);
+    ASSERT_EQ(count_ops_of_type<op::v0::Sum>(f), 0);
+    auto new_broadcasts = get_ops_of_type<op::v0::Broadcast>(f);
+    ASSERT_EQ(count_if(new_broadcasts.begin(),
+                       new_broadcasts.end(),
+                       [&](const shared_ptr<op::v0::Broadcast>& b) {
+                           return b->input_value(0) == a &&
+                                  b->get_broadcast_axes() == AxisSet{0};
+                       }),
+              1);
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto t_a = backend->create_tensor(element::f32, Shape{3});
+    copy_data(t_a, vector<float>{1, 2, 3});
+    auto result = backend->create_tensor(element::f32, Shape{4, 3});
+    backend->compile(f)->call_with_validate({result}, {t_a});
+    EXPECT_TRUE(test::all_close_f((vector<float>{5, 10, 15, 5, 10, 15, 5, 10, 15, 5, 10, 15}),
+                                  read_vector<float>(result)));
+}
+
+TEST(algebraic_simplification, sum_broadcast_negative)
+{
+    auto a = make_shared<op::v0::Parameter>(element::f32, Shape{3});
+    auto broadcast = make_shared<op::v0::Broadcast>(a, Shape{4, 3}, AxisSet{0});
+    auto sum = make_shared<op::v0::Sum>(broadcast, AxisSet{1});
+    auto f = make_shared<Function>(OutputVector{sum}, ParameterVector{a});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AlgebraicSimplification>();
+    pass_manager.run_passes(f);
+    ASSERT_EQ(count_ops_of_type<op::v0::Sum>(f), 1);
+}
+
 TEST(algebraic_simplification, pass_property)
 {
     auto pass = std::make_shared<ngraph::pass::AlgebraicSimplification>();
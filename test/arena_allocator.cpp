@@ -0,0 +1,67 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "gtest/gtest.h"
+
+#include "ngraph/runtime/arena_allocator.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+TEST(arena_allocator, alignment)
+{
+    runtime::ArenaAllocator arena;
+    for (size_t alignment : {1, 8, 64, 4096})
+    {
+        void* ptr = arena.malloc(3, alignment);
+        EXPECT_EQ(reinterpret_cast<size_t>(ptr) % alignment, 0);
+    }
+    EXPECT_ANY_THROW(arena.malloc(8, 3));
+}
+
+TEST(arena_allocator, reset_reuses_memory)
+{
+    runtime::ArenaAllocator arena;
+    void* first = arena.malloc(100, 64);
+    arena.malloc(100, 64);
+    EXPECT_EQ(arena.get_system_allocation_count(), 1);
+    arena.reset();
+    EXPECT_EQ(arena.malloc(100, 64), first);
+    EXPECT_EQ(arena.get_system_allocation_count(), 1);
+    EXPECT_EQ(arena.get_allocation_count(), 3);
+}
+
+TEST(arena_allocator, coalesce_on_reset)
+{
+    runtime::ArenaAllocator arena(1024);
+    const size_t big = 1024 * 1024;
+    for (size_t i = 0; i < 4; i++)
+    {
+        arena.malloc(big, 64);
+    }
+    size_t system_allocations = arena.get_system_allocation_count();
+    EXPECT_GT(system_allocations, 1);
+    EXPECT_GE(arena.get_high_water_mark(), 4 * big);
+
+    // After a reset one block covers the whole previous cycle
+    arena.reset();
+    system_allocations = arena.get_system_allocation_count();
+    for (size_t i = 0; i < 4; i++)
+    {
+        arena.malloc(big, 64);
+    }
+    EXPECT_EQ(arena.get_system_allocation_count(), system_allocations);
+}
@@ -936,6 +936,20 @@ TEST(attributes, elu_op)
     EXPECT_EQ(g_elu->get_alpha(), elu->get_alpha());
 }
 
+TEST(attributes, allreduce_op)
+{
+    FactoryRegistry<Node>::get().register_factory<op::v0::AllReduce>();
+    auto data = make_shared<op::v0::Parameter>(element::f32, Shape{2, 4});
+
+    const auto allreduce = make_shared<op::v0::AllReduce>(
+        data, reduction::Type::SUM, reduction::Compression::BF16);
+    NodeBuilder builder(allreduce);
+    auto g_allreduce = as_type_ptr<op::v0::AllReduce>(builder.create());
+
+    EXPECT_EQ(g_allreduce->get_reduce_type(), allreduce->get_reduce_type());
+    EXPECT_EQ(g_allreduce->get_compression(), allreduce->get_compression());
+}
+
 TEST(attributes, fake_quantize_op)
 {
     FactoryRegistry<Node>::get().register_factory<opset1::FakeQuantize>();
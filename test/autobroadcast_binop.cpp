@@ -0,0 +1,217 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/autobroadcast_binop.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// The CoordinateTransform based NUMPY broadcast the reference used to implement, kept here as
+// the oracle for the strided implementation
+template <typename T, typename Functor>
+static void coordinate_autobroadcast_binop(const T* arg0,
+                                           const T* arg1,
+                                           T* out,
+                                           const Shape& arg0_shape,
+                                           const Shape& arg1_shape,
+                                           Functor elementwise_functor)
+{
+    Shape arg0_padded_shape = arg0_shape;
+    Shape arg1_padded_shape = arg1_shape;
+    while (arg0_padded_shape.size() < arg1_padded_shape.size())
+    {
+        arg0_padded_shape.insert(arg0_padded_shape.begin(), 1);
+    }
+    while (arg1_padded_shape.size() < arg0_padded_shape.size())
+    {
+        arg1_padded_shape.insert(arg1_padded_shape.begin(), 1);
+    }
+
+    Shape arg0_squeezed_shape;
+    Shape arg1_squeezed_shape;
+    AxisSet arg0_squeezed_axes;
+    AxisSet arg1_squeezed_axes;
+    Shape output_shape;
+    for (size_t i = 0; i < arg0_padded_shape.size(); i++)
+    {
+        if (arg0_padded_shape[i] == 1)
+        {
+            arg0_squeezed_axes.insert(i);
+        }
+        else
+        {
+            arg0_squeezed_shape.push_back(arg0_padded_shape[i]);
+        }
+        if (arg1_padded_shape[i] == 1)
+        {
+            arg1_squeezed_axes.insert(i);
+        }
+        else
+        {
+            arg1_squeezed_shape.push_back(arg1_padded_shape[i]);
+        }
+        output_shape.push_back(arg0_padded_shape[i] == 1 ? arg1_padded_shape[i]
+                                                         : arg0_padded_shape[i]);
+    }
+
+    CoordinateTransform arg0_transform(arg0_squeezed_shape);
+    CoordinateTransform arg1_transform(arg1_squeezed_shape);
+    CoordinateTransform output_transform(output_shape);
+    for (const Coordinate& output_coord : output_transform)
+    {
+        Coordinate arg0_coord = reduce(output_coord, arg0_squeezed_axes);
+        Coordinate arg1_coord = reduce(output_coord, arg1_squeezed_axes);
+        out[output_transform.index(output_coord)] =
+            elementwise_functor(arg0[arg0_transform.index(arg0_coord)],
+                                arg1[arg1_transform.index(arg1_coord)]);
+    }
+}
+
+static Shape broadcast_shape(const Shape& arg0_shape, const Shape& arg1_shape)
+{
+    Shape shape(max(arg0_shape.size(), arg1_shape.size()), 1);
+    for (size_t i = 0; i < shape.size(); i++)
+    {
+        size_t arg0_dim = i < shape.size() - arg0_shape.size()
+                              ? 1
+                              : arg0_shape[i - (shape.size() - arg0_shape.size())];
+        size_t arg1_dim = i < shape.size() - arg1_shape.size()
+                              ? 1
+                              : arg1_shape[i - (shape.size() - arg1_shape.size())];
+        shape[i] = arg0_dim == 1 ? arg1_dim : arg0_dim;
+    }
+    return shape;
+}
+
+static vector<float> iota_vector(size_t size, float start)
+{
+    vector<float> values(size);
+    for (size_t i = 0; i < size; i++)
+    {
+        values[i] = start + static_cast<float>(i);
+    }
+    return values;
+}
+
+static const vector<pair<Shape, Shape>> s_broadcast_cases{{Shape{2, 3, 4}, Shape{2, 3, 4}},
+                                                          {Shape{2, 3, 4}, Shape{}},
+                                                          {Shape{}, Shape{2, 3, 4}},
+                                                          {Shape{2, 3, 4}, Shape{4}},
+                                                          {Shape{4}, Shape{2, 3, 4}},
+                                                          {Shape{2, 3, 4}, Shape{3, 1}},
+                                                          {Shape{3, 2, 1}, Shape{1, 6}},
+                                                          {Shape{2, 1, 4, 1}, Shape{3, 1, 5}},
+                                                          {Shape{1, 1}, Shape{1}},
+                                                          {Shape{2, 0, 3}, Shape{3}},
+                                                          {Shape{5, 1, 1, 7}, Shape{5, 2, 3, 7}}};
+
+TEST(autobroadcast_binop, numpy_matches_coordinate_transform)
+{
+    auto subtract = [](float x, float y) { return x - 2 * y; };
+    for (auto& shapes : s_broadcast_cases)
+    {
+        const Shape& arg0_shape = shapes.first;
+        const Shape& arg1_shape = shapes.second;
+        Shape out_shape = broadcast_shape(arg0_shape, arg1_shape);
+        vector<float> arg0 = iota_vector(shape_size(arg0_shape), 1);
+        vector<float> arg1 = iota_vector(shape_size(arg1_shape), 100);
+        vector<float> expected(shape_size(out_shape));
+        vector<float> result(shape_size(out_shape));
+
+        coordinate_autobroadcast_binop(
+            arg0.data(), arg1.data(), expected.data(), arg0_shape, arg1_shape, subtract);
+        runtime::reference::autobroadcast_binop(arg0.data(),
+                                                arg1.data(),
+                                                result.data(),
+                                                arg0_shape,
+                                                arg1_shape,
+                                                op::AutoBroadcastSpec::NUMPY,
+                                                subtract);
+        EXPECT_EQ(result, expected) << arg0_shape << " " << arg1_shape;
+    }
+}
+
+TEST(autobroadcast_binop, pdpd)
+{
+    // arg1 [3, 1] aligned at axis 1 of arg0 [2, 3, 4]
+    Shape arg0_shape{2, 3, 4};
+    vector<float> arg0 = iota_vector(shape_size(arg0_shape), 0);
+    vector<float> arg1{10, 20, 30};
+    vector<float> result(arg0.size());
+    runtime::reference::autobroadcast_binop(arg0.data(),
+                                            arg1.data(),
+                                            result.data(),
+                                            arg0_shape,
+                                            Shape{3, 1},
+                                            op::AutoBroadcastSpec(op::AutoBroadcastType::PDPD, 1),
+                                            [](float x, float y) { return x + y; });
+    for (size_t i = 0; i < result.size(); i++)
+    {
+        EXPECT_EQ(result[i], arg0[i] + arg1[(i / 4) % 3]);
+    }
+}
+
+TEST(benchmark, autobroadcast_binop)
+{
+    auto add = [](float x, float y) { return x + y; };
+    const vector<pair<Shape, Shape>> cases{{Shape{64, 64, 64}, Shape{64, 64, 64}},
+                                           {Shape{64, 64, 64}, Shape{}},
+                                           {Shape{64, 64, 64}, Shape{64}},
+                                           {Shape{64, 64, 64}, Shape{64, 1}}};
+    for (auto& shapes : cases)
+    {
+        const Shape& arg0_shape = shapes.first;
+        const Shape& arg1_shape = shapes.second;
+        vector<float> arg0 = iota_vector(shape_size(arg0_shape), 1);
+        vector<float> arg1 = iota_vector(shape_size(arg1_shape), 2);
+        vector<float> out(shape_size(broadcast_shape(arg0_shape, arg1_shape)));
+        const size_t iterations = 10;
+
+        stopwatch generic_timer;
+        generic_timer.start();
+        for (size_t i = 0; i < iterations; i++)
+        {
+            coordinate_autobroadcast_binop(
+                arg0.data(), arg1.data(), out.data(), arg0_shape, arg1_shape, add);
+        }
+        generic_timer.stop();
+
+        stopwatch strided_timer;
+        strided_timer.start();
+        for (size_t i = 0; i < iterations; i++)
+        {
+            runtime::reference::autobroadcast_binop(arg0.data(),
+                                                    arg1.data(),
+                                                    out.data(),
+                                                    arg0_shape,
+                                                    arg1_shape,
+                                                    op::AutoBroadcastSpec::NUMPY,
+                                                    add);
+        }
+        strided_timer.stop();
+
+        cout << arg0_shape << " + " << arg1_shape << ": CoordinateTransform "
+             << generic_timer.get_microseconds() / iterations << "us, strided "
+             << strided_timer.get_microseconds() / iterations << "us" << endl;
+    }
+}
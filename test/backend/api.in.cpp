@@ -16,6 +16,7 @@
 
 #include "gtest/gtest.h"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/pipeline.hpp"
 #include "util/all_close_f.hpp"
 #include "util/ndarray.hpp"
 #include "util/random.hpp"
@@ -110,3 +111,90 @@ NGRAPH_TEST(${BACKEND_NAME}, get_parameters_and_results)
     //     EXPECT_NE(results[i], func_results[i]);
     // }
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, call_async)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::v1::Add>(A, B), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    shared_ptr<runtime::Tensor> a = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> b = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> r1 = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> r2 = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{5, 6, 7, 8});
+
+    auto handle = backend->compile(f);
+    // The second call reads the output of the first one
+    auto first = handle->call_async({r1}, {a, b});
+    auto second = handle->call_async({r2}, {r1, b});
+    // Writing an input waits for the calls reading it
+    copy_data(b, vector<float>{0, 0, 0, 0});
+    EXPECT_TRUE(first.get());
+    EXPECT_TRUE(second.get());
+    EXPECT_TRUE(test::all_close_f(
+        read_vector<float>(r1), vector<float>{6, 8, 10, 12}, MIN_FLOAT_TOLERANCE_BITS));
+    EXPECT_TRUE(test::all_close_f(
+        read_vector<float>(r2), vector<float>{11, 14, 17, 20}, MIN_FLOAT_TOLERANCE_BITS));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, pipeline)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::v1::Add>(A, B), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    runtime::Pipeline pipeline(backend->compile(f), 3);
+    ASSERT_EQ(pipeline.get_depth(), 3);
+
+    vector<size_t> drained;
+    auto fill = [](size_t iteration, const vector<shared_ptr<runtime::Tensor>>& inputs) {
+        if (iteration == 7)
+        {
+            return false;
+        }
+        float x = static_cast<float>(iteration);
+        copy_data(inputs[0], vector<float>{x, x, x, x});
+        copy_data(inputs[1], vector<float>{1, 2, 3, 4});
+        return true;
+    };
+    auto drain = [&drained](size_t iteration, const vector<shared_ptr<runtime::Tensor>>& outputs) {
+        float x = static_cast<float>(iteration);
+        EXPECT_TRUE(test::all_close_f(read_vector<float>(outputs[0]),
+                                      vector<float>{x + 1, x + 2, x + 3, x + 4},
+                                      MIN_FLOAT_TOLERANCE_BITS));
+        drained.push_back(iteration);
+    };
+    EXPECT_EQ(pipeline.run(fill, drain), 7);
+    EXPECT_EQ(drained, (vector<size_t>{0, 1, 2, 3, 4, 5, 6}));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, memory_footprint)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto K = op::v0::Constant::create(element::f32, shape, {1, 2, 3, 4});
+    auto f = make_shared<Function>(
+        make_shared<op::v0::Negative>(make_shared<op::v1::Multiply>(A, K)), ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto exec = backend->compile(f);
+    auto a = backend->create_tensor(element::f32, shape);
+    auto r = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 1, 1, 1});
+    ASSERT_TRUE(exec->call_with_validate({r}, {a}));
+
+    runtime::MemoryFootprint footprint = exec->get_memory_footprint();
+    EXPECT_GE(footprint.constant_bytes + footprint.converted_constant_bytes, 16);
+    EXPECT_GE(footprint.get_total_bytes(),
+              footprint.constant_bytes + footprint.converted_constant_bytes);
+    stringstream ss;
+    ss << footprint;
+    EXPECT_NE(ss.str().find("total: " + to_string(footprint.get_total_bytes()) + " bytes"),
+              string::npos);
+}
@@ -663,3 +663,41 @@ NGRAPH_TEST(${BACKEND_NAME}, argmin_trivial_in_double)
     handle->call_with_validate({result}, {a});
     EXPECT_EQ((vector<int32_t>{3, 2, 1}), read_vector<int32_t>(result));
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, argmax_argmin_long_axis_first_of_ties)
+{
+    // A vocabulary-sized innermost axis with repeated extremes
+    Shape shape{3, 1000};
+    Shape rshape{3};
+    vector<float> a_data(shape_size(shape));
+    for (size_t i = 0; i < a_data.size(); ++i)
+    {
+        a_data[i] = static_cast<float>((i * 31) % 97);
+    }
+
+    vector<int64_t> expected_max, expected_min;
+    for (size_t row = 0; row < shape[0]; ++row)
+    {
+        auto first = a_data.begin() + row * shape[1];
+        auto last = first + shape[1];
+        expected_max.push_back(std::max_element(first, last) - first);
+        expected_min.push_back(std::min_element(first, last) - first);
+    }
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, a_data);
+    auto result = backend->create_tensor(element::i64, rshape);
+
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto f_max =
+        make_shared<Function>(make_shared<op::v0::ArgMax>(A, 1, element::i64), ParameterVector{A});
+    backend->compile(f_max)->call_with_validate({result}, {a});
+    EXPECT_EQ(expected_max, read_vector<int64_t>(result));
+
+    auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto f_min =
+        make_shared<Function>(make_shared<op::v0::ArgMin>(B, 1, element::i64), ParameterVector{B});
+    backend->compile(f_min)->call_with_validate({result}, {a});
+    EXPECT_EQ(expected_min, read_vector<int64_t>(result));
+}
@@ -0,0 +1,131 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "util/all_close_f.hpp"
+#include "util/test_control.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string s_manifest = "${MANIFEST}";
+
+NGRAPH_TEST(${BACKEND_NAME}, binary_convolution_2d)
+{
+    auto data = make_shared<op::v0::Parameter>(element::f32, Shape{1, 1, 3, 3});
+    auto filters = op::v0::Constant::create(element::f32, Shape{1, 1, 2, 2}, {1, 0, 0, 1});
+    auto conv = make_shared<op::v1::BinaryConvolution>(data,
+                                                       filters,
+                                                       Strides{1, 1},
+                                                       CoordinateDiff{0, 0},
+                                                       CoordinateDiff{0, 0},
+                                                       Strides{1, 1},
+                                                       "xnor-popcount",
+                                                       0.0f);
+    auto f = make_shared<Function>(conv, ParameterVector{data});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::f32, Shape{1, 1, 3, 3});
+    copy_data(a, vector<float>{1, 0, 1, 0, 1, 1, 1, 1, 0});
+    auto result = backend->create_tensor(element::f32, Shape{1, 1, 2, 2});
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a});
+    EXPECT_TRUE(test::all_close_f((vector<float>{4, -2, -2, -2}), read_vector<float>(result)));
+}
+
+// More channels than fit in a word, strides and padding, against a direct sum of +1 and -1
+NGRAPH_TEST(${BACKEND_NAME}, binary_convolution_padded)
+{
+    Shape data_shape{2, 70, 5, 5};
+    Shape filters_shape{3, 70, 3, 3};
+    Shape out_shape{2, 3, 3, 3};
+    const size_t stride = 2;
+    const float pad_value = 1.0f;
+    auto data = make_shared<op::v0::Parameter>(element::f32, data_shape);
+    auto filters = make_shared<op::v0::Parameter>(element::f32, filters_shape);
+    auto conv = make_shared<op::v1::BinaryConvolution>(data,
+                                                       filters,
+                                                       Strides{stride, stride},
+                                                       CoordinateDiff{1, 1},
+                                                       CoordinateDiff{1, 1},
+                                                       Strides{1, 1},
+                                                       "xnor-popcount",
+                                                       pad_value);
+    ASSERT_EQ(conv->get_output_shape(0), out_shape);
+    auto f = make_shared<Function>(conv, ParameterVector{data, filters});
+
+    vector<float> data_values(shape_size(data_shape));
+    for (size_t i = 0; i < data_values.size(); i++)
+    {
+        data_values[i] = (i * 7 + 3) % 5 > 1 ? 1.0f : 0.0f;
+    }
+    vector<float> filter_values(shape_size(filters_shape));
+    for (size_t i = 0; i < filter_values.size(); i++)
+    {
+        filter_values[i] = (i * 11 + 1) % 3 == 0 ? 1.0f : 0.0f;
+    }
+    auto sign = [](float value) { return value > 0 ? 1.0f : -1.0f; };
+    vector<float> expected(shape_size(out_shape), 0);
+    size_t channels = data_shape[1];
+    size_t size = data_shape[2];
+    for (size_t n = 0; n < out_shape[0]; n++)
+    {
+        for (size_t o = 0; o < out_shape[1]; o++)
+        {
+            for (size_t y = 0; y < out_shape[2]; y++)
+            {
+                for (size_t x = 0; x < out_shape[3]; x++)
+                {
+                    float sum = 0;
+                    for (size_t c = 0; c < channels; c++)
+                    {
+                        for (size_t ky = 0; ky < 3; ky++)
+                        {
+                            for (size_t kx = 0; kx < 3; kx++)
+                            {
+                                ptrdiff_t iy = ptrdiff_t(y * stride + ky) - 1;
+                                ptrdiff_t ix = ptrdiff_t(x * stride + kx) - 1;
+                                bool inside = iy >= 0 && ix >= 0 && iy < ptrdiff_t(size) &&
+                                              ix < ptrdiff_t(size);
+                                float value =
+                                    inside ? data_values[((n * channels + c) * size + iy) * size +
+                                                         ix]
+                                           : pad_value;
+                                float weight =
+                                    filter_values[((o * channels + c) * 3 + ky) * 3 + kx];
+                                sum += sign(value) * sign(weight);
+                            }
+                        }
+                    }
+                    expected[((n * out_shape[1] + o) * out_shape[2] + y) * out_shape[3] + x] =
+                        sum;
+                }
+            }
+        }
+    }
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::f32, data_shape);
+    copy_data(a, data_values);
+    auto b = backend->create_tensor(element::f32, filters_shape);
+    copy_data(b, filter_values);
+    auto result = backend->create_tensor(element::f32, out_shape);
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result)));
+}
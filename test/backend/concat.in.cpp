@@ -14,6 +14,8 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <numeric>
+
 #include "gtest/gtest.h"
 #include "ngraph/ngraph.hpp"
 #include "util/all_close.hpp"
@@ -731,3 +733,49 @@ NGRAPH_TEST(${BACKEND_NAME}, concat_zero_length_4d_middle)
                                   read_vector<float>(result),
                                   MIN_FLOAT_TOLERANCE_BITS));
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, concat_many_blocks_middle_axis)
+{
+    // Many small blocks, as when appending to a cache, plus one block with rows large enough
+    // to be copied in several pieces
+    vector<size_t> lengths{1, 2, 1, 3, 1, 1, 2, 1, 20000, 1, 4, 1};
+    ParameterVector params;
+    OutputVector args;
+    vector<vector<int32_t>> data;
+    int32_t next = 0;
+    for (auto length : lengths)
+    {
+        params.push_back(make_shared<op::v0::Parameter>(element::i32, Shape{2, length, 3}));
+        args.push_back(params.back());
+        data.emplace_back(2 * length * 3);
+        for (auto& value : data.back())
+        {
+            value = next++;
+        }
+    }
+    size_t total_length = accumulate(lengths.begin(), lengths.end(), size_t(0));
+    auto f = make_shared<Function>(make_shared<op::v0::Concat>(args, 1), params);
+
+    vector<int32_t> expected;
+    for (size_t n = 0; n < 2; ++n)
+    {
+        for (size_t i = 0; i < lengths.size(); ++i)
+        {
+            auto row = data[i].begin() + n * lengths[i] * 3;
+            expected.insert(expected.end(), row, row + lengths[i] * 3);
+        }
+    }
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    vector<shared_ptr<runtime::Tensor>> inputs;
+    for (size_t i = 0; i < lengths.size(); ++i)
+    {
+        inputs.push_back(backend->create_tensor(element::i32, Shape{2, lengths[i], 3}));
+        copy_data(inputs.back(), data[i]);
+    }
+    auto result = backend->create_tensor(element::i32, Shape{2, total_length, 3});
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, inputs);
+    EXPECT_EQ(expected, read_vector<int32_t>(result));
+}
@@ -0,0 +1,71 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "util/all_close_f.hpp"
+#include "util/test_control.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string s_manifest = "${MANIFEST}";
+
+// Frames of [T, N, C] logits whose largest class is `classes` [T, N], the last class, 2,
+// being the blank
+static vector<float> ctc_logits(const vector<size_t>& classes)
+{
+    vector<float> logits(classes.size() * 3, 0.0f);
+    for (size_t i = 0; i < classes.size(); i++)
+    {
+        logits[i * 3 + classes[i]] = 1.0f;
+    }
+    return logits;
+}
+
+static vector<float> ctc_decode(bool merge_repeated, const string& backend_name)
+{
+    Shape data_shape{4, 2, 3};
+    auto data = make_shared<op::v0::Parameter>(element::f32, data_shape);
+    auto mask = make_shared<op::v0::Parameter>(element::f32, Shape{4, 2});
+    auto decoder = make_shared<op::v0::CTCGreedyDecoder>(data, mask, merge_repeated);
+    EXPECT_EQ(decoder->get_output_shape(0), (Shape{2, 4, 1, 1}));
+    auto f = make_shared<Function>(decoder, ParameterVector{data, mask});
+
+    auto backend = runtime::Backend::create(backend_name);
+    auto a = backend->create_tensor(element::f32, data_shape);
+    // Batch element 0 decodes 1 1 blank 1, batch element 1 0 0 1 and a masked 0
+    copy_data(a, ctc_logits({1, 0, 1, 0, 2, 1, 1, 0}));
+    auto b = backend->create_tensor(element::f32, Shape{4, 2});
+    copy_data(b, vector<float>{1, 1, 1, 1, 1, 1, 1, 0});
+    auto result = backend->create_tensor(element::f32, Shape{2, 4, 1, 1});
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, b});
+    return read_vector<float>(result);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, ctc_greedy_decoder_merge_repeated)
+{
+    EXPECT_TRUE(test::all_close_f((vector<float>{1, 1, -1, -1, 0, 1, -1, -1}),
+                                  ctc_decode(true, "${BACKEND_NAME}")));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, ctc_greedy_decoder_keep_repeated)
+{
+    EXPECT_TRUE(test::all_close_f((vector<float>{1, 1, 1, -1, 0, 0, 1, -1}),
+                                  ctc_decode(false, "${BACKEND_NAME}")));
+}
@@ -209,3 +209,57 @@ NGRAPH_TEST(${BACKEND_NAME}, cum_sum_2dim_allmodes)
     test_cum_sum_allmodes(0, 1, 1);
     test_cum_sum_allmodes(0, 0, 1);
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, cum_sum_long_axis_allmodes)
+{
+    // Long enough for the axis to be scanned in blocks
+    Shape shape{2, 20000};
+    vector<int32_t> a_data(shape_size(shape));
+    for (size_t i = 0; i < a_data.size(); ++i)
+    {
+        a_data[i] = static_cast<int32_t>(i % 7) - 3;
+    }
+
+    for (int exclusive = 0; exclusive < 2; ++exclusive)
+    {
+        for (int reverse = 0; reverse < 2; ++reverse)
+        {
+            auto A = make_shared<op::v0::Parameter>(element::i32, shape);
+            auto axis = make_shared<op::v0::Parameter>(element::i64, Shape{1});
+            auto f = make_shared<Function>(
+                make_shared<op::v0::CumSum>(A, axis, exclusive, reverse),
+                ParameterVector{A, axis});
+
+            vector<int32_t> expected(a_data.size());
+            for (size_t row = 0; row < shape[0]; ++row)
+            {
+                int32_t sum = 0;
+                for (size_t k = 0; k < shape[1]; ++k)
+                {
+                    size_t i = row * shape[1] + (reverse ? shape[1] - 1 - k : k);
+                    if (exclusive)
+                    {
+                        expected[i] = sum;
+                        sum += a_data[i];
+                    }
+                    else
+                    {
+                        sum += a_data[i];
+                        expected[i] = sum;
+                    }
+                }
+            }
+
+            auto backend = runtime::Backend::create("${BACKEND_NAME}");
+            auto a = backend->create_tensor(element::i32, shape);
+            copy_data(a, a_data);
+            auto axis_tensor = backend->create_tensor(element::i64, Shape{1});
+            copy_data(axis_tensor, vector<int64_t>{1});
+            auto result = backend->create_tensor(element::i32, shape);
+
+            auto handle = backend->compile(f);
+            handle->call_with_validate({result}, {a, axis_tensor});
+            EXPECT_EQ(expected, read_vector<int32_t>(result));
+        }
+    }
+}
@@ -0,0 +1,68 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/data_parallel_executable.hpp"
+#include "util/all_close_f.hpp"
+#include "util/test_control.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string s_manifest = "${MANIFEST}";
+
+NGRAPH_TEST(${BACKEND_NAME}, data_parallel_executable)
+{
+    // A batch of 3 rows times weights, and the sum of the products over the batch
+    auto X = make_shared<op::v0::Parameter>(element::f32, Shape{3, 2});
+    auto W = make_shared<op::v0::Parameter>(element::f32, Shape{2, 2});
+    auto Y = make_shared<op::v0::Dot>(X, W);
+    auto G = make_shared<op::v0::Sum>(Y, AxisSet{0});
+    auto f = make_shared<Function>(OutputVector{Y, G}, ParameterVector{X, W});
+
+    vector<shared_ptr<runtime::Backend>> backends{runtime::Backend::create("${BACKEND_NAME}"),
+                                                  runtime::Backend::create("${BACKEND_NAME}")};
+    runtime::DataParallelExecutable exec(f, backends);
+
+    using slice = pair<size_t, size_t>;
+    EXPECT_EQ(exec.get_slices(), (vector<slice>{slice(0, 2), slice(2, 3)}));
+    EXPECT_EQ(exec.get_split_inputs(), (vector<bool>{true, false}));
+    EXPECT_EQ(exec.get_gathered_outputs(), (vector<bool>{true, false}));
+
+    auto x = backends[0]->create_tensor(element::f32, Shape{3, 2});
+    auto w = backends[0]->create_tensor(element::f32, Shape{2, 2});
+    copy_data(x, vector<float>{1, 2, 3, 4, 5, 6});
+    copy_data(w, vector<float>{1, 0, 1, 1});
+    auto y = backends[0]->create_tensor(element::f32, Shape{3, 2});
+    auto g = backends[0]->create_tensor(element::f32, Shape{2});
+    ASSERT_TRUE(exec.call_with_validate({y, g}, {x, w}));
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(y),
+                                  vector<float>{3, 2, 7, 4, 11, 6},
+                                  MIN_FLOAT_TOLERANCE_BITS));
+    EXPECT_TRUE(
+        test::all_close_f(read_vector<float>(g), vector<float>{21, 12}, MIN_FLOAT_TOLERANCE_BITS));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, data_parallel_executable_batch_too_small)
+{
+    auto X = make_shared<op::v0::Parameter>(element::f32, Shape{1, 2});
+    auto f = make_shared<Function>(make_shared<op::v0::Negative>(X), ParameterVector{X});
+    vector<shared_ptr<runtime::Backend>> backends{runtime::Backend::create("${BACKEND_NAME}"),
+                                                  runtime::Backend::create("${BACKEND_NAME}")};
+    EXPECT_THROW(runtime::DataParallelExecutable(f, backends), ngraph_error);
+}
@@ -0,0 +1,114 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "util/all_close_f.hpp"
+#include "util/test_control.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string s_manifest = "${MANIFEST}";
+
+// Without offsets a deformable convolution is a convolution
+NGRAPH_TEST(${BACKEND_NAME}, deformable_convolution_zero_offsets)
+{
+    Shape data_shape{2, 3, 5, 5};
+    Shape offsets_shape{2, 18, 3, 3};
+    Shape filters_shape{4, 3, 3, 3};
+    Shape out_shape{2, 4, 3, 3};
+    auto data = make_shared<op::v0::Parameter>(element::f32, data_shape);
+    auto offsets = make_shared<op::v0::Parameter>(element::f32, offsets_shape);
+    auto filters = make_shared<op::v0::Parameter>(element::f32, filters_shape);
+    auto deformable = make_shared<op::v1::DeformableConvolution>(data,
+                                                                 offsets,
+                                                                 filters,
+                                                                 Strides{2, 2},
+                                                                 CoordinateDiff{1, 1},
+                                                                 CoordinateDiff{1, 1},
+                                                                 Strides{1, 1});
+    auto conv = make_shared<op::v0::Convolution>(
+        data, filters, Strides{2, 2}, Strides{1, 1}, CoordinateDiff{1, 1}, CoordinateDiff{1, 1});
+    ASSERT_EQ(deformable->get_output_shape(0), out_shape);
+    auto f = make_shared<Function>(OutputVector{deformable, conv},
+                                   ParameterVector{data, offsets, filters});
+
+    vector<float> data_values(shape_size(data_shape));
+    for (size_t i = 0; i < data_values.size(); i++)
+    {
+        data_values[i] = float((i * 7 + 3) % 11) - 5;
+    }
+    vector<float> filter_values(shape_size(filters_shape));
+    for (size_t i = 0; i < filter_values.size(); i++)
+    {
+        filter_values[i] = float((i * 5 + 1) % 7) / 4 - 0.75f;
+    }
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::f32, data_shape);
+    copy_data(a, data_values);
+    auto b = backend->create_tensor(element::f32, offsets_shape);
+    copy_data(b, vector<float>(shape_size(offsets_shape), 0));
+    auto c = backend->create_tensor(element::f32, filters_shape);
+    copy_data(c, filter_values);
+    auto result = backend->create_tensor(element::f32, out_shape);
+    auto expected = backend->create_tensor(element::f32, out_shape);
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result, expected}, {a, b, c});
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(expected), read_vector<float>(result)));
+}
+
+// Each group has its own deformable group: the first samples half a row down, between two
+// rows and with zeros past the bottom, the second one column to the left
+NGRAPH_TEST(${BACKEND_NAME}, deformable_convolution_bilinear_groups)
+{
+    Shape data_shape{1, 2, 3, 3};
+    Shape offsets_shape{1, 4, 3, 3};
+    Shape filters_shape{2, 1, 1, 1};
+    Shape out_shape{1, 2, 3, 3};
+    auto data = make_shared<op::v0::Parameter>(element::f32, data_shape);
+    auto offsets = make_shared<op::v0::Parameter>(element::f32, offsets_shape);
+    auto filters = op::v0::Constant::create(element::f32, filters_shape, {1, 2});
+    auto deformable = make_shared<op::v1::DeformableConvolution>(data,
+                                                                 offsets,
+                                                                 filters,
+                                                                 Strides{1, 1},
+                                                                 CoordinateDiff{0, 0},
+                                                                 CoordinateDiff{0, 0},
+                                                                 Strides{1, 1},
+                                                                 op::PadType::EXPLICIT,
+                                                                 2,
+                                                                 2);
+    auto f = make_shared<Function>(deformable, ParameterVector{data, offsets});
+
+    vector<float> offset_values(shape_size(offsets_shape), 0);
+    fill(offset_values.begin(), offset_values.begin() + 9, 0.5f);
+    fill(offset_values.begin() + 27, offset_values.end(), -1.0f);
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::f32, data_shape);
+    copy_data(a, vector<float>{0, 1, 2, 3, 4, 5, 6, 7, 8, 10, 11, 12, 13, 14, 15, 16, 17, 18});
+    auto b = backend->create_tensor(element::f32, offsets_shape);
+    copy_data(b, offset_values);
+    auto result = backend->create_tensor(element::f32, out_shape);
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_TRUE(test::all_close_f(
+        (vector<float>{1.5, 2.5, 3.5, 4.5, 5.5, 6.5, 3, 3.5, 4, 0, 20, 22, 0, 26, 28, 0, 32, 34}),
+        read_vector<float>(result)));
+}
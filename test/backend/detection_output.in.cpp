@@ -0,0 +1,95 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "util/all_close_f.hpp"
+#include "util/test_control.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string s_manifest = "${MANIFEST}";
+
+// Three priors with a variance of 0.1; the first two overlap
+static const vector<float> s_proposals{0.0f,  0.0f,  0.5f,  0.5f,  0.05f, 0.05f, 0.55f, 0.55f,
+                                       0.5f,  0.5f,  1.0f,  1.0f,  0.1f,  0.1f,  0.1f,  0.1f,
+                                       0.1f,  0.1f,  0.1f,  0.1f,  0.1f,  0.1f,  0.1f,  0.1f};
+static const vector<float> s_box_logits{
+    0.0f, 0.0f, 0.0f, 0.0f, 0.5f, 0.5f, 0.5f, 0.5f, 1.0f, 1.0f, 0.0f, 0.0f};
+
+static op::DetectionOutputAttrs detection_attrs(const string& code_type, int keep_top_k)
+{
+    op::DetectionOutputAttrs attrs;
+    attrs.num_classes = 2;
+    attrs.background_label_id = 0;
+    attrs.keep_top_k = {keep_top_k};
+    attrs.code_type = code_type;
+    attrs.nms_threshold = 0.4f;
+    attrs.confidence_threshold = 0.0f;
+    attrs.normalized = true;
+    return attrs;
+}
+
+static vector<float> run_detection_output(const string& backend_name,
+                                          const op::DetectionOutputAttrs& attrs,
+                                          const vector<float>& class_preds)
+{
+    auto box_logits = make_shared<op::v0::Parameter>(element::f32, Shape{1, 12});
+    auto class_preds_param = make_shared<op::v0::Parameter>(element::f32, Shape{1, 6});
+    auto proposals = make_shared<op::v0::Parameter>(element::f32, Shape{1, 2, 12});
+    auto detection =
+        make_shared<op::v0::DetectionOutput>(box_logits, class_preds_param, proposals, attrs);
+    auto f = make_shared<Function>(detection,
+                                   ParameterVector{box_logits, class_preds_param, proposals});
+
+    auto backend = runtime::Backend::create(backend_name);
+    auto a = backend->create_tensor(element::f32, Shape{1, 12});
+    copy_data(a, s_box_logits);
+    auto b = backend->create_tensor(element::f32, Shape{1, 6});
+    copy_data(b, class_preds);
+    auto c = backend->create_tensor(element::f32, Shape{1, 2, 12});
+    copy_data(c, s_proposals);
+    auto result = backend->create_tensor(element::f32, detection->get_output_shape(0));
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, b, c});
+    return read_vector<float>(result);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, detection_output_corner)
+{
+    auto attrs = detection_attrs("caffe.PriorBoxParameter.CORNER", 3);
+    auto result = run_detection_output(
+        "${BACKEND_NAME}", attrs, vector<float>{0.1f, 0.9f, 0.2f, 0.8f, 0.3f, 0.7f});
+    // The second prior is suppressed by the first; the last row marks the end
+    EXPECT_TRUE(test::all_close_f(vector<float>{0, 1, 0.9f, 0,    0,    0.5f, 0.5f,
+                                                0, 1, 0.7f, 0.6f, 0.6f, 1,    1,
+                                                -1, 0, 0,    0,    0,    0,    0},
+                                  result,
+                                  MIN_FLOAT_TOLERANCE_BITS));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, detection_output_center_size_keep_top_k)
+{
+    auto attrs = detection_attrs("caffe.PriorBoxParameter.CENTER_SIZE", 1);
+    attrs.clip_after_nms = true;
+    auto result = run_detection_output(
+        "${BACKEND_NAME}", attrs, vector<float>{0.1f, 0.9f, 0.2f, 0.8f, 0.05f, 0.95f});
+    // The last prior is shifted by a tenth of its width, then clipped to the image
+    EXPECT_TRUE(test::all_close_f(
+        vector<float>{0, 1, 0.95f, 0.55f, 0.55f, 1, 1}, result, MIN_FLOAT_TOLERANCE_BITS));
+}
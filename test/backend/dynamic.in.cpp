@@ -14,8 +14,14 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <thread>
+
 #include "gtest/gtest.h"
+#include "misc.hpp"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/dynamic/batching_executable.hpp"
+#include "ngraph/runtime/dynamic/dynamic_executable.hpp"
+#include "ngraph/runtime/dynamic/dynamic_tensor.hpp"
 #include "util/all_close_f.hpp"
 #include "util/test_control.hpp"
 #include "util/test_tools.hpp"
@@ -433,3 +439,210 @@ NGRAPH_TEST(${BACKEND_NAME}, dynamic_rank_add)
         EXPECT_TRUE(test::all_close_f(results, expected_values));
     }
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, dynamic_shape_polymorphic_abc)
+{
+    //
+    // f(a,b,c) = (a+b)*c with shape {2,?,3}, run without specializing the function.
+    //
+    auto a = make_shared<op::v0::Parameter>(element::f32, PartialShape{2, Dimension::dynamic(), 3});
+    auto b = make_shared<op::v0::Parameter>(element::f32, PartialShape{2, Dimension::dynamic(), 3});
+    auto c = make_shared<op::v0::Parameter>(element::f32, PartialShape{2, Dimension::dynamic(), 3});
+    auto f = make_shared<Function>(OutputVector{(a + b) * c}, ParameterVector{a, b, c});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto ex = make_shared<runtime::dynamic::DynamicExecutable>(f, backend, false, true);
+    EXPECT_TRUE(ex->is_shape_polymorphic());
+
+    auto t_r = make_shared<runtime::dynamic::DynamicTensor>(
+        element::f32, PartialShape{2, Dimension::dynamic(), 3}, backend);
+
+    for (size_t middle_dim = 0; middle_dim < 5; middle_dim++)
+    {
+        t_r->release_storage();
+        vector<float> inputs(2 * middle_dim * 3);
+        vector<float> expected_values(2 * middle_dim * 3);
+        for (size_t i = 0; i < inputs.size(); i++)
+        {
+            inputs[i] = i;
+            expected_values[i] = (i + i) * i;
+        }
+
+        auto t_a = backend->create_tensor(element::f32, Shape{2, middle_dim, 3});
+        auto t_b = backend->create_tensor(element::f32, Shape{2, middle_dim, 3});
+        auto t_c = backend->create_tensor(element::f32, Shape{2, middle_dim, 3});
+        copy_data(t_a, inputs);
+        copy_data(t_b, inputs);
+        copy_data(t_c, inputs);
+
+        ex->call({t_r}, {t_a, t_b, t_c});
+
+        ASSERT_EQ(t_r->get_shape(), (Shape{2, middle_dim, 3}));
+        EXPECT_TRUE(test::all_close_f(read_vector<float>(t_r), expected_values));
+    }
+    // Every shape was served by the one symbolic plan
+    EXPECT_TRUE(ex->is_shape_polymorphic());
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, dynamic_shape_polymorphic_fallback)
+{
+    //
+    // v0::Reverse has no host evaluator, so the first call falls back to specialization.
+    //
+    auto a = make_shared<op::v0::Parameter>(element::f32, PartialShape{2, Dimension::dynamic()});
+    auto reverse = make_shared<op::v0::Reverse>(a + a, AxisSet{1});
+    auto f = make_shared<Function>(OutputVector{reverse}, ParameterVector{a});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto ex = make_shared<runtime::dynamic::DynamicExecutable>(f, backend, false, true);
+    EXPECT_TRUE(ex->is_shape_polymorphic());
+
+    auto t_a = backend->create_tensor(element::f32, Shape{2, 3});
+    copy_data(t_a, vector<float>{1, 2, 3, 4, 5, 6});
+    auto t_r = make_shared<runtime::dynamic::DynamicTensor>(
+        element::f32, PartialShape{2, Dimension::dynamic()}, backend);
+
+    ex->call({t_r}, {t_a});
+
+    EXPECT_FALSE(ex->is_shape_polymorphic());
+    ASSERT_EQ(t_r->get_shape(), (Shape{2, 3}));
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(t_r), (vector<float>{6, 4, 2, 12, 10, 8})));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, dynamic_shape_polymorphic_upper_bound_pool)
+{
+    //
+    // f(a,b) = (a+b)*a with the middle dimension bounded by 8; intermediates come from one
+    // pool planned for {2,8,3}.
+    //
+    PartialShape shape{2, Dimension(1, 8), 3};
+    auto a = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto b = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(OutputVector{(a + b) * a}, ParameterVector{a, b});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto ex = make_shared<runtime::dynamic::DynamicExecutable>(f, backend, false, true);
+    // Both intermediates of {2,8,3} floats are live at the same time
+    EXPECT_GE(ex->get_planned_pool_size(), 2 * 2 * 8 * 3 * sizeof(float));
+
+    auto t_r = make_shared<runtime::dynamic::DynamicTensor>(element::f32, shape, backend);
+    for (size_t middle_dim : {8, 1, 5})
+    {
+        t_r->release_storage();
+        vector<float> inputs(2 * middle_dim * 3);
+        vector<float> expected_values(2 * middle_dim * 3);
+        for (size_t i = 0; i < inputs.size(); i++)
+        {
+            inputs[i] = i;
+            expected_values[i] = (i + 1.0f) * i;
+        }
+        auto t_a = backend->create_tensor(element::f32, Shape{2, middle_dim, 3});
+        auto t_b = backend->create_tensor(element::f32, Shape{2, middle_dim, 3});
+        copy_data(t_a, inputs);
+        copy_data(t_b, vector<float>(inputs.size(), 1.0f));
+
+        ex->call({t_r}, {t_a, t_b});
+
+        ASSERT_EQ(t_r->get_shape(), (Shape{2, middle_dim, 3}));
+        EXPECT_TRUE(test::all_close_f(read_vector<float>(t_r), expected_values));
+    }
+    EXPECT_TRUE(ex->is_shape_polymorphic());
+
+    // Shapes outside the declared bounds are rejected
+    auto t_big = backend->create_tensor(element::f32, Shape{2, 9, 3});
+    EXPECT_ANY_THROW(ex->call({t_r}, {t_big, t_big}));
+
+    // Without bounds there is nothing to plan
+    auto c = make_shared<op::v0::Parameter>(element::f32, PartialShape{2, Dimension::dynamic()});
+    auto g = make_shared<Function>(OutputVector{c + c}, ParameterVector{c});
+    auto unbounded = make_shared<runtime::dynamic::DynamicExecutable>(g, backend, false, true);
+    EXPECT_EQ(unbounded->get_planned_pool_size(), 0);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, batching_executable_coalesces_calls)
+{
+    //
+    // f(a,b) = a*b + a, where a and b have shape {?,3} and the first axis is the batch axis.
+    //
+    auto a = make_shared<op::v0::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 3});
+    auto b = make_shared<op::v0::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 3});
+    auto f = make_shared<Function>(OutputVector{a * b + a}, ParameterVector{a, b});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto ex = make_shared<runtime::dynamic::BatchingExecutable>(
+        f, backend, 0, 8, std::chrono::microseconds(2000));
+
+    EXPECT_EQ(ex->get_batch_bucket(1), 1);
+    EXPECT_EQ(ex->get_batch_bucket(3), 4);
+    EXPECT_EQ(ex->get_batch_bucket(8), 8);
+
+    const size_t n_threads = 6;
+    vector<vector<float>> results(n_threads);
+    vector<thread> threads;
+    for (size_t t = 0; t < n_threads; t++)
+    {
+        threads.emplace_back([&, t]() {
+            size_t batch = 1 + t % 2;
+            vector<float> values(batch * 3);
+            for (size_t i = 0; i < values.size(); i++)
+            {
+                values[i] = t * 10 + i;
+            }
+            auto t_a = backend->create_tensor(element::f32, Shape{batch, 3});
+            auto t_b = backend->create_tensor(element::f32, Shape{batch, 3});
+            auto t_r = backend->create_tensor(element::f32, Shape{batch, 3});
+            copy_data(t_a, values);
+            copy_data(t_b, vector<float>(batch * 3, 2.0f));
+            ex->call({t_r}, {t_a, t_b});
+            results[t] = read_vector<float>(t_r);
+        });
+    }
+    for (auto& th : threads)
+    {
+        th.join();
+    }
+
+    for (size_t t = 0; t < n_threads; t++)
+    {
+        size_t batch = 1 + t % 2;
+        vector<float> expected(batch * 3);
+        for (size_t i = 0; i < expected.size(); i++)
+        {
+            expected[i] = 3.0f * (t * 10 + i);
+        }
+        EXPECT_TRUE(test::all_close_f(results[t], expected));
+    }
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, batching_executable_recompiles_evicted_bucket)
+{
+    // With room for one executable, alternating batch sizes recompiles each bucket every time
+    auto a = make_shared<op::v0::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 3});
+    auto f = make_shared<Function>(OutputVector{a + a}, ParameterVector{a});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    set_environment("NGRAPH_CACHE_SIZE", "1", 1);
+    auto ex = make_shared<runtime::dynamic::BatchingExecutable>(
+        f, backend, 0, 8, std::chrono::microseconds(100));
+    unset_environment("NGRAPH_CACHE_SIZE");
+
+    for (size_t i = 0; i < 6; i++)
+    {
+        size_t batch = 1 + i % 2;
+        vector<float> values(batch * 3);
+        for (size_t j = 0; j < values.size(); j++)
+        {
+            values[j] = i * 10 + j;
+        }
+        auto t_a = backend->create_tensor(element::f32, Shape{batch, 3});
+        auto t_r = backend->create_tensor(element::f32, Shape{batch, 3});
+        copy_data(t_a, values);
+        ASSERT_TRUE(ex->call({t_r}, {t_a}));
+        vector<float> expected(values.size());
+        for (size_t j = 0; j < values.size(); j++)
+        {
+            expected[j] = 2.0f * values[j];
+        }
+        EXPECT_TRUE(test::all_close_f(read_vector<float>(t_r), expected));
+    }
+}
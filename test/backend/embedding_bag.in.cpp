@@ -0,0 +1,118 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "util/all_close_f.hpp"
+#include "util/test_control.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string s_manifest = "${MANIFEST}";
+
+// Row i of the table is {i, 10 * i}
+static const vector<float> s_emb_table{0, 0, 1, 10, 2, 20, 3, 30, 4, 40};
+
+NGRAPH_TEST(${BACKEND_NAME}, embedding_bag_offsets_sum)
+{
+    auto emb_table = make_shared<op::v0::Parameter>(element::f32, Shape{5, 2});
+    auto indices = op::v0::Constant::create(element::i32, Shape{4}, {0, 2, 3, 4});
+    auto offsets = op::v0::Constant::create(element::i32, Shape{3}, {0, 2, 2});
+    auto default_index = op::v0::Constant::create(element::i32, Shape{}, {1});
+    auto weights = make_shared<op::v0::Parameter>(element::f32, Shape{4});
+    auto pooled = make_shared<op::v3::EmbeddingBagOffsetsSum>(
+        emb_table, indices, offsets, default_index, weights);
+    auto unweighted =
+        make_shared<op::v3::EmbeddingBagOffsetsSum>(emb_table, indices, offsets);
+    auto f = make_shared<Function>(OutputVector{pooled, unweighted},
+                                   ParameterVector{emb_table, weights});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::f32, Shape{5, 2});
+    copy_data(a, s_emb_table);
+    auto w = backend->create_tensor(element::f32, Shape{4});
+    copy_data(w, vector<float>{0.5f, 1, 2, 1});
+    auto result0 = backend->create_tensor(element::f32, Shape{3, 2});
+    auto result1 = backend->create_tensor(element::f32, Shape{3, 2});
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result0, result1}, {a, w});
+    // The empty second bag takes the default row, or zeros without a default index
+    EXPECT_TRUE(test::all_close_f(vector<float>{2, 20, 1, 10, 10, 100},
+                                  read_vector<float>(result0),
+                                  MIN_FLOAT_TOLERANCE_BITS));
+    EXPECT_TRUE(test::all_close_f(vector<float>{2, 20, 0, 0, 7, 70},
+                                  read_vector<float>(result1),
+                                  MIN_FLOAT_TOLERANCE_BITS));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, embedding_bag_packed_sum)
+{
+    auto emb_table = make_shared<op::v0::Parameter>(element::f32, Shape{5, 2});
+    auto indices = op::v0::Constant::create(element::i64, Shape{2, 2}, {0, 2, 1, 4});
+    auto weights = make_shared<op::v0::Parameter>(element::f32, Shape{2, 2});
+    auto pooled = make_shared<op::v3::EmbeddingBagPackedSum>(emb_table, indices, weights);
+    auto unweighted = make_shared<op::v3::EmbeddingBagPackedSum>(emb_table, indices);
+    auto f = make_shared<Function>(OutputVector{pooled, unweighted},
+                                   ParameterVector{emb_table, weights});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::f32, Shape{5, 2});
+    copy_data(a, s_emb_table);
+    auto w = backend->create_tensor(element::f32, Shape{2, 2});
+    copy_data(w, vector<float>{1, 2, 0.5f, 1});
+    auto result0 = backend->create_tensor(element::f32, Shape{2, 2});
+    auto result1 = backend->create_tensor(element::f32, Shape{2, 2});
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result0, result1}, {a, w});
+    EXPECT_TRUE(test::all_close_f(
+        vector<float>{4, 40, 4.5f, 45}, read_vector<float>(result0), MIN_FLOAT_TOLERANCE_BITS));
+    EXPECT_TRUE(test::all_close_f(
+        vector<float>{2, 20, 5, 50}, read_vector<float>(result1), MIN_FLOAT_TOLERANCE_BITS));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, embedding_segments_sum)
+{
+    auto emb_table = make_shared<op::v0::Parameter>(element::f32, Shape{5, 2});
+    auto indices = op::v0::Constant::create(element::i32, Shape{4}, {0, 2, 3, 4});
+    auto segment_ids = op::v0::Constant::create(element::i32, Shape{4}, {0, 0, 2, 2});
+    auto num_segments = op::v0::Constant::create(element::i32, Shape{}, {4});
+    auto default_index = op::v0::Constant::create(element::i32, Shape{}, {1});
+    auto weights = make_shared<op::v0::Parameter>(element::f32, Shape{4});
+    auto pooled = make_shared<op::v3::EmbeddingSegmentsSum>(
+        emb_table, indices, segment_ids, num_segments, default_index, weights);
+    auto defaulted = make_shared<op::v3::EmbeddingSegmentsSum>(
+        emb_table, indices, segment_ids, num_segments, default_index);
+    auto f = make_shared<Function>(OutputVector{pooled, defaulted},
+                                   ParameterVector{emb_table, weights});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::f32, Shape{5, 2});
+    copy_data(a, s_emb_table);
+    auto w = backend->create_tensor(element::f32, Shape{4});
+    copy_data(w, vector<float>{0.5f, 1, 2, 1});
+    auto result0 = backend->create_tensor(element::f32, Shape{4, 2});
+    auto result1 = backend->create_tensor(element::f32, Shape{4, 2});
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result0, result1}, {a, w});
+    EXPECT_TRUE(test::all_close_f(vector<float>{2, 20, 1, 10, 10, 100, 1, 10},
+                                  read_vector<float>(result0),
+                                  MIN_FLOAT_TOLERANCE_BITS));
+    EXPECT_TRUE(test::all_close_f(vector<float>{2, 20, 1, 10, 7, 70, 1, 10},
+                                  read_vector<float>(result1),
+                                  MIN_FLOAT_TOLERANCE_BITS));
+}
@@ -18,6 +18,7 @@
 #include <cinttypes>
 #include <cmath>
 #include <cstdlib>
+#include <numeric>
 #include <random>
 #include <string>
 
@@ -825,3 +826,42 @@ NGRAPH_TEST(${BACKEND_NAME}, gather_no_axis_bool)
     c->call_with_validate({result}, {p, i});
     EXPECT_TRUE(test::all_close((vector<char>{1, 1, 1, 0, 1, 0, 0, 1}), read_vector<char>(result)));
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, gather_embedding_rows_many_indices)
+{
+    Shape params_shape{1000, 37};
+    Shape indices_shape{40, 25};
+    Shape out_shape{40, 25, 37};
+    auto P = make_shared<op::v0::Parameter>(element::f32, params_shape);
+    auto I = make_shared<op::v0::Parameter>(element::i32, indices_shape);
+    auto G = make_shared<op::v0::Gather>(P, I);
+    auto f = make_shared<Function>(G, ParameterVector{P, I});
+
+    vector<float> p_data(shape_size(params_shape));
+    iota(p_data.begin(), p_data.end(), 0.0f);
+    vector<int32_t> i_data(shape_size(indices_shape));
+    for (size_t k = 0; k < i_data.size(); ++k)
+    {
+        // Spread over the table, with some negative indices
+        i_data[k] = static_cast<int32_t>((k * 389) % 1000) - (k % 5 == 0 ? 1000 : 0);
+    }
+    vector<float> expected;
+    for (int32_t index : i_data)
+    {
+        size_t row = index < 0 ? index + 1000 : index;
+        expected.insert(expected.end(),
+                        p_data.begin() + row * 37,
+                        p_data.begin() + (row + 1) * 37);
+    }
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto p = backend->create_tensor(element::f32, params_shape);
+    copy_data(p, p_data);
+    auto i = backend->create_tensor(element::i32, indices_shape);
+    copy_data(i, i_data);
+    auto result = backend->create_tensor(element::f32, out_shape);
+
+    auto c = backend->compile(f);
+    c->call_with_validate({result}, {p, i});
+    EXPECT_EQ(expected, read_vector<float>(result));
+}
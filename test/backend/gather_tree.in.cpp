@@ -0,0 +1,74 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "util/all_close_f.hpp"
+#include "util/test_control.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string s_manifest = "${MANIFEST}";
+
+// The second batch element is one step shorter and ends its first beam at step 1
+NGRAPH_TEST(${BACKEND_NAME}, gather_tree_int32)
+{
+    Shape shape{3, 2, 2};
+    auto step_ids = make_shared<op::v0::Parameter>(element::i32, shape);
+    auto parent_ids = make_shared<op::v0::Parameter>(element::i32, shape);
+    auto max_seq_len = make_shared<op::v0::Parameter>(element::i32, Shape{2});
+    auto end_token = op::v0::Constant::create(element::i32, Shape{}, {10});
+    auto gather = make_shared<op::v1::GatherTree>(step_ids, parent_ids, max_seq_len, end_token);
+    auto f = make_shared<Function>(gather, ParameterVector{step_ids, parent_ids, max_seq_len});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::i32, shape);
+    copy_data(a, vector<int32_t>{1, 2, 7, 8, 3, 4, 10, 9, 5, 6, 11, 12});
+    auto b = backend->create_tensor(element::i32, shape);
+    copy_data(b, vector<int32_t>{0, 0, 0, 0, 1, 0, 0, 1, 0, 1, 0, 0});
+    auto c = backend->create_tensor(element::i32, Shape{2});
+    copy_data(c, vector<int32_t>{3, 2});
+    auto result = backend->create_tensor(element::i32, shape);
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, b, c});
+    EXPECT_EQ((vector<int32_t>{2, 1, 7, 8, 3, 4, 10, 9, 5, 6, 10, 10}),
+              read_vector<int32_t>(result));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, gather_tree_float_i64_lengths)
+{
+    Shape shape{3, 1, 2};
+    auto step_ids = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto parent_ids = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto max_seq_len = make_shared<op::v0::Parameter>(element::i64, Shape{1});
+    auto end_token = op::v0::Constant::create(element::f32, Shape{}, {0});
+    auto gather = make_shared<op::v1::GatherTree>(step_ids, parent_ids, max_seq_len, end_token);
+    auto f = make_shared<Function>(gather, ParameterVector{step_ids, parent_ids, max_seq_len});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4, 5, 6});
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(b, vector<float>{0, 0, 1, 0, 0, 1});
+    auto c = backend->create_tensor(element::i64, Shape{1});
+    copy_data(c, vector<int64_t>{3});
+    auto result = backend->create_tensor(element::f32, shape);
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, b, c});
+    EXPECT_TRUE(test::all_close_f((vector<float>{2, 1, 3, 4, 5, 6}), read_vector<float>(result)));
+}
@@ -0,0 +1,93 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/heterogeneous_executable.hpp"
+#include "util/all_close_f.hpp"
+#include "util/test_control.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string s_manifest = "${MANIFEST}";
+
+NGRAPH_TEST(${BACKEND_NAME}, heterogeneous_executable)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto C = make_shared<op::v1::Add>(A, B);
+    auto D = make_shared<op::v0::Negative>(C);
+    auto K = op::v0::Constant::create(element::f32, shape, {1, 2, 3, 4});
+    auto E = make_shared<op::v1::Multiply>(make_shared<op::v1::Multiply>(D, B), K);
+    auto f = make_shared<Function>(OutputVector{E, C, A, K}, ParameterVector{A, B});
+
+    // Two instances of the backend under test, with Negative forced onto the second
+    vector<shared_ptr<runtime::Backend>> backends{runtime::Backend::create("${BACKEND_NAME}"),
+                                                  runtime::Backend::create("${BACKEND_NAME}")};
+    auto cost = [](const Node& node, size_t backend) {
+        return is_type<op::v0::Negative>(&node) ? 1.0 - backend : 1.0 * backend;
+    };
+    runtime::HeterogeneousExecutable exec(f, backends, cost);
+
+    auto& segments = exec.get_segments();
+    ASSERT_EQ(segments.size(), 3);
+    EXPECT_EQ(segments[0].backend, 0);
+    EXPECT_EQ(segments[1].backend, 1);
+    EXPECT_EQ(segments[2].backend, 0);
+    EXPECT_EQ(count_ops_of_type<op::v0::Negative>(segments[1].function), 1);
+    EXPECT_EQ(count_ops_of_type<op::v0::Constant>(segments[2].function), 1);
+
+    auto a = backends[0]->create_tensor(element::f32, shape);
+    auto b = backends[0]->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{5, 6, 7, 8});
+    vector<shared_ptr<runtime::Tensor>> outputs;
+    for (size_t i = 0; i < 4; i++)
+    {
+        outputs.push_back(backends[0]->create_tensor(element::f32, shape));
+    }
+    ASSERT_TRUE(exec.call_with_validate(outputs, {a, b}));
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(outputs[0]),
+                                  vector<float>{-30, -96, -210, -384},
+                                  MIN_FLOAT_TOLERANCE_BITS));
+    EXPECT_TRUE(test::all_close_f(
+        read_vector<float>(outputs[1]), vector<float>{6, 8, 10, 12}, MIN_FLOAT_TOLERANCE_BITS));
+    EXPECT_TRUE(test::all_close_f(
+        read_vector<float>(outputs[2]), vector<float>{1, 2, 3, 4}, MIN_FLOAT_TOLERANCE_BITS));
+    EXPECT_TRUE(test::all_close_f(
+        read_vector<float>(outputs[3]), vector<float>{1, 2, 3, 4}, MIN_FLOAT_TOLERANCE_BITS));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, heterogeneous_executable_single_backend)
+{
+    Shape shape{3};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::v0::Abs>(make_shared<op::v0::Negative>(A)),
+                                   ParameterVector{A});
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    runtime::HeterogeneousExecutable exec(f, {backend});
+    ASSERT_EQ(exec.get_segments().size(), 1);
+
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, -2, 3});
+    auto result = backend->create_tensor(element::f32, shape);
+    ASSERT_TRUE(exec.call_with_validate({result}, {a}));
+    EXPECT_TRUE(test::all_close_f(
+        read_vector<float>(result), vector<float>{1, 2, 3}, MIN_FLOAT_TOLERANCE_BITS));
+}
@@ -0,0 +1,173 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <numeric>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "util/all_close_f.hpp"
+#include "util/test_control.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string s_manifest = "${MANIFEST}";
+
+using v3 = op::v3::Interpolate;
+
+template <typename T, typename OP, typename ATTRS>
+static vector<T> interpolate(const element::Type& type,
+                             const Shape& shape,
+                             const vector<T>& values,
+                             const Shape& out_shape,
+                             const ATTRS& attrs)
+{
+    vector<int64_t> sizes;
+    for (auto axis : attrs.axes)
+    {
+        sizes.push_back(static_cast<int64_t>(out_shape[axis]));
+    }
+    auto image = make_shared<op::v0::Parameter>(type, shape);
+    auto interpolate = make_shared<OP>(
+        image, op::v0::Constant::create(element::i64, Shape{sizes.size()}, sizes), attrs);
+    auto f = make_shared<Function>(interpolate, ParameterVector{image});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(type, shape);
+    copy_data(a, values);
+    auto result = backend->create_tensor(type, out_shape);
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a});
+    return read_vector<T>(result);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, interpolate_v0_nearest)
+{
+    op::v0::InterpolateAttrs attrs;
+    attrs.axes = AxisSet{2, 3};
+    attrs.mode = "nearest";
+    attrs.align_corners = false;
+    EXPECT_EQ((vector<float>{1, 1, 2, 2, 1, 1, 2, 2, 3, 3, 4, 4, 3, 3, 4, 4}),
+              (interpolate<float, op::v0::Interpolate>(
+                  element::f32, Shape{1, 1, 2, 2}, {1, 2, 3, 4}, Shape{1, 1, 4, 4}, attrs)));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, interpolate_v0_linear_align_corners)
+{
+    op::v0::InterpolateAttrs attrs;
+    attrs.axes = AxisSet{2, 3};
+    attrs.mode = "linear";
+    EXPECT_TRUE(test::all_close_f(
+        (vector<float>{1, 1.5f, 2, 2, 2.5f, 3, 3, 3.5f, 4}),
+        (interpolate<float, op::v0::Interpolate>(
+            element::f32, Shape{1, 1, 2, 2}, {1, 2, 3, 4}, Shape{1, 1, 3, 3}, attrs))));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, interpolate_v3_linear_onnx_half_pixel)
+{
+    v3::InterpolateAttrs attrs;
+    attrs.axes = AxisSet{2, 3};
+    attrs.mode = v3::InterpolateMode::linear_onnx;
+    EXPECT_TRUE(test::all_close_f(
+        (vector<float>{1, 1.25f, 1.75f, 2.25f, 2.75f, 3.25f, 3.75f, 4}),
+        (interpolate<float, v3>(
+            element::f32, Shape{1, 1, 1, 4}, {1, 2, 3, 4}, Shape{1, 1, 1, 8}, attrs))));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, interpolate_v3_linear_onnx_u8)
+{
+    v3::InterpolateAttrs attrs;
+    attrs.axes = AxisSet{3};
+    attrs.mode = v3::InterpolateMode::linear_onnx;
+    EXPECT_EQ((vector<uint8_t>{0, 64, 191, 255}),
+              (interpolate<uint8_t, v3>(
+                  element::u8, Shape{1, 1, 1, 2}, {0, 255}, Shape{1, 1, 1, 4}, attrs)));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, interpolate_v3_cubic)
+{
+    v3::InterpolateAttrs attrs;
+    attrs.axes = AxisSet{3};
+    attrs.mode = v3::InterpolateMode::cubic;
+    EXPECT_TRUE(test::all_close_f(
+        (vector<float>{0.894531f,
+                       1.191406f,
+                       1.667969f,
+                       2.296875f,
+                       2.703125f,
+                       3.332031f,
+                       3.808594f,
+                       4.105469f}),
+        (interpolate<float, v3>(
+            element::f32, Shape{1, 1, 1, 4}, {1, 2, 3, 4}, Shape{1, 1, 1, 8}, attrs))));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, interpolate_v3_area)
+{
+    v3::InterpolateAttrs attrs;
+    attrs.axes = AxisSet{3};
+    attrs.mode = v3::InterpolateMode::area;
+    EXPECT_TRUE(test::all_close_f(
+        (vector<float>{1.25f, 2.5f, 3.75f}),
+        (interpolate<float, v3>(
+            element::f32, Shape{1, 1, 1, 4}, {1, 2, 3, 4}, Shape{1, 1, 1, 3}, attrs))));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, interpolate_v3_nearest_pads)
+{
+    v3::InterpolateAttrs attrs;
+    attrs.axes = AxisSet{3};
+    attrs.mode = v3::InterpolateMode::nearest;
+    attrs.coordinate_transformation_mode = v3::CoordinateTransformMode::asymmetric;
+    attrs.nearest_mode = v3::NearestMode::floor;
+    attrs.pads_begin = {0, 0, 0, 1};
+    attrs.pads_end = {0, 0, 0, 1};
+    EXPECT_EQ((vector<float>{0, 0, 1, 1, 2, 2, 0, 0}),
+              (interpolate<float, v3>(
+                  element::f32, Shape{1, 1, 1, 2}, {1, 2}, Shape{1, 1, 1, 8}, attrs)));
+}
+
+// Enough rows for the passes to be split between threads, with axes that shrink and grow
+NGRAPH_TEST(${BACKEND_NAME}, interpolate_v3_nearest_batch)
+{
+    Shape shape{2, 3, 8, 5};
+    Shape out_shape{2, 3, 4, 15};
+    vector<float> values(shape_size(shape));
+    iota(values.begin(), values.end(), 0.0f);
+    vector<float> expected;
+    for (size_t n = 0; n < 2; n++)
+    {
+        for (size_t c = 0; c < 3; c++)
+        {
+            for (size_t h = 0; h < 4; h++)
+            {
+                for (size_t w = 0; w < 15; w++)
+                {
+                    expected.push_back(values[((n * 3 + c) * 8 + h * 2) * 5 + w / 3]);
+                }
+            }
+        }
+    }
+
+    v3::InterpolateAttrs attrs;
+    attrs.axes = AxisSet{2, 3};
+    attrs.mode = v3::InterpolateMode::nearest;
+    attrs.coordinate_transformation_mode = v3::CoordinateTransformMode::asymmetric;
+    attrs.nearest_mode = v3::NearestMode::floor;
+    EXPECT_EQ(expected,
+              (interpolate<float, v3>(element::f32, shape, values, out_shape, attrs)));
+}
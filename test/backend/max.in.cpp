@@ -507,3 +507,38 @@ NGRAPH_TEST(${BACKEND_NAME}, max_3d_eliminate_zero_dim)
     handle->call_with_validate({result}, {a});
     EXPECT_EQ((vector<float>{mi, mi, mi, mi, mi, mi}), read_vector<float>(result));
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, max_outer_and_split_axes)
+{
+    // Rows longer than the chunk the CPU kernel accumulates at a time
+    Shape shape_a{3, 4, 300};
+    vector<int32_t> a_data(shape_size(shape_a));
+    for (size_t i = 0; i < a_data.size(); ++i)
+    {
+        a_data[i] = static_cast<int32_t>((i * 7919) % 1009) - 500;
+    }
+
+    for (auto axes : {AxisSet{0}, AxisSet{1}, AxisSet{0, 2}})
+    {
+        auto A = make_shared<op::v0::Parameter>(element::i32, shape_a);
+        auto f = make_shared<Function>(make_shared<op::v0::Max>(A, axes), ParameterVector{A});
+        Shape shape_rt = reduce(shape_a, axes);
+
+        vector<int32_t> expected(shape_size(shape_rt), numeric_limits<int32_t>::min());
+        CoordinateTransform input_transform(shape_a);
+        CoordinateTransform output_transform(shape_rt);
+        for (const Coordinate& input_coord : input_transform)
+        {
+            auto& y = expected[output_transform.index(reduce(input_coord, axes))];
+            y = std::max(y, a_data[input_transform.index(input_coord)]);
+        }
+
+        auto backend = runtime::Backend::create("${BACKEND_NAME}");
+        auto a = backend->create_tensor(element::i32, shape_a);
+        copy_data(a, a_data);
+        auto result = backend->create_tensor(element::i32, shape_rt);
+        auto handle = backend->compile(f);
+        handle->call_with_validate({result}, {a});
+        EXPECT_EQ(expected, read_vector<int32_t>(result));
+    }
+}
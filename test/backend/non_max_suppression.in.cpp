@@ -0,0 +1,122 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "util/test_control.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string s_manifest = "${MANIFEST}";
+
+// Boxes 0 to 2 overlap, as do boxes 3 and 4; box 5 is on its own
+static const vector<float> s_corner_boxes{0.0f, 0.0f,  1.0f, 1.0f,  0.0f, 0.1f,   1.0f, 1.1f,
+                                          0.0f, -0.1f, 1.0f, 0.9f,  0.0f, 10.0f,  1.0f, 11.0f,
+                                          0.0f, 10.1f, 1.0f, 11.1f, 0.0f, 100.0f, 1.0f, 101.0f};
+static const vector<float> s_scores{0.9f, 0.75f, 0.6f, 0.95f, 0.5f, 0.3f};
+
+NGRAPH_TEST(${BACKEND_NAME}, non_max_suppression_suppress_by_iou)
+{
+    auto boxes = make_shared<op::v0::Parameter>(element::f32, Shape{1, 6, 4});
+    auto scores = make_shared<op::v0::Parameter>(element::f32, Shape{1, 1, 6});
+    auto nms = make_shared<op::v1::NonMaxSuppression>(
+        boxes,
+        scores,
+        op::v0::Constant::create(element::i64, Shape{}, {3}),
+        op::v0::Constant::create(element::f32, Shape{}, {0.5f}),
+        op::v0::Constant::create(element::f32, Shape{}, {0.0f}));
+    auto f = make_shared<Function>(nms, ParameterVector{boxes, scores});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::f32, Shape{1, 6, 4});
+    copy_data(a, s_corner_boxes);
+    auto b = backend->create_tensor(element::f32, Shape{1, 1, 6});
+    copy_data(b, s_scores);
+    auto result = backend->create_tensor(element::i64, Shape{3, 3});
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_EQ((vector<int64_t>{0, 0, 3, 0, 0, 0, 0, 0, 5}), read_vector<int64_t>(result));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, non_max_suppression_center_point_box)
+{
+    vector<float> center_boxes{0.5f, 0.5f,  1.0f, 1.0f, 0.5f, 0.6f,   1.0f, 1.0f,
+                               0.5f, 0.4f,  1.0f, 1.0f, 0.5f, 10.5f,  1.0f, 1.0f,
+                               0.5f, 10.6f, 1.0f, 1.0f, 0.5f, 100.5f, 1.0f, 1.0f};
+    auto boxes = make_shared<op::v0::Parameter>(element::f32, Shape{1, 6, 4});
+    auto scores = make_shared<op::v0::Parameter>(element::f32, Shape{1, 1, 6});
+    auto nms = make_shared<op::v3::NonMaxSuppression>(
+        boxes,
+        scores,
+        op::v0::Constant::create(element::i32, Shape{}, {5}),
+        op::v0::Constant::create(element::f32, Shape{}, {0.5f}),
+        op::v0::Constant::create(element::f32, Shape{}, {0.7f}),
+        op::v3::NonMaxSuppression::BoxEncodingType::CENTER,
+        true,
+        element::i32);
+    auto f = make_shared<Function>(nms, ParameterVector{boxes, scores});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::f32, Shape{1, 6, 4});
+    copy_data(a, center_boxes);
+    auto b = backend->create_tensor(element::f32, Shape{1, 1, 6});
+    copy_data(b, s_scores);
+    auto result = backend->create_tensor(element::i32, Shape{5, 3});
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, b});
+    // Only three boxes pass the score threshold, and box 1 overlaps box 0
+    EXPECT_EQ((vector<int32_t>{0, 0, 3, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1}),
+              read_vector<int32_t>(result));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, non_max_suppression_two_classes)
+{
+    vector<float> scores_data(s_scores);
+    scores_data.insert(scores_data.end(), {0.3f, 0.5f, 0.95f, 0.6f, 0.75f, 0.9f});
+    auto boxes = make_shared<op::v0::Parameter>(element::f32, Shape{1, 6, 4});
+    auto scores = make_shared<op::v0::Parameter>(element::f32, Shape{1, 2, 6});
+    auto max_boxes = op::v0::Constant::create(element::i64, Shape{}, {2});
+    auto iou_threshold = op::v0::Constant::create(element::f32, Shape{}, {0.5f});
+    auto score_threshold = op::v0::Constant::create(element::f32, Shape{}, {0.0f});
+    auto by_class = make_shared<op::v1::NonMaxSuppression>(
+        boxes,
+        scores,
+        max_boxes,
+        iou_threshold,
+        score_threshold,
+        op::v1::NonMaxSuppression::BoxEncodingType::CORNER,
+        false);
+    auto by_score = make_shared<op::v1::NonMaxSuppression>(
+        boxes, scores, max_boxes, iou_threshold, score_threshold);
+    auto f = make_shared<Function>(OutputVector{by_class, by_score},
+                                   ParameterVector{boxes, scores});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::f32, Shape{1, 6, 4});
+    copy_data(a, s_corner_boxes);
+    auto b = backend->create_tensor(element::f32, Shape{1, 2, 6});
+    copy_data(b, scores_data);
+    auto result0 = backend->create_tensor(element::i64, Shape{4, 3});
+    auto result1 = backend->create_tensor(element::i64, Shape{4, 3});
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result0, result1}, {a, b});
+    EXPECT_EQ((vector<int64_t>{0, 0, 3, 0, 0, 0, 0, 1, 2, 0, 1, 5}),
+              read_vector<int64_t>(result0));
+    EXPECT_EQ((vector<int64_t>{0, 0, 3, 0, 1, 2, 0, 0, 0, 0, 1, 5}),
+              read_vector<int64_t>(result1));
+}
@@ -103,3 +103,63 @@ NGRAPH_TEST(${BACKEND_NAME}, non_zero_all_0s)
     auto result_data = read_vector<int64_t>(result);
     ASSERT_EQ(result_data.data(), nullptr);
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, non_zero_downstream)
+{
+    auto p = make_shared<op::v0::Parameter>(element::f32, Shape{5});
+    auto square = make_shared<op::v1::Multiply>(p, p);
+    auto non_zero = make_shared<op::v3::NonZero>(square, element::i32);
+    auto sum = make_shared<op::v1::Add>(non_zero, non_zero);
+    auto fun = make_shared<Function>(OutputVector{sum}, ParameterVector{p});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}", true);
+    auto cfun = backend->compile(fun);
+
+    // Same input shape, different output shapes
+    vector<vector<float>> inputs{{0, 1, 0, -2, 3}, {4, 0, 0, 0, 0}, {0, 0, 0, 0, 0}};
+    vector<vector<int32_t>> expected_results{{2, 6, 8}, {0}, {}};
+    vector<Shape> expected_shapes{Shape{1, 3}, Shape{1, 1}, Shape{1, 0}};
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        auto input = backend->create_tensor(element::f32, Shape{5});
+        copy_data(input, inputs[i]);
+        auto result = backend->create_dynamic_tensor(element::i32, PartialShape::dynamic());
+        cfun->call_with_validate({result}, {input});
+
+        EXPECT_EQ(result->get_shape(), expected_shapes[i]);
+        EXPECT_EQ(read_vector<int32_t>(result), expected_results[i]);
+    }
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, non_zero_large)
+{
+    Shape input_shape{3, 100000};
+    auto p = make_shared<op::v0::Parameter>(element::i32, input_shape);
+    auto non_zero = make_shared<op::v3::NonZero>(p, element::i64);
+    auto fun = make_shared<Function>(OutputVector{non_zero}, ParameterVector{p});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}", true);
+    auto cfun = backend->compile(fun);
+
+    vector<int32_t> input_data(shape_size(input_shape), 0);
+    vector<int64_t> rows;
+    vector<int64_t> columns;
+    for (size_t i = 0; i < input_data.size(); i += 7)
+    {
+        input_data[i] = static_cast<int32_t>(i);
+        if (i != 0)
+        {
+            rows.push_back(i / input_shape[1]);
+            columns.push_back(i % input_shape[1]);
+        }
+    }
+    auto input = backend->create_tensor(element::i32, input_shape);
+    copy_data(input, input_data);
+    auto result = backend->create_dynamic_tensor(element::i64, PartialShape::dynamic());
+    cfun->call_with_validate({result}, {input});
+
+    vector<int64_t> expected_result = rows;
+    expected_result.insert(expected_result.end(), columns.begin(), columns.end());
+    EXPECT_EQ(result->get_shape(), (Shape{2, rows.size()}));
+    EXPECT_EQ(read_vector<int64_t>(result), expected_result);
+}
@@ -595,6 +595,39 @@ NGRAPH_TEST(${BACKEND_NAME}, builder_reshape_3D_to_scalar)
     test_case.run();
 }
 
+// Large enough for several cache tiles per transposed block, with ragged edges
+NGRAPH_TEST(${BACKEND_NAME}, reshape_nchw_to_nhwc_tiled)
+{
+    Shape shape_a{2, 37, 9, 7};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape_a);
+    Shape shape_r{2, 9, 7, 37};
+    auto r = make_shared<op::v0::Reshape>(A, AxisVector{0, 2, 3, 1}, shape_r);
+    auto f = make_shared<Function>(r, ParameterVector{A});
+
+    vector<float> a_data(shape_size(shape_a));
+    iota(a_data.begin(), a_data.end(), 0.f);
+    vector<float> expected;
+    for (size_t n = 0; n < 2; ++n)
+    {
+        for (size_t hw = 0; hw < 9 * 7; ++hw)
+        {
+            for (size_t c = 0; c < 37; ++c)
+            {
+                expected.push_back(a_data[(n * 37 + c) * 9 * 7 + hw]);
+            }
+        }
+    }
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::f32, shape_a);
+    copy_data(a, a_data);
+    auto result = backend->create_tensor(element::f32, shape_r);
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a});
+    EXPECT_EQ(expected, read_vector<float>(result));
+}
+
 #if NGRAPH_INTERPRETER_ENABLE
 
 NGRAPH_TEST(${BACKEND_NAME}, reshape_shufflenet_5d)
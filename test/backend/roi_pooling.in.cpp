@@ -0,0 +1,139 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <numeric>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "util/all_close_f.hpp"
+#include "util/test_control.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string s_manifest = "${MANIFEST}";
+
+// Runs `node` on a feature map holding 0, 1, 2, ... and the given boxes
+static vector<float> run_roi_pooling(const shared_ptr<Node>& node,
+                                     const shared_ptr<op::v0::Parameter>& input,
+                                     const shared_ptr<op::v0::Parameter>& rois,
+                                     const vector<float>& boxes)
+{
+    auto f = make_shared<Function>(node, ParameterVector{input, rois});
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    vector<float> values(shape_size(input->get_output_shape(0)));
+    iota(values.begin(), values.end(), 0.0f);
+    auto a = backend->create_tensor(element::f32, input->get_output_shape(0));
+    copy_data(a, values);
+    auto b = backend->create_tensor(element::f32, rois->get_output_shape(0));
+    copy_data(b, boxes);
+    auto result = backend->create_tensor(element::f32, node->get_output_shape(0));
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, b});
+    return read_vector<float>(result);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, roi_align_avg)
+{
+    auto input = make_shared<op::v0::Parameter>(element::f32, Shape{1, 2, 4, 4});
+    auto rois = make_shared<op::v0::Parameter>(element::f32, Shape{2, 4});
+    auto batch_indices = op::v0::Constant::create(element::i64, Shape{2}, {0, 0});
+    auto roi_align =
+        make_shared<op::v3::ROIAlign>(input, rois, batch_indices, 2, 2, 2, 1.0f, "avg");
+    vector<float> expected{3.75f,
+                           5.25f,
+                           9.75f,
+                           11.25f,
+                           19.75f,
+                           21.25f,
+                           25.75f,
+                           27.25f,
+                           7.25f,
+                           7.75f,
+                           11.25f,
+                           11.75f,
+                           23.25f,
+                           23.75f,
+                           27.25f,
+                           27.75f};
+    EXPECT_TRUE(test::all_close_f(
+        expected, run_roi_pooling(roi_align, input, rois, {0, 0, 3, 3, 1, 1, 2, 3})));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, roi_align_max)
+{
+    auto input = make_shared<op::v0::Parameter>(element::f32, Shape{1, 2, 4, 4});
+    auto rois = make_shared<op::v0::Parameter>(element::f32, Shape{1, 4});
+    auto batch_indices = op::v0::Constant::create(element::i32, Shape{1}, {0});
+    auto roi_align =
+        make_shared<op::v3::ROIAlign>(input, rois, batch_indices, 2, 2, 2, 1.0f, "max");
+    EXPECT_TRUE(test::all_close_f(
+        (vector<float>{5.625f, 7.125f, 11.625f, 13.125f, 21.625f, 23.125f, 27.625f, 29.125f}),
+        run_roi_pooling(roi_align, input, rois, {0, 0, 3, 3})));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, roi_pooling_max)
+{
+    auto input = make_shared<op::v0::Parameter>(element::f32, Shape{1, 1, 4, 4});
+    auto rois = make_shared<op::v0::Parameter>(element::f32, Shape{1, 5});
+    auto roi_pooling = make_shared<op::v0::ROIPooling>(input, rois, Shape{2, 2}, 1.0f, "max");
+    EXPECT_EQ((vector<float>{5, 7, 13, 15}),
+              run_roi_pooling(roi_pooling, input, rois, {0, 0, 0, 3, 3}));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, roi_pooling_bilinear)
+{
+    auto input = make_shared<op::v0::Parameter>(element::f32, Shape{1, 1, 4, 4});
+    auto rois = make_shared<op::v0::Parameter>(element::f32, Shape{2, 5});
+    auto roi_pooling =
+        make_shared<op::v0::ROIPooling>(input, rois, Shape{2, 2}, 1.0f, "bilinear");
+    EXPECT_TRUE(test::all_close_f(
+        (vector<float>{0, 3, 12, 15, 3.75f, 5.25f, 9.75f, 11.25f}),
+        run_roi_pooling(
+            roi_pooling, input, rois, {0, 0, 0, 1, 1, 0, 0.25f, 0.25f, 0.75f, 0.75f})));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, psroi_pooling_average)
+{
+    auto input = make_shared<op::v0::Parameter>(element::f32, Shape{1, 8, 3, 3});
+    auto rois = make_shared<op::v0::Parameter>(element::f32, Shape{2, 5});
+    auto psroi = make_shared<op::v0::PSROIPooling>(input, rois, 2, 2, 1.0f, 1, 1, "average");
+    EXPECT_TRUE(test::all_close_f(
+        (vector<float>{2, 12, 23, 33, 38, 48, 59, 69, 4, 14, 25, 35, 40, 50, 61, 71}),
+        run_roi_pooling(psroi, input, rois, {0, 0, 0, 2, 2, 0, 1, 1, 2, 2})));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, psroi_pooling_bilinear)
+{
+    auto input = make_shared<op::v0::Parameter>(element::f32, Shape{1, 4, 3, 3});
+    auto rois = make_shared<op::v0::Parameter>(element::f32, Shape{1, 5});
+    auto psroi = make_shared<op::v0::PSROIPooling>(input, rois, 1, 2, 1.0f, 2, 2, "bilinear");
+    EXPECT_TRUE(test::all_close_f((vector<float>{15.5f, 16.5f, 18.5f, 19.5f}),
+                                  run_roi_pooling(psroi, input, rois, {0, 0, 0, 1, 1})));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, deformable_psroi_pooling_offsets)
+{
+    auto input = make_shared<op::v0::Parameter>(element::f32, Shape{1, 4, 3, 3});
+    auto rois = make_shared<op::v0::Parameter>(element::f32, Shape{1, 5});
+    auto offsets = op::v0::Constant::create(
+        element::f32, Shape{1, 2, 2, 2}, vector<float>{0.1f, 0, 0, 0, 0, 0, 0, -0.1f});
+    auto psroi = make_shared<op::v1::DeformablePSROIPooling>(
+        input, rois, offsets, 1, 1.0f, 2, "bilinear_deformable", 2, 2, 1.0f, 2);
+    EXPECT_TRUE(test::all_close_f((vector<float>{0.65f, 10.75f, 22.25f, 31.6f}),
+                                  run_roi_pooling(psroi, input, rois, {0, 0, 0, 2, 2})));
+}
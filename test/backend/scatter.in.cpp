@@ -18,6 +18,7 @@
 #include <cinttypes>
 #include <cmath>
 #include <cstdlib>
+#include <numeric>
 #include <random>
 #include <string>
 
@@ -278,3 +279,162 @@ NGRAPH_TEST(${BACKEND_NAME}, scatter_nd_add_2d_to_3d)
                                   read_vector<float>(result),
                                   MIN_FLOAT_TOLERANCE_BITS));
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, scatter_update_axis_1)
+{
+    Shape data_shape{2, 4, 2};
+    Shape indices_shape{2};
+    Shape updates_shape{2, 2, 2};
+    auto D = make_shared<op::v0::Parameter>(element::f32, data_shape);
+    auto I = make_shared<op::v0::Parameter>(element::i64, indices_shape);
+    auto U = make_shared<op::v0::Parameter>(element::f32, updates_shape);
+    auto A = op::v0::Constant::create(element::i64, Shape{}, {1});
+    auto G = make_shared<op::v3::ScatterUpdate>(D, I, U, A);
+    auto f = make_shared<Function>(OutputVector{G->output(0)}, ParameterVector{D, I, U});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto d = backend->create_tensor(element::f32, data_shape);
+    copy_data(d, vector<float>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15});
+    auto i = backend->create_tensor(element::i64, indices_shape);
+    copy_data(i, vector<int64_t>{3, 0});
+    auto u = backend->create_tensor(element::f32, updates_shape);
+    copy_data(u, vector<float>{20, 21, 22, 23, 24, 25, 26, 27});
+    auto result = backend->create_tensor(element::f32, data_shape);
+
+    auto c = backend->compile(f);
+    c->call_with_validate({result}, {d, i, u});
+    EXPECT_TRUE(test::all_close_f(
+        (vector<float>{22, 23, 2, 3, 4, 5, 20, 21, 26, 27, 10, 11, 12, 13, 24, 25}),
+        read_vector<float>(result),
+        MIN_FLOAT_TOLERANCE_BITS));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, scatter_update_repeated_indices)
+{
+    Shape data_shape{3, 2};
+    Shape indices_shape{3};
+    Shape updates_shape{3, 2};
+    auto D = make_shared<op::v0::Parameter>(element::f32, data_shape);
+    auto I = make_shared<op::v0::Parameter>(element::i32, indices_shape);
+    auto U = make_shared<op::v0::Parameter>(element::f32, updates_shape);
+    auto A = op::v0::Constant::create(element::i64, Shape{}, {0});
+    auto G = make_shared<op::v3::ScatterUpdate>(D, I, U, A);
+    auto f = make_shared<Function>(OutputVector{G->output(0)}, ParameterVector{D, I, U});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto d = backend->create_tensor(element::f32, data_shape);
+    copy_data(d, vector<float>{1, 2, 3, 4, 5, 6});
+    auto i = backend->create_tensor(element::i32, indices_shape);
+    copy_data(i, vector<int32_t>{2, 0, 2});
+    auto u = backend->create_tensor(element::f32, updates_shape);
+    copy_data(u, vector<float>{10, 11, 12, 13, 14, 15});
+    auto result = backend->create_tensor(element::f32, data_shape);
+
+    auto c = backend->compile(f);
+    c->call_with_validate({result}, {d, i, u});
+    // The last update of a repeated index wins
+    EXPECT_TRUE(test::all_close_f((vector<float>{12, 13, 3, 4, 14, 15}),
+                                  read_vector<float>(result),
+                                  MIN_FLOAT_TOLERANCE_BITS));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, scatter_update_intermediate_data)
+{
+    // The data dies at the scatter, so it can be updated in place
+    Shape data_shape{4, 3};
+    Shape indices_shape{1};
+    Shape updates_shape{1, 3};
+    auto D = make_shared<op::v0::Parameter>(element::f32, data_shape);
+    auto I = make_shared<op::v0::Parameter>(element::i64, indices_shape);
+    auto U = make_shared<op::v0::Parameter>(element::f32, updates_shape);
+    auto A = op::v0::Constant::create(element::i64, Shape{}, {0});
+    auto cache = make_shared<op::v1::Multiply>(D, D);
+    auto G = make_shared<op::v3::ScatterUpdate>(cache, I, U, A);
+    auto f = make_shared<Function>(OutputVector{G->output(0)}, ParameterVector{D, I, U});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto d = backend->create_tensor(element::f32, data_shape);
+    copy_data(d, vector<float>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12});
+    auto i = backend->create_tensor(element::i64, indices_shape);
+    auto u = backend->create_tensor(element::f32, updates_shape);
+    copy_data(u, vector<float>{-1, -2, -3});
+    auto result = backend->create_tensor(element::f32, data_shape);
+
+    auto c = backend->compile(f);
+    copy_data(i, vector<int64_t>{2});
+    c->call_with_validate({result}, {d, i, u});
+    EXPECT_TRUE(test::all_close_f((vector<float>{1, 4, 9, 16, 25, 36, -1, -2, -3, 100, 121, 144}),
+                                  read_vector<float>(result),
+                                  MIN_FLOAT_TOLERANCE_BITS));
+    copy_data(i, vector<int64_t>{0});
+    c->call_with_validate({result}, {d, i, u});
+    EXPECT_TRUE(
+        test::all_close_f((vector<float>{-1, -2, -3, 16, 25, 36, 49, 64, 81, 100, 121, 144}),
+                          read_vector<float>(result),
+                          MIN_FLOAT_TOLERANCE_BITS));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, scatter_elements_update_axis_1)
+{
+    Shape data_shape{3, 3};
+    Shape indices_shape{2, 3};
+    auto D = make_shared<op::v0::Parameter>(element::f32, data_shape);
+    auto I = make_shared<op::v0::Parameter>(element::i32, indices_shape);
+    auto U = make_shared<op::v0::Parameter>(element::f32, indices_shape);
+    auto A = op::v0::Constant::create(element::i64, Shape{}, {-1});
+    auto G = make_shared<op::v3::ScatterElementsUpdate>(D, I, U, A);
+    auto f = make_shared<Function>(OutputVector{G->output(0)}, ParameterVector{D, I, U});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto d = backend->create_tensor(element::f32, data_shape);
+    copy_data(d, vector<float>{0, 0, 0, 0, 0, 0, 0, 0, 0});
+    auto i = backend->create_tensor(element::i32, indices_shape);
+    copy_data(i, vector<int32_t>{1, 0, 2, 0, 2, 1});
+    auto u = backend->create_tensor(element::f32, indices_shape);
+    copy_data(u, vector<float>{1, 2, 3, 4, 5, 6});
+    auto result = backend->create_tensor(element::f32, data_shape);
+
+    auto c = backend->compile(f);
+    c->call_with_validate({result}, {d, i, u});
+    EXPECT_TRUE(test::all_close_f((vector<float>{2, 1, 3, 4, 6, 5, 0, 0, 0}),
+                                  read_vector<float>(result),
+                                  MIN_FLOAT_TOLERANCE_BITS));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, scatter_nd_2d_slices)
+{
+    Shape data_shape{3, 4, 2};
+    Shape indices_shape{2, 2};
+    Shape updates_shape{2, 2};
+    auto D = make_shared<op::v0::Parameter>(element::f32, data_shape);
+    auto I = make_shared<op::v0::Parameter>(element::i64, indices_shape);
+    auto U = make_shared<op::v0::Parameter>(element::f32, updates_shape);
+    auto G = make_shared<op::v0::ScatterND>(D, I, U);
+    auto f = make_shared<Function>(OutputVector{G->output(0)}, ParameterVector{D, I, U});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto d = backend->create_tensor(element::f32, data_shape);
+    vector<float> data(shape_size(data_shape));
+    iota(data.begin(), data.end(), 0.0f);
+    copy_data(d, data);
+    auto i = backend->create_tensor(element::i64, indices_shape);
+    copy_data(i, vector<int64_t>{2, 1, 0, 3});
+    auto u = backend->create_tensor(element::f32, updates_shape);
+    copy_data(u, vector<float>{100, 101, 102, 103});
+    auto result = backend->create_tensor(element::f32, data_shape);
+
+    auto c = backend->compile(f);
+    c->call_with_validate({result}, {d, i, u});
+    vector<float> expected(data);
+    expected[18] = 100;
+    expected[19] = 101;
+    expected[6] = 102;
+    expected[7] = 103;
+    EXPECT_TRUE(
+        test::all_close_f(expected, read_vector<float>(result), MIN_FLOAT_TOLERANCE_BITS));
+}
@@ -0,0 +1,126 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/shared_backbone.hpp"
+#include "util/all_close_f.hpp"
+#include "util/test_control.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string s_manifest = "${MANIFEST}";
+
+// A backbone X * W + B followed by a different head in each function
+static shared_ptr<Function> make_family_member(bool negate)
+{
+    Shape shape{2, 2};
+    auto X = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto W = op::v0::Constant::create(element::f32, shape, {1, 2, 3, 4});
+    auto B = op::v0::Constant::create(element::f32, shape, {1, 1, 1, 1});
+    auto backbone = make_shared<op::v1::Add>(make_shared<op::v1::Multiply>(X, W), B);
+    shared_ptr<Node> head;
+    if (negate)
+    {
+        head = make_shared<op::v0::Negative>(backbone);
+    }
+    else
+    {
+        auto S = op::v0::Constant::create(element::f32, shape, {2, 2, 2, 2});
+        head = make_shared<op::v1::Multiply>(backbone, S);
+    }
+    return make_shared<Function>(OutputVector{head, X}, ParameterVector{X});
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, shared_backbone_partition)
+{
+    auto f = make_family_member(true);
+    auto g = make_family_member(false);
+    auto partition = runtime::SharedBackbone::partition({f, g});
+
+    ASSERT_NE(partition.backbone, nullptr);
+    ASSERT_EQ(partition.backbone->get_results().size(), 1);
+    EXPECT_TRUE(is_type<op::v1::Add>(partition.backbone->get_results()[0]->get_argument(0)));
+    EXPECT_EQ(count_ops_of_type<op::v0::Constant>(partition.backbone), 2);
+
+    ASSERT_EQ(partition.heads.size(), 2);
+    EXPECT_EQ(count_ops_of_type<op::v0::Constant>(partition.heads[0]), 0);
+    EXPECT_EQ(count_ops_of_type<op::v0::Constant>(partition.heads[1]), 1);
+    EXPECT_EQ(count_ops_of_type<op::v1::Add>(partition.heads[1]), 0);
+    for (auto& inputs : partition.head_inputs)
+    {
+        // The backbone output and the parameter passed through as a result
+        ASSERT_EQ(inputs.size(), 2);
+        size_t from_backbone = 0;
+        for (auto& input : inputs)
+        {
+            EXPECT_EQ(input.index, 0);
+            if (input.source == runtime::SharedBackbone::HeadInput::Source::backbone)
+            {
+                from_backbone++;
+            }
+        }
+        EXPECT_EQ(from_backbone, 1);
+    }
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, shared_backbone_nothing_shared)
+{
+    Shape shape{2};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::v0::Negative>(A), ParameterVector{A});
+    auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto g = make_shared<Function>(make_shared<op::v0::Abs>(B), ParameterVector{B});
+    auto partition = runtime::SharedBackbone::partition({f, g});
+    EXPECT_EQ(partition.backbone, nullptr);
+    ASSERT_EQ(partition.heads.size(), 2);
+    EXPECT_EQ(partition.heads[0]->get_ops().size(), f->get_ops().size());
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, shared_backbone_call)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    runtime::SharedBackbone family(backend, {make_family_member(true), make_family_member(false)});
+    ASSERT_EQ(family.get_function_count(), 2);
+
+    Shape shape{2, 2};
+    auto x = backend->create_tensor(element::f32, shape);
+    copy_data(x, vector<float>{1, 2, 3, 4});
+    vector<vector<shared_ptr<runtime::Tensor>>> outputs(2);
+    for (auto& output : outputs)
+    {
+        output.push_back(backend->create_tensor(element::f32, shape));
+        output.push_back(backend->create_tensor(element::f32, shape));
+    }
+
+    ASSERT_TRUE(family.call(1, outputs[1], {x}));
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(outputs[1][0]),
+                                  vector<float>{4, 10, 20, 34},
+                                  MIN_FLOAT_TOLERANCE_BITS));
+
+    copy_data(x, vector<float>{0, 1, 2, 3});
+    ASSERT_TRUE(family.call_all(outputs, {x}));
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(outputs[0][0]),
+                                  vector<float>{-1, -3, -7, -13},
+                                  MIN_FLOAT_TOLERANCE_BITS));
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(outputs[1][0]),
+                                  vector<float>{2, 6, 14, 26},
+                                  MIN_FLOAT_TOLERANCE_BITS));
+    EXPECT_TRUE(test::all_close_f(
+        read_vector<float>(outputs[0][1]), vector<float>{0, 1, 2, 3}, MIN_FLOAT_TOLERANCE_BITS));
+}
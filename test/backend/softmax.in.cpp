@@ -291,3 +291,47 @@ NGRAPH_TEST(${BACKEND_NAME}, softmax_overflow)
                            expf(5) / d2};
     EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result)));
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, softmax_middle_and_split_axes)
+{
+    // Inner extent spans more than one block of positions handled together
+    Shape shape{2, 5, 70};
+    vector<float> a_data(shape_size(shape));
+    for (size_t i = 0; i < a_data.size(); ++i)
+    {
+        a_data[i] = static_cast<float>((i * 37) % 23) - 11;
+    }
+
+    for (auto axes : {AxisSet{1}, AxisSet{0, 2}})
+    {
+        auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+        auto f = make_shared<Function>(make_shared<op::v0::Softmax>(A, axes), ParameterVector{A});
+
+        // Sums over the softmax axes, indexed by the position with those axes zeroed
+        vector<double> sums(a_data.size(), 0);
+        auto key = [&](size_t n, size_t c, size_t w) {
+            return ((axes.count(0) ? 0 : n) * 5 + (axes.count(1) ? 0 : c)) * 70 +
+                   (axes.count(2) ? 0 : w);
+        };
+        for (size_t n = 0; n < 2; ++n)
+            for (size_t c = 0; c < 5; ++c)
+                for (size_t w = 0; w < 70; ++w)
+                    sums[key(n, c, w)] += exp(a_data[(n * 5 + c) * 70 + w]);
+        vector<float> expected(a_data.size());
+        for (size_t n = 0; n < 2; ++n)
+            for (size_t c = 0; c < 5; ++c)
+                for (size_t w = 0; w < 70; ++w)
+                {
+                    size_t i = (n * 5 + c) * 70 + w;
+                    expected[i] = static_cast<float>(exp(a_data[i]) / sums[key(n, c, w)]);
+                }
+
+        auto backend = runtime::Backend::create("${BACKEND_NAME}");
+        auto a = backend->create_tensor(element::f32, shape);
+        copy_data(a, a_data);
+        auto result = backend->create_tensor(element::f32, shape);
+        auto handle = backend->compile(f);
+        handle->call_with_validate({result}, {a});
+        EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result)));
+    }
+}
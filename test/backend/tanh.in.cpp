@@ -65,3 +65,45 @@ NGRAPH_TEST(${BACKEND_NAME}, tanh)
     handle->call_with_validate({result}, {a});
     EXPECT_TRUE(test::all_close_f(input, read_vector<float>(result)));
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, tanh_exp_log_sqrt_4d)
+{
+    // Large enough for the vector body and tail of the JIT eltwise kernels
+    Shape shape{2, 3, 5, 7};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto tanh = make_shared<op::v0::Tanh>(A);
+    auto exp = make_shared<op::v0::Exp>(A);
+    auto log = make_shared<op::v0::Log>(exp);
+    auto sqrt = make_shared<op::v0::Sqrt>(exp);
+    auto f = make_shared<Function>(OutputVector{tanh, exp, log, sqrt}, ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    vector<float> input(shape_size(shape));
+    for (size_t i = 0; i < input.size(); i++)
+    {
+        input[i] = -4.0f + 8.0f * i / input.size();
+    }
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, input);
+    vector<shared_ptr<runtime::Tensor>> results;
+    for (size_t i = 0; i < 4; i++)
+    {
+        results.push_back(backend->create_tensor(element::f32, shape));
+    }
+
+    vector<float> expected_tanh, expected_exp, expected_sqrt;
+    for (float x : input)
+    {
+        expected_tanh.push_back(tanhf(x));
+        expected_exp.push_back(expf(x));
+        expected_sqrt.push_back(sqrtf(expf(x)));
+    }
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate(results, {a});
+    EXPECT_TRUE(test::all_close_f(expected_tanh, read_vector<float>(results[0])));
+    EXPECT_TRUE(test::all_close_f(expected_exp, read_vector<float>(results[1])));
+    EXPECT_TRUE(test::all_close_f(input, read_vector<float>(results[2])));
+    EXPECT_TRUE(test::all_close_f(expected_sqrt, read_vector<float>(results[3])));
+}
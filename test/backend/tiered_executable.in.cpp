@@ -0,0 +1,77 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/tiered_executable.hpp"
+#include "util/all_close_f.hpp"
+#include "util/test_control.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string s_manifest = "${MANIFEST}";
+
+NGRAPH_TEST(${BACKEND_NAME}, tiered_executable)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto C = make_shared<op::v0::Relu>(make_shared<op::v1::Add>(A, B));
+    auto f = make_shared<Function>(make_shared<op::v1::Multiply>(C, A), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    runtime::TieredExecutable exec(f, backend);
+    // The function itself is left alone
+    EXPECT_EQ(count_ops_of_type<op::v1::Add>(f), 1);
+
+    auto a = exec.create_input_tensor(0);
+    auto b = exec.create_input_tensor(1);
+    auto result = exec.create_output_tensor(0);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{-5, 6, -7, 8});
+    vector<float> expected{0, 16, 0, 48};
+
+    // Whichever tier serves the call, the result is the same
+    ASSERT_TRUE(exec.call_with_validate({result}, {a, b}));
+    EXPECT_TRUE(
+        test::all_close_f(read_vector<float>(result), expected, MIN_FLOAT_TOLERANCE_BITS));
+
+    EXPECT_TRUE(exec.wait_for_optimized());
+    EXPECT_TRUE(exec.is_optimized());
+    copy_data(result, vector<float>{0, 0, 0, 0});
+    ASSERT_TRUE(exec.call_with_validate({result}, {a, b}));
+    EXPECT_TRUE(
+        test::all_close_f(read_vector<float>(result), expected, MIN_FLOAT_TOLERANCE_BITS));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, tiered_executable_destroyed_while_compiling)
+{
+    Shape shape{3};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::v0::Abs>(A), ParameterVector{A});
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto exec = make_shared<runtime::TieredExecutable>(f, backend);
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, -2, 3});
+    auto result = backend->create_tensor(element::f32, shape);
+    ASSERT_TRUE(exec->call_with_validate({result}, {a}));
+    // Destruction waits for the background compile
+    exec.reset();
+    EXPECT_TRUE(test::all_close_f(
+        read_vector<float>(result), vector<float>{1, 2, 3}, MIN_FLOAT_TOLERANCE_BITS));
+}
@@ -1117,6 +1117,71 @@ NGRAPH_TEST(${BACKEND_NAME}, topk_3d_large_input_min)
     }
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, topk_2d_large_axis_small_k)
+{
+    // k is much smaller than the axis, with ties, so backends may take a selection path
+    Shape shape{3, 512};
+    Shape rshape{3, 4};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto B = make_shared<op::v0::TopK>(A, 1, element::i32, 4, true, op::v0::TopK::SortType::value);
+    auto C = make_shared<op::v0::TopK>(A, 1, element::i32, 4, false, op::v0::TopK::SortType::value);
+    auto f = make_shared<Function>(
+        OutputVector{B->output(0), B->output(1), C->output(0), C->output(1)},
+        ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Every value in [0, 256) appears twice in each row
+    vector<float> input(shape_size(shape));
+    for (size_t row = 0; row < 3; row++)
+    {
+        for (size_t i = 0; i < 512; i++)
+        {
+            input[row * 512 + i] = static_cast<float>((i * 37 + row * 101) % 256);
+        }
+    }
+    // Equal values are ordered by index
+    auto expected =
+        [&](const vector<int32_t>& values, vector<int32_t>& indices, vector<float>& out) {
+            for (size_t row = 0; row < 3; row++)
+            {
+                for (int32_t value : values)
+                {
+                    for (int32_t i = 0; i < 512; i++)
+                    {
+                        if (static_cast<int32_t>(input[row * 512 + i]) == value)
+                        {
+                            indices.push_back(i);
+                            out.push_back(static_cast<float>(value));
+                        }
+                    }
+                }
+            }
+        };
+    vector<int32_t> expected_max_indices;
+    vector<float> expected_max_values;
+    expected({255, 254}, expected_max_indices, expected_max_values);
+    vector<int32_t> expected_min_indices;
+    vector<float> expected_min_values;
+    expected({0, 1}, expected_min_indices, expected_min_values);
+
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, input);
+    auto max_indices = backend->create_tensor(element::i32, rshape);
+    auto max_values = backend->create_tensor(element::f32, rshape);
+    auto min_indices = backend->create_tensor(element::i32, rshape);
+    auto min_values = backend->create_tensor(element::f32, rshape);
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({max_indices, max_values, min_indices, min_values}, {a});
+    EXPECT_EQ(expected_max_indices, read_vector<int32_t>(max_indices));
+    EXPECT_TRUE(test::all_close_f(
+        expected_max_values, read_vector<float>(max_values), MIN_FLOAT_TOLERANCE_BITS));
+    EXPECT_EQ(expected_min_indices, read_vector<int32_t>(min_indices));
+    EXPECT_TRUE(test::all_close_f(
+        expected_min_values, read_vector<float>(min_values), MIN_FLOAT_TOLERANCE_BITS));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, topk_3d_single_output)
 {
     Shape shape{2, 3, 2};
@@ -0,0 +1,83 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "util/all_close_f.hpp"
+#include "util/test_control.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string s_manifest = "${MANIFEST}";
+
+// One SGD step per call on a weight kept in a variable, which the function returns as read
+static shared_ptr<Function> make_sgd_step(const Shape& shape)
+{
+    auto init = op::v0::Constant::create(element::f32, shape, {1, 2, 3, 4});
+    auto grad = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto weights = make_shared<op::v0::ReadVariable>(init, "weights");
+    auto learning_rate = op::v0::Constant::create(element::f32, shape, {0.5, 0.5, 0.5, 0.5});
+    auto update = make_shared<op::v1::Subtract>(
+        weights, make_shared<op::v1::Multiply>(learning_rate, grad));
+    auto assign = make_shared<op::v0::AssignVariable>(update, weights);
+    auto result = make_shared<op::v0::Result>(weights);
+    result->add_control_dependency(assign);
+    return make_shared<Function>(ResultVector{result}, ParameterVector{grad});
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, variable_update_across_calls)
+{
+    Shape shape{2, 2};
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto handle = backend->compile(make_sgd_step(shape));
+
+    auto grad = backend->create_tensor(element::f32, shape);
+    copy_data(grad, vector<float>{2, 2, 2, 2});
+    auto result = backend->create_tensor(element::f32, shape);
+
+    handle->call_with_validate({result}, {grad});
+    EXPECT_TRUE(test::all_close_f((vector<float>{1, 2, 3, 4}), read_vector<float>(result)));
+    handle->call_with_validate({result}, {grad});
+    EXPECT_TRUE(test::all_close_f((vector<float>{0, 1, 2, 3}), read_vector<float>(result)));
+    handle->call_with_validate({result}, {grad});
+    EXPECT_TRUE(test::all_close_f((vector<float>{-1, 0, 1, 2}), read_vector<float>(result)));
+
+    auto weights = backend->create_tensor(element::f32, shape);
+    ASSERT_TRUE(handle->read_variable("weights", weights));
+    EXPECT_TRUE(test::all_close_f((vector<float>{-2, -1, 0, 1}), read_vector<float>(weights)));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, variable_read_write)
+{
+    Shape shape{2, 2};
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto handle = backend->compile(make_sgd_step(shape));
+
+    auto weights = backend->create_tensor(element::f32, shape);
+    EXPECT_FALSE(handle->read_variable("weights", weights));
+
+    copy_data(weights, vector<float>{10, 20, 30, 40});
+    handle->write_variable("weights", weights);
+    auto grad = backend->create_tensor(element::f32, shape);
+    copy_data(grad, vector<float>{2, 4, 6, 8});
+    auto result = backend->create_tensor(element::f32, shape);
+    handle->call_with_validate({result}, {grad});
+    EXPECT_TRUE(test::all_close_f((vector<float>{10, 20, 30, 40}), read_vector<float>(result)));
+    ASSERT_TRUE(handle->read_variable("weights", weights));
+    EXPECT_TRUE(test::all_close_f((vector<float>{9, 18, 27, 36}), read_vector<float>(weights)));
+}
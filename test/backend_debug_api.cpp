@@ -22,6 +22,7 @@
 #include "gtest/gtest.h"
 #include "ngraph/log.hpp"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/interpreter/int_backend.hpp"
 #include "ngraph/runtime/interpreter/int_executable.hpp"
 #include "util/test_tools.hpp"
 
@@ -74,3 +75,217 @@ TEST(INTERPRETER, nan_check_output)
     ihandle->set_nan_check(true);
     EXPECT_ANY_THROW(handle->call_with_validate({result}, {a, b}));
 }
+
+TEST(INTERPRETER, arena_intermediates)
+{
+    Shape shape{16, 16};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>((A + B) * (A - B), ParameterVector{A, B});
+
+    shared_ptr<runtime::Backend> backend = runtime::Backend::create("INTERPRETER");
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>(shape_size(shape), 3));
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(b, vector<float>(shape_size(shape), 1));
+    auto result = backend->create_tensor(element::f32, shape);
+
+    shared_ptr<runtime::Executable> handle = backend->compile(f);
+    shared_ptr<runtime::interpreter::INTExecutable> ihandle =
+        static_pointer_cast<runtime::interpreter::INTExecutable>(handle);
+    ihandle->set_memory_plan_enabled(false);
+    ASSERT_NE(ihandle->get_arena(), nullptr);
+
+    for (size_t i = 0; i < 3; i++)
+    {
+        handle->call_with_validate({result}, {a, b});
+        EXPECT_EQ(read_vector<float>(result), vector<float>(shape_size(shape), 8));
+    }
+    // Add, Subtract and Multiply outputs are intermediates (Result copies the last one), all
+    // served from a single backing block
+    EXPECT_EQ(ihandle->get_arena()->get_allocation_count(), 9);
+    EXPECT_EQ(ihandle->get_arena()->get_system_allocation_count(), 1);
+
+    ihandle->set_arena_enabled(false);
+    EXPECT_EQ(ihandle->get_arena(), nullptr);
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_EQ(read_vector<float>(result), vector<float>(shape_size(shape), 8));
+}
+
+TEST(INTERPRETER, memory_plan_intermediates)
+{
+    Shape shape{16, 16};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+    shared_ptr<Node> node = A;
+    const size_t depth = 8;
+    for (size_t i = 0; i < depth; i++)
+    {
+        node = make_shared<op::v1::Add>(node, B);
+    }
+    auto f = make_shared<Function>(node, ParameterVector{A, B});
+
+    shared_ptr<runtime::Backend> backend = runtime::Backend::create("INTERPRETER");
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>(shape_size(shape), 0));
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(b, vector<float>(shape_size(shape), 1));
+    auto result = backend->create_tensor(element::f32, shape);
+
+    shared_ptr<runtime::Executable> handle = backend->compile(f);
+    shared_ptr<runtime::interpreter::INTExecutable> ihandle =
+        static_pointer_cast<runtime::interpreter::INTExecutable>(handle);
+
+    // A chain only ever needs two live intermediates
+    size_t tensor_size = shape_size(shape) * sizeof(float);
+    EXPECT_GT(ihandle->get_memory_pool_size(), 0);
+    EXPECT_LE(ihandle->get_memory_pool_size(), 2 * tensor_size);
+
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_EQ(read_vector<float>(result), vector<float>(shape_size(shape), depth));
+    EXPECT_EQ(ihandle->get_arena()->get_allocation_count(), 0);
+
+    ihandle->set_memory_plan_enabled(false);
+    EXPECT_EQ(ihandle->get_memory_pool_size(), 0);
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_EQ(read_vector<float>(result), vector<float>(shape_size(shape), depth));
+}
+
+TEST(INTERPRETER, intra_op_threads)
+{
+    Shape data_shape{8, 4, 32, 32};
+    Shape filter_shape{8, 4, 3, 3};
+    Shape matrix_shape{64, 32};
+    auto data = make_shared<op::v0::Parameter>(element::f32, data_shape);
+    auto filter = make_shared<op::v0::Parameter>(element::f32, filter_shape);
+    auto bias = make_shared<op::v0::Parameter>(element::f32, Shape{8, 1, 1});
+    auto matrix = make_shared<op::v0::Parameter>(element::f32, matrix_shape);
+    auto conv = make_shared<op::v0::Convolution>(data, filter);
+    auto relu = make_shared<op::v0::Relu>(make_shared<op::v1::Add>(conv, bias));
+    auto pool = make_shared<op::v0::MaxPool>(relu, Shape{2, 2}, Strides{2, 2});
+    auto softmax = make_shared<op::v0::Softmax>(relu, AxisSet{1});
+    auto sum = make_shared<op::v0::Sum>(relu, AxisSet{2, 3});
+    auto dot = make_shared<op::v0::Dot>(matrix, make_shared<op::v0::Sum>(matrix, AxisSet{0}), 1);
+    auto f = make_shared<Function>(OutputVector{pool, softmax, sum, dot},
+                                   ParameterVector{data, filter, bias, matrix});
+
+    default_random_engine engine(0);
+    uniform_real_distribution<float> distribution(-1, 1);
+    auto random_vector = [&](const Shape& shape) {
+        vector<float> values(shape_size(shape));
+        for (float& value : values)
+        {
+            value = distribution(engine);
+        }
+        return values;
+    };
+    vector<vector<float>> inputs{random_vector(data_shape),
+                                 random_vector(filter_shape),
+                                 random_vector(Shape{8, 1, 1}),
+                                 random_vector(matrix_shape)};
+
+    auto run = [&](const string& backend_name) {
+        shared_ptr<runtime::Backend> backend = runtime::Backend::create(backend_name);
+        vector<shared_ptr<runtime::Tensor>> args;
+        for (size_t i = 0; i < inputs.size(); i++)
+        {
+            args.push_back(
+                backend->create_tensor(element::f32, f->get_parameters()[i]->get_output_shape(0)));
+            copy_data(args.back(), inputs[i]);
+        }
+        vector<shared_ptr<runtime::Tensor>> results;
+        for (size_t i = 0; i < f->get_output_size(); i++)
+        {
+            results.push_back(backend->create_tensor(element::f32, f->get_output_shape(i)));
+        }
+        backend->compile(f)->call_with_validate(results, args);
+        vector<vector<float>> values;
+        for (auto& result : results)
+        {
+            values.push_back(read_vector<float>(result));
+        }
+        return values;
+    };
+
+    auto backend = runtime::Backend::create("INTERPRETER:threads=4");
+    EXPECT_EQ(static_pointer_cast<runtime::interpreter::INTBackend>(backend)->get_num_threads(),
+              4);
+    EXPECT_THROW(runtime::Backend::create("INTERPRETER:unknown=1"), ngraph_error);
+
+    // Partitions compute every output element exactly as the single-threaded kernel does
+    EXPECT_EQ(run("INTERPRETER:threads=4"), run("INTERPRETER"));
+}
+
+// Reports per-call system allocations for intermediate tensors with the default allocation
+// (one allocation per intermediate), with the arena and with the static memory plan.
+TEST(benchmark, interpreter_intermediate_allocations)
+{
+    Shape shape{32, 32};
+    const size_t depth = 32;
+    const size_t iterations = 1000;
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+    shared_ptr<Node> node = A;
+    for (size_t i = 0; i < depth; i++)
+    {
+        node = make_shared<op::v1::Add>(node, B);
+    }
+    auto f = make_shared<Function>(node, ParameterVector{A, B});
+
+    shared_ptr<runtime::Backend> backend = runtime::Backend::create("INTERPRETER");
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>(shape_size(shape), 0));
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(b, vector<float>(shape_size(shape), 1));
+    auto result = backend->create_tensor(element::f32, shape);
+
+    enum class Mode
+    {
+        DEFAULT,
+        ARENA,
+        MEMORY_PLAN
+    };
+    for (Mode mode : {Mode::DEFAULT, Mode::ARENA, Mode::MEMORY_PLAN})
+    {
+        shared_ptr<runtime::Executable> handle = backend->compile(f);
+        shared_ptr<runtime::interpreter::INTExecutable> ihandle =
+            static_pointer_cast<runtime::interpreter::INTExecutable>(handle);
+        ihandle->set_memory_plan_enabled(false);
+        handle->call({result}, {a, b});
+        // Every arena request is an allocation the default path makes per call
+        size_t intermediates = ihandle->get_arena()->get_allocation_count();
+        size_t system_allocations = ihandle->get_arena()->get_system_allocation_count();
+        ihandle->set_arena_enabled(mode == Mode::ARENA);
+        ihandle->set_memory_plan_enabled(mode == Mode::MEMORY_PLAN);
+
+        stopwatch timer;
+        timer.start();
+        for (size_t i = 0; i < iterations; i++)
+        {
+            handle->call({result}, {a, b});
+        }
+        timer.stop();
+
+        double allocations_per_call = 0;
+        string name;
+        switch (mode)
+        {
+        case Mode::DEFAULT:
+            name = "default";
+            allocations_per_call = intermediates;
+            break;
+        case Mode::ARENA:
+            name = "arena";
+            allocations_per_call =
+                double(ihandle->get_arena()->get_system_allocation_count() - system_allocations) /
+                iterations;
+            break;
+        case Mode::MEMORY_PLAN:
+            name = "memory plan (" + to_string(ihandle->get_memory_pool_size()) + " byte pool)";
+            break;
+        }
+        cout << name << ": " << allocations_per_call << " allocations/call, "
+             << timer.get_microseconds() / iterations << "us/call" << endl;
+        EXPECT_EQ(read_vector<float>(result), vector<float>(shape_size(shape), depth));
+    }
+}
@@ -16,19 +16,25 @@
 
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "gtest/gtest.h"
 
+#include "misc.hpp"
 #include "ngraph/codegen/compiler.hpp"
 #include "ngraph/codegen/execution_engine.hpp"
 #include "ngraph/env_util.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/op/add.hpp"
 #include "ngraph/op/concat.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/multiply.hpp"
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
+#include "util/all_close_f.hpp"
 #include "util/random.hpp"
 #include "util/test_tools.hpp"
 
@@ -141,3 +147,170 @@ TEST(benchmark, concat_32x1x200_axis1_6)
         }
     }
 }
+
+//
+// Compares the GFLOP/s of square f32 Dot on the INTERPRETER, which runs the blocked reference
+// GEMM, and on CPU, which runs the DNNL/Eigen kernels selected in cpu/builder/dot.cpp.
+//
+TEST(benchmark, dot_gflops)
+{
+    vector<std::string> backend_names{"INTERPRETER", "CPU"};
+    for (size_t size : {64, 256, 1024})
+    {
+        Shape shape{size, size};
+        vector<float> a_data(shape_size(shape));
+        vector<float> b_data(shape_size(shape));
+        for (size_t i = 0; i < a_data.size(); i++)
+        {
+            a_data[i] = static_cast<float>(i % 7) - 3.0f;
+            b_data[i] = static_cast<float>(i % 5) * 0.5f;
+        }
+        const size_t n_runs = size < 1024 ? 20 : 3;
+        double flops = 2.0 * size * size * size * n_runs;
+
+        vector<vector<float>> results;
+        for (std::string backend_name : backend_names)
+        {
+            auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+            auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+            auto f = make_shared<Function>(make_shared<op::v0::Dot>(A, B), ParameterVector{A, B});
+
+            auto backend = runtime::Backend::create(backend_name);
+            auto a = backend->create_tensor(element::f32, shape);
+            auto b = backend->create_tensor(element::f32, shape);
+            auto result = backend->create_tensor(element::f32, shape);
+            copy_data(a, a_data);
+            copy_data(b, b_data);
+            auto handle = backend->compile(f);
+            handle->call_with_validate({result}, {a, b});
+
+            stopwatch sw;
+            sw.start();
+            for (size_t j = 0; j < n_runs; j++)
+            {
+                handle->call_with_validate({result}, {a, b});
+            }
+            sw.stop();
+
+            std::cout << backend_name << " dot " << size << "x" << size << ": "
+                      << flops / std::max<size_t>(1, sw.get_nanoseconds()) << " GFLOP/s"
+                      << std::endl;
+            results.push_back(read_vector<float>(result));
+        }
+        EXPECT_TRUE(test::all_close_f(results[0], results[1]));
+    }
+}
+
+//
+// Measures CPU_Executable::call throughput as the number of concurrent callers and
+// runtime contexts (NGRAPH_CPU_CONCURRENCY) grows. Each calling thread owns its tensors.
+//
+TEST(benchmark, cpu_concurrent_call_throughput)
+{
+    Shape shape{64, 64};
+    const size_t n_calls_per_thread = 2000;
+    const size_t max_concurrency = std::max(1u, std::thread::hardware_concurrency());
+
+    vector<size_t> concurrency_levels;
+    for (size_t c = 1; c <= max_concurrency; c *= 2)
+    {
+        concurrency_levels.push_back(c);
+    }
+    if (concurrency_levels.back() != max_concurrency)
+    {
+        concurrency_levels.push_back(max_concurrency);
+    }
+
+    for (size_t concurrency : concurrency_levels)
+    {
+        set_environment("NGRAPH_CPU_CONCURRENCY", to_string(concurrency).c_str(), 1);
+
+        auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+        auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+        auto f = make_shared<Function>(make_shared<op::v1::Multiply>(A + B, B),
+                                       ParameterVector{A, B});
+
+        auto backend = runtime::Backend::create("CPU");
+        auto handle = backend->compile(f);
+
+        vector<vector<shared_ptr<runtime::Tensor>>> inputs(concurrency);
+        vector<shared_ptr<runtime::Tensor>> results(concurrency);
+        for (size_t t = 0; t < concurrency; t++)
+        {
+            auto a = backend->create_tensor(element::f32, shape);
+            auto b = backend->create_tensor(element::f32, shape);
+            copy_data(a, vector<float>(shape_size(shape), 1.0f));
+            copy_data(b, vector<float>(shape_size(shape), 2.0f));
+            inputs[t] = {a, b};
+            results[t] = backend->create_tensor(element::f32, shape);
+        }
+
+        stopwatch sw;
+        sw.start();
+        vector<thread> threads;
+        for (size_t t = 0; t < concurrency; t++)
+        {
+            threads.emplace_back([&, t]() {
+                for (size_t j = 0; j < n_calls_per_thread; j++)
+                {
+                    handle->call({results[t]}, inputs[t]);
+                }
+            });
+        }
+        for (auto& th : threads)
+        {
+            th.join();
+        }
+        sw.stop();
+
+        size_t total_calls = concurrency * n_calls_per_thread;
+        double calls_per_sec = total_calls * 1000000.0 / std::max<size_t>(1, sw.get_microseconds());
+        std::cout << "CPU concurrency " << concurrency << ": " << total_calls << " calls in "
+                  << sw.get_milliseconds() << "ms (" << static_cast<size_t>(calls_per_sec)
+                  << " calls/sec)" << std::endl;
+
+        for (size_t t = 0; t < concurrency; t++)
+        {
+            EXPECT_EQ(read_vector<float>(results[t]), vector<float>(shape_size(shape), 6.0f));
+        }
+    }
+    unset_environment("NGRAPH_CPU_CONCURRENCY");
+}
+
+//
+// Times the stages of starting the CPU backend. Loading the backend, its DNNL engine, thread
+// pools and op builders happen once per process, so run this test on its own:
+//   unit-test --gtest_filter=benchmark.cpu_backend_startup
+//
+TEST(benchmark, cpu_backend_startup)
+{
+    Shape shape{2, 2};
+    auto make_function = [&shape]() {
+        auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+        auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+        return make_shared<Function>(make_shared<op::v1::Add>(A, B), ParameterVector{A, B});
+    };
+
+    stopwatch sw;
+    sw.start();
+    auto backend = runtime::Backend::create("CPU");
+    sw.stop();
+    std::cout << "CPU backend created in " << sw.get_microseconds() << "us" << std::endl;
+
+    sw.start();
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    sw.stop();
+    std::cout << "Tensors created in " << sw.get_microseconds() << "us" << std::endl;
+
+    for (const char* compile : {"First", "Second"})
+    {
+        sw.start();
+        auto handle = backend->compile(make_function());
+        handle->call({result}, {a, b});
+        sw.stop();
+        std::cout << compile << " compile and call in " << sw.get_microseconds() << "us"
+                  << std::endl;
+    }
+}
@@ -259,3 +259,26 @@ TEST(bfloat16, assigns)
         EXPECT_EQ(f32arr[i], bf16arr[i]);
     }
 }
+
+TEST(bfloat16, bulk_conversions)
+{
+    mt19937 engine(0);
+    uniform_int_distribution<uint32_t> bits;
+    // Not a multiple of the vector width, so the scalar tail runs as well
+    vector<float> values(19 * 1024 + 3);
+    for (float& value : values)
+    {
+        value = test::FloatUnion(bits(engine)).f;
+    }
+    vector<bfloat16> converted(values.size());
+    bfloat16::from_float_buffer(values.data(), converted.data(), values.size());
+    vector<float> widened(values.size());
+    bfloat16::to_float_buffer(converted.data(), widened.data(), values.size());
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        bfloat16 expected(values[i]);
+        EXPECT_EQ(expected.to_bits(), converted[i].to_bits()) << i;
+        EXPECT_EQ(static_cast<uint32_t>(expected.to_bits()) << 16,
+                  test::FloatUnion(widened[i]).i);
+    }
+}
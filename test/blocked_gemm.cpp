@@ -0,0 +1,200 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cmath>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ngraph/runtime/reference/blocked_gemm.hpp"
+#include "ngraph/runtime/reference/dot.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Textbook triple loop, summing each output element in increasing k order
+template <typename T, typename ACCUMULATION>
+static void naive_gemm(const T* a, const T* b, T* c, size_t m, size_t n, size_t k)
+{
+    for (size_t i = 0; i < m; i++)
+    {
+        for (size_t j = 0; j < n; j++)
+        {
+            ACCUMULATION sum = 0;
+            for (size_t p = 0; p < k; p++)
+            {
+                sum = sum + static_cast<ACCUMULATION>(a[i * k + p]) *
+                                static_cast<ACCUMULATION>(b[p * n + j]);
+            }
+            c[i * n + j] = static_cast<T>(sum);
+        }
+    }
+}
+
+template <typename T>
+static vector<T> pattern_vector(size_t size, size_t seed)
+{
+    vector<T> values(size);
+    for (size_t i = 0; i < size; i++)
+    {
+        values[i] = static_cast<T>(static_cast<int>((i * 7 + seed * 13) % 17) - 8) /
+                    static_cast<T>(4);
+    }
+    return values;
+}
+
+// Sizes straddling the register tile and the cache blocks, including empty matrices
+static const vector<vector<size_t>> s_gemm_sizes{{1, 1, 1},
+                                                 {3, 5, 7},
+                                                 {4, 8, 16},
+                                                 {5, 9, 0},
+                                                 {0, 4, 4},
+                                                 {65, 33, 257},
+                                                 {130, 520, 300}};
+
+TEST(blocked_gemm, float_matches_naive)
+{
+    for (auto& size : s_gemm_sizes)
+    {
+        size_t m = size[0], n = size[1], k = size[2];
+        vector<float> a = pattern_vector<float>(m * k, 1);
+        vector<float> b = pattern_vector<float>(k * n, 2);
+        vector<float> expected(m * n, -1);
+        vector<float> result(m * n, -1);
+        naive_gemm<float, double>(a.data(), b.data(), expected.data(), m, n, k);
+        runtime::reference::blocked_gemm<float, float, float, double>(
+            a.data(), b.data(), result.data(), m, n, k);
+        EXPECT_EQ(result, expected) << m << "x" << n << "x" << k;
+    }
+}
+
+TEST(blocked_gemm, int_matches_naive)
+{
+    for (auto& size : s_gemm_sizes)
+    {
+        size_t m = size[0], n = size[1], k = size[2];
+        vector<int32_t> a = pattern_vector<int32_t>(m * k, 3);
+        vector<int32_t> b = pattern_vector<int32_t>(k * n, 4);
+        vector<int32_t> expected(m * n, -1);
+        vector<int32_t> result(m * n, -1);
+        naive_gemm<int32_t, int32_t>(a.data(), b.data(), expected.data(), m, n, k);
+        runtime::reference::blocked_gemm<int32_t, int32_t, int32_t, int32_t>(
+            a.data(), b.data(), result.data(), m, n, k);
+        EXPECT_EQ(result, expected) << m << "x" << n << "x" << k;
+    }
+}
+
+TEST(blocked_gemm, dot_multiple_reduction_axes)
+{
+    // [2, 3, 4, 5] . [4, 5, 6] over two axes is a [6, 20] x [20, 6] matrix product
+    Shape arg0_shape{2, 3, 4, 5};
+    Shape arg1_shape{4, 5, 6};
+    vector<float> a = pattern_vector<float>(shape_size(arg0_shape), 5);
+    vector<float> b = pattern_vector<float>(shape_size(arg1_shape), 6);
+    vector<float> expected(36);
+    vector<float> result(36);
+    naive_gemm<float, double>(a.data(), b.data(), expected.data(), 6, 6, 20);
+    runtime::reference::dot(
+        a.data(), b.data(), result.data(), arg0_shape, arg1_shape, Shape{2, 3, 6}, 2);
+    EXPECT_EQ(result, expected);
+}
+
+TEST(blocked_gemm, quantized_dot_matches_naive)
+{
+    float scale0 = 0.5f;
+    float scale1 = 0.125f;
+    float output_scale = 8.0f;
+    uint8_t zero_point0 = 7;
+    int8_t zero_point1 = -3;
+    int8_t output_zero_point = 2;
+    for (auto& size : s_gemm_sizes)
+    {
+        size_t m = size[0], n = size[1], k = size[2];
+        vector<uint8_t> a(m * k);
+        vector<int8_t> b(k * n);
+        vector<int32_t> a_shifted(a.size());
+        vector<int32_t> b_shifted(b.size());
+        for (size_t i = 0; i < a.size(); i++)
+        {
+            a[i] = static_cast<uint8_t>((i * 7) % 29);
+            a_shifted[i] = a[i] - zero_point0;
+        }
+        for (size_t i = 0; i < b.size(); i++)
+        {
+            b[i] = static_cast<int8_t>(static_cast<int>((i * 5) % 17) - 8);
+            b_shifted[i] = b[i] - zero_point1;
+        }
+        vector<int32_t> sums(m * n);
+        naive_gemm<int32_t, int32_t>(a_shifted.data(), b_shifted.data(), sums.data(), m, n, k);
+        float scale = scale0 * scale1 / output_scale;
+        vector<int8_t> expected(m * n);
+        for (size_t i = 0; i < sums.size(); i++)
+        {
+            expected[i] = static_cast<int8_t>(
+                static_cast<int8_t>(std::round(static_cast<float>(sums[i]) * scale)) +
+                output_zero_point);
+        }
+
+        vector<int8_t> result(m * n, -1);
+        runtime::reference::dot<uint8_t, int8_t, int8_t, int32_t>(a.data(),
+                                                                  b.data(),
+                                                                  result.data(),
+                                                                  Shape{m, k},
+                                                                  Shape{k, n},
+                                                                  Shape{m, n},
+                                                                  1,
+                                                                  &scale0,
+                                                                  &zero_point0,
+                                                                  &scale1,
+                                                                  &zero_point1,
+                                                                  &output_scale,
+                                                                  &output_zero_point);
+        EXPECT_EQ(result, expected) << m << "x" << n << "x" << k;
+    }
+}
+
+TEST(benchmark, blocked_gemm)
+{
+    for (size_t size : {64, 256, 512})
+    {
+        vector<float> a = pattern_vector<float>(size * size, 1);
+        vector<float> b = pattern_vector<float>(size * size, 2);
+        vector<float> c(size * size);
+        double flops = 2.0 * size * size * size;
+        const size_t iterations = 3;
+
+        stopwatch naive_timer;
+        naive_timer.start();
+        for (size_t i = 0; i < iterations; i++)
+        {
+            naive_gemm<float, double>(a.data(), b.data(), c.data(), size, size, size);
+        }
+        naive_timer.stop();
+
+        stopwatch blocked_timer;
+        blocked_timer.start();
+        for (size_t i = 0; i < iterations; i++)
+        {
+            runtime::reference::blocked_gemm<float, float, float, double>(
+                a.data(), b.data(), c.data(), size, size, size);
+        }
+        blocked_timer.stop();
+
+        cout << size << "x" << size << "x" << size << ": naive "
+             << flops * iterations / (naive_timer.get_nanoseconds() + 1) << " GFLOP/s, blocked "
+             << flops * iterations / (blocked_timer.get_nanoseconds() + 1) << " GFLOP/s" << endl;
+    }
+}
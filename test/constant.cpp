@@ -1389,3 +1389,50 @@ TEST(constant, bad_get_data_ptr)
         EXPECT_HAS_SUBSTRING(error.what(), std::string("get_data_ptr"));
     }
 }
+
+TEST(constant, lazy_data)
+{
+    size_t loads = 0;
+    op::v0::Constant c(element::i32, Shape{3}, [&loads]() {
+        loads++;
+        auto buffer = make_shared<runtime::AlignedBuffer>(3 * sizeof(int32_t));
+        vector<int32_t> values{1, 2, 3};
+        memcpy(buffer->get_ptr(), values.data(), buffer->size());
+        return buffer;
+    });
+    op::v0::Constant copy(c);
+    EXPECT_EQ(c.get_output_shape(0), (Shape{3}));
+    EXPECT_FALSE(c.is_data_loaded());
+    EXPECT_EQ(loads, 0);
+
+    EXPECT_EQ(copy.get_vector<int32_t>(), (vector<int32_t>{1, 2, 3}));
+    EXPECT_EQ(c.get_vector<int32_t>(), (vector<int32_t>{1, 2, 3}));
+    EXPECT_FALSE(c.get_all_data_elements_bitwise_identical());
+    EXPECT_TRUE(c.is_data_loaded());
+    EXPECT_EQ(loads, 1);
+}
+
+TEST(constant, bulk_conversions)
+{
+    // Broadcast of one value to a size that is not a power of two
+    op::v0::Constant broadcast(element::f64, Shape{7, 3}, vector<int32_t>{5});
+    EXPECT_EQ(broadcast.get_vector<double>(), vector<double>(21, 5.0));
+    EXPECT_TRUE(broadcast.get_all_data_elements_bitwise_identical());
+
+    op::v0::Constant empty(element::i16, Shape{0, 4}, vector<int16_t>{1});
+    EXPECT_TRUE(empty.get_vector<int16_t>().empty());
+
+    vector<float> values{1.0f, -2.5f, 0.5f, 8.0f};
+    op::v0::Constant same(element::f32, Shape{4}, values);
+    EXPECT_EQ(same.get_vector<float>(), values);
+    EXPECT_EQ(same.cast_vector<float>(), values);
+    EXPECT_EQ(same.cast_vector<int64_t>(), (vector<int64_t>{1, -2, 0, 8}));
+
+    op::v0::Constant half(element::f16, Shape{4}, values);
+    EXPECT_EQ(half.cast_vector<float>(), values);
+    op::v0::Constant brain(element::bf16, Shape{4}, values);
+    EXPECT_EQ(brain.cast_vector<float>(), values);
+
+    op::v0::Constant flags(element::boolean, Shape{3}, vector<char>{1, 0, 1});
+    EXPECT_EQ(flags.cast_vector<bool>(), (vector<bool>{true, false, true}));
+}
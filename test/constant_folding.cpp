@@ -3224,3 +3224,77 @@ TEST(constant_folding, constant_dyn_reshape_v1_pattern_with_zero_dims)
     test_constant_folding_reshape_v1(shape_in, values_in, {4}, {2, -1, 2, 0}, true);
     test_constant_folding_reshape_v1(shape_in, values_in, {4}, {4, 1, 0, 2}, true);
 }
+
+TEST(constant_folding, memoize_identical_subtrees)
+{
+    // Two copies of the same weight, each permuted the same way, and a third permuted differently
+    Shape shape_in{2, 3};
+    vector<float> values_in{0, 1, 2, 3, 4, 5};
+    auto weight0 = make_shared<op::v0::Constant>(element::f32, shape_in, values_in);
+    auto weight1 = make_shared<op::v0::Constant>(element::f32, shape_in, values_in);
+    auto reshape0 = make_shared<op::v0::Reshape>(weight0, AxisVector{1, 0}, Shape{3, 2});
+    auto reshape1 = make_shared<op::v0::Reshape>(weight1, AxisVector{1, 0}, Shape{3, 2});
+    auto reshape2 = make_shared<op::v0::Reshape>(weight1, AxisVector{0, 1}, Shape{3, 2});
+    auto f = make_shared<Function>(OutputVector{reshape0, reshape1, reshape2}, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(count_ops_of_type<op::v0::Reshape>(f), 0);
+    EXPECT_EQ(f->get_results().at(0)->get_argument(0), f->get_results().at(1)->get_argument(0));
+    EXPECT_NE(f->get_results().at(0)->get_argument(0), f->get_results().at(2)->get_argument(0));
+    EXPECT_EQ(get_result_constant<float>(f, 0), (vector<float>{0, 3, 1, 4, 2, 5}));
+    EXPECT_EQ(get_result_constant<float>(f, 2), values_in);
+}
+
+TEST(constant_folding, independent_subtrees)
+{
+    // Enough large independent subtrees for the waves to be folded on several threads
+    const size_t n_subtrees = 16;
+    Shape shape{64, 256};
+    OutputVector results;
+    for (size_t i = 0; i < n_subtrees; i++)
+    {
+        vector<float> values(shape_size(shape), static_cast<float>(i));
+        auto a = make_shared<op::v0::Constant>(element::f32, shape, values);
+        auto b = make_shared<op::v0::Constant>(element::f32, shape, vector<float>{1});
+        auto reshape = make_shared<op::v0::Reshape>(a + b, AxisVector{1, 0}, Shape{256, 64});
+        results.push_back(make_shared<op::v0::Negative>(reshape));
+    }
+    auto f = make_shared<Function>(results, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(count_ops_of_type<op::v0::Negative>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::v0::Constant>(f), n_subtrees);
+    for (size_t i = 0; i < n_subtrees; i++)
+    {
+        EXPECT_EQ(get_result_constant<float>(f, i),
+                  vector<float>(shape_size(shape), -static_cast<float>(i + 1)));
+    }
+}
+
+TEST(constant_folding, shared_input_in_one_wave)
+{
+    // A weight folded by the first wave and then preprocessed two ways in the second, so that
+    // two folds of the same wave read one constant that has no name yet
+    Shape shape{64, 256};
+    auto weight = make_shared<op::v0::Constant>(
+        element::f32, shape, vector<float>(shape_size(shape), 2.0f));
+    auto negative = make_shared<op::v0::Negative>(weight);
+    auto reshape = make_shared<op::v0::Reshape>(negative, AxisVector{1, 0}, Shape{256, 64});
+    auto convert = make_shared<op::v0::Convert>(negative, element::i32);
+    auto f = make_shared<Function>(OutputVector{reshape, convert}, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(count_ops_of_type<op::v0::Reshape>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::v0::Convert>(f), 0);
+    EXPECT_EQ(get_result_constant<float>(f, 0), vector<float>(shape_size(shape), -2.0f));
+    EXPECT_EQ(get_result_constant<int32_t>(f, 1), vector<int32_t>(shape_size(shape), -2));
+}
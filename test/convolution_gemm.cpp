@@ -0,0 +1,381 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cmath>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/convolution.hpp"
+#include "ngraph/util.hpp"
+#include "util/all_close_f.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Direct convolution summing over filter positions, then input channels, in the order the
+// CoordinateTransform walk of general_convolution used
+template <typename T>
+static void direct_convolution(const T* in,
+                               const T* filter,
+                               T* out,
+                               const Shape& in_shape,
+                               const Shape& filter_shape,
+                               const Shape& out_shape,
+                               const Strides& stride,
+                               const Strides& filter_dilation,
+                               const CoordinateDiff& in_pad_below,
+                               const Strides& in_dilation,
+                               size_t in_batch_axis,
+                               size_t in_channel_axis,
+                               size_t filter_out_channel_axis,
+                               size_t filter_in_channel_axis,
+                               size_t out_batch_axis,
+                               size_t out_channel_axis)
+{
+    size_t n_spatial = in_shape.size() - 2;
+    Shape filter_spatial(filter_shape.begin() + 2, filter_shape.end());
+    CoordinateTransform in_transform(in_shape);
+    CoordinateTransform filter_transform(filter_shape);
+    CoordinateTransform out_transform(out_shape);
+    for (const Coordinate& out_coord : out_transform)
+    {
+        double sum = 0;
+        for (const Coordinate& f : CoordinateTransform(filter_spatial))
+        {
+            Coordinate in_coord(in_shape.size());
+            Coordinate filter_coord(filter_shape.size());
+            bool valid = true;
+            for (size_t i = 0; i < n_spatial; i++)
+            {
+                ptrdiff_t pos = out_coord[i + 2] * stride[i] + f[i] * filter_dilation[i] -
+                                in_pad_below[i];
+                ptrdiff_t dilation = in_dilation[i];
+                valid = valid && pos >= 0 && pos % dilation == 0 &&
+                        pos / dilation < static_cast<ptrdiff_t>(in_shape[i + 2]);
+                in_coord[i + 2] = valid ? pos / dilation : 0;
+                filter_coord[i + 2] = f[i];
+            }
+            if (!valid)
+            {
+                continue;
+            }
+            in_coord[in_batch_axis] = out_coord[out_batch_axis];
+            filter_coord[filter_out_channel_axis] = out_coord[out_channel_axis];
+            for (size_t c = 0; c < in_shape[in_channel_axis]; c++)
+            {
+                in_coord[in_channel_axis] = c;
+                filter_coord[filter_in_channel_axis] = c;
+                sum += static_cast<double>(in[in_transform.index(in_coord)]) *
+                       static_cast<double>(filter[filter_transform.index(filter_coord)]);
+            }
+        }
+        out[out_transform.index(out_coord)] = static_cast<T>(sum);
+    }
+}
+
+static vector<float> pattern_vector(size_t size, size_t seed)
+{
+    vector<float> values(size);
+    for (size_t i = 0; i < size; i++)
+    {
+        values[i] = static_cast<float>(static_cast<int>((i * 7 + seed * 11) % 23) - 11) / 8.0f;
+    }
+    return values;
+}
+
+struct ConvolutionCase
+{
+    Shape in_shape;
+    Shape filter_shape;
+    Strides stride;
+    Strides filter_dilation;
+    CoordinateDiff pad_below;
+    CoordinateDiff pad_above;
+    Strides in_dilation;
+};
+
+static Shape convolution_out_shape(const ConvolutionCase& c)
+{
+    Shape out_shape{c.in_shape[0], c.filter_shape[0]};
+    for (size_t i = 0; i < c.in_shape.size() - 2; i++)
+    {
+        ptrdiff_t in_dim = (c.in_shape[i + 2] - 1) * c.in_dilation[i] + 1 + c.pad_below[i] +
+                           c.pad_above[i];
+        ptrdiff_t filter_dim = (c.filter_shape[i + 2] - 1) * c.filter_dilation[i] + 1;
+        out_shape.push_back((in_dim - filter_dim) / c.stride[i] + 1);
+    }
+    return out_shape;
+}
+
+// {in_shape, filter_shape, stride, filter_dilation, pad_below, pad_above, in_dilation}
+static const vector<ConvolutionCase> s_convolution_cases{
+    // 1D, 2D and 3D with strides, dilations and padding
+    {Shape{2, 3, 9}, Shape{4, 3, 3}, Strides{2}, Strides{1}, {1}, {0}, Strides{1}},
+    {Shape{2, 3, 7, 6}, Shape{5, 3, 2, 3}, Strides{1, 2}, Strides{2, 1}, {1, 0}, {0, 2}, {1, 1}},
+    {Shape{1, 2, 5, 5}, Shape{3, 2, 3, 3}, Strides{1, 1}, Strides{1, 1}, {0, 0}, {0, 0}, {2, 2}},
+    {Shape{1, 2, 6, 5}, Shape{2, 2, 2, 2}, Strides{1, 1}, Strides{1, 1}, {-1, 1}, {2, -1}, {1, 1}},
+    {Shape{1, 2, 4, 5, 3},
+     Shape{2, 2, 2, 3, 1},
+     Strides{1, 2, 1},
+     Strides{1, 1, 2},
+     {1, 1, 1},
+     {0, 1, 0},
+     Strides{1, 1, 1}},
+    // Winograd: 3x3 with unit strides, odd and even output sizes, padding
+    {Shape{2, 3, 8, 8}, Shape{4, 3, 3, 3}, Strides{1, 1}, Strides{1, 1}, {0, 0}, {0, 0}, {1, 1}},
+    {Shape{1, 5, 7, 9}, Shape{6, 5, 3, 3}, Strides{1, 1}, Strides{1, 1}, {1, 1}, {1, 1}, {1, 1}},
+    {Shape{1, 2, 5, 4}, Shape{3, 2, 3, 3}, Strides{1, 1}, Strides{1, 1}, {2, 0}, {-1, 1}, {1, 1}}};
+
+TEST(convolution_gemm, matches_direct)
+{
+    for (const ConvolutionCase& c : s_convolution_cases)
+    {
+        Shape out_shape = convolution_out_shape(c);
+        vector<float> in = pattern_vector(shape_size(c.in_shape), 1);
+        vector<float> filter = pattern_vector(shape_size(c.filter_shape), 2);
+        vector<float> expected(shape_size(out_shape));
+        vector<float> result(shape_size(out_shape));
+        direct_convolution(in.data(),
+                           filter.data(),
+                           expected.data(),
+                           c.in_shape,
+                           c.filter_shape,
+                           out_shape,
+                           c.stride,
+                           c.filter_dilation,
+                           c.pad_below,
+                           c.in_dilation,
+                           0,
+                           1,
+                           0,
+                           1,
+                           0,
+                           1);
+        runtime::reference::convolution(in.data(),
+                                        filter.data(),
+                                        result.data(),
+                                        c.in_shape,
+                                        c.filter_shape,
+                                        out_shape,
+                                        c.stride,
+                                        c.filter_dilation,
+                                        c.pad_below,
+                                        c.pad_above,
+                                        c.in_dilation);
+        bool winograd = c.filter_shape.size() == 4 && c.filter_shape[2] == 3 &&
+                        c.filter_shape[3] == 3 && c.stride == Strides{1, 1} &&
+                        c.in_dilation == Strides{1, 1};
+        if (winograd)
+        {
+            EXPECT_TRUE(test::all_close_f(result, expected)) << c.in_shape << " " << c.filter_shape;
+        }
+        else
+        {
+            EXPECT_EQ(result, expected) << c.in_shape << " " << c.filter_shape;
+        }
+    }
+}
+
+TEST(convolution_gemm, quantized_matches_direct)
+{
+    // u8 x i8 -> i8 with zero points on every tensor; padding must not see the input zero point
+    float input_scale = 0.5f;
+    float filter_scale = 0.25f;
+    float output_scale = 4.0f;
+    uint8_t input_zero_point = 3;
+    int8_t filter_zero_point = -2;
+    int8_t output_zero_point = 1;
+    for (const ConvolutionCase& c : s_convolution_cases)
+    {
+        Shape out_shape = convolution_out_shape(c);
+        vector<uint8_t> in(shape_size(c.in_shape));
+        vector<int8_t> filter(shape_size(c.filter_shape));
+        vector<double> in_shifted(in.size());
+        vector<double> filter_shifted(filter.size());
+        for (size_t i = 0; i < in.size(); i++)
+        {
+            in[i] = static_cast<uint8_t>((i * 7) % 23);
+            in_shifted[i] = static_cast<double>(in[i]) - input_zero_point;
+        }
+        for (size_t i = 0; i < filter.size(); i++)
+        {
+            filter[i] = static_cast<int8_t>(static_cast<int>((i * 5) % 13) - 6);
+            filter_shifted[i] = static_cast<double>(filter[i]) - filter_zero_point;
+        }
+
+        vector<double> sums(shape_size(out_shape));
+        direct_convolution(in_shifted.data(),
+                           filter_shifted.data(),
+                           sums.data(),
+                           c.in_shape,
+                           c.filter_shape,
+                           out_shape,
+                           c.stride,
+                           c.filter_dilation,
+                           c.pad_below,
+                           c.in_dilation,
+                           0,
+                           1,
+                           0,
+                           1,
+                           0,
+                           1);
+        float scale = input_scale * filter_scale / output_scale;
+        vector<int8_t> expected(sums.size());
+        for (size_t i = 0; i < sums.size(); i++)
+        {
+            expected[i] = static_cast<int8_t>(
+                static_cast<int8_t>(std::round(static_cast<float>(sums[i]) * scale)) +
+                output_zero_point);
+        }
+
+        vector<int8_t> result(shape_size(out_shape));
+        runtime::reference::convolution<uint8_t, int8_t, int8_t, int32_t>(in.data(),
+                                                                          filter.data(),
+                                                                          result.data(),
+                                                                          c.in_shape,
+                                                                          c.filter_shape,
+                                                                          out_shape,
+                                                                          c.stride,
+                                                                          c.filter_dilation,
+                                                                          c.pad_below,
+                                                                          c.pad_above,
+                                                                          c.in_dilation,
+                                                                          &input_scale,
+                                                                          &input_zero_point,
+                                                                          &filter_scale,
+                                                                          &filter_zero_point,
+                                                                          &output_scale,
+                                                                          &output_zero_point);
+        EXPECT_EQ(result, expected) << c.in_shape << " " << c.filter_shape;
+    }
+}
+
+TEST(convolution_gemm, backprop_axes)
+{
+    // The axis layouts convolution_backprop_filter and convolution_backprop_in pass to
+    // general_convolution, as {in_shape, filter_shape, out_shape, axes}. The second one is
+    // eligible for Winograd.
+    struct AxesCase
+    {
+        Shape in_shape;
+        Shape filter_shape;
+        Shape out_shape;
+        vector<size_t> axes;
+    };
+    vector<AxesCase> cases{
+        {Shape{3, 2, 6, 5}, Shape{3, 4, 4, 3}, Shape{4, 2, 3, 3}, {1, 0, 1, 0, 1, 0}},
+        {Shape{2, 3, 6, 5}, Shape{3, 4, 3, 3}, Shape{2, 4, 4, 3}, {0, 1, 1, 0, 0, 1}}};
+    for (const AxesCase& c : cases)
+    {
+        const vector<size_t>& axes = c.axes;
+        Strides unit{1, 1};
+        CoordinateDiff zero{0, 0};
+        vector<float> in = pattern_vector(shape_size(c.in_shape), 3);
+        vector<float> filter = pattern_vector(shape_size(c.filter_shape), 4);
+        vector<float> expected(shape_size(c.out_shape));
+        vector<float> result(shape_size(c.out_shape));
+        direct_convolution(in.data(),
+                           filter.data(),
+                           expected.data(),
+                           c.in_shape,
+                           c.filter_shape,
+                           c.out_shape,
+                           unit,
+                           unit,
+                           zero,
+                           unit,
+                           axes[0],
+                           axes[1],
+                           axes[2],
+                           axes[3],
+                           axes[4],
+                           axes[5]);
+        runtime::reference::general_convolution(in.data(),
+                                                filter.data(),
+                                                result.data(),
+                                                c.in_shape,
+                                                c.filter_shape,
+                                                c.out_shape,
+                                                unit,
+                                                unit,
+                                                zero,
+                                                zero,
+                                                unit,
+                                                axes[0],
+                                                axes[1],
+                                                axes[2],
+                                                axes[3],
+                                                axes[4],
+                                                axes[5]);
+        EXPECT_TRUE(test::all_close_f(result, expected)) << c.in_shape << " " << c.filter_shape;
+    }
+}
+
+TEST(benchmark, convolution_gemm)
+{
+    // im2col for a strided 3x3, Winograd for a unit stride 3x3
+    Shape in_shape{1, 32, 56, 56};
+    Shape filter_shape{32, 32, 3, 3};
+    for (size_t s : {2, 1})
+    {
+        ConvolutionCase c{
+            in_shape, filter_shape, Strides{s, s}, Strides{1, 1}, {1, 1}, {1, 1}, Strides{1, 1}};
+        Shape out_shape = convolution_out_shape(c);
+        vector<float> in = pattern_vector(shape_size(in_shape), 1);
+        vector<float> filter = pattern_vector(shape_size(filter_shape), 2);
+        vector<float> out(shape_size(out_shape));
+
+        stopwatch direct_timer;
+        direct_timer.start();
+        direct_convolution(in.data(),
+                           filter.data(),
+                           out.data(),
+                           in_shape,
+                           filter_shape,
+                           out_shape,
+                           c.stride,
+                           c.filter_dilation,
+                           c.pad_below,
+                           c.in_dilation,
+                           0,
+                           1,
+                           0,
+                           1,
+                           0,
+                           1);
+        direct_timer.stop();
+
+        stopwatch gemm_timer;
+        gemm_timer.start();
+        runtime::reference::convolution(in.data(),
+                                        filter.data(),
+                                        out.data(),
+                                        in_shape,
+                                        filter_shape,
+                                        out_shape,
+                                        c.stride,
+                                        c.filter_dilation,
+                                        c.pad_below,
+                                        c.pad_above,
+                                        c.in_dilation);
+        gemm_timer.stop();
+
+        cout << "3x3 stride " << s << ": direct " << direct_timer.get_microseconds()
+             << "us, reference " << gemm_timer.get_microseconds() << "us" << endl;
+    }
+}
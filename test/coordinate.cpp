@@ -305,6 +305,64 @@ TEST(DISABLED_coordinate, dilation)
     EXPECT_TRUE(it == ct.end());
 }
 
+// Checks IndexIterator against index() and has_source_coordinate() of the coordinate iterator
+static void check_index_iterator(CoordinateTransform& ct)
+{
+    auto index_it = ct.index_begin();
+    size_t target_index = 0;
+    for (const Coordinate& c : ct)
+    {
+        ASSERT_TRUE(index_it.valid());
+        EXPECT_EQ(index_it.target_index(), target_index++);
+        EXPECT_EQ(index_it.has_source(), ct.has_source_coordinate(c)) << c;
+        if (ct.has_source_coordinate(c))
+        {
+            EXPECT_EQ(index_it.source_index(), ct.index(c)) << c;
+        }
+        ++index_it;
+    }
+    EXPECT_FALSE(index_it.valid());
+}
+
+TEST(coordinate, index_iterator)
+{
+    {
+        auto ct = CoordinateTransform({});
+        check_index_iterator(ct);
+    }
+    {
+        auto ct = CoordinateTransform({2, 3, 4});
+        check_index_iterator(ct);
+    }
+    {
+        auto ct = CoordinateTransform({2, 0, 4});
+        check_index_iterator(ct);
+    }
+    {
+        // Slice
+        auto ct = CoordinateTransform({5, 7, 6}, {1, 0, 2}, {5, 7, 5}, {2, 3, 1});
+        check_index_iterator(ct);
+    }
+    {
+        // Transpose
+        auto ct = CoordinateTransform({2, 3, 4}, {0, 0, 0}, {2, 3, 4}, {1, 1, 1}, {2, 0, 1});
+        check_index_iterator(ct);
+    }
+    {
+        // Padding, including negative padding, and dilation
+        Shape source_shape{3, 4, 2};
+        auto ct = CoordinateTransform(source_shape,
+                                      {0, 0, 0},
+                                      {8, 3, 5},
+                                      {1, 2, 1},
+                                      {0, 1, 2},
+                                      {2, -1, 1},
+                                      {1, 0, 2},
+                                      {2, 1, 2});
+        check_index_iterator(ct);
+    }
+}
+
 TEST(benchmark, coordinate)
 {
     Shape source_shape{128, 3, 2000, 1000};
@@ -335,3 +393,57 @@ TEST(benchmark, coordinate)
     timer.stop();
     cout << "time: " << timer.get_milliseconds() << endl;
 }
+
+TEST(benchmark, coordinate_index_iterator)
+{
+    struct Case
+    {
+        string name;
+        CoordinateTransform transform;
+    };
+    vector<Case> cases{
+        {"copy 64x64x64", CoordinateTransform({64, 64, 64})},
+        {"slice 128x128x32 step 2",
+         CoordinateTransform({128, 128, 32}, {0, 0, 0}, {128, 128, 32}, {2, 2, 1})},
+        {"transpose 64x64x64",
+         CoordinateTransform({64, 64, 64}, {0, 0, 0}, {64, 64, 64}, {1, 1, 1}, {2, 1, 0})},
+        {"pad 1x3x224x224 by 3",
+         CoordinateTransform({1, 3, 224, 224},
+                             {0, 0, 0, 0},
+                             {1, 3, 230, 230},
+                             {1, 1, 1, 1},
+                             {0, 1, 2, 3},
+                             {0, 0, 3, 3},
+                             {0, 0, 3, 3})}};
+
+    for (auto& c : cases)
+    {
+        size_t coordinate_sum = 0;
+        stopwatch coordinate_timer;
+        coordinate_timer.start();
+        for (const Coordinate& coord : c.transform)
+        {
+            if (c.transform.has_source_coordinate(coord))
+            {
+                coordinate_sum += c.transform.index(coord);
+            }
+        }
+        coordinate_timer.stop();
+
+        size_t index_sum = 0;
+        stopwatch index_timer;
+        index_timer.start();
+        for (auto it = c.transform.index_begin(); it.valid(); ++it)
+        {
+            if (it.has_source())
+            {
+                index_sum += it.source_index();
+            }
+        }
+        index_timer.stop();
+
+        EXPECT_EQ(coordinate_sum, index_sum);
+        cout << c.name << ": Iterator " << coordinate_timer.get_milliseconds()
+             << "ms, IndexIterator " << index_timer.get_milliseconds() << "ms" << endl;
+    }
+}
@@ -15,7 +15,10 @@
 //*****************************************************************************
 
 #include "gtest/gtest.h"
+#include "misc.hpp"
+#include "ngraph/file_util.hpp"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/cpu/cpu_executable.hpp"
 #include "util/all_close_f.hpp"
 #include "util/ndarray.hpp"
 
@@ -60,3 +63,130 @@ TEST(cpu_codegen, abc)
                                   (test::NDArray<float, 2>({{50, 72}, {98, 128}})).get_vector(),
                                   MIN_FLOAT_TOLERANCE_BITS));
 }
+
+TEST(cpu_codegen, export_library)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto B = op::v0::Constant::create(element::f32, shape, {1, 2, 3, 4});
+    auto f = make_shared<Function>(A * B, ParameterVector{A});
+    string name = f->get_name();
+
+    auto backend = runtime::Backend::create("CPU");
+    ngraph::pass::PassConfig pass_config;
+    pass_config.set_pass_attribute("CODEGEN", true);
+    auto handle = backend->compile(f, pass_config);
+    auto exec = dynamic_pointer_cast<runtime::cpu::CPU_Executable>(handle);
+    ASSERT_NE(exec, nullptr);
+
+    string dir = file_util::path_join(file_util::get_temp_directory_path(), name + "_aot");
+    exec->export_library(dir);
+    EXPECT_TRUE(file_util::exists(file_util::path_join(dir, "CMakeLists.txt")));
+    EXPECT_TRUE(file_util::exists(file_util::path_join(dir, name + "_aot.h")));
+    EXPECT_TRUE(file_util::exists(file_util::path_join(dir, name + "_codegen.cpp")));
+    EXPECT_EQ(file_util::get_file_size(file_util::path_join(dir, name + ".weights")),
+              shape_size(shape) * sizeof(float));
+
+    // The C entry point and the constants replace the JIT and the graph
+    auto entry = file_util::read_file_to_string(file_util::path_join(dir, name + "_aot.cpp"));
+    EXPECT_NE(entry.find(name + "_create(const char* directory)"), string::npos);
+    EXPECT_NE(entry.find(name + "_bind_constants(constants);"), string::npos);
+    auto code = file_util::read_file_to_string(file_util::path_join(dir, name + "_codegen.cpp"));
+    EXPECT_EQ(code.find("__dso_handle"), string::npos);
+    file_util::remove_directory(dir);
+
+    auto g = make_shared<Function>(A + A, ParameterVector{A});
+    auto direct = dynamic_pointer_cast<runtime::cpu::CPU_Executable>(backend->compile(g));
+    EXPECT_THROW(direct->export_library(dir), ngraph_error);
+}
+
+TEST(cpu_codegen, export_library_parts)
+{
+    Shape shape{2, 2};
+    set_environment("NGRAPH_CPU_CODEGEN_COMPILE_THREADS", "2", 1);
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto B = op::v0::Constant::create(element::f32, shape, {1, 1, 1, 1});
+    auto C = op::v0::Constant::create(element::f32, shape, {0.5, 0.5, 0.5, 0.5});
+    shared_ptr<Node> X = A;
+    for (size_t i = 0; i < 80; i++)
+    {
+        X = make_shared<op::v1::Subtract>(make_shared<op::v1::Add>(X, B), C);
+    }
+    auto f = make_shared<Function>(X, ParameterVector{A});
+    string name = f->get_name();
+
+    auto backend = runtime::Backend::create("CPU");
+    ngraph::pass::PassConfig pass_config;
+    pass_config.set_pass_attribute("CODEGEN", true);
+    auto handle = backend->compile(f, pass_config);
+    unset_environment("NGRAPH_CPU_CODEGEN_COMPILE_THREADS");
+    auto exec = dynamic_pointer_cast<runtime::cpu::CPU_Executable>(handle);
+    ASSERT_NE(exec, nullptr);
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    handle->call_with_validate({result}, {a});
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(result), vector<float>{41, 42, 43, 44}));
+
+    string dir = file_util::path_join(file_util::get_temp_directory_path(), name + "_aot");
+    exec->export_library(dir);
+    auto cmake = file_util::read_file_to_string(file_util::path_join(dir, "CMakeLists.txt"));
+    auto part = name + "_part1_codegen.cpp";
+    ASSERT_TRUE(file_util::exists(file_util::path_join(dir, part)));
+    EXPECT_NE(cmake.find(part), string::npos);
+
+    // The runtime context helpers must be defined once or the parts do not link together
+    auto code = file_util::read_file_to_string(file_util::path_join(dir, name + "_codegen.cpp"));
+    auto part_code = file_util::read_file_to_string(file_util::path_join(dir, part));
+    EXPECT_NE(code.find("CPURuntimeContextCG* init_cg_ctx()\n{"), string::npos);
+    EXPECT_EQ(part_code.find("init_cg_ctx"), string::npos);
+    EXPECT_EQ(part_code.find("destroy_cg_ctx"), string::npos);
+    file_util::remove_directory(dir);
+}
+
+TEST(cpu_codegen, compile_cache)
+{
+    Shape shape{2, 2};
+    string cache_dir =
+        file_util::path_join(file_util::get_temp_directory_path(), "ngraph_codegen_cache_test");
+    file_util::remove_directory(cache_dir);
+    set_environment("NGRAPH_CPU_CACHE_DIR", cache_dir.c_str(), 1);
+
+    size_t object_files = 0;
+    for (size_t run = 0; run < 2; run++)
+    {
+        // Rebuilt functions get new names but must reuse the object file of the first run
+        auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+        auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+        auto f = make_shared<Function>(A * B + A, ParameterVector{A, B});
+
+        auto backend = runtime::Backend::create("CPU");
+        ngraph::pass::PassConfig pass_config;
+        pass_config.set_pass_attribute("CODEGEN", true);
+        auto handle = backend->compile(f, pass_config);
+
+        auto a = backend->create_tensor(element::f32, shape);
+        auto b = backend->create_tensor(element::f32, shape);
+        auto result = backend->create_tensor(element::f32, shape);
+        copy_data(a, vector<float>{1, 2, 3, 4});
+        copy_data(b, vector<float>{5, 6, 7, 8});
+        handle->call_with_validate({result}, {a, b});
+        EXPECT_TRUE(test::all_close_f(read_vector<float>(result), vector<float>{6, 14, 24, 36}));
+
+        object_files = 0;
+        file_util::iterate_files(cache_dir,
+                                 [&](const string& file, bool is_dir) {
+                                     if (!is_dir && file.size() > 2 &&
+                                         file.compare(file.size() - 2, 2, ".o") == 0)
+                                     {
+                                         object_files++;
+                                     }
+                                 },
+                                 false);
+        EXPECT_EQ(object_files, 1);
+    }
+
+    unset_environment("NGRAPH_CPU_CACHE_DIR");
+    file_util::remove_directory(cache_dir);
+}
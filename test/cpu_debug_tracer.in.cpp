@@ -88,6 +88,8 @@ NGRAPH_TEST(${BACKEND}, cpu_debug_tracer, check_flow_with_external_function)
 
     shared_ptr<runtime::Executable> handle = backend->compile(f);
     handle->call_with_validate({result}, {a, b});
+    // The tensors are written by another thread
+    runtime::cpu::CPU_DebugTracer::get().flush();
 
     // open two logs and parse them
     ifstream f_meta;
@@ -131,3 +133,22 @@ NGRAPH_TEST(${BACKEND}, cpu_debug_tracer, check_flow_with_external_function)
     remove(bin_log_file.c_str());
     unset_env_vars();
 }
+
+NGRAPH_TEST(${BACKEND}, cpu_debug_tracer, sample_calls_and_ops)
+{
+    set_environment("NGRAPH_CPU_TRACER_SAMPLE_PERIOD", "3", 1);
+    set_environment("NGRAPH_CPU_TRACER_OPS", "Add,Convolution", 1);
+    runtime::cpu::CPU_DebugTracer tracer;
+    unset_environment("NGRAPH_CPU_TRACER_SAMPLE_PERIOD");
+    unset_environment("NGRAPH_CPU_TRACER_OPS");
+
+    vector<bool> traced;
+    for (size_t i = 0; i < 7; i++)
+    {
+        traced.push_back(tracer.begin_call());
+    }
+    EXPECT_EQ(traced, (vector<bool>{true, false, false, true, false, false, true}));
+    EXPECT_TRUE(tracer.traces_op("Add"));
+    EXPECT_TRUE(tracer.traces_op("Convolution"));
+    EXPECT_FALSE(tracer.traces_op("Multiply"));
+}
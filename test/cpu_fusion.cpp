@@ -59,6 +59,7 @@
 #include "ngraph/pattern/op/skip.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor.hpp"
+#include "ngraph/runtime/cpu/op/allreduce_async.hpp"
 #include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
 #include "ngraph/runtime/cpu/op/bounded_relu.hpp"
 #include "ngraph/runtime/cpu/op/conv_add.hpp"
@@ -74,7 +75,10 @@
 #include "ngraph/runtime/cpu/op/rnn.hpp"
 #include "ngraph/runtime/cpu/op/rnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
+#include "ngraph/runtime/cpu/op/transfer_async.hpp"
 #include "ngraph/runtime/cpu/op/update_slice.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_allreduce_bucketing.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_async_transfers.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_mat_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_post_layout_optimizations.hpp"
@@ -610,6 +614,111 @@ TEST(cpu_fusion, fuse_rnn_input_across_time_steps_4d_data)
     EXPECT_EQ(ref_matmulbias_count, matmulbias_count);
 }
 
+TEST(cpu_fusion, allreduce_bucketing)
+{
+    // Each gradient is ready after the one before it, the backprop of a chain of layers
+    Shape shape{2, 2};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto g1 = make_shared<op::v0::Tanh>(A);
+    auto g2 = make_shared<op::v0::Tanh>(g1);
+    auto g3 = make_shared<op::v0::Tanh>(g2);
+    auto r3 = make_shared<op::v0::AllReduce>(g3);
+    auto r1 = make_shared<op::v0::AllReduce>(g1);
+    auto r2 = make_shared<op::v0::AllReduce>(g2);
+    auto func = make_shared<Function>(OutputVector{r3, r1, r2}, ParameterVector{A});
+
+    pass::Manager pass_manager;
+    // Room for two of the gradients a bucket
+    pass_manager.register_pass<runtime::cpu::pass::CPUAllReduceBucketing>(32);
+    pass_manager.run_passes(func);
+    ASSERT_EQ(count_ops_of_type<op::v0::AllReduce>(func), 0);
+    auto starts = get_ops_of_type<op::AllReduceStart>(func);
+    ASSERT_EQ(starts.size(), 2);
+    shared_ptr<Node> first = starts[0];
+    shared_ptr<Node> second = starts[1];
+    if (first->get_input_size() != 2)
+    {
+        swap(first, second);
+    }
+    ASSERT_EQ(first->get_input_size(), 2);
+    EXPECT_EQ(first->get_input_node_shared_ptr(0), g1);
+    EXPECT_EQ(first->get_input_node_shared_ptr(1), g2);
+    EXPECT_EQ(first->get_output_shape(0), Shape{8});
+    ASSERT_EQ(second->get_input_size(), 1);
+    EXPECT_EQ(second->get_input_node_shared_ptr(0), g3);
+    ASSERT_EQ(second->get_control_dependencies().size(), 1);
+    EXPECT_EQ(second->get_control_dependencies()[0], first);
+
+    for (auto wait : get_ops_of_type<op::AllReduceWait>(func))
+    {
+        ASSERT_EQ(wait->get_control_dependencies().size(), 1);
+        EXPECT_EQ(wait->get_control_dependencies()[0], second);
+    }
+    for (size_t i = 0; i < 3; i++)
+    {
+        auto wait = as_type_ptr<op::AllReduceWait>(func->get_results()[i]->get_argument(0));
+        ASSERT_NE(wait, nullptr);
+        EXPECT_EQ(func->get_results()[i]->get_input_shape(0), shape);
+    }
+    // r1 and r2 are the outputs of the wait of the first bucket
+    EXPECT_EQ(func->get_results()[1]->get_argument(0), func->get_results()[2]->get_argument(0));
+    EXPECT_EQ(func->get_results()[1]->input_value(0).get_index(), 0);
+    EXPECT_EQ(func->get_results()[2]->input_value(0).get_index(), 1);
+}
+
+TEST(cpu_fusion, allreduce_bucketing_dependent_reductions)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto r1 = make_shared<op::v0::AllReduce>(A);
+    auto r2 = make_shared<op::v0::AllReduce>(make_shared<op::v0::Tanh>(r1));
+    auto func = make_shared<Function>(r2, ParameterVector{A});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUAllReduceBucketing>();
+    pass_manager.run_passes(func);
+    EXPECT_EQ(count_ops_of_type<op::v0::AllReduce>(func), 2);
+    EXPECT_EQ(count_ops_of_type<op::AllReduceStart>(func), 0);
+}
+
+TEST(cpu_fusion, async_transfers)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto send = make_shared<op::v0::Send>(A, 1);
+    auto recv = make_shared<op::v0::Recv>(B, 1);
+    // Neither feeds the transfers nor needs them
+    auto tanh = make_shared<op::v0::Tanh>(A);
+    auto abs = make_shared<op::v0::Abs>(tanh);
+    auto add = make_shared<op::v1::Add>(recv, abs);
+    auto func = make_shared<Function>(OutputVector{send, add}, ParameterVector{A, B});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUAsyncTransfers>();
+    pass_manager.run_passes(func);
+    EXPECT_EQ(count_ops_of_type<op::v0::Send>(func), 0);
+    EXPECT_EQ(count_ops_of_type<op::v0::Recv>(func), 0);
+    ASSERT_EQ(count_ops_of_type<op::SendStart>(func), 1);
+    ASSERT_EQ(count_ops_of_type<op::RecvStart>(func), 1);
+    ASSERT_EQ(count_ops_of_type<op::TransferWait>(func), 2);
+
+    map<Node*, size_t> positions;
+    size_t position = 0;
+    for (auto node : func->get_ordered_ops())
+    {
+        positions[node.get()] = position++;
+    }
+    for (auto wait : get_ops_of_type<op::TransferWait>(func))
+    {
+        auto start = wait->get_input_node_ptr(0);
+        EXPECT_LT(positions.at(start), positions.at(tanh.get()));
+        EXPECT_GT(positions.at(wait.get()), positions.at(abs.get()));
+    }
+    EXPECT_TRUE(is_type<op::TransferWait>(add->get_input_node_ptr(0)));
+    EXPECT_TRUE(is_type<op::TransferWait>(func->get_results()[0]->get_input_node_ptr(0)));
+}
+
 #ifndef NGRAPH_JSON_DISABLE
 // Tests that rely on deserializing json files
 TEST(cpu_fusion, fuse_conv_bias)
@@ -768,3 +877,31 @@ TEST(cpu_fusion, fuse_1_layer_rnn)
 }
 
 #endif
+
+TEST(benchmark, cpu_fusion_models)
+{
+    // Time spent matching and rewriting, which is mostly failed matches
+    const vector<string> models{"mxnet/mxnet_densenet121_inference_batch1_float32.json",
+                                "mxnet/Sockeye_Seq2Seq_forward.json",
+                                "mxnet/Sockeye_Seq2Seq_backward.json",
+                                "mxnet/LSTM_backward.json",
+                                "mxnet/bn_bprop.json",
+                                "conv_bias.json"};
+    for (auto& model : models)
+    {
+        const string json_path = file_util::path_join(SERIALIZED_ZOO, model);
+        const string json_string = file_util::read_file_to_string(json_path);
+        stringstream ss(json_string);
+        shared_ptr<Function> func = ngraph::deserialize(ss);
+        size_t ops = func->get_ops().size();
+
+        pass::Manager pass_manager;
+        pass_manager.register_pass<runtime::cpu::pass::CPUFusion>();
+        stopwatch timer;
+        timer.start();
+        pass_manager.run_passes(func);
+        timer.stop();
+        cout << model << ": " << ops << " ops, CPUFusion " << timer.get_microseconds() << "us"
+             << endl;
+    }
+}
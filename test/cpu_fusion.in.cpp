@@ -23,6 +23,7 @@
 #include "gtest/gtest.h"
 #include "misc.hpp"
 #include "ngraph/autodiff/adjoints.hpp"
+#include "ngraph/builder/preprocess.hpp"
 #include "ngraph/env_util.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/graph_util.hpp"
@@ -54,26 +55,33 @@
 #include "ngraph/pass/graph_rewrite.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/reshape_elimination.hpp"
+#include "ngraph/pass/weight_compression.hpp"
 #include "ngraph/pattern/matcher.hpp"
 #include "ngraph/pattern/op/label.hpp"
 #include "ngraph/pattern/op/skip.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor.hpp"
+#include "ngraph/runtime/cpu/op/attention.hpp"
 #include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
 #include "ngraph/runtime/cpu/op/bounded_relu.hpp"
+#include "ngraph/runtime/cpu/op/compressed_weights.hpp"
 #include "ngraph/runtime/cpu/op/conv_add.hpp"
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
 #include "ngraph/runtime/cpu/op/deconv.hpp"
 #include "ngraph/runtime/cpu/op/dropout.hpp"
+#include "ngraph/runtime/cpu/op/elementwise_chain.hpp"
 #include "ngraph/runtime/cpu/op/gelu_backprop.hpp"
 #include "ngraph/runtime/cpu/op/group_conv_bias.hpp"
 #include "ngraph/runtime/cpu/op/leaky_relu.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
+#include "ngraph/runtime/cpu/op/optimizer_update.hpp"
+#include "ngraph/runtime/cpu/op/preprocess.hpp"
 #include "ngraph/runtime/cpu/op/rnn.hpp"
 #include "ngraph/runtime/cpu/op/rnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
+#include "ngraph/runtime/cpu/op/sparse_dot.hpp"
 #include "ngraph/runtime/cpu/op/update_slice.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_mat_fusion.hpp"
@@ -808,6 +816,47 @@ NGRAPH_TEST(${BACKEND_NAME}, cpu_fusion_conv_horizontal_fusion)
     }
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, cpu_fusion_matmul_horizontal_fusion)
+{
+    // Query, key and value projections of the same input
+    Shape shape_a{2, 4};
+    auto make_function = [shape_a]() {
+        auto A = std::make_shared<op::v0::Parameter>(element::f32, shape_a);
+        OutputVector projections;
+        ParameterVector params{A};
+        for (size_t columns : {3, 5, 2})
+        {
+            auto weights = std::make_shared<op::v0::Parameter>(element::f32, Shape{4, columns});
+            auto bias = std::make_shared<op::v0::Parameter>(element::f32, Shape{columns});
+            auto dot = std::make_shared<op::v0::Dot>(A, weights);
+            auto dot_bias = dot + std::make_shared<op::v0::Broadcast>(
+                                      bias, dot->get_output_shape(0), AxisSet{0});
+            projections.push_back(dot_bias);
+            params.push_back(weights);
+            params.push_back(bias);
+        }
+        return make_shared<Function>(projections, params);
+    };
+    auto int_f = make_function();
+    auto cpu_f = make_function();
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::v0::Parameter> param : cpu_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_output_shape(0)));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "${BACKEND_NAME}");
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i)));
+    }
+    ASSERT_EQ(count_ops_of_type<op::MatmulBias>(cpu_f), 1);
+}
+
 namespace
 {
     // ConvolutionBiasAdd relies on an in-place fused DNNL kernel.
@@ -888,6 +937,313 @@ NGRAPH_TEST(${BACKEND_NAME}, cpu_fusion_conv_add)
     EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0)));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, cpu_fusion_elementwise_chain)
+{
+    // More elements than the kernel processes per block
+    Shape shape{3, 700};
+    auto make_function = [&shape]() -> std::shared_ptr<Function> {
+        auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+        auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+        auto add = make_shared<op::v1::Add>(A, B);
+        auto mul = make_shared<op::v1::Multiply>(add, A);
+        auto tanh = make_shared<op::v0::Tanh>(mul);
+        auto sigmoid = make_shared<op::v0::Sigmoid>(B);
+        auto sub = make_shared<op::v1::Subtract>(tanh, sigmoid);
+        // add is also a result, so it has to stay outside of the chain
+        return make_shared<Function>(OutputVector{sub, add}, ParameterVector{A, B});
+    };
+
+    auto int_f = make_function();
+    auto cpu_f = make_function();
+    test::Uniform<float> rng(-2.0f, 2.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::v0::Parameter> param : cpu_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_output_shape(0)));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "${BACKEND_NAME}");
+    EXPECT_EQ(count_ops_of_type<op::ElementwiseChain>(cpu_f), 1);
+    EXPECT_EQ(count_ops_of_type<op::v1::Add>(cpu_f), 1);
+    EXPECT_EQ(count_ops_of_type<op::v0::Tanh>(cpu_f), 0);
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_fusion_sgd_momentum_update)
+{
+    Shape shape{3, 700};
+    auto make_function = [&shape]() -> std::shared_ptr<Function> {
+        auto W = make_shared<op::v0::Parameter>(element::f32, shape);
+        auto V = make_shared<op::v0::Parameter>(element::f32, shape);
+        auto G = make_shared<op::v0::Parameter>(element::f32, shape);
+        auto lr = make_shared<op::v0::Parameter>(element::f32, Shape{});
+        auto momentum = op::v0::Constant::create(element::f32, shape, {0.9f});
+        auto new_v = make_shared<op::v1::Add>(make_shared<op::v1::Multiply>(momentum, V), G);
+        auto new_w = make_shared<op::v1::Subtract>(
+            W,
+            make_shared<op::v1::Multiply>(
+                make_shared<op::v0::Broadcast>(lr, shape, AxisSet{0, 1}), new_v));
+        return make_shared<Function>(OutputVector{new_w, new_v}, ParameterVector{W, V, G, lr});
+    };
+
+    auto int_f = make_function();
+    auto cpu_f = make_function();
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::v0::Parameter> param : cpu_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_output_shape(0)));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "${BACKEND_NAME}");
+    EXPECT_EQ(count_ops_of_type<op::SGDMomentumUpdate>(cpu_f), 1);
+    EXPECT_EQ(count_ops_of_type<op::v1::Subtract>(cpu_f), 0);
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-5f, 1.0e-5f));
+    }
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_fusion_adam_update)
+{
+    Shape shape{3, 700};
+    auto make_function = [&shape]() -> std::shared_ptr<Function> {
+        auto W = make_shared<op::v0::Parameter>(element::f32, shape);
+        auto M = make_shared<op::v0::Parameter>(element::f32, shape);
+        auto V = make_shared<op::v0::Parameter>(element::f32, shape);
+        auto G = make_shared<op::v0::Parameter>(element::f32, shape);
+        auto lr = make_shared<op::v0::Parameter>(element::f32, Shape{});
+        auto uniform = [&shape](float value) {
+            return op::v0::Constant::create(element::f32, shape, {value});
+        };
+        auto new_m = make_shared<op::v1::Add>(make_shared<op::v1::Multiply>(uniform(0.9f), M),
+                                              make_shared<op::v1::Multiply>(uniform(0.1f), G));
+        auto new_v = make_shared<op::v1::Add>(
+            make_shared<op::v1::Multiply>(uniform(0.999f), V),
+            make_shared<op::v1::Multiply>(uniform(0.001f), make_shared<op::v1::Multiply>(G, G)));
+        auto denominator =
+            make_shared<op::v1::Add>(make_shared<op::v0::Sqrt>(new_v), uniform(1e-8f));
+        auto step = make_shared<op::v1::Divide>(
+            make_shared<op::v1::Multiply>(
+                make_shared<op::v0::Broadcast>(lr, shape, AxisSet{0, 1}), new_m),
+            denominator);
+        auto new_w = make_shared<op::v1::Subtract>(W, step);
+        return make_shared<Function>(OutputVector{new_w, new_m, new_v},
+                                     ParameterVector{W, M, V, G, lr});
+    };
+
+    auto int_f = make_function();
+    auto cpu_f = make_function();
+    test::Uniform<float> rng(0.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::v0::Parameter> param : cpu_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_output_shape(0)));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "${BACKEND_NAME}");
+    EXPECT_EQ(count_ops_of_type<op::AdamUpdate>(cpu_f), 1);
+    EXPECT_EQ(count_ops_of_type<op::v0::Sqrt>(cpu_f), 0);
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-5f, 1.0e-5f));
+    }
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_fusion_compressed_weights)
+{
+    // More rows of weights than one K block of the GEMM
+    Shape shape_data{5, 300};
+    Shape shape_weights{300, 40};
+    Shape shape_table{50, 33};
+    auto make_function = [&]() -> std::shared_ptr<Function> {
+        test::Uniform<float> rng(-1.0f, 1.0f);
+        vector<float> weights(shape_size(shape_weights));
+        rng.initialize(weights);
+        vector<float> table(shape_size(shape_table));
+        rng.initialize(table);
+        auto data = make_shared<op::v0::Parameter>(element::f32, shape_data);
+        auto indices = make_shared<op::v0::Parameter>(element::f32, Shape{7});
+        auto dot = make_shared<op::v0::Dot>(
+            data, op::v0::Constant::create(element::f32, shape_weights, weights));
+        auto lookup = make_shared<op::v0::EmbeddingLookup>(
+            indices, op::v0::Constant::create(element::f32, shape_table, table));
+        auto f = make_shared<Function>(OutputVector{dot, lookup}, ParameterVector{data, indices});
+        pass::Manager pass_manager;
+        pass_manager.register_pass<pass::WeightCompression>(4, 0);
+        pass_manager.run_passes(f);
+        return f;
+    };
+
+    auto int_f = make_function();
+    auto cpu_f = make_function();
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<float> data(shape_size(shape_data));
+    rng.initialize(data);
+    vector<vector<float>> args{data, {0, 49, 3, 3, 17, 48, 1}};
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "${BACKEND_NAME}");
+    EXPECT_EQ(count_ops_of_type<op::CompressedDot>(cpu_f), 1);
+    EXPECT_EQ(count_ops_of_type<op::CompressedEmbeddingLookup>(cpu_f), 1);
+    EXPECT_EQ(count_ops_of_type<op::v0::DecompressWeights>(cpu_f), 0);
+    EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0), 1.0e-4f, 1.0e-4f));
+    EXPECT_EQ(cpu_results.at(1), int_results.at(1));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_fusion_sparse_weights)
+{
+    // Unstructured pruning of a Dot's weights, and whole blocks of 8 output columns pruned from
+    // the transposed weights of a MatMul, with rows of data in a partial tile
+    Shape shape_data{10, 256};
+    Shape shape_weights{256, 70};
+    Shape shape_weights_t{68, 256};
+    auto make_function = [&]() -> std::shared_ptr<Function> {
+        test::Uniform<float> rng(-1.0f, 1.0f);
+        vector<float> weights(shape_size(shape_weights));
+        rng.initialize(weights);
+        for (size_t i = 0; i < weights.size(); i++)
+        {
+            weights[i] = i % 11 == 0 ? weights[i] : 0.0f;
+        }
+        vector<float> weights_t(shape_size(shape_weights_t));
+        rng.initialize(weights_t);
+        for (size_t i = 0; i < weights_t.size(); i++)
+        {
+            size_t output = i / shape_weights_t[1];
+            size_t input = i % shape_weights_t[1];
+            weights_t[i] = (input + output / 8) % 7 == 0 ? weights_t[i] : 0.0f;
+        }
+        auto data = make_shared<op::v0::Parameter>(element::f32, shape_data);
+        auto dot = make_shared<op::v0::Dot>(
+            data, op::v0::Constant::create(element::f32, shape_weights, weights));
+        auto matmul = make_shared<op::v0::MatMul>(
+            data, op::v0::Constant::create(element::f32, shape_weights_t, weights_t), false, true);
+        return make_shared<Function>(OutputVector{dot, matmul}, ParameterVector{data});
+    };
+
+    auto int_f = make_function();
+    auto cpu_f = make_function();
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<float> data(shape_size(shape_data));
+    rng.initialize(data);
+    vector<vector<float>> args{data};
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "${BACKEND_NAME}");
+    EXPECT_EQ(count_ops_of_type<op::SparseDot>(cpu_f), 2);
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-5f, 1.0e-5f));
+    }
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_fusion_scaled_dot_product_attention)
+{
+    // More queries than a tile and more keys than a block of the kernel
+    Shape shape_query{2, 3, 40, 16};
+    Shape shape_key{2, 3, 100, 16};
+    Shape shape_key_t{2, 3, 16, 100};
+    Shape shape_value{2, 3, 100, 8};
+    Shape shape_mask{2, 1, 1, 100};
+    auto make_function = [&]() -> std::shared_ptr<Function> {
+        auto query = make_shared<op::v0::Parameter>(element::f32, shape_query);
+        auto key = make_shared<op::v0::Parameter>(element::f32, shape_key);
+        auto key_t = make_shared<op::v0::Parameter>(element::f32, shape_key_t);
+        auto value = make_shared<op::v0::Parameter>(element::f32, shape_value);
+        auto mask = make_shared<op::v0::Parameter>(element::f32, shape_mask);
+
+        // softmax(q x k^T / sqrt(depth) + mask) x v
+        auto scores = make_shared<op::v0::MatMul>(query, key, false, true);
+        auto scaled = make_shared<op::v1::Divide>(
+            scores, op::v0::Constant::create(element::f32, Shape{}, {4.0f}));
+        auto masked = make_shared<op::v1::Add>(scaled, mask);
+        auto probs = make_shared<op::v1::Softmax>(masked, 3);
+        auto context = make_shared<op::v0::MatMul>(probs, value);
+
+        // softmax(q x k * 0.5) x v, the key already transposed
+        auto scores_t = make_shared<op::v0::MatMul>(query, key_t);
+        auto scaled_t = make_shared<op::v1::Multiply>(
+            op::v0::Constant::create(element::f32, Shape{}, {0.5f}), scores_t);
+        auto probs_t = make_shared<op::v1::Softmax>(scaled_t, 3);
+        auto context_t = make_shared<op::v0::MatMul>(probs_t, value);
+
+        return make_shared<Function>(OutputVector{context, context_t},
+                                     ParameterVector{query, key, key_t, value, mask});
+    };
+
+    auto int_f = make_function();
+    auto cpu_f = make_function();
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::v0::Parameter> param : cpu_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_output_shape(0)));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    // Mask out every seventh key
+    for (size_t i = 0; i < args[4].size(); i += 7)
+    {
+        args[4][i] = -10000.0f;
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "${BACKEND_NAME}");
+    EXPECT_EQ(count_ops_of_type<op::ScaledDotProductAttention>(cpu_f), 2);
+    EXPECT_EQ(count_ops_of_type<op::v0::Softmax>(cpu_f), 0);
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_fusion_preprocess)
+{
+    // u8 NHWC frames resized, normalized and transposed for a convolution expecting f32 NCHW
+    Shape shape_frames{2, 20, 22, 3};
+    Shape shape_input{2, 3, 16, 16};
+    Shape shape_weights{16, 3, 3, 3};
+    auto make_function = [&]() -> std::shared_ptr<Function> {
+        auto input = make_shared<op::v0::Parameter>(element::f32, shape_input);
+        auto weights = make_shared<op::v0::Parameter>(element::f32, shape_weights);
+        auto conv = make_shared<op::v0::Convolution>(input, weights);
+        auto f = make_shared<Function>(OutputVector{conv}, ParameterVector{input, weights});
+
+        builder::PreprocessSteps steps;
+        steps.frame_size = Shape{shape_frames[1], shape_frames[2]};
+        steps.resize_attrs.mode = op::v3::Interpolate::InterpolateMode::linear;
+        steps.mean = {123.7f, 116.3f, 103.5f};
+        steps.scale = {1.0f / 58.4f, 1.0f / 57.1f, 1.0f / 57.4f};
+        auto frames = builder::add_preprocessing(f, 0, steps);
+        EXPECT_EQ(frames->get_output_shape(0), shape_frames);
+        return f;
+    };
+
+    auto int_f = make_function();
+    auto cpu_f = make_function();
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<float> weights(shape_size(shape_weights));
+    rng.initialize(weights);
+    vector<uint8_t> frames(shape_size(shape_frames));
+    for (size_t i = 0; i < frames.size(); i++)
+    {
+        frames[i] = static_cast<uint8_t>((i * 37) % 256);
+    }
+    auto int_results = execute<uint8_t, float, float>(int_f, {frames}, {weights}, "INTERPRETER");
+    auto cpu_results =
+        execute<uint8_t, float, float>(cpu_f, {frames}, {weights}, "${BACKEND_NAME}");
+    EXPECT_EQ(count_ops_of_type<op::Preprocess>(cpu_f), 1);
+    EXPECT_EQ(count_ops_of_type<op::v0::Convert>(cpu_f), 0);
+    EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0), 1.0e-4f, 1.0e-4f));
+}
+
 namespace
 {
     shared_ptr<Function> gen_groupconv_batchnorm(const bool add_goe,
@@ -1465,6 +1821,104 @@ NGRAPH_TEST(${BACKEND_NAME}, cpu_fusion_convbias_affine_folding2)
     EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0)));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, cpu_fusion_matmulbias_batch_norm_folding)
+{
+    Shape shape_input{4, 6};
+    Shape shape_weights{6, 3};
+    Shape shape_norm{3};
+
+    auto make_function = [shape_input, shape_weights, shape_norm]() {
+        auto input = std::make_shared<op::v0::Parameter>(element::f32, shape_input);
+        auto weights = std::make_shared<op::v0::Parameter>(element::f32, shape_weights);
+        auto bias = std::make_shared<op::v0::Parameter>(element::f32, shape_norm);
+        double eps = 1.01;
+        auto gamma = std::make_shared<op::v0::Parameter>(element::f32, shape_norm);
+        auto beta = std::make_shared<op::v0::Parameter>(element::f32, shape_norm);
+        auto mean = std::make_shared<op::v0::Parameter>(element::f32, shape_norm);
+        auto var = std::make_shared<op::v0::Parameter>(element::f32, shape_norm);
+        auto dot = std::make_shared<op::v0::Dot>(input, weights);
+        auto dotbias = dot + std::make_shared<op::v0::Broadcast>(
+                                 bias, dot->get_output_shape(0), AxisSet{0});
+        auto bn =
+            std::make_shared<op::v0::BatchNormInference>(dotbias, gamma, beta, mean, var, eps);
+        auto f = make_shared<Function>(
+            OutputVector{bn}, ParameterVector{input, weights, bias, gamma, beta, mean, var});
+        return f;
+    };
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUFusion>();
+    auto func = make_function();
+    pass_manager.run_passes(func);
+    ASSERT_EQ(count_ops_of_type<op::MatmulBias>(func), 1);
+    ASSERT_EQ(count_ops_of_type<op::v0::BatchNormInference>(func), 0);
+
+    auto int_f = make_function();
+    auto cpu_f = make_function();
+
+    test::Uniform<float> rng(1.0f, 100.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::v0::Parameter> param : cpu_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_output_shape(0)));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "${BACKEND_NAME}");
+    EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0)));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_fusion_matmul_affine_folding)
+{
+    Shape shape_input{4, 6};
+    Shape shape_weights{3, 6};
+    Shape shape_norm{3};
+
+    auto make_function = [shape_input, shape_weights, shape_norm]() {
+        auto input = std::make_shared<op::v0::Parameter>(element::f32, shape_input);
+        auto weights = std::make_shared<op::v0::Parameter>(element::f32, shape_weights);
+
+        auto a = std::make_shared<op::v0::Parameter>(element::f32, shape_norm);
+        auto b = std::make_shared<op::v0::Parameter>(element::f32, Shape{});
+        auto dot = std::make_shared<op::v0::Dot>(
+            input, std::make_shared<op::v0::Reshape>(weights, AxisVector{1, 0}, Shape{6, 3}));
+        auto out = std::make_shared<op::v1::Add>(
+            std::make_shared<op::v1::Multiply>(
+                dot, std::make_shared<op::v0::Broadcast>(a, dot->get_output_shape(0), AxisSet{0})),
+            std::make_shared<op::v0::Broadcast>(b, dot->get_output_shape(0), AxisSet{0, 1}));
+        auto f = make_shared<Function>(OutputVector{out}, ParameterVector{input, weights, a, b});
+        return f;
+    };
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUFusion>();
+    auto func = make_function();
+    pass_manager.run_passes(func);
+    ASSERT_EQ(count_ops_of_type<op::MatmulBias>(func), 1);
+    ASSERT_EQ(count_ops_of_type<op::v1::Add>(func), 0);
+    auto mmb = as_type_ptr<op::MatmulBias>(func->get_results().at(0)->get_argument(0));
+    ASSERT_TRUE(mmb);
+    EXPECT_TRUE(mmb->get_is_b_transposed());
+
+    auto int_f = make_function();
+    auto cpu_f = make_function();
+
+    test::Uniform<float> rng(-10.0f, 10.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::v0::Parameter> param : cpu_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_output_shape(0)));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "${BACKEND_NAME}");
+    EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0)));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, batch_fusion_group_convolution)
 {
     auto backend = runtime::Backend::create("${BACKEND_NAME}");
@@ -2149,6 +2603,72 @@ NGRAPH_TEST(${BACKEND_NAME}, cpu_fusion_fuse_dropout)
     }
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, cpu_fusion_fuse_dropout_backprop)
+{
+    Shape shape{2, 3, 64, 64};
+    double keep_prob = 0.9;
+    auto input = std::make_shared<op::v0::Parameter>(element::f32, shape);
+    auto delta = std::make_shared<op::v0::Parameter>(element::f32, shape);
+    auto value = op::v0::Constant::create(element::f32, shape, {keep_prob});
+    auto const1 = op::v0::Constant::create(element::f32, Shape{}, {1});
+    auto gen_mask = std::make_shared<op::v0::GenerateMask>(
+        const1, shape, element::f32, 0, keep_prob, false);
+    auto dropout = std::make_shared<op::v1::Divide>(
+        std::make_shared<op::v1::Multiply>(gen_mask, input), value);
+    auto backprop = std::make_shared<op::v1::Multiply>(
+        gen_mask, std::make_shared<op::v1::Divide>(delta, value));
+    auto f = make_shared<Function>(OutputVector{dropout, backprop},
+                                   ParameterVector{input, delta});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUFusion>();
+    pass_manager.run_passes(f);
+    ASSERT_EQ(count_ops_of_type<op::Dropout>(f), 1);
+    ASSERT_EQ(count_ops_of_type<op::DropoutBackprop>(f), 1);
+    ASSERT_EQ(count_ops_of_type<op::v1::Multiply>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Divide>(f), 0);
+    auto fused = as_type_ptr<op::DropoutBackprop>(f->get_results().at(1)->get_argument(0));
+    ASSERT_TRUE(fused);
+    EXPECT_TRUE(fused->get_scale());
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto out = backend->create_tensor(element::f32, shape);
+    auto d_input = backend->create_tensor(element::f32, shape);
+    vector<float> input_val(shape_size(shape));
+    vector<float> delta_val(shape_size(shape));
+    test::Uniform<float> rng(1.0f, 100.0f);
+    rng.initialize(input_val);
+    rng.initialize(delta_val);
+    copy_data(a, input_val);
+    copy_data(b, delta_val);
+
+    // Without a seed every call draws a new mask, which the backprop has to follow
+    auto handle = backend->compile(f);
+    vector<float> first_out;
+    for (size_t call = 0; call < 2; call++)
+    {
+        handle->call_with_validate({out, d_input}, {a, b});
+        auto out_val = read_vector<float>(out);
+        auto d_input_val = read_vector<float>(d_input);
+        vector<float> expected(shape_size(shape));
+        for (size_t i = 0; i < expected.size(); i++)
+        {
+            expected[i] = out_val[i] == 0 ? 0 : delta_val[i] / static_cast<float>(keep_prob);
+        }
+        EXPECT_TRUE(test::all_close_f(d_input_val, expected, MIN_FLOAT_TOLERANCE_BITS));
+        if (call == 0)
+        {
+            first_out = out_val;
+        }
+        else
+        {
+            EXPECT_FALSE(test::all_close_f(out_val, first_out, MIN_FLOAT_TOLERANCE_BITS));
+        }
+    }
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, cpu_fusion_fuse_leaky_relu)
 {
     auto make_function = [](Shape input_shape, vector<float> alpha_val) {
@@ -2538,6 +3058,33 @@ NGRAPH_TEST(${BACKEND_NAME}, cpu_quant_fusion_qconv_relu)
     EXPECT_TRUE(test::all_close(cpu1_results.at(0), cpu2_results.at(0)));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, cpu_quant_fusion_qdot_nonzero_zero_point)
+{
+    auto data = make_shared<op::v0::Parameter>(element::u8, Shape{2, 3});
+    auto weights = op::v0::Constant::create(
+        element::i8, Shape{3, 4}, {1, -2, 3, -4, 5, -6, 7, -8, 9, 10, 11, 12});
+    auto constant = [](const element::Type& type, float value) {
+        return op::v0::Constant::create(type, Shape{}, {value});
+    };
+    auto qdot = make_shared<op::v0::QuantizedDot>(data,
+                                                  weights,
+                                                  1,
+                                                  constant(element::f32, 0.5f),
+                                                  constant(element::u8, 2),
+                                                  constant(element::f32, 0.25f),
+                                                  constant(element::i8, 0),
+                                                  constant(element::f32, 0.5f),
+                                                  constant(element::i8, 1),
+                                                  element::i8);
+    auto f = make_shared<Function>(qdot, ParameterVector{data});
+
+    // QuantizedMatmul ignores zero points, so this QuantizedDot must not be rewritten to it
+    vector<vector<uint8_t>> args{{0, 1, 2, 7, 20, 30}};
+    auto expected = execute<uint8_t, int8_t>(f, args, "INTERPRETER");
+    auto actual = execute<uint8_t, int8_t>(f, args, "${BACKEND_NAME}");
+    EXPECT_EQ(actual.at(0), expected.at(0));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, cpu_quant_fusion_qconvb_relu)
 {
     auto make_function = []() {
@@ -3239,6 +3786,117 @@ NGRAPH_TEST(${BACKEND_NAME}, cpu_fusion_lstm_cell)
     }
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, cpu_fusion_lstm_sequence)
+{
+    const size_t seq_length = 3;
+    const size_t batch_size = 2;
+    const size_t input_size = 4;
+    const size_t hidden_size = 3;
+    auto make_function = [&](op::v0::LSTMSequence::direction direction) {
+        const size_t num_directions =
+            direction == op::v0::LSTMSequence::direction::BIDIRECTIONAL ? 2 : 1;
+        const auto X = make_shared<op::v0::Parameter>(element::f32,
+                                                      Shape{seq_length, batch_size, input_size});
+        const auto H_t = make_shared<op::v0::Parameter>(
+            element::f32, Shape{num_directions, batch_size, hidden_size});
+        const auto C_t = make_shared<op::v0::Parameter>(
+            element::f32, Shape{num_directions, batch_size, hidden_size});
+        const auto W = make_shared<op::v0::Parameter>(
+            element::f32, Shape{num_directions, 4 * hidden_size, input_size});
+        const auto R = make_shared<op::v0::Parameter>(
+            element::f32, Shape{num_directions, 4 * hidden_size, hidden_size});
+        const auto B =
+            make_shared<op::v0::Parameter>(element::f32, Shape{num_directions, 4 * hidden_size});
+        const auto seq_lengths = op::v0::Constant::create(
+            element::i32, Shape{batch_size}, vector<int32_t>(batch_size, seq_length));
+        const auto lstm_sequence = make_shared<op::v0::LSTMSequence>(X,
+                                                                     H_t,
+                                                                     C_t,
+                                                                     seq_lengths,
+                                                                     W,
+                                                                     R,
+                                                                     B,
+                                                                     hidden_size,
+                                                                     direction,
+                                                                     op::LSTMWeightsFormat::IOFC);
+        return make_shared<Function>(lstm_sequence->outputs(),
+                                     ParameterVector{X, H_t, C_t, W, R, B});
+    };
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    for (auto direction : {op::v0::LSTMSequence::direction::FORWARD,
+                           op::v0::LSTMSequence::direction::REVERSE,
+                           op::v0::LSTMSequence::direction::BIDIRECTIONAL})
+    {
+        auto lstm_function_cpu = make_function(direction);
+        vector<vector<float>> args;
+        for (shared_ptr<op::v0::Parameter> param : lstm_function_cpu->get_parameters())
+        {
+            vector<float> tensor_val(shape_size(param->get_output_shape(0)));
+            rng.initialize(tensor_val);
+            args.push_back(tensor_val);
+        }
+
+        auto int_results = execute(make_function(direction), args, "INTERPRETER");
+        auto cpu_results = execute(lstm_function_cpu, args, "${BACKEND_NAME}");
+        EXPECT_EQ(count_ops_of_type<op::v0::LSTMSequence>(lstm_function_cpu), 0);
+        EXPECT_EQ(count_ops_of_type<op::Rnn>(lstm_function_cpu), 1);
+        for (size_t i = 0; i < cpu_results.size(); i++)
+        {
+            EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+        }
+    }
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_fusion_gru_cell)
+{
+    const size_t batch_size = 2;
+    const size_t input_size = 4;
+    const size_t hidden_size = 3;
+    auto make_function = [&](bool linear_before_reset) {
+        const auto X = make_shared<op::v0::Parameter>(element::f32, Shape{batch_size, input_size});
+        const auto H_t =
+            make_shared<op::v0::Parameter>(element::f32, Shape{batch_size, hidden_size});
+        const auto W =
+            make_shared<op::v0::Parameter>(element::f32, Shape{3 * hidden_size, input_size});
+        const auto R =
+            make_shared<op::v0::Parameter>(element::f32, Shape{3 * hidden_size, hidden_size});
+        const auto B = make_shared<op::v0::Parameter>(
+            element::f32, Shape{(linear_before_reset ? 4 : 3) * hidden_size});
+        const auto gru_cell = make_shared<op::v3::GRUCell>(X,
+                                                           H_t,
+                                                           W,
+                                                           R,
+                                                           B,
+                                                           hidden_size,
+                                                           vector<string>{"sigmoid", "tanh"},
+                                                           vector<float>{},
+                                                           vector<float>{},
+                                                           0.f,
+                                                           linear_before_reset);
+        return make_shared<Function>(gru_cell, ParameterVector{X, H_t, W, R, B});
+    };
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    for (bool linear_before_reset : {false, true})
+    {
+        auto gru_function_cpu = make_function(linear_before_reset);
+        vector<vector<float>> args;
+        for (shared_ptr<op::v0::Parameter> param : gru_function_cpu->get_parameters())
+        {
+            vector<float> tensor_val(shape_size(param->get_output_shape(0)));
+            rng.initialize(tensor_val);
+            args.push_back(tensor_val);
+        }
+
+        auto int_results = execute(make_function(linear_before_reset), args, "INTERPRETER");
+        auto cpu_results = execute(gru_function_cpu, args, "${BACKEND_NAME}");
+        EXPECT_EQ(count_ops_of_type<op::v3::GRUCell>(gru_function_cpu), 0);
+        EXPECT_EQ(count_ops_of_type<op::Rnn>(gru_function_cpu), 1);
+        EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0), 1.0e-4f, 1.0e-4f));
+    }
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, cpu_fusion_rnn_fusion_2rnn_layer_3lstm_cell)
 {
     const std::string file_name("mxnet/2rnn_layer_3lstm_cell.json");
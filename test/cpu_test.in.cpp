@@ -15,15 +15,18 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <atomic>
 #include <cstdio>
 #include <iostream>
 #include <list>
 #include <memory>
+#include <numeric>
 #include <thread>
 
 #include "gtest/gtest.h"
 #include "misc.hpp"
 #include "ngraph/autodiff/adjoints.hpp"
+#include "ngraph/chrome_trace.hpp"
 #include "ngraph/env_util.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/graph_util.hpp"
@@ -35,14 +38,26 @@
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/op/tile.hpp"
 #include "ngraph/pass/constant_folding.hpp"
+#include "ngraph/pass/convert_fp32_to_bf16.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
+#include "ngraph/runtime/cpu/cpu_autotune.hpp"
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_executable.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/cpu_memory_timeline.hpp"
+#include "ngraph/runtime/cpu/cpu_numa.hpp"
+#include "ngraph/runtime/cpu/cpu_op_sampler.hpp"
+#include "ngraph/runtime/cpu/cpu_op_scheduler.hpp"
+#include "ngraph/runtime/cpu/cpu_pool_trimmer.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor.hpp"
+#include "ngraph/runtime/cpu/dnnl_primitive_cache.hpp"
 #include "ngraph/runtime/cpu/dnnl_utils.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
+#include "ngraph/runtime/cpu/op/kv_cache_append.hpp"
 #include "ngraph/runtime/cpu/op/max_pool_with_indices.hpp"
+#include "ngraph/runtime/cpu/op/prefix_attention.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
 #include "util/all_close.hpp"
@@ -72,10 +87,30 @@ namespace
 
         static constexpr NodeTypeInfo type_info{"UnhandledOp", 0};
         const NodeTypeInfo& get_type_info() const override { return type_info; }
+        bool evaluate(const HostTensorVector& /* outputs */,
+                      const HostTensorVector& /* inputs */) const override
+        {
+            return false;
+        }
     };
 
     constexpr NodeTypeInfo UnhandledOp::type_info;
 
+    // Has no CPU builder but evaluates like Abs
+    class EvaluatedOp : public ngraph::op::v0::Abs
+    {
+    public:
+        EvaluatedOp(const std::shared_ptr<Node>& arg)
+            : Abs(arg)
+        {
+        }
+
+        static constexpr NodeTypeInfo type_info{"EvaluatedOp", 0};
+        const NodeTypeInfo& get_type_info() const override { return type_info; }
+    };
+
+    constexpr NodeTypeInfo EvaluatedOp::type_info;
+
     static void compare_backends(const std::shared_ptr<Function>& f1,
                                  const std::shared_ptr<Function>& f2,
                                  const string backend1,
@@ -110,6 +145,27 @@ NGRAPH_TEST(${BACKEND_NAME}, cpu_test_unhandled_op)
     ASSERT_THROW(backend->compile(f), unsupported_op);
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_evaluate_fallback)
+{
+    Shape shape{2, 3};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto evaluated = make_shared<EvaluatedOp>(make_shared<op::v1::Add>(A, B));
+    auto f = make_shared<Function>(make_shared<op::v0::Relu>(evaluated), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, -2, 3, -4, 5, -6});
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(b, vector<float>{-2, 1, -4, 3, -6, 5});
+    auto result = backend->create_tensor(element::f32, shape);
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_TRUE(test::all_close_f(
+        (vector<float>{1, 1, 1, 1, 1, 1}), read_vector<float>(result), MIN_FLOAT_TOLERANCE_BITS));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, cpu_test_trivial_in_place_relu)
 {
     auto A = make_shared<op::v0::Parameter>(element::f32, Shape{16, 1});
@@ -137,6 +193,46 @@ NGRAPH_TEST(${BACKEND_NAME}, cpu_test_trivial_in_place_relu_fail)
               add->get_output_tensor(0).get_pool_offset());
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_in_place_accumulation)
+{
+    // Gradient contributions summed the way backprop accumulates them
+    Shape shape{16, 1};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto C = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto exp_a = make_shared<op::v0::Exp>(A);
+    auto exp_b = make_shared<op::v0::Exp>(B);
+    auto sum1 = make_shared<op::v1::Add>(exp_a, exp_b);
+    auto sum2 = make_shared<op::v1::Add>(make_shared<op::v0::Tanh>(C), sum1);
+    auto neg = make_shared<op::v0::Negative>(sum2);
+    auto f = make_shared<Function>(neg, ParameterVector{A, B, C});
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    // Keep the ops apart rather than fused into one chain
+    set_environment("NGRAPH_PASS_ENABLES", "CPUElementwiseFusion:0", 1);
+    auto handle = backend->compile(f);
+    unset_environment("NGRAPH_PASS_ENABLES");
+    // Each sum overwrites an addend that dies with it
+    size_t sum1_offset = sum1->get_output_tensor(0).get_pool_offset();
+    ASSERT_TRUE(sum1_offset == exp_a->get_output_tensor(0).get_pool_offset() ||
+                sum1_offset == exp_b->get_output_tensor(0).get_pool_offset());
+    ASSERT_TRUE(sum2->get_output_tensor(0).get_pool_offset() == sum1_offset ||
+                sum2->get_output_tensor(0).get_pool_offset() ==
+                    sum2->get_input_tensor(0).get_pool_offset());
+
+    vector<float> a(16, 0.0f);
+    vector<float> b(16, 0.0f);
+    vector<float> c(16, 0.0f);
+    auto ta = backend->create_tensor(element::f32, shape);
+    auto tb = backend->create_tensor(element::f32, shape);
+    auto tc = backend->create_tensor(element::f32, shape);
+    copy_data(ta, a);
+    copy_data(tb, b);
+    copy_data(tc, c);
+    auto result = backend->create_tensor(element::f32, shape);
+    handle->call_with_validate({result}, {ta, tb, tc});
+    EXPECT_TRUE(test::all_close_f(vector<float>(16, -2.0f), read_vector<float>(result)));
+}
+
 #ifdef NGRAPH_TBB_ENABLE
 NGRAPH_TEST(${BACKEND_NAME}, cpu_test_abc_tbb)
 {
@@ -241,6 +337,227 @@ NGRAPH_TEST(${BACKEND_NAME}, cpu_test_dnnl_layouts)
     EXPECT_TRUE(test::all_close_f(vector<float>{expected_result}, rv));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_dnnl_primitive_cache)
+{
+    auto make_function = []() -> std::shared_ptr<Function> {
+        auto A = make_shared<op::v0::Parameter>(element::f32, Shape{1, 16, 2, 2});
+        auto B = make_shared<op::v0::Parameter>(element::f32, Shape{32, 16, 1, 1});
+        auto conv = make_shared<op::v0::Convolution>(A,
+                                                     B,
+                                                     Strides{1, 1},
+                                                     Strides{1, 1},
+                                                     CoordinateDiff{0, 0},
+                                                     CoordinateDiff{0, 0},
+                                                     Strides{1, 1});
+        return make_shared<Function>(NodeVector{conv}, ParameterVector{A, B});
+    };
+
+    auto& cache = runtime::cpu::DNNLPrimitiveCache::get();
+    size_t capacity = cache.get_capacity();
+    cache.set_capacity(1024);
+    cache.clear();
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::f32, Shape{1, 16, 2, 2});
+    auto b = backend->create_tensor(element::f32, Shape{32, 16, 1, 1});
+    copy_data(a, vector<float>(64, 1.0f));
+    copy_data(b, vector<float>(512, 0.5f));
+
+    vector<vector<float>> results;
+    for (size_t i = 0; i < 2; i++)
+    {
+        auto result = backend->create_tensor(element::f32, Shape{1, 32, 2, 2});
+        auto handle = backend->compile(make_function());
+        handle->call_with_validate({result}, {a, b});
+        results.push_back(read_vector<float>(result));
+    }
+
+    // The second executable reuses the convolution built for the first one
+    auto stats = cache.get_stats();
+    EXPECT_GE(stats.misses, 1);
+    EXPECT_GE(stats.hits, 1);
+    EXPECT_EQ(stats.size, stats.misses);
+    EXPECT_TRUE(test::all_close_f(vector<float>(128, 8.0f), results[0]));
+    EXPECT_TRUE(test::all_close_f(results[0], results[1]));
+
+    cache.set_capacity(1);
+    EXPECT_EQ(cache.get_stats().size, 1);
+    cache.set_capacity(capacity);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_shared_constants)
+{
+    vector<float> weights(512);
+    iota(weights.begin(), weights.end(), 0.0f);
+    auto make_function = [&weights](size_t batch) -> std::shared_ptr<Function> {
+        auto A = make_shared<op::v0::Parameter>(element::f32, Shape{batch, 16, 2, 2});
+        auto B = op::v0::Constant::create(element::f32, Shape{32, 16, 1, 1}, weights);
+        auto conv = make_shared<op::v0::Convolution>(A,
+                                                     B,
+                                                     Strides{1, 1},
+                                                     Strides{1, 1},
+                                                     CoordinateDiff{0, 0},
+                                                     CoordinateDiff{0, 0},
+                                                     Strides{1, 1});
+        return make_shared<Function>(NodeVector{conv}, ParameterVector{A});
+    };
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto cpu_backend = static_pointer_cast<runtime::cpu::CPU_Backend>(backend);
+    auto before = cpu_backend->get_constant_store()->get_stats();
+
+    vector<shared_ptr<runtime::Executable>> handles;
+    vector<vector<float>> results;
+    for (size_t batch : {1, 2})
+    {
+        auto a = backend->create_tensor(element::f32, Shape{batch, 16, 2, 2});
+        copy_data(a, vector<float>(batch * 64, 1.0f));
+        auto result = backend->create_tensor(element::f32, Shape{batch, 32, 2, 2});
+        handles.push_back(backend->compile(make_function(batch)));
+        handles.back()->call_with_validate({result}, {a});
+        results.push_back(read_vector<float>(result));
+    }
+
+    // The second executable uses the weights interned by the first one
+    auto after = cpu_backend->get_constant_store()->get_stats();
+    EXPECT_GE(after.hits - before.hits, 1);
+    EXPECT_GE(after.shared_bytes - before.shared_bytes, weights.size() * sizeof(float));
+    EXPECT_TRUE(test::all_close_f(
+        results[0], vector<float>(results[1].begin(), results[1].begin() + results[0].size())));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_prepacked_padded_weights)
+{
+    // 3 output and input channels are padded to the block size of DNNL weight layouts
+    Shape shape_a{2, 3, 5, 5};
+    Shape shape_b{3, 3, 3, 3};
+    Shape shape_r{2, 3, 3, 3};
+    vector<float> weights(shape_size(shape_b));
+    iota(weights.begin(), weights.end(), 1.0f);
+    auto make_function = [&]() -> std::shared_ptr<Function> {
+        auto A = make_shared<op::v0::Parameter>(element::f32, shape_a);
+        auto B = op::v0::Constant::create(element::f32, shape_b, weights);
+        auto conv = make_shared<op::v0::Convolution>(A, B);
+        return make_shared<Function>(NodeVector{conv}, ParameterVector{A});
+    };
+
+    auto cpu_f = make_function();
+    auto int_f = make_function();
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args{vector<float>(shape_size(shape_a))};
+    rng.initialize(args[0]);
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "${BACKEND_NAME}");
+    EXPECT_TRUE(test::all_close_f(cpu_results.at(0), int_results.at(0)));
+
+    // The weights are reordered at compile time
+    for (auto& node : cpu_f->get_ordered_ops())
+    {
+        if (is_type<runtime::cpu::op::ConvertLayout>(node))
+        {
+            EXPECT_FALSE(node->get_input_node_ptr(0)->is_constant());
+        }
+    }
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_bound_call)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::v1::Add>(A, B), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    auto handle = static_pointer_cast<runtime::cpu::CPU_Executable>(backend->compile(f));
+
+    EXPECT_THROW(handle->call_bound(), ngraph_error);
+    handle->bind({result}, {a, b});
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{5, 6, 7, 8});
+    handle->call_bound();
+    EXPECT_TRUE(test::all_close_f(vector<float>{6, 8, 10, 12}, read_vector<float>(result)));
+
+    // Bound buffers are read again on every call
+    copy_data(b, vector<float>{1, 1, 1, 1});
+    handle->call_bound();
+    EXPECT_TRUE(test::all_close_f(vector<float>{2, 3, 4, 5}, read_vector<float>(result)));
+
+    auto wrong = backend->create_tensor(element::f32, Shape{4});
+    EXPECT_ANY_THROW(handle->bind({result}, {a, wrong}));
+    handle->unbind();
+    EXPECT_THROW(handle->call_bound(), ngraph_error);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_eltwise_layout_follows_users)
+{
+    // The Multiply takes the blocked layout of the first convolution rather than the native one
+    // of its first argument, which the second convolution would reorder again
+    auto make_function = []() -> std::shared_ptr<Function> {
+        auto A = make_shared<op::v0::Parameter>(element::f32, Shape{1, 16, 4, 4});
+        auto B = make_shared<op::v0::Parameter>(element::f32, Shape{16, 16, 1, 1});
+        auto C = make_shared<op::v0::Parameter>(element::f32, Shape{1, 16, 4, 4});
+        auto D = make_shared<op::v0::Parameter>(element::f32, Shape{16, 16, 1, 1});
+        auto conv1 = make_shared<op::v0::Convolution>(A, B, Strides{1, 1}, Strides{1, 1});
+        auto mul = make_shared<op::v1::Multiply>(C, conv1);
+        auto conv2 = make_shared<op::v0::Convolution>(mul, D, Strides{1, 1}, Strides{1, 1});
+        return make_shared<Function>(OutputVector{conv2}, ParameterVector{A, B, C, D});
+    };
+
+    auto cpu_f = make_function();
+    auto int_f = make_function();
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::v0::Parameter> param : cpu_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_output_shape(0)));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "${BACKEND_NAME}");
+    EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0), 1.0e-4f, 1.0e-4f));
+    // The inputs of the convolutions, C and the result are reordered, but not the product
+    EXPECT_LE(count_ops_of_type<runtime::cpu::op::ConvertLayout>(cpu_f), 5);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_blocked_slice_and_spatial_sum)
+{
+    // The slice of whole channel blocks and the spatial sums read the blocked output of the
+    // convolution as it is
+    auto make_function = []() -> std::shared_ptr<Function> {
+        auto A = make_shared<op::v0::Parameter>(element::f32, Shape{2, 16, 3, 5});
+        auto B = make_shared<op::v0::Parameter>(element::f32, Shape{32, 16, 1, 1});
+        auto conv = make_shared<op::v0::Convolution>(A, B, Strides{1, 1}, Strides{1, 1});
+        auto slice =
+            make_shared<op::v0::Slice>(conv, Coordinate{0, 16, 0, 0}, Coordinate{2, 32, 3, 5});
+        auto sum1 = make_shared<op::v0::Sum>(conv, AxisSet{2, 3});
+        auto sum2 = make_shared<op::v0::Sum>(slice, AxisSet{2, 3});
+        return make_shared<Function>(OutputVector{sum1, sum2}, ParameterVector{A, B});
+    };
+
+    auto cpu_f = make_function();
+    auto int_f = make_function();
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::v0::Parameter> param : cpu_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_output_shape(0)));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "${BACKEND_NAME}");
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+    // Only the inputs of the convolution are reordered
+    EXPECT_EQ(count_ops_of_type<runtime::cpu::op::ConvertLayout>(cpu_f), 2);
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, cpu_test_reshape_layout_optimizations1)
 {
     // Squeeze outermost dimension
@@ -920,6 +1237,38 @@ NGRAPH_TEST(${BACKEND_NAME},
         vector<float>{-5., -6., -7., -8.}, read_vector<float>(result), MIN_FLOAT_TOLERANCE_BITS));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_in_place_views)
+{
+    // A slice of the rows of one batch element and a transpose moving an axis of one element
+    // are views of their inputs
+    Shape shape_a{3, 4, 2};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape_a);
+    auto abs = make_shared<op::v0::Abs>(A);
+    auto slice = make_shared<op::v0::Slice>(abs, Coordinate{1, 1, 0}, Coordinate{2, 3, 2});
+    auto reshape = make_shared<op::v0::Reshape>(slice, AxisVector{1, 0, 2}, Shape{2, 1, 2});
+    auto neg = make_shared<op::v0::Negative>(reshape);
+    auto f = make_shared<Function>(neg, ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::f32, shape_a);
+    vector<float> a_data(shape_size(shape_a));
+    iota(a_data.begin(), a_data.end(), 0);
+    copy_data(a, a_data);
+    auto result = backend->create_tensor(element::f32, Shape{2, 1, 2});
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a});
+    EXPECT_TRUE(test::all_close_f(vector<float>{-10., -11., -12., -13.},
+                                  read_vector<float>(result),
+                                  MIN_FLOAT_TOLERANCE_BITS));
+    for (shared_ptr<op::Op> view : vector<shared_ptr<op::Op>>{slice, reshape})
+    {
+        auto op_annotations = view->get_op_annotations();
+        ASSERT_TRUE(op_annotations);
+        EXPECT_EQ(op_annotations->get_in_place_oi_pairs().size(), 1);
+    }
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, cpu_test_convert_inplace)
 {
     Shape shape{2, 2};
@@ -2216,6 +2565,36 @@ NGRAPH_TEST(${BACKEND_NAME}, cpu_test_convolution_simple_bf16)
               read_vector<bfloat16>(result));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_dot_bf16)
+{
+    if (!runtime::cpu::dnnl_utils::is_bf16_supported())
+    {
+        // TODO change to skip when there is a new release of gtest
+        NGRAPH_WARN << "This test is skipped for platform without bf16 support and for mlir.";
+        return;
+    }
+
+    Shape shape_a{2, 3};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape_a);
+    auto B = op::v0::Constant::create(element::f32, Shape{3, 2}, {1, 2, 3, 4, 5, 6});
+    auto dot = make_shared<op::v0::Dot>(A, B);
+    auto f = make_shared<Function>(dot, ParameterVector{A});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConvertFP32ToBF16>();
+    pass_manager.run_passes(f);
+    ASSERT_EQ(dot->get_output_element_type(0), element::bf16);
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::bf16, shape_a);
+    copy_data(a, vector<bfloat16>{1, 2, 3, 4, 5, 6});
+    auto result = backend->create_tensor(element::bf16, Shape{2, 2});
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a});
+    EXPECT_EQ((vector<bfloat16>{22, 28, 49, 64}), read_vector<bfloat16>(result));
+}
+
 // This tests a backend's implementation of the three parameter version of create_tensor
 // Testing using this tensor as a Function input
 NGRAPH_TEST(${BACKEND_NAME}, cpu_test_create_tensor_2_input)
@@ -2320,3 +2699,1191 @@ NGRAPH_TEST(${BACKEND_NAME}, cpu_test_one_hot_scalar_oob_in_3)
     handle->call_with_validate({result}, {a});
     EXPECT_EQ(r_data[3], 0);
 }
+
+#ifndef NGRAPH_JSON_DISABLE
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_persistent_compile_cache)
+{
+    Shape shape{2, 2};
+    auto make_function = [&]() {
+        auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+        auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+        return make_shared<Function>(make_shared<op::v1::Add>(A, B), ParameterVector{A, B});
+    };
+
+    string cache_dir = file_util::path_join(file_util::get_temp_directory_path(),
+                                            "ngraph_cpu_compile_cache_test");
+    file_util::remove_directory(cache_dir);
+    set_environment("NGRAPH_CPU_CACHE_DIR", cache_dir.c_str(), 1);
+
+    size_t cache_files = 0;
+    for (size_t run = 0; run < 2; run++)
+    {
+        // A fresh backend has no in-memory executable map, so the second run must be served
+        // from the cache entry written by the first.
+        auto backend = runtime::Backend::create("CPU");
+        auto handle = backend->compile(make_function());
+
+        auto a = backend->create_tensor(element::f32, shape);
+        auto b = backend->create_tensor(element::f32, shape);
+        auto result = backend->create_tensor(element::f32, shape);
+        copy_data(a, vector<float>{1, 2, 3, 4});
+        copy_data(b, vector<float>{5, 6, 7, 8});
+        handle->call_with_validate({result}, {a, b});
+        EXPECT_TRUE(
+            test::all_close_f(read_vector<float>(result), vector<float>{6, 8, 10, 12}));
+
+        cache_files = 0;
+        file_util::iterate_files(cache_dir,
+                                 [&](const string& /* file */, bool is_dir) {
+                                     if (!is_dir)
+                                     {
+                                         cache_files++;
+                                     }
+                                 },
+                                 false);
+        EXPECT_EQ(cache_files, 1);
+
+        // save/load round trip
+        stringstream ss;
+        handle->save(ss);
+        auto loaded = backend->load(ss);
+        loaded->call_with_validate({result}, {b, a});
+        EXPECT_TRUE(
+            test::all_close_f(read_vector<float>(result), vector<float>{6, 8, 10, 12}));
+    }
+
+    unset_environment("NGRAPH_CPU_CACHE_DIR");
+    file_util::remove_directory(cache_dir);
+}
+#endif
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_op_scheduler)
+{
+    // 0 fans out to 1..n which all feed n + 1
+    const size_t n = 64;
+    vector<vector<size_t>> successors(n + 2);
+    for (size_t i = 1; i <= n; i++)
+    {
+        successors[0].push_back(i);
+        successors[i].push_back(n + 1);
+    }
+    runtime::cpu::CPU_OpScheduler scheduler(successors, 4);
+    EXPECT_EQ(scheduler.get_num_workers(), 4);
+
+    for (size_t iteration = 0; iteration < 100; iteration++)
+    {
+        vector<atomic<bool>> done(n + 2);
+        for (auto& d : done)
+        {
+            d = false;
+        }
+        atomic<bool> ordered{true};
+        scheduler.run([&](size_t op, size_t worker) {
+            EXPECT_LT(worker, 4);
+            if (op > 0 && op <= n && !done[0])
+            {
+                ordered = false;
+            }
+            for (size_t i = 1; op == n + 1 && i <= n; i++)
+            {
+                if (!done[i])
+                {
+                    ordered = false;
+                }
+            }
+            done[op] = true;
+        });
+        EXPECT_TRUE(ordered);
+        for (auto& d : done)
+        {
+            EXPECT_TRUE(d);
+        }
+    }
+
+    // The first failure is rethrown and the scheduler remains usable
+    auto failing_task = [](size_t op, size_t) {
+        if (op == 3)
+        {
+            throw ngraph_error("op failed");
+        }
+    };
+    EXPECT_THROW(scheduler.run(failing_task), ngraph_error);
+    atomic<size_t> count{0};
+    scheduler.run([&](size_t, size_t) { count++; });
+    EXPECT_EQ(count, n + 2);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_op_sampler)
+{
+    runtime::cpu::CPU_OpSampler sampler(2, 4);
+    for (size_t call = 0; call < 8; call++)
+    {
+        EXPECT_EQ(sampler.sample_call(), call % 4 == 0);
+    }
+
+    // Every thread records into counters of its own, summed when read
+    vector<thread> threads;
+    for (size_t t = 0; t < 4; t++)
+    {
+        threads.emplace_back([&]() {
+            for (size_t i = 0; i < 100; i++)
+            {
+                sampler.record(1, 10);
+            }
+        });
+    }
+    for (thread& t : threads)
+    {
+        t.join();
+    }
+    vector<runtime::cpu::CPU_OpSampler::OpTime> op_times = sampler.get_op_times();
+    ASSERT_EQ(op_times.size(), 2);
+    EXPECT_EQ(op_times[0].calls, 0);
+    EXPECT_EQ(op_times[1].calls, 400);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_sampled_op_timing)
+{
+    set_environment("NGRAPH_CPU_TIMING_SAMPLE_PERIOD", "2", 1);
+    Shape shape{2, 2};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>((A + B) * B, ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto handle = backend->compile(f);
+    unset_environment("NGRAPH_CPU_TIMING_SAMPLE_PERIOD");
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{5, 6, 7, 8});
+    // The first call is not sampled, then every other call is
+    for (size_t i = 0; i < 9; i++)
+    {
+        handle->call_with_validate({result}, {a, b});
+    }
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(result), vector<float>{30, 48, 70, 96}));
+
+    // Ops whose inputs did not change may be skipped, so they have at most 4 sampled runs
+    vector<runtime::PerformanceCounter> perf_data = handle->get_performance_data();
+    ASSERT_FALSE(perf_data.empty());
+    size_t sampled_runs = 0;
+    for (const runtime::PerformanceCounter& counter : perf_data)
+    {
+        EXPECT_LE(counter.call_count(), 4);
+        sampled_runs += counter.call_count();
+    }
+    EXPECT_GT(sampled_runs, 0);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_op_trace_events)
+{
+    string trace_path =
+        file_util::path_join(file_util::get_temp_directory_path(), "cpu_test_op_trace.json");
+    event::Manager::enable_event_tracing();
+    event::Manager::open(trace_path);
+
+    Shape shape{2, 2};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::v1::Add>(A, B), ParameterVector{A, B});
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{5, 6, 7, 8});
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, b});
+
+    event::Manager::close();
+    event::Manager::disable_event_tracing();
+    string trace = file_util::read_file_to_string(trace_path);
+    file_util::remove_file(trace_path);
+
+    // The compile, the call and every op are in the one trace, the ops tagged with their context
+    EXPECT_NE(trace.find(R"("name":"compile","cat":"CPU")"), string::npos);
+    EXPECT_NE(trace.find(R"("name":"call","cat":"CPU")"), string::npos);
+    EXPECT_NE(trace.find(R"(","cat":"Op")"), string::npos);
+    EXPECT_NE(trace.find(R"("args":{"context":0,"arena":)"), string::npos);
+    EXPECT_EQ(trace.back(), '\n');
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_trace_event_buffers)
+{
+    string trace_path =
+        file_util::path_join(file_util::get_temp_directory_path(), "cpu_test_trace_buffers.json");
+    event::Manager::enable_event_tracing();
+    event::Manager::open(trace_path);
+
+    // More events than a thread buffer holds, from two threads, with objects in between
+    const size_t count = 10000;
+    auto record = [count](const string& name) {
+        for (size_t i = 0; i < count; i++)
+        {
+            event::Duration event(name, "Test");
+        }
+    };
+    event::Object object("tensor", R"({"bytes":16})");
+    thread worker(record, "worker");
+    record("main");
+    worker.join();
+    object.destroy();
+
+    event::Manager::close();
+    event::Manager::disable_event_tracing();
+    string trace = file_util::read_file_to_string(trace_path);
+    file_util::remove_file(trace_path);
+
+    auto occurrences = [&trace](const string& text) {
+        size_t n = 0;
+        for (size_t pos = trace.find(text); pos != string::npos; pos = trace.find(text, pos + 1))
+        {
+            n++;
+        }
+        return n;
+    };
+    EXPECT_EQ(occurrences(R"("name":"main","cat":"Test")"), count);
+    EXPECT_EQ(occurrences(R"("name":"worker","cat":"Test")"), count);
+    EXPECT_EQ(occurrences(R"("ph":"N")"), 1);
+    EXPECT_EQ(occurrences(R"("ph":"O")"), 1);
+    EXPECT_EQ(occurrences(R"("ph":"D")"), 1);
+    // One separator between each pair of events
+    EXPECT_EQ(occurrences(",\n"), 2 * count + 2);
+    EXPECT_EQ(trace.substr(trace.size() - 3), "\n]\n");
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_memory_timeline)
+{
+    runtime::cpu::CPU_MemoryTimeline timeline(
+        4, {{"t0", 0, 64, 0, 1}, {"t1", 64, 32, 1, 2}, {"t2", 0, 16, 2, 3}}, 48, 8);
+    EXPECT_EQ(timeline.get_live_bytes(0), 64);
+    EXPECT_EQ(timeline.get_live_bytes(1), 96);
+    EXPECT_EQ(timeline.get_live_bytes(2), 48);
+    EXPECT_EQ(timeline.get_live_bytes(3), 16);
+    EXPECT_EQ(timeline.get_pool_extent(2), 96);
+    EXPECT_EQ(timeline.get_peak_op(), 1);
+    EXPECT_EQ(timeline.get_live_buffers(1), (vector<string>{"t0", "t1"}));
+
+    Shape shape{2, 2};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto t1 = make_shared<op::v0::Dot>(A, B);
+    auto t2 = make_shared<op::v0::Dot>(t1, B);
+    auto f = make_shared<Function>(make_shared<op::v0::Dot>(t2, A), ParameterVector{A, B});
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto handle = static_pointer_cast<runtime::cpu::CPU_Executable>(backend->compile(f));
+
+    const runtime::cpu::CPU_MemoryTimeline* memory = handle->get_memory_timeline();
+    ASSERT_NE(memory, nullptr);
+    ASSERT_GT(memory->get_num_ops(), 0);
+    EXPECT_EQ(memory->get_host_tensor_bytes(), 3 * shape_size(shape) * sizeof(float));
+    size_t peak_bytes = memory->get_live_bytes(memory->get_peak_op());
+    EXPECT_GE(peak_bytes, shape_size(shape) * sizeof(float));
+    for (size_t op = 0; op < memory->get_num_ops(); op++)
+    {
+        EXPECT_LE(memory->get_live_bytes(op), peak_bytes);
+        EXPECT_LE(memory->get_live_bytes(op), memory->get_pool_extent(op));
+    }
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_numa_node)
+{
+    ASSERT_GE(runtime::cpu::numa::get_node_count(), 1);
+
+    Shape shape{2, 2};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>((A + B) * B, ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}:numa_node=0");
+    auto cpu_backend = static_pointer_cast<runtime::cpu::CPU_Backend>(backend);
+    EXPECT_EQ(cpu_backend->get_numa_node(), 0);
+    EXPECT_THROW(cpu_backend->set_numa_node(runtime::cpu::numa::get_node_count()),
+                 CheckFailure);
+
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(b, vector<float>{5, 6, 7, 8});
+    auto result = backend->create_tensor(element::f32, shape);
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(result), vector<float>{30, 48, 70, 96}));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_cpu_set)
+{
+    EXPECT_EQ(runtime::cpu::numa::parse_cpu_list("0-2:5", ':'), (vector<int>{0, 1, 2, 5}));
+
+    // Large enough for the ops to run on the thread pool of the CPU set
+    Shape shape{64, 64};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>((A + B) * B, ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}:cpus=0");
+    auto cpu_backend = static_pointer_cast<runtime::cpu::CPU_Backend>(backend);
+    EXPECT_EQ(cpu_backend->get_cpus(), vector<int>{0});
+
+    vector<float> a_data(shape_size(shape)), b_data(shape_size(shape)), expected;
+    for (size_t i = 0; i < a_data.size(); i++)
+    {
+        a_data[i] = static_cast<float>(i % 7);
+        b_data[i] = static_cast<float>(i % 5);
+        expected.push_back((a_data[i] + b_data[i]) * b_data[i]);
+    }
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, a_data);
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(b, b_data);
+    auto result = backend->create_tensor(element::f32, shape);
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(result), expected));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_call_priority)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>((A + B) * B, ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(b, vector<float>{5, 6, 7, 8});
+    auto result = backend->create_tensor(element::f32, shape);
+
+    auto handle = static_pointer_cast<runtime::cpu::CPU_Executable>(backend->compile(f));
+    handle->call({result}, {a, b}, runtime::cpu::CallPriority::High);
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(result), vector<float>{30, 48, 70, 96}));
+
+    // A background call waits while a high priority call is running
+    auto& cpu_executor = runtime::cpu::executor::GetCPUExecutor();
+    cpu_executor.begin_call(runtime::cpu::CallPriority::High);
+    auto background = handle->call_async({result}, {a, b}, runtime::cpu::CallPriority::Background);
+    EXPECT_EQ(background.wait_for(chrono::milliseconds(100)), future_status::timeout);
+    cpu_executor.end_call(runtime::cpu::CallPriority::High);
+    EXPECT_TRUE(background.get());
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(result), vector<float>{30, 48, 70, 96}));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_call_cancellation)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>((A + B) * B, ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(b, vector<float>{5, 6, 7, 8});
+    auto result = backend->create_tensor(element::f32, shape);
+
+    auto handle = static_pointer_cast<runtime::cpu::CPU_Executable>(backend->compile(f));
+    auto token = make_shared<runtime::cpu::CancellationToken>();
+    // The first call of a context always completes
+    token->cancel();
+    EXPECT_TRUE(handle->call({result}, {a, b}, runtime::cpu::CallPriority::Normal, token));
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(result), vector<float>{30, 48, 70, 96}));
+
+    copy_data(a, vector<float>{0, 0, 0, 0});
+    EXPECT_FALSE(handle->call({result}, {a, b}, runtime::cpu::CallPriority::Normal, token));
+
+    auto expired = make_shared<runtime::cpu::CancellationToken>();
+    expired->set_deadline(runtime::cpu::CancellationToken::Clock::now());
+    EXPECT_FALSE(
+        handle->call_async({result}, {a, b}, runtime::cpu::CallPriority::Normal, expired).get());
+
+    // A stopped call does not leave stale values behind
+    copy_data(b, vector<float>{1, 2, 3, 4});
+    EXPECT_TRUE(handle->call({result}, {a, b}, runtime::cpu::CallPriority::Normal));
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(result), vector<float>{1, 4, 9, 16}));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_call_async_input_release)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto C = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>((A + B) * B, ParameterVector{A, B, C});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(b, vector<float>{5, 6, 7, 8});
+    auto c = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+
+    auto handle = static_pointer_cast<runtime::cpu::CPU_Executable>(backend->compile(f));
+    handle->call({result}, {a, b, c});
+
+    // The call is held before its first op, by when no op reads C any more
+    auto& cpu_executor = runtime::cpu::executor::GetCPUExecutor();
+    cpu_executor.begin_call(runtime::cpu::CallPriority::High);
+    auto background =
+        handle->call_async({result}, {a, b, c}, runtime::cpu::CallPriority::Background);
+    auto c_writable = async(launch::async, [&c]() { c->wait_for_write_ready(); });
+    auto a_writable = async(launch::async, [&a]() { a->wait_for_write_ready(); });
+    EXPECT_EQ(c_writable.wait_for(chrono::seconds(10)), future_status::ready);
+    EXPECT_EQ(a_writable.wait_for(chrono::milliseconds(100)), future_status::timeout);
+    cpu_executor.end_call(runtime::cpu::CallPriority::High);
+    EXPECT_TRUE(background.get());
+    a_writable.get();
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(result), vector<float>{30, 48, 70, 96}));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_autotune)
+{
+    runtime::cpu::CPUTuning tuning;
+    tuning.intra_op_threads = 1;
+    tuning.inter_op = false;
+    tuning.concurrency = 2;
+    runtime::cpu::CPUTuning parsed;
+    ASSERT_TRUE(runtime::cpu::CPUTuning::from_string(tuning.to_string(), parsed));
+    EXPECT_EQ(parsed.intra_op_threads, 1);
+    EXPECT_FALSE(parsed.inter_op);
+    EXPECT_EQ(parsed.concurrency, 2);
+    EXPECT_FALSE(runtime::cpu::CPUTuning::from_string("threads four", parsed));
+
+    Shape shape{2, 2};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>((A + B) * B, ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto cpu_backend = static_pointer_cast<runtime::cpu::CPU_Backend>(backend);
+    auto results = runtime::cpu::autotune(*cpu_backend, f, 2, true);
+    EXPECT_EQ(results.size(), runtime::cpu::get_tuning_candidates(true).size());
+    for (size_t i = 1; i < results.size(); i++)
+    {
+        EXPECT_LE(results[i - 1].microseconds_per_call, results[i].microseconds_per_call);
+    }
+    EXPECT_EQ(cpu_backend->get_tuning(), nullptr);
+
+    cpu_backend->set_tuning(make_shared<runtime::cpu::CPUTuning>(tuning));
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(b, vector<float>{5, 6, 7, 8});
+    auto result = backend->create_tensor(element::f32, shape);
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(result), vector<float>{30, 48, 70, 96}));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_native_fused_ops)
+{
+    auto make_function = []() -> std::shared_ptr<Function> {
+        auto A = make_shared<op::v0::Parameter>(element::f32, Shape{4, 6, 16});
+        auto scale = make_shared<op::v0::Parameter>(element::f32, Shape{96});
+        auto bias = make_shared<op::v0::Parameter>(element::f32, Shape{96});
+        auto B = make_shared<op::v0::Parameter>(element::f32, Shape{2, 3, 4, 5});
+        auto slope = make_shared<op::v0::Parameter>(element::f32, Shape{3});
+        auto C = make_shared<op::v0::Parameter>(element::f32, Shape{4, 5});
+        // Rows with a large mean exercise the Welford statistics
+        auto offset = op::v0::Constant::create(element::f32, Shape{4, 6, 16}, {500.0f});
+        auto ln = make_shared<op::v0::LayerNorm>(A + offset, scale, bias, true, 1);
+        auto mvn_strided = make_shared<op::v0::MVN>(B, AxisSet{0, 2, 3});
+        auto mvn_trailing = make_shared<op::v0::MVN>(B, AxisSet{2, 3}, false);
+        auto axes = op::v0::Constant::create(element::i64, Shape{1}, {1});
+        auto l2 = make_shared<op::v0::NormalizeL2>(B, axes, 1e-6f, op::EpsMode::ADD);
+        auto grn = make_shared<op::v0::GRN>(B, 1.0f);
+        auto prelu = make_shared<op::v0::PRelu>(B, slope);
+        auto squared_difference = make_shared<op::v0::SquaredDifference>(B, C);
+        auto gelu = make_shared<op::v0::Gelu>(B);
+        OutputVector results = ln->outputs();
+        for (auto node : NodeVector{
+                 mvn_strided, mvn_trailing, l2, grn, prelu, squared_difference, gelu})
+        {
+            results.push_back(node);
+        }
+        return make_shared<Function>(results, ParameterVector{A, scale, bias, B, slope, C});
+    };
+
+    auto cpu_f = make_function();
+    auto int_f = make_function();
+
+    test::Uniform<float> rng(-2.0f, 2.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::v0::Parameter> param : cpu_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_output_shape(0)));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "${BACKEND_NAME}");
+    // The fused ops run on their native kernels rather than on a decomposition
+    EXPECT_EQ(count_ops_of_type<op::v0::LayerNorm>(cpu_f), 1);
+    EXPECT_EQ(count_ops_of_type<op::v0::MVN>(cpu_f), 2);
+    EXPECT_EQ(count_ops_of_type<op::v0::NormalizeL2>(cpu_f), 1);
+    EXPECT_EQ(count_ops_of_type<op::v0::GRN>(cpu_f), 1);
+    EXPECT_EQ(count_ops_of_type<op::v0::PRelu>(cpu_f), 1);
+    EXPECT_EQ(count_ops_of_type<op::v0::SquaredDifference>(cpu_f), 1);
+    EXPECT_EQ(count_ops_of_type<op::v0::Gelu>(cpu_f), 1);
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_detection_ops_many_boxes)
+{
+    // Box counts of a detection model, so that every batch, image and class is a task of
+    // its own on the CPU backend. Boxes 2k and 2k + 1 are the same box and no two pairs
+    // overlap, so only the better box of each pair is kept. Task t ranks box p at
+    // (p + 1000 * t) % 20000 and ties between tasks go to the lower task.
+    const size_t num_boxes = 20000;
+    auto score = [](size_t rank, size_t task) {
+        return 1.0f - static_cast<float>(6 * rank + task) / 120000.0f;
+    };
+    auto rank_of = [&](size_t box, size_t task) { return (box + 1000 * task) % num_boxes; };
+    auto box_at = [&](size_t rank, size_t task) {
+        return (rank + num_boxes - 1000 * task) % num_boxes;
+    };
+
+    auto boxes = make_shared<op::v0::Parameter>(element::f32, Shape{2, num_boxes, 4});
+    auto scores = make_shared<op::v0::Parameter>(element::f32, Shape{2, 3, num_boxes});
+    auto nms = make_shared<op::v3::NonMaxSuppression>(
+        boxes,
+        scores,
+        op::v0::Constant::create(element::i64, Shape{}, {200}),
+        op::v0::Constant::create(element::f32, Shape{}, {0.5f}),
+        op::v0::Constant::create(element::f32, Shape{}, {0.3f}));
+    auto nms_f = make_shared<Function>(nms, ParameterVector{boxes, scores});
+
+    vector<float> boxes_val;
+    vector<float> scores_val;
+    for (size_t batch = 0; batch < 2; batch++)
+    {
+        for (size_t box = 0; box < num_boxes; box++)
+        {
+            float x = static_cast<float>(box / 2 * 2);
+            boxes_val.insert(boxes_val.end(), {0.0f, x, 1.0f, x + 1.0f});
+        }
+    }
+    for (size_t task = 0; task < 6; task++)
+    {
+        for (size_t box = 0; box < num_boxes; box++)
+        {
+            scores_val.push_back(score(rank_of(box, task), task));
+        }
+    }
+    // The output has room for 600 boxes, the best 100 of every batch and class
+    vector<int64_t> expected_nms;
+    for (size_t row = 0; row < 600; row++)
+    {
+        size_t task = row % 6;
+        expected_nms.insert(expected_nms.end(),
+                            {static_cast<int64_t>(task / 3),
+                             static_cast<int64_t>(task % 3),
+                             static_cast<int64_t>(box_at(row / 6 * 2, task))});
+    }
+    auto nms_result = execute<float, int64_t>(nms_f, {boxes_val, scores_val}, "${BACKEND_NAME}");
+    EXPECT_EQ(expected_nms, nms_result.at(0));
+
+    auto box_logits = make_shared<op::v0::Parameter>(element::f32, Shape{2, num_boxes * 4});
+    auto class_preds = make_shared<op::v0::Parameter>(element::f32, Shape{2, num_boxes * 4});
+    auto proposals = make_shared<op::v0::Parameter>(element::f32, Shape{1, 2, num_boxes * 4});
+    op::DetectionOutputAttrs attrs;
+    attrs.num_classes = 4;
+    attrs.top_k = 400;
+    attrs.keep_top_k = {200};
+    attrs.code_type = "caffe.PriorBoxParameter.CENTER_SIZE";
+    attrs.nms_threshold = 0.45f;
+    attrs.confidence_threshold = 0.01f;
+    attrs.normalized = true;
+    auto detection =
+        make_shared<op::v0::DetectionOutput>(box_logits, class_preds, proposals, attrs);
+    auto detection_f =
+        make_shared<Function>(detection, ParameterVector{box_logits, class_preds, proposals});
+
+    // Priors of a 100 x 100 grid, with coordinates that decode exactly
+    auto prior = [](size_t box) {
+        float xmin = static_cast<float>(box / 2 % 100) / 128;
+        float ymin = static_cast<float>(box / 2 / 100) / 128;
+        return vector<float>{xmin, ymin, xmin + 1.0f / 256, ymin + 1.0f / 256};
+    };
+    vector<float> box_logits_val(2 * num_boxes * 4, 0.0f);
+    vector<float> class_preds_val;
+    vector<float> proposals_val;
+    for (size_t image = 0; image < 2; image++)
+    {
+        for (size_t box = 0; box < num_boxes; box++)
+        {
+            class_preds_val.push_back(0.0f);
+            for (size_t cls = 1; cls < 4; cls++)
+            {
+                size_t task = image * 3 + cls - 1;
+                class_preds_val.push_back(score(rank_of(box, task), task));
+            }
+        }
+    }
+    for (size_t box = 0; box < num_boxes; box++)
+    {
+        auto coordinates = prior(box);
+        proposals_val.insert(proposals_val.end(), coordinates.begin(), coordinates.end());
+    }
+    for (size_t box = 0; box < num_boxes; box++)
+    {
+        proposals_val.insert(proposals_val.end(), {0.1f, 0.1f, 0.2f, 0.2f});
+    }
+    // Every class keeps 200 boxes, of which the 200 best of the image are ranks 0 to 130 of
+    // all classes and rank 132 of the first two, written in class order
+    vector<float> expected_detection;
+    for (size_t image = 0; image < 2; image++)
+    {
+        for (size_t cls = 1; cls < 4; cls++)
+        {
+            size_t task = image * 3 + cls - 1;
+            for (size_t kept = 0; kept < (cls < 3 ? 67 : 66); kept++)
+            {
+                size_t box = box_at(2 * kept, task);
+                auto coordinates = prior(box);
+                expected_detection.insert(expected_detection.end(),
+                                          {static_cast<float>(image),
+                                           static_cast<float>(cls),
+                                           score(2 * kept, task)});
+                expected_detection.insert(
+                    expected_detection.end(), coordinates.begin(), coordinates.end());
+            }
+        }
+    }
+    auto detection_result = execute<float>(
+        detection_f, {box_logits_val, class_preds_val, proposals_val}, "${BACKEND_NAME}");
+    EXPECT_TRUE(test::all_close_f(expected_detection, detection_result.at(0)));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_tensor_iterator_rnn)
+{
+    // h = tanh(x[t] . W + h) over a sequence of 5, with the sequence on the leading axis, where
+    // every part of the input and output is contiguous, and on an inner axis, where they are not
+    const size_t seq_len = 5;
+    auto part_shape = [](size_t axis, size_t features) {
+        return axis == 0 ? Shape{1, 2, features} : Shape{2, 1, features};
+    };
+    auto seq_shape = [&](size_t axis) {
+        Shape shape = part_shape(axis, 3);
+        shape[axis] = seq_len;
+        return shape;
+    };
+    auto step = [&](const Output<Node>& x, const Output<Node>& h, const Output<Node>& w,
+                    size_t axis) {
+        auto x_2d = make_shared<op::v0::Reshape>(x, AxisVector{0, 1, 2}, Shape{2, 3});
+        auto xw = make_shared<op::v0::Reshape>(
+            make_shared<op::v0::Dot>(x_2d, w), AxisVector{0, 1}, part_shape(axis, 4));
+        return make_shared<op::v0::Tanh>(make_shared<op::v1::Add>(xw, h));
+    };
+    auto make_tensor_iterator = [&](size_t axis) {
+        auto x = make_shared<op::v0::Parameter>(element::f32, seq_shape(axis));
+        auto h0 = make_shared<op::v0::Parameter>(element::f32, part_shape(axis, 4));
+        auto w = make_shared<op::v0::Parameter>(element::f32, Shape{3, 4});
+        auto xi = make_shared<op::v0::Parameter>(element::f32, part_shape(axis, 3));
+        auto hi = make_shared<op::v0::Parameter>(element::f32, part_shape(axis, 4));
+        auto wi = make_shared<op::v0::Parameter>(element::f32, Shape{3, 4});
+        auto ho = step(xi, hi, wi, axis);
+        auto body = make_shared<op::v0::TensorIterator::BodyLambda>(OutputVector{ho},
+                                                                    ParameterVector{xi, hi, wi});
+        auto tensor_iterator = make_shared<op::v0::TensorIterator>();
+        tensor_iterator->set_body(body);
+        tensor_iterator->set_sliced_input(xi, x, 0, 1, 1, -1, axis);
+        tensor_iterator->set_merged_input(hi, h0, ho);
+        tensor_iterator->set_invariant_input(wi, w);
+        auto last = tensor_iterator->get_iter_value(ho, -1);
+        auto all = tensor_iterator->get_concatenated_slices(ho, 0, 1, 1, -1, axis);
+        return make_shared<Function>(OutputVector{last, all}, ParameterVector{x, h0, w});
+    };
+    auto make_unrolled = [&](size_t axis) {
+        auto x = make_shared<op::v0::Parameter>(element::f32, seq_shape(axis));
+        auto h0 = make_shared<op::v0::Parameter>(element::f32, part_shape(axis, 4));
+        auto w = make_shared<op::v0::Parameter>(element::f32, Shape{3, 4});
+        Output<Node> h = h0;
+        OutputVector hs;
+        for (size_t t = 0; t < seq_len; t++)
+        {
+            Coordinate lower{0, 0, 0};
+            Coordinate upper = seq_shape(axis);
+            lower[axis] = t;
+            upper[axis] = t + 1;
+            h = step(make_shared<op::v0::Slice>(x, lower, upper), h, w, axis);
+            hs.push_back(h);
+        }
+        auto all = make_shared<op::v0::Concat>(hs, axis);
+        return make_shared<Function>(OutputVector{h, all}, ParameterVector{x, h0, w});
+    };
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    for (size_t axis : {0, 1})
+    {
+        vector<vector<float>> args;
+        for (shared_ptr<op::v0::Parameter> param : make_unrolled(axis)->get_parameters())
+        {
+            vector<float> tensor_val(shape_size(param->get_output_shape(0)));
+            rng.initialize(tensor_val);
+            args.push_back(tensor_val);
+        }
+        auto int_results = execute(make_unrolled(axis), args, "INTERPRETER");
+        auto cpu_results = execute(make_tensor_iterator(axis), args, "${BACKEND_NAME}");
+        for (size_t i = 0; i < cpu_results.size(); i++)
+        {
+            EXPECT_TRUE(test::all_close_f(cpu_results.at(i), int_results.at(i)));
+        }
+    }
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_concurrent_compiles)
+{
+    Shape shape_a{2, 3};
+    Shape shape_w{3, 2};
+    auto make_function = [&](float scale) {
+        auto A = make_shared<op::v0::Parameter>(element::f32, shape_a);
+        auto W = op::v0::Constant::create(
+            element::f32, shape_w, {scale, -scale, 2 * scale, 0.0f, -scale, scale});
+        auto B = op::v0::Constant::create(element::f32, Shape{2, 2}, {1.0f, 1.0f, 1.0f, 1.0f});
+        auto dot = make_shared<op::v0::Dot>(A, W);
+        return make_shared<Function>(make_shared<op::v0::Relu>(make_shared<op::v1::Add>(dot, B)),
+                                     ParameterVector{A});
+    };
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    // Half the threads compile a function of their own, the others all compile the same one
+    const size_t thread_count = 8;
+    auto shared_function = make_function(1.0f);
+    vector<shared_ptr<runtime::Executable>> executables(thread_count);
+    vector<thread> threads;
+    for (size_t i = 0; i < thread_count; i++)
+    {
+        threads.emplace_back([&, i]() {
+            executables[i] = backend->compile(
+                i % 2 == 0 ? make_function(static_cast<float>(i + 1)) : shared_function);
+        });
+    }
+    for (thread& t : threads)
+    {
+        t.join();
+    }
+
+    auto a = backend->create_tensor(element::f32, shape_a);
+    copy_data(a, vector<float>{1, 2, 3, -1, 0, 2});
+    for (size_t i = 0; i < thread_count; i++)
+    {
+        ASSERT_TRUE(executables[i]);
+        if (i % 2 == 1)
+        {
+            EXPECT_EQ(executables[i], executables[1]);
+        }
+        float s = i % 2 == 0 ? static_cast<float>(i + 1) : 1.0f;
+        vector<float> expected{std::max(2 * s + 1, 0.0f),
+                               std::max(2 * s + 1, 0.0f),
+                               std::max(-3 * s + 1, 0.0f),
+                               std::max(3 * s + 1, 0.0f)};
+        auto result = backend->create_tensor(element::f32, Shape{2, 2});
+        ASSERT_TRUE(executables[i]->call_with_validate({result}, {a}));
+        EXPECT_TRUE(test::all_close_f(read_vector<float>(result), expected));
+    }
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_conv_autotune)
+{
+    Shape shape_a{1, 16, 14, 14};
+    Shape shape_b{16, 16, 3, 3};
+    auto make_function = [&]() {
+        auto A = make_shared<op::v0::Parameter>(element::f32, shape_a);
+        auto B = make_shared<op::v0::Parameter>(element::f32, shape_b);
+        auto conv = make_shared<op::v0::Convolution>(A,
+                                                     B,
+                                                     Strides{1, 1},
+                                                     Strides{1, 1},
+                                                     CoordinateDiff{1, 1},
+                                                     CoordinateDiff{1, 1});
+        return make_shared<Function>(NodeVector{conv}, ParameterVector{A, B});
+    };
+
+    string cache_dir = file_util::path_join(file_util::get_temp_directory_path(),
+                                            "ngraph_cpu_conv_autotune_test");
+    file_util::remove_directory(cache_dir);
+    set_environment("NGRAPH_CPU_CONV_AUTOTUNE", "1", 1);
+    set_environment("NGRAPH_CPU_CACHE_DIR", cache_dir.c_str(), 1);
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args{vector<float>(shape_size(shape_a)),
+                               vector<float>(shape_size(shape_b))};
+    for (auto& arg : args)
+    {
+        rng.initialize(arg);
+    }
+    auto int_results = execute(make_function(), args, "INTERPRETER");
+    // The second compile uses the choice the first one timed
+    for (size_t run = 0; run < 2; run++)
+    {
+        auto cpu_results = execute(make_function(), args, "${BACKEND_NAME}");
+        // Winograd rounds differently from direct convolution
+        EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0), 1.0e-3f, 1.0e-3f));
+    }
+    EXPECT_TRUE(
+        file_util::exists(file_util::path_join(cache_dir, "dnnl_conv_algorithms.txt")));
+
+    unset_environment("NGRAPH_CPU_CACHE_DIR");
+    unset_environment("NGRAPH_CPU_CONV_AUTOTUNE");
+    file_util::remove_directory(cache_dir);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_profile_guided_compile)
+{
+    Shape shape{2, 2};
+    auto make_function = [&]() {
+        auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+        auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+        auto C = make_shared<op::v0::Parameter>(element::f32, shape);
+        return make_shared<Function>((A + B) * (B - C) + (A * C), ParameterVector{A, B, C});
+    };
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto cpu_backend = static_pointer_cast<runtime::cpu::CPU_Backend>(backend);
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(b, vector<float>{5, 6, 7, 8});
+    auto c = backend->create_tensor(element::f32, shape);
+    copy_data(c, vector<float>{1, 1, 2, 2});
+    auto result = backend->create_tensor(element::f32, shape);
+    vector<float> expected{25, 42, 56, 80};
+
+    runtime::cpu::CPUTuning tuning;
+    auto profiled = backend->compile(make_function(), true);
+    EXPECT_FALSE(runtime::cpu::record_profile(*profiled, tuning));
+    for (size_t i = 0; i < 3; i++)
+    {
+        profiled->call_with_validate({result}, {a, b, c});
+    }
+    ASSERT_TRUE(runtime::cpu::record_profile(*profiled, tuning));
+    EXPECT_EQ(tuning.op_profile.size(), profiled->get_performance_data().size());
+
+    runtime::cpu::CPUTuning parsed;
+    ASSERT_TRUE(runtime::cpu::CPUTuning::from_string(tuning.to_string(), parsed));
+    ASSERT_EQ(parsed.op_profile.size(), tuning.op_profile.size());
+    for (size_t i = 0; i < parsed.op_profile.size(); i++)
+    {
+        EXPECT_EQ(parsed.op_profile[i].first, tuning.op_profile[i].first);
+    }
+
+    // Every op is as slow as it can be, so none runs inline
+    for (auto& op : parsed.op_profile)
+    {
+        op.second = 1e6;
+    }
+    cpu_backend->set_tuning(make_shared<runtime::cpu::CPUTuning>(parsed));
+    auto handle = backend->compile(make_function());
+    handle->call_with_validate({result}, {a, b, c});
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(result), expected));
+
+    // A profile of other ops is ignored
+    parsed.op_profile.resize(1);
+    cpu_backend->set_tuning(make_shared<runtime::cpu::CPUTuning>(parsed));
+    handle = backend->compile(make_function());
+    handle->call_with_validate({result}, {a, b, c});
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(result), expected));
+    cpu_backend->set_tuning(nullptr);
+
+    // A single worker starts the ready ops with the highest priority first
+    runtime::cpu::CPU_OpScheduler scheduler(
+        vector<vector<size_t>>{{3}, {3}, {3}, {}}, 1, vector<double>{1, 3, 2, 0});
+    vector<size_t> order;
+    scheduler.run([&](size_t op, size_t /* worker */) { order.push_back(op); });
+    EXPECT_EQ(order, (vector<size_t>{1, 2, 0, 3}));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_pool_trimming)
+{
+    Shape shape{64, 64};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(((A + B) * B) - A, ParameterVector{A, B});
+
+    set_environment("NGRAPH_CPU_CONCURRENCY", "2", 1);
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto handle = static_pointer_cast<runtime::cpu::CPU_Executable>(backend->compile(f));
+    unset_environment("NGRAPH_CPU_CONCURRENCY");
+    auto call_frame = handle->get_call_frame();
+    ASSERT_EQ(call_frame->get_num_contexts(), 2);
+    // Only the first context exists before any concurrent call
+    EXPECT_EQ(call_frame->get_pool_bytes(1), 0);
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    vector<float> a_data(shape_size(shape), 2);
+    vector<float> b_data(shape_size(shape), 3);
+    copy_data(a, a_data);
+    copy_data(b, b_data);
+    ASSERT_TRUE(handle->call_with_validate({result}, {a, b}));
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(result), vector<float>(a_data.size(), 13)));
+
+    auto& trimmer = runtime::cpu::CPU_PoolTrimmer::get();
+    size_t pool_bytes = trimmer.get_pool_bytes();
+    size_t freed = trimmer.trim(runtime::cpu::CPU_PoolTrimmer::Clock::now());
+    EXPECT_LE(freed, pool_bytes);
+    EXPECT_EQ(call_frame->get_pool_bytes(0), 0);
+    EXPECT_EQ(trimmer.get_pool_bytes(), pool_bytes - freed);
+
+    // Only b changed, but every value is recomputed in the new pools
+    copy_data(b, vector<float>(b_data.size(), 1));
+    ASSERT_TRUE(handle->call_with_validate({result}, {a, b}));
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(result), vector<float>(a_data.size(), 1)));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_activation_arena)
+{
+    Shape small{4, 4};
+    Shape large{32, 32};
+    auto make_function = [](const Shape& shape) {
+        auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+        auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+        return make_shared<Function>(((A + B) * B) - A, ParameterVector{A, B});
+    };
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto cpu_backend = static_pointer_cast<runtime::cpu::CPU_Backend>(backend);
+    auto arena = make_shared<runtime::cpu::CPUActivationArena>();
+    cpu_backend->set_activation_arena(arena);
+    auto first = backend->compile(make_function(small));
+    size_t first_size = arena->get_size();
+    auto second = backend->compile(make_function(large));
+    cpu_backend->set_activation_arena(nullptr);
+    EXPECT_GE(arena->get_size(), first_size);
+    EXPECT_EQ(arena->get_allocated_size(), 0);
+
+    auto run = [&](shared_ptr<runtime::Executable> handle, const Shape& shape, float b_value) {
+        auto a = backend->create_tensor(element::f32, shape);
+        auto b = backend->create_tensor(element::f32, shape);
+        auto result = backend->create_tensor(element::f32, shape);
+        copy_data(a, vector<float>(shape_size(shape), 2));
+        copy_data(b, vector<float>(shape_size(shape), b_value));
+        EXPECT_TRUE(handle->call_with_validate({result}, {a, b}));
+        return read_vector<float>(result);
+    };
+    // The stages overwrite each other's values, which are recomputed by every call
+    for (size_t i = 0; i < 2; i++)
+    {
+        EXPECT_TRUE(test::all_close_f(run(first, small, 3), vector<float>(16, 13)));
+        EXPECT_TRUE(test::all_close_f(run(second, large, 1), vector<float>(1024, 1)));
+    }
+    EXPECT_EQ(arena->get_allocated_size(), arena->get_size());
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_warm_up)
+{
+    // One SGD step per call on a weight kept in a variable, which the function returns as read
+    Shape shape{2, 2};
+    auto init = op::v0::Constant::create(element::f32, shape, {1, 2, 3, 4});
+    auto grad = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto weights = make_shared<op::v0::ReadVariable>(init, "weights");
+    auto update = make_shared<op::v1::Subtract>(weights, grad);
+    auto assign = make_shared<op::v0::AssignVariable>(update, weights);
+    auto result = make_shared<op::v0::Result>(weights);
+    result->add_control_dependency(assign);
+    auto f = make_shared<Function>(ResultVector{result}, ParameterVector{grad});
+
+    set_environment("NGRAPH_CPU_CONCURRENCY", "2", 1);
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto handle = static_pointer_cast<runtime::cpu::CPU_Executable>(backend->compile(f));
+    unset_environment("NGRAPH_CPU_CONCURRENCY");
+    auto call_frame = handle->get_call_frame();
+    ASSERT_EQ(call_frame->get_num_contexts(), 2);
+
+    handle->warm_up();
+    EXPECT_GT(call_frame->get_pool_bytes(1), 0);
+    // Warming up left the variable unset
+    auto value = backend->create_tensor(element::f32, shape);
+    EXPECT_FALSE(handle->read_variable("weights", value));
+
+    auto g = backend->create_tensor(element::f32, shape);
+    auto r = backend->create_tensor(element::f32, shape);
+    copy_data(g, vector<float>{1, 1, 1, 1});
+    ASSERT_TRUE(handle->call_with_validate({r}, {g}));
+    EXPECT_TRUE(test::all_close_f((vector<float>{1, 2, 3, 4}), read_vector<float>(r)));
+
+    // and a value written before
+    copy_data(value, vector<float>{10, 20, 30, 40});
+    handle->write_variable("weights", value);
+    handle->warm_up({g});
+    ASSERT_TRUE(handle->call_with_validate({r}, {g}));
+    EXPECT_TRUE(test::all_close_f((vector<float>{10, 20, 30, 40}), read_vector<float>(r)));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_stream_state)
+{
+    // A running sum kept as state, like the hidden state of an RNN fed chunk by chunk
+    Shape shape{2};
+    auto state = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto x = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto sum = make_shared<op::v1::Add>(state, x);
+    auto twice = make_shared<op::v1::Add>(sum, sum);
+    auto f = make_shared<Function>(OutputVector{sum, twice}, ParameterVector{state, x});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto handle = static_pointer_cast<runtime::cpu::CPU_Executable>(backend->compile(f));
+    handle->bind_state(0, 0);
+    EXPECT_THROW(handle->bind_state(0, 1), ngraph_error);
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto y = backend->create_tensor(element::f32, shape);
+    auto value = backend->create_tensor(element::f32, shape);
+    auto run = [&](const vector<float>& chunk) {
+        copy_data(a, chunk);
+        EXPECT_TRUE(handle->call_on_context(0, {nullptr, y}, {nullptr, a}));
+        return read_vector<float>(y);
+    };
+    EXPECT_TRUE(test::all_close_f((vector<float>{2, 4}), run({1, 2})));
+    EXPECT_TRUE(test::all_close_f((vector<float>{4, 6}), run({1, 1})));
+
+    // Warming up does not move the state on
+    handle->warm_up();
+    handle->read_state(0, 0, value);
+    EXPECT_TRUE(test::all_close_f((vector<float>{2, 3}), read_vector<float>(value)));
+
+    handle->reset_states();
+    handle->read_state(0, 0, value);
+    EXPECT_TRUE(test::all_close_f((vector<float>{0, 0}), read_vector<float>(value)));
+
+    copy_data(value, vector<float>{5, 5});
+    handle->write_state(0, 0, value);
+    EXPECT_TRUE(test::all_close_f((vector<float>{10, 12}), run({0, 1})));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_kv_cache_decode)
+{
+    // One decoding step per call, with the keys and values of the earlier steps cached
+    size_t batch = 2;
+    size_t depth = 3;
+    size_t max_length = 8;
+    float scale = 0.5f;
+    auto query = make_shared<op::v0::Parameter>(element::f32, Shape{batch, 1, depth});
+    auto key = make_shared<op::v0::Parameter>(element::f32, Shape{batch, 1, depth});
+    auto value = make_shared<op::v0::Parameter>(element::f32, Shape{batch, 1, depth});
+    auto position = make_shared<op::v0::Parameter>(element::i64, Shape{});
+    auto keys = make_shared<op::KVCacheAppend>(key, position, max_length);
+    auto values = make_shared<op::KVCacheAppend>(value, position, max_length);
+    auto attention = make_shared<op::PrefixAttention>(query, keys, values, position, scale);
+    auto f = make_shared<Function>(OutputVector{attention, values},
+                                   ParameterVector{query, key, value, position});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto handle = backend->compile(f);
+    auto q = backend->create_tensor(element::f32, query->get_output_shape(0));
+    auto k = backend->create_tensor(element::f32, key->get_output_shape(0));
+    auto v = backend->create_tensor(element::f32, value->get_output_shape(0));
+    auto p = backend->create_tensor(element::i64, Shape{});
+    auto result = backend->create_tensor(element::f32, attention->get_output_shape(0));
+    auto cache = backend->create_tensor(element::f32, values->get_output_shape(0));
+
+    vector<vector<float>> seen_keys(batch);
+    vector<vector<float>> seen_values(batch);
+    for (int64_t step = 0; step < 4; step++)
+    {
+        vector<float> q_data, k_data, v_data;
+        for (size_t i = 0; i < batch * depth; i++)
+        {
+            q_data.push_back(0.25f * ((i + step) % 5));
+            k_data.push_back(0.5f * ((3 * i + step) % 4) - 0.5f);
+            v_data.push_back(float(step * 10 + i));
+        }
+        copy_data(q, q_data);
+        copy_data(k, k_data);
+        copy_data(v, v_data);
+        copy_data(p, vector<int64_t>{step});
+        ASSERT_TRUE(handle->call_with_validate({result, cache}, {q, k, v, p}));
+
+        vector<float> expected;
+        for (size_t b = 0; b < batch; b++)
+        {
+            seen_keys[b].insert(
+                seen_keys[b].end(), k_data.begin() + b * depth, k_data.begin() + (b + 1) * depth);
+            seen_values[b].insert(
+                seen_values[b].end(), v_data.begin() + b * depth, v_data.begin() + (b + 1) * depth);
+            vector<float> weights;
+            float sum = 0;
+            for (size_t j = 0; j <= static_cast<size_t>(step); j++)
+            {
+                float dot = 0;
+                for (size_t d = 0; d < depth; d++)
+                {
+                    dot += q_data[b * depth + d] * seen_keys[b][j * depth + d];
+                }
+                weights.push_back(exp(scale * dot));
+                sum += weights.back();
+            }
+            for (size_t d = 0; d < depth; d++)
+            {
+                float out = 0;
+                for (size_t j = 0; j <= static_cast<size_t>(step); j++)
+                {
+                    out += weights[j] / sum * seen_values[b][j * depth + d];
+                }
+                expected.push_back(out);
+            }
+        }
+        EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result)));
+
+        // The cache returned as a result is a copy holding the steps so far
+        auto cache_data = read_vector<float>(cache);
+        for (size_t b = 0; b < batch; b++)
+        {
+            vector<float> prefix(cache_data.begin() + b * max_length * depth,
+                                 cache_data.begin() + (b * max_length + step + 1) * depth);
+            EXPECT_EQ(prefix, seen_values[b]);
+        }
+    }
+
+    // Appending past the end of the cache fails
+    copy_data(p, vector<int64_t>{static_cast<int64_t>(max_length)});
+    EXPECT_THROW(handle->call_with_validate({result, cache}, {q, k, v, p}), ngraph_error);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, cpu_test_tensor_views)
+{
+    Shape shape{2, 3};
+    auto p = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto one = op::v0::Constant::create(element::f32, shape, {1, 1, 1, 1, 1, 1});
+    auto f = make_shared<Function>(make_shared<op::v1::Add>(p, one), ParameterVector{p});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto handle = backend->compile(f);
+
+    // Rows 1 and 2 of a batch of 4, in and out, without copies
+    auto batch = backend->create_tensor(element::f32, Shape{4, 3});
+    copy_data(batch, vector<float>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11});
+    auto results = backend->create_tensor(element::f32, Shape{4, 3});
+    copy_data(results, vector<float>(12, 0));
+    auto in = backend->create_tensor_view(batch, shape, 3, Strides{3, 1});
+    auto out = backend->create_tensor_view(results, shape, 3, Strides{3, 1});
+    EXPECT_EQ(static_cast<float*>(batch->get_host_data_ptr()) + 3, in->get_host_data_ptr());
+    handle->call_with_validate({out}, {in});
+    EXPECT_TRUE(test::all_close_f((vector<float>{0, 0, 0, 4, 5, 6, 7, 8, 9, 0, 0, 0}),
+                                  read_vector<float>(results)));
+
+    // Transposed blocks are strided, and copied at the boundary of the call
+    auto columns = backend->create_tensor_view(batch, shape, 0, Strides{1, 3});
+    auto transposed = backend->create_tensor_view(results, shape, 1, Strides{1, 3});
+    EXPECT_EQ(nullptr, transposed->get_host_data_ptr());
+    handle->call_with_validate({transposed}, {columns});
+    EXPECT_TRUE(
+        test::all_close_f((vector<float>{1, 4, 7, 2, 5, 8}), read_vector<float>(transposed)));
+    EXPECT_TRUE(test::all_close_f((vector<float>{0, 1, 2, 4, 4, 5, 7, 7, 8, 0, 0, 0}),
+                                  read_vector<float>(results)));
+
+    // Past the end of the batch
+    EXPECT_THROW(backend->create_tensor_view(batch, shape, 7, Strides{3, 1}), ngraph_error);
+}
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <memory>
+#include <numeric>
 
 #include "gtest/gtest.h"
 #include "ngraph/file_util.hpp"
@@ -336,6 +337,52 @@ TEST(CSE, one_hot)
     }
 }
 
+TEST(CSE, structural)
+{
+    Shape shape{2, 2};
+    auto A = std::make_shared<op::v0::Parameter>(element::f32, shape);
+    auto B = std::make_shared<op::v0::Parameter>(element::f32, shape);
+    auto concat1 = std::make_shared<op::v0::Concat>(OutputVector{A, B}, 0);
+    auto concat2 = std::make_shared<op::v0::Concat>(OutputVector{A, B}, 0);
+    auto concat_axis = std::make_shared<op::v0::Concat>(OutputVector{A, B}, 1);
+    auto concat_order = std::make_shared<op::v0::Concat>(OutputVector{B, A}, 0);
+    auto f = std::make_shared<Function>(OutputVector{concat1, concat2, concat_axis, concat_order},
+                                        ParameterVector{A, B});
+    pass::Manager pass_manager;
+    pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
+    pass_manager.run_passes(f);
+
+    auto result = [&](size_t i) { return f->get_results().at(i)->get_argument(0); };
+    ASSERT_EQ(result(0), result(1));
+    ASSERT_NE(result(0), result(2));
+    ASSERT_NE(result(0), result(3));
+    ASSERT_EQ(count_ops_of_type<op::v0::Concat>(f), 3);
+}
+
+TEST(CSE, constant_payload)
+{
+    Shape shape{64};
+    vector<float> values(shape_size(shape));
+    iota(values.begin(), values.end(), 0.0f);
+    vector<float> other_values(values);
+    other_values.back() = -1.0f;
+    auto A = std::make_shared<op::v0::Parameter>(element::f32, shape);
+    auto c1 = op::v0::Constant::create(element::f32, shape, values);
+    auto c2 = op::v0::Constant::create(element::f32, shape, values);
+    auto c3 = op::v0::Constant::create(element::f32, shape, other_values);
+    auto f = std::make_shared<Function>(OutputVector{std::make_shared<op::v1::Add>(A, c1),
+                                                     std::make_shared<op::v1::Add>(A, c2),
+                                                     std::make_shared<op::v1::Add>(A, c3)},
+                                        ParameterVector{A});
+    pass::Manager pass_manager;
+    pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(f->get_results().at(0)->get_argument(0), f->get_results().at(1)->get_argument(0));
+    ASSERT_NE(f->get_results().at(0)->get_argument(0), f->get_results().at(2)->get_argument(0));
+    ASSERT_EQ(count_ops_of_type<op::v0::Constant>(f), 2);
+}
+
 TEST(CSE, pass_property)
 {
     auto pass = std::make_shared<ngraph::pass::CommonSubexpressionElimination>();
@@ -0,0 +1,142 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#ifndef _WIN32
+
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ngraph/distributed/shared_memory.hpp"
+#include "ngraph/type/bfloat16.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Runs f(rank) in size processes, the calling one being rank 0, and returns whether every
+// rank returned true
+template <typename F>
+static bool run_ranks(int size, F f)
+{
+    vector<pid_t> children;
+    for (int rank = 1; rank < size; rank++)
+    {
+        pid_t pid = fork();
+        if (pid == 0)
+        {
+            _exit(f(rank) ? 0 : 1);
+        }
+        children.push_back(pid);
+    }
+    bool success = f(0);
+    for (pid_t pid : children)
+    {
+        int status;
+        success = waitpid(pid, &status, 0) == pid && WIFEXITED(status) &&
+                  WEXITSTATUS(status) == 0 && success;
+    }
+    return success;
+}
+
+TEST(distributed_shared_memory, all_reduce)
+{
+    const int size = 4;
+    EXPECT_TRUE(run_ranks(size, [](int rank) {
+        // Chunks smaller than the tensors, which are reduced in several steps
+        distributed::SharedMemory shm("/ngraph_test_all_reduce", size, rank, 256);
+        vector<float> sum(1000);
+        for (size_t i = 0; i < sum.size(); i++)
+        {
+            sum[i] = static_cast<float>(rank + i);
+        }
+        shm.all_reduce(
+            sum.data(), sum.data(), element::Type_t::f32, reduction::Type::SUM, sum.size());
+        vector<int64_t> max(77, rank);
+        vector<int64_t> max_out(max.size());
+        shm.all_reduce(
+            max.data(), max_out.data(), element::Type_t::i64, reduction::Type::MAX, max.size());
+
+        bool correct = true;
+        for (size_t i = 0; i < sum.size(); i++)
+        {
+            correct = correct && sum[i] == static_cast<float>(size * i + size * (size - 1) / 2);
+        }
+        for (int64_t value : max_out)
+        {
+            correct = correct && value == size - 1;
+        }
+        return correct;
+    }));
+}
+
+TEST(distributed_shared_memory, all_reduce_bf16)
+{
+    const int size = 3;
+    EXPECT_TRUE(run_ranks(size, [](int rank) {
+        distributed::SharedMemory shm("/ngraph_test_all_reduce_bf16", size, rank, 256);
+        // Exact in bf16, as are the sums
+        vector<bfloat16> values(500, bfloat16(static_cast<float>(rank + 1)));
+        shm.all_reduce(values.data(),
+                       values.data(),
+                       element::Type_t::bf16,
+                       reduction::Type::SUM,
+                       values.size());
+        bool correct = true;
+        for (bfloat16 value : values)
+        {
+            correct = correct && static_cast<float>(value) == 6.0f;
+        }
+        return correct;
+    }));
+}
+
+TEST(distributed_shared_memory, broadcast_send_recv)
+{
+    const int size = 3;
+    EXPECT_TRUE(run_ranks(size, [](int rank) {
+        distributed::SharedMemory shm("/ngraph_test_broadcast_send_recv", size, rank, 256);
+        vector<double> broadcast(300, rank);
+        shm.broadcast(broadcast.data(), element::Type_t::f64, broadcast.size(), 2);
+        bool correct = true;
+        for (double value : broadcast)
+        {
+            correct = correct && value == 2;
+        }
+
+        // Larger than a mailbox
+        vector<int32_t> message(500);
+        if (rank == 0)
+        {
+            for (size_t i = 0; i < message.size(); i++)
+            {
+                message[i] = static_cast<int32_t>(i);
+            }
+            shm.send(message.data(), element::Type_t::i32, message.size(), 1);
+        }
+        else if (rank == 1)
+        {
+            shm.recv(message.data(), element::Type_t::i32, message.size(), 0);
+            for (size_t i = 0; i < message.size(); i++)
+            {
+                correct = correct && message[i] == static_cast<int32_t>(i);
+            }
+        }
+        return correct;
+    }));
+}
+
+#endif
@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <atomic>
 #include <cmath>
 #include <cstddef>
 #include <string>
@@ -155,6 +156,77 @@ TEST(eval, max_eval_reduce_min)
     EXPECT_EQ(maximum_value(squeezes).second, 37);
 }
 
+TEST(eval, evaluator_parallel_memo)
+{
+    // A wide graph of independent sums over constants
+    NodeVector sums;
+    for (int64_t i = 0; i < 16; ++i)
+    {
+        auto a = op::v0::Constant::create<int64_t>(element::i64, Shape{}, {i});
+        auto b = op::v0::Constant::create<int64_t>(element::i64, Shape{}, {2 * i});
+        sums.push_back(make_shared<op::v1::Add>(a, b));
+    }
+    OutputVector values;
+    for (auto& sum : sums)
+    {
+        values.push_back(make_shared<op::v1::Add>(sum, sum));
+    }
+
+    atomic<size_t> calls{0};
+    Evaluator<int64_t>::op_handler_map handlers = {
+        {op::v0::Constant::type_info,
+         [&calls](Node* node, vector<int64_t>&) -> vector<int64_t> {
+             calls++;
+             return {as_type<op::v0::Constant>(node)->get_vector<int64_t>().at(0)};
+         }},
+        {op::v1::Add::type_info,
+         [&calls](Node*, vector<int64_t>& inputs) -> vector<int64_t> {
+             calls++;
+             return {inputs.at(0) + inputs.at(1)};
+         }}};
+    auto memo = make_shared<Evaluator<int64_t>::Memo>(
+        [](const int64_t& value) { return to_string(value); });
+
+    Evaluator<int64_t>::value_map value_map;
+    Evaluator<int64_t> evaluator(handlers, value_map);
+    evaluator.set_num_threads(4);
+    evaluator.set_memo(memo);
+    auto results = evaluator.evaluate(values);
+    ASSERT_EQ(results.size(), 16);
+    for (int64_t i = 0; i < 16; ++i)
+    {
+        EXPECT_EQ(results[i], 6 * i);
+    }
+    EXPECT_EQ(calls, 16 * 4);
+    EXPECT_EQ(memo->size(), 16 * 4);
+
+    // A new query with a fresh value map reuses the memoized results
+    Evaluator<int64_t>::value_map other_value_map;
+    Evaluator<int64_t> other(handlers, other_value_map);
+    other.set_memo(memo);
+    EXPECT_EQ(other.evaluate(values.back()), 90);
+    EXPECT_EQ(calls, 16 * 4);
+}
+
+TEST(eval, evaluate_nodes_memo)
+{
+    auto p = make_shared<op::v0::Parameter>(element::i64, Shape{2});
+    auto sum = make_shared<op::v1::Add>(p, p);
+    auto memo = make_host_tensor_memo();
+    for (int64_t i = 0; i < 3; ++i)
+    {
+        auto input = make_shared<HostTensor>(element::i64, Shape{2});
+        copy_data(input, vector<int64_t>{1, i % 2});
+        auto output = make_shared<HostTensor>(element::i64, Shape{2});
+        map<RawNodeOutput, HostTensorPtr> value_map{{p->output(0), input}};
+        map<RawNodeOutput, HostTensorPtr> output_tensor_map{{sum->output(0), output}};
+        evaluate_nodes(value_map, output_tensor_map, OutputVector{sum}, 2, memo);
+        EXPECT_EQ(read_vector<int64_t>(output), (vector<int64_t>{2, 2 * (i % 2)}));
+    }
+    // The third evaluation had the same input as the first
+    EXPECT_EQ(memo->size(), 2);
+}
+
 TEST(eval, evaluate_shape_of)
 {
     auto p = make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, -1});
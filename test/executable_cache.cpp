@@ -0,0 +1,78 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "gtest/gtest.h"
+
+#include "misc.hpp"
+#include "ngraph/runtime/executable_cache.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+TEST(executable_cache, hit_miss_statistics)
+{
+    runtime::ExecutableCache cache;
+    shared_ptr<runtime::Executable> exec;
+    shared_ptr<Function> func;
+
+    EXPECT_FALSE(cache.find_entry({2, 3, -1}, exec, func));
+    cache.add_entry({2, 3, -1}, nullptr, nullptr, 100);
+    EXPECT_TRUE(cache.is_cached({2, 3, -1}));
+    EXPECT_TRUE(cache.find_entry({2, 3, -1}, exec, func));
+    EXPECT_FALSE(cache.is_cached({2, -1, 3}));
+
+    auto stats = cache.get_statistics();
+    EXPECT_EQ(stats.hits, 1);
+    EXPECT_EQ(stats.misses, 1);
+    EXPECT_EQ(stats.evictions, 0);
+    EXPECT_EQ(stats.entries, 1);
+    EXPECT_EQ(stats.compile_time_us, 100);
+}
+
+TEST(executable_cache, lru_eviction)
+{
+    set_environment("NGRAPH_CACHE_SIZE", "2", 1);
+    runtime::ExecutableCache cache;
+    unset_environment("NGRAPH_CACHE_SIZE");
+
+    cache.add_entry({1}, nullptr, nullptr);
+    cache.add_entry({2}, nullptr, nullptr);
+    // Touch {1} so that {2} becomes the least recently used entry
+    cache.get_cached_entry({1});
+    cache.add_entry({3}, nullptr, nullptr);
+
+    EXPECT_TRUE(cache.is_cached({1}));
+    EXPECT_FALSE(cache.is_cached({2}));
+    EXPECT_TRUE(cache.is_cached({3}));
+    EXPECT_EQ(cache.get_statistics().evictions, 1);
+    EXPECT_THROW(cache.get_cached_entry({2}), ngraph_error);
+}
+
+TEST(executable_cache, shape_bucketing)
+{
+    EXPECT_EQ(runtime::ExecutableCache::bucket_dimension(0), 0);
+    EXPECT_EQ(runtime::ExecutableCache::bucket_dimension(1), 1);
+    EXPECT_EQ(runtime::ExecutableCache::bucket_dimension(5), 8);
+    EXPECT_EQ(runtime::ExecutableCache::bucket_dimension(64), 64);
+    EXPECT_EQ(runtime::ExecutableCache::bucket_shape({3, 17, -1, 4}),
+              (vector<int>{4, 32, -1, 4}));
+
+    runtime::ExecutableCache cache(true);
+    cache.add_entry({5, -1}, nullptr, nullptr);
+    EXPECT_TRUE(cache.is_cached({7, -1}));
+    EXPECT_TRUE(cache.is_cached({8, -1}));
+    EXPECT_FALSE(cache.is_cached({9, -1}));
+}
@@ -119,3 +119,52 @@ TEST(float16, values)
     EXPECT_EQ(static_cast<float16>(65519.0).to_bits(), 0x7bff);
     EXPECT_EQ(static_cast<float16>(65520.0).to_bits(), 0x7c00);
 }
+
+TEST(float16, bulk_conversions)
+{
+    // Every float16, including the ones that do not survive a round trip
+    vector<float16> halves(65536);
+    for (size_t i = 0; i < halves.size(); ++i)
+    {
+        halves[i] = float16::from_bits(static_cast<uint16_t>(i));
+    }
+    vector<float> floats(halves.size());
+    float16::to_float_buffer(halves.data(), floats.data(), halves.size());
+    for (size_t i = 0; i < halves.size(); ++i)
+    {
+        float expected = halves[i];
+        if (std::isnan(expected))
+        {
+            EXPECT_TRUE(std::isnan(floats[i]));
+        }
+        else
+        {
+            EXPECT_EQ(test::FloatUnion(expected).i, test::FloatUnion(floats[i]).i) << i;
+        }
+    }
+
+    // Values around every float16 exponent, denormals and the overflow threshold
+    default_random_engine engine(0);
+    uniform_real_distribution<float> mantissa(0.5f, 1.0f);
+    vector<float> values{0.0f, -0.0f, 65519.0f, 65520.0f, 1e-8f, -1e-8f};
+    for (int exponent = -26; exponent <= 17; ++exponent)
+    {
+        values.push_back(std::ldexp(1.0f, exponent));
+        values.push_back(std::nextafter(std::ldexp(1.0f, exponent), 0.0f));
+        for (size_t i = 0; i < 50; ++i)
+        {
+            values.push_back(std::ldexp(mantissa(engine), exponent));
+            values.push_back(-std::ldexp(mantissa(engine), exponent));
+        }
+    }
+    vector<float16> converted(values.size());
+    float16::from_float_buffer(values.data(), converted.data(), values.size());
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        EXPECT_EQ(float16(values[i]).to_bits(), converted[i].to_bits()) << values[i];
+    }
+
+    // Rounding up out of the denormal range must not also bump the exponent
+    EXPECT_EQ(float16(std::nextafter(std::ldexp(1.0f, -15), 0.0f)).to_bits(), 0x0200);
+    EXPECT_EQ(float16(std::nextafter(std::ldexp(1.0f, -14), 0.0f)).to_bits(), 0x0400);
+}
@@ -15,17 +15,24 @@
 //*****************************************************************************
 
 #include <iostream>
+#include <numeric>
 #include <vector>
 
 #include "gtest/gtest.h"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/pass/manager.hpp"
 #include "ngraph/util.hpp"
+#include "runtime/gpu/gpu_cuda_caching_allocator.hpp"
 #include "runtime/gpu/gpu_primitive_emitter.hpp"
+#include "runtime/gpu/gpu_stream_schedule.hpp"
 #include "runtime/gpu/gpu_util.hpp"
 #include "runtime/gpu/nvshape.hpp"
+#include "runtime/gpu/op/fused_elementwise.hpp"
+#include "runtime/gpu/pass/gpu_elementwise_fusion.hpp"
 #include "util/all_close.hpp"
 #include "util/all_close_f.hpp"
 #include "util/random.hpp"
+#include "util/test_tools.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -166,6 +173,256 @@ TEST(gpu_test, memory_manager_seperate_workspaces_allocsize)
     EXPECT_EQ(emitter.sizeof_device_allocation(), total_size);
 }
 
+TEST(gpu_test, caching_allocator_size_classes)
+{
+    using runtime::gpu::CudaCachingAllocator;
+    EXPECT_EQ(CudaCachingAllocator::round_size(0), 512);
+    EXPECT_EQ(CudaCachingAllocator::round_size(1), 512);
+    EXPECT_EQ(CudaCachingAllocator::round_size(513), 1024);
+    EXPECT_EQ(CudaCachingAllocator::round_size(1 << 20), 1 << 20);
+    EXPECT_EQ(CudaCachingAllocator::round_size((1 << 20) + 1), 2 << 20);
+    EXPECT_EQ(CudaCachingAllocator::round_size((2 << 20) + 1), 4 << 20);
+}
+
+TEST(gpu_test, caching_allocator_reuse)
+{
+    runtime::gpu::CudaCachingAllocator allocator;
+    void* first = allocator.allocate(1000);
+    EXPECT_EQ(allocator.get_stats().allocated_bytes, 1024);
+    allocator.free(first);
+    EXPECT_EQ(allocator.get_stats().allocated_bytes, 0);
+    EXPECT_EQ(allocator.get_stats().cached_bytes, 1024);
+
+    // same size class, served from the cache
+    void* second = allocator.allocate(600);
+    EXPECT_EQ(second, first);
+    EXPECT_EQ(allocator.get_stats().num_cache_hits, 1);
+    EXPECT_EQ(allocator.get_stats().num_device_allocations, 1);
+
+    // other size class
+    void* third = allocator.allocate(4000);
+    EXPECT_NE(third, first);
+    EXPECT_EQ(allocator.get_stats().num_device_allocations, 2);
+    EXPECT_EQ(allocator.get_stats().peak_allocated_bytes, 1024 + 4096);
+
+    allocator.free(second);
+    allocator.free(third);
+    allocator.trim();
+    EXPECT_EQ(allocator.get_stats().cached_bytes, 0);
+    EXPECT_ANY_THROW(allocator.free(third));
+}
+
+TEST(gpu_test, memory_manager_tensor_pool_not_shared_with_workspace)
+{
+    runtime::gpu::GPUPrimitiveEmitter emitter;
+    size_t idx_workspace, idx_pool;
+    {
+        auto allocator = emitter.get_memory_allocator();
+        idx_workspace = allocator.reserve_workspace(64);
+        idx_pool = allocator.reserve_tensor_pool(64);
+    }
+    emitter.allocate_primitive_memory();
+    EXPECT_EQ(emitter.sizeof_device_allocation(), 128);
+    EXPECT_NE(emitter.get_memory_primitives()[idx_pool](), nullptr);
+    EXPECT_NE(emitter.get_memory_primitives()[idx_pool](),
+              emitter.get_memory_primitives()[idx_workspace]());
+}
+
+TEST(gpu_test, stream_schedule_chain)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Abs>(A);
+    auto C = make_shared<op::Negative>(B);
+    auto D = make_shared<op::Sqrt>(C);
+    auto f = make_shared<Function>(D, ParameterVector{A});
+
+    runtime::gpu::GPUStreamSchedule schedule(f->get_ordered_ops(), 4);
+    EXPECT_EQ(schedule.get_num_used_streams(), 1);
+    for (auto node : NodeVector{B, C, D})
+    {
+        EXPECT_EQ(schedule.get_step(node.get()).stream, 0);
+        EXPECT_TRUE(schedule.get_step(node.get()).wait_events.empty());
+        EXPECT_EQ(schedule.get_step(node.get()).record_event,
+                  runtime::gpu::GPUStreamSchedule::no_event);
+    }
+}
+
+TEST(gpu_test, stream_schedule_diamond)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Abs>(A);
+    auto C = make_shared<op::Negative>(B);
+    auto D = make_shared<op::Sqrt>(B);
+    auto E = make_shared<op::Add>(C, D);
+    auto f = make_shared<Function>(E, ParameterVector{A});
+
+    runtime::gpu::GPUStreamSchedule schedule(f->get_ordered_ops(), 2);
+    EXPECT_EQ(schedule.get_num_used_streams(), 2);
+    auto& b = schedule.get_step(B.get());
+    auto& c = schedule.get_step(C.get());
+    auto& d = schedule.get_step(D.get());
+    auto& e = schedule.get_step(E.get());
+    // the two branches run on different streams and join on the stream of B
+    EXPECT_NE(c.stream, d.stream);
+    EXPECT_EQ(e.stream, b.stream);
+    auto& branch = (c.stream == b.stream) ? d : c;
+    ASSERT_NE(b.record_event, runtime::gpu::GPUStreamSchedule::no_event);
+    ASSERT_NE(branch.record_event, runtime::gpu::GPUStreamSchedule::no_event);
+    EXPECT_EQ(branch.wait_events, vector<size_t>{b.record_event});
+    EXPECT_EQ(e.wait_events, vector<size_t>{branch.record_event});
+    EXPECT_EQ(schedule.get_num_events(), 4);
+}
+
+TEST(gpu_test, cuda_graph_replay)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Multiply>(make_shared<op::Add>(A, B), B),
+                                   ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("GPU:cuda_graph");
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    auto other_result = backend->create_tensor(element::f32, shape);
+    auto handle = backend->compile(f);
+
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{5, 6, 7, 8});
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_EQ((vector<float>{30, 48, 70, 96}), read_vector<float>(result));
+
+    // replayed with the same tensors and new data
+    copy_data(b, vector<float>{1, 1, 1, 1});
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_EQ((vector<float>{2, 3, 4, 5}), read_vector<float>(result));
+
+    // captured again for a different output tensor
+    handle->call_with_validate({other_result}, {b, a});
+    EXPECT_EQ((vector<float>{2, 6, 12, 20}), read_vector<float>(other_result));
+}
+
+TEST(gpu_test, unknown_backend_option)
+{
+    EXPECT_ANY_THROW(runtime::Backend::create("GPU:no_such_option"));
+}
+
+TEST(gpu_test, tensor_staged_copies)
+{
+    auto backend = runtime::Backend::create("GPU");
+    // spans several staging buffers and ends with a partial one
+    Shape shape{3 * 1024 * 1024 + 5};
+    vector<float> data(shape_size(shape));
+    iota(data.begin(), data.end(), 0.0f);
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(a, data);
+    b->copy_from(*a);
+    EXPECT_EQ(data, read_vector<float>(a));
+    EXPECT_EQ(data, read_vector<float>(b));
+}
+
+TEST(gpu_test, tensor_write_behind_call)
+{
+    Shape shape{256, 256};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Add>(A, A), ParameterVector{A});
+
+    auto backend = runtime::Backend::create("GPU");
+    auto a = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    auto handle = backend->compile(f);
+
+    // the second write is queued behind the call reading the first data
+    copy_data(a, vector<float>(shape_size(shape), 1));
+    handle->call_with_validate({result}, {a});
+    copy_data(a, vector<float>(shape_size(shape), 2));
+    EXPECT_EQ(vector<float>(shape_size(shape), 2), read_vector<float>(result));
+    handle->call_with_validate({result}, {a});
+    EXPECT_EQ(vector<float>(shape_size(shape), 4), read_vector<float>(result));
+}
+
+TEST(gpu_test, dot_matrix_f16)
+{
+    auto A = make_shared<op::Parameter>(element::f16, Shape{2, 3});
+    auto B = make_shared<op::Parameter>(element::f16, Shape{3, 2});
+    auto f = make_shared<Function>(make_shared<op::Dot>(A, B), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("GPU");
+    auto a = backend->create_tensor(element::f16, Shape{2, 3});
+    auto b = backend->create_tensor(element::f16, Shape{3, 2});
+    auto result = backend->create_tensor(element::f16, Shape{2, 2});
+    copy_data(a, vector<float16>{1, 2, 3, 4, 5, 6});
+    copy_data(b, vector<float16>{1, 2, 3, 4, 5, 6});
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_EQ((vector<float16>{22, 28, 49, 64}), read_vector<float16>(result));
+}
+
+static shared_ptr<Function> make_bias_relu_function()
+{
+    auto A = make_shared<op::v0::Parameter>(element::f32, Shape{2, 3});
+    auto B = make_shared<op::v0::Parameter>(element::f32, Shape{2, 3});
+    auto C = make_shared<op::v0::Parameter>(element::f32, Shape{3});
+    auto bias = make_shared<op::v0::Broadcast>(C, Shape{2, 3}, AxisSet{0});
+    auto sum = make_shared<op::v1::Add>(make_shared<op::v1::Multiply>(A, B), bias);
+    return make_shared<Function>(make_shared<op::v0::Relu>(sum), ParameterVector{A, B, C});
+}
+
+TEST(gpu_test, elementwise_fusion_pass)
+{
+    auto f = make_bias_relu_function();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::gpu::pass::ElementwiseFusion>();
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(count_ops_of_type<op::gpu::FusedElementwise>(f), 1);
+    EXPECT_EQ(count_ops_of_type<op::v0::Broadcast>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::v1::Add>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::v1::Multiply>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::v0::Relu>(f), 0);
+}
+
+TEST(gpu_test, elementwise_fusion_keeps_shared_values)
+{
+    Shape shape{4};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto product = make_shared<op::v1::Multiply>(A, B);
+    auto f = make_shared<Function>(
+        OutputVector{make_shared<op::v0::Exp>(make_shared<op::v0::Negative>(product)), product},
+        ParameterVector{A, B});
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::gpu::pass::ElementwiseFusion>();
+    pass_manager.run_passes(f);
+
+    // the product is a result, so it is computed once and read by the fused negative and exp
+    EXPECT_EQ(count_ops_of_type<op::gpu::FusedElementwise>(f), 1);
+    EXPECT_EQ(count_ops_of_type<op::v1::Multiply>(f), 1);
+}
+
+TEST(gpu_test, fused_elementwise_kernel)
+{
+    auto backend = runtime::Backend::create("GPU");
+    auto f = make_bias_relu_function();
+    auto a = backend->create_tensor(element::f32, Shape{2, 3});
+    auto b = backend->create_tensor(element::f32, Shape{2, 3});
+    auto c = backend->create_tensor(element::f32, Shape{3});
+    auto result = backend->create_tensor(element::f32, Shape{2, 3});
+    copy_data(a, vector<float>{1, 2, 3, 4, 5, 6});
+    copy_data(b, vector<float>{2, 2, 2, 2, 2, 2});
+    copy_data(c, vector<float>{1, -20, 3});
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, b, c});
+    EXPECT_EQ((vector<float>{3, 0, 9, 9, 0, 15}), read_vector<float>(result));
+}
+
 TEST(gpu_test, topk_fanout_graph_transform)
 {
     Shape shape{2, 3, 2};
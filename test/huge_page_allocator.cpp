@@ -0,0 +1,80 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstring>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/runtime/huge_page_allocator.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+TEST(huge_page_allocator, malloc_free)
+{
+    for (auto mode : {runtime::HugePageAllocator::Mode::Transparent,
+                      runtime::HugePageAllocator::Mode::Explicit})
+    {
+        runtime::HugePageAllocator allocator(mode, true);
+        const size_t huge_page_size = runtime::HugePageAllocator::get_huge_page_size();
+        vector<void*> ptrs;
+        for (size_t size : {size_t(1), size_t(3000), huge_page_size + 1})
+        {
+            char* ptr = static_cast<char*>(allocator.malloc(size, 64));
+            ASSERT_NE(ptr, nullptr);
+            EXPECT_EQ(reinterpret_cast<size_t>(ptr) % 64, 0);
+            memset(ptr, 0x5a, size);
+            EXPECT_EQ(ptr[size - 1], 0x5a);
+            ptrs.push_back(ptr);
+        }
+        // Every allocation is either whole huge pages or served by the fallback
+        if (allocator.get_fallback_count() == 0)
+        {
+            EXPECT_EQ(allocator.get_mapped_bytes(), 4 * huge_page_size);
+        }
+        for (void* ptr : ptrs)
+        {
+            allocator.free(ptr);
+        }
+        EXPECT_EQ(allocator.get_mapped_bytes(), 0);
+    }
+}
+
+TEST(huge_page_allocator, aligned_buffer)
+{
+    runtime::HugePageAllocator allocator;
+    {
+        runtime::AlignedBuffer buffer(1 << 20, 4096, &allocator);
+        EXPECT_EQ(reinterpret_cast<size_t>(buffer.get_ptr()) % 4096, 0);
+        memset(buffer.get_ptr(), 1, buffer.size());
+    }
+    EXPECT_EQ(allocator.get_mapped_bytes(), 0);
+}
+
+TEST(huge_page_allocator, prefault_keeps_contents)
+{
+    vector<char> data(3 * 4096 + 17);
+    for (size_t i = 0; i < data.size(); i++)
+    {
+        data[i] = static_cast<char>(i * 7);
+    }
+    vector<char> expected = data;
+    runtime::prefault_memory(data.data() + 5, data.size() - 5);
+    runtime::prefault_memory(data.data(), data.size(), false);
+    EXPECT_EQ(data, expected);
+}
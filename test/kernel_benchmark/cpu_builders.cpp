@@ -0,0 +1,168 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+// Single ops compiled by the CPU backend, so that the DNNL primitives its builders emit are
+// measured together with the dispatch of the executable that calls them.
+
+#include <memory>
+
+#include "kernel_benchmark.hpp"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/backend.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    // Compiles f on the CPU backend with random arguments, ready to be called
+    class CompiledOp
+    {
+    public:
+        CompiledOp(const shared_ptr<Function>& f)
+            : m_backend(runtime::Backend::create("CPU"))
+            , m_executable(m_backend->compile(f))
+        {
+            for (const shared_ptr<op::v0::Parameter>& param : f->get_parameters())
+            {
+                const Shape& shape = param->get_output_shape(0);
+                auto tensor = m_backend->create_tensor(element::f32, shape);
+                vector<float> data = random_data<float>(shape_size(shape));
+                tensor->write(data.data(), data.size() * sizeof(float));
+                m_bytes += tensor->get_size_in_bytes();
+                m_args.push_back(tensor);
+            }
+            for (const shared_ptr<op::v0::Result>& result : f->get_results())
+            {
+                auto tensor = m_backend->create_tensor(element::f32, result->get_output_shape(0));
+                m_bytes += tensor->get_size_in_bytes();
+                m_results.push_back(tensor);
+            }
+        }
+
+        void call() { m_executable->call(m_results, m_args); }
+        int64_t get_bytes() const { return m_bytes; }
+
+    private:
+        shared_ptr<runtime::Backend> m_backend;
+        shared_ptr<runtime::Executable> m_executable;
+        vector<shared_ptr<runtime::Tensor>> m_args;
+        vector<shared_ptr<runtime::Tensor>> m_results;
+        int64_t m_bytes = 0;
+    };
+
+    void run(benchmark::State& state, const shared_ptr<Function>& f, int64_t items)
+    {
+        CompiledOp op(f);
+        for (auto _ : state)
+        {
+            op.call();
+        }
+        set_throughput(state, items, op.get_bytes());
+    }
+}
+
+// Convolution of a {batch, channels, size, size} image with {filters, channels, kernel,
+// kernel} filters, padded to keep the size, counted in multiply-adds
+static void cpu_builder_convolution(benchmark::State& state)
+{
+    size_t batch = state.range(0);
+    size_t channels = state.range(1);
+    size_t filters = state.range(2);
+    size_t size = state.range(3);
+    size_t kernel = state.range(4);
+    std::ptrdiff_t padding = kernel / 2;
+    auto data = make_shared<op::v0::Parameter>(element::f32, Shape{batch, channels, size, size});
+    auto filter =
+        make_shared<op::v0::Parameter>(element::f32, Shape{filters, channels, kernel, kernel});
+    auto convolution = make_shared<op::v0::Convolution>(data,
+                                                        filter,
+                                                        Strides{1, 1},
+                                                        Strides{1, 1},
+                                                        CoordinateDiff{padding, padding},
+                                                        CoordinateDiff{padding, padding});
+    auto f = make_shared<Function>(convolution, ParameterVector{data, filter});
+    run(state, f, batch * filters * size * size * channels * kernel * kernel);
+}
+BENCHMARK(cpu_builder_convolution)
+    ->Args({1, 64, 64, 56, 3})
+    ->Args({1, 256, 64, 56, 1})
+    ->Args({8, 128, 128, 28, 3})
+    ->Args({1, 512, 512, 7, 3})
+    ->UseRealTime();
+
+// Products of a {batch, inputs} matrix with an {inputs, outputs} matrix, as in a fully
+// connected layer, counted in multiply-adds
+static void cpu_builder_matmul(benchmark::State& state)
+{
+    size_t batch = state.range(0);
+    size_t inputs = state.range(1);
+    size_t outputs = state.range(2);
+    auto data = make_shared<op::v0::Parameter>(element::f32, Shape{batch, inputs});
+    auto weights = make_shared<op::v0::Parameter>(element::f32, Shape{inputs, outputs});
+    auto dot = make_shared<op::v0::Dot>(data, weights);
+    auto f = make_shared<Function>(dot, ParameterVector{data, weights});
+    run(state, f, batch * inputs * outputs);
+}
+BENCHMARK(cpu_builder_matmul)
+    ->Args({1, 1024, 1024})
+    ->Args({64, 1024, 1024})
+    ->Args({256, 4096, 1024})
+    ->UseRealTime();
+
+// 3x3 max pooling with stride 2 of a {batch, channels, size, size} image
+static void cpu_builder_max_pool(benchmark::State& state)
+{
+    size_t batch = state.range(0);
+    size_t channels = state.range(1);
+    size_t size = state.range(2);
+    auto data = make_shared<op::v0::Parameter>(element::f32, Shape{batch, channels, size, size});
+    auto max_pool = make_shared<op::v0::MaxPool>(data, Shape{3, 3}, Strides{2, 2});
+    auto f = make_shared<Function>(max_pool, ParameterVector{data});
+    run(state, f, shape_size(max_pool->get_output_shape(0)));
+}
+BENCHMARK(cpu_builder_max_pool)->Args({1, 64, 112})->Args({8, 256, 28})->UseRealTime();
+
+// Inference batch normalization of a {batch, channels, size, size} image
+static void cpu_builder_batch_norm(benchmark::State& state)
+{
+    size_t batch = state.range(0);
+    size_t channels = state.range(1);
+    size_t size = state.range(2);
+    Shape shape{batch, channels, size, size};
+    auto data = make_shared<op::v0::Parameter>(element::f32, shape);
+    ParameterVector params;
+    for (size_t i = 0; i < 4; i++)
+    {
+        params.push_back(make_shared<op::v0::Parameter>(element::f32, Shape{channels}));
+    }
+    auto batch_norm = make_shared<op::v0::BatchNormInference>(
+        data, params[0], params[1], params[2], params[3], 0.001);
+    params.push_back(data);
+    auto f = make_shared<Function>(batch_norm, params);
+    run(state, f, shape_size(shape));
+}
+BENCHMARK(cpu_builder_batch_norm)->Args({1, 64, 112})->Args({8, 256, 28})->UseRealTime();
+
+static void cpu_builder_relu(benchmark::State& state)
+{
+    Shape shape{static_cast<size_t>(state.range(0))};
+    auto data = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto relu = make_shared<op::v0::Relu>(data);
+    auto f = make_shared<Function>(relu, ParameterVector{data});
+    run(state, f, shape_size(shape));
+}
+BENCHMARK(cpu_builder_relu)->Range(1 << 10, 1 << 22)->UseRealTime();
@@ -0,0 +1,123 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+// The Eigen kernels the CPU backend dispatches to when it does not use DNNL. They run on the
+// thread pool of arena 0 of the CPU executor, as in a call of a compiled function.
+
+#include "kernel_benchmark.hpp"
+#include "ngraph/runtime/cpu/kernel/add.hpp"
+#include "ngraph/runtime/cpu/kernel/dot.hpp"
+#include "ngraph/runtime/cpu/kernel/reduce_sum.hpp"
+#include "ngraph/runtime/cpu/kernel/relu.hpp"
+#include "ngraph/runtime/cpu/kernel/softmax.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+template <typename T>
+static void cpu_kernel_add(benchmark::State& state)
+{
+    size_t count = state.range(0);
+    vector<T> arg0 = random_data<T>(count);
+    vector<T> arg1 = random_data<T>(count);
+    vector<T> out(count);
+    for (auto _ : state)
+    {
+        runtime::cpu::kernel::add<T>(arg0.data(), arg1.data(), out.data(), count, 0);
+        benchmark::ClobberMemory();
+    }
+    set_throughput(state, count, 3 * count * sizeof(T));
+}
+BENCHMARK_TEMPLATE(cpu_kernel_add, float)->Range(1 << 10, 1 << 22)->UseRealTime();
+BENCHMARK_TEMPLATE(cpu_kernel_add, int32_t)->Range(1 << 10, 1 << 22)->UseRealTime();
+
+template <typename T>
+static void cpu_kernel_relu(benchmark::State& state)
+{
+    size_t count = state.range(0);
+    vector<T> arg = random_data<T>(count);
+    vector<T> out(count);
+    for (auto _ : state)
+    {
+        runtime::cpu::kernel::relu<T>(arg.data(), out.data(), count, 0);
+        benchmark::ClobberMemory();
+    }
+    set_throughput(state, count, 2 * count * sizeof(T));
+}
+BENCHMARK_TEMPLATE(cpu_kernel_relu, float)->Range(1 << 10, 1 << 22)->UseRealTime();
+
+// Square matrix products, counted in multiply-adds
+template <typename T>
+static void cpu_kernel_dot(benchmark::State& state)
+{
+    size_t n = state.range(0);
+    Shape shape{n, n};
+    vector<T> arg0 = random_data<T>(n * n);
+    vector<T> arg1 = random_data<T>(n * n);
+    vector<T> out(n * n);
+    for (auto _ : state)
+    {
+        runtime::cpu::kernel::dot<T, 2, 2, 1>(
+            arg0.data(), arg1.data(), out.data(), shape, shape, shape, 0);
+        benchmark::ClobberMemory();
+    }
+    set_throughput(state, n * n * n, 3 * n * n * sizeof(T));
+}
+BENCHMARK_TEMPLATE(cpu_kernel_dot, float)->RangeMultiplier(2)->Range(32, 1024)->UseRealTime();
+BENCHMARK_TEMPLATE(cpu_kernel_dot, double)->RangeMultiplier(2)->Range(32, 512)->UseRealTime();
+
+// Softmax over the rows of a {batch, classes} matrix
+template <typename T>
+static void cpu_kernel_softmax(benchmark::State& state)
+{
+    Shape shape{static_cast<size_t>(state.range(0)), static_cast<size_t>(state.range(1))};
+    size_t count = shape_size(shape);
+    vector<T> arg = random_data<T>(count);
+    vector<T> out(count);
+    for (auto _ : state)
+    {
+        runtime::cpu::kernel::softmax<T, 2, 1>(arg.data(), out.data(), shape, AxisSet{1}, 0);
+        benchmark::ClobberMemory();
+    }
+    set_throughput(state, count, 2 * count * sizeof(T));
+}
+BENCHMARK_TEMPLATE(cpu_kernel_softmax, float)
+    ->Args({1, 1000})
+    ->Args({64, 1000})
+    ->Args({32, 32000})
+    ->UseRealTime();
+
+// Sum of the rows of a {rows, columns} matrix
+template <typename T>
+static void cpu_kernel_reduce_sum(benchmark::State& state)
+{
+    Shape shape{static_cast<size_t>(state.range(0)), static_cast<size_t>(state.range(1))};
+    Shape out_shape{shape[0]};
+    size_t count = shape_size(shape);
+    vector<T> arg = random_data<T>(count);
+    vector<T> out(shape[0]);
+    for (auto _ : state)
+    {
+        runtime::cpu::kernel::reduce_sum_innermost_1rd<T, 2>(
+            arg.data(), out.data(), shape, out_shape, 0);
+        benchmark::ClobberMemory();
+    }
+    set_throughput(state, count, count * sizeof(T));
+}
+BENCHMARK_TEMPLATE(cpu_kernel_reduce_sum, float)
+    ->Args({1024, 1024})
+    ->Args({64, 65536})
+    ->UseRealTime();
@@ -0,0 +1,81 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "kernel_benchmark.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/ngraph.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Shapes of the rank of an NCHW activation, passed around the way op construction does
+static void shape_copies(benchmark::State& state)
+{
+    Shape shape{1, 64, 56, 56};
+    for (auto _ : state)
+    {
+        vector<Shape> shapes;
+        for (size_t i = 0; i < 64; i++)
+        {
+            shapes.push_back(shape);
+        }
+        Shape last = std::move(shapes.back());
+        benchmark::DoNotOptimize(last);
+    }
+    state.SetItemsProcessed(state.iterations() * 64);
+}
+BENCHMARK(shape_copies);
+
+// A chain of range(0) blocks of elementwise and reshaping ops on an NCHW activation
+static shared_ptr<Function> make_chain(size_t blocks)
+{
+    auto data = make_shared<op::v0::Parameter>(element::f32, Shape{1, 64, 56, 56});
+    auto bias = make_shared<op::v0::Parameter>(element::f32, Shape{1, 64, 56, 56});
+    Output<Node> value = data;
+    for (size_t i = 0; i < blocks; i++)
+    {
+        value = make_shared<op::v0::Relu>(make_shared<op::v1::Add>(value, bias));
+        value = make_shared<op::v0::Reshape>(value, AxisVector{0, 2, 3, 1}, Shape{1, 56, 56, 64});
+        value = make_shared<op::v0::Reshape>(value, AxisVector{0, 3, 1, 2}, Shape{1, 64, 56, 56});
+    }
+    return make_shared<Function>(OutputVector{value}, ParameterVector{data, bias});
+}
+
+static void graph_construction(benchmark::State& state)
+{
+    size_t blocks = state.range(0);
+    for (auto _ : state)
+    {
+        auto f = make_chain(blocks);
+        f->validate_nodes_and_infer_types();
+        benchmark::DoNotOptimize(f);
+    }
+    state.SetItemsProcessed(state.iterations() * blocks * 4);
+}
+BENCHMARK(graph_construction)->Range(8, 512);
+
+static void graph_clone(benchmark::State& state)
+{
+    size_t blocks = state.range(0);
+    auto f = make_chain(blocks);
+    for (auto _ : state)
+    {
+        auto clone = clone_function(*f);
+        benchmark::DoNotOptimize(clone);
+    }
+    state.SetItemsProcessed(state.iterations() * blocks * 4);
+}
+BENCHMARK(graph_clone)->Range(8, 512);
@@ -0,0 +1,44 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// Values in [-8, 8), small enough that no kernel overflows or saturates on them
+template <typename T>
+std::vector<T> random_data(size_t count)
+{
+    static std::default_random_engine engine(0);
+    std::uniform_real_distribution<double> distribution(-8.0, 8.0);
+    std::vector<T> data(count);
+    for (T& value : data)
+    {
+        value = static_cast<T>(distribution(engine));
+    }
+    return data;
+}
+
+// Reports `items` elements or operations and `bytes` of memory traffic per iteration, which
+// Google Benchmark turns into rates
+inline void set_throughput(benchmark::State& state, int64_t items, int64_t bytes)
+{
+    state.SetItemsProcessed(state.iterations() * items);
+    state.SetBytesProcessed(state.iterations() * bytes);
+}
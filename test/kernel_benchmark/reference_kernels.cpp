@@ -0,0 +1,184 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "kernel_benchmark.hpp"
+#include "ngraph/runtime/reference/add.hpp"
+#include "ngraph/runtime/reference/convolution.hpp"
+#include "ngraph/runtime/reference/dot.hpp"
+#include "ngraph/runtime/reference/max_pool.hpp"
+#include "ngraph/runtime/reference/relu.hpp"
+#include "ngraph/runtime/reference/softmax.hpp"
+#include "ngraph/runtime/reference/sum.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+template <typename T>
+static void reference_add(benchmark::State& state)
+{
+    size_t count = state.range(0);
+    vector<T> arg0 = random_data<T>(count);
+    vector<T> arg1 = random_data<T>(count);
+    vector<T> out(count);
+    for (auto _ : state)
+    {
+        runtime::reference::add<T>(arg0.data(), arg1.data(), out.data(), count);
+        benchmark::ClobberMemory();
+    }
+    set_throughput(state, count, 3 * count * sizeof(T));
+}
+BENCHMARK_TEMPLATE(reference_add, float)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(reference_add, int32_t)->Range(1 << 10, 1 << 22);
+
+template <typename T>
+static void reference_relu(benchmark::State& state)
+{
+    size_t count = state.range(0);
+    vector<T> arg = random_data<T>(count);
+    vector<T> out(count);
+    for (auto _ : state)
+    {
+        runtime::reference::relu<T>(arg.data(), out.data(), count);
+        benchmark::ClobberMemory();
+    }
+    set_throughput(state, count, 2 * count * sizeof(T));
+}
+BENCHMARK_TEMPLATE(reference_relu, float)->Range(1 << 10, 1 << 22);
+
+// Square matrix products, counted in multiply-adds
+template <typename T>
+static void reference_dot(benchmark::State& state)
+{
+    size_t n = state.range(0);
+    Shape shape{n, n};
+    vector<T> arg0 = random_data<T>(n * n);
+    vector<T> arg1 = random_data<T>(n * n);
+    vector<T> out(n * n);
+    for (auto _ : state)
+    {
+        runtime::reference::dot<T, T, T>(
+            arg0.data(), arg1.data(), out.data(), shape, shape, shape, 1);
+        benchmark::ClobberMemory();
+    }
+    set_throughput(state, n * n * n, 3 * n * n * sizeof(T));
+}
+BENCHMARK_TEMPLATE(reference_dot, float)->RangeMultiplier(2)->Range(32, 256);
+BENCHMARK_TEMPLATE(reference_dot, double)->RangeMultiplier(2)->Range(32, 256);
+
+// Softmax over the rows of a {batch, classes} matrix
+template <typename T>
+static void reference_softmax(benchmark::State& state)
+{
+    Shape shape{static_cast<size_t>(state.range(0)), static_cast<size_t>(state.range(1))};
+    size_t count = shape_size(shape);
+    vector<T> arg = random_data<T>(count);
+    vector<T> out(count);
+    for (auto _ : state)
+    {
+        runtime::reference::softmax<T>(arg.data(), out.data(), shape, AxisSet{1});
+        benchmark::ClobberMemory();
+    }
+    set_throughput(state, count, 2 * count * sizeof(T));
+}
+BENCHMARK_TEMPLATE(reference_softmax, float)->Args({1, 1000})->Args({64, 1000})->Args({32, 32000});
+
+// Sum of a {rows, columns} matrix along axis range(2)
+template <typename T>
+static void reference_sum(benchmark::State& state)
+{
+    Shape shape{static_cast<size_t>(state.range(0)), static_cast<size_t>(state.range(1))};
+    AxisSet axes{static_cast<size_t>(state.range(2))};
+    size_t count = shape_size(shape);
+    vector<T> arg = random_data<T>(count);
+    vector<T> out(shape_size(reduce(shape, axes)));
+    for (auto _ : state)
+    {
+        runtime::reference::sum<T>(arg.data(), out.data(), shape, axes);
+        benchmark::ClobberMemory();
+    }
+    set_throughput(state, count, count * sizeof(T));
+}
+BENCHMARK_TEMPLATE(reference_sum, float)->Args({1024, 1024, 0})->Args({1024, 1024, 1});
+
+// Convolution of a {1, channels, size, size} image with {filters, channels, kernel, kernel}
+// filters, padded to keep the size, counted in multiply-adds
+template <typename T>
+static void reference_convolution(benchmark::State& state)
+{
+    size_t channels = state.range(0);
+    size_t filters = state.range(1);
+    size_t size = state.range(2);
+    size_t kernel = state.range(3);
+    std::ptrdiff_t padding = kernel / 2;
+    Shape in_shape{1, channels, size, size};
+    Shape filter_shape{filters, channels, kernel, kernel};
+    Shape out_shape{1, filters, size, size};
+    vector<T> in = random_data<T>(shape_size(in_shape));
+    vector<T> filter = random_data<T>(shape_size(filter_shape));
+    vector<T> out(shape_size(out_shape));
+    for (auto _ : state)
+    {
+        runtime::reference::convolution<T, T, T>(in.data(),
+                                                 filter.data(),
+                                                 out.data(),
+                                                 in_shape,
+                                                 filter_shape,
+                                                 out_shape,
+                                                 Strides{1, 1},
+                                                 Strides{1, 1},
+                                                 CoordinateDiff{padding, padding},
+                                                 CoordinateDiff{padding, padding},
+                                                 Strides{1, 1});
+        benchmark::ClobberMemory();
+    }
+    set_throughput(state,
+                   shape_size(out_shape) * channels * kernel * kernel,
+                   (shape_size(in_shape) + shape_size(filter_shape) + shape_size(out_shape)) *
+                       sizeof(T));
+}
+BENCHMARK_TEMPLATE(reference_convolution, float)
+    ->Args({16, 16, 28, 3})
+    ->Args({64, 64, 14, 3})
+    ->Args({256, 64, 14, 1})
+    ->Unit(benchmark::kMillisecond);
+
+// 3x3 max pooling with stride 2 of a {1, channels, size, size} image
+template <typename T>
+static void reference_max_pool(benchmark::State& state)
+{
+    size_t channels = state.range(0);
+    size_t size = state.range(1);
+    Shape in_shape{1, channels, size, size};
+    Shape out_shape{1, channels, (size - 3) / 2 + 1, (size - 3) / 2 + 1};
+    vector<T> in = random_data<T>(shape_size(in_shape));
+    vector<T> out(shape_size(out_shape));
+    for (auto _ : state)
+    {
+        runtime::reference::max_pool<T>(in.data(),
+                                        out.data(),
+                                        in_shape,
+                                        out_shape,
+                                        Shape{3, 3},
+                                        Strides{2, 2},
+                                        Shape{0, 0},
+                                        Shape{0, 0});
+        benchmark::ClobberMemory();
+    }
+    set_throughput(state,
+                   shape_size(out_shape),
+                   (shape_size(in_shape) + shape_size(out_shape)) * sizeof(T));
+}
+BENCHMARK_TEMPLATE(reference_max_pool, float)->Args({64, 112})->Args({256, 28});
@@ -0,0 +1,124 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <memory>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/mixed_precision.hpp"
+#include "util/test_tools.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+static shared_ptr<Function> make_conv_relu_softmax()
+{
+    auto data = make_shared<op::v0::Parameter>(element::f32, Shape{1, 2, 4, 4});
+    auto filter = op::v0::Constant::create(element::f32, Shape{3, 2, 1, 1}, {1, 2, 3, 4, 5, 6});
+    auto conv = make_shared<op::v0::Convolution>(data, filter);
+    auto relu = make_shared<op::v0::Relu>(conv);
+    auto softmax = make_shared<op::v0::Softmax>(relu, AxisSet{1});
+    return make_shared<Function>(softmax, ParameterVector{data});
+}
+
+TEST(mixed_precision, converts_compute_and_keeps_sensitive_ops)
+{
+    auto f = make_conv_relu_softmax();
+
+    pass::Manager pass_manager;
+    auto mixed_precision = pass_manager.register_pass<pass::MixedPrecision>();
+    pass_manager.run_passes(f);
+
+    // One Convert into the Convolution, one back out before the Softmax, none for the weights
+    EXPECT_EQ(mixed_precision->get_convert_count(), 2);
+    EXPECT_EQ(mixed_precision->get_converted_node_count(), 2);
+    EXPECT_EQ(count_ops_of_type<op::v0::Convert>(f), 2);
+    for (auto node : f->get_ordered_ops())
+    {
+        if (is_type<op::v0::Convolution>(node))
+        {
+            EXPECT_EQ(node->get_output_element_type(0), element::f16);
+            EXPECT_TRUE(node->get_input_node_ptr(1)->is_constant());
+        }
+        if (is_type<op::v0::Relu>(node))
+        {
+            EXPECT_EQ(node->get_output_element_type(0), element::f16);
+        }
+        if (is_type<op::v0::Softmax>(node))
+        {
+            EXPECT_EQ(node->get_output_element_type(0), element::f32);
+        }
+    }
+    EXPECT_EQ(f->get_output_element_type(0), element::f32);
+    EXPECT_EQ(f->get_parameters()[0]->get_element_type(), element::f32);
+}
+
+TEST(mixed_precision, converts_are_shared)
+{
+    auto data = make_shared<op::v0::Parameter>(element::f32, Shape{2, 3});
+    auto weights = op::v0::Constant::create(element::f32, Shape{3, 3}, vector<float>(9, 1));
+    auto dot0 = make_shared<op::v0::Dot>(data, weights);
+    auto dot1 = make_shared<op::v0::Dot>(data, weights);
+    auto abs0 = make_shared<op::v0::Abs>(dot0);
+    auto f = make_shared<Function>(OutputVector{abs0, dot1}, ParameterVector{data});
+
+    pass::Manager pass_manager;
+    auto mixed_precision = pass_manager.register_pass<pass::MixedPrecision>();
+    pass_manager.run_passes(f);
+
+    // data -> f16 once, each result back to f32 once, one low precision copy of the weights
+    EXPECT_EQ(mixed_precision->get_convert_count(), 3);
+    EXPECT_EQ(count_ops_of_type<op::v0::Constant>(f), 1);
+    EXPECT_EQ(abs0->get_output_element_type(0), element::f16);
+    EXPECT_EQ(f->get_output_element_type(0), element::f32);
+    EXPECT_EQ(f->get_output_element_type(1), element::f32);
+}
+
+TEST(mixed_precision, pass_config_policy)
+{
+    pass::PassConfig pass_config;
+    pass_config.set_pass_attribute("MixedPrecision::BF16", true);
+    pass_config.set_pass_attribute("MixedPrecision::Allow::Softmax", true);
+    pass_config.set_pass_attribute("MixedPrecision::Deny::Softmax", false);
+    pass_config.set_pass_attribute("MixedPrecision::Deny::Relu", true);
+
+    pass::MixedPrecision policy(pass_config);
+    EXPECT_EQ(policy.get_low_precision_type(), element::bf16);
+    EXPECT_EQ(policy.get_allow_list().count("Softmax"), 1);
+    EXPECT_EQ(policy.get_deny_list().count("Softmax"), 0);
+
+    auto f = make_conv_relu_softmax();
+    pass::Manager pass_manager;
+    auto mixed_precision = pass_manager.register_pass<pass::MixedPrecision>(pass_config);
+    pass_manager.run_passes(f);
+
+    // Relu is denied, so the Convolution output returns to f32 and the Softmax converts again
+    EXPECT_EQ(mixed_precision->get_converted_node_count(), 2);
+    EXPECT_EQ(mixed_precision->get_convert_count(), 4);
+    for (auto node : f->get_ordered_ops())
+    {
+        if (is_type<op::v0::Softmax>(node))
+        {
+            EXPECT_EQ(node->get_output_element_type(0), element::bf16);
+        }
+        if (is_type<op::v0::Relu>(node))
+        {
+            EXPECT_EQ(node->get_output_element_type(0), element::f32);
+        }
+    }
+    EXPECT_EQ(f->get_output_element_type(0), element::f32);
+}
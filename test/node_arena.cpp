@@ -0,0 +1,109 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <memory>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/ngraph.hpp"
+#include "ngraph/node_arena.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/validate.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+TEST(node_arena, scope_nesting)
+{
+    EXPECT_EQ(NodeArena::get_current(), nullptr);
+    auto outer = make_shared<NodeArena>();
+    auto inner = make_shared<NodeArena>();
+    {
+        NodeArena::Scope outer_scope(outer);
+        EXPECT_EQ(NodeArena::get_current(), outer);
+        {
+            NodeArena::Scope inner_scope(inner);
+            EXPECT_EQ(NodeArena::get_current(), inner);
+        }
+        EXPECT_EQ(NodeArena::get_current(), outer);
+    }
+    EXPECT_EQ(NodeArena::get_current(), nullptr);
+}
+
+TEST(node_arena, allocate_alignment)
+{
+    auto arena = make_shared<NodeArena>(64);
+    auto c = static_cast<char*>(arena->allocate(1, 1));
+    auto d = static_cast<double*>(arena->allocate(sizeof(double), alignof(double)));
+    EXPECT_NE(c, nullptr);
+    EXPECT_EQ(reinterpret_cast<size_t>(d) % alignof(double), 0);
+    // Larger than a block
+    EXPECT_NE(arena->allocate(256, 8), nullptr);
+    EXPECT_EQ(arena->get_allocated_size(), 1 + sizeof(double) + 256);
+    EXPECT_GE(arena->get_reserved_size(), arena->get_allocated_size());
+}
+
+TEST(node_arena, descriptors_in_scope)
+{
+    auto arena = make_shared<NodeArena>();
+    shared_ptr<Function> f;
+    {
+        NodeArena::Scope scope(arena);
+        auto A = make_shared<op::v0::Parameter>(element::f32, Shape{2, 3});
+        auto B = make_shared<op::v0::Parameter>(element::f32, Shape{2, 3});
+        f = make_shared<Function>(make_shared<op::v1::Add>(A, B), ParameterVector{A, B});
+    }
+    EXPECT_GT(arena->get_allocated_size(), 0);
+    // Nodes made after the scope ends use the heap
+    size_t allocated = arena->get_allocated_size();
+    auto C = make_shared<op::v0::Parameter>(element::f32, Shape{2, 3});
+    EXPECT_EQ(arena->get_allocated_size(), allocated);
+
+    ASSERT_EQ(f->get_results().size(), 1);
+    EXPECT_EQ(f->get_output_shape(0), (Shape{2, 3}));
+    auto g = clone_function(*f);
+    EXPECT_EQ(g->get_output_shape(0), (Shape{2, 3}));
+}
+
+TEST(node_arena, make_nodes)
+{
+    weak_ptr<NodeArena> weak_arena;
+    shared_ptr<Function> f;
+    {
+        auto arena = make_shared<NodeArena>();
+        weak_arena = arena;
+        auto A = arena->make<op::v0::Parameter>(element::f32, Shape{4});
+        auto B = arena->make<op::v0::Parameter>(element::f32, Shape{4});
+        auto add = arena->make<op::v1::Add>(A, B);
+        auto neg = arena->make<op::v0::Negative>(add);
+        f = make_shared<Function>(neg, ParameterVector{A, B});
+
+        // shared_from_this still works on arena nodes
+        EXPECT_EQ(add->shared_from_this(), add);
+        EXPECT_EQ(neg->get_argument(0), add);
+        EXPECT_GE(arena->get_allocated_size(), sizeof(op::v1::Add) + sizeof(op::v0::Negative));
+    }
+    // The nodes keep their arena alive
+    EXPECT_FALSE(weak_arena.expired());
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Validate>();
+    pass_manager.run_passes(f);
+    EXPECT_EQ(f->get_output_element_type(0), element::f32);
+
+    f = nullptr;
+    EXPECT_TRUE(weak_arena.expired());
+}
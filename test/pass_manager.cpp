@@ -23,6 +23,7 @@
 
 #include "ngraph/graph_util.hpp"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/pass/constant_folding.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "util/test_tools.hpp"
 
@@ -67,3 +68,52 @@ TEST(pass_manager, serialize_with_revalidate_does_not_crash)
     auto graph = make_test_graph();
     pass_manager.run_passes(graph);
 }
+
+TEST(pass_manager, pass_profiles)
+{
+    pass::Manager pass_manager;
+    pass_manager.set_per_pass_validation(false);
+    pass_manager.set_pass_profiling(true);
+    pass_manager.register_pass<DummyPass>();
+    pass_manager.register_pass<pass::ConstantFolding>();
+
+    Shape shape{2, 2};
+    auto a = op::v0::Constant::create(element::f32, shape, {1, 2, 3, 4});
+    auto b = op::v0::Constant::create(element::f32, shape, {5, 6, 7, 8});
+    auto p = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::v1::Multiply>(make_shared<op::v1::Add>(a, b), p),
+                                   ParameterVector{p});
+    pass_manager.run_passes(f);
+
+    auto& profiles = pass_manager.get_pass_profiles();
+    ASSERT_EQ(profiles.size(), 2);
+    EXPECT_EQ(profiles[0].index, 0);
+    EXPECT_NE(profiles[0].name.find("DummyPass"), string::npos);
+    EXPECT_EQ(profiles[0].nodes_before, 6);
+    EXPECT_EQ(profiles[0].nodes_after, 6);
+    EXPECT_EQ(profiles[0].rewrites, 0);
+    EXPECT_EQ(profiles[1].index, 1);
+    EXPECT_EQ(profiles[1].name, "ngraph::pass::ConstantFolding");
+    EXPECT_EQ(profiles[1].nodes_before, 6);
+    EXPECT_EQ(profiles[1].nodes_after, 4);
+    EXPECT_EQ(profiles[1].rewrites, 1);
+}
+
+TEST(pass_manager, profile_callback)
+{
+    vector<string> profiled;
+    pass::Manager::set_profile_callback(
+        [&](const pass::PassProfile& profile) { profiled.push_back(profile.name); });
+
+    // profiling is enabled without set_pass_profiling
+    pass::Manager pass_manager;
+    pass_manager.set_per_pass_validation(false);
+    pass_manager.register_pass<DummyPass>();
+    pass_manager.run_passes(make_test_graph());
+    pass::Manager::set_profile_callback(nullptr);
+    pass_manager.run_passes(make_test_graph());
+
+    ASSERT_EQ(profiled.size(), 1);
+    EXPECT_NE(profiled[0].find("DummyPass"), string::npos);
+    EXPECT_EQ(pass_manager.get_pass_profiles().size(), 0);
+}
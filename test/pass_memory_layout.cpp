@@ -21,12 +21,14 @@
 
 #include "gtest/gtest.h"
 
+#include "ngraph/file_util.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/pass/dump_sorted.hpp"
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/memory_layout.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
+#include "ngraph/serializer.hpp"
 #include "util/test_tools.hpp"
 
 using namespace ngraph;
@@ -203,6 +205,23 @@ TEST(memory_manager, memory_align)
     EXPECT_EQ(128, mm.allocate(4));
 }
 
+TEST(memory_manager, greedy_by_size)
+{
+    pass::MemoryManager mm{1, pass::MemoryManager::allocation_scheme::GREEDY_BY_SIZE};
+    EXPECT_THROW(mm.allocate(10), std::invalid_argument);
+
+    // The first and last buffers are never live together and share offset 0
+    vector<pass::MemoryManager::interval> intervals{{10, 0, 0}, {10, 0, 2}, {20, 1, 2}};
+    vector<size_t> offsets = mm.allocate(intervals);
+    EXPECT_EQ(offsets, (vector<size_t>{0, 20, 0}));
+    EXPECT_EQ(mm.max_allocated(), 30);
+
+    // First fit places the two small buffers side by side, the hole they leave is too small
+    pass::MemoryManager first_fit{1};
+    EXPECT_EQ(first_fit.allocate(intervals), (vector<size_t>{0, 10, 20}));
+    EXPECT_EQ(first_fit.max_allocated(), 40);
+}
+
 TEST(memory_layout, basic)
 {
     pass::Manager pass_manager;
@@ -231,3 +250,67 @@ TEST(memory_layout, constant)
     size_t temporary_pool_size = f->get_temporary_pool_size();
     EXPECT_EQ(4, temporary_pool_size);
 }
+
+// Checks that no two tensors that are live at the same time share memory
+static void check_memory_layout(const shared_ptr<Function>& f)
+{
+    map<const descriptor::Tensor*, pair<size_t, size_t>> live;
+    for (shared_ptr<Node> node : f->get_ordered_ops())
+    {
+        for (const descriptor::Tensor* tensor : node->liveness_new_list)
+        {
+            size_t begin = tensor->get_pool_offset();
+            size_t end = begin + tensor->size();
+            EXPECT_LE(end, f->get_temporary_pool_size());
+            for (auto& other : live)
+            {
+                EXPECT_TRUE(end <= other.second.first || other.second.second <= begin)
+                    << tensor->get_name() << " overlaps " << other.first->get_name();
+            }
+            live[tensor] = {begin, end};
+        }
+        for (const descriptor::Tensor* tensor : node->liveness_free_list)
+        {
+            live.erase(tensor);
+        }
+    }
+}
+
+#ifndef NGRAPH_JSON_DISABLE
+// Reports the pool size each allocation scheme needs for the serialized models
+TEST(memory_layout, allocation_scheme_report)
+{
+    using scheme = pass::MemoryManager::allocation_scheme;
+    vector<pair<string, scheme>> schemes = {{"NO_REUSE", scheme::NO_REUSE},
+                                            {"FIRST_FIT", scheme::FIRST_FIT},
+                                            {"BEST_FIT", scheme::BEST_FIT},
+                                            {"GREEDY_BY_SIZE", scheme::GREEDY_BY_SIZE}};
+    vector<string> models = {"mxnet/mnist_mlp_forward.json",
+                             "mxnet/10_bucket_LSTM.json",
+                             "mxnet/LSTM_backward.json",
+                             "mxnet/LSTM_forward.json",
+                             "tf_conv_mnist_nhwc.json"};
+
+    for (const string& model : models)
+    {
+        const string json_path = file_util::path_join(SERIALIZED_ZOO, model);
+        shared_ptr<Function> func = deserialize(file_util::read_file_to_string(json_path));
+        map<scheme, size_t> pool_size;
+        cout << model << ":";
+        for (const pair<string, scheme>& s : schemes)
+        {
+            shared_ptr<Function> f = clone_function(*func);
+            pass::Manager pass_manager;
+            pass_manager.register_pass<pass::Liveness>();
+            pass_manager.register_pass<pass::MemoryLayout>(64, false, s.second);
+            pass_manager.run_passes(f);
+            check_memory_layout(f);
+            pool_size[s.second] = f->get_temporary_pool_size();
+            cout << " " << s.first << "=" << pool_size[s.second];
+        }
+        cout << endl;
+        EXPECT_LE(pool_size[scheme::GREEDY_BY_SIZE], pool_size[scheme::NO_REUSE]);
+        EXPECT_LE(pool_size[scheme::FIRST_FIT], pool_size[scheme::NO_REUSE]);
+    }
+}
+#endif
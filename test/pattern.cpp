@@ -709,6 +709,69 @@ TEST(pattern, recurrent_graph_rewrite)
     }
 }
 
+// Rewrites Sign(x) to Exp(Log(x)), Exp(Log(x)) to x and Abs(Negative(parameter)) to
+// Abs(parameter). The last pattern has its root two levels below the Exp, so it can only match
+// once the Exp that the first rewrite creates has been removed.
+class TestDeepRecurrentGraphRewrite : public ngraph::pass::RecurrentGraphRewrite
+{
+public:
+    void add_rewrite(const shared_ptr<Node>& pattern,
+                     const shared_ptr<pattern::op::Label>& label,
+                     function<shared_ptr<Node>(const Output<Node>&)> make_replacement)
+    {
+        auto callback = [label, make_replacement](pattern::RecurrentMatcher& rm) {
+            auto arg = rm.get_bound_values_for_pattern(label).at(0);
+            rm.get_match_value().replace(make_replacement(arg)->output(0));
+            return true;
+        };
+        std::set<std::shared_ptr<pattern::op::Label>> empty_correlated_matches;
+        this->add_matcher(
+            make_shared<pattern::RecurrentMatcher>(pattern, label, empty_correlated_matches),
+            callback);
+    }
+
+    TestDeepRecurrentGraphRewrite()
+        : RecurrentGraphRewrite()
+    {
+        Shape shape{2};
+        auto x = std::make_shared<pattern::op::Label>(element::f32, shape);
+        add_rewrite(make_shared<op::v0::Sign>(x), x, [](const Output<Node>& arg) {
+            return make_shared<op::v0::Exp>(make_shared<op::v0::Log>(arg));
+        });
+        auto y = std::make_shared<pattern::op::Label>(element::f32, shape);
+        add_rewrite(make_shared<op::v0::Exp>(make_shared<op::v0::Log>(y)),
+                    y,
+                    [](const Output<Node>& arg) { return arg.get_node_shared_ptr(); });
+        auto param = std::make_shared<pattern::op::Label>(
+            element::f32, shape, [](const Output<Node>& value) {
+                return value.get_node()->is_parameter();
+            });
+        add_rewrite(make_shared<op::v0::Abs>(make_shared<op::v0::Negative>(param)),
+                    param,
+                    [](const Output<Node>& arg) { return make_shared<op::v0::Abs>(arg); });
+    }
+};
+
+TEST(pattern, recurrent_graph_rewrite_deep_match)
+{
+    // The Abs is tried before the Exp created for the Sign is removed, and must be tried again
+    // after that
+    Shape shape{2};
+    auto a = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto sign = make_shared<op::v0::Sign>(a);
+    auto negative = make_shared<op::v0::Negative>(sign);
+    auto abs = make_shared<op::v0::Abs>(negative);
+    auto f = make_shared<Function>(OutputVector{abs}, ParameterVector{a});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<TestDeepRecurrentGraphRewrite>();
+    pass_manager.run_passes(f);
+
+    auto result = f->get_results().at(0)->get_argument(0);
+    ASSERT_TRUE(is_type<op::v0::Abs>(result));
+    ASSERT_EQ(result->get_argument(0), a);
+}
+
 TEST(pattern, label_on_skip)
 {
     Shape shape{2, 2};
@@ -760,3 +823,50 @@ TEST(pattern, is_contained_match)
     ASSERT_TRUE(n.match(label_abs2, absn2));
     ASSERT_FALSE(n.is_contained_match());
 }
+
+TEST(pattern, memoized_failures)
+{
+    Shape shape{2};
+    auto x = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto y = make_shared<op::v0::Parameter>(element::f32, shape);
+
+    size_t predicate_calls = 0;
+    auto is_parameter = [&predicate_calls](const Output<Node>& value) {
+        predicate_calls++;
+        return is_type<op::v0::Parameter>(value.get_node());
+    };
+    auto la = make_shared<pattern::op::Label>(element::f32, shape);
+    auto lb = make_shared<pattern::op::Label>(element::f32, shape, is_parameter);
+    auto pattern = make_shared<op::v0::Abs>(make_shared<op::v1::Subtract>(la, lb));
+
+    pattern::Matcher m(pattern);
+    m.set_memo_epoch(1);
+    shared_ptr<Node> no_match = make_shared<op::v0::Abs>(
+        make_shared<op::v1::Subtract>(x, make_shared<op::v0::Abs>(y)));
+    EXPECT_FALSE(m.match(no_match));
+    EXPECT_EQ(predicate_calls, 1);
+    EXPECT_TRUE(m.get_pattern_value_map().empty());
+
+    // Failures are remembered, even once labels are bound
+    EXPECT_FALSE(m.match(no_match));
+    EXPECT_FALSE(m.match(no_match, pattern::PatternValueMap{{la, x}}));
+    EXPECT_EQ(predicate_calls, 1);
+
+    // Until the epoch changes
+    m.set_memo_epoch(2);
+    EXPECT_FALSE(m.match(no_match));
+    EXPECT_EQ(predicate_calls, 2);
+
+    shared_ptr<Node> match = make_shared<op::v0::Abs>(make_shared<op::v1::Subtract>(x, y));
+    EXPECT_TRUE(m.match(match));
+    EXPECT_EQ(m.get_pattern_value_map()[la], x);
+    EXPECT_EQ(m.get_pattern_value_map()[lb], y);
+
+    // A failed submatch undoes its bindings
+    auto same = make_shared<op::v1::Subtract>(la, la);
+    pattern::Matcher m_same(same);
+    EXPECT_FALSE(m_same.match(make_shared<op::v1::Subtract>(x, y)->output(0)));
+    EXPECT_TRUE(m_same.get_pattern_value_map().empty());
+    EXPECT_TRUE(m_same.match(make_shared<op::v1::Subtract>(x, x)->output(0)));
+    EXPECT_EQ(m_same.get_pattern_value_map()[la], x);
+}
@@ -0,0 +1,76 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ngraph/runtime/reference/generate_mask.hpp"
+#include "ngraph/runtime/reference/random_uniform.hpp"
+#include "ngraph/state/philox.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+TEST(philox, known_answer)
+{
+    // Philox4x32-10 known answer test of Random123 for a zero counter and key
+    auto numbers = Philox(0).block(0);
+    EXPECT_EQ(numbers[0], 0x6627e8d5u);
+    EXPECT_EQ(numbers[1], 0xe169c58du);
+    EXPECT_EQ(numbers[2], 0xbc57ac4cu);
+    EXPECT_EQ(numbers[3], 0x9b00dbd8u);
+}
+
+TEST(philox, ranges_match_whole)
+{
+    // Ranges generated separately, as threads would, give the numbers of the whole output
+    size_t count = 1003;
+    vector<float> whole(count);
+    vector<float> split(count);
+    runtime::reference::random_uniform_range(whole.data(), -1.0f, 1.0f, 0, count, Philox(7), 5);
+    vector<size_t> bounds{0, 1, 17, 400, 998, count};
+    for (size_t i = 0; i + 1 < bounds.size(); i++)
+    {
+        runtime::reference::random_uniform_range(
+            split.data(), -1.0f, 1.0f, bounds[i], bounds[i + 1], Philox(7), 5);
+    }
+    EXPECT_EQ(whole, split);
+}
+
+TEST(philox, states_continue_sequence)
+{
+    // Successive calls on a state continue one sequence instead of repeating it
+    size_t count = 10;
+    UniformRNGState state(3);
+    vector<double> first(count);
+    vector<double> second(count);
+    runtime::reference::random_uniform(first.data(), 0.0, 1.0, count, &state);
+    runtime::reference::random_uniform(second.data(), 0.0, 1.0, count, &state);
+    vector<double> both(2 * count);
+    runtime::reference::random_uniform_range(both.data(), 0.0, 1.0, 0, 2 * count, Philox(3), 0);
+    EXPECT_EQ(first, vector<double>(both.begin(), both.begin() + count));
+    EXPECT_EQ(second, vector<double>(both.begin() + count, both.end()));
+
+    BernoulliRNGState mask_state(1, 0.25);
+    vector<float> mask(100000);
+    runtime::reference::generate_mask(mask.data(), mask.size(), &mask_state, true);
+    size_t ones = 0;
+    for (float m : mask)
+    {
+        ones += m == 1.0f;
+    }
+    EXPECT_NEAR(static_cast<double>(ones) / mask.size(), 0.25, 0.01);
+}
@@ -0,0 +1,154 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/post_training_quantization.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static vector<float> random_vector(size_t size, float low, float high, unsigned seed)
+{
+    default_random_engine engine(seed);
+    uniform_real_distribution<float> distribution(low, high);
+    vector<float> values(size);
+    generate(values.begin(), values.end(), [&]() { return distribution(engine); });
+    return values;
+}
+
+static vector<float> execute(const shared_ptr<runtime::Backend>& backend,
+                             const shared_ptr<Function>& f,
+                             const vector<float>& input)
+{
+    auto a = backend->create_tensor(element::f32, f->get_parameters()[0]->get_output_shape(0));
+    copy_data(a, input);
+    auto result = backend->create_tensor(element::f32, f->get_output_shape(0));
+    backend->compile(f)->call_with_validate({result}, {a});
+    return read_vector<float>(result);
+}
+
+static float max_abs_difference(const vector<float>& a, const vector<float>& b)
+{
+    float difference = 0;
+    for (size_t i = 0; i < a.size(); ++i)
+    {
+        difference = max(difference, fabs(a[i] - b[i]));
+    }
+    return difference;
+}
+
+static float max_abs_value(const vector<float>& a)
+{
+    float value = 0;
+    for (float x : a)
+    {
+        value = max(value, fabs(x));
+    }
+    return value;
+}
+
+TEST(post_training_quantization, convolution_relu_dot)
+{
+    Shape shape_data{1, 2, 6, 6};
+    Shape shape_filter{3, 2, 3, 3};
+    auto data = make_shared<op::v0::Parameter>(element::f32, shape_data);
+    auto filter = op::v0::Constant::create(
+        element::f32, shape_filter, random_vector(shape_size(shape_filter), -1, 1, 1));
+    auto conv = make_shared<op::v0::Convolution>(data, filter);
+    auto relu = make_shared<op::v0::Relu>(conv);
+    auto flat = make_shared<op::v0::Reshape>(relu, AxisVector{0, 1, 2, 3}, Shape{1, 48});
+    auto weights = op::v0::Constant::create(
+        element::f32, Shape{48, 4}, random_vector(48 * 4, -0.5f, 0.5f, 2));
+    auto dot = make_shared<op::v0::Dot>(flat, weights);
+    auto f = make_shared<Function>(dot, ParameterVector{data});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    vector<vector<float>> samples;
+    for (unsigned seed = 10; seed < 14; ++seed)
+    {
+        samples.push_back(random_vector(shape_size(shape_data), -1, 1, seed));
+    }
+    vector<vector<float>> expected;
+    for (auto& sample : samples)
+    {
+        expected.push_back(execute(backend, f, sample));
+    }
+
+    pass::ActivationCalibrator calibrator(f, backend);
+    for (auto& sample : samples)
+    {
+        auto a = backend->create_tensor(element::f32, shape_data);
+        copy_data(a, sample);
+        calibrator.run({a});
+    }
+    EXPECT_EQ(calibrator.get_sample_count(), samples.size());
+    // Data and output of the convolution, data and output of the dot
+    EXPECT_EQ(calibrator.get_table().size(), 4);
+    EXPECT_EQ(count_ops_of_type<op::v0::Convolution>(f), 1);
+
+    pass::Manager pass_manager;
+    auto quantization = pass_manager.register_pass<pass::PostTrainingQuantization>(
+        calibrator.get_table());
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(quantization->get_quantized_count(), 2);
+    EXPECT_EQ(count_ops_of_type<op::v0::Convolution>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::v0::Dot>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::v0::QuantizedConvolution>(f), 1);
+    EXPECT_EQ(count_ops_of_type<op::v0::QuantizedDot>(f), 1);
+
+    for (size_t i = 0; i < samples.size(); ++i)
+    {
+        vector<float> actual = execute(backend, f, samples[i]);
+        // Two chained 8 bit layers stay within a few percent of the output range
+        EXPECT_LE(max_abs_difference(expected[i], actual), 0.05f * max_abs_value(expected[i]));
+    }
+}
+
+TEST(post_training_quantization, uncalibrated_nodes_stay_f32)
+{
+    auto a = make_shared<op::v0::Parameter>(element::f32, Shape{2, 3});
+    auto b = make_shared<op::v0::Parameter>(element::f32, Shape{3, 2});
+    auto matmul = make_shared<op::v0::MatMul>(a, b);
+    auto f = make_shared<Function>(matmul, ParameterVector{a, b});
+
+    pass::CalibrationTable table{{pass::calibration_key(a), {-1.0f, 1.0f}},
+                                 {pass::calibration_key(matmul), {-3.0f, 3.0f}}};
+    pass::Manager pass_manager;
+    auto quantization = pass_manager.register_pass<pass::PostTrainingQuantization>(table);
+    pass_manager.run_passes(f);
+    // The range of the second activation is missing
+    EXPECT_EQ(quantization->get_quantized_count(), 0);
+    EXPECT_EQ(count_ops_of_type<op::v0::MatMul>(f), 1);
+
+    table[pass::calibration_key(b)] = {-2.0f, 2.0f};
+    pass::Manager second_manager;
+    quantization = second_manager.register_pass<pass::PostTrainingQuantization>(table);
+    second_manager.run_passes(f);
+    EXPECT_EQ(quantization->get_quantized_count(), 1);
+    EXPECT_EQ(count_ops_of_type<op::v0::QuantizedDot>(f), 1);
+    EXPECT_EQ(count_ops_of_type<op::v0::Quantize>(f), 2);
+}
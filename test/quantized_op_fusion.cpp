@@ -0,0 +1,161 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/quantized_op_fusion.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static shared_ptr<Node> dequantize(const Output<Node>& input,
+                                   float scale,
+                                   const Output<Node>& zero_point,
+                                   const AxisSet& axes = AxisSet{})
+{
+    auto scale_shape = zero_point.get_shape();
+    auto scales = op::v0::Constant::create(
+        element::f32, scale_shape, vector<float>(shape_size(scale_shape), scale));
+    return make_shared<op::v0::Dequantize>(input, scales, zero_point, element::f32, axes);
+}
+
+static shared_ptr<Node> quantize(const Output<Node>& input,
+                                 const element::Type& type,
+                                 float scale,
+                                 int zero_point)
+{
+    return make_shared<op::v0::Quantize>(
+        input,
+        op::v0::Constant::create(element::f32, Shape{}, {scale}),
+        op::v0::Constant::create(type, Shape{}, {zero_point}),
+        type,
+        AxisSet{},
+        op::v0::Quantize::RoundMode::ROUND_NEAREST_TOWARD_EVEN);
+}
+
+static void run_quantized_op_fusion(const shared_ptr<Function>& f)
+{
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::QuantizedOpFusion>();
+    pass_manager.run_passes(f);
+}
+
+// The quantized kernels round ties away from zero, Quantize rounds them to even
+static void expect_within_one_level(const vector<int>& actual, const vector<int>& expected)
+{
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < actual.size(); i++)
+    {
+        EXPECT_LE(abs(actual[i] - expected[i]), 1) << i;
+    }
+}
+
+template <typename T>
+static vector<int> to_int(const vector<T>& values)
+{
+    return vector<int>(values.begin(), values.end());
+}
+
+TEST(quantized_op_fusion, dot_u8_i8)
+{
+    auto data = make_shared<op::v0::Parameter>(element::u8, Shape{2, 3});
+    auto weights = op::v0::Constant::create(
+        element::i8, Shape{3, 4}, {1, -2, 3, -4, 5, -6, 7, -8, 9, 10, 11, 12});
+    auto dot = make_shared<op::v0::Dot>(
+        dequantize(data, 0.5f, op::v0::Constant::create(element::u8, Shape{}, {2})),
+        dequantize(weights, 0.25f, op::v0::Constant::create(element::i8, Shape{}, {0})));
+    auto f = make_shared<Function>(quantize(dot, element::i8, 0.5f, 1), ParameterVector{data});
+
+    vector<vector<uint8_t>> args{{0, 1, 2, 7, 20, 30}};
+    auto expected = execute<uint8_t, int8_t>(f, args, "INTERPRETER");
+    run_quantized_op_fusion(f);
+
+    EXPECT_EQ(count_ops_of_type<op::v0::QuantizedDot>(f), 1);
+    EXPECT_EQ(count_ops_of_type<op::v0::Dequantize>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::v0::Quantize>(f), 0);
+    auto actual = execute<uint8_t, int8_t>(f, args, "INTERPRETER");
+    expect_within_one_level(to_int(actual.at(0)), to_int(expected.at(0)));
+}
+
+TEST(quantized_op_fusion, matmul_u8_u8_with_converted_zero_point)
+{
+    // The ONNX importer converts zero points to the data type with a Convert
+    auto zero_point = make_shared<op::v0::Convert>(
+        op::v0::Constant::create(element::i32, Shape{}, {128}), element::u8);
+    auto data = make_shared<op::v0::Parameter>(element::u8, Shape{2, 2});
+    auto weights = make_shared<op::v0::Parameter>(element::u8, Shape{2, 3});
+    auto matmul = make_shared<op::v0::MatMul>(dequantize(data, 0.1f, zero_point),
+                                              dequantize(weights, 0.2f, zero_point));
+    auto f = make_shared<Function>(quantize(matmul, element::u8, 0.05f, 100),
+                                   ParameterVector{data, weights});
+
+    vector<vector<uint8_t>> args{{120, 130, 140, 128}, {100, 128, 150, 160, 128, 90}};
+    auto expected = execute<uint8_t, uint8_t>(f, args, "INTERPRETER");
+    run_quantized_op_fusion(f);
+
+    EXPECT_EQ(count_ops_of_type<op::v0::QuantizedDot>(f), 1);
+    EXPECT_EQ(count_ops_of_type<op::v0::MatMul>(f), 0);
+    auto actual = execute<uint8_t, uint8_t>(f, args, "INTERPRETER");
+    expect_within_one_level(to_int(actual.at(0)), to_int(expected.at(0)));
+}
+
+TEST(quantized_op_fusion, convolution_v1)
+{
+    auto data = make_shared<op::v0::Parameter>(element::u8, Shape{1, 1, 3, 3});
+    auto filter =
+        op::v0::Constant::create(element::i8, Shape{2, 1, 2, 2}, {1, 2, 3, 4, -1, 0, 1, 2});
+    auto conv = make_shared<op::v1::Convolution>(
+        dequantize(data, 0.5f, op::v0::Constant::create(element::u8, Shape{}, {0})),
+        dequantize(filter, 0.5f, op::v0::Constant::create(element::i8, Shape{}, {0})),
+        Strides{1, 1},
+        CoordinateDiff{1, 0},
+        CoordinateDiff{0, 1},
+        Strides{1, 1});
+    auto f = make_shared<Function>(quantize(conv, element::i8, 0.25f, 0), ParameterVector{data});
+
+    vector<vector<uint8_t>> args{{1, 2, 3, 4, 5, 6, 7, 8, 9}};
+    auto expected = execute<uint8_t, int8_t>(f, args, "INTERPRETER");
+    run_quantized_op_fusion(f);
+
+    EXPECT_EQ(count_ops_of_type<op::v0::QuantizedConvolution>(f), 1);
+    EXPECT_EQ(count_ops_of_type<op::v1::Convolution>(f), 0);
+    auto actual = execute<uint8_t, int8_t>(f, args, "INTERPRETER");
+    expect_within_one_level(to_int(actual.at(0)), to_int(expected.at(0)));
+}
+
+TEST(quantized_op_fusion, skips_per_channel_weights)
+{
+    auto data = make_shared<op::v0::Parameter>(element::u8, Shape{2, 3});
+    auto weights = make_shared<op::v0::Parameter>(element::i8, Shape{3, 4});
+    auto dot = make_shared<op::v0::Dot>(
+        dequantize(data, 0.5f, op::v0::Constant::create(element::u8, Shape{}, {0})),
+        dequantize(weights,
+                   0.25f,
+                   op::v0::Constant::create(element::i8, Shape{4}, {0, 0, 0, 0}),
+                   AxisSet{1}));
+    auto f = make_shared<Function>(quantize(dot, element::i8, 0.5f, 0),
+                                   ParameterVector{data, weights});
+    run_quantized_op_fusion(f);
+
+    EXPECT_EQ(count_ops_of_type<op::v0::QuantizedDot>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::v0::Dot>(f), 1);
+}
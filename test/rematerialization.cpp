@@ -0,0 +1,107 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/rematerialization.hpp"
+#include "util/all_close_f.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// exp(x) is used at the start of the chain and again at the end, so it is live across the
+// three-tensor peak at Sin
+static shared_ptr<Function> make_checkpoint_function()
+{
+    auto x = make_shared<op::v0::Parameter>(element::f32, Shape{1000});
+    auto a = make_shared<op::v0::Exp>(x);
+    auto b = make_shared<op::v0::Tanh>(a);
+    auto c = make_shared<op::v0::Sin>(b);
+    auto d = make_shared<op::v0::Sum>(c, AxisSet{0});
+    auto e = make_shared<op::v1::Multiply>(a, d);
+    return make_shared<Function>(e, ParameterVector{x});
+}
+
+TEST(rematerialization, recompute_late_use)
+{
+    auto f = make_checkpoint_function();
+    vector<float> input(1000);
+    for (size_t i = 0; i < input.size(); i++)
+    {
+        input[i] = (i % 17) / 17.0f - 0.5f;
+    }
+    auto expected = execute(f, vector<vector<float>>{input}, "INTERPRETER");
+
+    pass::Manager pass_manager;
+    auto rematerialization = pass_manager.register_pass<pass::Rematerialization>(10000);
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(rematerialization->get_initial_peak_bytes(), 12000);
+    EXPECT_EQ(rematerialization->get_peak_bytes(), 8004);
+    EXPECT_EQ(rematerialization->get_recomputed_count(), 1);
+    EXPECT_EQ(count_ops_of_type<op::v0::Exp>(f), 2);
+    auto multiply = f->get_results().at(0)->get_input_node_shared_ptr(0);
+    auto recomputed = multiply->get_input_node_shared_ptr(0);
+    ASSERT_TRUE(is_type<op::v0::Exp>(recomputed));
+    EXPECT_EQ(recomputed->get_control_dependencies().size(), 1);
+    EXPECT_TRUE(is_type<op::v0::Sum>(recomputed->get_control_dependencies().at(0)));
+
+    auto result = execute(f, vector<vector<float>>{input}, "INTERPRETER");
+    EXPECT_TRUE(test::all_close_f(expected.at(0), result.at(0)));
+}
+
+TEST(rematerialization, within_budget)
+{
+    auto f = make_checkpoint_function();
+
+    pass::Manager pass_manager;
+    auto rematerialization = pass_manager.register_pass<pass::Rematerialization>(12000);
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(rematerialization->get_peak_bytes(), 12000);
+    EXPECT_EQ(rematerialization->get_recomputed_count(), 0);
+    EXPECT_EQ(count_ops_of_type<op::v0::Exp>(f), 1);
+}
+
+TEST(rematerialization, keeps_stateful_ops)
+{
+    auto x = make_shared<op::v0::Parameter>(element::f32, Shape{1000});
+    auto training = op::v0::Constant::create(element::boolean, Shape{}, {1});
+    auto a = make_shared<op::v0::GenerateMask>(training,
+                                               Shape{1000},
+                                               element::f32,
+                                               1,
+                                               0.5,
+                                               true);
+    auto b = make_shared<op::v0::Tanh>(make_shared<op::v1::Multiply>(x, a));
+    auto c = make_shared<op::v0::Sin>(b);
+    auto d = make_shared<op::v0::Sum>(c, AxisSet{0});
+    auto e = make_shared<op::v1::Multiply>(a, d);
+    auto f = make_shared<Function>(e, ParameterVector{x});
+
+    pass::Manager pass_manager;
+    auto rematerialization = pass_manager.register_pass<pass::Rematerialization>(0);
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(count_ops_of_type<op::v0::GenerateMask>(f), 1);
+    EXPECT_EQ(e->get_input_node_shared_ptr(0), a);
+}
@@ -21,6 +21,7 @@
 #include "gtest/gtest.h"
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/cpio.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/op/constant.hpp"
@@ -192,6 +193,45 @@ TEST(serialize, constant)
     EXPECT_TRUE(found);
 }
 
+TEST(serialize, constant_mapped)
+{
+    const string tmp_file = "serialize_constant_mapped.cpio";
+    Shape shape{2, 2, 2};
+    auto A = op::v0::Constant::create(element::f32, shape, {1, 2, 3, 4, 5, 6, 7, 8});
+    auto B = op::v0::Constant::create(element::i32, Shape{3}, {9, 10, 11});
+    auto f = make_shared<Function>(OutputVector{A, B}, ParameterVector{});
+
+    serialize_to_cpio(tmp_file, f);
+    auto g = deserialize_mapped(tmp_file);
+    ASSERT_NE(g, nullptr);
+    size_t found = 0;
+    for (shared_ptr<Node> node : g->get_ordered_ops())
+    {
+        shared_ptr<op::v0::Constant> c = as_type_ptr<op::v0::Constant>(node);
+        if (c)
+        {
+            found++;
+            EXPECT_EQ(reinterpret_cast<size_t>(c->get_data_ptr()) %
+                          op::v0::Constant::host_alignment(),
+                      0);
+            if (c->get_output_element_type(0) == element::f32)
+            {
+                EXPECT_EQ((vector<float>{1, 2, 3, 4, 5, 6, 7, 8}), c->get_vector<float>());
+            }
+            else
+            {
+                EXPECT_EQ((vector<int32_t>{9, 10, 11}), c->get_vector<int32_t>());
+            }
+        }
+    }
+    EXPECT_EQ(found, 2);
+
+    // The mapping must outlive the file on disk
+    file_util::remove_file(tmp_file);
+    auto h = clone_function(*g);
+    EXPECT_EQ(h->get_results().size(), 2);
+}
+
 TEST(benchmark, serialize)
 {
     stopwatch timer;
@@ -211,6 +251,131 @@ TEST(benchmark, serialize)
     out << serialize(f, 4);
 }
 
+TEST(serialize, binary)
+{
+    const string tmp_file = "serialize_binary.cpio";
+    auto A = make_shared<op::v0::Parameter>(element::f32, Shape{2, 4});
+    auto B = op::v0::Constant::create(element::f32, Shape{4, 3}, vector<float>(12, 0.5f));
+    auto C = op::v0::Constant::create(element::i64, Shape{2}, {3, 2});
+    auto dot = make_shared<op::v0::Dot>(A, B);
+    auto reshape = make_shared<op::v1::Reshape>(dot, C, false);
+    reshape->set_friendly_name("output");
+    auto f = make_shared<Function>(reshape, ParameterVector{A});
+
+    serialize_binary(tmp_file, f);
+    for (auto g : {deserialize(tmp_file), deserialize_mapped(tmp_file)})
+    {
+        ASSERT_NE(g, nullptr);
+        ASSERT_EQ(g->get_ops().size(), f->get_ops().size());
+        auto result = g->get_results().at(0)->get_argument(0);
+        EXPECT_EQ(result->get_friendly_name(), "output");
+        EXPECT_EQ(result->get_output_shape(0), (Shape{3, 2}));
+        auto g_reshape = as_type_ptr<op::v1::Reshape>(result);
+        ASSERT_NE(g_reshape, nullptr);
+        EXPECT_FALSE(g_reshape->get_special_zero());
+        auto g_b = as_type_ptr<op::v0::Constant>(result->get_argument(0)->get_argument(1));
+        ASSERT_NE(g_b, nullptr);
+        EXPECT_EQ(g_b->get_vector<float>(), vector<float>(12, 0.5f));
+    }
+    file_util::remove_file(tmp_file);
+}
+
+TEST(serialize, constant_compressed)
+{
+    const string tmp_file = "serialize_constant_compressed.cpio";
+    auto A = op::v0::Constant::create(element::f32, Shape{64, 64}, vector<float>(4096, 1.5f));
+    auto B = op::v0::Constant::create(element::i32, Shape{3}, {9, 10, 11});
+    auto f = make_shared<Function>(OutputVector{A, B}, ParameterVector{});
+#ifdef NGRAPH_ZLIB_ENABLE
+    serialize_to_cpio(tmp_file, f, 0, true);
+    {
+        // B does not shrink and is stored as is
+        cpio::Reader reader(tmp_file);
+        size_t compressed_records = 0;
+        for (auto& info : reader.get_file_info())
+        {
+            if (info.get_name() == A->get_name() + ".z")
+            {
+                compressed_records++;
+                EXPECT_LT(info.get_size(), 4096 * sizeof(float));
+            }
+        }
+        EXPECT_EQ(compressed_records, 1);
+    }
+    for (auto g : {deserialize(tmp_file), deserialize_mapped(tmp_file)})
+    {
+        ASSERT_NE(g, nullptr);
+        auto g_a = as_type_ptr<op::v0::Constant>(g->get_results().at(0)->get_argument(0));
+        auto g_b = as_type_ptr<op::v0::Constant>(g->get_results().at(1)->get_argument(0));
+        ASSERT_NE(g_a, nullptr);
+        ASSERT_NE(g_b, nullptr);
+        EXPECT_EQ(g_a->get_vector<float>(), vector<float>(4096, 1.5f));
+        EXPECT_EQ(g_b->get_vector<int32_t>(), (vector<int32_t>{9, 10, 11}));
+    }
+    file_util::remove_file(tmp_file);
+#else
+    EXPECT_THROW(serialize_to_cpio(tmp_file, f, 0, true), ngraph_error);
+    file_util::remove_file(tmp_file);
+#endif
+}
+
+TEST(serialize, constant_lazy)
+{
+    const string tmp_file = "serialize_constant_lazy.cpio";
+    auto A = op::v0::Constant::create(element::f32, Shape{2, 2}, {1, 2, 3, 4});
+    auto B = op::v0::Constant::create(element::i32, Shape{3}, {7, 7, 7});
+    auto f = make_shared<Function>(OutputVector{A, B}, ParameterVector{});
+
+    serialize_to_cpio(tmp_file, f);
+    auto g = deserialize_mapped(tmp_file, true);
+    ASSERT_NE(g, nullptr);
+    auto g_a = as_type_ptr<op::v0::Constant>(g->get_results().at(0)->get_argument(0));
+    auto g_b = as_type_ptr<op::v0::Constant>(g->get_results().at(1)->get_argument(0));
+    ASSERT_NE(g_a, nullptr);
+    ASSERT_NE(g_b, nullptr);
+    EXPECT_FALSE(g_a->is_data_loaded());
+    EXPECT_FALSE(g_b->is_data_loaded());
+
+    // Cloning shares the loader rather than reading the data
+    auto h = clone_function(*g);
+    auto h_b = as_type_ptr<op::v0::Constant>(h->get_results().at(1)->get_argument(0));
+    ASSERT_NE(h_b, nullptr);
+    EXPECT_FALSE(h_b->is_data_loaded());
+
+    EXPECT_EQ(g_a->get_vector<float>(), (vector<float>{1, 2, 3, 4}));
+    EXPECT_TRUE(g_a->is_data_loaded());
+    EXPECT_FALSE(g_b->is_data_loaded());
+
+    file_util::remove_file(tmp_file);
+    EXPECT_TRUE(h_b->get_all_data_elements_bitwise_identical());
+    EXPECT_TRUE(g_b->is_data_loaded());
+    EXPECT_EQ(g_b->get_vector<int32_t>(), (vector<int32_t>{7, 7, 7}));
+}
+
+TEST(benchmark, serialize_binary)
+{
+    const string json_path = file_util::path_join(SERIALIZED_ZOO, "mxnet/LSTM_backward.json");
+    const string tmp_cpio = "benchmark_serialize_binary.cpio";
+    const string tmp_binary = "benchmark_serialize_binary.bin.cpio";
+    shared_ptr<Function> f = ngraph::deserialize(file_util::read_file_to_string(json_path));
+    serialize_to_cpio(tmp_cpio, f);
+    serialize_binary(tmp_binary, f);
+
+    stopwatch timer;
+    timer.start();
+    auto json_function = deserialize(tmp_cpio);
+    timer.stop();
+    cout << "json graph load took   " << timer.get_milliseconds() << "ms\n";
+    timer.start();
+    auto binary_function = deserialize(tmp_binary);
+    timer.stop();
+    cout << "binary graph load took " << timer.get_milliseconds() << "ms\n";
+    EXPECT_EQ(json_function->get_ops().size(), binary_function->get_ops().size());
+
+    file_util::remove_file(tmp_cpio);
+    file_util::remove_file(tmp_binary);
+}
+
 MATCHER_P2(IsOutputShape, type, shape, "")
 {
     return std::get<0>(arg) == type && std::get<1>(arg).to_shape() == shape;
@@ -879,6 +1044,52 @@ TEST(serialize, depth_to_space)
     EXPECT_EQ(depth_to_space_out->get_mode(), mode);
 }
 
+TEST(serialize, decompress_weights)
+{
+    Shape shape{4, 5};
+    auto packed = op::v0::Constant::create(
+        element::i8, op::v0::DecompressWeights::get_packed_shape(shape, 4), vector<int8_t>(12, 1));
+    auto scales = op::v0::Constant::create(element::f32, Shape{4}, {1, 2, 3, 4});
+    auto decompress = make_shared<op::v0::DecompressWeights>(packed, scales, shape, 0, 4);
+
+    auto result = make_shared<op::v0::Result>(decompress);
+    auto f = make_shared<Function>(ResultVector{result}, ParameterVector{});
+    string s = serialize(f);
+
+    shared_ptr<Function> g = deserialize(s);
+    auto g_result = g->get_results().at(0);
+    auto decompress_out =
+        as_type_ptr<op::v0::DecompressWeights>(g_result->get_input_node_shared_ptr(0));
+    ASSERT_TRUE(decompress_out);
+    EXPECT_EQ(decompress_out->get_weights_shape(), shape);
+    EXPECT_EQ(decompress_out->get_axis(), 0);
+    EXPECT_EQ(decompress_out->get_bits(), 4);
+    EXPECT_EQ(decompress_out->get_input_shape(0), (Shape{4, 3}));
+}
+
+TEST(serialize, variable)
+{
+    auto init = op::v0::Constant::create(element::f32, Shape{2}, {1, 2});
+    auto read = make_shared<op::v0::ReadVariable>(init, "weights");
+    auto assign = make_shared<op::v0::AssignVariable>(make_shared<op::v0::Negative>(read), read);
+    auto result = make_shared<op::v0::Result>(read);
+    result->add_control_dependency(assign);
+    auto f = make_shared<Function>(ResultVector{result}, ParameterVector{});
+    string s = serialize(f);
+
+    shared_ptr<Function> g = deserialize(s);
+    auto g_result = g->get_results().at(0);
+    auto read_out = as_type_ptr<op::v0::ReadVariable>(g_result->get_input_node_shared_ptr(0));
+    ASSERT_TRUE(read_out);
+    EXPECT_EQ(read_out->get_variable_id(), "weights");
+    ASSERT_EQ(g_result->get_control_dependencies().size(), 1);
+    auto assign_out =
+        as_type_ptr<op::v0::AssignVariable>(g_result->get_control_dependencies().at(0));
+    ASSERT_TRUE(assign_out);
+    EXPECT_EQ(assign_out->get_variable_id(), "weights");
+    EXPECT_EQ(assign_out->get_control_dependencies().size(), 1);
+}
+
 TEST(serialize, space_to_depth)
 {
     auto arg = make_shared<op::v0::Parameter>(element::f32, Shape{4, 6, 8});
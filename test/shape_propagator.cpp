@@ -0,0 +1,111 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "gtest/gtest.h"
+
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/shape_relevance.hpp"
+#include "ngraph/runtime/dynamic/shape_propagator.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static shared_ptr<Function> make_flagged_function(const OutputVector& results,
+                                                  const ParameterVector& params)
+{
+    auto f = make_shared<Function>(results, params);
+    pass::Manager passes;
+    passes.register_pass<pass::ShapeRelevance>();
+    passes.run_passes(f);
+    return f;
+}
+
+TEST(shape_propagator, reinfers_only_changed_nodes)
+{
+    auto a = make_shared<op::v0::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 3});
+    auto b = make_shared<op::v0::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 4});
+    auto concat = make_shared<op::v0::Concat>(OutputVector{a, a + a}, 0);
+    auto relu = make_shared<op::v0::Relu>(b);
+    auto f = make_flagged_function(OutputVector{concat, relu}, ParameterVector{a, b});
+
+    runtime::dynamic::ShapePropagator propagator(f);
+    ASSERT_TRUE(propagator.is_supported());
+
+    EXPECT_EQ(propagator.get_output_shapes({Shape{2, 3}, Shape{5, 4}}),
+              (vector<Shape>{Shape{4, 3}, Shape{5, 4}}));
+    // Add, Concat, Relu and both Results
+    EXPECT_EQ(propagator.get_last_reinferred_count(), 5);
+
+    EXPECT_EQ(propagator.get_output_shapes({Shape{7, 3}, Shape{5, 4}}),
+              (vector<Shape>{Shape{14, 3}, Shape{5, 4}}));
+    // Only the branch fed by the first parameter
+    EXPECT_EQ(propagator.get_last_reinferred_count(), 3);
+
+    // Memoized signatures do not touch the graph
+    EXPECT_EQ(propagator.get_output_shapes({Shape{2, 3}, Shape{5, 4}}),
+              (vector<Shape>{Shape{4, 3}, Shape{5, 4}}));
+    EXPECT_EQ(propagator.get_last_reinferred_count(), 3);
+
+    // The original function is left untouched
+    EXPECT_TRUE(f->get_results()[0]->get_output_partial_shape(0).is_dynamic());
+}
+
+TEST(shape_propagator, reinfers_only_readers_of_changed_outputs)
+{
+    auto x = make_shared<op::v0::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 3});
+    auto gamma = op::v0::Constant::create(element::f32, Shape{3}, {1, 1, 1});
+    auto beta = op::v0::Constant::create(element::f32, Shape{3}, {0, 0, 0});
+    auto bn = make_shared<op::v0::BatchNormTraining>(x, gamma, beta, 0.001);
+    auto normalized = make_shared<op::v0::Relu>(bn->output(0));
+    auto mean = make_shared<op::v0::Relu>(bn->output(1));
+    auto f = make_flagged_function(OutputVector{normalized, mean}, ParameterVector{x});
+
+    runtime::dynamic::ShapePropagator propagator(f);
+    EXPECT_EQ(propagator.get_output_shapes({Shape{2, 3}}),
+              (vector<Shape>{Shape{2, 3}, Shape{3}}));
+    // The batch size only changes the normalized output, the mean keeps its shape, so the
+    // branch reading the mean is never re-inferred
+    EXPECT_EQ(propagator.get_last_reinferred_count(), 3);
+
+    EXPECT_EQ(propagator.get_output_shapes({Shape{8, 3}}),
+              (vector<Shape>{Shape{8, 3}, Shape{3}}));
+    EXPECT_EQ(propagator.get_last_reinferred_count(), 3);
+}
+
+TEST(shape_propagator, recovers_after_failure)
+{
+    auto a = make_shared<op::v0::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 3});
+    auto b = make_shared<op::v0::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 3});
+    auto f = make_flagged_function(OutputVector{a + b}, ParameterVector{a, b});
+
+    runtime::dynamic::ShapePropagator propagator(f);
+    EXPECT_ANY_THROW(propagator.get_output_shapes({Shape{2, 3}, Shape{4, 3}}));
+    EXPECT_EQ(propagator.get_output_shapes({Shape{2, 3}, Shape{2, 3}}),
+              (vector<Shape>{Shape{2, 3}}));
+}
+
+TEST(shape_propagator, shape_relevant_parameter_unsupported)
+{
+    auto x = make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic());
+    auto shape = make_shared<op::v0::Parameter>(element::i64, PartialShape{2});
+    auto reshape = make_shared<op::v1::Reshape>(x, shape, false);
+    auto f = make_flagged_function(OutputVector{reshape}, ParameterVector{x, shape});
+
+    runtime::dynamic::ShapePropagator propagator(f);
+    EXPECT_FALSE(propagator.is_supported());
+    EXPECT_ANY_THROW(propagator.get_output_shapes({Shape{2, 3}, Shape{2}}));
+}
@@ -0,0 +1,141 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <memory>
+
+#include "gtest/gtest.h"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/transpose_sinking_v1.hpp"
+#include "util/test_tools.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+static shared_ptr<Node> make_transpose(const Output<Node>& arg, const AxisVector& order)
+{
+    return make_shared<op::v1::Transpose>(
+        arg, op::v0::Constant::create(element::i64, Shape{order.size()}, order));
+}
+
+static void run_transpose_sinking(shared_ptr<Function> f)
+{
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::TransposeSinkingV1>();
+    pass_manager.run_passes(f);
+}
+
+TEST(transpose_sinking_v1, inverse_transposes_cancel)
+{
+    // NHWC to NCHW and back around elementwise ops
+    auto a = make_shared<op::v0::Parameter>(element::f32, Shape{2, 4, 5, 3});
+    auto b = make_shared<op::v0::Parameter>(element::f32, Shape{2, 4, 5, 3});
+    AxisVector to_nchw{0, 3, 1, 2};
+    AxisVector to_nhwc{0, 2, 3, 1};
+    auto relu = make_shared<op::v0::Relu>(make_transpose(a, to_nchw));
+    auto add = make_shared<op::v1::Add>(relu, make_transpose(b, to_nchw));
+    auto f = make_shared<Function>(OutputVector{make_transpose(add, to_nhwc)},
+                                   ParameterVector{a, b});
+    run_transpose_sinking(f);
+
+    ASSERT_EQ(count_ops_of_type<op::v1::Transpose>(f), 0);
+    auto new_add = as_type_ptr<op::v1::Add>(f->get_results().at(0)->get_argument(0));
+    ASSERT_TRUE(new_add);
+    ASSERT_EQ(new_add->get_output_shape(0), (Shape{2, 4, 5, 3}));
+    ASSERT_EQ(new_add->get_argument(1), b);
+}
+
+TEST(transpose_sinking_v1, constant_operand)
+{
+    // The constant is transposed back, for constant folding to fold
+    auto a = make_shared<op::v0::Parameter>(element::f32, Shape{2, 3});
+    auto c = op::v0::Constant::create(element::f32, Shape{3, 2}, {1, 2, 3, 4, 5, 6});
+    auto mul = make_shared<op::v1::Multiply>(make_transpose(a, AxisVector{1, 0}), c);
+    auto f = make_shared<Function>(OutputVector{mul}, ParameterVector{a});
+    run_transpose_sinking(f);
+
+    auto t = as_type_ptr<op::v1::Transpose>(f->get_results().at(0)->get_argument(0));
+    ASSERT_TRUE(t);
+    auto new_mul = as_type_ptr<op::v1::Multiply>(t->get_argument(0));
+    ASSERT_TRUE(new_mul);
+    ASSERT_EQ(new_mul->get_argument(0), a);
+    ASSERT_EQ(new_mul->get_input_shape(1), (Shape{2, 3}));
+}
+
+TEST(transpose_sinking_v1, matmul_transpose_flags)
+{
+    auto a = make_shared<op::v0::Parameter>(element::f32, Shape{4, 2, 3});
+    auto b = make_shared<op::v0::Parameter>(element::f32, Shape{4, 5, 3});
+    auto matmul = make_shared<op::v0::MatMul>(a, make_transpose(b, AxisVector{0, 2, 1}));
+    auto f = make_shared<Function>(OutputVector{matmul}, ParameterVector{a, b});
+    run_transpose_sinking(f);
+
+    ASSERT_EQ(count_ops_of_type<op::v1::Transpose>(f), 0);
+    auto new_matmul = as_type_ptr<op::v0::MatMul>(f->get_results().at(0)->get_argument(0));
+    ASSERT_TRUE(new_matmul);
+    ASSERT_FALSE(new_matmul->get_transpose_a());
+    ASSERT_TRUE(new_matmul->get_transpose_b());
+    ASSERT_EQ(new_matmul->get_argument(1), b);
+    ASSERT_EQ(new_matmul->get_output_shape(0), (Shape{4, 2, 5}));
+}
+
+TEST(transpose_sinking_v1, transpose_with_other_users)
+{
+    // A transpose with several users stays where it is
+    auto a = make_shared<op::v0::Parameter>(element::f32, Shape{2, 3});
+    auto t = make_transpose(a, AxisVector{1, 0});
+    auto abs = make_shared<op::v0::Abs>(t);
+    auto neg = make_shared<op::v0::Negative>(t);
+    auto f = make_shared<Function>(OutputVector{abs, neg}, ParameterVector{a});
+    run_transpose_sinking(f);
+
+    ASSERT_EQ(count_ops_of_type<op::v1::Transpose>(f), 1);
+    ASSERT_EQ(abs->get_argument(0), t);
+}
+
+TEST(transpose_sinking_v1, reshape_chain)
+{
+    auto a = make_shared<op::v0::Parameter>(element::f32, Shape{1, 6, 4});
+    auto squeeze =
+        make_shared<op::v0::Squeeze>(a, op::v0::Constant::create(element::i64, Shape{1}, {0}));
+    auto reshape = make_shared<op::v1::Reshape>(
+        squeeze, op::v0::Constant::create(element::i64, Shape{3}, {2, 3, 4}), false);
+    auto unsqueeze = make_shared<op::v0::Unsqueeze>(
+        reshape, op::v0::Constant::create(element::i64, Shape{1}, {3}));
+    auto f = make_shared<Function>(OutputVector{unsqueeze}, ParameterVector{a});
+    run_transpose_sinking(f);
+
+    ASSERT_EQ(count_ops_of_type<op::v0::Squeeze>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::v0::Unsqueeze>(f), 0);
+    auto new_reshape = as_type_ptr<op::v1::Reshape>(f->get_results().at(0)->get_argument(0));
+    ASSERT_TRUE(new_reshape);
+    ASSERT_EQ(new_reshape->get_argument(0), a);
+    ASSERT_EQ(new_reshape->get_output_shape(0), (Shape{2, 3, 4, 1}));
+}
+
+TEST(transpose_sinking_v1, identity_squeeze_unsqueeze)
+{
+    auto a = make_shared<op::v0::Parameter>(element::f32, Shape{1, 6});
+    auto axes = op::v0::Constant::create(element::i64, Shape{1}, {0});
+    auto squeeze = make_shared<op::v0::Squeeze>(a, axes);
+    auto unsqueeze = make_shared<op::v0::Unsqueeze>(squeeze, axes);
+    auto abs = make_shared<op::v0::Abs>(unsqueeze);
+    auto f = make_shared<Function>(OutputVector{abs}, ParameterVector{a});
+    run_transpose_sinking(f);
+
+    ASSERT_EQ(abs->get_argument(0), a);
+}
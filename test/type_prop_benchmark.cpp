@@ -73,3 +73,29 @@ TEST(type_prop, DISABLED_benchmark_type_prop_convolution)
     std::cout << "Constructed " << std::fixed << num_iterations << " Convolution ops in "
               << std::fixed << total_nanosec << " ns" << std::endl;
 }
+
+TEST(type_prop, DISABLED_benchmark_type_prop_reduction)
+{
+    auto p = make_shared<op::v0::Parameter>(element::f32, Shape{8, 16, 32, 64});
+    auto axes = op::v0::Constant::create(element::i64, Shape{2}, {1, 3});
+
+    constexpr size_t num_iterations = 1000000;
+    size_t total_nanosec = 0;
+
+    stopwatch sw;
+
+    for (size_t i = 0; i < num_iterations; i++)
+    {
+        sw.start();
+        auto sum = make_shared<op::v1::ReduceSum>(p, axes, true);
+        auto softmax = make_shared<op::v0::Softmax>(sum, AxisSet{1, 3});
+        auto reduction_axes = sum->get_reduction_axes();
+        sw.stop();
+
+        total_nanosec += sw.get_nanoseconds();
+    }
+
+    std::cout.imbue(std::locale(""));
+    std::cout << "Constructed " << std::fixed << num_iterations << " ReduceSum and Softmax ops in "
+              << std::fixed << total_nanosec << " ns" << std::endl;
+}
@@ -29,6 +29,7 @@
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
 #include "ngraph/serializer.hpp"
+#include "ngraph/specialize_function.hpp"
 #include "util/all_close.hpp"
 #include "util/autodiff/backprop_function.hpp"
 #include "util/ndarray.hpp"
@@ -285,6 +286,26 @@ TEST(util, round_up)
     EXPECT_EQ(8, round_up(5, 4));
 }
 
+TEST(util, parallel_for)
+{
+    for (size_t num_threads : {1, 4})
+    {
+        vector<size_t> visits(1000);
+        parallel_for(visits.size(), num_threads, [&](size_t i) { visits[i]++; });
+        EXPECT_EQ(visits, vector<size_t>(1000, 1));
+
+        EXPECT_THROW(parallel_for(100,
+                                  num_threads,
+                                  [](size_t i) {
+                                      if (i == 57)
+                                      {
+                                          throw runtime_error("failed");
+                                      }
+                                  }),
+                     runtime_error);
+    }
+}
+
 TEST(util, parse_string)
 {
     EXPECT_FLOAT_EQ(2, parse_string<float>("2"));
@@ -692,6 +713,145 @@ TEST(util, clone_function_op_annotations)
     EXPECT_TRUE(found_B);
 }
 
+namespace
+{
+    // Counts its type inferences
+    class ValidationCountingOp : public op::v0::Abs
+    {
+    public:
+        ValidationCountingOp(const Output<Node>& arg)
+            : Abs(arg)
+        {
+            constructor_validate_and_infer_types();
+        }
+
+        static constexpr NodeTypeInfo type_info{"ValidationCountingOp", 0};
+        const NodeTypeInfo& get_type_info() const override { return type_info; }
+        void validate_and_infer_types() override
+        {
+            s_validations++;
+            Abs::validate_and_infer_types();
+        }
+        shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override
+        {
+            return make_shared<ValidationCountingOp>(new_args.at(0));
+        }
+
+        static size_t s_validations;
+    };
+
+    constexpr NodeTypeInfo ValidationCountingOp::type_info;
+    size_t ValidationCountingOp::s_validations = 0;
+}
+
+TEST(util, clone_function_reuses_output_types)
+{
+    auto A = make_shared<op::v0::Parameter>(element::f32, PartialShape{2, Dimension::dynamic()});
+    auto B = make_shared<ValidationCountingOp>(make_shared<ValidationCountingOp>(A));
+    auto f = make_shared<Function>(B, ParameterVector{A});
+
+    ValidationCountingOp::s_validations = 0;
+    auto g = clone_function(*f);
+    EXPECT_EQ(ValidationCountingOp::s_validations, 0);
+    EXPECT_TRUE(g->get_output_partial_shape(0).same_scheme(PartialShape{2, Dimension::dynamic()}));
+
+    // Specializing to the same types also keeps them
+    g = specialize_function(f,
+                            {element::f32},
+                            {PartialShape{2, Dimension::dynamic()}},
+                            vector<void*>{nullptr});
+    EXPECT_EQ(ValidationCountingOp::s_validations, 0);
+
+    // A new shape is propagated
+    g = specialize_function(f, {element::f32}, {PartialShape{2, 3}}, vector<void*>{nullptr});
+    EXPECT_EQ(ValidationCountingOp::s_validations, 2);
+    EXPECT_EQ(g->get_output_shape(0), (Shape{2, 3}));
+
+    // As are types changed in the original without revalidation
+    ValidationCountingOp::s_validations = 0;
+    A->set_partial_shape(PartialShape{2, 4});
+    g = clone_function(*f);
+    EXPECT_EQ(ValidationCountingOp::s_validations, 2);
+    EXPECT_EQ(g->get_output_shape(0), (Shape{2, 4}));
+}
+
+TEST(util, clone_function_topk_v1)
+{
+    auto A = make_shared<op::v0::Parameter>(element::f32, Shape{2, 5});
+    auto k = op::v0::Constant::create(element::i64, Shape{}, {3});
+    auto topk = make_shared<op::v1::TopK>(A, k, -1, "max", "value");
+    auto f = make_shared<Function>(topk->outputs(), ParameterVector{A});
+
+    auto g = clone_function(*f);
+    auto clone = as_type_ptr<op::v1::TopK>(g->get_results().at(0)->get_argument(0));
+    ASSERT_TRUE(clone);
+    EXPECT_EQ(clone->get_axis(), 1);
+}
+
+TEST(util, clone_function_reverse_sequence)
+{
+    auto A = make_shared<op::v0::Parameter>(element::f32, Shape{4, 3, 2});
+    auto lengths = make_shared<op::v0::Parameter>(element::i32, Shape{3});
+    auto reverse = make_shared<op::v0::ReverseSequence>(A, lengths, -2, 0);
+    auto f = make_shared<Function>(reverse, ParameterVector{A, lengths});
+
+    auto g = clone_function(*f);
+    auto clone = as_type_ptr<op::v0::ReverseSequence>(g->get_results().at(0)->get_argument(0));
+    ASSERT_TRUE(clone);
+    EXPECT_EQ(clone->get_batch_axis(), 1);
+    EXPECT_EQ(clone->get_sequence_axis(), 0);
+}
+
+TEST(util, clone_function_group_convolution)
+{
+    auto data = make_shared<op::v0::Parameter>(element::f32, Shape{1, 4, 5, 5});
+    auto filters = make_shared<op::v0::Parameter>(element::f32, Shape{2, 3, 2, 3, 3});
+    auto conv = make_shared<op::v0::GroupConvolution>(data,
+                                                      filters,
+                                                      Strides{1, 1},
+                                                      Strides{1, 1},
+                                                      CoordinateDiff{0, 0},
+                                                      CoordinateDiff{0, 0},
+                                                      Strides{1, 1});
+    auto f = make_shared<Function>(conv, ParameterVector{data, filters});
+
+    auto g = clone_function(*f);
+    auto clone = as_type_ptr<op::v0::GroupConvolution>(g->get_results().at(0)->get_argument(0));
+    ASSERT_TRUE(clone);
+    EXPECT_EQ(clone->get_groups(), 2);
+    EXPECT_EQ(g->get_output_shape(0), (Shape{1, 6, 3, 3}));
+}
+
+TEST(util, validate_revalidates_stale_nodes)
+{
+    auto A = make_shared<op::v0::Parameter>(element::f32, Shape{2, 3});
+    auto B = make_shared<ValidationCountingOp>(A);
+    auto C = make_shared<ValidationCountingOp>(B);
+    auto D = make_shared<ValidationCountingOp>(C);
+    auto f = make_shared<Function>(D, ParameterVector{A});
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Validate>();
+
+    // Nothing changed since construction
+    ValidationCountingOp::s_validations = 0;
+    pass_manager.run_passes(f);
+    EXPECT_EQ(ValidationCountingOp::s_validations, 0);
+
+    // A replacement of the same type stops at its users
+    C->input(0).replace_source_output(
+        op::v0::Constant::create(element::f32, Shape{2, 3}, vector<float>(6, 1)));
+    pass_manager.run_passes(f);
+    EXPECT_EQ(ValidationCountingOp::s_validations, 1);
+
+    // A new shape reaches the results
+    ValidationCountingOp::s_validations = 0;
+    A->set_partial_shape(PartialShape{4, 5});
+    C->input(0).replace_source_output(B);
+    pass_manager.run_passes(f);
+    EXPECT_EQ(ValidationCountingOp::s_validations, 3);
+    EXPECT_EQ(f->get_output_shape(0), (Shape{4, 5}));
+}
+
 TEST(util, topological_sort_replace)
 {
     Shape shape{2, 2};
@@ -712,6 +872,39 @@ TEST(util, topological_sort_replace)
     EXPECT_TRUE(custom_sorter_used);
 }
 
+TEST(util, ordered_ops_cache)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto B = make_shared<op::v0::Parameter>(element::f32, shape);
+    auto add = A + B;
+    auto abs = make_shared<op::v0::Abs>(add);
+    auto f = make_shared<Function>(abs, ParameterVector{A, B});
+
+    auto ordered = f->get_ordered_ops();
+    EXPECT_EQ(ordered, topological_sort(NodeVector{f->get_results().at(0), A, B}));
+    vector<Node*> ordered_ptrs = f->get_ordered_op_ptrs();
+    ASSERT_EQ(ordered_ptrs.size(), ordered.size());
+    for (size_t i = 0; i < ordered.size(); i++)
+    {
+        EXPECT_EQ(ordered_ptrs[i], ordered[i].get());
+    }
+
+    // Replacing a node invalidates the cached order
+    auto mul = A * B;
+    replace_node(add, mul);
+    ordered = f->get_ordered_ops();
+    EXPECT_EQ(find(ordered.begin(), ordered.end(), add), ordered.end());
+    EXPECT_LT(find(ordered.begin(), ordered.end(), mul), find(ordered.begin(), ordered.end(), abs));
+
+    // So does adding a control dependency
+    auto neg = make_shared<op::v0::Negative>(B);
+    abs->add_control_dependency(neg);
+    ordered = f->get_ordered_ops();
+    EXPECT_LT(find(ordered.begin(), ordered.end(), neg), find(ordered.begin(), ordered.end(), abs));
+    EXPECT_EQ(ordered.size(), 6);
+}
+
 TEST(util, double_to_int_limits)
 {
     auto round_func = [](double x) { return std::round(x); };
@@ -816,3 +1009,38 @@ TEST(util, double_to_int)
     EXPECT_TRUE(double_to_int<int32_t>(x, floor_func) == 1);
     EXPECT_TRUE(double_to_int<int32_t>(x, round_func) == 2);
 }
+
+TEST(util, axis_set)
+{
+    AxisSet axes{3, 1, 2, 1};
+    EXPECT_EQ((vector<size_t>{1, 2, 3}), vector<size_t>(axes.begin(), axes.end()));
+    EXPECT_EQ(3, *axes.rbegin());
+    EXPECT_EQ(1, axes.count(2));
+    EXPECT_EQ(0, axes.count(0));
+    EXPECT_FALSE(axes.insert(2).second);
+
+    // More axes than fit inline, some past the bit mask
+    AxisSet many;
+    for (size_t axis = 20; axis-- > 0;)
+    {
+        many.insert(axis);
+    }
+    many.insert(100);
+    many.insert(70);
+    EXPECT_EQ(22, many.size());
+    EXPECT_EQ(1, many.count(70));
+    EXPECT_EQ(0, many.count(71));
+    EXPECT_EQ(100, *many.rbegin());
+
+    AxisSet copy = many;
+    EXPECT_EQ(many, copy);
+    EXPECT_EQ(1, copy.erase(5));
+    EXPECT_EQ(0, copy.count(5));
+    EXPECT_NE(many, copy);
+    AxisSet moved = std::move(copy);
+    EXPECT_EQ(21, moved.size());
+
+    std::set<size_t> std_set = moved;
+    EXPECT_EQ(moved, AxisSet(std_set));
+    EXPECT_LT(AxisSet({1, 2}), AxisSet({1, 3}));
+}
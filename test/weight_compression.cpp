@@ -0,0 +1,136 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/ngraph.hpp"
+#include "ngraph/op/experimental/decompress_weights.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/weight_compression.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static vector<float> random_vector(size_t size, float low, float high, unsigned seed)
+{
+    default_random_engine engine(seed);
+    uniform_real_distribution<float> distribution(low, high);
+    vector<float> values(size);
+    generate(values.begin(), values.end(), [&]() { return distribution(engine); });
+    return values;
+}
+
+static float max_abs(const vector<float>& values)
+{
+    float result = 0;
+    for (float value : values)
+    {
+        result = max(result, abs(value));
+    }
+    return result;
+}
+
+TEST(weight_compression, dot_8bit)
+{
+    Shape shape_data{3, 64};
+    Shape shape_weights{64, 20};
+    auto weights = random_vector(shape_size(shape_weights), -1.0f, 1.0f, 0);
+    auto data = make_shared<op::v0::Parameter>(element::f32, shape_data);
+    auto dot = make_shared<op::v0::Dot>(
+        data, op::v0::Constant::create(element::f32, shape_weights, weights));
+    auto f = make_shared<Function>(dot, ParameterVector{data});
+    auto input = random_vector(shape_size(shape_data), -1.0f, 1.0f, 1);
+    auto expected = execute(f, vector<vector<float>>{input}, "INTERPRETER");
+
+    pass::Manager pass_manager;
+    auto compression = pass_manager.register_pass<pass::WeightCompression>(8, 0);
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(compression->get_compressed_count(), 1);
+    EXPECT_EQ(compression->get_saved_bytes(),
+              shape_size(shape_weights) * 4 - shape_size(shape_weights) - 20 * 4);
+    auto decompress = as_type_ptr<op::v0::DecompressWeights>(dot->get_input_node_shared_ptr(1));
+    ASSERT_TRUE(decompress);
+    EXPECT_EQ(decompress->get_axis(), 1);
+    EXPECT_EQ(decompress->get_input_element_type(0), element::i8);
+    EXPECT_EQ(decompress->get_input_shape(0), shape_weights);
+    EXPECT_EQ(decompress->get_input_shape(1), Shape{20});
+
+    // Each weight is off by at most half a quantization step of its column
+    auto actual = execute(f, vector<vector<float>>{input}, "INTERPRETER");
+    float bound = shape_data[1] * max_abs(input) * max_abs(weights) / 127.0f / 2.0f;
+    for (size_t i = 0; i < actual[0].size(); i++)
+    {
+        EXPECT_LE(abs(actual[0][i] - expected[0][i]), bound);
+    }
+}
+
+TEST(weight_compression, embedding_lookup_4bit)
+{
+    // Every row is a multiple of its scale, max(abs(row)) / 7, so 4 bits represent it exactly.
+    // The odd row length leaves half of the last byte of each packed row unused.
+    Shape shape_weights{6, 5};
+    vector<float> weights{-7, -6, -5, -4, -3, 0,  0.5f, 1, 1.5f, 3.5f, 3, 4, 5, 6, 7,
+                          14, 12, 10, 8,  6,  7,  2,    0, -2,   -7,   -14, -8, 0, 4, 6};
+    auto indices = make_shared<op::v0::Parameter>(element::i32, Shape{4});
+    auto lookup = make_shared<op::v0::EmbeddingLookup>(
+        indices, op::v0::Constant::create(element::f32, shape_weights, weights));
+    auto f = make_shared<Function>(lookup, ParameterVector{indices});
+
+    pass::Manager pass_manager;
+    auto compression = pass_manager.register_pass<pass::WeightCompression>(4, 0);
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(compression->get_compressed_count(), 1);
+    auto decompress =
+        as_type_ptr<op::v0::DecompressWeights>(lookup->get_input_node_shared_ptr(1));
+    ASSERT_TRUE(decompress);
+    EXPECT_EQ(decompress->get_axis(), 0);
+    EXPECT_EQ(decompress->get_input_shape(0), (Shape{6, 3}));
+
+    auto actual = execute<int32_t, float>(f, vector<vector<int32_t>>{{5, 0, 1, 5}}, "INTERPRETER");
+    vector<float> expected{-14, -8, 0, 4, 6, -7, -6, -5, -4, -3,
+                           0,   0.5f, 1, 1.5f, 3.5f, -14, -8, 0, 4, 6};
+    EXPECT_EQ(actual[0], expected);
+}
+
+TEST(weight_compression, skips_small_and_shared_constants)
+{
+    auto data = make_shared<op::v0::Parameter>(element::f32, Shape{2, 64});
+    auto shared_weights =
+        op::v0::Constant::create(element::f32, Shape{64, 64}, random_vector(64 * 64, -1, 1, 2));
+    auto small_weights =
+        op::v0::Constant::create(element::f32, Shape{64, 2}, random_vector(64 * 2, -1, 1, 3));
+    // shared_weights also feeds the Add, so its f32 data has to stay
+    auto dot = make_shared<op::v0::Dot>(data, shared_weights);
+    auto add = make_shared<op::v1::Add>(shared_weights, shared_weights);
+    auto small_dot = make_shared<op::v0::Dot>(data, small_weights);
+    auto f = make_shared<Function>(OutputVector{dot, add, small_dot}, ParameterVector{data});
+
+    pass::Manager pass_manager;
+    auto compression = pass_manager.register_pass<pass::WeightCompression>(8, 1024);
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(compression->get_compressed_count(), 0);
+    EXPECT_EQ(count_ops_of_type<op::v0::DecompressWeights>(f), 0);
+}